@@ -0,0 +1,141 @@
+#include "storm-bench/Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace bench {
+
+namespace {
+std::vector<std::pair<std::string, std::function<void(BenchmarkState&)>>>& getRegistry() {
+    // Constructed on first use as benchmarks register themselves during static initialization.
+    static std::vector<std::pair<std::string, std::function<void(BenchmarkState&)>>> registry;
+    return registry;
+}
+
+double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    uint64_t const middle = values.size() / 2;
+    return values.size() % 2 == 1 ? values[middle] : (values[middle - 1] + values[middle]) / 2;
+}
+}  // namespace
+
+BenchmarkState::BenchmarkState(BenchmarkOptions const& options) : options(options), itemsPerRun(0) {
+    // Intentionally left empty.
+}
+
+BenchmarkOptions const& BenchmarkState::getOptions() const {
+    return options;
+}
+
+void BenchmarkState::measure(std::function<void()> const& run, bool expensive) {
+    double totalSeconds = 0;
+    while (expensive ? seconds.size() < options.macroRepetitions : (seconds.size() < options.minimalRepetitions || totalSeconds < options.minimalSeconds)) {
+        auto start = std::chrono::steady_clock::now();
+        run();
+        std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+        seconds.push_back(duration.count());
+        totalSeconds += duration.count();
+    }
+}
+
+void BenchmarkState::setItemsPerRun(uint64_t items) {
+    itemsPerRun = items;
+}
+
+void BenchmarkState::addCounter(std::string const& name, double value) {
+    counters[name] = value;
+}
+
+void BenchmarkState::skip(std::string const& reason) {
+    skipReason = reason;
+}
+
+storm::json<double> BenchmarkState::toJson() const {
+    storm::json<double> result;
+    if (!skipReason.empty()) {
+        result["skipped"] = skipReason;
+        return result;
+    }
+    result["repetitions"] = seconds.size();
+    if (!seconds.empty()) {
+        result["min-seconds"] = *std::min_element(seconds.begin(), seconds.end());
+        result["median-seconds"] = median(seconds);
+        result["mean-seconds"] = std::accumulate(seconds.begin(), seconds.end(), 0.0) / seconds.size();
+        if (itemsPerRun > 0) {
+            result["items-per-run"] = itemsPerRun;
+            result["items-per-second"] = itemsPerRun / median(seconds);
+        }
+    }
+    for (auto const& counter : counters) {
+        result["counters"][counter.first] = counter.second;
+    }
+    return result;
+}
+
+std::string BenchmarkState::toString() const {
+    std::stringstream stream;
+    if (!skipReason.empty()) {
+        stream << "skipped (" << skipReason << ")";
+    } else if (seconds.empty()) {
+        stream << "no measurements";
+    } else {
+        stream << std::fixed << std::setprecision(6) << "median " << median(seconds) << "s over " << seconds.size() << " runs";
+        if (itemsPerRun > 0) {
+            stream << std::setprecision(0) << ", " << itemsPerRun / median(seconds) << " items/s";
+        }
+    }
+    return stream.str();
+}
+
+void registerBenchmark(std::string const& name, std::function<void(BenchmarkState&)> const& benchmark) {
+    getRegistry().emplace_back(name, benchmark);
+}
+
+std::vector<std::string> getBenchmarkNames() {
+    std::vector<std::string> names;
+    for (auto const& benchmark : getRegistry()) {
+        names.push_back(benchmark.first);
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+storm::json<double> runBenchmarks(BenchmarkOptions const& options, std::string const& filter) {
+    // Run the benchmarks in a fixed order, independent of the order of static initialization.
+    auto registry = getRegistry();
+    std::sort(registry.begin(), registry.end(), [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+
+    storm::json<double> results;
+    results["context"]["seed"] = options.seed;
+    results["context"]["threads"] = options.numberOfThreads;
+    results["context"]["minimal-repetitions"] = options.minimalRepetitions;
+    results["context"]["minimal-seconds"] = options.minimalSeconds;
+    results["context"]["macro-repetitions"] = options.macroRepetitions;
+    results["benchmarks"] = storm::json<double>::array();
+    for (auto const& benchmark : registry) {
+        if (benchmark.first.find(filter) == std::string::npos) {
+            continue;
+        }
+        BenchmarkState state(options);
+        try {
+            benchmark.second(state);
+        } catch (std::exception const& e) {
+            state.skip(std::string("failed: ") + e.what());
+        }
+        STORM_PRINT(std::left << std::setw(60) << benchmark.first << " " << state.toString() << '\n');
+        storm::json<double> result = state.toJson();
+        result["name"] = benchmark.first;
+        results["benchmarks"].push_back(std::move(result));
+    }
+    return results;
+}
+
+}  // namespace bench
+}  // namespace storm
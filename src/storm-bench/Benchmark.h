@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "storm/adapters/JsonAdapter.h"
+
+namespace storm {
+namespace bench {
+
+/*!
+ * Options that are shared by all benchmarks. All randomness of the benchmarks is derived from the seed such that runs are reproducible.
+ */
+struct BenchmarkOptions {
+    // Seed of the random number generators used for creating inputs.
+    uint64_t seed = 42;
+    // Number of threads that solvers and decompositions may use.
+    uint64_t numberOfThreads = 1;
+    // The code of a (micro) benchmark is run at least this often...
+    uint64_t minimalRepetitions = 5;
+    // ... and until at least this many seconds have passed.
+    double minimalSeconds = 0.5;
+    // The number of runs of expensive (macro) benchmarks.
+    uint64_t macroRepetitions = 1;
+};
+
+/*!
+ * Passed to a benchmark which uses it to time (repeated) runs of the code under consideration. The setup of the benchmark is not timed.
+ */
+class BenchmarkState {
+   public:
+    BenchmarkState(BenchmarkOptions const& options);
+
+    BenchmarkOptions const& getOptions() const;
+
+    /*!
+     * Runs the given code repeatedly and records the time of each run.
+     *
+     * @param run The code to time.
+     * @param expensive If true, the code is run exactly as often as specified for macro benchmarks.
+     */
+    void measure(std::function<void()> const& run, bool expensive = false);
+
+    /*!
+     * Sets the number of items (e.g. matrix entries or states) that are processed by a single run. The throughput is then reported as well.
+     */
+    void setItemsPerRun(uint64_t items);
+
+    /*!
+     * Adds a named value that is reported along with the times, e.g. the size of the input or the result of a computation.
+     */
+    void addCounter(std::string const& name, double value);
+
+    /*!
+     * Marks the benchmark as skipped, e.g. because required inputs or solvers are not available.
+     */
+    void skip(std::string const& reason);
+
+    /*!
+     * Retrieves the results of the benchmark as a json object.
+     */
+    storm::json<double> toJson() const;
+
+    /*!
+     * Retrieves a one-line summary of the results.
+     */
+    std::string toString() const;
+
+   private:
+    BenchmarkOptions const& options;
+    std::vector<double> seconds;
+    uint64_t itemsPerRun;
+    std::map<std::string, double> counters;
+    std::string skipReason;
+};
+
+/*!
+ * Registers a benchmark under the given name. Names are hierarchical with '/' as separator, e.g., 'BitVector/complement'.
+ */
+void registerBenchmark(std::string const& name, std::function<void(BenchmarkState&)> const& benchmark);
+
+/*!
+ * Runs all registered benchmarks whose name contains the given filter and returns their results.
+ */
+storm::json<double> runBenchmarks(BenchmarkOptions const& options, std::string const& filter);
+
+/*!
+ * Retrieves the names of all registered benchmarks.
+ */
+std::vector<std::string> getBenchmarkNames();
+
+}  // namespace bench
+}  // namespace storm
+
+// Defines and registers a benchmark. The body of the benchmark follows the macro and has access to a BenchmarkState named 'state'.
+#define STORM_BENCHMARK(identifier, name)                                                                                                     \
+    static void identifier(storm::bench::BenchmarkState& state);                                                                              \
+    static bool const identifier##Registered = (storm::bench::registerBenchmark(name, identifier), true);                                    \
+    static void identifier(storm::bench::BenchmarkState& state)
@@ -0,0 +1,413 @@
+#include "storm-bench/Benchmark.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "storm-config.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/multiplier/Multiplier.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+namespace storm {
+namespace bench {
+namespace {
+
+uint64_t const matrixStates = 1ull << 18;
+uint64_t const bitVectorSize = 1ull << 24;
+
+/*!
+ * Creates a matrix with (at most) the given number of entries per row. Like in matrices of built models, the successors of a state are close to the state.
+ * The generator is specified by the standard, so the matrix only depends on the seed.
+ */
+storm::storage::SparseMatrix<double> createRandomMatrix(uint64_t numberOfStates, uint64_t choicesPerState, uint64_t entriesPerRow, uint64_t seed) {
+    uint64_t const bandWidth = 4096;
+    std::mt19937_64 generator(seed);
+    bool const hasGroups = choicesPerState > 1;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates * choicesPerState, numberOfStates, numberOfStates * choicesPerState * entriesPerRow,
+                                                        true, hasGroups, hasGroups ? numberOfStates : 0);
+    std::vector<uint64_t> columns;
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (hasGroups) {
+            builder.newRowGroup(row);
+        }
+        for (uint64_t choice = 0; choice < choicesPerState; ++choice, ++row) {
+            columns.clear();
+            for (uint64_t entry = 0; entry < entriesPerRow; ++entry) {
+                columns.push_back((state + generator() % bandWidth) % numberOfStates);
+            }
+            std::sort(columns.begin(), columns.end());
+            columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+            double const probability = 1.0 / columns.size();
+            for (auto column : columns) {
+                builder.addNextValue(row, column, probability);
+            }
+        }
+    }
+    return builder.build();
+}
+
+storm::storage::BitVector createRandomBitVector(uint64_t size, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    storm::storage::BitVector result(size);
+    for (uint64_t index = 0; index + 64 <= size; index += 64) {
+        result.setFromInt(index, 64, generator());
+    }
+    return result;
+}
+
+std::shared_ptr<storm::models::sparse::Model<double>> buildModel(std::string const& file, std::string const& propertyString) {
+    storm::prism::Program program = storm::api::parseProgram(file);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(propertyString, program));
+    return storm::api::buildSparseModel<double>(program, formulas);
+}
+
+void benchmarkMultiply(BenchmarkState& state, storm::solver::MultiplierType type, bool splitStorage, uint64_t choicesPerState, uint64_t blockSize) {
+    auto matrix = createRandomMatrix(matrixStates, choicesPerState, 8, state.getOptions().seed);
+    storm::Environment env;
+    env.solver().multiplier().setType(type);
+    env.solver().multiplier().setSplitStorage(splitStorage);
+    auto multiplier = storm::solver::MultiplierFactory<double>().create(env, matrix);
+    std::vector<double> x(matrix.getColumnCount() * blockSize, 0.5);
+    std::vector<double> result(matrix.getRowCount() * blockSize);
+    state.setItemsPerRun(matrix.getEntryCount() * blockSize);
+    if (blockSize > 1) {
+        if (choicesPerState > 1) {
+            state.measure([&]() { multiplier->multiplyAndReduceBlock(env, storm::OptimizationDirection::Maximize, blockSize, x, nullptr, result); });
+        } else {
+            state.measure([&]() { multiplier->multiplyBlock(env, blockSize, x, nullptr, result); });
+        }
+    } else if (choicesPerState > 1) {
+        state.measure([&]() { multiplier->multiplyAndReduce(env, storm::OptimizationDirection::Maximize, x, nullptr, result); });
+    } else {
+        state.measure([&]() { multiplier->multiply(env, x, nullptr, result); });
+    }
+}
+
+STORM_BENCHMARK(multiplyNative, "SparseMatrix/multiply/native") {
+    benchmarkMultiply(state, storm::solver::MultiplierType::Native, false, 1, 1);
+}
+
+STORM_BENCHMARK(multiplyNativeSplit, "SparseMatrix/multiply/native-split") {
+    benchmarkMultiply(state, storm::solver::MultiplierType::Native, true, 1, 1);
+}
+
+STORM_BENCHMARK(multiplySimd, "SparseMatrix/multiply/simd") {
+    benchmarkMultiply(state, storm::solver::MultiplierType::Simd, false, 1, 1);
+}
+
+STORM_BENCHMARK(multiplyGmmxx, "SparseMatrix/multiply/gmmxx") {
+    benchmarkMultiply(state, storm::solver::MultiplierType::Gmmxx, false, 1, 1);
+}
+
+STORM_BENCHMARK(multiplyBlock, "SparseMatrix/multiply/native-block4") {
+    benchmarkMultiply(state, storm::solver::MultiplierType::Native, false, 1, 4);
+}
+
+STORM_BENCHMARK(multiplyAndReduceNative, "SparseMatrix/multiplyAndReduce/native") {
+    benchmarkMultiply(state, storm::solver::MultiplierType::Native, false, 4, 1);
+}
+
+STORM_BENCHMARK(multiplyAndReduceSimd, "SparseMatrix/multiplyAndReduce/simd") {
+    benchmarkMultiply(state, storm::solver::MultiplierType::Simd, false, 4, 1);
+}
+
+STORM_BENCHMARK(multiplyAndReduceBlock, "SparseMatrix/multiplyAndReduce/native-block4") {
+    benchmarkMultiply(state, storm::solver::MultiplierType::Native, false, 4, 4);
+}
+
+STORM_BENCHMARK(transpose, "SparseMatrix/transpose") {
+    auto matrix = createRandomMatrix(matrixStates, 1, 8, state.getOptions().seed);
+    state.setItemsPerRun(matrix.getEntryCount());
+    state.measure([&]() { matrix.transpose(); });
+}
+
+STORM_BENCHMARK(bitVectorAnd, "BitVector/and") {
+    auto first = createRandomBitVector(bitVectorSize, state.getOptions().seed);
+    auto second = createRandomBitVector(bitVectorSize, state.getOptions().seed + 1);
+    state.setItemsPerRun(bitVectorSize);
+    state.measure([&]() { first &= second; });
+}
+
+STORM_BENCHMARK(bitVectorAndNot, "BitVector/andNot") {
+    auto first = createRandomBitVector(bitVectorSize, state.getOptions().seed);
+    auto second = createRandomBitVector(bitVectorSize, state.getOptions().seed + 1);
+    state.setItemsPerRun(bitVectorSize);
+    state.measure([&]() { first.andNot(second); });
+}
+
+STORM_BENCHMARK(bitVectorSubset, "BitVector/isSubsetOf") {
+    auto first = createRandomBitVector(bitVectorSize, state.getOptions().seed);
+    auto second = first | createRandomBitVector(bitVectorSize, state.getOptions().seed + 1);
+    state.setItemsPerRun(bitVectorSize);
+    bool subset = false;
+    state.measure([&]() { subset = first.isSubsetOf(second); });
+    state.addCounter("subset", subset);
+}
+
+STORM_BENCHMARK(bitVectorComplement, "BitVector/complement") {
+    auto bitVector = createRandomBitVector(bitVectorSize, state.getOptions().seed);
+    state.setItemsPerRun(bitVectorSize);
+    state.measure([&]() { bitVector.complement(); });
+}
+
+STORM_BENCHMARK(bitVectorCount, "BitVector/numberOfSetBits") {
+    auto bitVector = createRandomBitVector(bitVectorSize, state.getOptions().seed);
+    state.setItemsPerRun(bitVectorSize);
+    uint64_t count = 0;
+    state.measure([&]() { count = bitVector.getNumberOfSetBits(); });
+    state.addCounter("set-bits", count);
+}
+
+STORM_BENCHMARK(bitVectorIterate, "BitVector/iterateSetBits") {
+    auto bitVector = createRandomBitVector(bitVectorSize, state.getOptions().seed);
+    state.setItemsPerRun(bitVectorSize);
+    uint64_t sum = 0;
+    state.measure([&]() {
+        sum = 0;
+        for (auto index : bitVector) {
+            sum += index;
+        }
+    });
+    state.addCounter("sum", sum);
+}
+
+STORM_BENCHMARK(bitVectorForEachSetBit, "BitVector/forEachSetBit") {
+    auto bitVector = createRandomBitVector(bitVectorSize, state.getOptions().seed);
+    state.setItemsPerRun(bitVectorSize);
+    uint64_t sum = 0;
+    state.measure([&]() {
+        sum = 0;
+        bitVector.forEachSetBit([&sum](uint64_t index) { sum += index; });
+    });
+    state.addCounter("sum", sum);
+}
+
+STORM_BENCHMARK(bitVectorRank, "BitVector/rankIndex") {
+    auto bitVector = createRandomBitVector(bitVectorSize, state.getOptions().seed);
+    uint64_t const numberOfQueries = 1ull << 16;
+    state.setItemsPerRun(numberOfQueries);
+    uint64_t sum = 0;
+    state.measure([&]() {
+        storm::storage::BitVectorRankIndex rankIndex(bitVector);
+        sum = 0;
+        for (uint64_t query = 0; query < numberOfQueries; ++query) {
+            sum += rankIndex.getNumberOfSetBitsBeforeIndex((query * 2654435761ull) % bitVectorSize);
+        }
+    });
+    state.addCounter("sum", sum);
+}
+
+/*!
+ * Creates keys like the ones of a state storage: most of the bits are random, but the keys are not distinct.
+ */
+std::vector<storm::storage::BitVector> createHashMapKeys(BenchmarkState& state, uint64_t numberOfKeys, uint64_t keySize) {
+    std::vector<storm::storage::BitVector> keys;
+    std::mt19937_64 generator(state.getOptions().seed);
+    for (uint64_t i = 0; i < numberOfKeys; ++i) {
+        storm::storage::BitVector key(keySize);
+        for (uint64_t offset = 0; offset + 64 < keySize; offset += 64) {
+            key.setFromInt(offset, 64, generator());
+        }
+        key.setFromInt(keySize - 64, 64, generator() % 1024);
+        keys.push_back(std::move(key));
+    }
+    return keys;
+}
+
+template<typename Hash>
+void benchmarkBitVectorHash(BenchmarkState& state) {
+    uint64_t const numberOfKeys = 1ull << 16;
+    uint64_t const keySize = 256;
+    std::vector<storm::storage::BitVector> keys = createHashMapKeys(state, numberOfKeys, keySize);
+    Hash hasher;
+    state.setItemsPerRun(numberOfKeys);
+    uint64_t checksum = 0;
+    state.measure([&]() {
+        for (auto const& key : keys) {
+            checksum += hasher(key);
+        }
+    });
+    state.addCounter("checksum", static_cast<double>(checksum % 1024));
+}
+
+template<typename Hash = storm::storage::DefaultBitVectorHash<uint64_t>>
+void benchmarkBitVectorHashMap(BenchmarkState& state, double loadFactor = 0.75) {
+    uint64_t const numberOfKeys = 1ull << 18;
+    uint64_t const keySize = 128;
+    std::vector<storm::storage::BitVector> keys = createHashMapKeys(state, numberOfKeys, keySize);
+    state.setItemsPerRun(numberOfKeys);
+    uint64_t size = 0;
+    double probeLength = 0.0;
+    state.measure([&]() {
+        storm::storage::BitVectorHashMap<uint64_t, Hash> map(keySize, 1000, loadFactor);
+        for (uint64_t i = 0; i < numberOfKeys; ++i) {
+            map.findOrAdd(keys[i], i);
+        }
+        size = map.size();
+        probeLength = map.getAverageProbeLength();
+    });
+    state.addCounter("distinct-keys", size);
+    state.addCounter("average-probe-length", probeLength);
+}
+
+STORM_BENCHMARK(bitVectorHashMurmur3, "BitVector/hash/murmur3") {
+    benchmarkBitVectorHash<storm::storage::Murmur3BitVectorHash<uint64_t>>(state);
+}
+
+STORM_BENCHMARK(bitVectorHashWyhash, "BitVector/hash/wyhash") {
+    benchmarkBitVectorHash<storm::storage::WyhashBitVectorHash<uint64_t>>(state);
+}
+
+STORM_BENCHMARK(bitVectorHashMap, "BitVectorHashMap/findOrAdd") {
+    benchmarkBitVectorHashMap(state);
+}
+
+STORM_BENCHMARK(bitVectorHashMapMurmur3, "BitVectorHashMap/findOrAdd/murmur3") {
+    benchmarkBitVectorHashMap<storm::storage::Murmur3BitVectorHash<uint64_t>>(state);
+}
+
+STORM_BENCHMARK(bitVectorHashMapWyhash, "BitVectorHashMap/findOrAdd/wyhash") {
+    benchmarkBitVectorHashMap<storm::storage::WyhashBitVectorHash<uint64_t>>(state);
+}
+
+STORM_BENCHMARK(bitVectorHashMapMurmur3HighLoad, "BitVectorHashMap/findOrAdd/murmur3-load0.95") {
+    benchmarkBitVectorHashMap<storm::storage::Murmur3BitVectorHash<uint64_t>>(state, 0.95);
+}
+
+STORM_BENCHMARK(bitVectorHashMapWyhashHighLoad, "BitVectorHashMap/findOrAdd/wyhash-load0.95") {
+    benchmarkBitVectorHashMap<storm::storage::WyhashBitVectorHash<uint64_t>>(state, 0.95);
+}
+
+void benchmarkModelBuilding(BenchmarkState& state, std::string const& file, std::string const& propertyString) {
+    uint64_t states = 0, transitions = 0;
+    state.measure(
+        [&]() {
+            auto model = buildModel(file, propertyString);
+            states = model->getNumberOfStates();
+            transitions = model->getNumberOfTransitions();
+        },
+        true);
+    state.setItemsPerRun(states);
+    state.addCounter("states", states);
+    state.addCounter("transitions", transitions);
+}
+
+STORM_BENCHMARK(buildCrowds, "NextStateGenerator/prism/crowds-5-5") {
+    benchmarkModelBuilding(state, STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", "P=? [F \"observe0Greater1\"]");
+}
+
+STORM_BENCHMARK(buildBrp, "NextStateGenerator/prism/brp-16-2") {
+    benchmarkModelBuilding(state, STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", "P=? [F \"target\"]");
+}
+
+STORM_BENCHMARK(buildCsma, "NextStateGenerator/prism/csma2-2") {
+    benchmarkModelBuilding(state, STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", "Pmax=? [F \"all_delivered\"]");
+}
+
+STORM_BENCHMARK(buildFirewire, "NextStateGenerator/prism/firewire3-0.5") {
+    benchmarkModelBuilding(state, STORM_TEST_RESOURCES_DIR "/mdp/firewire3-0.5.nm", "Pmax=? [F \"elected\"]");
+}
+
+STORM_BENCHMARK(sccDecomposition, "Decomposition/scc/random") {
+    auto matrix = createRandomMatrix(matrixStates, 1, 4, state.getOptions().seed);
+    uint64_t numberOfSccs = 0;
+    state.setItemsPerRun(matrix.getRowCount());
+    state.measure([&]() { numberOfSccs = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix).size(); });
+    state.addCounter("sccs", numberOfSccs);
+}
+
+STORM_BENCHMARK(mecDecomposition, "Decomposition/mec/random") {
+    auto matrix = createRandomMatrix(matrixStates / 4, 4, 4, state.getOptions().seed);
+    auto backwardTransitions = matrix.transpose(true);
+    uint64_t numberOfMecs = 0;
+    state.setItemsPerRun(matrix.getRowGroupCount());
+    state.measure([&]() { numberOfMecs = storm::storage::MaximalEndComponentDecomposition<double>(matrix, backwardTransitions).size(); });
+    state.addCounter("mecs", numberOfMecs);
+}
+
+STORM_BENCHMARK(mecDecompositionCsma, "Decomposition/mec/csma2-2") {
+    auto model = buildModel(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", "Pmax=? [F \"all_delivered\"]");
+    uint64_t numberOfMecs = 0;
+    state.setItemsPerRun(model->getNumberOfStates());
+    state.measure([&]() {
+        numberOfMecs = storm::storage::MaximalEndComponentDecomposition<double>(model->getTransitionMatrix(), model->getBackwardTransitions()).size();
+    });
+    state.addCounter("mecs", numberOfMecs);
+}
+
+void benchmarkMinMaxMethod(BenchmarkState& state, storm::solver::MinMaxMethod method) {
+    std::string const propertyString = "Pmin=? [F \"finished\" & \"all_coins_equal_1\"]";
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(propertyString, program));
+    auto mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(method);
+    uint64_t const initialState = *mdp->getInitialStates().begin();
+    double value = 0;
+    // Note that the qualitative precomputations are shared between the runs as they are cached by the model.
+    state.measure([&]() {
+        auto result = storm::api::verifyWithSparseEngine<double>(env, mdp, storm::api::createTask<double>(formulas.front(), true));
+        value = result->asExplicitQuantitativeCheckResult<double>()[initialState];
+    });
+    state.setItemsPerRun(mdp->getNumberOfStates());
+    state.addCounter("result", value);
+}
+
+STORM_BENCHMARK(minMaxValueIteration, "MinMaxMethod/value") {
+    benchmarkMinMaxMethod(state, storm::solver::MinMaxMethod::ValueIteration);
+}
+
+STORM_BENCHMARK(minMaxPolicyIteration, "MinMaxMethod/policy") {
+    benchmarkMinMaxMethod(state, storm::solver::MinMaxMethod::PolicyIteration);
+}
+
+STORM_BENCHMARK(minMaxLinearProgramming, "MinMaxMethod/linearprogramming") {
+    benchmarkMinMaxMethod(state, storm::solver::MinMaxMethod::LinearProgramming);
+}
+
+STORM_BENCHMARK(minMaxTopological, "MinMaxMethod/topological") {
+    benchmarkMinMaxMethod(state, storm::solver::MinMaxMethod::Topological);
+}
+
+STORM_BENCHMARK(minMaxRationalSearch, "MinMaxMethod/ratsearch") {
+    benchmarkMinMaxMethod(state, storm::solver::MinMaxMethod::RationalSearch);
+}
+
+STORM_BENCHMARK(minMaxIntervalIteration, "MinMaxMethod/intervaliteration") {
+    benchmarkMinMaxMethod(state, storm::solver::MinMaxMethod::IntervalIteration);
+}
+
+STORM_BENCHMARK(minMaxSoundValueIteration, "MinMaxMethod/soundvalueiteration") {
+    benchmarkMinMaxMethod(state, storm::solver::MinMaxMethod::SoundValueIteration);
+}
+
+STORM_BENCHMARK(minMaxOptimisticValueIteration, "MinMaxMethod/optimisticvalueiteration") {
+    benchmarkMinMaxMethod(state, storm::solver::MinMaxMethod::OptimisticValueIteration);
+}
+
+STORM_BENCHMARK(minMaxViToPi, "MinMaxMethod/vi-to-pi") {
+    benchmarkMinMaxMethod(state, storm::solver::MinMaxMethod::ViToPi);
+}
+
+STORM_BENCHMARK(minMaxPrioritizedValueIteration, "MinMaxMethod/prioritizedvalueiteration") {
+    benchmarkMinMaxMethod(state, storm::solver::MinMaxMethod::PrioritizedValueIteration);
+}
+
+}  // namespace
+}  // namespace bench
+}  // namespace storm
@@ -0,0 +1,65 @@
+#include "storm-bench/Benchmark.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/storage/Qvbs.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/jani/Property.h"
+
+namespace storm {
+namespace bench {
+namespace {
+
+/*!
+ * Builds the given instance of a QVBS model and checks all of its properties with the sparse engine. Requires the QVBS root to be set via --qvbsroot.
+ */
+void benchmarkQvbs(BenchmarkState& state, std::string const& modelName, uint64_t instanceIndex) {
+    storm::storage::QvbsBenchmark benchmark(modelName);
+    auto janiInput = storm::api::parseJaniModel(benchmark.getJaniFile(instanceIndex));
+    storm::storage::SymbolicModelDescription modelDescription(janiInput.first);
+    auto constantDefinitions = modelDescription.parseConstantDefinitions(benchmark.getConstantDefinition(instanceIndex));
+    modelDescription = modelDescription.preprocess(constantDefinitions);
+    auto properties = storm::api::substituteConstantsInProperties(janiInput.second, constantDefinitions);
+    auto formulas = storm::api::extractFormulasFromProperties(properties);
+
+    storm::Environment env;
+    uint64_t states = 0, transitions = 0, checkedProperties = 0;
+    state.measure(
+        [&]() {
+            auto model = storm::api::buildSparseModel<double>(modelDescription, formulas);
+            states = model->getNumberOfStates();
+            transitions = model->getNumberOfTransitions();
+            checkedProperties = 0;
+            for (auto const& formula : formulas) {
+                auto result = storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(formula, true));
+                if (result) {
+                    ++checkedProperties;
+                }
+            }
+        },
+        true);
+    state.setItemsPerRun(states);
+    state.addCounter("states", states);
+    state.addCounter("transitions", transitions);
+    state.addCounter("properties", checkedProperties);
+}
+
+// A selection of QVBS models that can be handled by the sparse engine in reasonable time using their smallest instance.
+std::vector<std::string> const qvbsModels = {"brp", "consensus", "crowds", "csma", "firewire", "herman", "leader_sync", "nand", "wlan", "zeroconf"};
+
+bool const qvbsBenchmarksRegistered = []() {
+    for (auto const& modelName : qvbsModels) {
+        registerBenchmark("Qvbs/" + modelName + "/0", [modelName](BenchmarkState& state) { benchmarkQvbs(state, modelName, 0); });
+    }
+    return true;
+}();
+
+}  // namespace
+}  // namespace bench
+}  // namespace storm
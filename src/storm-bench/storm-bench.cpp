@@ -0,0 +1,106 @@
+#include "storm-bench/Benchmark.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/initialize.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace bench {
+
+/*!
+ * Prints the options that are handled by storm-bench itself. All other options are passed on to the settings of storm.
+ */
+void printUsage() {
+    STORM_PRINT("Usage: storm-bench [options] [storm options]\n"
+                << "  --list                     list the names of all benchmarks\n"
+                << "  --filter <string>          only run benchmarks whose name contains the given string\n"
+                << "  --repetitions <n>          minimal number of runs of micro benchmarks (default: 5)\n"
+                << "  --min-time <seconds>       minimal total time of micro benchmarks (default: 0.5)\n"
+                << "  --macro-repetitions <n>    number of runs of macro benchmarks, e.g. Qvbs/* (default: 1)\n"
+                << "  --seed <n>                 seed for generated inputs (default: 42)\n"
+                << "  --threads <n>              number of solver threads (default: 1)\n"
+                << "  --json <file>              write the results to the given file\n"
+                << "QVBS benchmarks require the path to the benchmark set, given via --qvbsroot <path>.\n");
+}
+
+int runBenchmarks(int const argc, char const* argv[]) {
+    BenchmarkOptions options;
+    std::string filter, jsonFile;
+    bool list = false;
+    std::vector<char const*> stormArguments = {argv[0]};
+    for (int i = 1; i < argc; ++i) {
+        std::string argument(argv[i]);
+        auto nextArgument = [&]() {
+            STORM_LOG_THROW(i + 1 < argc, storm::exceptions::InvalidArgumentException, "Missing value for option '" << argument << "'.");
+            return std::string(argv[++i]);
+        };
+        if (argument == "--help") {
+            printUsage();
+            return 0;
+        } else if (argument == "--list") {
+            list = true;
+        } else if (argument == "--filter") {
+            filter = nextArgument();
+        } else if (argument == "--repetitions") {
+            options.minimalRepetitions = std::stoull(nextArgument());
+        } else if (argument == "--min-time") {
+            options.minimalSeconds = std::stod(nextArgument());
+        } else if (argument == "--macro-repetitions") {
+            options.macroRepetitions = std::stoull(nextArgument());
+        } else if (argument == "--seed") {
+            options.seed = std::stoull(nextArgument());
+        } else if (argument == "--threads") {
+            options.numberOfThreads = std::stoull(nextArgument());
+        } else if (argument == "--json") {
+            jsonFile = nextArgument();
+        } else {
+            stormArguments.push_back(argv[i]);
+        }
+    }
+
+    if (list) {
+        for (auto const& name : getBenchmarkNames()) {
+            STORM_PRINT(name << '\n');
+        }
+        return 0;
+    }
+
+    // Fix the number of threads such that results do not depend on the machine the benchmarks are run on.
+    std::string const numberOfThreads = std::to_string(options.numberOfThreads);
+    stormArguments.push_back("--solver-threads");
+    stormArguments.push_back(numberOfThreads.c_str());
+    storm::settings::mutableManager().setFromCommandLine(stormArguments.size(), stormArguments.data());
+
+    auto results = storm::bench::runBenchmarks(options, filter);
+    if (!jsonFile.empty()) {
+        std::ofstream stream(jsonFile);
+        STORM_LOG_THROW(stream.good(), storm::exceptions::InvalidArgumentException, "Unable to open file '" << jsonFile << "'.");
+        stream << results.dump(4) << '\n';
+    }
+    return 0;
+}
+
+}  // namespace bench
+}  // namespace storm
+
+int main(const int argc, const char** argv) {
+    try {
+        storm::utility::setUp();
+        storm::settings::initializeAll("Storm-bench", "storm-bench");
+        int result = storm::bench::runBenchmarks(argc, argv);
+        storm::utility::cleanUp();
+        return result;
+    } catch (storm::exceptions::BaseException const& exception) {
+        STORM_LOG_ERROR("An exception caused Storm-bench to terminate. The message of the exception is: " << exception.what());
+        return 1;
+    } catch (std::exception const& exception) {
+        STORM_LOG_ERROR("An unexpected exception occurred and caused Storm-bench to terminate. The message of this exception is: " << exception.what());
+        return 2;
+    }
+}
@@ -5,10 +5,13 @@
 #include "storm/exceptions/OptionParserException.h"
 #include "storm/io/file.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/DebugSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
+#include "storm/settings/modules/ServerSettings.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
 #include "storm/utility/macros.h"
@@ -46,13 +49,18 @@ bool parseOptions(const int argc, const char* argv[]) {
 void setResourceLimits() {
     storm::settings::modules::ResourceSettings const& resources = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
 
-    // If we were given a time limit, we put it in place now.
-    if (resources.isTimeoutSet()) {
+    // If we were given a time limit, we put it in place now. A server applies the time limit to each request instead.
+    bool isServer = storm::settings::hasModule<storm::settings::modules::ServerSettings>() &&
+                    storm::settings::getModule<storm::settings::modules::ServerSettings>().isServerSet();
+    if (resources.isTimeoutSet() && !isServer) {
         storm::utility::resources::setTimeoutAlarm(resources.getTimeoutInSeconds());
     }
 
     // register signal handler to handle aborts
     storm::utility::resources::installSignalHandler(storm::settings::getModule<storm::settings::modules::ResourceSettings>().getSignalWaitingTimeInSeconds());
+
+    // Only record the phases of the computation if they are reported.
+    storm::utility::Profiler::getInstance().setEnabled(resources.isProfileTraceSet() || resources.isPrintTimeAndMemorySet());
 }
 
 void setFileLogging() {
@@ -97,13 +105,25 @@ int process(std::string const& name, std::string const& executableName, std::fun
     setFileLogging();
     // Set output precision
     storm::utility::setOutputDigitsFromGeneralPrecision(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    // Set the placement of the threads of parallel computations
+    if (storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+        storm::utility::setThreadAffinityPolicy(storm::settings::getModule<storm::settings::modules::CoreSettings>().getThreadAffinityPolicy());
+    }
 
     // Process options and start computations
-    processOptionsFunc();
+    {
+        storm::utility::ProfilerPhase phase("total");
+        processOptionsFunc();
+    }
 
     totalTimer.stop();
-    if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
+    auto const& resources = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+    if (resources.isPrintTimeAndMemorySet()) {
         storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
+        storm::utility::Profiler::getInstance().printSummary(std::cout);
+    }
+    if (resources.isProfileTraceSet()) {
+        storm::utility::Profiler::getInstance().exportChromeTrace(resources.getProfileTraceFilename());
     }
 
     // All operations have been performed, so we clean up everything and terminate.
@@ -6,6 +6,8 @@
 #include "storm-gamebased-ar/api/verification.h"
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm-parsers/parser/ExpressionParser.h"
+#include "storm-parsers/util/ModelBuildCache.h"
+#include "storm-version-info/storm-version.h"
 
 #include "storm/io/file.h"
 #include "storm/utility/AutomaticSettings.h"
@@ -16,6 +18,7 @@
 
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
+#include "storm/utility/threads.h"
 
 #include <type_traits>
 
@@ -23,13 +26,16 @@
 #include "storm/storage/jani/Property.h"
 
 #include "storm/builder/BuilderType.h"
+#include "storm/builder/ModelSizeEstimation.h"
 
 #include "storm/models/ModelBase.h"
 
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
 #include "storm/exceptions/OptionParserException.h"
 
+#include "storm/modelchecker/helper/ltl/SparseLTLHelper.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -51,6 +57,7 @@
 #include "storm/storage/jani/localeliminator/AutomaticAction.h"
 #include "storm/storage/jani/localeliminator/JaniLocalEliminator.h"
 
+#include "storm/utility/Profiler.h"
 #include "storm/utility/Stopwatch.h"
 
 namespace storm {
@@ -137,6 +144,7 @@ inline SymbolicInput parseSymbolicInputQvbs(storm::settings::modules::IOSettings
 }
 
 inline SymbolicInput parseSymbolicInput() {
+    storm::utility::ProfilerPhase phase("parse");
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     if (ioSettings.isQvbsInputSet()) {
         return parseSymbolicInputQvbs(ioSettings);
@@ -195,6 +203,30 @@ inline void getModelProcessingInformationAutomatic(SymbolicInput const& input, M
         as.predict(input.model->asJaniModel(), properties.front());
     }
 
+    // Avoid engines whose memory consumption is expected to exceed the available memory.
+    uint64_t availableMemory = hints.isAvailableMemorySet() ? hints.getAvailableMemory() : storm::utility::getAvailableMemory();
+    if (availableMemory > 0) {
+        std::optional<storm::builder::ModelSizeEstimate> estimate;
+        if (hints.getEstimationStateLimit() > 0) {
+            estimate = storm::builder::estimateModelSize(input.model->asJaniModel(), hints.getEstimationStateLimit());
+        }
+        if (hints.isNumberStatesSet()) {
+            // The hint takes precedence over the estimated number of states, the other numbers are scaled accordingly.
+            uint64_t const numberOfStates = hints.getNumberStates();
+            if (estimate && estimate->numberOfStates > 0) {
+                double const scale = static_cast<double>(numberOfStates) / static_cast<double>(estimate->numberOfStates);
+                estimate->numberOfChoices = static_cast<uint64_t>(static_cast<double>(estimate->numberOfChoices) * scale);
+                estimate->numberOfTransitions = static_cast<uint64_t>(static_cast<double>(estimate->numberOfTransitions) * scale);
+                estimate->numberOfStates = numberOfStates;
+            } else {
+                estimate = storm::builder::ModelSizeEstimate{numberOfStates, numberOfStates, numberOfStates, 64, false};
+            }
+        }
+        if (estimate) {
+            as.restrictToMemory(estimate.value(), availableMemory);
+        }
+    }
+
     mpi.engine = as.getEngine();
     if (as.enableBisimulation()) {
         mpi.applyBisimulation = true;
@@ -374,6 +406,14 @@ inline std::pair<SymbolicInput, ModelProcessingInformation> preprocessSymbolicIn
         output.properties = storm::api::substituteConstantsInProperties(output.properties, constantDefinitions);
     }
     ensureNoUndefinedPropertyConstants(output.properties);
+
+    // Remove the parts of the model that can not influence the properties. This is skipped if the model is exported or all labels are built.
+    auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    if (output.model && output.model.get().isPrismProgram() && !output.properties.empty() && !buildSettings.isNoSlicingSet() &&
+        !buildSettings.isBuildFullModelSet() && !buildSettings.isBuildAllLabelsSet() && !buildSettings.isSymmetryReductionSet() &&
+        !ioSettings.isExportBuildSet() && !ioSettings.isExportExplicitSet() && !ioSettings.isExportDotSet()) {
+        output.model = output.model.get().slice(output.properties);
+    }
     auto transformedJani = std::make_shared<SymbolicInput>();
     ModelProcessingInformation mpi = getModelProcessingInformation(output, transformedJani);
 
@@ -400,7 +440,6 @@ inline std::pair<SymbolicInput, ModelProcessingInformation> preprocessSymbolicIn
         storm::jani::ModelFeatures supportedFeatures = storm::api::getSupportedJaniFeatures(storm::utility::getBuilderType(mpi.engine));
         storm::api::simplifyJaniModel(output.model.get().asJaniModel(), output.properties, supportedFeatures);
 
-        const auto& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
         if (buildSettings.isLocationEliminationSet()) {
             auto locationHeuristic = buildSettings.getLocationEliminationLocationHeuristic();
             auto edgesHeuristic = buildSettings.getLocationEliminationEdgesHeuristic();
@@ -481,6 +520,8 @@ inline storm::builder::BuilderOptions createBuildOptionsSparseFromSettings(Symbo
     if (buildSettings.isAddOverlappingGuardsLabelSet()) {
         options.setAddOverlappingGuardsLabel(true);
     }
+    options.setApplySymmetryReduction(buildSettings.isSymmetryReductionSet());
+    options.setApplyPartialOrderReduction(buildSettings.isPartialOrderReductionSet());
 
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     if (ioSettings.isComputeExpectedVisitingTimesSet() || ioSettings.isComputeSteadyStateDistributionSet()) {
@@ -491,6 +532,23 @@ inline storm::builder::BuilderOptions createBuildOptionsSparseFromSettings(Symbo
 
 template<typename ValueType>
 std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::builder::BuilderOptions const& options) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+        // Partially explored models are not cached.
+        if (buildSettings.isBuildCacheSet() && !buildSettings.isExplorationStateLimitSet()) {
+            storm::utility::ModelBuildCache cache(buildSettings.getBuildCacheDirectory(), buildSettings.getBuildCacheSizeLimit());
+            std::stringstream additionalInformation;
+            additionalInformation << storm::StormVersion::longVersionString() << ", exploration order " << buildSettings.getExplorationOrder();
+            std::string key = storm::utility::ModelBuildCache::computeKey(input.model.get(), options, additionalInformation.str());
+            if (auto model = cache.load(key, input.model->getManager().getSharedPointer())) {
+                STORM_PRINT_AND_LOG("Loaded model from the build cache.\n");
+                return model;
+            }
+            auto model = storm::api::buildSparseModel<ValueType>(input.model.get(), options);
+            cache.store(key, model);
+            return model;
+        }
+    }
     return storm::api::buildSparseModel<ValueType>(input.model.get(), options);
 }
 
@@ -507,7 +565,10 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
     } else if (ioSettings.isExplicitDRNSet()) {
         storm::parser::DirectEncodingParserOptions options;
         options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
+        options.numberOfThreads = buildSettings.getNumberOfBuildThreads();
         result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename(), options);
+    } else if (ioSettings.isExplicitBinarySet()) {
+        result = storm::api::buildExplicitBinaryModel<ValueType>(ioSettings.getExplicitBinaryFilename());
     } else {
         STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
         result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -515,9 +576,18 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
     return result;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+void printDdStatistics(std::shared_ptr<storm::models::ModelBase> const& model, std::string const& phase) {
+    if (model && model->isSymbolicModel() && storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowDdStatisticsSet()) {
+        STORM_PRINT("DD statistics after " << phase << ": " << model->as<storm::models::symbolic::Model<DdType, ValueType>>()->getManager().getStatistics()
+                                           << ".\n\n");
+    }
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input, storm::settings::modules::IOSettings const& ioSettings,
                                                      ModelProcessingInformation const& mpi) {
+    storm::utility::ProfilerPhase phase("build");
     storm::utility::Stopwatch modelBuildingWatch(true);
 
     std::shared_ptr<storm::models::ModelBase> result;
@@ -529,7 +599,7 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
             auto options = createBuildOptionsSparseFromSettings(input);
             result = buildModelSparse<ValueType>(input, options);
         }
-    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
+    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitBinarySet() || ioSettings.isExplicitIMCASet()) {
         STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException,
                         "Can only use sparse engine with explicit input.");
         result = buildModelExplicit<ValueType>(ioSettings, storm::settings::getModule<storm::settings::modules::BuildSettings>());
@@ -538,7 +608,13 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
     modelBuildingWatch.stop();
     if (result) {
         STORM_PRINT("Time for model construction: " << modelBuildingWatch << ".\n\n");
+        if (result->isSparseModel()) {
+            auto sparseModel = result->as<storm::models::sparse::Model<ValueType>>();
+            phase.addCounter("states", sparseModel->getNumberOfStates());
+            phase.addCounter("transitions", sparseModel->getNumberOfTransitions());
+        }
     }
+    printDdStatistics<DdType, ValueType>(result, "model construction");
 
     return result;
 }
@@ -595,9 +671,13 @@ std::pair<std::shared_ptr<storm::models::sparse::Model<ValueType>>, bool> prepro
         auto seed = transformationSettings.getModelPermutationSeed();
         STORM_PRINT_AND_LOG("Permuting model states using " << storm::utility::permutation::orderKindtoString(order.value()) << " order"
                                                             << (seed.has_value() ? " with seed " + std::to_string(seed.value()) : "") << ".\n");
+        auto const distanceBefore = storm::utility::permutation::computeAverageIndexDistance(result.first->getTransitionMatrix());
         result.first = storm::api::permuteModelStates(result.first, order.value(), seed);
         result.second = true;
         STORM_PRINT_AND_LOG("Transition matrix hash after permuting: " << result.first->getTransitionMatrix().hash() << ".\n");
+        STORM_PRINT_AND_LOG("Average index distance of the transitions changed from "
+                            << distanceBefore << " to " << storm::utility::permutation::computeAverageIndexDistance(result.first->getTransitionMatrix())
+                            << ".\n");
     }
 
     if (result.first->isOfType(storm::models::ModelType::MarkovAutomaton)) {
@@ -646,6 +726,9 @@ void exportSparseModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>
             case storm::exporter::ModelExportFormat::Json:
                 storm::api::exportSparseModelAsJson(model, ioSettings.getExportBuildFilename());
                 break;
+            case storm::exporter::ModelExportFormat::Binary:
+                storm::api::exportSparseModelAsBinary(model, ioSettings.getExportBuildFilename());
+                break;
             default:
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
                                 "Exporting sparse models in " << storm::exporter::toString(ioSettings.getExportBuildFormat()) << " format is not supported.");
@@ -704,6 +787,7 @@ void exportDdModel(std::shared_ptr<storm::models::symbolic::Model<DdType, ValueT
 
 template<storm::dd::DdType DdType, typename ValueType>
 void exportModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
+    storm::utility::ProfilerPhase phase("export");
     if (model->isSparseModel()) {
         exportSparseModel<ValueType>(model->as<storm::models::sparse::Model<ValueType>>(), input);
     } else {
@@ -788,6 +872,7 @@ std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessDdModel(std
 template<storm::dd::DdType DdType, typename BuildValueType, typename ExportValueType = BuildValueType>
 std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input,
                                                                            ModelProcessingInformation const& mpi) {
+    storm::utility::ProfilerPhase phase("preprocess");
     storm::utility::Stopwatch preprocessingWatch(true);
 
     std::pair<std::shared_ptr<storm::models::ModelBase>, bool> result = std::make_pair(model, false);
@@ -1027,7 +1112,11 @@ void verifyProperties(SymbolicInput const& input, VerificationCallbackType const
     for (auto const& property : properties) {
         printModelCheckingProperty(property);
         storm::utility::Stopwatch watch(true);
-        auto result = verifyProperty<ValueType>(property.getRawFormula(), property.getFilter().getStatesFormula(), verificationCallback);
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+        {
+            storm::utility::ProfilerPhase phase("check");
+            result = verifyProperty<ValueType>(property.getRawFormula(), property.getFilter().getStatesFormula(), verificationCallback);
+        }
         watch.stop();
         if (result) {
             postprocessingCallback(result);
@@ -1200,6 +1289,18 @@ void verifyWithExplorationEngine(SymbolicInput const& input, ModelProcessingInfo
         });
 }
 
+template<typename ValueType>
+void verifyWithSimulationEngine(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    STORM_LOG_ASSERT(input.model, "Expected symbolic model description.");
+    STORM_LOG_THROW((std::is_same<ValueType, double>::value), storm::exceptions::NotSupportedException,
+                    "Simulation does not support other data-types than floating points.");
+    verifyProperties<ValueType>(
+        input, [&input, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+            STORM_LOG_THROW(states->isInitialFormula(), storm::exceptions::NotSupportedException, "Simulation can only filter initial states.");
+            return storm::api::verifyWithSimulationEngine<ValueType>(mpi.env, input.model.get(), storm::api::createTask<ValueType>(formula, true));
+        });
+}
+
 template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
@@ -1265,6 +1366,19 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
         ++exportCount;
     };
     if (!(ioSettings.isComputeSteadyStateDistributionSet() || ioSettings.isComputeExpectedVisitingTimesSet())) {
+        if (mpi.env.modelchecker().isLtl2daToolSet()) {
+            // Translate the LTL formulas of all properties (concurrently) before the properties are checked one after another
+            std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+            for (auto const& property : input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties) {
+                formulas.push_back(property.getRawFormula());
+            }
+            // The translation does not depend on the value type of the model
+            if (sparseModel->isNondeterministicModel()) {
+                storm::modelchecker::helper::SparseLTLHelper<double, true>::translateLTLFormulas(mpi.env, formulas);
+            } else {
+                storm::modelchecker::helper::SparseLTLHelper<double, false>::translateLTLFormulas(mpi.env, formulas);
+            }
+        }
         verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback);
     }
     if (ioSettings.isComputeSteadyStateDistributionSet()) {
@@ -1352,6 +1466,7 @@ typename std::enable_if<DdType != storm::dd::DdType::CUDD || std::is_same<ValueT
     } else {
         verifyWithAbstractionRefinementEngine<DdType, ValueType>(model, input, mpi);
     }
+    printDdStatistics<DdType, ValueType>(model, "model checking");
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
@@ -1415,6 +1530,8 @@ void processInputWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessi
         verifyWithAbstractionRefinementEngine<DdType, VerificationValueType>(input, mpi);
     } else if (mpi.engine == storm::utility::Engine::Exploration) {
         verifyWithExplorationEngine<VerificationValueType>(input, mpi);
+    } else if (mpi.engine == storm::utility::Engine::Simulation) {
+        verifyWithSimulationEngine<VerificationValueType>(input, mpi);
     } else {
         std::shared_ptr<storm::models::ModelBase> model =
             buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, mpi);
@@ -0,0 +1,496 @@
+#include "storm-cli-utilities/server.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ResourceSettings.h"
+#include "storm/settings/modules/ServerSettings.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace cli {
+
+namespace {
+
+typedef storm::json<double> ServerJson;
+
+/*!
+ * A built model together with the (preprocessed) description it was built from. Stored models are never modified.
+ */
+struct StoredModel {
+    storm::storage::SymbolicModelDescription description;
+    std::shared_ptr<storm::models::sparse::Model<double>> model;
+};
+
+/*!
+ * Stores a bounded number of models, where the least recently used model is removed first. All methods may be called concurrently.
+ * Removed models remain valid for as long as they are used by some request.
+ */
+class ModelRegistry {
+   public:
+    explicit ModelRegistry(uint64_t maximalNumberOfModels) : maximalNumberOfModels(maximalNumberOfModels) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Retrieves the model with the given key or null if there is no such model.
+     */
+    std::shared_ptr<StoredModel const> get(std::string const& key) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto indexIt = index.find(key);
+        if (indexIt == index.end()) {
+            return nullptr;
+        }
+        // Mark the model as the most recently used one.
+        entries.splice(entries.begin(), entries, indexIt->second);
+        return indexIt->second->second;
+    }
+
+    /*!
+     * Stores the given model under the given key (unless there already is a model with this key) and returns the model stored under this key.
+     */
+    std::shared_ptr<StoredModel const> insert(std::string const& key, std::shared_ptr<StoredModel const> const& model) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto indexIt = index.find(key);
+        if (indexIt != index.end()) {
+            // The model has been built concurrently by another request.
+            entries.splice(entries.begin(), entries, indexIt->second);
+            return indexIt->second->second;
+        }
+        entries.emplace_front(key, model);
+        index[key] = entries.begin();
+        while (entries.size() > maximalNumberOfModels) {
+            STORM_LOG_INFO("Removing model '" << entries.back().first << "' from the server.");
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+        return model;
+    }
+
+    /*!
+     * Removes the model with the given key.
+     * @return true iff there was a model with the given key.
+     */
+    bool remove(std::string const& key) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto indexIt = index.find(key);
+        if (indexIt == index.end()) {
+            return false;
+        }
+        entries.erase(indexIt->second);
+        index.erase(indexIt);
+        return true;
+    }
+
+    /*!
+     * Retrieves the keys of all stored models, starting with the most recently used one.
+     */
+    std::vector<std::string> getKeys() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<std::string> result;
+        for (auto const& entry : entries) {
+            result.push_back(entry.first);
+        }
+        return result;
+    }
+
+   private:
+    typedef std::list<std::pair<std::string, std::shared_ptr<StoredModel const>>> EntryList;
+
+    uint64_t maximalNumberOfModels;
+    // The stored models, starting with the most recently used one.
+    EntryList entries;
+    std::map<std::string, EntryList::iterator> index;
+    mutable std::mutex mutex;
+};
+
+ModelRegistry& getModelRegistry() {
+    static ModelRegistry registry(storm::settings::getModule<storm::settings::modules::ServerSettings>().getMaximalNumberOfModels());
+    return registry;
+}
+
+std::string getStringMember(ServerJson const& request, std::string const& name, bool optional = false) {
+    auto memberIt = request.find(name);
+    if (memberIt == request.end()) {
+        STORM_LOG_THROW(optional, storm::exceptions::InvalidArgumentException, "The request has no member '" << name << "'.");
+        return "";
+    }
+    STORM_LOG_THROW(memberIt->is_string(), storm::exceptions::InvalidArgumentException, "The member '" << name << "' of the request is not a string.");
+    return memberIt->get<std::string>();
+}
+
+/*!
+ * Retrieves the key of the model described by the given load request.
+ */
+std::string getModelKey(ServerJson const& request) {
+    bool isPrism = request.contains("prism");
+    STORM_LOG_THROW(isPrism != request.contains("jani"), storm::exceptions::InvalidArgumentException,
+                    "The request has to specify either a PRISM or a JANI file.");
+    std::string key = (isPrism ? "prism:" : "jani:") + getStringMember(request, isPrism ? "prism" : "jani");
+    std::string constants = getStringMember(request, "constants", true);
+    if (!constants.empty()) {
+        key += ":" + constants;
+    }
+    return key;
+}
+
+/*!
+ * Retrieves the model described by the given load request, where the model is built if it is not stored yet.
+ */
+std::shared_ptr<StoredModel const> getOrBuildModel(ServerJson const& request, std::string const& key, bool& built) {
+    std::shared_ptr<StoredModel const> storedModel = getModelRegistry().get(key);
+    built = !storedModel;
+    if (storedModel) {
+        return storedModel;
+    }
+
+    auto newModel = std::make_shared<StoredModel>();
+    if (request.contains("prism")) {
+        newModel->description = storm::storage::SymbolicModelDescription(storm::api::parseProgram(getStringMember(request, "prism")));
+    } else {
+        newModel->description = storm::storage::SymbolicModelDescription(storm::api::parseJaniModel(getStringMember(request, "jani")).first);
+    }
+    newModel->description = newModel->description.preprocess(getStringMember(request, "constants", true));
+    newModel->model = storm::api::buildSparseModel<double>(newModel->description, storm::builder::BuilderOptions(true, true));
+    STORM_LOG_THROW(newModel->model, storm::exceptions::InvalidArgumentException, "Unable to build the model '" << key << "'.");
+
+    // The trivial row grouping of the transition matrix is created lazily, which must not happen while the model is accessed concurrently.
+    newModel->model->getTransitionMatrix().getRowGroupIndices();
+    return getModelRegistry().insert(key, newModel);
+}
+
+/*!
+ * Retrieves the model of the given check request, which is either given by its key or described as for a load request.
+ */
+std::shared_ptr<StoredModel const> getModelForCheck(ServerJson const& request) {
+    if (request.contains("model")) {
+        std::string key = getStringMember(request, "model");
+        std::shared_ptr<StoredModel const> storedModel = getModelRegistry().get(key);
+        STORM_LOG_THROW(storedModel, storm::exceptions::InvalidArgumentException, "There is no model with key '" << key << "'.");
+        return storedModel;
+    }
+    bool built;
+    return getOrBuildModel(request, getModelKey(request), built);
+}
+
+void addModelInformation(ServerJson& response, std::string const& key, StoredModel const& storedModel) {
+    response["model"] = key;
+    std::stringstream typeStream;
+    typeStream << storedModel.model->getType();
+    response["type"] = typeStream.str();
+    response["states"] = storedModel.model->getNumberOfStates();
+    response["transitions"] = storedModel.model->getNumberOfTransitions();
+}
+
+void processLoadRequest(ServerJson const& request, ServerJson& response) {
+    std::string key = getModelKey(request);
+    bool built;
+    std::shared_ptr<StoredModel const> storedModel = getOrBuildModel(request, key, built);
+    addModelInformation(response, key, *storedModel);
+    response["cached"] = !built;
+}
+
+/*!
+ * Checks the properties of the given request. The results are restricted to the initial states.
+ */
+void processCheckRequest(ServerJson const& request, ServerJson& response) {
+    std::shared_ptr<StoredModel const> storedModel = getModelForCheck(request);
+    std::vector<storm::jani::Property> properties =
+        storm::api::parsePropertiesForSymbolicModelDescription(getStringMember(request, "property"), storedModel->description);
+    STORM_LOG_THROW(!properties.empty(), storm::exceptions::InvalidArgumentException, "The request does not contain a property.");
+
+    storm::Environment env;
+    storm::storage::BitVector const& initialStates = storedModel->model->getInitialStates();
+    storm::modelchecker::ExplicitQualitativeCheckResult initialStatesFilter(initialStates);
+    ServerJson results = ServerJson::array();
+    for (auto const& property : properties) {
+        ServerJson propertyResult;
+        propertyResult["name"] = property.getName();
+        storm::utility::Stopwatch watch(true);
+        std::unique_ptr<storm::modelchecker::CheckResult> result =
+            storm::api::verifyWithSparseEngine<double>(env, storedModel->model, storm::api::createTask<double>(property.getRawFormula(), true));
+        watch.stop();
+        propertyResult["time"] = watch.getTimeInMilliseconds() / 1000.0;
+        if (storm::utility::resources::isTerminate()) {
+            // The result is not reliable, so neither this nor the remaining properties are reported. Only sound bounds for the initial state (if any) are.
+            propertyResult["error"] = "The computation was aborted.";
+            if (result && result->isExplicitQuantitativeCheckResult() && initialStates.getNumberOfSetBits() == 1) {
+                auto& quantitativeResult = result->asExplicitQuantitativeCheckResult<double>();
+                if (quantitativeResult.hasBounds()) {
+                    uint64_t initialState = *initialStates.begin();
+                    propertyResult["lower-bound"] = quantitativeResult.getLowerBound(initialState);
+                    propertyResult["upper-bound"] = quantitativeResult.getUpperBound(initialState);
+                }
+            }
+            results.push_back(std::move(propertyResult));
+            break;
+        }
+        if (!result) {
+            propertyResult["error"] = "The property is not supported.";
+        } else {
+            result->filter(initialStatesFilter);
+            std::stringstream resultStream;
+            resultStream << *result;
+            propertyResult["result"] = resultStream.str();
+            if (initialStates.getNumberOfSetBits() == 1) {
+                uint64_t initialState = *initialStates.begin();
+                if (result->isExplicitQuantitativeCheckResult()) {
+                    propertyResult["value"] = result->asExplicitQuantitativeCheckResult<double>()[initialState];
+                } else if (result->isExplicitQualitativeCheckResult()) {
+                    propertyResult["value"] = result->asExplicitQualitativeCheckResult()[initialState];
+                }
+            }
+        }
+        results.push_back(std::move(propertyResult));
+    }
+    response["results"] = std::move(results);
+}
+
+/*!
+ * Retrieves the timeout (in seconds) of the given request, where zero means that there is no timeout.
+ */
+uint64_t getTimeout(ServerJson const& request) {
+    auto timeoutIt = request.find("timeout");
+    if (timeoutIt != request.end()) {
+        STORM_LOG_THROW(timeoutIt->is_number_unsigned(), storm::exceptions::InvalidArgumentException, "The timeout has to be a non-negative integer.");
+        return timeoutIt->get<uint64_t>();
+    }
+    storm::settings::modules::ResourceSettings const& resources = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+    return resources.isTimeoutSet() ? resources.getTimeoutInSeconds() : 0;
+}
+
+/*!
+ * A queue of accepted connections from which the worker threads take the connections they serve.
+ */
+class ConnectionQueue {
+   public:
+    void push(int connection) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            connections.push(connection);
+        }
+        condition.notify_one();
+    }
+
+    /*!
+     * Waits for the next connection. Returns a negative value if the queue is closed and empty.
+     */
+    int pop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this] { return closed || !connections.empty(); });
+        if (connections.empty()) {
+            return -1;
+        }
+        int connection = connections.front();
+        connections.pop();
+        return connection;
+    }
+
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+        }
+        condition.notify_all();
+    }
+
+   private:
+    std::queue<int> connections;
+    bool closed = false;
+    std::mutex mutex;
+    std::condition_variable condition;
+};
+
+bool sendLine(int connection, std::string line) {
+    line.push_back('\n');
+    std::size_t sent = 0;
+    while (sent < line.size()) {
+        ssize_t count = send(connection, line.data() + sent, line.size() - sent, 0);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            return false;
+        }
+        sent += count;
+    }
+    return true;
+}
+
+/*!
+ * Answers the requests received over the given connection until it is closed or a shutdown is requested.
+ * @return true iff a shutdown was requested.
+ */
+bool serveConnection(int connection) {
+    std::string buffer;
+    char chunk[4096];
+    while (true) {
+        std::size_t lineEnd = buffer.find('\n');
+        if (lineEnd != std::string::npos) {
+            std::string line = buffer.substr(0, lineEnd);
+            buffer.erase(0, lineEnd + 1);
+            if (std::all_of(line.begin(), line.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)); })) {
+                continue;
+            }
+            auto [response, isShutdown] = processServerRequest(line);
+            if (!sendLine(connection, response) || isShutdown) {
+                return isShutdown;
+            }
+            continue;
+        }
+        ssize_t count = recv(connection, chunk, sizeof(chunk), 0);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            return false;
+        }
+        buffer.append(chunk, count);
+    }
+}
+
+}  // namespace
+
+std::pair<std::string, bool> processServerRequest(std::string const& request) {
+    ServerJson response;
+    bool isShutdown = false;
+    try {
+        ServerJson parsedRequest = ServerJson::parse(request);
+        STORM_LOG_THROW(parsedRequest.is_object(), storm::exceptions::InvalidArgumentException, "The request is not a JSON object.");
+        if (parsedRequest.contains("id")) {
+            response["id"] = parsedRequest["id"];
+        }
+        std::string command = getStringMember(parsedRequest, "command");
+        storm::utility::Stopwatch watch(true);
+
+        // Both building and checking the model are subject to the timeout of the request.
+        uint64_t timeout = getTimeout(parsedRequest);
+        if (timeout > 0) {
+            storm::utility::resources::setThreadTimeout(timeout);
+        }
+        try {
+            if (command == "load") {
+                processLoadRequest(parsedRequest, response);
+            } else if (command == "check") {
+                processCheckRequest(parsedRequest, response);
+            } else if (command == "unload") {
+                std::string key = getStringMember(parsedRequest, "model");
+                STORM_LOG_THROW(getModelRegistry().remove(key), storm::exceptions::InvalidArgumentException, "There is no model with key '" << key << "'.");
+            } else if (command == "status") {
+                response["models"] = getModelRegistry().getKeys();
+            } else if (command == "shutdown") {
+                isShutdown = true;
+            } else {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown command '" << command << "'.");
+            }
+        } catch (...) {
+            storm::utility::resources::resetThreadTimeout();
+            throw;
+        }
+        storm::utility::resources::resetThreadTimeout();
+        response["time"] = watch.getTimeInMilliseconds() / 1000.0;
+    } catch (storm::exceptions::BaseException const& exception) {
+        response["error"] = exception.what();
+    } catch (std::exception const& exception) {
+        response["error"] = std::string("Unexpected error: ") + exception.what();
+    }
+    return {storm::dumpJson(response, true), isShutdown};
+}
+
+void runServer() {
+    storm::settings::modules::ServerSettings const& serverSettings = storm::settings::getModule<storm::settings::modules::ServerSettings>();
+    uint64_t numberOfWorkers = serverSettings.getNumberOfWorkerThreads();
+    if (numberOfWorkers == 0) {
+        numberOfWorkers = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+    }
+
+    // Writing to a connection that was closed by the client must not terminate the server.
+    std::signal(SIGPIPE, SIG_IGN);
+
+    int listeningSocket = socket(AF_INET, SOCK_STREAM, 0);
+    STORM_LOG_THROW(listeningSocket >= 0, storm::exceptions::FileIoException, "Unable to create socket: " << std::strerror(errno) << ".");
+    int reuseAddress = 1;
+    setsockopt(listeningSocket, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(static_cast<uint16_t>(serverSettings.getPort()));
+    if (bind(listeningSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listeningSocket, SOMAXCONN) != 0) {
+        std::string error = std::strerror(errno);
+        ::close(listeningSocket);
+        STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Unable to listen on port " << serverSettings.getPort() << ": " << error << ".");
+    }
+    STORM_PRINT_AND_LOG("Listening on port " << serverSettings.getPort() << " with " << numberOfWorkers << " worker thread(s).\n");
+
+    ConnectionQueue queue;
+    std::atomic<bool> shutdownRequested(false);
+    std::vector<std::thread> workers;
+    for (uint64_t worker = 0; worker < numberOfWorkers; ++worker) {
+        workers.emplace_back([&queue, &shutdownRequested, listeningSocket]() {
+            for (int connection = queue.pop(); connection >= 0; connection = queue.pop()) {
+                bool isShutdown = serveConnection(connection);
+                ::close(connection);
+                if (isShutdown && !shutdownRequested.exchange(true)) {
+                    // Wake up the accepting thread.
+                    ::shutdown(listeningSocket, SHUT_RDWR);
+                }
+            }
+        });
+    }
+
+    while (!shutdownRequested && !storm::utility::resources::isTerminate()) {
+        int connection = accept(listeningSocket, nullptr, nullptr);
+        if (connection < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            STORM_LOG_WARN_COND(shutdownRequested, "Unable to accept connection: " << std::strerror(errno) << ".");
+            break;
+        }
+        queue.push(connection);
+    }
+    STORM_PRINT_AND_LOG("Shutting down the server.\n");
+    queue.close();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    ::close(listeningSocket);
+}
+
+}  // namespace cli
+}  // namespace storm
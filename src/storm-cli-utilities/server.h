@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+#include <utility>
+
+namespace storm {
+namespace cli {
+
+/*!
+ * Runs Storm as a long-running model checking server that listens for (local) TCP connections on the port given by the server settings.
+ * Each line sent over a connection is a request in JSON format that is answered by a single line containing the JSON response. The following requests
+ * are supported, where the member "command" selects the kind of the request and (optional) members "id" are copied to the response:
+ *
+ * - {"command": "load", "prism" or "jani": <file>, "constants": <definitions>} builds the (sparse) model of the given PRISM program or JANI model
+ *   and keeps it in memory. The response contains the key under which the model is stored as well as its number of states and transitions.
+ * - {"command": "check", "model": <key>, "property": <properties>, "timeout": <seconds>} checks the given properties on the stored model with the given
+ *   key. Instead of the key, the members of a load request can be given, in which case the model is built if necessary. The timeout is optional and
+ *   defaults to the timeout of the resource settings (if set). The response contains the result of each property for the initial states.
+ * - {"command": "unload", "model": <key>} removes the stored model with the given key.
+ * - {"command": "status"} lists the keys of all stored models.
+ * - {"command": "shutdown"} stops accepting new connections. The server terminates as soon as all open connections have been closed.
+ *
+ * If a request can not be processed, the response contains the member "error" with a description of the problem.
+ * A limited number of models is stored, where the least recently used one is removed (as soon as it is no longer used by a running request) if a new
+ * model is loaded. Requests of different connections are processed concurrently by a fixed number of worker threads. Stored models are shared among
+ * these requests and never modified. In particular, the results of analyses that are cached within the models (e.g. of graph analyses) can be reused
+ * by subsequent requests.
+ */
+void runServer();
+
+/*!
+ * Processes a single request of the server protocol described above and returns the response. This is used by the server for each received line.
+ *
+ * @return the response and whether the server is requested to shut down.
+ */
+std::pair<std::string, bool> processServerRequest(std::string const& request);
+
+}  // namespace cli
+}  // namespace storm
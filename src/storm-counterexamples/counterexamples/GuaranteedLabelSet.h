@@ -28,7 +28,7 @@ std::vector<storm::storage::FlatSet<uint_fast64_t>> getGuaranteedLabelSets(storm
     // Get some data from the model for convenient access.
     storm::storage::SparseMatrix<T> const& transitionMatrix = model.getTransitionMatrix();
     std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
-    storm::storage::SparseMatrix<T> backwardTransitions = model.getBackwardTransitions();
+    storm::storage::SparseMatrix<T> const& backwardTransitions = model.getBackwardTransitions();
 
     // Now we compute the set of labels that is present on all paths from the initial to the target states.
     std::vector<storm::storage::FlatSet<uint_fast64_t>> analysisInformation(model.getNumberOfStates(), relevantLabels);
@@ -695,7 +695,7 @@ class MILPMinimalLabelSetGenerator {
     static uint_fast64_t assertSchedulerCuts(storm::solver::LpSolver<double>& solver, storm::models::sparse::Mdp<T> const& mdp,
                                              storm::storage::BitVector const& psiStates, StateInformation const& stateInformation,
                                              ChoiceInformation const& choiceInformation, VariableInformation const& variableInformation) {
-        storm::storage::SparseMatrix<T> backwardTransitions = mdp.getBackwardTransitions();
+        storm::storage::SparseMatrix<T> const& backwardTransitions = mdp.getBackwardTransitions();
         uint_fast64_t numberOfConstraintsCreated = 0;
 
         for (auto state : stateInformation.relevantStates) {
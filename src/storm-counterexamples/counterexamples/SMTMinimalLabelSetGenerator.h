@@ -132,7 +132,7 @@ class SMTMinimalLabelSetGenerator {
 
         // Compute all relevant states, i.e. states for which there exists a scheduler that has a non-zero
         // probabilitiy of satisfying phi until psi.
-        storm::storage::SparseMatrix<T> backwardTransitions = model.getBackwardTransitions();
+        storm::storage::SparseMatrix<T> const& backwardTransitions = model.getBackwardTransitions();
         relevancyInformation.relevantStates = storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates);
         relevancyInformation.relevantStates &= ~psiStates;
 
@@ -368,7 +368,7 @@ class SMTMinimalLabelSetGenerator {
 
         // Get some data from the model for convenient access.
         storm::storage::SparseMatrix<T> const& transitionMatrix = model.getTransitionMatrix();
-        storm::storage::SparseMatrix<T> backwardTransitions = model.getBackwardTransitions();
+        storm::storage::SparseMatrix<T> const& backwardTransitions = model.getBackwardTransitions();
         storm::storage::BitVector const& initialStates = model.getInitialStates();
 
         for (auto currentState : relevancyInformation.relevantStates) {
@@ -898,7 +898,7 @@ class SMTMinimalLabelSetGenerator {
 
         // Get some data from the model for convenient access.
         storm::storage::SparseMatrix<T> const& transitionMatrix = model.getTransitionMatrix();
-        storm::storage::SparseMatrix<T> backwardTransitions = model.getBackwardTransitions();
+        storm::storage::SparseMatrix<T> const& backwardTransitions = model.getBackwardTransitions();
 
         // First, we add the formulas that encode
         // (1) if an incoming transition is chosen, an outgoing one is chosen as well (for non-initial states)
@@ -1895,8 +1895,19 @@ class SMTMinimalLabelSetGenerator {
             std::shared_ptr<storm::models::sparse::Model<T>> const& subModel = subChoiceOrigins.first;
             std::vector<storm::storage::FlatSet<uint_fast64_t>> const& subLabelSets = subChoiceOrigins.second;
 
-            // Now determine the maximal reachability probability in the sub-model.
-            maximalPropertyValue = computeMaximalReachabilityProbability(env, *subModel, phiStates, psiStates, rewardName);
+            // Candidates for which no target state is reachable are frequent and their probability is zero, so we determine the reachable states first
+            // and only invoke the numerical analysis if it is actually required.
+            storm::storage::BitVector reachableStates;
+            if (!rewardName || options.useDynamicConstraints) {
+                reachableStates =
+                    storm::utility::graph::getReachableStates(subModel->getTransitionMatrix(), subModel->getInitialStates(), phiStates, psiStates);
+            }
+            if (!rewardName && reachableStates.isDisjointFrom(psiStates)) {
+                maximalPropertyValue = {storm::utility::zero<T>()};
+            } else {
+                // Now determine the maximal reachability probability in the sub-model.
+                maximalPropertyValue = computeMaximalReachabilityProbability(env, *subModel, phiStates, psiStates, rewardName);
+            }
             totalModelCheckingTime += std::chrono::high_resolution_clock::now() - modelCheckingClock;
 
             // Depending on whether the threshold was successfully achieved or not, we proceed by either analyzing the bad solution or stopping the iteration
@@ -1914,10 +1925,7 @@ class SMTMinimalLabelSetGenerator {
                 }
 
                 if (options.useDynamicConstraints) {
-                    // Determine which of the two analysis techniques to call by performing a reachability analysis.
-                    storm::storage::BitVector reachableStates =
-                        storm::utility::graph::getReachableStates(subModel->getTransitionMatrix(), subModel->getInitialStates(), phiStates, psiStates);
-
+                    // Determine which of the two analysis techniques to call based on the reachability analysis.
                     if (reachableStates.isDisjointFrom(psiStates)) {
                         // If there was no target state reachable, analyze the solution and guide the solver into the right direction.
                         analyzeZeroProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
@@ -4,6 +4,8 @@
 #include "storm-dft/settings/modules/DftGspnSettings.h"
 #include "storm-dft/settings/modules/DftIOSettings.h"
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
+#include "storm-dft/simulator/DFTUnreliabilitySimulator.h"
+#include "storm-dft/storage/DftSymmetries.h"
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/settings/modules/GeneralSettings.h"
@@ -88,7 +90,7 @@ void processOptions() {
     // Compute minimal number of BE failures leading to system failure and
     // maximal number of BE failures not leading to system failure yet.
     // TODO: always needed?
-    auto bounds = storm::dft::api::computeBEFailureBounds(*dft, useSMT, solverTimeout);
+    auto bounds = storm::dft::api::computeBEFailureBounds(*dft, useSMT, solverTimeout, faultTreeSettings.getSmtThreads());
     STORM_LOG_DEBUG("BE failure bounds: lower bound: " << bounds.first << ", upper bound: " << bounds.second << ".");
 
 #ifdef STORM_HAVE_Z3
@@ -143,7 +145,7 @@ void processOptions() {
         auto const additionalRelevantEventNames{faultTreeSettings.getRelevantEvents()};
         storm::dft::api::analyzeDFTBdd<ValueType>(dft, isExportToBddDot, filename, isMTTF, mttfPrecision, mttfStepsize, mttfAlgorithm, isMinimalCutSets,
                                                   probabilityAnalysis, isModularisation, importanceMeasureName, timepoints, manuallyInputtedProperties,
-                                                  additionalRelevantEventNames, chunksize);
+                                                  additionalRelevantEventNames, chunksize, faultTreeSettings.getModularisationThreads());
 
         // don't perform other analysis if analyzeWithBdds is set
         if (dftIOSettings.isAnalyzeWithBdds()) {
@@ -220,6 +222,32 @@ void processOptions() {
         STORM_LOG_DEBUG("No FDEP conflicts found.");
     }
 
+    if (faultTreeSettings.isSimulationSet()) {
+        // Estimate the unreliability by simulation instead of building the state space
+        STORM_LOG_THROW(dftIOSettings.usePropTimebound() || dftIOSettings.usePropTimepoints(), storm::exceptions::InvalidSettingsException,
+                        "Simulation requires a time bound or time points.");
+        std::vector<double> timepoints;
+        if (dftIOSettings.usePropTimepoints()) {
+            timepoints = dftIOSettings.getPropTimepoints();
+        }
+        if (dftIOSettings.usePropTimebound()) {
+            timepoints.push_back(dftIOSettings.getPropTimebound());
+        }
+        dft->setRelevantEvents(relevantEvents, faultTreeSettings.isAllowDCForRelevantEvents());
+        storm::dft::storage::DftSymmetries symmetries;
+        storm::dft::storage::DFTStateGenerationInfo stateGenerationInfo(dft->buildStateGenerationInfo(symmetries));
+        storm::dft::simulator::DFTUnreliabilitySimulator<ValueType> simulator(*dft, stateGenerationInfo, faultTreeSettings.getSimulationSeed(),
+                                                                             faultTreeSettings.getSimulationThreads());
+        double const halfWidth = faultTreeSettings.isSimulationPrecisionSet() ? faultTreeSettings.getSimulationHalfWidth() : 0;
+        for (double timebound : timepoints) {
+            auto statistics = simulator.simulate(timebound, faultTreeSettings.getSimulationTraces(), halfWidth, faultTreeSettings.getSimulationConfidence());
+            std::cout << "Estimated system failure probability at timebound " << timebound << " is " << statistics.getProbability() << " +- "
+                      << statistics.confidenceHalfWidth << " (" << faultTreeSettings.getSimulationConfidence() * 100 << "% confidence, "
+                      << statistics.numberOfTraces << " traces)\n";
+        }
+        return;
+    }
+
     // TODO allow building of state space even without properties
     if (props.empty()) {
         STORM_LOG_WARN("No property given. No analysis will be performed.");
@@ -16,6 +16,7 @@
 #include "storm-dft/utility/RelevantEvents.h"
 
 #include "storm-gspn/api/storm-gspn.h"
+#include "storm/utility/parallel.h"
 
 namespace storm::dft {
 namespace api {
@@ -109,9 +110,24 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> prepareForMarkovAnalysis(st
 }
 
 template<typename ValueType>
-std::pair<uint64_t, uint64_t> computeBEFailureBounds(storm::dft::storage::DFT<ValueType> const& dft, bool useSMT, double solverTimeout) {
-    uint64_t lowerBEBound = storm::dft::utility::FailureBoundFinder::getLeastFailureBound(dft, useSMT, solverTimeout);
-    uint64_t upperBEBound = storm::dft::utility::FailureBoundFinder::getAlwaysFailedBound(dft, useSMT, solverTimeout);
+std::pair<uint64_t, uint64_t> computeBEFailureBounds(storm::dft::storage::DFT<ValueType> const& dft, bool useSMT, double solverTimeout,
+                                                     uint64_t numberOfThreads = 1) {
+    uint64_t lowerBEBound;
+    uint64_t upperBEBound;
+    if (useSMT && numberOfThreads > 1) {
+        // The searches for both bounds are independent and share the available threads
+        uint64_t const lowerThreads = numberOfThreads - numberOfThreads / 2;
+        storm::utility::parallel::forEachChunk(2, static_cast<uint64_t>(0), static_cast<uint64_t>(2), [&](uint64_t, uint64_t begin, uint64_t) {
+            if (begin == 0) {
+                lowerBEBound = storm::dft::utility::FailureBoundFinder::getLeastFailureBound(dft, useSMT, solverTimeout, lowerThreads);
+            } else {
+                upperBEBound = storm::dft::utility::FailureBoundFinder::getAlwaysFailedBound(dft, useSMT, solverTimeout, numberOfThreads - lowerThreads);
+            }
+        });
+    } else {
+        lowerBEBound = storm::dft::utility::FailureBoundFinder::getLeastFailureBound(dft, useSMT, solverTimeout);
+        upperBEBound = storm::dft::utility::FailureBoundFinder::getAlwaysFailedBound(dft, useSMT, solverTimeout);
+    }
     return std::make_pair(lowerBEBound, upperBEBound);
 }
 
@@ -231,13 +247,16 @@ typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analy
  * @param chunksize
  * The size of the chunks of doubles to work on at a time
  *
+ * @param numberOfThreads
+ * The number of threads used to analyse dynamic modules concurrently (only with modularisation)
+ *
  */
 template<typename ValueType>
 void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<ValueType>> const& dft, bool const exportToDot, std::string const& filename,
                    bool const calculateMttf, double const mttfPrecision, double const mttfStepsize, std::string const mttfAlgorithmName,
                    bool const calculateMCS, bool const calculateProbability, bool const useModularisation, std::string const importanceMeasureName,
                    std::vector<double> const& timepoints, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties,
-                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize);
+                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize, size_t const numberOfThreads = 1);
 
 /*!
  * Analyze the DFT using the SMT encoding
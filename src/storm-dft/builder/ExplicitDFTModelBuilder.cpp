@@ -1,6 +1,8 @@
 #include "ExplicitDFTModelBuilder.h"
 
 #include <map>
+#include <type_traits>
+#include <vector>
 
 #include <storm/exceptions/IllegalArgumentException.h>
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -13,6 +15,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/bitoperations.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
@@ -230,7 +233,12 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::buildModel(size_t iteration,
         approximationThreshold = ftSettings.getMaxDepth();
     }
 
-    exploreStateSpace(approximationThreshold);
+    if (std::is_same<ValueType, double>::value && approximationThreshold <= 0.0 && ftSettings.getExplorationThreads() > 1) {
+        // Without approximation, the order of exploration does not influence the resulting model and states can be expanded concurrently.
+        exploreStateSpaceConcurrently(ftSettings.getExplorationThreads(), ftSettings.getExplorationBatchSize());
+    } else {
+        exploreStateSpace(approximationThreshold);
+    }
 
     size_t stateSize = stateStorage.getNumberOfStates() + (this->uniqueFailedState ? 1 : 0);
     modelComponents.markovianStates.resize(stateSize);
@@ -417,95 +425,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
             ++nrExpandedStates;
             storm::generator::StateBehavior<ValueType, StateType> behavior =
                 generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
-            STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
-            setMarkovian(behavior.begin()->isMarkovian());
-
-            // Now add all choices.
-            for (auto const& choice : behavior) {
-                // Add the probabilistic behavior to the matrix.
-                for (auto const& stateProbabilityPair : choice) {
-                    STORM_LOG_ASSERT(!storm::utility::isZero(stateProbabilityPair.second), "Probability zero.");
-                    // Set transition to state id + offset. This helps in only remapping all previously skipped states.
-                    matrixBuilder.addTransition(matrixBuilder.mappingOffset + stateProbabilityPair.first, stateProbabilityPair.second);
-                    // Set heuristic values for reached states
-                    auto iter = statesNotExplored.find(stateProbabilityPair.first);
-                    if (iter != statesNotExplored.end()) {
-                        // Update heuristic values
-                        DFTStatePointer state = iter->second.first;
-                        if (!iter->second.second) {
-                            // Initialize heuristic values
-                            ExplorationHeuristicPointer heuristic;
-                            switch (usedHeuristic) {
-                                case storm::dft::builder::ApproximationHeuristic::DEPTH:
-                                    heuristic =
-                                        std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic);
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
-                                    heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(
-                                        stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                                    heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(
-                                        stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                    break;
-                                default:
-                                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
-                            }
-
-                            iter->second.second = heuristic;
-                            // if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) ||
-                            // state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() &&
-                            // !state->getFailableElements().hasBEs())) {
-                            if (state->getFailableElements().hasDependencies() ||
-                                (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
-                                // Do not skip absorbing state or if reached by dependencies
-                                iter->second.second->markExpand();
-                            }
-                            if (usedHeuristic == storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
-                                // Compute bounds for heuristic now
-                                if (state->isPseudoState()) {
-                                    // Create concrete state from pseudo state
-                                    state->construct();
-                                }
-                                STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
-
-                                // Initialize bounds
-                                // TODO: avoid hack
-                                ValueType lowerBound = getLowerBound(state);
-                                ValueType upperBound = getUpperBound(state);
-                                heuristic->setBounds(lowerBound, upperBound);
-                            }
-
-                            explorationQueue.push(heuristic);
-                        } else if (!iter->second.second->isExpand()) {
-                            bool changedPriority = false;
-                            double oldPriority = iter->second.second->getPriority();
-                            switch (usedHeuristic) {
-                                case storm::dft::builder::ApproximationHeuristic::DEPTH:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic,
-                                                                                                 /* next values are irrelevant */ stateProbabilityPair.second,
-                                                                                                 stateProbabilityPair.second);
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
-                                                                                                 choice.getTotalMass());
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
-                                                                                                 choice.getTotalMass());
-                                    break;
-                                default:
-                                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
-                            }
-                            if (changedPriority) {
-                                // Update priority queue
-                                explorationQueue.update(iter->second.second, oldPriority);
-                            }
-                        }
-                    }
-                }
-                matrixBuilder.finishRow();
-            }
+            addStateBehavior(currentState, currentExplorationHeuristic, behavior);
         }
         if (storm::utility::resources::isTerminate()) {
             break;
@@ -521,6 +441,190 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
     STORM_LOG_ASSERT(nrSkippedStates == skippedStates.size(), "Nr skipped states is wrong");
 }
 
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpaceConcurrently(uint64_t numberOfThreads, uint64_t batchSize) {
+    size_t nrExpandedStates = 0;
+    storm::utility::ProgressMeasurement progress("explored states");
+    progress.startNewMeasurement(0);
+    std::vector<storm::dft::generator::DftNextStateGenerator<ValueType, StateType>> generators(numberOfThreads, generator);
+    std::vector<ExplorationHeuristicPointer> batchHeuristics;
+    std::vector<DFTStatePointer> batchStates;
+    std::vector<storm::generator::StateBehavior<ValueType, StateType>> batchBehaviors;
+    std::vector<std::vector<DFTStatePointer>> batchDiscoveredStates;
+    while (!explorationQueue.empty()) {
+        // Take the next batch of states from the queue
+        batchHeuristics.clear();
+        batchStates.clear();
+        while (!explorationQueue.empty() && batchHeuristics.size() < batchSize) {
+            ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.pop();
+            StateType currentId = currentExplorationHeuristic->getId();
+            auto itFind = statesNotExplored.find(currentId);
+            STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
+            DFTStatePointer currentState = itFind->second.first;
+            STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
+            STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
+            statesNotExplored.erase(itFind);
+            if (currentState->isPseudoState()) {
+                // Create concrete state from pseudo state
+                currentState->construct();
+            }
+            STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
+            batchHeuristics.push_back(currentExplorationHeuristic);
+            batchStates.push_back(currentState);
+        }
+
+        // Expand the states of the batch concurrently. Successor states are only recorded and get a temporary id which is resolved afterwards, as
+        // the state storage is not thread-safe.
+        batchBehaviors.assign(batchStates.size(), storm::generator::StateBehavior<ValueType, StateType>());
+        batchDiscoveredStates.assign(batchStates.size(), std::vector<DFTStatePointer>());
+        storm::utility::parallel::forEachBlock(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(batchStates.size()), 8,
+                                               [&](uint64_t threadIndex, uint64_t blockBegin, uint64_t blockEnd) {
+                                                   auto& threadGenerator = generators[threadIndex];
+                                                   for (uint64_t index = blockBegin; index < blockEnd; ++index) {
+                                                       auto& discoveredStates = batchDiscoveredStates[index];
+                                                       threadGenerator.load(batchStates[index]);
+                                                       batchBehaviors[index] = threadGenerator.expand([&](DFTStatePointer const& state) {
+                                                           discoveredStates.push_back(state);
+                                                           return static_cast<StateType>(OFFSET_DISCOVERED_STATE + discoveredStates.size() - 1);
+                                                       });
+                                                   }
+                                               });
+
+        // Add the discovered states and the behavior in the order of the batch
+        for (uint64_t index = 0; index < batchStates.size(); ++index) {
+            std::vector<StateType> discoveredIds;
+            discoveredIds.reserve(batchDiscoveredStates[index].size());
+            for (auto const& state : batchDiscoveredStates[index]) {
+                discoveredIds.push_back(getOrAddStateIndex(state));
+            }
+            storm::generator::StateBehavior<ValueType, StateType> behavior;
+            for (auto const& choice : batchBehaviors[index]) {
+                // Choices are rebuilt as different temporary ids might refer to the same state.
+                storm::generator::Choice<ValueType, StateType> resolvedChoice(choice.getActionIndex(), choice.isMarkovian());
+                for (auto const& stateProbabilityPair : choice) {
+                    StateType stateId = stateProbabilityPair.first;
+                    if (stateId >= OFFSET_DISCOVERED_STATE) {
+                        stateId = discoveredIds[stateId - OFFSET_DISCOVERED_STATE];
+                    }
+                    resolvedChoice.addProbability(stateId, stateProbabilityPair.second);
+                }
+                behavior.addChoice(std::move(resolvedChoice));
+            }
+            behavior.setExpanded();
+
+            // Remember that the current row group was actually filled with the transitions of a different state
+            matrixBuilder.setRemapping(batchStates[index]->getId());
+            matrixBuilder.newRowGroup();
+            ++nrExpandedStates;
+            addStateBehavior(batchStates[index], batchHeuristics[index], behavior);
+            // Output number of currently explored states
+            if (nrExpandedStates % 100 == 0) {
+                progress.updateProgress(nrExpandedStates);
+            }
+        }
+        if (storm::utility::resources::isTerminate()) {
+            break;
+        }
+    }  // end exploration
+
+    STORM_LOG_INFO("Expanded " << nrExpandedStates << " states using " << numberOfThreads << " threads");
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::addStateBehavior(DFTStatePointer const& currentState,
+                                                                     ExplorationHeuristicPointer const& currentExplorationHeuristic,
+                                                                     storm::generator::StateBehavior<ValueType, StateType> const& behavior) {
+    STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
+    setMarkovian(behavior.begin()->isMarkovian());
+
+    // Now add all choices.
+    for (auto const& choice : behavior) {
+        // Add the probabilistic behavior to the matrix.
+        for (auto const& stateProbabilityPair : choice) {
+            STORM_LOG_ASSERT(!storm::utility::isZero(stateProbabilityPair.second), "Probability zero.");
+            // Set transition to state id + offset. This helps in only remapping all previously skipped states.
+            matrixBuilder.addTransition(matrixBuilder.mappingOffset + stateProbabilityPair.first, stateProbabilityPair.second);
+            // Set heuristic values for reached states
+            auto iter = statesNotExplored.find(stateProbabilityPair.first);
+            if (iter != statesNotExplored.end()) {
+                // Update heuristic values
+                DFTStatePointer state = iter->second.first;
+                if (!iter->second.second) {
+                    // Initialize heuristic values
+                    ExplorationHeuristicPointer heuristic;
+                    switch (usedHeuristic) {
+                        case storm::dft::builder::ApproximationHeuristic::DEPTH:
+                            heuristic =
+                                std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic);
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
+                            heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(
+                                stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
+                            heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(
+                                stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                            break;
+                        default:
+                            STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
+                    }
+
+                    iter->second.second = heuristic;
+                    // if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) ||
+                    // state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() &&
+                    // !state->getFailableElements().hasBEs())) {
+                    if (state->getFailableElements().hasDependencies() ||
+                        (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
+                        // Do not skip absorbing state or if reached by dependencies
+                        iter->second.second->markExpand();
+                    }
+                    if (usedHeuristic == storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
+                        // Compute bounds for heuristic now
+                        if (state->isPseudoState()) {
+                            // Create concrete state from pseudo state
+                            state->construct();
+                        }
+                        STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
+
+                        // Initialize bounds
+                        // TODO: avoid hack
+                        ValueType lowerBound = getLowerBound(state);
+                        ValueType upperBound = getUpperBound(state);
+                        heuristic->setBounds(lowerBound, upperBound);
+                    }
+
+                    explorationQueue.push(heuristic);
+                } else if (!iter->second.second->isExpand()) {
+                    bool changedPriority = false;
+                    double oldPriority = iter->second.second->getPriority();
+                    switch (usedHeuristic) {
+                        case storm::dft::builder::ApproximationHeuristic::DEPTH:
+                            changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic,
+                                                                                         /* next values are irrelevant */ stateProbabilityPair.second,
+                                                                                         stateProbabilityPair.second);
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
+                            changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
+                                                                                         choice.getTotalMass());
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
+                            changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
+                                                                                         choice.getTotalMass());
+                            break;
+                        default:
+                            STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
+                    }
+                    if (changedPriority) {
+                        // Update priority queue
+                        explorationQueue.update(iter->second.second, oldPriority);
+                    }
+                }
+            }
+        }
+        matrixBuilder.finishRow();
+    }
+}
+
 template<typename ValueType, typename StateType>
 void ExplicitDFTModelBuilder<ValueType, StateType>::buildLabeling() {
     bool isAddLabelsClaiming = storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().isAddLabelsClaiming();
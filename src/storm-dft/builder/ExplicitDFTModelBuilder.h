@@ -190,6 +190,25 @@ class ExplicitDFTModelBuilder {
      */
     void exploreStateSpace(double approximationThreshold);
 
+    /*!
+     * Explore state space of DFT without approximation by expanding batches of states concurrently.
+     * Only the expansion of states is performed concurrently, the states and transitions are added sequentially in the order of the batch.
+     *
+     * @param numberOfThreads Number of threads expanding states.
+     * @param batchSize Maximal number of states expanded concurrently.
+     */
+    void exploreStateSpaceConcurrently(uint64_t numberOfThreads, uint64_t batchSize);
+
+    /*!
+     * Add the given behavior of the current state to the matrix and initialize or update the heuristic values of the reached states.
+     *
+     * @param currentState The current state.
+     * @param currentExplorationHeuristic The heuristic of the current state.
+     * @param behavior The behavior of the current state.
+     */
+    void addStateBehavior(DFTStatePointer const& currentState, ExplorationHeuristicPointer const& currentExplorationHeuristic,
+                          storm::generator::StateBehavior<ValueType, StateType> const& behavior);
+
     /*!
      * Initialize the matrix for a refinement iteration.
      */
@@ -278,6 +297,8 @@ class ExplicitDFTModelBuilder {
     const size_t INITIAL_BITVECTOR_SIZE = 20000;
     // Offset used for pseudo states.
     const StateType OFFSET_PSEUDO_STATE = std::numeric_limits<StateType>::max() / 2;
+    // Offset used for the temporary ids of states discovered during concurrent exploration.
+    const StateType OFFSET_DISCOVERED_STATE = std::numeric_limits<StateType>::max() / 4 * 3;
 
     // Dft
     storm::dft::storage::DFT<ValueType> const& dft;
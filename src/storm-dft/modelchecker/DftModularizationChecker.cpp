@@ -1,5 +1,7 @@
 #include "DftModularizationChecker.h"
 
+#include <algorithm>
+#include <numeric>
 #include <sstream>
 
 #include "storm-dft/adapters/SFTBDDPropertyFormulaAdapter.h"
@@ -12,13 +14,14 @@
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
 #include "storm/exceptions/InvalidModelException.h"
+#include "storm/utility/parallel.h"
 
 namespace storm::dft {
 namespace modelchecker {
 
 template<typename ValueType>
-DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft)
-    : dft{dft}, modelchecker(true), sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()} {
+DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, size_t numberOfThreads)
+    : dft{dft}, modelchecker(true), sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()}, numberOfThreads{numberOfThreads} {
     // Initialize modules
     storm::dft::utility::DftModularizer<ValueType> modularizer;
     auto topModule = modularizer.computeModules(*dft);
@@ -69,10 +72,42 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
     // Map from module representatives to their sample points
     std::map<size_t, std::map<ValueType, ValueType>> samplePoints;
 
+    // Create properties
+    std::stringstream propertyStream{};
+    for (auto const timebound : timepoints) {
+        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
+    }
+    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
+
     // First analyse all dynamic modules
-    for (auto const& mod : dynamicModules) {
-        STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
-        auto result = analyseDynamicModule(mod, timepoints);
+    std::vector<typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results> results(dynamicModules.size());
+    if (numberOfThreads > 1 && dynamicModules.size() > 1) {
+        // Start with the largest modules such that the analysis of the last modules does not dominate the overall time
+        std::vector<size_t> order(dynamicModules.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::vector<size_t> moduleSizes;
+        for (auto const& mod : dynamicModules) {
+            moduleSizes.push_back(mod.getAllElements().size());
+        }
+        std::stable_sort(order.begin(), order.end(), [&moduleSizes](size_t a, size_t b) { return moduleSizes[a] > moduleSizes[b]; });
+        STORM_LOG_DEBUG("Analyse " << dynamicModules.size() << " dynamic modules using " << numberOfThreads << " threads.");
+        storm::utility::parallel::forEachBlock(numberOfThreads, static_cast<size_t>(0), order.size(), 1, [&](uint64_t, size_t begin, size_t end) {
+            // The modelchecker keeps statistics and is therefore not shared
+            storm::dft::modelchecker::DFTModelChecker<ValueType> moduleChecker(false);
+            for (size_t index = begin; index < end; ++index) {
+                results[order[index]] = analyseDynamicModule(dynamicModules[order[index]], props, moduleChecker);
+            }
+        });
+    } else {
+        for (size_t index = 0; index < dynamicModules.size(); ++index) {
+            STORM_LOG_DEBUG("Analyse dynamic module " << dynamicModules[index].toString(*dft));
+            results[index] = analyseDynamicModule(dynamicModules[index], props, modelchecker);
+        }
+    }
+
+    for (size_t index = 0; index < dynamicModules.size(); ++index) {
+        auto const& mod = dynamicModules[index];
+        auto const& result = results[index];
         // Remember probabilities for module
         std::map<ValueType, ValueType> activeSamples{};
         for (size_t i{0}; i < timepoints.size(); ++i) {
@@ -123,20 +158,13 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
 
 template<typename ValueType>
 typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results DftModularizationChecker<ValueType>::analyseDynamicModule(
-    storm::dft::storage::DftIndependentModule const& module, std::vector<ValueType> const& timepoints) {
+    storm::dft::storage::DftIndependentModule const& module, FormulaVector const& properties,
+    storm::dft::modelchecker::DFTModelChecker<ValueType>& moduleChecker) {
     STORM_LOG_ASSERT(!module.isStatic() && !module.isFullyStatic(), "Module should be dynamic.");
     STORM_LOG_ASSERT(!dft->getElement(module.getRepresentative())->isBasicElement(), "Dynamic module should not be a single BE.");
 
     auto subDft = module.getSubtree(*dft);
-
-    // Create properties
-    std::stringstream propertyStream{};
-    for (auto const timebound : timepoints) {
-        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
-    }
-    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
-
-    return std::move(modelchecker.check(subDft, props, false, false, {}));
+    return std::move(moduleChecker.check(subDft, properties, false, false, {}));
 }
 
 // Explicitly instantiate the class.
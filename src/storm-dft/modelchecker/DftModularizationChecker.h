@@ -28,8 +28,9 @@ class DftModularizationChecker {
     /*!
      * Initializes and computes all modules.
      * @param dft DFT.
+     * @param numberOfThreads Number of threads used to analyse the dynamic modules concurrently.
      */
-    DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft);
+    DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, size_t numberOfThreads = 1);
 
     /*!
      * Calculate the properties specified by the formulas.
@@ -75,10 +76,12 @@ class DftModularizationChecker {
     /*!
      * Analyse the given dynamic module.
      * @param module Module.
-     * @param timepoints Time points for which the failure probability of element should be computed.
+     * @param properties Properties for the failure probability of the module at the time points.
+     * @param moduleChecker DFT modelchecker used for the analysis.
      */
-    typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(storm::dft::storage::DftIndependentModule const &module,
-                                                                                                    std::vector<ValueType> const &timepoints);
+    typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(
+        storm::dft::storage::DftIndependentModule const &module, FormulaVector const &properties,
+        storm::dft::modelchecker::DFTModelChecker<ValueType> &moduleChecker);
 
     // DFT.
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft;
@@ -89,6 +92,8 @@ class DftModularizationChecker {
     std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager;
     // Independent modules with their top element
     std::vector<storm::dft::storage::DftIndependentModule> dynamicModules;
+    // Number of threads used to analyse the dynamic modules
+    size_t numberOfThreads;
 };
 
 }  // namespace modelchecker
@@ -1,6 +1,7 @@
 #include <gmm/gmm_std.h>
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
@@ -114,126 +115,171 @@ ValueType recursiveBirnbaumFactor(uint32_t const variableIndex, Bdd const bdd, s
 }
 
 /**
- * \returns
- * The probabilities that the bdd is true
- * given the probabilities that the variables are true.
- *
- * \param chunksize
- * The width of the Eigen Arrays
- *
- * \param bdd
- * The bdd for which to calculate the probabilities
+ * A Bdd stored as an array of nodes in topological order,
+ * i.e., the children of every node precede the node itself.
+ * The nodes 0 and 1 are the terminals false and true.
+ * The last node is the root.
+ */
+struct FlatBdd {
+    // For each node the position of its variable in variables
+    std::vector<size_t> variablePositions;
+    std::vector<size_t> thenNodes;
+    std::vector<size_t> elseNodes;
+    // The variables occurring in the bdd
+    std::vector<uint32_t> variables;
+    std::unordered_map<uint32_t, size_t> variableToPosition;
+
+    size_t getNumberOfNodes() const {
+        return thenNodes.size();
+    }
+
+    size_t getRoot() const {
+        return getNumberOfNodes() - 1;
+    }
+};
+
+/**
+ * Adds the given bdd and all its sub Bdds to the flat bdd.
  *
- * \param indexToProbabilities
- * A reference to a mapping
- * that must map every variable in the bdd to probabilities
+ * \returns
+ * The node of the given bdd.
  *
- * \param bddToProbabilities
+ * \param bddToNode
  * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
- *
- * \note
- * Great care was made that all pointers
- * are valid elements in bddToProbabilities.
- *
  */
-Eigen::ArrayXd const *recursiveProbabilities(size_t const chunksize, Bdd const bdd, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                             std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities) {
-    auto const bddId{bdd.GetBDD()};
-    auto const it{bddToProbabilities.find(bddId)};
-    if (it != bddToProbabilities.end() && it->second.first) {
-        return &it->second.second;
+size_t flattenBdd(Bdd const bdd, FlatBdd &flatBdd, std::unordered_map<uint64_t, size_t> &bddToNode) {
+    if (bdd.isZero()) {
+        return 0;
+    } else if (bdd.isOne()) {
+        return 1;
     }
-
-    auto &bddToProbabilitiesElement{bddToProbabilities[bddId]};
-    if (bdd.isOne()) {
-        bddToProbabilitiesElement.first = true;
-        bddToProbabilitiesElement.second = Eigen::ArrayXd::Constant(chunksize, 1);
-        return &bddToProbabilitiesElement.second;
-    } else if (bdd.isZero()) {
-        bddToProbabilitiesElement.first = true;
-        bddToProbabilitiesElement.second = Eigen::ArrayXd::Constant(chunksize, 0);
-        return &bddToProbabilitiesElement.second;
+    auto const it{bddToNode.find(bdd.GetBDD())};
+    if (it != bddToNode.end()) {
+        return it->second;
     }
-
-    auto const &thenProbabilities{*recursiveProbabilities(chunksize, bdd.Then(), indexToProbabilities, bddToProbabilities)};
-    auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
-
+    auto const thenNode{flattenBdd(bdd.Then(), flatBdd, bddToNode)};
+    auto const elseNode{flattenBdd(bdd.Else(), flatBdd, bddToNode)};
     auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
+    auto const variableIt{flatBdd.variableToPosition.emplace(currentVar, flatBdd.variables.size())};
+    if (variableIt.second) {
+        flatBdd.variables.push_back(currentVar);
+    }
+    auto const node{flatBdd.getNumberOfNodes()};
+    flatBdd.variablePositions.push_back(variableIt.first->second);
+    flatBdd.thenNodes.push_back(thenNode);
+    flatBdd.elseNodes.push_back(elseNode);
+    bddToNode[bdd.GetBDD()] = node;
+    return node;
+}
 
-    // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
-    bddToProbabilitiesElement.first = true;
-    bddToProbabilitiesElement.second = currentProbabilities * thenProbabilities + (1 - currentProbabilities) * elseProbabilities;
-    return &bddToProbabilitiesElement.second;
+/**
+ * \returns
+ * The flat representation of the given bdd.
+ */
+FlatBdd flattenBdd(Bdd const bdd) {
+    FlatBdd flatBdd{};
+    // Terminals
+    flatBdd.variablePositions = {0, 0};
+    flatBdd.thenNodes = {0, 1};
+    flatBdd.elseNodes = {0, 1};
+    std::unordered_map<uint64_t, size_t> bddToNode{};
+    auto const root{flattenBdd(bdd, flatBdd, bddToNode)};
+    if (root != flatBdd.getRoot()) {
+        // The bdd is a terminal: append a node with both children being this terminal as root
+        flatBdd.variablePositions.push_back(0);
+        flatBdd.thenNodes.push_back(root);
+        flatBdd.elseNodes.push_back(root);
+    }
+    return flatBdd;
 }
 
 /**
  * \returns
- * The birnbaum importance factors of the given variable
+ * For each variable of the flat bdd its probabilities.
+ *
+ * \param indexToProbabilities
+ * A reference to a mapping
+ * that must map every variable in the bdd to probabilities
+ */
+std::vector<Eigen::ArrayXd const *> getVariableProbabilities(FlatBdd const &flatBdd, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities) {
+    std::vector<Eigen::ArrayXd const *> variableProbabilities{};
+    variableProbabilities.reserve(flatBdd.variables.size());
+    for (auto const variable : flatBdd.variables) {
+        variableProbabilities.push_back(&indexToProbabilities.at(variable));
+    }
+    return variableProbabilities;
+}
+
+/**
+ * Computes the probabilities that the nodes of the flat bdd are true
+ * given the probabilities that the variables are true.
+ * The nodes are evaluated bottom-up, each with all timepoints at once.
  *
  * \param chunksize
- * The width of the Eigen Arrays
+ * The number of timepoints
  *
- * \param bdd
- * The bdd for which to calculate the factors
+ * \param variableProbabilities
+ * For each variable of the flat bdd its probabilities
  *
- * \param variableIndex
- * The index of the variable the birnbaum factors should be calculated
+ * \param probabilities
+ * Is resized and set to the probabilities:
+ * One column per node, one row per timepoint.
+ */
+void computeProbabilities(size_t const chunksize, FlatBdd const &flatBdd, std::vector<Eigen::ArrayXd const *> const &variableProbabilities,
+                          Eigen::ArrayXXd &probabilities) {
+    auto const numberOfNodes{flatBdd.getNumberOfNodes()};
+    probabilities.resize(chunksize, numberOfNodes);
+    probabilities.col(0).setZero();
+    probabilities.col(1).setOnes();
+    for (size_t node{2}; node < numberOfNodes; ++node) {
+        if (flatBdd.thenNodes[node] == flatBdd.elseNodes[node]) {
+            probabilities.col(node) = probabilities.col(flatBdd.thenNodes[node]);
+        } else {
+            auto const &currentProbabilities{*variableProbabilities[flatBdd.variablePositions[node]]};
+            // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
+            probabilities.col(node) = currentProbabilities * probabilities.col(flatBdd.thenNodes[node]) +
+                                      (1 - currentProbabilities) * probabilities.col(flatBdd.elseNodes[node]);
+        }
+    }
+}
+
+/**
+ * Computes the birnbaum importance factors of all variables of the flat bdd at once.
+ * The birnbaum factor of x is the sum over all nodes n labelled with x of
+ * P(reaching n from the root) * (P(Then(n)) - P(Else(n))).
  *
- * \param indexToProbability
- * A reference to a mapping
- * that must map every variable in the bdd to a probabilities
+ * \param chunksize
+ * The number of timepoints
  *
- * \param bddToProbability
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
+ * \param variableProbabilities
+ * For each variable of the flat bdd its probabilities
  *
- * \param bddToBirnbaumFactor
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
+ * \param probabilities
+ * The probabilities of the nodes as computed by computeProbabilities
+ *
+ * \param birnbaumFactors
+ * Is resized and set to the birnbaum factors:
+ * One column per variable of the flat bdd, one row per timepoint.
  */
-Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t const variableIndex, Bdd const bdd,
-                                               std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToBirnbaumFactors) {
-    auto const bddId{bdd.GetBDD()};
-    auto const it{bddToBirnbaumFactors.find(bddId)};
-    if (it != bddToBirnbaumFactors.end() && it->second.first) {
-        return &it->second.second;
-    }
-
-    auto &bddToBirnbaumFactorsElement{bddToBirnbaumFactors[bddId]};
-    if (bdd.isTerminal() || bdd.TopVar() > variableIndex) {
-        // return vector 0;
-        bddToBirnbaumFactorsElement.second = Eigen::ArrayXd::Constant(chunksize, 0);
-        return &bddToBirnbaumFactorsElement.second;
-    }
-
-    auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
-
-    if (currentVar == variableIndex) {
-        auto const &thenProbabilities{*recursiveProbabilities(chunksize, bdd.Then(), indexToProbabilities, bddToProbabilities)};
-        auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
-
-        bddToBirnbaumFactorsElement.first = true;
-        bddToBirnbaumFactorsElement.second = thenProbabilities - elseProbabilities;
-        return &bddToBirnbaumFactorsElement.second;
+void computeBirnbaumFactors(size_t const chunksize, FlatBdd const &flatBdd, std::vector<Eigen::ArrayXd const *> const &variableProbabilities,
+                            Eigen::ArrayXXd const &probabilities, Eigen::ArrayXXd &birnbaumFactors) {
+    auto const numberOfNodes{flatBdd.getNumberOfNodes()};
+    birnbaumFactors.setZero(chunksize, flatBdd.variables.size());
+    Eigen::ArrayXXd reachProbabilities{Eigen::ArrayXXd::Zero(chunksize, numberOfNodes)};
+    reachProbabilities.col(flatBdd.getRoot()).setOnes();
+    // Parents precede their children in reverse topological order
+    for (size_t node{numberOfNodes - 1}; node >= 2; --node) {
+        auto const thenNode{flatBdd.thenNodes[node]};
+        auto const elseNode{flatBdd.elseNodes[node]};
+        if (thenNode == elseNode) {
+            reachProbabilities.col(thenNode) += reachProbabilities.col(node);
+            continue;
+        }
+        auto const &currentProbabilities{*variableProbabilities[flatBdd.variablePositions[node]]};
+        birnbaumFactors.col(flatBdd.variablePositions[node]) += reachProbabilities.col(node) * (probabilities.col(thenNode) - probabilities.col(elseNode));
+        reachProbabilities.col(thenNode) += currentProbabilities * reachProbabilities.col(node);
+        reachProbabilities.col(elseNode) += (1 - currentProbabilities) * reachProbabilities.col(node);
     }
-
-    // currentVar < variableIndex
-    auto const &thenBirnbaumFactors{
-        *recursiveBirnbaumFactors(chunksize, variableIndex, bdd.Then(), indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-    auto const &elseBirnbaumFactors{
-        *recursiveBirnbaumFactors(chunksize, variableIndex, bdd.Else(), indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
-    bddToBirnbaumFactorsElement.first = true;
-    bddToBirnbaumFactorsElement.second = currentProbabilities * thenBirnbaumFactors + (1 - currentProbabilities) * elseBirnbaumFactors;
-    return &bddToBirnbaumFactorsElement.second;
 }
 }  // namespace
 
@@ -347,23 +393,19 @@ ValueType SFTBDDChecker::getProbabilityAtTimebound(Bdd bdd, ValueType timebound)
 }
 
 std::vector<ValueType> SFTBDDChecker::getProbabilitiesAtTimepoints(Bdd bdd, std::vector<ValueType> const &timepoints, size_t chunksize) const {
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
+    // The bdd is only traversed once, all chunks are evaluated on its flat representation
+    auto const flatBdd{flattenBdd(bdd)};
+    Eigen::ArrayXXd probabilities{};
     std::vector<ValueType> resultProbabilities{};
     resultProbabilities.reserve(timepoints.size());
 
     chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-
-        // Great care was made so that the pointer returned is always valid
-        // and points to an element in bddToProbabilities
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+        computeProbabilities(currentChunksize, flatBdd, getVariableProbabilities(flatBdd, indexToProbabilities), probabilities);
 
         // Update result Probabilities
+        auto const root{flatBdd.getRoot()};
         for (size_t i{0}; i < currentChunksize; ++i) {
-            resultProbabilities.push_back(probabilitiesArray(i));
+            resultProbabilities.push_back(probabilities(i, root));
         }
     });
 
@@ -396,20 +438,26 @@ std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueT
     std::vector<ValueType> resultVector{};
     resultVector.reserve(getDFT()->getBasicElements().size());
 
-    std::map<uint32_t, ValueType> indexToProbability{};
+    std::map<uint32_t, Eigen::ArrayXd> indexToProbabilities{};
     for (auto const &be : getDFT()->getBasicElements()) {
         auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
+        indexToProbabilities[currentIndex] = Eigen::ArrayXd::Constant(1, be->getUnreliability(timebound));
     }
-    std::map<uint64_t, ValueType> bddToProbability{};
 
-    auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
+    // The birnbaum factors of all basic elements are obtained from a single pass over the bdd
+    auto const flatBdd{flattenBdd(bdd)};
+    auto const variableProbabilities{getVariableProbabilities(flatBdd, indexToProbabilities)};
+    Eigen::ArrayXXd probabilities{};
+    Eigen::ArrayXXd birnbaumFactors{};
+    computeProbabilities(1, flatBdd, variableProbabilities, probabilities);
+    computeBirnbaumFactors(1, flatBdd, variableProbabilities, probabilities, birnbaumFactors);
+    ValueType const probability{probabilities(0, flatBdd.getRoot())};
 
     for (auto const &be : getDFT()->getBasicElements()) {
         auto const index{getSylvanBddManager()->getIndex(be->name())};
-        std::map<uint64_t, ValueType> bddToBirnbaumFactor{};
-        auto const birnbaumFactor{recursiveBirnbaumFactor(index, bdd, indexToProbability, bddToProbability, bddToBirnbaumFactor)};
-        auto const &beProbability{indexToProbability[index]};
+        auto const variableIt{flatBdd.variableToPosition.find(index)};
+        ValueType const birnbaumFactor{variableIt != flatBdd.variableToPosition.end() ? birnbaumFactors(0, variableIt->second) : 0};
+        ValueType const beProbability{indexToProbabilities.at(index)(0)};
         resultVector.push_back(func(beProbability, probability, birnbaumFactor));
     }
     return resultVector;
@@ -418,27 +466,25 @@ std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueT
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::string const &beName, std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
+    auto const flatBdd{flattenBdd(getTopLevelElementBdd())};
+    auto const index{getSylvanBddManager()->getIndex(beName)};
+    auto const variableIt{flatBdd.variableToPosition.find(index)};
+    Eigen::ArrayXXd probabilities{};
+    Eigen::ArrayXXd birnbaumFactors{};
     std::vector<ValueType> resultVector{};
     resultVector.reserve(timepoints.size());
 
     chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd caches
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-        for (auto &i : bddToBirnbaumFactors) {
-            i.second.first = false;
+        auto const variableProbabilities{getVariableProbabilities(flatBdd, indexToProbabilities)};
+        computeProbabilities(currentChunksize, flatBdd, variableProbabilities, probabilities);
+        computeBirnbaumFactors(currentChunksize, flatBdd, variableProbabilities, probabilities, birnbaumFactors);
+
+        Eigen::ArrayXd const probabilitiesArray{probabilities.col(flatBdd.getRoot())};
+        // The factor is 0 if the bdd does not depend on the basic element
+        Eigen::ArrayXd birnbaumFactorsArray{Eigen::ArrayXd::Zero(currentChunksize)};
+        if (variableIt != flatBdd.variableToPosition.end()) {
+            birnbaumFactorsArray = birnbaumFactors.col(variableIt->second);
         }
-
-        // Great care was made so that the pointer returned is always valid
-        auto const index{getSylvanBddManager()->getIndex(beName)};
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
-        auto const &birnbaumFactorsArray{
-            *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
         auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
         auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
 
@@ -454,11 +500,12 @@ std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::str
 template<typename FuncType>
 std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
+    auto const flatBdd{flattenBdd(getTopLevelElementBdd())};
     auto const basicElements{getDFT()->getBasicElements()};
 
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
+    // The birnbaum factors of all basic elements are obtained from a single pass over the bdd
+    Eigen::ArrayXXd probabilities{};
+    Eigen::ArrayXXd birnbaumFactors{};
     std::vector<std::vector<ValueType>> resultVector{};
     resultVector.resize(getDFT()->getBasicElements().size());
     for (auto &i : resultVector) {
@@ -466,25 +513,20 @@ std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTim
     }
 
     chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+        auto const variableProbabilities{getVariableProbabilities(flatBdd, indexToProbabilities)};
+        computeProbabilities(currentChunksize, flatBdd, variableProbabilities, probabilities);
+        computeBirnbaumFactors(currentChunksize, flatBdd, variableProbabilities, probabilities, birnbaumFactors);
+        Eigen::ArrayXd const probabilitiesArray{probabilities.col(flatBdd.getRoot())};
 
         for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
             auto const &be{basicElements[basicElementIndex]};
-            // Invalidate bdd cache
-            for (auto &i : bddToBirnbaumFactors) {
-                i.second.first = false;
-            }
-
-            // Great care was made so that the pointer returned is always
-            // valid and points to an element in bddToProbabilities
             auto const index{getSylvanBddManager()->getIndex(be->name())};
-            auto const &birnbaumFactorsArray{
-                *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
+            // The factor is 0 if the bdd does not depend on the basic element
+            auto const variableIt{flatBdd.variableToPosition.find(index)};
+            Eigen::ArrayXd birnbaumFactorsArray{Eigen::ArrayXd::Zero(currentChunksize)};
+            if (variableIt != flatBdd.variableToPosition.end()) {
+                birnbaumFactorsArray = birnbaumFactors.col(variableIt->second);
+            }
 
             auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
 
@@ -35,6 +35,12 @@ const std::string FaultTreeSettings::chunksizeOptionName = "chunksize";
 const std::string FaultTreeSettings::mttfPrecisionName = "mttf-precision";
 const std::string FaultTreeSettings::mttfStepsizeName = "mttf-stepsize";
 const std::string FaultTreeSettings::mttfAlgorithmName = "mttf-algorithm";
+const std::string FaultTreeSettings::explorationThreadsOptionName = "exploration-threads";
+const std::string FaultTreeSettings::modularisationThreadsOptionName = "modularisation-threads";
+const std::string FaultTreeSettings::simulationOptionName = "simulation";
+const std::string FaultTreeSettings::simulationPrecisionOptionName = "simulation-precision";
+const std::string FaultTreeSettings::simulationThreadsOptionName = "simulation-threads";
+const std::string FaultTreeSettings::smtThreadsOptionName = "smt-threads";
 
 FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, noSymmetryReductionOptionName, false, "Do not exploit symmetric structure of model.")
@@ -106,6 +112,65 @@ FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
                              .setDefaultValueString("proceeding")
                              .build())
             .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false,
+                                       "Sets the number of threads that expand states concurrently during state space generation (without approximation).")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                             .setDefaultValueUnsignedInteger(1)
+                             .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                             .build())
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("batch", "The number of states that are expanded concurrently.")
+                             .setDefaultValueUnsignedInteger(256)
+                             .makeOptional()
+                             .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                             .build())
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, modularisationThreadsOptionName, false,
+                                                   "Sets the number of threads that analyse independent dynamic modules concurrently (with modularisation).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, simulationOptionName, false, "Estimate the time-bounded unreliability by Monte Carlo simulation.")
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("traces", "The maximal number of traces to generate.")
+                             .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                             .build())
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("seed", "The seed of the random number generation.")
+                             .setDefaultValueUnsignedInteger(1)
+                             .makeOptional()
+                             .build())
+            .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, simulationPrecisionOptionName, false,
+                                       "Stop the simulation as soon as the confidence interval is narrow enough.")
+            .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("halfwidth", "The half-width of the confidence interval to achieve.")
+                             .addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleGreaterValidator(0.0))
+                             .build())
+            .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("confidence", "The confidence level.")
+                             .setDefaultValueDouble(0.95)
+                             .makeOptional()
+                             .addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                             .build())
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationThreadsOptionName, false, "Sets the number of threads that generate traces.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, smtThreadsOptionName, false,
+                                                   "Sets the number of SMT solver instances that check queries concurrently when computing failure bounds.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 bool FaultTreeSettings::useSymmetryReduction() const {
@@ -201,6 +266,50 @@ std::string FaultTreeSettings::getMttfAlgorithm() const {
     return this->getOption(mttfAlgorithmName).getArgumentByName("algorithm").getValueAsString();
 }
 
+uint64_t FaultTreeSettings::getExplorationThreads() const {
+    return this->getOption(explorationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t FaultTreeSettings::getExplorationBatchSize() const {
+    return this->getOption(explorationThreadsOptionName).getArgumentByName("batch").getValueAsUnsignedInteger();
+}
+
+uint64_t FaultTreeSettings::getModularisationThreads() const {
+    return this->getOption(modularisationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool FaultTreeSettings::isSimulationSet() const {
+    return this->getOption(simulationOptionName).getHasOptionBeenSet();
+}
+
+uint64_t FaultTreeSettings::getSimulationTraces() const {
+    return this->getOption(simulationOptionName).getArgumentByName("traces").getValueAsUnsignedInteger();
+}
+
+uint64_t FaultTreeSettings::getSimulationSeed() const {
+    return this->getOption(simulationOptionName).getArgumentByName("seed").getValueAsUnsignedInteger();
+}
+
+bool FaultTreeSettings::isSimulationPrecisionSet() const {
+    return this->getOption(simulationPrecisionOptionName).getHasOptionBeenSet();
+}
+
+double FaultTreeSettings::getSimulationHalfWidth() const {
+    return this->getOption(simulationPrecisionOptionName).getArgumentByName("halfwidth").getValueAsDouble();
+}
+
+double FaultTreeSettings::getSimulationConfidence() const {
+    return this->getOption(simulationPrecisionOptionName).getArgumentByName("confidence").getValueAsDouble();
+}
+
+uint64_t FaultTreeSettings::getSimulationThreads() const {
+    return this->getOption(simulationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t FaultTreeSettings::getSmtThreads() const {
+    return this->getOption(smtThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 void FaultTreeSettings::finalize() {}
 
 bool FaultTreeSettings::check() const {
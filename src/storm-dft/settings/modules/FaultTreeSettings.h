@@ -167,6 +167,83 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
      */
     std::string getMttfAlgorithm() const;
 
+    /*!
+     * Retrieves the number of threads that expand states concurrently during state space generation.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getExplorationThreads() const;
+
+    /*!
+     * Retrieves the number of states that are expanded concurrently during state space generation.
+     *
+     * @return The batch size.
+     */
+    uint64_t getExplorationBatchSize() const;
+
+    /*!
+     * Retrieves the number of threads that analyse independent dynamic modules concurrently.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getModularisationThreads() const;
+
+    /*!
+     * Retrieves whether the unreliability should be estimated by Monte Carlo simulation.
+     *
+     * @return True iff the option was set.
+     */
+    bool isSimulationSet() const;
+
+    /*!
+     * Retrieves the maximal number of traces to generate in the simulation.
+     *
+     * @return The number of traces.
+     */
+    uint64_t getSimulationTraces() const;
+
+    /*!
+     * Retrieves the seed of the simulation.
+     *
+     * @return The seed.
+     */
+    uint64_t getSimulationSeed() const;
+
+    /*!
+     * Retrieves whether the simulation should stop once the confidence interval is narrow enough.
+     *
+     * @return True iff the option was set.
+     */
+    bool isSimulationPrecisionSet() const;
+
+    /*!
+     * Retrieves the half-width of the confidence interval after which the simulation stops.
+     *
+     * @return The half-width.
+     */
+    double getSimulationHalfWidth() const;
+
+    /*!
+     * Retrieves the confidence level of the confidence interval of the simulation.
+     *
+     * @return The confidence level.
+     */
+    double getSimulationConfidence() const;
+
+    /*!
+     * Retrieves the number of threads that generate traces in the simulation.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getSimulationThreads() const;
+
+    /*!
+     * Retrieves the number of SMT solver instances that check queries concurrently when computing failure bounds.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getSmtThreads() const;
+
     bool check() const override;
 
     void finalize() override;
@@ -196,6 +273,12 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
     static const std::string mttfPrecisionName;
     static const std::string mttfStepsizeName;
     static const std::string mttfAlgorithmName;
+    static const std::string explorationThreadsOptionName;
+    static const std::string modularisationThreadsOptionName;
+    static const std::string simulationOptionName;
+    static const std::string simulationPrecisionOptionName;
+    static const std::string simulationThreadsOptionName;
+    static const std::string smtThreadsOptionName;
 };
 
 }  // namespace modules
@@ -0,0 +1,103 @@
+#include "DFTUnreliabilitySimulator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <boost/math/distributions/normal.hpp>
+#include <boost/random/seed_seq.hpp>
+
+#include "storm-dft/simulator/DFTTraceSimulator.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm::dft {
+namespace simulator {
+
+double SimulationStatistics::getProbability() const {
+    uint64_t validTraces = numberOfTraces - numberOfInvalidTraces;
+    return validTraces == 0 ? 0 : static_cast<double>(numberOfSuccessfulTraces) / validTraces;
+}
+
+template<typename ValueType>
+DFTUnreliabilitySimulator<ValueType>::DFTUnreliabilitySimulator(storm::dft::storage::DFT<ValueType> const& dft,
+                                                                storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo, uint64_t seed,
+                                                                uint64_t numberOfThreads, uint64_t tracesPerBatch)
+    : dft(dft),
+      stateGenerationInfo(stateGenerationInfo),
+      seed(seed),
+      numberOfThreads(std::max<uint64_t>(1, numberOfThreads)),
+      tracesPerBatch(std::max<uint64_t>(1, tracesPerBatch)) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+SimulationStatistics DFTUnreliabilitySimulator<ValueType>::simulate(double timebound, uint64_t maxNumberOfTraces, double targetHalfWidth,
+                                                                    double confidenceLevel) const {
+    STORM_LOG_THROW(confidenceLevel > 0 && confidenceLevel < 1, storm::exceptions::InvalidArgumentException,
+                    "Confidence level " << confidenceLevel << " is not in (0,1).");
+    double const z = boost::math::quantile(boost::math::normal_distribution<double>(), 1 - (1 - confidenceLevel) / 2);
+
+    // Each thread keeps its own simulator whose random number generator is reseeded for every batch
+    std::vector<boost::mt19937> generators(numberOfThreads);
+    std::vector<std::unique_ptr<DFTTraceSimulator<ValueType>>> simulators;
+    for (auto& generator : generators) {
+        simulators.push_back(std::make_unique<DFTTraceSimulator<ValueType>>(dft, stateGenerationInfo, generator));
+    }
+
+    SimulationStatistics statistics;
+    uint64_t nextBatch = 0;
+    while (statistics.numberOfTraces < maxNumberOfTraces) {
+        uint64_t const remainingTraces = maxNumberOfTraces - statistics.numberOfTraces;
+        uint64_t const numberOfBatches = std::min(numberOfThreads, (remainingTraces + tracesPerBatch - 1) / tracesPerBatch);
+        std::vector<SimulationStatistics> batchStatistics(numberOfBatches);
+        auto simulateBatch = [&](uint64_t threadIndex, uint64_t batch) {
+            uint64_t const batchIndex = nextBatch + batch;
+            boost::random::seed_seq seedSequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32), static_cast<uint32_t>(batchIndex),
+                                                 static_cast<uint32_t>(batchIndex >> 32)};
+            generators[threadIndex].seed(seedSequence);
+            auto& current = batchStatistics[batch];
+            current.numberOfTraces = std::min(tracesPerBatch, remainingTraces - batch * tracesPerBatch);
+            for (uint64_t trace = 0; trace < current.numberOfTraces; ++trace) {
+                SimulationResult result = simulators[threadIndex]->simulateCompleteTrace(timebound);
+                if (result == SimulationResult::SUCCESSFUL) {
+                    ++current.numberOfSuccessfulTraces;
+                } else if (result == SimulationResult::INVALID) {
+                    ++current.numberOfInvalidTraces;
+                }
+            }
+        };
+        storm::utility::parallel::forEachBlock(numberOfThreads, static_cast<uint64_t>(0), numberOfBatches, 1,
+                                               [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+                                                   for (uint64_t batch = begin; batch < end; ++batch) {
+                                                       simulateBatch(threadIndex, batch);
+                                                   }
+                                               });
+        nextBatch += numberOfBatches;
+        for (auto const& current : batchStatistics) {
+            statistics.numberOfTraces += current.numberOfTraces;
+            statistics.numberOfSuccessfulTraces += current.numberOfSuccessfulTraces;
+            statistics.numberOfInvalidTraces += current.numberOfInvalidTraces;
+        }
+
+        // Agresti-Coull interval which is also meaningful if no or all traces were successful
+        uint64_t const validTraces = statistics.numberOfTraces - statistics.numberOfInvalidTraces;
+        double const adjustedTraces = validTraces + z * z;
+        double const adjustedProbability = (statistics.numberOfSuccessfulTraces + z * z / 2) / adjustedTraces;
+        statistics.confidenceHalfWidth = z * std::sqrt(adjustedProbability * (1 - adjustedProbability) / adjustedTraces);
+        STORM_LOG_DEBUG("Simulated " << statistics.numberOfTraces << " traces, estimate " << statistics.getProbability() << " +- "
+                                     << statistics.confidenceHalfWidth);
+        if (targetHalfWidth > 0 && statistics.confidenceHalfWidth <= targetHalfWidth) {
+            break;
+        }
+    }
+    return statistics;
+}
+
+template class DFTUnreliabilitySimulator<double>;
+template class DFTUnreliabilitySimulator<storm::RationalFunction>;
+
+}  // namespace simulator
+}  // namespace storm::dft
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm-dft/storage/DFT.h"
+#include "storm-dft/storage/DFTStateGenerationInfo.h"
+
+namespace storm::dft {
+namespace simulator {
+
+/*!
+ * Statistics of the traces generated by a Monte Carlo simulation.
+ */
+struct SimulationStatistics {
+    // Number of generated traces.
+    uint64_t numberOfTraces = 0;
+    // Number of traces in which the system failed within the time bound.
+    uint64_t numberOfSuccessfulTraces = 0;
+    // Number of traces which reached an invalid state. They are discarded.
+    uint64_t numberOfInvalidTraces = 0;
+    // Half-width of the confidence interval around the estimated probability.
+    double confidenceHalfWidth = 1;
+
+    /*!
+     * Get the estimated probability of a system failure within the time bound.
+     *
+     * @return Fraction of successful traces among all valid traces.
+     */
+    double getProbability() const;
+};
+
+/*!
+ * Monte Carlo simulation for estimating the unreliability of a DFT.
+ * Traces are generated in batches which are distributed over several threads.
+ * Each batch uses its own random number generator whose seed is derived from the global seed and the index of the batch.
+ * The estimate is therefore independent of the order in which the batches are processed.
+ * After each round of batches, the simulation stops if the confidence interval is narrow enough.
+ */
+template<typename ValueType>
+class DFTUnreliabilitySimulator {
+   public:
+    /*!
+     * Constructor.
+     *
+     * @param dft DFT.
+     * @param stateGenerationInfo Info for state generation.
+     * @param seed Seed from which the random number generators of all batches are derived.
+     * @param numberOfThreads Number of threads generating traces.
+     * @param tracesPerBatch Number of traces generated by one batch.
+     */
+    DFTUnreliabilitySimulator(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo,
+                              uint64_t seed, uint64_t numberOfThreads = 1, uint64_t tracesPerBatch = 1000);
+
+    /*!
+     * Estimate the probability that the top-level event fails within the given time bound.
+     *
+     * @param timebound Time bound.
+     * @param maxNumberOfTraces Maximal number of traces to generate.
+     * @param targetHalfWidth If positive, the simulation stops as soon as the half-width of the confidence interval is at most this value.
+     * @param confidenceLevel Confidence level of the confidence interval.
+     * @return Statistics of the simulation.
+     */
+    SimulationStatistics simulate(double timebound, uint64_t maxNumberOfTraces, double targetHalfWidth = 0, double confidenceLevel = 0.95) const;
+
+   private:
+    // The DFT used for the generation of next states.
+    storm::dft::storage::DFT<ValueType> const& dft;
+
+    // General information for the state generation.
+    storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo;
+
+    uint64_t seed;
+    uint64_t numberOfThreads;
+    uint64_t tracesPerBatch;
+};
+
+}  // namespace simulator
+}  // namespace storm::dft
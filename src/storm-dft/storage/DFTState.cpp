@@ -1,4 +1,8 @@
 #include "DFTState.h"
+
+#include <algorithm>
+#include <functional>
+
 #include "storm-dft/storage/DFT.h"
 #include "storm-dft/storage/elements/DFTElements.h"
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -552,12 +556,30 @@ bool DFTState<ValueType>::claimNew(size_t spareId, size_t currentlyUses,
 template<typename ValueType>
 bool DFTState<ValueType>::orderBySymmetry() {
     bool changed = false;
+    std::vector<uint64_t> blocks;
     for (size_t pos = 0; pos < mStateGenerationInfo.getSymmetrySize(); ++pos) {
         // Check each symmetry
         size_t length = mStateGenerationInfo.getSymmetryLength(pos);
-        std::vector<size_t> symmetryIndices = mStateGenerationInfo.getSymmetryIndices(pos);
+        std::vector<size_t> const& symmetryIndices = mStateGenerationInfo.getSymmetryIndices(pos);
+        if (length < 64) {
+            // Sort symmetry group in decreasing order by reading each block as a number
+            blocks.clear();
+            for (size_t index : symmetryIndices) {
+                STORM_LOG_ASSERT(index + length <= mStatus.size(),
+                                 "Symmetry index " << index << " + length " << length << " is larger than status vector " << mStatus.size());
+                blocks.push_back(mStatus.getAsInt(index, length));
+            }
+            if (!std::is_sorted(blocks.begin(), blocks.end(), std::greater<uint64_t>())) {
+                std::sort(blocks.begin(), blocks.end(), std::greater<uint64_t>());
+                for (size_t i = 0; i < symmetryIndices.size(); ++i) {
+                    mStatus.setFromInt(symmetryIndices[i], length, blocks[i]);
+                }
+                changed = true;
+            }
+            continue;
+        }
+
         // Sort symmetry group in decreasing order by bubble sort
-        // TODO use better algorithm?
         size_t tmp;
         size_t n = symmetryIndices.size();
         do {
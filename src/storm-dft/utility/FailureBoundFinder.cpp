@@ -1,14 +1,52 @@
 #include "FailureBoundFinder.h"
 
+#include "storm/utility/parallel.h"
+
 namespace storm::dft {
 namespace utility {
 
-uint64_t FailureBoundFinder::correctLowerBound(std::shared_ptr<storm::dft::modelchecker::DFTASFChecker> smtchecker, uint64_t bound, uint_fast64_t timeout) {
+FailureBoundFinder::SmtCheckers FailureBoundFinder::createCheckers(storm::dft::storage::DFT<double> const &dft, uint64_t numberOfCheckers) {
+    // Every checker has its own encoding and solver instance such that queries can be checked concurrently
+    SmtCheckers smtcheckers(std::max<uint64_t>(1, numberOfCheckers));
+    storm::utility::parallel::forEachChunk(smtcheckers.size(), static_cast<uint64_t>(0), static_cast<uint64_t>(smtcheckers.size()),
+                                           [&dft, &smtcheckers](uint64_t, uint64_t begin, uint64_t end) {
+                                               for (uint64_t i = begin; i < end; ++i) {
+                                                   smtcheckers[i] = std::make_shared<storm::dft::modelchecker::DFTASFChecker>(dft);
+                                                   smtcheckers[i]->toSolver();
+                                               }
+                                           });
+    return smtcheckers;
+}
+
+std::pair<uint64_t, storm::solver::SmtSolver::CheckResult> FailureBoundFinder::checkUntilNotUnsat(
+    SmtCheckers const &smtcheckers, uint64_t numberOfQueries, uint_fast64_t timeout,
+    std::function<storm::solver::SmtSolver::CheckResult(storm::dft::modelchecker::DFTASFChecker &, uint64_t)> const &query) {
+    std::vector<storm::solver::SmtSolver::CheckResult> results(smtcheckers.size());
+    for (uint64_t batchBegin = 0; batchBegin < numberOfQueries; batchBegin += smtcheckers.size()) {
+        uint64_t const batchSize = std::min<uint64_t>(smtcheckers.size(), numberOfQueries - batchBegin);
+        storm::utility::parallel::forEachChunk(batchSize, static_cast<uint64_t>(0), batchSize, [&](uint64_t, uint64_t begin, uint64_t end) {
+            for (uint64_t i = begin; i < end; ++i) {
+                smtcheckers[i]->setSolverTimeout(timeout * 1000);
+                results[i] = query(*smtcheckers[i], batchBegin + i);
+                smtcheckers[i]->unsetSolverTimeout();
+            }
+        });
+        // Results of queries after the first one that is not "Unsat" are discarded, so the outcome does not depend on the number of checkers
+        for (uint64_t i = 0; i < batchSize; ++i) {
+            if (results[i] != storm::solver::SmtSolver::CheckResult::Unsat) {
+                return {batchBegin + i, results[i]};
+            }
+        }
+    }
+    return {numberOfQueries, storm::solver::SmtSolver::CheckResult::Unsat};
+}
+
+uint64_t FailureBoundFinder::correctLowerBound(SmtCheckers const &smtcheckers, uint64_t bound, uint_fast64_t timeout) {
     STORM_LOG_DEBUG("Lower bound correction - try to correct bound " << std::to_string(bound));
     uint64_t boundCandidate = bound;
     uint64_t nrDepEvents = 0;
     uint64_t nrNonMarkovian = 0;
-    auto dft = smtchecker->getDFT();
+    auto const &dft = smtcheckers.front()->getDFT();
 
     // Count dependent events
     for (size_t i = 0; i < dft.nrElements(); ++i) {
@@ -22,22 +60,27 @@ uint64_t FailureBoundFinder::correctLowerBound(std::shared_ptr<storm::dft::model
     }
 
     // Only need to check as long as bound candidate + nr of non-Markovians to check is smaller than number of dependent events
-    while (nrNonMarkovian <= nrDepEvents && boundCandidate >= 0) {
+    while (nrNonMarkovian <= nrDepEvents) {
+        // The uniqueness transformation for constantly failed BEs guarantees that a DFT never fails
+        // in step 0 without intermediate non-Markovians, thus forcibly set nrNonMarkovian
         if (nrNonMarkovian == 0 and boundCandidate == 0) {
             nrNonMarkovian = 1;
         }
-        STORM_LOG_TRACE("Lower bound correction - check possible bound " << std::to_string(boundCandidate) << " with " << std::to_string(nrNonMarkovian)
-                                                                         << " non-Markovian states");
-        // The uniqueness transformation for constantly failed BEs guarantees that a DFT never fails
-        // in step 0 without intermediate non-Markovians, thus forcibly set nrNonMarkovian
-        smtchecker->setSolverTimeout(timeout * 1000);
-        storm::solver::SmtSolver::CheckResult tmp_res = smtchecker->checkFailsLeqWithEqNonMarkovianState(boundCandidate + nrNonMarkovian, nrNonMarkovian);
-        smtchecker->unsetSolverTimeout();
+        STORM_LOG_TRACE("Lower bound correction - check possible bound " << std::to_string(boundCandidate) << " with at least "
+                                                                         << std::to_string(nrNonMarkovian) << " non-Markovian states");
+        // If a query is UNSAT, the number of non-Markovian states is increased and the next query is checked
+        uint64_t const firstNrNonMarkovian = nrNonMarkovian;
+        uint64_t const numberOfQueries = std::max(nrDepEvents, firstNrNonMarkovian) - firstNrNonMarkovian + 1;
+        auto [queryIndex, tmp_res] = checkUntilNotUnsat(
+            smtcheckers, numberOfQueries, timeout, [boundCandidate, firstNrNonMarkovian](storm::dft::modelchecker::DFTASFChecker &checker, uint64_t index) {
+                return checker.checkFailsLeqWithEqNonMarkovianState(boundCandidate + firstNrNonMarkovian + index, firstNrNonMarkovian + index);
+            });
+        nrNonMarkovian = firstNrNonMarkovian + queryIndex;
         switch (tmp_res) {
             case storm::solver::SmtSolver::CheckResult::Sat:
                 /* If SAT, there is a sequence where only boundCandidate-many BEs fail directly and rest is nonMarkovian.
                  * Bound candidate is vaild, therefore check the next one */
-                STORM_LOG_TRACE("Lower bound correction - SAT");
+                STORM_LOG_TRACE("Lower bound correction - SAT with " << std::to_string(nrNonMarkovian) << " non-Markovian states");
                 // Prevent integer underflow
                 if (boundCandidate == 0) {
                     STORM_LOG_DEBUG("Lower bound correction - corrected bound to 0");
@@ -50,9 +93,8 @@ uint64_t FailureBoundFinder::correctLowerBound(std::shared_ptr<storm::dft::model
                 STORM_LOG_DEBUG("Lower bound correction - Solver returned 'Unknown', corrected to 1");
                 return 1;
             default:
-                // if query is UNSAT, increase number of non-Markovian states and try again
+                // All queries are UNSAT
                 STORM_LOG_TRACE("Lower bound correction - UNSAT");
-                ++nrNonMarkovian;
                 break;
         }
     }
@@ -61,49 +103,37 @@ uint64_t FailureBoundFinder::correctLowerBound(std::shared_ptr<storm::dft::model
     return boundCandidate + 1;
 }
 
-uint64_t FailureBoundFinder::correctUpperBound(std::shared_ptr<storm::dft::modelchecker::DFTASFChecker> smtchecker, uint64_t bound, uint_fast64_t timeout) {
+uint64_t FailureBoundFinder::correctUpperBound(SmtCheckers const &smtcheckers, uint64_t bound, uint_fast64_t timeout) {
     STORM_LOG_DEBUG("Upper bound correction - try to correct bound " << std::to_string(bound));
     uint64_t boundCandidate = bound;
-    uint64_t nrDepEvents = 0;
-    uint64_t nrNonMarkovian = 0;
-    uint64_t currentTimepoint = 0;
-    auto dft = smtchecker->getDFT();
-    // Count dependent events
-    for (size_t i = 0; i < dft.nrElements(); ++i) {
-        std::shared_ptr<storm::dft::storage::elements::DFTElement<double> const> element = dft.getElement(i);
-        if (element->isBasicElement()) {
-            auto be = std::static_pointer_cast<storm::dft::storage::elements::DFTBE<double> const>(element);
-            if (be->hasIngoingDependencies()) {
-                ++nrDepEvents;
-            }
+    while (true) {
+        // Check the splits of the sequence points from bound down to boundCandidate into BE failures and non-Markovian states
+        STORM_LOG_TRACE("Upper bound correction - check candidate " << std::to_string(boundCandidate));
+        auto [queryIndex, tmp_res] = checkUntilNotUnsat(smtcheckers, bound - boundCandidate + 1, timeout,
+                                                        [bound, boundCandidate](storm::dft::modelchecker::DFTASFChecker &checker, uint64_t index) {
+                                                            uint64_t const currentTimepoint = bound - index;
+                                                            return checker.checkFailsAtTimepointWithEqNonMarkovianState(currentTimepoint,
+                                                                                                                        currentTimepoint - boundCandidate);
+                                                        });
+        uint64_t const currentTimepoint = bound - queryIndex;
+        switch (tmp_res) {
+            case storm::solver::SmtSolver::CheckResult::Sat:
+                STORM_LOG_TRACE("Upper bound correction - SAT");
+                STORM_LOG_DEBUG("Upper bound correction - corrected to bound "
+                                << boundCandidate << " (TLE can fail at sequence point " << std::to_string(currentTimepoint) << " with "
+                                << std::to_string(currentTimepoint - boundCandidate) << " non-Markovian states)");
+                return boundCandidate;
+            case storm::solver::SmtSolver::CheckResult::Unknown:
+                // If any query returns unknown, we cannot be sure about the bound and fall back to the naive one
+                STORM_LOG_DEBUG("Upper bound correction - Solver returned 'Unknown', corrected to bound " << bound);
+                return bound;
+            default:
+                // All queries are UNSAT, so try the next candidate
+                STORM_LOG_TRACE("Upper bound correction - UNSAT");
+                break;
         }
-    }
-    while (boundCandidate >= 0) {
-        currentTimepoint = bound + 1;
-        while (currentTimepoint - boundCandidate > 0) {
-            --currentTimepoint;
-            nrNonMarkovian = currentTimepoint - boundCandidate;
-            STORM_LOG_TRACE("Upper bound correction - candidate " << std::to_string(boundCandidate) << " check split " << std::to_string(currentTimepoint)
-                                                                  << "|" << std::to_string(nrNonMarkovian));
-            smtchecker->setSolverTimeout(timeout * 1000);
-            storm::solver::SmtSolver::CheckResult tmp_res = smtchecker->checkFailsAtTimepointWithEqNonMarkovianState(currentTimepoint, nrNonMarkovian);
-            smtchecker->unsetSolverTimeout();
-            switch (tmp_res) {
-                case storm::solver::SmtSolver::CheckResult::Sat:
-                    STORM_LOG_TRACE("Upper bound correction - SAT");
-                    STORM_LOG_DEBUG("Upper bound correction - corrected to bound " << boundCandidate << " (TLE can fail at sequence point "
-                                                                                   << std::to_string(currentTimepoint) << " with "
-                                                                                   << std::to_string(nrNonMarkovian) << " non-Markovian states)");
-                    return boundCandidate;
-                case storm::solver::SmtSolver::CheckResult::Unknown:
-                    // If any query returns unknown, we cannot be sure about the bound and fall back to the naive one
-                    STORM_LOG_DEBUG("Upper bound correction - Solver returned 'Unknown', corrected to bound " << bound);
-                    return bound;
-                default:
-                    // if query is UNSAT, increase number of non-Markovian states and try again
-                    STORM_LOG_TRACE("Lower bound correction - UNSAT");
-                    break;
-            }
+        if (boundCandidate == 0) {
+            break;
         }
         --boundCandidate;
     }
@@ -113,85 +143,81 @@ uint64_t FailureBoundFinder::correctUpperBound(std::shared_ptr<storm::dft::model
     return boundCandidate;
 }
 
-uint64_t FailureBoundFinder::getLeastFailureBound(storm::dft::storage::DFT<double> const &dft, bool useSMT, uint_fast64_t timeout) {
+uint64_t FailureBoundFinder::getLeastFailureBound(storm::dft::storage::DFT<double> const &dft, bool useSMT, uint_fast64_t timeout, uint64_t numberOfThreads) {
     if (useSMT) {
         STORM_LOG_TRACE("Compute lower bound for number of BE failures necessary for the DFT to fail");
 
-        storm::dft::modelchecker::DFTASFChecker smtchecker(dft);
-        smtchecker.toSolver();
-
-        uint64_t bound = 0;
-        while (bound < dft.nrBasicElements() + 1) {
-            smtchecker.setSolverTimeout(timeout * 1000);
-            storm::solver::SmtSolver::CheckResult tmp_res = smtchecker.checkTleFailsWithLeq(bound);
-            smtchecker.unsetSolverTimeout();
-            switch (tmp_res) {
-                case storm::solver::SmtSolver::CheckResult::Sat:
-                    if (!dft.getDependencies().empty()) {
-                        return correctLowerBound(std::make_shared<storm::dft::modelchecker::DFTASFChecker>(smtchecker), bound, timeout);
-                    } else {
-                        return bound;
-                    }
-                case storm::solver::SmtSolver::CheckResult::Unknown:
-                    STORM_LOG_DEBUG("Lower bound: Solver returned 'Unknown'");
+        SmtCheckers smtcheckers = createCheckers(dft, numberOfThreads);
+
+        // The bound is the least number of BE failures for which the query is not UNSAT
+        auto [bound, tmp_res] =
+            checkUntilNotUnsat(smtcheckers, dft.nrBasicElements() + 1, timeout,
+                               [](storm::dft::modelchecker::DFTASFChecker &checker, uint64_t index) { return checker.checkTleFailsWithLeq(index); });
+        switch (tmp_res) {
+            case storm::solver::SmtSolver::CheckResult::Sat:
+                if (!dft.getDependencies().empty()) {
+                    return correctLowerBound(smtcheckers, bound, timeout);
+                } else {
                     return bound;
-                default:
-                    ++bound;
-                    break;
-            }
+                }
+            case storm::solver::SmtSolver::CheckResult::Unknown:
+                STORM_LOG_DEBUG("Lower bound: Solver returned 'Unknown'");
+                return bound;
+            default:
+                return bound;
         }
-
-        return bound;
     } else {
         // naive bound
         return 1;
     }
 }
 
-uint64_t FailureBoundFinder::getLeastFailureBound(storm::dft::storage::DFT<RationalFunction> const &dft, bool useSMT, uint_fast64_t timeout) {
+uint64_t FailureBoundFinder::getLeastFailureBound(storm::dft::storage::DFT<RationalFunction> const &dft, bool useSMT, uint_fast64_t timeout,
+                                                  uint64_t numberOfThreads) {
     if (useSMT) {
         STORM_LOG_WARN("SMT encoding does not support rational functions");
     }
     return 1;
 }
 
-uint64_t FailureBoundFinder::getAlwaysFailedBound(storm::dft::storage::DFT<double> const &dft, bool useSMT, uint_fast64_t timeout) {
+uint64_t FailureBoundFinder::getAlwaysFailedBound(storm::dft::storage::DFT<double> const &dft, bool useSMT, uint_fast64_t timeout, uint64_t numberOfThreads) {
     STORM_LOG_TRACE("Compute bound for number of BE failures such that the DFT always fails");
     if (useSMT) {
-        storm::dft::modelchecker::DFTASFChecker smtchecker(dft);
-        smtchecker.toSolver();
+        SmtCheckers smtcheckers = createCheckers(dft, numberOfThreads);
 
-        if (smtchecker.checkTleNeverFailed() == storm::solver::SmtSolver::CheckResult::Sat) {
+        if (smtcheckers.front()->checkTleNeverFailed() == storm::solver::SmtSolver::CheckResult::Sat) {
             return dft.nrBasicElements() + 1;
         }
-        uint64_t bound = dft.nrBasicElements();
-        while (bound >= 0) {
-            smtchecker.setSolverTimeout(timeout * 1000);
-            storm::solver::SmtSolver::CheckResult tmp_res = smtchecker.checkTleFailsWithEq(bound);
-            smtchecker.unsetSolverTimeout();
-            switch (tmp_res) {
-                case storm::solver::SmtSolver::CheckResult::Sat:
-                    if (!dft.getDependencies().empty()) {
-                        return correctUpperBound(std::make_shared<storm::dft::modelchecker::DFTASFChecker>(smtchecker), bound, timeout);
-                    } else {
-                        return bound;
-                    }
-                case storm::solver::SmtSolver::CheckResult::Unknown:
-                    STORM_LOG_DEBUG("Upper bound: Solver returned 'Unknown'");
+        // The bound is the largest number of BE failures for which the query is not UNSAT
+        auto [queryIndex, tmp_res] = checkUntilNotUnsat(smtcheckers, dft.nrBasicElements() + 1, timeout,
+                                                        [&dft](storm::dft::modelchecker::DFTASFChecker &checker, uint64_t index) {
+                                                            return checker.checkTleFailsWithEq(dft.nrBasicElements() - index);
+                                                        });
+        if (queryIndex > dft.nrBasicElements()) {
+            return 0;
+        }
+        uint64_t bound = dft.nrBasicElements() - queryIndex;
+        switch (tmp_res) {
+            case storm::solver::SmtSolver::CheckResult::Sat:
+                if (!dft.getDependencies().empty()) {
+                    return correctUpperBound(smtcheckers, bound, timeout);
+                } else {
                     return bound;
-                default:
-                    --bound;
-                    break;
-            }
+                }
+            case storm::solver::SmtSolver::CheckResult::Unknown:
+                STORM_LOG_DEBUG("Upper bound: Solver returned 'Unknown'");
+                return bound;
+            default:
+                return bound;
         }
-        return bound;
     } else {
         // naive bound
         return dft.nrBasicElements() + 1;
     }
 }
 
-uint64_t FailureBoundFinder::getAlwaysFailedBound(storm::dft::storage::DFT<RationalFunction> const &dft, bool useSMT, uint_fast64_t timeout) {
+uint64_t FailureBoundFinder::getAlwaysFailedBound(storm::dft::storage::DFT<RationalFunction> const &dft, bool useSMT, uint_fast64_t timeout,
+                                                  uint64_t numberOfThreads) {
     if (useSMT) {
         STORM_LOG_WARN("SMT encoding does not support rational functions");
     }
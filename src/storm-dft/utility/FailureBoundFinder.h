@@ -1,5 +1,10 @@
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include "storm-dft/modelchecker/DFTASFChecker.h"
 #include "storm-dft/storage/DFT.h"
 
@@ -14,11 +19,14 @@ class FailureBoundFinder {
      * @param dft the DFT to check
      * @param useSMT if set, an SMT solver is used to improve the bounds
      * @param timeout timeout for each query in seconds, defaults to 10 seconds
+     * @param numberOfThreads number of SMT solver instances that check queries for different bounds concurrently
      * @return the minimal number
      */
-    static uint64_t getLeastFailureBound(storm::dft::storage::DFT<double> const &dft, bool useSMT = false, uint_fast64_t timeout = 10);
+    static uint64_t getLeastFailureBound(storm::dft::storage::DFT<double> const &dft, bool useSMT = false, uint_fast64_t timeout = 10,
+                                         uint64_t numberOfThreads = 1);
 
-    static uint64_t getLeastFailureBound(storm::dft::storage::DFT<storm::RationalFunction> const &dft, bool useSMT = false, uint_fast64_t timeout = 10);
+    static uint64_t getLeastFailureBound(storm::dft::storage::DFT<storm::RationalFunction> const &dft, bool useSMT = false, uint_fast64_t timeout = 10,
+                                         uint64_t numberOfThreads = 1);
 
     /**
      * Get the number of BE failures for which the TLE always fails (upper bound for number of failures to check).
@@ -26,35 +34,63 @@ class FailureBoundFinder {
      * @param dft the DFT to check
      * @param useSMT if set, an SMT solver is used to improve the bounds
      * @param timeout timeout for each query in seconds, defaults to 10 seconds
+     * @param numberOfThreads number of SMT solver instances that check queries for different bounds concurrently
      * @return the number
      */
-    static uint64_t getAlwaysFailedBound(storm::dft::storage::DFT<double> const &dft, bool useSMT = false, uint_fast64_t timeout = 10);
+    static uint64_t getAlwaysFailedBound(storm::dft::storage::DFT<double> const &dft, bool useSMT = false, uint_fast64_t timeout = 10,
+                                         uint64_t numberOfThreads = 1);
 
-    static uint64_t getAlwaysFailedBound(storm::dft::storage::DFT<storm::RationalFunction> const &dft, bool useSMT = false, uint_fast64_t timeout = 10);
+    static uint64_t getAlwaysFailedBound(storm::dft::storage::DFT<storm::RationalFunction> const &dft, bool useSMT = false, uint_fast64_t timeout = 10,
+                                         uint64_t numberOfThreads = 1);
 
    private:
+    typedef std::vector<std::shared_ptr<storm::dft::modelchecker::DFTASFChecker>> SmtCheckers;
+
+    /**
+     * Helper function that creates the given number of SMT checkers for the DFT, each with its own solver instance.
+     *
+     * @param dft the DFT to check
+     * @param numberOfCheckers the number of checkers to create
+     * @return the checkers, which are prepared for SMT checking
+     */
+    static SmtCheckers createCheckers(storm::dft::storage::DFT<double> const &dft, uint64_t numberOfCheckers);
+
+    /**
+     * Helper function that checks the given sequence of queries until the first query that is not "Unsat".
+     * Consecutive queries are checked speculatively and concurrently, one per SMT checker.
+     *
+     * @param smtcheckers the SMT checkers to use
+     * @param numberOfQueries the number of queries
+     * @param timeout timeout for each query in seconds
+     * @param query function that performs the query with the given index on the given checker
+     * @return the index of the first query that is not "Unsat" together with its result, or the number of queries and "Unsat" if all queries are "Unsat"
+     */
+    static std::pair<uint64_t, storm::solver::SmtSolver::CheckResult> checkUntilNotUnsat(
+        SmtCheckers const &smtcheckers, uint64_t numberOfQueries, uint_fast64_t timeout,
+        std::function<storm::solver::SmtSolver::CheckResult(storm::dft::modelchecker::DFTASFChecker &, uint64_t)> const &query);
+
     /**
      * Helper function for correction of least failure bound when dependencies are present.
      * The main idea is to check if a later point of failure for the TLE than the pre-computed bound exists, but
      * up until that point the number of non-Markovian states visited is so large, that less than the pre-computed bound BEs fail by themselves.
      * The corrected bound is then (newTLEFailureTimepoint)-(nrNonMarkovianStatesVisited). This term is minimized.
      *
-     * @param smtchecker the SMT checker to use
+     * @param smtcheckers the SMT checkers to use
      * @param bound known lower bound to be corrected
      * @param timeout timeout timeout for each query in seconds
      * @return the corrected bound
      */
-    static uint64_t correctLowerBound(std::shared_ptr<storm::dft::modelchecker::DFTASFChecker> smtchecker, uint64_t bound, uint_fast64_t timeout);
+    static uint64_t correctLowerBound(SmtCheckers const &smtcheckers, uint64_t bound, uint_fast64_t timeout);
 
     /**
      * Helper function for correction of bound for number of BEs such that the DFT always fails when dependencies are present
      *
-     * @param smtchecker the SMT checker to use
+     * @param smtcheckers the SMT checkers to use
      * @param bound known bound to be corrected
      * @param timeout timeout timeout for each query in seconds
      * @return the corrected bound
      */
-    static uint64_t correctUpperBound(std::shared_ptr<storm::dft::modelchecker::DFTASFChecker> smtchecker, uint64_t bound, uint_fast64_t timeout);
+    static uint64_t correctUpperBound(SmtCheckers const &smtcheckers, uint64_t bound, uint_fast64_t timeout);
 };
 
 }  // namespace utility
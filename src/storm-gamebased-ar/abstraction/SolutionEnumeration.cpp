@@ -0,0 +1,123 @@
+#include "storm-gamebased-ar/abstraction/SolutionEnumeration.h"
+
+#include "storm-gamebased-ar/abstraction/AbstractionInformation.h"
+
+#include "storm/solver/SmtSolver.h"
+#include "storm/storage/dd/DdManager.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm::gbar {
+namespace abstraction {
+
+template<storm::dd::DdType DdType>
+SolutionEnumeration<DdType>::SolutionEnumeration(VariablesAndPredicates const& sourceVariablesAndPredicates,
+                                                 std::vector<VariablesAndPredicates> const& destinationVariablesAndPredicates)
+    : sourceVariablesAndPredicates(sourceVariablesAndPredicates), destinationVariablesAndPredicates(destinationVariablesAndPredicates) {
+    for (auto const& element : sourceVariablesAndPredicates) {
+        decisionVariables.push_back(element.first);
+    }
+    for (auto const& variablesAndPredicates : destinationVariablesAndPredicates) {
+        for (auto const& element : variablesAndPredicates) {
+            decisionVariables.push_back(element.first);
+        }
+    }
+}
+
+template<storm::dd::DdType DdType>
+uint64_t SolutionEnumeration<DdType>::enumerate(storm::solver::SmtSolver& solver) {
+    solutions.clear();
+    solver.allSat(decisionVariables, [this](storm::solver::SmtSolver::ModelReference const& model) {
+        solutions.emplace_back();
+        solutions.back().reserve(decisionVariables.size());
+        for (auto const& variable : decisionVariables) {
+            solutions.back().push_back(model.getBooleanValue(variable));
+        }
+        return true;
+    });
+    return solutions.size();
+}
+
+template<storm::dd::DdType DdType>
+std::pair<std::vector<uint64_t>, std::vector<std::vector<uint64_t>>> SolutionEnumeration<DdType>::getPredicates() const {
+    std::pair<std::vector<uint64_t>, std::vector<std::vector<uint64_t>>> result;
+    for (auto const& element : sourceVariablesAndPredicates) {
+        result.first.push_back(element.second);
+    }
+    for (auto const& variablesAndPredicates : destinationVariablesAndPredicates) {
+        result.second.emplace_back();
+        for (auto const& element : variablesAndPredicates) {
+            result.second.back().push_back(element.second);
+        }
+    }
+    return result;
+}
+
+template<storm::dd::DdType DdType>
+storm::dd::Bdd<DdType> SolutionEnumeration<DdType>::getSourceStates(AbstractionInformation<DdType> const& abstractionInformation) const {
+    storm::dd::Bdd<DdType> result = abstractionInformation.getDdManager().getBddZero();
+    for (auto const& solution : solutions) {
+        result |= getSourceStateBdd(abstractionInformation, solution);
+    }
+    return result;
+}
+
+template<storm::dd::DdType DdType>
+std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> SolutionEnumeration<DdType>::getSourceToDistributionsMap(
+    AbstractionInformation<DdType> const& abstractionInformation) const {
+    std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> result;
+    for (auto const& solution : solutions) {
+        result[getSourceStateBdd(abstractionInformation, solution)].push_back(getDistributionBdd(abstractionInformation, solution));
+    }
+    return result;
+}
+
+template<storm::dd::DdType DdType>
+storm::dd::Bdd<DdType> SolutionEnumeration<DdType>::getSourceStateBdd(AbstractionInformation<DdType> const& abstractionInformation,
+                                                                      std::vector<bool> const& solution) const {
+    storm::dd::Bdd<DdType> result = abstractionInformation.getDdManager().getBddOne();
+    for (uint64_t index = sourceVariablesAndPredicates.size(); index > 0; --index) {
+        if (solution[index - 1]) {
+            result &= abstractionInformation.encodePredicateAsSource(sourceVariablesAndPredicates[index - 1].second);
+        } else {
+            result &= !abstractionInformation.encodePredicateAsSource(sourceVariablesAndPredicates[index - 1].second);
+        }
+    }
+
+    STORM_LOG_ASSERT(!result.isZero(), "Source must not be empty.");
+    return result;
+}
+
+template<storm::dd::DdType DdType>
+storm::dd::Bdd<DdType> SolutionEnumeration<DdType>::getDistributionBdd(AbstractionInformation<DdType> const& abstractionInformation,
+                                                                       std::vector<bool> const& solution) const {
+    storm::dd::Bdd<DdType> result = abstractionInformation.getDdManager().getBddZero();
+
+    uint64_t offset = sourceVariablesAndPredicates.size();
+    for (uint_fast64_t updateIndex = 0; updateIndex < destinationVariablesAndPredicates.size(); ++updateIndex) {
+        storm::dd::Bdd<DdType> updateBdd = abstractionInformation.getDdManager().getBddOne();
+
+        // Translate block variables for this update into a successor block.
+        auto const& variablesAndPredicates = destinationVariablesAndPredicates[updateIndex];
+        for (uint64_t index = variablesAndPredicates.size(); index > 0; --index) {
+            if (solution[offset + index - 1]) {
+                updateBdd &= abstractionInformation.encodePredicateAsSuccessor(variablesAndPredicates[index - 1].second);
+            } else {
+                updateBdd &= !abstractionInformation.encodePredicateAsSuccessor(variablesAndPredicates[index - 1].second);
+            }
+        }
+        offset += variablesAndPredicates.size();
+
+        updateBdd &= abstractionInformation.encodeAux(updateIndex, 0, abstractionInformation.getAuxVariableCount());
+        result |= updateBdd;
+    }
+
+    STORM_LOG_ASSERT(!result.isZero(), "Distribution must not be empty.");
+    return result;
+}
+
+template class SolutionEnumeration<storm::dd::DdType::CUDD>;
+template class SolutionEnumeration<storm::dd::DdType::Sylvan>;
+
+}  // namespace abstraction
+}  // namespace storm::gbar
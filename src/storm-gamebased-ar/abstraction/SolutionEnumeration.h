@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace solver {
+class SmtSolver;
+}
+}  // namespace storm
+
+namespace storm::gbar {
+namespace abstraction {
+
+template<storm::dd::DdType DdType>
+class AbstractionInformation;
+
+/*!
+ * The solutions of the decision variables of (a block of the decomposition of) a command or edge. The solutions are enumerated with the (local) SMT solver
+ * of the command or edge and only translated to BDDs afterwards. As the enumeration neither manipulates DDs nor the expression manager, enumerations of
+ * different commands or edges can be performed concurrently.
+ */
+template<storm::dd::DdType DdType>
+class SolutionEnumeration {
+   public:
+    typedef std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> VariablesAndPredicates;
+
+    SolutionEnumeration() = default;
+
+    /*!
+     * Creates an enumeration over the given decision variables.
+     *
+     * @param sourceVariablesAndPredicates The decision variables (and their predicates) that encode the source states.
+     * @param destinationVariablesAndPredicates For each update (destination), the decision variables (and their predicates) that encode its successors.
+     */
+    SolutionEnumeration(VariablesAndPredicates const& sourceVariablesAndPredicates,
+                        std::vector<VariablesAndPredicates> const& destinationVariablesAndPredicates);
+
+    /*!
+     * Enumerates and stores all solutions of the given solver over the decision variables.
+     *
+     * @return The number of solutions.
+     */
+    uint64_t enumerate(storm::solver::SmtSolver& solver);
+
+    /*!
+     * Retrieves the indices of the source predicates and, for each update, the indices of the successor predicates.
+     */
+    std::pair<std::vector<uint64_t>, std::vector<std::vector<uint64_t>>> getPredicates() const;
+
+    /*!
+     * Translates the enumerated solutions to a BDD representing the source states of all solutions.
+     */
+    storm::dd::Bdd<DdType> getSourceStates(AbstractionInformation<DdType> const& abstractionInformation) const;
+
+    /*!
+     * Translates the enumerated solutions to a mapping from source states to the distributions over successor states.
+     */
+    std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> getSourceToDistributionsMap(
+        AbstractionInformation<DdType> const& abstractionInformation) const;
+
+   private:
+    storm::dd::Bdd<DdType> getSourceStateBdd(AbstractionInformation<DdType> const& abstractionInformation, std::vector<bool> const& solution) const;
+
+    storm::dd::Bdd<DdType> getDistributionBdd(AbstractionInformation<DdType> const& abstractionInformation, std::vector<bool> const& solution) const;
+
+    // The decision variables (and their predicates) that encode the source states and the successors of each update, respectively.
+    VariablesAndPredicates sourceVariablesAndPredicates;
+    std::vector<VariablesAndPredicates> destinationVariablesAndPredicates;
+
+    // All decision variables, i.e. the source variables followed by the successor variables of each update.
+    std::vector<storm::expressions::Variable> decisionVariables;
+
+    // The values of the decision variables (in the order above) of each solution.
+    std::vector<std::vector<bool>> solutions;
+};
+
+}  // namespace abstraction
+}  // namespace storm::gbar
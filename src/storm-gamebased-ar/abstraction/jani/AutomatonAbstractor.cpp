@@ -16,6 +16,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm::gbar {
 namespace abstraction {
@@ -27,7 +28,8 @@ template<storm::dd::DdType DdType, typename ValueType>
 AutomatonAbstractor<DdType, ValueType>::AutomatonAbstractor(storm::jani::Automaton const& automaton, AbstractionInformation<DdType>& abstractionInformation,
                                                             std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory,
                                                             bool useDecomposition, bool addPredicatesForValidBlocks, bool debug)
-    : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), edges(), automaton(automaton) {
+    : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), edges(), automaton(automaton),
+      numberOfThreads(storm::settings::getModule<AbstractionSettings>().getNumberOfThreads()) {
     // For each concrete command, we create an abstract counterpart.
     uint64_t edgeId = 0;
     for (auto const& edge : automaton.getEdges()) {
@@ -71,11 +73,29 @@ std::set<storm::expressions::Variable> const& AutomatonAbstractor<DdType, ValueT
 
 template<storm::dd::DdType DdType, typename ValueType>
 GameBddResult<DdType> AutomatonAbstractor<DdType, ValueType>::abstract() {
-    // First, we retrieve the abstractions of all commands.
+    // First, we retrieve the abstractions of all edges. The enumerations of the solutions only use the SMT solvers of the edges and are thus
+    // performed concurrently, whereas the remaining steps manipulate DDs (or the expression manager) and are performed sequentially.
+    auto forEachEdgeConcurrently = [this](auto const& function) {
+        storm::utility::parallel::forEachBlock(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(edges.size()), 1,
+                                               [&](uint64_t, uint64_t begin, uint64_t end) {
+                                                   for (uint64_t index = begin; index < end; ++index) {
+                                                       function(edges[index]);
+                                                   }
+                                               });
+    };
+
     std::vector<GameBddResult<DdType>> edgeDdsAndUsedOptionVariableCounts;
     uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
     for (auto& edge : edges) {
-        edgeDdsAndUsedOptionVariableCounts.push_back(edge.abstract());
+        edge.prepareAbstraction();
+    }
+    forEachEdgeConcurrently([](EdgeAbstractor<DdType, ValueType>& edge) { edge.enumerateGuard(); });
+    for (auto& edge : edges) {
+        edge.processGuard();
+    }
+    forEachEdgeConcurrently([](EdgeAbstractor<DdType, ValueType>& edge) { edge.enumerateTransitions(); });
+    for (auto& edge : edges) {
+        edgeDdsAndUsedOptionVariableCounts.push_back(edge.finishAbstraction());
         maximalNumberOfUsedOptionVariables = std::max(maximalNumberOfUsedOptionVariables, edgeDdsAndUsedOptionVariableCounts.back().numberOfPlayer2Variables);
     }
 
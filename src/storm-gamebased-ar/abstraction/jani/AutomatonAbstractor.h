@@ -150,6 +150,9 @@ class AutomatonAbstractor {
 
     // If the automaton has more than one location, we need variables to encode that.
     boost::optional<std::pair<storm::expressions::Variable, storm::expressions::Variable>> locationVariables;
+
+    // The number of threads that concurrently enumerate the abstractions.
+    uint64_t numberOfThreads;
 };
 }  // namespace jani
 }  // namespace abstraction
@@ -1,7 +1,5 @@
 #include "storm-gamebased-ar/abstraction/prism/CommandAbstractor.h"
 
-#include <chrono>
-
 #include <boost/iterator/transform_iterator.hpp>
 
 #include "storm-gamebased-ar/abstraction/AbstractionInformation.h"
@@ -33,6 +31,8 @@ CommandAbstractor<DdType, ValueType>::CommandAbstractor(storm::prism::Command co
       evaluator(abstractionInformation.getExpressionManager()),
       relevantPredicatesAndVariables(),
       cachedDd(abstractionInformation.getDdManager().getBddZero(), 0),
+      blockEnumerationGuard(abstractionInformation.getDdManager().getBddOne()),
+      blockEnumerationAuxVariableCount(abstractionInformation.getAuxVariableCount()),
       decisionVariables(),
       useDecomposition(useDecomposition),
       addPredicatesForValidBlocks(addPredicatesForValidBlocks),
@@ -110,18 +110,22 @@ std::set<storm::expressions::Variable> const& CommandAbstractor<DdType, ValueTyp
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
-void CommandAbstractor<DdType, ValueType>::recomputeCachedBdd() {
-    if (useDecomposition) {
-        recomputeCachedBddWithDecomposition();
-    } else {
-        recomputeCachedBddWithoutDecomposition();
+void CommandAbstractor<DdType, ValueType>::prepareAbstraction() {
+    guardEnumeration = boost::none;
+    transitionEnumerations.clear();
+    reusedTransitionEnumerations.clear();
+    if (!forceRecomputation) {
+        return;
+    }
+
+    if (!useDecomposition) {
+        STORM_LOG_TRACE("Recomputing BDD for command " << command.get());
+        transitionEnumerations.emplace_back(relevantPredicatesAndVariables.first, relevantPredicatesAndVariables.second);
+        reusedTransitionEnumerations.push_back(false);
+        return;
     }
-}
 
-template<storm::dd::DdType DdType, typename ValueType>
-void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
     STORM_LOG_TRACE("Recomputing BDD for command " << command.get() << " [with index " << command.get().getGlobalIndex() << "] using the decomposition.");
-    auto start = std::chrono::high_resolution_clock::now();
 
     // compute a decomposition of the command
     //  * start with all relevant blocks: blocks of assignment variables and variables in the rhs of assignments
@@ -265,55 +269,19 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
         }
     }
 
-    uint64_t numberOfSolutions = 0;
-    uint64_t numberOfTotalSolutions = 0;
-
-    // If we need to enumerate the guard, do it only once now.
+    // If we need to enumerate the guard, do it only once (before the blocks).
     if (enumerateAbstractGuard) {
         std::set<uint64_t> relatedGuardPredicates = localExpressionInformation.getRelatedExpressions(variablesContainedInGuard);
-        std::vector<storm::expressions::Variable> guardDecisionVariables;
         std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> guardVariablesAndPredicates;
         for (auto const& element : relevantPredicatesAndVariables.first) {
             if (relatedGuardPredicates.find(element.second) != relatedGuardPredicates.end()) {
-                guardDecisionVariables.push_back(element.first);
                 guardVariablesAndPredicates.push_back(element);
             }
         }
-        abstractGuard = this->getAbstractionInformation().getDdManager().getBddZero();
-        smtSolver->allSat(guardDecisionVariables,
-                          [this, &guardVariablesAndPredicates, &numberOfSolutions](storm::solver::SmtSolver::ModelReference const& model) {
-                              abstractGuard |= getSourceStateBdd(model, guardVariablesAndPredicates);
-                              ++numberOfSolutions;
-                              return true;
-                          });
-        STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for abstract guard.");
-
-        // Now that we have the abstract guard, we can add it as an assertion to the solver before enumerating
-        // the other solutions.
-
-        // Create a new backtracking point before adding the guard.
-        smtSolver->push();
-
-        // Create the guard constraint.
-        std::pair<std::vector<storm::expressions::Expression>, std::unordered_map<uint_fast64_t, storm::expressions::Variable>> result =
-            abstractGuard.toExpression(this->getAbstractionInformation().getExpressionManager());
-
-        // Then add it to the solver.
-        for (auto const& expression : result.first) {
-            smtSolver->add(expression);
-        }
-
-        // Finally associate the level variables with the predicates.
-        for (auto const& indexVariablePair : result.second) {
-            smtSolver->add(
-                storm::expressions::iff(indexVariablePair.second, this->getAbstractionInformation().getPredicateForDdVariableIndex(indexVariablePair.first)));
-        }
+        guardEnumeration = SolutionEnumeration<DdType>(guardVariablesAndPredicates, {});
     }
 
-    // Then enumerate the solutions for each of the blocks of the decomposition.
-    uint64_t usedNondeterminismVariables = 0;
-    uint64_t blockCounter = 0;
-    std::vector<storm::dd::Bdd<DdType>> blockBdds;
+    // Then prepare the enumeration of the solutions for each of the blocks of the decomposition.
     for (auto const& block : relevantBlockPartition) {
         std::set<uint64_t> relevantPredicates;
         for (auto const& innerBlock : block) {
@@ -326,11 +294,9 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
             continue;
         }
 
-        std::vector<storm::expressions::Variable> transitionDecisionVariables;
         std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> sourceVariablesAndPredicates;
         for (auto const& element : relevantPredicatesAndVariables.first) {
             if (relevantPredicates.find(element.second) != relevantPredicates.end()) {
-                transitionDecisionVariables.push_back(element.first);
                 sourceVariablesAndPredicates.push_back(element);
             }
         }
@@ -346,24 +312,127 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
                     for (auto const& element : relevantPredicatesAndVariables.second[updateIndex]) {
                         if (assignmentVariableBlock.find(element.second) != assignmentVariableBlock.end()) {
                             destinationVariablesAndPredicates.back().push_back(element);
-                            transitionDecisionVariables.push_back(element.first);
                         }
                     }
                 }
             }
         }
 
-        std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-        numberOfSolutions = 0;
-        smtSolver->allSat(transitionDecisionVariables, [&sourceToDistributionsMap, this, &numberOfSolutions, &sourceVariablesAndPredicates,
-                                                        &destinationVariablesAndPredicates](storm::solver::SmtSolver::ModelReference const& model) {
-            sourceToDistributionsMap[getSourceStateBdd(model, sourceVariablesAndPredicates)].push_back(
-                getDistributionBdd(model, destinationVariablesAndPredicates));
-            ++numberOfSolutions;
-            return true;
-        });
-        STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for block " << blockCounter << ".");
-        numberOfTotalSolutions += numberOfSolutions;
+        transitionEnumerations.emplace_back(sourceVariablesAndPredicates, destinationVariablesAndPredicates);
+        reusedTransitionEnumerations.push_back(false);
+    }
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+void CommandAbstractor<DdType, ValueType>::enumerateGuard() {
+    if (guardEnumeration) {
+        uint64_t numberOfSolutions = guardEnumeration->enumerate(*smtSolver);
+        STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for abstract guard.");
+    }
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+void CommandAbstractor<DdType, ValueType>::processGuard() {
+    if (!forceRecomputation || !useDecomposition) {
+        return;
+    }
+
+    if (guardEnumeration) {
+        abstractGuard = guardEnumeration->getSourceStates(this->getAbstractionInformation());
+
+        // Now that we have the abstract guard, we can add it as an assertion to the solver before enumerating
+        // the other solutions.
+
+        // Create a new backtracking point before adding the guard.
+        smtSolver->push();
+
+        // Create the guard constraint.
+        std::pair<std::vector<storm::expressions::Expression>, std::unordered_map<uint_fast64_t, storm::expressions::Variable>> result =
+            abstractGuard.toExpression(this->getAbstractionInformation().getExpressionManager());
+
+        // Then add it to the solver.
+        for (auto const& expression : result.first) {
+            smtSolver->add(expression);
+        }
+
+        // Finally associate the level variables with the predicates.
+        for (auto const& indexVariablePair : result.second) {
+            smtSolver->add(
+                storm::expressions::iff(indexVariablePair.second, this->getAbstractionInformation().getPredicateForDdVariableIndex(indexVariablePair.first)));
+        }
+    }
+
+    // The solutions of the blocks depend on the (abstract) guard that restricts the enumeration and on the encoding of the updates. If either of them
+    // changed, the cached solutions are invalid.
+    storm::dd::Bdd<DdType> enumerationGuard = guardEnumeration ? abstractGuard : this->getAbstractionInformation().getDdManager().getBddOne();
+    if (enumerationGuard != blockEnumerationGuard || this->getAbstractionInformation().getAuxVariableCount() != blockEnumerationAuxVariableCount) {
+        blockEnumerationCache.clear();
+        blockEnumerationGuard = enumerationGuard;
+        blockEnumerationAuxVariableCount = this->getAbstractionInformation().getAuxVariableCount();
+    }
+
+    // If the predicates of a block did not change since a previous refinement, neither did its solutions, so we can reuse them.
+    for (uint64_t blockIndex = 0; blockIndex < transitionEnumerations.size(); ++blockIndex) {
+        reusedTransitionEnumerations[blockIndex] =
+            blockEnumerationCache.find(transitionEnumerations[blockIndex].getPredicates()) != blockEnumerationCache.end();
+    }
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+void CommandAbstractor<DdType, ValueType>::enumerateTransitions() {
+    for (uint64_t blockIndex = 0; blockIndex < transitionEnumerations.size(); ++blockIndex) {
+        if (!reusedTransitionEnumerations[blockIndex]) {
+            uint64_t numberOfSolutions = transitionEnumerations[blockIndex].enumerate(*smtSolver);
+            STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for block " << blockIndex << ".");
+        }
+    }
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+GameBddResult<DdType> CommandAbstractor<DdType, ValueType>::finishAbstraction() {
+    if (forceRecomputation) {
+        if (useDecomposition) {
+            finishAbstractionWithDecomposition();
+        } else {
+            finishAbstractionWithoutDecomposition();
+        }
+        forceRecomputation = false;
+
+        // Release the memory of the enumerated solutions.
+        guardEnumeration = boost::none;
+        transitionEnumerations.clear();
+        reusedTransitionEnumerations.clear();
+    } else {
+        cachedDd.bdd &= computeMissingUpdateIdentities();
+    }
+
+    STORM_LOG_TRACE("Command produces " << cachedDd.bdd.getNonZeroCount() << " transitions.");
+
+    return cachedDd;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+void CommandAbstractor<DdType, ValueType>::finishAbstractionWithDecomposition() {
+    if (guardEnumeration) {
+        smtSolver->pop();
+    }
+
+    // Translate the solutions of each of the blocks of the decomposition.
+    uint64_t numberOfReusedBlocks = 0;
+    uint64_t usedNondeterminismVariables = 0;
+    std::vector<storm::dd::Bdd<DdType>> blockBdds;
+    for (uint64_t blockCounter = 0; blockCounter < transitionEnumerations.size(); ++blockCounter) {
+        auto predicates = transitionEnumerations[blockCounter].getPredicates();
+        auto enumerationIt = blockEnumerationCache.find(predicates);
+        if (reusedTransitionEnumerations[blockCounter]) {
+            STORM_LOG_ASSERT(enumerationIt != blockEnumerationCache.end(), "Expected cached solutions for block " << blockCounter << ".");
+            STORM_LOG_TRACE("Reusing the solutions for block " << blockCounter << ".");
+            ++numberOfReusedBlocks;
+        } else {
+            auto newSourceToDistributionsMap = transitionEnumerations[blockCounter].getSourceToDistributionsMap(this->getAbstractionInformation());
+            enumerationIt = blockEnumerationCache.emplace(std::move(predicates), std::move(newSourceToDistributionsMap)).first;
+        }
+        std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> const& sourceToDistributionsMap = enumerationIt->second;
 
         // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
         // need to encode the nondeterminism.
@@ -400,11 +469,6 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
         usedNondeterminismVariables += numberOfVariablesNeeded;
 
         blockBdds.push_back(resultBdd);
-        ++blockCounter;
-    }
-
-    if (enumerateAbstractGuard) {
-        smtSolver->pop();
     }
 
     // multiply the results
@@ -414,7 +478,7 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
     }
 
     // If we did not explicitly enumerate the guard, we can construct it from the result BDD.
-    if (!enumerateAbstractGuard) {
+    if (!guardEnumeration) {
         std::set<storm::expressions::Variable> allVariables(getAbstractionInformation().getSuccessorVariables());
         auto player2Variables = getAbstractionInformation().getPlayer2VariableSet(usedNondeterminismVariables);
         allVariables.insert(player2Variables.begin(), player2Variables.end());
@@ -441,27 +505,14 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
     // Cache the result.
     cachedDd = GameBddResult<DdType>(resultBdd, usedNondeterminismVariables);
 
-    auto end = std::chrono::high_resolution_clock::now();
-
-    STORM_LOG_TRACE("Enumerated " << numberOfTotalSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
-                                  << "ms.");
-    forceRecomputation = false;
+    STORM_LOG_TRACE("Translated the solutions of " << transitionEnumerations.size() << " block(s), reusing the solutions of " << numberOfReusedBlocks
+                                                   << " of them.");
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
-void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithoutDecomposition() {
-    STORM_LOG_TRACE("Recomputing BDD for command " << command.get());
-    auto start = std::chrono::high_resolution_clock::now();
-
-    // Create a mapping from source state DDs to their distributions.
-    std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-    uint64_t numberOfSolutions = 0;
-    smtSolver->allSat(decisionVariables, [&sourceToDistributionsMap, this, &numberOfSolutions](storm::solver::SmtSolver::ModelReference const& model) {
-        sourceToDistributionsMap[getSourceStateBdd(model, relevantPredicatesAndVariables.first)].push_back(
-            getDistributionBdd(model, relevantPredicatesAndVariables.second));
-        ++numberOfSolutions;
-        return true;
-    });
+void CommandAbstractor<DdType, ValueType>::finishAbstractionWithoutDecomposition() {
+    std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap =
+        transitionEnumerations.front().getSourceToDistributionsMap(this->getAbstractionInformation());
 
     // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
     // need to encode the nondeterminism.
@@ -505,11 +556,6 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithoutDecompositio
 
     // Cache the result.
     cachedDd = GameBddResult<DdType>(resultBdd, numberOfVariablesNeeded);
-    auto end = std::chrono::high_resolution_clock::now();
-
-    STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
-                                  << "ms.");
-    forceRecomputation = false;
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
@@ -622,53 +668,6 @@ void CommandAbstractor<DdType, ValueType>::addMissingPredicates(
     }
 }
 
-template<storm::dd::DdType DdType, typename ValueType>
-storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getSourceStateBdd(
-    storm::solver::SmtSolver::ModelReference const& model,
-    std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const {
-    storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddOne();
-    for (auto variableIndexPairIt = variablePredicates.rbegin(), variableIndexPairIte = variablePredicates.rend(); variableIndexPairIt != variableIndexPairIte;
-         ++variableIndexPairIt) {
-        auto const& variableIndexPair = *variableIndexPairIt;
-        if (model.getBooleanValue(variableIndexPair.first)) {
-            result &= this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
-        } else {
-            result &= !this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
-        }
-    }
-
-    STORM_LOG_ASSERT(!result.isZero(), "Source must not be empty.");
-    return result;
-}
-
-template<storm::dd::DdType DdType, typename ValueType>
-storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getDistributionBdd(
-    storm::solver::SmtSolver::ModelReference const& model,
-    std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const {
-    storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddZero();
-
-    for (uint_fast64_t updateIndex = 0; updateIndex < command.get().getNumberOfUpdates(); ++updateIndex) {
-        storm::dd::Bdd<DdType> updateBdd = this->getAbstractionInformation().getDdManager().getBddOne();
-
-        // Translate block variables for this update into a successor block.
-        for (auto variableIndexPairIt = variablePredicates[updateIndex].rbegin(), variableIndexPairIte = variablePredicates[updateIndex].rend();
-             variableIndexPairIt != variableIndexPairIte; ++variableIndexPairIt) {
-            auto const& variableIndexPair = *variableIndexPairIt;
-            if (model.getBooleanValue(variableIndexPair.first)) {
-                updateBdd &= this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
-            } else {
-                updateBdd &= !this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
-            }
-        }
-
-        updateBdd &= this->getAbstractionInformation().encodeAux(updateIndex, 0, this->getAbstractionInformation().getAuxVariableCount());
-        result |= updateBdd;
-    }
-
-    STORM_LOG_ASSERT(!result.isZero(), "Distribution must not be empty.");
-    return result;
-}
-
 template<storm::dd::DdType DdType, typename ValueType>
 storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::computeMissingUpdateIdentities() const {
     storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddZero();
@@ -698,15 +697,11 @@ storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::computeMissingUpdat
 
 template<storm::dd::DdType DdType, typename ValueType>
 GameBddResult<DdType> CommandAbstractor<DdType, ValueType>::abstract() {
-    if (forceRecomputation) {
-        this->recomputeCachedBdd();
-    } else {
-        cachedDd.bdd &= computeMissingUpdateIdentities();
-    }
-
-    STORM_LOG_TRACE("Command produces " << cachedDd.bdd.getNonZeroCount() << " transitions.");
-
-    return cachedDd;
+    prepareAbstraction();
+    enumerateGuard();
+    processGuard();
+    enumerateTransitions();
+    return finishAbstraction();
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
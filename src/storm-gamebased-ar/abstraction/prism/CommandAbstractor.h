@@ -3,10 +3,14 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include "storm-gamebased-ar/abstraction/GameBddResult.h"
 #include "storm-gamebased-ar/abstraction/LocalExpressionInformation.h"
+#include "storm-gamebased-ar/abstraction/SolutionEnumeration.h"
 #include "storm-gamebased-ar/abstraction/StateSetAbstractor.h"
 
 #include "storm/storage/expressions/ExpressionEvaluator.h"
@@ -98,6 +102,33 @@ class CommandAbstractor {
      */
     GameBddResult<DdType> abstract();
 
+    /*!
+     * The abstraction of the command can also be computed in the following steps (in this order), which is equivalent to calling abstract(). The
+     * enumeration steps only use the SMT solver of this command and may thus be performed concurrently for different commands, whereas all other steps
+     * manipulate DDs or the expression manager and must not be performed concurrently with any other step.
+     */
+    void prepareAbstraction();
+
+    /*!
+     * Enumerates the solutions for the abstract guard (if needed). See prepareAbstraction.
+     */
+    void enumerateGuard();
+
+    /*!
+     * Translates the solutions for the abstract guard and restricts the subsequent enumeration to it. See prepareAbstraction.
+     */
+    void processGuard();
+
+    /*!
+     * Enumerates the solutions for the transitions (of the blocks of the decomposition that were affected by a refinement). See prepareAbstraction.
+     */
+    void enumerateTransitions();
+
+    /*!
+     * Translates the enumerated solutions and returns the abstraction. See prepareAbstraction.
+     */
+    GameBddResult<DdType> finishAbstraction();
+
     /*!
      * Retrieves the transitions to bottom states of this command.
      *
@@ -158,37 +189,14 @@ class CommandAbstractor {
     void addMissingPredicates(std::pair<std::set<uint_fast64_t>, std::vector<std::set<uint_fast64_t>>> const& newRelevantPredicates);
 
     /*!
-     * Translates the given model to a source state DD.
-     *
-     * @param model The model to translate.
-     * @return The source state encoded as a DD.
-     */
-    storm::dd::Bdd<DdType> getSourceStateBdd(storm::solver::SmtSolver::ModelReference const& model,
-                                             std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const;
-
-    /*!
-     * Translates the given model to a distribution over successor states.
-     *
-     * @param model The model to translate.
-     * @return The source state encoded as a DD.
-     */
-    storm::dd::Bdd<DdType> getDistributionBdd(storm::solver::SmtSolver::ModelReference const& model,
-                                              std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const;
-
-    /*!
-     * Recomputes the cached BDD. This needs to be triggered if any relevant predicates change.
+     * Translates the enumerated solutions to the cached BDD without using the decomposition.
      */
-    void recomputeCachedBdd();
+    void finishAbstractionWithoutDecomposition();
 
     /*!
-     * Recomputes the cached BDD without using the decomposition.
+     * Translates the enumerated solutions to the cached BDD using the decomposition.
      */
-    void recomputeCachedBddWithoutDecomposition();
-
-    /*!
-     * Recomputes the cached BDD using th decomposition.
-     */
-    void recomputeCachedBddWithDecomposition();
+    void finishAbstractionWithDecomposition();
 
     /*!
      * Computes the missing state identities.
@@ -249,6 +257,22 @@ class CommandAbstractor {
     // predicates, this result may be reused.
     GameBddResult<DdType> cachedDd;
 
+    // The solutions enumerated for the blocks of the decomposition (as a mapping from source states to their distributions), keyed by the relevant
+    // source predicates and the relevant successor predicates of each update of the block. As new predicates do not restrict the values of the
+    // decision variables of other predicates, the solutions of blocks that are not affected by a refinement can be reused.
+    typedef std::pair<std::vector<uint64_t>, std::vector<std::vector<uint64_t>>> BlockEnumerationKey;
+    std::map<BlockEnumerationKey, std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>>> blockEnumerationCache;
+
+    // The guard constraint and the number of auxiliary variables with which the cached solutions of the blocks were enumerated.
+    storm::dd::Bdd<DdType> blockEnumerationGuard;
+    uint64_t blockEnumerationAuxVariableCount;
+
+    // The enumerations of the current abstraction (if it is recomputed), i.e. the enumeration for the abstract guard (if needed) and the enumeration of
+    // each block of the decomposition (or a single enumeration if no decomposition is used) together with flags whether their cached solutions are reused.
+    boost::optional<SolutionEnumeration<DdType>> guardEnumeration;
+    std::vector<SolutionEnumeration<DdType>> transitionEnumerations;
+    std::vector<bool> reusedTransitionEnumerations;
+
     // All relevant decision variables over which to perform AllSat.
     std::vector<storm::expressions::Variable> decisionVariables;
 
@@ -15,6 +15,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm::gbar {
 namespace abstraction {
@@ -26,7 +27,8 @@ template<storm::dd::DdType DdType, typename ValueType>
 ModuleAbstractor<DdType, ValueType>::ModuleAbstractor(storm::prism::Module const& module, AbstractionInformation<DdType>& abstractionInformation,
                                                       std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, bool useDecomposition,
                                                       bool addPredicatesForValidBlocks, bool debug)
-    : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), commands(), module(module) {
+    : smtSolverFactory(smtSolverFactory), abstractionInformation(abstractionInformation), commands(), module(module),
+      numberOfThreads(storm::settings::getModule<AbstractionSettings>().getNumberOfThreads()) {
     // For each concrete command, we create an abstract counterpart.
     for (auto const& command : module.getCommands()) {
         commands.emplace_back(command, abstractionInformation, smtSolverFactory, useDecomposition, addPredicatesForValidBlocks, debug);
@@ -64,11 +66,29 @@ std::set<storm::expressions::Variable> const& ModuleAbstractor<DdType, ValueType
 
 template<storm::dd::DdType DdType, typename ValueType>
 GameBddResult<DdType> ModuleAbstractor<DdType, ValueType>::abstract() {
-    // First, we retrieve the abstractions of all commands.
+    // First, we retrieve the abstractions of all commands. The enumerations of the solutions only use the SMT solvers of the commands and are thus
+    // performed concurrently, whereas the remaining steps manipulate DDs (or the expression manager) and are performed sequentially.
+    auto forEachCommandConcurrently = [this](auto const& function) {
+        storm::utility::parallel::forEachBlock(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(commands.size()), 1,
+                                               [&](uint64_t, uint64_t begin, uint64_t end) {
+                                                   for (uint64_t index = begin; index < end; ++index) {
+                                                       function(commands[index]);
+                                                   }
+                                               });
+    };
+
     std::vector<GameBddResult<DdType>> commandDdsAndUsedOptionVariableCounts;
     uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
     for (auto& command : commands) {
-        commandDdsAndUsedOptionVariableCounts.push_back(command.abstract());
+        command.prepareAbstraction();
+    }
+    forEachCommandConcurrently([](CommandAbstractor<DdType, ValueType>& command) { command.enumerateGuard(); });
+    for (auto& command : commands) {
+        command.processGuard();
+    }
+    forEachCommandConcurrently([](CommandAbstractor<DdType, ValueType>& command) { command.enumerateTransitions(); });
+    for (auto& command : commands) {
+        commandDdsAndUsedOptionVariableCounts.push_back(command.finishAbstraction());
         maximalNumberOfUsedOptionVariables =
             std::max(maximalNumberOfUsedOptionVariables, commandDdsAndUsedOptionVariableCounts.back().numberOfPlayer2Variables);
     }
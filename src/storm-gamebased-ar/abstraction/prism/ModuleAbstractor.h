@@ -138,6 +138,9 @@ class ModuleAbstractor {
 
     // The concrete module this abstract module refers to.
     std::reference_wrapper<storm::prism::Module const> module;
+
+    // The number of threads that concurrently enumerate the abstractions.
+    uint64_t numberOfThreads;
 };
 }  // namespace prism
 }  // namespace abstraction
@@ -70,11 +70,13 @@ void JaniGSPNBuilder::addEdges(storm::jani::Automaton& automaton, uint64_t locId
 
         // Compute enabled weight expression.
         storm::expressions::Expression totalWeight = expressionManager->rational(0.0);
+        uint64_t numberOfWeightedTransitions = 0;
         for (auto const& transId : partition.transitions) {
             auto const& trans = gspn.getImmediateTransitions()[transId];
             if (trans.noWeightAttached()) {
                 continue;
             }
+            ++numberOfWeightedTransitions;
             storm::expressions::Expression destguard = expressionManager->boolean(true);
             for (auto const& inPlaceEntry : trans.getInputPlaces()) {
                 destguard = destguard && (vars[inPlaceEntry.first]->getExpressionVariable() >= inPlaceEntry.second);
@@ -85,6 +87,10 @@ void JaniGSPNBuilder::addEdges(storm::jani::Automaton& automaton, uint64_t locId
             totalWeight = totalWeight + storm::expressions::ite(destguard, expressionManager->rational(trans.getWeight()), expressionManager->rational(0.0));
         }
         totalWeight = totalWeight.simplify();
+        if (numberOfWeightedTransitions == 0) {
+            // The edge could never be taken
+            continue;
+        }
 
         std::vector<storm::jani::OrderedAssignments> oas;
         std::vector<storm::expressions::Expression> probabilities;
@@ -122,8 +128,14 @@ void JaniGSPNBuilder::addEdges(storm::jani::Automaton& automaton, uint64_t locId
 
             oas.emplace_back(assignments);
             destinationLocations.emplace_back(locId);
-            probabilities.emplace_back(
-                storm::expressions::ite(destguard, (expressionManager->rational(trans.getWeight()) / totalWeight), expressionManager->rational(0.0)));
+            if (numberOfWeightedTransitions == 1) {
+                // The guard of the edge coincides with the guard of the only transition (e.g. transitions with zero weight get their own partition).
+                // This avoids evaluating the normalization in every explored marking.
+                probabilities.emplace_back(expressionManager->rational(1.0));
+            } else {
+                probabilities.emplace_back(
+                    storm::expressions::ite(destguard, (expressionManager->rational(trans.getWeight()) / totalWeight), expressionManager->rational(0.0)));
+            }
         }
 
         std::shared_ptr<storm::jani::TemplateEdge> templateEdge = std::make_shared<storm::jani::TemplateEdge>((priorityGuard && guard).simplify());
@@ -45,7 +45,7 @@ void analyzeMonotonicity(std::shared_ptr<storm::models::sparse::Model<ValueType>
     if (!monSettings.isMonSolutionSet()) {
         auto monotonicityHelper = storm::analysis::MonotonicityHelper<ValueType, double>(
             model, formulas, regions, monSettings.getNumberOfSamples(), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision(),
-            monSettings.isDotOutputSet());
+            monSettings.isDotOutputSet(), monSettings.getNumberOfThreads());
         if (monSettings.isExportMonotonicitySet()) {
             monotonicityHelper.checkMonotonicityInBuild(outfile, monSettings.isUsePLABoundsSet(), monSettings.getDotOutputFilename());
         } else {
@@ -378,7 +378,7 @@ void parameterSpacePartitioningWithSparseEngine(std::shared_ptr<storm::models::s
     storm::utility::Stopwatch watch(true);
     std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(
         model, storm::api::createTask<ValueType>((property.getRawFormula()), true), regions.front(), engine, refinementThreshold, optionalDepthLimit,
-        storm::modelchecker::RegionResultHypothesis::Unknown, false, monotonicitySettings, monThresh);
+        storm::modelchecker::RegionResultHypothesis::Unknown, false, monotonicitySettings, monThresh, partitionSettings.getRefinementThreads());
     watch.stop();
     printInitialStatesResult<ValueType>(result, &watch);
 
@@ -449,7 +449,8 @@ void processInputWithValueTypeAndDdlib(cli::SymbolicInput& input, storm::cli::Mo
     }
 
     // TODO move this.
-    storm::api::MonotonicitySetting monotonicitySettings(parSettings.isUseMonotonicitySet(), false, monSettings.isUsePLABoundsSet());
+    storm::api::MonotonicitySetting monotonicitySettings(parSettings.isUseMonotonicitySet(), false, monSettings.isUsePLABoundsSet(),
+                                                         monSettings.getNumberOfThreads());
     uint64_t monThresh = monSettings.getMonotonicityThreshold();
 
     auto mode = parSettings.getOperationMode();
@@ -11,6 +11,7 @@
 #include "storm/storage/expressions/RationalFunctionToExpression.h"
 #include "storm/storage/expressions/SimpleValuation.h"
 #include "storm/storage/expressions/VariableExpression.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/solver.h"
 
 namespace storm {
@@ -24,42 +25,66 @@ AssumptionChecker<ValueType, ConstantType>::AssumptionChecker(storage::SparseMat
 template<typename ValueType, typename ConstantType>
 void AssumptionChecker<ValueType, ConstantType>::initializeCheckingOnSamples(std::shared_ptr<logic::Formula const> formula,
                                                                              std::shared_ptr<models::sparse::Dtmc<ValueType>> model,
-                                                                             storage::ParameterRegion<ValueType> region, uint_fast64_t numberOfSamples) {
+                                                                             storage::ParameterRegion<ValueType> region, uint_fast64_t numberOfSamples,
+                                                                             uint64_t numberOfThreads) {
+    STORM_LOG_THROW(formula->isProbabilityOperatorFormula() && (formula->asProbabilityOperatorFormula().getSubformula().isUntilFormula() ||
+                                                                formula->asProbabilityOperatorFormula().getSubformula().isEventuallyFormula()),
+                    exceptions::NotSupportedException, "Expecting until or eventually formula");
     // Create sample points
     auto instantiator = utility::ModelInstantiator<models::sparse::Dtmc<ValueType>, models::sparse::Dtmc<ConstantType>>(*model);
-    auto matrix = model->getTransitionMatrix();
     std::set<VariableType> variables = models::sparse::getProbabilityParameters(*model);
+    Environment env;
 
-    for (uint_fast64_t i = 0; i < numberOfSamples; ++i) {
-        auto valuation = utility::parametric::Valuation<ValueType>();
-        for (auto var : variables) {
-            auto lb = region.getLowerBoundary(var.name());
-            auto ub = region.getUpperBoundary(var.name());
-            // Creates samples between lb and ub, that is: lb, lb + (ub-lb)/(#samples -1), lb + 2* (ub-lb)/(#samples -1), ..., ub
-            auto val = std::pair<VariableType, CoefficientType>(var, (lb + utility::convertNumber<CoefficientType>(i / (numberOfSamples - 1)) * (ub - lb)));
-            valuation.insert(val);
+    // The instantiator is not thread-safe, so we instantiate (at most) one model per thread and check these models concurrently.
+    numberOfThreads = std::max<uint64_t>(numberOfThreads, 1);
+    std::vector<models::sparse::Dtmc<ConstantType>> sampleModels;
+    for (uint_fast64_t batchBegin = 0; batchBegin < numberOfSamples; batchBegin += numberOfThreads) {
+        uint_fast64_t batchEnd = std::min<uint_fast64_t>(batchBegin + numberOfThreads, numberOfSamples);
+        sampleModels.clear();
+        for (uint_fast64_t i = batchBegin; i < batchEnd; ++i) {
+            auto valuation = utility::parametric::Valuation<ValueType>();
+            for (auto var : variables) {
+                auto lb = region.getLowerBoundary(var.name());
+                auto ub = region.getUpperBoundary(var.name());
+                // Creates samples between lb and ub, that is: lb, lb + (ub-lb)/(#samples -1), lb + 2* (ub-lb)/(#samples -1), ..., ub
+                auto val =
+                    std::pair<VariableType, CoefficientType>(var, (lb + utility::convertNumber<CoefficientType>(i / (numberOfSamples - 1)) * (ub - lb)));
+                valuation.insert(val);
+            }
+            sampleModels.push_back(instantiator.instantiate(valuation));
         }
-        models::sparse::Dtmc<ConstantType> sampleModel = instantiator.instantiate(valuation);
-        auto checker = modelchecker::SparseDtmcPrctlModelChecker<models::sparse::Dtmc<ConstantType>>(sampleModel);
-        std::unique_ptr<modelchecker::CheckResult> checkResult;
-        if (formula->isProbabilityOperatorFormula() && formula->asProbabilityOperatorFormula().getSubformula().isUntilFormula()) {
-            const modelchecker::CheckTask<logic::UntilFormula, ConstantType> checkTask =
-                modelchecker::CheckTask<logic::UntilFormula, ConstantType>((*formula).asProbabilityOperatorFormula().getSubformula().asUntilFormula());
-            checkResult = checker.computeUntilProbabilities(Environment(), checkTask);
-        } else if (formula->isProbabilityOperatorFormula() && formula->asProbabilityOperatorFormula().getSubformula().isEventuallyFormula()) {
-            const modelchecker::CheckTask<logic::EventuallyFormula, ConstantType> checkTask = modelchecker::CheckTask<logic::EventuallyFormula, ConstantType>(
-                (*formula).asProbabilityOperatorFormula().getSubformula().asEventuallyFormula());
-            checkResult = checker.computeReachabilityProbabilities(Environment(), checkTask);
-        } else {
-            STORM_LOG_THROW(false, exceptions::NotSupportedException, "Expecting until or eventually formula");
+
+        std::vector<std::vector<ConstantType>> batchSamples(sampleModels.size());
+        utility::parallel::forEachChunk(sampleModels.size(), static_cast<uint64_t>(0), static_cast<uint64_t>(sampleModels.size()),
+                                        [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                                            for (uint64_t index = chunkBegin; index < chunkEnd; ++index) {
+                                                batchSamples[index] = computeSampleValues(env, *formula, sampleModels[index]);
+                                            }
+                                        });
+        for (auto& values : batchSamples) {
+            samples.push_back(std::move(values));
         }
-        auto quantitativeResult = checkResult->asExplicitQuantitativeCheckResult<ConstantType>();
-        std::vector<ConstantType> values = quantitativeResult.getValueVector();
-        samples.push_back(values);
     }
     useSamples = true;
 }
 
+template<typename ValueType, typename ConstantType>
+std::vector<ConstantType> AssumptionChecker<ValueType, ConstantType>::computeSampleValues(Environment const& env, logic::Formula const& formula,
+                                                                                          models::sparse::Dtmc<ConstantType> const& sampleModel) {
+    auto checker = modelchecker::SparseDtmcPrctlModelChecker<models::sparse::Dtmc<ConstantType>>(sampleModel);
+    std::unique_ptr<modelchecker::CheckResult> checkResult;
+    if (formula.asProbabilityOperatorFormula().getSubformula().isUntilFormula()) {
+        const modelchecker::CheckTask<logic::UntilFormula, ConstantType> checkTask =
+            modelchecker::CheckTask<logic::UntilFormula, ConstantType>(formula.asProbabilityOperatorFormula().getSubformula().asUntilFormula());
+        checkResult = checker.computeUntilProbabilities(env, checkTask);
+    } else {
+        const modelchecker::CheckTask<logic::EventuallyFormula, ConstantType> checkTask =
+            modelchecker::CheckTask<logic::EventuallyFormula, ConstantType>(formula.asProbabilityOperatorFormula().getSubformula().asEventuallyFormula());
+        checkResult = checker.computeReachabilityProbabilities(env, checkTask);
+    }
+    return checkResult->asExplicitQuantitativeCheckResult<ConstantType>().getValueVector();
+}
+
 template<typename ValueType, typename ConstantType>
 void AssumptionChecker<ValueType, ConstantType>::setSampleValues(std::vector<std::vector<ConstantType>> samples) {
     this->samples = samples;
@@ -78,6 +103,48 @@ AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumption(
                                                                                 std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region,
                                                                                 std::vector<ConstantType> const minValues,
                                                                                 std::vector<ConstantType> const maxValues) const {
+    auto result = validateAssumptionWithoutSMTSolver(val1, val2, assumption, minValues, maxValues);
+    if (result) {
+        return result.value();
+    }
+    auto query = createSMTQuery(val1, val2, assumption, order, region, minValues, maxValues);
+    return query ? checkSMTQuery(query.value()) : AssumptionStatus::UNKNOWN;
+}
+
+template<typename ValueType, typename ConstantType>
+std::vector<AssumptionStatus> AssumptionChecker<ValueType, ConstantType>::validateAssumptions(
+    std::vector<std::shared_ptr<expressions::BinaryRelationExpression>> const& assumptions, std::shared_ptr<Order> order,
+    storage::ParameterRegion<ValueType> region, std::vector<ConstantType> const& minValues, std::vector<ConstantType> const& maxValues,
+    uint64_t numberOfThreads) const {
+    std::vector<AssumptionStatus> result(assumptions.size(), AssumptionStatus::UNKNOWN);
+    std::vector<SmtQuery> queries;
+    std::vector<uint64_t> queryIndices;
+    for (uint64_t index = 0; index < assumptions.size(); ++index) {
+        auto const& assumption = assumptions[index];
+        auto val1 = std::stoull(assumption->getFirstOperand()->asVariableExpression().getVariableName());
+        auto val2 = std::stoull(assumption->getSecondOperand()->asVariableExpression().getVariableName());
+        auto status = validateAssumptionWithoutSMTSolver(val1, val2, assumption, minValues, maxValues);
+        if (status) {
+            result[index] = status.value();
+        } else if (auto query = createSMTQuery(val1, val2, assumption, order, region, minValues, maxValues)) {
+            queries.push_back(std::move(query.value()));
+            queryIndices.push_back(index);
+        }
+    }
+
+    utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(queries.size()),
+                                    [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                                        for (uint64_t index = chunkBegin; index < chunkEnd; ++index) {
+                                            result[queryIndices[index]] = checkSMTQuery(queries[index]);
+                                        }
+                                    });
+    return result;
+}
+
+template<typename ValueType, typename ConstantType>
+std::optional<AssumptionStatus> AssumptionChecker<ValueType, ConstantType>::validateAssumptionWithoutSMTSolver(
+    uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<expressions::BinaryRelationExpression> assumption, std::vector<ConstantType> const& minValues,
+    std::vector<ConstantType> const& maxValues) const {
     // First check if based on sample points the assumption can be discharged
     assert(val1 == std::stoull(assumption->getFirstOperand()->asVariableExpression().getVariableName()));
     assert(val2 == std::stoull(assumption->getSecondOperand()->asVariableExpression().getVariableName()));
@@ -109,13 +176,10 @@ AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumption(
 
     if (result == AssumptionStatus::UNKNOWN) {
         // If result from sample checking was unknown, the assumption might hold
-        std::set<expressions::Variable> vars = std::set<expressions::Variable>({});
-        assumption->gatherVariables(vars);
-
         STORM_LOG_THROW(
             assumption->getRelationType() == expressions::RelationType::Greater || assumption->getRelationType() == expressions::RelationType::Equal,
             exceptions::NotSupportedException, "Only Greater Or Equal assumptions supported");
-        result = validateAssumptionSMTSolver(val1, val2, assumption, order, region, minValues, maxValues);
+        return std::nullopt;
     }
     return result;
 }
@@ -142,12 +206,10 @@ AssumptionStatus AssumptionChecker<ValueType, ConstantType>::checkOnSamples(std:
 }
 
 template<typename ValueType, typename ConstantType>
-AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumptionSMTSolver(
+std::optional<typename AssumptionChecker<ValueType, ConstantType>::SmtQuery> AssumptionChecker<ValueType, ConstantType>::createSMTQuery(
     uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<expressions::BinaryRelationExpression> assumption, std::shared_ptr<Order> order,
-    storage::ParameterRegion<ValueType> region, std::vector<ConstantType> const minValues, std::vector<ConstantType> const maxValues) const {
-    std::shared_ptr<utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<utility::solver::MathsatSmtSolverFactory>();
+    storage::ParameterRegion<ValueType> const& region, std::vector<ConstantType> const& minValues, std::vector<ConstantType> const& maxValues) const {
     std::shared_ptr<expressions::ExpressionManager> manager(new expressions::ExpressionManager());
-    AssumptionStatus result = AssumptionStatus::UNKNOWN;
     auto var1 = assumption->getFirstOperand()->asVariableExpression().getVariableName();
     auto var2 = assumption->getSecondOperand()->asVariableExpression().getVariableName();
     auto row1 = matrix.getRow(val1);
@@ -231,84 +293,89 @@ AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumptionS
         }
     }
 
-    if (orderKnown) {
-        solver::Z3SmtSolver s(*manager);
-        auto valueTypeToExpression = expressions::RationalFunctionToExpression<ValueType>(manager);
-        expressions::Expression expr1 = manager->rational(0);
-        for (auto itr1 = row1.begin(); itr1 != row1.end(); ++itr1) {
-            expr1 = expr1 + (valueTypeToExpression.toExpression(itr1->getValue()) * manager->getVariable("s" + std::to_string(itr1->getColumn())));
-        }
+    if (!orderKnown) {
+        return std::nullopt;
+    }
 
-        expressions::Expression expr2 = manager->rational(0);
-        for (auto itr2 = row2.begin(); itr2 != row2.end(); ++itr2) {
-            expr2 = expr2 + (valueTypeToExpression.toExpression(itr2->getValue()) * manager->getVariable("s" + std::to_string(itr2->getColumn())));
-        }
+    auto valueTypeToExpression = expressions::RationalFunctionToExpression<ValueType>(manager);
+    expressions::Expression expr1 = manager->rational(0);
+    for (auto itr1 = row1.begin(); itr1 != row1.end(); ++itr1) {
+        expr1 = expr1 + (valueTypeToExpression.toExpression(itr1->getValue()) * manager->getVariable("s" + std::to_string(itr1->getColumn())));
+    }
 
-        // Create expression for the assumption based on the relation to successors
-        // It is the negation of actual assumption
+    expressions::Expression expr2 = manager->rational(0);
+    for (auto itr2 = row2.begin(); itr2 != row2.end(); ++itr2) {
+        expr2 = expr2 + (valueTypeToExpression.toExpression(itr2->getValue()) * manager->getVariable("s" + std::to_string(itr2->getColumn())));
+    }
 
-        expressions::Expression exprToCheck;
-        if (assumption->getRelationType() == expressions::RelationType::Greater) {
-            exprToCheck = expr1 <= expr2;
-        } else {
-            assert(assumption->getRelationType() == expressions::RelationType::Equal);
-            exprToCheck = expr1 != expr2;
-        }
+    // Create expression for the assumption based on the relation to successors
+    // It is the negation of actual assumption
 
-        auto variables = manager->getVariables();
-        // Bounds for the state probabilities and parameters
-        expressions::Expression exprBounds = manager->boolean(true);
-        if (addVar1) {
-            exprBounds = exprBounds && (manager->getVariable("s" + var1) == expr1);
-        }
-        if (addVar2) {
-            exprBounds = exprBounds && (manager->getVariable("s" + var2) == expr2);
-        }
-        for (auto var : variables) {
-            if (find(stateVariables.begin(), stateVariables.end(), var) != stateVariables.end()) {
-                // the var is a state
-                if (minValues.size() > 0) {
-                    std::string test = var.getName();
-                    auto val = std::stoi(test.substr(1, test.size() - 1));
-                    exprBounds = exprBounds && manager->rational(minValues[val]) <= var && var <= manager->rational(maxValues[val]);
-                } else {
-                    exprBounds = exprBounds && manager->rational(0) <= var && var <= manager->rational(1);
-                }
-            } else if (find(topVariables.begin(), topVariables.end(), var) != topVariables.end()) {
-                // the var is =)
-                exprBounds = exprBounds && var == manager->rational(1);
-            } else if (find(bottomVariables.begin(), bottomVariables.end(), var) != bottomVariables.end()) {
-                // the var is =(
-                exprBounds = exprBounds && var == manager->rational(0);
+    expressions::Expression exprToCheck;
+    if (assumption->getRelationType() == expressions::RelationType::Greater) {
+        exprToCheck = expr1 <= expr2;
+    } else {
+        assert(assumption->getRelationType() == expressions::RelationType::Equal);
+        exprToCheck = expr1 != expr2;
+    }
+
+    auto variables = manager->getVariables();
+    // Bounds for the state probabilities and parameters
+    expressions::Expression exprBounds = manager->boolean(true);
+    if (addVar1) {
+        exprBounds = exprBounds && (manager->getVariable("s" + var1) == expr1);
+    }
+    if (addVar2) {
+        exprBounds = exprBounds && (manager->getVariable("s" + var2) == expr2);
+    }
+    for (auto var : variables) {
+        if (find(stateVariables.begin(), stateVariables.end(), var) != stateVariables.end()) {
+            // the var is a state
+            if (minValues.size() > 0) {
+                std::string test = var.getName();
+                auto val = std::stoi(test.substr(1, test.size() - 1));
+                exprBounds = exprBounds && manager->rational(minValues[val]) <= var && var <= manager->rational(maxValues[val]);
             } else {
-                // the var is a parameter
-                auto lb = utility::convertNumber<RationalNumber>(region.getLowerBoundary(var.getName()));
-                auto ub = utility::convertNumber<RationalNumber>(region.getUpperBoundary(var.getName()));
-                exprBounds = exprBounds && manager->rational(lb) < var && var < manager->rational(ub);
+                exprBounds = exprBounds && manager->rational(0) <= var && var <= manager->rational(1);
             }
+        } else if (find(topVariables.begin(), topVariables.end(), var) != topVariables.end()) {
+            // the var is =)
+            exprBounds = exprBounds && var == manager->rational(1);
+        } else if (find(bottomVariables.begin(), bottomVariables.end(), var) != bottomVariables.end()) {
+            // the var is =(
+            exprBounds = exprBounds && var == manager->rational(0);
+        } else {
+            // the var is a parameter
+            auto lb = utility::convertNumber<RationalNumber>(region.getLowerBoundary(var.getName()));
+            auto ub = utility::convertNumber<RationalNumber>(region.getUpperBoundary(var.getName()));
+            exprBounds = exprBounds && manager->rational(lb) < var && var < manager->rational(ub);
         }
+    }
 
-        s.add(exprOrderSucc);
-        s.add(exprBounds);
-        s.setTimeout(100);
-        // assert that sorting of successors in the order and the bounds on the expression are at least satisfiable
-        // when this is not the case, the order is invalid
-        // however, it could be that the sat solver didn't finish in time, in that case we just continue.
-        if (s.check() == solver::SmtSolver::CheckResult::Unsat) {
-            return AssumptionStatus::INVALID;
-        }
-        assert(s.check() != solver::SmtSolver::CheckResult::Unsat);
+    return SmtQuery{manager, exprOrderSucc && exprBounds, exprToCheck};
+}
 
-        s.add(exprToCheck);
-        auto smtRes = s.check();
-        if (smtRes == solver::SmtSolver::CheckResult::Unsat) {
-            // If there is no thing satisfying the negation we are safe.
-            result = AssumptionStatus::VALID;
-        } else if (smtRes == solver::SmtSolver::CheckResult::Sat) {
-            result = AssumptionStatus::INVALID;
-        }
+template<typename ValueType, typename ConstantType>
+AssumptionStatus AssumptionChecker<ValueType, ConstantType>::checkSMTQuery(SmtQuery const& query) {
+    solver::Z3SmtSolver s(*query.manager);
+    s.add(query.orderAndBounds);
+    s.setTimeout(100);
+    // assert that sorting of successors in the order and the bounds on the expression are at least satisfiable
+    // when this is not the case, the order is invalid
+    // however, it could be that the sat solver didn't finish in time, in that case we just continue.
+    if (s.check() == solver::SmtSolver::CheckResult::Unsat) {
+        return AssumptionStatus::INVALID;
     }
-    return result;
+
+    s.add(query.negatedAssumption);
+    auto smtRes = s.check();
+    if (smtRes == solver::SmtSolver::CheckResult::Unsat) {
+        // If there is no thing satisfying the negation we are safe.
+        return AssumptionStatus::VALID;
+    } else if (smtRes == solver::SmtSolver::CheckResult::Sat) {
+        return AssumptionStatus::INVALID;
+    }
+    return AssumptionStatus::UNKNOWN;
 }
 
 template<typename ValueType, typename ConstantType>
@@ -1,6 +1,9 @@
 #ifndef STORM_ASSUMPTIONCHECKER_H
 #define STORM_ASSUMPTIONCHECKER_H
 
+#include <memory>
+#include <optional>
+
 #include "Order.h"
 #include "storm-pars/storage/ParameterRegion.h"
 #include "storm/environment/Environment.h"
@@ -9,6 +12,7 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/expressions/BinaryRelationExpression.h"
+#include "storm/storage/expressions/Expression.h"
 
 namespace storm {
 namespace analysis {
@@ -51,9 +55,10 @@ class AssumptionChecker {
      * @param model The considered model.
      * @param region The region of the model's parameters.
      * @param numberOfSamples Number of sample points.
+     * @param numberOfThreads The number of threads that check the instantiated models concurrently. The models are instantiated sequentially.
      */
     void initializeCheckingOnSamples(std::shared_ptr<logic::Formula const> formula, std::shared_ptr<models::sparse::Dtmc<ValueType>> model,
-                                     storage::ParameterRegion<ValueType> region, uint_fast64_t numberOfSamples);
+                                     storage::ParameterRegion<ValueType> region, uint_fast64_t numberOfSamples, uint64_t numberOfThreads = 1);
 
     /*!
      * Sets the sample values to the given vector and useSamples to true.
@@ -76,16 +81,48 @@ class AssumptionChecker {
     AssumptionStatus validateAssumption(std::shared_ptr<expressions::BinaryRelationExpression> assumption, std::shared_ptr<Order> order,
                                         storage::ParameterRegion<ValueType> region) const;
 
+    /*!
+     * Tries to validate the given assumptions (whose operands are the variables of two states) for the same order.
+     * The SMT queries are created sequentially, as this might extend the order. Each query has its own expression manager and solver, so
+     * the queries are checked concurrently if more than one thread is given.
+     *
+     * @param numberOfThreads The number of threads that check the SMT queries.
+     * @return For every assumption (in the given order), AssumptionStatus::VALID, or AssumptionStatus::UNKNOWN, or AssumptionStatus::INVALID
+     */
+    std::vector<AssumptionStatus> validateAssumptions(std::vector<std::shared_ptr<expressions::BinaryRelationExpression>> const& assumptions,
+                                                      std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region,
+                                                      std::vector<ConstantType> const& minValues, std::vector<ConstantType> const& maxValues,
+                                                      uint64_t numberOfThreads = 1) const;
+
    private:
+    // The SMT query for an assumption, i.e., the order of the successors and the bounds together with the negation of the assumption.
+    struct SmtQuery {
+        std::shared_ptr<expressions::ExpressionManager> manager;
+        expressions::Expression orderAndBounds;
+        expressions::Expression negatedAssumption;
+    };
+
     bool useSamples;
 
     std::vector<std::vector<ConstantType>> samples;
 
     storage::SparseMatrix<ValueType> matrix;
 
-    AssumptionStatus validateAssumptionSMTSolver(uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<expressions::BinaryRelationExpression> assumption,
-                                                 std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region,
-                                                 std::vector<ConstantType> const minValues, std::vector<ConstantType> const maxValue) const;
+    // Returns the status of the assumption if it follows from the samples or the min and max values and none otherwise.
+    std::optional<AssumptionStatus> validateAssumptionWithoutSMTSolver(uint_fast64_t val1, uint_fast64_t val2,
+                                                                       std::shared_ptr<expressions::BinaryRelationExpression> assumption,
+                                                                       std::vector<ConstantType> const& minValues,
+                                                                       std::vector<ConstantType> const& maxValues) const;
+
+    // Returns none if the order of the successors is not known (even with the min and max values, which might extend the order).
+    std::optional<SmtQuery> createSMTQuery(uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<expressions::BinaryRelationExpression> assumption,
+                                           std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> const& region,
+                                           std::vector<ConstantType> const& minValues, std::vector<ConstantType> const& maxValues) const;
+
+    static AssumptionStatus checkSMTQuery(SmtQuery const& query);
+
+    static std::vector<ConstantType> computeSampleValues(Environment const& env, logic::Formula const& formula,
+                                                         models::sparse::Dtmc<ConstantType> const& sampleModel);
 
     AssumptionStatus checkOnSamples(std::shared_ptr<expressions::BinaryRelationExpression> assumption) const;
 };
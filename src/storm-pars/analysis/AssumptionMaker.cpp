@@ -26,6 +26,24 @@ std::map<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatu
     std::map<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatus> result;
     STORM_LOG_INFO("Creating assumptions for " << val1 << " and " << val2);
     assert(order->compare(val1, val2) == Order::UNKNOWN);
+    if (numberOfThreads > 1) {
+        std::vector<AssumptionType> assumptions = {createAssumption(val1, val2, expressions::RelationType::Greater),
+                                                   createAssumption(val2, val1, expressions::RelationType::Greater),
+                                                   createAssumption(val1, val2, expressions::RelationType::Equal)};
+        auto validationResults = assumptionChecker.validateAssumptions(assumptions, order, region, minValues, maxValues, numberOfThreads);
+        for (uint_fast64_t i = 0; i < assumptions.size(); ++i) {
+            if (validationResults[i] == AssumptionStatus::VALID) {
+                result.clear();
+                result.insert({assumptions[i], AssumptionStatus::VALID});
+                STORM_LOG_INFO("Assumption " << *assumptions[i] << "is valid\n");
+                return result;
+            } else if (validationResults[i] != AssumptionStatus::INVALID) {
+                result.insert({assumptions[i], validationResults[i]});
+            }
+        }
+        STORM_LOG_INFO("None of the assumptions is valid, number of possible assumptions:  " << result.size() << '\n');
+        return result;
+    }
     auto assumption = createAndCheckAssumption(val1, val2, expressions::RelationType::Greater, order, region, minValues, maxValues);
     if (assumption.second != AssumptionStatus::INVALID) {
         result.insert(assumption);
@@ -71,7 +89,7 @@ template<typename ValueType, typename ConstantType>
 void AssumptionMaker<ValueType, ConstantType>::initializeCheckingOnSamples(std::shared_ptr<logic::Formula const> formula,
                                                                            std::shared_ptr<models::sparse::Dtmc<ValueType>> model,
                                                                            storage::ParameterRegion<ValueType> region, uint_fast64_t numberOfSamples) {
-    assumptionChecker.initializeCheckingOnSamples(formula, model, region, numberOfSamples);
+    assumptionChecker.initializeCheckingOnSamples(formula, model, region, numberOfSamples, numberOfThreads);
 }
 
 template<typename ValueType, typename ConstantType>
@@ -80,15 +98,26 @@ void AssumptionMaker<ValueType, ConstantType>::setSampleValues(std::vector<std::
 }
 
 template<typename ValueType, typename ConstantType>
-std::pair<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatus> AssumptionMaker<ValueType, ConstantType>::createAndCheckAssumption(
-    uint_fast64_t val1, uint_fast64_t val2, expressions::RelationType relationType, std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region,
-    std::vector<ConstantType> const minValues, std::vector<ConstantType> const maxValues) const {
+void AssumptionMaker<ValueType, ConstantType>::setNumberOfThreads(uint64_t numberOfThreads) {
+    this->numberOfThreads = std::max<uint64_t>(numberOfThreads, 1);
+}
+
+template<typename ValueType, typename ConstantType>
+typename AssumptionMaker<ValueType, ConstantType>::AssumptionType AssumptionMaker<ValueType, ConstantType>::createAssumption(
+    uint_fast64_t val1, uint_fast64_t val2, expressions::RelationType relationType) const {
     assert(val1 != val2);
     expressions::Variable var1 = expressionManager->getVariable(std::to_string(val1));
     expressions::Variable var2 = expressionManager->getVariable(std::to_string(val2));
-    auto assumption = std::make_shared<expressions::BinaryRelationExpression>(
+    return std::make_shared<expressions::BinaryRelationExpression>(
         expressions::BinaryRelationExpression(*expressionManager, expressionManager->getBooleanType(), var1.getExpression().getBaseExpressionPointer(),
                                               var2.getExpression().getBaseExpressionPointer(), relationType));
+}
+
+template<typename ValueType, typename ConstantType>
+std::pair<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatus> AssumptionMaker<ValueType, ConstantType>::createAndCheckAssumption(
+    uint_fast64_t val1, uint_fast64_t val2, expressions::RelationType relationType, std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region,
+    std::vector<ConstantType> const minValues, std::vector<ConstantType> const maxValues) const {
+    auto assumption = createAssumption(val1, val2, relationType);
     AssumptionStatus validationResult = assumptionChecker.validateAssumption(val1, val2, assumption, order, region, minValues, maxValues);
     return std::pair<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatus>(assumption, validationResult);
 }
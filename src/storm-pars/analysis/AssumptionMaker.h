@@ -58,7 +58,17 @@ class AssumptionMaker {
      */
     void setSampleValues(std::vector<std::vector<ConstantType>> const& samples);
 
+    /*!
+     * Sets the number of threads that check the assumptions (and the samples) concurrently. With more than one thread, all three assumptions are
+     * checked, even if one of them turns out to be valid.
+     *
+     * @param numberOfThreads The number of threads, default 1.
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
    private:
+    AssumptionType createAssumption(uint_fast64_t val1, uint_fast64_t val2, expressions::RelationType relationType) const;
+
     std::pair<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatus> createAndCheckAssumption(
         uint_fast64_t val1, uint_fast64_t val2, expressions::RelationType relationType, std::shared_ptr<Order> order,
         storage::ParameterRegion<ValueType> region, std::vector<ConstantType> const minValues, std::vector<ConstantType> const maxValue) const;
@@ -68,6 +78,8 @@ class AssumptionMaker {
     std::shared_ptr<expressions::ExpressionManager> expressionManager;
 
     uint_fast64_t numberOfStates;
+
+    uint64_t numberOfThreads = 1;
 };
 }  // namespace analysis
 }  // namespace storm
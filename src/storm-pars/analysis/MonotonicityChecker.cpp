@@ -1,5 +1,7 @@
 #include "MonotonicityChecker.h"
 
+#include <algorithm>
+
 #include "storm/solver/Z3SmtSolver.h"
 
 namespace storm {
@@ -165,16 +167,31 @@ std::pair<bool, bool> MonotonicityChecker<ValueType>::checkDerivative(ValueType
 template<typename ValueType>
 typename MonotonicityChecker<ValueType>::Monotonicity MonotonicityChecker<ValueType>::checkTransitionMonRes(
     ValueType function, typename MonotonicityChecker<ValueType>::VariableType param, typename MonotonicityChecker<ValueType>::Region region) {
+    auto& knownResults = transitionMonotonicity[function][param];
+    for (auto const& knownResult : knownResults) {
+        if (knownResult.first.isSubRegion(region)) {
+            return knownResult.second;
+        }
+    }
+
     std::pair<bool, bool> res = MonotonicityChecker<ValueType>::checkDerivative(getDerivative(function, param), region);
+    Monotonicity result;
     if (res.first && !res.second) {
-        return Monotonicity::Incr;
+        result = Monotonicity::Incr;
     } else if (!res.first && res.second) {
-        return Monotonicity::Decr;
+        result = Monotonicity::Decr;
     } else if (res.first && res.second) {
-        return Monotonicity::Constant;
+        result = Monotonicity::Constant;
     } else {
+        // The function might still be monotone on a subregion, so we do not store this result
         return Monotonicity::Not;
     }
+    // Results for subregions of the current region are no longer needed
+    knownResults.erase(std::remove_if(knownResults.begin(), knownResults.end(),
+                                      [&region](std::pair<Region, Monotonicity> const& knownResult) { return region.isSubRegion(knownResult.first); }),
+                       knownResults.end());
+    knownResults.emplace_back(std::move(region), result);
+    return result;
 }
 
 template<typename ValueType>
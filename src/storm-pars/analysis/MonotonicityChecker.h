@@ -63,6 +63,10 @@ class MonotonicityChecker {
     storage::SparseMatrix<ValueType> matrix;
 
     boost::container::flat_map<ValueType, boost::container::flat_map<VariableType, ValueType>> derivatives;
+
+    // For every transition function and parameter, the regions on which the function was found to be monotone (or constant) in the parameter. As this
+    // also holds on every subregion, the (expensive) derivative checks are not repeated for the subregions considered during region refinement.
+    boost::container::flat_map<ValueType, boost::container::flat_map<VariableType, std::vector<std::pair<Region, Monotonicity>>>> transitionMonotonicity;
 };
 }  // namespace analysis
 }  // namespace storm
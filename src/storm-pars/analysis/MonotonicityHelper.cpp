@@ -20,9 +20,10 @@ template<typename ValueType, typename ConstantType>
 MonotonicityHelper<ValueType, ConstantType>::MonotonicityHelper(std::shared_ptr<models::sparse::Model<ValueType>> model,
                                                                 std::vector<std::shared_ptr<logic::Formula const>> formulas,
                                                                 std::vector<storage::ParameterRegion<ValueType>> regions, uint_fast64_t numberOfSamples,
-                                                                double const& precision, bool dotOutput)
+                                                                double const& precision, bool dotOutput, uint64_t numberOfThreads)
     : assumptionMaker(model->getTransitionMatrix()) {
     assert(model != nullptr);
+    assumptionMaker.setNumberOfThreads(numberOfThreads);
 
     this->model = model;
     this->formulas = formulas;
@@ -62,6 +63,7 @@ MonotonicityHelper<ValueType, ConstantType>::MonotonicityHelper(std::shared_ptr<
     }
 
     this->extender = new analysis::OrderExtender<ValueType, ConstantType>(model, formulas[0]);
+    this->extender->setNumberOfThreads(numberOfThreads);
 
     for (uint_fast64_t i = 0; i < matrix.getRowCount(); ++i) {
         std::set<VariableType> occurringVariables;
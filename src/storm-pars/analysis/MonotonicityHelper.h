@@ -46,10 +46,11 @@ class MonotonicityHelper {
      *          if 0 then no check on samples is executed.
      * @param precision Precision on which the samples are compared
      * @param dotOutput Whether or not dot output should be generated for the ROs.
+     * @param numberOfThreads Number of threads that check the assumptions concurrently, default 1.
      */
     MonotonicityHelper(std::shared_ptr<models::sparse::Model<ValueType>> model, std::vector<std::shared_ptr<logic::Formula const>> formulas,
                        std::vector<storage::ParameterRegion<ValueType>> regions, uint_fast64_t numberOfSamples = 0, double const& precision = 0.000001,
-                       bool dotOutput = false);
+                       bool dotOutput = false, uint64_t numberOfThreads = 1);
 
     /*!
      * Checks if a derivative >=0 or/and <=0
@@ -839,6 +839,10 @@ bool OrderExtender<ValueType, ConstantType>::isHope(std::shared_ptr<Order> order
     return yesThereIsHope;
 }
 template<typename ValueType, typename ConstantType>
+void OrderExtender<ValueType, ConstantType>::setNumberOfThreads(uint64_t numberOfThreads) {
+    assumptionMaker->setNumberOfThreads(numberOfThreads);
+}
+template<typename ValueType, typename ConstantType>
 MonotonicityChecker<ValueType>& OrderExtender<ValueType, ConstantType>::getMonotoncityChecker() {
     return monotonicityChecker;
 }
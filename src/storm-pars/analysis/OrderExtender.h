@@ -83,6 +83,11 @@ class OrderExtender {
 
     bool isHope(std::shared_ptr<Order> order);
 
+    /*!
+     * Sets the number of threads that check the assumptions created while extending the order concurrently.
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
     MonotonicityChecker<ValueType>& getMonotoncityChecker();
     std::vector<std::set<VariableType>> const& getVariablesOccuringAtState();
 
@@ -36,11 +36,15 @@ struct MonotonicitySetting {
     bool useMonotonicity;
     bool useOnlyGlobalMonotonicity;
     bool useBoundsFromPLA;
+    // The number of threads that check the assumptions of the monotonicity analysis concurrently
+    uint64_t numberOfThreads;
 
-    explicit MonotonicitySetting(bool useMonotonicity = false, bool useOnlyGlobalMonotonicity = false, bool useBoundsFromPLA = false) {
+    explicit MonotonicitySetting(bool useMonotonicity = false, bool useOnlyGlobalMonotonicity = false, bool useBoundsFromPLA = false,
+                                 uint64_t numberOfThreads = 1) {
         this->useMonotonicity = useMonotonicity;
         this->useOnlyGlobalMonotonicity = useOnlyGlobalMonotonicity;
         this->useBoundsFromPLA = useBoundsFromPLA;
+        this->numberOfThreads = numberOfThreads;
     }
 };
 
@@ -163,6 +167,7 @@ std::shared_ptr<storm::modelchecker::RegionModelChecker<ParametricType>> initial
         checker->setUseMonotonicity(monotonicitySetting.useMonotonicity);
         checker->setUseOnlyGlobal(monotonicitySetting.useOnlyGlobalMonotonicity);
         checker->setUseBounds(monotonicitySetting.useBoundsFromPLA);
+        checker->setNumberOfMonotonicityThreads(monotonicitySetting.numberOfThreads);
         if (monotonicitySetting.useMonotonicity && monotoneParameters) {
             checker->setMonotoneParameters(monotoneParameters.get());
         }
@@ -280,6 +285,8 @@ std::unique_ptr<storm::modelchecker::RegionCheckResult<ValueType>> checkRegionsW
  * @param allowModelSimplification
  * @param useMonotonicity
  * @param monThresh if given, determines at which depth to start using monotonicity
+ * @param numberOfThreads the number of threads that analyze regions concurrently. Each additional thread uses its own region model checker. Monotonicity
+ * is only supported with a single thread.
  */
 template<typename ValueType>
 std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(
@@ -287,10 +294,19 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> che
     storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine,
     boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none,
     storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true,
-    MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0) {
+    MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0, uint64_t numberOfThreads = 1) {
     Environment env;
     bool preconditionsValidated = false;
     auto regionChecker = initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, preconditionsValidated, monotonicitySetting);
+    STORM_LOG_WARN_COND(numberOfThreads <= 1 || !monotonicitySetting.useMonotonicity, "Region refinement with monotonicity uses a single thread only.");
+    if (numberOfThreads > 1 && !monotonicitySetting.useMonotonicity) {
+        std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<ValueType>>> workers;
+        for (uint64_t worker = 1; worker < numberOfThreads; ++worker) {
+            // The preconditions have already been validated when initializing the first checker.
+            workers.push_back(initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, true, monotonicitySetting));
+        }
+        regionChecker->setRefinementWorkers(std::move(workers));
+    }
     return regionChecker->performRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis, monThresh);
 }
 
@@ -15,6 +15,7 @@
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/solver/EliminationLinearEquationSolver.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "utility/SignalHandler.h"
 
 namespace storm {
@@ -320,14 +321,15 @@ ConstantType GradientDescentInstantiationSearcher<FunctionType, ConstantType>::s
                 break;
             }
 
-            for (auto const& parameter : miniBatch) {
-                auto checkResult = derivativeEvaluationHelper->check(env, nesterovPredictedPosition, parameter, valueVector);
-                ConstantType delta = checkResult->getValueVector()[derivativeEvaluationHelper->getInitialState()];
+            // The derivatives w.r.t. all parameters of the mini-batch are computed in a single pass.
+            auto checkResults = derivativeEvaluationHelper->check(env, nesterovPredictedPosition, miniBatch, valueVector);
+            for (uint_fast64_t i = 0; i < miniBatch.size(); ++i) {
+                ConstantType delta = checkResults[i]->getValueVector()[derivativeEvaluationHelper->getInitialState()];
                 if (synthesisTask->getBound().comparisonType == logic::ComparisonType::Less ||
                     synthesisTask->getBound().comparisonType == logic::ComparisonType::LessEqual) {
                     delta = -delta;
                 }
-                deltaVector[parameter] = delta;
+                deltaVector[miniBatch[i]] = delta;
             }
         } else {
             if (synthesisTask->getBound().comparisonType == logic::ComparisonType::Less ||
@@ -382,10 +384,24 @@ std::pair<std::map<VariableType<FunctionType>, CoefficientType<FunctionType>>, C
 GradientDescentInstantiationSearcher<FunctionType, ConstantType>::gradientDescent() {
     STORM_LOG_ASSERT(this->synthesisTask, "Call setup before calling gradientDescent");
 
-    resetDynamicValues();
-
     STORM_LOG_ASSERT(this->synthesisTask->isBoundSet(), "Task does not involve a bound.");
 
+    // Every thread performs the gradient descent with its own searcher.
+    std::vector<GradientDescentInstantiationSearcher*> searchers = {this};
+    STORM_LOG_WARN_COND(numberOfThreads == 1 || !recordRun, "Recording the run requires a single thread. Using a single thread.");
+    if (!recordRun) {
+        while (workers.size() + 1 < numberOfThreads) {
+            workers.push_back(std::unique_ptr<GradientDescentInstantiationSearcher>(new GradientDescentInstantiationSearcher(*this)));
+            workers.back()->setup(env, synthesisTask);
+        }
+        for (uint64_t i = 0; i + 1 < numberOfThreads; ++i) {
+            searchers.push_back(workers[i].get());
+        }
+    }
+    for (auto searcher : searchers) {
+        searcher->resetDynamicValues();
+    }
+
     std::map<VariableType<FunctionType>, CoefficientType<FunctionType>> bestInstantiation;
     ConstantType bestValue;
     switch (this->synthesisTask->getBound().comparisonType) {
@@ -403,27 +419,36 @@ GradientDescentInstantiationSearcher<FunctionType, ConstantType>::gradientDescen
     std::default_random_engine engine(device());
     std::uniform_real_distribution<> dist(0, 1);
     bool initialGuess = true;
-    std::map<VariableType<FunctionType>, CoefficientType<FunctionType>> point;
+    std::vector<std::map<VariableType<FunctionType>, CoefficientType<FunctionType>>> points(searchers.size());
+    std::vector<ConstantType> values(searchers.size());
     while (true) {
-        STORM_PRINT_AND_LOG("Trying out a new starting point\n");
+        if (searchers.size() == 1) {
+            STORM_PRINT_AND_LOG("Trying out a new starting point\n");
+        } else {
+            STORM_PRINT_AND_LOG("Trying out " << searchers.size() << " new starting points\n");
+        }
         if (initialGuess) {
             STORM_PRINT_AND_LOG("Trying initial guess (p->0.5 for every parameter p or set start point)\n");
         }
-        // Generate random starting point
-        for (auto const& param : this->parameters) {
-            if (initialGuess) {
-                logarithmicBarrierTerm = utility::convertNumber<ConstantType>(0.1);
-                if (startPoint) {
-                    point[param] = (*startPoint)[param];
+        // Generate random starting points. Only the first thread tries the initial guess.
+        for (uint64_t i = 0; i < searchers.size(); ++i) {
+            auto& searcher = *searchers[i];
+            auto& point = points[i];
+            for (auto const& param : this->parameters) {
+                if (initialGuess && i == 0) {
+                    searcher.logarithmicBarrierTerm = utility::convertNumber<ConstantType>(0.1);
+                    if (startPoint) {
+                        point[param] = (*startPoint)[param];
+                    } else {
+                        point[param] = utility::convertNumber<CoefficientType<FunctionType>>(0.5 + 1e-6);
+                    }
+                } else if (!initialGuess && constraintMethod == GradientDescentConstraintMethod::BARRIER_LOGARITHMIC &&
+                           searcher.logarithmicBarrierTerm > utility::convertNumber<ConstantType>(0.00001)) {
+                    // Do nothing
                 } else {
-                    point[param] = utility::convertNumber<CoefficientType<FunctionType>>(0.5 + 1e-6);
+                    searcher.logarithmicBarrierTerm = utility::convertNumber<ConstantType>(0.1);
+                    point[param] = utility::convertNumber<CoefficientType<FunctionType>>(dist(engine));
                 }
-            } else if (!initialGuess && constraintMethod == GradientDescentConstraintMethod::BARRIER_LOGARITHMIC &&
-                       logarithmicBarrierTerm > utility::convertNumber<ConstantType>(0.00001)) {
-                // Do nothing
-            } else {
-                logarithmicBarrierTerm = utility::convertNumber<ConstantType>(0.1);
-                point[param] = utility::convertNumber<CoefficientType<FunctionType>>(dist(engine));
             }
         }
         initialGuess = false;
@@ -431,24 +456,33 @@ GradientDescentInstantiationSearcher<FunctionType, ConstantType>::gradientDescen
         /* walk.clear(); */
 
         stochasticWatch.start();
-        STORM_PRINT_AND_LOG("Starting at " << point << "\n");
-        ConstantType prob = stochasticGradientDescent(point);
+        for (auto const& point : points) {
+            STORM_PRINT_AND_LOG("Starting at " << point << "\n");
+        }
+        storm::utility::parallel::forEachChunk(searchers.size(), static_cast<uint64_t>(0), static_cast<uint64_t>(searchers.size()),
+                                               [&](uint64_t, uint64_t begin, uint64_t end) {
+                                                   for (uint64_t i = begin; i < end; ++i) {
+                                                       values[i] = searchers[i]->stochasticGradientDescent(points[i]);
+                                                   }
+                                               });
         stochasticWatch.stop();
 
-        bool isFoundPointBetter = false;
-        switch (this->synthesisTask->getBound().comparisonType) {
-            case logic::ComparisonType::Greater:
-            case logic::ComparisonType::GreaterEqual:
-                isFoundPointBetter = prob > bestValue;
-                break;
-            case logic::ComparisonType::Less:
-            case logic::ComparisonType::LessEqual:
-                isFoundPointBetter = prob < bestValue;
-                break;
-        }
-        if (isFoundPointBetter) {
-            bestInstantiation = point;
-            bestValue = prob;
+        for (uint64_t i = 0; i < searchers.size(); ++i) {
+            bool isFoundPointBetter = false;
+            switch (this->synthesisTask->getBound().comparisonType) {
+                case logic::ComparisonType::Greater:
+                case logic::ComparisonType::GreaterEqual:
+                    isFoundPointBetter = values[i] > bestValue;
+                    break;
+                case logic::ComparisonType::Less:
+                case logic::ComparisonType::LessEqual:
+                    isFoundPointBetter = values[i] < bestValue;
+                    break;
+            }
+            if (isFoundPointBetter) {
+                bestInstantiation = points[i];
+                bestValue = values[i];
+            }
         }
 
         if (synthesisTask->getBound().isSatisfied(bestValue)) {
@@ -458,7 +492,9 @@ GradientDescentInstantiationSearcher<FunctionType, ConstantType>::gradientDescen
             break;
         } else {
             if (constraintMethod == GradientDescentConstraintMethod::BARRIER_LOGARITHMIC) {
-                logarithmicBarrierTerm = logarithmicBarrierTerm / 10;
+                for (auto searcher : searchers) {
+                    searcher->logarithmicBarrierTerm = searcher->logarithmicBarrierTerm / 10;
+                }
                 STORM_PRINT_AND_LOG("Smaller term\n" << bestValue << "\n" << logarithmicBarrierTerm << "\n");
                 continue;
             }
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <map>
 #include <memory>
+#include <vector>
 #include "GradientDescentConstraintMethod.h"
 #include "GradientDescentMethod.h"
 #include "analysis/GraphConditions.h"
@@ -155,6 +157,19 @@ class GradientDescentInstantiationSearcher {
 
         instantiationModelChecker->specifyFormula(*this->currentCheckTaskNoBound);
         derivativeEvaluationHelper->specifyFormula(env, *this->currentCheckTaskNoBound);
+        // The searchers of additional threads are (re-)created for the new task when they are needed.
+        workers.clear();
+    }
+
+    /**
+     * Sets the number of threads. Every thread performs the gradient descent from a different starting point,
+     * and the best instantiation of all threads is returned. Every additional thread uses its own copy of the matrices used
+     * for computing the derivatives. As the walk can only be recorded for a single descent, this is ignored if
+     * recordRun is set.
+     * @param numberOfThreads The number of threads (at least one).
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads) {
+        this->numberOfThreads = std::max<uint64_t>(numberOfThreads, 1);
     }
 
     /**
@@ -182,6 +197,25 @@ class GradientDescentInstantiationSearcher {
     std::vector<VisualizationPoint> getVisualizationWalk();
 
    private:
+    /**
+     * Creates a GradientDescentInstantiationSearcher with the same configuration as the given one, but with its own
+     * model checkers. It does not record its run. Call setup before using it.
+     */
+    GradientDescentInstantiationSearcher(GradientDescentInstantiationSearcher const& other)
+        : model(other.model),
+          derivativeEvaluationHelper(std::make_unique<SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>>(other.model)),
+          instantiationModelChecker(
+              std::make_unique<modelchecker::SparseDtmcInstantiationModelChecker<models::sparse::Dtmc<FunctionType>, ConstantType>>(other.model)),
+          startPoint(other.startPoint),
+          miniBatchSize(other.miniBatchSize),
+          terminationEpsilon(other.terminationEpsilon),
+          constraintMethod(other.constraintMethod),
+          recordRun(false),
+          gradientDescentType(other.gradientDescentType),
+          useSignsOnly(other.useSignsOnly) {
+        // Intentionally left empty.
+    }
+
     void resetDynamicValues();
 
     Environment env;
@@ -245,6 +279,10 @@ class GradientDescentInstantiationSearcher {
 
     ConstantType logarithmicBarrierTerm;
 
+    // The number of threads and the searchers of all threads but the calling one.
+    uint64_t numberOfThreads = 1;
+    std::vector<std::unique_ptr<GradientDescentInstantiationSearcher>> workers;
+
     ConstantType stochasticGradientDescent(
         std::map<typename utility::parametric::VariableType<FunctionType>::type, typename utility::parametric::CoefficientType<FunctionType>::type>& position);
     ConstantType doStep(
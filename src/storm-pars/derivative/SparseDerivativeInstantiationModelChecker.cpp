@@ -36,6 +36,16 @@ template<typename FunctionType, typename ConstantType>
 std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::check(
     Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation, VariableType<FunctionType> const& parameter,
     boost::optional<std::vector<ConstantType>> const& valueVector) {
+    auto results = check(env, valuation, std::vector<VariableType<FunctionType>>({parameter}), valueVector);
+    return std::move(results.front());
+}
+
+template<typename FunctionType, typename ConstantType>
+std::vector<std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>>
+SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::check(Environment const& env,
+                                                                             storm::utility::parametric::Valuation<FunctionType> const& valuation,
+                                                                             std::vector<VariableType<FunctionType>> const& parameters,
+                                                                             boost::optional<std::vector<ConstantType>> const& valueVector) {
     std::vector<ConstantType> reachabilityProbabilities;
     if (!valueVector.is_initialized()) {
         storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<FunctionType>, ConstantType> instantiationModelChecker(model);
@@ -55,59 +65,61 @@ std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> Spa
             interestingReachabilityProbabilities.push_back(reachabilityProbabilities[i]);
         }
     }
-    // Instantiate the matrices with the given instantiation
 
+    // Instantiate the equation system, which is the same for all parameters.
     instantiationWatch.start();
-
-    // STORM_PRINT_AND_LOG(valuation << "\n");
-
-    // Write results into the placeholders
     for (auto& functionResult : this->functionsUnderived) {
         functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
     }
-    for (auto& functionResult : this->functionsDerived.at(parameter)) {
-        functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
-    }
-
-    auto deltaConstrainedMatrixInstantiated = deltaConstrainedMatricesInstantiated->at(parameter);
-
-    // Write the instantiated values to the matrices and vectors according to the stored mappings
     for (auto& entryValuePair : this->matrixMappingUnderived) {
         entryValuePair.first->setValue(*(entryValuePair.second));
     }
-    for (auto& entryValuePair : this->matrixMappingsDerived.at(parameter)) {
-        entryValuePair.first->setValue(*(entryValuePair.second));
-    }
-
-    std::vector<ConstantType> instantiatedDerivedOutputVec(derivedOutputVecs->at(parameter).size());
-    for (uint_fast64_t i = 0; i < derivedOutputVecs->at(parameter).size(); i++) {
-        instantiatedDerivedOutputVec[i] = utility::convertNumber<ConstantType>(derivedOutputVecs->at(parameter)[i].evaluate(valuation));
-    }
-
     instantiationWatch.stop();
 
+    // Here's where the real magic happens - the solver calls!
+    // All derivatives are solutions of (1-M)^-1 * b for different right-hand sides b, so we set up a single solver that can reuse its (cached) data.
     approximationWatch.start();
+    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
+    auto solver = factory.create(env);
+    solver->setCachingEnabled(true);
+    solver->setMatrix(constrainedMatrixInstantiated);
+    approximationWatch.stop();
 
+    std::vector<std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>> results;
+    results.reserve(parameters.size());
     std::vector<ConstantType> resultVec(interestingReachabilityProbabilities.size());
-    deltaConstrainedMatrixInstantiated.multiplyWithVector(interestingReachabilityProbabilities, resultVec);
-    for (uint_fast64_t i = 0; i < instantiatedDerivedOutputVec.size(); ++i) {
-        resultVec[i] += instantiatedDerivedOutputVec[i];
-    }
+    for (auto const& parameter : parameters) {
+        instantiationWatch.start();
+        for (auto& functionResult : this->functionsDerived.at(parameter)) {
+            functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
+        }
+        // Note that the mappings point into the stored matrix, so we must not work on a copy of it.
+        auto& deltaConstrainedMatrixInstantiated = deltaConstrainedMatricesInstantiated->at(parameter);
+        for (auto& entryValuePair : this->matrixMappingsDerived.at(parameter)) {
+            entryValuePair.first->setValue(*(entryValuePair.second));
+        }
 
-    // Here's where the real magic happens - the solver call!
-    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
-    auto solver = factory.create(env);
+        auto const& derivedOutputVec = derivedOutputVecs->at(parameter);
+        std::vector<ConstantType> instantiatedDerivedOutputVec(derivedOutputVec.size());
+        for (uint_fast64_t i = 0; i < derivedOutputVec.size(); i++) {
+            instantiatedDerivedOutputVec[i] = utility::convertNumber<ConstantType>(derivedOutputVec[i].evaluate(valuation));
+        }
+        instantiationWatch.stop();
 
-    // Calculate (1-M)^-1 * resultVec
-    // STORM_PRINT_AND_LOG(constrainedMatrixInstantiated << "\n");
-    // STORM_PRINT_AND_LOG("calling solver\n");
-    solver->setMatrix(constrainedMatrixInstantiated);
-    std::vector<ConstantType> finalResult(resultVec.size());
-    solver->solveEquations(env, finalResult, resultVec);
+        approximationWatch.start();
+        deltaConstrainedMatrixInstantiated.multiplyWithVector(interestingReachabilityProbabilities, resultVec);
+        for (uint_fast64_t i = 0; i < instantiatedDerivedOutputVec.size(); ++i) {
+            resultVec[i] += instantiatedDerivedOutputVec[i];
+        }
 
-    approximationWatch.stop();
+        // Calculate (1-M)^-1 * resultVec
+        std::vector<ConstantType> finalResult(resultVec.size());
+        solver->solveEquations(env, finalResult, resultVec);
+        approximationWatch.stop();
 
-    return std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(finalResult);
+        results.push_back(std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(std::move(finalResult)));
+    }
+    return results;
 }
 
 template<typename FunctionType, typename ConstantType>
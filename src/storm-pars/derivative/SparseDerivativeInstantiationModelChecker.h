@@ -47,6 +47,19 @@ class SparseDerivativeInstantiationModelChecker {
         typename utility::parametric::VariableType<FunctionType>::type const& parameter,
         boost::optional<std::vector<ConstantType>> const& valueVector = boost::none);
 
+    /**
+     * check calculates the derivatives of the model w.r.t. the given parameters at an instantiation in a single pass.
+     * The value vector and the equation system are only instantiated once, and all derivatives are obtained with the same
+     * equation solver, which can reuse its cached data for every right-hand side.
+     * Call specifyFormula first!
+     * @param env The environment.
+     * @return The derivative w.r.t. every given parameter (in the given order).
+     */
+    std::vector<std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>> check(
+        Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation,
+        std::vector<typename utility::parametric::VariableType<FunctionType>::type> const& parameters,
+        boost::optional<std::vector<ConstantType>> const& valueVector = boost::none);
+
     uint64_t getInitialState() {
         return initialStateEqSystem;
     }
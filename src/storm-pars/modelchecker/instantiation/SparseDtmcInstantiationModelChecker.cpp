@@ -1,12 +1,18 @@
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/logic/FragmentSpecification.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -49,6 +55,34 @@ std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType
     }
 }
 
+template<typename SparseModelType, typename ConstantType>
+std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(
+    Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+    std::vector<std::unique_ptr<CheckResult>> results;
+    if (valuations.empty()) {
+        return results;
+    }
+    // Checking the first valuation also computes the maybe states (if the instantiations are graph preserving).
+    results.push_back(check(env, valuations.front()));
+    std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> remainingValuations(valuations.begin() + 1, valuations.end());
+
+    // The batched computation is based on value iteration and is thus not used for exact computations.
+    bool useBatch = std::is_same<ConstantType, double>::value && !remainingValuations.empty() && this->getInstantiationsAreGraphPreserving() &&
+                    this->currentCheckTask->getFormula().isInFragment(storm::logic::reachability()) &&
+                    this->currentCheckTask->getHint().isExplicitModelCheckerHint() &&
+                    this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>().hasMaybeStates();
+    if (useBatch) {
+        for (auto& result : checkReachabilityProbabilityFormulaBatch(env, remainingValuations)) {
+            results.push_back(std::move(result));
+        }
+    } else {
+        for (auto const& valuation : remainingValuations) {
+            results.push_back(check(env, valuation));
+        }
+    }
+    return results;
+}
+
 template<typename SparseModelType, typename ConstantType>
 std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityProbabilityFormula(
     Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker) {
@@ -194,6 +228,103 @@ std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType
     return result;
 }
 
+template<typename SparseModelType, typename ConstantType>
+std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityProbabilityFormulaBatch(
+    Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+    ExplicitModelCheckerHint<ConstantType> const& hint = this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>();
+    storm::storage::BitVector const& maybeStates = hint.getMaybeStates();
+    // As the instantiations are graph preserving, the values of the non-maybe states are the same for all valuations.
+    std::vector<ConstantType> const& knownValues = hint.getResultHint();
+    auto const& matrix = this->parametricModel.getTransitionMatrix();
+    uint64_t const numberOfValuations = valuations.size();
+    std::vector<ConstantType> entryValues = modelInstantiator.instantiateTransitionMatrixEntries(valuations);
+
+    storm::utility::ConstantsComparator<ConstantType> comparator;
+    for (uint64_t state = 0; state < matrix.getRowCount(); ++state) {
+        for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+            ConstantType rowSum = storm::utility::zero<ConstantType>();
+            for (auto entryIt = matrix.begin(state); entryIt != matrix.end(state); ++entryIt) {
+                rowSum += entryValues[std::distance(matrix.begin(), entryIt) * numberOfValuations + valuation];
+            }
+            STORM_LOG_THROW(comparator.isOne(rowSum), storm::exceptions::InvalidArgumentException,
+                            "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
+        }
+    }
+
+    // Gather the transitions between maybe states and the probabilities to directly reach the states with value one.
+    std::vector<uint64_t> maybeStateToIndex = maybeStates.getNumberOfSetBitsBeforeIndices();
+    uint64_t const numberOfMaybeStates = maybeStates.getNumberOfSetBits();
+    std::vector<uint64_t> rowStarts, columns, entries;
+    rowStarts.reserve(numberOfMaybeStates + 1);
+    std::vector<ConstantType> offsets(numberOfMaybeStates * numberOfValuations, storm::utility::zero<ConstantType>());
+    for (auto state : maybeStates) {
+        rowStarts.push_back(columns.size());
+        for (auto entryIt = matrix.begin(state); entryIt != matrix.end(state); ++entryIt) {
+            uint64_t entry = std::distance(matrix.begin(), entryIt);
+            if (maybeStates.get(entryIt->getColumn())) {
+                columns.push_back(maybeStateToIndex[entryIt->getColumn()]);
+                entries.push_back(entry);
+            } else if (!storm::utility::isZero(knownValues[entryIt->getColumn()])) {
+                for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                    offsets[maybeStateToIndex[state] * numberOfValuations + valuation] +=
+                        entryValues[entry * numberOfValuations + valuation] * knownValues[entryIt->getColumn()];
+                }
+            }
+        }
+    }
+    rowStarts.push_back(columns.size());
+
+    // Value iteration (in Gauss-Seidel style) starting from zero. The values of a state for the different valuations lie consecutively.
+    ConstantType const precision = storm::utility::convertNumber<ConstantType>(env.solver().native().getPrecision());
+    bool const relative = env.solver().native().getRelativeTerminationCriterion();
+    uint64_t const maximalNumberOfIterations = env.solver().native().getMaximalNumberOfIterations();
+    std::vector<ConstantType> values(numberOfMaybeStates * numberOfValuations, storm::utility::zero<ConstantType>());
+    std::vector<ConstantType> newValues(numberOfValuations);
+    bool converged = false;
+    uint64_t iterations = 0;
+    while (!converged && iterations < maximalNumberOfIterations) {
+        converged = true;
+        for (uint64_t maybeState = 0; maybeState < numberOfMaybeStates; ++maybeState) {
+            std::copy_n(offsets.begin() + maybeState * numberOfValuations, numberOfValuations, newValues.begin());
+            for (uint64_t index = rowStarts[maybeState]; index < rowStarts[maybeState + 1]; ++index) {
+                ConstantType const* probabilities = entryValues.data() + entries[index] * numberOfValuations;
+                ConstantType const* successorValues = values.data() + columns[index] * numberOfValuations;
+                for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                    newValues[valuation] += probabilities[valuation] * successorValues[valuation];
+                }
+            }
+            ConstantType* stateValues = values.data() + maybeState * numberOfValuations;
+            for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                ConstantType difference = storm::utility::abs<ConstantType>(newValues[valuation] - stateValues[valuation]);
+                if (converged && difference > (relative ? precision * storm::utility::abs<ConstantType>(newValues[valuation]) : precision)) {
+                    converged = false;
+                }
+                stateValues[valuation] = newValues[valuation];
+            }
+        }
+        ++iterations;
+    }
+    STORM_LOG_WARN_COND(converged, "Batched value iteration did not converge within " << iterations << " iterations.");
+    STORM_LOG_INFO("Batched value iteration for " << numberOfValuations << " valuations took " << iterations << " iterations.");
+
+    std::vector<std::unique_ptr<CheckResult>> results;
+    auto const& operatorFormula = this->currentCheckTask->getFormula().asOperatorFormula();
+    for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+        std::vector<ConstantType> stateValues = knownValues;
+        for (auto state : maybeStates) {
+            stateValues[state] = values[maybeStateToIndex[state] * numberOfValuations + valuation];
+        }
+        ExplicitQuantitativeCheckResult<ConstantType> quantitativeResult(std::move(stateValues));
+        if (operatorFormula.hasQuantitativeResult()) {
+            results.push_back(std::make_unique<ExplicitQuantitativeCheckResult<ConstantType>>(std::move(quantitativeResult)));
+        } else {
+            results.push_back(
+                quantitativeResult.compareAgainstBound(operatorFormula.getComparisonType(), operatorFormula.template getThresholdAs<ConstantType>()));
+        }
+    }
+    return results;
+}
+
 template class SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>;
 template class SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::RationalNumber>;
 
@@ -2,6 +2,7 @@
 
 #include <boost/optional.hpp>
 #include <memory>
+#include <vector>
 
 #include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
 #include "storm-pars/utility/ModelInstantiator.h"
@@ -23,6 +24,17 @@ class SparseDtmcInstantiationModelChecker : public SparseInstantiationModelCheck
     virtual std::unique_ptr<CheckResult> check(Environment const& env,
                                                storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
 
+    /*!
+     * Checks the specified property for each of the given valuations. The first valuation is checked as in check. For reachability probabilities with graph
+     * preserving instantiations, the remaining valuations are then checked together: The matrix entries are evaluated for all valuations at once and the
+     * values of all valuations are computed in a single Gauss-Seidel value iteration, i.e., the matrix is traversed once per iteration for all valuations.
+     * Other properties are checked one valuation at a time.
+     *
+     * @return The check results in the order of the given valuations.
+     */
+    std::vector<std::unique_ptr<CheckResult>> checkBatch(
+        Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
+
    protected:
     // Optimizations for the different formula types
     std::unique_ptr<CheckResult> checkReachabilityProbabilityFormula(
@@ -32,6 +44,10 @@ class SparseDtmcInstantiationModelChecker : public SparseInstantiationModelCheck
     std::unique_ptr<CheckResult> checkBoundedUntilFormula(
         Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
 
+    // Computes the reachability probabilities for all given valuations at once using the maybe states (and values of the other states) of the hint.
+    std::vector<std::unique_ptr<CheckResult>> checkReachabilityProbabilityFormulaBatch(
+        Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
+
     storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Dtmc<ConstantType>> modelInstantiator;
 };
 }  // namespace modelchecker
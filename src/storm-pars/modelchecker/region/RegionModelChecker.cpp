@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <queue>
 #include <sstream>
 #include <vector>
@@ -13,6 +14,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotImplementedException.h"
@@ -95,58 +97,84 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
     }
 
     // NORMAL WHILE LOOP
+    // Without monotonicity, the refinement workers (if any) analyze the regions at the front of the queue concurrently. The results are then processed in
+    // queue order on this thread, so the coverage is only ever updated by a single thread.
+    uint64_t const batchSize = useMonotonicity ? 1 : refinementWorkers.size() + 1;
+    std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> batch;
+    std::vector<uint64_t> batchDepths;
     uint64_t currentDepth = refinementDepths.front();
     while ((!useMonotonicity || currentDepth < monThresh) && fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
         assert(unprocessedRegions.size() == refinementDepths.size());
-        STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; "
-                                            << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
-        auto& currentRegion = unprocessedRegions.front().first;
-        auto& res = unprocessedRegions.front().second;
-        std::shared_ptr<storm::analysis::Order> order;
-        std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult;
-        res = analyzeRegion(env, currentRegion, hypothesis, res, false);
+        batch.clear();
+        batchDepths.clear();
+        while (batch.size() < batchSize && !unprocessedRegions.empty()) {
+            batch.push_back(std::move(unprocessedRegions.front()));
+            batchDepths.push_back(refinementDepths.front());
+            unprocessedRegions.pop();
+            refinementDepths.pop();
+        }
+        if (batch.size() == 1) {
+            batch.front().second = analyzeRegion(env, batch.front().first, hypothesis, batch.front().second, false);
+        } else {
+            storm::utility::parallel::forEachChunk(batch.size(), 0ull, batch.size(), [&](uint64_t threadIndex, uint64_t chunkBegin, uint64_t chunkEnd) {
+                RegionModelChecker<ParametricType>& checker = threadIndex == 0 ? *this : *refinementWorkers[threadIndex - 1];
+                for (uint64_t index = chunkBegin; index < chunkEnd; ++index) {
+                    batch[index].second = checker.analyzeRegion(env, batch[index].first, hypothesis, batch[index].second, false);
+                }
+            });
+        }
 
-        switch (res) {
-            case RegionResult::AllSat:
-                fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                fractionOfAllSatArea += currentRegion.area() / areaOfParameterSpace;
-                result.push_back(std::move(unprocessedRegions.front()));
-                break;
-            case RegionResult::AllViolated:
-                fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                fractionOfAllViolatedArea += currentRegion.area() / areaOfParameterSpace;
-                result.push_back(std::move(unprocessedRegions.front()));
-                break;
-            default:
-                // Split the region as long as the desired refinement depth is not reached.
-                if (!depthThreshold || currentDepth < depthThreshold.get()) {
-                    std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
-                    RegionResult initResForNewRegions = (res == RegionResult::CenterSat)
-                                                            ? RegionResult::ExistsSat
-                                                            : ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated : RegionResult::Unknown);
+        for (uint64_t batchIndex = 0; batchIndex < batch.size(); ++batchIndex) {
+            currentDepth = batchDepths[batchIndex];
+            STORM_LOG_INFO("Analyzed region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; "
+                                               << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+            auto& currentRegion = batch[batchIndex].first;
+            auto& res = batch[batchIndex].second;
+            // Regions of the batch that are processed after the coverage threshold has been reached are not refined any further.
+            bool refine = fractionOfUndiscoveredArea > thresholdAsCoefficient && (!depthThreshold || currentDepth < depthThreshold.get());
+
+            switch (res) {
+                case RegionResult::AllSat:
+                    fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
+                    fractionOfAllSatArea += currentRegion.area() / areaOfParameterSpace;
+                    result.push_back(std::move(batch[batchIndex]));
+                    break;
+                case RegionResult::AllViolated:
+                    fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
+                    fractionOfAllViolatedArea += currentRegion.area() / areaOfParameterSpace;
+                    result.push_back(std::move(batch[batchIndex]));
+                    break;
+                default:
+                    // Split the region as long as the desired refinement depth is not reached.
+                    if (refine) {
+                        std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                        RegionResult initResForNewRegions =
+                            (res == RegionResult::CenterSat) ? RegionResult::ExistsSat
+                                                             : ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated : RegionResult::Unknown);
+
+                        currentRegion.split(currentRegion.getCenterPoint(), newRegions);
+                        for (auto& newRegion : newRegions) {
+                            unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
+                            refinementDepths.push(currentDepth + 1);
+                        }
 
-                    currentRegion.split(currentRegion.getCenterPoint(), newRegions);
-                    for (auto& newRegion : newRegions) {
-                        unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
-                        refinementDepths.push(currentDepth + 1);
+                    } else {
+                        // If the region is not further refined, it is still added to the result
+                        result.push_back(std::move(batch[batchIndex]));
                     }
-
-                } else {
-                    // If the region is not further refined, it is still added to the result
-                    result.push_back(std::move(unprocessedRegions.front()));
+                    break;
+            }
+            ++numOfAnalyzedRegions;
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
+                    STORM_PRINT_AND_LOG("#");
+                    displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
                 }
-                break;
-        }
-        ++numOfAnalyzedRegions;
-        unprocessedRegions.pop();
-        refinementDepths.pop();
-        if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-            while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
-                STORM_PRINT_AND_LOG("#");
-                displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
             }
         }
-        currentDepth = refinementDepths.front();
+        if (!refinementDepths.empty()) {
+            currentDepth = refinementDepths.front();
+        }
     }
 
     // FIFO queues for the order and local monotonicity results
@@ -423,6 +451,16 @@ void RegionModelChecker<ParametricType>::setUseOnlyGlobal(bool global) {
     this->useOnlyGlobal = global;
 }
 
+template<typename ParametricType>
+void RegionModelChecker<ParametricType>::setNumberOfMonotonicityThreads(uint64_t numberOfThreads) {
+    this->numberOfMonotonicityThreads = std::max<uint64_t>(numberOfThreads, 1);
+}
+
+template<typename ParametricType>
+uint64_t RegionModelChecker<ParametricType>::getNumberOfMonotonicityThreads() const {
+    return numberOfMonotonicityThreads;
+}
+
 template<typename ParametricType>
 void RegionModelChecker<ParametricType>::splitSmart(storm::storage::ParameterRegion<ParametricType>& currentRegion,
                                                     std::vector<storm::storage::ParameterRegion<ParametricType>>& regionVector,
@@ -439,6 +477,16 @@ void RegionModelChecker<ParametricType>::setMonotoneParameters(std::pair<std::se
     monotoneDecrParameters = std::move(monotoneParameters.second);
 }
 
+template<typename ParametricType>
+void RegionModelChecker<ParametricType>::setRefinementWorkers(std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> workers) {
+    refinementWorkers = std::move(workers);
+}
+
+template<typename ParametricType>
+std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& RegionModelChecker<ParametricType>::getRefinementWorkers() const {
+    return refinementWorkers;
+}
+
 #ifdef STORM_HAVE_CARL
 template class RegionModelChecker<storm::RationalFunction>;
 #endif
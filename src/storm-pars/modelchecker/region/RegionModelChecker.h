@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "storm-pars/analysis/LocalMonotonicityResult.h"
 #include "storm-pars/analysis/Order.h"
@@ -53,7 +54,7 @@ class RegionModelChecker {
 
     * If supported by this model checker, it is possible to sample the vertices of the regions whenever AllSat/AllViolated could not be shown.
     */
-    std::unique_ptr<storm::modelchecker::RegionCheckResult<ParametricType>> analyzeRegions(
+    virtual std::unique_ptr<storm::modelchecker::RegionCheckResult<ParametricType>> analyzeRegions(
         Environment const& env, std::vector<storm::storage::ParameterRegion<ParametricType>> const& regions,
         std::vector<RegionResultHypothesis> const& hypotheses, bool sampleVerticesOfRegion = false);
 
@@ -124,6 +125,12 @@ class RegionModelChecker {
     void setUseBounds(bool bounds = true);
     void setUseOnlyGlobal(bool global = true);
 
+    /*!
+     * Sets the number of threads that check the assumptions of the monotonicity analysis concurrently.
+     */
+    void setNumberOfMonotonicityThreads(uint64_t numberOfThreads);
+    uint64_t getNumberOfMonotonicityThreads() const;
+
     /*!
      * When splitting, split in at most this many dimensions
      */
@@ -137,12 +144,23 @@ class RegionModelChecker {
                                          std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>>
                                    monotoneParameters);
 
+    /*!
+     * Sets region model checkers that are used to analyze regions concurrently during region refinement (without monotonicity). Each worker must have been
+     * specified for the same model and check task as this checker, but must not share any state (e.g. parameter lifter or solver) with it.
+     */
+    void setRefinementWorkers(std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> workers);
+
    private:
     bool useMonotonicity = false;
     bool useOnlyGlobal = false;
     bool useBounds = false;
+    uint64_t numberOfMonotonicityThreads = 1;
+
+    std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> refinementWorkers;
 
    protected:
+    std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& getRefinementWorkers() const;
+
     uint_fast64_t numberOfRegionsKnownThroughMonotonicity;
     boost::optional<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneIncrParameters;
     boost::optional<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneDecrParameters;
@@ -151,6 +151,7 @@ void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::spec
         storm::utility::graph::performProb01(this->parametricModel->getBackwardTransitions(), phiStates, psiStates);
     this->orderExtender = storm::analysis::OrderExtender<ValueType, ConstantType>(&statesWithProbability01.second, &statesWithProbability01.first,
                                                                                   this->parametricModel->getTransitionMatrix());
+    this->orderExtender->setNumberOfThreads(this->getNumberOfMonotonicityThreads());
 }
 
 template<typename SparseModelType, typename ConstantType>
@@ -199,6 +200,7 @@ void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::spec
 
     this->orderExtender = storm::analysis::OrderExtender<ValueType, ConstantType>(&statesWithProbability01.second, &statesWithProbability01.first,
                                                                                   this->parametricModel->getTransitionMatrix());
+    this->orderExtender->setNumberOfThreads(this->getNumberOfMonotonicityThreads());
 }
 
 template<typename SparseModelType, typename ConstantType>
@@ -331,6 +333,7 @@ std::unique_ptr<CheckResult> SparseDtmcParameterLiftingModelChecker<SparseModelT
     }
     parameterLifter->specifyRegion(region, dirForParameters);
 
+    std::vector<ConstantType>& x = storm::solver::minimize(dirForParameters) ? minX : maxX;
     if (stepBound) {
         assert(*stepBound > 0);
         x = std::vector<ConstantType>(maybeStates.getNumberOfSetBits(), storm::utility::zero<ConstantType>());
@@ -441,7 +444,7 @@ std::unique_ptr<CheckResult> SparseDtmcParameterLiftingModelChecker<SparseModelT
             solver->setTerminationCondition(std::move(termCond));
         }
 
-        // Invoke the solver
+        // Invoke the solver, starting from the most recent result for the same direction (typically the one for the parent region)
         x.resize(maybeStates.getNumberOfSetBits(), storm::utility::zero<ConstantType>());
         solver->solveEquations(env, dirForParameters, x, parameterLifter->getVector());
         if (storm::solver::minimize(dirForParameters)) {
@@ -549,7 +552,8 @@ void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::rese
     parameterLifter = nullptr;
     minSchedChoices = boost::none;
     maxSchedChoices = boost::none;
-    x.clear();
+    minX.clear();
+    maxX.clear();
     lowerResultBound = boost::none;
     upperResultBound = boost::none;
     regionSplitEstimationsEnabled = false;
@@ -87,9 +87,10 @@ class SparseDtmcParameterLiftingModelChecker : public SparseParameterLiftingMode
     std::unique_ptr<storm::solver::MinMaxLinearEquationSolverFactory<ConstantType>> solverFactory;
     bool solvingRequiresUpperRewardBounds;
 
-    // Results from the most recent solver call.
+    // Results from the most recent solver call (for each direction).
+    // When a region is split, the results for the parent region are the starting point for its subregions.
     boost::optional<std::vector<uint_fast64_t>> minSchedChoices, maxSchedChoices;
-    std::vector<ConstantType> x;
+    std::vector<ConstantType> minX, maxX;
     boost::optional<ConstantType> lowerResultBound, upperResultBound;
 
     bool regionSplitEstimationsEnabled;
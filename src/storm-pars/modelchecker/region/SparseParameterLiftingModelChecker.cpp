@@ -573,6 +573,11 @@ CheckTask<storm::logic::Formula, ConstantType> const& SparseParameterLiftingMode
     return *currentCheckTask;
 }
 
+template<typename SparseModelType, typename ConstantType>
+ConstantType const& SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::getValueOfLastCheck() const {
+    return lastValue;
+}
+
 template<typename SparseModelType, typename ConstantType>
 void SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::specifyBoundedUntilFormula(
     const CheckTask<logic::BoundedUntilFormula, ConstantType>& checkTask) {
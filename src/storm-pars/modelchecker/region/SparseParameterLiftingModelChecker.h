@@ -86,6 +86,11 @@ class SparseParameterLiftingModelChecker : public RegionModelChecker<typename Sp
     SparseModelType const& getConsideredParametricModel() const;
     CheckTask<storm::logic::Formula, ConstantType> const& getCurrentCheckTask() const;
 
+    /*!
+     * Retrieves the value at the initial state that has been computed by the most recent call of check.
+     */
+    ConstantType const& getValueOfLastCheck() const;
+
    protected:
     void specifyFormula(Environment const& env, CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask);
 
@@ -6,20 +6,35 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
+
+#include "storm-pars/settings/modules/RegionVerificationSettings.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
 
 namespace storm {
 namespace modelchecker {
 
 template<typename SparseModelType, typename ImpreciseType, typename PreciseType>
 ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::ValidatingSparseParameterLiftingModelChecker()
-    : numOfWrongRegions(0) {
-    // Intentionally left empty
+    : numOfWrongRegions(0), numOfUnvalidatedRegions(0) {
+    if (storm::settings::hasModule<storm::settings::modules::RegionVerificationSettings>()) {
+        auto const& regionVerificationSettings = storm::settings::getModule<storm::settings::modules::RegionVerificationSettings>();
+        if (regionVerificationSettings.isValidationMarginSet()) {
+            validationMargin = regionVerificationSettings.getValidationMargin();
+        }
+    }
 }
 
 template<typename SparseModelType, typename ImpreciseType, typename PreciseType>
 ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::~ValidatingSparseParameterLiftingModelChecker() {
     if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
         STORM_PRINT_AND_LOG("Validating Parameter Lifting Model Checker detected " << numOfWrongRegions << " regions where the imprecise method was wrong.\n");
+        if (validationMargin) {
+            STORM_PRINT_AND_LOG("Validating Parameter Lifting Model Checker did not validate " << numOfUnvalidatedRegions
+                                                                                              << " regions due to a sufficient margin.\n");
+        }
     }
 }
 
@@ -36,8 +51,83 @@ RegionResult ValidatingSparseParameterLiftingModelChecker<SparseModelType, Impre
     std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>>
         localMonotonicityResult) {
     RegionResult currentResult = getImpreciseChecker().analyzeRegion(env, region, hypothesis, initialResult, false);
+    return validateRegion(env, region, hypothesis, currentResult, sampleVerticesOfRegion);
+}
+
+template<typename SparseModelType, typename ImpreciseType, typename PreciseType>
+std::unique_ptr<storm::modelchecker::RegionCheckResult<typename SparseModelType::ValueType>>
+ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::analyzeRegions(
+    Environment const& env, std::vector<storm::storage::ParameterRegion<typename SparseModelType::ValueType>> const& regions,
+    std::vector<RegionResultHypothesis> const& hypotheses, bool sampleVerticesOfRegion) {
+    STORM_LOG_THROW(regions.size() == hypotheses.size(), storm::exceptions::InvalidArgumentException,
+                    "The number of regions and the number of hypotheses do not match");
+    std::vector<ValidatingSparseParameterLiftingModelChecker*> checkers = {this};
+    for (auto const& worker : this->getRefinementWorkers()) {
+        if (auto validatingWorker = dynamic_cast<ValidatingSparseParameterLiftingModelChecker*>(worker.get())) {
+            checkers.push_back(validatingWorker);
+        }
+    }
+    if (checkers.size() == 1) {
+        // Validating right away allows to use the hints of the imprecise checker for the same region.
+        return RegionModelChecker<typename SparseModelType::ValueType>::analyzeRegions(env, regions, hypotheses, sampleVerticesOfRegion);
+    }
+
+    // First analyze all regions with the imprecise method.
+    std::vector<std::pair<storm::storage::ParameterRegion<typename SparseModelType::ValueType>, RegionResult>> result;
+    std::vector<uint64_t> regionsToValidate;
+    for (uint64_t regionIndex = 0; regionIndex < regions.size(); ++regionIndex) {
+        RegionResult impreciseResult = getImpreciseChecker().analyzeRegion(env, regions[regionIndex], hypotheses[regionIndex], RegionResult::Unknown, false);
+        bool conclusive = impreciseResult == RegionResult::AllSat || impreciseResult == RegionResult::AllViolated;
+        if (requiresValidation(impreciseResult) || (sampleVerticesOfRegion && !conclusive)) {
+            regionsToValidate.push_back(regionIndex);
+        }
+        result.emplace_back(regions[regionIndex], impreciseResult);
+    }
+
+    // Then validate the results concurrently. Every thread uses its own precise checker.
+    storm::utility::parallel::forEachChunk(std::min<uint64_t>(checkers.size(), regionsToValidate.size()), static_cast<uint64_t>(0),
+                                           static_cast<uint64_t>(regionsToValidate.size()), [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+                                               for (uint64_t index = begin; index < end; ++index) {
+                                                   auto& regionResult = result[regionsToValidate[index]];
+                                                   regionResult.second =
+                                                       checkers[threadIndex]->validateRegion(env, regionResult.first, hypotheses[regionsToValidate[index]],
+                                                                                             regionResult.second, sampleVerticesOfRegion);
+                                               }
+                                           });
+
+    return std::make_unique<storm::modelchecker::RegionCheckResult<typename SparseModelType::ValueType>>(std::move(result));
+}
+
+template<typename SparseModelType, typename ImpreciseType, typename PreciseType>
+void ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::setValidationMargin(std::optional<double> const& margin) {
+    validationMargin = margin;
+}
+
+template<typename SparseModelType, typename ImpreciseType, typename PreciseType>
+bool ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::requiresValidation(RegionResult const& impreciseResult) const {
+    if (impreciseResult != RegionResult::AllSat && impreciseResult != RegionResult::AllViolated) {
+        return false;
+    }
+    if (!validationMargin) {
+        return true;
+    }
+    // A conclusive result stems from a check of the imprecise checker.
+    ImpreciseType const threshold = getImpreciseChecker().getCurrentCheckTask().getFormula().asOperatorFormula().template getThresholdAs<ImpreciseType>();
+    return storm::utility::abs<ImpreciseType>(getImpreciseChecker().getValueOfLastCheck() - threshold) <=
+           storm::utility::convertNumber<ImpreciseType>(validationMargin.value());
+}
+
+template<typename SparseModelType, typename ImpreciseType, typename PreciseType>
+RegionResult ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::validateRegion(
+    Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, RegionResultHypothesis const& hypothesis,
+    RegionResult const& impreciseResult, bool sampleVerticesOfRegion) {
+    RegionResult currentResult = impreciseResult;
 
     if (currentResult == RegionResult::AllSat || currentResult == RegionResult::AllViolated) {
+        if (!requiresValidation(currentResult)) {
+            ++numOfUnvalidatedRegions;
+            return currentResult;
+        }
         applyHintsToPreciseChecker();
 
         storm::solver::OptimizationDirection parameterOptDir = getPreciseChecker().getCurrentCheckTask().getOptimizationDirection();
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
 #include "storm-pars/modelchecker/region/SparseParameterLiftingModelChecker.h"
 #include "storm-pars/storage/ParameterRegion.h"
@@ -31,6 +33,22 @@ class ValidatingSparseParameterLiftingModelChecker : public RegionModelChecker<t
         std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>>
             localMonotonicityResult = nullptr) override;
 
+    /*!
+     * Analyzes the given regions. If refinement workers (validating model checkers of the same type) are set, the validation is deferred:
+     * All regions are first analyzed by means of the imprecise method. The results that need to be validated are then validated
+     * concurrently by this checker and the workers. Otherwise, the regions are analyzed one after another.
+     */
+    virtual std::unique_ptr<storm::modelchecker::RegionCheckResult<typename SparseModelType::ValueType>> analyzeRegions(
+        Environment const& env, std::vector<storm::storage::ParameterRegion<typename SparseModelType::ValueType>> const& regions,
+        std::vector<RegionResultHypothesis> const& hypotheses, bool sampleVerticesOfRegion = false) override;
+
+    /*!
+     * Sets a margin such that an imprecise result is not validated if the imprecise value at the initial state differs from the threshold by more than the
+     * (absolute) margin. Note that this is only sound if the error of the imprecise method is below the margin, which is not guaranteed.
+     * @param margin If not given, every result is validated.
+     */
+    void setValidationMargin(std::optional<double> const& margin);
+
    protected:
     virtual SparseParameterLiftingModelChecker<SparseModelType, ImpreciseType>& getImpreciseChecker() = 0;
     virtual SparseParameterLiftingModelChecker<SparseModelType, ImpreciseType> const& getImpreciseChecker() const = 0;
@@ -40,8 +58,18 @@ class ValidatingSparseParameterLiftingModelChecker : public RegionModelChecker<t
     virtual void applyHintsToPreciseChecker() = 0;
 
    private:
+    // Returns true if the given result of the imprecise method needs to be validated, i.e., it is conclusive and its margin is not sufficient.
+    bool requiresValidation(RegionResult const& impreciseResult) const;
+
+    // Validates the given result of the imprecise method and samples the vertices of the region, if requested and the result is inconclusive.
+    RegionResult validateRegion(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region,
+                                RegionResultHypothesis const& hypothesis, RegionResult const& impreciseResult, bool sampleVerticesOfRegion);
+
+    std::optional<double> validationMargin;
+
     // Information for statistics
     uint_fast64_t numOfWrongRegions;
+    uint_fast64_t numOfUnvalidatedRegions;
 };
 }  // namespace modelchecker
 }  // namespace storm
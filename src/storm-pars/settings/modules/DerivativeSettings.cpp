@@ -4,6 +4,7 @@
 #include "storm-pars/derivative/GradientDescentMethod.h"
 #include "storm/settings/Argument.h"
 #include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/ArgumentValidators.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
 
@@ -27,6 +28,7 @@ const std::string DerivativeSettings::printJson = "print-json";
 const std::string DerivativeSettings::gradientDescentMethod = "descent-method";
 const std::string DerivativeSettings::omitInconsequentialParams = "omit-inconsequential-params";
 const std::string DerivativeSettings::constraintMethod = "constraint-method";
+const std::string DerivativeSettings::numberOfThreads = "threads";
 
 DerivativeSettings::DerivativeSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, feasibleInstantiationSearch, false,
@@ -84,6 +86,14 @@ DerivativeSettings::DerivativeSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("project-gradient")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreads, false,
+                                                   "Sets the number of threads, each of which performs gradient descent from a different starting point.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 bool DerivativeSettings::isFeasibleInstantiationSearchSet() const {
@@ -139,6 +149,10 @@ std::string DerivativeSettings::getConstraintMethodAsString() const {
     return this->getOption(constraintMethod).getArgumentByName(constraintMethod).getValueAsString();
 }
 
+uint64_t DerivativeSettings::getNumberOfThreads() const {
+    return this->getOption(numberOfThreads).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 boost::optional<derivative::GradientDescentMethod> DerivativeSettings::methodFromString(const std::string &str) const {
     derivative::GradientDescentMethod method;
     if (str == "adam") {
@@ -87,6 +87,11 @@ class DerivativeSettings : public ModuleSettings {
      */
     bool areInconsequentialParametersOmitted() const;
 
+    /*!
+     * Retrieves the number of threads that perform gradient descent from different starting points.
+     */
+    uint64_t getNumberOfThreads() const;
+
     const static std::string moduleName;
 
    private:
@@ -103,6 +108,7 @@ class DerivativeSettings : public ModuleSettings {
     const static std::string gradientDescentMethod;
     const static std::string omitInconsequentialParams;
     const static std::string constraintMethod;
+    const static std::string numberOfThreads;
     boost::optional<derivative::GradientDescentMethod> methodFromString(const std::string &str) const;
     boost::optional<derivative::GradientDescentConstraintMethod> constraintMethodFromString(const std::string &str) const;
 };
@@ -23,6 +23,7 @@ const std::string MonotonicitySettings::monSolutionShortName = "msf";
 const std::string MonotonicitySettings::monotonicityThreshold = "depth";
 
 const std::string MonotonicitySettings::monotoneParameters = "parameters";
+const std::string MonotonicitySettings::numberOfThreads = "threads";
 
 MonotonicitySettings::MonotonicitySettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, usePLABounds, true, "Sets whether pla bounds should be used for monotonicity analysis")
@@ -70,6 +71,14 @@ MonotonicitySettings::MonotonicitySettings() : ModuleSettings(moduleName) {
             .addArgument(
                 storm::settings::ArgumentBuilder::createStringArgument("monotoneParametersFilename", "The file where the monotone parameters are set").build())
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreads, true,
+                                                   "Sets the number of threads that check assumptions and samples in the monotonicity analysis concurrently.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 bool MonotonicitySettings::isUsePLABoundsSet() const {
@@ -112,6 +121,10 @@ uint_fast64_t MonotonicitySettings::getMonotonicityThreshold() const {
     return this->getOption(monotonicityThreshold).getArgumentByName("depth").getValueAsUnsignedInteger();
 }
 
+uint64_t MonotonicitySettings::getNumberOfThreads() const {
+    return this->getOption(numberOfThreads).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool MonotonicitySettings::isMonSolutionSet() const {
     return this->getOption(monSolution).getHasOptionBeenSet();
 }
@@ -60,6 +60,11 @@ class MonotonicitySettings : public ModuleSettings {
      */
     uint64_t getMonotonicityThreshold() const;
 
+    /*!
+     * Retrieves the number of threads that check assumptions and samples in the monotonicity analysis concurrently
+     */
+    uint64_t getNumberOfThreads() const;
+
     const static std::string moduleName;
 
    private:
@@ -72,6 +77,7 @@ class MonotonicitySettings : public ModuleSettings {
     const static std::string monotoneParameters;
     const static std::string monSolution;
     const static std::string monSolutionShortName;
+    const static std::string numberOfThreads;
 };
 
 }  // namespace modules
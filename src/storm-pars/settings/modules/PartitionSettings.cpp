@@ -13,6 +13,7 @@ const std::string PartitionSettings::moduleName = "partitioning";
 const std::string requestedCoverageOptionName = "terminationCondition";
 const std::string printNoIllustrationOptionName = "noillustration";
 const std::string printFullResultOptionName = "printfullresult";
+const std::string refinementThreadsOptionName = "refinement-threads";
 
 PartitionSettings::PartitionSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, requestedCoverageOptionName, false, "The requested coverage")
@@ -31,6 +32,13 @@ PartitionSettings::PartitionSettings() : ModuleSettings(moduleName) {
         storm::settings::OptionBuilder(moduleName, printNoIllustrationOptionName, false, "If set, no illustration of the result is printed.").build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, printFullResultOptionName, false, "If set, the full result for every region is printed.").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, refinementThreadsOptionName, true,
+                                                   "Sets the number of threads that analyze regions concurrently during refinement (without monotonicity).")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 double PartitionSettings::getCoverageThreshold() const {
@@ -50,6 +58,10 @@ bool PartitionSettings::isPrintFullResultSet() const {
     return this->getOption(printFullResultOptionName).getHasOptionBeenSet();
 }
 
+uint64_t PartitionSettings::getRefinementThreads() const {
+    return this->getOption(refinementThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 uint64_t PartitionSettings::getDepthLimit() const {
     int64_t depth = this->getOption(requestedCoverageOptionName).getArgumentByName("depth-limit").getValueAsInteger();
     STORM_LOG_THROW(depth >= 0, storm::exceptions::InvalidOperationException, "Tried to retrieve the depth limit but it was not set.");
@@ -36,6 +36,11 @@ class PartitionSettings : public ModuleSettings {
      */
     bool isPrintFullResultSet() const;
 
+    /*!
+     * Retrieves the number of threads that analyze regions concurrently during refinement.
+     */
+    uint64_t getRefinementThreads() const;
+
     const static std::string moduleName;
 };
 }  // namespace storm::settings::modules
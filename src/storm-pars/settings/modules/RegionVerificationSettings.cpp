@@ -11,6 +11,7 @@ namespace storm::settings::modules {
 const std::string RegionVerificationSettings::moduleName = "regionverif";
 const std::string splittingThresholdName = "splitting-threshold";
 const std::string checkEngineOptionName = "engine";
+const std::string validationMarginOptionName = "validation-margin";
 
 RegionVerificationSettings::RegionVerificationSettings() : ModuleSettings(moduleName) {
     this->addOption(
@@ -26,6 +27,14 @@ RegionVerificationSettings::RegionVerificationSettings() : ModuleSettings(module
                                          .setDefaultValueString("pl")
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, validationMarginOptionName, true,
+                                                   "If set, the validating engine does not validate results whose value differs from the threshold by "
+                                                   "more than the given margin. This is unsound.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("margin", "The margin.")
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterEqualValidator(0.0))
+                                         .build())
+                        .build());
 }
 
 int RegionVerificationSettings::getSplittingThreshold() const {
@@ -53,4 +62,12 @@ storm::modelchecker::RegionCheckEngine RegionVerificationSettings::getRegionChec
     return result;
 }
 
+bool RegionVerificationSettings::isValidationMarginSet() const {
+    return this->getOption(validationMarginOptionName).getHasOptionBeenSet();
+}
+
+double RegionVerificationSettings::getValidationMargin() const {
+    return this->getOption(validationMarginOptionName).getArgumentByName("margin").getValueAsDouble();
+}
+
 }  // namespace storm::settings::modules
@@ -18,6 +18,16 @@ class RegionVerificationSettings : public ModuleSettings {
      */
     storm::modelchecker::RegionCheckEngine getRegionCheckEngine() const;
 
+    /*!
+     * Retrieves whether a margin was set such that imprecise results of the validating engine are only validated if they are closer to the threshold.
+     */
+    bool isValidationMarginSet() const;
+
+    /*!
+     * Retrieves the margin of the validating engine. Imprecise results with a larger margin are not validated, which is unsound.
+     */
+    double getValidationMargin() const;
+
     const static std::string moduleName;
 };
 
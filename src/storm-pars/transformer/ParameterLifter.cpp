@@ -1,5 +1,9 @@
 #include "storm-pars/transformer/ParameterLifter.h"
 
+#include <algorithm>
+#include <map>
+#include <type_traits>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnexpectedException.h"
@@ -349,10 +353,36 @@ ConstantType& ParameterLifter<ParametricType, ConstantType>::FunctionValuationCo
 template<typename ParametricType, typename ConstantType>
 void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(
     storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+    if (std::is_same<ConstantType, double>::value) {
+        evaluateCompiledFunctions(region, dirForUnspecifiedParameters);
+        return;
+    }
+    // Find the parameters whose bounds changed since the previous evaluation.
+    bool const evaluateAll = !previousRegion || previousRegion->getVariables() != region.getVariables();
+    bool const directionChanged = !previousDirection || previousDirection.value() != dirForUnspecifiedParameters;
+    std::set<VariableType> changedVariables;
+    if (!evaluateAll) {
+        for (auto const& variable : region.getVariables()) {
+            if (region.getLowerBoundary(variable) != previousRegion->getLowerBoundary(variable) ||
+                region.getUpperBoundary(variable) != previousRegion->getUpperBoundary(variable)) {
+                changedVariables.insert(variable);
+            }
+        }
+    }
+    auto dependsOnChangedVariable = [&changedVariables](std::set<VariableType> const& variables) {
+        return std::any_of(variables.begin(), variables.end(), [&changedVariables](VariableType const& v) { return changedVariables.count(v) > 0; });
+    };
+
     for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
         ParametricType const& function = collectedFunctionValuationPlaceholder.first.first;
         AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
         ConstantType& placeholder = collectedFunctionValuationPlaceholder.second;
+        if (!evaluateAll && !(directionChanged && !abstrValuation.getUnspecifiedParameters().empty()) &&
+            !dependsOnChangedVariable(abstrValuation.getLowerParameters()) && !dependsOnChangedVariable(abstrValuation.getUpperParameters()) &&
+            !dependsOnChangedVariable(abstrValuation.getUnspecifiedParameters())) {
+            // The placeholder still holds the result for this region.
+            continue;
+        }
         auto concreteValuations = abstrValuation.getConcreteValuations(region);
         auto concreteValuationIt = concreteValuations.begin();
         placeholder = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
@@ -365,6 +395,113 @@ void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::
             }
         }
     }
+    previousRegion = region;
+    previousDirection = dirForUnspecifiedParameters;
+}
+
+template<typename ParametricType, typename ConstantType>
+void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::compileCollectedFunctions() {
+    compiledFunctions.clear();
+    compiledVariables.clear();
+    compiledFunctionsOfVariable.clear();
+    compiledFunctionsWithUnspecifiedParameters.clear();
+    // The placeholders are evaluated from scratch after compilation.
+    previousLowerBounds.clear();
+    previousUpperBounds.clear();
+    previousDirection = std::nullopt;
+    std::map<VariableType, uint64_t> variableToIndex;
+    auto getIndex = [&](VariableType const& variable) {
+        auto insertionRes = variableToIndex.emplace(variable, compiledVariables.size());
+        if (insertionRes.second) {
+            compiledVariables.push_back(variable);
+            compiledFunctionsOfVariable.emplace_back();
+        }
+        return insertionRes.first->second;
+    };
+    compiledFunctions.reserve(collectedFunctions.size());
+    for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
+        AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
+        std::vector<VariableType> localVariables;
+        std::vector<uint64_t> variableIndices;
+        for (auto const* parameters :
+             {&abstrValuation.getLowerParameters(), &abstrValuation.getUpperParameters(), &abstrValuation.getUnspecifiedParameters()}) {
+            for (auto const& variable : *parameters) {
+                localVariables.push_back(variable);
+                variableIndices.push_back(getIndex(variable));
+                compiledFunctionsOfVariable[variableIndices.back()].push_back(compiledFunctions.size());
+            }
+        }
+        if (!abstrValuation.getUnspecifiedParameters().empty()) {
+            compiledFunctionsWithUnspecifiedParameters.push_back(compiledFunctions.size());
+        }
+        compiledFunctions.push_back(CompiledFunctionValuation{
+            storm::utility::parametric::CompiledRationalFunction(collectedFunctionValuationPlaceholder.first.first, localVariables), std::move(variableIndices),
+            abstrValuation.getLowerParameters().size(), abstrValuation.getUpperParameters().size(), &collectedFunctionValuationPlaceholder.second});
+    }
+}
+
+template<typename ParametricType, typename ConstantType>
+void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCompiledFunctions(
+    storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+    if (compiledFunctions.size() != collectedFunctions.size()) {
+        compileCollectedFunctions();
+    }
+    std::vector<double> lowerBounds, upperBounds;
+    lowerBounds.reserve(compiledVariables.size());
+    upperBounds.reserve(compiledVariables.size());
+    for (auto const& variable : compiledVariables) {
+        lowerBounds.push_back(storm::utility::convertNumber<double>(region.getLowerBoundary(variable)));
+        upperBounds.push_back(storm::utility::convertNumber<double>(region.getUpperBoundary(variable)));
+    }
+
+    // Find the functions that depend on a parameter whose bounds changed since the previous evaluation.
+    storm::storage::BitVector functionsToEvaluate(compiledFunctions.size(), !previousDirection.has_value());
+    if (previousDirection) {
+        for (uint64_t variable = 0; variable < compiledVariables.size(); ++variable) {
+            if (lowerBounds[variable] != previousLowerBounds[variable] || upperBounds[variable] != previousUpperBounds[variable]) {
+                for (auto const& function : compiledFunctionsOfVariable[variable]) {
+                    functionsToEvaluate.set(function, true);
+                }
+            }
+        }
+        if (previousDirection.value() != dirForUnspecifiedParameters) {
+            for (auto const& function : compiledFunctionsWithUnspecifiedParameters) {
+                functionsToEvaluate.set(function, true);
+            }
+        }
+    }
+
+    std::vector<double> values;
+    for (auto const functionIndex : functionsToEvaluate) {
+        auto const& compiledFunction = compiledFunctions[functionIndex];
+        uint64_t const numberOfFixedParameters = compiledFunction.numberOfLowerParameters + compiledFunction.numberOfUpperParameters;
+        uint64_t const numberOfUnspecifiedParameters = compiledFunction.variables.size() - numberOfFixedParameters;
+        values.resize(compiledFunction.variables.size());
+        for (uint64_t index = 0; index < numberOfFixedParameters; ++index) {
+            uint64_t variable = compiledFunction.variables[index];
+            values[index] = index < compiledFunction.numberOfLowerParameters ? lowerBounds[variable] : upperBounds[variable];
+        }
+        // Each bit of the vertex decides whether the corresponding unspecified parameter is set to its lower or upper bound.
+        double result = 0.0;
+        for (uint64_t vertex = 0; vertex < (1ull << numberOfUnspecifiedParameters); ++vertex) {
+            for (uint64_t unspecified = 0; unspecified < numberOfUnspecifiedParameters; ++unspecified) {
+                uint64_t variable = compiledFunction.variables[numberOfFixedParameters + unspecified];
+                values[numberOfFixedParameters + unspecified] = ((vertex >> unspecified) & 1) ? upperBounds[variable] : lowerBounds[variable];
+            }
+            double currentResult = compiledFunction.function.evaluate(values);
+            if (vertex == 0) {
+                result = currentResult;
+            } else if (storm::solver::minimize(dirForUnspecifiedParameters)) {
+                result = std::min(result, currentResult);
+            } else {
+                result = std::max(result, currentResult);
+            }
+        }
+        *compiledFunction.placeholder = storm::utility::convertNumber<ConstantType>(result);
+    }
+    previousLowerBounds = std::move(lowerBounds);
+    previousUpperBounds = std::move(upperBounds);
+    previousDirection = dirForUnspecifiedParameters;
 }
 
 template class ParameterLifter<storm::RationalFunction, double>;
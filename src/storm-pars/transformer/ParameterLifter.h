@@ -1,12 +1,14 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <set>
 #include <unordered_map>
 #include <vector>
 
 #include "storm-pars/analysis/Order.h"
 #include "storm-pars/storage/ParameterRegion.h"
+#include "storm-pars/utility/CompiledRationalFunction.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/storage/BitVector.h"
@@ -138,6 +140,11 @@ class ParameterLifter {
          */
         ConstantType& add(ParametricType const& function, AbstractValuation const& valuation);
 
+        /*!
+         * Evaluates the collected functions w.r.t. the given region and writes the results into the placeholders.
+         * Only the functions that depend on a parameter whose bounds changed since the previous call are evaluated again (as well as those with
+         * unspecified parameters if the direction changed). This makes specifying the child regions of a split region cheap.
+         */
         void evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region,
                                         storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
 
@@ -157,6 +164,31 @@ class ParameterLifter {
 
         // Stores the collected functions with the valuations together with a placeholder for the result.
         std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+
+        // For floating point results, the collected functions are compiled once and then evaluated without carl's polynomial arithmetic.
+        struct CompiledFunctionValuation {
+            storm::utility::parametric::CompiledRationalFunction function;
+            // The indices (wrt. compiledVariables) of the lower, the upper and the unspecified parameters of the valuation (in this order).
+            std::vector<uint64_t> variables;
+            uint64_t numberOfLowerParameters;
+            uint64_t numberOfUpperParameters;
+            ConstantType* placeholder;
+        };
+
+        void compileCollectedFunctions();
+        void evaluateCompiledFunctions(storm::storage::ParameterRegion<ParametricType> const& region,
+                                       storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
+
+        std::vector<CompiledFunctionValuation> compiledFunctions;
+        std::vector<VariableType> compiledVariables;
+        // For every compiled variable the indices of the compiled functions that depend on it, and the indices of the functions with unspecified parameters.
+        std::vector<std::vector<uint64_t>> compiledFunctionsOfVariable;
+        std::vector<uint64_t> compiledFunctionsWithUnspecifiedParameters;
+
+        // The region (or the bounds of the compiled variables) and the direction of the previous evaluation (if any).
+        std::optional<storm::storage::ParameterRegion<ParametricType>> previousRegion;
+        std::vector<double> previousLowerBounds, previousUpperBounds;
+        std::optional<storm::solver::OptimizationDirection> previousDirection;
     };
 
     FunctionValuationCollector functionValuationCollector;
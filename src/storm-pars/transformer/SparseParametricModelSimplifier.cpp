@@ -5,7 +5,10 @@
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/EliminationSettings.h"
 #include "storm/solver/stateelimination/NondeterministicModelStateEliminator.h"
+#include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
 #include "storm/storage/FlexibleSparseMatrix.h"
 #include "storm/utility/vector.h"
 
@@ -134,10 +137,21 @@ std::shared_ptr<SparseModelType> SparseParametricModelSimplifier<SparseModelType
     // invoke elimination and obtain resulting transition matrix
     storm::storage::FlexibleSparseMatrix<typename SparseModelType::ValueType> flexibleMatrix(sparseMatrix);
     storm::storage::FlexibleSparseMatrix<typename SparseModelType::ValueType> flexibleBackwardTransitions(sparseMatrix.transpose(), true);
-    storm::solver::stateelimination::NondeterministicModelStateEliminator<typename SparseModelType::ValueType> stateEliminator(
-        flexibleMatrix, flexibleBackwardTransitions, actionRewards);
-    for (auto state : selectedStates) {
-        stateEliminator.eliminateState(state, true);
+    uint64_t numberOfThreads = storm::settings::hasModule<storm::settings::modules::EliminationSettings>()
+                                   ? storm::settings::getModule<storm::settings::modules::EliminationSettings>().getNumberOfThreads()
+                                   : 1;
+    if (numberOfThreads > 1 && sparseMatrix.hasTrivialRowGrouping()) {
+        // Without nondeterminism, the row values are state values. States with disjoint neighbourhoods are then eliminated concurrently.
+        std::vector<storm::storage::sparse::state_type> statesToEliminate(selectedStates.begin(), selectedStates.end());
+        storm::solver::stateelimination::PrioritizedStateEliminator<typename SparseModelType::ValueType> stateEliminator(
+            flexibleMatrix, flexibleBackwardTransitions, statesToEliminate, actionRewards);
+        stateEliminator.eliminateAllInParallel(numberOfThreads, [](storm::storage::sparse::state_type) { return true; });
+    } else {
+        storm::solver::stateelimination::NondeterministicModelStateEliminator<typename SparseModelType::ValueType> stateEliminator(
+            flexibleMatrix, flexibleBackwardTransitions, actionRewards);
+        for (auto state : selectedStates) {
+            stateEliminator.eliminateState(state, true);
+        }
     }
     selectedStates.complement();
     auto keptRows = sparseMatrix.getRowFilter(selectedStates);
@@ -11,6 +11,7 @@
 #include <set>
 #include <stack>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "adapters/RationalFunctionAdapter.h"
 #include "adapters/RationalNumberAdapter.h"
@@ -77,27 +78,16 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
     std::map<RationalFunctionVariable, std::map<uint64_t, std::set<uint64_t>>> treeStates;
     std::map<RationalFunctionVariable, std::set<uint64_t>> workingSets;
 
-    auto backwardsTransitions = flexibleMatrix.createSparseMatrix().transpose(true);
     // Count number of parameter occurences per state
     for (uint64_t row = 0; row < flexibleMatrix.getRowCount(); row++) {
         for (auto const& entry : flexibleMatrix.getRow(row)) {
             if (entry.getValue().isConstant()) {
                 continue;
             }
-            STORM_LOG_ERROR_COND(entry.getValue().gatherVariables().size() == 1, "Flip minimization only supports transitions with a single parameter.");
-            auto parameter = *entry.getValue().gatherVariables().begin();
-            auto cache = entry.getValue().nominatorAsPolynomial().pCache();
-            STORM_LOG_ERROR_COND(entry.getValue().denominator().isOne() && entry.getValue().nominator().isUnivariate() &&
-                                     entry.getValue().nominator().getSingleVariable() == parameter && entry.getValue().nominator().factorization().size() == 1,
-                                 "Flip minimization only supports simple pMCs.");
+            auto parameter = getParametricTransition(entry.getValue()).parameter;
             STORM_LOG_ERROR_COND(flexibleMatrix.getRow(row).size() == 2, "Flip minimization only supports transitions with a single parameter.");
             workingSets[parameter].emplace(row);
             treeStates[parameter][row].emplace(row);
-            if (utility::isOne(entry.getValue().derivative(entry.getValue().nominator().getSingleVariable()))) {
-            } else if (utility::isOne(-entry.getValue().derivative(entry.getValue().nominator().getSingleVariable()))) {
-            } else {
-                STORM_LOG_ERROR_COND(false, "Flip minimization only supports transitions with a single parameter.");
-            }
         }
     }
 
@@ -189,24 +179,16 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
                         break;
                     }
 
-                    STORM_LOG_ERROR_COND(entry2.getValue().gatherVariables().size() == 1,
-                                         "Flip minimization only supports transitions with a single parameter.");
-                    parameterOfSuccessor = *entry2.getValue().gatherVariables().begin();
-                    auto cache = entry2.getValue().nominatorAsPolynomial().pCache();
-                    STORM_LOG_ERROR_COND(entry2.getValue().denominator().isOne() && entry2.getValue().nominator().isUnivariate() &&
-                                             entry2.getValue().nominator().getSingleVariable() == parameterOfSuccessor &&
-                                             entry2.getValue().nominator().factorization().size() == 1,
-                                         "Flip minimization only supports simple pMCs.");
+                    auto const& parametricTransition = getParametricTransition(entry2.getValue());
+                    parameterOfSuccessor = parametricTransition.parameter;
                     STORM_LOG_ERROR_COND(flexibleMatrix.getRow(entry.getColumn()).size() == 2,
                                          "Flip minimization only supports transitions with a single parameter.");
-                    if (utility::isOne(entry2.getValue().derivative(entry2.getValue().nominator().getSingleVariable()))) {
+                    if (parametricTransition.type == ParametricTransition::Type::Parameter) {
                         pRationalFunctions[parameterOfSuccessor] = entry2.getValue();
                         pTransitions[entry.getColumn()] = entry2.getColumn();
-                    } else if (utility::isOne(-entry2.getValue().derivative(entry2.getValue().nominator().getSingleVariable()))) {
+                    } else if (parametricTransition.type == ParametricTransition::Type::OneMinusParameter) {
                         oneMinusPRationalFunctions[parameterOfSuccessor] = entry2.getValue();
                         oneMinusPTransitions[entry.getColumn()] = entry2.getColumn();
-                    } else {
-                        STORM_LOG_ERROR_COND(false, "Flip minimization only supports transitions with a single parameter.");
                     }
                 }
                 parameterBuckets[parameterOfSuccessor].emplace(entry.getColumn());
@@ -214,7 +196,7 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
                 directProbs[entry.getColumn()] = entry.getValue();
             }
 
-            // TODO slow could be done better if flexible matrix had ability to add states
+            // The rows are moved to the enlarged matrix, which replaces the old one below.
             uint64_t newMatrixSize = flexibleMatrix.getRowCount() + 3 * parameterBuckets.size();
             if (parameterBuckets.count(constantVariable)) {
                 newMatrixSize -= 2;
@@ -222,7 +204,7 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
             storage::SparseMatrixBuilder<RationalFunction> builder;
             storage::FlexibleSparseMatrix<RationalFunction> matrixWithAdditionalStates(builder.build(newMatrixSize, newMatrixSize, 0));
             for (uint64_t row = 0; row < flexibleMatrix.getRowCount(); row++) {
-                matrixWithAdditionalStates.getRow(row) = flexibleMatrix.getRow(row);
+                matrixWithAdditionalStates.getRow(row) = std::move(flexibleMatrix.getRow(row));
             }
 
             workingSets.clear();
@@ -312,12 +294,11 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
                     stateRewardVector->push_back(storm::utility::zero<RationalFunction>());
                 }
             }
-            runningLabeling = nextNewLabels;
+            runningLabeling = std::move(nextNewLabels);
 
             updateTreeStates(treeStates, workingSets, matrixWithAdditionalStates, allParameters, stateRewardVector, runningLabeling, labelsInFormula);
 
-            flexibleMatrix = matrixWithAdditionalStates;
-            backwardsTransitions = flexibleMatrix.createSparseMatrix().transpose(true);
+            flexibleMatrix = std::move(matrixWithAdditionalStates);
         }
     }
 
@@ -399,32 +380,26 @@ std::vector<storm::storage::MatrixEntry<uint64_t, RationalFunction>> TimeTravell
 }
 
 models::sparse::StateLabeling TimeTravelling::extendStateLabeling(models::sparse::StateLabeling const& oldLabeling, uint64_t oldSize, uint64_t newSize,
-                                                                  uint64_t stateWithLabels, const std::set<std::string> labelsInFormula) {
+                                                                  uint64_t stateWithLabels, const std::set<std::string>& labelsInFormula) {
     models::sparse::StateLabeling newLabels(newSize);
     for (auto const& label : oldLabeling.getLabels()) {
-        newLabels.addLabel(label);
-    }
-    for (uint64_t state = 0; state < oldSize; state++) {
-        for (auto const& label : oldLabeling.getLabelsOfState(state)) {
-            newLabels.addLabelToState(label, state);
-        }
-    }
-    for (uint64_t i = oldSize; i < newSize; i++) {
+        storage::BitVector statesWithLabel = oldLabeling.getStates(label);
+        statesWithLabel.resize(newSize, false);
         // We assume that everything that we time-travel has the same labels for now.
-        for (auto const& label : oldLabeling.getLabelsOfState(stateWithLabels)) {
-            if (labelsInFormula.count(label)) {
-                newLabels.addLabelToState(label, i);
+        if (labelsInFormula.count(label) && statesWithLabel.get(stateWithLabels)) {
+            for (uint64_t i = oldSize; i < newSize; i++) {
+                statesWithLabel.set(i, true);
             }
         }
+        newLabels.addLabel(label, std::move(statesWithLabel));
     }
     return newLabels;
 }
 
-bool labelsIntersectedEqual(const std::set<std::string>& labels1, const std::set<std::string>& labels2, const std::set<std::string>& intersection) {
+bool labelsIntersectedEqual(const models::sparse::StateLabeling& stateLabeling, uint64_t state1, uint64_t state2,
+                            const std::set<std::string>& intersection) {
     for (auto const& label : intersection) {
-        bool set1ContainsLabel = labels1.count(label) > 0;
-        bool set2ContainsLabel = labels2.count(label) > 0;
-        if (set1ContainsLabel != set2ContainsLabel) {
+        if (stateLabeling.containsLabel(label) && stateLabeling.getStateHasLabel(label, state1) != stateLabeling.getStateHasLabel(label, state2)) {
             return false;
         }
     }
@@ -435,7 +410,7 @@ void TimeTravelling::updateTreeStates(std::map<RationalFunctionVariable, std::ma
                                       std::map<RationalFunctionVariable, std::set<uint64_t>>& workingSets,
                                       storage::FlexibleSparseMatrix<RationalFunction>& flexibleMatrix, const std::set<carl::Variable>& allParameters,
                                       const boost::optional<std::vector<RationalFunction>>& stateRewardVector,
-                                      const models::sparse::StateLabeling stateLabeling, const std::set<std::string> labelsInFormula) {
+                                      const models::sparse::StateLabeling& stateLabeling, const std::set<std::string>& labelsInFormula) {
     auto backwardsTransitions = flexibleMatrix.createSparseMatrix().transpose(true);
     for (auto const& parameter : allParameters) {
         std::set<uint64_t> workingSet = workingSets[parameter];
@@ -447,7 +422,7 @@ void TimeTravelling::updateTreeStates(std::map<RationalFunctionVariable, std::ma
                 }
                 for (auto const& entry : backwardsTransitions.getRow(row)) {
                     if (entry.getValue().isConstant() &&
-                        labelsIntersectedEqual(stateLabeling.getLabelsOfState(entry.getColumn()), stateLabeling.getLabelsOfState(row), labelsInFormula)) {
+                        labelsIntersectedEqual(stateLabeling, entry.getColumn(), row, labelsInFormula)) {
                         // If the set of tree states at the current position is a subset of the set of
                         // tree states of the parent state, we've reached some loop. Then we can stop.
                         bool isSubset = true;
@@ -477,7 +452,7 @@ bool TimeTravelling::collapseConstantTransitions(uint64_t state, storage::Flexib
                                                  const std::map<RationalFunctionVariable, std::map<uint64_t, std::set<uint64_t>>>& treeStates,
                                                  const std::set<carl::Variable>& allParameters,
                                                  const boost::optional<std::vector<RationalFunction>>& stateRewardVector,
-                                                 const models::sparse::StateLabeling stateLabeling, const std::set<std::string> labelsInFormula) {
+                                                 const models::sparse::StateLabeling& stateLabeling, const std::set<std::string>& labelsInFormula) {
     auto copiedRow = matrix.getRow(state);
     bool firstIteration = true;
     for (auto const& entry : copiedRow) {
@@ -493,7 +468,7 @@ bool TimeTravelling::collapseConstantTransitions(uint64_t state, storage::Flexib
         bool continueConvertingHere;
         if (stateRewardVector && !stateRewardVector->at(entry.getColumn()).isZero()) {
             continueConvertingHere = false;
-        } else if (!labelsIntersectedEqual(stateLabeling.getLabelsOfState(state), stateLabeling.getLabelsOfState(nextState), labelsInFormula)) {
+        } else if (!labelsIntersectedEqual(stateLabeling, state, nextState, labelsInFormula)) {
             continueConvertingHere = false;
         } else {
             if (alreadyVisited.count(nextState)) {
@@ -512,10 +487,9 @@ bool TimeTravelling::collapseConstantTransitions(uint64_t state, storage::Flexib
         }
         if (continueConvertingHere) {
             for (auto const& successor : matrix.getRow(nextState)) {
-                RationalFunction succProbability = successor.getValue();
-                storm::storage::MatrixEntry<uint64_t, RationalFunction> newEntry(successor.getColumn(), probability * succProbability);
-                STORM_LOG_INFO("JipConvert: " << state << " -> " << successor.getColumn() << " w/ " << probability * succProbability);
-                matrix.getRow(state).push_back(newEntry);
+                storm::storage::MatrixEntry<uint64_t, RationalFunction> newEntry(successor.getColumn(), probability * successor.getValue());
+                STORM_LOG_INFO("JipConvert: " << state << " -> " << successor.getColumn() << " w/ " << newEntry.getValue());
+                matrix.getRow(state).push_back(std::move(newEntry));
             }
         } else {
             matrix.getRow(state).push_back(entry);
@@ -529,6 +503,30 @@ bool TimeTravelling::collapseConstantTransitions(uint64_t state, storage::Flexib
     return true;
 }
 
+TimeTravelling::ParametricTransition const& TimeTravelling::getParametricTransition(RationalFunction const& probability) {
+    auto cached = parametricTransitionCache.find(probability);
+    if (cached != parametricTransitionCache.end()) {
+        return cached->second;
+    }
+    ParametricTransition result;
+    auto const variables = probability.gatherVariables();
+    STORM_LOG_ERROR_COND(variables.size() == 1, "Flip minimization only supports transitions with a single parameter.");
+    result.parameter = *variables.begin();
+    STORM_LOG_ERROR_COND(probability.denominator().isOne() && probability.nominator().isUnivariate() &&
+                             probability.nominator().getSingleVariable() == result.parameter && probability.nominator().factorization().size() == 1,
+                         "Flip minimization only supports simple pMCs.");
+    RationalFunction const derivative = probability.derivative(result.parameter);
+    if (utility::isOne(derivative)) {
+        result.type = ParametricTransition::Type::Parameter;
+    } else if (utility::isOne(-derivative)) {
+        result.type = ParametricTransition::Type::OneMinusParameter;
+    } else {
+        STORM_LOG_ERROR_COND(false, "Flip minimization only supports transitions with a single parameter.");
+        result.type = ParametricTransition::Type::Other;
+    }
+    return parametricTransitionCache.emplace(probability, result).first->second;
+}
+
 class TimeTravelling;
 }  // namespace transformer
 }  // namespace storm
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <set>
+#include <unordered_map>
 #include "adapters/RationalFunctionAdapter.h"
 #include "modelchecker/CheckTask.h"
 #include "models/sparse/Dtmc.h"
@@ -47,7 +48,7 @@ class TimeTravelling {
     void updateTreeStates(std::map<RationalFunctionVariable, std::map<uint64_t, std::set<uint64_t>>>& treeStates,
                           std::map<RationalFunctionVariable, std::set<uint64_t>>& workingSets, storage::FlexibleSparseMatrix<RationalFunction>& flexibleMatrix,
                           const std::set<carl::Variable>& allParameters, const boost::optional<std::vector<RationalFunction>>& stateRewardVector,
-                          const models::sparse::StateLabeling stateLabelling, const std::set<std::string> labelsInFormula);
+                          const models::sparse::StateLabeling& stateLabelling, const std::set<std::string>& labelsInFormula);
 
     /**
      * extendStateLabeling extends the given state labeling to newly created states. It will set the new labels to the labels on the given state.
@@ -60,7 +61,7 @@ class TimeTravelling {
      * @return models::sparse::StateLabeling
      */
     models::sparse::StateLabeling extendStateLabeling(models::sparse::StateLabeling const& oldLabeling, uint64_t oldSize, uint64_t newSize,
-                                                      uint64_t stateWithLabels, const std::set<std::string> labelsInFormula);
+                                                      uint64_t stateWithLabels, const std::set<std::string>& labelsInFormula);
     /**
      * Sums duplicate transitions in a vector of MatrixEntries into one MatrixEntry.
      *
@@ -87,7 +88,27 @@ class TimeTravelling {
     bool collapseConstantTransitions(uint64_t state, storage::FlexibleSparseMatrix<RationalFunction>& matrix, std::map<uint64_t, bool>& alreadyVisited,
                                      const std::map<RationalFunctionVariable, std::map<uint64_t, std::set<uint64_t>>>& treeStates,
                                      const std::set<carl::Variable>& allParameters, const boost::optional<std::vector<RationalFunction>>& stateRewardVector,
-                                     const models::sparse::StateLabeling stateLabelling, const std::set<std::string> labelsInFormula);
+                                     const models::sparse::StateLabeling& stateLabelling, const std::set<std::string>& labelsInFormula);
+
+    /**
+     * The parameter of a parametric transition of a simple pMC and whether its probability is p or 1-p.
+     */
+    struct ParametricTransition {
+        enum class Type { Parameter, OneMinusParameter, Other };
+        RationalFunctionVariable parameter;
+        Type type;
+    };
+
+    /**
+     * Analyzes the given (non-constant) probability of a simple pMC. As such a pMC only has the probabilities p and 1-p for every parameter p, the
+     * analysis is done once per distinct rational function and looked up afterwards.
+     *
+     * @param probability The probability of the transition.
+     * @return ParametricTransition The (cached) analysis result.
+     */
+    ParametricTransition const& getParametricTransition(RationalFunction const& probability);
+
+    std::unordered_map<RationalFunction, ParametricTransition> parametricTransitionCache;
 };
 
 }  // namespace transformer
@@ -0,0 +1,70 @@
+#include "storm-pars/utility/CompiledRationalFunction.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+namespace parametric {
+
+CompiledRationalFunction::CompiledRationalFunction(storm::RationalFunction const& function, std::vector<storm::RationalFunctionVariable> const& variables) {
+    auto one = storm::utility::one<storm::RationalFunctionCoefficient>();
+    hasConstantDenominator = function.denominator().isConstant();
+    if (hasConstantDenominator) {
+        // Dividing the coefficients by the denominator before rounding them to doubles avoids one rounding error.
+        numerator = compile(function.nominatorAsPolynomial().polynomialWithCoefficient(), one / function.denominator().constantPart(), variables);
+    } else {
+        numerator = compile(function.nominatorAsPolynomial().polynomialWithCoefficient(), one, variables);
+        denominator = compile(function.denominatorAsPolynomial().polynomialWithCoefficient(), one, variables);
+    }
+}
+
+CompiledRationalFunction::CompiledPolynomial CompiledRationalFunction::compile(storm::RawPolynomial const& polynomial,
+                                                                               storm::RationalFunctionCoefficient const& factor,
+                                                                               std::vector<storm::RationalFunctionVariable> const& variables) {
+    CompiledPolynomial result;
+    for (auto const& term : polynomial) {
+        result.termStarts.push_back(result.factors.size());
+        result.coefficients.push_back(storm::utility::convertNumber<double>(storm::RationalFunctionCoefficient(term.coeff() * factor)));
+        if (term.monomial()) {
+            for (auto const& variableExponent : *term.monomial()) {
+                auto variableIt = std::find(variables.begin(), variables.end(), variableExponent.first);
+                STORM_LOG_THROW(variableIt != variables.end(), storm::exceptions::InvalidArgumentException,
+                                "Variable " << variableExponent.first << " of the function has not been declared.");
+                result.factors.emplace_back(std::distance(variables.begin(), variableIt), variableExponent.second);
+            }
+        }
+    }
+    result.termStarts.push_back(result.factors.size());
+    return result;
+}
+
+double CompiledRationalFunction::evaluate(CompiledPolynomial const& polynomial, std::vector<double> const& variableValues) {
+    double result = 0.0;
+    for (uint64_t term = 0; term < polynomial.coefficients.size(); ++term) {
+        double termValue = polynomial.coefficients[term];
+        for (uint64_t factor = polynomial.termStarts[term]; factor < polynomial.termStarts[term + 1]; ++factor) {
+            double const base = variableValues[polynomial.factors[factor].first];
+            for (uint64_t exponent = polynomial.factors[factor].second; exponent > 0; --exponent) {
+                termValue *= base;
+            }
+        }
+        result += termValue;
+    }
+    return result;
+}
+
+double CompiledRationalFunction::evaluate(std::vector<double> const& variableValues) const {
+    if (hasConstantDenominator) {
+        return evaluate(numerator, variableValues);
+    }
+    return evaluate(numerator, variableValues) / evaluate(denominator, variableValues);
+}
+
+}  // namespace parametric
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "storm/adapters/RationalFunctionForward.h"
+
+namespace storm {
+namespace utility {
+namespace parametric {
+
+/*!
+ * A rational function that is compiled into a flat list of terms over doubles. Evaluating it is a tight numeric loop instead of carl's generic polynomial
+ * arithmetic. The coefficients are rounded to doubles, i.e., the result may deviate slightly from the (exact) evaluation of the original function.
+ */
+class CompiledRationalFunction {
+   public:
+    /*!
+     * Compiles the given function.
+     *
+     * @param function The function to compile.
+     * @param variables The variables occurring in the function. Upon evaluation, their values are given in this order.
+     */
+    CompiledRationalFunction(storm::RationalFunction const& function, std::vector<storm::RationalFunctionVariable> const& variables);
+
+    /*!
+     * Evaluates the function.
+     *
+     * @param variableValues The values of the variables (in the order given upon construction).
+     */
+    double evaluate(std::vector<double> const& variableValues) const;
+
+   private:
+    struct CompiledPolynomial {
+        // The coefficient of each term.
+        std::vector<double> coefficients;
+        // The factors of term i are factors[termStarts[i]], ..., factors[termStarts[i + 1] - 1], each given by the index of the variable and its exponent.
+        std::vector<uint64_t> termStarts;
+        std::vector<std::pair<uint64_t, uint64_t>> factors;
+    };
+
+    static CompiledPolynomial compile(storm::RawPolynomial const& polynomial, storm::RationalFunctionCoefficient const& factor,
+                                      std::vector<storm::RationalFunctionVariable> const& variables);
+    static double evaluate(CompiledPolynomial const& polynomial, std::vector<double> const& variableValues);
+
+    CompiledPolynomial numerator;
+    // If the denominator is constant, it is already incorporated in the coefficients of the numerator.
+    bool hasConstantDenominator;
+    CompiledPolynomial denominator;
+};
+
+}  // namespace parametric
+}  // namespace utility
+}  // namespace storm
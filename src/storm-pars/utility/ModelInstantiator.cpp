@@ -1,4 +1,8 @@
 #include "storm-pars/utility/ModelInstantiator.h"
+
+#include <algorithm>
+#include <iterator>
+
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -11,6 +15,7 @@ ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ModelInst
     // Now pre-compute the information for the equation system.
     initializeModelSpecificData(parametricModel);
     initializeMatrixMapping(this->instantiatedModel->getTransitionMatrix(), this->functions, this->matrixMapping, parametricModel.getTransitionMatrix());
+    numberOfTransitionMatrixMappings = this->matrixMapping.size();
 
     for (auto& rewModel : this->instantiatedModel->getRewardModels()) {
         if (rewModel.second.hasStateRewards()) {
@@ -156,6 +161,40 @@ ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, Cons
     return *this->instantiatedModel;
 }
 
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+std::vector<typename ConstantSparseModelType::ValueType>
+ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiateTransitionMatrixEntries(
+    std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations) const {
+    uint64_t const numberOfValuations = valuations.size();
+    auto& transitionMatrix = this->instantiatedModel->getTransitionMatrix();
+
+    // Constant entries have been set when initializing the mapping. The remaining entries are overwritten below.
+    std::vector<ConstantType> result;
+    result.reserve(transitionMatrix.getEntryCount() * numberOfValuations);
+    for (auto const& entry : transitionMatrix) {
+        result.insert(result.end(), numberOfValuations, entry.getValue());
+    }
+
+    // Evaluate each function for all valuations, so that the values of a function lie consecutively.
+    std::unordered_map<ConstantType const*, uint64_t> placeholderToFunctionIndex;
+    std::vector<ConstantType> functionValues;
+    functionValues.reserve(this->functions.size() * numberOfValuations);
+    for (auto const& functionResult : this->functions) {
+        placeholderToFunctionIndex.emplace(&functionResult.second, placeholderToFunctionIndex.size());
+        for (auto const& valuation : valuations) {
+            functionValues.push_back(evaluateFunction(functionResult.first, valuation));
+        }
+    }
+
+    for (uint64_t mappingIndex = 0; mappingIndex < numberOfTransitionMatrixMappings; ++mappingIndex) {
+        auto const& entryValuePair = this->matrixMapping[mappingIndex];
+        uint64_t entryIndex = std::distance(transitionMatrix.begin(), entryValuePair.first);
+        uint64_t functionIndex = placeholderToFunctionIndex.at(entryValuePair.second);
+        std::copy_n(functionValues.begin() + functionIndex * numberOfValuations, numberOfValuations, result.begin() + entryIndex * numberOfValuations);
+    }
+    return result;
+}
+
 template<typename ParametricSparseModelType, typename ConstantSparseModelType>
 void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::checkValid() const {
     // TODO write some checks
@@ -4,6 +4,7 @@
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include "storm-pars/utility/parametric.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -47,6 +48,16 @@ class ModelInstantiator {
      */
     ConstantSparseModelType const& instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation);
 
+    /*!
+     * Evaluates the entries of the transition matrix for all of the given valuations at once. Every distinct function is evaluated once per valuation.
+     * The instantiated model (as returned by instantiate) is not changed.
+     *
+     * @param valuations The valuations for which to instantiate the transition matrix.
+     * @return The values of the transition matrix entries (in the order of the matrix) where the value of entry i under the k-th valuation is at position
+     * i * valuations.size() + k.
+     */
+    std::vector<ConstantType> instantiateTransitionMatrixEntries(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations) const;
+
     /*!
      *  Check validity
      */
@@ -129,6 +140,18 @@ class ModelInstantiator {
         }
     }
 
+    template<typename PMT = ParametricSparseModelType>
+    static typename std::enable_if<std::is_same<PMT, ConstantSparseModelType>::value, ConstantType>::type evaluateFunction(
+        ParametricType const& function, storm::utility::parametric::Valuation<ParametricType> const& valuation) {
+        return storm::utility::parametric::substitute(function, valuation);
+    }
+
+    template<typename PMT = ParametricSparseModelType>
+    static typename std::enable_if<!std::is_same<PMT, ConstantSparseModelType>::value, ConstantType>::type evaluateFunction(
+        ParametricType const& function, storm::utility::parametric::Valuation<ParametricType> const& valuation) {
+        return storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, valuation));
+    }
+
     /*!
      * Creates a matrix that has entries at the same position as the given matrix.
      * The returned matrix is a stochastic matrix, i.e., the rows sum up to one.
@@ -176,6 +199,8 @@ class ModelInstantiator {
     std::unordered_map<ParametricType, ConstantType> functions;
     /// Connection of matrix entries with placeholders
     std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping;
+    /// The number of leading elements of the matrixMapping that refer to entries of the transition matrix
+    uint64_t numberOfTransitionMatrixMappings;
     /// Connection of Vector entries with placeholders
     std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping;
 };
@@ -6,6 +6,7 @@
 #include <type_traits>
 
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/BinaryModelParser.h"
 #include "storm-parsers/parser/DirectEncodingParser.h"
 #include "storm-parsers/parser/ImcaMarkovAutomatonParser.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -32,6 +33,15 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitDRNModel(
     return storm::parser::DirectEncodingParser<ValueType>::parseModel(drnFile, options);
 }
 
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitBinaryModel(
+    std::string const& binaryFile, std::shared_ptr<storm::expressions::ExpressionManager> const& expressionManager = nullptr) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        return storm::parser::BinaryModelParser::parseModel(binaryFile, expressionManager);
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact or parametric models are not supported by the binary format.");
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitIMCAModel(std::string const& imcaFile) {
     if constexpr (std::is_same_v<ValueType, double>) {
@@ -0,0 +1,256 @@
+#include "storm-parsers/parser/BinaryModelParser.h"
+
+#include <cstring>
+#include <type_traits>
+
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace parser {
+
+namespace binary = storm::exporter::binary;
+
+namespace {
+
+uint64_t paddedSize(uint64_t size) {
+    return (size + binary::Alignment - 1) / binary::Alignment * binary::Alignment;
+}
+
+/*!
+ * Reads the (aligned) contents of a memory mapped binary model file.
+ */
+class BinaryReader {
+   public:
+    BinaryReader(char const* begin, char const* end) : current(begin), end(end) {
+        // Intentionally left empty.
+    }
+
+    template<typename T>
+    T read() {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be read.");
+        checkAvailable(sizeof(T));
+        T result;
+        std::memcpy(&result, current, sizeof(T));
+        current += sizeof(T);
+        return result;
+    }
+
+    /*!
+     * Skips the given number of bytes (plus padding) and returns a pointer to the first of them.
+     */
+    char const* skip(uint64_t size) {
+        checkAvailable(size);
+        checkAvailable(paddedSize(size));
+        char const* result = current;
+        current += paddedSize(size);
+        return result;
+    }
+
+   private:
+    void checkAvailable(uint64_t size) const {
+        STORM_LOG_THROW(size <= static_cast<uint64_t>(end - current), storm::exceptions::WrongFormatException, "Unexpected end of binary model file.");
+    }
+
+    char const* current;
+    char const* end;
+};
+
+template<typename T>
+std::vector<T> toVector(char const* data, uint64_t size, uint64_t expectedNumberOfElements) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be read.");
+    STORM_LOG_THROW(size == expectedNumberOfElements * sizeof(T), storm::exceptions::WrongFormatException,
+                    "Unexpected size of section in binary model file: " << size << " bytes, expected " << expectedNumberOfElements * sizeof(T) << ".");
+    std::vector<T> result(expectedNumberOfElements);
+    if (size > 0) {
+        std::memcpy(result.data(), data, size);
+    }
+    return result;
+}
+
+storm::storage::BitVector toBitVector(char const* data, uint64_t size, uint64_t numberOfBits) {
+    std::vector<uint64_t> words = toVector<uint64_t>(data, size, (numberOfBits + 63) / 64);
+    storm::storage::BitVector result(numberOfBits);
+    for (uint64_t wordIndex = 0; wordIndex < words.size(); ++wordIndex) {
+        for (uint64_t word = words[wordIndex]; word != 0; word &= word - 1) {
+            uint64_t bit = wordIndex * 64 + __builtin_ctzll(word);
+            STORM_LOG_THROW(bit < numberOfBits, storm::exceptions::WrongFormatException, "Bit index " << bit << " is out of bounds.");
+            result.set(bit);
+        }
+    }
+    return result;
+}
+
+storm::storage::sparse::StateValuations toStateValuations(char const* data, uint64_t size, uint64_t numberOfStates,
+                                                          storm::expressions::ExpressionManager& expressionManager) {
+    BinaryReader reader(data, data + size);
+    uint64_t numberOfVariables = reader.read<uint64_t>();
+    std::vector<bool> isBoolean;
+    storm::storage::sparse::StateValuationsBuilder builder;
+    for (uint64_t variableIndex = 0; variableIndex < numberOfVariables; ++variableIndex) {
+        uint64_t type = reader.read<uint64_t>();
+        uint64_t nameLength = reader.read<uint64_t>();
+        std::string name(reader.skip(nameLength), nameLength);
+        STORM_LOG_THROW(type <= 1, storm::exceptions::WrongFormatException, "Unknown type of state variable '" << name << "'.");
+        isBoolean.push_back(type == 0);
+        if (expressionManager.hasVariable(name)) {
+            storm::expressions::Variable variable = expressionManager.getVariable(name);
+            STORM_LOG_THROW(type == 0 ? variable.getType().isBooleanType() : variable.getType().isIntegerType(), storm::exceptions::WrongFormatException,
+                            "State variable '" << name << "' has a different type than the variable of the expression manager.");
+            builder.addVariable(variable);
+        } else {
+            builder.addVariable(type == 0 ? expressionManager.declareBooleanVariable(name) : expressionManager.declareIntegerVariable(name));
+        }
+    }
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        std::vector<bool> booleanValues;
+        std::vector<int64_t> integerValues;
+        for (uint64_t variableIndex = 0; variableIndex < numberOfVariables; ++variableIndex) {
+            int64_t value = reader.read<int64_t>();
+            if (isBoolean[variableIndex]) {
+                booleanValues.push_back(value != 0);
+            } else {
+                integerValues.push_back(value);
+            }
+        }
+        builder.addState(state, std::move(booleanValues), std::move(integerValues));
+    }
+    return builder.build();
+}
+
+}  // namespace
+
+std::shared_ptr<storm::models::sparse::Model<double>> BinaryModelParser::parseModel(
+    std::string const& filename, std::shared_ptr<storm::expressions::ExpressionManager> const& expressionManager) {
+    typedef storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, double> EntryType;
+    static_assert(sizeof(EntryType) == 2 * sizeof(uint64_t) && std::is_trivially_copyable_v<EntryType>, "Unexpected layout of matrix entries.");
+
+    STORM_LOG_INFO("Reading from file " << filename);
+    storm::utility::Stopwatch stopwatch(true);
+    MappedFile file(filename.c_str());
+    BinaryReader reader(file.getData(), file.getDataEnd());
+
+    // Parse header
+    char const* magic = reader.skip(sizeof(binary::Magic));
+    STORM_LOG_THROW(std::equal(magic, magic + sizeof(binary::Magic), binary::Magic), storm::exceptions::WrongFormatException,
+                    "File " << filename << " is not a binary model file.");
+    uint32_t version = reader.read<uint32_t>();
+    STORM_LOG_THROW(version == binary::Version, storm::exceptions::WrongFormatException,
+                    "Binary model file has version " << version << " but only version " << binary::Version << " is supported.");
+    STORM_LOG_THROW(reader.read<uint32_t>() == binary::ByteOrderMarker, storm::exceptions::WrongFormatException,
+                    "Binary model file was written on a machine with a different byte order.");
+    STORM_LOG_THROW(reader.read<uint32_t>() == static_cast<uint32_t>(binary::ValueTypeTag::Double), storm::exceptions::NotSupportedException,
+                    "Binary model file does not hold a model over doubles.");
+    auto type = static_cast<storm::models::ModelType>(reader.read<uint32_t>());
+    STORM_LOG_THROW(type == storm::models::ModelType::Dtmc || type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::Mdp ||
+                        type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp,
+                    storm::exceptions::WrongFormatException, "Unsupported model type in binary model file.");
+    uint64_t numberOfSections = reader.read<uint64_t>();
+
+    // Parse sections
+    bool sawInfo = false;
+    uint64_t numberOfStates = 0, numberOfRows = 0, numberOfEntries = 0, numberOfColumns = 0;
+    bool hasRowGroups = false;
+    std::vector<uint64_t> rowIndications;
+    std::vector<EntryType> entries;
+    boost::optional<std::vector<uint64_t>> rowGroupIndices;
+    storm::storage::sparse::ModelComponents<double> components;
+    std::map<std::string, std::pair<std::optional<std::vector<double>>, std::optional<std::vector<double>>>> rewardVectors;
+    for (uint64_t sectionIndex = 0; sectionIndex < numberOfSections; ++sectionIndex) {
+        auto kind = static_cast<binary::SectionKind>(reader.read<uint32_t>());
+        reader.read<uint32_t>();
+        uint64_t nameLength = reader.read<uint64_t>();
+        uint64_t size = reader.read<uint64_t>();
+        std::string name(reader.skip(nameLength), nameLength);
+        char const* data = reader.skip(size);
+        STORM_LOG_THROW(sawInfo || kind == binary::SectionKind::ModelInfo, storm::exceptions::WrongFormatException,
+                        "Binary model file does not start with the model information.");
+
+        switch (kind) {
+            case binary::SectionKind::ModelInfo: {
+                std::vector<uint64_t> info = toVector<uint64_t>(data, size, 5);
+                numberOfStates = info[0];
+                numberOfRows = info[1];
+                numberOfEntries = info[2];
+                numberOfColumns = info[3];
+                hasRowGroups = info[4] != 0;
+                components.stateLabeling = storm::models::sparse::StateLabeling(numberOfStates);
+                sawInfo = true;
+                break;
+            }
+            case binary::SectionKind::RowIndications:
+                rowIndications = toVector<uint64_t>(data, size, numberOfRows + 1);
+                break;
+            case binary::SectionKind::MatrixEntries:
+                entries = toVector<EntryType>(data, size, numberOfEntries);
+                break;
+            case binary::SectionKind::RowGroupIndices:
+                rowGroupIndices = toVector<uint64_t>(data, size, numberOfStates + 1);
+                break;
+            case binary::SectionKind::StateLabel:
+                components.stateLabeling.addLabel(name, toBitVector(data, size, numberOfStates));
+                break;
+            case binary::SectionKind::ChoiceLabel:
+                if (!components.choiceLabeling) {
+                    components.choiceLabeling = storm::models::sparse::ChoiceLabeling(numberOfRows);
+                }
+                components.choiceLabeling->addLabel(name, toBitVector(data, size, numberOfRows));
+                break;
+            case binary::SectionKind::StateRewards:
+                if (size > 0) {
+                    rewardVectors[name].first = toVector<double>(data, size, numberOfStates);
+                } else {
+                    rewardVectors[name];
+                }
+                break;
+            case binary::SectionKind::StateActionRewards:
+                rewardVectors[name].second = toVector<double>(data, size, numberOfRows);
+                break;
+            case binary::SectionKind::ExitRates:
+                components.exitRates = toVector<double>(data, size, numberOfStates);
+                break;
+            case binary::SectionKind::MarkovianStates:
+                components.markovianStates = toBitVector(data, size, numberOfStates);
+                break;
+            case binary::SectionKind::Observations:
+                components.observabilityClasses = toVector<uint32_t>(data, size, numberOfStates);
+                break;
+            case binary::SectionKind::StateValuations:
+                if (expressionManager) {
+                    components.stateValuations = toStateValuations(data, size, numberOfStates, *expressionManager);
+                } else {
+                    STORM_LOG_INFO("Ignoring the state valuations of the binary model as no expression manager was given.");
+                }
+                break;
+            default:
+                STORM_LOG_WARN("Ignoring unknown section " << static_cast<uint32_t>(kind) << " of binary model file.");
+        }
+    }
+    STORM_LOG_THROW(sawInfo, storm::exceptions::WrongFormatException, "Binary model file does not contain model information.");
+    STORM_LOG_THROW(rowIndications.size() == numberOfRows + 1 && rowIndications.front() == 0 && rowIndications.back() == numberOfEntries,
+                    storm::exceptions::WrongFormatException, "Binary model file contains invalid row indications.");
+    STORM_LOG_THROW(!hasRowGroups || rowGroupIndices, storm::exceptions::WrongFormatException, "Binary model file does not contain the row groups.");
+
+    components.transitionMatrix = storm::storage::SparseMatrix<double>(numberOfColumns, std::move(rowIndications), std::move(entries),
+                                                                       hasRowGroups ? std::move(rowGroupIndices) : boost::none);
+    for (auto& [name, vectors] : rewardVectors) {
+        components.rewardModels.emplace(name, storm::models::sparse::StandardRewardModel<double>(std::move(vectors.first), std::move(vectors.second)));
+    }
+    components.rateTransitions = type == storm::models::ModelType::Ctmc;
+
+    stopwatch.stop();
+    STORM_LOG_INFO("Loaded binary model (" << file.getDataSize() << " bytes) in " << stopwatch << ".");
+    return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+}
+
+}  // namespace parser
+}  // namespace storm
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace expressions {
+class ExpressionManager;
+}
+
+namespace parser {
+
+/*!
+ * Parser for sparse models in the binary model format (see storm/io/BinaryModelFormat.h). The file is mapped to memory and the arrays of the
+ * model are copied from the mapping without any further parsing.
+ */
+class BinaryModelParser {
+   public:
+    /*!
+     * Loads a model in the binary format from the given file.
+     *
+     * @param filename The file to load.
+     * @param expressionManager If given, state valuations that are stored in the file are restored. Their variables are declared in (or taken from)
+     * this manager, which must outlive the model.
+     * @return The model.
+     */
+    static std::shared_ptr<storm::models::sparse::Model<double>> parseModel(
+        std::string const& filename, std::shared_ptr<storm::expressions::ExpressionManager> const& expressionManager = nullptr);
+};
+
+}  // namespace parser
+}  // namespace storm
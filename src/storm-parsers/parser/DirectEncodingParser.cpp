@@ -2,12 +2,17 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
-#include <regex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm-parsers/parser/MappedFile.h"
 #include "storm-parsers/parser/ValueParser.h"
 
 #include "storm/exceptions/AbortException.h"
@@ -22,21 +27,231 @@
 #include "storm/io/file.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/storage/BitVector.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/Stopwatch.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace parser {
 
+namespace {
+
+/*!
+ * Reads the lines of a memory mapped file without copying them.
+ */
+class LineReader {
+   public:
+    LineReader(char const* begin, char const* end) : current(begin), end(end) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Retrieves the next line (without the line break).
+     * @return false iff the end of the data was reached.
+     */
+    bool getLine(std::string_view& line) {
+        if (current == end) {
+            return false;
+        }
+        char const* lineEnd = static_cast<char const*>(std::memchr(current, '\n', end - current));
+        char const* next = lineEnd == nullptr ? end : lineEnd + 1;
+        if (lineEnd == nullptr) {
+            lineEnd = end;
+        }
+        while (lineEnd != current && (*(lineEnd - 1) == '\r' || *(lineEnd - 1) == '\n')) {
+            --lineEnd;
+        }
+        line = std::string_view(current, lineEnd - current);
+        current = next;
+        return true;
+    }
+
+    /*!
+     * Retrieves the first character of the next line or '\0' if the end of the data was reached.
+     */
+    char peek() const {
+        return current == end ? '\0' : *current;
+    }
+
+    char const* getPosition() const {
+        return current;
+    }
+
+   private:
+    char const* current;
+    char const* end;
+};
+
+bool startsWith(std::string_view const& str, std::string_view const& prefix) {
+    return str.substr(0, prefix.size()) == prefix;
+}
+
+bool isWhitespace(char c) {
+    return c == ' ' || c == '\t';
+}
+
+std::string_view trimLeft(std::string_view str) {
+    while (!str.empty() && isWhitespace(str.front())) {
+        str.remove_prefix(1);
+    }
+    return str;
+}
+
+std::string_view trim(std::string_view str) {
+    str = trimLeft(str);
+    while (!str.empty() && isWhitespace(str.back())) {
+        str.remove_suffix(1);
+    }
+    return str;
+}
+
+/*!
+ * Retrieves the part of the line up to the first space and removes it (and the space) from the line.
+ */
+std::string_view nextToken(std::string_view& line) {
+    size_t posEnd = line.find(' ');
+    std::string_view token = line.substr(0, posEnd);
+    line.remove_prefix(posEnd == std::string_view::npos ? line.size() : posEnd + 1);
+    return token;
+}
+
+uint64_t parseIndex(std::string_view str, uint64_t lineNumber) {
+    str = trim(str);
+    uint64_t result = 0;
+    auto [parsedEnd, error] = std::from_chars(str.data(), str.data() + str.size(), result);
+    STORM_LOG_THROW(error == std::errc() && parsedEnd == str.data() + str.size(), storm::exceptions::WrongFormatException,
+                    "Could not parse number '" << str << "' in line " << lineNumber << ".");
+    return result;
+}
+
+/*!
+ * Parses a double without allocating memory. Returns false if the string is not a plain floating point number (e.g. a fraction).
+ */
+bool parseDoubleFast(std::string_view str, double& result) {
+    char buffer[64];
+    if (str.empty() || str.size() >= sizeof(buffer)) {
+        return false;
+    }
+    std::copy(str.begin(), str.end(), buffer);
+    buffer[str.size()] = '\0';
+    char* parsedEnd;
+    result = std::strtod(buffer, &parsedEnd);
+    return parsedEnd == buffer + str.size();
+}
+
+/*!
+ * Parses labels that are separated by whitespace and can optionally be enclosed in quotation marks.
+ */
+void parseLabels(std::string_view line, uint64_t item, uint64_t lineNumber, std::vector<std::pair<uint64_t, std::string_view>>& labels) {
+    while (!(line = trimLeft(line)).empty()) {
+        std::string_view label;
+        if (line.front() == '"') {
+            size_t posEnd = line.find('"', 1);
+            STORM_LOG_THROW(posEnd != std::string_view::npos, storm::exceptions::WrongFormatException, "Unterminated label in line " << lineNumber << ".");
+            label = line.substr(1, posEnd - 1);
+            line.remove_prefix(posEnd + 1);
+        } else {
+            size_t posEnd = std::min(line.find(' '), line.find('\t'));
+            label = line.substr(0, posEnd);
+            line.remove_prefix(posEnd == std::string_view::npos ? line.size() : posEnd);
+        }
+        if (!label.empty()) {
+            labels.emplace_back(item, label);
+        }
+    }
+}
+
+/*!
+ * Collects labels of states or choices in the order in which they are encountered.
+ */
+class LabelCollector {
+   public:
+    explicit LabelCollector(uint64_t numberOfItems) : numberOfItems(numberOfItems) {
+        // Intentionally left empty.
+    }
+
+    void add(std::vector<std::pair<uint64_t, std::string_view>> const& labels) {
+        for (auto const& [item, label] : labels) {
+            auto it = labelToItems.find(label);
+            if (it == labelToItems.end()) {
+                it = labelToItems.emplace(label, storm::storage::BitVector(numberOfItems)).first;
+                labelNames.push_back(label);
+            }
+            STORM_LOG_THROW(item < numberOfItems, storm::exceptions::WrongFormatException, "Label '" << label << "' assigned to unexpected item " << item << ".");
+            it->second.set(item);
+        }
+    }
+
+    template<typename LabelingType>
+    void moveInto(LabelingType& labeling) {
+        for (auto const& label : labelNames) {
+            labeling.addLabel(std::string(label), std::move(labelToItems.at(label)));
+        }
+    }
+
+   private:
+    uint64_t numberOfItems;
+    std::vector<std::string_view> labelNames;
+    std::unordered_map<std::string_view, storm::storage::BitVector> labelToItems;
+};
+
+}  // namespace
+
+/*!
+ * A part of the model section that starts at a state (unless it is the first part).
+ */
+template<typename ValueType, typename RewardModelType>
+struct DirectEncodingParser<ValueType, RewardModelType>::Chunk {
+    char const* begin;
+    char const* end;
+    uint64_t firstLineNumber;
+    uint64_t firstState;
+    uint64_t firstRow;
+    uint64_t numberOfStates;
+    uint64_t numberOfRows;
+    uint64_t numberOfEntries;
+};
+
+/*!
+ * The content of a chunk. All indices are global.
+ */
+template<typename ValueType, typename RewardModelType>
+struct DirectEncodingParser<ValueType, RewardModelType>::ParsedChunk {
+    std::vector<uint64_t> rowGroupStarts;
+    std::vector<uint64_t> entryRows;
+    std::vector<uint64_t> entryColumns;
+    std::vector<ValueType> entryValues;
+    std::vector<ValueType> exitRates;
+    std::vector<uint32_t> observations;
+    std::vector<std::vector<std::pair<uint64_t, ValueType>>> stateRewards;
+    std::vector<std::vector<std::pair<uint64_t, ValueType>>> actionRewards;
+    std::vector<std::pair<uint64_t, std::string_view>> stateLabels;
+    std::vector<std::pair<uint64_t, std::string_view>> choiceLabels;
+};
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseModel(
     std::string const& filename, DirectEncodingParserOptions const& options) {
     // Load file
     STORM_LOG_INFO("Reading from file " << filename);
-    std::ifstream file;
-    storm::utility::openFile(filename, file);
+    storm::utility::Stopwatch stopwatch(true);
+    MappedFile file(filename.c_str());
+    LineReader reader(file.getData(), file.getDataEnd());
+    std::string_view lineView;
+    uint64_t lineNumber = 0;
+    auto readLine = [&reader, &lineView, &lineNumber](std::string& line) {
+        if (reader.getLine(lineView)) {
+            ++lineNumber;
+            line = lineView;
+            return true;
+        }
+        line.clear();
+        return false;
+    };
     std::string line;
 
     // Initialize
@@ -51,7 +266,7 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
     std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> modelComponents;
 
     // Parse header
-    while (storm::utility::getline(file, line)) {
+    while (readLine(line)) {
         if (line.empty() || boost::starts_with(line, "//")) {
             continue;
         }
@@ -68,7 +283,7 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
         } else if (line == "@parameters") {
             // Parse parameters
             STORM_LOG_THROW(!sawParameters, storm::exceptions::WrongFormatException, "Parameters declared twice");
-            storm::utility::getline(file, line);
+            readLine(line);
             if (line != "") {
                 std::vector<std::string> parameters;
                 boost::split(parameters, line, boost::is_any_of(" "));
@@ -81,7 +296,7 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
 
         } else if (line == "@placeholders") {
             // Parse placeholders
-            while (storm::utility::getline(file, line)) {
+            while (readLine(line)) {
                 size_t posColon = line.find(':');
                 STORM_LOG_THROW(posColon != std::string::npos, storm::exceptions::WrongFormatException, "':' not found.");
                 std::string placeName = line.substr(0, posColon - 1);
@@ -91,7 +306,7 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
                 STORM_LOG_TRACE("Placeholder " << placeName << " for value " << value);
                 auto ret = placeholders.insert(std::make_pair(placeName.substr(1), value));
                 STORM_LOG_THROW(ret.second, storm::exceptions::WrongFormatException, "Placeholder '$" << placeName << "' was already defined before.");
-                if (file.peek() == '@') {
+                if (reader.peek() == '@') {
                     // Next character is @ -> placeholder definitions ended
                     break;
                 }
@@ -99,16 +314,16 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
         } else if (line == "@reward_models") {
             // Parse reward models
             STORM_LOG_THROW(rewardModelNames.empty(), storm::exceptions::WrongFormatException, "Reward model names declared twice");
-            storm::utility::getline(file, line);
+            readLine(line);
             boost::split(rewardModelNames, line, boost::is_any_of("\t "));
         } else if (line == "@nr_states") {
             // Parse no. of states
             STORM_LOG_THROW(nrStates == 0, storm::exceptions::WrongFormatException, "Number states declared twice");
-            storm::utility::getline(file, line);
+            readLine(line);
             nrStates = parseNumber<size_t>(line);
         } else if (line == "@nr_choices") {
             STORM_LOG_THROW(nrChoices == 0, storm::exceptions::WrongFormatException, "Number of actions declared twice");
-            storm::utility::getline(file, line);
+            readLine(line);
             nrChoices = parseNumber<size_t>(line);
         } else if (line == "@model") {
             // Parse rest of the model
@@ -118,66 +333,131 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
                             "No. of actions (@nr_choices) has to be declared before model.");
             STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
             // Construct model components
-            modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+            modelComponents = parseStates(reader.getPosition(), file.getDataEnd(), lineNumber + 1, type, nrStates, nrChoices, placeholders, valueParser,
+                                          rewardModelNames, options);
             break;
         } else {
             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
         }
     }
     // Done parsing
-    storm::utility::closeFile(file);
+    STORM_LOG_THROW(modelComponents, storm::exceptions::WrongFormatException, "No model section (@model) found in file " << filename << ".");
+    stopwatch.stop();
+    double const megabytes = static_cast<double>(file.getDataSize()) / (1024.0 * 1024.0);
+    double const seconds = std::max<double>(static_cast<double>(stopwatch.getTimeInMilliseconds()), 1.0) / 1000.0;
+    STORM_LOG_INFO("Parsed " << megabytes << " MB in " << stopwatch << " (" << megabytes / seconds << " MB/s).");
 
     // Build model
     return storm::utility::builder::buildModelFromComponents(type, std::move(*modelComponents));
 }
 
 template<typename ValueType, typename RewardModelType>
-std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseStates(
-    std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-    ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
-    // Initialize
-    auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
+std::vector<typename DirectEncodingParser<ValueType, RewardModelType>::Chunk> DirectEncodingParser<ValueType, RewardModelType>::splitIntoChunks(
+    char const* begin, char const* end, uint64_t firstLineNumber, size_t stateSize, uint64_t chunkSize) {
+    std::vector<Chunk> chunks;
+    Chunk currentChunk{begin, end, firstLineNumber, 0, 0, 0, 0, 0};
+    LineReader reader(begin, end);
+    std::string_view line;
+    uint64_t lineNumber = firstLineNumber - 1;
+    size_t state = 0;
+    size_t row = 0;
+    bool firstState = true;
+    bool firstActionForState = true;
+    char const* lineBegin = reader.getPosition();
+    for (; reader.getLine(line); lineBegin = reader.getPosition()) {
+        ++lineNumber;
+        line = trimLeft(line);
+        if (line.empty() || startsWith(line, "//")) {
+            continue;
+        }
+        if (startsWith(line, "state ")) {
+            if (firstState) {
+                firstState = false;
+            } else {
+                ++state;
+                ++row;
+            }
+            firstActionForState = true;
+            STORM_LOG_THROW(state < stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
+            if (currentChunk.numberOfStates > 0 && static_cast<uint64_t>(lineBegin - currentChunk.begin) >= chunkSize) {
+                currentChunk.end = lineBegin;
+                chunks.push_back(currentChunk);
+                currentChunk = Chunk{lineBegin, end, lineNumber, state, row, 0, 0, 0};
+            }
+            ++currentChunk.numberOfStates;
+            ++currentChunk.numberOfRows;
+        } else if (startsWith(line, "action ")) {
+            if (firstActionForState) {
+                firstActionForState = false;
+            } else {
+                ++row;
+                ++currentChunk.numberOfRows;
+            }
+        } else {
+            ++currentChunk.numberOfEntries;
+        }
+    }
+    chunks.push_back(currentChunk);
+    return chunks;
+}
+
+template<typename ValueType, typename RewardModelType>
+typename DirectEncodingParser<ValueType, RewardModelType>::ParsedChunk DirectEncodingParser<ValueType, RewardModelType>::parseChunk(
+    Chunk const& chunk, storm::models::ModelType type, size_t stateSize, std::unordered_map<std::string, ValueType> const& placeholders,
+    ValueParser<ValueType> const& valueParser, DirectEncodingParserOptions const& options) {
     bool nonDeterministic =
         (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
     bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
-    storm::storage::SparseMatrixBuilder<ValueType> builder = storm::storage::SparseMatrixBuilder<ValueType>(0, 0, 0, false, nonDeterministic, 0);
-    modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
-    modelComponents->observabilityClasses = std::vector<uint32_t>();
-    modelComponents->observabilityClasses->resize(stateSize);
-    if (options.buildChoiceLabeling) {
-        modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
+    ParsedChunk result;
+    result.entryRows.reserve(chunk.numberOfEntries);
+    result.entryColumns.reserve(chunk.numberOfEntries);
+    result.entryValues.reserve(chunk.numberOfEntries);
+    if (nonDeterministic) {
+        result.rowGroupStarts.reserve(chunk.numberOfStates);
     }
-    std::vector<std::vector<ValueType>> stateRewards;
-    std::vector<std::vector<ValueType>> actionRewards;
     if (continuousTime) {
-        modelComponents->exitRates = std::vector<ValueType>(stateSize);
-        if (type == storm::models::ModelType::MarkovAutomaton) {
-            modelComponents->markovianStates = storm::storage::BitVector(stateSize);
-        }
+        result.exitRates.reserve(chunk.numberOfStates);
     }
-    // We parse rates for continuous time models.
-    if (type == storm::models::ModelType::Ctmc) {
-        modelComponents->rateTransitions = true;
+    if (type == storm::models::ModelType::Pomdp) {
+        result.observations.reserve(chunk.numberOfStates);
     }
 
+    auto parseRewards = [&](std::string_view& line, uint64_t item, uint64_t lineNumber, std::vector<std::vector<std::pair<uint64_t, ValueType>>>& rewards) {
+        size_t posEndReward = line.find(']');
+        STORM_LOG_THROW(posEndReward != std::string::npos, storm::exceptions::WrongFormatException, "] missing in line " << lineNumber << " .");
+        std::string_view rewardsStr = line.substr(1, posEndReward - 1);
+        for (uint64_t rewardIndex = 0; true; ++rewardIndex) {
+            size_t posComma = rewardsStr.find(',');
+            if (rewards.size() <= rewardIndex) {
+                rewards.resize(rewardIndex + 1);
+            }
+            auto rewardValue = parseValue(trim(rewardsStr.substr(0, posComma)), placeholders, valueParser);
+            if (!storm::utility::isZero(rewardValue)) {
+                rewards[rewardIndex].emplace_back(item, std::move(rewardValue));
+            }
+            if (posComma == std::string_view::npos) {
+                break;
+            }
+            rewardsStr.remove_prefix(posComma + 1);
+        }
+        line.remove_prefix(posEndReward + 1);
+    };
+
     // Iterate over all lines
-    std::string line;
-    size_t row = 0;
-    size_t state = 0;
-    uint64_t lineNumber = 0;
+    LineReader reader(chunk.begin, chunk.end);
+    std::string_view line;
+    uint64_t lineNumber = chunk.firstLineNumber - 1;
+    size_t row = chunk.firstRow;
+    size_t state = chunk.firstState;
     bool firstState = true;
     bool firstActionForState = true;
-    while (storm::utility::getline(file, line)) {
-        lineNumber++;
-        if (boost::starts_with(line, "//")) {
-            continue;
-        }
-        if (line.empty()) {
+    while (reader.getLine(line)) {
+        ++lineNumber;
+        line = trimLeft(line);
+        if (line.empty() || startsWith(line, "//")) {
             continue;
         }
-        STORM_LOG_TRACE("Parsing line no " << lineNumber << " : " << line);
-        boost::trim_left(line);
-        if (boost::starts_with(line, "state ")) {
+        if (startsWith(line, "state ")) {
             // New state
             if (firstState) {
                 firstState = false;
@@ -186,207 +466,202 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 ++row;
             }
             firstActionForState = true;
-            STORM_LOG_TRACE("New state " << state);
-            STORM_LOG_THROW(state <= stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
 
             // Parse state id
-            line = line.substr(6);  // Remove "state "
-            std::string curString = line;
-            size_t posEnd = line.find(" ");
-            if (posEnd != std::string::npos) {
-                curString = line.substr(0, posEnd);
-                line = line.substr(posEnd + 1);
-            } else {
-                line = "";
-            }
-            size_t parsedId = parseNumber<size_t>(curString);
+            line.remove_prefix(6);  // Remove "state "
+            size_t parsedId = parseIndex(nextToken(line), lineNumber);
             STORM_LOG_THROW(state == parsedId, storm::exceptions::WrongFormatException,
                             "In line " << lineNumber << " state ids are not ordered and without gaps. Expected " << state << " but got " << parsedId << ".");
             if (nonDeterministic) {
-                STORM_LOG_TRACE("new Row Group starts at " << row << ".");
-                builder.newRowGroup(row);
-                STORM_LOG_THROW(nrChoices == 0 || builder.getCurrentRowGroupCount() <= nrChoices, storm::exceptions::WrongFormatException,
-                                "More actions detected than declared (in @nr_choices).");
+                result.rowGroupStarts.push_back(row);
             }
 
             if (continuousTime) {
                 // Parse exit rate for CTMC or MA
-                STORM_LOG_THROW(boost::starts_with(line, "!"), storm::exceptions::WrongFormatException, "Exit rate missing in " << lineNumber);
-                line = line.substr(1);  // Remove "!"
-                curString = line;
-                posEnd = line.find(" ");
-                if (posEnd != std::string::npos) {
-                    curString = line.substr(0, posEnd);
-                    line = line.substr(posEnd + 1);
-                } else {
-                    line = "";
-                }
-                ValueType exitRate = parseValue(curString, placeholders, valueParser);
-                if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(exitRate)) {
-                    modelComponents->markovianStates.get().set(state);
-                }
-                STORM_LOG_TRACE("Exit rate " << exitRate);
-                modelComponents->exitRates.get()[state] = exitRate;
+                STORM_LOG_THROW(startsWith(line, "!"), storm::exceptions::WrongFormatException, "Exit rate missing in " << lineNumber);
+                line.remove_prefix(1);  // Remove "!"
+                result.exitRates.push_back(parseValue(nextToken(line), placeholders, valueParser));
             }
 
-            if (boost::starts_with(line, "[")) {
+            if (startsWith(line, "[")) {
                 // Parse rewards
-                size_t posEndReward = line.find(']');
-                STORM_LOG_THROW(posEndReward != std::string::npos, storm::exceptions::WrongFormatException, "] missing in line " << lineNumber << " .");
-                std::string rewardsStr = line.substr(1, posEndReward - 1);
-                STORM_LOG_TRACE("State rewards: " << rewardsStr);
-                std::vector<std::string> rewards;
-                boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (stateRewards.size() < rewards.size()) {
-                    stateRewards.resize(rewards.size());
-                }
-                auto stateRewardsIt = stateRewards.begin();
-                for (auto const& rew : rewards) {
-                    auto rewardValue = parseValue(rew, placeholders, valueParser);
-                    if (!storm::utility::isZero(rewardValue)) {
-                        if (stateRewardsIt->empty()) {
-                            stateRewardsIt->resize(stateSize, storm::utility::zero<ValueType>());
-                        }
-                        (*stateRewardsIt)[state] = std::move(rewardValue);
-                    }
-                    ++stateRewardsIt;
-                }
-                line = line.substr(posEndReward + 1);
+                parseRewards(line, state, lineNumber, result.stateRewards);
             }
 
             if (type == storm::models::ModelType::Pomdp) {
-                if (boost::starts_with(line, "{")) {
-                    size_t posEndObservation = line.find("}");
-                    std::string observation = line.substr(1, posEndObservation - 1);
-                    STORM_LOG_TRACE("State observation " << observation);
-                    modelComponents->observabilityClasses.value()[state] = std::stoi(observation);
-                    line = line.substr(posEndObservation + 1);
-                } else {
-                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Expected an observation for state " << state << " in line " << lineNumber);
-                }
+                STORM_LOG_THROW(startsWith(line, "{"), storm::exceptions::WrongFormatException,
+                                "Expected an observation for state " << state << " in line " << lineNumber);
+                size_t posEndObservation = line.find('}');
+                STORM_LOG_THROW(posEndObservation != std::string::npos, storm::exceptions::WrongFormatException, "} missing in line " << lineNumber << " .");
+                result.observations.push_back(static_cast<uint32_t>(parseIndex(line.substr(1, posEndObservation - 1), lineNumber)));
+                line.remove_prefix(posEndObservation + 1);
             }
 
             // Parse labels
-            if (!line.empty()) {
-                std::vector<std::string> labels;
-                // Labels are separated by whitespace and can optionally be enclosed in quotation marks
-                // Regex for labels with two cases:
-                // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
-                //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
-                //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows
-                //   (?=(\s|$|\"))
-                // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
-                //   - First part matches string without whitespace and quotation marks [^\s\"]+?
-                //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
-                std::regex labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
-
-                // Iterate over matches
-                auto match_begin = std::sregex_iterator(line.begin(), line.end(), labelRegex);
-                auto match_end = std::sregex_iterator();
-                for (std::sregex_iterator i = match_begin; i != match_end; ++i) {
-                    std::smatch match = *i;
-                    // Find matched group and add as label
-                    if (match.length(1) > 0) {
-                        labels.push_back(match.str(1));
-                    } else {
-                        labels.push_back(match.str(3));
-                    }
-                }
-
-                for (std::string const& label : labels) {
-                    if (!modelComponents->stateLabeling.containsLabel(label)) {
-                        modelComponents->stateLabeling.addLabel(label);
-                    }
-                    modelComponents->stateLabeling.addLabelToState(label, state);
-                    STORM_LOG_TRACE("New label: '" << label << "'");
-                }
-            }
-        } else if (boost::starts_with(line, "action ")) {
+            parseLabels(line, state, lineNumber, result.stateLabels);
+        } else if (startsWith(line, "action ")) {
             // New action
             if (firstActionForState) {
                 firstActionForState = false;
             } else {
                 ++row;
             }
-            STORM_LOG_TRACE("New action: " << row);
-            line = line.substr(7);
-            std::string curString = line;
-            size_t posEnd = line.find(" ");
-            if (posEnd != std::string::npos) {
-                curString = line.substr(0, posEnd);
-                line = line.substr(posEnd + 1);
-            } else {
-                line = "";
-            }
-
-            // curString contains action name.
-            if (options.buildChoiceLabeling) {
-                if (curString != "__NOLABEL__") {
-                    if (!modelComponents->choiceLabeling.value().containsLabel(curString)) {
-                        modelComponents->choiceLabeling.value().addLabel(curString);
-                    }
-                    modelComponents->choiceLabeling.value().addLabelToChoice(curString, row);
-                }
+            line.remove_prefix(7);  // Remove "action "
+            std::string_view actionName = nextToken(line);
+            if (options.buildChoiceLabeling && actionName != "__NOLABEL__") {
+                result.choiceLabels.emplace_back(row, actionName);
             }
             // Check for rewards
-            if (boost::starts_with(line, "[")) {
-                // Rewards found
-                size_t posEndReward = line.find(']');
-                STORM_LOG_THROW(posEndReward != std::string::npos, storm::exceptions::WrongFormatException, "] missing.");
-                std::string rewardsStr = line.substr(1, posEndReward - 1);
-                STORM_LOG_TRACE("Action rewards: " << rewardsStr);
-                std::vector<std::string> rewards;
-                boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (actionRewards.size() < rewards.size()) {
-                    actionRewards.resize(rewards.size());
-                }
-                auto actionRewardsIt = actionRewards.begin();
-                for (auto const& rew : rewards) {
-                    auto rewardValue = parseValue(rew, placeholders, valueParser);
-                    if (!storm::utility::isZero(rewardValue)) {
-                        if (actionRewardsIt->size() <= row) {
-                            actionRewardsIt->resize(std::max(row + 1, stateSize), storm::utility::zero<ValueType>());
-                        }
-                        (*actionRewardsIt)[row] = std::move(rewardValue);
-                    }
-                    ++actionRewardsIt;
-                }
-                line = line.substr(posEndReward + 1);
+            if (startsWith(line, "[")) {
+                parseRewards(line, row, lineNumber, result.actionRewards);
             }
-
         } else {
             // New transition
             size_t posColon = line.find(':');
             STORM_LOG_THROW(posColon != std::string::npos, storm::exceptions::WrongFormatException,
                             "':' not found in '" << line << "' on line " << lineNumber << ".");
-            size_t target = parseNumber<size_t>(line.substr(0, posColon - 1));
-            std::string valueStr = line.substr(posColon + 2);
-            ValueType value = parseValue(valueStr, placeholders, valueParser);
-            STORM_LOG_TRACE("Transition " << row << " -> " << target << ": " << value);
+            size_t target = parseIndex(line.substr(0, posColon), lineNumber);
             STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException,
                             "In line " << lineNumber << " target state " << target << " is greater than state size " << stateSize);
-            builder.addNextValue(row, target, value);
+            result.entryRows.push_back(row);
+            result.entryColumns.push_back(target);
+            result.entryValues.push_back(parseValue(trim(line.substr(posColon + 1)), placeholders, valueParser));
+        }
+    }
+    return result;
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseStates(
+    char const* begin, char const* end, uint64_t firstLineNumber, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+    std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames,
+    DirectEncodingParserOptions const& options) {
+    // Split the model into chunks. This determines the dimensions of the matrix, so that all memory can be reserved upfront.
+    std::vector<Chunk> chunks = splitIntoChunks(begin, end, firstLineNumber, stateSize, options.chunkSize);
+    uint64_t numberOfRows = 0;
+    uint64_t numberOfEntries = 0;
+    for (auto const& chunk : chunks) {
+        numberOfRows += chunk.numberOfRows;
+        numberOfEntries += chunk.numberOfEntries;
+    }
+    numberOfRows = std::max<uint64_t>(numberOfRows, 1);
+    STORM_LOG_DEBUG("Model has " << numberOfRows << " rows and " << numberOfEntries << " entries, split into " << chunks.size() << " chunks.");
+
+    // Initialize
+    auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
+    bool nonDeterministic =
+        (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
+    bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+    if (nonDeterministic) {
+        STORM_LOG_THROW(nrChoices == 0 || numberOfRows == nrChoices, storm::exceptions::WrongFormatException,
+                        "Number of actions detected (" << numberOfRows << ") does not match number of actions declared (" << nrChoices
+                                                       << ", in @nr_choices).");
+    }
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfRows, stateSize, numberOfEntries, false, nonDeterministic,
+                                                           nonDeterministic ? stateSize : 0);
+    modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
+    modelComponents->observabilityClasses = std::vector<uint32_t>();
+    modelComponents->observabilityClasses->resize(stateSize);
+    if (options.buildChoiceLabeling) {
+        modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
+    }
+    std::vector<std::vector<ValueType>> stateRewards;
+    std::vector<std::vector<ValueType>> actionRewards;
+    if (continuousTime) {
+        modelComponents->exitRates = std::vector<ValueType>(stateSize);
+        if (type == storm::models::ModelType::MarkovAutomaton) {
+            modelComponents->markovianStates = storm::storage::BitVector(stateSize);
+        }
+    }
+    // We parse rates for continuous time models.
+    if (type == storm::models::ModelType::Ctmc) {
+        modelComponents->rateTransitions = true;
+    }
+    LabelCollector stateLabels(stateSize);
+    LabelCollector choiceLabels(nrChoices);
+
+    // Copies the content of a parsed chunk into the model components.
+    auto addChunk = [&](Chunk const& chunk, ParsedChunk& parsedChunk) {
+        auto rowGroupIt = parsedChunk.rowGroupStarts.cbegin();
+        for (uint64_t entry = 0; entry < parsedChunk.entryRows.size(); ++entry) {
+            for (; rowGroupIt != parsedChunk.rowGroupStarts.cend() && *rowGroupIt <= parsedChunk.entryRows[entry]; ++rowGroupIt) {
+                builder.newRowGroup(*rowGroupIt);
+            }
+            builder.addNextValue(parsedChunk.entryRows[entry], parsedChunk.entryColumns[entry], std::move(parsedChunk.entryValues[entry]));
+        }
+        for (; rowGroupIt != parsedChunk.rowGroupStarts.cend(); ++rowGroupIt) {
+            builder.newRowGroup(*rowGroupIt);
+        }
+        for (uint64_t localState = 0; localState < parsedChunk.exitRates.size(); ++localState) {
+            if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(parsedChunk.exitRates[localState])) {
+                modelComponents->markovianStates.get().set(chunk.firstState + localState);
+            }
+            modelComponents->exitRates.get()[chunk.firstState + localState] = std::move(parsedChunk.exitRates[localState]);
+        }
+        std::copy(parsedChunk.observations.begin(), parsedChunk.observations.end(), modelComponents->observabilityClasses->begin() + chunk.firstState);
+        if (stateRewards.size() < parsedChunk.stateRewards.size()) {
+            stateRewards.resize(parsedChunk.stateRewards.size());
+        }
+        for (uint64_t i = 0; i < parsedChunk.stateRewards.size(); ++i) {
+            for (auto& [rewardState, rewardValue] : parsedChunk.stateRewards[i]) {
+                if (stateRewards[i].empty()) {
+                    stateRewards[i].resize(stateSize, storm::utility::zero<ValueType>());
+                }
+                stateRewards[i][rewardState] = std::move(rewardValue);
+            }
+        }
+        if (actionRewards.size() < parsedChunk.actionRewards.size()) {
+            actionRewards.resize(parsedChunk.actionRewards.size());
+        }
+        for (uint64_t i = 0; i < parsedChunk.actionRewards.size(); ++i) {
+            for (auto& [rewardRow, rewardValue] : parsedChunk.actionRewards[i]) {
+                if (actionRewards[i].empty()) {
+                    actionRewards[i].resize(numberOfRows, storm::utility::zero<ValueType>());
+                }
+                actionRewards[i][rewardRow] = std::move(rewardValue);
+            }
+        }
+        stateLabels.add(parsedChunk.stateLabels);
+        choiceLabels.add(parsedChunk.choiceLabels);
+    };
+
+    // Parse the chunks in rounds of (at most) one chunk per thread. Merging them in order keeps at most one round in memory.
+    uint64_t numberOfThreads = std::max<uint64_t>(options.numberOfThreads, 1);
+    if constexpr (std::is_same_v<ValueType, storm::RationalFunction>) {
+        STORM_LOG_WARN_COND(numberOfThreads == 1, "Models over rational functions are parsed sequentially.");
+        numberOfThreads = 1;
+    }
+    for (uint64_t roundBegin = 0; roundBegin < chunks.size(); roundBegin += numberOfThreads) {
+        uint64_t const roundEnd = std::min<uint64_t>(roundBegin + numberOfThreads, chunks.size());
+        std::vector<ParsedChunk> parsedChunks(roundEnd - roundBegin);
+        storm::utility::parallel::forEachBlock(numberOfThreads, roundBegin, roundEnd, 1, [&](uint64_t, uint64_t blockBegin, uint64_t blockEnd) {
+            for (uint64_t chunkIndex = blockBegin; chunkIndex < blockEnd; ++chunkIndex) {
+                parsedChunks[chunkIndex - roundBegin] = parseChunk(chunks[chunkIndex], type, stateSize, placeholders, valueParser, options);
+            }
+        });
+        for (uint64_t chunkIndex = roundBegin; chunkIndex < roundEnd; ++chunkIndex) {
+            addChunk(chunks[chunkIndex], parsedChunks[chunkIndex - roundBegin]);
         }
 
         if (storm::utility::resources::isTerminate()) {
-            std::cout << "Parsed " << state << "/" << stateSize << " states before abort.\n";
+            Chunk const& lastChunk = chunks[roundEnd - 1];
+            std::cout << "Parsed " << lastChunk.firstState + lastChunk.numberOfStates << "/" << stateSize << " states before abort.\n";
             STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
             break;
         }
-
-    }  // end state iteration
-    STORM_LOG_TRACE("Finished parsing");
-
-    if (nonDeterministic) {
-        STORM_LOG_THROW(nrChoices == 0 || builder.getLastRow() + 1 == nrChoices, storm::exceptions::WrongFormatException,
-                        "Number of actions detected (at least " << builder.getLastRow() + 1 << ") does not match number of actions declared (" << nrChoices
-                                                                << ", in @nr_choices).");
     }
+    STORM_LOG_TRACE("Finished parsing");
 
     // Build transition matrix
-    modelComponents->transitionMatrix = builder.build(row + 1, stateSize, nonDeterministic ? stateSize : 0);
+    modelComponents->transitionMatrix = builder.build(numberOfRows, stateSize, nonDeterministic ? stateSize : 0);
     STORM_LOG_TRACE("Built matrix");
 
+    // Build labelings
+    stateLabels.moveInto(modelComponents->stateLabeling);
+    if (options.buildChoiceLabeling) {
+        choiceLabels.moveInto(modelComponents->choiceLabeling.value());
+    }
+
     // Build reward models
     uint64_t numRewardModels = std::max(stateRewards.size(), actionRewards.size());
     for (uint64_t i = 0; i < numRewardModels; ++i) {
@@ -401,7 +676,6 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
             stateRewardVector = std::move(stateRewards[i]);
         }
         if (i < actionRewards.size() && !actionRewards[i].empty()) {
-            actionRewards[i].resize(row + 1, storm::utility::zero<ValueType>());
             actionRewardVector = std::move(actionRewards[i]);
         }
         modelComponents->rewardModels.emplace(
@@ -412,17 +686,23 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
 }
 
 template<typename ValueType, typename RewardModelType>
-ValueType DirectEncodingParser<ValueType, RewardModelType>::parseValue(std::string const& valueStr,
+ValueType DirectEncodingParser<ValueType, RewardModelType>::parseValue(std::string_view valueStr,
                                                                        std::unordered_map<std::string, ValueType> const& placeholders,
                                                                        ValueParser<ValueType> const& valueParser) {
-    if (boost::starts_with(valueStr, "$")) {
-        auto it = placeholders.find(valueStr.substr(1));
+    if (startsWith(valueStr, "$")) {
+        auto it = placeholders.find(std::string(valueStr.substr(1)));
         STORM_LOG_THROW(it != placeholders.end(), storm::exceptions::WrongFormatException, "Placeholder " << valueStr << " unknown.");
         return it->second;
-    } else {
-        // Use default value parser
-        return valueParser.parseValue(valueStr);
     }
+    if constexpr (std::is_same_v<ValueType, double>) {
+        // Avoid the allocations of the default value parser for plain numbers.
+        double result;
+        if (parseDoubleFast(valueStr, result)) {
+            return result;
+        }
+    }
+    // Use default value parser
+    return valueParser.parseValue(std::string(valueStr));
 }
 
 // Template instantiations.
@@ -1,6 +1,8 @@
 #ifndef STORM_PARSER_DIRECTENCODINGPARSER_H_
 #define STORM_PARSER_DIRECTENCODINGPARSER_H_
 
+#include <string_view>
+
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/sparse/ModelComponents.h"
@@ -13,6 +15,10 @@ class ValueParser;
 
 struct DirectEncodingParserOptions {
     bool buildChoiceLabeling = false;
+    // The number of threads that parse the states. Models over rational functions are always parsed sequentially.
+    uint64_t numberOfThreads = 1;
+    // The (approximate) number of bytes of the model section that are parsed at once (by one thread). Chunks always start at a state.
+    uint64_t chunkSize = 1ull << 24;
 };
 /*!
  *	Parser for models in the DRN format with explicit encoding.
@@ -31,10 +37,15 @@ class DirectEncodingParser {
         std::string const& fil, DirectEncodingParserOptions const& options = DirectEncodingParserOptions());
 
    private:
+    struct Chunk;
+    struct ParsedChunk;
+
     /*!
      * Parse states and return transition matrix.
      *
-     * @param file Input file stream.
+     * @param begin Begin of the (memory mapped) model section.
+     * @param end End of the (memory mapped) model section.
+     * @param firstLineNumber The line number of the first line of the model section.
      * @param type Model type.
      * @param stateSize No. of states
      * @param placeholders Placeholders for values.
@@ -44,8 +55,21 @@ class DirectEncodingParser {
      * @return Transition matrix.
      */
     static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> parseStates(
-        std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-        ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+        char const* begin, char const* end, uint64_t firstLineNumber, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+        std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+        std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+
+    /*!
+     * Splits the model section into chunks that start at a state. This also determines the number of states, rows and entries of each chunk.
+     */
+    static std::vector<Chunk> splitIntoChunks(char const* begin, char const* end, uint64_t firstLineNumber, size_t stateSize, uint64_t chunkSize);
+
+    /*!
+     * Parses the states of the given chunk. The result refers to the memory of the chunk.
+     */
+    static ParsedChunk parseChunk(Chunk const& chunk, storm::models::ModelType type, size_t stateSize,
+                                  std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+                                  DirectEncodingParserOptions const& options);
 
     /*!
      * Parse value from string while using placeholders.
@@ -54,7 +78,7 @@ class DirectEncodingParser {
      * @param valueParser Value parser.
      * @return
      */
-    static ValueType parseValue(std::string const& valueStr, std::unordered_map<std::string, ValueType> const& placeholders,
+    static ValueType parseValue(std::string_view valueStr, std::unordered_map<std::string, ValueType> const& placeholders,
                                 ValueParser<ValueType> const& valueParser);
 };
 
@@ -35,6 +35,7 @@
 #include <sstream>
 
 #include "storm/io/file.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -101,6 +102,7 @@ JaniParser<ValueType>::JaniParser(std::string const& jsonstring) : expressionMan
 
 template<typename ValueType>
 void JaniParser<ValueType>::readFile(std::string const& path) {
+    storm::utility::ProfilerPhase phase("jani-read");
     std::ifstream file;
     storm::utility::openFile(path, file);
     file >> parsedStructure;
@@ -109,6 +111,12 @@ void JaniParser<ValueType>::readFile(std::string const& path) {
 
 template<typename ValueType>
 std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<ValueType>::parseModel(bool parseProperties) {
+    storm::utility::ProfilerPhase phase("jani-parse");
+    // The parsed json is released piece by piece as soon as the corresponding part of the model has been built.
+    // This way, the json and the model do not need to be kept in memory completely at the same time.
+    if (!parseProperties && parsedStructure.is_object()) {
+        parsedStructure.erase("properties");
+    }
     // jani-version
     STORM_LOG_THROW(parsedStructure.count("jani-version") == 1, storm::exceptions::InvalidJaniException, "Jani-version must be given exactly once.");
     uint64_t version = getUnsignedInt<ValueType>(parsedStructure.at("jani-version"), "jani version");
@@ -162,6 +170,7 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
             assert(model.getConstants().back().getName() == constant->getName());
             constants.emplace(constant->getName(), &model.getConstants().back());
         }
+        parsedStructure.erase("constants");
     }
 
     // Parse variables
@@ -174,6 +183,7 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
             std::shared_ptr<storm::jani::Variable> variable = parseVariable(varStructure, scope.refine("variables[" + std::to_string(globalVars.size())));
             globalVars.emplace(variable->getName(), &model.addVariable(*variable));
         }
+        parsedStructure.erase("variables");
     }
 
     uint64_t funDeclCount = parsedStructure.count("functions");
@@ -202,15 +212,19 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
             assert(globalFuns.count(funDef.getName()) == 1);
             globalFuns[funDef.getName()] = &model.addFunctionDefinition(funDef);
         }
+        parsedStructure.erase("functions");
     }
 
     // Parse Automata
     STORM_LOG_THROW(parsedStructure.count("automata") == 1, storm::exceptions::InvalidJaniException, "Exactly one list of automata must be given");
     STORM_LOG_THROW(parsedStructure.at("automata").is_array(), storm::exceptions::InvalidJaniException, "Automata must be an array");
     // Automatons can only be parsed after constants and variables.
-    for (auto const& automataEntry : parsedStructure.at("automata")) {
+    for (auto& automataEntry : parsedStructure.at("automata")) {
         model.addAutomaton(parseAutomaton(automataEntry, model, scope.refine("automata[" + std::to_string(model.getNumberOfAutomata()) + "]")));
+        // The automaton is typically the largest part of the json, so we release it right away.
+        automataEntry = nullptr;
     }
+    phase.addCounter("automata", model.getNumberOfAutomata());
     STORM_LOG_THROW(parsedStructure.count("restrict-initial") < 2, storm::exceptions::InvalidJaniException, "Model has multiple initial value restrictions");
     storm::expressions::Expression initialValueRestriction = expressionManager->boolean(true);
     if (parsedStructure.count("restrict-initial") > 0) {
@@ -230,20 +244,22 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
     std::vector<storm::jani::Property> properties;
     if (parseProperties && parsedStructure.count("properties") == 1) {
         STORM_LOG_THROW(parsedStructure.at("properties").is_array(), storm::exceptions::InvalidJaniException, "Properties should be an array");
-        for (auto const& propertyEntry : parsedStructure.at("properties")) {
+        for (auto& propertyEntry : parsedStructure.at("properties")) {
             try {
                 auto prop = this->parseProperty(model, propertyEntry, scope.refine("property[" + std::to_string(properties.size()) + "]"));
                 // Eliminate reward accumulations as much as possible
                 rewAccEliminator.eliminateRewardAccumulations(prop);
-                properties.push_back(prop);
+                properties.push_back(std::move(prop));
             } catch (storm::exceptions::NotSupportedException const& ex) {
                 STORM_LOG_WARN("Cannot handle property: " << ex.what());
             } catch (storm::exceptions::NotImplementedException const& ex) {
                 STORM_LOG_WARN("Cannot handle property: " << ex.what());
             }
+            propertyEntry = nullptr;
         }
     }
-    return {model, properties};
+    parsedStructure = nullptr;
+    return {std::move(model), std::move(properties)};
 }
 
 template<typename ValueType>
@@ -1,5 +1,10 @@
 #include "storm-parsers/parser/PrismParserGrammar.h"
 
+#include <cctype>
+#include <functional>
+#include <queue>
+#include <set>
+#include <unordered_map>
 #include <unordered_set>
 #include "storm/storage/prism/Compositions.h"
 
@@ -8,6 +13,7 @@
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/io/file.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/macros.h"
 
 #include "storm/storage/BitVector.h"
@@ -59,7 +65,12 @@ storm::prism::Program PrismParserGrammar::parseFromString(std::string const& inp
     try {
         // Start first run.
         storm::spirit_encoding::space_type space;
-        bool succeeded = qi::phrase_parse(iter, last, grammar, space | qi::lit("//") >> *(qi::char_ - (qi::eol | qi::eoi)) >> (qi::eol | qi::eoi), result);
+        bool succeeded;
+        {
+            storm::utility::ProfilerPhase phase("prism-first-pass");
+            phase.addCounter("characters", input.size());
+            succeeded = qi::phrase_parse(iter, last, grammar, space | qi::lit("//") >> *(qi::char_ - (qi::eol | qi::eoi)) >> (qi::eol | qi::eoi), result);
+        }
         STORM_LOG_THROW(succeeded, storm::exceptions::WrongFormatException, "Parsing failed in first pass.");
         STORM_LOG_DEBUG("First pass of parsing PRISM input finished.");
 
@@ -68,7 +79,11 @@ storm::prism::Program PrismParserGrammar::parseFromString(std::string const& inp
         iter = first;
         last = PositionIteratorType(input.end());
         grammar.moveToSecondRun();
-        succeeded = qi::phrase_parse(iter, last, grammar, space | qi::lit("//") >> *(qi::char_ - (qi::eol | qi::eoi)) >> (qi::eol | qi::eoi), result);
+        {
+            storm::utility::ProfilerPhase phase("prism-second-pass");
+            phase.addCounter("characters", input.size());
+            succeeded = qi::phrase_parse(iter, last, grammar, space | qi::lit("//") >> *(qi::char_ - (qi::eol | qi::eoi)) >> (qi::eol | qi::eoi), result);
+        }
         STORM_LOG_THROW(succeeded, storm::exceptions::WrongFormatException, "Parsing failed in second pass.");
     } catch (qi::expectation_failure<PositionIteratorType> const& e) {
         // If the parser expected content different than the one provided, display information about the location of the error.
@@ -449,44 +464,119 @@ void PrismParserGrammar::moveToSecondRun() {
     this->globalProgramInformation.moveToSecondRun();
 }
 
+namespace {
+/*!
+ * Retrieves the identifiers that occur in the given expression. This only scans the characters of the expression and does not parse it, so the result
+ * may contain names that are not identifiers of the expression (e.g. of functions), but all identifiers are found.
+ */
+std::vector<std::string> getOccurringIdentifiers(std::string const& expression) {
+    std::vector<std::string> result;
+    auto isIdentifierCharacter = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+    for (auto it = expression.begin(), end = expression.end(); it != end;) {
+        char const c = *it;
+        if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            auto identifierBegin = it;
+            while (it != end && isIdentifierCharacter(*it)) {
+                ++it;
+            }
+            result.emplace_back(identifierBegin, it);
+        } else if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+            // Skip the whole number, such that the exponent of a literal like 1e-5 is not taken as identifier.
+            for (++it; it != end && (isIdentifierCharacter(*it) || *it == '.' || ((*it == '+' || *it == '-') && (it[-1] == 'e' || it[-1] == 'E')));) {
+                ++it;
+            }
+        } else {
+            ++it;
+        }
+    }
+    return result;
+}
+}  // namespace
+
 void PrismParserGrammar::createFormulaIdentifiers(std::vector<storm::prism::Formula> const& formulas) {
     STORM_LOG_THROW(formulas.size() == this->formulaExpressions.size(), storm::exceptions::UnexpectedException,
                     "Unexpected number of formulas and formula expressions");
+    storm::utility::ProfilerPhase phase("prism-formulas");
+    phase.addCounter("formulas", formulas.size());
     this->formulaOrder.clear();
     storm::storage::BitVector unprocessed(formulas.size(), true);
-    // It might be that formulas are declared in a weird order.
-    // We follow a trial-and-error approach: If we can not parse the expression for one formula,
+
+    // Tries to parse the expression of the given formula and, if this succeeds, declares the formula as identifier.
+    auto processFormula = [&](uint64_t formulaIndex) {
+        storm::expressions::Expression expression = this->expressionParser->parseFromString(formulaExpressions[formulaIndex], true);
+        if (!expression.isInitialized()) {
+            return false;
+        }
+        unprocessed.set(formulaIndex, false);
+        formulaOrder.push_back(formulaIndex);
+        storm::expressions::Variable variable;
+        try {
+            if (expression.hasIntegerType()) {
+                variable = manager->declareIntegerVariable(formulas[formulaIndex].getName());
+            } else if (expression.hasBooleanType()) {
+                variable = manager->declareBooleanVariable(formulas[formulaIndex].getName());
+            } else {
+                STORM_LOG_ASSERT(expression.hasNumericalType(), "Unexpected type for formula expression of formula " << formulas[formulaIndex].getName());
+                variable = manager->declareRationalVariable(formulas[formulaIndex].getName());
+            }
+            this->identifiers_.add(formulas[formulaIndex].getName(), variable.getExpression());
+        } catch (storm::exceptions::InvalidArgumentException const& e) {
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
+                            "Parsing error in " << this->getFilename() << ": illegal identifier '" << formulas[formulaIndex].getName() << "' at line '"
+                                                << formulas[formulaIndex].getLineNumber());
+        }
+        this->expressionParser->setIdentifierMapping(&this->identifiers_);
+        return true;
+    };
+
+    // Formulas might be declared in a weird order. We first process them in an order in which each formula comes after the formulas it refers to,
+    // where the smallest index comes first if there is a choice. This way, each formula is parsed only once.
+    std::unordered_map<std::string, uint64_t> formulaNameToIndex;
+    for (uint64_t formulaIndex = 0; formulaIndex < formulas.size(); ++formulaIndex) {
+        formulaNameToIndex.emplace(formulas[formulaIndex].getName(), formulaIndex);
+    }
+    std::vector<std::vector<uint64_t>> dependentFormulas(formulas.size());
+    std::vector<uint64_t> numberOfUnprocessedDependencies(formulas.size(), 0);
+    for (uint64_t formulaIndex = 0; formulaIndex < formulas.size(); ++formulaIndex) {
+        std::set<uint64_t> dependencies;
+        for (auto const& identifier : getOccurringIdentifiers(formulaExpressions[formulaIndex])) {
+            auto dependencyIt = formulaNameToIndex.find(identifier);
+            if (dependencyIt != formulaNameToIndex.end() && dependencyIt->second != formulaIndex) {
+                dependencies.insert(dependencyIt->second);
+            }
+        }
+        for (auto dependency : dependencies) {
+            dependentFormulas[dependency].push_back(formulaIndex);
+        }
+        numberOfUnprocessedDependencies[formulaIndex] = dependencies.size();
+    }
+    std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>> readyFormulas;
+    for (uint64_t formulaIndex = 0; formulaIndex < formulas.size(); ++formulaIndex) {
+        if (numberOfUnprocessedDependencies[formulaIndex] == 0) {
+            readyFormulas.push(formulaIndex);
+        }
+    }
+    while (!readyFormulas.empty()) {
+        uint64_t formulaIndex = readyFormulas.top();
+        readyFormulas.pop();
+        if (processFormula(formulaIndex)) {
+            for (auto dependentFormula : dependentFormulas[formulaIndex]) {
+                if (--numberOfUnprocessedDependencies[dependentFormula] == 0) {
+                    readyFormulas.push(dependentFormula);
+                }
+            }
+        }
+    }
+
+    // For the remaining formulas (if any), we follow a trial-and-error approach: If we can not parse the expression for one formula,
     // we assume a subsequent formula has to be evaluated first.
     // We cycle through the formulas until no further progress is made
-    bool progress = true;
+    bool progress = !unprocessed.empty();
     while (progress) {
         progress = false;
         for (uint64_t formulaIndex = unprocessed.getNextSetIndex(0); formulaIndex < formulas.size();
              formulaIndex = unprocessed.getNextSetIndex(formulaIndex + 1)) {
-            storm::expressions::Expression expression = this->expressionParser->parseFromString(formulaExpressions[formulaIndex], true);
-            if (expression.isInitialized()) {
-                progress = true;
-                unprocessed.set(formulaIndex, false);
-                formulaOrder.push_back(formulaIndex);
-                storm::expressions::Variable variable;
-                try {
-                    if (expression.hasIntegerType()) {
-                        variable = manager->declareIntegerVariable(formulas[formulaIndex].getName());
-                    } else if (expression.hasBooleanType()) {
-                        variable = manager->declareBooleanVariable(formulas[formulaIndex].getName());
-                    } else {
-                        STORM_LOG_ASSERT(expression.hasNumericalType(),
-                                         "Unexpected type for formula expression of formula " << formulas[formulaIndex].getName());
-                        variable = manager->declareRationalVariable(formulas[formulaIndex].getName());
-                    }
-                    this->identifiers_.add(formulas[formulaIndex].getName(), variable.getExpression());
-                } catch (storm::exceptions::InvalidArgumentException const& e) {
-                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
-                                    "Parsing error in " << this->getFilename() << ": illegal identifier '" << formulas[formulaIndex].getName() << "' at line '"
-                                                        << formulas[formulaIndex].getLineNumber());
-                }
-                this->expressionParser->setIdentifierMapping(&this->identifiers_);
-            }
+            progress |= processFormula(formulaIndex);
         }
     }
     if (!unprocessed.empty()) {
@@ -0,0 +1,220 @@
+#include "storm-parsers/util/ModelBuildCache.h"
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "storm-parsers/parser/BinaryModelParser.h"
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/io/BinaryModelExporter.h"
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+namespace {
+
+std::string const ModelExtension = ".bin";
+std::string const KeyExtension = ".key";
+
+/*!
+ * The 64 bit FNV-1a hash. In contrast to std::hash, the result does not depend on the standard library implementation.
+ */
+uint64_t fnv1a(std::string const& input) {
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : input) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string readFile(boost::filesystem::path const& path) {
+    std::ifstream stream(path.string(), std::ios::in | std::ios::binary);
+    std::stringstream content;
+    content << stream.rdbuf();
+    return content.str();
+}
+
+}  // namespace
+
+ModelBuildCache::ModelBuildCache(std::string const& directory, uint64_t sizeLimit) : directory(directory), sizeLimit(sizeLimit) {
+    boost::system::error_code error;
+    boost::filesystem::create_directories(this->directory, error);
+    STORM_LOG_WARN_COND(!error, "Could not create the build cache directory " << directory << ": " << error.message());
+}
+
+std::string ModelBuildCache::computeKey(storm::storage::SymbolicModelDescription const& modelDescription, storm::builder::BuilderOptions const& options,
+                                        std::string const& additionalInformation) {
+    std::stringstream key;
+    key << "binary format " << storm::exporter::binary::Version << "\n";
+    key << "additional information " << additionalInformation << "\n";
+
+    // The builder options.
+    key << "reward models";
+    if (options.isBuildAllRewardModelsSet()) {
+        key << " (all)";
+    }
+    for (auto const& name : options.getRewardModelNames()) {
+        key << " " << std::quoted(name);
+    }
+    key << "\nlabels";
+    if (options.isBuildAllLabelsSet()) {
+        key << " (all)";
+    }
+    for (auto const& name : options.getLabelNames()) {
+        key << " " << std::quoted(name);
+    }
+    for (auto const& [name, expression] : options.getExpressionLabels()) {
+        key << " " << std::quoted(name) << "=(" << expression << ")";
+    }
+    key << "\nterminal states";
+    for (auto const& [labelOrExpression, value] : options.getTerminalStates()) {
+        if (labelOrExpression.isLabel()) {
+            key << " " << std::quoted(labelOrExpression.getLabel());
+        } else {
+            key << " (" << labelOrExpression.getExpression() << ")";
+        }
+        key << "=" << value;
+    }
+    key << "\nflags " << options.isApplyMaximalProgressAssumptionSet() << options.isBuildChoiceLabelsSet() << options.isBuildStateValuationsSet()
+        << options.isBuildObservationValuationsSet() << options.isBuildChoiceOriginsSet() << options.isExplorationChecksSet()
+        << options.isInferObservationsFromActionsSet() << options.isScaleAndLiftTransitionRewardsSet() << options.isAddOutOfBoundsStateSet()
+        << options.isAddOverlappingGuardLabelSet() << " " << options.getReservedBitsForUnboundedVariables() << "\n";
+
+    // The model itself. As the constants are substituted during preprocessing, this also covers the constant definitions.
+    key << "model\n" << modelDescription << "\n";
+    return key.str();
+}
+
+std::shared_ptr<storm::models::sparse::Model<double>> ModelBuildCache::load(
+    std::string const& key, std::shared_ptr<storm::expressions::ExpressionManager> const& expressionManager) const {
+    auto modelPath = getModelPath(key);
+    auto keyPath = getKeyPath(key);
+    if (!boost::filesystem::exists(modelPath) || !boost::filesystem::exists(keyPath)) {
+        STORM_LOG_INFO("No entry in the build cache.");
+        return nullptr;
+    }
+    if (readFile(keyPath) != key) {
+        // Either a hash collision or an entry that was written by a different version.
+        STORM_LOG_INFO("Entry in the build cache belongs to a different model.");
+        return nullptr;
+    }
+
+    try {
+        auto model = storm::parser::BinaryModelParser::parseModel(modelPath.string(), expressionManager);
+        // Mark the entry as recently used.
+        boost::system::error_code error;
+        boost::filesystem::last_write_time(modelPath, std::time(nullptr), error);
+        STORM_LOG_INFO("Loaded model from build cache entry " << modelPath << ".");
+        return model;
+    } catch (storm::exceptions::BaseException const& e) {
+        STORM_LOG_WARN("Removing invalid build cache entry " << modelPath << ": " << e.what());
+        remove(modelPath);
+        return nullptr;
+    }
+}
+
+bool ModelBuildCache::store(std::string const& key, std::shared_ptr<storm::models::sparse::Model<double>> const& model) const {
+    auto modelPath = getModelPath(key);
+    auto keyPath = getKeyPath(key);
+    // Write to temporary files first so that concurrent readers never see incomplete entries.
+    auto temporaryModelPath = modelPath;
+    temporaryModelPath += boost::filesystem::unique_path(".%%%%-%%%%.tmp");
+    auto temporaryKeyPath = keyPath;
+    temporaryKeyPath += boost::filesystem::unique_path(".%%%%-%%%%.tmp");
+    try {
+        {
+            std::ofstream stream(temporaryModelPath.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << temporaryModelPath << ".");
+            storm::exporter::binaryExportSparseModel(stream, model);
+        }
+        {
+            std::ofstream stream(temporaryKeyPath.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+            stream << key;
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not write file " << temporaryKeyPath << ".");
+        }
+        boost::filesystem::rename(temporaryKeyPath, keyPath);
+        boost::filesystem::rename(temporaryModelPath, modelPath);
+    } catch (std::exception const& e) {
+        STORM_LOG_WARN("Could not store the model in the build cache: " << e.what());
+        boost::system::error_code error;
+        boost::filesystem::remove(temporaryModelPath, error);
+        boost::filesystem::remove(temporaryKeyPath, error);
+        return false;
+    }
+    STORM_LOG_INFO("Stored model in build cache entry " << modelPath << ".");
+    enforceSizeLimit();
+    return true;
+}
+
+void ModelBuildCache::enforceSizeLimit() const {
+    struct Entry {
+        boost::filesystem::path modelPath;
+        uint64_t size;
+        std::time_t lastUse;
+    };
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+    boost::system::error_code error;
+    for (boost::filesystem::directory_iterator it(directory, error), end; !error && it != end; it.increment(error)) {
+        auto const& path = it->path();
+        if (path.extension() != ModelExtension || !boost::filesystem::is_regular_file(path)) {
+            continue;
+        }
+        auto keyPath = path;
+        keyPath.replace_extension(KeyExtension);
+        uint64_t size = boost::filesystem::file_size(path) + (boost::filesystem::exists(keyPath) ? boost::filesystem::file_size(keyPath) : 0);
+        entries.push_back({path, size, boost::filesystem::last_write_time(path)});
+        totalSize += size;
+    }
+    if (totalSize <= sizeLimit) {
+        return;
+    }
+    std::sort(entries.begin(), entries.end(), [](Entry const& lhs, Entry const& rhs) { return lhs.lastUse < rhs.lastUse; });
+    for (auto const& entry : entries) {
+        if (totalSize <= sizeLimit) {
+            break;
+        }
+        STORM_LOG_INFO("Evicting build cache entry " << entry.modelPath << ".");
+        remove(entry.modelPath);
+        totalSize -= entry.size;
+    }
+}
+
+void ModelBuildCache::clear() const {
+    std::vector<boost::filesystem::path> modelPaths;
+    boost::system::error_code error;
+    for (boost::filesystem::directory_iterator it(directory, error), end; !error && it != end; it.increment(error)) {
+        if (it->path().extension() == ModelExtension) {
+            modelPaths.push_back(it->path());
+        }
+    }
+    for (auto const& modelPath : modelPaths) {
+        remove(modelPath);
+    }
+}
+
+boost::filesystem::path ModelBuildCache::getModelPath(std::string const& key) const {
+    std::stringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << fnv1a(key) << ModelExtension;
+    return directory / name.str();
+}
+
+boost::filesystem::path ModelBuildCache::getKeyPath(std::string const& key) const {
+    return getModelPath(key).replace_extension(KeyExtension);
+}
+
+void ModelBuildCache::remove(boost::filesystem::path const& modelPath) const {
+    boost::system::error_code error;
+    boost::filesystem::remove(modelPath, error);
+    boost::filesystem::remove(boost::filesystem::path(modelPath).replace_extension(KeyExtension), error);
+}
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace storm {
+namespace utility {
+
+/*!
+ * An on-disk cache for explicitly built models. Each entry is stored in the binary model format (see storm/io/BinaryModelFormat.h) and is identified
+ * by a key that describes everything the built model depends on: the (preprocessed) symbolic model description with its constant definitions, the
+ * builder options, the version of the binary format and further information given by the caller (such as the version of Storm). An entry is only reused if its stored key matches exactly. Once the cache
+ * exceeds its size limit, the least recently used entries are evicted.
+ */
+class ModelBuildCache {
+   public:
+    /*!
+     * Creates a cache in the given directory, which is created if it does not exist.
+     *
+     * @param directory The cache directory.
+     * @param sizeLimit The maximal size (in bytes) of all entries.
+     */
+    ModelBuildCache(std::string const& directory, uint64_t sizeLimit);
+
+    /*!
+     * Computes the key under which the model built from the given description and options is cached.
+     *
+     * @param modelDescription The symbolic model description (after substituting the constants).
+     * @param options The builder options.
+     * @param additionalInformation Further information that influences the resulting model, e.g., the Storm version or the exploration order.
+     */
+    static std::string computeKey(storm::storage::SymbolicModelDescription const& modelDescription, storm::builder::BuilderOptions const& options,
+                                  std::string const& additionalInformation = "");
+
+    /*!
+     * Loads the model with the given key from the cache.
+     *
+     * @param key The key of the model.
+     * @param expressionManager If given, the state valuations of the model are restored using this manager.
+     * @return The model or nullptr if there is no (valid) entry for the key.
+     */
+    std::shared_ptr<storm::models::sparse::Model<double>> load(
+        std::string const& key, std::shared_ptr<storm::expressions::ExpressionManager> const& expressionManager = nullptr) const;
+
+    /*!
+     * Stores the given model in the cache and evicts old entries afterwards if the size limit is exceeded.
+     *
+     * @return True iff the model could be stored.
+     */
+    bool store(std::string const& key, std::shared_ptr<storm::models::sparse::Model<double>> const& model) const;
+
+    /*!
+     * Removes the least recently used entries until the size of the cache does not exceed the size limit.
+     */
+    void enforceSizeLimit() const;
+
+    /*!
+     * Removes all entries of the cache.
+     */
+    void clear() const;
+
+   private:
+    boost::filesystem::path getModelPath(std::string const& key) const;
+    boost::filesystem::path getKeyPath(std::string const& key) const;
+    void remove(boost::filesystem::path const& modelPath) const;
+
+    boost::filesystem::path directory;
+    uint64_t sizeLimit;
+};
+
+}  // namespace utility
+}  // namespace storm
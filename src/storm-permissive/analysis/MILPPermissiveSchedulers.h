@@ -58,6 +58,16 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
         return result;
     }
 
+    std::map<uint_fast64_t, double> getBoundaryValues() const override {
+        STORM_LOG_ASSERT(mCalledOptimizer, "Optimizer not called.");
+        STORM_LOG_ASSERT(foundSolution(), "Solution not found.");
+        std::map<uint_fast64_t, double> result;
+        for (auto const& entry : this->mBoundaryRanges) {
+            result[entry.first] = solver.getContinuousValue(mProbVariables.at(entry.first));
+        }
+        return result;
+    }
+
     void dumpLpSolutionToFile(std::string const& filename) {
         std::fstream filestream;
         filestream.open(filename, std::fstream::out);
@@ -87,7 +97,7 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
     /**
      *  Create variables
      */
-    void createVariables(PermissiveSchedulerPenalties const& penalties, storm::storage::BitVector const& relevantStates) {
+    void createVariables(bool lowerBound, PermissiveSchedulerPenalties const& penalties, storm::storage::BitVector const& relevantStates) {
         // We need the unique initial state later, so we get that one before looping.
         STORM_LOG_ASSERT(this->mdp.getInitialStates().getNumberOfSetBits() == 1, "No unique initial state.");
         uint_fast64_t initialStateIndex = this->mdp.getInitialStates().getNextSetIndex(0);
@@ -127,6 +137,12 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
                 }
             }
         }
+        // Create x_t variables for the boundary states of the subsystem.
+        // Leaving more freedom to the subsystems behind the boundary is rewarded.
+        for (auto const& entry : this->mBoundaryRanges) {
+            mProbVariables[entry.first] = solver.addBoundedContinuousVariable("x_" + std::to_string(entry.first), entry.second.first, entry.second.second,
+                                                                             lowerBound ? 1.0 : -1.0);
+        }
         solver.update();
     }
 
@@ -139,11 +155,23 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
         // (1)
         STORM_LOG_ASSERT(this->mdp.getInitialStates().getNumberOfSetBits() == 1, "No unique initial state.");
         uint_fast64_t initialStateIndex = this->mdp.getInitialStates().getNextSetIndex(0);
-        STORM_LOG_ASSERT(relevantStates[initialStateIndex], "Initial state not relevant.");
-        if (lowerBound) {
-            solver.addConstraint("c1", mProbVariables[initialStateIndex] >= solver.getConstant(boundary));
+        if (this->mSubsystem) {
+            // The thresholds of the subsystem replace the boundary of the initial state.
+            for (auto const& entry : this->mThresholds) {
+                STORM_LOG_ASSERT(relevantStates[entry.first], "State with threshold not relevant.");
+                if (lowerBound) {
+                    solver.addConstraint("c1-" + std::to_string(entry.first), mProbVariables[entry.first] >= solver.getConstant(entry.second));
+                } else {
+                    solver.addConstraint("c1-" + std::to_string(entry.first), mProbVariables[entry.first] <= solver.getConstant(entry.second));
+                }
+            }
         } else {
-            solver.addConstraint("c1", mProbVariables[initialStateIndex] <= solver.getConstant(boundary));
+            STORM_LOG_ASSERT(relevantStates[initialStateIndex], "Initial state not relevant.");
+            if (lowerBound) {
+                solver.addConstraint("c1", mProbVariables[initialStateIndex] >= solver.getConstant(boundary));
+            } else {
+                solver.addConstraint("c1", mProbVariables[initialStateIndex] <= solver.getConstant(boundary));
+            }
         }
         for (uint_fast64_t s : relevantStates) {
             std::string stateString = std::to_string(s);
@@ -156,12 +184,12 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
             // (5)
             solver.addConstraint("c5-" + std::to_string(s), mProbVariables[s] <= mAlphaVariables[s]);
 
-            // (3) For the relevant states.
+            // (3) For the relevant states (and the boundary states of the subsystem).
             for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
                 std::string sastring(stateString + "_" + std::to_string(a));
                 expr = solver.getConstant(0.0);
                 for (auto const& entry : this->mdp.getTransitionMatrix().getRow(this->mdp.getNondeterministicChoiceIndices()[s] + a)) {
-                    if (entry.getValue() != 0 && relevantStates.get(entry.getColumn())) {
+                    if (entry.getValue() != 0 && mProbVariables.count(entry.getColumn()) > 0) {
                         expr = expr + solver.getConstant(entry.getValue()) * mProbVariables[entry.getColumn()];
                     } else if (entry.getValue() != 0 && this->mGoals.get(entry.getColumn())) {
                         expr = expr + solver.getConstant(entry.getValue());
@@ -211,12 +239,11 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
      *
      */
     void createMILP(bool lowerBound, double boundary, PermissiveSchedulerPenalties const& penalties) {
-        storm::storage::BitVector irrelevant = this->mGoals | this->mSinks;
-        storm::storage::BitVector relevantStates = ~irrelevant;
+        storm::storage::BitVector relevantStates = this->getRelevantStates();
         // Notice that the separated construction of variables and
         // constraints slows down the construction of the MILP.
         // In the future, we might want to merge this.
-        createVariables(penalties, relevantStates);
+        createVariables(lowerBound, penalties, relevantStates);
         createConstraints(lowerBound, boundary, relevantStates);
 
         solver.setOptimizationDirection(storm::OptimizationDirection::Minimize);
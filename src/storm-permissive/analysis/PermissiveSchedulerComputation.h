@@ -1,6 +1,9 @@
 #pragma once
 
+#include <boost/optional.hpp>
+#include <map>
 #include <memory>
+#include <utility>
 
 #include "storm-permissive/analysis/PermissiveSchedulerPenalty.h"
 #include "storm-permissive/analysis/PermissiveSchedulers.h"
@@ -17,6 +20,20 @@ class PermissiveSchedulerComputation {
     storm::storage::BitVector const& mGoals;
     storm::storage::BitVector const& mSinks;
     PermissiveSchedulerPenalties mPenalties;
+    boost::optional<storm::storage::BitVector> mSubsystem;
+    std::map<uint_fast64_t, double> mThresholds;
+    std::map<uint_fast64_t, std::pair<double, double>> mBoundaryRanges;
+
+    /*!
+     * Retrieves the states whose choices are encoded, i.e., the states of the subsystem (if any) that are neither goal nor sink states.
+     */
+    storm::storage::BitVector getRelevantStates() const {
+        storm::storage::BitVector relevantStates = ~(mGoals | mSinks);
+        if (mSubsystem) {
+            relevantStates &= mSubsystem.get();
+        }
+        return relevantStates;
+    }
 
    public:
     PermissiveSchedulerComputation(storm::models::sparse::Mdp<double, RM> const& mdp, storm::storage::BitVector const& goalstates,
@@ -27,6 +44,24 @@ class PermissiveSchedulerComputation {
 
     virtual void calculatePermissiveScheduler(bool lowerBound, double boundary) = 0;
 
+    /*!
+     * Restricts the computation to the choices of the given states, e.g. the states of an SCC. Instead of the given boundary for the initial state, the
+     * states of the subsystem then have to satisfy the given thresholds (lower thresholds for lower-bounded properties and upper thresholds otherwise).
+     * The values of the states outside of the subsystem that are reached from it (and that are neither goal nor sink states) are chosen from the given
+     * ranges. For each of these boundary states, the range has to be given and the chosen value can be retrieved once a solution has been found.
+     */
+    void setSubsystem(storm::storage::BitVector const& subsystem, std::map<uint_fast64_t, double> const& thresholds,
+                      std::map<uint_fast64_t, std::pair<double, double>> const& boundaryRanges) {
+        mSubsystem = subsystem;
+        mThresholds = thresholds;
+        mBoundaryRanges = boundaryRanges;
+    }
+
+    /*!
+     * Retrieves the values that were chosen for the boundary states of the subsystem (see setSubsystem).
+     */
+    virtual std::map<uint_fast64_t, double> getBoundaryValues() const = 0;
+
     void setPenalties(PermissiveSchedulerPenalties penalties) {
         mPenalties = penalties;
     }
@@ -1,34 +1,215 @@
 
 #include "PermissiveSchedulers.h"
 
+#include <algorithm>
+#include <limits>
+#include <mutex>
+
 #include "storm-permissive/analysis/MILPPermissiveSchedulers.h"
 #include "storm-permissive/analysis/SmtBasedPermissiveSchedulers.h"
+#include "storm/environment/Environment.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/solver/SolveGoal.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/solver.h"
 
 namespace storm {
 namespace ps {
 
+namespace {
+
+/*
+ * The part of a permissive scheduler that was computed for a single SCC.
+ */
+struct SccSolution {
+    storm::storage::BitVector enabledChoices;
+    std::map<uint_fast64_t, double> boundaryValues;
+};
+
+template<typename RM>
+boost::optional<SccSolution> solveSubsystem(PermissiveSchedulerComputation<RM>& computation, storm::storage::BitVector const& subsystem,
+                                            std::map<uint_fast64_t, double> const& thresholds,
+                                            std::map<uint_fast64_t, std::pair<double, double>> const& boundaryRanges, bool lowerBound) {
+    computation.setSubsystem(subsystem, thresholds, boundaryRanges);
+    // The boundary of the initial state is replaced by the thresholds.
+    computation.calculatePermissiveScheduler(lowerBound, 0.0);
+    if (!computation.foundSolution()) {
+        return boost::none;
+    }
+    return SccSolution{computation.getScheduler().getEnabledChoices(), computation.getBoundaryValues()};
+}
+
+/*
+ * Computes a permissive scheduler by solving one encoding for each SCC of the states that are reachable from the initial state (without passing goal or
+ * sink states). The SCCs are processed top-down, i.e., an SCC is solved once all SCCs from which it is entered are solved (where independent SCCs are
+ * solved in parallel). The states through which an SCC is left are boundary states whose values are chosen by the encoding of the SCC. Their range is
+ * restricted to the values that can be achieved by a single scheduler (i.e., at least the minimal probability for upper bounds and at most the maximal
+ * probability for lower bounds), and the chosen values are thresholds for the SCCs that are entered through them. Choices outside of the reachable SCCs
+ * stay enabled. The resulting scheduler is sound, but it may be less permissive than the one of a monolithic encoding, as the choices of an SCC cannot
+ * depend on the SCCs below it anymore.
+ *
+ * @param solve A function that creates a fresh encoding (and solver) for the given subsystem and solves it.
+ */
+template<typename RM, typename SolveFunction>
+boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerPerScc(storm::models::sparse::Mdp<double, RM> const& mdp,
+                                                                                storm::storage::BitVector const& goalstates,
+                                                                                storm::storage::BitVector const& sinkstates, bool lowerBound,
+                                                                                double boundary, SolveFunction const& solve) {
+    STORM_LOG_ASSERT(mdp.getInitialStates().getNumberOfSetBits() == 1, "No unique initial state.");
+    uint_fast64_t initialStateIndex = mdp.getInitialStates().getNextSetIndex(0);
+    auto const& transitionMatrix = mdp.getTransitionMatrix();
+    storm::storage::BitVector relevantStates = ~(goalstates | sinkstates);
+    if (!relevantStates.get(initialStateIndex)) {
+        // The probability is one (or zero) under all schedulers.
+        double value = goalstates.get(initialStateIndex) ? 1.0 : 0.0;
+        if (lowerBound ? value >= boundary : value <= boundary) {
+            return SubMDPPermissiveScheduler<RM>(mdp, true);
+        }
+        return boost::none;
+    }
+    relevantStates &= storm::utility::graph::getReachableStates(transitionMatrix, mdp.getInitialStates(), relevantStates, ~relevantStates);
+
+    storm::storage::StronglyConnectedComponentDecomposition<double> sccs(
+        transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().subsystem(relevantStates));
+    std::vector<uint64_t> stateToScc(mdp.getNumberOfStates(), std::numeric_limits<uint64_t>::max());
+    for (uint64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+        for (auto state : sccs[sccIndex]) {
+            stateToScc[state] = sccIndex;
+        }
+    }
+
+    // Determine the boundary states of each SCC and the SCCs that are entered through them.
+    std::vector<std::vector<uint_fast64_t>> boundaryStates(sccs.size());
+    std::vector<uint64_t> dependencyCounts(sccs.size(), 0);
+    std::vector<uint64_t> dependentOffsets(1, 0);
+    std::vector<uint64_t> dependents;
+    for (uint64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+        for (auto state : sccs[sccIndex]) {
+            for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+                if (entry.getValue() != 0 && relevantStates.get(entry.getColumn()) && stateToScc[entry.getColumn()] != sccIndex) {
+                    boundaryStates[sccIndex].push_back(entry.getColumn());
+                }
+            }
+        }
+        std::sort(boundaryStates[sccIndex].begin(), boundaryStates[sccIndex].end());
+        boundaryStates[sccIndex].erase(std::unique(boundaryStates[sccIndex].begin(), boundaryStates[sccIndex].end()), boundaryStates[sccIndex].end());
+        uint64_t firstDependent = dependents.size();
+        for (auto state : boundaryStates[sccIndex]) {
+            dependents.push_back(stateToScc[state]);
+        }
+        std::sort(dependents.begin() + firstDependent, dependents.end());
+        dependents.erase(std::unique(dependents.begin() + firstDependent, dependents.end()), dependents.end());
+        for (uint64_t index = firstDependent; index < dependents.size(); ++index) {
+            ++dependencyCounts[dependents[index]];
+        }
+        dependentOffsets.push_back(dependents.size());
+    }
+
+    // The values that can be achieved by a single scheduler bound the values of the boundary states.
+    storm::Environment env;
+    std::vector<double> extremalValues = storm::modelchecker::helper::SparseMdpPrctlHelper<double>::computeUntilProbabilities(
+                                             env, storm::solver::SolveGoal<double>(!lowerBound), transitionMatrix, mdp.getBackwardTransitions(),
+                                             storm::storage::BitVector(mdp.getNumberOfStates(), true), goalstates, false, false)
+                                             .values;
+
+    std::mutex mutex;
+    std::vector<double> thresholds(mdp.getNumberOfStates(), lowerBound ? 0.0 : 1.0);
+    storm::storage::BitVector hasThreshold(mdp.getNumberOfStates(), false);
+    thresholds[initialStateIndex] = boundary;
+    hasThreshold.set(initialStateIndex);
+    storm::storage::BitVector enabledChoices(mdp.getNumberOfChoices(), true);
+    uint64_t numberOfThreads = 1;
+    if (storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+        numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads();
+    }
+    STORM_LOG_DEBUG("Computing permissive scheduler via " << sccs.size() << " SCCs of " << relevantStates.getNumberOfSetBits() << " states.");
+
+    bool foundSolution = storm::utility::parallel::forEachInDependencyOrder(
+        numberOfThreads, dependencyCounts, dependentOffsets, dependents, [&](uint64_t, uint64_t sccIndex) {
+            storm::storage::BitVector subsystem(mdp.getNumberOfStates(), false);
+            std::map<uint_fast64_t, double> sccThresholds;
+            std::map<uint_fast64_t, std::pair<double, double>> boundaryRanges;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                for (auto state : sccs[sccIndex]) {
+                    subsystem.set(state);
+                    if (hasThreshold.get(state)) {
+                        sccThresholds[state] = thresholds[state];
+                    }
+                }
+            }
+            for (auto state : boundaryStates[sccIndex]) {
+                boundaryRanges[state] = lowerBound ? std::make_pair(0.0, extremalValues[state]) : std::make_pair(extremalValues[state], 1.0);
+            }
+
+            boost::optional<SccSolution> solution = solve(subsystem, sccThresholds, boundaryRanges);
+            if (!solution) {
+                STORM_LOG_INFO("No permissive scheduler for SCC " << sccIndex << " satisfies the thresholds of its entry states.");
+                return false;
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            enabledChoices &= solution->enabledChoices;
+            for (auto const& entry : solution->boundaryValues) {
+                // If an SCC is entered from several SCCs, it has to satisfy the strictest threshold.
+                if (!hasThreshold.get(entry.first)) {
+                    thresholds[entry.first] = entry.second;
+                    hasThreshold.set(entry.first);
+                } else {
+                    thresholds[entry.first] = lowerBound ? std::max(thresholds[entry.first], entry.second) : std::min(thresholds[entry.first], entry.second);
+                }
+            }
+            return true;
+        });
+
+    if (!foundSolution) {
+        return boost::none;
+    }
+    SubMDPPermissiveScheduler<RM> result(mdp, true);
+    for (auto choice : ~enabledChoices) {
+        result.disable(choice);
+    }
+    return result;
+}
+
+}  // namespace
+
 template<typename RM>
 boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaMILP(storm::models::sparse::Mdp<double, RM> const& mdp,
-                                                                                 storm::logic::ProbabilityOperatorFormula const& safeProp) {
+                                                                                 storm::logic::ProbabilityOperatorFormula const& safeProp,
+                                                                                 bool decomposeIntoSccs) {
     storm::modelchecker::SparsePropositionalModelChecker<storm::models::sparse::Mdp<double, RM>> propMC(mdp);
     STORM_LOG_ASSERT(safeProp.getSubformula().isEventuallyFormula(), "No eventually formula.");
-    auto backwardTransitions = mdp.getBackwardTransitions();
+    auto const& backwardTransitions = mdp.getBackwardTransitions();
     storm::storage::BitVector goalstates =
         propMC.check(safeProp.getSubformula().asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
     goalstates = storm::utility::graph::performProb1A(mdp, backwardTransitions, storm::storage::BitVector(goalstates.size(), true), goalstates);
     storm::storage::BitVector sinkstates =
         storm::utility::graph::performProb0A(backwardTransitions, storm::storage::BitVector(goalstates.size(), true), goalstates);
 
+    STORM_LOG_THROW(!storm::logic::isStrict(safeProp.getComparisonType()), storm::exceptions::NotImplementedException, "Strict bounds are not supported");
+    if (decomposeIntoSccs) {
+        bool lowerBound = storm::logic::isLowerBound(safeProp.getComparisonType());
+        return computePermissiveSchedulerPerScc(
+            mdp, goalstates, sinkstates, lowerBound, safeProp.getThresholdAs<double>(),
+            [&](storm::storage::BitVector const& subsystem, std::map<uint_fast64_t, double> const& thresholds,
+                std::map<uint_fast64_t, std::pair<double, double>> const& boundaryRanges) {
+                auto solver = storm::utility::solver::getLpSolver<double>("Gurobi", storm::solver::LpSolverTypeSelection::Gurobi);
+                MilpPermissiveSchedulerComputation<RM> comp(*solver, mdp, goalstates, sinkstates);
+                return solveSubsystem(comp, subsystem, thresholds, boundaryRanges, lowerBound);
+            });
+    }
+
     auto solver = storm::utility::solver::getLpSolver<double>("Gurobi", storm::solver::LpSolverTypeSelection::Gurobi);
     MilpPermissiveSchedulerComputation<storm::models::sparse::StandardRewardModel<double>> comp(*solver, mdp, goalstates, sinkstates);
-    STORM_LOG_THROW(!storm::logic::isStrict(safeProp.getComparisonType()), storm::exceptions::NotImplementedException, "Strict bounds are not supported");
     comp.calculatePermissiveScheduler(storm::logic::isLowerBound(safeProp.getComparisonType()), safeProp.getThresholdAs<double>());
     // comp.dumpLpToFile("milpdump.lp");
     std::cout << "Found Solution: " << (comp.foundSolution() ? "yes" : "no") << '\n';
@@ -45,20 +226,35 @@ boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaMC(s
 
 template<typename RM>
 boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaSMT(storm::models::sparse::Mdp<double, RM> const& mdp,
-                                                                                storm::logic::ProbabilityOperatorFormula const& safeProp) {
+                                                                                storm::logic::ProbabilityOperatorFormula const& safeProp,
+                                                                                bool decomposeIntoSccs) {
     storm::modelchecker::SparsePropositionalModelChecker<storm::models::sparse::Mdp<double, RM>> propMC(mdp);
     STORM_LOG_ASSERT(safeProp.getSubformula().isEventuallyFormula(), "No eventually formula.");
-    auto backwardTransitions = mdp.getBackwardTransitions();
+    auto const& backwardTransitions = mdp.getBackwardTransitions();
     storm::storage::BitVector goalstates =
         propMC.check(safeProp.getSubformula().asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
     goalstates = storm::utility::graph::performProb1A(mdp, backwardTransitions, storm::storage::BitVector(goalstates.size(), true), goalstates);
     storm::storage::BitVector sinkstates =
         storm::utility::graph::performProb0A(backwardTransitions, storm::storage::BitVector(goalstates.size(), true), goalstates);
 
+    STORM_LOG_THROW(!storm::logic::isStrict(safeProp.getComparisonType()), storm::exceptions::NotImplementedException, "Strict bounds are not supported");
+    if (decomposeIntoSccs) {
+        bool lowerBound = storm::logic::isLowerBound(safeProp.getComparisonType());
+        return computePermissiveSchedulerPerScc(
+            mdp, goalstates, sinkstates, lowerBound, safeProp.getThresholdAs<double>(),
+            [&](storm::storage::BitVector const& subsystem, std::map<uint_fast64_t, double> const& thresholds,
+                std::map<uint_fast64_t, std::pair<double, double>> const& boundaryRanges) {
+                // Every encoding gets its own expression manager, so the SCCs can be solved concurrently.
+                storm::expressions::ExpressionManager expressionManager;
+                auto solver = storm::utility::solver::getSmtSolver(expressionManager);
+                SmtPermissiveSchedulerComputation<RM> comp(*solver, mdp, goalstates, sinkstates);
+                return solveSubsystem(comp, subsystem, thresholds, boundaryRanges, lowerBound);
+            });
+    }
+
     std::shared_ptr<storm::expressions::ExpressionManager> expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
     auto solver = storm::utility::solver::getSmtSolver(*expressionManager);
     SmtPermissiveSchedulerComputation<storm::models::sparse::StandardRewardModel<double>> comp(*solver, mdp, goalstates, sinkstates);
-    STORM_LOG_THROW(!storm::logic::isStrict(safeProp.getComparisonType()), storm::exceptions::NotImplementedException, "Strict bounds are not supported");
     comp.calculatePermissiveScheduler(storm::logic::isLowerBound(safeProp.getComparisonType()), safeProp.getThresholdAs<double>());
     if (comp.foundSolution()) {
         return boost::optional<SubMDPPermissiveScheduler<RM>>(comp.getScheduler());
@@ -69,9 +265,11 @@ boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaSMT(
 }
 
 template boost::optional<SubMDPPermissiveScheduler<>> computePermissiveSchedulerViaMILP(storm::models::sparse::Mdp<double> const& mdp,
-                                                                                        storm::logic::ProbabilityOperatorFormula const& safeProp);
+                                                                                        storm::logic::ProbabilityOperatorFormula const& safeProp,
+                                                                                        bool decomposeIntoSccs);
 template boost::optional<SubMDPPermissiveScheduler<>> computePermissiveSchedulerViaSMT(storm::models::sparse::Mdp<double> const& mdp,
-                                                                                       storm::logic::ProbabilityOperatorFormula const& safeProp);
+                                                                                       storm::logic::ProbabilityOperatorFormula const& safeProp,
+                                                                                       bool decomposeIntoSccs);
 
 }  // namespace ps
 }  // namespace storm
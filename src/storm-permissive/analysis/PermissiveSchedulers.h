@@ -35,6 +35,10 @@ class SubMDPPermissiveScheduler : public PermissiveScheduler {
         enabledChoices.set(choiceIndex, false);
     }
 
+    storm::storage::BitVector const& getEnabledChoices() const {
+        return enabledChoices;
+    }
+
     storm::models::sparse::Mdp<double, RM> apply() const {
         storm::transformer::ChoiceSelector<double, RM> cs(mdp);
         return *(cs.transform(enabledChoices)->template as<storm::models::sparse::Mdp<double, RM>>());
@@ -73,12 +77,28 @@ class SubMDPPermissiveScheduler : public PermissiveScheduler {
     }
 };
 
+/*!
+ * Computes a permissive scheduler for the given probability operator formula by solving an MILP.
+ *
+ * @param decomposeIntoSccs If set, one (smaller) MILP is solved for each SCC of the states that are reachable from the initial state. The SCCs are
+ * solved top-down (independent SCCs in parallel), where the values chosen for the states through which an SCC is left become thresholds for the SCCs
+ * entered through them. The result satisfies the property, but may be less permissive than the one of the single MILP over all state-action pairs that
+ * is solved otherwise.
+ */
 template<typename RM = storm::models::sparse::StandardRewardModel<double>>
 boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaMILP(storm::models::sparse::Mdp<double, RM> const& mdp,
-                                                                                 storm::logic::ProbabilityOperatorFormula const& safeProp);
+                                                                                 storm::logic::ProbabilityOperatorFormula const& safeProp,
+                                                                                 bool decomposeIntoSccs = false);
 
+/*!
+ * Computes a permissive scheduler for the given probability operator formula with an SMT solver.
+ *
+ * @param decomposeIntoSccs If set, one (smaller) encoding is solved for each SCC of the states that are reachable from the initial state (as for
+ * computePermissiveSchedulerViaMILP). Otherwise, a single encoding over all state-action pairs is solved.
+ */
 template<typename RM>
 boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaSMT(storm::models::sparse::Mdp<double, RM> const& mdp,
-                                                                                storm::logic::ProbabilityOperatorFormula const& safeProp);
+                                                                                storm::logic::ProbabilityOperatorFormula const& safeProp,
+                                                                                bool decomposeIntoSccs = false);
 }  // namespace ps
 }  // namespace storm
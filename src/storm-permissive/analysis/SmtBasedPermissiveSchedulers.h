@@ -1,5 +1,7 @@
 #pragma once
 
+#include <map>
+
 #include "storm/solver/SmtSolver.h"
 
 namespace storm {
@@ -18,6 +20,7 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
     std::unordered_map<uint_fast64_t, storm::expressions::Variable> mAlphaVariables;
     std::unordered_map<storm::storage::StateActionTarget, storm::expressions::Variable> mBetaVariables;
     std::unordered_map<uint_fast64_t, storm::expressions::Variable> mGammaVariables;
+    std::map<uint_fast64_t, double> mBoundaryValues;
 
    public:
     SmtPermissiveSchedulerComputation(storm::solver::SmtSolver& smtSolver, storm::models::sparse::Mdp<double, RM> const& mdp,
@@ -38,6 +41,11 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
         return mFoundSolution;
     }
 
+    std::map<uint_fast64_t, double> getBoundaryValues() const override {
+        STORM_LOG_ASSERT(foundSolution(), "Solution not found.");
+        return mBoundaryValues;
+    }
+
     SubMDPPermissiveScheduler<RM> getScheduler() const override {
         STORM_LOG_ASSERT(foundSolution(), "Solution not found.");
         SubMDPPermissiveScheduler<RM> result(this->mdp, true);
@@ -88,6 +96,13 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
                 }
             }
         }
+        // Create x_t variables for the boundary states of the subsystem.
+        for (auto const& entry : this->mBoundaryRanges) {
+            var = manager.declareRationalVariable("x_" + std::to_string(entry.first));
+            solver.add(var >= manager.rational(entry.second.first));
+            solver.add(var <= manager.rational(entry.second.second));
+            mProbVariables[entry.first] = var;
+        }
     }
 
     /**
@@ -99,11 +114,23 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
         // (1)
         STORM_LOG_ASSERT(this->mdp.getInitialStates().getNumberOfSetBits() == 1, "No unique initial state.");
         uint_fast64_t initialStateIndex = this->mdp.getInitialStates().getNextSetIndex(0);
-        STORM_LOG_ASSERT(relevantStates[initialStateIndex], "Initial state not relevant.");
-        if (lowerBound) {
-            solver.add(mProbVariables[initialStateIndex] >= manager.rational(boundary));
+        if (this->mSubsystem) {
+            // The thresholds of the subsystem replace the boundary of the initial state.
+            for (auto const& entry : this->mThresholds) {
+                STORM_LOG_ASSERT(relevantStates[entry.first], "State with threshold not relevant.");
+                if (lowerBound) {
+                    solver.add(mProbVariables[entry.first] >= manager.rational(entry.second));
+                } else {
+                    solver.add(mProbVariables[entry.first] <= manager.rational(entry.second));
+                }
+            }
         } else {
-            solver.add(mProbVariables[initialStateIndex] <= manager.rational(boundary));
+            STORM_LOG_ASSERT(relevantStates[initialStateIndex], "Initial state not relevant.");
+            if (lowerBound) {
+                solver.add(mProbVariables[initialStateIndex] >= manager.rational(boundary));
+            } else {
+                solver.add(mProbVariables[initialStateIndex] <= manager.rational(boundary));
+            }
         }
         for (uint_fast64_t s : relevantStates) {
             std::string stateString = std::to_string(s);
@@ -121,12 +148,12 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
                 //                        solver.addConstraint("c5-" + std::to_string(s), mProbVariables[s] <= mAlphaVariables[s]);
             }
 
-            // (3) For the relevant states.
+            // (3) For the relevant states (and the boundary states of the subsystem).
             for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
                 std::string sastring(stateString + "_" + std::to_string(a));
 
                 for (auto const& entry : this->mdp.getTransitionMatrix().getRow(this->mdp.getNondeterministicChoiceIndices()[s] + a)) {
-                    if (entry.getValue() != 0 && relevantStates.get(entry.getColumn())) {
+                    if (entry.getValue() != 0 && mProbVariables.count(entry.getColumn()) > 0) {
                         expressions.push_back(manager.rational(entry.getValue()) * mProbVariables[entry.getColumn()]);
                     } else if (entry.getValue() != 0 && this->mGoals.get(entry.getColumn())) {
                         expressions.push_back(manager.rational(entry.getValue()));
@@ -184,8 +211,7 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
      *
      */
     void performSmtLoop(bool lowerBound, double boundary, PermissiveSchedulerPenalties const& penalties) {
-        storm::storage::BitVector irrelevant = this->mGoals | this->mSinks;
-        storm::storage::BitVector relevantStates = ~irrelevant;
+        storm::storage::BitVector relevantStates = this->getRelevantStates();
         createVariables(relevantStates);
         createConstraints(lowerBound, boundary, relevantStates);
 
@@ -219,7 +245,7 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
                           return penalties.get(first) < penalties.get(second);
                       });
 
-            do {
+            while (!availableStateActionPairs.empty()) {
                 auto multistrategyVariable = multistrategyVariables.at(availableStateActionPairs.back());
 
                 result = solver.checkWithAssumptions({multistrategyVariable});
@@ -232,8 +258,17 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
                     }
                 }
                 availableStateActionPairs.pop_back();
+            }
 
-            } while (!availableStateActionPairs.empty());
+            if (!this->mBoundaryRanges.empty()) {
+                // All taken choices are asserted, so the values of the boundary states of a model are compatible with all of them.
+                result = solver.check();
+                STORM_LOG_ASSERT(result == storm::solver::SmtSolver::CheckResult::Sat, "Taken choices are inconsistent.");
+                model = solver.getModel();
+                for (auto const& entry : this->mBoundaryRanges) {
+                    mBoundaryValues[entry.first] = model->getRationalValue(mProbVariables.at(entry.first));
+                }
+            }
 
             mFoundSolution = true;
         } else {
@@ -16,6 +16,7 @@ const std::string BeliefExplorationSettings::moduleName = "beliefExploration";
 
 const std::string refineOption = "refine";
 const std::string explorationTimeLimitOption = "exploration-time";
+const std::string explorationThreadsOption = "exploration-threads";
 const std::string resolutionOption = "resolution";
 const std::string clipGridResolutionOption = "clip-resolution";
 const std::string sizeThresholdOption = "size-threshold";
@@ -48,6 +49,21 @@ BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleNa
             .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "In seconds.").setDefaultValueUnsignedInteger(0).build())
             .build());
 
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, explorationThreadsOption, false,
+                                       "Sets the number of threads that compute the successor beliefs of the states that are to be explored next.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                             .setDefaultValueUnsignedInteger(1)
+                             .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                             .build())
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("batch", "The number of states whose successors are computed at once.")
+                             .setDefaultValueUnsignedInteger(256)
+                             .makeOptional()
+                             .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                             .build())
+            .build());
+
     this->addOption(
         storm::settings::OptionBuilder(moduleName, resolutionOption, false,
                                        "Sets the resolution of the discretization and how it is increased in case of refinement")
@@ -181,6 +197,14 @@ uint64_t BeliefExplorationSettings::getExplorationTimeLimit() const {
     return this->getOption(explorationTimeLimitOption).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+uint64_t BeliefExplorationSettings::getExplorationThreads() const {
+    return this->getOption(explorationThreadsOption).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t BeliefExplorationSettings::getExplorationBatchSize() const {
+    return this->getOption(explorationThreadsOption).getArgumentByName("batch").getValueAsUnsignedInteger();
+}
+
 uint64_t BeliefExplorationSettings::getResolutionInit() const {
     return this->getOption(resolutionOption).getArgumentByName("init").getValueAsUnsignedInteger();
 }
@@ -255,6 +279,8 @@ void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchec
     options.refinePrecision = storm::utility::convertNumber<ValueType>(getRefinePrecision());
     options.refineStepLimit = getRefineStepLimit();
     options.explorationTimeLimit = getExplorationTimeLimit();
+    options.explorationThreads = getExplorationThreads();
+    options.explorationBatchSize = getExplorationBatchSize();
 
     options.clippingGridRes = getClippingGridResolution();
     options.resolutionInit = getResolutionInit();
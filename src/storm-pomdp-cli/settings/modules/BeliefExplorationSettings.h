@@ -39,6 +39,10 @@ class BeliefExplorationSettings : public ModuleSettings {
 
     uint64_t getExplorationTimeLimit() const;
 
+    /// Parallel computation of successor beliefs
+    uint64_t getExplorationThreads() const;
+    uint64_t getExplorationBatchSize() const;
+
     /// Discretization Resolution
     uint64_t getResolutionInit() const;
     double getResolutionFactor() const;
@@ -285,7 +285,13 @@ bool performAnalysis(std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> co
             } else {
                 STORM_PRINT_AND_LOG("\nResult: ");
             }
-            printResult(result.getMin(), result.getMax());
+            if (result.hasBounds() && pomdp->getInitialStates().getNumberOfSetBits() == 1) {
+                // The solver was aborted but provides sound bounds for the initial state.
+                uint64_t initialState = *pomdp->getInitialStates().begin();
+                printResult(result.getLowerBound(initialState), result.getUpperBound(initialState));
+            } else {
+                printResult(result.getMin(), result.getMax());
+            }
             STORM_PRINT_AND_LOG('\n');
         } else {
             STORM_PRINT_AND_LOG("\nResult: Not available.\n");
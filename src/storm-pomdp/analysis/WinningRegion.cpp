@@ -14,17 +14,20 @@ namespace pomdp {
 WinningRegion::WinningRegion(std::vector<uint64_t> const& observationSizes) : observationSizes(observationSizes) {
     for (uint64_t i = 0; i < observationSizes.size(); ++i) {
         winningRegion.push_back(std::vector<storm::storage::BitVector>());
+        winningOffsets.emplace_back(observationSizes[i], false);
     }
 }
 
 void WinningRegion::setObservationIsWinning(uint64_t observation) {
     winningRegion[observation] = {storm::storage::BitVector(observationSizes[observation], true)};
+    winningOffsets[observation] = storm::storage::BitVector(observationSizes[observation], true);
 }
 
 void WinningRegion::addTargetStates(uint64_t observation, storm::storage::BitVector const& offsets) {
     assert(!offsets.empty());
     if (winningRegion[observation].empty()) {
         winningRegion[observation].push_back(offsets);
+        winningOffsets[observation] |= offsets;
         return;
     }
     std::vector<storm::storage::BitVector> newWinningSupport = std::vector<storm::storage::BitVector>();
@@ -56,6 +59,8 @@ bool WinningRegion::update(uint64_t observation, storm::storage::BitVector const
         }
     }
 
+    // The new support covers all supports it replaces, so the union only grows.
+    winningOffsets[observation] |= winning;
     // only if changed.
     if (changed) {
         newWinningSupport.push_back(winning);
@@ -67,7 +72,10 @@ bool WinningRegion::update(uint64_t observation, storm::storage::BitVector const
 }
 
 bool WinningRegion::query(uint64_t observation, storm::storage::BitVector const& currently) const {
-    for (storm::storage::BitVector winning : winningRegion[observation]) {
+    if (!currently.isSubsetOf(winningOffsets[observation])) {
+        return false;
+    }
+    for (auto const& winning : winningRegion[observation]) {
         if (currently.isSubsetOf(winning)) {
             return true;
         }
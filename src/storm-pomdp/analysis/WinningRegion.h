@@ -45,6 +45,9 @@ class WinningRegion {
 
    private:
     std::vector<std::vector<storm::storage::BitVector>> winningRegion;
+    // For each observation, the union of its winning supports. A support that is not contained in this union is not winning, which rejects most
+    // queries without considering the individual supports.
+    std::vector<storm::storage::BitVector> winningOffsets;
     std::vector<uint64_t> observationSizes;
 };
 }  // namespace pomdp
@@ -12,7 +12,9 @@ WinningRegionQueryInterface<ValueType>::WinningRegionQueryInterface(storm::model
     for (uint64_t observation = 0; observation < nrObservations; ++observation) {
         statesPerObservation.push_back(std::vector<uint64_t>());
     }
+    stateToOffset.reserve(pomdp.getNumberOfStates());
     for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+        stateToOffset.push_back(statesPerObservation[pomdp.getObservation(state)].size());
         statesPerObservation[pomdp.getObservation(state)].push_back(state);
     }
 }
@@ -21,19 +23,10 @@ template<typename ValueType>
 bool WinningRegionQueryInterface<ValueType>::isInWinningRegion(storm::storage::BitVector const& beliefSupport) const {
     STORM_LOG_ASSERT(beliefSupport.getNumberOfSetBits() > 0, "One cannot think one is literally nowhere");
     uint64_t observation = pomdp.getObservation(beliefSupport.getNextSetIndex(0));
-    // TODO consider optimizations after testing.
     storm::storage::BitVector queryVector(statesPerObservation[observation].size());
-    auto stateWithObsIt = statesPerObservation[observation].begin();
-    uint64_t offset = 0;
     for (uint64_t possibleState : beliefSupport) {
         STORM_LOG_ASSERT(pomdp.getObservation(possibleState) == observation, "Support must be observation-consistent");
-        while (possibleState > *stateWithObsIt) {
-            stateWithObsIt++;
-            offset++;
-        }
-        if (possibleState == *stateWithObsIt) {
-            queryVector.set(offset);
-        }
+        queryVector.set(stateToOffset[possibleState]);
     }
     return winningRegion.query(observation, queryVector);
 }
@@ -41,6 +34,7 @@ bool WinningRegionQueryInterface<ValueType>::isInWinningRegion(storm::storage::B
 template<typename ValueType>
 bool WinningRegionQueryInterface<ValueType>::staysInWinningRegion(storm::storage::BitVector const& currentBeliefSupport, uint64_t actionIndex) const {
     STORM_LOG_ASSERT(currentBeliefSupport.getNumberOfSetBits() > 0, "One cannot think one is literally nowhere");
+    // The successor supports are directly collected as offsets within their observation, which avoids vectors over all states of the POMDP.
     std::map<uint32_t, storm::storage::BitVector> successors;
     STORM_LOG_DEBUG("Stays in winning region? (" << currentBeliefSupport << ", " << actionIndex << ")");
     for (uint64_t oldState : currentBeliefSupport) {
@@ -48,19 +42,20 @@ bool WinningRegionQueryInterface<ValueType>::staysInWinningRegion(storm::storage
         for (auto const& successor : pomdp.getTransitionMatrix().getRow(row)) {
             assert(!storm::utility::isZero(successor.getValue()));
             uint32_t obs = pomdp.getObservation(successor.getColumn());
-            if (successors.count(obs) == 0) {
-                successors[obs] = storm::storage::BitVector(pomdp.getNumberOfStates());
+            auto successorIt = successors.find(obs);
+            if (successorIt == successors.end()) {
+                successorIt = successors.emplace(obs, storm::storage::BitVector(statesPerObservation[obs].size())).first;
             }
-            successors[obs].set(successor.getColumn(), true);
+            successorIt->second.set(stateToOffset[successor.getColumn()], true);
         }
     }
 
     for (auto const& entry : successors) {
-        if (!isInWinningRegion(entry.second)) {
-            STORM_LOG_DEBUG("Belief support " << entry.second << " (obs " << entry.first << ") is not winning");
+        if (!winningRegion.query(entry.first, entry.second)) {
+            STORM_LOG_DEBUG("Belief support with offsets " << entry.second << " (obs " << entry.first << ") is not winning");
             return false;
         } else {
-            STORM_LOG_DEBUG("Belief support " << entry.second << " (obs " << entry.first << ") is winning");
+            STORM_LOG_DEBUG("Belief support with offsets " << entry.second << " (obs " << entry.first << ") is winning");
         }
     }
     return true;
@@ -22,6 +22,8 @@ class WinningRegionQueryInterface {
     WinningRegion const& winningRegion;
     // TODO consider sharing this.
     std::vector<std::vector<uint64_t>> statesPerObservation;
+    // The position of each state among the states with the same observation.
+    std::vector<uint64_t> stateToOffset;
 };
 }  // namespace pomdp
 }  // namespace storm
\ No newline at end of file
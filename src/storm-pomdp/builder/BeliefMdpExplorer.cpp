@@ -9,6 +9,7 @@
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/Scheduler.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/jani/Property.h"
 #include "storm/utility/SignalHandler.h"
@@ -78,6 +79,7 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::startNewExploration(std::opt
     optimalChoices = std::nullopt;
     optimalChoicesReachableMdpStates = std::nullopt;
     scheduler = nullptr;
+    previousSchedulerChoices.clear();
     exploredMdp = nullptr;
     internalAddRowGroupIndex();  // Mark the start of the first row group
 
@@ -133,6 +135,16 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::restartExploration() {
     clippingTransitionRewards.clear();
     previousChoiceIndices = exploredMdp->getNondeterministicChoiceIndices();
     exploredChoiceIndices = exploredMdp->getNondeterministicChoiceIndices();
+    previousSchedulerChoices.clear();
+    if (scheduler) {
+        // Keep the choices of the scheduler as the states of the old MDP are not renumbered during the exploration.
+        previousSchedulerChoices.reserve(exploredMdp->getNumberOfStates());
+        for (uint64_t state = 0; state < exploredMdp->getNumberOfStates(); ++state) {
+            auto const &choice = scheduler->getChoice(state);
+            previousSchedulerChoices.push_back(choice.isDefined() && choice.isDeterministic() ? choice.getDeterministicChoice()
+                                                                                              : std::numeric_limits<uint64_t>::max());
+        }
+    }
     mdpActionRewards.clear();
     probabilityEstimation.clear();
     if (exploredMdp->hasRewardModel()) {
@@ -216,6 +228,7 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::restoreExplorationState() {
     optimalChoicesReachableMdpStates = std::nullopt;
     exploredMdp = nullptr;
     scheduler = nullptr;
+    previousSchedulerChoices.clear();
 }
 
 template<typename PomdpType, typename BeliefValueType>
@@ -235,6 +248,19 @@ std::vector<uint64_t> BeliefMdpExplorer<PomdpType, BeliefValueType>::getUnexplor
     return res;
 }
 
+template<typename PomdpType, typename BeliefValueType>
+std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId> BeliefMdpExplorer<PomdpType, BeliefValueType>::getNextUnexploredBeliefs(
+    uint64_t maximalNumberOfBeliefs) const {
+    STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+    std::vector<BeliefId> res;
+    res.reserve(std::min<uint64_t>(maximalNumberOfBeliefs, mdpStatesToExplorePrioState.size()));
+    // exploreNextState always pops the last entry of the queue.
+    for (auto it = mdpStatesToExplorePrioState.rbegin(); it != mdpStatesToExplorePrioState.rend() && res.size() < maximalNumberOfBeliefs; ++it) {
+        res.push_back(mdpStateToBeliefIdMap[it->second]);
+    }
+    return res;
+}
+
 template<typename PomdpType, typename BeliefValueType>
 typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId BeliefMdpExplorer<PomdpType, BeliefValueType>::exploreNextState() {
     STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
@@ -782,6 +808,10 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::dropUnexploredStates() {
     storm::utility::vector::filterVectorInPlace(lowerValueBounds, relevantMdpStates);
     storm::utility::vector::filterVectorInPlace(upperValueBounds, relevantMdpStates);
     storm::utility::vector::filterVectorInPlace(values, relevantMdpStates);
+    if (!previousSchedulerChoices.empty()) {
+        previousSchedulerChoices.resize(relevantMdpStates.size(), std::numeric_limits<uint64_t>::max());
+        storm::utility::vector::filterVectorInPlace(previousSchedulerChoices, relevantMdpStates);
+    }
 
     {  // mdpStateToChoiceLabelsMap
         if (!mdpStateToChoiceLabelsMap.empty()) {
@@ -1085,12 +1115,34 @@ BeliefMdpExplorer<PomdpType, BeliefValueType>::createStandardCheckTask(std::shar
     auto task = storm::api::createTask<ValueType>(property, false);
     auto hint = storm::modelchecker::ExplicitModelCheckerHint<ValueType>();
     hint.setResultHint(values);
+    if (!previousSchedulerChoices.empty()) {
+        hint.setSchedulerHint(createSchedulerHint());
+    }
     auto hintPtr = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>(hint);
     task.setHint(hintPtr);
     task.setProduceSchedulers();
     return task;
 }
 
+template<typename PomdpType, typename BeliefValueType>
+storm::storage::Scheduler<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::ValueType>
+BeliefMdpExplorer<PomdpType, BeliefValueType>::createSchedulerHint() const {
+    STORM_LOG_ASSERT(exploredMdp, "Tried to create a scheduler hint but the MDP is not explored");
+    storm::storage::Scheduler<ValueType> schedulerHint(exploredMdp->getNumberOfStates());
+    uint64_t numberOfReusedChoices = 0;
+    for (uint64_t state = 0; state < exploredMdp->getNumberOfStates(); ++state) {
+        // The actions of a state might have been adjusted since the last check. The model checker only uses the hint if it is valid.
+        if (state < previousSchedulerChoices.size() && previousSchedulerChoices[state] < exploredMdp->getTransitionMatrix().getRowGroupSize(state)) {
+            schedulerHint.setChoice(previousSchedulerChoices[state], state);
+            ++numberOfReusedChoices;
+        } else {
+            schedulerHint.setChoice(0, state);
+        }
+    }
+    STORM_LOG_DEBUG("Scheduler hint reuses the choices of " << numberOfReusedChoices << " of " << exploredMdp->getNumberOfStates() << " states.");
+    return schedulerHint;
+}
+
 template<typename PomdpType, typename BeliefValueType>
 typename BeliefMdpExplorer<PomdpType, BeliefValueType>::MdpStateType BeliefMdpExplorer<PomdpType, BeliefValueType>::getCurrentMdpState() const {
     STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
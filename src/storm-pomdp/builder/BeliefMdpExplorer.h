@@ -63,6 +63,11 @@ class BeliefMdpExplorer {
 
     std::vector<uint64_t> getUnexploredStates();
 
+    /*!
+     * Retrieves the beliefs of (at most) the given number of unexplored states in the order in which they are explored if no further state is queued.
+     */
+    std::vector<BeliefId> getNextUnexploredBeliefs(uint64_t maximalNumberOfBeliefs) const;
+
     BeliefId exploreNextState();
 
     void addChoiceLabelToCurrentState(uint64_t const &localActionIndex, std::string const &label);
@@ -262,6 +267,12 @@ class BeliefMdpExplorer {
 
     storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property);
 
+    /*!
+     * Creates a scheduler hint for the explored MDP that takes the choices of the previously computed scheduler where possible and the first choice
+     * at all other states.
+     */
+    storm::storage::Scheduler<ValueType> createSchedulerHint() const;
+
     MdpStateType getCurrentMdpState() const;
 
     MdpStateType getCurrentBeliefId() const;
@@ -318,6 +329,8 @@ class BeliefMdpExplorer {
     std::optional<storm::storage::BitVector> optimalChoices;
     std::optional<storm::storage::BitVector> optimalChoicesReachableMdpStates;
     std::shared_ptr<storm::storage::Scheduler<ValueType>> scheduler;
+    // The choices of the scheduler that was computed for the previously checked MDP (if any). Used as a scheduler hint when checking the next MDP.
+    std::vector<uint64_t> previousSchedulerChoices;
 
     // The current status of this explorer
     ExplorationHeuristic explHeuristic;
@@ -0,0 +1,130 @@
+#include "storm-pomdp/generator/BatchedBeliefTracker.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace generator {
+
+template<typename ValueType, typename BeliefState>
+storm::utility::Stopwatch::NanosecondType BatchedBeliefTracker<ValueType, BeliefState>::Statistics::getAverageLatency() const {
+    return numberOfUpdates == 0 ? 0 : totalLatency / static_cast<storm::utility::Stopwatch::NanosecondType>(numberOfUpdates);
+}
+
+template<typename ValueType, typename BeliefState>
+void BatchedBeliefTracker<ValueType, BeliefState>::Statistics::add(Statistics const& other) {
+    numberOfUpdates += other.numberOfUpdates;
+    totalLatency += other.totalLatency;
+    maxLatency = std::max(maxLatency, other.maxLatency);
+}
+
+template<typename ValueType, typename BeliefState>
+BatchedBeliefTracker<ValueType, BeliefState>::BatchedBeliefTracker(storm::models::sparse::Pomdp<ValueType> const& pomdp, uint64_t numberOfTraces,
+                                                                   typename NondeterministicBeliefTracker<ValueType, BeliefState>::Options options,
+                                                                   uint64_t numberOfThreads)
+    : numberOfThreads(numberOfThreads) {
+    // Every tracker has its own manager, so the traces do not share any mutable state.
+    trackers.reserve(numberOfTraces);
+    for (uint64_t trace = 0; trace < numberOfTraces; ++trace) {
+        trackers.emplace_back(pomdp, options);
+    }
+}
+
+template<typename ValueType, typename BeliefState>
+storm::storage::BitVector BatchedBeliefTracker<ValueType, BeliefState>::reset(std::vector<uint32_t> const& observations) {
+    STORM_LOG_THROW(observations.size() == trackers.size(), storm::exceptions::InvalidArgumentException,
+                    "Expected " << trackers.size() << " observations but got " << observations.size() << ".");
+    storm::storage::BitVector result(trackers.size());
+    for (uint64_t trace = 0; trace < trackers.size(); ++trace) {
+        result.set(trace, trackers[trace].reset(observations[trace]));
+    }
+    return result;
+}
+
+template<typename ValueType, typename BeliefState>
+storm::storage::BitVector BatchedBeliefTracker<ValueType, BeliefState>::track(std::vector<uint64_t> const& newObservations) {
+    STORM_LOG_THROW(newObservations.size() == trackers.size(), storm::exceptions::InvalidArgumentException,
+                    "Expected " << trackers.size() << " observations but got " << newObservations.size() << ".");
+    // The results are written to bytes as concurrent writes to bits of the same bucket would race.
+    std::vector<uint8_t> consistent(trackers.size(), 0);
+    std::vector<Statistics> threadStatistics(std::max<uint64_t>(1, numberOfThreads));
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(trackers.size()),
+                                           [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+                                               Statistics& localStatistics = threadStatistics[threadIndex];
+                                               storm::utility::Stopwatch updateWatch;
+                                               for (uint64_t trace = begin; trace < end; ++trace) {
+                                                   if (trackers[trace].getNumberOfBeliefs() == 0) {
+                                                       // This trace was already inconsistent.
+                                                       continue;
+                                                   }
+                                                   updateWatch.restart();
+                                                   consistent[trace] = trackers[trace].track(newObservations[trace]);
+                                                   updateWatch.stop();
+                                                   ++localStatistics.numberOfUpdates;
+                                                   localStatistics.totalLatency += updateWatch.getTimeInNanoseconds();
+                                                   localStatistics.maxLatency = std::max(localStatistics.maxLatency, updateWatch.getTimeInNanoseconds());
+                                               }
+                                           });
+    for (auto const& localStatistics : threadStatistics) {
+        statistics.add(localStatistics);
+    }
+
+    storm::storage::BitVector result(trackers.size());
+    for (uint64_t trace = 0; trace < trackers.size(); ++trace) {
+        result.set(trace, consistent[trace] != 0);
+    }
+    return result;
+}
+
+template<typename ValueType, typename BeliefState>
+void BatchedBeliefTracker<ValueType, BeliefState>::setRisk(std::vector<ValueType> const& risk) {
+    for (auto& tracker : trackers) {
+        tracker.setRisk(risk);
+    }
+}
+
+template<typename ValueType, typename BeliefState>
+std::vector<ValueType> BatchedBeliefTracker<ValueType, BeliefState>::getCurrentRisks(bool max) {
+    std::vector<ValueType> result;
+    result.reserve(trackers.size());
+    for (auto& tracker : trackers) {
+        result.push_back(tracker.getCurrentRisk(max));
+    }
+    return result;
+}
+
+template<typename ValueType, typename BeliefState>
+uint64_t BatchedBeliefTracker<ValueType, BeliefState>::getNumberOfTraces() const {
+    return trackers.size();
+}
+
+template<typename ValueType, typename BeliefState>
+NondeterministicBeliefTracker<ValueType, BeliefState> const& BatchedBeliefTracker<ValueType, BeliefState>::getTracker(uint64_t trace) const {
+    STORM_LOG_ASSERT(trace < trackers.size(), "Trace " << trace << " is not tracked.");
+    return trackers[trace];
+}
+
+template<typename ValueType, typename BeliefState>
+typename BatchedBeliefTracker<ValueType, BeliefState>::Statistics const& BatchedBeliefTracker<ValueType, BeliefState>::getStatistics() const {
+    return statistics;
+}
+
+template<typename ValueType, typename BeliefState>
+void BatchedBeliefTracker<ValueType, BeliefState>::printStatistics(std::ostream& out) const {
+    out << "Belief tracking statistics:\n";
+    out << "  Number of updates: " << statistics.numberOfUpdates << '\n';
+    out << "  Average latency: " << statistics.getAverageLatency() / 1000 << "us\n";
+    out << "  Maximal latency: " << statistics.maxLatency / 1000 << "us\n";
+}
+
+template class BatchedBeliefTracker<double, SparseBeliefState<double>>;
+template class BatchedBeliefTracker<double, ObservationDenseBeliefState<double>>;
+template class BatchedBeliefTracker<storm::RationalNumber, SparseBeliefState<storm::RationalNumber>>;
+template class BatchedBeliefTracker<storm::RationalNumber, ObservationDenseBeliefState<storm::RationalNumber>>;
+
+}  // namespace generator
+}  // namespace storm
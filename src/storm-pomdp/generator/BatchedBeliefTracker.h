@@ -0,0 +1,92 @@
+#pragma once
+
+#include <ostream>
+#include <vector>
+
+#include "storm-pomdp/generator/NondeterministicBeliefTracker.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/Stopwatch.h"
+
+namespace storm {
+namespace generator {
+
+/**
+ * This tracker performs state estimation for a batch of independent observation traces of the same POMDP, e.g., for a monitor that observes many
+ * runs at once. Every trace is tracked by its own NondeterministicBeliefTracker. The traces of a batch are updated concurrently.
+ *
+ * @tparam ValueType How are probabilities stored
+ * @tparam BeliefState What format to use for beliefs
+ */
+template<typename ValueType, typename BeliefState>
+class BatchedBeliefTracker {
+   public:
+    /**
+     * Latencies of the updates of single traces (in nanoseconds).
+     */
+    struct Statistics {
+        uint64_t numberOfUpdates = 0;
+        storm::utility::Stopwatch::NanosecondType totalLatency = 0;
+        storm::utility::Stopwatch::NanosecondType maxLatency = 0;
+
+        storm::utility::Stopwatch::NanosecondType getAverageLatency() const;
+        void add(Statistics const& other);
+    };
+
+    /**
+     * @param pomdp The POMDP whose traces are tracked
+     * @param numberOfTraces How many traces are tracked
+     * @param options The options for every tracker
+     * @param numberOfThreads The maximal number of threads that update the traces of a batch
+     */
+    BatchedBeliefTracker(storm::models::sparse::Pomdp<ValueType> const& pomdp, uint64_t numberOfTraces,
+                         typename NondeterministicBeliefTracker<ValueType, BeliefState>::Options options =
+                             typename NondeterministicBeliefTracker<ValueType, BeliefState>::Options(),
+                         uint64_t numberOfThreads = 1);
+    /**
+     * Start new traces.
+     * @param observations The initial observation of every trace.
+     * @return The traces for which there is an initial state with the given observation.
+     */
+    storm::storage::BitVector reset(std::vector<uint32_t> const& observations);
+    /**
+     * Extend every observed trace with the next observation.
+     * @param newObservations The new observation of every trace.
+     * @return The traces that are still consistent with the POMDP (and did not time out). Inconsistent traces are not updated until they are reset.
+     */
+    storm::storage::BitVector track(std::vector<uint64_t> const& newObservations);
+    /**
+     * Sets the state-risk to use for all beliefs of all traces.
+     * @param risk
+     */
+    void setRisk(std::vector<ValueType> const& risk);
+    /**
+     * What is the (worst-case/best-case) risk of every trace?
+     * @param max Should we take the max or the min?
+     * @return
+     */
+    std::vector<ValueType> getCurrentRisks(bool max = true);
+    /**
+     * How many traces are we tracking?
+     * @return
+     */
+    uint64_t getNumberOfTraces() const;
+    /**
+     * Provides access to the tracker of the given trace.
+     * @return
+     */
+    NondeterministicBeliefTracker<ValueType, BeliefState> const& getTracker(uint64_t trace) const;
+    /**
+     * Latencies of all updates since the construction.
+     * @return
+     */
+    Statistics const& getStatistics() const;
+    void printStatistics(std::ostream& out) const;
+
+   private:
+    std::vector<NondeterministicBeliefTracker<ValueType, BeliefState>> trackers;
+    uint64_t numberOfThreads;
+    Statistics statistics;
+};
+
+}  // namespace generator
+}  // namespace storm
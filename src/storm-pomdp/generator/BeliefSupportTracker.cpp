@@ -14,7 +14,9 @@ storm::storage::BitVector const& BeliefSupportTracker<ValueType>::getCurrentBeli
 
 template<typename ValueType>
 void BeliefSupportTracker<ValueType>::track(uint64_t action, uint64_t observation) {
-    storm::storage::BitVector newBeliefSupport(pomdp.getNumberOfStates());
+    // The buffer of the previous support is reused for the new one.
+    newBeliefSupport.resize(pomdp.getNumberOfStates());
+    newBeliefSupport.clear();
     for (uint64_t oldState : currentBeliefSupport) {
         uint64_t row = pomdp.getTransitionMatrix().getRowGroupIndices()[oldState] + action;
         for (auto const& successor : pomdp.getTransitionMatrix().getRow(row)) {
@@ -24,7 +26,7 @@ void BeliefSupportTracker<ValueType>::track(uint64_t action, uint64_t observatio
             }
         }
     }
-    currentBeliefSupport = newBeliefSupport;
+    std::swap(currentBeliefSupport, newBeliefSupport);
 }
 
 template<typename ValueType>
@@ -31,6 +31,7 @@ class BeliefSupportTracker {
    private:
     storm::models::sparse::Pomdp<ValueType> const& pomdp;
     storm::storage::BitVector currentBeliefSupport;
+    storm::storage::BitVector newBeliefSupport;
 };
 }  // namespace generator
 }  // namespace storm
\ No newline at end of file
@@ -1,5 +1,8 @@
 
 #include "storm-pomdp/generator/NondeterministicBeliefTracker.h"
+
+#include <algorithm>
+
 #include "storm/storage/geometry/ReduceVertexCloud.h"
 #include "storm/storage/geometry/nativepolytopeconversion/QuickHull.h"
 #include "storm/utility/ConstantsComparator.h"
@@ -233,7 +236,7 @@ bool operator==(ObservationDenseBeliefState<ValueType> const& lhs, ObservationDe
     if (lhs.observation != rhs.observation) {
         return false;
     }
-    storm::utility::ConstantsComparator<ValueType> cmp(0.00001, true);
+    storm::utility::ConstantsComparator<ValueType> cmp(storm::utility::convertNumber<ValueType>(0.00001), true);
     auto lhsIt = lhs.belief.begin();
     auto rhsIt = rhs.belief.begin();
     while (lhsIt != lhs.belief.end()) {
@@ -249,9 +252,12 @@ bool operator==(ObservationDenseBeliefState<ValueType> const& lhs, ObservationDe
 
 template<typename ValueType>
 ObservationDenseBeliefState<ValueType>::ObservationDenseBeliefState(std::shared_ptr<BeliefStateManager<ValueType>> const& manager, uint64_t state)
-    : manager(manager), belief(manager->numberOfStatesPerObservation(manager->getObservation(state))) {
+    : manager(manager), belief(manager->numberOfStatesPerObservation(manager->getObservation(state)), storm::utility::zero<ValueType>()), id(0), prevId(0) {
+    id = manager->getFreshId();
     observation = manager->getObservation(state);
     belief[manager->getObservationOffset(state)] = storm::utility::one<ValueType>();
+    boost::hash_combine(prestoredhash, state);
+    risk = manager->getRisk(state);
 }
 
 template<typename ValueType>
@@ -264,62 +270,58 @@ ObservationDenseBeliefState<ValueType>::ObservationDenseBeliefState(std::shared_
 
 template<typename ValueType>
 void ObservationDenseBeliefState<ValueType>::update(uint32_t newObservation, std::unordered_set<ObservationDenseBeliefState>& previousBeliefs) const {
-    updateHelper({{}}, {storm::utility::zero<ValueType>()}, 0, newObservation, previousBeliefs);
-}
-
-template<typename ValueType>
-void ObservationDenseBeliefState<ValueType>::updateHelper(std::vector<std::map<uint64_t, ValueType>> const& partialBeliefs, std::vector<ValueType> const& sums,
-                                                          uint64_t currentEntry, uint32_t newObservation,
-                                                          std::unordered_set<ObservationDenseBeliefState<ValueType>>& previousBeliefs) const {
-    while (currentEntry != belief.size() && storm::utility::isZero(belief[currentEntry])) {
-        currentEntry++;
-    }
-    if (currentEntry == belief.size()) {
-        for (uint64_t i = 0; i < partialBeliefs.size(); ++i) {
-            auto const& partialBelief = partialBeliefs[i];
-            auto const& sum = sums[i];
-            if (storm::utility::isZero(sum)) {
-                continue;
-            }
-            std::size_t newHash = 0;
-            ValueType risk = storm::utility::zero<ValueType>();
-            std::vector<ValueType> finalBelief(manager->numberOfStatesPerObservation(observation), storm::utility::zero<ValueType>());
-            for (auto& entry : partialBelief) {
-                assert(!storm::utility::isZero(sum));
-                finalBelief[manager->getObservationOffset(entry.first)] = (entry.second / sum);
-                // boost::hash_combine(newHash, std::hash<ValueType>()(entry.second));
-                boost::hash_combine(newHash, entry.first);
-                risk += entry.second / sum * manager->getRisk(entry.first);
-            }
-            previousBeliefs.insert(ObservationDenseBeliefState<ValueType>(manager, newObservation, finalBelief, newHash, risk, id));
+    // Every combination of choices in the states of the support yields a (partial) belief over the states with the new observation.
+    uint64_t const numberOfNewStates = manager->numberOfStatesPerObservation(newObservation);
+    std::vector<std::vector<ValueType>> partialBeliefs(1, std::vector<ValueType>(numberOfNewStates, storm::utility::zero<ValueType>()));
+    std::vector<ValueType> sums(1, storm::utility::zero<ValueType>());
+    auto const& choiceIndices = manager->getPomdp().getNondeterministicChoiceIndices();
+    for (uint64_t currentEntry = 0; currentEntry < belief.size(); ++currentEntry) {
+        if (storm::utility::isZero(belief[currentEntry])) {
+            continue;
         }
-    } else {
         uint64_t state = manager->getState(observation, currentEntry);
-        uint64_t nextEntry = currentEntry + 1;
-        std::vector<std::map<uint64_t, ValueType>> newPartialBeliefs;
+        std::vector<std::vector<ValueType>> newPartialBeliefs;
         std::vector<ValueType> newSums;
+        newPartialBeliefs.reserve(partialBeliefs.size() * (choiceIndices[state + 1] - choiceIndices[state]));
+        newSums.reserve(newPartialBeliefs.capacity());
         for (uint64_t i = 0; i < partialBeliefs.size(); ++i) {
-            for (auto row = manager->getPomdp().getNondeterministicChoiceIndices()[state];
-                 row < manager->getPomdp().getNondeterministicChoiceIndices()[state + 1]; ++row) {
-                std::map<uint64_t, ValueType> newPartialBelief = partialBeliefs[i];
+            for (auto row = choiceIndices[state]; row < choiceIndices[state + 1]; ++row) {
+                std::vector<ValueType> newPartialBelief = partialBeliefs[i];
                 ValueType newSum = sums[i];
                 for (auto const& transition : manager->getPomdp().getTransitionMatrix().getRow(row)) {
-                    if (newObservation != manager->getPomdp().getObservation(transition.getColumn())) {
+                    if (newObservation != manager->getObservation(transition.getColumn())) {
                         continue;
                     }
-
-                    if (newPartialBelief.count(transition.getColumn()) == 0) {
-                        newPartialBelief[transition.getColumn()] = transition.getValue() * belief[currentEntry];
-                    } else {
-                        newPartialBelief[transition.getColumn()] += transition.getValue() * belief[currentEntry];
-                    }
-                    newSum += transition.getValue() * belief[currentEntry];
+                    ValueType probability = transition.getValue() * belief[currentEntry];
+                    newPartialBelief[manager->getObservationOffset(transition.getColumn())] += probability;
+                    newSum += probability;
                 }
-                newPartialBeliefs.push_back(newPartialBelief);
-                newSums.push_back(newSum);
+                newPartialBeliefs.push_back(std::move(newPartialBelief));
+                newSums.push_back(std::move(newSum));
             }
         }
-        updateHelper(newPartialBeliefs, newSums, nextEntry, newObservation, previousBeliefs);
+        partialBeliefs = std::move(newPartialBeliefs);
+        sums = std::move(newSums);
+    }
+
+    for (uint64_t i = 0; i < partialBeliefs.size(); ++i) {
+        auto& finalBelief = partialBeliefs[i];
+        auto const& sum = sums[i];
+        if (storm::utility::isZero(sum)) {
+            continue;
+        }
+        std::size_t newHash = 0;
+        ValueType risk = storm::utility::zero<ValueType>();
+        for (uint64_t offset = 0; offset < numberOfNewStates; ++offset) {
+            if (storm::utility::isZero(finalBelief[offset])) {
+                continue;
+            }
+            uint64_t state = manager->getState(newObservation, offset);
+            finalBelief[offset] /= sum;
+            boost::hash_combine(newHash, state);
+            risk += finalBelief[offset] * manager->getRisk(state);
+        }
+        previousBeliefs.insert(ObservationDenseBeliefState<ValueType>(manager, newObservation, finalBelief, newHash, risk, id));
     }
 }
 
@@ -330,12 +332,28 @@ std::size_t ObservationDenseBeliefState<ValueType>::hash() const noexcept {
 
 template<typename ValueType>
 ValueType ObservationDenseBeliefState<ValueType>::get(uint64_t state) const {
-    if (manager->getObservation(state) != state) {
+    if (manager->getObservation(state) != observation) {
         return storm::utility::zero<ValueType>();
     }
     return belief[manager->getObservationOffset(state)];
 }
 
+template<typename ValueType>
+bool ObservationDenseBeliefState<ValueType>::isValid() const {
+    return std::any_of(belief.begin(), belief.end(), [](ValueType const& value) { return !storm::utility::isZero(value); });
+}
+
+template<typename ValueType>
+std::map<uint64_t, ValueType> ObservationDenseBeliefState<ValueType>::getBeliefMap() const {
+    std::map<uint64_t, ValueType> result;
+    for (uint64_t offset = 0; offset < belief.size(); ++offset) {
+        if (!storm::utility::isZero(belief[offset])) {
+            result.emplace_hint(result.end(), manager->getState(observation, offset), belief[offset]);
+        }
+    }
+    return result;
+}
+
 template<typename ValueType>
 ValueType ObservationDenseBeliefState<ValueType>::getRisk() const {
     return risk;
@@ -382,6 +400,8 @@ NondeterministicBeliefTracker<ValueType, BeliefState>::NondeterministicBeliefTra
 
 template<typename ValueType, typename BeliefState>
 bool NondeterministicBeliefTracker<ValueType, BeliefState>::reset(uint32_t observation) {
+    beliefs.clear();
+    numberOfPrunedBeliefs = 0;
     bool hit = false;
     for (auto state : pomdp.getInitialStates()) {
         if (observation == pomdp.getObservation(state)) {
@@ -404,11 +424,30 @@ bool NondeterministicBeliefTracker<ValueType, BeliefState>::track(uint64_t newOb
             return false;
         }
     }
-    beliefs = newBeliefs;
+    beliefs = std::move(newBeliefs);
     lastObservation = newObservation;
+    prune();
     return !beliefs.empty();
 }
 
+template<typename ValueType, typename BeliefState>
+void NondeterministicBeliefTracker<ValueType, BeliefState>::prune() {
+    if (options.maxNumberOfBeliefs == 0 || beliefs.size() <= options.maxNumberOfBeliefs) {
+        return;
+    }
+    std::vector<typename std::unordered_set<BeliefState>::const_iterator> iterators;
+    iterators.reserve(beliefs.size());
+    for (auto it = beliefs.cbegin(); it != beliefs.cend(); ++it) {
+        iterators.push_back(it);
+    }
+    std::nth_element(iterators.begin(), iterators.begin() + options.maxNumberOfBeliefs, iterators.end(),
+                     [](auto const& lhs, auto const& rhs) { return lhs->getRisk() > rhs->getRisk(); });
+    for (auto it = iterators.begin() + options.maxNumberOfBeliefs; it != iterators.end(); ++it) {
+        beliefs.erase(*it);
+    }
+    numberOfPrunedBeliefs += iterators.size() - options.maxNumberOfBeliefs;
+}
+
 template<typename ValueType, typename BeliefState>
 ValueType NondeterministicBeliefTracker<ValueType, BeliefState>::getCurrentRisk(bool max) {
     STORM_LOG_THROW(!beliefs.empty(), storm::exceptions::InvalidOperationException, "Risk is only defined for beliefs (run reset() first).");
@@ -489,16 +528,24 @@ bool NondeterministicBeliefTracker<ValueType, BeliefState>::hasTimedOut() const
     return reductionTimedOut;
 }
 
+template<typename ValueType, typename BeliefState>
+uint64_t NondeterministicBeliefTracker<ValueType, BeliefState>::getNumberOfPrunedBeliefs() const {
+    return numberOfPrunedBeliefs;
+}
+
 template class SparseBeliefState<double>;
 template bool operator==(SparseBeliefState<double> const&, SparseBeliefState<double> const&);
 template class NondeterministicBeliefTracker<double, SparseBeliefState<double>>;
-// template class ObservationDenseBeliefState<double>;
-// template bool operator==(ObservationDenseBeliefState<double> const&, ObservationDenseBeliefState<double> const&);
-// template class NondeterministicBeliefTracker<double, ObservationDenseBeliefState<double>>;
+template class ObservationDenseBeliefState<double>;
+template bool operator==(ObservationDenseBeliefState<double> const&, ObservationDenseBeliefState<double> const&);
+template class NondeterministicBeliefTracker<double, ObservationDenseBeliefState<double>>;
 
 template class SparseBeliefState<storm::RationalNumber>;
 template bool operator==(SparseBeliefState<storm::RationalNumber> const&, SparseBeliefState<storm::RationalNumber> const&);
 template class NondeterministicBeliefTracker<storm::RationalNumber, SparseBeliefState<storm::RationalNumber>>;
+template class ObservationDenseBeliefState<storm::RationalNumber>;
+template bool operator==(ObservationDenseBeliefState<storm::RationalNumber> const&, ObservationDenseBeliefState<storm::RationalNumber> const&);
+template class NondeterministicBeliefTracker<storm::RationalNumber, ObservationDenseBeliefState<storm::RationalNumber>>;
 
 }  // namespace generator
 }  // namespace storm
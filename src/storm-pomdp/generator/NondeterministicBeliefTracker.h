@@ -88,6 +88,7 @@ class SparseBeliefState {
 
 /**
  * ObservationDenseBeliefState stores beliefs in a dense format (per observation).
+ * The belief is an array over the states with the current observation, which is also the format of all intermediate results of an update.
  */
 template<typename ValueType>
 class ObservationDenseBeliefState;
@@ -98,18 +99,27 @@ template<typename ValueType>
 class ObservationDenseBeliefState {
    public:
     ObservationDenseBeliefState(std::shared_ptr<BeliefStateManager<ValueType>> const& manager, uint64_t state);
+    /**
+     * Update the belief using the new observation
+     * @param newObservation
+     * @param previousBeliefs put the new belief in this set
+     */
     void update(uint32_t newObservation, std::unordered_set<ObservationDenseBeliefState>& previousBeliefs) const;
     std::size_t hash() const noexcept;
     ValueType get(uint64_t state) const;
     ValueType getRisk() const;
     std::string toString() const;
+    bool isValid() const;
     uint64_t getSupportSize() const;
     void setSupport(storm::storage::BitVector&) const;
+    /**
+     * Get the belief as a map from states to probabilities (for the states with a positive probability)
+     * @return
+     */
+    std::map<uint64_t, ValueType> getBeliefMap() const;
     friend bool operator== <>(ObservationDenseBeliefState<ValueType> const& lhs, ObservationDenseBeliefState<ValueType> const& rhs);
 
    private:
-    void updateHelper(std::vector<std::map<uint64_t, ValueType>> const& partialBeliefs, std::vector<ValueType> const& sums, uint64_t currentEntry,
-                      uint32_t newObservation, std::unordered_set<ObservationDenseBeliefState<ValueType>>& previousBeliefs) const;
     ObservationDenseBeliefState(std::shared_ptr<BeliefStateManager<ValueType>> const& manager, uint32_t observation, std::vector<ValueType> const& belief,
                                 std::size_t newHash, ValueType const& risk, uint64_t prevId);
     std::shared_ptr<BeliefStateManager<ValueType>> manager;
@@ -136,11 +146,12 @@ class NondeterministicBeliefTracker {
         uint64_t trackTimeOut = 0;
         uint64_t timeOut = 0;  // for reduction, in milliseconds, 0 is no timeout
         ValueType wiggle;      // tolerance, anything above 0 means that we are incomplete.
+        uint64_t maxNumberOfBeliefs = 0;  // if more beliefs are tracked after an update, only the ones with the highest risk are kept. 0 is no bound
     };
     NondeterministicBeliefTracker(storm::models::sparse::Pomdp<ValueType> const& pomdp,
                                   typename NondeterministicBeliefTracker<ValueType, BeliefState>::Options options = Options());
     /**
-     * Start with a new trace.
+     * Start with a new trace. Beliefs of a previous trace are discarded.
      * @param observation The initial observation to start with.
      * @return
      */
@@ -193,12 +204,24 @@ class NondeterministicBeliefTracker {
      * @return
      */
     bool hasTimedOut() const;
+    /**
+     * How many beliefs were pruned (due to the bound on the number of beliefs) since the last reset?
+     * If beliefs were pruned, the current maximal risk is still exact, but later ones (and all minimal risks) may be too low (too high).
+     * @return
+     */
+    uint64_t getNumberOfPrunedBeliefs() const;
 
    private:
+    /**
+     * Keeps the beliefs with the highest risk if there are more beliefs than allowed by the options.
+     */
+    void prune();
+
     storm::models::sparse::Pomdp<ValueType> const& pomdp;
     std::shared_ptr<BeliefStateManager<ValueType>> manager;
     std::unordered_set<BeliefState> beliefs;
     bool reductionTimedOut = false;
+    uint64_t numberOfPrunedBeliefs = 0;
     Options options;
     uint32_t lastObservation;
 };
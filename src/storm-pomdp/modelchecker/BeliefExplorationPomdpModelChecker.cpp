@@ -846,6 +846,12 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
         }
 
         uint64_t currId = overApproximation->exploreNextState();
+        if (options.explorationThreads > 1 && !beliefManager->hasPrecomputedSuccessorBeliefs(currId)) {
+            // Compute the successors of the current and the next queued beliefs in parallel. They are added to the MDP in the same order as before.
+            std::vector<typename BeliefManagerType::BeliefId> beliefIds = overApproximation->getNextUnexploredBeliefs(options.explorationBatchSize - 1);
+            beliefIds.insert(beliefIds.begin(), currId);
+            beliefManager->precomputeSuccessorBeliefs(beliefIds, options.explorationThreads);
+        }
         bool hasOldBehavior = refine && overApproximation->currentStateHasOldBehavior();
         if (!hasOldBehavior) {
             STORM_LOG_INFO_COND(!fixPoint, "Not reaching a refinement fixpoint because a new state is explored");
@@ -1102,6 +1108,12 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
             stateStored = true;
         }
         uint64_t currId = underApproximation->exploreNextState();
+        if (options.explorationThreads > 1 && !beliefManager->hasPrecomputedSuccessorBeliefs(currId)) {
+            // Compute the successors of the current and the next queued beliefs in parallel. They are added to the MDP in the same order as before.
+            std::vector<typename BeliefManagerType::BeliefId> beliefIds = underApproximation->getNextUnexploredBeliefs(options.explorationBatchSize - 1);
+            beliefIds.insert(beliefIds.begin(), currId);
+            beliefManager->precomputeSuccessorBeliefs(beliefIds, options.explorationThreads);
+        }
         uint32_t currObservation = beliefManager->getBeliefObservation(currId);
         uint64_t addedActions = 0;
         bool stateAlreadyExplored = refine && underApproximation->currentStateHasOldBehavior() && !underApproximation->getCurrentStateWasTruncated();
@@ -29,6 +29,10 @@ struct BeliefExplorationPomdpModelCheckerOptions {
     uint64_t refineStepLimit = 0;
     ValueType refinePrecision = storm::utility::convertNumber<ValueType>(1e-4);
     uint64_t explorationTimeLimit = 0;
+    // The number of threads that compute the successor beliefs of the next (at most) explorationBatchSize states in the exploration queue.
+    // The explored MDP does not depend on the number of threads.
+    uint64_t explorationThreads = 1;
+    uint64_t explorationBatchSize = 256;
 
     // Control parameters for the refinement heuristic
     // Discretization Resolution
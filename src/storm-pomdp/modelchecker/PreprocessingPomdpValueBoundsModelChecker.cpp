@@ -1,4 +1,5 @@
 #include "PreprocessingPomdpValueBoundsModelChecker.h"
+#include <optional>
 #include <random>
 
 #include "storm-pomdp/storage/PomdpMemory.h"
@@ -8,9 +9,11 @@
 #include "storm/storage/Scheduler.h"
 
 #include "environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -211,12 +214,19 @@ typename PreprocessingPomdpValueBoundsModelChecker<ValueType>::ValueBounds Prepr
     std::vector<storm::storage::Scheduler<ValueType>> guessedSchedulers;
     std::shared_ptr<std::pair<std::vector<ValueType>, storm::storage::Scheduler<ValueType>>> guessedSchedulerPair;
     std::vector<std::pair<double, bool>> guessParameters({{0.875, false}, {0.875, true}, {0.75, false}, {0.75, true}});
-    for (auto const& pars : guessParameters) {
-        guessedSchedulerPair = std::make_shared<std::pair<std::vector<ValueType>, storm::storage::Scheduler<ValueType>>>(
-            computeValuesForGuessedScheduler(env, fullyObservableResult, actionBasedRewardsPtr, formula, info, underlyingMdp,
-                                             storm::utility::convertNumber<ValueType>(pars.first), pars.second));
-        guessedSchedulerValues.push_back(guessedSchedulerPair->first);
-        guessedSchedulers.push_back(guessedSchedulerPair->second);
+    // The initial guesses are independent of each other, so they are computed concurrently if several threads are allowed.
+    std::vector<std::optional<std::pair<std::vector<ValueType>, storm::storage::Scheduler<ValueType>>>> initialGuesses(guessParameters.size());
+    storm::utility::parallel::forEachBlock(env.solver().getNumberOfThreads(), static_cast<uint64_t>(0), static_cast<uint64_t>(guessParameters.size()), 1,
+                                           [&](uint64_t, uint64_t blockBegin, uint64_t blockEnd) {
+                                               for (uint64_t guess = blockBegin; guess < blockEnd; ++guess) {
+                                                   initialGuesses[guess] = computeValuesForGuessedScheduler(
+                                                       env, fullyObservableResult, actionBasedRewardsPtr, formula, info, underlyingMdp,
+                                                       storm::utility::convertNumber<ValueType>(guessParameters[guess].first), guessParameters[guess].second);
+                                               }
+                                           });
+    for (auto& initialGuess : initialGuesses) {
+        guessedSchedulerValues.push_back(std::move(initialGuess->first));
+        guessedSchedulers.push_back(std::move(initialGuess->second));
     }
 
     // compute the 'best' guess and do a few iterations on it
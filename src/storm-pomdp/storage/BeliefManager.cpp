@@ -1,11 +1,14 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/solver/GlpkLpSolver.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace storage {
@@ -83,7 +86,7 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType co
                                                                     TriangulationMode const &triangulationMode)
     : pomdp(pomdp), triangulationMode(triangulationMode) {
     cc = storm::utility::ConstantsComparator<BeliefValueType>(precision, false);
-    beliefToIdMap.resize(pomdp.getNrObservations());
+    beliefIndex.assign(16, noId());
     initialBeliefId = computeInitialBelief();
 }
 
@@ -195,7 +198,8 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation Bel
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state,
+                                                                             BeliefValueType const &value) const {
     auto insertionRes = distr.emplace(state, value);
     if (!insertionRes.second) {
         insertionRes.first->second += value;
@@ -204,7 +208,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(Dis
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) const {
     if (distr.size() == 1 && cc.isEqual(distr.begin()->second, storm::utility::one<BeliefValueType>())) {
         // If the distribution consists of only one entry and its value is sufficiently close to 1, make it exactly 1 to avoid numerical problems
         distr.begin()->second = storm::utility::one<BeliefValueType>();
@@ -258,11 +262,10 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(
     BeliefType const &belief) const {
-    uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto idIt = beliefToIdMap[obs].find(belief);
-    STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-    return idIt->second;
+    STORM_LOG_ASSERT(getBeliefObservation(belief) < pomdp.getNrObservations(), "Belief has unknown observation.");
+    BeliefId id = beliefIndex[findBeliefIndexSlot(belief, BeliefHash()(belief))];
+    STORM_LOG_ASSERT(id != noId(), "Unknown Belief.");
+    return id;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -403,49 +406,51 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
     // Variable names are mostly based on the paper
     // However, we speed this up a little by exploiting that belief states usually have sparse support (i.e. numEntries is much smaller than
     // pomdp.getNumberOfStates()). Initialize diffs and the first row of the 'qs' matrix (aka v)
-    std::set<FreudenthalDiff, std::greater<>> sorted_diffs;  // d (and p?) in the paper
-    std::vector<BeliefValueType> qsRow;                      // Row of the 'qs' matrix from the paper (initially corresponds to v
-    qsRow.reserve(numEntries);
+    // The diffs are kept in a contiguous vector that is sorted once, which avoids the node allocations of an ordered set.
+    std::vector<FreudenthalDiff> sorted_diffs;  // d (and p?) in the paper
+    sorted_diffs.reserve(numEntries);
+    std::vector<BeliefValueType> qsRow;  // Row of the 'qs' matrix from the paper (initially corresponds to v
+    qsRow.reserve(numEntries + 1);
     std::vector<StateType> toOriginalIndicesMap;  // Maps 'local' indices to the original pomdp state indices
     toOriginalIndicesMap.reserve(numEntries);
     BeliefValueType x = resolution;
     for (auto const &entry : belief) {
-        qsRow.push_back(storm::utility::floor(x));                            // v
-        sorted_diffs.emplace(toOriginalIndicesMap.size(), x - qsRow.back());  // x-v
+        qsRow.push_back(storm::utility::floor(x));                                // v
+        sorted_diffs.emplace_back(toOriginalIndicesMap.size(), x - qsRow.back());  // x-v
         toOriginalIndicesMap.push_back(entry.first);
         x -= entry.second * resolution;
     }
+    std::sort(sorted_diffs.begin(), sorted_diffs.end(), std::greater<>());
     // Insert a dummy 0 column in the qs matrix so the loops below are a bit simpler
     qsRow.push_back(storm::utility::zero<BeliefValueType>());
 
     result.weights.reserve(numEntries);
     result.gridPoints.reserve(numEntries);
-    auto currentSortedDiff = sorted_diffs.begin();
-    auto previousSortedDiff = sorted_diffs.end();
-    --previousSortedDiff;
+    StateType previousSortedDiff = numEntries - 1;
     for (StateType i = 0; i < numEntries; ++i) {
         // Compute the weight for the grid points
-        BeliefValueType weight = previousSortedDiff->diff - currentSortedDiff->diff;
+        BeliefValueType weight = sorted_diffs[previousSortedDiff].diff - sorted_diffs[i].diff;
         if (i == 0) {
             // The first weight is a bit different
             weight += storm::utility::one<BeliefValueType>();
         } else {
             // 'compute' the next row of the qs matrix
-            qsRow[previousSortedDiff->dimension] += storm::utility::one<BeliefValueType>();
+            qsRow[sorted_diffs[previousSortedDiff].dimension] += storm::utility::one<BeliefValueType>();
         }
         if (!cc.isZero(weight)) {
             result.weights.push_back(weight);
-            // Compute the grid point
+            // Compute the grid point. As the local indices are ordered like the original ones, each entry can be appended.
             BeliefType gridPoint;
+            gridPoint.reserve(numEntries);
             for (StateType j = 0; j < numEntries; ++j) {
                 BeliefValueType gridPointEntry = qsRow[j] - qsRow[j + 1];
                 if (!cc.isZero(gridPointEntry)) {
-                    gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
+                    gridPoint.emplace_hint(gridPoint.end(), toOriginalIndicesMap[j], gridPointEntry / resolution);
                 }
             }
             result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
         }
-        previousSortedDiff = currentSortedDiff++;
+        previousSortedDiff = i;
     }
 }
 
@@ -499,6 +504,13 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation Bel
         result.gridPoints.push_back(getOrAddBeliefId(belief));
     } else {
         auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
+        std::size_t const hash = BeliefHash()(belief);
+        auto cachedIt = findCachedTriangulation(belief, ceiledResolution, hash);
+        if (cachedIt != triangulationCache.end()) {
+            // Mark the triangulation as the most recently used one. This does not invalidate the iterator.
+            triangulationCache.splice(triangulationCache.begin(), triangulationCache, cachedIt);
+            return cachedIt->triangulation;
+        }
         switch (triangulationMode) {
             case TriangulationMode::Static:
                 triangulateBeliefFreudenthal(belief, ceiledResolution, result);
@@ -509,20 +521,56 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation Bel
             default:
                 STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
         }
+        addCachedTriangulation(belief, ceiledResolution, hash, result);
     }
     STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
     return result;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
-                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
-BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
-                                                                     std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
-                                                                     std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
-    std::vector<std::pair<BeliefId, ValueType>> destinations;
+void BeliefManager<PomdpType, BeliefValueType, StateType>::setTriangulationCacheCapacity(uint64_t capacity) {
+    triangulationCacheCapacity = capacity;
+    while (triangulationCache.size() > triangulationCacheCapacity) {
+        auto range = triangulationCacheIndex.equal_range(triangulationCache.back().hash);
+        for (auto indexIt = range.first; indexIt != range.second; ++indexIt) {
+            if (indexIt->second == std::prev(triangulationCache.end())) {
+                triangulationCacheIndex.erase(indexIt);
+                break;
+            }
+        }
+        triangulationCache.pop_back();
+    }
+}
 
-    BeliefType belief = getBelief(beliefId);
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename std::list<typename BeliefManager<PomdpType, BeliefValueType, StateType>::CachedTriangulation>::iterator
+BeliefManager<PomdpType, BeliefValueType, StateType>::findCachedTriangulation(BeliefType const &belief, BeliefValueType const &resolution,
+                                                                              std::size_t const &hash) {
+    auto range = triangulationCacheIndex.equal_range(hash);
+    for (auto indexIt = range.first; indexIt != range.second; ++indexIt) {
+        if (indexIt->second->resolution == resolution && isEqual(indexIt->second->belief, belief)) {
+            return indexIt->second;
+        }
+    }
+    return triangulationCache.end();
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::addCachedTriangulation(BeliefType const &belief, BeliefValueType const &resolution,
+                                                                                  std::size_t const &hash, Triangulation const &triangulation) {
+    if (triangulationCacheCapacity == 0) {
+        return;
+    }
+    triangulationCache.push_front({hash, belief, resolution, triangulation});
+    triangulationCacheIndex.emplace(hash, triangulationCache.begin());
+    // Drop the least recently used triangulation(s)
+    setTriangulationCacheCapacity(triangulationCacheCapacity);
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<typename BeliefManager<PomdpType, BeliefValueType, StateType>::SuccessorBelief>
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessorBeliefs(BeliefType const &belief, uint64_t actionIndex) const {
+    std::vector<SuccessorBelief> successors;
 
     // Find the probability we go to each observation
     BeliefType successorObs;  // This is actually not a belief but has the same type
@@ -537,7 +585,8 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
     }
     adjustDistribution(successorObs);
 
-    // Now for each successor observation we find and potentially triangulate the successor belief
+    // Now for each successor observation we find the successor belief
+    successors.reserve(successorObs.size());
     for (auto const &successor : successorObs) {
         BeliefType successorBelief;
         for (auto const &pointEntry : belief) {
@@ -551,27 +600,77 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
         }
         adjustDistribution(successorBelief);
         STORM_LOG_ASSERT(assertBelief(successorBelief), "Invalid successor belief.");
+        successors.push_back({static_cast<uint32_t>(successor.first), std::move(successorBelief), successor.second});
+    }
+    return successors;
+}
 
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::precomputeSuccessorBeliefs(std::vector<BeliefId> const &beliefIds, uint64_t numberOfThreads) {
+    precomputedSuccessorBeliefs.clear();
+    std::vector<std::vector<std::vector<SuccessorBelief>>> successorsOfBeliefs(beliefIds.size());
+    // The work per belief varies strongly, so the beliefs are distributed in small blocks. No belief is added while the threads are running.
+    storm::utility::parallel::forEachBlock(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(beliefIds.size()), 1,
+                                           [&](uint64_t, uint64_t blockBegin, uint64_t blockEnd) {
+                                               for (uint64_t index = blockBegin; index < blockEnd; ++index) {
+                                                   BeliefType const &belief = getBelief(beliefIds[index]);
+                                                   uint64_t numberOfChoices = pomdp.getNumberOfChoices(belief.begin()->first);
+                                                   successorsOfBeliefs[index].reserve(numberOfChoices);
+                                                   for (uint64_t action = 0; action < numberOfChoices; ++action) {
+                                                       successorsOfBeliefs[index].push_back(computeSuccessorBeliefs(belief, action));
+                                                   }
+                                               }
+                                           });
+    for (uint64_t index = 0; index < beliefIds.size(); ++index) {
+        precomputedSuccessorBeliefs.emplace(beliefIds[index], std::move(successorsOfBeliefs[index]));
+    }
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::hasPrecomputedSuccessorBeliefs(BeliefId const &beliefId) const {
+    return precomputedSuccessorBeliefs.count(beliefId) > 0;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
+                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                     std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
+                                                                     std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
+    std::vector<std::pair<BeliefId, ValueType>> destinations;
+
+    // Use the precomputed successors if available. Neither these nor the computed successors refer to the stored beliefs, which might be reallocated below.
+    std::vector<SuccessorBelief> computedSuccessors;
+    std::vector<SuccessorBelief> const *successors = &computedSuccessors;
+    auto precomputedIt = precomputedSuccessorBeliefs.find(beliefId);
+    if (precomputedIt != precomputedSuccessorBeliefs.end()) {
+        successors = &precomputedIt->second[actionIndex];
+    } else {
+        computedSuccessors = computeSuccessorBeliefs(getBelief(beliefId), actionIndex);
+    }
+
+    // For each successor observation we potentially triangulate the successor belief
+    for (auto const &successor : *successors) {
         // Insert the destination. We know that destinations have to be disjoint since they have different observations
         if (observationTriangulationResolutions) {
-            Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.value()[successor.first]);
+            Triangulation triangulation = triangulateBelief(successor.belief, observationTriangulationResolutions.value()[successor.observation]);
             for (size_t j = 0; j < triangulation.size(); ++j) {
                 // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                BeliefValueType a = triangulation.weights[j] * successor.second;
+                BeliefValueType a = triangulation.weights[j] * successor.probability;
                 destinations.emplace_back(triangulation.gridPoints[j], storm::utility::convertNumber<ValueType>(a));
             }
         } else if (observationGridClippingResolutions) {
-            BeliefClipping clipping = clipBeliefToGrid(successorBelief, observationGridClippingResolutions.value()[successor.first],
+            BeliefClipping clipping = clipBeliefToGrid(successor.belief, observationGridClippingResolutions.value()[successor.observation],
                                                        storm::storage::BitVector(pomdp.getNumberOfStates()));
             if (clipping.isClippable) {
-                BeliefValueType a = (storm::utility::one<BeliefValueType>() - clipping.delta) * successor.second;
+                BeliefValueType a = (storm::utility::one<BeliefValueType>() - clipping.delta) * successor.probability;
                 destinations.emplace_back(clipping.targetBelief, storm::utility::convertNumber<ValueType>(a));
             } else {
                 // Belief on Grid
-                destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
+                destinations.emplace_back(getOrAddBeliefId(successor.belief), storm::utility::convertNumber<ValueType>(successor.probability));
             }
         } else {
-            destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
+            destinations.emplace_back(getOrAddBeliefId(successor.belief), storm::utility::convertNumber<ValueType>(successor.probability));
         }
     }
 
@@ -589,8 +688,7 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping Be
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping BeliefManager<PomdpType, BeliefValueType, StateType>::clipBeliefToGrid(
     BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite) {
-    uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
+    STORM_LOG_ASSERT(getBeliefObservation(belief) < pomdp.getNrObservations(), "Belief has unknown observation.");
     if (!lpSolver) {
         lpSolver = storm::utility::solver::getLpSolver<BeliefValueType>("POMDP LP Solver");
     } else {
@@ -769,16 +867,49 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefMa
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(
     BeliefType const &belief) {
-    uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-    if (insertioRes.second) {
-        // There actually was an insertion, so add the new belief
-        STORM_LOG_TRACE("Add Belief " << beliefs.size() << " " << toString(belief));
-        beliefs.push_back(belief);
-    }
-    // Return the id
-    return insertioRes.first->second;
+    STORM_LOG_ASSERT(getBeliefObservation(belief) < pomdp.getNrObservations(), "Belief has unknown observation.");
+    std::size_t hash = BeliefHash()(belief);
+    uint64_t slot = findBeliefIndexSlot(belief, hash);
+    if (beliefIndex[slot] != noId()) {
+        return beliefIndex[slot];
+    }
+
+    // The belief is new, so add it
+    BeliefId id = beliefs.size();
+    STORM_LOG_TRACE("Add Belief " << id << " " << toString(belief));
+    beliefs.push_back(belief);
+    beliefs.back().shrink_to_fit();
+    beliefHashes.push_back(hash);
+    beliefIndex[slot] = id;
+    if (2 * beliefs.size() > beliefIndex.size()) {
+        growBeliefIndex();
+    }
+    return id;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::findBeliefIndexSlot(BeliefType const &belief, std::size_t const &hash) const {
+    uint64_t const mask = beliefIndex.size() - 1;
+    for (uint64_t slot = hash & mask;; slot = (slot + 1) & mask) {
+        BeliefId const id = beliefIndex[slot];
+        // Comparing the hashes first avoids most comparisons of beliefs.
+        if (id == noId() || (beliefHashes[id] == hash && Belief_equal_to()(beliefs[id], belief))) {
+            return slot;
+        }
+    }
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::growBeliefIndex() {
+    beliefIndex.assign(2 * beliefIndex.size(), noId());
+    uint64_t const mask = beliefIndex.size() - 1;
+    for (BeliefId id = 0; id < beliefs.size(); ++id) {
+        uint64_t slot = beliefHashes[id] & mask;
+        while (beliefIndex[slot] != noId()) {
+            slot = (slot + 1) & mask;
+        }
+        beliefIndex[slot] = id;
+    }
 }
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getRepresentativeState(BeliefId const &beliefId) {
@@ -2,6 +2,7 @@
 
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
+#include <list>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -78,8 +79,14 @@ class BeliefManager {
 
     Triangulation triangulateBelief(BeliefId beliefId, BeliefValueType resolution);
 
+    /*!
+     * Sets the maximal number of triangulations that are kept to avoid triangulating the same belief with the same resolution again. If the capacity is
+     * exceeded, the least recently used triangulation is dropped. A capacity of zero disables the cache.
+     */
+    void setTriangulationCacheCapacity(uint64_t capacity);
+
     template<typename DistributionType>
-    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value);
+    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const;
 
     void joinSupport(BeliefId const &beliefId, BeliefSupportType &support);
 
@@ -93,6 +100,18 @@ class BeliefManager {
 
     std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
+    /*!
+     * Computes the successor beliefs of all actions of the given beliefs using (at most) the given number of threads. They are kept until the next call,
+     * so that subsequent expansions of these beliefs (with or without triangulation or clipping) only need to look up or add the ids of the successors.
+     * As ids are still assigned in the order in which the expansions are requested, the resulting ids do not depend on the number of threads.
+     */
+    void precomputeSuccessorBeliefs(std::vector<BeliefId> const &beliefIds, uint64_t numberOfThreads);
+
+    /*!
+     * Retrieves whether the successor beliefs of the given belief have been computed by the last call to precomputeSuccessorBeliefs.
+     */
+    bool hasPrecomputedSuccessorBeliefs(BeliefId const &beliefId) const;
+
     BeliefClipping clipBeliefToGrid(BeliefId const &beliefId, uint64_t resolution, storm::storage::BitVector isInfinite = storm::storage::BitVector());
 
     std::string getObservationLabel(BeliefId const &beliefId);
@@ -107,7 +126,13 @@ class BeliefManager {
     BeliefClipping clipBeliefToGrid(BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite);
 
     template<typename DistributionType>
-    void adjustDistribution(DistributionType &distr);
+    void adjustDistribution(DistributionType &distr) const;
+
+    struct SuccessorBelief {
+        uint32_t observation;
+        BeliefType belief;
+        BeliefValueType probability;  // The probability to observe the observation of the successor belief
+    };
 
     struct BeliefHash {
         std::size_t operator()(const BeliefType &belief) const;
@@ -145,6 +170,20 @@ class BeliefManager {
 
     Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
 
+    struct CachedTriangulation {
+        std::size_t hash;
+        BeliefType belief;
+        BeliefValueType resolution;
+        Triangulation triangulation;
+    };
+
+    typename std::list<CachedTriangulation>::iterator findCachedTriangulation(BeliefType const &belief, BeliefValueType const &resolution,
+                                                                              std::size_t const &hash);
+
+    void addCachedTriangulation(BeliefType const &belief, BeliefValueType const &resolution, std::size_t const &hash, Triangulation const &triangulation);
+
+    std::vector<SuccessorBelief> computeSuccessorBeliefs(BeliefType const &belief, uint64_t actionIndex) const;
+
     std::vector<std::pair<BeliefId, ValueType>> expandInternal(
         BeliefId const &beliefId, uint64_t actionIndex, std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = std::nullopt,
         std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions = std::nullopt);
@@ -153,18 +192,40 @@ class BeliefManager {
 
     BeliefId getOrAddBeliefId(BeliefType const &belief);
 
+    /*!
+     * Retrieves the slot of the belief index that holds the id of the given belief or, if the belief is unknown, the empty slot where it is to be
+     * inserted.
+     */
+    uint64_t findBeliefIndexSlot(BeliefType const &belief, std::size_t const &hash) const;
+
+    /*!
+     * Doubles the number of slots of the belief index.
+     */
+    void growBeliefIndex();
+
     PomdpType const &pomdp;
     std::vector<ValueType> pomdpActionRewardVector;
 
     std::vector<BeliefType> beliefs;
-    std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash, Belief_equal_to>> beliefToIdMap;
+    std::vector<std::size_t> beliefHashes;
+    // A hash table with open addressing (and linear probing) that stores the ids of the beliefs, so that each belief is only stored once. Empty slots are
+    // marked with noId(). The number of slots is a power of two and at least twice the number of beliefs.
+    std::vector<BeliefId> beliefIndex;
     BeliefId initialBeliefId;
 
+    // The successor beliefs (for each action) of the beliefs given in the last call to precomputeSuccessorBeliefs.
+    std::unordered_map<BeliefId, std::vector<std::vector<SuccessorBelief>>> precomputedSuccessorBeliefs;
+
     storm::utility::ConstantsComparator<BeliefValueType> cc;
 
     std::shared_ptr<storm::solver::LpSolver<BeliefValueType>> lpSolver;
 
     TriangulationMode triangulationMode;
+
+    // The recently computed triangulations, ordered from the most to the least recently used one, and their positions by the hash of the triangulated belief.
+    std::list<CachedTriangulation> triangulationCache;
+    std::unordered_multimap<std::size_t, typename std::list<CachedTriangulation>::iterator> triangulationCacheIndex;
+    uint64_t triangulationCacheCapacity = 1ull << 16;
 };
 }  // namespace storage
 }  // namespace storm
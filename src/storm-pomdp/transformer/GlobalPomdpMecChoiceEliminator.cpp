@@ -49,7 +49,7 @@ template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> GlobalPomdpMecChoiceEliminator<ValueType>::transformMinReward(
     storm::logic::EventuallyFormula const& formula) const {
     assert(formula.isRewardPathFormula());
-    auto backwardTransitions = pomdp.getBackwardTransitions();
+    auto const& backwardTransitions = pomdp.getBackwardTransitions();
     storm::storage::BitVector allStates(pomdp.getNumberOfStates(), true);
     auto prob1EStates = storm::utility::graph::performProb1E(pomdp.getTransitionMatrix(), pomdp.getTransitionMatrix().getRowGroupIndices(), backwardTransitions,
                                                              allStates, checkPropositionalFormula(formula.getSubformula()));
@@ -96,7 +96,7 @@ std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> GlobalPomdpMecChoiceEli
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> GlobalPomdpMecChoiceEliminator<ValueType>::transformMax(
     storm::logic::UntilFormula const& formula) const {
-    auto backwardTransitions = pomdp.getBackwardTransitions();
+    auto const& backwardTransitions = pomdp.getBackwardTransitions();
     auto prob01States = storm::utility::graph::performProb01Max(pomdp.getTransitionMatrix(), pomdp.getTransitionMatrix().getRowGroupIndices(),
                                                                 backwardTransitions, checkPropositionalFormula(formula.getLeftSubformula()),
                                                                 checkPropositionalFormula(formula.getRightSubformula()));
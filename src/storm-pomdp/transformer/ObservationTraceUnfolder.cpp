@@ -5,7 +5,8 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
-#undef _VERBOSE_OBSERVATION_UNFOLDING
+#include <algorithm>
+#include <limits>
 
 namespace storm {
 namespace pomdp {
@@ -22,130 +23,134 @@ ObservationTraceUnfolder<ValueType>::ObservationTraceUnfolder(storm::models::spa
 
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Mdp<ValueType>> ObservationTraceUnfolder<ValueType>::transform(const std::vector<uint32_t>& observations) {
-    std::vector<uint32_t> modifiedObservations = observations;
-    // First observation should be special.
-    // This just makes the algorithm simpler because we do not treat the first step as a special case later.
-    modifiedObservations[0] = model.getNrObservations();
-
-    storm::storage::BitVector initialStates = model.getInitialStates();
-    storm::storage::BitVector actualInitialStates = initialStates;
-    for (uint64_t state : initialStates) {
-        if (model.getObservation(state) != observations[0]) {
+    STORM_LOG_THROW(!observations.empty(), storm::exceptions::InvalidArgumentException, "Expected a non-empty observation trace.");
+    // The layers of the common prefix with the previously unfolded trace remain valid.
+    uint64_t commonPrefixLength = 0;
+    while (commonPrefixLength < std::min(observations.size(), unfoldedTrace.size()) && observations[commonPrefixLength] == unfoldedTrace[commonPrefixLength]) {
+        ++commonPrefixLength;
+    }
+    if (commonPrefixLength == 0) {
+        initialize(observations[0]);
+    } else {
+        truncate(commonPrefixLength);
+    }
+    for (uint64_t step = unfoldedTrace.size(); step < observations.size(); ++step) {
+        unfoldLayer(observations[step]);
+    }
+    return buildModel();
+}
+
+template<typename ValueType>
+void ObservationTraceUnfolder<ValueType>::initialize(uint32_t observation) {
+    unfoldedTrace.clear();
+    storm::storage::BitVector actualInitialStates = model.getInitialStates();
+    for (uint64_t state : model.getInitialStates()) {
+        if (model.getObservation(state) != observation) {
             actualInitialStates.set(state, false);
         }
     }
     STORM_LOG_THROW(actualInitialStates.getNumberOfSetBits() == 1, storm::exceptions::InvalidArgumentException,
                     "Must have unique initial state matching the observation");
-    //
     statesPerObservation[model.getNrObservations()] = actualInitialStates;
 
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-    std::cout << "build valution builder..\n";
-#endif
-    storm::storage::sparse::StateValuationsBuilder svbuilder;
-    svbuilder.addVariable(svvar);
-
-    std::map<uint64_t, uint64_t> unfoldedToOld;
-    std::map<uint64_t, uint64_t> unfoldedToOldNextStep;
-    std::map<uint64_t, uint64_t> oldToUnfolded;
-
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-    std::cout << "start buildiing matrix...\n";
-#endif
+    // The initial state is the only state of the first layer.
+    unfoldedTrace = {observation};
+    unfoldedToOldState = {actualInitialStates.getNextSetIndex(0)};
+    layerStarts = {0};
+    rowGroupStarts = {0};
+    rowStarts = {0};
+    entries.clear();
+    oldToUnfolded.assign(model.getNumberOfStates(), std::numeric_limits<uint64_t>::max());
+}
 
-    // Add this initial state state:
-    unfoldedToOldNextStep[0] = actualInitialStates.getNextSetIndex(0);
+template<typename ValueType>
+void ObservationTraceUnfolder<ValueType>::truncate(uint64_t numberOfLayers) {
+    if (numberOfLayers < layerStarts.size()) {
+        unfoldedToOldState.resize(layerStarts[numberOfLayers]);
+        layerStarts.resize(numberOfLayers);
+    }
+    // Only the states before the last layer keep their rows.
+    rowGroupStarts.resize(layerStarts.back() + 1);
+    rowStarts.resize(rowGroupStarts.back() + 1);
+    entries.erase(entries.begin() + rowStarts.back(), entries.end());
+    unfoldedTrace.resize(numberOfLayers);
+}
 
-    storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, 0, 0, true, true);
-    uint64_t newStateIndex = 1;
-    uint64_t newRowGroupStart = 0;
-    uint64_t newRowCount = 0;
-    // Notice that we are going to use a special last step
-
-    for (uint64_t step = 0; step < observations.size() - 1; ++step) {
-        oldToUnfolded.clear();
-        unfoldedToOld = unfoldedToOldNextStep;
-        unfoldedToOldNextStep.clear();
-
-        for (auto const& unfoldedToOldEntry : unfoldedToOld) {
-            transitionMatrixBuilder.newRowGroup(newRowGroupStart);
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-            std::cout << "\tconsider new state " << unfoldedToOldEntry.first << '\n';
-#endif
-            assert(step == 0 || newRowCount == transitionMatrixBuilder.getLastRow() + 1);
-            svbuilder.addState(unfoldedToOldEntry.first, {}, {static_cast<int64_t>(unfoldedToOldEntry.second)});
-            uint64_t oldRowIndexStart = model.getNondeterministicChoiceIndices()[unfoldedToOldEntry.second];
-            uint64_t oldRowIndexEnd = model.getNondeterministicChoiceIndices()[unfoldedToOldEntry.second + 1];
-
-            for (uint64_t oldRowIndex = oldRowIndexStart; oldRowIndex != oldRowIndexEnd; oldRowIndex++) {
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-                std::cout << "\t\tconsider old action " << oldRowIndex << '\n';
-                std::cout << "\t\tconsider new row nr " << newRowCount << '\n';
-#endif
-
-                ValueType resetProb = storm::utility::zero<ValueType>();
-                // We first find the reset probability
-                for (auto const& oldRowEntry : model.getTransitionMatrix().getRow(oldRowIndex)) {
-                    if (model.getObservation(oldRowEntry.getColumn()) != observations[step + 1]) {
-                        resetProb += oldRowEntry.getValue();
-                    }
+template<typename ValueType>
+void ObservationTraceUnfolder<ValueType>::unfoldLayer(uint32_t observation) {
+    uint64_t const layerStart = layerStarts.back();
+    uint64_t const layerEnd = unfoldedToOldState.size();
+    layerStarts.push_back(layerEnd);
+    for (uint64_t unfoldedState = layerStart; unfoldedState < layerEnd; ++unfoldedState) {
+        uint64_t oldState = unfoldedToOldState[unfoldedState];
+        for (uint64_t oldRowIndex = model.getNondeterministicChoiceIndices()[oldState]; oldRowIndex < model.getNondeterministicChoiceIndices()[oldState + 1];
+             ++oldRowIndex) {
+            // Transitions to states with a different observation reset to the initial state.
+            ValueType resetProb = storm::utility::zero<ValueType>();
+            for (auto const& oldRowEntry : model.getTransitionMatrix().getRow(oldRowIndex)) {
+                if (model.getObservation(oldRowEntry.getColumn()) != observation) {
+                    resetProb += oldRowEntry.getValue();
                 }
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-                std::cout << "\t\t\t add reset with probability " << resetProb << '\n';
-#endif
-
-                // Add the resets
-                if (resetProb != storm::utility::zero<ValueType>()) {
-                    transitionMatrixBuilder.addNextValue(newRowCount, 0, resetProb);
+            }
+            if (resetProb != storm::utility::zero<ValueType>()) {
+                entries.emplace_back(0, resetProb);
+            }
+            for (auto const& oldRowEntry : model.getTransitionMatrix().getRow(oldRowIndex)) {
+                if (model.getObservation(oldRowEntry.getColumn()) != observation) {
+                    continue;  // already handled.
                 }
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-                std::cout << "\t\t\t add other transitions...\n";
-#endif
-
-                // Now, we build the outgoing transitions.
-                for (auto const& oldRowEntry : model.getTransitionMatrix().getRow(oldRowIndex)) {
-                    if (model.getObservation(oldRowEntry.getColumn()) != observations[step + 1]) {
-                        continue;  // already handled.
-                    }
-                    uint64_t column = 0;
-
-                    auto entryIt = oldToUnfolded.find(oldRowEntry.getColumn());
-                    if (entryIt == oldToUnfolded.end()) {
-                        column = newStateIndex;
-                        oldToUnfolded[oldRowEntry.getColumn()] = column;
-                        unfoldedToOldNextStep[column] = oldRowEntry.getColumn();
-                        newStateIndex++;
-                    } else {
-                        column = entryIt->second;
-                    }
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-                    std::cout << "\t\t\t\t transition to " << column << "with probability " << oldRowEntry.getValue() << '\n';
-#endif
-                    transitionMatrixBuilder.addNextValue(newRowCount, column, oldRowEntry.getValue());
+                uint64_t& column = oldToUnfolded[oldRowEntry.getColumn()];
+                if (column == std::numeric_limits<uint64_t>::max()) {
+                    column = unfoldedToOldState.size();
+                    unfoldedToOldState.push_back(oldRowEntry.getColumn());
                 }
-                newRowCount++;
+                entries.emplace_back(column, oldRowEntry.getValue());
             }
+            rowStarts.push_back(entries.size());
+        }
+        rowGroupStarts.push_back(rowStarts.size() - 1);
+    }
+    for (uint64_t unfoldedState = layerEnd; unfoldedState < unfoldedToOldState.size(); ++unfoldedState) {
+        oldToUnfolded[unfoldedToOldState[unfoldedState]] = std::numeric_limits<uint64_t>::max();
+    }
+    unfoldedTrace.push_back(observation);
+}
 
-            newRowGroupStart = transitionMatrixBuilder.getLastRow() + 1;
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Mdp<ValueType>> ObservationTraceUnfolder<ValueType>::buildModel() const {
+    storm::storage::sparse::StateValuationsBuilder svbuilder;
+    svbuilder.addVariable(svvar);
+    storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, 0, 0, true, true);
+
+    uint64_t const numberOfExpandedStates = layerStarts.back();
+    for (uint64_t unfoldedState = 0; unfoldedState < numberOfExpandedStates; ++unfoldedState) {
+        transitionMatrixBuilder.newRowGroup(rowGroupStarts[unfoldedState]);
+        svbuilder.addState(unfoldedState, {}, {static_cast<int64_t>(unfoldedToOldState[unfoldedState])});
+        for (uint64_t row = rowGroupStarts[unfoldedState]; row < rowGroupStarts[unfoldedState + 1]; ++row) {
+            for (uint64_t entry = rowStarts[row]; entry < rowStarts[row + 1]; ++entry) {
+                transitionMatrixBuilder.addNextValue(row, entries[entry].getColumn(), entries[entry].getValue());
+            }
         }
     }
+
     // Now, take care of the last step.
-    uint64_t sinkState = newStateIndex;
-    uint64_t targetState = newStateIndex + 1;
+    uint64_t newRowGroupStart = rowGroupStarts.back();
+    uint64_t sinkState = unfoldedToOldState.size();
+    uint64_t targetState = sinkState + 1;
     auto cc = storm::utility::ConstantsComparator<ValueType>();
-    for (auto const& unfoldedToOldEntry : unfoldedToOldNextStep) {
-        svbuilder.addState(unfoldedToOldEntry.first, {}, {static_cast<int64_t>(unfoldedToOldEntry.second)});
+    for (uint64_t unfoldedState = numberOfExpandedStates; unfoldedState < sinkState; ++unfoldedState) {
+        uint64_t oldState = unfoldedToOldState[unfoldedState];
+        svbuilder.addState(unfoldedState, {}, {static_cast<int64_t>(oldState)});
 
         transitionMatrixBuilder.newRowGroup(newRowGroupStart);
-        STORM_LOG_ASSERT(risk.size() > unfoldedToOldEntry.second, "Must be a state");
-        STORM_LOG_ASSERT(!cc.isLess(storm::utility::one<ValueType>(), risk[unfoldedToOldEntry.second]), "Risk must be a probability");
-        STORM_LOG_ASSERT(!cc.isLess(risk[unfoldedToOldEntry.second], storm::utility::zero<ValueType>()), "Risk must be a probability");
-        // std::cout << "risk is" <<  risk[unfoldedToOldEntry.second] << '\n';
-        if (!storm::utility::isOne(risk[unfoldedToOldEntry.second])) {
-            transitionMatrixBuilder.addNextValue(newRowGroupStart, sinkState, storm::utility::one<ValueType>() - risk[unfoldedToOldEntry.second]);
+        STORM_LOG_ASSERT(risk.size() > oldState, "Must be a state");
+        STORM_LOG_ASSERT(!cc.isLess(storm::utility::one<ValueType>(), risk[oldState]), "Risk must be a probability");
+        STORM_LOG_ASSERT(!cc.isLess(risk[oldState], storm::utility::zero<ValueType>()), "Risk must be a probability");
+        if (!storm::utility::isOne(risk[oldState])) {
+            transitionMatrixBuilder.addNextValue(newRowGroupStart, sinkState, storm::utility::one<ValueType>() - risk[oldState]);
         }
-        if (!storm::utility::isZero(risk[unfoldedToOldEntry.second])) {
-            transitionMatrixBuilder.addNextValue(newRowGroupStart, targetState, risk[unfoldedToOldEntry.second]);
+        if (!storm::utility::isZero(risk[oldState])) {
+            transitionMatrixBuilder.addNextValue(newRowGroupStart, targetState, risk[oldState]);
         }
         newRowGroupStart++;
     }
@@ -159,15 +164,9 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> ObservationTraceUnfolder<
     // target state
     transitionMatrixBuilder.addNextValue(newRowGroupStart, targetState, storm::utility::one<ValueType>());
     svbuilder.addState(targetState, {}, {-1});
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-    std::cout << "build matrix...\n";
-#endif
 
     storm::storage::sparse::ModelComponents<ValueType> components;
     components.transitionMatrix = transitionMatrixBuilder.build();
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-    std::cout << components.transitionMatrix << '\n';
-#endif
     STORM_LOG_ASSERT(components.transitionMatrix.getRowGroupCount() == targetState + 1,
                      "Expect row group count (" << components.transitionMatrix.getRowGroupCount() << ") one more as target state index " << targetState << ")");
 
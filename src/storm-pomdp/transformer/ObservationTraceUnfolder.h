@@ -1,3 +1,5 @@
+#pragma once
+
 #include "storm/models/sparse/Pomdp.h"
 
 namespace storm {
@@ -5,6 +7,10 @@ namespace pomdp {
 /**
  * Observation-trace unrolling to allow model checking for monitoring.
  * This approach is outlined in  Junges, Hazem, Seshia  -- Runtime Monitoring for Markov Decision Processes
+ *
+ * The layers of the unfolding only depend on the prefix of the trace up to them. The unfolder therefore keeps the layers of the last transformed trace and
+ * only unfolds the layers after the longest common prefix with the next trace. Transforming many traces in lexicographic order thus unfolds every node of
+ * the trie of these traces exactly once.
  * @tparam ValueType ValueType for probabilities
  */
 template<typename ValueType>
@@ -19,7 +25,7 @@ class ObservationTraceUnfolder {
     ObservationTraceUnfolder(storm::models::sparse::Pomdp<ValueType> const& model, std::vector<ValueType> const& risk,
                              std::shared_ptr<storm::expressions::ExpressionManager>& exprManager);
     /**
-     * Transform in one shot
+     * Transform in one shot (reusing the layers of the common prefix with the previously transformed trace)
      * @param observations
      * @return
      */
@@ -37,12 +43,41 @@ class ObservationTraceUnfolder {
     void reset(uint32_t observation);
 
    private:
+    /**
+     * Starts a new unfolding with the initial state that matches the given observation.
+     */
+    void initialize(uint32_t observation);
+    /**
+     * Drops all but the given number of layers.
+     */
+    void truncate(uint64_t numberOfLayers);
+    /**
+     * Adds the outgoing transitions of the states of the last layer, which yields a new layer for states with the given observation.
+     */
+    void unfoldLayer(uint32_t observation);
+    /**
+     * Builds the MDP of the current layers, where the states of the last layer move to the target with their risk.
+     */
+    std::shared_ptr<storm::models::sparse::Mdp<ValueType>> buildModel() const;
+
     storm::models::sparse::Pomdp<ValueType> const& model;
     std::vector<ValueType> risk;  // TODO reconsider holding this as a reference, but there were some strange bugs
     std::shared_ptr<storm::expressions::ExpressionManager>& exprManager;
     std::vector<storm::storage::BitVector> statesPerObservation;
     std::vector<uint32_t> traceSoFar;
     storm::expressions::Variable svvar;
+
+    // The current unfolding: the trace it belongs to, the original state of every unfolded state and the first unfolded state of every layer.
+    std::vector<uint32_t> unfoldedTrace;
+    std::vector<uint64_t> unfoldedToOldState;
+    std::vector<uint64_t> layerStarts;
+    // The rows of the unfolded states of all but the last layer. The i-th unfolded state has the rows [rowGroupStarts[i], rowGroupStarts[i+1]) and the
+    // j-th row has the entries [rowStarts[j], rowStarts[j+1]).
+    std::vector<uint64_t> rowGroupStarts;
+    std::vector<uint64_t> rowStarts;
+    std::vector<storm::storage::MatrixEntry<uint64_t, ValueType>> entries;
+    // The unfolded state of every original state in the layer that is currently unfolded (if any).
+    std::vector<uint64_t> oldToUnfolded;
 };
 
 }  // namespace pomdp
@@ -4,8 +4,8 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/sparse/ModelComponents.h"
-#include "storm/utility/graph.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
@@ -20,28 +20,23 @@ PomdpMemoryUnfolder<ValueType>::PomdpMemoryUnfolder(storm::models::sparse::Pomdp
 
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> PomdpMemoryUnfolder<ValueType>::transform(bool dropUnreachableStates) const {
-    // For simplicity we first build the 'full' product of pomdp and memory (with pomdp.numStates * memory.numStates states).
     STORM_LOG_THROW(pomdp.isCanonic(), storm::exceptions::InvalidArgumentException, "POMDP must be canonical to unfold memory into it");
-    storm::storage::sparse::ModelComponents<ValueType> components;
-    components.transitionMatrix = transformTransitions();
-    components.stateLabeling = transformStateLabeling();
-
-    // Now delete unreachable states.
-    storm::storage::BitVector allStates(components.transitionMatrix.getRowGroupCount(), true);
-
-    storm::storage::BitVector reachableStates = allStates;
+    // The reachable states are determined before building the unfolding, so that only the reachable part of the product is ever stored.
+    storm::storage::BitVector reachableStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), true);
     if (dropUnreachableStates) {
-        reachableStates =
-            storm::utility::graph::getReachableStates(components.transitionMatrix, components.stateLabeling.getStates("init"), allStates, ~allStates);
-        components.transitionMatrix = components.transitionMatrix.getSubmatrix(true, reachableStates, reachableStates);
-        components.stateLabeling = components.stateLabeling.getSubLabeling(reachableStates);
-        if (keepStateValuations && pomdp.hasStateValuations()) {
-            std::vector<uint64_t> newToOldStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), 0);
-            for (uint64_t newState = 0; newState < newToOldStates.size(); newState++) {
-                newToOldStates[newState] = getModelState(newState);
-            }
-            components.stateValuations = pomdp.getStateValuations().blowup(newToOldStates).selectStates(reachableStates);
+        reachableStates = computeReachableUnfoldingStates();
+    }
+
+    storm::storage::sparse::ModelComponents<ValueType> components;
+    components.transitionMatrix = transformTransitions(reachableStates);
+    components.stateLabeling = transformStateLabeling(reachableStates);
+    if (dropUnreachableStates && keepStateValuations && pomdp.hasStateValuations()) {
+        std::vector<uint64_t> newToOldStates;
+        newToOldStates.reserve(reachableStates.getNumberOfSetBits());
+        for (auto unfoldingState : reachableStates) {
+            newToOldStates.push_back(getModelState(unfoldingState));
         }
+        components.stateValuations = pomdp.getStateValuations().blowup(newToOldStates);
     }
 
     // build the remaining components
@@ -54,31 +49,90 @@ std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> PomdpMemoryUnfolder<Val
 }
 
 template<typename ValueType>
-storm::storage::SparseMatrix<ValueType> PomdpMemoryUnfolder<ValueType>::transformTransitions() const {
+storm::storage::BitVector PomdpMemoryUnfolder<ValueType>::computeReachableUnfoldingStates() const {
     storm::storage::SparseMatrix<ValueType> const& origTransitions = pomdp.getTransitionMatrix();
-    uint64_t numRows = 0;
-    uint64_t numEntries = 0;
+    storm::storage::BitVector reachableStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), false);
+    std::vector<uint64_t> stack;
+    for (auto const& modelState : pomdp.getInitialStates()) {
+        uint64_t unfoldingState = getUnfoldingState(modelState, memory.getInitialState());
+        if (!reachableStates.get(unfoldingState)) {
+            reachableStates.set(unfoldingState);
+            stack.push_back(unfoldingState);
+        }
+    }
+    while (!stack.empty()) {
+        uint64_t unfoldingState = stack.back();
+        stack.pop_back();
+        uint64_t modelState = getModelState(unfoldingState);
+        for (auto const& memStatePrime : memory.getTransitions(getMemoryState(unfoldingState))) {
+            for (auto const& entry : origTransitions.getRowGroup(modelState)) {
+                uint64_t successor = getUnfoldingState(entry.getColumn(), memStatePrime);
+                if (!reachableStates.get(successor)) {
+                    reachableStates.set(successor);
+                    stack.push_back(successor);
+                }
+            }
+        }
+    }
+    return reachableStates;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> PomdpMemoryUnfolder<ValueType>::computeModelStateOffsets(storm::storage::BitVector const& reachableStates) const {
+    std::vector<uint64_t> offsets;
+    offsets.reserve(pomdp.getNumberOfStates() + 1);
+    uint64_t offset = 0;
     for (uint64_t modelState = 0; modelState < pomdp.getNumberOfStates(); ++modelState) {
+        offsets.push_back(offset);
         for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-            numRows += origTransitions.getRowGroupSize(modelState) * memory.getNumberOfOutgoingTransitions(memState);
-            numEntries += origTransitions.getRowGroup(modelState).getNumberOfEntries() * memory.getNumberOfOutgoingTransitions(memState);
+            if (reachableStates.get(getUnfoldingState(modelState, memState))) {
+                ++offset;
+            }
         }
     }
-    storm::storage::SparseMatrixBuilder<ValueType> builder(numRows, pomdp.getNumberOfStates() * memory.getNumberOfStates(), numEntries, true, true,
-                                                           pomdp.getNumberOfStates() * memory.getNumberOfStates());
+    offsets.push_back(offset);
+    return offsets;
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryUnfolder<ValueType>::getReachableIndex(std::vector<uint64_t> const& modelStateOffsets, storm::storage::BitVector const& reachableStates,
+                                                           uint64_t modelState, uint64_t memoryState) const {
+    STORM_LOG_ASSERT(reachableStates.get(getUnfoldingState(modelState, memoryState)), "Unfolding state is not reachable.");
+    uint64_t index = modelStateOffsets[modelState];
+    for (uint64_t memState = 0; memState < memoryState; ++memState) {
+        if (reachableStates.get(getUnfoldingState(modelState, memState))) {
+            ++index;
+        }
+    }
+    return index;
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> PomdpMemoryUnfolder<ValueType>::transformTransitions(storm::storage::BitVector const& reachableStates) const {
+    storm::storage::SparseMatrix<ValueType> const& origTransitions = pomdp.getTransitionMatrix();
+    std::vector<uint64_t> modelStateOffsets = computeModelStateOffsets(reachableStates);
+    uint64_t numStates = modelStateOffsets.back();
+    uint64_t numRows = 0;
+    uint64_t numEntries = 0;
+    for (auto unfoldingState : reachableStates) {
+        uint64_t modelState = getModelState(unfoldingState);
+        uint64_t memState = getMemoryState(unfoldingState);
+        numRows += origTransitions.getRowGroupSize(modelState) * memory.getNumberOfOutgoingTransitions(memState);
+        numEntries += origTransitions.getRowGroup(modelState).getNumberOfEntries() * memory.getNumberOfOutgoingTransitions(memState);
+    }
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numRows, numStates, numEntries, true, true, numStates);
 
     uint64_t row = 0;
-    for (uint64_t modelState = 0; modelState < pomdp.getNumberOfStates(); ++modelState) {
-        for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-            builder.newRowGroup(row);
-            for (uint64_t origRow = origTransitions.getRowGroupIndices()[modelState]; origRow < origTransitions.getRowGroupIndices()[modelState + 1];
-                 ++origRow) {
-                for (auto const& memStatePrime : memory.getTransitions(memState)) {
-                    for (auto const& entry : origTransitions.getRow(origRow)) {
-                        builder.addNextValue(row, getUnfoldingState(entry.getColumn(), memStatePrime), entry.getValue());
-                    }
-                    ++row;
+    for (auto unfoldingState : reachableStates) {
+        uint64_t modelState = getModelState(unfoldingState);
+        uint64_t memState = getMemoryState(unfoldingState);
+        builder.newRowGroup(row);
+        for (uint64_t origRow = origTransitions.getRowGroupIndices()[modelState]; origRow < origTransitions.getRowGroupIndices()[modelState + 1]; ++origRow) {
+            for (auto const& memStatePrime : memory.getTransitions(memState)) {
+                for (auto const& entry : origTransitions.getRow(origRow)) {
+                    builder.addNextValue(row, getReachableIndex(modelStateOffsets, reachableStates, entry.getColumn(), memStatePrime), entry.getValue());
                 }
+                ++row;
             }
         }
     }
@@ -86,30 +140,35 @@ storm::storage::SparseMatrix<ValueType> PomdpMemoryUnfolder<ValueType>::transfor
 }
 
 template<typename ValueType>
-storm::models::sparse::StateLabeling PomdpMemoryUnfolder<ValueType>::transformStateLabeling() const {
-    storm::models::sparse::StateLabeling labeling(pomdp.getNumberOfStates() * memory.getNumberOfStates());
+storm::models::sparse::StateLabeling PomdpMemoryUnfolder<ValueType>::transformStateLabeling(storm::storage::BitVector const& reachableStates) const {
+    std::vector<uint64_t> modelStateOffsets = computeModelStateOffsets(reachableStates);
+    uint64_t numStates = modelStateOffsets.back();
+    storm::models::sparse::StateLabeling labeling(numStates);
     for (auto const& labelName : pomdp.getStateLabeling().getLabels()) {
-        storm::storage::BitVector newStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), false);
+        storm::storage::BitVector newStates(numStates, false);
 
         // The init label is only assigned to unfolding states with the initial memory state
         if (labelName == "init") {
             for (auto const& modelState : pomdp.getStateLabeling().getStates(labelName)) {
-                newStates.set(getUnfoldingState(modelState, memory.getInitialState()));
+                if (reachableStates.get(getUnfoldingState(modelState, memory.getInitialState()))) {
+                    newStates.set(getReachableIndex(modelStateOffsets, reachableStates, modelState, memory.getInitialState()));
+                }
             }
         } else {
             for (auto const& modelState : pomdp.getStateLabeling().getStates(labelName)) {
-                for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-                    newStates.set(getUnfoldingState(modelState, memState));
-                }
+                // The unfolding states of a model state have consecutive indices
+                newStates.setMultiple(modelStateOffsets[modelState], modelStateOffsets[modelState + 1] - modelStateOffsets[modelState]);
             }
         }
         labeling.addLabel(labelName, std::move(newStates));
     }
     if (addMemoryLabels) {
         for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-            storm::storage::BitVector newStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), false);
+            storm::storage::BitVector newStates(numStates, false);
             for (uint64_t modelState = 0; modelState < pomdp.getNumberOfStates(); ++modelState) {
-                newStates.set(getUnfoldingState(modelState, memState));
+                if (reachableStates.get(getUnfoldingState(modelState, memState))) {
+                    newStates.set(getReachableIndex(modelStateOffsets, reachableStates, modelState, memState));
+                }
             }
             labeling.addLabel("memstate_" + std::to_string(memState), newStates);
         }
@@ -16,8 +16,25 @@ class PomdpMemoryUnfolder {
     std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> transform(bool dropUnreachableStates = true) const;
 
    private:
-    storm::storage::SparseMatrix<ValueType> transformTransitions() const;
-    storm::models::sparse::StateLabeling transformStateLabeling() const;
+    /*!
+     * Computes the states of the unfolding that are reachable from an initial state (with the initial memory state) without building the unfolding.
+     */
+    storm::storage::BitVector computeReachableUnfoldingStates() const;
+
+    /*!
+     * For each model state, computes the index (among the given states of the unfolding) of the first given unfolding state of that model state.
+     * The last entry holds the number of given states.
+     */
+    std::vector<uint64_t> computeModelStateOffsets(storm::storage::BitVector const& reachableStates) const;
+
+    /*!
+     * Retrieves the index of the given unfolding state among the given states of the unfolding.
+     */
+    uint64_t getReachableIndex(std::vector<uint64_t> const& modelStateOffsets, storm::storage::BitVector const& reachableStates, uint64_t modelState,
+                               uint64_t memoryState) const;
+
+    storm::storage::SparseMatrix<ValueType> transformTransitions(storm::storage::BitVector const& reachableStates) const;
+    storm::models::sparse::StateLabeling transformStateLabeling(storm::storage::BitVector const& reachableStates) const;
     std::vector<uint32_t> transformObservabilityClasses(storm::storage::BitVector const& reachableStates) const;
     storm::models::sparse::StandardRewardModel<ValueType> transformRewardModel(storm::models::sparse::StandardRewardModel<ValueType> const& rewardModel,
                                                                                storm::storage::BitVector const& reachableStates) const;
@@ -68,6 +68,8 @@ std::string dumpJson(storm::json<ValueType> const& j, bool compact) {
     }
 }
 
+template bool isJsonNumberExportAccurate(storm::json<double> const& j);
+template bool isJsonNumberExportAccurate(storm::json<storm::RationalNumber> const& j);
 template std::string dumpJson(storm::json<double> const& j, bool compact = false);
 template std::string dumpJson(storm::json<storm::RationalNumber> const& j, bool compact = false);
 
@@ -41,4 +41,7 @@ typedef GmpRationalNumber RationalNumber;
 #else
 #error GMP is to be used, but is not available.
 #endif
+
+// A rational number that is stored inline as long as it fits into 64 bits (see SmallRationalNumber.h).
+class SmallRationalNumber;
 }  // namespace storm
@@ -0,0 +1,248 @@
+#include "storm/adapters/SmallRationalNumber.h"
+
+#include <limits>
+#include <numeric>
+#include <ostream>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+
+namespace {
+bool multiplyOverflows(int64_t first, int64_t second, int64_t& result) {
+    return __builtin_mul_overflow(first, second, &result);
+}
+
+bool addOverflows(int64_t first, int64_t second, int64_t& result) {
+    return __builtin_add_overflow(first, second, &result);
+}
+
+// All integers up to this absolute value are represented exactly by a double.
+int64_t const maximalExactDoubleInteger = int64_t(1) << std::numeric_limits<double>::digits;
+}  // namespace
+
+SmallRationalNumber::SmallRationalNumber() : numerator(0), denominator(1) {
+    // Intentionally left empty.
+}
+
+SmallRationalNumber::SmallRationalNumber(int64_t value) : numerator(0), denominator(1) {
+    setFraction(value, 1);
+}
+
+SmallRationalNumber::SmallRationalNumber(int64_t numerator, int64_t denominator) : numerator(0), denominator(1) {
+    STORM_LOG_THROW(denominator != 0, storm::exceptions::InvalidArgumentException, "The denominator of a rational number must not be zero.");
+    setFraction(numerator, denominator);
+}
+
+SmallRationalNumber::SmallRationalNumber(storm::RationalNumber const& value) : numerator(0), denominator(1) {
+    storm::RationalNumber const limit = storm::utility::convertNumber<storm::RationalNumber>(static_cast<int_fast64_t>(std::numeric_limits<int64_t>::max()));
+    storm::RationalNumber const valueNumerator = storm::utility::convertNumber<storm::RationalNumber>(storm::utility::numerator(value));
+    storm::RationalNumber const valueDenominator = storm::utility::convertNumber<storm::RationalNumber>(storm::utility::denominator(value));
+    if (valueNumerator <= limit && -valueNumerator <= limit && valueDenominator <= limit) {
+        numerator = storm::utility::convertNumber<int_fast64_t>(valueNumerator);
+        denominator = storm::utility::convertNumber<int_fast64_t>(valueDenominator);
+    } else {
+        large = std::make_unique<storm::RationalNumber>(value);
+    }
+}
+
+SmallRationalNumber::SmallRationalNumber(SmallRationalNumber const& other)
+    : numerator(other.numerator), denominator(other.denominator), large(other.large ? std::make_unique<storm::RationalNumber>(*other.large) : nullptr) {
+    // Intentionally left empty.
+}
+
+SmallRationalNumber& SmallRationalNumber::operator=(SmallRationalNumber const& other) {
+    if (this != &other) {
+        numerator = other.numerator;
+        denominator = other.denominator;
+        if (!other.large) {
+            large.reset();
+        } else if (large) {
+            *large = *other.large;
+        } else {
+            large = std::make_unique<storm::RationalNumber>(*other.large);
+        }
+    }
+    return *this;
+}
+
+bool SmallRationalNumber::isSmall() const {
+    return !large;
+}
+
+storm::RationalNumber SmallRationalNumber::toRationalNumber() const {
+    if (large) {
+        return *large;
+    }
+    storm::RationalNumber result = storm::utility::convertNumber<storm::RationalNumber>(static_cast<int_fast64_t>(numerator));
+    if (denominator != 1) {
+        result /= storm::utility::convertNumber<storm::RationalNumber>(static_cast<int_fast64_t>(denominator));
+    }
+    return result;
+}
+
+double SmallRationalNumber::toDouble() const {
+    // Dividing two exactly represented integers yields the correctly rounded result.
+    if (!large && -maximalExactDoubleInteger <= numerator && numerator <= maximalExactDoubleInteger && denominator <= maximalExactDoubleInteger) {
+        return static_cast<double>(numerator) / static_cast<double>(denominator);
+    }
+    return storm::utility::convertNumber<double>(toRationalNumber());
+}
+
+std::size_t SmallRationalNumber::hash() const {
+    // Large numbers may have a value that could also be stored inline, so both need to be hashed the same way.
+    return std::hash<storm::RationalNumber>()(toRationalNumber());
+}
+
+void SmallRationalNumber::setFraction(int64_t newNumerator, int64_t newDenominator) {
+    int64_t const minimalValue = std::numeric_limits<int64_t>::min();
+    if (newNumerator == minimalValue || newDenominator == minimalValue) {
+        large = std::make_unique<storm::RationalNumber>(storm::utility::convertNumber<storm::RationalNumber>(static_cast<int_fast64_t>(newNumerator)) /
+                                                        storm::utility::convertNumber<storm::RationalNumber>(static_cast<int_fast64_t>(newDenominator)));
+        return;
+    }
+    int64_t divisor = std::gcd(newNumerator, newDenominator);
+    if (newDenominator < 0) {
+        divisor = -divisor;
+    }
+    numerator = newNumerator / divisor;
+    denominator = newDenominator / divisor;
+    large.reset();
+}
+
+storm::RationalNumber& SmallRationalNumber::promote() {
+    if (!large) {
+        large = std::make_unique<storm::RationalNumber>(toRationalNumber());
+    }
+    return *large;
+}
+
+SmallRationalNumber& SmallRationalNumber::operator+=(SmallRationalNumber const& other) {
+    if (!large && !other.large) {
+        // Use the gcd of the denominators to keep the intermediate values small.
+        int64_t const divisor = std::gcd(denominator, other.denominator);
+        int64_t first, second, sum, product;
+        if (!multiplyOverflows(numerator, other.denominator / divisor, first) && !multiplyOverflows(other.numerator, denominator / divisor, second) &&
+            !addOverflows(first, second, sum) && !multiplyOverflows(denominator / divisor, other.denominator, product)) {
+            setFraction(sum, product);
+            return *this;
+        }
+    }
+    promote() += other.toRationalNumber();
+    return *this;
+}
+
+SmallRationalNumber& SmallRationalNumber::operator-=(SmallRationalNumber const& other) {
+    return *this += -other;
+}
+
+SmallRationalNumber& SmallRationalNumber::operator*=(SmallRationalNumber const& other) {
+    if (!large && !other.large) {
+        // Cancel common factors first, so the result is already reduced and the intermediate values stay small.
+        int64_t const firstDivisor = std::gcd(numerator, other.denominator);
+        int64_t const secondDivisor = std::gcd(other.numerator, denominator);
+        int64_t resultNumerator, resultDenominator;
+        if (!multiplyOverflows(numerator / firstDivisor, other.numerator / secondDivisor, resultNumerator) &&
+            !multiplyOverflows(denominator / secondDivisor, other.denominator / firstDivisor, resultDenominator)) {
+            setFraction(resultNumerator, resultDenominator);
+            return *this;
+        }
+    }
+    promote() *= other.toRationalNumber();
+    return *this;
+}
+
+SmallRationalNumber& SmallRationalNumber::operator/=(SmallRationalNumber const& other) {
+    STORM_LOG_THROW(other.large ? !storm::utility::isZero(*other.large) : other.numerator != 0, storm::exceptions::InvalidArgumentException,
+                    "Division by zero.");
+    if (!large && !other.large) {
+        int64_t const numeratorDivisor = std::gcd(numerator, other.numerator);
+        int64_t const denominatorDivisor = std::gcd(denominator, other.denominator);
+        int64_t resultNumerator, resultDenominator;
+        if (!multiplyOverflows(numerator / numeratorDivisor, other.denominator / denominatorDivisor, resultNumerator) &&
+            !multiplyOverflows(denominator / denominatorDivisor, other.numerator / numeratorDivisor, resultDenominator)) {
+            setFraction(resultNumerator, resultDenominator);
+            return *this;
+        }
+    }
+    promote() /= other.toRationalNumber();
+    return *this;
+}
+
+SmallRationalNumber SmallRationalNumber::operator-() const {
+    if (large) {
+        return SmallRationalNumber(storm::RationalNumber(-*large));
+    }
+    SmallRationalNumber result;
+    result.numerator = -numerator;
+    result.denominator = denominator;
+    return result;
+}
+
+bool operator==(SmallRationalNumber const& first, SmallRationalNumber const& second) {
+    if (!first.large && !second.large) {
+        return first.numerator == second.numerator && first.denominator == second.denominator;
+    }
+    return first.toRationalNumber() == second.toRationalNumber();
+}
+
+bool operator<(SmallRationalNumber const& first, SmallRationalNumber const& second) {
+    if (!first.large && !second.large) {
+        int64_t firstProduct, secondProduct;
+        if (!multiplyOverflows(first.numerator, second.denominator, firstProduct) && !multiplyOverflows(second.numerator, first.denominator, secondProduct)) {
+            return firstProduct < secondProduct;
+        }
+    }
+    return first.toRationalNumber() < second.toRationalNumber();
+}
+
+std::ostream& operator<<(std::ostream& out, SmallRationalNumber const& number) {
+    if (number.large) {
+        out << *number.large;
+    } else if (number.denominator == 1) {
+        out << number.numerator;
+    } else {
+        out << number.numerator << "/" << number.denominator;
+    }
+    return out;
+}
+
+SmallRationalNumber operator+(SmallRationalNumber first, SmallRationalNumber const& second) {
+    return first += second;
+}
+
+SmallRationalNumber operator-(SmallRationalNumber first, SmallRationalNumber const& second) {
+    return first -= second;
+}
+
+SmallRationalNumber operator*(SmallRationalNumber first, SmallRationalNumber const& second) {
+    return first *= second;
+}
+
+SmallRationalNumber operator/(SmallRationalNumber first, SmallRationalNumber const& second) {
+    return first /= second;
+}
+
+bool operator!=(SmallRationalNumber const& first, SmallRationalNumber const& second) {
+    return !(first == second);
+}
+
+bool operator>(SmallRationalNumber const& first, SmallRationalNumber const& second) {
+    return second < first;
+}
+
+bool operator<=(SmallRationalNumber const& first, SmallRationalNumber const& second) {
+    return !(second < first);
+}
+
+bool operator>=(SmallRationalNumber const& first, SmallRationalNumber const& second) {
+    return !(first < second);
+}
+
+std::size_t hash_value(SmallRationalNumber const& number) {
+    return number.hash();
+}
+
+}  // namespace storm
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+namespace storm {
+
+/*!
+ * An exact rational number that stores fractions whose numerator and denominator fit into 64 bits inline. Only if an operation overflows, the result
+ * is stored as (heap-allocated) arbitrary precision rational number. As the probabilities of most exact models have small denominators, this avoids
+ * allocating memory for most values and most arithmetic operations on them.
+ */
+class SmallRationalNumber {
+   public:
+    /*!
+     * Creates the number zero.
+     */
+    SmallRationalNumber();
+
+    /*!
+     * Creates the given integer.
+     */
+    SmallRationalNumber(int64_t value);
+
+    /*!
+     * Creates the fraction numerator/denominator, which does not need to be reduced.
+     */
+    SmallRationalNumber(int64_t numerator, int64_t denominator);
+
+    /*!
+     * Creates the given rational number, which is stored inline if it fits.
+     */
+    explicit SmallRationalNumber(storm::RationalNumber const& value);
+
+    SmallRationalNumber(SmallRationalNumber const& other);
+    SmallRationalNumber(SmallRationalNumber&& other) = default;
+    SmallRationalNumber& operator=(SmallRationalNumber const& other);
+    SmallRationalNumber& operator=(SmallRationalNumber&& other) = default;
+
+    /*!
+     * Retrieves whether the number is stored inline (rather than as arbitrary precision rational number).
+     */
+    bool isSmall() const;
+
+    storm::RationalNumber toRationalNumber() const;
+    double toDouble() const;
+
+    /*!
+     * Computes a hash value that only depends on the value of the number (and not on how it is stored).
+     */
+    std::size_t hash() const;
+
+    SmallRationalNumber& operator+=(SmallRationalNumber const& other);
+    SmallRationalNumber& operator-=(SmallRationalNumber const& other);
+    SmallRationalNumber& operator*=(SmallRationalNumber const& other);
+    SmallRationalNumber& operator/=(SmallRationalNumber const& other);
+    SmallRationalNumber operator-() const;
+
+    friend bool operator==(SmallRationalNumber const& first, SmallRationalNumber const& second);
+    friend bool operator<(SmallRationalNumber const& first, SmallRationalNumber const& second);
+    friend std::ostream& operator<<(std::ostream& out, SmallRationalNumber const& number);
+
+   private:
+    /*!
+     * Sets the number to the reduced fraction numerator/denominator or to the corresponding arbitrary precision number if the reduced fraction can
+     * not be stored inline.
+     */
+    void setFraction(int64_t numerator, int64_t denominator);
+
+    /*!
+     * Makes sure the number is stored as arbitrary precision rational number.
+     */
+    storm::RationalNumber& promote();
+
+    // The reduced fraction if the number is stored inline. The denominator is always positive and the numerator is never the smallest int64_t, so
+    // negating the number can not overflow.
+    int64_t numerator;
+    int64_t denominator;
+
+    // The number if it is not stored inline.
+    std::unique_ptr<storm::RationalNumber> large;
+};
+
+SmallRationalNumber operator+(SmallRationalNumber first, SmallRationalNumber const& second);
+SmallRationalNumber operator-(SmallRationalNumber first, SmallRationalNumber const& second);
+SmallRationalNumber operator*(SmallRationalNumber first, SmallRationalNumber const& second);
+SmallRationalNumber operator/(SmallRationalNumber first, SmallRationalNumber const& second);
+
+bool operator!=(SmallRationalNumber const& first, SmallRationalNumber const& second);
+bool operator>(SmallRationalNumber const& first, SmallRationalNumber const& second);
+bool operator<=(SmallRationalNumber const& first, SmallRationalNumber const& second);
+bool operator>=(SmallRationalNumber const& first, SmallRationalNumber const& second);
+
+std::size_t hash_value(SmallRationalNumber const& number);
+
+}  // namespace storm
+
+namespace std {
+template<>
+struct hash<storm::SmallRationalNumber> {
+    std::size_t operator()(storm::SmallRationalNumber const& number) const {
+        return number.hash();
+    }
+};
+}  // namespace std
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "storm/builder/ParallelCompositionBuilder.h"
+
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
@@ -10,6 +12,7 @@
 #include "storm/storage/dd/BisimulationDecomposition.h"
 #include "storm/storage/dd/DdType.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
 
@@ -69,6 +72,43 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> performBisimulationMini
     }
 }
 
+/*!
+ * Computes the bisimulation quotient of the parallel (interleaving) composition of the given CTMCs without building the composition of the original
+ * CTMCs. Each component is minimized, then the components are composed one by one and every intermediate composition is minimized again. As bisimulation
+ * is a congruence wrt. this composition, the result is bisimilar to the minimized composition of the original CTMCs, but only (the reachable parts of)
+ * compositions of quotients are ever built.
+ *
+ * @param components The CTMCs to compose. They must not share any transitions (see ParallelCompositionBuilder).
+ * @param formulas The formulas that are to be preserved.
+ * @param labelAnd If true, a label holds in a composed state iff it holds in both component states. Otherwise, it holds iff it holds in either of them.
+ * @param type The kind of bisimulation to compute.
+ * @return The minimized composition.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> performCompositionalBisimulationMinimization(
+    std::vector<std::shared_ptr<storm::models::sparse::Ctmc<ValueType>>> const& components,
+    std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, bool labelAnd,
+    storm::storage::BisimulationType type = storm::storage::BisimulationType::Strong) {
+    STORM_LOG_THROW(!components.empty(), storm::exceptions::InvalidArgumentException, "Cannot compose an empty set of CTMCs.");
+
+    std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> composition;
+    for (auto const& component : components) {
+        std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> quotient =
+            performDeterministicSparseBisimulationMinimization<storm::models::sparse::Ctmc<ValueType>>(component, formulas, type);
+        STORM_LOG_DEBUG("Minimized component from " << component->getNumberOfStates() << " to " << quotient->getNumberOfStates() << " states.");
+        if (!composition) {
+            composition = quotient;
+            continue;
+        }
+
+        composition = storm::builder::ParallelCompositionBuilder<ValueType>::compose({composition, quotient}, labelAnd);
+        std::uint64_t numberOfComposedStates = composition->getNumberOfStates();
+        composition = performDeterministicSparseBisimulationMinimization<storm::models::sparse::Ctmc<ValueType>>(composition, formulas, type);
+        STORM_LOG_DEBUG("Minimized composition from " << numberOfComposedStates << " to " << composition->getNumberOfStates() << " states.");
+    }
+    return composition;
+}
+
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType = ValueType>
 typename std::enable_if<DdType == storm::dd::DdType::Sylvan || std::is_same<ValueType, double>::value,
                         std::shared_ptr<storm::models::Model<ExportValueType>>>::type
@@ -14,6 +14,7 @@
 #include "storm/storage/sparse/ModelComponents.h"
 
 #include "storm/builder/BuilderType.h"
+#include "storm/builder/ConstantSweepModelBuilder.h"
 #include "storm/builder/DdJaniModelBuilder.h"
 #include "storm/builder/DdPrismModelBuilder.h"
 
@@ -115,6 +116,27 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm:
     return buildSparseModel<ValueType>(model, options);
 }
 
+/*!
+ * Builds the sparse models of the given program for each of the given definitions of its undefined constants. If the undefined constants do not affect the
+ * state space, it is explored only once (see storm::builder::ConstantSweepModelBuilder).
+ *
+ * @param program The program with undefined constants.
+ * @param constantDefinitions For each model, the definitions of the undefined constants.
+ * @param options The builder options.
+ * @return The models in the order of the given definitions.
+ */
+template<typename ValueType>
+std::vector<std::shared_ptr<storm::models::sparse::Model<ValueType>>> buildSparseModelsForConstantSweep(
+    storm::prism::Program const& program, std::vector<std::map<storm::expressions::Variable, storm::expressions::Expression>> const& constantDefinitions,
+    storm::builder::BuilderOptions const& options) {
+    storm::builder::ConstantSweepModelBuilder<ValueType> builder(program, options);
+    std::vector<std::shared_ptr<storm::models::sparse::Model<ValueType>>> result;
+    for (auto const& definitions : constantDefinitions) {
+        result.push_back(builder.build(definitions));
+    }
+    return result;
+}
+
 template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> buildSparseModel(
     storm::models::ModelType modelType, storm::storage::sparse::ModelComponents<ValueType, RewardModelType>&& components) {
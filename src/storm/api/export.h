@@ -2,6 +2,7 @@
 
 #include "storm/adapters/JsonForward.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/BinaryModelExporter.h"
 #include "storm/io/DDEncodingExporter.h"
 #include "storm/io/DirectEncodingExporter.h"
 #include "storm/io/file.h"
@@ -53,6 +54,19 @@ void exportSparseModelAsJson(std::shared_ptr<storm::models::sparse::Model<ValueT
     storm::utility::closeFile(stream);
 }
 
+template<typename ValueType>
+void exportSparseModelAsBinary(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+        STORM_PRINT_AND_LOG("Write to file " << filename << ".\n");
+        storm::exporter::binaryExportSparseModel(stream, model);
+        storm::utility::closeFile(stream);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Only models over doubles can be exported in the binary format.");
+    }
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 void exportSymbolicModelAsDot(std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> const& model, std::string const& filename) {
     model->writeDotToFile(filename);
@@ -61,9 +75,17 @@ void exportSymbolicModelAsDot(std::shared_ptr<storm::models::symbolic::Model<Typ
 template<typename ValueType>
 void exportScheduler(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::storage::Scheduler<ValueType> const& scheduler,
                      std::string const& filename) {
+    std::string jsonFileExtension = ".json";
+    std::string binaryFileExtension = ".bin";
+    if (filename.size() > 4 && std::equal(binaryFileExtension.rbegin(), binaryFileExtension.rend(), filename.rbegin())) {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+        storm::exporter::binaryExportScheduler(stream, scheduler);
+        storm::utility::closeFile(stream);
+        return;
+    }
     std::ofstream stream;
     storm::utility::openFile(filename, stream);
-    std::string jsonFileExtension = ".json";
     if (filename.size() > 4 && std::equal(jsonFileExtension.rbegin(), jsonFileExtension.rend(), filename.rbegin())) {
         scheduler.printJsonToStream(stream, model, false, true);
     } else {
@@ -78,13 +100,12 @@ inline void exportCheckResultToJson(std::shared_ptr<storm::models::sparse::Model
     std::ofstream stream;
     storm::utility::openFile(filename, stream);
     if (checkResult->isExplicitQualitativeCheckResult()) {
-        auto j = checkResult->asExplicitQualitativeCheckResult().toJson(model->getOptionalStateValuations(), model->getStateLabeling());
-        stream << storm::dumpJson(j);
+        checkResult->asExplicitQualitativeCheckResult().printJsonToStream(stream, model->getOptionalStateValuations(), model->getStateLabeling());
     } else {
         STORM_LOG_THROW(checkResult->isExplicitQuantitativeCheckResult(), storm::exceptions::NotSupportedException,
                         "Export of check results is only supported for explicit check results (e.g. in the sparse engine)");
-        auto j = checkResult->template asExplicitQuantitativeCheckResult<ValueType>().toJson(model->getOptionalStateValuations(), model->getStateLabeling());
-        stream << storm::dumpJson(j);
+        checkResult->template asExplicitQuantitativeCheckResult<ValueType>().printJsonToStream(stream, model->getOptionalStateValuations(),
+                                                                                                 model->getStateLabeling());
     }
     storm::utility::closeFile(stream);
 }
@@ -1,14 +1,17 @@
 #pragma once
 
+#include <optional>
 #include <type_traits>
 
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/HybridMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
+#include "storm/modelchecker/hints/SolutionHintCache.h"
 #include "storm/modelchecker/prctl/HybridDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/HybridMdpPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
@@ -17,6 +20,7 @@
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/simulation/SimulationModelChecker.h"
 
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
@@ -88,6 +92,43 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithExplorationEngine(st
     return verifyWithExplorationEngine(env, model, task);
 }
 
+//
+// Verifying with Simulation engine
+//
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSimulationEngine(
+    storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    STORM_LOG_THROW(model.isPrismProgram(), storm::exceptions::NotSupportedException, "Simulation engine is currently only applicable to PRISM models.");
+    storm::prism::Program const& program = model.asPrismProgram();
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    if (program.getModelType() == storm::prism::Program::ModelType::DTMC) {
+        storm::modelchecker::SimulationModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(program);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "The model type " << program.getModelType() << " is not supported by the simulation engine.");
+    }
+
+    return result;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSimulationEngine(
+    storm::Environment const&, storm::storage::SymbolicModelDescription const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Simulation engine does not support data type.");
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSimulationEngine(storm::storage::SymbolicModelDescription const& model,
+                                                                             storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    Environment env;
+    return verifyWithSimulationEngine(env, model, task);
+}
+
 //
 // Verifying with Sparse engine
 //
@@ -231,20 +272,41 @@ template<typename ValueType>
 std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env,
                                                                          std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
                                                                          storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    // If a hint cache is set, the cached results of previous invocations warm-start the computation and the new result is cached.
+    std::optional<storm::modelchecker::SolutionHintCache> hintCache;
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> actualTask = task;
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (env.modelchecker().isHintCacheDirectorySet() && storm::modelchecker::SolutionHintCache::isApplicable(env, *model, task)) {
+            hintCache.emplace(env.modelchecker().getHintCacheDirectory());
+            if (auto hint = hintCache->load(*model, task)) {
+                actualTask.setHint(hint);
+            }
+            if (model->isNondeterministicModel()) {
+                actualTask.setProduceSchedulers(true);
+            }
+        }
+    }
+
     std::unique_ptr<storm::modelchecker::CheckResult> result;
     if (model->getType() == storm::models::ModelType::Dtmc) {
-        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Dtmc<ValueType>>(), task);
+        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Dtmc<ValueType>>(), actualTask);
     } else if (model->getType() == storm::models::ModelType::Mdp) {
-        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Mdp<ValueType>>(), task);
+        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Mdp<ValueType>>(), actualTask);
     } else if (model->getType() == storm::models::ModelType::Ctmc) {
-        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Ctmc<ValueType>>(), task);
+        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Ctmc<ValueType>>(), actualTask);
     } else if (model->getType() == storm::models::ModelType::MarkovAutomaton) {
-        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>(), task);
+        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>(), actualTask);
     } else if (model->getType() == storm::models::ModelType::Smg) {
-        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Smg<ValueType>>(), task);
+        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Smg<ValueType>>(), actualTask);
     } else {
         STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The model type " << model->getType() << " is not supported by the sparse engine.");
     }
+
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (hintCache && result) {
+            hintCache->store(*model, task, *result);
+        }
+    }
     return result;
 }
 
@@ -9,15 +9,24 @@
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/OutOfRangeException.h"
 
 namespace storm {
 namespace automata {
+namespace detail {
+// The maximal number of entries for which the successors are stored for every state and letter.
+std::size_t const maximalSuccessorTableSize = 1ull << 20;
+}  // namespace detail
+
+bool DeterministicAutomaton::LabelCube::matches(APSet::alphabet_element letter) const {
+    return (letter & mask) == values;
+}
+
 DeterministicAutomaton::DeterministicAutomaton(APSet apSet, std::size_t numberOfStates, std::size_t initialState, AcceptanceCondition::ptr acceptance)
     : apSet(apSet), numberOfStates(numberOfStates), initialState(initialState), acceptance(acceptance) {
-    // TODO: this could overflow, add check?
     edgesPerState = apSet.alphabetSize();
-    numberOfEdges = numberOfStates * edgesPerState;
-    successors.resize(numberOfEdges);
+    edges.resize(numberOfStates);
 }
 
 std::size_t DeterministicAutomaton::getInitialState() const {
@@ -29,13 +38,99 @@ const APSet& DeterministicAutomaton::getAPSet() const {
 }
 
 std::size_t DeterministicAutomaton::getSuccessor(std::size_t from, APSet::alphabet_element label) const {
-    std::size_t index = from * edgesPerState + label;
-    return successors.at(index);
+    if (!successors.empty()) {
+        return successors[from * edgesPerState + label];
+    }
+    return getSuccessorFromDecisionDiagram(from, label);
+}
+
+std::size_t DeterministicAutomaton::getSuccessorFromDecisionDiagram(std::size_t from, APSet::alphabet_element label) const {
+    STORM_LOG_ASSERT(from < decisionRoots.size(), "The edges of the automaton have not been finalized.");
+    DecisionNode const* node = &decisionNodes[decisionRoots[from]];
+    while (node->ap < apSet.size()) {
+        node = &decisionNodes[(label >> node->ap) & 1 ? node->high : node->low];
+    }
+    return node->low;
 }
 
 void DeterministicAutomaton::setSuccessor(std::size_t from, APSet::alphabet_element label, std::size_t successor) {
-    std::size_t index = from * edgesPerState + label;
-    successors.at(index) = successor;
+    addEdge(from, {LabelCube{edgesPerState - 1, label}}, successor);
+}
+
+void DeterministicAutomaton::addEdge(std::size_t from, std::vector<LabelCube> const& guard, std::size_t successor) {
+    STORM_LOG_THROW(from < numberOfStates && successor < numberOfStates, storm::exceptions::OutOfRangeException,
+                    "Edge from state " << from << " to state " << successor << " is out of range.");
+    for (auto const& cube : guard) {
+        edges[from].push_back(Edge{LabelCube{cube.mask, cube.values & cube.mask}, successor});
+    }
+}
+
+void DeterministicAutomaton::finalizeEdges() {
+    decisionNodes.clear();
+    decisionRoots.clear();
+    decisionRoots.reserve(numberOfStates);
+    std::vector<Edge const*> candidates;
+    for (std::size_t state = 0; state < numberOfStates; ++state) {
+        candidates.clear();
+        for (auto const& edge : edges[state]) {
+            candidates.push_back(&edge);
+        }
+        decisionRoots.push_back(buildDecisionNode(state, candidates, apSet.elementAllFalse()));
+    }
+
+    successors.clear();
+    if (numberOfStates <= (detail::maximalSuccessorTableSize >> apSet.size())) {
+        successors.resize(numberOfStates * edgesPerState);
+        for (std::size_t state = 0; state < numberOfStates; ++state) {
+            for (APSet::alphabet_element label = 0; label < edgesPerState; ++label) {
+                successors[state * edgesPerState + label] = getSuccessorFromDecisionDiagram(state, label);
+            }
+        }
+    }
+}
+
+std::size_t DeterministicAutomaton::buildDecisionNode(std::size_t state, std::vector<Edge const*> const& candidates, APSet::alphabet_element decidedAPs) {
+    STORM_LOG_THROW(!candidates.empty(), storm::exceptions::InvalidOperationException,
+                    "Deterministic automaton is not complete: state " << state << " has no successor for some letters.");
+
+    // If the current (partial) letter satisfies a cube, all remaining letters lead to its successor.
+    APSet::alphabet_element undecidedAPs = 0;
+    Edge const* satisfiedEdge = nullptr;
+    for (auto const& candidate : candidates) {
+        APSet::alphabet_element undecidedAPsOfCandidate = candidate->guard.mask & ~decidedAPs;
+        if (undecidedAPsOfCandidate == 0 && satisfiedEdge == nullptr) {
+            satisfiedEdge = candidate;
+        }
+        undecidedAPs |= undecidedAPsOfCandidate;
+    }
+    if (satisfiedEdge) {
+        for (auto const& candidate : candidates) {
+            STORM_LOG_THROW(candidate->successor == satisfiedEdge->successor, storm::exceptions::InvalidOperationException,
+                            "Deterministic automaton has multiple definitions of successor for state " << state << ".");
+        }
+        decisionNodes.push_back(DecisionNode{apSet.size(), satisfiedEdge->successor, satisfiedEdge->successor});
+        return decisionNodes.size() - 1;
+    }
+
+    // Otherwise, we branch on the first atomic proposition that is relevant for one of the candidates.
+    unsigned int ap = 0;
+    while (((undecidedAPs >> ap) & 1) == 0) {
+        ++ap;
+    }
+    APSet::alphabet_element apMask = apSet.elementAddAP(apSet.elementAllFalse(), ap);
+    std::vector<Edge const*> lowCandidates, highCandidates;
+    for (auto const& candidate : candidates) {
+        if ((candidate->guard.mask & apMask) == 0 || (candidate->guard.values & apMask) == 0) {
+            lowCandidates.push_back(candidate);
+        }
+        if ((candidate->guard.mask & apMask) == 0 || (candidate->guard.values & apMask) != 0) {
+            highCandidates.push_back(candidate);
+        }
+    }
+    std::size_t low = buildDecisionNode(state, lowCandidates, decidedAPs | apMask);
+    std::size_t high = buildDecisionNode(state, highCandidates, decidedAPs | apMask);
+    decisionNodes.push_back(DecisionNode{ap, low, high});
+    return decisionNodes.size() - 1;
 }
 
 std::size_t DeterministicAutomaton::getNumberOfStates() const {
@@ -81,8 +176,21 @@ void DeterministicAutomaton::printHOA(std::ostream& out) const {
             }
         }
         out << "}\n";
-        for (std::size_t label = 0; label < getNumberOfEdgesPerState(); label++) {
-            out << getSuccessor(s, label) << "\n";
+        for (auto const& edge : edges[s]) {
+            out << "[";
+            if (edge.guard.mask == apSet.elementAllFalse()) {
+                out << "t";
+            }
+            bool firstLiteral = true;
+            for (unsigned int ap = 0; ap < apSet.size(); ap++) {
+                if ((edge.guard.mask >> ap) & 1) {
+                    if (!firstLiteral)
+                        out << " & ";
+                    firstLiteral = false;
+                    out << (((edge.guard.values >> ap) & 1) ? "" : "!") << ap;
+                }
+            }
+            out << "] " << edge.successor << "\n";
         }
     }
 }
@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <memory>
+#include <vector>
 #include "storm/automata/APSet.h"
 
 namespace storm {
@@ -13,15 +14,44 @@ class DeterministicAutomaton {
    public:
     typedef std::shared_ptr<DeterministicAutomaton> ptr;
 
+    /*!
+     * A conjunction of literals over the atomic propositions. A letter satisfies the cube iff it agrees with the
+     * values on all atomic propositions contained in the mask.
+     */
+    struct LabelCube {
+        APSet::alphabet_element mask;
+        APSet::alphabet_element values;
+
+        bool matches(APSet::alphabet_element letter) const;
+    };
+
     DeterministicAutomaton(APSet apSet, std::size_t numberOfStates, std::size_t initialState, std::shared_ptr<AcceptanceCondition> acceptance);
 
     const APSet& getAPSet() const;
 
     std::size_t getInitialState() const;
 
+    /*!
+     * Retrieves the successor of the given state for the given letter. Requires that the edges have been finalized.
+     */
     std::size_t getSuccessor(std::size_t from, APSet::alphabet_element label) const;
+
+    /*!
+     * Adds an edge from the given state that is taken for exactly the given letter.
+     */
     void setSuccessor(std::size_t from, APSet::alphabet_element label, std::size_t successor);
 
+    /*!
+     * Adds an edge from the given state that is taken for all letters satisfying (at least) one of the given cubes.
+     */
+    void addEdge(std::size_t from, std::vector<LabelCube> const& guard, std::size_t successor);
+
+    /*!
+     * Builds the structures that are used to look up successors. This has to be called once after all edges have been
+     * added. Throws if the edges of some state do not define exactly one successor for every letter.
+     */
+    void finalizeEdges();
+
     std::size_t getNumberOfStates() const;
     std::size_t getNumberOfEdgesPerState() const;
 
@@ -33,12 +63,38 @@ class DeterministicAutomaton {
     static DeterministicAutomaton::ptr parseFromFile(const std::string& filename);
 
    private:
+    struct Edge {
+        LabelCube guard;
+        std::size_t successor;
+    };
+
+    /*!
+     * A node of the decision diagram of a state. Inner nodes branch on the value of an atomic proposition, leaves
+     * (whose atomic proposition is the number of atomic propositions) store the successor state in 'low'.
+     */
+    struct DecisionNode {
+        unsigned int ap;
+        std::size_t low;
+        std::size_t high;
+    };
+
+    std::size_t buildDecisionNode(std::size_t state, std::vector<Edge const*> const& candidates, APSet::alphabet_element decidedAPs);
+    std::size_t getSuccessorFromDecisionDiagram(std::size_t from, APSet::alphabet_element label) const;
+
     APSet apSet;
     std::size_t numberOfStates;
     std::size_t initialState;
-    std::size_t numberOfEdges;
     std::size_t edgesPerState;
     std::shared_ptr<AcceptanceCondition> acceptance;
+
+    // The edges leaving each state, given as a list of cubes.
+    std::vector<std::vector<Edge>> edges;
+
+    // The decision diagrams of all states, where the root of the diagram for each state is stored separately.
+    std::vector<DecisionNode> decisionNodes;
+    std::vector<std::size_t> decisionRoots;
+
+    // If the alphabet is small enough, the successors are additionally stored for every state and letter.
     std::vector<std::size_t> successors;
 };
 }  // namespace automata
@@ -31,12 +31,10 @@ class HOAConsumerDA : public HOAConsumerDAHeader {
     std::vector<storm::expressions::Variable> apVariables;
     std::unique_ptr<storm::solver::SmtSolver> solver;
 
-    storm::storage::BitVector seenEdges;
-
    public:
     typedef std::shared_ptr<HOAConsumerDA> ptr;
 
-    HOAConsumerDA() : seenEdges(0) {
+    HOAConsumerDA() {
         expressionManager.reset(new storm::expressions::ExpressionManager());
         storm::utility::solver::SmtSolverFactory factory;
         solver = factory.create(*expressionManager);
@@ -63,8 +61,6 @@ class HOAConsumerDA : public HOAConsumerDAHeader {
 
         helper = new cpphoafparser::ImplicitEdgeHelper(header.apSet.size());
 
-        seenEdges.resize(*header.numberOfStates * helper->getEdgesPerState());
-
         for (const std::string& ap : header.apSet.getAPs()) {
             apVariables.push_back(expressionManager->declareBooleanVariable(ap));
         }
@@ -115,7 +111,6 @@ class HOAConsumerDA : public HOAConsumerDAHeader {
         }
 
         da->setSuccessor(stateId, edgeIndex, conjSuccessors.at(0));
-        markEdgeAsSeen(stateId, edgeIndex);
     }
 
     /**
@@ -138,30 +133,41 @@ class HOAConsumerDA : public HOAConsumerDAHeader {
 
         std::size_t successor = conjSuccessors.at(0);
 
+        // The guard is translated to a list of cubes over the atomic propositions occurring in the label, so that the
+        // size of the automaton does not depend on the size of the full alphabet.
+        APSet::alphabet_element occurringAPs = header.apSet.elementAllFalse();
+        collectAPs(labelExpr, occurringAPs);
+        std::vector<storm::expressions::Variable> occurringVariables;
+        for (std::size_t i = 0; i < apVariables.size(); i++) {
+            if ((occurringAPs >> i) & 1) {
+                occurringVariables.push_back(apVariables[i]);
+            }
+        }
+
         solver->reset();
         solver->add(labelToStormExpression(labelExpr));
 
-        solver->allSat(apVariables, [this, stateId, successor](storm::expressions::SimpleValuation& valuation) {
-            // construct edge index from valuation
-            APSet::alphabet_element edgeIndex = header.apSet.elementAllFalse();
-            for (std::size_t i = 0; i < apVariables.size(); i++) {
-                if (valuation.getBooleanValue(apVariables[i])) {
-                    edgeIndex = header.apSet.elementAddAP(edgeIndex, i);
-                }
+        std::vector<DeterministicAutomaton::LabelCube> guard;
+        if (occurringVariables.empty()) {
+            if (solver->check() == storm::solver::SmtSolver::CheckResult::Sat) {
+                guard.push_back(DeterministicAutomaton::LabelCube{occurringAPs, header.apSet.elementAllFalse()});
             }
+        } else {
+            solver->allSat(occurringVariables, [this, &guard, &occurringAPs](storm::expressions::SimpleValuation& valuation) {
+                // construct cube from valuation
+                APSet::alphabet_element values = header.apSet.elementAllFalse();
+                for (std::size_t i = 0; i < apVariables.size(); i++) {
+                    if (((occurringAPs >> i) & 1) && valuation.getBooleanValue(apVariables[i])) {
+                        values = header.apSet.elementAddAP(values, i);
+                    }
+                }
+                guard.push_back(DeterministicAutomaton::LabelCube{occurringAPs, values});
 
-            // require: edge already exists -> same successor
-            STORM_LOG_THROW(!alreadyHaveEdge(stateId, edgeIndex) || da->getSuccessor(stateId, edgeIndex) == successor,
-                            storm::exceptions::InvalidOperationException,
-                            "HOA automaton: multiple definitions of successor for state " << stateId << " and edge " << edgeIndex);
-
-            // std::cout << stateId << " -(" << edgeIndex << ")-> " << successor << '\n';
-            da->setSuccessor(stateId, edgeIndex, successor);
-            markEdgeAsSeen(stateId, edgeIndex);
-
-            // continue with next valuation
-            return true;
-        });
+                // continue with next valuation
+                return true;
+            });
+        }
+        da->addEdge(stateId, guard, successor);
     }
 
     /**
@@ -176,8 +182,8 @@ class HOAConsumerDA : public HOAConsumerDAHeader {
      * Called by the parser to notify the consumer that the automata definition has ended [mandatory, once].
      */
     virtual void notifyEnd() {
-        // require that we have seen all edges, i.e., that the automaton is complete
-        STORM_LOG_THROW(seenEdges.full(), storm::exceptions::InvalidOperationException, "HOA automaton has mismatch in number of edges, not complete?");
+        // require that every letter has exactly one successor, i.e., that the automaton is complete and deterministic
+        da->finalizeEdges();
     }
 
     /**
@@ -220,12 +226,27 @@ class HOAConsumerDA : public HOAConsumerDAHeader {
         throw std::runtime_error("Unknown label expression operator");
     }
 
-    bool alreadyHaveEdge(std::size_t stateId, std::size_t edgeIndex) {
-        return seenEdges.get(stateId * helper->getEdgesPerState() + edgeIndex);
-    }
-
-    void markEdgeAsSeen(std::size_t stateId, std::size_t edgeIndex) {
-        seenEdges.set(stateId * helper->getEdgesPerState() + edgeIndex);
+    void collectAPs(label_expr::ptr labelExpr, APSet::alphabet_element& aps) {
+        switch (labelExpr->getType()) {
+            case label_expr::EXP_AND:
+            case label_expr::EXP_OR:
+                collectAPs(labelExpr->getLeft(), aps);
+                collectAPs(labelExpr->getRight(), aps);
+                break;
+            case label_expr::EXP_NOT:
+                collectAPs(labelExpr->getLeft(), aps);
+                break;
+            case label_expr::EXP_TRUE:
+            case label_expr::EXP_FALSE:
+                break;
+            case label_expr::EXP_ATOM: {
+                unsigned int apIndex = labelExpr->getAtom().getAPIndex();
+                STORM_LOG_THROW(apIndex < apVariables.size(), storm::exceptions::OutOfRangeException,
+                                "HOA automaton refers to non-existing atomic proposition");
+                aps = header.apSet.elementAddAP(aps, apIndex);
+                break;
+            }
+        }
     }
 };
 
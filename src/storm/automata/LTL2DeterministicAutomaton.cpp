@@ -7,14 +7,93 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/logic/Formula.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include <sys/wait.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <unordered_map>
 
 namespace storm {
 namespace automata {
 
-std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daSpot(storm::logic::Formula const& f, bool dnf) {
+namespace detail {
+
+// The automata that have been constructed so far, indexed by their cache key.
+std::mutex cacheMutex;
+std::unordered_map<std::string, std::shared_ptr<DeterministicAutomaton>> cache;
+
+// Spot (in particular its BDD library) is not thread-safe, so all translations with Spot are serialized.
+std::mutex spotMutex;
+
+std::string getCacheKey(storm::logic::Formula const& f, std::string const& ltl2daTool, bool dnf) {
+    if (ltl2daTool.empty()) {
+        return std::string(dnf ? "spot-dnf " : "spot ") + f.toPrefixString();
+    }
+    return "tool " + ltl2daTool + " " + f.toPrefixString();
+}
+
+std::string getUniqueSuffix() {
+    static std::atomic<uint64_t> counter(0);
+    return "." + std::to_string(getpid()) + "." + std::to_string(counter++);
+}
+
+bool readFile(std::string const& filename, std::string& content) {
+    std::ifstream stream(filename);
+    if (!stream) {
+        return false;
+    }
+    std::stringstream contentStream;
+    contentStream << stream.rdbuf();
+    content = contentStream.str();
+    return true;
+}
+
+bool writeFileAtomically(std::string const& filename, std::string const& content) {
+    // Write to a temporary file first such that concurrent readers never see a partially written file
+    std::string temporaryFilename = filename + getUniqueSuffix();
+    std::ofstream stream(temporaryFilename);
+    stream << content;
+    stream.close();
+    if (!stream || std::rename(temporaryFilename.c_str(), filename.c_str()) != 0) {
+        std::remove(temporaryFilename.c_str());
+        return false;
+    }
+    return true;
+}
+
+/*!
+ * The cached automaton for the given key is stored in the file <hash>.hoa within the cache directory. Since different keys may have the same hash, the
+ * key itself is stored in <hash>.key and compared upon loading.
+ */
+std::string getCacheFilePrefix(std::string const& cacheDirectory, std::string const& key) {
+    std::stringstream stream;
+    stream << cacheDirectory << "/" << std::hex << std::hash<std::string>()(key);
+    return stream.str();
+}
+
+bool loadFromCacheDirectory(std::string const& cacheDirectory, std::string const& key, std::string& hoa) {
+    std::string filePrefix = getCacheFilePrefix(cacheDirectory, key);
+    std::string storedKey;
+    return readFile(filePrefix + ".key", storedKey) && storedKey == key && readFile(filePrefix + ".hoa", hoa);
+}
+
+void storeInCacheDirectory(std::string const& cacheDirectory, std::string const& key, std::string const& hoa) {
+    std::string filePrefix = getCacheFilePrefix(cacheDirectory, key);
+    bool success = writeFileAtomically(filePrefix + ".hoa", hoa) && writeFileAtomically(filePrefix + ".key", key);
+    STORM_LOG_WARN_COND(success, "Could not store the deterministic automaton in the cache directory " << cacheDirectory << ".");
+}
+
+std::string ltl2hoaSpot(storm::logic::Formula const& f, bool dnf) {
 #ifdef STORM_HAVE_SPOT
+    std::lock_guard<std::mutex> lock(spotMutex);
     std::string prefixLtl = f.toPrefixString();
 
     spot::parsed_formula spotPrefixLtl = spot::parse_prefix_ltl(prefixLtl);
@@ -46,9 +125,7 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daSpot(s
     // Print reachable states in HOA format, implicit edges (i), state-based acceptance (s)
     spot::print_hoa(autStream, aut, "is");
 
-    storm::automata::DeterministicAutomaton::ptr da = DeterministicAutomaton::parse(autStream);
-
-    return da;
+    return autStream.str();
 
 #else
     (void)f;
@@ -57,10 +134,16 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daSpot(s
 #endif
 }
 
-std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExternalTool(storm::logic::Formula const& f, std::string ltl2daTool) {
+std::string ltl2hoaExternalTool(storm::logic::Formula const& f, std::string const& ltl2daTool) {
     std::string prefixLtl = f.toPrefixString();
 
-    STORM_LOG_INFO("Calling external LTL->DA tool:   " << ltl2daTool << " '" << prefixLtl << "' da.hoa");
+    // Each call writes to its own file such that several translations may run concurrently
+    std::string outputFilename = std::string(P_tmpdir) + "/storm-da-XXXXXX";
+    int outputFileDescriptor = mkstemp(&outputFilename[0]);
+    STORM_LOG_THROW(outputFileDescriptor >= 0, storm::exceptions::FileIoException, "Could not create a temporary file for the deterministic automaton.");
+    close(outputFileDescriptor);
+
+    STORM_LOG_INFO("Calling external LTL->DA tool:   " << ltl2daTool << " '" << prefixLtl << "' " << outputFilename);
 
     pid_t pid;
 
@@ -69,32 +152,109 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExtern
 
     if (pid == 0) {
         // we are in the child process
-        if (execlp(ltl2daTool.c_str(), ltl2daTool.c_str(), prefixLtl.c_str(), "da.hoa", NULL) < 0) {
+        if (execlp(ltl2daTool.c_str(), ltl2daTool.c_str(), prefixLtl.c_str(), outputFilename.c_str(), NULL) < 0) {
             std::cerr << "ERROR: exec failed: " << strerror(errno) << '\n';
             std::exit(1);
         }
         // never reached
-        return std::shared_ptr<DeterministicAutomaton>();
+        return std::string();
     } else {  // in the parent
         int status;
 
-        // wait for completion
-        while (wait(&status) != pid)
+        // wait for completion of this particular child (other threads might wait for their own children)
+        while (waitpid(pid, &status, 0) != pid)
             ;
 
         int rv;
         if (WIFEXITED(status)) {
             rv = WEXITSTATUS(status);
         } else {
+            std::remove(outputFilename.c_str());
             STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Could not construct deterministic automaton: process aborted");
         }
-        STORM_LOG_THROW(rv == 0, storm::exceptions::FileIoException,
+        std::string hoa;
+        bool success = rv == 0 && readFile(outputFilename, hoa);
+        std::remove(outputFilename.c_str());
+        STORM_LOG_THROW(success, storm::exceptions::FileIoException,
                         "Could not construct deterministic automaton for " << prefixLtl << ", return code = " << rv);
+        STORM_LOG_INFO("Read automaton for " << prefixLtl << " from " << outputFilename);
+        return hoa;
+    }
+}
+
+std::shared_ptr<DeterministicAutomaton> parseHoa(std::string const& hoa) {
+    std::stringstream stream(hoa);
+    return DeterministicAutomaton::parse(stream);
+}
+
+}  // namespace detail
+
+std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daSpot(storm::logic::Formula const& f, bool dnf) {
+    return detail::parseHoa(detail::ltl2hoaSpot(f, dnf));
+}
 
-        STORM_LOG_INFO("Reading automaton for " << prefixLtl << " from da.hoa");
+std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExternalTool(storm::logic::Formula const& f, std::string ltl2daTool) {
+    return detail::parseHoa(detail::ltl2hoaExternalTool(f, ltl2daTool));
+}
 
-        return DeterministicAutomaton::parseFromFile("da.hoa");
+std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2da(storm::logic::Formula const& f, std::string const& ltl2daTool, bool dnf,
+                                                                          std::string const& cacheDirectory) {
+    std::string key = detail::getCacheKey(f, ltl2daTool, dnf);
+    {
+        std::lock_guard<std::mutex> lock(detail::cacheMutex);
+        auto cacheIt = detail::cache.find(key);
+        if (cacheIt != detail::cache.end()) {
+            STORM_LOG_INFO("Reusing the cached deterministic automaton for " << f.toPrefixString() << ".");
+            return cacheIt->second;
+        }
     }
+
+    // The translation is done without holding the lock such that different formulas can be translated concurrently
+    std::string hoa;
+    if (cacheDirectory.empty() || !detail::loadFromCacheDirectory(cacheDirectory, key, hoa)) {
+        hoa = ltl2daTool.empty() ? detail::ltl2hoaSpot(f, dnf) : detail::ltl2hoaExternalTool(f, ltl2daTool);
+        if (!cacheDirectory.empty()) {
+            detail::storeInCacheDirectory(cacheDirectory, key, hoa);
+        }
+    } else {
+        STORM_LOG_INFO("Loaded the deterministic automaton for " << f.toPrefixString() << " from the cache directory " << cacheDirectory << ".");
+    }
+    std::shared_ptr<DeterministicAutomaton> da = detail::parseHoa(hoa);
+
+    std::lock_guard<std::mutex> lock(detail::cacheMutex);
+    // If another thread translated the same formula in the meantime, its automaton is kept
+    return detail::cache.emplace(key, da).first->second;
+}
+
+void LTL2DeterministicAutomaton::ltl2daBatch(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, std::string const& ltl2daTool,
+                                             bool dnf, std::string const& cacheDirectory, uint64_t numberOfThreads) {
+    // Only translate each formula once
+    std::vector<storm::logic::Formula const*> uniqueFormulas;
+    std::set<std::string> keys;
+    for (auto const& formula : formulas) {
+        if (keys.insert(detail::getCacheKey(*formula, ltl2daTool, dnf)).second) {
+            uniqueFormulas.push_back(formula.get());
+        }
+    }
+    STORM_LOG_INFO("Translating " << uniqueFormulas.size() << " distinct LTL formula(s) to deterministic automata.");
+
+    auto translate = [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t index = begin; index < end; ++index) {
+            try {
+                ltl2da(*uniqueFormulas[index], ltl2daTool, dnf, cacheDirectory);
+            } catch (std::exception const& e) {
+                STORM_LOG_WARN("Could not translate " << uniqueFormulas[index]->toPrefixString() << " up front: " << e.what());
+            }
+        }
+    };
+    // Translations with Spot are serialized anyway, so there is no point in using several threads
+    uint64_t const threads = ltl2daTool.empty() ? 1 : numberOfThreads;
+    storm::utility::parallel::forEachBlock(threads, static_cast<uint64_t>(0), static_cast<uint64_t>(uniqueFormulas.size()), 1, translate);
+}
+
+void LTL2DeterministicAutomaton::clearCache() {
+    std::lock_guard<std::mutex> lock(detail::cacheMutex);
+    detail::cache.clear();
 }
 
 }  // namespace automata
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace storm {
 
@@ -35,6 +38,40 @@ class LTL2DeterministicAutomaton {
      * @return An automaton equivalent to the formula.
      */
     static std::shared_ptr<DeterministicAutomaton> ltl2daExternalTool(storm::logic::Formula const& f, std::string ltl2daTool);
+
+    /*!
+     * Converts an LTL formula into a deterministic omega-automaton using the given external LTL2DA tool or, if no tool is given, using Spot.
+     * The resulting automata are cached in memory and, if a cache directory is given, as HOA files in this directory.
+     * The cache is keyed by the prefix representation of the formula and the translation options. Since the state subformulas of LTL formulas are
+     * replaced by atomic propositions p0, p1, ... prior to the translation, formulas of the same shape share their automaton.
+     *
+     * @param f The LTL formula.
+     * @param ltl2daTool The external tool. If empty, Spot is used.
+     * @param dnf A Flag indicating whether the acceptance condition is transformed into DNF (only relevant for Spot).
+     * @param cacheDirectory The directory for cached automata. If empty, automata are only cached in memory.
+     * @return An automaton equivalent to the formula.
+     */
+    static std::shared_ptr<DeterministicAutomaton> ltl2da(storm::logic::Formula const& f, std::string const& ltl2daTool, bool dnf,
+                                                          std::string const& cacheDirectory = "");
+
+    /*!
+     * Converts the given LTL formulas up front such that subsequent calls of ltl2da with the same options are answered from the cache.
+     * Translations with an external tool are performed concurrently. Spot is not thread-safe, so translations with Spot are performed one after another.
+     * Formulas that can not be translated are skipped; the error is reported once the automaton is actually requested.
+     *
+     * @param formulas The LTL formulas.
+     * @param ltl2daTool The external tool. If empty, Spot is used.
+     * @param dnf A Flag indicating whether the acceptance condition is transformed into DNF (only relevant for Spot).
+     * @param cacheDirectory The directory for cached automata. If empty, automata are only cached in memory.
+     * @param numberOfThreads The number of threads that call the external tool.
+     */
+    static void ltl2daBatch(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, std::string const& ltl2daTool, bool dnf,
+                            std::string const& cacheDirectory, uint64_t numberOfThreads);
+
+    /*!
+     * Removes all automata from the in-memory cache.
+     */
+    static void clearCache();
 };
 
 }  // namespace automata
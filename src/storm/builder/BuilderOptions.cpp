@@ -51,6 +51,8 @@ BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels)
       inferObservationsFromActions(false),
       addOverlappingGuardsLabel(false),
       addOutOfBoundsState(false),
+      applySymmetryReduction(false),
+      applyPartialOrderReduction(false),
       reservedBitsForUnboundedVariables(32),
       showProgress(false),
       showProgressDelay(0) {
@@ -190,6 +192,14 @@ bool BuilderOptions::isAddOverlappingGuardLabelSet() const {
     return addOverlappingGuardsLabel;
 }
 
+bool BuilderOptions::isApplySymmetryReductionSet() const {
+    return applySymmetryReduction;
+}
+
+bool BuilderOptions::isApplyPartialOrderReductionSet() const {
+    return applyPartialOrderReduction;
+}
+
 BuilderOptions& BuilderOptions::setBuildAllRewardModels(bool newValue) {
     buildAllRewardModels = newValue;
     return *this;
@@ -291,6 +301,16 @@ BuilderOptions& BuilderOptions::setAddOverlappingGuardsLabel(bool newValue) {
     return *this;
 }
 
+BuilderOptions& BuilderOptions::setApplySymmetryReduction(bool newValue) {
+    applySymmetryReduction = newValue;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setApplyPartialOrderReduction(bool newValue) {
+    applyPartialOrderReduction = newValue;
+    return *this;
+}
+
 BuilderOptions& BuilderOptions::substituteExpressions(
     std::function<storm::expressions::Expression(storm::expressions::Expression const&)> const& substitutionFunction) {
     for (auto& e : expressionLabels) {
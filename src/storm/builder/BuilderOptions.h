@@ -120,6 +120,8 @@ class BuilderOptions {
     bool isAddOutOfBoundsStateSet() const;
     uint64_t getReservedBitsForUnboundedVariables() const;
     bool isAddOverlappingGuardLabelSet() const;
+    bool isApplySymmetryReductionSet() const;
+    bool isApplyPartialOrderReductionSet() const;
     uint64_t getShowProgressDelay() const;
 
     /**
@@ -206,6 +208,18 @@ class BuilderOptions {
      */
     BuilderOptions& setAddOverlappingGuardsLabel(bool newValue = true);
 
+    /**
+     * Should the states of replicated (renamed) modules be explored only up to permutations of the replicas
+     * @param newValue the new value (default true)
+     */
+    BuilderOptions& setApplySymmetryReduction(bool newValue = true);
+
+    /**
+     * Should only a single independent and invisible command be expanded in states where this is safe (ample sets for MDPs)
+     * @param newValue the new value (default true)
+     */
+    BuilderOptions& setApplyPartialOrderReduction(bool newValue = true);
+
     /**
      * Sets the number of bits that will be reserved for unbounded integer variables.
      */
@@ -268,6 +282,12 @@ class BuilderOptions {
     /// A flag indicating that the an additional state for out of bounds should be created.
     bool addOutOfBoundsState;
 
+    /// A flag indicating whether states that only differ by a permutation of replicated modules are to be merged.
+    bool applySymmetryReduction;
+
+    /// A flag indicating whether partial order reduction is to be applied when exploring MDPs.
+    bool applyPartialOrderReduction;
+
     /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
     uint64_t reservedBitsForUnboundedVariables;
 
@@ -0,0 +1,190 @@
+#include "storm/builder/ConstantSweepModelBuilder.h"
+
+#include <set>
+#include <unordered_map>
+
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/expressions/ToRationalNumberVisitor.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+namespace {
+
+/*!
+ * Retrieves whether the given expressions of the builder options refer to the given variables.
+ */
+bool optionsContainVariables(BuilderOptions const& options, std::set<storm::expressions::Variable> const& variables) {
+    for (auto const& expressionLabel : options.getExpressionLabels()) {
+        if (expressionLabel.second.containsVariable(variables)) {
+            return true;
+        }
+    }
+    for (auto const& terminalState : options.getTerminalStates()) {
+        if (terminalState.first.isExpression() && terminalState.first.getExpression().containsVariable(variables)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+template<typename ValueType>
+ConstantSweepModelBuilder<ValueType>::ConstantSweepModelBuilder(storm::prism::Program const& program, BuilderOptions const& options)
+    : program(program.substituteFormulas()), options(options), reuseStateSpace(false) {
+    if (!this->program.hasUndefinedConstants()) {
+        return;
+    }
+    std::set<storm::expressions::Variable> undefinedConstants;
+    bool allConstantsRational = true;
+    for (auto const& constant : this->program.getUndefinedConstants()) {
+        undefinedConstants.insert(constant.get().getExpressionVariable());
+        allConstantsRational &= constant.get().getType().isRationalType();
+    }
+    auto modelType = this->program.getModelType();
+    bool supportedModelType = modelType == storm::prism::Program::ModelType::DTMC || modelType == storm::prism::Program::ModelType::CTMC ||
+                              modelType == storm::prism::Program::ModelType::MDP;
+    reuseStateSpace = supportedModelType && allConstantsRational && this->program.undefinedConstantsAreGraphPreserving() &&
+                      !optionsContainVariables(options, undefinedConstants);
+    STORM_LOG_INFO_COND(reuseStateSpace, "The undefined constants affect the state space, so each model of the sweep is built from scratch.");
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> ConstantSweepModelBuilder<ValueType>::build(
+    std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) {
+    if (reuseStateSpace) {
+        if (!parametricModel) {
+            STORM_LOG_INFO("Building the parametric model that is instantiated for each model of the sweep.");
+            parametricModel = ExplicitModelBuilder<storm::RationalFunction>(program, options).build();
+        }
+        auto result = instantiate(constantDefinitions);
+        if (result) {
+            return result;
+        }
+        STORM_LOG_INFO("Some transitions get probability zero under the given constant definitions, so the model is built from scratch.");
+    }
+    return ExplicitModelBuilder<ValueType>(program.defineUndefinedConstants(constantDefinitions).substituteConstantsFormulas(), options).build();
+}
+
+template<typename ValueType>
+bool ConstantSweepModelBuilder<ValueType>::isReusingStateSpace() const {
+    return reuseStateSpace;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> ConstantSweepModelBuilder<ValueType>::instantiate(
+    std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) {
+    // The parameters of the parametric model are named after the undefined constants.
+    std::map<std::string, storm::RationalFunctionCoefficient> valuesByName;
+    storm::expressions::ToRationalNumberVisitor<storm::RationalNumber> toRationalNumber;
+    for (auto const& definition : constantDefinitions) {
+        valuesByName.emplace(definition.first.getName(),
+                             storm::utility::convertNumber<storm::RationalFunctionCoefficient>(toRationalNumber.toRationalNumber(definition.second)));
+    }
+    std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+    auto addToValuation = [&](storm::RationalFunction const& function) {
+        std::set<storm::RationalFunctionVariable> parameters;
+        function.gatherVariables(parameters);
+        for (auto const& parameter : parameters) {
+            if (valuation.count(parameter) == 0) {
+                auto valueIt = valuesByName.find(parameter.name());
+                STORM_LOG_THROW(valueIt != valuesByName.end(), storm::exceptions::InvalidArgumentException,
+                                "No definition for the undefined constant '" << parameter.name() << "'.");
+                valuation.emplace(parameter, valueIt->second);
+            }
+        }
+    };
+
+    // Functions occur many times in the model, so each of them is evaluated only once.
+    std::unordered_map<storm::RationalFunction, ValueType> values;
+    auto evaluate = [&](storm::RationalFunction const& function) {
+        auto valueIt = values.find(function);
+        if (valueIt == values.end()) {
+            addToValuation(function);
+            valueIt = values.emplace(function, storm::utility::convertNumber<ValueType>(function.evaluate(valuation))).first;
+        }
+        return valueIt->second;
+    };
+
+    auto const& parametricMatrix = parametricModel->getTransitionMatrix();
+    std::vector<storm::storage::SparseMatrixIndexType> rowIndications;
+    rowIndications.reserve(parametricMatrix.getRowCount() + 1);
+    std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>> entries;
+    entries.reserve(parametricMatrix.getEntryCount());
+    for (uint_fast64_t row = 0; row < parametricMatrix.getRowCount(); ++row) {
+        rowIndications.push_back(entries.size());
+        for (auto const& entry : parametricMatrix.getRow(row)) {
+            ValueType value = evaluate(entry.getValue());
+            if (storm::utility::isZero(value)) {
+                // A model built from scratch would not contain this transition (and possibly fewer states).
+                return nullptr;
+            }
+            entries.emplace_back(entry.getColumn(), value);
+        }
+    }
+    rowIndications.push_back(entries.size());
+    boost::optional<std::vector<storm::storage::SparseMatrixIndexType>> rowGroupIndices;
+    if (!parametricMatrix.hasTrivialRowGrouping()) {
+        rowGroupIndices = parametricMatrix.getRowGroupIndices();
+    }
+    storm::storage::sparse::ModelComponents<ValueType> components(
+        storm::storage::SparseMatrix<ValueType>(parametricMatrix.getColumnCount(), std::move(rowIndications), std::move(entries), std::move(rowGroupIndices)),
+        storm::models::sparse::StateLabeling(parametricModel->getStateLabeling()));
+    components.rateTransitions = parametricModel->isOfType(storm::models::ModelType::Ctmc);
+
+    auto evaluateVector = [&](std::vector<storm::RationalFunction> const& vector) {
+        std::vector<ValueType> result;
+        result.reserve(vector.size());
+        for (auto const& function : vector) {
+            result.push_back(evaluate(function));
+        }
+        return result;
+    };
+    for (auto const& [name, rewardModel] : parametricModel->getRewardModels()) {
+        std::optional<std::vector<ValueType>> stateRewards, stateActionRewards;
+        std::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
+        if (rewardModel.hasStateRewards()) {
+            stateRewards = evaluateVector(rewardModel.getStateRewardVector());
+        }
+        if (rewardModel.hasStateActionRewards()) {
+            stateActionRewards = evaluateVector(rewardModel.getStateActionRewardVector());
+        }
+        if (rewardModel.hasTransitionRewards()) {
+            auto const& parametricRewards = rewardModel.getTransitionRewardMatrix();
+            storm::storage::SparseMatrixBuilder<ValueType> rewardBuilder(parametricRewards.getRowCount(), parametricRewards.getColumnCount(),
+                                                                         parametricRewards.getEntryCount());
+            for (uint_fast64_t row = 0; row < parametricRewards.getRowCount(); ++row) {
+                for (auto const& entry : parametricRewards.getRow(row)) {
+                    rewardBuilder.addNextValue(row, entry.getColumn(), evaluate(entry.getValue()));
+                }
+            }
+            transitionRewards = rewardBuilder.build();
+        }
+        components.rewardModels.emplace(
+            name, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewards), std::move(stateActionRewards), std::move(transitionRewards)));
+    }
+
+    if (parametricModel->hasChoiceLabeling()) {
+        components.choiceLabeling = parametricModel->getChoiceLabeling();
+    }
+    if (parametricModel->hasStateValuations()) {
+        components.stateValuations = parametricModel->getStateValuations();
+    }
+    if (parametricModel->hasChoiceOrigins()) {
+        components.choiceOrigins = parametricModel->getChoiceOrigins();
+    }
+    return storm::utility::builder::buildModelFromComponents(parametricModel->getType(), std::move(components));
+}
+
+template class ConstantSweepModelBuilder<double>;
+template class ConstantSweepModelBuilder<storm::RationalNumber>;
+
+}  // namespace builder
+}  // namespace storm
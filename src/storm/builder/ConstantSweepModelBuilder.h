@@ -0,0 +1,68 @@
+#pragma once
+
+#include <map>
+#include <memory>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * Builds the explicit models of a PRISM program for a sequence of definitions of its undefined constants, e.g., when sweeping a constant over a range of
+ * values. If the undefined constants only occur in the probabilities (or rates) of the updates and in the reward values, they do not affect the state space
+ * and the structure of the transitions. In this case, a single parametric model is built on the first call and each model is obtained by instantiating it,
+ * which avoids repeating the state-space exploration. Otherwise (and whenever an instantiation would introduce transitions with probability zero), each
+ * model is built from scratch.
+ */
+template<typename ValueType>
+class ConstantSweepModelBuilder {
+   public:
+    /*!
+     * Creates a builder for the given program.
+     *
+     * @param program The program whose undefined constants are defined for each build.
+     * @param options The options used to build the models.
+     */
+    ConstantSweepModelBuilder(storm::prism::Program const& program, BuilderOptions const& options);
+
+    /*!
+     * Builds the model in which the undefined constants of the program are defined as given.
+     *
+     * @param constantDefinitions The definitions of (at least) all undefined constants of the program.
+     * @return The built model.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> build(
+        std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions);
+
+    /*!
+     * Retrieves whether the models are obtained by instantiating a parametric model rather than by exploring the state space for each definition.
+     */
+    bool isReusingStateSpace() const;
+
+   private:
+    /*!
+     * Instantiates the parametric model with the given definitions.
+     *
+     * @return The instantiated model or nullptr if some transition gets probability zero under the definitions.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> instantiate(
+        std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions);
+
+    // The program (with substituted formulas) and the options used to build the models.
+    storm::prism::Program program;
+    BuilderOptions options;
+
+    // A flag indicating whether the state space is reused across the builds.
+    bool reuseStateSpace;
+
+    // The parametric model in which the undefined constants are parameters. It is built lazily by the first call to build.
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> parametricModel;
+};
+
+}  // namespace builder
+}  // namespace storm
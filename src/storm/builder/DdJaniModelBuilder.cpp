@@ -41,6 +41,7 @@
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/WrongFormatException.h"
+#include "storm/utility/Stopwatch.h"
 #include "storm/utility/dd.h"
 #include "storm/utility/jani.h"
 #include "storm/utility/macros.h"
@@ -2339,6 +2340,15 @@ template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(storm::jani::Model const& model,
                                                                                typename DdJaniModelBuilder<Type, ValueType>::Options const& options,
                                                                                std::shared_ptr<storm::dd::DdManager<Type>> const& manager) {
+    // Keep track of the time spent in the individual phases.
+    std::vector<std::string> phaseTimes;
+    storm::utility::Stopwatch phaseWatch(true);
+    auto finishPhase = [&phaseTimes, &phaseWatch](std::string const& phaseName) {
+        phaseWatch.stop();
+        phaseTimes.push_back(phaseName + ": " + std::to_string(phaseWatch.getTimeInMilliseconds()) + "ms");
+        phaseWatch.restart();
+    };
+
     // Determine the actions that will appear in the parallel composition.
     storm::jani::CompositionInformationVisitor visitor(model, model.getSystemComposition());
     storm::jani::CompositionInformation actionInformation = visitor.getInformation();
@@ -2346,6 +2356,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
     // Create all necessary variables.
     CompositionVariableCreator<Type, ValueType> variableCreator(model, actionInformation);
     CompositionVariables<Type, ValueType> variables = variableCreator.create(manager);
+    finishPhase("variables");
 
     // Determine which transient assignments need to be considered in the building process.
     std::vector<storm::expressions::Variable> rewardVariables = selectRewardVariables<Type, ValueType>(model, options);
@@ -2354,6 +2365,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
     bool applyMaximumProgress = options.applyMaximumProgressAssumption && model.getModelType() == storm::jani::ModelType::MA;
     CombinedEdgesSystemComposer<Type, ValueType> composer(model, actionInformation, variables, rewardVariables, applyMaximumProgress);
     ComposerResult<Type, ValueType> system = composer.compose();
+    finishPhase("composition");
 
     // Postprocess the variables in place.
     postprocessVariables(model.getModelType(), system, variables);
@@ -2363,6 +2375,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
 
     // Postprocess the system in place and get the states that were terminal (i.e. whose transitions were cut off).
     storm::dd::Bdd<Type> terminalStates = postprocessSystem(model, system, variables, options, labelsToExpressionMap);
+    finishPhase("postprocessing");
 
     // Start creating the model components.
     ModelComponents<Type, ValueType> modelComponents;
@@ -2379,9 +2392,29 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
         model.getModelType() == storm::jani::ModelType::MA) {
         transitionMatrixBdd = transitionMatrixBdd.existsAbstract(variables.allNondeterminismVariables);
     }
-    modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables,
-                                                                                 variables.columnMetaVariables)
-                                          .first;
+    storm::builder::DdReachabilityStrategy reachabilityStrategy =
+        storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdReachabilityStrategy();
+    if (reachabilityStrategy == storm::builder::DdReachabilityStrategy::BreadthFirst) {
+        modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd,
+                                                                                     variables.rowMetaVariables, variables.columnMetaVariables)
+                                              .first;
+    } else {
+        // The composed system does not keep the relations of the individual actions, so the transition relation is only partitioned by automata.
+        std::vector<std::set<storm::expressions::Variable>> automatonRowMetaVariables;
+        for (auto const& automatonIdentity : variables.automatonToIdentityMap) {
+            std::set<storm::expressions::Variable> const& containedMetaVariables = automatonIdentity.second.getContainedMetaVariables();
+            automatonRowMetaVariables.emplace_back();
+            std::set_intersection(containedMetaVariables.begin(), containedMetaVariables.end(), variables.rowMetaVariables.begin(),
+                                  variables.rowMetaVariables.end(), std::inserter(automatonRowMetaVariables.back(), automatonRowMetaVariables.back().end()));
+        }
+        modelComponents.reachableStates =
+            storm::utility::dd::computeReachableStates(
+                modelComponents.initialStates,
+                storm::utility::dd::partitionTransitionRelation<Type>({transitionMatrixBdd}, automatonRowMetaVariables, variables.rowColumnMetaVariablePairs),
+                reachabilityStrategy)
+                .first;
+    }
+    finishPhase("reachability");
 
     // Check that the reachable fragment does not overlap with the illegal fragment.
     storm::dd::Bdd<Type> reachableIllegalFragment = modelComponents.reachableStates && system.illegalFragment;
@@ -2391,6 +2424,9 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
     // Cut transitions to reachable states.
     storm::dd::Add<Type, ValueType> reachableStatesAdd = modelComponents.reachableStates.template toAdd<ValueType>();
     modelComponents.transitionMatrix = system.transitions * reachableStatesAdd;
+    if (storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdReorderingSet()) {
+        storm::utility::dd::reorderVariables(*variables.manager, modelComponents.transitionMatrix.notZero());
+    }
 
     // Fix deadlocks if existing.
     modelComponents.deadlockStates =
@@ -2398,13 +2434,18 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
 
     // Cut the deadlock states by removing all states that we 'converted' to deadlock states by making them terminal.
     modelComponents.deadlockStates = modelComponents.deadlockStates && !terminalStates;
+    finishPhase("restriction to reachable states");
 
     // Build the reward models.
     modelComponents.rewardModels =
         buildRewardModels(reachableStatesAdd, modelComponents.transitionMatrix, model.getModelType(), variables, system, rewardVariables);
+    finishPhase("reward models");
 
     // Finally, create the model.
-    return createModel(model.getModelType(), variables, modelComponents);
+    auto result = createModel(model.getModelType(), variables, modelComponents);
+    finishPhase("model creation");
+    STORM_LOG_INFO("Time spent in the phases of the symbolic JANI model builder: " << boost::join(phaseTimes, ", ") << ".");
+    return result;
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -28,6 +28,8 @@
 
 #include "storm/settings/modules/BuildSettings.h"
 
+#include "storm/builder/DdVariableOrder.h"
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 namespace storm {
@@ -190,95 +192,74 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
             allNondeterminismVariables.insert(variablePair.first);
         }
 
-        // Create meta variables for global program variables.
+        // Collect the global and module variables of the program.
+        std::map<storm::expressions::Variable, storm::prism::IntegerVariable const*> integerVariables;
+        std::map<storm::expressions::Variable, storm::prism::BooleanVariable const*> booleanVariables;
         for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-            int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-            int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-
-            STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                   << "] and " << variablePair.second.getName() << "["
-                                                                                   << variablePair.second.getIndex() << "]");
-
-            rowMetaVariables.insert(variablePair.first);
-            variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-
-            columnMetaVariables.insert(variablePair.second);
-            variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-
-            storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-            variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-            rowColumnMetaVariablePairs.push_back(variablePair);
-
+            integerVariables.emplace(integerVariable.getExpressionVariable(), &integerVariable);
             allGlobalVariables.insert(integerVariable.getExpressionVariable());
         }
         for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+            booleanVariables.emplace(booleanVariable.getExpressionVariable(), &booleanVariable);
+            allGlobalVariables.insert(booleanVariable.getExpressionVariable());
+        }
+        for (storm::prism::Module const& module : program.getModules()) {
+            for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                integerVariables.emplace(integerVariable.getExpressionVariable(), &integerVariable);
+            }
+            for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
+                booleanVariables.emplace(booleanVariable.getExpressionVariable(), &booleanVariable);
+            }
+        }
 
-            STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                   << "] and " << variablePair.second.getName() << "["
-                                                                                   << variablePair.second.getIndex() << "]");
+        // Create meta variables for the program variables. The order in which they are created determines the DD variable order.
+        std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> variableToIdentityBddMap;
+        storm::builder::DdVariableOrder variableOrder = storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrder();
+        for (storm::expressions::Variable const& variable : computeVariableOrder(program, variableOrder)) {
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair;
+            auto integerVariableIt = integerVariables.find(variable);
+            bool isIntegerVariable = integerVariableIt != integerVariables.end();
+            if (isIntegerVariable) {
+                int_fast64_t low = integerVariableIt->second->getLowerBoundExpression().evaluateAsInt();
+                int_fast64_t high = integerVariableIt->second->getUpperBoundExpression().evaluateAsInt();
+                variablePair = manager->addMetaVariable(integerVariableIt->second->getName(), low, high);
+            } else {
+                variablePair = manager->addMetaVariable(booleanVariables.at(variable)->getName());
+            }
+
+            STORM_LOG_TRACE("Created meta variables for " << (allGlobalVariables.count(variable) > 0 ? "global " : "")
+                                                          << (isIntegerVariable ? "integer" : "boolean") << " variable: " << variablePair.first.getName()
+                                                          << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "["
+                                                          << variablePair.second.getIndex() << "]");
 
             rowMetaVariables.insert(variablePair.first);
-            variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
+            variableToRowMetaVariableMap->emplace(variable, variablePair.first);
 
             columnMetaVariables.insert(variablePair.second);
-            variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
+            variableToColumnMetaVariableMap->emplace(variable, variablePair.second);
 
             storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-            variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
+            variableToIdentityMap.emplace(variable, variableIdentity.template toAdd<ValueType>());
+            variableToIdentityBddMap.emplace(variable, variableIdentity);
 
             rowColumnMetaVariablePairs.push_back(variablePair);
-            allGlobalVariables.insert(booleanVariable.getExpressionVariable());
         }
 
-        // Create meta variables for each of the modules' variables.
+        // Create the identities and ranges of the modules.
         for (storm::prism::Module const& module : program.getModules()) {
             storm::dd::Bdd<Type> moduleIdentity = manager->getBddOne();
             storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
-
+            std::vector<storm::expressions::Variable> moduleVariables;
             for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                    manager->addMetaVariable(integerVariable.getName(), low, high);
-                STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                << "] and " << variablePair.second.getName() << "["
-                                                                                << variablePair.second.getIndex() << "]");
-
-                rowMetaVariables.insert(variablePair.first);
-                variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-
-                columnMetaVariables.insert(variablePair.second);
-                variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-
-                storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                moduleIdentity &= variableIdentity;
-                moduleRange &= manager->getRange(variablePair.first);
-
-                rowColumnMetaVariablePairs.push_back(variablePair);
+                moduleVariables.push_back(integerVariable.getExpressionVariable());
             }
             for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                << "] and " << variablePair.second.getName() << "["
-                                                                                << variablePair.second.getIndex() << "]");
-
-                rowMetaVariables.insert(variablePair.first);
-                variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-
-                columnMetaVariables.insert(variablePair.second);
-                variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-
-                storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                moduleIdentity &= variableIdentity;
-                moduleRange &= manager->getRange(variablePair.first);
-
-                rowColumnMetaVariablePairs.push_back(variablePair);
+                moduleVariables.push_back(booleanVariable.getExpressionVariable());
+            }
+            for (auto const& variable : moduleVariables) {
+                moduleIdentity &= variableToIdentityBddMap.at(variable);
+                moduleRange &= manager->getRange(variableToRowMetaVariableMap->at(variable));
             }
-            moduleToIdentityMap[module.getName()] = moduleIdentity.template toAdd<ValueType>();
             moduleToRangeMap[module.getName()] = moduleRange.template toAdd<ValueType>();
         }
     }
@@ -1239,6 +1220,30 @@ storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::createSyst
     return result;
 }
 
+template<storm::dd::DdType Type, typename ValueType>
+std::vector<storm::dd::Bdd<Type>> DdPrismModelBuilder<Type, ValueType>::createActionTransitionRelations(GenerationInformation const& generationInfo,
+                                                                                                      ModuleDecisionDiagram const& module) {
+    std::vector<ActionDecisionDiagram const*> actions = {&module.independentAction};
+    for (auto const& synchronizingAction : module.synchronizingActionToDecisionDiagramMap) {
+        actions.push_back(&synchronizingAction.second);
+    }
+
+    std::vector<storm::dd::Bdd<Type>> result;
+    for (auto const& action : actions) {
+        storm::dd::Bdd<Type> relation = action->transitionsDd.notZero();
+        for (auto const& variable : generationInfo.allGlobalVariables) {
+            if (action->assignedGlobalVariables.count(variable) == 0) {
+                relation &= generationInfo.variableToIdentityMap.at(variable).toBdd();
+            }
+        }
+        if (generationInfo.program.getModelType() == storm::prism::Program::ModelType::MDP) {
+            relation = relation.existsAbstract(generationInfo.allNondeterminismVariables);
+        }
+        result.push_back(std::move(relation));
+    }
+    return result;
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 typename DdPrismModelBuilder<Type, ValueType>::SystemResult DdPrismModelBuilder<Type, ValueType>::createSystemDecisionDiagram(
     GenerationInformation& generationInfo) {
@@ -1457,14 +1462,40 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
         transitionMatrixBdd = transitionMatrixBdd.existsAbstract(generationInfo.allNondeterminismVariables);
     }
 
-    storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables,
-                                                                                            generationInfo.columnMetaVariables)
-                                               .first;
+    storm::dd::Bdd<Type> reachableStates;
+    storm::builder::DdReachabilityStrategy reachabilityStrategy =
+        storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdReachabilityStrategy();
+    if (reachabilityStrategy == storm::builder::DdReachabilityStrategy::BreadthFirst) {
+        reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables,
+                                                                           generationInfo.columnMetaVariables)
+                              .first;
+    } else {
+        // Partition the transition relation by actions and modules.
+        std::vector<storm::dd::Bdd<Type>> relations = createActionTransitionRelations(generationInfo, globalModule);
+        for (auto& relation : relations) {
+            relation &= !terminalStatesBdd;
+        }
+        std::vector<std::set<storm::expressions::Variable>> moduleRowMetaVariables;
+        for (auto const& moduleIdentity : generationInfo.moduleToIdentityMap) {
+            std::set<storm::expressions::Variable> const& containedMetaVariables = moduleIdentity.second.getContainedMetaVariables();
+            moduleRowMetaVariables.emplace_back();
+            std::set_intersection(containedMetaVariables.begin(), containedMetaVariables.end(), generationInfo.rowMetaVariables.begin(),
+                                  generationInfo.rowMetaVariables.end(), std::inserter(moduleRowMetaVariables.back(), moduleRowMetaVariables.back().end()));
+        }
+        reachableStates = storm::utility::dd::computeReachableStates<Type>(
+                              initialStates,
+                              storm::utility::dd::partitionTransitionRelation(relations, moduleRowMetaVariables, generationInfo.rowColumnMetaVariablePairs),
+                              reachabilityStrategy)
+                              .first;
+    }
     storm::dd::Add<Type, ValueType> reachableStatesAdd = reachableStates.template toAdd<ValueType>();
     transitionMatrix *= reachableStatesAdd;
     if (system.stateActionDd) {
         system.stateActionDd.get() *= reachableStatesAdd;
     }
+    if (storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdReorderingSet()) {
+        storm::utility::dd::reorderVariables(*generationInfo.manager, transitionMatrix.notZero());
+    }
 
     // Detect deadlocks and 1) fix them if requested 2) throw an error otherwise.
     storm::dd::Bdd<Type> statesWithTransition = transitionMatrixBdd.existsAbstract(generationInfo.columnMetaVariables);
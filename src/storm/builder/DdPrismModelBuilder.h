@@ -286,6 +286,13 @@ class DdPrismModelBuilder {
 
     static storm::dd::Add<Type, ValueType> createSystemFromModule(GenerationInformation& generationInfo, ModuleDecisionDiagram& module);
 
+    /*!
+     * Creates the transition relations (without nondeterminism variables) of the independent and the synchronizing actions of the given module, whose
+     * union is the transition relation of the system created from the module. As opposed to the action decision diagrams, the relations contain the
+     * identities of the global variables that the respective action does not assign.
+     */
+    static std::vector<storm::dd::Bdd<Type>> createActionTransitionRelations(GenerationInformation const& generationInfo, ModuleDecisionDiagram const& module);
+
     static std::unordered_map<std::string, storm::models::symbolic::StandardRewardModel<Type, ValueType>> createRewardModelDecisionDiagrams(
         std::vector<std::reference_wrapper<storm::prism::RewardModel const>> const& selectedRewardModels, SystemResult& system,
         GenerationInformation& generationInfo, ModuleDecisionDiagram const& globalModule, storm::dd::Add<Type, ValueType> const& reachableStatesAdd,
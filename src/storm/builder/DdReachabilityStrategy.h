@@ -0,0 +1,17 @@
+#pragma once
+
+#include <ostream>
+
+namespace storm {
+namespace builder {
+
+// An enum that contains all strategies with which the symbolic builders can compute the reachable states. Breadth-first search applies the monolithic
+// transition relation to the frontier. Chaining applies the parts of the partitioned transition relation one after the other within each iteration.
+// Saturation additionally exhausts every part before moving on and restarts from the part that is closest to the terminal nodes whenever new states are
+// found, such that the parts that change only few (low) DD variables are saturated first.
+enum class DdReachabilityStrategy { BreadthFirst, Chaining, Saturation };
+
+std::ostream& operator<<(std::ostream& out, DdReachabilityStrategy const& strategy);
+
+}  // namespace builder
+}  // namespace storm
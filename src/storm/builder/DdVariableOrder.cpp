@@ -0,0 +1,166 @@
+#include "storm/builder/DdVariableOrder.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <set>
+
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+std::ostream& operator<<(std::ostream& out, DdVariableOrder const& order) {
+    switch (order) {
+        case DdVariableOrder::Declaration:
+            out << "declaration";
+            break;
+        case DdVariableOrder::Force:
+            out << "force";
+            break;
+        default:
+            out << "undefined";
+            break;
+    }
+    return out;
+}
+
+uint64_t computeTotalSpan(std::vector<uint64_t> const& order, std::vector<std::vector<uint64_t>> const& hyperedges) {
+    std::vector<uint64_t> position(order.size());
+    for (uint64_t index = 0; index < order.size(); ++index) {
+        position[order[index]] = index;
+    }
+    uint64_t span = 0;
+    for (auto const& hyperedge : hyperedges) {
+        if (hyperedge.empty()) {
+            continue;
+        }
+        auto [minIt, maxIt] =
+            std::minmax_element(hyperedge.begin(), hyperedge.end(), [&position](uint64_t a, uint64_t b) { return position[a] < position[b]; });
+        span += position[*maxIt] - position[*minIt];
+    }
+    return span;
+}
+
+std::vector<uint64_t> computeForceOrder(uint64_t numberOfVertices, std::vector<std::vector<uint64_t>> const& hyperedges, uint64_t maximalNumberOfIterations) {
+    std::vector<uint64_t> order(numberOfVertices);
+    std::iota(order.begin(), order.end(), 0ull);
+
+    // Hyperedges with less than two vertices do not constrain the order.
+    std::vector<std::vector<uint64_t>> vertexToHyperedges(numberOfVertices);
+    for (uint64_t hyperedgeIndex = 0; hyperedgeIndex < hyperedges.size(); ++hyperedgeIndex) {
+        if (hyperedges[hyperedgeIndex].size() > 1) {
+            for (auto vertex : hyperedges[hyperedgeIndex]) {
+                STORM_LOG_ASSERT(vertex < numberOfVertices, "Vertex " << vertex << " of hyperedge is out of range.");
+                vertexToHyperedges[vertex].push_back(hyperedgeIndex);
+            }
+        }
+    }
+
+    std::vector<uint64_t> bestOrder = order;
+    uint64_t bestSpan = computeTotalSpan(order, hyperedges);
+    std::vector<double> position(numberOfVertices), centerOfGravity(hyperedges.size()), newPosition(numberOfVertices);
+    for (uint64_t iteration = 0; iteration < maximalNumberOfIterations && bestSpan > 0; ++iteration) {
+        for (uint64_t index = 0; index < numberOfVertices; ++index) {
+            position[order[index]] = static_cast<double>(index);
+        }
+        for (uint64_t hyperedgeIndex = 0; hyperedgeIndex < hyperedges.size(); ++hyperedgeIndex) {
+            auto const& hyperedge = hyperedges[hyperedgeIndex];
+            if (hyperedge.size() > 1) {
+                double sum = 0.0;
+                for (auto vertex : hyperedge) {
+                    sum += position[vertex];
+                }
+                centerOfGravity[hyperedgeIndex] = sum / static_cast<double>(hyperedge.size());
+            }
+        }
+        for (uint64_t vertex = 0; vertex < numberOfVertices; ++vertex) {
+            if (vertexToHyperedges[vertex].empty()) {
+                newPosition[vertex] = position[vertex];
+            } else {
+                double sum = 0.0;
+                for (auto hyperedgeIndex : vertexToHyperedges[vertex]) {
+                    sum += centerOfGravity[hyperedgeIndex];
+                }
+                newPosition[vertex] = sum / static_cast<double>(vertexToHyperedges[vertex].size());
+            }
+        }
+        // Ties are broken by the current order to keep the result deterministic.
+        std::sort(order.begin(), order.end(), [&](uint64_t a, uint64_t b) {
+            return newPosition[a] < newPosition[b] || (newPosition[a] == newPosition[b] && position[a] < position[b]);
+        });
+
+        uint64_t span = computeTotalSpan(order, hyperedges);
+        if (span >= bestSpan) {
+            break;
+        }
+        bestSpan = span;
+        bestOrder = order;
+    }
+    return bestOrder;
+}
+
+std::vector<storm::expressions::Variable> computeVariableOrder(storm::prism::Program const& program, DdVariableOrder order) {
+    std::vector<storm::expressions::Variable> variables;
+    for (auto const& variable : program.getGlobalIntegerVariables()) {
+        variables.push_back(variable.getExpressionVariable());
+    }
+    for (auto const& variable : program.getGlobalBooleanVariables()) {
+        variables.push_back(variable.getExpressionVariable());
+    }
+    for (auto const& module : program.getModules()) {
+        for (auto const& variable : module.getIntegerVariables()) {
+            variables.push_back(variable.getExpressionVariable());
+        }
+        for (auto const& variable : module.getBooleanVariables()) {
+            variables.push_back(variable.getExpressionVariable());
+        }
+    }
+    if (order == DdVariableOrder::Declaration) {
+        return variables;
+    }
+    STORM_LOG_ASSERT(order == DdVariableOrder::Force, "Unknown variable order.");
+
+    std::map<storm::expressions::Variable, uint64_t> variableToIndex;
+    for (uint64_t index = 0; index < variables.size(); ++index) {
+        variableToIndex.emplace(variables[index], index);
+    }
+    std::vector<std::vector<uint64_t>> hyperedges;
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            std::set<storm::expressions::Variable> commandVariables = command.getGuardExpression().getVariables();
+            for (auto const& update : command.getUpdates()) {
+                for (auto const& assignment : update.getAssignments()) {
+                    commandVariables.insert(assignment.getVariable());
+                    auto expressionVariables = assignment.getExpression().getVariables();
+                    commandVariables.insert(expressionVariables.begin(), expressionVariables.end());
+                }
+            }
+            std::vector<uint64_t> hyperedge;
+            for (auto const& variable : commandVariables) {
+                // Other variables (e.g. undefined constants) are not encoded by the builder.
+                auto it = variableToIndex.find(variable);
+                if (it != variableToIndex.end()) {
+                    hyperedge.push_back(it->second);
+                }
+            }
+            hyperedges.push_back(std::move(hyperedge));
+        }
+    }
+
+    std::vector<uint64_t> declarationOrder(variables.size());
+    std::iota(declarationOrder.begin(), declarationOrder.end(), 0ull);
+    std::vector<uint64_t> vertexOrder = computeForceOrder(variables.size(), hyperedges);
+    STORM_LOG_INFO("The FORCE variable order reduces the total span of the commands from " << computeTotalSpan(declarationOrder, hyperedges) << " to "
+                                                                                               << computeTotalSpan(vertexOrder, hyperedges) << ".");
+    std::vector<storm::expressions::Variable> result;
+    result.reserve(variables.size());
+    for (auto index : vertexOrder) {
+        result.push_back(variables[index]);
+    }
+    return result;
+}
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+
+namespace builder {
+
+// An enum that contains all orders in which the symbolic builders can allocate the DD variables of the model variables.
+enum class DdVariableOrder { Declaration, Force };
+
+std::ostream& operator<<(std::ostream& out, DdVariableOrder const& order);
+
+/*!
+ * Computes an order of the vertices of the given hypergraph using the FORCE heuristic: Starting from the identity order, every vertex is repeatedly moved
+ * to the average center of gravity of its hyperedges. This tends to place vertices that share hyperedges next to each other. The order found in any of the
+ * iterations that minimizes the total span (i.e., the sum over all hyperedges of the distance between their first and last vertex) is returned.
+ *
+ * @param numberOfVertices The number of vertices.
+ * @param hyperedges The hyperedges given by the vertices they connect.
+ * @param maximalNumberOfIterations The maximal number of iterations. The heuristic stops earlier if the span does not decrease any more.
+ * @return The vertices in the computed order.
+ */
+std::vector<uint64_t> computeForceOrder(uint64_t numberOfVertices, std::vector<std::vector<uint64_t>> const& hyperedges,
+                                        uint64_t maximalNumberOfIterations = 100);
+
+/*!
+ * Computes the total span of the given hyperedges with respect to the given order.
+ */
+uint64_t computeTotalSpan(std::vector<uint64_t> const& order, std::vector<std::vector<uint64_t>> const& hyperedges);
+
+/*!
+ * Computes the order in which the DD variables of the (global and module) variables of the given program are to be allocated. For the FORCE order, every
+ * command yields a hyperedge that connects the variables of its guard, the variables it assigns and the variables of the assigned expressions.
+ *
+ * @param program The program whose variables to order.
+ * @param order The kind of order to compute.
+ * @return All global and module variables of the program in the computed order.
+ */
+std::vector<storm::expressions::Variable> computeVariableOrder(storm::prism::Program const& program, DdVariableOrder order);
+
+}  // namespace builder
+}  // namespace storm
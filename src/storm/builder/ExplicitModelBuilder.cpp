@@ -1,6 +1,9 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
+#include <limits>
 #include <map>
+#include <type_traits>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -9,6 +12,7 @@
 
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 
 #include "storm/generator/JaniNextStateGenerator.h"
@@ -23,6 +27,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
 
+#include "storm/storage/ChunkedSparseMatrixBuilder.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/jani/Automaton.h"
 #include "storm/storage/jani/AutomatonComposition.h"
@@ -30,15 +35,114 @@
 #include "storm/storage/jani/ParallelComposition.h"
 
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/prism.h"
 
 namespace storm {
 namespace builder {
 
+namespace {
+// The number of states that are handed to the generator at once during breadth-first exploration.
+uint64_t const explorationBatchSize = 256;
+
+/*!
+ * Collects the rows of the states that one process owns in a distributed exploration. When a row is added, the global indices of its successors
+ * are not known yet, which is why the columns are only translated when building the matrix.
+ */
+template<typename StateType>
+class DistributedRowCollector {
+   public:
+    void newRowGroup(uint64_t startingRow) {
+        rowGroupIndices.push_back(startingRow);
+    }
+
+    void addNextValue(uint64_t row, StateType column, double const& value) {
+        while (rowIndications.size() <= row) {
+            rowIndications.push_back(entries.size());
+        }
+        entries.emplace_back(column, value);
+    }
+
+    /*!
+     * Builds the matrix with the given number of rows and columns. The columns of each row are translated with the given mapping and then sorted.
+     */
+    template<typename ColumnMapping>
+    storm::storage::SparseMatrix<double> build(uint64_t numberOfRows, uint64_t numberOfColumns, bool hasCustomRowGrouping,
+                                               ColumnMapping const& columnMapping) {
+        rowIndications.resize(numberOfRows + 1, entries.size());
+        storm::storage::SparseMatrixBuilder<double> builder(numberOfRows, numberOfColumns, entries.size(), true, hasCustomRowGrouping,
+                                                            hasCustomRowGrouping ? rowGroupIndices.size() : 0);
+        uint64_t nextRowGroup = 0;
+        std::vector<std::pair<uint64_t, double>> rowEntries;
+        for (uint64_t row = 0; row < numberOfRows; ++row) {
+            if (hasCustomRowGrouping && nextRowGroup < rowGroupIndices.size() && rowGroupIndices[nextRowGroup] == row) {
+                builder.newRowGroup(row);
+                ++nextRowGroup;
+            }
+            rowEntries.clear();
+            for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+                rowEntries.emplace_back(columnMapping(entries[entry].first), entries[entry].second);
+            }
+            std::sort(rowEntries.begin(), rowEntries.end());
+            for (auto const& [column, value] : rowEntries) {
+                builder.addNextValue(row, column, value);
+            }
+        }
+        return builder.build(numberOfRows, numberOfColumns, hasCustomRowGrouping ? rowGroupIndices.size() : 0);
+    }
+
+   private:
+    std::vector<uint64_t> rowGroupIndices;
+    std::vector<uint64_t> rowIndications;
+    std::vector<std::pair<StateType, double>> entries;
+};
+
+/*!
+ * Records the number of entries of each row and the starts of the row groups that are added to it. This is used to allocate the storage for the rows
+ * before they are written.
+ */
+class RowStructureRecorder {
+   public:
+    explicit RowStructureRecorder(uint64_t firstRow) : firstRow(firstRow) {
+        // Intentionally left empty.
+    }
+
+    void newRowGroup(uint64_t startingRow) {
+        rowGroupStarts.push_back(startingRow);
+    }
+
+    template<typename ValueType>
+    void addNextValue(uint64_t row, uint64_t, ValueType const&) {
+        if (rowEntryCounts.size() <= row - firstRow) {
+            rowEntryCounts.resize(row - firstRow + 1, 0);
+        }
+        ++rowEntryCounts[row - firstRow];
+    }
+
+    uint64_t firstRow;
+    std::vector<uint64_t> rowEntryCounts;
+    std::vector<uint64_t> rowGroupStarts;
+};
+
+/*!
+ * Retrieves an approximation of the given probability, which is used to estimate the probability mass of states.
+ */
+template<typename ValueType>
+double getProbabilityEstimate(ValueType const& value) {
+    if constexpr (std::is_same_v<ValueType, storm::RationalFunction>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Probability-guided exploration is not supported for parametric models.");
+        return 0.0;
+    } else {
+        return storm::utility::convertNumber<double>(value);
+    }
+}
+}  // namespace
+
 template<typename StateType>
 StateType ExplicitStateLookup<StateType>::lookup(std::map<storm::expressions::Variable, storm::expressions::Expression> const& stateDescription) const {
     auto cs = storm::generator::createCompressedState(this->varInfo, stateDescription, true);
@@ -62,6 +166,15 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options()
     if (buildSettings.isExplorationStateLimitSet()) {
         explorationStateLimit = buildSettings.getExplorationStateLimit();
     }
+    if (buildSettings.isExplorationMassThresholdSet()) {
+        explorationMassThreshold = buildSettings.getExplorationMassThreshold();
+    }
+    numberOfThreads = buildSettings.getNumberOfBuildThreads();
+    if (buildSettings.isDiskBackedStateStorageSet()) {
+        maximalNumberOfStatesInMemory = buildSettings.getMaximalNumberOfStatesInMemory();
+        stateStorageDirectory = buildSettings.getStateStorageDirectory();
+    }
+    compressChains = buildSettings.isCompressChainsSet();
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -76,7 +189,11 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
     : ExplicitModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions), builderOptions) {
-    // Intentionally left empty.
+    if (this->options.numberOfThreads > 1) {
+        generatorFactory = [program, generatorOptions]() {
+            return std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions);
+        };
+    }
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -84,7 +201,11 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
     : ExplicitModelBuilder(std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions), builderOptions) {
-    // Intentionally left empty.
+    if (this->options.numberOfThreads > 1) {
+        generatorFactory = [model, generatorOptions]() {
+            return std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions);
+        };
+    }
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -113,6 +234,17 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Explic
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex(CompressedState const& state) {
+    if (diskBackedStateStorage) {
+        // This looks up the state on disk immediately, which is why the levels of the exploration are treated differently (see buildMatrices).
+        if (auto knownIndex = diskBackedStateStorage->find(state)) {
+            return *knownIndex;
+        }
+        StateType newIndex = static_cast<StateType>(diskBackedStateStorage->size());
+        diskBackedStateStorage->insert(state, newIndex);
+        statesToExplore.emplace_back(state, newIndex);
+        return newIndex;
+    }
+
     StateType newIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
 
     // Check, if the state was already registered.
@@ -128,6 +260,13 @@ StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddS
             stateRemapping.get().push_back(storm::utility::zero<StateType>());
         } else if (options.explorationOrder == ExplorationOrder::Bfs) {
             statesToExplore.emplace_back(state, actualIndex);
+            if (stateRemapping) {
+                stateRemapping.get().push_back(storm::utility::zero<StateType>());
+            }
+        } else if (options.explorationOrder == ExplorationOrder::Probability) {
+            // The state is queued once its share of the probability mass is known (see buildMatrices).
+            frontier.emplace(actualIndex, std::make_pair(state, 0.0));
+            stateRemapping.get().push_back(storm::utility::zero<StateType>());
         } else {
             STORM_LOG_ASSERT(false, "Invalid exploration order.");
         }
@@ -138,12 +277,242 @@ StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddS
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitStateLookup<StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exportExplicitStateLookup() const {
+    STORM_LOG_THROW(!diskBackedStateStorage, storm::exceptions::NotSupportedException, "The states are not kept in memory.");
     return ExplicitStateLookup<StateType>(this->generator->getVariableInformation(), this->stateStorage.stateToId);
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
+template<typename MatrixBuilderType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehavior(
+    CompressedState const& state, StateType const& stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+    uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow, MatrixBuilderType& transitionMatrixBuilder,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder, StateType const& placeholderOffset, std::vector<StateType> const& placeholderIndices) {
+    // If there is no behavior, we might have to introduce a self-loop.
+    if (behavior.empty()) {
+        if (options.fixDeadlocks || !behavior.wasExpanded()) {
+            // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+            if (behavior.wasExpanded()) {
+                this->stateStorage.deadlockStateIndices.push_back(stateIndex);
+            } else {
+                this->stateStorage.unexploredStateIndices.push_back(stateIndex);
+            }
+
+            addTransitions(stateIndex, behavior, currentRow, transitionMatrixBuilder, placeholderOffset, placeholderIndices);
+
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateRewards()) {
+                    rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                }
+
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                }
+            }
+
+            // This state shall be Markovian (to not introduce Zeno behavior)
+            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
+                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+            }
+            // Other state-based information does not need to be treated, in particular:
+            // * StateValuations have already been set above
+            // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
+
+            ++currentRow;
+            ++currentRowGroup;
+        } else {
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
+                            "Error while creating sparse matrix from probabilistic program: found deadlock state ("
+                                << generator->stateToString(state) << "). For fixing these, please provide the appropriate option.");
+        }
+    } else {
+        // Add the state rewards to the corresponding reward models.
+        auto stateRewardIt = behavior.getStateRewards().begin();
+        for (auto& rewardModelBuilder : rewardModelBuilders) {
+            if (rewardModelBuilder.hasStateRewards()) {
+                rewardModelBuilder.addStateReward(*stateRewardIt);
+            }
+            ++stateRewardIt;
+        }
+
+        addTransitions(stateIndex, behavior, currentRow, transitionMatrixBuilder, placeholderOffset, placeholderIndices);
+
+        // Now add all choices.
+        bool firstChoiceOfState = true;
+        for (auto const& choice : behavior) {
+            // add the generated choice information
+            if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
+                stateAndChoiceInformationBuilder.addChoiceLabels(choice.getLabels(), currentRow);
+            }
+            if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
+                stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
+            }
+            if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
+                STORM_LOG_ASSERT(
+                    firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
+                    "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
+                if (firstChoiceOfState) {
+                    stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
+                }
+            }
+            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
+                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+            }
+
+            // Add the rewards to the reward models.
+            auto choiceRewardIt = choice.getRewards().begin();
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                }
+                ++choiceRewardIt;
+            }
+            ++currentRow;
+            firstChoiceOfState = false;
+        }
+
+        ++currentRowGroup;
+    }
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+template<typename MatrixBuilderType>
+uint_fast64_t ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addTransitions(
+    StateType const& stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, uint_fast64_t row,
+    MatrixBuilderType& transitionMatrixBuilder, StateType const& placeholderOffset, std::vector<StateType> const& placeholderIndices) const {
+    // If the model is nondeterministic, we need to open a row group.
+    if (!generator->isDeterministicModel()) {
+        transitionMatrixBuilder.newRowGroup(row);
+    }
+
+    // A state without behavior obtains a self-loop.
+    if (behavior.empty()) {
+        transitionMatrixBuilder.addNextValue(row, stateIndex, storm::utility::one<ValueType>());
+        return row + 1;
+    }
+
+    for (auto const& choice : behavior) {
+        for (auto const& stateProbabilityPair : choice) {
+            StateType column = stateProbabilityPair.first;
+            if (column >= placeholderOffset) {
+                column = placeholderIndices[column - placeholderOffset];
+            }
+            transitionMatrixBuilder.addNextValue(row, column, stateProbabilityPair.second);
+        }
+        ++row;
+    }
+    return row;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isParallelExplorationApplicable() const {
+    if (options.numberOfThreads <= 1) {
+        return false;
+    }
+    // The ids of states depend on the order in which they are discovered. To obtain the same ids as in a sequential exploration, we expand
+    // complete breadth-first levels in parallel and then register the new states in the sequential discovery order.
+    if (!generatorFactory) {
+        STORM_LOG_WARN("Parallel state space exploration is only supported for PRISM and JANI input. Exploring sequentially.");
+        return false;
+    }
+    if (options.explorationOrder != ExplorationOrder::Bfs) {
+        STORM_LOG_WARN("Parallel state space exploration is only supported for breadth-first exploration. Exploring sequentially.");
+        return false;
+    }
+    if (options.explorationStateLimit.has_value()) {
+        STORM_LOG_WARN("Parallel state space exploration is not supported in combination with an exploration state limit. Exploring sequentially.");
+        return false;
+    }
+    if (generator->getOptions().isAddOverlappingGuardLabelSet()) {
+        STORM_LOG_WARN("Parallel state space exploration is not supported when labeling states with overlapping guards. Exploring sequentially.");
+        return false;
+    }
+    if (options.maximalNumberOfStatesInMemory.has_value()) {
+        STORM_LOG_WARN("Parallel state space exploration is not supported when keeping states on disk. Exploring sequentially.");
+        return false;
+    }
+    if (options.compressChains) {
+        STORM_LOG_WARN("Parallel state space exploration is not supported in combination with chain compression. Exploring sequentially.");
+        return false;
+    }
+    return true;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isChainCompressionApplicable() const {
+    if (!options.compressChains) {
+        return false;
+    }
+    if (generator->getModelType() != storm::generator::ModelType::DTMC && generator->getModelType() != storm::generator::ModelType::MDP) {
+        STORM_LOG_WARN("Chain compression is only supported for DTMCs and MDPs. Building the full model.");
+        return false;
+    }
+    if (options.maximalNumberOfStatesInMemory.has_value()) {
+        STORM_LOG_WARN("Chain compression is not supported when keeping states on disk. Building the full model.");
+        return false;
+    }
+    if (generator->getOptions().isBuildStateValuationsSet() || generator->getOptions().isAddOverlappingGuardLabelSet()) {
+        STORM_LOG_WARN("Chain compression is not supported when building state valuations or labeling states with overlapping guards. Building the full "
+                       "model.");
+        return false;
+    }
+    return true;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+std::vector<typename ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ParallelExplorationChunk>
+ExplicitModelBuilder<ValueType, RewardModelType, StateType>::expandLevelInParallel(
+    std::vector<std::pair<CompressedState, StateType>> const& level,
+    std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> const& workerGenerators) const {
+    // States that are not known yet are referred to by placeholder ids beyond the current number of states.
+    StateType const placeholderOffset = static_cast<StateType>(stateStorage.getNumberOfStates());
+    std::vector<ParallelExplorationChunk> chunks(workerGenerators.size());
+
+    // Note that the state storage is only read during this phase, which is why it can be shared among the threads.
+    uint64_t numberOfChunks = storm::utility::parallel::forEachChunk(
+        workerGenerators.size(), static_cast<uint64_t>(0), static_cast<uint64_t>(level.size()), [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+            ParallelExplorationChunk& chunk = chunks[threadIndex];
+            chunk.begin = begin;
+            chunk.end = end;
+            chunk.behaviors.reserve(end - begin);
+            storm::generator::NextStateGenerator<ValueType, StateType>& workerGenerator = *workerGenerators[threadIndex];
+
+            storm::storage::BitVectorHashMap<StateType> newStateToPlaceholder(stateStorage.bitsPerState, 100);
+            std::function<StateType(CompressedState const&)> stateToIdCallback = [&](CompressedState const& state) -> StateType {
+                if (auto knownIndex = stateStorage.stateToId.find(state)) {
+                    return *knownIndex;
+                }
+                StateType newPlaceholder = placeholderOffset + static_cast<StateType>(chunk.newStates.size());
+                StateType placeholder = newStateToPlaceholder.findOrAdd(state, newPlaceholder);
+                if (placeholder == newPlaceholder) {
+                    chunk.newStates.push_back(state);
+                }
+                return placeholder;
+            };
+
+            std::vector<CompressedState const*> batch;
+            for (uint64_t batchBegin = begin; batchBegin < end; batchBegin += explorationBatchSize) {
+                uint64_t const batchEnd = std::min(batchBegin + explorationBatchSize, end);
+                batch.clear();
+                for (uint64_t position = batchBegin; position < batchEnd; ++position) {
+                    batch.push_back(&level[position].first);
+                }
+                workerGenerator.expandBatch(batch, stateToIdCallback, chunk.behaviors);
+                if (storm::utility::resources::isTerminate()) {
+                    // The remaining states are not needed as the exploration is aborted anyway.
+                    chunk.end = batchEnd;
+                    break;
+                }
+            }
+        });
+    chunks.resize(numberOfChunks);
+    return chunks;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+template<typename MatrixBuilderType>
 void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
-    storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+    MatrixBuilderType& transitionMatrixBuilder,
     std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
     StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
     // Initialize building state valuations (if necessary)
@@ -155,13 +524,41 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     std::function<StateType(CompressedState const&)> stateToIdCallback =
         std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
 
-    // If the exploration order is something different from breadth-first, we need to keep track of the remapping
+    bool compressChains = false;
+    if constexpr (std::is_same_v<MatrixBuilderType, storm::storage::SparseMatrixBuilder<ValueType>>) {
+        compressChains = isChainCompressionApplicable();
+    } else {
+        STORM_LOG_WARN_COND(!options.compressChains, "Chain compression is not supported for this kind of output. Building the full model.");
+    }
+
+    // If the exploration order is something different from breadth-first or states are skipped, we need to keep track of the remapping
     // from state ids to row groups. For this, we actually store the reversed mapping of row groups to state-ids
     // and later reverse it.
-    if (options.explorationOrder != ExplorationOrder::Bfs) {
+    if (options.explorationOrder != ExplorationOrder::Bfs || compressChains) {
         stateRemapping = std::vector<uint_fast64_t>();
     }
 
+    // If requested, keep only a bounded number of states in memory.
+    if (options.maximalNumberOfStatesInMemory.has_value()) {
+        STORM_LOG_THROW(options.explorationOrder == ExplorationOrder::Bfs && !options.explorationStateLimit.has_value(),
+                        storm::exceptions::NotSupportedException, "Keeping states on disk requires breadth-first exploration without a state limit.");
+        STORM_LOG_THROW(!generator->isPartiallyObservable() && !generator->getOptions().isAddOverlappingGuardLabelSet(),
+                        storm::exceptions::NotSupportedException,
+                        "Keeping states on disk is not supported for partially observable models or when labeling states with overlapping guards.");
+        diskBackedStateStorage = std::make_unique<storm::storage::DiskBackedStateMap<StateType>>(
+            stateStorage.bitsPerState, options.maximalNumberOfStatesInMemory.value(), options.stateStorageDirectory);
+    }
+
+    // If requested, create one generator per thread. The first thread uses the generator of this builder.
+    std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> workerGenerators;
+    if (isParallelExplorationApplicable()) {
+        STORM_LOG_INFO("Exploring the state space with " << options.numberOfThreads << " threads.");
+        workerGenerators.push_back(generator);
+        while (workerGenerators.size() < options.numberOfThreads) {
+            workerGenerators.push_back(generatorFactory());
+        }
+    }
+
     // Let the generator create all initial states.
     this->stateStorage.initialStateIndices = generator->getInitialStates(stateToIdCallback);
     STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException,
@@ -176,185 +573,445 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     uint64_t numberOfExploredStates = 0;
     uint64_t numberOfExploredStatesSinceLastMessage = 0;
 
-    // Perform a search through the model.
-    while (!statesToExplore.empty()) {
-        // Get the first state in the queue.
-        CompressedState currentState = statesToExplore.front().first;
-        StateType currentIndex = statesToExplore.front().second;
-        statesToExplore.pop_front();
+    auto finishStateExploration = [&]() {
+        ++numberOfExploredStates;
+        if (generator->getOptions().isShowProgressSet()) {
+            ++numberOfExploredStatesSinceLastMessage;
 
-        // If the exploration order differs from breadth-first, we remember that this row group was actually
-        // filled with the transitions of a different state.
-        if (options.explorationOrder != ExplorationOrder::Bfs) {
-            stateRemapping.get()[currentIndex] = currentRowGroup;
+            auto now = std::chrono::high_resolution_clock::now();
+            auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+            if (static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getShowProgressDelay()) {
+                auto statesPerSecond = numberOfExploredStatesSinceLastMessage / durationSinceLastMessage;
+                auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
+                std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond
+                          << " states per second).\n";
+                timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                numberOfExploredStatesSinceLastMessage = 0;
+            }
         }
 
-        if (currentIndex % 100000 == 0) {
-            STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
+        if (storm::utility::resources::isTerminate()) {
+            auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+            std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+        }
+    };
+
+    std::vector<StateType> const noPlaceholders;
+    StateType const noPlaceholderOffset = std::numeric_limits<StateType>::max();
+    std::vector<storm::generator::StateBehavior<ValueType, StateType>> batchBehaviors;
+
+    // If chains are compressed, the states that are skipped are mapped to their (only) successor. A skipped state is neither initial nor labeled
+    // and moves to its successor with probability one without collecting any reward.
+    std::unordered_map<StateType, StateType> chainSuccessors;
+    auto skipChainState = [&](CompressedState const& state, StateType const& stateIndex,
+                              storm::generator::StateBehavior<ValueType, StateType> const& behavior) {
+        if (!compressChains || behavior.getNumberOfChoices() != 1) {
+            return false;
+        }
+        auto const& choice = *behavior.begin();
+        if (choice.size() != 1 || choice.begin()->first == stateIndex || choice.hasLabels() || choice.hasOriginData()) {
+            return false;
+        }
+        auto isNonZero = [](ValueType const& reward) { return !storm::utility::isZero(reward); };
+        if (std::any_of(behavior.getStateRewards().begin(), behavior.getStateRewards().end(), isNonZero) ||
+            std::any_of(choice.getRewards().begin(), choice.getRewards().end(), isNonZero)) {
+            return false;
+        }
+        auto const& initialStateIndices = this->stateStorage.initialStateIndices;
+        if (std::find(initialStateIndices.begin(), initialStateIndices.end(), stateIndex) != initialStateIndices.end() || generator->isLabeled(state)) {
+            return false;
         }
+        chainSuccessors.emplace(stateIndex, choice.begin()->first);
+        return true;
+    };
+
+    if (options.explorationOrder == ExplorationOrder::Probability) {
+        // The probability mass is initially distributed uniformly among the initial states.
+        double const initialMass = 1.0 / static_cast<double>(this->stateStorage.initialStateIndices.size());
+        for (auto const& initialStateIndex : this->stateStorage.initialStateIndices) {
+            frontier.at(initialStateIndex).second = initialMass;
+            prioritizedStates.emplace(initialMass, initialStateIndex);
+        }
+        frontierMass = 1.0;
+    }
+
+    // Perform a probability-guided search (if requested). Every state passes on its mass to its successors that are not explored yet, so the mass
+    // of a state estimates the probability to reach it via the explored states. The mass that flows back to explored states is dropped.
+    std::unordered_map<StateType, double> successorMasses;
+    while (!frontier.empty()) {
+        if (prioritizedStates.empty()) {
+            // This only happens if the generator registered states that are not the successor of any explored state.
+            for (auto const& frontierEntry : frontier) {
+                prioritizedStates.emplace(frontierEntry.second.second, frontierEntry.first);
+            }
+        }
+        auto const [mass, currentIndex] = prioritizedStates.top();
+        prioritizedStates.pop();
+        auto frontierIt = frontier.find(currentIndex);
+        // Entries are outdated if the state was explored already or if its mass increased after the entry was queued.
+        if (frontierIt == frontier.end() || frontierIt->second.second != mass) {
+            continue;
+        }
+        CompressedState currentState = std::move(frontierIt->second.first);
+        frontier.erase(frontierIt);
+        stateRemapping.get()[currentIndex] = currentRowGroup;
 
         generator->load(currentState);
         if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
             generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
         }
 
+        // Once the state limit is reached or the remaining states are only reached with negligible probability, the remaining states are not expanded.
+        bool const budgetExhausted =
+            (options.explorationStateLimit.has_value() && stateStorage.getNumberOfStates() >= options.explorationStateLimit.value()) ||
+            (options.explorationMassThreshold.has_value() && frontierMass < options.explorationMassThreshold.value());
+        frontierMass -= mass;
+
         storm::generator::StateBehavior<ValueType, StateType> behavior;
-        // If the exploration state limit is set and the limit is reached, we stop the exploration.
-        bool const stateLimitExceeded = options.explorationStateLimit.has_value() && stateStorage.getNumberOfStates() >= options.explorationStateLimit.value();
-        if (!stateLimitExceeded) {
+        if (!budgetExhausted) {
             behavior = generator->expand(stateToIdCallback);
-        }
 
-        // If there is no behavior, we might have to introduce a self-loop.
-        if (behavior.empty()) {
-            if (options.fixDeadlocks || !behavior.wasExpanded()) {
-                // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                if (behavior.wasExpanded()) {
-                    this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                } else {
-                    this->stateStorage.unexploredStateIndices.push_back(currentIndex);
-                }
-
-                if (!generator->isDeterministicModel()) {
-                    transitionMatrixBuilder.newRowGroup(currentRow);
+            // Every successor gets its largest share of the mass over all choices.
+            successorMasses.clear();
+            for (auto const& choice : behavior) {
+                double const choiceMass = getProbabilityEstimate(choice.getTotalMass());
+                for (auto const& successorProbabilityPair : choice) {
+                    if (frontier.count(successorProbabilityPair.first) > 0) {
+                        double& successorMass = successorMasses[successorProbabilityPair.first];
+                        successorMass = std::max(successorMass, mass * getProbabilityEstimate(successorProbabilityPair.second) / choiceMass);
+                    }
                 }
+            }
+            for (auto const& [successor, successorMass] : successorMasses) {
+                double& frontierEntryMass = frontier.at(successor).second;
+                frontierEntryMass += successorMass;
+                frontierMass += successorMass;
+                prioritizedStates.emplace(frontierEntryMass, successor);
+            }
+        }
 
-                transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
+        if (!skipChainState(currentState, currentIndex, behavior)) {
+            addStateBehavior(currentState, currentIndex, behavior, currentRowGroup, currentRow, transitionMatrixBuilder, rewardModelBuilders,
+                             stateAndChoiceInformationBuilder, noPlaceholderOffset, noPlaceholders);
+        }
+        generator->recycle(std::move(behavior));
+        finishStateExploration();
+    }
 
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateRewards()) {
-                        rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+    // Perform a search through the model.
+    while (!statesToExplore.empty()) {
+        if (!workerGenerators.empty()) {
+            // Expand the complete current level in parallel. The successors found in this way form the next level.
+            std::vector<std::pair<CompressedState, StateType>> currentLevel(std::make_move_iterator(statesToExplore.begin()),
+                                                                            std::make_move_iterator(statesToExplore.end()));
+            statesToExplore.clear();
+            StateType const placeholderOffset = static_cast<StateType>(stateStorage.getNumberOfStates());
+            std::vector<ParallelExplorationChunk> chunks = expandLevelInParallel(currentLevel, workerGenerators);
+
+            if constexpr (std::is_same_v<MatrixBuilderType, storm::storage::ChunkedSparseMatrixBuilder<ValueType>>) {
+                // Register the new states in the order in which a sequential exploration would have found them and add everything but the rows,
+                // whose sizes are only recorded. Then, the storage for all rows of the level is allocated at once and every chunk is written
+                // in place by a separate thread.
+                uint64_t const firstRowOfLevel = currentRow;
+                RowStructureRecorder rowStructure(firstRowOfLevel);
+                std::vector<uint64_t> firstRowOfChunk(chunks.size());
+                std::vector<std::vector<StateType>> placeholderIndicesOfChunk(chunks.size());
+                for (uint64_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+                    auto& chunk = chunks[chunkIndex];
+                    firstRowOfChunk[chunkIndex] = currentRow;
+                    auto& placeholderIndices = placeholderIndicesOfChunk[chunkIndex];
+                    placeholderIndices.reserve(chunk.newStates.size());
+                    for (auto const& newState : chunk.newStates) {
+                        placeholderIndices.push_back(getOrAddStateIndex(newState));
                     }
-
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                    for (uint64_t position = chunk.begin; position < chunk.end; ++position) {
+                        auto const& [currentState, currentIndex] = currentLevel[position];
+                        if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                            generator->load(currentState);
+                            generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+                        }
+                        addStateBehavior(currentState, currentIndex, chunk.behaviors[position - chunk.begin], currentRowGroup, currentRow, rowStructure,
+                                         rewardModelBuilders, stateAndChoiceInformationBuilder, placeholderOffset, placeholderIndices);
+                        finishStateExploration();
                     }
                 }
-
-                // This state shall be Markovian (to not introduce Zeno behavior)
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+                rowStructure.rowEntryCounts.resize(currentRow - firstRowOfLevel, 0);
+                transitionMatrixBuilder.appendRows(firstRowOfLevel, rowStructure.rowEntryCounts, rowStructure.rowGroupStarts);
+
+                storm::utility::parallel::forEachChunk(
+                    chunks.size(), static_cast<uint64_t>(0), static_cast<uint64_t>(chunks.size()), [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                        for (uint64_t chunkIndex = chunkBegin; chunkIndex < chunkEnd; ++chunkIndex) {
+                            auto const& chunk = chunks[chunkIndex];
+                            typename storm::storage::ChunkedSparseMatrixBuilder<ValueType>::RowWriter rowWriter(transitionMatrixBuilder);
+                            uint64_t row = firstRowOfChunk[chunkIndex];
+                            for (uint64_t position = chunk.begin; position < chunk.end; ++position) {
+                                row = addTransitions(currentLevel[position].second, chunk.behaviors[position - chunk.begin], row, rowWriter,
+                                                     placeholderOffset, placeholderIndicesOfChunk[chunkIndex]);
+                            }
+                        }
+                    });
+
+                // The chunk was expanded by the generator with the same index, which can reuse the storage for the next level.
+                for (uint64_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+                    for (auto& behavior : chunks[chunkIndex].behaviors) {
+                        workerGenerators[chunkIndex]->recycle(std::move(behavior));
+                    }
                 }
-                // Other state-based information does not need to be treated, in particular:
-                // * StateValuations have already been set above
-                // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
-
-                ++currentRow;
-                ++currentRowGroup;
             } else {
-                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
-                                "Error while creating sparse matrix from probabilistic program: found deadlock state ("
-                                    << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
-            }
-        } else {
-            // Add the state rewards to the corresponding reward models.
-            auto stateRewardIt = behavior.getStateRewards().begin();
-            for (auto& rewardModelBuilder : rewardModelBuilders) {
-                if (rewardModelBuilder.hasStateRewards()) {
-                    rewardModelBuilder.addStateReward(*stateRewardIt);
+                // Register the new states in the order in which a sequential exploration would have found them and add the rows.
+                std::vector<StateType> placeholderIndices;
+                for (uint64_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+                    auto& chunk = chunks[chunkIndex];
+                    placeholderIndices.clear();
+                    placeholderIndices.reserve(chunk.newStates.size());
+                    for (auto const& newState : chunk.newStates) {
+                        placeholderIndices.push_back(getOrAddStateIndex(newState));
+                    }
+                    for (uint64_t position = chunk.begin; position < chunk.end; ++position) {
+                        auto const& [currentState, currentIndex] = currentLevel[position];
+                        if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                            generator->load(currentState);
+                            generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+                        }
+                        auto& behavior = chunk.behaviors[position - chunk.begin];
+                        addStateBehavior(currentState, currentIndex, behavior, currentRowGroup, currentRow, transitionMatrixBuilder, rewardModelBuilders,
+                                         stateAndChoiceInformationBuilder, placeholderOffset, placeholderIndices);
+                        // The chunk was expanded by the generator with the same index, which can reuse the storage for the next level.
+                        workerGenerators[chunkIndex]->recycle(std::move(behavior));
+                        finishStateExploration();
+                    }
                 }
-                ++stateRewardIt;
-            }
-
-            // If the model is nondeterministic, we need to open a row group.
-            if (!generator->isDeterministicModel()) {
-                transitionMatrixBuilder.newRowGroup(currentRow);
             }
+            continue;
+        }
 
-            // Now add all choices.
-            bool firstChoiceOfState = true;
-            for (auto const& choice : behavior) {
-                // add the generated choice information
-                if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
-                    for (auto const& label : choice.getLabels()) {
-                        stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
-                    }
+        if (diskBackedStateStorage) {
+            // Expand the complete current level. Successors that are not in memory obtain placeholder ids. These successors are then looked up
+            // on disk at once (delayed duplicate detection) and the ones that are not found there are new states of the next level.
+            std::vector<std::pair<CompressedState, StateType>> currentLevel(std::make_move_iterator(statesToExplore.begin()),
+                                                                            std::make_move_iterator(statesToExplore.end()));
+            statesToExplore.clear();
+            StateType const placeholderOffset = static_cast<StateType>(diskBackedStateStorage->size());
+            storm::storage::BitVectorHashMap<StateType> candidateToPlaceholder(stateStorage.bitsPerState, 100);
+            std::vector<CompressedState> candidates;
+            std::function<StateType(CompressedState const&)> levelStateToIdCallback = [&](CompressedState const& state) -> StateType {
+                if (auto knownIndex = diskBackedStateStorage->findInMemory(state)) {
+                    return *knownIndex;
                 }
-                if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
-                    stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
+                StateType newPlaceholder = placeholderOffset + static_cast<StateType>(candidates.size());
+                StateType placeholder = candidateToPlaceholder.findOrAdd(state, newPlaceholder);
+                if (placeholder == newPlaceholder) {
+                    candidates.push_back(state);
                 }
-                if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
-                    STORM_LOG_ASSERT(
-                        firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
-                        "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
-                    if (firstChoiceOfState) {
-                        stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
-                    }
+                return placeholder;
+            };
+
+            batchBehaviors.clear();
+            batchBehaviors.reserve(currentLevel.size());
+            std::vector<CompressedState const*> batchStates;
+            for (uint64_t batchBegin = 0; batchBegin < currentLevel.size(); batchBegin += explorationBatchSize) {
+                uint64_t const batchEnd = std::min<uint64_t>(batchBegin + explorationBatchSize, currentLevel.size());
+                batchStates.clear();
+                for (uint64_t position = batchBegin; position < batchEnd; ++position) {
+                    batchStates.push_back(&currentLevel[position].first);
                 }
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+                generator->expandBatch(batchStates, levelStateToIdCallback, batchBehaviors);
+            }
+
+            // Candidates are numbered in the order in which they were encountered, so the states obtain the same ids as in a sequential exploration.
+            std::vector<std::optional<StateType>> indicesOnDisk = diskBackedStateStorage->findOnDisk(candidates);
+            std::vector<StateType> placeholderIndices(candidates.size());
+            for (uint64_t candidate = 0; candidate < candidates.size(); ++candidate) {
+                if (indicesOnDisk[candidate].has_value()) {
+                    placeholderIndices[candidate] = indicesOnDisk[candidate].value();
+                } else {
+                    placeholderIndices[candidate] = static_cast<StateType>(diskBackedStateStorage->size());
+                    diskBackedStateStorage->insert(candidates[candidate], placeholderIndices[candidate]);
+                    statesToExplore.emplace_back(std::move(candidates[candidate]), placeholderIndices[candidate]);
                 }
+            }
 
-                // Add the probabilistic behavior to the matrix.
-                for (auto const& stateProbabilityPair : choice) {
-                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+            for (uint64_t position = 0; position < currentLevel.size(); ++position) {
+                auto const& [currentState, currentIndex] = currentLevel[position];
+                if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                    generator->load(currentState);
+                    generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
                 }
+                addStateBehavior(currentState, currentIndex, batchBehaviors[position], currentRowGroup, currentRow, transitionMatrixBuilder,
+                                 rewardModelBuilders, stateAndChoiceInformationBuilder, placeholderOffset, placeholderIndices);
+                generator->recycle(std::move(batchBehaviors[position]));
+                finishStateExploration();
+            }
+            continue;
+        }
 
-                // Add the rewards to the reward models.
-                auto choiceRewardIt = choice.getRewards().begin();
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+        if (options.explorationOrder == ExplorationOrder::Bfs && !options.explorationStateLimit.has_value()) {
+            // Expand a batch of states from the front of the queue. As the callback is invoked in the same order as when expanding the states one
+            // after another, the states obtain the same ids.
+            uint64_t const batchSize = std::min<uint64_t>(statesToExplore.size(), explorationBatchSize);
+            std::vector<std::pair<CompressedState, StateType>> batch(std::make_move_iterator(statesToExplore.begin()),
+                                                                      std::make_move_iterator(statesToExplore.begin() + batchSize));
+            statesToExplore.erase(statesToExplore.begin(), statesToExplore.begin() + batchSize);
+            std::vector<CompressedState const*> batchStates;
+            batchStates.reserve(batchSize);
+            for (auto const& stateAndIndex : batch) {
+                batchStates.push_back(&stateAndIndex.first);
+            }
+            batchBehaviors.clear();
+            generator->expandBatch(batchStates, stateToIdCallback, batchBehaviors);
+
+            for (uint64_t position = 0; position < batchSize; ++position) {
+                auto const& [currentState, currentIndex] = batch[position];
+                if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                    generator->load(currentState);
+                    generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+                }
+                if (!skipChainState(currentState, currentIndex, batchBehaviors[position])) {
+                    if (stateRemapping) {
+                        stateRemapping.get()[currentIndex] = currentRowGroup;
                     }
-                    ++choiceRewardIt;
+                    addStateBehavior(currentState, currentIndex, batchBehaviors[position], currentRowGroup, currentRow, transitionMatrixBuilder,
+                                     rewardModelBuilders, stateAndChoiceInformationBuilder, noPlaceholderOffset, noPlaceholders);
                 }
-                ++currentRow;
-                firstChoiceOfState = false;
+                generator->recycle(std::move(batchBehaviors[position]));
+                finishStateExploration();
             }
+            continue;
+        }
 
-            ++currentRowGroup;
+        // Get the first state in the queue.
+        CompressedState currentState = statesToExplore.front().first;
+        StateType currentIndex = statesToExplore.front().second;
+        statesToExplore.pop_front();
+
+        // If the exploration order differs from breadth-first or states are skipped, we remember that this row group was actually
+        // filled with the transitions of a different state.
+        if (stateRemapping) {
+            stateRemapping.get()[currentIndex] = currentRowGroup;
         }
 
-        ++numberOfExploredStates;
-        if (generator->getOptions().isShowProgressSet()) {
-            ++numberOfExploredStatesSinceLastMessage;
+        if (currentIndex % 100000 == 0) {
+            STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
+        }
 
-            auto now = std::chrono::high_resolution_clock::now();
-            auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
-            if (static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getShowProgressDelay()) {
-                auto statesPerSecond = numberOfExploredStatesSinceLastMessage / durationSinceLastMessage;
-                auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
-                std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond
-                          << " states per second).\n";
-                timeOfLastMessage = std::chrono::high_resolution_clock::now();
-                numberOfExploredStatesSinceLastMessage = 0;
-            }
+        generator->load(currentState);
+        if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+            generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
         }
 
-        if (storm::utility::resources::isTerminate()) {
-            auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
-            std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds before abort.\n";
-            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
-            break;
+        storm::generator::StateBehavior<ValueType, StateType> behavior;
+        // If the exploration state limit is set and the limit is reached, we stop the exploration.
+        bool const stateLimitExceeded = options.explorationStateLimit.has_value() && stateStorage.getNumberOfStates() >= options.explorationStateLimit.value();
+        if (!stateLimitExceeded) {
+            behavior = generator->expand(stateToIdCallback);
         }
+
+        if (!skipChainState(currentState, currentIndex, behavior)) {
+            addStateBehavior(currentState, currentIndex, behavior, currentRowGroup, currentRow, transitionMatrixBuilder, rewardModelBuilders,
+                             stateAndChoiceInformationBuilder, noPlaceholderOffset, noPlaceholders);
+        }
+        generator->recycle(std::move(behavior));
+        finishStateExploration();
     }
 
     // If the exploration order was not breadth-first, we need to fix the entries in the matrix according to
     // (reversed) mapping of row groups to indices.
-    if (options.explorationOrder != ExplorationOrder::Bfs) {
-        STORM_LOG_ASSERT(stateRemapping, "Unable to fix columns without mapping.");
-        std::vector<uint_fast64_t> const& remapping = stateRemapping.get();
-
-        // We need to fix the following entities:
-        // (a) the transition matrix
-        // (b) the initial states
-        // (c) the hash map storing the mapping states -> ids
-        // (d) fix remapping for state-generation labels
-
-        // Fix (a).
-        transitionMatrixBuilder.replaceColumns(remapping, 0);
+    if constexpr (std::is_same_v<MatrixBuilderType, storm::storage::SparseMatrixBuilder<ValueType>>) {
+        if (stateRemapping) {
+            std::vector<uint_fast64_t>& remapping = stateRemapping.get();
+
+            // Skipped states are mapped to the row group of the first state on their chain that is not skipped. If there is no such state, the chain
+            // ends in a cycle of skipped states and one of these states is kept with a self-loop.
+            storm::storage::BitVector skippedStates(remapping.size());
+            if (!chainSuccessors.empty()) {
+                storm::storage::BitVector resolvedStates(remapping.size());
+                storm::storage::BitVector statesOnChain(remapping.size());
+                std::vector<StateType> chain;
+                for (auto const& chainEntry : chainSuccessors) {
+                    if (resolvedStates.get(chainEntry.first)) {
+                        continue;
+                    }
+                    chain.assign(1, chainEntry.first);
+                    statesOnChain.set(chainEntry.first);
+                    StateType end = chainEntry.second;
+                    auto endIt = chainSuccessors.find(end);
+                    while (endIt != chainSuccessors.end() && !resolvedStates.get(end) && !statesOnChain.get(end)) {
+                        chain.push_back(end);
+                        statesOnChain.set(end);
+                        end = endIt->second;
+                        endIt = chainSuccessors.find(end);
+                    }
+                    if (endIt != chainSuccessors.end() && statesOnChain.get(end)) {
+                        if (!generator->isDeterministicModel()) {
+                            transitionMatrixBuilder.newRowGroup(currentRow);
+                        }
+                        transitionMatrixBuilder.addNextValue(currentRow, end, storm::utility::one<ValueType>());
+                        for (auto& rewardModelBuilder : rewardModelBuilders) {
+                            if (rewardModelBuilder.hasStateRewards()) {
+                                rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                            }
+                            if (rewardModelBuilder.hasStateActionRewards()) {
+                                rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                            }
+                        }
+                        remapping[end] = currentRowGroup;
+                        ++currentRow;
+                        ++currentRowGroup;
+                    }
+                    for (auto const& state : chain) {
+                        statesOnChain.set(state, false);
+                        resolvedStates.set(state);
+                        if (state != end) {
+                            remapping[state] = remapping[end];
+                            skippedStates.set(state);
+                        }
+                    }
+                }
+                STORM_LOG_INFO("Skipped " << skippedStates.getNumberOfSetBits() << " states of deterministic chains during the exploration.");
+            }
 
-        // Fix (b).
-        std::vector<StateType> newInitialStateIndices(this->stateStorage.initialStateIndices.size());
-        std::transform(this->stateStorage.initialStateIndices.begin(), this->stateStorage.initialStateIndices.end(), newInitialStateIndices.begin(),
-                       [&remapping](StateType const& state) { return remapping[state]; });
-        std::sort(newInitialStateIndices.begin(), newInitialStateIndices.end());
-        this->stateStorage.initialStateIndices = std::move(newInitialStateIndices);
+            // We need to fix the following entities:
+            // (a) the transition matrix
+            // (b) the initial states
+            // (c) the hash map storing the mapping states -> ids
+            // (d) fix remapping for state-generation labels
+
+            // Fix (a).
+            transitionMatrixBuilder.replaceColumns(remapping, 0);
+
+            // Fix (b).
+            std::vector<StateType> newInitialStateIndices(this->stateStorage.initialStateIndices.size());
+            std::transform(this->stateStorage.initialStateIndices.begin(), this->stateStorage.initialStateIndices.end(), newInitialStateIndices.begin(),
+                           [&remapping](StateType const& state) { return remapping[state]; });
+            std::sort(newInitialStateIndices.begin(), newInitialStateIndices.end());
+            this->stateStorage.initialStateIndices = std::move(newInitialStateIndices);
+
+            // Fix (c). Skipped states are removed, so that they are neither labeled nor counted.
+            if (skippedStates.empty()) {
+                this->stateStorage.stateToId.remap([&remapping](StateType const& state) { return remapping[state]; });
+            } else {
+                storm::storage::BitVectorHashMap<StateType> keptStateToId(this->stateStorage.bitsPerState, currentRowGroup);
+                for (auto const& stateIndexPair : this->stateStorage.stateToId) {
+                    if (!skippedStates.get(stateIndexPair.second)) {
+                        keptStateToId.findOrAdd(stateIndexPair.first, static_cast<StateType>(remapping[stateIndexPair.second]));
+                    }
+                }
+                this->stateStorage.stateToId = std::move(keptStateToId);
+            }
 
-        // Fix (c).
-        this->stateStorage.stateToId.remap([&remapping](StateType const& state) { return remapping[state]; });
+            // The deadlock and unexplored states are referred to by their ids as well.
+            for (auto* specialStateIndices : {&this->stateStorage.deadlockStateIndices, &this->stateStorage.unexploredStateIndices}) {
+                for (auto& state : *specialStateIndices) {
+                    state = remapping[state];
+                }
+            }
 
-        this->generator->remapStateIds([&remapping](StateType const& state) { return remapping[state]; });
+            this->generator->remapStateIds([&remapping](StateType const& state) { return remapping[state]; });
+        }
+    } else {
+        STORM_LOG_ASSERT(options.explorationOrder == ExplorationOrder::Bfs && !compressChains,
+                         "Only breadth-first exploration without chain compression is supported for this matrix builder.");
     }
 }
 
@@ -365,7 +1022,6 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
     bool deterministicModel = generator->isDeterministicModel();
 
     // Prepare the component builders
-    storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, 0, 0, false, !deterministicModel, 0);
     std::vector<RewardModelBuilder<typename RewardModelType::ValueType>> rewardModelBuilders;
     for (uint64_t i = 0; i < generator->getNumberOfRewardModels(); ++i) {
         rewardModelBuilders.emplace_back(generator->getRewardModelInformation(i));
@@ -377,12 +1033,22 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
     stateAndChoiceInformationBuilder.setBuildMarkovianStates(generator->getModelType() == storm::generator::ModelType::MA);
     stateAndChoiceInformationBuilder.setBuildStateValuations(generator->getOptions().isBuildStateValuationsSet());
 
-    buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+    storm::storage::SparseMatrix<ValueType> transitionMatrix;
+    if (options.explorationOrder == ExplorationOrder::Bfs && !options.compressChains) {
+        // As the rows are added in their final order, they can be written to fixed-size chunks that never need to be reallocated.
+        storm::storage::ChunkedSparseMatrixBuilder<ValueType> transitionMatrixBuilder(!deterministicModel);
+        buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+        transitionMatrix = transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount());
+    } else {
+        storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, 0, 0, false, !deterministicModel, 0);
+        buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+        transitionMatrix = transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount());
+    }
 
     // Initialize the model components with the obtained information.
-    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(
-        transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount()), buildStateLabeling(),
-        std::unordered_map<std::string, RewardModelType>(), !generator->isDiscreteTimeModel());
+    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(std::move(transitionMatrix), buildStateLabeling(),
+                                                                                        std::unordered_map<std::string, RewardModelType>(),
+                                                                                        !generator->isDiscreteTimeModel());
 
     uint_fast64_t numStates = modelComponents.transitionMatrix.getColumnCount();
     uint_fast64_t numChoices = modelComponents.transitionMatrix.getRowCount();
@@ -410,8 +1076,9 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
         modelComponents.stateValuations = stateAndChoiceInformationBuilder.stateValuationsBuilder().build();
     }
     if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins()) {
-        auto originData = stateAndChoiceInformationBuilder.buildDataOfChoiceOrigins(numChoices);
-        modelComponents.choiceOrigins = generator->generateChoiceOrigins(originData);
+        auto originData = stateAndChoiceInformationBuilder.buildDataOfChoiceOriginIdentifiers();
+        modelComponents.choiceOrigins =
+            generator->generateChoiceOrigins(stateAndChoiceInformationBuilder.buildChoiceOriginIdentifiers(numChoices), originData);
     }
     if (generator->isPartiallyObservable()) {
         std::vector<uint32_t> classes(stateStorage.getNumberOfStates());
@@ -429,8 +1096,245 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
     return modelComponents;
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+typename ExplicitModelBuilder<ValueType, RewardModelType, StateType>::OutOfCoreModelComponents
+ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildOutOfCore(std::string const& matrixFilename) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        storm::models::ModelType modelType;
+        if (generator->getModelType() == storm::generator::ModelType::DTMC) {
+            modelType = storm::models::ModelType::Dtmc;
+        } else {
+            STORM_LOG_THROW(generator->getModelType() == storm::generator::ModelType::MDP, storm::exceptions::NotSupportedException,
+                            "Writing the transition matrix to disk is only supported for DTMCs and MDPs.");
+            modelType = storm::models::ModelType::Mdp;
+        }
+        STORM_LOG_THROW(options.explorationOrder == ExplorationOrder::Bfs, storm::exceptions::NotSupportedException,
+                        "Writing the transition matrix to disk requires breadth-first exploration.");
+
+        storm::storage::OutOfCoreMatrixWriter transitionMatrixWriter(matrixFilename, !generator->isDeterministicModel(), modelType);
+        std::vector<RewardModelBuilder<typename RewardModelType::ValueType>> rewardModelBuilders;
+        for (uint64_t i = 0; i < generator->getNumberOfRewardModels(); ++i) {
+            rewardModelBuilders.emplace_back(generator->getRewardModelInformation(i));
+        }
+        StateAndChoiceInformationBuilder stateAndChoiceInformationBuilder;
+        buildMatrices(transitionMatrixWriter, rewardModelBuilders, stateAndChoiceInformationBuilder);
+
+        uint64_t const numStates = transitionMatrixWriter.getCurrentRowGroupCount();
+        OutOfCoreModelComponents result{modelType, transitionMatrixWriter.build(0, numStates, numStates), buildStateLabeling(), {}};
+        for (auto& rewardModelBuilder : rewardModelBuilders) {
+            result.rewardModels.emplace(rewardModelBuilder.getName(), rewardModelBuilder.build(result.transitionMatrix.getRowCount(), numStates, numStates));
+        }
+        STORM_LOG_INFO("Wrote the transition matrix with " << result.transitionMatrix.getEntryCount() << " entries to '" << matrixFilename << "'.");
+        return result;
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Writing the transition matrix to disk is only supported for doubles.");
+    }
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+typename ExplicitModelBuilder<ValueType, RewardModelType, StateType>::DistributedModelComponents
+ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildDistributed(storm::utility::mpi::Communicator const& communicator) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        storm::models::ModelType modelType;
+        if (generator->getModelType() == storm::generator::ModelType::DTMC) {
+            modelType = storm::models::ModelType::Dtmc;
+        } else {
+            STORM_LOG_THROW(generator->getModelType() == storm::generator::ModelType::MDP, storm::exceptions::NotSupportedException,
+                            "Distributed state space exploration is only supported for DTMCs and MDPs.");
+            modelType = storm::models::ModelType::Mdp;
+        }
+        STORM_LOG_THROW(options.explorationOrder == ExplorationOrder::Bfs && !options.explorationStateLimit.has_value(),
+                        storm::exceptions::NotSupportedException,
+                        "Distributed state space exploration requires breadth-first exploration without a state limit.");
+        storm::utility::ProfilerPhase phase("distributed-exploration");
+        uint64_t const rank = communicator.getRank();
+        uint64_t const numberOfRanks = communicator.getNumberOfRanks();
+        uint64_t const bitsPerState = stateStorage.bitsPerState;
+        // States are sent as sequences of 64 bit words (at least one, so that the number of received states can be derived from the message).
+        uint64_t const wordsPerState = std::max<uint64_t>(1, (bitsPerState + 63) / 64);
+
+        // The owner is determined by a different hash function than the one of the hash maps, as otherwise the states that a process owns would
+        // all share the same (few) buckets.
+        storm::storage::FNV1aBitVectorHash ownerHash;
+        auto getOwner = [&](CompressedState const& state) -> uint64_t { return ownerHash(state) % numberOfRanks; };
+
+        // Successors owned by other processes are referred to by ids with the highest bit set. The remaining bits form an index into the
+        // vectors that store the owner of the state and the id its owner assigned to it.
+        StateType const remoteFlag = static_cast<StateType>(1) << (std::numeric_limits<StateType>::digits - 1);
+        storm::storage::BitVectorHashMap<StateType> remoteStateToIndex(bitsPerState, 100);
+        std::vector<uint64_t> ownerOfRemoteState;
+        std::vector<StateType> idOfRemoteState;
+        // For each process, the (serialized) states that are sent to it after the current level and the indices under which they are stored here.
+        std::vector<std::vector<uint64_t>> outgoingStates(numberOfRanks);
+        std::vector<std::vector<StateType>> outgoingRemoteIndices(numberOfRanks);
+
+        auto getOrAddOwnedStateIndex = [&](CompressedState const& state) {
+            StateType index = getOrAddStateIndex(state);
+            STORM_LOG_THROW(index < remoteFlag, storm::exceptions::NotSupportedException, "Too many states for a process.");
+            return index;
+        };
+        std::function<StateType(CompressedState const&)> stateToIdCallback = [&](CompressedState const& state) -> StateType {
+            uint64_t const owner = getOwner(state);
+            if (owner == rank) {
+                return getOrAddOwnedStateIndex(state);
+            }
+            StateType const newIndex = static_cast<StateType>(ownerOfRemoteState.size());
+            STORM_LOG_THROW(newIndex < remoteFlag, storm::exceptions::NotSupportedException, "Too many successors owned by other processes.");
+            StateType const index = remoteStateToIndex.findOrAdd(state, newIndex);
+            if (index == newIndex) {
+                ownerOfRemoteState.push_back(owner);
+                outgoingRemoteIndices[owner].push_back(index);
+                for (uint64_t bitIndex = 0; bitIndex < wordsPerState * 64; bitIndex += 64) {
+                    uint64_t const numberOfBits = bitIndex < bitsPerState ? std::min<uint64_t>(64, bitsPerState - bitIndex) : 0;
+                    outgoingStates[owner].push_back(numberOfBits > 0 ? state.getAsInt(bitIndex, numberOfBits) : 0);
+                }
+            }
+            return remoteFlag | index;
+        };
+
+        DistributedRowCollector<StateType> transitionMatrixBuilder;
+        std::vector<RewardModelBuilder<typename RewardModelType::ValueType>> rewardModelBuilders;
+        for (uint64_t i = 0; i < generator->getNumberOfRewardModels(); ++i) {
+            rewardModelBuilders.emplace_back(generator->getRewardModelInformation(i));
+        }
+        StateAndChoiceInformationBuilder stateAndChoiceInformationBuilder;
+        std::vector<StateType> const noPlaceholders;
+        StateType const noPlaceholderOffset = std::numeric_limits<StateType>::max();
+
+        // Every process creates all initial states, but only keeps the ones it owns.
+        for (auto const& initialState : generator->getInitialStates(stateToIdCallback)) {
+            if (initialState < remoteFlag) {
+                stateStorage.initialStateIndices.push_back(initialState);
+            }
+        }
+        STORM_LOG_THROW(communicator.allReduceOr(!stateStorage.initialStateIndices.empty()), storm::exceptions::WrongFormatException,
+                        "The model does not have a single initial state.");
+
+        uint_fast64_t currentRowGroup = 0;
+        uint_fast64_t currentRow = 0;
+        uint64_t numberOfLevels = 0;
+        std::vector<std::vector<uint64_t>> incomingStates(numberOfRanks);
+        std::vector<std::vector<uint64_t>> outgoingIds(numberOfRanks);
+        std::vector<std::vector<uint64_t>> incomingIds(numberOfRanks);
+        do {
+            // Expand the owned states that are known so far. As this also expands the states discovered in the meantime, a level of this search
+            // possibly covers several levels of a breadth-first search.
+            while (!statesToExplore.empty()) {
+                auto [currentState, currentIndex] = std::move(statesToExplore.front());
+                statesToExplore.pop_front();
+                generator->load(currentState);
+                auto behavior = generator->expand(stateToIdCallback);
+                addStateBehavior(currentState, currentIndex, behavior, currentRowGroup, currentRow, transitionMatrixBuilder, rewardModelBuilders,
+                                 stateAndChoiceInformationBuilder, noPlaceholderOffset, noPlaceholders);
+                generator->recycle(std::move(behavior));
+            }
+            ++numberOfLevels;
+
+            // Send the newly discovered successors to their owners, which add them to their states and reply with the ids of the states.
+            std::vector<uint64_t> outgoingCounts(numberOfRanks);
+            for (uint64_t peer = 0; peer < numberOfRanks; ++peer) {
+                outgoingCounts[peer] = outgoingStates[peer].size();
+            }
+            std::vector<uint64_t> incomingCounts = communicator.allToAll(outgoingCounts);
+            for (uint64_t peer = 0; peer < numberOfRanks; ++peer) {
+                incomingStates[peer].resize(incomingCounts[peer]);
+            }
+            communicator.exchange(outgoingStates, incomingStates);
+            for (uint64_t peer = 0; peer < numberOfRanks; ++peer) {
+                outgoingIds[peer].clear();
+                for (auto wordIt = incomingStates[peer].begin(); wordIt != incomingStates[peer].end(); wordIt += wordsPerState) {
+                    CompressedState receivedState(bitsPerState);
+                    for (uint64_t bitIndex = 0; bitIndex < bitsPerState; bitIndex += 64) {
+                        receivedState.setFromInt(bitIndex, std::min<uint64_t>(64, bitsPerState - bitIndex), *(wordIt + bitIndex / 64));
+                    }
+                    outgoingIds[peer].push_back(getOrAddOwnedStateIndex(receivedState));
+                }
+                incomingIds[peer].resize(outgoingRemoteIndices[peer].size());
+            }
+            communicator.exchange(outgoingIds, incomingIds);
+            idOfRemoteState.resize(ownerOfRemoteState.size());
+            for (uint64_t peer = 0; peer < numberOfRanks; ++peer) {
+                for (uint64_t position = 0; position < outgoingRemoteIndices[peer].size(); ++position) {
+                    idOfRemoteState[outgoingRemoteIndices[peer][position]] = static_cast<StateType>(incomingIds[peer][position]);
+                }
+                outgoingStates[peer].clear();
+                outgoingRemoteIndices[peer].clear();
+            }
+
+            // All processes have to abort together, as the others would wait for messages otherwise.
+            STORM_LOG_THROW(!communicator.allReduceOr(storm::utility::resources::isTerminate()), storm::exceptions::AbortException,
+                            "Aborted in distributed state space exploration.");
+        } while (communicator.allReduceOr(!statesToExplore.empty()));
+
+        // Number the states of all processes consecutively and translate the columns accordingly.
+        uint64_t const numberOfOwnedStates = stateStorage.getNumberOfStates();
+        std::vector<uint64_t> numberOfStatesOfRank = communicator.allToAll(std::vector<uint64_t>(numberOfRanks, numberOfOwnedStates));
+        std::vector<uint64_t> firstStateOfRank(numberOfRanks + 1, 0);
+        for (uint64_t peer = 0; peer < numberOfRanks; ++peer) {
+            firstStateOfRank[peer + 1] = firstStateOfRank[peer] + numberOfStatesOfRank[peer];
+        }
+        auto transitionMatrix = transitionMatrixBuilder.build(currentRow, firstStateOfRank.back(), !generator->isDeterministicModel(),
+                                                              [&](StateType const& column) -> uint64_t {
+                                                                  if (column & remoteFlag) {
+                                                                      StateType const index = column & ~remoteFlag;
+                                                                      return firstStateOfRank[ownerOfRemoteState[index]] + idOfRemoteState[index];
+                                                                  }
+                                                                  return firstStateOfRank[rank] + column;
+                                                              });
+
+        DistributedModelComponents result{modelType, std::move(firstStateOfRank), std::move(transitionMatrix), buildStateLabeling(), {}};
+        for (auto& rewardModelBuilder : rewardModelBuilders) {
+            result.rewardModels.emplace(rewardModelBuilder.getName(), rewardModelBuilder.build(currentRow, numberOfOwnedStates, numberOfOwnedStates));
+        }
+        phase.addCounter("levels", numberOfLevels);
+        phase.addCounter("remote-successors", ownerOfRemoteState.size());
+        STORM_LOG_INFO("Process " << rank << " explored " << numberOfOwnedStates << " of " << result.firstStateOfRank.back() << " states in "
+                                  << numberOfLevels << " levels.");
+        return result;
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Distributed state space exploration is only supported for doubles.");
+    }
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 storm::models::sparse::StateLabeling ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildStateLabeling() {
+    if (diskBackedStateStorage) {
+        // Label the states chunk by chunk. Within a chunk, the states are numbered consecutively, so the generator can label them as usual.
+        storm::models::sparse::StateLabeling result(diskBackedStateStorage->size());
+        diskBackedStateStorage->forEachChunk([&](std::vector<std::pair<CompressedState, StateType>> const& chunk) {
+            storm::storage::sparse::StateStorage<StateType> chunkStorage(stateStorage.bitsPerState);
+            std::vector<std::pair<StateType, StateType>> idToPosition;
+            idToPosition.reserve(chunk.size());
+            for (uint64_t position = 0; position < chunk.size(); ++position) {
+                chunkStorage.stateToId.findOrAdd(chunk[position].first, static_cast<StateType>(position));
+                idToPosition.emplace_back(chunk[position].second, static_cast<StateType>(position));
+            }
+            std::sort(idToPosition.begin(), idToPosition.end());
+            auto getPositions = [&idToPosition](std::vector<StateType> const& ids) {
+                std::vector<StateType> positions;
+                for (auto const& id : ids) {
+                    auto it = std::lower_bound(idToPosition.begin(), idToPosition.end(), std::make_pair(id, static_cast<StateType>(0)));
+                    if (it != idToPosition.end() && it->first == id) {
+                        positions.push_back(it->second);
+                    }
+                }
+                std::sort(positions.begin(), positions.end());
+                return positions;
+            };
+            auto chunkLabeling =
+                generator->label(chunkStorage, getPositions(stateStorage.initialStateIndices), getPositions(stateStorage.deadlockStateIndices),
+                                 getPositions(stateStorage.unexploredStateIndices));
+            for (auto const& label : chunkLabeling.getLabels()) {
+                if (!result.containsLabel(label)) {
+                    result.addLabel(label);
+                }
+                for (auto const& position : chunkLabeling.getStates(label)) {
+                    result.addLabelToState(label, chunk[position].second);
+                }
+            }
+        });
+        return result;
+    }
     return generator->label(stateStorage, stateStorage.initialStateIndices, stateStorage.deadlockStateIndices, stateStorage.unexploredStateIndices);
 }
 
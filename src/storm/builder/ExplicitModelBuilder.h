@@ -6,7 +6,10 @@
 #include <boost/variant.hpp>
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <memory>
+#include <queue>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -16,11 +19,14 @@
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/DiskBackedStateMap.h"
+#include "storm/storage/OutOfCoreMatrix.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/storage/sparse/StateStorage.h"
 
+#include "storm/utility/mpi.h"
 #include "storm/utility/prism.h"
 
 #include "storm/builder/ExplorationOrder.h"
@@ -82,6 +88,26 @@ class ExplicitModelBuilder {
 
         // If set, no further states will be explored once the given number is exceeded.
         std::optional<StateType> explorationStateLimit;
+
+        // If set, the probability-guided exploration stops once the estimated probability mass of the states that were found but not explored yet
+        // drops below this threshold. Like the states beyond the state limit, the remaining states are labeled as unexplored and get a self-loop, so
+        // that treating them as violating (satisfying) a reachability property yields a lower (upper) bound on its probability.
+        std::optional<double> explorationMassThreshold;
+
+        // The number of threads used for exploring the state space. If larger than one, the (breadth-first) exploration expands all states of
+        // the current level concurrently with separate generators. The resulting model coincides with the one obtained sequentially.
+        uint64_t numberOfThreads;
+
+        // If set, at most this number of states is kept in memory during the (breadth-first) exploration. The other states are moved to sorted
+        // files in the given directory (or the directory for temporary files if it is empty) and the successors of every level are looked up
+        // there at once.
+        std::optional<uint64_t> maximalNumberOfStatesInMemory;
+        std::string stateStorageDirectory;
+
+        // If set, states of DTMCs and MDPs that are neither initial nor labeled, have no rewards and a single choice with a single successor are not
+        // added to the model. Instead, their predecessors are directly connected to the first state of the chain that is not skipped. This preserves
+        // unbounded reachability probabilities and expected rewards, but not step-bounded properties.
+        bool compressChains;
     };
 
     /*!
@@ -118,6 +144,50 @@ class ExplicitModelBuilder {
      */
     std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> build();
 
+    /*!
+     * The components of a model whose transition matrix resides on disk.
+     */
+    struct OutOfCoreModelComponents {
+        storm::models::ModelType modelType;
+        storm::storage::OutOfCoreMatrix transitionMatrix;
+        storm::models::sparse::StateLabeling stateLabeling;
+        std::unordered_map<std::string, RewardModelType> rewardModels;
+    };
+
+    /*!
+     * Explores the model like build, but writes the rows of the transition matrix to the given file as they are explored instead of keeping the
+     * matrix in memory. Only the state storage, the labeling and the reward vectors remain in memory. This is only supported for DTMCs and MDPs
+     * over doubles that are explored in breadth-first order.
+     *
+     * @param matrixFilename The file to which the transition matrix is written (in the binary model format).
+     */
+    OutOfCoreModelComponents buildOutOfCore(std::string const& matrixFilename);
+
+    /*!
+     * The part of a model that is owned by one process of a distributed computation. The states of each process are numbered consecutively, so
+     * the global index of a state is the first index of its owner plus its index within the owner.
+     */
+    struct DistributedModelComponents {
+        storm::models::ModelType modelType;
+        // For every process, the global index of the first state it owns, followed by the total number of states.
+        std::vector<uint64_t> firstStateOfRank;
+        // The row groups of the owned states. The columns refer to the global state indices.
+        storm::storage::SparseMatrix<ValueType> transitionMatrix;
+        // The labeling and reward models of the owned states (and their choices).
+        storm::models::sparse::StateLabeling stateLabeling;
+        std::unordered_map<std::string, RewardModelType> rewardModels;
+    };
+
+    /*!
+     * Explores the model jointly with the other processes of the given communicator. Each process owns the states whose hash value maps to it
+     * and only expands these states. Successors owned by other processes are sent to their owners in one batch per breadth-first level. The
+     * model is never gathered at a single process. This is a collective operation and is only supported for DTMCs and MDPs over doubles.
+     *
+     * @param communicator The processes among which the states are distributed.
+     * @return The part of the model owned by this process, which can be passed to the distributed value iteration.
+     */
+    DistributedModelComponents buildDistributed(storm::utility::mpi::Communicator const& communicator = storm::utility::mpi::Communicator::world());
+
     /*!
      * Export a wrapper that contains (a copy of) the internal information that maps states to ids.
      * This wrapper can be helpful to find states in later stages.
@@ -126,6 +196,22 @@ class ExplicitModelBuilder {
     ExplicitStateLookup<StateType> exportExplicitStateLookup() const;
 
    private:
+    /*!
+     * The result of expanding a consecutive part of a breadth-first level with a separate generator.
+     */
+    struct ParallelExplorationChunk {
+        // The positions (within the level) of the first expanded state and the position one past the last expanded state.
+        uint64_t begin = 0;
+        uint64_t end = 0;
+
+        // The behaviors of the expanded states.
+        std::vector<storm::generator::StateBehavior<ValueType, StateType>> behaviors;
+
+        // The successors that were not known when the level was expanded in the order in which they were first encountered. Within the
+        // behaviors, they are referred to by the placeholder index (number of known states) + (position in this vector).
+        std::vector<CompressedState> newStates;
+    };
+
     /*!
      * Retrieves the state id of the given state. If the state has not been encountered yet, it will be added to
      * the lists of all states with a new id. If the state was already known, the object that is pointed to by
@@ -140,14 +226,69 @@ class ExplicitModelBuilder {
     /*!
      * Builds the transition matrix and the transition reward matrix based for the given program.
      *
-     * @param transitionMatrixBuilder The builder of the transition matrix.
+     * @param transitionMatrixBuilder The builder of the transition matrix (a SparseMatrixBuilder or, for breadth-first exploration, a
+     * ChunkedSparseMatrixBuilder or an OutOfCoreMatrixWriter).
      * @param rewardModelBuilders The builders for the selected reward models.
      * @param stateAndChoiceInformationBuilder The builder for the requested information of the individual states and choices
      */
-    void buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
-                       std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    template<typename MatrixBuilderType>
+    void buildMatrices(MatrixBuilderType& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
                        StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
 
+    /*!
+     * Retrieves whether the state space can be explored with multiple threads for the current options.
+     */
+    bool isParallelExplorationApplicable() const;
+
+    /*!
+     * Retrieves whether chains of states can be compressed during the exploration for the current options (see Options::compressChains).
+     */
+    bool isChainCompressionApplicable() const;
+
+    /*!
+     * Expands the given breadth-first level using the given generators (one per thread). No new states are inserted into the state storage.
+     *
+     * @param level The states of the level together with their ids.
+     * @param workerGenerators The generators to use. Each generator is used by exactly one thread.
+     * @return For each (used) generator, the expanded part of the level.
+     */
+    std::vector<ParallelExplorationChunk> expandLevelInParallel(
+        std::vector<std::pair<CompressedState, StateType>> const& level,
+        std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> const& workerGenerators) const;
+
+    /*!
+     * Adds the rows for the given (already expanded) state to the component builders.
+     *
+     * @param state The state.
+     * @param stateIndex The id of the state.
+     * @param behavior The behavior of the state.
+     * @param currentRowGroup The row group of the state. Is increased accordingly.
+     * @param currentRow The first row of the state. Is increased accordingly.
+     * @param placeholderOffset Successor ids that are at least this value are placeholders which are resolved using placeholderIndices.
+     * @param placeholderIndices The ids of the states referred to by the placeholders.
+     */
+    template<typename MatrixBuilderType>
+    void addStateBehavior(CompressedState const& state, StateType const& stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+                          uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow, MatrixBuilderType& transitionMatrixBuilder,
+                          std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                          StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder, StateType const& placeholderOffset,
+                          std::vector<StateType> const& placeholderIndices);
+
+    /*!
+     * Adds the rows of the given (already expanded) state to the given matrix builder. This does not touch any other data of this builder, so
+     * different states can be added concurrently if the matrix builder permits it.
+     *
+     * @param stateIndex The id of the state.
+     * @param behavior The behavior of the state. If it is empty, the state obtains a self-loop.
+     * @param row The first row of the state.
+     * @param placeholderOffset Successor ids that are at least this value are placeholders which are resolved using placeholderIndices.
+     * @param placeholderIndices The ids of the states referred to by the placeholders.
+     * @return The row after the last row of the state.
+     */
+    template<typename MatrixBuilderType>
+    uint_fast64_t addTransitions(StateType const& stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, uint_fast64_t row,
+                        MatrixBuilderType& transitionMatrixBuilder, StateType const& placeholderOffset, std::vector<StateType> const& placeholderIndices) const;
+
     /*!
      * Explores the state space of the given program and returns the components of the model as a result.
      *
@@ -165,18 +306,33 @@ class ExplicitModelBuilder {
     /// The generator to use for the building process.
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
 
+    /// If set, this creates additional generators that behave like the one above (used for parallel exploration).
+    std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> generatorFactory;
+
     /// The options to be used for the building process.
     Options options;
 
     /// Internal information about the states that were explored.
     storm::storage::sparse::StateStorage<StateType> stateStorage;
 
+    /// If only a bounded number of states is to be kept in memory, this replaces the mapping of states to ids of the state storage.
+    std::unique_ptr<storm::storage::DiskBackedStateMap<StateType>> diskBackedStateStorage;
+
     /// A set of states that still need to be explored.
     std::deque<std::pair<CompressedState, StateType>> statesToExplore;
 
     /// An optional mapping from state indices to the row groups in which they actually reside. This needs to be
     /// built in case the exploration order is not BFS.
     boost::optional<std::vector<uint_fast64_t>> stateRemapping;
+
+    /// For the probability-guided exploration, the states that were found but not explored yet together with their estimated probability mass.
+    std::unordered_map<StateType, std::pair<CompressedState, double>> frontier;
+
+    /// For the probability-guided exploration, the ids of the states of the frontier ordered by their (possibly outdated) estimated probability mass.
+    std::priority_queue<std::pair<double, StateType>> prioritizedStates;
+
+    /// The sum of the estimated probability masses of the states of the frontier.
+    double frontierMass = 0.0;
 };
 
 }  // namespace builder
@@ -6,8 +6,9 @@
 namespace storm {
 namespace builder {
 
-// An enum that contains all currently supported exploration orders.
-enum class ExplorationOrder { Dfs, Bfs };
+// An enum that contains all currently supported exploration orders. The probability-guided order explores the states in the order of their
+// estimated probability mass, i.e., the probability with which they are reached from the initial states via the states explored so far.
+enum class ExplorationOrder { Dfs, Bfs, Probability };
 
 std::ostream& operator<<(std::ostream& out, ExplorationOrder const& order);
 
@@ -0,0 +1,107 @@
+#include "storm/builder/ModelSizeEstimation.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "storm/exceptions/BaseException.h"
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/traverser/InformationCollector.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+std::optional<ModelSizeEstimate> estimateModelSize(storm::jani::Model const& model, uint64_t maximalNumberOfStates) {
+    storm::jani::Model restrictedModel = model;
+    if (!restrictedModel.restrictToFeatures(storm::generator::JaniNextStateGenerator<double>::getSupportedJaniFeatures()).empty()) {
+        STORM_LOG_INFO("Skipping the estimation of the model size as the model uses features that are not supported by the explicit generator.");
+        return std::nullopt;
+    }
+
+    try {
+        storm::generator::JaniNextStateGenerator<double, uint32_t> generator(restrictedModel);
+        storm::storage::BitVectorHashMap<uint32_t> stateToId(generator.getStateSize(), std::min<uint64_t>(maximalNumberOfStates, 100000));
+        std::vector<storm::generator::CompressedState> currentLevel;
+        std::vector<storm::generator::CompressedState> nextLevel;
+        auto stateToIdCallback = [&stateToId, &nextLevel](storm::generator::CompressedState const& state) {
+            uint32_t newIndex = static_cast<uint32_t>(stateToId.size());
+            uint32_t index = stateToId.findOrAdd(state, newIndex);
+            if (index == newIndex) {
+                nextLevel.push_back(state);
+            }
+            return index;
+        };
+        generator.getInitialStates(stateToIdCallback);
+
+        uint64_t numberOfExpandedStates = 0;
+        uint64_t numberOfChoices = 0;
+        uint64_t numberOfTransitions = 0;
+        uint64_t numberOfLevels = 0;
+        uint64_t expandedStatesOfLastLevel = 0;
+        while (!nextLevel.empty() && stateToId.size() < maximalNumberOfStates) {
+            std::swap(currentLevel, nextLevel);
+            nextLevel.clear();
+            ++numberOfLevels;
+            expandedStatesOfLastLevel = 0;
+            for (auto const& state : currentLevel) {
+                if (stateToId.size() >= maximalNumberOfStates) {
+                    break;
+                }
+                generator.load(state);
+                auto behavior = generator.expand(stateToIdCallback);
+                // Deadlock states get a selfloop in the sparse model.
+                numberOfChoices += std::max<uint64_t>(1, behavior.getNumberOfChoices());
+                numberOfTransitions += behavior.empty() ? 1 : 0;
+                for (auto const& choice : behavior) {
+                    numberOfTransitions += choice.size();
+                }
+                generator.recycle(std::move(behavior));
+                ++expandedStatesOfLastLevel;
+            }
+            numberOfExpandedStates += expandedStatesOfLastLevel;
+        }
+
+        ModelSizeEstimate result;
+        result.bitsPerState = generator.getStateSize();
+        result.exact = nextLevel.empty() && expandedStatesOfLastLevel == currentLevel.size();
+        result.numberOfStates = stateToId.size();
+        if (!result.exact && expandedStatesOfLastLevel > 0) {
+            // Extrapolate the size of the next level as if the last level had been expanded completely.
+            double const lastLevelSize = static_cast<double>(currentLevel.size());
+            double const nextLevelSize = static_cast<double>(nextLevel.size()) * lastLevelSize / static_cast<double>(expandedStatesOfLastLevel);
+            double const ratio = nextLevelSize / lastLevelSize;
+            double remainingStates;
+            if (ratio < 1.0) {
+                remainingStates = nextLevelSize / (1.0 - ratio);
+            } else {
+                remainingStates = nextLevelSize * static_cast<double>(numberOfLevels);
+            }
+            double estimate = static_cast<double>(numberOfExpandedStates - expandedStatesOfLastLevel) + lastLevelSize + remainingStates;
+            uint64_t const stateDomainSize = model.getModelInformation().stateDomainSize;
+            if (stateDomainSize > 0) {
+                estimate = std::min(estimate, static_cast<double>(stateDomainSize));
+            }
+            result.numberOfStates = std::max(result.numberOfStates, static_cast<uint64_t>(estimate));
+        }
+        if (numberOfExpandedStates == 0) {
+            result.numberOfChoices = result.numberOfStates;
+            result.numberOfTransitions = result.numberOfStates;
+        } else {
+            double const scale = static_cast<double>(result.numberOfStates) / static_cast<double>(numberOfExpandedStates);
+            result.numberOfChoices = static_cast<uint64_t>(static_cast<double>(numberOfChoices) * scale);
+            result.numberOfTransitions = static_cast<uint64_t>(static_cast<double>(numberOfTransitions) * scale);
+        }
+        STORM_LOG_INFO("Estimated " << (result.exact ? "" : "approx. ") << result.numberOfStates << " states, " << result.numberOfChoices << " choices and "
+                                    << result.numberOfTransitions << " transitions after exploring " << stateToId.size() << " states in "
+                                    << numberOfLevels << " levels.");
+        return result;
+    } catch (storm::exceptions::BaseException const& e) {
+        STORM_LOG_INFO("Skipping the estimation of the model size as the exploration failed: " << e.what());
+        return std::nullopt;
+    }
+}
+
+}  // namespace builder
+}  // namespace storm
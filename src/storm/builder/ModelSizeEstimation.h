@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+namespace storm {
+namespace jani {
+class Model;
+}
+
+namespace builder {
+
+/*!
+ * An estimate of the size of the sparse representation of a model.
+ */
+struct ModelSizeEstimate {
+    uint64_t numberOfStates;
+    uint64_t numberOfChoices;
+    uint64_t numberOfTransitions;
+    // The number of bits with which the explicit builder stores a state.
+    uint64_t bitsPerState;
+    // Whether the model was explored completely, i.e., the numbers are exact.
+    bool exact;
+};
+
+/*!
+ * Cheaply estimates the size of the given model by a breadth-first exploration that stops after discovering the given number of states. If the exploration
+ * stops early, the number of states is extrapolated from the growth of the last level: If the levels shrink, the remaining levels are assumed to shrink
+ * geometrically. Otherwise, the levels are assumed to keep their size for as many levels as were explored so far. The extrapolation is capped at the size
+ * of the state domain. The numbers of choices and transitions are extrapolated from the averages over the expanded states.
+ *
+ * @return The estimate or nothing if the model can not be explored by the explicit generator (e.g. due to unsupported features).
+ */
+std::optional<ModelSizeEstimate> estimateModelSize(storm::jani::Model const& model, uint64_t maximalNumberOfStates);
+
+}  // namespace builder
+}  // namespace storm
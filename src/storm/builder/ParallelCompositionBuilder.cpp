@@ -1,164 +1,255 @@
 #include "storm/builder/ParallelCompositionBuilder.h"
+
+#include <algorithm>
+#include <numeric>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/storage/BitVectorHashMap.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
 
 namespace storm {
 namespace builder {
 
+namespace {
+
+uint64_t getNumberOfCompositionThreads(bool threadSafeValueType, uint64_t numberOfStates) {
+    // Copying and adding rational functions is not thread-safe.
+    if (!threadSafeValueType || !storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+        return 1;
+    }
+    return std::min<uint64_t>(storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads(),
+                              std::max<uint64_t>(1, numberOfStates / 50000));
+}
+
+/*
+ * Advances the given tuple to the lexicographically next one where each position ranges over the given number of values.
+ * Returns false iff the given tuple was the last one.
+ */
+bool nextTuple(std::vector<uint64_t>& tuple, std::vector<uint64_t> const& numberOfValues) {
+    for (uint64_t position = tuple.size(); position > 0; --position) {
+        if (++tuple[position - 1] < numberOfValues[position - 1]) {
+            return true;
+        }
+        tuple[position - 1] = 0;
+    }
+    return false;
+}
+
+}  // namespace
+
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ParallelCompositionBuilder<ValueType>::compose(
     std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmcA, std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmcB, bool labelAnd) {
-    STORM_LOG_TRACE("Parallel composition");
-
-    storm::storage::SparseMatrix<ValueType> matrixA = ctmcA->getTransitionMatrix();
-    storm::storage::SparseMatrix<ValueType> matrixB = ctmcB->getTransitionMatrix();
-    storm::models::sparse::StateLabeling labelingA = ctmcA->getStateLabeling();
-    storm::models::sparse::StateLabeling labelingB = ctmcB->getStateLabeling();
-    size_t sizeA = ctmcA->getNumberOfStates();
-    size_t sizeB = ctmcB->getNumberOfStates();
-    size_t size = sizeA * sizeB;
-    size_t rowIndex = 0;
-
-    // Build matrix
-    storm::storage::SparseMatrixBuilder<ValueType> builder(size, size, 0, true, false, 0);
-
-    for (size_t stateA = 0; stateA < sizeA; ++stateA) {
-        for (size_t stateB = 0; stateB < sizeB; ++stateB) {
-            STORM_LOG_ASSERT(rowIndex == stateA * sizeB + stateB, "Row " << rowIndex << " is not correct");
-
-            auto rowA = matrixA.getRow(stateA);
-            auto itA = rowA.begin();
-            auto rowB = matrixB.getRow(stateB);
-            auto itB = rowB.begin();
-
-            // First consider all target states of A < the current stateA
-            while (itA != rowA.end() && itA->getColumn() < stateA) {
-                builder.addNextValue(rowIndex, itA->getColumn() * sizeB + stateB, itA->getValue());
-                ++itA;
-            }
+    return compose({ctmcA, ctmcB}, labelAnd, false);
+}
 
-            // Then consider all target states of B
-            while (itB != rowB.end()) {
-                builder.addNextValue(rowIndex, stateA * sizeB + itB->getColumn(), itB->getValue());
-                ++itB;
-            }
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ParallelCompositionBuilder<ValueType>::compose(
+    std::vector<std::shared_ptr<storm::models::sparse::Ctmc<ValueType>>> const& ctmcs, bool labelAnd, bool restrictToReachableStates) {
+    typedef typename storm::storage::SparseMatrix<ValueType>::index_type IndexType;
+    STORM_LOG_THROW(!ctmcs.empty(), storm::exceptions::InvalidArgumentException, "Cannot compose an empty set of CTMCs.");
+    STORM_LOG_TRACE("Parallel composition of " << ctmcs.size() << " CTMCs");
+    uint64_t const numberOfComponents = ctmcs.size();
 
-            // Last consider all remaining target states of A > the current stateA
-            while (itA != rowA.end()) {
-                builder.addNextValue(rowIndex, itA->getColumn() * sizeB + stateB, itA->getValue());
-                ++itA;
-            }
+    std::vector<uint64_t> componentSizes;
+    for (auto const& ctmc : ctmcs) {
+        STORM_LOG_THROW(ctmc->getNumberOfStates() > 0, storm::exceptions::InvalidArgumentException, "Cannot compose a CTMC without states.");
+        componentSizes.push_back(ctmc->getNumberOfStates());
+    }
 
-            ++rowIndex;
+    // The composed states are stored as consecutive tuples of component states.
+    std::vector<uint64_t> composedStates;
+
+    // If all tuples are built, the index of a tuple is given by its lexicographic position. Otherwise, the tuples are encoded as bit vectors (with a
+    // fixed number of bits per component) that are mapped to their index.
+    std::vector<uint64_t> strides(numberOfComponents, 1);
+    std::vector<uint64_t> bitOffsets(numberOfComponents + 1, 0);
+    for (uint64_t component = numberOfComponents - 1; component > 0; --component) {
+        strides[component - 1] = strides[component] * componentSizes[component];
+    }
+    for (uint64_t component = 0; component < numberOfComponents; ++component) {
+        uint64_t numberOfBits = 1;
+        while (numberOfBits < 64 && (1ull << numberOfBits) < componentSizes[component]) {
+            ++numberOfBits;
         }
+        bitOffsets[component + 1] = bitOffsets[component] + numberOfBits;
     }
+    uint64_t const bucketSize = ((bitOffsets.back() + 63) / 64) * 64;
+    storm::storage::BitVectorHashMap<uint64_t> tupleToIndex(bucketSize, restrictToReachableStates ? 1000 : 1);
+    auto encodeTuple = [&](uint64_t const* tuple, storm::storage::BitVector& key) {
+        for (uint64_t component = 0; component < numberOfComponents; ++component) {
+            key.setFromInt(bitOffsets[component], bitOffsets[component + 1] - bitOffsets[component], tuple[component]);
+        }
+    };
 
-    storm::storage::SparseMatrix<ValueType> matrixComposed = builder.build();
-    STORM_LOG_ASSERT(matrixComposed.getRowCount() == size, "Row count is not correct");
-    STORM_LOG_ASSERT(matrixComposed.getColumnCount() == size, "Column count is not correct");
+    if (restrictToReachableStates) {
+        // Explore the composed states that are reachable from the initial ones in a breadth-first manner.
+        std::vector<std::vector<uint64_t>> initialStates;
+        std::vector<uint64_t> numberOfInitialStates;
+        for (auto const& ctmc : ctmcs) {
+            initialStates.emplace_back(ctmc->getInitialStates().begin(), ctmc->getInitialStates().end());
+            numberOfInitialStates.push_back(initialStates.back().size());
+        }
+        storm::storage::BitVector key(bucketSize);
+        std::vector<uint64_t> tuple(numberOfComponents);
+        auto addTuple = [&]() {
+            encodeTuple(tuple.data(), key);
+            uint64_t const numberOfStates = composedStates.size() / numberOfComponents;
+            if (tupleToIndex.findOrAdd(key, numberOfStates) == numberOfStates) {
+                composedStates.insert(composedStates.end(), tuple.begin(), tuple.end());
+            }
+        };
 
-    // Build labeling
-    storm::models::sparse::StateLabeling labeling = storm::models::sparse::StateLabeling(sizeA * sizeB);
+        if (std::find(numberOfInitialStates.begin(), numberOfInitialStates.end(), 0ull) == numberOfInitialStates.end()) {
+            std::vector<uint64_t> initialTuple(numberOfComponents, 0);
+            do {
+                for (uint64_t component = 0; component < numberOfComponents; ++component) {
+                    tuple[component] = initialStates[component][initialTuple[component]];
+                }
+                addTuple();
+            } while (nextTuple(initialTuple, numberOfInitialStates));
+        }
 
-    if (labelAnd) {
-        for (std::string const& label : labelingA.getLabels()) {
-            if (labelingB.containsLabel(label)) {
-                // Only consider labels contained in both CTMCs
-                storm::storage::BitVector labelStates(size, false);
-                for (auto entryA : labelingA.getStates(label)) {
-                    for (auto entryB : labelingB.getStates(label)) {
-                        labelStates.set(entryA * sizeB + entryB);
+        for (uint64_t currentState = 0; currentState * numberOfComponents < composedStates.size(); ++currentState) {
+            for (uint64_t component = 0; component < numberOfComponents; ++component) {
+                std::copy_n(composedStates.begin() + currentState * numberOfComponents, numberOfComponents, tuple.begin());
+                uint64_t localState = tuple[component];
+                for (auto const& entry : ctmcs[component]->getTransitionMatrix().getRow(localState)) {
+                    if (entry.getColumn() != localState) {
+                        tuple[component] = entry.getColumn();
+                        addTuple();
                     }
                 }
-                labeling.addLabel(label, labelStates);
             }
         }
     } else {
-        // Set labels from A
-        for (std::string const& label : labelingA.getLabels()) {
-            if (label == "init") {
-                // Initial states must be initial in both CTMCs
-                STORM_LOG_ASSERT(labelingB.containsLabel(label), "B does not have init.");
-                storm::storage::BitVector labelStates(size, false);
-                for (auto entryA : labelingA.getStates(label)) {
-                    for (auto entryB : labelingB.getStates(label)) {
-                        labelStates.set(entryA * sizeB + entryB);
-                    }
-                }
-                labeling.addLabel(label, labelStates);
-            } else {
-                storm::storage::BitVector labelStates(size, false);
-                for (auto entry : labelingA.getStates(label)) {
-                    for (size_t index = entry * sizeB; index < entry * sizeB + sizeB; ++index) {
-                        labelStates.set(index, true);
+        std::vector<uint64_t> tuple(numberOfComponents, 0);
+        composedStates.reserve(strides.front() * componentSizes.front() * numberOfComponents);
+        do {
+            composedStates.insert(composedStates.end(), tuple.begin(), tuple.end());
+        } while (nextTuple(tuple, componentSizes));
+    }
+    uint64_t const numberOfStates = composedStates.size() / numberOfComponents;
+    STORM_LOG_DEBUG("Composition has " << numberOfStates << " states.");
+
+    // Build the matrix. The entry counts and the entries of the rows are computed in parallel and directly yield the data of the resulting matrix.
+    uint64_t const numberOfThreads = getNumberOfCompositionThreads(!std::is_same<ValueType, storm::RationalFunction>::value, numberOfStates);
+    std::vector<IndexType> rowIndications(numberOfStates + 1, 0);
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), numberOfStates, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t state = begin; state < end; ++state) {
+            IndexType entryCount = 0;
+            bool hasSelfloop = false;
+            for (uint64_t component = 0; component < numberOfComponents; ++component) {
+                uint64_t localState = composedStates[state * numberOfComponents + component];
+                for (auto const& entry : ctmcs[component]->getTransitionMatrix().getRow(localState)) {
+                    if (entry.getColumn() == localState) {
+                        hasSelfloop = true;
+                    } else {
+                        ++entryCount;
                     }
                 }
-                labeling.addLabel(label, labelStates);
             }
+            rowIndications[state + 1] = hasSelfloop ? entryCount + 1 : entryCount;
         }
-        // Set labels from B
-        for (std::string const& label : labelingB.getLabels()) {
-            if (label == "init") {
-                continue;
-            }
-            if (labeling.containsLabel(label)) {
-                // Label is already there from A
-                for (auto entry : labelingB.getStates(label)) {
-                    for (size_t index = 0; index < sizeA; ++index) {
-                        labeling.addLabelToState(label, index * sizeB + entry);
+    });
+    std::partial_sum(rowIndications.begin(), rowIndications.end(), rowIndications.begin());
+
+    std::vector<storm::storage::MatrixEntry<IndexType, ValueType>> columnsAndValues(rowIndications.back());
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), numberOfStates, [&](uint64_t, uint64_t begin, uint64_t end) {
+        storm::storage::BitVector key(bucketSize);
+        std::vector<uint64_t> tuple(numberOfComponents);
+        for (uint64_t state = begin; state < end; ++state) {
+            auto entryIt = columnsAndValues.begin() + rowIndications[state];
+            bool hasSelfloop = false;
+            ValueType selfloopValue = storm::utility::zero<ValueType>();
+            for (uint64_t component = 0; component < numberOfComponents; ++component) {
+                std::copy_n(composedStates.begin() + state * numberOfComponents, numberOfComponents, tuple.begin());
+                uint64_t localState = tuple[component];
+                for (auto const& entry : ctmcs[component]->getTransitionMatrix().getRow(localState)) {
+                    if (entry.getColumn() == localState) {
+                        hasSelfloop = true;
+                        selfloopValue += entry.getValue();
+                        continue;
                     }
-                }
-            } else {
-                storm::storage::BitVector labelStates(size, false);
-                for (auto entry : labelingB.getStates(label)) {
-                    for (size_t index = 0; index < sizeA; ++index) {
-                        labelStates.set(index * sizeB + entry, true);
+                    uint64_t successor;
+                    if (restrictToReachableStates) {
+                        tuple[component] = entry.getColumn();
+                        encodeTuple(tuple.data(), key);
+                        successor = tupleToIndex.getValue(key);
+                    } else {
+                        successor = state + (entry.getColumn() - localState) * strides[component];
                     }
+                    *entryIt = storm::storage::MatrixEntry<IndexType, ValueType>(successor, entry.getValue());
+                    ++entryIt;
                 }
-                labeling.addLabel(label, labelStates);
             }
+            if (hasSelfloop) {
+                *entryIt = storm::storage::MatrixEntry<IndexType, ValueType>(state, std::move(selfloopValue));
+                ++entryIt;
+            }
+            STORM_LOG_ASSERT(entryIt == columnsAndValues.begin() + rowIndications[state + 1], "Unexpected number of entries in row " << state << ".");
+            std::sort(columnsAndValues.begin() + rowIndications[state], entryIt,
+                      [](auto const& first, auto const& second) { return first.getColumn() < second.getColumn(); });
         }
-    }
+    });
+    storm::storage::SparseMatrix<ValueType> matrixComposed(numberOfStates, std::move(rowIndications), std::move(columnsAndValues), boost::none);
 
-    // Build CTMC
-    std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> composedCtmc = std::make_shared<storm::models::sparse::Ctmc<ValueType>>(matrixComposed, labeling);
-
-    // Print for debugging
-    /*std::cout << "Matrix A:\n";
-    std::cout << matrixA << '\n';
-    std::cout << "Matrix B:\n";
-    std::cout << matrixB << '\n';
-    std::cout << "Composed matrix: \n" << matrixComposed;
-    std::cout << "Labeling A\n";
-    labelingA.printLabelingInformationToStream(std::cout);
-    for (size_t stateA = 0; stateA < sizeA; ++stateA) {
-        std::cout << "State " << stateA << ": ";
-        for (auto label : labelingA.getLabelsOfState(stateA)) {
-            std::cout << label << ", ";
-        }
-        std::cout << '\n';
+    // Build labeling
+    std::vector<std::string> labels;
+    for (std::string const& label : ctmcs.front()->getStateLabeling().getLabels()) {
+        labels.push_back(label);
     }
-    std::cout << "Labeling B\n";
-    labelingB.printLabelingInformationToStream(std::cout);
-    for (size_t stateB = 0; stateB < sizeB; ++stateB) {
-        std::cout << "State " << stateB << ": ";
-        for (auto label : labelingB.getLabelsOfState(stateB)) {
-            std::cout << label << ", ";
+    if (labelAnd) {
+        // Only consider labels contained in all CTMCs
+        labels.erase(std::remove_if(labels.begin(), labels.end(),
+                                    [&ctmcs](std::string const& label) {
+                                        return std::any_of(ctmcs.begin(), ctmcs.end(),
+                                                           [&label](auto const& ctmc) { return !ctmc->getStateLabeling().containsLabel(label); });
+                                    }),
+                     labels.end());
+    } else {
+        for (auto const& ctmc : ctmcs) {
+            for (std::string const& label : ctmc->getStateLabeling().getLabels()) {
+                if (std::find(labels.begin(), labels.end(), label) == labels.end()) {
+                    labels.push_back(label);
+                }
+            }
         }
-        std::cout << '\n';
     }
-    std::cout << "Labeling Composed\n";
-    labeling.printLabelingInformationToStream(std::cout);
-    for (size_t state = 0; state < size; ++state) {
-        std::cout << "State " << state << ": ";
-        for (auto label : labeling.getLabelsOfState(state)) {
-            std::cout << label << ", ";
+
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    for (std::string const& label : labels) {
+        // Initial states must be initial in all CTMCs
+        bool const holdsInAll = labelAnd || label == "init";
+        std::vector<storm::storage::BitVector const*> componentStates;
+        for (auto const& ctmc : ctmcs) {
+            STORM_LOG_ASSERT(label != "init" || ctmc->getStateLabeling().containsLabel(label), "CTMC does not have init.");
+            componentStates.push_back(ctmc->getStateLabeling().containsLabel(label) ? &ctmc->getStateLabeling().getStates(label) : nullptr);
+        }
+        storm::storage::BitVector labelStates(numberOfStates, false);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            bool holds = holdsInAll;
+            for (uint64_t component = 0; component < numberOfComponents; ++component) {
+                bool holdsInComponent = componentStates[component] && componentStates[component]->get(composedStates[state * numberOfComponents + component]);
+                if (holdsInComponent != holdsInAll) {
+                    holds = holdsInComponent;
+                    break;
+                }
+            }
+            labelStates.set(state, holds);
         }
-        std::cout << '\n';
-    }*/
+        labeling.addLabel(label, std::move(labelStates));
+    }
 
-    return composedCtmc;
+    // Build CTMC
+    return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(std::move(matrixComposed), std::move(labeling));
 }
 
 // Explicitly instantiate the class.
@@ -1,6 +1,9 @@
 #ifndef PARALLELCOMPOSITIONBUILDER_H
 #define PARALLELCOMPOSITIONBUILDER_H
 
+#include <memory>
+#include <vector>
+
 #include "storm/models/sparse/Ctmc.h"
 
 namespace storm {
@@ -12,8 +15,26 @@ namespace builder {
 template<typename ValueType>
 class ParallelCompositionBuilder {
    public:
+    /*!
+     * Builds the full (interleaving) parallel composition of the two given CTMCs. The composed state (stateA, stateB) has index stateA * sizeB + stateB.
+     *
+     * @param labelAnd If true, a label holds in a composed state iff it holds in both component states. Otherwise, it holds iff it holds in either of them.
+     */
     static std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> compose(std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmcA,
                                                                            std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmcB, bool labelAnd);
+
+    /*!
+     * Builds the (interleaving) parallel composition of the given CTMCs. The composed states are the tuples of component states. In every composed state,
+     * each transition of a component moves this component while all other components keep their state. Selfloops of several components are merged.
+     *
+     * @param ctmcs The components, which must not be empty.
+     * @param labelAnd If true, a label holds in a composed state iff it holds in all component states (so only labels of all components are kept).
+     *        Otherwise, it holds iff it holds in any of them. In both cases, a composed state is initial iff all of its component states are initial.
+     * @param restrictToReachableStates If true, only the composed states that are reachable from the initial composed states are built (in the order
+     *        of a breadth-first search). Otherwise, all tuples are built and numbered lexicographically.
+     */
+    static std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> compose(std::vector<std::shared_ptr<storm::models::sparse::Ctmc<ValueType>>> const& ctmcs,
+                                                                           bool labelAnd, bool restrictToReachableStates = true);
 };
 
 }  // namespace builder
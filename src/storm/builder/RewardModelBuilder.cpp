@@ -34,7 +34,10 @@ storm::models::sparse::StandardRewardModel<ValueType> RewardModelBuilder<ValueTy
         optionalStateActionRewardVector = std::move(stateActionRewardVector);
     }
 
-    return storm::models::sparse::StandardRewardModel<ValueType>(std::move(optionalStateRewardVector), std::move(optionalStateActionRewardVector));
+    storm::models::sparse::StandardRewardModel<ValueType> result(std::move(optionalStateRewardVector), std::move(optionalStateActionRewardVector));
+    // Reward structures often assign the same reward to (almost) all choices, in which case there is no need to store one value per choice.
+    result.compress();
+    return result;
 }
 
 template<typename ValueType>
@@ -1,6 +1,10 @@
 #include "storm/builder/StateAndChoiceInformationBuilder.h"
 
+#include <limits>
+
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/UnexpectedException.h"
+#include "storm/utility/macros.h"
 
 namespace storm {
 namespace builder {
@@ -18,18 +22,46 @@ bool StateAndChoiceInformationBuilder::isBuildChoiceLabels() const {
     return _buildChoiceLabels;
 }
 
-void StateAndChoiceInformationBuilder::addChoiceLabel(std::string const& label, uint_fast64_t choiceIndex) {
+void StateAndChoiceInformationBuilder::addChoiceLabels(std::set<std::string> const& labels, uint_fast64_t choiceIndex) {
     STORM_LOG_ASSERT(_buildChoiceLabels, "Building ChoiceLabels was not enabled.");
-    storm::storage::BitVector& labeledChoices = _choiceLabels[label];
-    labeledChoices.grow(choiceIndex + 1, false);
-    labeledChoices.set(choiceIndex, true);
+    STORM_LOG_ASSERT(_choiceLabelSetIdentifiers.size() <= choiceIndex,
+                     "Unexpected choice index. Apparently, the choice indices are provided in an incorrect order.");
+    if (labels.empty()) {
+        return;
+    }
+    if (_labelSetToIdentifier.empty()) {
+        // The empty set of labels always has identifier 0.
+        _labelSetToIdentifier.emplace(std::set<std::string>(), 0);
+    }
+    auto insertionRes = _labelSetToIdentifier.emplace(labels, static_cast<uint32_t>(_labelSetToIdentifier.size()));
+    _choiceLabelSetIdentifiers.resize(choiceIndex, 0);
+    _choiceLabelSetIdentifiers.push_back(insertionRes.first->second);
 }
 
 storm::models::sparse::ChoiceLabeling StateAndChoiceInformationBuilder::buildChoiceLabeling(uint_fast64_t totalNumberOfChoices) {
+    // Translate the label sets to the labels they contain.
+    std::vector<std::vector<uint64_t>> labelSetToLabelIndices(_labelSetToIdentifier.size());
+    std::map<std::string, uint64_t> labelToIndex;
+    for (auto const& labelSetIdentifierPair : _labelSetToIdentifier) {
+        for (auto const& label : labelSetIdentifierPair.first) {
+            auto labelIndex = labelToIndex.emplace(label, labelToIndex.size()).first->second;
+            labelSetToLabelIndices[labelSetIdentifierPair.second].push_back(labelIndex);
+        }
+    }
+
+    std::vector<storm::storage::BitVector> labelings(labelToIndex.size(), storm::storage::BitVector(totalNumberOfChoices, false));
+    for (uint_fast64_t choice = 0; choice < _choiceLabelSetIdentifiers.size(); ++choice) {
+        for (auto const& labelIndex : labelSetToLabelIndices[_choiceLabelSetIdentifiers[choice]]) {
+            labelings[labelIndex].set(choice, true);
+        }
+    }
+    _choiceLabelSetIdentifiers.clear();
+    _choiceLabelSetIdentifiers.shrink_to_fit();
+    _labelSetToIdentifier.clear();
+
     storm::models::sparse::ChoiceLabeling result(totalNumberOfChoices);
-    for (auto& label : _choiceLabels) {
-        label.second.resize(totalNumberOfChoices, false);
-        result.addLabel(label.first, std::move(label.second));
+    for (auto const& labelIndexPair : labelToIndex) {
+        result.addLabel(labelIndexPair.first, std::move(labelings[labelIndexPair.second]));
     }
     return result;
 }
@@ -44,18 +76,47 @@ bool StateAndChoiceInformationBuilder::isBuildChoiceOrigins() const {
 
 void StateAndChoiceInformationBuilder::addChoiceOriginData(boost::any const& originData, uint_fast64_t choiceIndex) {
     STORM_LOG_ASSERT(_buildChoiceOrigins, "Building ChoiceOrigins was not enabled.");
-    STORM_LOG_ASSERT(_dataOfChoiceOrigins.size() <= choiceIndex, "Unexpected choice index. Apparently, the choice indices are provided in an incorrect order.");
-    if (_dataOfChoiceOrigins.size() != choiceIndex) {
-        _dataOfChoiceOrigins.resize(choiceIndex);
+    STORM_LOG_ASSERT(_choiceOriginIdentifiers.size() <= choiceIndex,
+                     "Unexpected choice index. Apparently, the choice indices are provided in an incorrect order.");
+    if (_dataOfChoiceOriginIdentifiers.empty()) {
+        // Identifier 0 refers to the choices without origin data.
+        _dataOfChoiceOriginIdentifiers.emplace_back();
+        _indexSetToChoiceOriginIdentifier.emplace(storm::storage::FlatSet<uint_fast64_t>(), 0);
     }
-    _dataOfChoiceOrigins.push_back(originData);
+    uint32_t identifier;
+    if (auto indexSet = boost::any_cast<storm::storage::FlatSet<uint_fast64_t>>(&originData)) {
+        auto insertionRes = _indexSetToChoiceOriginIdentifier.emplace(*indexSet, static_cast<uint32_t>(_dataOfChoiceOriginIdentifiers.size()));
+        identifier = insertionRes.first->second;
+        if (insertionRes.second) {
+            _dataOfChoiceOriginIdentifiers.push_back(originData);
+        }
+    } else if (originData.empty()) {
+        identifier = 0;
+    } else {
+        // Other kinds of origin data can not be compared, so they are kept for every choice.
+        identifier = static_cast<uint32_t>(_dataOfChoiceOriginIdentifiers.size());
+        _dataOfChoiceOriginIdentifiers.push_back(originData);
+    }
+    STORM_LOG_THROW(_dataOfChoiceOriginIdentifiers.size() <= std::numeric_limits<uint32_t>::max(), storm::exceptions::UnexpectedException,
+                    "Too many distinct choice origins.");
+    _choiceOriginIdentifiers.resize(choiceIndex, 0);
+    _choiceOriginIdentifiers.push_back(identifier);
 }
 
-std::vector<boost::any> StateAndChoiceInformationBuilder::buildDataOfChoiceOrigins(uint_fast64_t totalNumberOfChoices) {
+std::vector<uint32_t> StateAndChoiceInformationBuilder::buildChoiceOriginIdentifiers(uint_fast64_t totalNumberOfChoices) {
     STORM_LOG_ASSERT(_buildChoiceOrigins, "Building ChoiceOrigins was not enabled.");
-    _dataOfChoiceOrigins.resize(totalNumberOfChoices);
-    _dataOfChoiceOrigins.shrink_to_fit();
-    return std::move(_dataOfChoiceOrigins);
+    _choiceOriginIdentifiers.resize(totalNumberOfChoices, 0);
+    _choiceOriginIdentifiers.shrink_to_fit();
+    return std::move(_choiceOriginIdentifiers);
+}
+
+std::vector<boost::any> StateAndChoiceInformationBuilder::buildDataOfChoiceOriginIdentifiers() {
+    STORM_LOG_ASSERT(_buildChoiceOrigins, "Building ChoiceOrigins was not enabled.");
+    if (_dataOfChoiceOriginIdentifiers.empty()) {
+        _dataOfChoiceOriginIdentifiers.emplace_back();
+    }
+    _indexSetToChoiceOriginIdentifier.clear();
+    return std::move(_dataOfChoiceOriginIdentifiers);
 }
 
 void StateAndChoiceInformationBuilder::setBuildStatePlayerIndications(bool value) {
@@ -1,13 +1,16 @@
 #pragma once
 
 #include <boost/any.hpp>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "storm/models/sparse/ChoiceLabeling.h"
 #include "storm/storage/BitVector.h"
+#include "storm/storage/BoostTypes.h"
 #include "storm/storage/PlayerIndex.h"
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
@@ -26,13 +29,26 @@ class StateAndChoiceInformationBuilder {
 
     void setBuildChoiceLabels(bool value);
     bool isBuildChoiceLabels() const;
-    void addChoiceLabel(std::string const& label, uint_fast64_t choiceIndex);
+    /*!
+     * Sets the labels of the given choice. Equal sets of labels are only stored once.
+     */
+    void addChoiceLabels(std::set<std::string> const& labels, uint_fast64_t choiceIndex);
     storm::models::sparse::ChoiceLabeling buildChoiceLabeling(uint_fast64_t totalNumberOfChoices);
 
     void setBuildChoiceOrigins(bool value);
     bool isBuildChoiceOrigins() const;
+    /*!
+     * Sets the origin data of the given choice. Equal sets of indices are only stored once.
+     */
     void addChoiceOriginData(boost::any const& originData, uint_fast64_t choiceIndex);
-    std::vector<boost::any> buildDataOfChoiceOrigins(uint_fast64_t totalNumberOfChoices);
+    /*!
+     * Retrieves for each choice the identifier of its origin data, where identifier 0 refers to choices without origin data.
+     */
+    std::vector<uint32_t> buildChoiceOriginIdentifiers(uint_fast64_t totalNumberOfChoices);
+    /*!
+     * Retrieves the (distinct) origin data of each identifier. The data of identifier 0 is empty.
+     */
+    std::vector<boost::any> buildDataOfChoiceOriginIdentifiers();
 
     void setBuildStatePlayerIndications(bool value);
     bool isBuildStatePlayerIndications() const;
@@ -54,10 +70,15 @@ class StateAndChoiceInformationBuilder {
 
    private:
     bool _buildChoiceLabels;
-    std::unordered_map<std::string, storm::storage::BitVector> _choiceLabels;
+    // For each choice, the identifier of its set of labels, where identifier 0 refers to the empty set.
+    std::vector<uint32_t> _choiceLabelSetIdentifiers;
+    std::map<std::set<std::string>, uint32_t> _labelSetToIdentifier;
 
     bool _buildChoiceOrigins;
-    std::vector<boost::any> _dataOfChoiceOrigins;
+    // For each choice, the identifier of its origin data, where identifier 0 refers to choices without origin data.
+    std::vector<uint32_t> _choiceOriginIdentifiers;
+    std::vector<boost::any> _dataOfChoiceOriginIdentifiers;
+    std::map<storm::storage::FlatSet<uint_fast64_t>, uint32_t> _indexSetToChoiceOriginIdentifier;
 
     bool _buildStatePlayerIndications;
     std::vector<storm::storage::PlayerIndex> _statePlayerIndications;
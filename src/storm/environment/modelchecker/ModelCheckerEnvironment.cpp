@@ -17,6 +17,21 @@ ModelCheckerEnvironment::ModelCheckerEnvironment() {
     if (mcSettings.isLtl2daToolSet()) {
         ltl2daTool = mcSettings.getLtl2daTool();
     }
+    if (mcSettings.isLtl2daCacheDirectorySet()) {
+        ltl2daCacheDirectory = mcSettings.getLtl2daCacheDirectory();
+    }
+    if (mcSettings.isHintCacheDirectorySet()) {
+        hintCacheDirectory = mcSettings.getHintCacheDirectory();
+    }
+    numberOfLtl2daThreads = mcSettings.getNumberOfLtl2daThreads();
+    hybridBlockSize = mcSettings.getHybridBlockSize();
+    numberOfEpochThreads = mcSettings.getNumberOfEpochThreads();
+    epochSolutionMemoryLimit = mcSettings.getEpochSolutionMemoryLimit() * 1024 * 1024;
+    releaseIntermediateData = mcSettings.isReleaseIntermediateDataSet();
+    filterRewZero = mcSettings.isFilterRewZeroSet();
+    stepBoundedSteadyPrecision = mcSettings.getStepBoundedSteadyPrecision();
+    stepBoundedSquaringStateLimit = mcSettings.getStepBoundedSquaringStateLimit();
+    conditionalAlgorithm = mcSettings.getConditionalAlgorithm();
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     steadyStateDistributionAlgorithm = ioSettings.getSteadyStateDistributionAlgorithm();
 }
@@ -57,4 +72,111 @@ void ModelCheckerEnvironment::unsetLtl2daTool() {
     ltl2daTool = boost::none;
 }
 
+bool ModelCheckerEnvironment::isLtl2daCacheDirectorySet() const {
+    return ltl2daCacheDirectory.is_initialized();
+}
+
+std::string const& ModelCheckerEnvironment::getLtl2daCacheDirectory() const {
+    return ltl2daCacheDirectory.get();
+}
+
+void ModelCheckerEnvironment::setLtl2daCacheDirectory(std::string const& value) {
+    ltl2daCacheDirectory = value;
+}
+
+void ModelCheckerEnvironment::unsetLtl2daCacheDirectory() {
+    ltl2daCacheDirectory = boost::none;
+}
+
+bool ModelCheckerEnvironment::isHintCacheDirectorySet() const {
+    return hintCacheDirectory.is_initialized();
+}
+
+std::string const& ModelCheckerEnvironment::getHintCacheDirectory() const {
+    return hintCacheDirectory.get();
+}
+
+void ModelCheckerEnvironment::setHintCacheDirectory(std::string const& value) {
+    hintCacheDirectory = value;
+}
+
+void ModelCheckerEnvironment::unsetHintCacheDirectory() {
+    hintCacheDirectory = boost::none;
+}
+
+uint64_t ModelCheckerEnvironment::getNumberOfLtl2daThreads() const {
+    return numberOfLtl2daThreads;
+}
+
+void ModelCheckerEnvironment::setNumberOfLtl2daThreads(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidEnvironmentException, "The number of threads must be positive.");
+    numberOfLtl2daThreads = value;
+}
+
+uint64_t ModelCheckerEnvironment::getHybridBlockSize() const {
+    return hybridBlockSize;
+}
+
+void ModelCheckerEnvironment::setHybridBlockSize(uint64_t value) {
+    hybridBlockSize = value;
+}
+
+uint64_t ModelCheckerEnvironment::getNumberOfEpochThreads() const {
+    return numberOfEpochThreads;
+}
+
+void ModelCheckerEnvironment::setNumberOfEpochThreads(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidEnvironmentException, "The number of threads must be positive.");
+    numberOfEpochThreads = value;
+}
+
+uint64_t ModelCheckerEnvironment::getEpochSolutionMemoryLimit() const {
+    return epochSolutionMemoryLimit;
+}
+
+void ModelCheckerEnvironment::setEpochSolutionMemoryLimit(uint64_t bytes) {
+    epochSolutionMemoryLimit = bytes;
+}
+
+bool ModelCheckerEnvironment::isReleaseIntermediateDataSet() const {
+    return releaseIntermediateData;
+}
+
+void ModelCheckerEnvironment::setReleaseIntermediateData(bool value) {
+    releaseIntermediateData = value;
+}
+
+bool ModelCheckerEnvironment::isFilterRewZeroSet() const {
+    return filterRewZero;
+}
+
+void ModelCheckerEnvironment::setFilterRewZero(bool value) {
+    filterRewZero = value;
+}
+
+double ModelCheckerEnvironment::getStepBoundedSteadyPrecision() const {
+    return stepBoundedSteadyPrecision;
+}
+
+void ModelCheckerEnvironment::setStepBoundedSteadyPrecision(double value) {
+    STORM_LOG_THROW(value >= 0.0, storm::exceptions::InvalidEnvironmentException, "The precision must not be negative.");
+    stepBoundedSteadyPrecision = value;
+}
+
+uint64_t ModelCheckerEnvironment::getStepBoundedSquaringStateLimit() const {
+    return stepBoundedSquaringStateLimit;
+}
+
+void ModelCheckerEnvironment::setStepBoundedSquaringStateLimit(uint64_t value) {
+    stepBoundedSquaringStateLimit = value;
+}
+
+storm::modelchecker::helper::ConditionalAlgorithm ModelCheckerEnvironment::getConditionalAlgorithm() const {
+    return conditionalAlgorithm;
+}
+
+void ModelCheckerEnvironment::setConditionalAlgorithm(storm::modelchecker::helper::ConditionalAlgorithm value) {
+    conditionalAlgorithm = value;
+}
+
 }  // namespace storm
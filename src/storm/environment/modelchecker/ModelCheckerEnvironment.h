@@ -7,6 +7,7 @@
 #include "storm/environment/Environment.h"
 #include "storm/environment/SubEnvironment.h"
 #include "storm/modelchecker/helper/infinitehorizon/SteadyStateDistributionAlgorithm.h"
+#include "storm/modelchecker/prctl/helper/ConditionalAlgorithm.h"
 
 namespace storm {
 
@@ -29,9 +30,64 @@ class ModelCheckerEnvironment {
     void setLtl2daTool(std::string const& value);
     void unsetLtl2daTool();
 
+    bool isLtl2daCacheDirectorySet() const;
+    std::string const& getLtl2daCacheDirectory() const;
+    void setLtl2daCacheDirectory(std::string const& value);
+    void unsetLtl2daCacheDirectory();
+
+    /// The directory in which the results and schedulers of reachability properties are cached to warm-start later computations.
+    bool isHintCacheDirectorySet() const;
+    std::string const& getHintCacheDirectory() const;
+    void setHintCacheDirectory(std::string const& value);
+    void unsetHintCacheDirectory();
+
+    uint64_t getNumberOfLtl2daThreads() const;
+    void setNumberOfLtl2daThreads(uint64_t value);
+
+    uint64_t getHybridBlockSize() const;
+    void setHybridBlockSize(uint64_t value);
+
+    uint64_t getNumberOfEpochThreads() const;
+    void setNumberOfEpochThreads(uint64_t value);
+
+    /// The memory limit (in bytes) for stored epoch solutions. Zero means that there is no limit.
+    uint64_t getEpochSolutionMemoryLimit() const;
+    void setEpochSolutionMemoryLimit(uint64_t bytes);
+
+    /// Whether intermediate data (e.g. backward transitions) is released as soon as the computation that needs it finishes instead of being cached.
+    bool isReleaseIntermediateDataSet() const;
+    void setReleaseIntermediateData(bool value);
+
+    /// Whether the states with reward zero are determined in a graph-based preprocessing step of the computation of expected rewards.
+    bool isFilterRewZeroSet() const;
+    void setFilterRewZero(bool value);
+
+    /// The precision with which the vector of step-bounded computations counts as steady. Zero means that only exact fixpoints terminate early.
+    double getStepBoundedSteadyPrecision() const;
+    void setStepBoundedSteadyPrecision(double value);
+
+    /// The maximal number of states for which step-bounded DTMC properties are computed by squaring the matrix. Zero means that it is never squared.
+    uint64_t getStepBoundedSquaringStateLimit() const;
+    void setStepBoundedSquaringStateLimit(uint64_t value);
+
+    /// The algorithm with which conditional probabilities of DTMCs and MDPs are computed.
+    storm::modelchecker::helper::ConditionalAlgorithm getConditionalAlgorithm() const;
+    void setConditionalAlgorithm(storm::modelchecker::helper::ConditionalAlgorithm value);
+
    private:
     SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
     boost::optional<std::string> ltl2daTool;
+    boost::optional<std::string> ltl2daCacheDirectory;
+    boost::optional<std::string> hintCacheDirectory;
+    uint64_t numberOfLtl2daThreads;
     SteadyStateDistributionAlgorithm steadyStateDistributionAlgorithm;
+    uint64_t hybridBlockSize;
+    uint64_t numberOfEpochThreads;
+    uint64_t epochSolutionMemoryLimit;
+    bool releaseIntermediateData;
+    bool filterRewZero;
+    double stepBoundedSteadyPrecision;
+    uint64_t stepBoundedSquaringStateLimit;
+    storm::modelchecker::helper::ConditionalAlgorithm conditionalAlgorithm;
 };
 }  // namespace storm
@@ -49,6 +49,7 @@ MultiObjectiveModelCheckerEnvironment::MultiObjectiveModelCheckerEnvironment() {
 
     printResults = multiobjectiveSettings.isPrintResultsSet();
     useLexicographicModelChecking = multiobjectiveSettings.isLexicographicModelCheckingSet();
+    numberOfThreads = multiobjectiveSettings.getNumberOfThreads();
 }
 
 MultiObjectiveModelCheckerEnvironment::~MultiObjectiveModelCheckerEnvironment() {
@@ -196,4 +197,13 @@ bool MultiObjectiveModelCheckerEnvironment::isLexicographicModelCheckingSet() co
 void MultiObjectiveModelCheckerEnvironment::setLexicographicModelChecking(bool value) {
     useLexicographicModelChecking = value;
 }
+
+uint64_t const& MultiObjectiveModelCheckerEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void MultiObjectiveModelCheckerEnvironment::setNumberOfThreads(uint64_t const& value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::IllegalArgumentException, "The number of threads must be positive.");
+    numberOfThreads = value;
+}
 }  // namespace storm
\ No newline at end of file
@@ -20,6 +20,8 @@ EigenSolverEnvironment::EigenSolverEnvironment() {
         maxIterationCount = std::numeric_limits<uint_fast64_t>::max();
     }
     precision = storm::utility::convertNumber<storm::RationalNumber>(eigenSettings.getPrecision());
+    floatingPointPresolve = eigenSettings.isFloatingPointPresolveSet();
+    refinementSteps = eigenSettings.getNumberOfRefinementSteps();
 }
 
 EigenSolverEnvironment::~EigenSolverEnvironment() {
@@ -70,4 +72,20 @@ storm::RationalNumber const& EigenSolverEnvironment::getPrecision() const {
 void EigenSolverEnvironment::setPrecision(storm::RationalNumber value) {
     precision = value;
 }
+
+bool EigenSolverEnvironment::isFloatingPointPresolveSet() const {
+    return floatingPointPresolve;
+}
+
+void EigenSolverEnvironment::setFloatingPointPresolve(bool value) {
+    floatingPointPresolve = value;
+}
+
+uint64_t const& EigenSolverEnvironment::getNumberOfRefinementSteps() const {
+    return refinementSteps;
+}
+
+void EigenSolverEnvironment::setNumberOfRefinementSteps(uint64_t value) {
+    refinementSteps = value;
+}
 }  // namespace storm
@@ -24,6 +24,10 @@ class EigenSolverEnvironment {
     void setMaximalNumberOfIterations(uint64_t value);
     storm::RationalNumber const& getPrecision() const;
     void setPrecision(storm::RationalNumber value);
+    bool isFloatingPointPresolveSet() const;
+    void setFloatingPointPresolve(bool value);
+    uint64_t const& getNumberOfRefinementSteps() const;
+    void setNumberOfRefinementSteps(uint64_t value);
 
    private:
     storm::solver::EigenLinearEquationSolverMethod method;
@@ -32,5 +36,7 @@ class EigenSolverEnvironment {
     uint64_t restartThreshold;
     uint64_t maxIterationCount;
     storm::RationalNumber precision;
+    bool floatingPointPresolve;
+    uint64_t refinementSteps;
 };
 }  // namespace storm
@@ -23,6 +23,7 @@ GameSolverEnvironment::GameSolverEnvironment() {
     STORM_LOG_ASSERT(considerRelativeTerminationCriterion ||
                          gameSettings.getConvergenceCriterion() == storm::settings::modules::GameSolverSettings::ConvergenceCriterion::Absolute,
                      "Unknown convergence criterion");
+    multiplicationStyle = gameSettings.getValueIterationMultiplicationStyle();
 }
 
 GameSolverEnvironment::~GameSolverEnvironment() {
@@ -66,4 +67,12 @@ void GameSolverEnvironment::setRelativeTerminationCriterion(bool value) {
     considerRelativeTerminationCriterion = value;
 }
 
+storm::solver::MultiplicationStyle const& GameSolverEnvironment::getMultiplicationStyle() const {
+    return multiplicationStyle;
+}
+
+void GameSolverEnvironment::setMultiplicationStyle(storm::solver::MultiplicationStyle value) {
+    multiplicationStyle = value;
+}
+
 }  // namespace storm
@@ -31,5 +31,6 @@ class GameSolverEnvironment {
     uint64_t maxIterationCount;
     storm::RationalNumber precision;
     bool considerRelativeTerminationCriterion;
+    storm::solver::MultiplicationStyle multiplicationStyle;
 };
 }  // namespace storm
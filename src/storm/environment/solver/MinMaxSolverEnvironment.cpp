@@ -25,6 +25,11 @@ MinMaxSolverEnvironment::MinMaxSolverEnvironment() {
                      "Unknown convergence criterion");
     multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
     forceRequireUnique = minMaxSettings.isForceUniqueSolutionRequirementSet();
+    mixedPrecision = minMaxSettings.isMixedPrecisionSet();
+    asynchronousUpdates = minMaxSettings.isAsynchronousUpdatesSet();
+    automaticMethodSelection = minMaxSettings.isAutomaticMethodSelectionSet();
+    automaticMethodRaceTime = minMaxSettings.isAutomaticMethodRaceSet() ? minMaxSettings.getAutomaticMethodRaceTime() : 0;
+    duplicateChoiceElimination = !minMaxSettings.isNoDuplicateEliminationSet();
 }
 
 MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -84,4 +89,44 @@ void MinMaxSolverEnvironment::setForceRequireUnique(bool value) {
     forceRequireUnique = value;
 }
 
+bool MinMaxSolverEnvironment::isMixedPrecisionSet() const {
+    return mixedPrecision;
+}
+
+void MinMaxSolverEnvironment::setMixedPrecision(bool value) {
+    mixedPrecision = value;
+}
+
+bool MinMaxSolverEnvironment::isAsynchronousUpdatesSet() const {
+    return asynchronousUpdates;
+}
+
+void MinMaxSolverEnvironment::setAsynchronousUpdates(bool value) {
+    asynchronousUpdates = value;
+}
+
+bool MinMaxSolverEnvironment::isAutomaticMethodSelectionSet() const {
+    return automaticMethodSelection;
+}
+
+void MinMaxSolverEnvironment::setAutomaticMethodSelection(bool value) {
+    automaticMethodSelection = value;
+}
+
+uint64_t MinMaxSolverEnvironment::getAutomaticMethodRaceTime() const {
+    return automaticMethodRaceTime;
+}
+
+void MinMaxSolverEnvironment::setAutomaticMethodRaceTime(uint64_t milliseconds) {
+    automaticMethodRaceTime = milliseconds;
+}
+
+bool MinMaxSolverEnvironment::isDuplicateChoiceEliminationSet() const {
+    return duplicateChoiceElimination;
+}
+
+void MinMaxSolverEnvironment::setDuplicateChoiceElimination(bool value) {
+    duplicateChoiceElimination = value;
+}
+
 }  // namespace storm
@@ -26,6 +26,16 @@ class MinMaxSolverEnvironment {
     void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
     bool isForceRequireUnique() const;
     void setForceRequireUnique(bool value);
+    bool isMixedPrecisionSet() const;
+    void setMixedPrecision(bool value);
+    bool isAsynchronousUpdatesSet() const;
+    void setAsynchronousUpdates(bool value);
+    bool isAutomaticMethodSelectionSet() const;
+    void setAutomaticMethodSelection(bool value);
+    uint64_t getAutomaticMethodRaceTime() const;
+    void setAutomaticMethodRaceTime(uint64_t milliseconds);
+    bool isDuplicateChoiceEliminationSet() const;
+    void setDuplicateChoiceElimination(bool value);
 
    private:
     storm::solver::MinMaxMethod minMaxMethod;
@@ -35,5 +45,10 @@ class MinMaxSolverEnvironment {
     bool considerRelativeTerminationCriterion;
     storm::solver::MultiplicationStyle multiplicationStyle;
     bool forceRequireUnique;
+    bool mixedPrecision;
+    bool asynchronousUpdates;
+    bool automaticMethodSelection;
+    uint64_t automaticMethodRaceTime;
+    bool duplicateChoiceElimination;
 };
 }  // namespace storm
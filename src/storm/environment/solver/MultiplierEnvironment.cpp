@@ -11,6 +11,8 @@ MultiplierEnvironment::MultiplierEnvironment() {
     auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
     type = multiplierSettings.getMultiplierType();
     typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+    splitStorage = multiplierSettings.isSplitStorageSet();
+    compressedValues = multiplierSettings.isCompressedValuesSet();
 }
 
 MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +32,20 @@ void MultiplierEnvironment::setType(storm::solver::MultiplierType value, bool is
     typeSetFromDefault = isSetFromDefault;
 }
 
+bool MultiplierEnvironment::isSplitStorageSet() const {
+    return splitStorage;
+}
+
+void MultiplierEnvironment::setSplitStorage(bool value) {
+    splitStorage = value;
+}
+
+bool MultiplierEnvironment::isCompressedValuesSet() const {
+    return compressedValues;
+}
+
+void MultiplierEnvironment::setCompressedValues(bool value) {
+    compressedValues = value;
+}
+
 }  // namespace storm
@@ -13,9 +13,15 @@ class MultiplierEnvironment {
     storm::solver::MultiplierType const& getType() const;
     bool const& isTypeSetFromDefault() const;
     void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
+    bool isSplitStorageSet() const;
+    void setSplitStorage(bool value);
+    bool isCompressedValuesSet() const;
+    void setCompressedValues(bool value);
 
    private:
     storm::solver::MultiplierType type;
     bool typeSetFromDefault;
+    bool splitStorage;
+    bool compressedValues;
 };
 }  // namespace storm
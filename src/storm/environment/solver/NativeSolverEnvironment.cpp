@@ -5,6 +5,8 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/InvalidEnvironmentException.h"
+
 namespace storm {
 
 NativeSolverEnvironment::NativeSolverEnvironment() {
@@ -26,6 +28,9 @@ NativeSolverEnvironment::NativeSolverEnvironment() {
     powerMethodMultiplicationStyle = nativeSettings.getPowerMethodMultiplicationStyle();
     sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
     symmetricUpdates = nativeSettings.isForceIntervalIterationSymmetricUpdatesSet();
+    mixedPrecision = nativeSettings.isMixedPrecisionSet();
+    preconditioner = nativeSettings.getPreconditioningMethod();
+    restartThreshold = nativeSettings.getRestartIterationCount();
 }
 
 NativeSolverEnvironment::~NativeSolverEnvironment() {
@@ -93,4 +98,29 @@ void NativeSolverEnvironment::setSymmetricUpdates(bool value) {
     symmetricUpdates = value;
 }
 
+bool NativeSolverEnvironment::isMixedPrecisionSet() const {
+    return mixedPrecision;
+}
+
+void NativeSolverEnvironment::setMixedPrecision(bool value) {
+    mixedPrecision = value;
+}
+
+storm::solver::NativeLinearEquationSolverPreconditioner const& NativeSolverEnvironment::getPreconditioner() const {
+    return preconditioner;
+}
+
+void NativeSolverEnvironment::setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner value) {
+    preconditioner = value;
+}
+
+uint64_t const& NativeSolverEnvironment::getRestartThreshold() const {
+    return restartThreshold;
+}
+
+void NativeSolverEnvironment::setRestartThreshold(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidEnvironmentException, "The restart threshold must be positive.");
+    restartThreshold = value;
+}
+
 }  // namespace storm
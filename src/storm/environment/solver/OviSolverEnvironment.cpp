@@ -11,10 +11,19 @@ OviSolverEnvironment::OviSolverEnvironment() {
     if (oviSettings.hasUpperBoundGuessingFactorBeenSet()) {
         upperBoundGuessingFactor = storm::utility::convertNumber<storm::RationalNumber>(oviSettings.getUpperBoundGuessingFactor());
     }
+    adaptive = oviSettings.isAdaptiveSet();
 }
 
 std::optional<storm::RationalNumber> const& OviSolverEnvironment::getUpperBoundGuessingFactor() const {
     return upperBoundGuessingFactor;
 }
 
+bool OviSolverEnvironment::isAdaptiveSet() const {
+    return adaptive;
+}
+
+void OviSolverEnvironment::setAdaptive(bool value) {
+    adaptive = value;
+}
+
 }  // namespace storm
@@ -13,8 +13,11 @@ class OviSolverEnvironment {
     ~OviSolverEnvironment() = default;
 
     std::optional<storm::RationalNumber> const& getUpperBoundGuessingFactor() const;
+    bool isAdaptiveSet() const;
+    void setAdaptive(bool value);
 
    private:
     std::optional<storm::RationalNumber> upperBoundGuessingFactor;
+    bool adaptive;
 };
 }  // namespace storm
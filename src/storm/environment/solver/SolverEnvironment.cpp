@@ -18,6 +18,13 @@ SolverEnvironment::SolverEnvironment() {
     forceExact = generalSettings.isExactSet() || generalSettings.isExactFinitePrecisionSet();
     linearEquationSolverType = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
     linearEquationSolverTypeSetFromDefault = storm::settings::getModule<storm::settings::modules::CoreSettings>().isEquationSolverSetFromDefaultValue();
+    numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads();
+    distributed = storm::settings::getModule<storm::settings::modules::CoreSettings>().isDistributedSet();
+    distributedStatePartitioning = storm::settings::getModule<storm::settings::modules::CoreSettings>().getDistributedStatePartitioning();
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isSolverCheckpointSet()) {
+        checkpointFilename = storm::settings::getModule<storm::settings::modules::CoreSettings>().getSolverCheckpointFilename();
+    }
+    checkpointInterval = storm::settings::getModule<storm::settings::modules::CoreSettings>().getSolverCheckpointInterval();
 }
 
 SolverEnvironment::~SolverEnvironment() {
@@ -120,6 +127,55 @@ void SolverEnvironment::setForceExact(bool value) {
     SolverEnvironment::forceExact = value;
 }
 
+uint64_t SolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void SolverEnvironment::setNumberOfThreads(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidEnvironmentException, "The number of threads must be positive.");
+    numberOfThreads = value;
+}
+
+bool SolverEnvironment::isDistributedSet() const {
+    return distributed;
+}
+
+void SolverEnvironment::setDistributed(bool value) {
+    distributed = value;
+}
+
+storm::utility::mpi::StatePartitioning SolverEnvironment::getDistributedStatePartitioning() const {
+    return distributedStatePartitioning;
+}
+
+void SolverEnvironment::setDistributedStatePartitioning(storm::utility::mpi::StatePartitioning value) {
+    distributedStatePartitioning = value;
+}
+
+std::optional<std::string> const& SolverEnvironment::getCheckpointFilename() const {
+    return checkpointFilename;
+}
+
+void SolverEnvironment::setCheckpointFilename(std::optional<std::string> const& value) {
+    checkpointFilename = value;
+}
+
+uint64_t SolverEnvironment::getCheckpointInterval() const {
+    return checkpointInterval;
+}
+
+void SolverEnvironment::setCheckpointInterval(uint64_t value) {
+    checkpointInterval = value;
+}
+
+storm::solver::SolverIterationObserver const& SolverEnvironment::getIterationObserver() const {
+    return iterationObserver;
+}
+
+void SolverEnvironment::setIterationObserver(storm::solver::SolverIterationObserver const& value) {
+    iterationObserver = value;
+}
+
 storm::solver::EquationSolverType const& SolverEnvironment::getLinearEquationSolverType() const {
     return linearEquationSolverType;
 }
@@ -2,11 +2,15 @@
 
 #include <boost/optional.hpp>
 #include <memory>
+#include <optional>
+#include <string>
 
 #include "storm/adapters/RationalNumberForward.h"
 #include "storm/environment/Environment.h"
 #include "storm/environment/SubEnvironment.h"
+#include "storm/solver/SolverIterationObserver.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/utility/mpi.h"
 
 namespace storm {
 
@@ -52,6 +56,18 @@ class SolverEnvironment {
     void setForceSoundness(bool value);
     bool isForceExact() const;
     void setForceExact(bool value);
+    uint64_t getNumberOfThreads() const;
+    void setNumberOfThreads(uint64_t value);
+    bool isDistributedSet() const;
+    void setDistributed(bool value);
+    storm::utility::mpi::StatePartitioning getDistributedStatePartitioning() const;
+    void setDistributedStatePartitioning(storm::utility::mpi::StatePartitioning value);
+    std::optional<std::string> const& getCheckpointFilename() const;
+    void setCheckpointFilename(std::optional<std::string> const& value);
+    uint64_t getCheckpointInterval() const;
+    void setCheckpointInterval(uint64_t value);
+    storm::solver::SolverIterationObserver const& getIterationObserver() const;
+    void setIterationObserver(storm::solver::SolverIterationObserver const& value);
 
     storm::solver::EquationSolverType const& getLinearEquationSolverType() const;
     void setLinearEquationSolverType(storm::solver::EquationSolverType const& value, bool isSetFromDefault = false);
@@ -78,5 +94,11 @@ class SolverEnvironment {
     bool linearEquationSolverTypeSetFromDefault;
     bool forceSoundness;
     bool forceExact;
+    uint64_t numberOfThreads;
+    bool distributed;
+    storm::utility::mpi::StatePartitioning distributedStatePartitioning;
+    std::optional<std::string> checkpointFilename;
+    uint64_t checkpointInterval;
+    storm::solver::SolverIterationObserver iterationObserver;
 };
 }  // namespace storm
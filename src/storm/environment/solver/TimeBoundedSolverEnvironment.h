@@ -16,6 +16,9 @@ class TimeBoundedSolverEnvironment {
     bool const& isMaMethodSetFromDefault() const;
     void setMaMethod(storm::solver::MaBoundedReachabilityMethod value, bool isSetFromDefault = false);
 
+    storm::solver::CtmcTransientMethod const& getCtmcMethod() const;
+    void setCtmcMethod(storm::solver::CtmcTransientMethod value);
+
     storm::RationalNumber const& getPrecision() const;
     void setPrecision(storm::RationalNumber value);
     bool const& getRelativeTerminationCriterion() const;
@@ -28,6 +31,8 @@ class TimeBoundedSolverEnvironment {
     storm::solver::MaBoundedReachabilityMethod maMethod;
     bool maMethodSetFromDefault;
 
+    storm::solver::CtmcTransientMethod ctmcMethod;
+
     storm::RationalNumber precision;
     bool relative;
 
@@ -18,6 +18,18 @@ Choice<ValueType, StateType>::Choice(uint_fast64_t actionIndex, bool markovian)
     // Intentionally left empty.
 }
 
+template<typename ValueType, typename StateType>
+void Choice<ValueType, StateType>::reset(uint_fast64_t actionIndex, bool markovian) {
+    this->markovian = markovian;
+    this->actionIndex = actionIndex;
+    this->distribution.clear();
+    this->totalMass = storm::utility::zero<ValueType>();
+    this->rewards.clear();
+    this->originData.reset();
+    this->labels.reset();
+    this->playerIndex.reset();
+}
+
 template<typename ValueType, typename StateType>
 void Choice<ValueType, StateType>::add(Choice const& other) {
     STORM_LOG_THROW(this->markovian == other.markovian, storm::exceptions::InvalidOperationException, "Type of choices do not match.");
@@ -30,6 +30,12 @@ struct Choice {
      */
     void add(Choice const& other);
 
+    /*!
+     * Turns this choice into an empty choice with the given action index. The storage of the distribution and the rewards is kept, which is why
+     * resetting a choice is cheaper than creating a new one.
+     */
+    void reset(uint_fast64_t actionIndex = 0, bool markovian = false);
+
     /**
      * Given a value q, find the event in the ordered distribution that corresponds to this prob.
      * Example: Given a (sub)distribution { x -> 0.4, y -> 0.3, z -> 0.2 },
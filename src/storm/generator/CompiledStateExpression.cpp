@@ -0,0 +1,299 @@
+#include "storm/generator/CompiledStateExpression.h"
+
+#include <algorithm>
+#include <array>
+#include <map>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+/*!
+ * Translates an expression into the instructions of a compiled state expression. Each visit returns whether the visited subexpression is in the supported
+ * fragment.
+ */
+class StateExpressionCompiler : public storm::expressions::ExpressionVisitor {
+   public:
+    StateExpressionCompiler(VariableInformation const& variableInformation) : stackSize(0), maximalStackSize(0) {
+        for (auto const& booleanVariable : variableInformation.booleanVariables) {
+            variables.emplace(booleanVariable.variable, Instruction{OpCode::BooleanVariable, booleanVariable.bitOffset, 1, 0});
+        }
+        for (auto const& integerVariable : variableInformation.integerVariables) {
+            if (integerVariable.bitWidth == 0) {
+                variables.emplace(integerVariable.variable, Instruction{OpCode::Constant, 0, 0, integerVariable.lowerBound});
+            } else {
+                variables.emplace(integerVariable.variable,
+                                  Instruction{OpCode::IntegerVariable, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound});
+            }
+        }
+    }
+
+    std::optional<CompiledStateExpression> compile(storm::expressions::Expression const& expression) {
+        CompiledStateExpression result;
+        instructions = &result.instructions;
+        bool success = boost::any_cast<bool>(expression.getBaseExpression().accept(*this, boost::none));
+        if (!success || maximalStackSize > CompiledStateExpression::MaximalStackSize) {
+            return std::nullopt;
+        }
+        STORM_LOG_ASSERT(stackSize == 1, "Unexpected stack size after compiling expression " << expression << ".");
+        return result;
+    }
+
+    virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override {
+        // All operands are evaluated as none of the supported operations can fail.
+        if (!boost::any_cast<bool>(expression.getCondition()->accept(*this, data)) ||
+            !boost::any_cast<bool>(expression.getThenExpression()->accept(*this, data)) ||
+            !boost::any_cast<bool>(expression.getElseExpression()->accept(*this, data))) {
+            return false;
+        }
+        return add(OpCode::IfThenElse, 3);
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        if (!visitOperands(expression, data)) {
+            return false;
+        }
+        switch (expression.getOperatorType()) {
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And:
+                return add(OpCode::And, 2);
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Or:
+                return add(OpCode::Or, 2);
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Xor:
+                return add(OpCode::Xor, 2);
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Implies:
+                return add(OpCode::Implies, 2);
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Iff:
+                return add(OpCode::Iff, 2);
+        }
+        return false;
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        // Divisions, powers and so on may yield rational values, so we only support the operations that are closed under integers.
+        if (!expression.hasIntegerType() || !visitOperands(expression, data)) {
+            return false;
+        }
+        switch (expression.getOperatorType()) {
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Plus:
+                return add(OpCode::Plus, 2);
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Minus:
+                return add(OpCode::Minus, 2);
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Times:
+                return add(OpCode::Times, 2);
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Min:
+                return add(OpCode::Min, 2);
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Max:
+                return add(OpCode::Max, 2);
+            default:
+                return false;
+        }
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override {
+        if (expression.getFirstOperand()->hasRationalType() || expression.getSecondOperand()->hasRationalType() || !visitOperands(expression, data)) {
+            return false;
+        }
+        switch (expression.getRelationType()) {
+            case storm::expressions::RelationType::Equal:
+                return add(OpCode::Equal, 2);
+            case storm::expressions::RelationType::NotEqual:
+                return add(OpCode::NotEqual, 2);
+            case storm::expressions::RelationType::Less:
+                return add(OpCode::Less, 2);
+            case storm::expressions::RelationType::LessOrEqual:
+                return add(OpCode::LessOrEqual, 2);
+            case storm::expressions::RelationType::Greater:
+                return add(OpCode::Greater, 2);
+            case storm::expressions::RelationType::GreaterOrEqual:
+                return add(OpCode::GreaterOrEqual, 2);
+        }
+        return false;
+    }
+
+    virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+        auto variableIt = variables.find(expression.getVariable());
+        if (variableIt == variables.end()) {
+            return false;
+        }
+        instructions->push_back(variableIt->second);
+        return push();
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        if (!boost::any_cast<bool>(expression.getOperand()->accept(*this, data))) {
+            return false;
+        }
+        return add(OpCode::Not, 1);
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        if (!expression.getOperand()->hasIntegerType() || !boost::any_cast<bool>(expression.getOperand()->accept(*this, data))) {
+            return false;
+        }
+        switch (expression.getOperatorType()) {
+            case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Minus:
+                return add(OpCode::Negate, 1);
+            case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Floor:
+            case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Ceil:
+                // Rounding an integer does not change its value.
+                return true;
+        }
+        return false;
+    }
+
+    virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) override {
+        instructions->push_back(Instruction{OpCode::Constant, 0, 0, expression.getValue() ? 1 : 0});
+        return push();
+    }
+
+    virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) override {
+        instructions->push_back(Instruction{OpCode::Constant, 0, 0, expression.getValue()});
+        return push();
+    }
+
+    virtual boost::any visit(storm::expressions::RationalLiteralExpression const&, boost::any const&) override {
+        return false;
+    }
+
+    virtual boost::any visit(storm::expressions::PredicateExpression const&, boost::any const&) override {
+        return false;
+    }
+
+   private:
+    typedef CompiledStateExpression::OpCode OpCode;
+    typedef CompiledStateExpression::Instruction Instruction;
+
+    bool visitOperands(storm::expressions::BinaryExpression const& expression, boost::any const& data) {
+        return boost::any_cast<bool>(expression.getFirstOperand()->accept(*this, data)) &&
+               boost::any_cast<bool>(expression.getSecondOperand()->accept(*this, data));
+    }
+
+    bool push() {
+        ++stackSize;
+        maximalStackSize = std::max(maximalStackSize, stackSize);
+        return true;
+    }
+
+    /*!
+     * Adds an operation that replaces the given number of operands on the stack by its result.
+     */
+    bool add(OpCode opCode, uint64_t numberOfOperands) {
+        instructions->push_back(Instruction{opCode, 0, 0, 0});
+        stackSize -= numberOfOperands - 1;
+        return true;
+    }
+
+    std::map<storm::expressions::Variable, Instruction> variables;
+    std::vector<Instruction>* instructions;
+    uint64_t stackSize;
+    uint64_t maximalStackSize;
+};
+
+std::optional<CompiledStateExpression> CompiledStateExpression::compile(storm::expressions::Expression const& expression,
+                                                                       VariableInformation const& variableInformation) {
+    if (!expression.hasBooleanType() && !expression.hasIntegerType()) {
+        return std::nullopt;
+    }
+    return StateExpressionCompiler(variableInformation).compile(expression);
+}
+
+bool CompiledStateExpression::evaluateAsBool(CompressedState const& state) const {
+    return evaluateAsInt(state) != 0;
+}
+
+int64_t CompiledStateExpression::evaluateAsInt(CompressedState const& state) const {
+    std::array<int64_t, MaximalStackSize> stack;
+    // The index of the top-most value plus one.
+    uint64_t top = 0;
+    for (auto const& instruction : instructions) {
+        switch (instruction.opCode) {
+            case OpCode::Constant:
+                stack[top++] = instruction.value;
+                continue;
+            case OpCode::BooleanVariable:
+                stack[top++] = state.get(instruction.bitOffset) ? 1 : 0;
+                continue;
+            case OpCode::IntegerVariable:
+                stack[top++] = static_cast<int64_t>(state.getAsInt(instruction.bitOffset, instruction.bitWidth)) + instruction.value;
+                continue;
+            case OpCode::Not:
+                stack[top - 1] = stack[top - 1] == 0 ? 1 : 0;
+                continue;
+            case OpCode::Negate:
+                stack[top - 1] = -stack[top - 1];
+                continue;
+            case OpCode::IfThenElse:
+                top -= 2;
+                stack[top - 1] = stack[top - 1] != 0 ? stack[top] : stack[top + 1];
+                continue;
+            default:
+                break;
+        }
+
+        // All remaining operations are binary.
+        --top;
+        int64_t& lhs = stack[top - 1];
+        int64_t const rhs = stack[top];
+        switch (instruction.opCode) {
+            case OpCode::And:
+                lhs = (lhs != 0 && rhs != 0) ? 1 : 0;
+                break;
+            case OpCode::Or:
+                lhs = (lhs != 0 || rhs != 0) ? 1 : 0;
+                break;
+            case OpCode::Xor:
+                lhs = ((lhs != 0) != (rhs != 0)) ? 1 : 0;
+                break;
+            case OpCode::Implies:
+                lhs = (lhs == 0 || rhs != 0) ? 1 : 0;
+                break;
+            case OpCode::Iff:
+                lhs = ((lhs != 0) == (rhs != 0)) ? 1 : 0;
+                break;
+            case OpCode::Plus:
+                lhs += rhs;
+                break;
+            case OpCode::Minus:
+                lhs -= rhs;
+                break;
+            case OpCode::Times:
+                lhs *= rhs;
+                break;
+            case OpCode::Min:
+                lhs = std::min(lhs, rhs);
+                break;
+            case OpCode::Max:
+                lhs = std::max(lhs, rhs);
+                break;
+            case OpCode::Equal:
+                lhs = lhs == rhs ? 1 : 0;
+                break;
+            case OpCode::NotEqual:
+                lhs = lhs != rhs ? 1 : 0;
+                break;
+            case OpCode::Less:
+                lhs = lhs < rhs ? 1 : 0;
+                break;
+            case OpCode::LessOrEqual:
+                lhs = lhs <= rhs ? 1 : 0;
+                break;
+            case OpCode::Greater:
+                lhs = lhs > rhs ? 1 : 0;
+                break;
+            case OpCode::GreaterOrEqual:
+                lhs = lhs >= rhs ? 1 : 0;
+                break;
+            default:
+                STORM_LOG_ASSERT(false, "Unexpected instruction.");
+        }
+    }
+    STORM_LOG_ASSERT(top == 1, "Unexpected stack size after evaluating compiled expression.");
+    return stack[0];
+}
+
+}  // namespace generator
+}  // namespace storm
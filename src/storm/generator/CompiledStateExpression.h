@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+namespace generator {
+
+struct VariableInformation;
+
+/*!
+ * A boolean or integer expression that is compiled into a flat sequence of instructions that operate directly on the bits of a compressed state.
+ * In contrast to the expression evaluators, evaluating a compiled expression neither requires to unpack the state nor to traverse the expression tree.
+ * Only the fragment of expressions that can be evaluated without rational arithmetic (boolean connectives, integer addition, subtraction,
+ * multiplication, minimum, maximum, comparisons and if-then-else) over the boolean and integer variables of the state is supported.
+ */
+class CompiledStateExpression {
+   public:
+    /*!
+     * Compiles the given expression.
+     *
+     * @param expression The boolean or integer expression to compile.
+     * @param variableInformation The information about how the variables are packed within the states.
+     * @return The compiled expression or nothing if the expression is not in the supported fragment.
+     */
+    static std::optional<CompiledStateExpression> compile(storm::expressions::Expression const& expression, VariableInformation const& variableInformation);
+
+    /*!
+     * Evaluates the (boolean) expression in the given state.
+     */
+    bool evaluateAsBool(CompressedState const& state) const;
+
+    /*!
+     * Evaluates the (integer) expression in the given state.
+     */
+    int64_t evaluateAsInt(CompressedState const& state) const;
+
+    /*!
+     * The maximal number of intermediate values of supported expressions.
+     */
+    static const uint64_t MaximalStackSize = 64;
+
+   private:
+    enum class OpCode : uint8_t {
+        Constant,
+        BooleanVariable,
+        IntegerVariable,
+        Not,
+        Negate,
+        IfThenElse,
+        And,
+        Or,
+        Xor,
+        Implies,
+        Iff,
+        Plus,
+        Minus,
+        Times,
+        Min,
+        Max,
+        Equal,
+        NotEqual,
+        Less,
+        LessOrEqual,
+        Greater,
+        GreaterOrEqual
+    };
+
+    struct Instruction {
+        OpCode opCode;
+        // The position of the variable within the state (for variables only).
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        // The value of a constant or the lower bound of an integer variable.
+        int64_t value;
+    };
+
+    friend class StateExpressionCompiler;
+
+    CompiledStateExpression() = default;
+
+    std::vector<Instruction> instructions;
+};
+
+}  // namespace generator
+}  // namespace storm
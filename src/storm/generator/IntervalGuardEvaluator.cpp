@@ -0,0 +1,316 @@
+#include "storm/generator/IntervalGuardEvaluator.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+
+// Bounds on the values of the variables and constants we consider so that the bound computations can not overflow.
+int64_t const maximalMagnitude = 1ll << 40;
+
+/*!
+ * Restricts the interval [lower, upper] (on the actual values of an integer variable) by the given relation to the given constant.
+ */
+void restrict(storm::expressions::OperatorType relation, int64_t constant, int64_t& lower, int64_t& upper) {
+    switch (relation) {
+        case storm::expressions::OperatorType::Equal:
+            lower = std::max(lower, constant);
+            upper = std::min(upper, constant);
+            break;
+        case storm::expressions::OperatorType::Less:
+            upper = std::min(upper, constant - 1);
+            break;
+        case storm::expressions::OperatorType::LessOrEqual:
+            upper = std::min(upper, constant);
+            break;
+        case storm::expressions::OperatorType::Greater:
+            lower = std::max(lower, constant + 1);
+            break;
+        case storm::expressions::OperatorType::GreaterOrEqual:
+            lower = std::max(lower, constant);
+            break;
+        default:
+            STORM_LOG_ASSERT(false, "Unexpected relation.");
+    }
+}
+
+/*!
+ * Mirrors the given relation, i.e., retrieves the relation R' such that (a R b) iff (b R' a).
+ */
+storm::expressions::OperatorType mirror(storm::expressions::OperatorType relation) {
+    switch (relation) {
+        case storm::expressions::OperatorType::Less:
+            return storm::expressions::OperatorType::Greater;
+        case storm::expressions::OperatorType::LessOrEqual:
+            return storm::expressions::OperatorType::GreaterOrEqual;
+        case storm::expressions::OperatorType::Greater:
+            return storm::expressions::OperatorType::Less;
+        case storm::expressions::OperatorType::GreaterOrEqual:
+            return storm::expressions::OperatorType::LessOrEqual;
+        default:
+            return relation;
+    }
+}
+
+bool isRelation(storm::expressions::OperatorType type) {
+    return type == storm::expressions::OperatorType::Equal || type == storm::expressions::OperatorType::Less ||
+           type == storm::expressions::OperatorType::LessOrEqual || type == storm::expressions::OperatorType::Greater ||
+           type == storm::expressions::OperatorType::GreaterOrEqual;
+}
+
+storm::expressions::Variable const& getVariable(storm::expressions::Expression const& expression) {
+    return static_cast<storm::expressions::VariableExpression const&>(expression.getBaseExpression()).getVariable();
+}
+
+/*!
+ * Splits the given expression into its conjuncts.
+ */
+void gatherConjuncts(storm::expressions::Expression const& expression, std::vector<storm::expressions::Expression>& conjuncts) {
+    if (expression.isFunctionApplication() && expression.getOperator() == storm::expressions::OperatorType::And) {
+        gatherConjuncts(expression.getOperand(0), conjuncts);
+        gatherConjuncts(expression.getOperand(1), conjuncts);
+    } else {
+        conjuncts.push_back(expression);
+    }
+}
+
+/*!
+ * The interval of values (relative to the lower bound of the variable) to which a guard restricts a variable.
+ */
+struct VariableRestriction {
+    uint64_t bitOffset;
+    uint64_t bitWidth;
+    int64_t lower;
+    int64_t upper;
+};
+
+}  // namespace
+
+bool IntervalGuardEvaluator::addGuard(uint64_t guardIndex, storm::expressions::Expression const& guard, VariableInformation const& variableInformation) {
+    STORM_LOG_ASSERT(!hasGuard(guardIndex), "Guard with index " << guardIndex << " was added twice.");
+    std::map<storm::expressions::Variable, BooleanVariableInformation const*> booleanVariables;
+    std::map<storm::expressions::Variable, IntegerVariableInformation const*> integerVariables;
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        booleanVariables.emplace(booleanVariable.variable, &booleanVariable);
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        // Restrict to variables whose stored values fit into 32 bit.
+        if (integerVariable.bitWidth > 0 && integerVariable.bitWidth <= 31 && std::abs(integerVariable.lowerBound) < maximalMagnitude &&
+            std::abs(integerVariable.upperBound) < maximalMagnitude) {
+            integerVariables.emplace(integerVariable.variable, &integerVariable);
+        }
+    }
+
+    std::vector<storm::expressions::Expression> conjuncts;
+    gatherConjuncts(guard, conjuncts);
+
+    // Intersect all constraints on the same variable.
+    std::map<storm::expressions::Variable, VariableRestriction> restrictions;
+    for (auto const& conjunct : conjuncts) {
+        if (conjunct.isTrue()) {
+            continue;
+        }
+        if (conjunct.isVariable() || (conjunct.isFunctionApplication() && conjunct.getOperator() == storm::expressions::OperatorType::Not &&
+                                      conjunct.getOperand(0).isVariable())) {
+            bool const negated = !conjunct.isVariable();
+            storm::expressions::Variable const variable = getVariable(negated ? conjunct.getOperand(0) : conjunct);
+            auto variableIt = booleanVariables.find(variable);
+            if (variableIt == booleanVariables.end()) {
+                return false;
+            }
+            int64_t const value = negated ? 0 : 1;
+            auto restrictionIt = restrictions.emplace(variable, VariableRestriction{variableIt->second->bitOffset, 1, 0, 1}).first;
+            restrictionIt->second.lower = std::max(restrictionIt->second.lower, value);
+            restrictionIt->second.upper = std::min(restrictionIt->second.upper, value);
+        } else if (conjunct.isFunctionApplication() && isRelation(conjunct.getOperator())) {
+            auto relation = conjunct.getOperator();
+            storm::expressions::Expression variableExpression = conjunct.getOperand(0);
+            storm::expressions::Expression constantExpression = conjunct.getOperand(1);
+            if (!variableExpression.isVariable()) {
+                std::swap(variableExpression, constantExpression);
+                relation = mirror(relation);
+            }
+            if (!variableExpression.isVariable() || constantExpression.containsVariables() || !constantExpression.hasIntegerType()) {
+                return false;
+            }
+            auto variableIt = integerVariables.find(getVariable(variableExpression));
+            if (variableIt == integerVariables.end()) {
+                return false;
+            }
+            int64_t const constant = constantExpression.evaluateAsInt();
+            if (std::abs(constant) >= maximalMagnitude) {
+                return false;
+            }
+            IntegerVariableInformation const& information = *variableIt->second;
+            auto restrictionIt =
+                restrictions
+                    .emplace(information.variable, VariableRestriction{information.bitOffset, information.bitWidth, 0, (1ll << information.bitWidth) - 1})
+                    .first;
+            int64_t lower = information.lowerBound + restrictionIt->second.lower;
+            int64_t upper = information.lowerBound + restrictionIt->second.upper;
+            restrict(relation, constant, lower, upper);
+            restrictionIt->second.lower = lower - information.lowerBound;
+            restrictionIt->second.upper = upper - information.lowerBound;
+        } else {
+            return false;
+        }
+    }
+
+    std::vector<Constraint> constraints;
+    for (auto const& restriction : restrictions) {
+        VariableRestriction const& bounds = restriction.second;
+        int64_t const lower = std::max<int64_t>(bounds.lower, 0);
+        int64_t const upper = std::min<int64_t>(bounds.upper, (1ll << bounds.bitWidth) - 1);
+        if (lower > upper) {
+            // The guard is unsatisfiable. We encode this by a constraint that no stored value satisfies.
+            constraints.push_back(Constraint{bounds.bitOffset, bounds.bitWidth, static_cast<uint32_t>(1ull << bounds.bitWidth), 0});
+        } else if (lower > 0 || upper < (1ll << bounds.bitWidth) - 1) {
+            constraints.push_back(Constraint{bounds.bitOffset, bounds.bitWidth, static_cast<uint32_t>(lower), static_cast<uint32_t>(upper - lower)});
+        }
+    }
+
+    if (guardIndex >= guardSlots.size()) {
+        guardSlots.resize(guardIndex + 1, noSlot);
+    }
+    guardSlots[guardIndex] = addedGuards.size();
+    addedGuards.push_back(std::move(constraints));
+    // Force the constraints to be regrouped on the next evaluation.
+    guardConstraintOffsets.clear();
+    return true;
+}
+
+bool IntervalGuardEvaluator::hasGuard(uint64_t guardIndex) const {
+    return guardIndex < guardSlots.size() && guardSlots[guardIndex] != noSlot;
+}
+
+void IntervalGuardEvaluator::prepare() {
+    // Assign an index to every restricted variable.
+    std::map<std::pair<uint64_t, uint64_t>, std::vector<std::pair<uint64_t, Constraint const*>>> constraintsOfVariables;
+    for (uint64_t slot = 0; slot < addedGuards.size(); ++slot) {
+        for (auto const& constraint : addedGuards[slot]) {
+            constraintsOfVariables[std::make_pair(constraint.bitOffset, constraint.bitWidth)].emplace_back(slot, &constraint);
+        }
+    }
+
+    variables.clear();
+    variableConstraintOffsets.assign(1, 0);
+    constraintLowerBounds.clear();
+    constraintSpans.clear();
+    std::vector<std::vector<uint64_t>> constraintsOfGuards(addedGuards.size());
+    for (auto const& variableAndConstraints : constraintsOfVariables) {
+        variables.push_back(variableAndConstraints.first);
+        for (auto const& slotAndConstraint : variableAndConstraints.second) {
+            constraintsOfGuards[slotAndConstraint.first].push_back(constraintLowerBounds.size());
+            constraintLowerBounds.push_back(slotAndConstraint.second->lowerBound);
+            constraintSpans.push_back(slotAndConstraint.second->span);
+        }
+        variableConstraintOffsets.push_back(constraintLowerBounds.size());
+    }
+
+    guardConstraintOffsets.assign(1, 0);
+    guardConstraints.clear();
+    for (auto const& constraintsOfGuard : constraintsOfGuards) {
+        guardConstraints.insert(guardConstraints.end(), constraintsOfGuard.begin(), constraintsOfGuard.end());
+        guardConstraintOffsets.push_back(guardConstraints.size());
+    }
+    constraintSatisfied.resize(constraintLowerBounds.size());
+    guardSatisfied.resize(addedGuards.size());
+}
+
+void IntervalGuardEvaluator::evaluate(CompressedState const& state) {
+    if (guardConstraintOffsets.empty()) {
+        prepare();
+    }
+
+    // Compare each variable against the bounds of all constraints on it. The inner loop has no dependencies between iterations, so the compiler
+    // processes several constraints (usually stemming from different commands) per instruction. Note that the unsigned difference wraps around for
+    // values below the lower bound and thus exceeds the span.
+    uint32_t const* lowerBounds = constraintLowerBounds.data();
+    uint32_t const* spans = constraintSpans.data();
+    uint8_t* satisfied = constraintSatisfied.data();
+    for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+        uint32_t const value = static_cast<uint32_t>(state.getAsInt(variables[variable].first, variables[variable].second));
+        uint64_t const end = variableConstraintOffsets[variable + 1];
+        for (uint64_t constraint = variableConstraintOffsets[variable]; constraint < end; ++constraint) {
+            satisfied[constraint] = static_cast<uint8_t>(value - lowerBounds[constraint] <= spans[constraint]);
+        }
+    }
+
+    for (uint64_t slot = 0; slot < guardSatisfied.size(); ++slot) {
+        uint8_t result = 1;
+        for (uint64_t position = guardConstraintOffsets[slot], end = guardConstraintOffsets[slot + 1]; position < end; ++position) {
+            result &= satisfied[guardConstraints[position]];
+        }
+        guardSatisfied[slot] = result;
+    }
+    useBatchResults = false;
+    resultStride = 1;
+    resultOffset = 0;
+}
+
+void IntervalGuardEvaluator::evaluate(std::vector<CompressedState const*> const& states) {
+    if (guardConstraintOffsets.empty()) {
+        prepare();
+    }
+
+    // In contrast to evaluating a single state, the innermost loops range over the states, so each comparison is applied to several states at once.
+    uint64_t const numberOfStates = states.size();
+    batchValues.resize(numberOfStates);
+    batchConstraintSatisfied.resize(constraintLowerBounds.size() * numberOfStates);
+    batchGuardSatisfied.resize(guardSatisfied.size() * numberOfStates);
+    uint32_t* values = batchValues.data();
+    uint8_t* satisfied = batchConstraintSatisfied.data();
+    for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            values[state] = static_cast<uint32_t>(states[state]->getAsInt(variables[variable].first, variables[variable].second));
+        }
+        for (uint64_t constraint = variableConstraintOffsets[variable], end = variableConstraintOffsets[variable + 1]; constraint < end; ++constraint) {
+            uint32_t const lowerBound = constraintLowerBounds[constraint];
+            uint32_t const span = constraintSpans[constraint];
+            uint8_t* satisfiedInStates = satisfied + constraint * numberOfStates;
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                satisfiedInStates[state] = static_cast<uint8_t>(values[state] - lowerBound <= span);
+            }
+        }
+    }
+
+    for (uint64_t slot = 0; slot < guardSatisfied.size(); ++slot) {
+        uint8_t* guardSatisfiedInStates = batchGuardSatisfied.data() + slot * numberOfStates;
+        std::fill_n(guardSatisfiedInStates, numberOfStates, static_cast<uint8_t>(1));
+        for (uint64_t position = guardConstraintOffsets[slot], end = guardConstraintOffsets[slot + 1]; position < end; ++position) {
+            uint8_t const* satisfiedInStates = satisfied + guardConstraints[position] * numberOfStates;
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                guardSatisfiedInStates[state] &= satisfiedInStates[state];
+            }
+        }
+    }
+    useBatchResults = true;
+    resultStride = numberOfStates;
+    resultOffset = 0;
+}
+
+void IntervalGuardEvaluator::selectState(uint64_t position) {
+    STORM_LOG_ASSERT(useBatchResults && position < resultStride, "Invalid position " << position << " of state within batch.");
+    resultOffset = position;
+}
+
+bool IntervalGuardEvaluator::isSatisfied(uint64_t guardIndex) const {
+    STORM_LOG_ASSERT(hasGuard(guardIndex), "Guard with index " << guardIndex << " was not added.");
+    STORM_LOG_ASSERT(!guardConstraintOffsets.empty(), "Guards have not been evaluated.");
+    return (useBatchResults ? batchGuardSatisfied : guardSatisfied)[guardSlots[guardIndex] * resultStride + resultOffset] != 0;
+}
+
+uint64_t IntervalGuardEvaluator::getNumberOfGuards() const {
+    return addedGuards.size();
+}
+
+}  // namespace generator
+}  // namespace storm
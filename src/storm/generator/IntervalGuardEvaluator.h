@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+namespace expressions {
+class Expression;
+}
+
+namespace generator {
+
+struct VariableInformation;
+
+/*!
+ * Evaluates the guards that are conjunctions of interval constraints (e.g. 2 <= x & x < 5 & b & !c) on the variables of a compressed state all at once.
+ * Such guards form the majority of guards in typical PRISM programs.
+ *
+ * The constraints are grouped by the variable they restrict. When evaluating, each variable is extracted from the state only once and compared against
+ * the bounds of all constraints on it in a single loop that is laid out for SIMD comparisons, i.e., many commands are checked at once.
+ */
+class IntervalGuardEvaluator {
+   public:
+    IntervalGuardEvaluator() = default;
+
+    /*!
+     * Tries to add the given guard.
+     *
+     * @param guardIndex The index under which the guard is identified (e.g. the global index of the command).
+     * @param guard The guard.
+     * @param variableInformation The information about how the variables are packed within the states.
+     * @return True iff the guard is a conjunction of interval constraints and has thus been added.
+     */
+    bool addGuard(uint64_t guardIndex, storm::expressions::Expression const& guard, VariableInformation const& variableInformation);
+
+    /*!
+     * Retrieves whether the guard with the given index has been added.
+     */
+    bool hasGuard(uint64_t guardIndex) const;
+
+    /*!
+     * Evaluates all added guards in the given state.
+     */
+    void evaluate(CompressedState const& state);
+
+    /*!
+     * Evaluates all added guards in all given states. The results for a state are retrieved after selecting it via selectState.
+     */
+    void evaluate(std::vector<CompressedState const*> const& states);
+
+    /*!
+     * Selects the state (given by its position in the states given to the last call to evaluate) for which subsequent calls to isSatisfied are answered.
+     */
+    void selectState(uint64_t position);
+
+    /*!
+     * Retrieves whether the added guard with the given index was satisfied in the state given to the last call to evaluate (or the selected state).
+     */
+    bool isSatisfied(uint64_t guardIndex) const;
+
+    /*!
+     * Retrieves the number of added guards.
+     */
+    uint64_t getNumberOfGuards() const;
+
+   private:
+    // A constraint lowerBound <= value <= lowerBound + span on the (unsigned) value that is stored in the state.
+    struct Constraint {
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        uint32_t lowerBound;
+        uint32_t span;
+    };
+
+    static const uint64_t noSlot = static_cast<uint64_t>(-1);
+
+    // The stored positions of the restricted variables.
+    std::vector<std::pair<uint64_t, uint64_t>> variables;
+
+    // The bounds of the constraints (grouped by variable) in structure-of-arrays layout. The constraints of variable i are stored at the positions
+    // variableConstraintOffsets[i] to variableConstraintOffsets[i + 1] (exclusive).
+    std::vector<uint64_t> variableConstraintOffsets;
+    std::vector<uint32_t> constraintLowerBounds;
+    std::vector<uint32_t> constraintSpans;
+
+    // For each guard, the positions of its constraints. The constraints of guard slot j are at guardConstraintOffsets[j] to guardConstraintOffsets[j + 1].
+    std::vector<uint64_t> guardConstraintOffsets;
+    std::vector<uint64_t> guardConstraints;
+
+    // The slot of each guard (or noSlot if the guard has not been added).
+    std::vector<uint64_t> guardSlots;
+
+    // The constraints of all guards in the order in which they were added. They are grouped only when the guards are evaluated first.
+    std::vector<std::vector<Constraint>> addedGuards;
+
+    // Memory for the results of the last evaluation.
+    std::vector<uint8_t> constraintSatisfied;
+    std::vector<uint8_t> guardSatisfied;
+
+    // Memory for the last evaluation of a batch of states. The results of all states for one constraint (or guard) are stored consecutively.
+    std::vector<uint32_t> batchValues;
+    std::vector<uint8_t> batchConstraintSatisfied;
+    std::vector<uint8_t> batchGuardSatisfied;
+
+    // Where to find the results for the current state. The result of guard slot j is stored at position j * resultStride + resultOffset of either the
+    // batch results or the results of the single evaluated state.
+    bool useBatchResults = false;
+    uint64_t resultStride = 1;
+    uint64_t resultOffset = 0;
+
+    /*!
+     * Groups the constraints of the added guards by variable.
+     */
+    void prepare();
+};
+
+}  // namespace generator
+}  // namespace storm
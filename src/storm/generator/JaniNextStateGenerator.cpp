@@ -1,5 +1,7 @@
 #include "storm/generator/JaniNextStateGenerator.h"
 
+#include <utility>
+
 #include "storm/adapters/JsonAdapter.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -56,6 +58,8 @@ JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani
       evaluateRewardExpressionsAtDestinations(false) {
     STORM_LOG_THROW(!this->options.isBuildChoiceLabelsSet(), storm::exceptions::NotSupportedException,
                     "JANI next-state generator cannot generate choice labels.");
+    STORM_LOG_WARN_COND(!this->options.isApplySymmetryReductionSet() && !this->options.isApplyPartialOrderReductionSet(),
+                        "The JANI next-state generator does not support symmetry and partial order reduction. The full model is built.");
 
     auto features = this->model.getModelFeatures();
     features.remove(storm::jani::ModelFeature::DerivedOperators);
@@ -104,6 +108,7 @@ JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani
     this->transientVariableInformation = TransientVariableInformation<ValueType>(this->model, this->parallelAutomata);
     this->transientVariableInformation.registerArrayVariableReplacements(arrayEliminatorData);
     this->initializeSpecialStates();
+    this->initializeIntervalGuards();
 
     // Create a proper evaluator.
     this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(this->model.getManager());
@@ -633,6 +638,7 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
 
     // Prepare the result, in case we return early.
     StateBehavior<ValueType, StateType> result;
+    bool const intervalGuardsEvaluatedForState = std::exchange(intervalGuardsEvaluated, false);
 
     // Retrieve the locations from the state.
     std::vector<uint64_t> locations = getLocations(*this->state);
@@ -660,6 +666,9 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
 
     // Get all choices for the state.
     result.setExpanded();
+    if (!intervalGuardsEvaluatedForState) {
+        intervalGuards.evaluate(*this->state);
+    }
     std::vector<Choice<ValueType>> allChoices;
     if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
         // First explore only edges without a rate
@@ -681,7 +690,7 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
 
     // If the model is a deterministic model, we need to fuse the choices into one.
     if (this->isDeterministicModel() && totalNumberOfChoices > 1) {
-        Choice<ValueType> globalChoice;
+        Choice<ValueType> globalChoice = this->createChoice();
 
         if (this->options.isAddOverlappingGuardLabelSet()) {
             this->overlappingGuardStates->push_back(stateToIdCallback(*this->state));
@@ -721,6 +730,9 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
         globalChoice.addRewards(std::move(stateActionRewards));
 
         // Move the newly fused choice in place.
+        for (auto& choice : allChoices) {
+            this->recycleChoice(std::move(choice));
+        }
         allChoices.clear();
         allChoices.push_back(std::move(globalChoice));
     }
@@ -735,6 +747,20 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
     return result;
 }
 
+template<typename ValueType, typename StateType>
+void JaniNextStateGenerator<ValueType, StateType>::expandBatch(std::vector<CompressedState const*> const& states, StateToIdCallback const& stateToIdCallback,
+                                                               std::vector<StateBehavior<ValueType, StateType>>& behaviors) {
+    // Evaluate the interval guards for all states at once.
+    intervalGuards.evaluate(states);
+    behaviors.reserve(behaviors.size() + states.size());
+    for (uint64_t position = 0; position < states.size(); ++position) {
+        this->load(*states[position]);
+        intervalGuards.selectState(position);
+        intervalGuardsEvaluated = true;
+        behaviors.push_back(expand(stateToIdCallback));
+    }
+}
+
 template<typename ValueType, typename StateType>
 Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex,
                                                                                            uint64_t automatonIndex, CompressedState const& state,
@@ -745,7 +771,7 @@ Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchro
         exitRate = this->evaluator->asRational(edge.getRate());
     }
 
-    Choice<ValueType> choice(edge.getActionIndex(), static_cast<bool>(exitRate));
+    Choice<ValueType> choice = this->createChoice(edge.getActionIndex(), static_cast<bool>(exitRate));
     std::vector<ValueType> stateActionRewards;
 
     // Perform the transient edge assignments and create the state action rewards
@@ -971,7 +997,7 @@ void JaniNextStateGenerator<ValueType, StateType>::expandSynchronizingEdgeCombin
         iteratorList[i] = edgeCombination[i].second.cbegin();
     }
 
-    storm::generator::Distribution<StateType, ValueType> distribution;
+    storm::generator::Distribution<StateType, ValueType>& distribution = synchronizedDistribution;
 
     // As long as there is one feasible combination of commands, keep on expanding it.
     bool done = false;
@@ -988,7 +1014,7 @@ void JaniNextStateGenerator<ValueType, StateType>::expandSynchronizingEdgeCombin
         // At this point, we applied all commands of the current command combination and newTargetStates
         // contains all target states and their respective probabilities. That means we are now ready to
         // add the choice to the list of transitions.
-        newChoices.emplace_back(outputActionIndex);
+        newChoices.push_back(this->createChoice(outputActionIndex));
 
         // Now create the actual distribution.
         Choice<ValueType>& choice = newChoices.back();
@@ -1040,10 +1066,11 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                                                                                               CompressedState const& state, StateToIdCallback stateToIdCallback,
                                                                                               EdgeFilter const& edgeFilter) {
     std::vector<Choice<ValueType>> result;
+    startGuardEvaluations();
 
     // To avoid reallocations, we declare some memory here here.
-    // This vector will store for each automaton the set of edges with the current output and the current source location
-    std::vector<EdgeSetWithIndices const*> edgeSetsMemory;
+    // This vector will store for each automaton the range of edges with the current output and the current source location
+    std::vector<std::pair<typename EdgeSetWithIndices::const_iterator, typename EdgeSetWithIndices::const_iterator>> edgeSetsMemory;
     // This vector will store the 'first' combination of edges that is productive.
     std::vector<typename EdgeSetWithIndices::const_iterator> edgeIteratorMemory;
 
@@ -1054,28 +1081,29 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
             auto const& nonsychingEdges = edges.front();
             uint64_t automatonIndex = nonsychingEdges.first;
 
-            auto edgesIt = nonsychingEdges.second.find(locations[automatonIndex]);
-            if (edgesIt != nonsychingEdges.second.end()) {
-                for (auto const& indexAndEdge : edgesIt->second) {
-                    if (edgeFilter != EdgeFilter::All) {
-                        STORM_LOG_ASSERT(edgeFilter == EdgeFilter::WithRate || edgeFilter == EdgeFilter::WithoutRate, "Unexpected edge filter.");
-                        if ((edgeFilter == EdgeFilter::WithRate) != indexAndEdge.second->hasRate()) {
-                            continue;
-                        }
-                    }
-                    if (!this->evaluator->asBool(indexAndEdge.second->getGuard())) {
+            LocationsAndEdges const& locationsAndEdges = nonsychingEdges.second;
+            uint64_t location = locations[automatonIndex];
+            for (auto indexAndEdgeIt = locationsAndEdges.begin(location), indexAndEdgeIte = locationsAndEdges.end(location); indexAndEdgeIt != indexAndEdgeIte;
+                 ++indexAndEdgeIt) {
+                auto const& indexAndEdge = *indexAndEdgeIt;
+                if (edgeFilter != EdgeFilter::All) {
+                    STORM_LOG_ASSERT(edgeFilter == EdgeFilter::WithRate || edgeFilter == EdgeFilter::WithoutRate, "Unexpected edge filter.");
+                    if ((edgeFilter == EdgeFilter::WithRate) != indexAndEdge.second->hasRate()) {
                         continue;
                     }
+                }
+                if (!isGuardSatisfied(automatonIndex, indexAndEdge)) {
+                    continue;
+                }
 
-                    result.push_back(expandNonSynchronizingEdge(*indexAndEdge.second,
-                                                                outputAndEdges.first ? outputAndEdges.first.get() : indexAndEdge.second->getActionIndex(),
-                                                                automatonIndex, state, stateToIdCallback));
+                result.push_back(expandNonSynchronizingEdge(*indexAndEdge.second,
+                                                            outputAndEdges.first ? outputAndEdges.first.get() : indexAndEdge.second->getActionIndex(),
+                                                            automatonIndex, state, stateToIdCallback));
 
-                    if (this->getOptions().isBuildChoiceOriginsSet()) {
-                        auto modelAutomatonIndex = model.getAutomatonIndex(parallelAutomata[automatonIndex].get().getName());
-                        EdgeIndexSet edgeIndex{model.encodeAutomatonAndEdgeIndices(modelAutomatonIndex, indexAndEdge.first)};
-                        result.back().addOriginData(boost::any(std::move(edgeIndex)));
-                    }
+                if (this->getOptions().isBuildChoiceOriginsSet()) {
+                    auto modelAutomatonIndex = model.getAutomatonIndex(parallelAutomata[automatonIndex].get().getName());
+                    EdgeIndexSet edgeIndex{model.encodeAutomatonAndEdgeIndices(modelAutomatonIndex, indexAndEdge.first)};
+                    result.back().addOriginData(boost::any(std::move(edgeIndex)));
                 }
             }
         } else {
@@ -1092,22 +1120,23 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
             for (auto const& automatonAndEdges : outputAndEdges.second) {
                 uint64_t automatonIndex = automatonAndEdges.first;
                 LocationsAndEdges const& locationsAndEdges = automatonAndEdges.second;
-                auto edgesIt = locationsAndEdges.find(locations[automatonIndex]);
-                if (edgesIt == locationsAndEdges.end()) {
+                uint64_t location = locations[automatonIndex];
+                if (locationsAndEdges.begin(location) == locationsAndEdges.end(location)) {
                     productiveCombination = false;
                     break;
                 }
-                edgeSetsMemory.push_back(&edgesIt->second);
+                edgeSetsMemory.emplace_back(locationsAndEdges.begin(location), locationsAndEdges.end(location));
             }
 
             if (productiveCombination) {
                 // second, check whether each automaton has at least one enabled action
                 edgeIteratorMemory.clear();  // Store the first enabled edge in each automaton.
-                for (auto const& edgesIt : edgeSetsMemory) {
+                auto automatonAndEdgesIt = outputAndEdges.second.begin();
+                for (auto const& edgeRange : edgeSetsMemory) {
                     bool atLeastOneEdge = false;
-                    EdgeSetWithIndices const& edgeSetWithIndices = *edgesIt;
-                    for (auto indexAndEdgeIt = edgeSetWithIndices.begin(), indexAndEdgeIte = edgeSetWithIndices.end(); indexAndEdgeIt != indexAndEdgeIte;
-                         ++indexAndEdgeIt) {
+                    uint64_t automatonIndex = automatonAndEdgesIt->first;
+                    ++automatonAndEdgesIt;
+                    for (auto indexAndEdgeIt = edgeRange.first, indexAndEdgeIte = edgeRange.second; indexAndEdgeIt != indexAndEdgeIte; ++indexAndEdgeIt) {
                         // check whether we do not consider this edge
                         if (edgeFilter != EdgeFilter::All) {
                             STORM_LOG_ASSERT(edgeFilter == EdgeFilter::WithRate || edgeFilter == EdgeFilter::WithoutRate, "Unexpected edge filter.");
@@ -1116,7 +1145,7 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                             }
                         }
 
-                        if (!this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
+                        if (!isGuardSatisfied(automatonIndex, *indexAndEdgeIt)) {
                             continue;
                         }
 
@@ -1145,11 +1174,10 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                 for (auto const& automatonAndEdges : outputAndEdges.second) {
                     EdgeSetWithIndices enabledEdgesOfAutomaton;
                     uint64_t automatonIndex = automatonAndEdges.first;
-                    EdgeSetWithIndices const& edgeSetWithIndices = **edgeSetIt;
                     auto indexAndEdgeIt = *edgeIteratorIt;
                     // The first edge where the edgeIterator points to is always enabled.
                     enabledEdgesOfAutomaton.emplace_back(*indexAndEdgeIt);
-                    auto indexAndEdgeIte = edgeSetWithIndices.end();
+                    auto indexAndEdgeIte = edgeSetIt->second;
                     for (++indexAndEdgeIt; indexAndEdgeIt != indexAndEdgeIte; ++indexAndEdgeIt) {
                         // check whether we do not consider this edge
                         if (edgeFilter != EdgeFilter::All) {
@@ -1159,7 +1187,7 @@ std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::get
                             }
                         }
 
-                        if (!this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
+                        if (!isGuardSatisfied(automatonIndex, *indexAndEdgeIt)) {
                             continue;
                         }
                         // If we reach this point, the edge is considered enabled.
@@ -1215,6 +1243,12 @@ storm::models::sparse::StateLabeling JaniNextStateGenerator<ValueType, StateType
                                                                                          std::vector<StateType> const& initialStateIndices,
                                                                                          std::vector<StateType> const& deadlockStateIndices,
                                                                                          std::vector<StateType> const& unexploredStateIndices) {
+    return NextStateGenerator<ValueType, StateType>::label(stateStorage, initialStateIndices, deadlockStateIndices, unexploredStateIndices,
+                                                           getLabelExpressions());
+}
+
+template<typename ValueType, typename StateType>
+std::vector<std::pair<std::string, storm::expressions::Expression>> JaniNextStateGenerator<ValueType, StateType>::getLabelExpressions() const {
     // As in JANI we can use transient boolean variable assignments in locations to identify states, we need to
     // create a list of boolean transient variables and the expressions that define them.
     std::vector<std::pair<std::string, storm::expressions::Expression>> transientVariableExpressions;
@@ -1225,8 +1259,7 @@ storm::models::sparse::StateLabeling JaniNextStateGenerator<ValueType, StateType
             }
         }
     }
-    return NextStateGenerator<ValueType, StateType>::label(stateStorage, initialStateIndices, deadlockStateIndices, unexploredStateIndices,
-                                                           transientVariableExpressions);
+    return transientVariableExpressions;
 }
 
 template<typename ValueType, typename StateType>
@@ -1278,15 +1311,15 @@ void JaniNextStateGenerator<ValueType, StateType>::createSynchronizationInformat
         auto const& automaton = this->model.getAutomaton(topLevelComposition.asAutomatonComposition().getAutomatonName());
         this->parallelAutomata.push_back(automaton);
 
-        LocationsAndEdges locationsAndEdges;
+        EdgeSetWithIndices edgesOfAutomaton;
         uint64_t edgeIndex = 0;
         for (auto const& edge : automaton.getEdges()) {
-            locationsAndEdges[edge.getSourceLocationIndex()].emplace_back(std::make_pair(edgeIndex, &edge));
+            edgesOfAutomaton.emplace_back(std::make_pair(edgeIndex, &edge));
             ++edgeIndex;
         }
 
         AutomataAndEdges automataAndEdges;
-        automataAndEdges.emplace_back(std::make_pair(0, std::move(locationsAndEdges)));
+        automataAndEdges.emplace_back(std::make_pair(0, LocationsAndEdges(automaton.getNumberOfLocations(), edgesOfAutomaton)));
 
         this->edges.emplace_back(std::make_pair(boost::none, std::move(automataAndEdges)));
     } else {
@@ -1302,18 +1335,19 @@ void JaniNextStateGenerator<ValueType, StateType>::createSynchronizationInformat
             this->parallelAutomata.push_back(this->model.getAutomaton(composition->asAutomatonComposition().getAutomatonName()));
 
             // Add edges with silent action.
-            LocationsAndEdges locationsAndEdges;
+            EdgeSetWithIndices silentEdges;
             uint64_t edgeIndex = 0;
             for (auto const& edge : parallelAutomata.back().get().getEdges()) {
                 if (edge.getActionIndex() == storm::jani::Model::SILENT_ACTION_INDEX) {
-                    locationsAndEdges[edge.getSourceLocationIndex()].emplace_back(std::make_pair(edgeIndex, &edge));
+                    silentEdges.emplace_back(std::make_pair(edgeIndex, &edge));
                 }
                 ++edgeIndex;
             }
 
-            if (!locationsAndEdges.empty()) {
+            if (!silentEdges.empty()) {
                 AutomataAndEdges automataAndEdges;
-                automataAndEdges.emplace_back(std::make_pair(automatonIndex, std::move(locationsAndEdges)));
+                automataAndEdges.emplace_back(
+                    std::make_pair(automatonIndex, LocationsAndEdges(parallelAutomata.back().get().getNumberOfLocations(), silentEdges)));
                 this->edges.emplace_back(std::make_pair(boost::none, std::move(automataAndEdges)));
             }
             ++automatonIndex;
@@ -1327,20 +1361,21 @@ void JaniNextStateGenerator<ValueType, StateType>::createSynchronizationInformat
             uint64_t automatonIndex = 0;
             for (auto const& element : vector.getInput()) {
                 if (!storm::jani::SynchronizationVector::isNoActionInput(element)) {
-                    LocationsAndEdges locationsAndEdges;
+                    EdgeSetWithIndices edgesWithAction;
                     uint64_t actionIndex = this->model.getActionIndex(element);
                     uint64_t edgeIndex = 0;
                     for (auto const& edge : parallelAutomata[automatonIndex].get().getEdges()) {
                         if (edge.getActionIndex() == actionIndex) {
-                            locationsAndEdges[edge.getSourceLocationIndex()].emplace_back(std::make_pair(edgeIndex, &edge));
+                            edgesWithAction.emplace_back(std::make_pair(edgeIndex, &edge));
                         }
                         ++edgeIndex;
                     }
-                    if (locationsAndEdges.empty()) {
+                    if (edgesWithAction.empty()) {
                         atLeastOneEdge = false;
                         break;
                     }
-                    automataAndEdges.emplace_back(std::make_pair(automatonIndex, std::move(locationsAndEdges)));
+                    automataAndEdges.emplace_back(
+                        std::make_pair(automatonIndex, LocationsAndEdges(parallelAutomata[automatonIndex].get().getNumberOfLocations(), edgesWithAction)));
                 }
                 ++automatonIndex;
             }
@@ -1352,41 +1387,100 @@ void JaniNextStateGenerator<ValueType, StateType>::createSynchronizationInformat
     }
 
     STORM_LOG_TRACE("Number of synchronizations: " << this->edges.size() << ".");
+
+    // Reserve a guard cache entry for each edge of each automaton.
+    guardCacheOffsets.clear();
+    uint64_t numberOfEdges = 0;
+    for (auto const& automaton : parallelAutomata) {
+        guardCacheOffsets.push_back(numberOfEdges);
+        numberOfEdges += automaton.get().getNumberOfEdges();
+    }
+    guardCache.assign(numberOfEdges, std::make_pair(0ull, false));
+    guardEvaluationRound = 0;
+}
+
+template<typename ValueType, typename StateType>
+void JaniNextStateGenerator<ValueType, StateType>::initializeIntervalGuards() {
+    intervalGuards = IntervalGuardEvaluator();
+    for (uint64_t automatonIndex = 0; automatonIndex < parallelAutomata.size(); ++automatonIndex) {
+        auto const& automatonEdges = parallelAutomata[automatonIndex].get().getEdges();
+        for (uint64_t edgeIndex = 0; edgeIndex < automatonEdges.size(); ++edgeIndex) {
+            intervalGuards.addGuard(guardCacheOffsets[automatonIndex] + edgeIndex, automatonEdges[edgeIndex].getGuard(), this->variableInformation);
+        }
+    }
+    STORM_LOG_DEBUG("Evaluating " << intervalGuards.getNumberOfGuards() << " of " << guardCache.size() << " guards as interval guards at once.");
+}
+
+template<typename ValueType, typename StateType>
+JaniNextStateGenerator<ValueType, StateType>::LocationsAndEdges::LocationsAndEdges(uint64_t numberOfLocations, EdgeSetWithIndices const& edgesOfAutomaton)
+    : locationOffsets(numberOfLocations + 1, 0) {
+    // Count the edges of each location and then sort the edges (stably) by their source location.
+    for (auto const& indexAndEdge : edgesOfAutomaton) {
+        ++locationOffsets[indexAndEdge.second->getSourceLocationIndex() + 1];
+    }
+    for (uint64_t location = 0; location < numberOfLocations; ++location) {
+        locationOffsets[location + 1] += locationOffsets[location];
+    }
+    std::vector<uint64_t> nextPositions(locationOffsets.begin(), locationOffsets.end() - 1);
+    edges.resize(edgesOfAutomaton.size());
+    for (auto const& indexAndEdge : edgesOfAutomaton) {
+        edges[nextPositions[indexAndEdge.second->getSourceLocationIndex()]++] = indexAndEdge;
+    }
+}
+
+template<typename ValueType, typename StateType>
+typename JaniNextStateGenerator<ValueType, StateType>::EdgeSetWithIndices::const_iterator
+JaniNextStateGenerator<ValueType, StateType>::LocationsAndEdges::begin(uint64_t location) const {
+    return edges.begin() + locationOffsets[location];
+}
+
+template<typename ValueType, typename StateType>
+typename JaniNextStateGenerator<ValueType, StateType>::EdgeSetWithIndices::const_iterator
+JaniNextStateGenerator<ValueType, StateType>::LocationsAndEdges::end(uint64_t location) const {
+    return edges.begin() + locationOffsets[location + 1];
+}
+
+template<typename ValueType, typename StateType>
+void JaniNextStateGenerator<ValueType, StateType>::startGuardEvaluations() {
+    ++guardEvaluationRound;
+}
+
+template<typename ValueType, typename StateType>
+bool JaniNextStateGenerator<ValueType, StateType>::isGuardSatisfied(uint64_t automatonIndex,
+                                                                     std::pair<uint64_t, storm::jani::Edge const*> const& indexAndEdge) {
+    uint64_t const guardIndex = guardCacheOffsets[automatonIndex] + indexAndEdge.first;
+    if (intervalGuards.hasGuard(guardIndex)) {
+        STORM_LOG_ASSERT(intervalGuards.isSatisfied(guardIndex) == this->evaluator->asBool(indexAndEdge.second->getGuard()),
+                         "Interval guard of edge " << indexAndEdge.first << " differs from the guard.");
+        return intervalGuards.isSatisfied(guardIndex);
+    }
+    auto& cacheEntry = guardCache[guardIndex];
+    if (cacheEntry.first != guardEvaluationRound) {
+        cacheEntry.first = guardEvaluationRound;
+        cacheEntry.second = this->evaluator->asBool(indexAndEdge.second->getGuard());
+    }
+    return cacheEntry.second;
 }
 
 template<typename ValueType, typename StateType>
 std::shared_ptr<storm::storage::sparse::ChoiceOrigins> JaniNextStateGenerator<ValueType, StateType>::generateChoiceOrigins(
-    std::vector<boost::any>& dataForChoiceOrigins) const {
+    std::vector<uint32_t>&& choiceOriginIdentifiers, std::vector<boost::any>& dataOfChoiceOriginIdentifiers) const {
     if (!this->getOptions().isBuildChoiceOriginsSet()) {
         return nullptr;
     }
 
-    std::vector<uint_fast64_t> identifiers;
-    identifiers.reserve(dataForChoiceOrigins.size());
-
-    std::map<EdgeIndexSet, uint_fast64_t> edgeIndexSetToIdentifierMap;
-    // The empty edge set (i.e., the choices without origin) always has to get identifier getIdentifierForChoicesWithNoOrigin() -- which is assumed to be 0
+    // Equal origins already got the same identifier during model building, so only the data of the (few) identifiers has to be translated.
     STORM_LOG_ASSERT(storm::storage::sparse::ChoiceOrigins::getIdentifierForChoicesWithNoOrigin() == 0, "The no origin identifier is assumed to be zero");
-    edgeIndexSetToIdentifierMap.insert(std::make_pair(EdgeIndexSet(), 0));
-    uint_fast64_t currentIdentifier = 1;
-    for (boost::any& originData : dataForChoiceOrigins) {
+    STORM_LOG_ASSERT(!dataOfChoiceOriginIdentifiers.empty() && dataOfChoiceOriginIdentifiers.front().empty(), "Expected no data for choices without origin.");
+    std::vector<EdgeIndexSet> identifierToEdgeIndexSetMapping;
+    identifierToEdgeIndexSetMapping.reserve(dataOfChoiceOriginIdentifiers.size());
+    for (boost::any& originData : dataOfChoiceOriginIdentifiers) {
         STORM_LOG_ASSERT(originData.empty() || boost::any_cast<EdgeIndexSet>(&originData) != nullptr,
                          "Origin data has unexpected type: " << originData.type().name() << ".");
-
-        EdgeIndexSet currentEdgeIndexSet = originData.empty() ? EdgeIndexSet() : boost::any_cast<EdgeIndexSet>(std::move(originData));
-        auto insertionRes = edgeIndexSetToIdentifierMap.emplace(std::move(currentEdgeIndexSet), currentIdentifier);
-        identifiers.push_back(insertionRes.first->second);
-        if (insertionRes.second) {
-            ++currentIdentifier;
-        }
-    }
-
-    std::vector<EdgeIndexSet> identifierToEdgeIndexSetMapping(currentIdentifier);
-    for (auto const& setIdPair : edgeIndexSetToIdentifierMap) {
-        identifierToEdgeIndexSetMapping[setIdPair.second] = setIdPair.first;
+        identifierToEdgeIndexSetMapping.push_back(originData.empty() ? EdgeIndexSet() : boost::any_cast<EdgeIndexSet>(std::move(originData)));
     }
 
-    return std::make_shared<storm::storage::sparse::JaniChoiceOrigins>(std::make_shared<storm::jani::Model>(model), std::move(identifiers),
+    return std::make_shared<storm::storage::sparse::JaniChoiceOrigins>(std::make_shared<storm::jani::Model>(model), std::move(choiceOriginIdentifiers),
                                                                        std::move(identifierToEdgeIndexSetMapping));
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "storm/generator/IntervalGuardEvaluator.h"
 #include "storm/generator/NextStateGenerator.h"
 #include "storm/generator/TransientVariableInformation.h"
 
@@ -49,6 +50,8 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
     virtual storm::storage::sparse::StateValuationsBuilder initializeStateValuationsBuilder() const override;
 
     virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
+    virtual void expandBatch(std::vector<CompressedState const*> const& states, StateToIdCallback const& stateToIdCallback,
+                             std::vector<StateBehavior<ValueType, StateType>>& behaviors) override;
 
     /// Adds the valuation for the currently loaded state to the given builder
     virtual void addStateValuation(storm::storage::sparse::state_type const& currentStateIndex,
@@ -62,7 +65,10 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
                                                        std::vector<StateType> const& deadlockStateIndices = {},
                                                        std::vector<StateType> const& unexploredStateIndices = {}) override;
 
-    virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
+    virtual std::vector<std::pair<std::string, storm::expressions::Expression>> getLabelExpressions() const override;
+
+    virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<uint32_t>&& choiceOriginIdentifiers,
+                                                                                         std::vector<boost::any>& dataOfChoiceOriginIdentifiers) const override;
 
     /*!
      * Sets the values of all transient variables in the current state to the given evaluator.
@@ -159,7 +165,23 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
                                                  CompressedState const& state, StateToIdCallback stateToIdCallback);
 
     typedef std::vector<std::pair<uint64_t, storm::jani::Edge const*>> EdgeSetWithIndices;
-    typedef std::unordered_map<uint64_t, EdgeSetWithIndices> LocationsAndEdges;
+
+    /*!
+     * The edges of an automaton (e.g. those with a certain action) grouped by their source location. The edges of location l are stored in the flat
+     * vector of edges from position locationOffsets[l] (inclusive) to position locationOffsets[l + 1] (exclusive).
+     */
+    struct LocationsAndEdges {
+        /*!
+         * Groups the given edges (which need to be given in ascending order of their index) by their source location.
+         */
+        LocationsAndEdges(uint64_t numberOfLocations, EdgeSetWithIndices const& edgesOfAutomaton);
+
+        EdgeSetWithIndices::const_iterator begin(uint64_t location) const;
+        EdgeSetWithIndices::const_iterator end(uint64_t location) const;
+
+        std::vector<uint64_t> locationOffsets;
+        EdgeSetWithIndices edges;
+    };
     typedef std::vector<std::pair<uint64_t, LocationsAndEdges>> AutomataAndEdges;
     typedef std::pair<boost::optional<uint64_t>, AutomataAndEdges> OutputAndEdges;
 
@@ -173,6 +195,22 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
                                           storm::generator::Distribution<StateType, ValueType>& distribution, std::vector<ValueType>& stateActionRewards,
                                           EdgeIndexSet& edgeIndices, StateToIdCallback stateToIdCallback);
 
+    /*!
+     * Evaluates the guard of the edge with the given index of the given automaton in the current state. As an edge may occur in several synchronizations,
+     * the result is cached (until the next call to startGuardEvaluations) such that each guard is evaluated at most once per state.
+     */
+    bool isGuardSatisfied(uint64_t automatonIndex, std::pair<uint64_t, storm::jani::Edge const*> const& indexAndEdge);
+
+    /*!
+     * Invalidates all cached guard evaluations. This needs to be called whenever the evaluator was set to a different state.
+     */
+    void startGuardEvaluations();
+
+    /*!
+     * Collects the guards that can be evaluated by the interval guard evaluator. Requires the synchronization and variable information.
+     */
+    void initializeIntervalGuards();
+
     /*!
      * Checks the list of enabled edges for multiple synchronized writes to the same global variable.
      */
@@ -212,6 +250,21 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
     /// The vector storing the edges that need to be explored (synchronously or asynchronously).
     std::vector<OutputAndEdges> edges;
 
+    /// For each automaton, the offset of its edges in the guard cache.
+    std::vector<uint64_t> guardCacheOffsets;
+
+    /// For each edge of each automaton, the evaluation round in which its guard was last evaluated and the result.
+    std::vector<std::pair<uint64_t, bool>> guardCache;
+
+    /// The current evaluation round of the guard cache.
+    uint64_t guardEvaluationRound = 0;
+
+    /// The guards (indexed by their position in the guard cache) that are conjunctions of interval constraints. They are evaluated all at once.
+    IntervalGuardEvaluator intervalGuards;
+
+    /// Whether the interval guards have already been evaluated for the loaded state (as part of a batch).
+    bool intervalGuardsEvaluated = false;
+
     /// The names and defining expressions of reward models that need to be considered.
     std::vector<std::pair<std::string, storm::expressions::Expression>> rewardExpressions;
 
@@ -232,6 +285,9 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
 
     /// Information about the transient variables of the model.
     TransientVariableInformation<ValueType> transientVariableInformation;
+
+    /// The distribution used while combining synchronizing edges. It is a member so that its storage is reused across states.
+    storm::generator::Distribution<StateType, ValueType> synchronizedDistribution;
 };
 
 }  // namespace generator
@@ -117,6 +117,16 @@ void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state
     this->state = &state;
 }
 
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::expandBatch(std::vector<CompressedState const*> const& states, StateToIdCallback const& stateToIdCallback,
+                                                           std::vector<StateBehavior<ValueType, StateType>>& behaviors) {
+    behaviors.reserve(behaviors.size() + states.size());
+    for (auto state : states) {
+        load(*state);
+        behaviors.push_back(expand(stateToIdCallback));
+    }
+}
+
 template<typename ValueType, typename StateType>
 bool NextStateGenerator<ValueType, StateType>::satisfies(storm::expressions::Expression const& expression) const {
     if (expression.isTrue()) {
@@ -235,6 +245,25 @@ storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::l
     return result;
 }
 
+template<typename ValueType, typename StateType>
+bool NextStateGenerator<ValueType, StateType>::isLabeled(CompressedState const& state) {
+    if (!labelExpressions) {
+        labelExpressions = getLabelExpressions();
+        labelExpressions->insert(labelExpressions->end(), this->options.getExpressionLabels().begin(), this->options.getExpressionLabels().end());
+    }
+    if (this->options.isAddOutOfBoundsStateSet() && state == outOfBoundsState) {
+        return true;
+    }
+    load(state);
+    unpackTransientVariableValuesIntoEvaluator(state, *this->evaluator);
+    for (auto const& label : labelExpressions.get()) {
+        if (evaluator->asBool(label.second)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 template<typename ValueType, typename StateType>
 bool NextStateGenerator<ValueType, StateType>::isSpecialLabel(std::string const& label) const {
     return label == "init" || label == "deadlock" || label == "unexplored" || label == "overlap_guards" || label == "out_of_bounds";
@@ -247,6 +276,34 @@ void NextStateGenerator<ValueType, StateType>::unpackTransientVariableValuesInto
     // This method should be overwritten in case there are transient variables (e.g. JANI).
 }
 
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::recycle(StateBehavior<ValueType, StateType>&& behavior) {
+    for (auto& choice : behavior.getChoices()) {
+        recycleChoice(std::move(choice));
+    }
+    behavior.getChoices().clear();
+}
+
+template<typename ValueType, typename StateType>
+Choice<ValueType, StateType> NextStateGenerator<ValueType, StateType>::createChoice(uint_fast64_t actionIndex, bool markovian) {
+    if (recycledChoices.empty()) {
+        return Choice<ValueType, StateType>(actionIndex, markovian);
+    }
+    Choice<ValueType, StateType> choice = std::move(recycledChoices.back());
+    recycledChoices.pop_back();
+    choice.reset(actionIndex, markovian);
+    return choice;
+}
+
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::recycleChoice(Choice<ValueType, StateType>&& choice) {
+    // Bound the number of kept choices as they hold on to their storage.
+    uint64_t const maximalNumberOfRecycledChoices = 1024;
+    if (recycledChoices.size() < maximalNumberOfRecycledChoices) {
+        recycledChoices.push_back(std::move(choice));
+    }
+}
+
 template<typename ValueType, typename StateType>
 void NextStateGenerator<ValueType, StateType>::postprocess(StateBehavior<ValueType, StateType>& result) {
     // If the model we build is a Markov Automaton, we postprocess the choices to sum all Markovian choices
@@ -313,7 +370,7 @@ void NextStateGenerator<ValueType, StateType>::extendStateInformation(storm::jso
 
 template<typename ValueType, typename StateType>
 std::shared_ptr<storm::storage::sparse::ChoiceOrigins> NextStateGenerator<ValueType, StateType>::generateChoiceOrigins(
-    std::vector<boost::any>& /*dataForChoiceOrigins*/) const {
+    std::vector<uint32_t>&& /*choiceOriginIdentifiers*/, std::vector<boost::any>& /*dataOfChoiceOriginIdentifiers*/) const {
     STORM_LOG_ERROR_COND(!options.isBuildChoiceOriginsSet(), "Generating choice origins is not supported for the considered model format.");
     return nullptr;
 }
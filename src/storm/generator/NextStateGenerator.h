@@ -101,6 +101,21 @@ class NextStateGenerator {
 
     void load(CompressedState const& state);
     virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) = 0;
+
+    /*!
+     * Expands the given states in the given order and appends their behaviors to the given vector. This is equivalent to loading and expanding
+     * the states one after another (in particular, the callback is invoked in the same order), but allows generators to evaluate parts of the
+     * behaviors for all states at once. Afterwards, the last of the states is loaded.
+     */
+    virtual void expandBatch(std::vector<CompressedState const*> const& states, StateToIdCallback const& stateToIdCallback,
+                             std::vector<StateBehavior<ValueType, StateType>>& behaviors);
+
+    /*!
+     * Hands a behavior that is no longer needed back to the generator. The storage of its choices is reused by subsequent calls to expand, which
+     * avoids allocating the distributions of the choices for every expanded state.
+     */
+    void recycle(StateBehavior<ValueType, StateType>&& behavior);
+
     bool satisfies(storm::expressions::Expression const& expression) const;
 
     /// Adds the valuation for the currently loaded state to the given builder
@@ -126,11 +141,21 @@ class NextStateGenerator {
                                                        std::vector<StateType> const& deadlockStateIndices = {},
                                                        std::vector<StateType> const& unexploredStateIndices = {}) = 0;
 
+    /*!
+     * Retrieves whether the given state obtains one of the (non-special) labels of the labeling created by label. Note that this loads the given state.
+     */
+    bool isLabeled(CompressedState const& state);
+
     NextStateGeneratorOptions const& getOptions() const;
 
     VariableInformation const& getVariableInformation() const;
 
-    virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const;
+    /*!
+     * Creates the choice origins from the identifiers of the choices and the (distinct) origin data of each identifier, where identifier 0 refers to
+     * the choices without origin.
+     */
+    virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<uint32_t>&& choiceOriginIdentifiers,
+                                                                                         std::vector<boost::any>& dataOfChoiceOriginIdentifiers) const;
 
     /*!
      * Performs a remapping of all values stored by applying the given remapping.
@@ -145,6 +170,11 @@ class NextStateGenerator {
      */
     bool isSpecialLabel(std::string const& label) const;
 
+    /*!
+     * Retrieves the labels (and their expressions) of the input model that are to be built.
+     */
+    virtual std::vector<std::pair<std::string, storm::expressions::Expression>> getLabelExpressions() const = 0;
+
     /*!
      * Creates the state labeling for the given states using the provided labels and expressions.
      */
@@ -171,6 +201,16 @@ class NextStateGenerator {
 
     void postprocess(StateBehavior<ValueType, StateType>& result);
 
+    /*!
+     * Creates an empty choice, reusing the storage of a recycled choice if possible.
+     */
+    Choice<ValueType, StateType> createChoice(uint_fast64_t actionIndex = 0, bool markovian = false);
+
+    /*!
+     * Keeps the storage of the given choice for later use by createChoice.
+     */
+    void recycleChoice(Choice<ValueType, StateType>&& choice);
+
     /// The options to be used for next-state generation.
     NextStateGeneratorOptions options;
 
@@ -205,6 +245,13 @@ class NextStateGenerator {
     boost::optional<std::vector<uint64_t>> overlappingGuardStates;
 
     std::shared_ptr<ActionMask<ValueType, StateType>> actionMask;
+
+   private:
+    /// The labels that are checked by isLabeled (constructed upon first use).
+    boost::optional<std::vector<std::pair<std::string, storm::expressions::Expression>>> labelExpressions;
+
+    /// Choices whose storage can be reused.
+    std::vector<Choice<ValueType, StateType>> recycledChoices;
 };
 }  // namespace generator
 }  // namespace storm
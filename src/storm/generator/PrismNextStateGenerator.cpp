@@ -1,5 +1,7 @@
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include <utility>
+
 #include <boost/any.hpp>
 #include <boost/container/flat_map.hpp>
 
@@ -7,6 +9,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/StateLabeling.h"
 
+#include "storm/storage/expressions/EquivalenceChecker.h"
 #include "storm/storage/expressions/SimpleValuation.h"
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
 
@@ -21,12 +24,105 @@
 #include "storm/utility/combinatorics.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/solver.h"
 
 #include "storm/utility/vector.h"
 
 namespace storm {
 namespace generator {
 
+namespace {
+std::string toString(storm::expressions::Expression const& expression) {
+    std::stringstream stream;
+    stream << expression;
+    return stream.str();
+}
+
+// Retrieves the boolean and integer variables of the given module in the order of their declaration.
+std::vector<storm::expressions::Variable> getLocalVariables(storm::prism::Module const& module) {
+    std::vector<storm::expressions::Variable> result;
+    for (auto const& variable : module.getBooleanVariables()) {
+        result.push_back(variable.getExpressionVariable());
+    }
+    for (auto const& variable : module.getIntegerVariables()) {
+        result.push_back(variable.getExpressionVariable());
+    }
+    return result;
+}
+
+// Checks whether the second module is obtained from the first one by renaming the i-th local variable of the first module to the i-th local variable of
+// the second module (which is what renaming a module in PRISM does, as it preserves the order of the declarations).
+bool isReplica(storm::prism::Module const& first, storm::prism::Module const& second) {
+    if (first.getBooleanVariables().size() != second.getBooleanVariables().size() ||
+        first.getIntegerVariables().size() != second.getIntegerVariables().size() || first.getNumberOfCommands() != second.getNumberOfCommands() ||
+        !first.getClockVariables().empty() || !second.getClockVariables().empty()) {
+        return false;
+    }
+    auto sameOptionalExpression = [](bool firstHasExpression, storm::expressions::Expression const& firstExpression, bool secondHasExpression,
+                                     storm::expressions::Expression const& secondExpression) {
+        return firstHasExpression == secondHasExpression && (!firstHasExpression || toString(firstExpression) == toString(secondExpression));
+    };
+    for (uint64_t index = 0; index < first.getBooleanVariables().size(); ++index) {
+        auto const& firstVariable = first.getBooleanVariables()[index];
+        auto const& secondVariable = second.getBooleanVariables()[index];
+        if (!sameOptionalExpression(firstVariable.hasInitialValue(), firstVariable.getInitialValueExpression(), secondVariable.hasInitialValue(),
+                                    secondVariable.getInitialValueExpression())) {
+            return false;
+        }
+    }
+    for (uint64_t index = 0; index < first.getIntegerVariables().size(); ++index) {
+        auto const& firstVariable = first.getIntegerVariables()[index];
+        auto const& secondVariable = second.getIntegerVariables()[index];
+        if (!sameOptionalExpression(firstVariable.hasInitialValue(), firstVariable.getInitialValueExpression(), secondVariable.hasInitialValue(),
+                                    secondVariable.getInitialValueExpression()) ||
+            !sameOptionalExpression(firstVariable.hasLowerBoundExpression(), firstVariable.getLowerBoundExpression(),
+                                    secondVariable.hasLowerBoundExpression(), secondVariable.getLowerBoundExpression()) ||
+            !sameOptionalExpression(firstVariable.hasUpperBoundExpression(), firstVariable.getUpperBoundExpression(),
+                                    secondVariable.hasUpperBoundExpression(), secondVariable.getUpperBoundExpression())) {
+            return false;
+        }
+    }
+
+    std::vector<storm::expressions::Variable> firstVariables = getLocalVariables(first);
+    std::vector<storm::expressions::Variable> secondVariables = getLocalVariables(second);
+    std::map<storm::expressions::Variable, storm::expressions::Expression> substitution;
+    std::map<storm::expressions::Variable, storm::expressions::Variable> renaming;
+    for (uint64_t index = 0; index < firstVariables.size(); ++index) {
+        substitution.emplace(firstVariables[index], secondVariables[index].getExpression());
+        renaming.emplace(firstVariables[index], secondVariables[index]);
+    }
+    for (uint64_t commandIndex = 0; commandIndex < first.getNumberOfCommands(); ++commandIndex) {
+        auto const& firstCommand = first.getCommand(commandIndex);
+        auto const& secondCommand = second.getCommand(commandIndex);
+        if (firstCommand.isMarkovian() != secondCommand.isMarkovian() || firstCommand.getActionIndex() != secondCommand.getActionIndex() ||
+            firstCommand.getNumberOfUpdates() != secondCommand.getNumberOfUpdates() ||
+            toString(firstCommand.getGuardExpression().substitute(substitution)) != toString(secondCommand.getGuardExpression())) {
+            return false;
+        }
+        for (uint64_t updateIndex = 0; updateIndex < firstCommand.getNumberOfUpdates(); ++updateIndex) {
+            auto const& firstUpdate = firstCommand.getUpdate(updateIndex);
+            auto const& secondUpdate = secondCommand.getUpdate(updateIndex);
+            if (firstUpdate.getNumberOfAssignments() != secondUpdate.getNumberOfAssignments() ||
+                toString(firstUpdate.getLikelihoodExpression().substitute(substitution)) != toString(secondUpdate.getLikelihoodExpression())) {
+                return false;
+            }
+            std::map<storm::expressions::Variable, std::string> secondAssignments;
+            for (auto const& assignment : secondUpdate.getAssignments()) {
+                secondAssignments.emplace(assignment.getVariable(), toString(assignment.getExpression()));
+            }
+            for (auto const& assignment : firstUpdate.getAssignments()) {
+                auto renamingIt = renaming.find(assignment.getVariable());
+                auto it = secondAssignments.find(renamingIt == renaming.end() ? assignment.getVariable() : renamingIt->second);
+                if (it == secondAssignments.end() || it->second != toString(assignment.getExpression().substitute(substitution))) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+}  // namespace
+
 template<typename ValueType, typename StateType>
 PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options,
                                                                        std::shared_ptr<ActionMask<ValueType, StateType>> const& mask)
@@ -49,6 +145,7 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
 
     // Create a proper evaluator.
     this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
+    compileExpressions();
 
     if (this->options.isBuildAllRewardModelsSet()) {
         for (auto const& rewardModel : this->program.getRewardModels()) {
@@ -101,6 +198,60 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
         moduleIndexToPlayerIndexMap = program.buildModuleIndexToPlayerIndexMap();
         actionIndexToPlayerIndexMap = program.buildActionIndexToPlayerIndexMap();
     }
+
+    if (this->options.isApplySymmetryReductionSet()) {
+        initializeSymmetryReduction();
+    }
+    if (this->options.isApplyPartialOrderReductionSet()) {
+        initializePartialOrderReduction();
+    }
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::compileExpressions() {
+    uint64_t numberOfCompiledExpressions = 0, numberOfExpressions = 0;
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            if (command.getGlobalIndex() >= compiledGuards.size()) {
+                compiledGuards.resize(command.getGlobalIndex() + 1);
+            }
+            auto& compiledGuard = compiledGuards[command.getGlobalIndex()];
+            compiledGuard = CompiledStateExpression::compile(command.getGuardExpression(), this->variableInformation);
+            numberOfCompiledExpressions += compiledGuard ? 1 : 0;
+            ++numberOfExpressions;
+            intervalGuards.addGuard(command.getGlobalIndex(), command.getGuardExpression(), this->variableInformation);
+            for (auto const& update : command.getUpdates()) {
+                if (update.getGlobalIndex() >= compiledAssignments.size()) {
+                    compiledAssignments.resize(update.getGlobalIndex() + 1);
+                }
+                auto& compiledUpdate = compiledAssignments[update.getGlobalIndex()];
+                compiledUpdate.clear();
+                for (auto const& assignment : update.getAssignments()) {
+                    compiledUpdate.push_back(CompiledStateExpression::compile(assignment.getExpression(), this->variableInformation));
+                    numberOfCompiledExpressions += compiledUpdate.back() ? 1 : 0;
+                    ++numberOfExpressions;
+                }
+            }
+        }
+    }
+    STORM_LOG_DEBUG("Compiled " << numberOfCompiledExpressions << " of " << numberOfExpressions << " guards and assignments.");
+    STORM_LOG_DEBUG("Evaluating " << intervalGuards.getNumberOfGuards() << " interval guards at once.");
+}
+
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::isGuardSatisfied(storm::prism::Command const& command) const {
+    if (intervalGuards.hasGuard(command.getGlobalIndex())) {
+        STORM_LOG_ASSERT(intervalGuards.isSatisfied(command.getGlobalIndex()) == this->evaluator->asBool(command.getGuardExpression()),
+                         "Interval guard of command " << command << " differs from the guard.");
+        return intervalGuards.isSatisfied(command.getGlobalIndex());
+    }
+    auto const& compiledGuard = compiledGuards[command.getGlobalIndex()];
+    if (compiledGuard) {
+        STORM_LOG_ASSERT(compiledGuard->evaluateAsBool(*this->state) == this->evaluator->asBool(command.getGuardExpression()),
+                         "Compiled guard of command " << command << " differs from the guard.");
+        return compiledGuard->evaluateAsBool(*this->state);
+    }
+    return this->evaluator->asBool(command.getGuardExpression());
 }
 
 template<typename ValueType, typename StateType>
@@ -181,6 +332,13 @@ template<typename ValueType, typename StateType>
 std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& stateToIdCallback) {
     std::vector<StateType> initialStateIndices;
 
+    // With symmetry reduction, the canonical representatives of the initial states are registered instead of the initial states themselves.
+    StateToIdCallback canonicalStateToIdCallback;
+    if (!symmetryGroups.empty()) {
+        canonicalStateToIdCallback = createCanonicalStateToIdCallback(stateToIdCallback);
+    }
+    StateToIdCallback const& initialStateToIdCallback = symmetryGroups.empty() ? stateToIdCallback : canonicalStateToIdCallback;
+
     // If all states are initial, we can simplify the enumeration substantially.
     if (program.hasInitialConstruct() && program.getInitialStatesExpression().isTrue()) {
         // Create vectors holding all possible values
@@ -220,9 +378,9 @@ std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitial
                     initialState.set(boolVar.bitOffset, static_cast<bool>(value));
                 }
             },
-            [&stateToIdCallback, &initialStateIndices, &initialState]() {
+            [&initialStateToIdCallback, &initialStateIndices, &initialState]() {
                 // Register initial state.
-                StateType id = stateToIdCallback(initialState);
+                StateType id = initialStateToIdCallback(initialState);
                 initialStateIndices.push_back(id);
                 return true;  // Keep on exploring
             });
@@ -262,7 +420,7 @@ std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitial
             }
 
             // Register initial state and return it.
-            StateType id = stateToIdCallback(initialState);
+            StateType id = initialStateToIdCallback(initialState);
             initialStateIndices.push_back(id);
 
             // Block the current initial state to search for the next one.
@@ -275,6 +433,12 @@ std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitial
         STORM_LOG_DEBUG("Enumerated " << initialStateIndices.size() << " initial states using SMT solving.");
     }
 
+    // Several initial states may have the same canonical representative.
+    if (!symmetryGroups.empty()) {
+        std::sort(initialStateIndices.begin(), initialStateIndices.end());
+        initialStateIndices.erase(std::unique(initialStateIndices.begin(), initialStateIndices.end()), initialStateIndices.end());
+    }
+
     return initialStateIndices;
 }
 
@@ -282,6 +446,7 @@ template<typename ValueType, typename StateType>
 StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
     // Prepare the result, in case we return early.
     StateBehavior<ValueType, StateType> result;
+    bool const intervalGuardsEvaluatedForState = std::exchange(intervalGuardsEvaluated, false);
 
     // First, construct the state rewards, as we may return early if there are no choices later and we already
     // need the state rewards then.
@@ -308,20 +473,36 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
     // Get all choices for the state.
     result.setExpanded();
+    if (!intervalGuardsEvaluatedForState) {
+        intervalGuards.evaluate(*this->state);
+    }
+
+    // With symmetry reduction, the canonical representatives of the successor states are registered instead of the successor states themselves.
+    StateToIdCallback canonicalStateToIdCallback;
+    if (!symmetryGroups.empty()) {
+        canonicalStateToIdCallback = createCanonicalStateToIdCallback(stateToIdCallback);
+    }
+    StateToIdCallback const& successorStateToIdCallback = symmetryGroups.empty() ? stateToIdCallback : canonicalStateToIdCallback;
 
     std::vector<Choice<ValueType>> allChoices;
-    if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
+    std::optional<Choice<ValueType>> ampleChoice;
+    if (!partialOrderReductionCommands.empty()) {
+        ampleChoice = getAmpleChoice(successorStateToIdCallback, stateToIdCallback);
+    }
+    if (ampleChoice) {
+        allChoices.push_back(std::move(ampleChoice.value()));
+    } else if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
         // First explore only edges without a rate
-        allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
-        addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
+        allChoices = getAsynchronousChoices(*this->state, successorStateToIdCallback, CommandFilter::Probabilistic);
+        addSynchronousChoices(allChoices, *this->state, successorStateToIdCallback, CommandFilter::Probabilistic);
         if (allChoices.empty()) {
             // Expand the Markovian edges if there are no probabilistic ones.
-            allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Markovian);
-            addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Markovian);
+            allChoices = getAsynchronousChoices(*this->state, successorStateToIdCallback, CommandFilter::Markovian);
+            addSynchronousChoices(allChoices, *this->state, successorStateToIdCallback, CommandFilter::Markovian);
         }
     } else {
-        allChoices = getAsynchronousChoices(*this->state, stateToIdCallback);
-        addSynchronousChoices(allChoices, *this->state, stateToIdCallback);
+        allChoices = getAsynchronousChoices(*this->state, successorStateToIdCallback);
+        addSynchronousChoices(allChoices, *this->state, successorStateToIdCallback);
     }
 
     std::size_t totalNumberOfChoices = allChoices.size();
@@ -334,7 +515,7 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
     // If the model is a deterministic model, we need to fuse the choices into one.
     if (this->isDeterministicModel() && totalNumberOfChoices > 1) {
-        Choice<ValueType> globalChoice;
+        Choice<ValueType> globalChoice = this->createChoice();
 
         if (this->options.isAddOverlappingGuardLabelSet()) {
             this->overlappingGuardStates->push_back(stateToIdCallback(*this->state));
@@ -387,6 +568,9 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
         }
 
         // Move the newly fused choice in place.
+        for (auto& choice : allChoices) {
+            this->recycleChoice(std::move(choice));
+        }
         allChoices.clear();
         allChoices.push_back(std::move(globalChoice));
     }
@@ -424,6 +608,20 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
     return result;
 }
 
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::expandBatch(std::vector<CompressedState const*> const& states, StateToIdCallback const& stateToIdCallback,
+                                                                std::vector<StateBehavior<ValueType, StateType>>& behaviors) {
+    // Evaluate the interval guards for all states at once.
+    intervalGuards.evaluate(states);
+    behaviors.reserve(behaviors.size() + states.size());
+    for (uint64_t position = 0; position < states.size(); ++position) {
+        this->load(*states[position]);
+        intervalGuards.selectState(position);
+        intervalGuardsEvaluated = true;
+        behaviors.push_back(expand(stateToIdCallback));
+    }
+}
+
 template<typename ValueType, typename StateType>
 bool PrismNextStateGenerator<ValueType, StateType>::evaluateBooleanExpressionInCurrentState(expressions::Expression const& expr) const {
     return this->evaluator->asBool(expr);
@@ -440,23 +638,26 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
 
     auto assignmentIt = update.getAssignments().begin();
     auto assignmentIte = update.getAssignments().end();
+    auto compiledAssignmentIt = compiledAssignments[update.getGlobalIndex()].begin();
 
     // Iterate over all boolean assignments and carry them out.
     auto boolIt = this->variableInformation.booleanVariables.begin();
-    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt) {
+    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt, ++compiledAssignmentIt) {
         while (assignmentIt->getVariable() != boolIt->variable) {
             ++boolIt;
         }
-        newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+        newState.set(boolIt->bitOffset,
+                     *compiledAssignmentIt ? (*compiledAssignmentIt)->evaluateAsBool(*this->state) : this->evaluator->asBool(assignmentIt->getExpression()));
     }
 
     // Iterate over all integer assignments and carry them out.
     auto integerIt = this->variableInformation.integerVariables.begin();
-    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt) {
+    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt, ++compiledAssignmentIt) {
         while (assignmentIt->getVariable() != integerIt->variable) {
             ++integerIt;
         }
-        int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+        int_fast64_t assignedValue =
+            *compiledAssignmentIt ? (*compiledAssignmentIt)->evaluateAsInt(*this->state) : this->evaluator->asInt(assignmentIt->getExpression());
         if (this->options.isAddOutOfBoundsStateSet()) {
             if (assignedValue < integerIt->lowerBound || assignedValue > integerIt->upperBound) {
                 return this->outOfBoundsState;
@@ -531,7 +732,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isGuardSatisfied(command)) {
                 // Found the first enabled command for this module.
                 hasOneEnabledCommand = true;
                 activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
@@ -565,7 +766,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isGuardSatisfied(command)) {
                 commands.push_back(command);
             }
         }
@@ -577,6 +778,71 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
     return result;
 }
 
+template<typename ValueType, typename StateType>
+Choice<ValueType> PrismNextStateGenerator<ValueType, StateType>::createAsynchronousChoice(uint64_t moduleIndex, storm::prism::Command const& command,
+                                                                                         CompressedState const& state,
+                                                                                         StateToIdCallback const& stateToIdCallback) {
+    Choice<ValueType> choice = this->createChoice(command.getActionIndex(), command.isMarkovian());
+
+    // Remember the choice origin only if we were asked to.
+    if (this->options.isBuildChoiceOriginsSet()) {
+        CommandSet commandIndex{command.getGlobalIndex()};
+        choice.addOriginData(boost::any(std::move(commandIndex)));
+    }
+
+    // Iterate over all updates of the current command.
+    ValueType probabilitySum = storm::utility::zero<ValueType>();
+    for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
+        storm::prism::Update const& update = command.getUpdate(k);
+
+        ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+        if (probability != storm::utility::zero<ValueType>()) {
+            // Obtain target state index and add it to the list of known states. If it has not yet been
+            // seen, we also add it to the set of states that have yet to be explored.
+            StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
+
+            // Update the choice by adding the probability/target state to it.
+            choice.addProbability(stateIndex, probability);
+            if (this->options.isExplorationChecksSet()) {
+                probabilitySum += probability;
+            }
+        }
+    }
+
+    // Create the state-action reward for the newly created choice.
+    for (auto const& rewardModel : rewardModels) {
+        ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
+        if (rewardModel.get().hasStateActionRewards()) {
+            for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
+                    this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
+                    stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
+                }
+            }
+        }
+        choice.addReward(stateActionRewardValue);
+    }
+
+    if (this->options.isBuildChoiceLabelsSet() && command.isLabeled()) {
+        choice.addLabel(program.getActionName(command.getActionIndex()));
+    }
+
+    if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
+        storm::storage::PlayerIndex const& playerOfModule = moduleIndexToPlayerIndexMap.at(moduleIndex);
+        STORM_LOG_THROW(playerOfModule != storm::storage::INVALID_PLAYER_INDEX, storm::exceptions::WrongFormatException,
+                        "Module " << program.getModule(moduleIndex).getName()
+                                  << " is not owned by any player but has at least one enabled, unlabeled command.");
+        choice.setPlayerIndex(playerOfModule);
+    }
+
+    if (this->options.isExplorationChecksSet()) {
+        // Check that the resulting distribution is in fact a distribution.
+        STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException,
+                        "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
+    }
+    return choice;
+}
+
 template<typename ValueType, typename StateType>
 std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAsynchronousChoices(CompressedState const& state,
                                                                                                      StateToIdCallback stateToIdCallback,
@@ -608,68 +874,11 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
 
             // Skip the command, if it is not enabled.
-            if (!this->evaluator->asBool(command.getGuardExpression())) {
+            if (!isGuardSatisfied(command)) {
                 continue;
             }
 
-            result.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
-            Choice<ValueType>& choice = result.back();
-
-            // Remember the choice origin only if we were asked to.
-            if (this->options.isBuildChoiceOriginsSet()) {
-                CommandSet commandIndex{command.getGlobalIndex()};
-                choice.addOriginData(boost::any(std::move(commandIndex)));
-            }
-
-            // Iterate over all updates of the current command.
-            ValueType probabilitySum = storm::utility::zero<ValueType>();
-            for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
-                storm::prism::Update const& update = command.getUpdate(k);
-
-                ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
-                if (probability != storm::utility::zero<ValueType>()) {
-                    // Obtain target state index and add it to the list of known states. If it has not yet been
-                    // seen, we also add it to the set of states that have yet to be explored.
-                    StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
-
-                    // Update the choice by adding the probability/target state to it.
-                    choice.addProbability(stateIndex, probability);
-                    if (this->options.isExplorationChecksSet()) {
-                        probabilitySum += probability;
-                    }
-                }
-            }
-
-            // Create the state-action reward for the newly created choice.
-            for (auto const& rewardModel : rewardModels) {
-                ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                if (rewardModel.get().hasStateActionRewards()) {
-                    for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                        if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
-                            this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                            stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
-                        }
-                    }
-                }
-                choice.addReward(stateActionRewardValue);
-            }
-
-            if (this->options.isBuildChoiceLabelsSet() && command.isLabeled()) {
-                choice.addLabel(program.getActionName(command.getActionIndex()));
-            }
-
-            if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
-                storm::storage::PlayerIndex const& playerOfModule = moduleIndexToPlayerIndexMap.at(i);
-                STORM_LOG_THROW(playerOfModule != storm::storage::INVALID_PLAYER_INDEX, storm::exceptions::WrongFormatException,
-                                "Module " << module.getName() << " is not owned by any player but has at least one enabled, unlabeled command.");
-                choice.setPlayerIndex(playerOfModule);
-            }
-
-            if (this->options.isExplorationChecksSet()) {
-                // Check that the resulting distribution is in fact a distribution.
-                STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException,
-                                "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
-            }
+            result.push_back(createAsynchronousChoice(i, command, state, stateToIdCallback));
         }
     }
 
@@ -720,7 +929,7 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
                 iteratorList[i] = activeCommandList[i].cbegin();
             }
 
-            storm::generator::Distribution<StateType, ValueType> distribution;
+            storm::generator::Distribution<StateType, ValueType>& distribution = synchronizedDistribution;
 
             // As long as there is one feasible combination of commands, keep on expanding it.
             bool done = false;
@@ -732,7 +941,7 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
                 // At this point, we applied all commands of the current command combination and newTargetStates
                 // contains all target states and their respective probabilities. That means we are now ready to
                 // add the choice to the list of transitions.
-                choices.push_back(Choice<ValueType>(actionIndex));
+                choices.push_back(this->createChoice(actionIndex));
 
                 // Now create the actual distribution.
                 Choice<ValueType>& choice = choices.back();
@@ -816,6 +1025,12 @@ storm::models::sparse::StateLabeling PrismNextStateGenerator<ValueType, StateTyp
                                                                                           std::vector<StateType> const& initialStateIndices,
                                                                                           std::vector<StateType> const& deadlockStateIndices,
                                                                                           std::vector<StateType> const& unexploredStateIndices) {
+    return NextStateGenerator<ValueType, StateType>::label(stateStorage, initialStateIndices, deadlockStateIndices, unexploredStateIndices,
+                                                           getLabelExpressions());
+}
+
+template<typename ValueType, typename StateType>
+std::vector<std::pair<std::string, storm::expressions::Expression>> PrismNextStateGenerator<ValueType, StateType>::getLabelExpressions() const {
     // Gather a vector of labels and their expressions.
     std::vector<std::pair<std::string, storm::expressions::Expression>> labels;
     if (this->options.isBuildAllLabelsSet()) {
@@ -832,8 +1047,7 @@ storm::models::sparse::StateLabeling PrismNextStateGenerator<ValueType, StateTyp
             }
         }
     }
-
-    return NextStateGenerator<ValueType, StateType>::label(stateStorage, initialStateIndices, deadlockStateIndices, unexploredStateIndices, labels);
+    return labels;
 }
 
 template<typename ValueType, typename StateType>
@@ -872,43 +1086,354 @@ storm::builder::RewardModelInformation PrismNextStateGenerator<ValueType, StateT
 
 template<typename ValueType, typename StateType>
 std::shared_ptr<storm::storage::sparse::ChoiceOrigins> PrismNextStateGenerator<ValueType, StateType>::generateChoiceOrigins(
-    std::vector<boost::any>& dataForChoiceOrigins) const {
+    std::vector<uint32_t>&& choiceOriginIdentifiers, std::vector<boost::any>& dataOfChoiceOriginIdentifiers) const {
     if (!this->getOptions().isBuildChoiceOriginsSet()) {
         return nullptr;
     }
 
-    std::vector<uint_fast64_t> identifiers;
-    identifiers.reserve(dataForChoiceOrigins.size());
-
-    std::map<CommandSet, uint_fast64_t> commandSetToIdentifierMap;
-    // The empty commandset (i.e., the choices without origin) always has to get identifier getIdentifierForChoicesWithNoOrigin() -- which is assumed to be 0
+    // Equal origins already got the same identifier during model building, so only the data of the (few) identifiers has to be translated.
     STORM_LOG_ASSERT(storm::storage::sparse::ChoiceOrigins::getIdentifierForChoicesWithNoOrigin() == 0, "The no origin identifier is assumed to be zero");
-    commandSetToIdentifierMap.insert(std::make_pair(CommandSet(), 0));
-    uint_fast64_t currentIdentifier = 1;
-    for (boost::any& originData : dataForChoiceOrigins) {
+    STORM_LOG_ASSERT(!dataOfChoiceOriginIdentifiers.empty() && dataOfChoiceOriginIdentifiers.front().empty(), "Expected no data for choices without origin.");
+    std::vector<CommandSet> identifierToCommandSetMapping;
+    identifierToCommandSetMapping.reserve(dataOfChoiceOriginIdentifiers.size());
+    for (boost::any& originData : dataOfChoiceOriginIdentifiers) {
         STORM_LOG_ASSERT(originData.empty() || boost::any_cast<CommandSet>(&originData) != nullptr,
                          "Origin data has unexpected type: " << originData.type().name() << ".");
+        identifierToCommandSetMapping.push_back(originData.empty() ? CommandSet() : boost::any_cast<CommandSet>(std::move(originData)));
+    }
 
-        CommandSet currentCommandSet = originData.empty() ? CommandSet() : boost::any_cast<CommandSet>(std::move(originData));
-        auto insertionRes = commandSetToIdentifierMap.insert(std::make_pair(std::move(currentCommandSet), currentIdentifier));
-        identifiers.push_back(insertionRes.first->second);
-        if (insertionRes.second) {
-            ++currentIdentifier;
+    return std::make_shared<storm::storage::sparse::PrismChoiceOrigins>(std::make_shared<storm::prism::Program>(program), std::move(choiceOriginIdentifiers),
+                                                                        std::move(identifierToCommandSetMapping));
+}
+
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::isCommandPotentiallySynchronizing(const prism::Command& command) const {
+    return program.getPossiblySynchronizingCommands().get(command.getGlobalIndex());
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::initializePartialOrderReduction() {
+    if (program.getModelType() != storm::prism::Program::ModelType::MDP) {
+        STORM_LOG_WARN("Partial order reduction is only supported for MDPs and is therefore not applied.");
+        return;
+    }
+    if (!rewardModels.empty()) {
+        STORM_LOG_WARN("Partial order reduction is not applied, because reward models are to be built.");
+        return;
+    }
+
+    // The variables that are read and written by the commands of each module.
+    std::vector<std::set<storm::expressions::Variable>> readVariables(program.getNumberOfModules());
+    std::vector<std::set<storm::expressions::Variable>> writtenVariables(program.getNumberOfModules());
+    std::vector<std::set<storm::expressions::Variable>> guardVariables(program.getNumberOfModules());
+    for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+        for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+            auto commandGuardVariables = command.getGuardExpression().getVariables();
+            guardVariables[moduleIndex].insert(commandGuardVariables.begin(), commandGuardVariables.end());
+            readVariables[moduleIndex].insert(commandGuardVariables.begin(), commandGuardVariables.end());
+            for (auto const& update : command.getUpdates()) {
+                auto likelihoodVariables = update.getLikelihoodExpression().getVariables();
+                readVariables[moduleIndex].insert(likelihoodVariables.begin(), likelihoodVariables.end());
+                for (auto const& assignment : update.getAssignments()) {
+                    writtenVariables[moduleIndex].insert(assignment.getVariable());
+                    auto expressionVariables = assignment.getExpression().getVariables();
+                    readVariables[moduleIndex].insert(expressionVariables.begin(), expressionVariables.end());
+                }
+            }
         }
     }
 
-    std::vector<CommandSet> identifierToCommandSetMapping(currentIdentifier);
-    for (auto const& setIdPair : commandSetToIdentifierMap) {
-        identifierToCommandSetMapping[setIdPair.second] = setIdPair.first;
+    // The variables that are visible to the labels and the terminal states.
+    std::set<storm::expressions::Variable> visibleVariables;
+    auto addVisibleVariables = [&visibleVariables](storm::expressions::Expression const& expression) {
+        auto variables = expression.getVariables();
+        visibleVariables.insert(variables.begin(), variables.end());
+    };
+    for (auto const& label : program.getLabels()) {
+        if (this->options.isBuildAllLabelsSet() || this->options.getLabelNames().count(label.getName()) > 0) {
+            addVisibleVariables(label.getStatePredicateExpression());
+        }
+    }
+    for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+        addVisibleVariables(expressionLabel.second);
+    }
+    for (auto const& expressionBool : this->terminalStates) {
+        addVisibleVariables(expressionBool.first);
     }
 
-    return std::make_shared<storm::storage::sparse::PrismChoiceOrigins>(std::make_shared<storm::prism::Program>(program), std::move(identifiers),
-                                                                        std::move(identifierToCommandSetMapping));
+    auto intersects = [](std::set<storm::expressions::Variable> const& first, std::set<storm::expressions::Variable> const& second) {
+        return std::any_of(first.begin(), first.end(), [&second](storm::expressions::Variable const& variable) { return second.count(variable) > 0; });
+    };
+
+    storm::storage::BitVector modules(program.getNumberOfModules());
+    storm::storage::BitVector commands(program.getNumberOfCommands());
+    for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+        std::set<storm::expressions::Variable> readByOthers, writtenByOthers;
+        for (uint64_t otherModuleIndex = 0; otherModuleIndex < program.getNumberOfModules(); ++otherModuleIndex) {
+            if (otherModuleIndex != moduleIndex) {
+                readByOthers.insert(readVariables[otherModuleIndex].begin(), readVariables[otherModuleIndex].end());
+                writtenByOthers.insert(writtenVariables[otherModuleIndex].begin(), writtenVariables[otherModuleIndex].end());
+            }
+        }
+        if (intersects(guardVariables[moduleIndex], writtenByOthers)) {
+            continue;
+        }
+        for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+            if (isCommandPotentiallySynchronizing(command) || command.isMarkovian()) {
+                continue;
+            }
+            std::set<storm::expressions::Variable> commandReadVariables = command.getGuardExpression().getVariables();
+            std::set<storm::expressions::Variable> commandWrittenVariables;
+            for (auto const& update : command.getUpdates()) {
+                auto likelihoodVariables = update.getLikelihoodExpression().getVariables();
+                commandReadVariables.insert(likelihoodVariables.begin(), likelihoodVariables.end());
+                for (auto const& assignment : update.getAssignments()) {
+                    commandWrittenVariables.insert(assignment.getVariable());
+                    auto expressionVariables = assignment.getExpression().getVariables();
+                    commandReadVariables.insert(expressionVariables.begin(), expressionVariables.end());
+                }
+            }
+            if (!intersects(commandReadVariables, writtenByOthers) && !intersects(commandWrittenVariables, readByOthers) &&
+                !intersects(commandWrittenVariables, writtenByOthers) && !intersects(commandWrittenVariables, visibleVariables)) {
+                commands.set(command.getGlobalIndex());
+                modules.set(moduleIndex);
+            }
+        }
+    }
+    STORM_LOG_INFO("Partial order reduction may expand " << commands.getNumberOfSetBits() << " of " << program.getNumberOfCommands()
+                                                         << " commands in isolation.");
+    if (!commands.empty()) {
+        partialOrderReductionModules = std::move(modules);
+        partialOrderReductionCommands = std::move(commands);
+    }
 }
 
 template<typename ValueType, typename StateType>
-bool PrismNextStateGenerator<ValueType, StateType>::isCommandPotentiallySynchronizing(const prism::Command& command) const {
-    return program.getPossiblySynchronizingCommands().get(command.getGlobalIndex());
+std::optional<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAmpleChoice(StateToIdCallback const& successorStateToIdCallback,
+                                                                                              StateToIdCallback const& stateToIdCallback) {
+    for (auto moduleIndex : partialOrderReductionModules) {
+        storm::prism::Module const& module = program.getModule(moduleIndex);
+        storm::prism::Command const* enabledCommand = nullptr;
+        bool multipleEnabledCommands = false;
+        for (auto const& command : module.getCommands()) {
+            if (isGuardSatisfied(command)) {
+                if (enabledCommand != nullptr) {
+                    multipleEnabledCommands = true;
+                    break;
+                }
+                enabledCommand = &command;
+            }
+        }
+        // A singleton ample set is required for probabilistic systems, so the module must have exactly one enabled command.
+        if (multipleEnabledCommands || enabledCommand == nullptr || !partialOrderReductionCommands.get(enabledCommand->getGlobalIndex())) {
+            continue;
+        }
+        if (this->actionMask != nullptr && !this->actionMask->query(*this, enabledCommand->getActionIndex())) {
+            continue;
+        }
+
+        // The successors are registered at this point, so if the ample set can not be used, the state has to be fully expanded (which includes them).
+        Choice<ValueType> choice = createAsynchronousChoice(moduleIndex, *enabledCommand, *this->state, successorStateToIdCallback);
+        StateType currentStateId = stateToIdCallback(*this->state);
+        for (auto const& stateProbabilityPair : choice) {
+            if (stateProbabilityPair.first <= currentStateId) {
+                return std::nullopt;
+            }
+        }
+        return choice;
+    }
+    return std::nullopt;
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::initializeSymmetryReduction() {
+    auto modelType = program.getModelType();
+    if (modelType != storm::prism::Program::ModelType::DTMC && modelType != storm::prism::Program::ModelType::CTMC &&
+        modelType != storm::prism::Program::ModelType::MDP) {
+        STORM_LOG_WARN("Symmetry reduction is not supported for models of type " << modelType << " and is therefore not applied.");
+        return;
+    }
+    if (this->options.isBuildChoiceOriginsSet()) {
+        STORM_LOG_WARN("Symmetry reduction is not applied, because choice origins are to be built.");
+        return;
+    }
+
+    // Group the modules such that all modules of a group are replicas of the first one.
+    std::vector<std::vector<uint64_t>> groups;
+    storm::storage::BitVector assignedModules(program.getNumberOfModules());
+    for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+        if (assignedModules.get(moduleIndex)) {
+            continue;
+        }
+        std::vector<uint64_t> group = {moduleIndex};
+        for (uint64_t otherModuleIndex = moduleIndex + 1; otherModuleIndex < program.getNumberOfModules(); ++otherModuleIndex) {
+            if (!assignedModules.get(otherModuleIndex) && isReplica(program.getModule(moduleIndex), program.getModule(otherModuleIndex))) {
+                group.push_back(otherModuleIndex);
+                assignedModules.set(otherModuleIndex);
+            }
+        }
+        if (group.size() > 1 && !getLocalVariables(program.getModule(moduleIndex)).empty()) {
+            groups.push_back(std::move(group));
+        }
+    }
+    if (groups.empty()) {
+        STORM_LOG_INFO("Symmetry reduction is not applied, because the program has no replicated modules.");
+        return;
+    }
+
+    // Every module may only refer to its own variables among the variables of replicated modules.
+    std::set<storm::expressions::Variable> replicatedVariables;
+    std::vector<std::set<storm::expressions::Variable>> ownReplicatedVariables(program.getNumberOfModules());
+    for (auto const& group : groups) {
+        for (auto moduleIndex : group) {
+            auto localVariables = getLocalVariables(program.getModule(moduleIndex));
+            ownReplicatedVariables[moduleIndex].insert(localVariables.begin(), localVariables.end());
+            replicatedVariables.insert(localVariables.begin(), localVariables.end());
+        }
+    }
+    for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+        auto const& module = program.getModule(moduleIndex);
+        for (auto const& command : module.getCommands()) {
+            std::set<storm::expressions::Variable> commandVariables = command.getGuardExpression().getVariables();
+            for (auto const& update : command.getUpdates()) {
+                auto likelihoodVariables = update.getLikelihoodExpression().getVariables();
+                commandVariables.insert(likelihoodVariables.begin(), likelihoodVariables.end());
+                for (auto const& assignment : update.getAssignments()) {
+                    commandVariables.insert(assignment.getVariable());
+                    auto expressionVariables = assignment.getExpression().getVariables();
+                    commandVariables.insert(expressionVariables.begin(), expressionVariables.end());
+                }
+            }
+            for (auto const& variable : commandVariables) {
+                if (replicatedVariables.count(variable) > 0 && ownReplicatedVariables[moduleIndex].count(variable) == 0) {
+                    STORM_LOG_WARN("Symmetry reduction is not applied, because module '" << module.getName() << "' refers to the variable '"
+                                                                                         << variable.getName() << "' of a replicated module.");
+                    return;
+                }
+            }
+        }
+    }
+
+    // Collect all expressions that need to be invariant under permutations of the replicas.
+    std::vector<storm::expressions::Expression> expressions;
+    for (auto const& label : program.getLabels()) {
+        if (this->options.isBuildAllLabelsSet() || this->options.getLabelNames().count(label.getName()) > 0) {
+            expressions.push_back(label.getStatePredicateExpression());
+        }
+    }
+    for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+        expressions.push_back(expressionLabel.second);
+    }
+    for (auto const& expressionBool : this->terminalStates) {
+        expressions.push_back(expressionBool.first);
+    }
+    for (auto const& rewardModel : rewardModels) {
+        for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+            expressions.push_back(stateReward.getStatePredicateExpression());
+            expressions.push_back(stateReward.getRewardValueExpression());
+        }
+        for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+            expressions.push_back(stateActionReward.getStatePredicateExpression());
+            expressions.push_back(stateActionReward.getRewardValueExpression());
+        }
+        for (auto const& transitionReward : rewardModel.get().getTransitionRewards()) {
+            expressions.push_back(transitionReward.getSourceStatePredicateExpression());
+            expressions.push_back(transitionReward.getTargetStatePredicateExpression());
+            expressions.push_back(transitionReward.getRewardValueExpression());
+        }
+    }
+    if (program.hasInitialConstruct()) {
+        expressions.push_back(program.getInitialStatesExpression());
+    }
+
+    // It suffices to check the invariance under swapping neighbouring replicas, as these transpositions generate all permutations. Expressions that
+    // are not syntactically invariant are checked for equivalence (within the ranges of the variables) using an SMT solver, if one is available.
+    std::unique_ptr<storm::expressions::EquivalenceChecker> equivalenceChecker;
+    for (auto const& group : groups) {
+        for (uint64_t replica = 0; replica + 1 < group.size(); ++replica) {
+            std::vector<storm::expressions::Variable> firstVariables = getLocalVariables(program.getModule(group[replica]));
+            std::vector<storm::expressions::Variable> secondVariables = getLocalVariables(program.getModule(group[replica + 1]));
+            std::map<storm::expressions::Variable, storm::expressions::Expression> transposition;
+            for (uint64_t index = 0; index < firstVariables.size(); ++index) {
+                transposition.emplace(firstVariables[index], secondVariables[index].getExpression());
+                transposition.emplace(secondVariables[index], firstVariables[index].getExpression());
+            }
+            for (auto const& expression : expressions) {
+                storm::expressions::Expression transposedExpression = expression.substitute(transposition);
+                if (toString(transposedExpression) == toString(expression)) {
+                    continue;
+                }
+                bool invariant = false;
+#if defined(STORM_HAVE_Z3) || defined(STORM_HAVE_MSAT)
+                if (!equivalenceChecker) {
+                    equivalenceChecker = std::make_unique<storm::expressions::EquivalenceChecker>(
+                        storm::utility::solver::SmtSolverFactory().create(program.getManager()));
+                    equivalenceChecker->addConstraints(program.getAllRangeExpressions());
+                }
+                invariant = equivalenceChecker->areEquivalent(expression, transposedExpression);
+#endif
+                if (!invariant) {
+                    STORM_LOG_WARN("Symmetry reduction is not applied, because the expression '" << expression << "' is not invariant under swapping modules '"
+                                                                                                  << program.getModule(group[replica]).getName() << "' and '"
+                                                                                                  << program.getModule(group[replica + 1]).getName() << "'.");
+                    return;
+                }
+            }
+        }
+    }
+
+    for (auto const& group : groups) {
+        std::vector<std::vector<std::pair<uint64_t, uint64_t>>> symmetryGroup;
+        for (auto moduleIndex : group) {
+            std::vector<std::pair<uint64_t, uint64_t>> replicaBits;
+            for (auto const& variable : getLocalVariables(program.getModule(moduleIndex))) {
+                if (variable.hasBooleanType()) {
+                    auto it = std::find_if(this->variableInformation.booleanVariables.begin(), this->variableInformation.booleanVariables.end(),
+                                           [&variable](BooleanVariableInformation const& information) { return information.variable == variable; });
+                    STORM_LOG_ASSERT(it != this->variableInformation.booleanVariables.end(), "Unknown variable " << variable.getName() << ".");
+                    replicaBits.emplace_back(it->bitOffset, 1);
+                } else {
+                    auto it = std::find_if(this->variableInformation.integerVariables.begin(), this->variableInformation.integerVariables.end(),
+                                           [&variable](IntegerVariableInformation const& information) { return information.variable == variable; });
+                    STORM_LOG_ASSERT(it != this->variableInformation.integerVariables.end(), "Unknown variable " << variable.getName() << ".");
+                    replicaBits.emplace_back(it->bitOffset, it->bitWidth);
+                }
+            }
+            symmetryGroup.push_back(std::move(replicaBits));
+        }
+        STORM_LOG_INFO("Applying symmetry reduction to " << group.size() << " replicas of module '" << program.getModule(group.front()).getName() << "'.");
+        symmetryGroups.push_back(std::move(symmetryGroup));
+    }
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::canonicalizeState(CompressedState& state) {
+    for (auto const& group : symmetryGroups) {
+        replicaValuations.resize(group.size());
+        for (uint64_t replica = 0; replica < group.size(); ++replica) {
+            auto& valuation = replicaValuations[replica];
+            valuation.clear();
+            for (auto const& [bitOffset, bitWidth] : group[replica]) {
+                valuation.push_back(state.getAsInt(bitOffset, bitWidth));
+            }
+        }
+        std::sort(replicaValuations.begin(), replicaValuations.end());
+        for (uint64_t replica = 0; replica < group.size(); ++replica) {
+            for (uint64_t index = 0; index < group[replica].size(); ++index) {
+                state.setFromInt(group[replica][index].first, group[replica][index].second, replicaValuations[replica][index]);
+            }
+        }
+    }
+}
+
+template<typename ValueType, typename StateType>
+typename PrismNextStateGenerator<ValueType, StateType>::StateToIdCallback PrismNextStateGenerator<ValueType, StateType>::createCanonicalStateToIdCallback(
+    StateToIdCallback const& stateToIdCallback) {
+    return [this, &stateToIdCallback](CompressedState const& state) {
+        CompressedState canonicalState = state;
+        canonicalizeState(canonicalState);
+        return stateToIdCallback(canonicalState);
+    };
 }
 
 template class PrismNextStateGenerator<double>;
@@ -1,6 +1,8 @@
 #ifndef STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/IntervalGuardEvaluator.h"
 #include "storm/generator/NextStateGenerator.h"
 
 #include "storm/storage/BoostTypes.h"
@@ -35,6 +37,8 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     virtual std::vector<StateType> getInitialStates(StateToIdCallback const& stateToIdCallback) override;
 
     virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
+    virtual void expandBatch(std::vector<CompressedState const*> const& states, StateToIdCallback const& stateToIdCallback,
+                             std::vector<StateBehavior<ValueType, StateType>>& behaviors) override;
     bool evaluateBooleanExpressionInCurrentState(storm::expressions::Expression const&) const;
 
     virtual std::size_t getNumberOfRewardModels() const override;
@@ -46,7 +50,10 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
                                                        std::vector<StateType> const& deadlockStateIndices = {},
                                                        std::vector<StateType> const& unexploredStateIndices = {}) override;
 
-    virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
+    virtual std::vector<std::pair<std::string, storm::expressions::Expression>> getLabelExpressions() const override;
+
+    virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<uint32_t>&& choiceOriginIdentifiers,
+                                                                                         std::vector<boost::any>& dataOfChoiceOriginIdentifiers) const override;
 
    private:
     void checkValid() const;
@@ -59,6 +66,16 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options,
                             std::shared_ptr<ActionMask<ValueType, StateType>> const&, bool flag);
 
+    /*!
+     * Compiles the guards of the commands and the assigned expressions of the updates, so that they can be evaluated directly on the compressed states.
+     */
+    void compileExpressions();
+
+    /*!
+     * Evaluates the guard of the given command in the state currently loaded into the evaluator.
+     */
+    bool isGuardSatisfied(storm::prism::Command const& command) const;
+
     /*!
      * Applies an update to the state currently loaded into the evaluator and applies the resulting values to
      * the given compressed state.
@@ -96,6 +113,12 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     std::vector<Choice<ValueType>> getAsynchronousChoices(CompressedState const& state, StateToIdCallback stateToIdCallback,
                                                           CommandFilter const& commandFilter = CommandFilter::All);
 
+    /*!
+     * Creates the choice of the given (enabled and not synchronizing) command of the module with the given index in the given state.
+     */
+    Choice<ValueType> createAsynchronousChoice(uint64_t moduleIndex, storm::prism::Command const& command, CompressedState const& state,
+                                               StateToIdCallback const& stateToIdCallback);
+
     /*!
      * Retrieves all (potentially) synchronous choices possible from the given state.
      * Note that these may include choices that run asynchronously for this state.
@@ -126,6 +149,43 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
 
     bool isCommandPotentiallySynchronizing(prism::Command const& command) const;
 
+    /*!
+     * Determines the commands that may form a singleton ample set for partial order reduction. A command qualifies if it is neither synchronizing nor
+     * Markovian, it is independent of the commands of all other modules (it neither writes a variable they read or write, nor reads a variable they
+     * write) and it does not write a variable that is visible to the labels or the terminal states. Moreover, the guards of its module may not read
+     * variables written by other modules, so that the set of enabled commands of the module can only be changed by the module itself.
+     */
+    void initializePartialOrderReduction();
+
+    /*!
+     * Tries to find an ample set for the current state, i.e., the choice of the only enabled command of some module if that command qualifies for
+     * partial order reduction (see initializePartialOrderReduction). To ensure that every cycle contains a fully expanded state, the ample set is
+     * only used if all of its successors have a larger id than the current state.
+     *
+     * @param successorStateToIdCallback The callback used to register the successor states.
+     * @param stateToIdCallback The callback used to retrieve the id of the current state.
+     * @return The choice of the ample set, if one was found.
+     */
+    std::optional<Choice<ValueType>> getAmpleChoice(StateToIdCallback const& successorStateToIdCallback, StateToIdCallback const& stateToIdCallback);
+
+    /*!
+     * Detects groups of replicated modules, i.e., modules whose commands coincide up to a renaming of their local variables. The groups are only used
+     * for symmetry reduction if the modules only refer to their own variables (among the variables of replicated modules) and all other parts of the
+     * program that affect the built model (labels, reward models, initial states, terminal states) are invariant under permutations of the replicas.
+     */
+    void initializeSymmetryReduction();
+
+    /*!
+     * Sorts the valuations of the replicas of every group of replicated modules in the given state. This yields a canonical representative of all
+     * states that only differ by a permutation of the replicas.
+     */
+    void canonicalizeState(CompressedState& state);
+
+    /*!
+     * Creates a callback that registers the canonical representative of a state via the given callback.
+     */
+    StateToIdCallback createCanonicalStateToIdCallback(StateToIdCallback const& stateToIdCallback);
+
     // The program used for the generation of next states.
     storm::prism::Program program;
 
@@ -138,6 +198,32 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     // Mappings from module/action indices to the programs players
     std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
     std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+    // The guards of the commands (indexed by the global command index) and the assigned expressions of the updates (indexed by the global update index)
+    // compiled to operate directly on the compressed states. Expressions that could not be compiled are evaluated by the evaluator instead.
+    std::vector<std::optional<CompiledStateExpression>> compiledGuards;
+    std::vector<std::vector<std::optional<CompiledStateExpression>>> compiledAssignments;
+
+    // The guards (indexed by the global command index) that are conjunctions of interval constraints. They are evaluated all at once for each state.
+    IntervalGuardEvaluator intervalGuards;
+
+    // Whether the interval guards have already been evaluated for the loaded state (as part of a batch).
+    bool intervalGuardsEvaluated = false;
+
+    // The distribution used while combining synchronizing commands. It is a member so that its storage is reused across states.
+    storm::generator::Distribution<StateType, ValueType> synchronizedDistribution;
+
+    // For every group of replicated modules used for symmetry reduction and every replica, the bit offsets and widths of the local variables of the
+    // replica. The variables of all replicas of a group appear in the same order. If empty, no symmetry reduction is applied.
+    std::vector<std::vector<std::vector<std::pair<uint64_t, uint64_t>>>> symmetryGroups;
+
+    // The modules and the commands (indexed by the global command index) that may form singleton ample sets. If empty, no partial order reduction is
+    // applied.
+    storm::storage::BitVector partialOrderReductionModules;
+    storm::storage::BitVector partialOrderReductionCommands;
+
+    // The valuations of the replicas of one group while canonicalizing a state. It is a member so that its storage is reused across states.
+    std::vector<std::vector<uint64_t>> replicaValuations;
 };
 
 }  // namespace generator
@@ -0,0 +1,255 @@
+#include "storm/io/BinaryModelExporter.h"
+
+#include <algorithm>
+#include <boost/optional.hpp>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace exporter {
+
+namespace {
+
+struct Section {
+    binary::SectionKind kind;
+    std::string name;
+    // The payload. If this is null, the owned data is written instead.
+    void const* data;
+    uint64_t size;
+    std::vector<uint64_t> ownedData;
+};
+
+Section makeSection(binary::SectionKind kind, std::string const& name, void const* data, uint64_t size) {
+    return Section{kind, name, data, size, {}};
+}
+
+Section makeSection(binary::SectionKind kind, std::string const& name, std::vector<uint64_t>&& data) {
+    uint64_t size = data.size() * sizeof(uint64_t);
+    return Section{kind, name, nullptr, size, std::move(data)};
+}
+
+std::vector<uint64_t> toWords(storm::storage::BitVector const& bitVector) {
+    std::vector<uint64_t> words((bitVector.size() + 63) / 64, 0);
+    for (auto const& bit : bitVector) {
+        words[bit / 64] |= 1ull << (bit % 64);
+    }
+    return words;
+}
+
+template<typename T>
+void writeRaw(std::ostream& os, T const& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written.");
+    os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+void writePadded(std::ostream& os, void const* data, uint64_t size) {
+    static const char zeros[binary::Alignment] = {};
+    if (size > 0) {
+        os.write(static_cast<char const*>(data), size);
+    }
+    if (size % binary::Alignment != 0) {
+        os.write(zeros, binary::Alignment - size % binary::Alignment);
+    }
+}
+
+/*!
+ * Encodes the state valuations, if they only consist of boolean and integer variables.
+ */
+boost::optional<std::vector<uint64_t>> encodeStateValuations(storm::storage::sparse::StateValuations const& valuations, uint64_t numberOfStates) {
+    if (numberOfStates == 0 || valuations.getNumberOfStates() != numberOfStates) {
+        return boost::none;
+    }
+    std::vector<uint64_t> result = {0};
+    auto firstRange = valuations.at(0);
+    uint64_t numberOfVariables = 0;
+    for (auto valueIt = firstRange.begin(); valueIt != firstRange.end(); ++valueIt) {
+        if (!valueIt.isVariableAssignment() || valueIt.isRational()) {
+            STORM_LOG_WARN("State valuations with rational variables or observation labels are not exported in the binary format.");
+            return boost::none;
+        }
+        std::string const& name = valueIt.getName();
+        result.push_back(valueIt.isBoolean() ? 0 : 1);
+        result.push_back(name.size());
+        std::vector<uint64_t> nameWords((name.size() + 7) / 8, 0);
+        std::copy(name.begin(), name.end(), reinterpret_cast<char*>(nameWords.data()));
+        result.insert(result.end(), nameWords.begin(), nameWords.end());
+        ++numberOfVariables;
+    }
+    result[0] = numberOfVariables;
+    result.reserve(result.size() + numberOfStates * numberOfVariables);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        auto range = valuations.at(state);
+        uint64_t variablesOfState = 0;
+        for (auto valueIt = range.begin(); valueIt != range.end(); ++valueIt, ++variablesOfState) {
+            STORM_LOG_THROW(valueIt.isVariableAssignment() && !valueIt.isRational(), storm::exceptions::NotSupportedException,
+                            "Inconsistent state valuations.");
+            int64_t value = valueIt.isBoolean() ? static_cast<int64_t>(valueIt.getBooleanValue()) : valueIt.getIntegerValue();
+            result.push_back(static_cast<uint64_t>(value));
+        }
+        STORM_LOG_THROW(variablesOfState == numberOfVariables, storm::exceptions::NotSupportedException, "Inconsistent state valuations.");
+    }
+    return result;
+}
+
+}  // namespace
+
+void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel) {
+    typedef storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, double> EntryType;
+    static_assert(sizeof(EntryType) == 2 * sizeof(uint64_t) && std::is_trivially_copyable_v<EntryType>, "Unexpected layout of matrix entries.");
+
+    storm::storage::SparseMatrix<double> const& matrix = sparseModel->getTransitionMatrix();
+    uint64_t const numberOfStates = sparseModel->getNumberOfStates();
+    std::vector<Section> sections;
+
+    // The transition matrix
+    std::vector<uint64_t> info = {numberOfStates, matrix.getRowCount(), matrix.getEntryCount(), matrix.getColumnCount(),
+                                  matrix.hasTrivialRowGrouping() ? 0ull : 1ull};
+    sections.push_back(makeSection(binary::SectionKind::ModelInfo, "", std::move(info)));
+    std::vector<uint64_t> rowIndications(matrix.getRowCount() + 1);
+    for (uint64_t row = 0; row <= matrix.getRowCount(); ++row) {
+        rowIndications[row] = (row == matrix.getRowCount() ? matrix.end() : matrix.begin(row)) - matrix.begin();
+    }
+    sections.push_back(makeSection(binary::SectionKind::RowIndications, "", std::move(rowIndications)));
+    sections.push_back(makeSection(binary::SectionKind::MatrixEntries, "", matrix.getEntryCount() > 0 ? &*matrix.begin() : nullptr,
+                                   matrix.getEntryCount() * sizeof(EntryType)));
+    if (!matrix.hasTrivialRowGrouping()) {
+        auto const& rowGroupIndices = matrix.getRowGroupIndices();
+        sections.push_back(makeSection(binary::SectionKind::RowGroupIndices, "", rowGroupIndices.data(), rowGroupIndices.size() * sizeof(uint64_t)));
+    }
+
+    // Labelings
+    for (auto const& label : sparseModel->getStateLabeling().getLabels()) {
+        sections.push_back(makeSection(binary::SectionKind::StateLabel, label, toWords(sparseModel->getStateLabeling().getStates(label))));
+    }
+    if (sparseModel->hasChoiceLabeling()) {
+        for (auto const& label : sparseModel->getChoiceLabeling().getLabels()) {
+            sections.push_back(makeSection(binary::SectionKind::ChoiceLabel, label, toWords(sparseModel->getChoiceLabeling().getChoices(label))));
+        }
+    }
+
+    // Reward models
+    for (auto const& [name, rewardModel] : sparseModel->getRewardModels()) {
+        STORM_LOG_THROW(!rewardModel.hasTransitionRewards(), storm::exceptions::NotSupportedException,
+                        "Transition rewards (of reward model '" << name << "') are not supported by the binary format.");
+        if (rewardModel.hasStateRewards()) {
+            auto const& rewards = rewardModel.getStateRewardVector();
+            sections.push_back(makeSection(binary::SectionKind::StateRewards, name, rewards.data(), rewards.size() * sizeof(double)));
+        }
+        if (rewardModel.hasStateActionRewards()) {
+            auto const& rewards = rewardModel.getStateActionRewardVector();
+            sections.push_back(makeSection(binary::SectionKind::StateActionRewards, name, rewards.data(), rewards.size() * sizeof(double)));
+        }
+        if (!rewardModel.hasStateRewards() && !rewardModel.hasStateActionRewards()) {
+            // Keep empty reward models.
+            sections.push_back(makeSection(binary::SectionKind::StateRewards, name, nullptr, 0));
+        }
+    }
+
+    // Model type specific components
+    if (sparseModel->getType() == storm::models::ModelType::Ctmc) {
+        auto const& exitRates = sparseModel->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector();
+        sections.push_back(makeSection(binary::SectionKind::ExitRates, "", exitRates.data(), exitRates.size() * sizeof(double)));
+    } else if (sparseModel->getType() == storm::models::ModelType::MarkovAutomaton) {
+        auto ma = sparseModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+        sections.push_back(makeSection(binary::SectionKind::ExitRates, "", ma->getExitRates().data(), ma->getExitRates().size() * sizeof(double)));
+        sections.push_back(makeSection(binary::SectionKind::MarkovianStates, "", toWords(ma->getMarkovianStates())));
+    } else if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
+        auto const& observations = sparseModel->as<storm::models::sparse::Pomdp<double>>()->getObservations();
+        sections.push_back(makeSection(binary::SectionKind::Observations, "", observations.data(), observations.size() * sizeof(uint32_t)));
+    } else {
+        STORM_LOG_THROW(sparseModel->getType() == storm::models::ModelType::Dtmc || sparseModel->getType() == storm::models::ModelType::Mdp,
+                        storm::exceptions::NotSupportedException,
+                        "Models of type " << sparseModel->getType() << " are not supported by the binary format.");
+    }
+
+    // State valuations
+    if (sparseModel->hasStateValuations()) {
+        if (auto encodedValuations = encodeStateValuations(sparseModel->getStateValuations(), numberOfStates)) {
+            sections.push_back(makeSection(binary::SectionKind::StateValuations, "", std::move(*encodedValuations)));
+        }
+    }
+
+    // Write header
+    os.write(binary::Magic, sizeof(binary::Magic));
+    writeRaw(os, binary::Version);
+    writeRaw(os, binary::ByteOrderMarker);
+    writeRaw(os, static_cast<uint32_t>(binary::ValueTypeTag::Double));
+    writeRaw(os, static_cast<uint32_t>(sparseModel->getType()));
+    writeRaw(os, static_cast<uint64_t>(sections.size()));
+
+    // Write sections
+    for (auto const& section : sections) {
+        writeRaw(os, static_cast<uint32_t>(section.kind));
+        writeRaw(os, static_cast<uint32_t>(0));
+        writeRaw(os, static_cast<uint64_t>(section.name.size()));
+        writeRaw(os, section.size);
+        writePadded(os, section.name.data(), section.name.size());
+        writePadded(os, section.data ? section.data : section.ownedData.data(), section.size);
+    }
+    STORM_LOG_THROW(os.good(), storm::exceptions::FileIoException, "Error while writing the binary model.");
+}
+
+template<typename ValueType>
+void binaryExportScheduler(std::ostream& os, storm::storage::Scheduler<ValueType> const& scheduler) {
+    STORM_LOG_THROW(scheduler.isDeterministicScheduler(), storm::exceptions::NotSupportedException,
+                    "Only deterministic schedulers can be exported in the binary format.");
+    uint64_t const numberOfModelStates = scheduler.getNumberOfModelStates();
+    uint64_t const numberOfMemoryStates = scheduler.getNumberOfMemoryStates();
+    STORM_LOG_WARN_COND(scheduler.isMemorylessScheduler(), "The memory structure of the scheduler is not exported in the binary format.");
+
+    // Write header
+    os.write(binary::SchedulerMagic, sizeof(binary::SchedulerMagic));
+    writeRaw(os, binary::SchedulerVersion);
+    writeRaw(os, binary::ByteOrderMarker);
+    writeRaw(os, numberOfModelStates);
+    writeRaw(os, numberOfMemoryStates);
+
+    // The choices are collected in blocks to avoid allocating an array for all states.
+    uint64_t const blockSize = 1ull << 16;
+    std::vector<uint32_t> choices;
+    choices.reserve(std::min(blockSize, numberOfModelStates));
+    for (uint64_t memoryState = 0; memoryState < numberOfMemoryStates; ++memoryState) {
+        storm::storage::BitVector dontCareStates(numberOfModelStates);
+        for (uint64_t blockBegin = 0; blockBegin < numberOfModelStates; blockBegin += blockSize) {
+            uint64_t const blockEnd = std::min(numberOfModelStates, blockBegin + blockSize);
+            choices.clear();
+            for (uint64_t state = blockBegin; state < blockEnd; ++state) {
+                auto const choice = scheduler.getChoice(state, memoryState);
+                if (choice.isDefined()) {
+                    STORM_LOG_THROW(choice.getDeterministicChoice() < binary::UndefinedChoice, storm::exceptions::NotSupportedException,
+                                    "The choice of state " << state << " exceeds the range of the binary format.");
+                    choices.push_back(static_cast<uint32_t>(choice.getDeterministicChoice()));
+                } else {
+                    choices.push_back(binary::UndefinedChoice);
+                }
+                if (scheduler.isDontCare(state, memoryState)) {
+                    dontCareStates.set(state);
+                }
+            }
+            os.write(reinterpret_cast<char const*>(choices.data()), choices.size() * sizeof(uint32_t));
+        }
+        if (numberOfModelStates * sizeof(uint32_t) % binary::Alignment != 0) {
+            writeRaw(os, static_cast<uint32_t>(0));
+        }
+        std::vector<uint64_t> dontCareWords = toWords(dontCareStates);
+        writePadded(os, dontCareWords.data(), dontCareWords.size() * sizeof(uint64_t));
+    }
+    STORM_LOG_THROW(os.good(), storm::exceptions::FileIoException, "Error while writing the binary scheduler.");
+}
+
+template void binaryExportScheduler(std::ostream& os, storm::storage::Scheduler<double> const& scheduler);
+template void binaryExportScheduler(std::ostream& os, storm::storage::Scheduler<storm::RationalNumber> const& scheduler);
+template void binaryExportScheduler(std::ostream& os, storm::storage::Scheduler<storm::RationalFunction> const& scheduler);
+template void binaryExportScheduler(std::ostream& os, storm::storage::Scheduler<storm::Interval> const& scheduler);
+
+}  // namespace exporter
+}  // namespace storm
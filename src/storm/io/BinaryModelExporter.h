@@ -0,0 +1,33 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/Scheduler.h"
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * Exports a sparse model into the binary model format (see BinaryModelFormat.h). The format holds the transition matrix, the state and
+ * choice labelings, the reward models, the exit rates and Markovian states of continuous-time models, the observations of POMDPs and the
+ * state valuations (if they only consist of boolean and integer variables).
+ *
+ * @param os           Stream to export to. It should be opened in binary mode
+ * @param sparseModel  Model to export
+ */
+void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel);
+
+/*!
+ * Exports a deterministic scheduler into the binary scheduler format (see BinaryModelFormat.h), i.e., the choice of every pair of a model
+ * state and a memory state and the don't care states.
+ *
+ * @param os         Stream to export to. It should be opened in binary mode
+ * @param scheduler  Scheduler to export
+ */
+template<typename ValueType>
+void binaryExportScheduler(std::ostream& os, storm::storage::Scheduler<ValueType> const& scheduler);
+
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+namespace exporter {
+namespace binary {
+
+/*
+ * Layout of the binary model format. All numbers are stored in the byte order of the exporting machine (which is checked on import):
+ *
+ * Header:
+ *   char[8]  magic ("STORMBIN")
+ *   uint32   format version
+ *   uint32   byte order marker
+ *   uint32   value type (see ValueTypeTag)
+ *   uint32   model type (as storm::models::ModelType)
+ *   uint64   number of sections
+ * Each section:
+ *   uint32   kind (see SectionKind)
+ *   uint32   reserved (0)
+ *   uint64   length of the name (in bytes)
+ *   uint64   length of the payload (in bytes)
+ *   name and payload, each padded with zeros to a multiple of 8 bytes
+ *
+ * As all payloads start at multiples of 8 bytes, the arrays can be read directly from a memory mapped file.
+ */
+
+static const char Magic[8] = {'S', 'T', 'O', 'R', 'M', 'B', 'I', 'N'};
+static const uint32_t Version = 1;
+static const uint32_t ByteOrderMarker = 0x01020304;
+static const uint64_t Alignment = 8;
+
+enum class ValueTypeTag : uint32_t { Double = 1 };
+
+enum class SectionKind : uint32_t {
+    // uint64[5]: number of states, rows, entries, columns and whether the matrix has a non-trivial row grouping
+    ModelInfo = 1,
+    // uint64[rows + 1]
+    RowIndications = 2,
+    // (uint64 column, double value)[entries], i.e., the in-memory layout of storm::storage::MatrixEntry<uint64_t, double>
+    MatrixEntries = 3,
+    // uint64[row groups + 1]
+    RowGroupIndices = 4,
+    // uint64[ceil(states / 64)], bit i of word j belongs to state 64 * j + i. The section name is the label.
+    StateLabel = 5,
+    // uint64[ceil(rows / 64)], as for state labels
+    ChoiceLabel = 6,
+    // double[states]. The section name is the name of the reward model.
+    StateRewards = 7,
+    // double[rows]. The section name is the name of the reward model.
+    StateActionRewards = 8,
+    // double[states]
+    ExitRates = 9,
+    // uint64[ceil(states / 64)], as for state labels
+    MarkovianStates = 10,
+    // uint32[states]
+    Observations = 11,
+    // uint64 number of variables, then for each variable uint64 type (0 = boolean, 1 = integer), uint64 length of the name and the name padded
+    // to a multiple of 8 bytes, followed by int64[states * variables] holding the values of all variables of state 0, state 1, ...
+    StateValuations = 12
+};
+
+/*
+ * Layout of the binary scheduler format, which holds deterministic schedulers. Numbers are stored as in the binary model format:
+ *
+ * Header:
+ *   char[8]  magic ("STORMSCH")
+ *   uint32   format version
+ *   uint32   byte order marker
+ *   uint64   number of model states
+ *   uint64   number of memory states
+ * For each memory state:
+ *   uint32[model states]  the choice of each model state (relative to the first choice of the state), padded with zeros to a multiple of 8 bytes.
+ *                         Undefined choices are given by UndefinedChoice.
+ *   uint64[ceil(model states / 64)]  the don't care states, as for state labels
+ *
+ * The memory structure of the scheduler is not part of the format.
+ */
+
+static const char SchedulerMagic[8] = {'S', 'T', 'O', 'R', 'M', 'S', 'C', 'H'};
+static const uint32_t SchedulerVersion = 1;
+static const uint32_t UndefinedChoice = 0xFFFFFFFF;
+
+}  // namespace binary
+}  // namespace exporter
+}  // namespace storm
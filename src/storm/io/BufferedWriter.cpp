@@ -0,0 +1,107 @@
+#include "storm/io/BufferedWriter.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace exporter {
+
+BufferedWriter::BufferedWriter(std::ostream& os, std::size_t bufferSize, bool asynchronous)
+    : os(os), bufferSize(std::max<std::size_t>(1, bufferSize)), asynchronous(asynchronous) {
+    // Reserve a bit more than the buffer size as the buffer is only written after it got full.
+    buffer.reserve(this->bufferSize + 1024);
+    formatDoublesDirectly = (os.flags() & std::ios_base::floatfield) == std::ios_base::fmtflags(0) && !(os.flags() & std::ios_base::showpoint) &&
+                            !(os.flags() & std::ios_base::showpos) && !(os.flags() & std::ios_base::uppercase);
+    precision = static_cast<int>(os.precision());
+    formatStream.copyfmt(os);
+}
+
+BufferedWriter::~BufferedWriter() {
+    try {
+        flush();
+    } catch (std::exception const& e) {
+        STORM_LOG_ERROR("Could not write buffered output: " << e.what());
+    }
+}
+
+BufferedWriter& BufferedWriter::operator<<(char c) {
+    buffer.push_back(c);
+    checkBuffer();
+    return *this;
+}
+
+BufferedWriter& BufferedWriter::operator<<(char const* str) {
+    buffer.append(str);
+    checkBuffer();
+    return *this;
+}
+
+BufferedWriter& BufferedWriter::operator<<(std::string const& str) {
+    buffer.append(str);
+    checkBuffer();
+    return *this;
+}
+
+BufferedWriter& BufferedWriter::operator<<(double value) {
+    if (formatDoublesDirectly) {
+        // This is the conversion that output streams perform for the default floating point format.
+        char characters[64];
+        int length = std::snprintf(characters, sizeof(characters), "%.*g", precision, value);
+        if (length > 0 && static_cast<std::size_t>(length) < sizeof(characters)) {
+            buffer.append(characters, length);
+            checkBuffer();
+            return *this;
+        }
+    }
+    formatStream.str(std::string());
+    formatStream << value;
+    buffer += formatStream.str();
+    checkBuffer();
+    return *this;
+}
+
+void BufferedWriter::writeUnsigned(uint64_t value) {
+    char characters[20];
+    char* begin = characters + sizeof(characters);
+    do {
+        *--begin = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    buffer.append(begin, characters + sizeof(characters) - begin);
+}
+
+void BufferedWriter::waitForPendingWrite() {
+    if (pendingWrite.valid()) {
+        pendingWrite.get();
+    }
+}
+
+void BufferedWriter::writeBuffer() {
+    if (!asynchronous) {
+        os.write(buffer.data(), buffer.size());
+        buffer.clear();
+        return;
+    }
+    // The previous buffer has to be written completely before its memory is reused.
+    waitForPendingWrite();
+    std::swap(buffer, writtenBuffer);
+    buffer.clear();
+    buffer.reserve(bufferSize + 1024);
+    pendingWrite = std::async(std::launch::async, [this]() { os.write(writtenBuffer.data(), writtenBuffer.size()); });
+}
+
+void BufferedWriter::flush() {
+    waitForPendingWrite();
+    if (!buffer.empty()) {
+        os.write(buffer.data(), buffer.size());
+        buffer.clear();
+    }
+    os.flush();
+    STORM_LOG_THROW(os.good(), storm::exceptions::FileIoException, "Writing to the output stream failed.");
+}
+
+}  // namespace exporter
+}  // namespace storm
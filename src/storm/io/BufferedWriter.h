@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <future>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * Collects formatted output in a large buffer which is written to the underlying stream at once whenever it is full. Integers and doubles are formatted
+ * directly into the buffer, all other values are formatted with the precision of the underlying stream. The output coincides with the output obtained
+ * by writing the values to the underlying stream directly.
+ * If asynchronous writing is enabled, a full buffer is written by a separate thread while the next buffer is filled.
+ */
+class BufferedWriter {
+   public:
+    /*!
+     * Creates a writer for the given stream.
+     *
+     * @param os The stream to which the output is written. It must not be used until the writer is flushed.
+     * @param bufferSize The number of bytes that are collected before they are written to the stream.
+     * @param asynchronous If true, full buffers are written by a separate thread.
+     */
+    BufferedWriter(std::ostream& os, std::size_t bufferSize = 1ull << 24, bool asynchronous = true);
+
+    /*!
+     * Writes the remaining output to the stream. Errors are only reported by flush().
+     */
+    ~BufferedWriter();
+
+    BufferedWriter(BufferedWriter const&) = delete;
+    BufferedWriter& operator=(BufferedWriter const&) = delete;
+
+    BufferedWriter& operator<<(char c);
+    BufferedWriter& operator<<(char const* str);
+    BufferedWriter& operator<<(std::string const& str);
+    BufferedWriter& operator<<(double value);
+
+    template<typename IntegerType, typename std::enable_if<std::is_integral<IntegerType>::value && !std::is_same<IntegerType, char>::value &&
+                                                               !std::is_same<IntegerType, bool>::value,
+                                                           int>::type = 0>
+    BufferedWriter& operator<<(IntegerType value) {
+        if constexpr (std::is_signed<IntegerType>::value) {
+            if (value < 0) {
+                buffer.push_back('-');
+                // Negating the smallest value would overflow, so the conversion to unsigned is done first
+                writeUnsigned(static_cast<uint64_t>(0) - static_cast<uint64_t>(value));
+            } else {
+                writeUnsigned(static_cast<uint64_t>(value));
+            }
+        } else {
+            writeUnsigned(static_cast<uint64_t>(value));
+        }
+        checkBuffer();
+        return *this;
+    }
+
+    template<typename ValueType, typename std::enable_if<!std::is_arithmetic<ValueType>::value, int>::type = 0>
+    BufferedWriter& operator<<(ValueType const& value) {
+        formatStream.str(std::string());
+        formatStream << value;
+        buffer += formatStream.str();
+        checkBuffer();
+        return *this;
+    }
+
+    /*!
+     * Writes all collected output to the stream and waits until it is written.
+     * Throws a FileIoException if the stream reports an error.
+     */
+    void flush();
+
+   private:
+    void writeUnsigned(uint64_t value);
+
+    /*!
+     * Hands the buffer over to the stream if it is full.
+     */
+    void checkBuffer() {
+        if (buffer.size() >= bufferSize) {
+            writeBuffer();
+        }
+    }
+
+    void writeBuffer();
+    void waitForPendingWrite();
+
+    std::ostream& os;
+    std::size_t bufferSize;
+    bool asynchronous;
+
+    // The buffer that is currently filled and the buffer that is currently written to the stream (if asynchronous).
+    std::string buffer;
+    std::string writtenBuffer;
+    std::future<void> pendingWrite;
+
+    // Doubles are formatted directly if the stream uses the default floating point format with this precision.
+    bool formatDoublesDirectly;
+    int precision;
+    std::ostringstream formatStream;
+};
+
+}  // namespace exporter
+}  // namespace storm
@@ -21,6 +21,9 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
                                std::vector<std::string> const& parameters, DirectEncodingOptions const& options) {
     // Notice that for CTMCs we write the rate matrix instead of probabilities
 
+    // The output is collected in large buffers which are written by a separate thread while the next part of the model is formatted
+    BufferedWriter out(os, options.bufferSize, options.asynchronousWriting);
+
     // Initialize
     std::vector<ValueType> exitRates;  // Only for CTMCs and MAs.
     if (sparseModel->getType() == storm::models::ModelType::Ctmc) {
@@ -30,20 +33,20 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
     }
 
     // Write header
-    os << "// Exported by storm\n";
-    os << "// Original model type: " << sparseModel->getType() << '\n';
-    os << "@type: " << sparseModel->getType() << '\n';
-    os << "@parameters\n";
+    out << "// Exported by storm\n";
+    out << "// Original model type: " << sparseModel->getType() << '\n';
+    out << "@type: " << sparseModel->getType() << '\n';
+    out << "@parameters\n";
     if (parameters.empty()) {
         for (std::string const& parameter : getParameters(sparseModel)) {
-            os << parameter << " ";
+            out << parameter << " ";
         }
     } else {
         for (std::string const& parameter : parameters) {
-            os << parameter << " ";
+            out << parameter << " ";
         }
     }
-    os << '\n';
+    out << '\n';
 
     // Optionally write placeholders which only need to be parsed once
     // This is used to reduce the parsing effort for rational functions
@@ -53,56 +56,56 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
         placeholders = generatePlaceholders(sparseModel, exitRates);
     }
     if (!placeholders.empty()) {
-        os << "@placeholders\n";
+        out << "@placeholders\n";
         for (auto const& entry : placeholders) {
-            os << "$" << entry.second << " : " << entry.first << '\n';
+            out << "$" << entry.second << " : " << entry.first << '\n';
         }
     }
 
-    os << "@reward_models\n";
+    out << "@reward_models\n";
     for (auto const& rewardModel : sparseModel->getRewardModels()) {
-        os << rewardModel.first << " ";
+        out << rewardModel.first << " ";
     }
-    os << '\n';
-    os << "@nr_states\n" << sparseModel->getNumberOfStates() << '\n';
-    os << "@nr_choices\n" << sparseModel->getNumberOfChoices() << '\n';
-    os << "@model\n";
+    out << '\n';
+    out << "@nr_states\n" << sparseModel->getNumberOfStates() << '\n';
+    out << "@nr_choices\n" << sparseModel->getNumberOfChoices() << '\n';
+    out << "@model\n";
 
     storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel->getTransitionMatrix();
 
     // Iterate over states and export state information and outgoing transitions
     for (typename storm::storage::SparseMatrix<ValueType>::index_type group = 0; group < matrix.getRowGroupCount(); ++group) {
-        os << "state " << group;
+        out << "state " << group;
 
         // Write exit rates for CTMCs and MAs
         if (!exitRates.empty()) {
-            os << " !";
-            writeValue(os, exitRates.at(group), placeholders);
+            out << " !";
+            writeValue(out, exitRates.at(group), placeholders);
         }
 
         if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
-            os << " {" << sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
+            out << " {" << sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
         }
 
         // Write state rewards
         bool first = true;
         for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
             if (first) {
-                os << " [";
+                out << " [";
                 first = false;
             } else {
-                os << ", ";
+                out << ", ";
             }
 
             if (rewardModelEntry.second.hasStateRewards()) {
-                writeValue(os, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
+                writeValue(out, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
             } else {
-                os << "0";
+                out << "0";
             }
         }
 
         if (!first) {
-            os << "]";
+            out << "]";
         }
 
         // Write labels. Only labels with a whitespace are put in (double) quotation marks.
@@ -111,15 +114,15 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
                             "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
             // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
             if (std::count_if(label.begin(), label.end(), isspace) > 0) {
-                os << " \"" << label << "\"";
+                out << " \"" << label << "\"";
             } else {
-                os << " " << label;
+                out << " " << label;
             }
         }
-        os << '\n';
+        out << '\n';
         // Write state valuations as comments
         if (sparseModel->hasStateValuations()) {
-            os << "//" << sparseModel->getStateValuations().getStateInfo(group) << '\n';
+            out << "//" << sparseModel->getStateValuations().getStateInfo(group) << '\n';
         }
 
         // Write probabilities
@@ -130,52 +133,53 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
         for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
             // Write choice
             if (sparseModel->hasChoiceLabeling()) {
-                os << "\taction ";
+                out << "\taction ";
                 bool lfirst = true;
                 if (sparseModel->getChoiceLabeling().getLabelsOfChoice(row).empty()) {
-                    os << "__NOLABEL__";
+                    out << "__NOLABEL__";
                 }
                 for (auto const& label : sparseModel->getChoiceLabeling().getLabelsOfChoice(row)) {
                     if (!lfirst) {
-                        os << "_";
+                        out << "_";
                         lfirst = false;
                     }
-                    os << label;
+                    out << label;
                 }
             } else {
-                os << "\taction " << row - start;
+                out << "\taction " << row - start;
             }
 
             // Write action rewards
             bool first = true;
             for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
                 if (first) {
-                    os << " [";
+                    out << " [";
                     first = false;
                 } else {
-                    os << ", ";
+                    out << ", ";
                 }
 
                 if (rewardModelEntry.second.hasStateActionRewards()) {
-                    writeValue(os, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
+                    writeValue(out, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
                 } else {
-                    os << "0";
+                    out << "0";
                 }
             }
             if (!first) {
-                os << "]";
+                out << "]";
             }
-            os << '\n';
+            out << '\n';
 
             // Write transitions
             for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
                 ValueType prob = it->getValue();
-                os << "\t\t" << it->getColumn() << " : ";
-                writeValue(os, prob, placeholders);
-                os << '\n';
+                out << "\t\t" << it->getColumn() << " : ";
+                writeValue(out, prob, placeholders);
+                out << '\n';
             }
         }
     }  // end state iteration
+    out.flush();
 }
 
 template<typename ValueType>
@@ -254,9 +258,9 @@ std::unordered_map<storm::RationalFunction, std::string> generatePlaceholders(
 }
 
 template<typename ValueType>
-void writeValue(std::ostream& os, ValueType value, std::unordered_map<ValueType, std::string> const& placeholders) {
+void writeValue(BufferedWriter& out, ValueType const& value, std::unordered_map<ValueType, std::string> const& placeholders) {
     if (storm::utility::isConstant(value)) {
-        os << value;
+        out << value;
         return;
     }
 
@@ -264,9 +268,9 @@ void writeValue(std::ostream& os, ValueType value, std::unordered_map<ValueType,
     auto it = placeholders.find(value);
     if (it != placeholders.end()) {
         // Use placeholder
-        os << "$" << it->second;
+        out << "$" << it->second;
     } else {
-        os << value;
+        out << value;
     }
 }
 
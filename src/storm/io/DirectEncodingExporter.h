@@ -3,6 +3,7 @@
 #include <iostream>
 #include <memory>
 
+#include "storm/io/BufferedWriter.h"
 #include "storm/models/sparse/Model.h"
 
 namespace storm {
@@ -10,6 +11,10 @@ namespace exporter {
 
 struct DirectEncodingOptions {
     bool allowPlaceholders = true;
+    // The number of bytes that are collected before they are written to the stream.
+    std::size_t bufferSize = 1ull << 24;
+    // If set, the output is written by a separate thread while the next part of the model is formatted.
+    bool asynchronousWriting = true;
 };
 /*!
  * Exports a sparse model into the explicit DRN format.
@@ -43,12 +48,12 @@ std::unordered_map<ValueType, std::string> generatePlaceholders(std::shared_ptr<
                                                                 std::vector<ValueType> exitRates);
 
 /*!
- * Write value to stream while using the placeholders.
- * @param os Output stream.
+ * Write value to the writer while using the placeholders.
+ * @param out Output writer.
  * @param value Value.
  * @param placeholders Placeholders.
  */
 template<typename ValueType>
-void writeValue(std::ostream& os, ValueType value, std::unordered_map<ValueType, std::string> const& placeholders);
+void writeValue(BufferedWriter& out, ValueType const& value, std::unordered_map<ValueType, std::string> const& placeholders);
 }  // namespace exporter
 }  // namespace storm
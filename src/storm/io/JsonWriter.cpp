@@ -0,0 +1,245 @@
+#include "storm/io/JsonWriter.h"
+
+#include <cstdio>
+#include <sstream>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace exporter {
+
+JsonWriter::JsonWriter(std::ostream& os, bool compact)
+    : writer(os), compact(compact), keyWritten(false), numberOfExactNumbers(0), numberOfInaccurateNumbers(0) {
+    // Intentionally left empty.
+}
+
+void JsonWriter::writeNewLineAndIndentation() {
+    if (!compact) {
+        writer << '\n';
+        for (uint64_t level = 0; level < containers.size(); ++level) {
+            writer << "    ";
+        }
+    }
+}
+
+void JsonWriter::beginValue() {
+    if (containers.empty()) {
+        return;
+    }
+    Container& container = containers.back();
+    if (container.isObject) {
+        STORM_LOG_ASSERT(keyWritten, "The value of an object member is written without its key.");
+        keyWritten = false;
+    } else {
+        if (!container.empty) {
+            writer << ',';
+        }
+        container.empty = false;
+        writeNewLineAndIndentation();
+    }
+}
+
+void JsonWriter::writeString(std::string const& str) {
+    // Escapes the same characters as nlohmann/json (without ensuring ASCII output).
+    writer << '"';
+    for (char c : str) {
+        switch (c) {
+            case '"':
+                writer << "\\\"";
+                break;
+            case '\\':
+                writer << "\\\\";
+                break;
+            case '\b':
+                writer << "\\b";
+                break;
+            case '\f':
+                writer << "\\f";
+                break;
+            case '\n':
+                writer << "\\n";
+                break;
+            case '\r':
+                writer << "\\r";
+                break;
+            case '\t':
+                writer << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char characters[8];
+                    std::snprintf(characters, sizeof(characters), "\\u%04x", static_cast<unsigned int>(static_cast<unsigned char>(c)));
+                    writer << characters;
+                } else {
+                    writer << c;
+                }
+        }
+    }
+    writer << '"';
+}
+
+void JsonWriter::countNumber(bool accurate, std::string const& number, std::string const& dump) {
+    ++numberOfExactNumbers;
+    if (!accurate) {
+        ++numberOfInaccurateNumbers;
+        if (numberOfInaccurateNumbers == 1) {
+            inaccuracyMessage = "Inaccurate JSON export: The number " + number + " will be exported as " + dump + ". ";
+        }
+    }
+}
+
+JsonWriter& JsonWriter::beginObject() {
+    beginValue();
+    writer << '{';
+    containers.push_back({true, true});
+    return *this;
+}
+
+JsonWriter& JsonWriter::endObject() {
+    STORM_LOG_ASSERT(!containers.empty() && containers.back().isObject && !keyWritten, "Can not end an object here.");
+    bool const empty = containers.back().empty;
+    containers.pop_back();
+    if (!empty) {
+        writeNewLineAndIndentation();
+    }
+    writer << '}';
+    return *this;
+}
+
+JsonWriter& JsonWriter::beginArray() {
+    beginValue();
+    writer << '[';
+    containers.push_back({false, true});
+    return *this;
+}
+
+JsonWriter& JsonWriter::endArray() {
+    STORM_LOG_ASSERT(!containers.empty() && !containers.back().isObject, "Can not end an array here.");
+    bool const empty = containers.back().empty;
+    containers.pop_back();
+    if (!empty) {
+        writeNewLineAndIndentation();
+    }
+    writer << ']';
+    return *this;
+}
+
+JsonWriter& JsonWriter::key(std::string const& name) {
+    STORM_LOG_ASSERT(!containers.empty() && containers.back().isObject && !keyWritten, "Can not write a key here.");
+    Container& container = containers.back();
+    if (!container.empty) {
+        writer << ',';
+    }
+    container.empty = false;
+    writeNewLineAndIndentation();
+    writeString(name);
+    writer << (compact ? ":" : ": ");
+    keyWritten = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::null() {
+    beginValue();
+    writer << "null";
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(bool value) {
+    beginValue();
+    writer << (value ? "true" : "false");
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(char const* value) {
+    beginValue();
+    writeString(value);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(std::string const& value) {
+    beginValue();
+    writeString(value);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(double value) {
+    beginValue();
+    // nlohmann/json determines the shortest representation that is parsed to the same number.
+    writer << storm::json<double>(value).dump();
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(storm::RationalNumber const& value) {
+    beginValue();
+    storm::json<storm::RationalNumber> number(value);
+    std::string dump = number.dump();
+    if (storm::isJsonNumberExportAccurate(number)) {
+        countNumber(true, "", dump);
+    } else {
+        std::stringstream numberAsString;
+        numberAsString << value;
+        countNumber(false, numberAsString.str(), dump);
+    }
+    writer << dump;
+    return *this;
+}
+
+template<typename JsonRationalType>
+JsonWriter& JsonWriter::value(storm::json<JsonRationalType> const& value) {
+    beginValue();
+    if constexpr (storm::NumberTraits<JsonRationalType>::IsExact) {
+        std::vector<storm::json<JsonRationalType> const*> stack = {&value};
+        while (!stack.empty()) {
+            auto const& current = *stack.back();
+            stack.pop_back();
+            if (current.is_structured()) {
+                for (auto const& child : current) {
+                    stack.push_back(&child);
+                }
+            } else if (current.is_number_float()) {
+                if (storm::isJsonNumberExportAccurate(current)) {
+                    countNumber(true, "", "");
+                } else {
+                    std::stringstream numberAsString;
+                    numberAsString << current.template get_ref<JsonRationalType const&>();
+                    countNumber(false, numberAsString.str(), current.dump());
+                }
+            }
+        }
+    }
+    if (compact) {
+        writer << value.dump();
+    } else {
+        // Nested lines are indented relative to the current position.
+        std::string indentation = "\n";
+        for (uint64_t level = 0; level < containers.size(); ++level) {
+            indentation += "    ";
+        }
+        std::string dump = value.dump(4);
+        std::string::size_type lineBegin = 0;
+        for (std::string::size_type lineEnd = dump.find('\n'); lineEnd != std::string::npos; lineEnd = dump.find('\n', lineBegin)) {
+            writer << dump.substr(lineBegin, lineEnd - lineBegin) << indentation;
+            lineBegin = lineEnd + 1;
+        }
+        writer << dump.substr(lineBegin);
+    }
+    return *this;
+}
+
+void JsonWriter::flush() {
+    STORM_LOG_ASSERT(containers.empty(), "The JSON document is incomplete.");
+    STORM_LOG_WARN_COND(numberOfInaccurateNumbers == 0, inaccuracyMessage << "In total, " << numberOfInaccurateNumbers << " of " << numberOfExactNumbers
+                                                                          << " numbers are inaccurate.");
+    numberOfInaccurateNumbers = 0;
+    numberOfExactNumbers = 0;
+    writer.flush();
+}
+
+template JsonWriter& JsonWriter::value(storm::json<double> const& value);
+template JsonWriter& JsonWriter::value(storm::json<storm::RationalNumber> const& value);
+
+}  // namespace exporter
+}  // namespace storm
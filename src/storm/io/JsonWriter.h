@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "storm/adapters/JsonForward.h"
+#include "storm/adapters/RationalNumberForward.h"
+#include "storm/io/BufferedWriter.h"
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * Writes a JSON document value by value to a stream without building the document in memory first. The output coincides with the output of
+ * storm::dumpJson for the same document. In particular, the caller needs to write the keys of every object in lexicographic order (as storm::json
+ * sorts them) and numbers are formatted by nlohmann/json. Small values that are given as storm::json objects can be embedded into the document.
+ * As for storm::dumpJson, a warning is printed if exact numbers can not be exported with full accuracy.
+ */
+class JsonWriter {
+   public:
+    /*!
+     * Creates a writer for the given stream.
+     *
+     * @param os The stream to which the document is written. It must not be used until the writer is flushed.
+     * @param compact If true, the document is written without unnecessary whitespace. Otherwise, it is indented by four spaces per level.
+     */
+    JsonWriter(std::ostream& os, bool compact = false);
+
+    /*!
+     * Writes the remaining output to the stream. Errors are only reported by flush().
+     */
+    ~JsonWriter() = default;
+
+    JsonWriter(JsonWriter const&) = delete;
+    JsonWriter& operator=(JsonWriter const&) = delete;
+
+    JsonWriter& beginObject();
+    JsonWriter& endObject();
+    JsonWriter& beginArray();
+    JsonWriter& endArray();
+
+    /*!
+     * Writes the key of the next member of the current object. The member's value has to be written next.
+     */
+    JsonWriter& key(std::string const& name);
+
+    JsonWriter& null();
+    JsonWriter& value(bool value);
+    JsonWriter& value(char const* value);
+    JsonWriter& value(std::string const& value);
+    JsonWriter& value(double value);
+    JsonWriter& value(storm::RationalNumber const& value);
+
+    template<typename IntegerType, typename std::enable_if<std::is_integral<IntegerType>::value && !std::is_same<IntegerType, char>::value &&
+                                                               !std::is_same<IntegerType, bool>::value,
+                                                           int>::type = 0>
+    JsonWriter& value(IntegerType value) {
+        beginValue();
+        writer << value;
+        return *this;
+    }
+
+    /*!
+     * Writes the given json object at the current position of the document.
+     */
+    template<typename JsonRationalType>
+    JsonWriter& value(storm::json<JsonRationalType> const& value);
+
+    /*!
+     * Writes all collected output to the stream and waits until it is written.
+     * Throws a FileIoException if the stream reports an error.
+     */
+    void flush();
+
+   private:
+    struct Container {
+        bool isObject;
+        bool empty;
+    };
+
+    /*!
+     * Writes the separator and the indentation in front of the next value.
+     */
+    void beginValue();
+    void writeNewLineAndIndentation();
+    void writeString(std::string const& str);
+    void countNumber(bool accurate, std::string const& number, std::string const& dump);
+
+    BufferedWriter writer;
+    bool compact;
+    std::vector<Container> containers;
+    bool keyWritten;
+
+    // Statistics on the accuracy of the exported exact numbers.
+    uint64_t numberOfExactNumbers;
+    uint64_t numberOfInaccurateNumbers;
+    std::string inaccuracyMessage;
+};
+
+}  // namespace exporter
+}  // namespace storm
@@ -15,6 +15,8 @@ ModelExportFormat getModelExportFormatFromString(std::string const& input) {
         return ModelExportFormat::Drn;
     } else if (input == "json") {
         return ModelExportFormat::Json;
+    } else if (input == "bin") {
+        return ModelExportFormat::Binary;
     }
     STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "The model export format '" << input << "' does not match any known format.");
 }
@@ -29,6 +31,8 @@ std::string toString(ModelExportFormat const& input) {
             return "drn";
         case ModelExportFormat::Json:
             return "json";
+        case ModelExportFormat::Binary:
+            return "bin";
     }
     STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unhandled model export format.");
 }
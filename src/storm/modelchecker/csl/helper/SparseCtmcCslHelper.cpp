@@ -1,11 +1,15 @@
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
+#include <optional>
+#include <type_traits>
+
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/helper/KrylovExponentialHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
@@ -19,6 +23,7 @@
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/numerical.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/FormatUnsupportedBySolverException.h"
@@ -265,6 +270,99 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
     return result;
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+
+    uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+    std::vector<std::vector<ValueType>> results(upperBounds.size());
+
+    // Set the possible (absolute) error allowed for truncation (epsilon for fox-glynn)
+    ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+
+    storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0.getNumberOfSetBits() << " states with probability greater 0.");
+    storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+
+    // the positions within the result for which the precision needs to be checked
+    storm::storage::BitVector relevantValues;
+    if (goal.hasRelevantValues()) {
+        relevantValues = std::move(goal.relevantValues());
+        relevantValues &= statesWithProbabilityGreater0;
+    } else {
+        relevantValues = statesWithProbabilityGreater0;
+    }
+
+    // The time bounds that need to be handled by uniformization.
+    std::vector<ValueType> finiteUpperBounds;
+    std::vector<uint64_t> finiteUpperBoundIndices;
+    for (uint64_t i = 0; i < upperBounds.size(); ++i) {
+        if (upperBounds[i] == storm::utility::infinity<double>()) {
+            // For [0, inf], we rather call untimed reachability.
+            results[i] = computeUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(), rateMatrix, backwardTransitions, exitRates, phiStates,
+                                                   psiStates, false);
+        } else {
+            finiteUpperBounds.push_back(storm::utility::convertNumber<ValueType>(upperBounds[i]));
+            finiteUpperBoundIndices.push_back(i);
+        }
+    }
+    if (finiteUpperBounds.empty()) {
+        return results;
+    }
+
+    ValueType uniformizationRate = 0;
+    storm::storage::SparseMatrix<ValueType> uniformizedMatrix;
+    std::vector<ValueType> b;
+    if (!statesWithProbabilityGreater0NonPsi.empty()) {
+        // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+        for (auto state : statesWithProbabilityGreater0NonPsi) {
+            uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+        }
+        uniformizationRate *= 1.02;
+        STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+
+        // Compute the uniformized matrix.
+        uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+
+        // Compute the vector that is to be added as a compensation for removing the absorbing states.
+        b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+        for (auto& element : b) {
+            element /= uniformizationRate;
+        }
+    }
+
+    bool repeat;
+    do {  // Iterate until the desired precision is reached (only relevant for relative precision criterion)
+        std::vector<std::vector<ValueType>> subresults;
+        if (!statesWithProbabilityGreater0NonPsi.empty()) {
+            std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+            subresults = computeTransientProbabilities(env, uniformizedMatrix, &b, finiteUpperBounds, uniformizationRate, std::move(values), epsilon);
+        }
+        repeat = false;
+        ValueType const previousEpsilon = epsilon;
+        for (uint64_t i = 0; i < finiteUpperBounds.size(); ++i) {
+            auto& result = results[finiteUpperBoundIndices[i]];
+            result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
+            storm::utility::vector::setVectorValues<ValueType>(result, psiStates, storm::utility::one<ValueType>());
+            if (!subresults.empty()) {
+                storm::utility::vector::setVectorValues(result, statesWithProbabilityGreater0NonPsi, subresults[i]);
+            }
+            // The epsilon is only decreased, so the smallest required epsilon of all time bounds is used in the next round.
+            ValueType requiredEpsilon = previousEpsilon;
+            if (checkAndUpdateTransientProbabilityEpsilon(env, requiredEpsilon, result, relevantValues)) {
+                repeat = true;
+                epsilon = std::min(epsilon, requiredEpsilon);
+            }
+        }
+    } while (repeat);
+    return results;
+}
+
 template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
 std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const&, storm::solver::SolveGoal<ValueType>&&,
                                                                              storm::storage::SparseMatrix<ValueType> const&,
@@ -650,11 +748,37 @@ storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeUniformizedM
     return uniformizedMatrix;
 }
 
+namespace {
+// Uniformization needs about uniformizationRate * timeBound matrix-vector multiplications, i.e., its effort grows with the ratio between the time bound and
+// the fastest dynamics of the model. From this ratio on, the Krylov method is selected automatically.
+double const AutomaticKrylovThreshold = 1e6;
+
+template<typename ValueType>
+bool useKrylovMethod(Environment const& env, std::vector<ValueType> const& timeBounds, ValueType const& uniformizationRate) {
+    auto const method = env.solver().timeBounded().getCtmcMethod();
+    if (method == storm::solver::CtmcTransientMethod::Krylov) {
+        STORM_LOG_WARN_COND(!env.solver().isForceSoundness(), "The Krylov method only estimates the error of transient probabilities.");
+        return true;
+    }
+    if (method == storm::solver::CtmcTransientMethod::Automatic && !env.solver().isForceSoundness() && !timeBounds.empty()) {
+        return *std::max_element(timeBounds.begin(), timeBounds.end()) * uniformizationRate >= AutomaticKrylovThreshold;
+    }
+    return false;
+}
+}  // namespace
+
 template<typename ValueType, bool useMixedPoissonProbabilities, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
 std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env,
                                                                           storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
                                                                           std::vector<ValueType> const* addVector, ValueType timeBound,
                                                                           ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
+    if constexpr (!useMixedPoissonProbabilities) {
+        // The version for multiple time bounds is equivalent and additionally supports early truncation.
+        std::vector<ValueType> const timeBounds = {timeBound};
+        return std::move(computeTransientProbabilities(env, uniformizedMatrix, addVector, timeBounds, uniformizationRate, std::move(values), epsilon).front());
+    }
+    STORM_LOG_WARN_COND(env.solver().timeBounded().getCtmcMethod() != storm::solver::CtmcTransientMethod::Krylov,
+                        "The Krylov method does not support cumulative rewards. Using uniformization instead.");
     STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
                         "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
     ValueType lambda = timeBound * uniformizationRate;
@@ -736,6 +860,190 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
     return result;
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env,
+                                                                                       storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                                       std::vector<ValueType> const* addVector,
+                                                                                       std::vector<ValueType> const& timeBounds, ValueType uniformizationRate,
+                                                                                       std::vector<ValueType> values, ValueType epsilon) {
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (useKrylovMethod(env, timeBounds, uniformizationRate)) {
+            STORM_LOG_INFO("Computing transient probabilities with the Krylov method.");
+            storm::solver::helper::KrylovExponentialHelper<ValueType> krylovHelper(uniformizedMatrix, addVector, uniformizationRate);
+            return krylovHelper.compute(env, timeBounds, values, epsilon);
+        }
+    }
+    uint64_t const numberOfRows = uniformizedMatrix.getRowCount();
+
+    // Check whether the values of later iterations are convex combinations of the current values (and zero), which allows to stop early.
+    bool earlyTruncation = addVector == nullptr;
+    bool stochasticMatrix = true;
+    ValueType const rowSumTolerance = storm::utility::convertNumber<ValueType>(1e-12);
+    for (uint64_t row = 0; earlyTruncation && row < numberOfRows; ++row) {
+        ValueType rowSum = storm::utility::zero<ValueType>();
+        for (auto const& entry : uniformizedMatrix.getRow(row)) {
+            earlyTruncation &= entry.getValue() >= storm::utility::zero<ValueType>();
+            rowSum += entry.getValue();
+        }
+        earlyTruncation &= rowSum <= storm::utility::one<ValueType>() + rowSumTolerance;
+        stochasticMatrix &= rowSum >= storm::utility::one<ValueType>() - rowSumTolerance;
+    }
+    ValueType const foxGlynnEpsilon = earlyTruncation ? epsilon / 2 : epsilon;
+    ValueType const truncationEpsilon = epsilon - foxGlynnEpsilon;
+
+    // Use Fox-Glynn to get the truncation points and the weights for every time bound.
+    struct TimeBoundData {
+        // Not set if no time can pass.
+        std::optional<storm::utility::numerical::FoxGlynnResult<ValueType>> foxGlynnResult;
+        // remainingWeights[i] is the sum of the weights after the i-th weight.
+        std::vector<ValueType> remainingWeights;
+        std::vector<ValueType> result;
+        bool finished{false};
+    };
+    std::vector<TimeBoundData> data(timeBounds.size());
+    uint64_t lastIteration = 0;
+    for (uint64_t i = 0; i < timeBounds.size(); ++i) {
+        ValueType lambda = timeBounds[i] * uniformizationRate;
+        // If no time can pass, the current values are the result.
+        if (storm::utility::isZero(lambda)) {
+            data[i].result = values;
+            data[i].finished = true;
+            continue;
+        }
+        auto const& foxGlynnResult = data[i].foxGlynnResult.emplace(storm::utility::numerical::foxGlynn(lambda, foxGlynnEpsilon));
+        STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[i] << ": left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
+        // foxGlynnResult.weights do not sum up to one. This is to enhance numerical stability.
+        if (earlyTruncation) {
+            data[i].remainingWeights.resize(foxGlynnResult.weights.size(), storm::utility::zero<ValueType>());
+            for (uint64_t index = foxGlynnResult.weights.size() - 1; index > 0; --index) {
+                data[i].remainingWeights[index - 1] = data[i].remainingWeights[index] + foxGlynnResult.weights[index];
+            }
+        }
+        data[i].result.assign(values.size(), storm::utility::zero<ValueType>());
+        lastIteration = std::max<uint64_t>(lastIteration, foxGlynnResult.right);
+    }
+
+    STORM_LOG_DEBUG("Starting iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
+
+    // Use multiple threads only if every thread gets a reasonable amount of work.
+    uint64_t const numberOfThreads = std::min<uint64_t>(env.solver().getNumberOfThreads(), std::max<uint64_t>(1, numberOfRows / 50000));
+    std::vector<std::pair<ValueType, std::vector<ValueType>*>> contributions;
+    std::vector<ValueType> lowerValues(numberOfThreads), upperValues(numberOfThreads);
+    // Adds the weighted values of the given rows to the results and keeps track of the range of the values.
+    auto accumulate = [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+        for (auto const& [weight, result] : contributions) {
+            for (uint64_t row = begin; row < end; ++row) {
+                (*result)[row] += weight * values[row];
+            }
+        }
+        if (earlyTruncation && begin < end) {
+            auto const [minIt, maxIt] = std::minmax_element(values.begin() + begin, values.begin() + end);
+            lowerValues[threadIndex] = *minIt;
+            upperValues[threadIndex] = *maxIt;
+        }
+    };
+    std::vector<ValueType> nextValues;
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+    for (uint64_t iteration = 0; iteration <= lastIteration; ++iteration) {
+        contributions.clear();
+        bool allFinished = true;
+        for (auto& timeBoundData : data) {
+            allFinished &= timeBoundData.finished;
+            if (timeBoundData.finished) {
+                continue;
+            }
+            auto const& foxGlynnResult = *timeBoundData.foxGlynnResult;
+            if (iteration >= foxGlynnResult.left && iteration <= foxGlynnResult.right) {
+                contributions.emplace_back(foxGlynnResult.weights[iteration - foxGlynnResult.left], &timeBoundData.result);
+                timeBoundData.finished = iteration == foxGlynnResult.right;
+            }
+        }
+        if (allFinished) {
+            break;
+        }
+
+        if (iteration > 0) {
+            if (numberOfThreads > 1) {
+                // Perform the multiplication and the accumulation in a single pass over the matrix.
+                nextValues.resize(values.size());
+                std::swap(values, nextValues);
+                storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), numberOfRows, [&](uint64_t threadIndex, uint64_t begin,
+                                                                                                                    uint64_t end) {
+                    for (uint64_t row = begin; row < end; ++row) {
+                        ValueType rowValue = addVector ? (*addVector)[row] : storm::utility::zero<ValueType>();
+                        for (auto const& entry : uniformizedMatrix.getRow(row)) {
+                            rowValue += entry.getValue() * nextValues[entry.getColumn()];
+                        }
+                        values[row] = std::move(rowValue);
+                    }
+                    accumulate(threadIndex, begin, end);
+                });
+            } else {
+                if (!earlyTruncation && contributions.empty()) {
+                    // Skip to the next iteration in which a result is updated.
+                    uint64_t nextRelevantIteration = lastIteration;
+                    for (auto const& timeBoundData : data) {
+                        if (!timeBoundData.finished && timeBoundData.foxGlynnResult->left > iteration) {
+                            nextRelevantIteration = std::min<uint64_t>(nextRelevantIteration, timeBoundData.foxGlynnResult->left);
+                        }
+                    }
+                    multiplier->repeatedMultiply(env, values, addVector, nextRelevantIteration - iteration);
+                    iteration = nextRelevantIteration - 1;
+                    continue;
+                }
+                multiplier->multiply(env, values, addVector, values);
+                accumulate(0, 0, values.size());
+            }
+        } else {
+            accumulate(0, 0, values.size());
+            std::fill(lowerValues.begin() + 1, lowerValues.end(), lowerValues.front());
+            std::fill(upperValues.begin() + 1, upperValues.end(), upperValues.front());
+        }
+
+        if (earlyTruncation && !values.empty()) {
+            // The values of all later iterations are within [lower, upper]. Hence, replacing them by the center of this interval yields an error of at
+            // most half of the remaining Poisson mass times the width of the interval.
+            ValueType lower = *std::min_element(lowerValues.begin(), lowerValues.end());
+            ValueType upper = *std::max_element(upperValues.begin(), upperValues.end());
+            if (!stochasticMatrix) {
+                // Probability mass may leave the considered states, so the values can also converge to zero.
+                lower = std::min(lower, storm::utility::zero<ValueType>());
+                upper = std::max(upper, storm::utility::zero<ValueType>());
+            }
+            ValueType const center = (lower + upper) / 2;
+            for (auto& timeBoundData : data) {
+                if (timeBoundData.finished) {
+                    continue;
+                }
+                auto const& foxGlynnResult = *timeBoundData.foxGlynnResult;
+                ValueType const& remainingWeight =
+                    iteration < foxGlynnResult.left ? foxGlynnResult.totalWeight : timeBoundData.remainingWeights[iteration - foxGlynnResult.left];
+                if (remainingWeight * (upper - lower) <= 2 * truncationEpsilon * foxGlynnResult.totalWeight) {
+                    STORM_LOG_DEBUG("Stopping the iteration for a time bound after " << iteration << " instead of " << foxGlynnResult.right << " iterations.");
+                    for (auto& value : timeBoundData.result) {
+                        value += remainingWeight * center;
+                    }
+                    timeBoundData.finished = true;
+                }
+            }
+        }
+    }
+
+    // Finally, divide the results by the total weight
+    std::vector<std::vector<ValueType>> results;
+    results.reserve(data.size());
+    for (auto& timeBoundData : data) {
+        if (timeBoundData.foxGlynnResult) {
+            storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(timeBoundData.result,
+                                                                             storm::utility::one<ValueType>() / timeBoundData.foxGlynnResult->totalWeight);
+        }
+        results.push_back(std::move(timeBoundData.result));
+    }
+    return results;
+}
+
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                                                       std::vector<ValueType> const& exitRates) {
@@ -771,6 +1079,11 @@ template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabiliti
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
     std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix,
+    storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<double> const& exitRates, std::vector<double> const& upperBounds);
+
 template std::vector<double> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal,
                                                                             storm::storage::SparseMatrix<double> const& rateMatrix,
                                                                             storm::storage::SparseMatrix<double> const& backwardTransitions,
@@ -832,6 +1145,9 @@ template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(
                                                                                 storm::storage::SparseMatrix<double> const& uniformizedMatrix,
                                                                                 std::vector<double> const* addVector, double timeBound,
                                                                                 double uniformizationRate, std::vector<double> values, double epsilon);
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilities(
+    Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector,
+    std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> values, double epsilon);
 
 #ifdef STORM_HAVE_CARL
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
@@ -31,6 +31,20 @@ class SparseCtmcCslHelper {
                                                                    std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound,
                                                                    double upperBound);
 
+    /*!
+     * Computes the probabilities of satisfying phi U[0,t] psi for each of the given upper time bounds t. All time bounds are handled in a single
+     * uniformization pass, i.e., the number of matrix-vector multiplications is determined by the largest time bound.
+     *
+     * @return For each upper time bound (in the given order), the probabilities of all states.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                                                storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                                storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                storm::storage::BitVector const& phiStates,
+                                                                                storm::storage::BitVector const& psiStates,
+                                                                                std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds);
+
     template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
     static std::vector<ValueType> computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                    storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -143,6 +157,30 @@ class SparseCtmcCslHelper {
                                                                 std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate,
                                                                 std::vector<ValueType> values, ValueType epsilon);
 
+    /*!
+     * Computes the transient probabilities for several time bounds at once. The time bounds share the matrix-vector multiplications, i.e., the
+     * number of multiplications is determined by the right Fox-Glynn truncation point of the largest time bound. If multiple solver threads are
+     * available, the multiplications and the weighted accumulation of the results are performed in parallel.
+     *
+     * If no vector is added and each row of the uniformized matrix sums up to at most one, the values of later iterations stay within the range of
+     * the current values (and zero). The iteration for a time bound is then stopped as soon as the remaining Poisson mass times this range is
+     * negligible, which typically happens long before the right truncation point if the transient values converge. Half of the given epsilon is
+     * used for this early truncation in that case.
+     *
+     * Depending on the environment, the values are instead computed with a shift-and-invert Krylov approximation of the matrix exponential, which does not
+     * depend on the uniformization rate. This is done automatically for double precision if the product of the largest time bound and the uniformization
+     * rate is large (i.e., the problem is stiff) and soundness is not required.
+     *
+     * @param timeBounds The time bounds to use.
+     * @return For each time bound (in the given order), the vector of transient probabilities.
+     * @see computeTransientProbabilities for a single time bound.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeTransientProbabilities(Environment const& env,
+                                                                             storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                             std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds,
+                                                                             ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon);
+
     /*!
      * Converts the given rate-matrix into a time-abstract probability matrix.
      *
@@ -19,9 +19,11 @@
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/Variable.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -58,6 +60,69 @@ std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> setUpProba
     return solver;
 }
 
+namespace {
+
+// The minimal number of rows that each thread processes in a parallel step of the time-bounded reachability computations.
+uint64_t const minimalNumberOfRowsPerThread = 50000;
+
+/*!
+ * Returns the number of threads to use for a parallel step over the given number of rows. If this is one, the step is performed sequentially.
+ */
+uint64_t getNumberOfThreadsForRows(Environment const& env, uint64_t numberOfRows) {
+    return std::min<uint64_t>(env.solver().getNumberOfThreads(), std::max<uint64_t>(1, numberOfRows / minimalNumberOfRowsPerThread));
+}
+
+/*!
+ * Computes result = matrix * x (+ b) with the given number of threads.
+ */
+template<typename ValueType>
+void multiplyInParallel(uint64_t numberOfThreads, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& x,
+                        std::vector<ValueType> const* b, std::vector<ValueType>& result) {
+    STORM_LOG_ASSERT(&x != &result, "In-place multiplication is not supported.");
+    result.resize(matrix.getRowCount());
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), matrix.getRowCount(), [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t row = begin; row < end; ++row) {
+            ValueType rowValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+            for (auto const& entry : matrix.getRow(row)) {
+                rowValue += entry.getValue() * x[entry.getColumn()];
+            }
+            result[row] = std::move(rowValue);
+        }
+    });
+}
+
+/*!
+ * Sets target[positions[i]] = values[i] for all i with the given number of threads.
+ */
+template<typename ValueType>
+void setVectorValuesInParallel(uint64_t numberOfThreads, std::vector<ValueType>& target, std::vector<uint64_t> const& positions,
+                               std::vector<ValueType> const& values) {
+    auto setValues = [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t i = begin; i < end; ++i) {
+            target[positions[i]] = values[i];
+        }
+    };
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(positions.size()), setValues);
+}
+
+/*!
+ * Reduces the given row values to one value per row group with the given number of threads.
+ */
+template<typename ValueType>
+void reduceInParallel(uint64_t numberOfThreads, OptimizationDirection dir, std::vector<ValueType> const& rowValues, std::vector<ValueType>& result,
+                      std::vector<uint64_t> const& rowGroupIndices) {
+    auto reduceGroups = [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t group = begin; group < end; ++group) {
+            auto groupBegin = rowValues.begin() + rowGroupIndices[group];
+            auto groupEnd = rowValues.begin() + rowGroupIndices[group + 1];
+            result[group] = minimize(dir) ? *std::min_element(groupBegin, groupEnd) : *std::max_element(groupBegin, groupEnd);
+        }
+    };
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(result.size()), reduceGroups);
+}
+
+}  // namespace
+
 template<typename ValueType>
 class UnifPlusHelper {
    public:
@@ -143,6 +208,16 @@ class UnifPlusHelper {
         std::vector<ValueType> nextProbabilisticStateValues(probabilisticToProbabilisticTransitions.getRowGroupCount());
         std::vector<ValueType> eqSysRhs(probabilisticToProbabilisticTransitions.getRowCount());
 
+        // The steps over the Markovian and probabilistic states are parallelized if there are enough states for the available threads.
+        uint64_t const markovianThreads = getNumberOfThreadsForRows(env, markovianToMaybeTransitions.getRowCount());
+        uint64_t const probabilisticThreads = getNumberOfThreadsForRows(env, probabilisticToMarkovianTransitions.getRowCount());
+        uint64_t const maybeStatesThreads = getNumberOfThreadsForRows(env, maybeStates.getNumberOfSetBits());
+        std::vector<uint64_t> const markovianPositions(markovianStatesModMaybeStates.begin(), markovianStatesModMaybeStates.end());
+        std::vector<uint64_t> const probabilisticPositions(probabilisticStatesModMaybeStates.begin(), probabilisticStatesModMaybeStates.end());
+        STORM_LOG_INFO_COND(std::max({markovianThreads, probabilisticThreads, maybeStatesThreads}) == 1,
+                            "Performing the unif+ steps with up to " << std::max({markovianThreads, probabilisticThreads, maybeStatesThreads})
+                                                                     << " threads.");
+
         // Start the outer iterations which increase the uniformization rate until lower and upper bound on the result vector is sufficiently small
         storm::utility::ProgressMeasurement progressIterations("iterations");
         uint64_t iteration = 0;
@@ -169,8 +244,10 @@ class UnifPlusHelper {
                 ValueType targetValue = computeLowerBound ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
                 storm::utility::ProgressMeasurement progressSteps("steps in iteration " + std::to_string(iteration) + " for " +
                                                                   std::string(computeLowerBound ? "lower" : "upper") + " bounds.");
-                progressSteps.setMaxCount(N);
+                // Only the first right+1 steps are relevant (see below).
+                progressSteps.setMaxCount(std::min<uint64_t>(N, foxGlynnResult.right + 1));
                 progressSteps.startNewMeasurement(0);
+                uint64_t relevantSteps = 0;
                 bool firstIteration = true;  // The first iterations can be irrelevant, because they will only produce zeroes anyway.
                 int64_t k = N;
                 // Iteration k = N is always non-relevant
@@ -200,7 +277,11 @@ class UnifPlusHelper {
                         std::fill(nextMarkovianStateValues.begin(), nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
                     } else {
                         // Compute the values at Markovian maybe states.
-                        markovianToMaybeMultiplier->multiply(env, maybeStatesValues, nullptr, nextMarkovianStateValues);
+                        if (markovianThreads > 1) {
+                            multiplyInParallel<ValueType>(markovianThreads, markovianToMaybeTransitions, maybeStatesValues, nullptr, nextMarkovianStateValues);
+                        } else {
+                            markovianToMaybeMultiplier->multiply(env, maybeStatesValues, nullptr, nextMarkovianStateValues);
+                        }
                         for (auto const& oneStepProb : markovianToPsiProbabilities) {
                             nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
                         }
@@ -214,12 +295,19 @@ class UnifPlusHelper {
                     }
 
                     // Compute the values at probabilistic states.
-                    probabilisticToMarkovianMultiplier->multiply(env, nextMarkovianStateValues, nullptr, eqSysRhs);
+                    if (probabilisticThreads > 1) {
+                        multiplyInParallel<ValueType>(probabilisticThreads, probabilisticToMarkovianTransitions, nextMarkovianStateValues, nullptr, eqSysRhs);
+                    } else {
+                        probabilisticToMarkovianMultiplier->multiply(env, nextMarkovianStateValues, nullptr, eqSysRhs);
+                    }
                     for (auto const& oneStepProb : probabilisticToPsiProbabilities) {
                         eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
                     }
                     if (solver) {
                         solver->solveEquations(solverEnv, dir, nextProbabilisticStateValues, eqSysRhs);
+                    } else if (probabilisticThreads > 1) {
+                        reduceInParallel(probabilisticThreads, dir, eqSysRhs, nextProbabilisticStateValues,
+                                         probabilisticToProbabilisticTransitions.getRowGroupIndices());
                     } else {
                         storm::utility::vector::reduceVectorMinOrMax(dir, eqSysRhs, nextProbabilisticStateValues,
                                                                      probabilisticToProbabilisticTransitions.getRowGroupIndices());
@@ -227,19 +315,34 @@ class UnifPlusHelper {
 
                     // Create the new values for the maybestates
                     // Fuse the results together
-                    storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, nextMarkovianStateValues);
-                    storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, nextProbabilisticStateValues);
+                    if (maybeStatesThreads > 1) {
+                        setVectorValuesInParallel(markovianThreads, maybeStatesValues, markovianPositions, nextMarkovianStateValues);
+                        setVectorValuesInParallel(probabilisticThreads, maybeStatesValues, probabilisticPositions, nextProbabilisticStateValues);
+                    } else {
+                        storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, nextMarkovianStateValues);
+                        storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, nextProbabilisticStateValues);
+                    }
                     if (!computeLowerBound) {
                         // Add the scaled values to the actual result vector
                         uint64_t i = N - 1 - k;
                         if (i >= foxGlynnResult.left) {
                             assert(i <= foxGlynnResult.right);  // has to hold since this iteration is considered relevant.
                             ValueType const& weight = foxGlynnResult.weights[i - foxGlynnResult.left];
-                            storm::utility::vector::addScaledVector(maybeStatesValuesUpper, maybeStatesValuesWeightedUpper, weight);
+                            if (maybeStatesThreads > 1) {
+                                auto addWeightedValues = [&](uint64_t, uint64_t begin, uint64_t end) {
+                                    for (uint64_t state = begin; state < end; ++state) {
+                                        maybeStatesValuesUpper[state] += maybeStatesValuesWeightedUpper[state] * weight;
+                                    }
+                                };
+                                storm::utility::parallel::forEachChunk(maybeStatesThreads, static_cast<uint64_t>(0),
+                                                                       static_cast<uint64_t>(maybeStatesValuesUpper.size()), addWeightedValues);
+                            } else {
+                                storm::utility::vector::addScaledVector(maybeStatesValuesUpper, maybeStatesValuesWeightedUpper, weight);
+                            }
                         }
                     }
 
-                    progressSteps.updateProgress(N - k);
+                    progressSteps.updateProgress(++relevantSteps);
                     if (storm::utility::resources::isTerminate()) {
                         abortedInnerIterations = true;
                         break;
@@ -565,32 +668,49 @@ void computeBoundedReachabilityProbabilitiesImca(Environment const& env, Optimiz
     // *    perform value iteration using A_PSwG, v_PS and the vector b where b = (A * 1_G)|PS + A_PStoMS * v_MS
     //      and 1_G being the characteristic vector for all goal states.
     // *    perform one timed-step using v_MS := A_MSwG * v_MS + A_MStoPS * v_PS + (A * 1_G)|MS
+    // The steps over the Markovian and probabilistic states are parallelized if there are enough states for the available threads.
+    uint64_t const markovianThreads = getNumberOfThreadsForRows(env, aMarkovian.getRowCount());
+    uint64_t const probabilisticThreads = getNumberOfThreadsForRows(env, aProbabilistic.getRowCount());
+    // Computes result = matrix * x + b.
+    auto multiplyAndAdd = [](uint64_t numberOfThreads, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& x,
+                             std::vector<ValueType> const& b, std::vector<ValueType>& result) {
+        if (numberOfThreads > 1) {
+            multiplyInParallel(numberOfThreads, matrix, x, &b, result);
+        } else {
+            matrix.multiplyWithVector(x, result);
+            storm::utility::vector::addVectors(result, b, result);
+        }
+    };
+    auto solveProbabilisticStates = [&]() {
+        // (Re-)compute bProbabilistic = bProbabilisticFixed + aProbabilisticToMarkovian * vMarkovian.
+        multiplyAndAdd(probabilisticThreads, aProbabilisticToMarkovian, markovianNonGoalValues, bProbabilisticFixed, bProbabilistic);
+
+        // Now perform the inner value iteration for probabilistic states.
+        if (solver) {
+            solver->solveEquations(solverEnv, dir, probabilisticNonGoalValues, bProbabilistic);
+        } else if (probabilisticThreads > 1) {
+            reduceInParallel(probabilisticThreads, dir, bProbabilistic, probabilisticNonGoalValues, aProbabilistic.getRowGroupIndices());
+        } else {
+            storm::utility::vector::reduceVectorMinOrMax(dir, bProbabilistic, probabilisticNonGoalValues, aProbabilistic.getRowGroupIndices());
+        }
+    };
+
+    storm::utility::ProgressMeasurement progress("steps");
+    progress.setMaxCount(numberOfSteps);
+    progress.startNewMeasurement(0);
     std::vector<ValueType> markovianNonGoalValuesSwap(markovianNonGoalValues);
     for (uint64_t currentStep = 0; currentStep < numberOfSteps; ++currentStep) {
         if (existProbabilisticStates) {
-            // Start by (re-)computing bProbabilistic = bProbabilisticFixed + aProbabilisticToMarkovian * vMarkovian.
-            aProbabilisticToMarkovian.multiplyWithVector(markovianNonGoalValues, bProbabilistic);
-            storm::utility::vector::addVectors(bProbabilistic, bProbabilisticFixed, bProbabilistic);
-
-            // Now perform the inner value iteration for probabilistic states.
-            if (solver) {
-                solver->solveEquations(solverEnv, dir, probabilisticNonGoalValues, bProbabilistic);
-            } else {
-                storm::utility::vector::reduceVectorMinOrMax(dir, bProbabilistic, probabilisticNonGoalValues, aProbabilistic.getRowGroupIndices());
-            }
+            solveProbabilisticStates();
 
             // (Re-)compute bMarkovian = bMarkovianFixed + aMarkovianToProbabilistic * vProbabilistic.
-            aMarkovianToProbabilistic.multiplyWithVector(probabilisticNonGoalValues, bMarkovian);
-            storm::utility::vector::addVectors(bMarkovian, bMarkovianFixed, bMarkovian);
+            multiplyAndAdd(markovianThreads, aMarkovianToProbabilistic, probabilisticNonGoalValues, bMarkovianFixed, bMarkovian);
         }
 
-        aMarkovian.multiplyWithVector(markovianNonGoalValues, markovianNonGoalValuesSwap);
+        multiplyAndAdd(markovianThreads, aMarkovian, markovianNonGoalValues, existProbabilisticStates ? bMarkovian : bMarkovianFixed,
+                       markovianNonGoalValuesSwap);
         std::swap(markovianNonGoalValues, markovianNonGoalValuesSwap);
-        if (existProbabilisticStates) {
-            storm::utility::vector::addVectors(markovianNonGoalValues, bMarkovian, markovianNonGoalValues);
-        } else {
-            storm::utility::vector::addVectors(markovianNonGoalValues, bMarkovianFixed, markovianNonGoalValues);
-        }
+        progress.updateProgress(currentStep + 1);
         if (storm::utility::resources::isTerminate()) {
             break;
         }
@@ -598,13 +718,7 @@ void computeBoundedReachabilityProbabilitiesImca(Environment const& env, Optimiz
 
     if (existProbabilisticStates) {
         // After the loop, perform one more step of the value iteration for PS states.
-        aProbabilisticToMarkovian.multiplyWithVector(markovianNonGoalValues, bProbabilistic);
-        storm::utility::vector::addVectors(bProbabilistic, bProbabilisticFixed, bProbabilistic);
-        if (solver) {
-            solver->solveEquations(solverEnv, dir, probabilisticNonGoalValues, bProbabilistic);
-        } else {
-            storm::utility::vector::reduceVectorMinOrMax(dir, bProbabilistic, probabilisticNonGoalValues, aProbabilistic.getRowGroupIndices());
-        }
+        solveProbabilisticStates();
     }
 }
 
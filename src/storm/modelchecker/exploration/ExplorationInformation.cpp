@@ -72,22 +72,24 @@ void ExplorationInformation<StateType, ValueType>::newRowGroup(ActionType const&
 
 template<typename StateType, typename ValueType>
 void ExplorationInformation<StateType, ValueType>::newRowGroup() {
-    newRowGroup(matrix.size());
+    newRowGroup(actionToEntryRange.size());
 }
 
 template<typename StateType, typename ValueType>
 void ExplorationInformation<StateType, ValueType>::terminateCurrentRowGroup() {
-    rowGroupIndices.push_back(matrix.size());
+    rowGroupIndices.push_back(actionToEntryRange.size());
 }
 
 template<typename StateType, typename ValueType>
 void ExplorationInformation<StateType, ValueType>::moveActionToBackOfMatrix(ActionType const& action) {
-    matrix.emplace_back(std::move(matrix[action]));
+    // The entries stay where they are, only the range is moved to a new action. The old action is left with an empty row.
+    actionToEntryRange.push_back(actionToEntryRange[action]);
+    actionToEntryRange[action].second = actionToEntryRange[action].first;
 }
 
 template<typename StateType, typename ValueType>
 StateType ExplorationInformation<StateType, ValueType>::getActionCount() const {
-    return matrix.size();
+    return actionToEntryRange.size();
 }
 
 template<typename StateType, typename ValueType>
@@ -142,19 +144,23 @@ void ExplorationInformation<StateType, ValueType>::addTerminalState(StateType co
 }
 
 template<typename StateType, typename ValueType>
-std::vector<storm::storage::MatrixEntry<StateType, ValueType>>& ExplorationInformation<StateType, ValueType>::getRowOfMatrix(ActionType const& row) {
-    return matrix[row];
+typename ExplorationInformation<StateType, ValueType>::const_row_type ExplorationInformation<StateType, ValueType>::getRowOfMatrix(
+    ActionType const& row) const {
+    auto const& range = actionToEntryRange[row];
+    return const_row_type(matrix.begin() + range.first, matrix.begin() + range.second);
 }
 
 template<typename StateType, typename ValueType>
-std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& ExplorationInformation<StateType, ValueType>::getRowOfMatrix(
-    ActionType const& row) const {
-    return matrix[row];
+void ExplorationInformation<StateType, ValueType>::addActionsToMatrix(std::size_t const& count) {
+    actionToEntryRange.resize(actionToEntryRange.size() + count, std::make_pair(matrix.size(), matrix.size()));
 }
 
 template<typename StateType, typename ValueType>
-void ExplorationInformation<StateType, ValueType>::addActionsToMatrix(std::size_t const& count) {
-    matrix.resize(matrix.size() + count);
+void ExplorationInformation<StateType, ValueType>::addEntryToLastActionOfMatrix(StateType const& column, ValueType const& value) {
+    STORM_LOG_ASSERT(!actionToEntryRange.empty() && actionToEntryRange.back().second == matrix.size(),
+                     "Entries may only be added to the last action and only while it is the last one that is filled.");
+    matrix.emplace_back(column, value);
+    ++actionToEntryRange.back().second;
 }
 
 template<typename StateType, typename ValueType>
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include <boost/optional.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include "storm/solver/OptimizationDirection.h"
 
@@ -26,7 +27,9 @@ class ExplorationInformation {
     typedef storm::storage::FlatSet<StateType> StateSet;
     typedef std::unordered_map<StateType, storm::generator::CompressedState> IdToStateMap;
     typedef typename IdToStateMap::const_iterator const_iterator;
-    typedef std::vector<std::vector<storm::storage::MatrixEntry<StateType, ValueType>>> MatrixType;
+    typedef storm::storage::MatrixEntry<StateType, ValueType> MatrixEntryType;
+    typedef std::vector<MatrixEntryType> MatrixType;
+    typedef boost::iterator_range<typename MatrixType::const_iterator> const_row_type;
 
     ExplorationInformation(storm::OptimizationDirection const& direction, ActionType const& unexploredMarker = std::numeric_limits<ActionType>::max());
 
@@ -74,12 +77,18 @@ class ExplorationInformation {
 
     void addTerminalState(StateType const& state);
 
-    std::vector<storm::storage::MatrixEntry<StateType, ValueType>>& getRowOfMatrix(ActionType const& row);
-
-    std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& getRowOfMatrix(ActionType const& row) const;
+    const_row_type getRowOfMatrix(ActionType const& row) const;
 
+    /*!
+     * Adds the given number of actions with empty rows to the matrix.
+     */
     void addActionsToMatrix(std::size_t const& count);
 
+    /*!
+     * Appends an entry to the row of the action that was added last.
+     */
+    void addEntryToLastActionOfMatrix(StateType const& column, ValueType const& value);
+
     bool maximize() const;
 
     bool minimize() const;
@@ -105,7 +114,10 @@ class ExplorationInformation {
     void setOptimizationDirection(storm::OptimizationDirection const& direction);
 
    private:
+    // The entries of all rows. Rows are stored contiguously in the order in which they are filled and never shrink, so actions only need to store
+    // the range of their entries.
     MatrixType matrix;
+    std::vector<std::pair<std::size_t, std::size_t>> actionToEntryRange;
     std::vector<StateType> rowGroupIndices;
 
     std::vector<StateType> stateToRowGroupMapping;
@@ -26,6 +26,7 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/ExplorationSettings.h"
 
+#include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
@@ -80,7 +81,15 @@ std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>
 
     // Compute and return result.
     std::tuple<StateType, ValueType, ValueType> boundsForInitialState = performExploration(stateGeneration, explorationInformation);
-    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::get<0>(boundsForInitialState), std::get<1>(boundsForInitialState));
+    auto result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::get<0>(boundsForInitialState), std::get<1>(boundsForInitialState));
+    if (storm::utility::resources::isTerminate()) {
+        // The exploration was aborted, so the value is only known to lie within the bounds.
+        typename ExplicitQuantitativeCheckResult<ValueType>::map_type lowerBound, upperBound;
+        lowerBound.emplace(std::get<0>(boundsForInitialState), std::get<1>(boundsForInitialState));
+        upperBound.emplace(std::get<0>(boundsForInitialState), std::get<2>(boundsForInitialState));
+        result->setBounds(std::move(lowerBound), std::move(upperBound));
+    }
+    return result;
 }
 
 template<typename ModelType, typename StateType>
@@ -126,6 +135,13 @@ std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueTy
         STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
         convergenceCriterionMet = comparator.isZero(difference);
 
+        if (!convergenceCriterionMet && storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Aborting the exploration, the value of the initial state is only known to lie in ["
+                           << bounds.getLowerBoundForState(initialStateIndex, explorationInformation) << ", "
+                           << bounds.getUpperBoundForState(initialStateIndex, explorationInformation) << "].");
+            break;
+        }
+
         // If the number of sampled paths exceeds a certain threshold, do a precomputation.
         if (!convergenceCriterionMet && explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
             performPrecomputation(stack, explorationInformation, bounds, stats);
@@ -255,7 +271,6 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
         if (!isTerminalState) {
             // Next, we insert the behavior into our matrix structure.
             StateType startAction = explorationInformation.getActionCount();
-            explorationInformation.addActionsToMatrix(behavior.getNumberOfChoices());
 
             ActionType localAction = 0;
 
@@ -263,8 +278,9 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
             std::pair<ValueType, ValueType> stateBounds = getLowestBounds(explorationInformation.getOptimizationDirection());
 
             for (auto const& choice : behavior) {
+                explorationInformation.addActionsToMatrix(1);
                 for (auto const& entry : choice) {
-                    explorationInformation.getRowOfMatrix(startAction + localAction).emplace_back(entry.first, entry.second);
+                    explorationInformation.addEntryToLastActionOfMatrix(entry.first, entry.second);
                     STORM_LOG_TRACE("Found transition " << currentStateId << "-[" << (startAction + localAction) << ", " << entry.second << "]-> "
                                                         << entry.first << ".");
                 }
@@ -362,7 +378,7 @@ template<typename ModelType, typename StateType>
 StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(
     ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
     Bounds<StateType, ValueType> const& bounds) const {
-    std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = explorationInformation.getRowOfMatrix(chosenAction);
+    typename ExplorationInformation<StateType, ValueType>::const_row_type row = explorationInformation.getRowOfMatrix(chosenAction);
     if (row.size() == 1) {
         return row.front().getColumn();
     }
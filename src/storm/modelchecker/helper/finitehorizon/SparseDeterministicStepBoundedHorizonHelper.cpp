@@ -2,21 +2,109 @@
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/solver/multiplier/Multiplier.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/utility/SignalHandler.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 namespace storm::modelchecker::helper {
 
+namespace {
+
+/*!
+ * Retrieves whether the given number of steps shall be performed by repeatedly squaring the (dense) matrix, which is the case if this is enabled for
+ * matrices of the given size and the roughly log(steps) dense matrix products are cheaper than the matrix-vector products of all steps.
+ */
+bool useSquaring(Environment const& env, storm::storage::SparseMatrix<double> const& matrix, uint64_t steps) {
+    if (steps < 2 || matrix.getRowCount() > env.modelchecker().getStepBoundedSquaringStateLimit()) {
+        return false;
+    }
+    double const dimension = static_cast<double>(matrix.getRowCount() + 1);
+    double const squaringCost = dimension * dimension * dimension * std::ceil(std::log2(static_cast<double>(steps)));
+    double const multiplicationCost = static_cast<double>(steps) * static_cast<double>(std::max<uint64_t>(1, matrix.getEntryCount()));
+    return squaringCost < multiplicationCost;
+}
+
+/*!
+ * Performs the given number of steps x' = A*x + b by repeatedly squaring the dense matrix [[A, b], [0, 1]], which maps (x, 1) to (A*x + b, 1).
+ */
+void multiplyBySquaring(Environment const& env, storm::storage::SparseMatrix<double> const& matrix, std::vector<double> const& b, std::vector<double>& x,
+                        uint64_t steps) {
+    uint64_t const numberOfStates = matrix.getRowCount();
+    uint64_t const dimension = numberOfStates + 1;
+    std::vector<double> power(dimension * dimension, 0.0);
+    for (uint64_t row = 0; row < numberOfStates; ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            power[row * dimension + entry.getColumn()] += entry.getValue();
+        }
+        power[row * dimension + numberOfStates] = b[row];
+    }
+    power[numberOfStates * dimension + numberOfStates] = 1.0;
+
+    std::vector<double> vector(x);
+    vector.push_back(1.0);
+    std::vector<double> nextVector(dimension);
+    std::vector<double> product(dimension * dimension);
+    uint64_t const numberOfThreads = std::min<uint64_t>(env.solver().getNumberOfThreads(), std::max<uint64_t>(1, dimension / 64));
+    auto squareRows = [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t row = begin; row < end; ++row) {
+            double* productRow = product.data() + row * dimension;
+            std::fill(productRow, productRow + dimension, 0.0);
+            for (uint64_t k = 0; k < dimension; ++k) {
+                double const factor = power[row * dimension + k];
+                if (factor != 0.0) {
+                    double const* powerRow = power.data() + k * dimension;
+                    for (uint64_t column = 0; column < dimension; ++column) {
+                        productRow[column] += factor * powerRow[column];
+                    }
+                }
+            }
+        }
+    };
+
+    // As all powers of the matrix commute, we can apply the powers for the set bits of the number of steps in any order.
+    for (uint64_t remainingSteps = steps; remainingSteps > 0; remainingSteps >>= 1) {
+        if (remainingSteps & 1) {
+            for (uint64_t row = 0; row < dimension; ++row) {
+                double const* powerRow = power.data() + row * dimension;
+                double value = 0.0;
+                for (uint64_t column = 0; column < dimension; ++column) {
+                    value += powerRow[column] * vector[column];
+                }
+                nextVector[row] = value;
+            }
+            std::swap(vector, nextVector);
+        }
+        if (remainingSteps > 1) {
+            storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), dimension, squareRows);
+            std::swap(power, product);
+        }
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Aborting the computation of " << steps << " steps by squaring the matrix.");
+            break;
+        }
+    }
+    vector.pop_back();
+    x = std::move(vector);
+}
+
+}  // namespace
+
 template<typename ValueType>
 SparseDeterministicStepBoundedHorizonHelper<ValueType>::SparseDeterministicStepBoundedHorizonHelper() {
     // Intentionally left empty.
@@ -40,7 +128,7 @@ std::vector<ValueType> SparseDeterministicStepBoundedHorizonHelper<ValueType>::c
     } else {
         maybeStates = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, upperBound);
         if (lowerBound == 0) {
-            maybeStates &= ~psiStates;
+            maybeStates.andNot(psiStates);
         } else {
             makeZeroColumns = psiStates;
         }
@@ -61,16 +149,25 @@ std::vector<ValueType> SparseDeterministicStepBoundedHorizonHelper<ValueType>::c
         // Create the vector with which to multiply.
         std::vector<ValueType> subresult(maybeStates.getNumberOfSetBits());
 
-        // Perform the matrix vector multiplication
-        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
+        // Perform the matrix vector multiplications, which stop early once the vector no longer changes.
+        auto performSteps = [&](storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t steps) {
+            if constexpr (std::is_same_v<ValueType, double>) {
+                if (useSquaring(env, matrix, steps)) {
+                    STORM_LOG_INFO("Performing " << steps << " steps by repeatedly squaring the matrix.");
+                    multiplyBySquaring(env, matrix, b, subresult, steps);
+                    return;
+                }
+            }
+            auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, matrix);
+            multiplier->repeatedMultiplyUntilSteady(env, subresult, &b, steps, env.modelchecker().getStepBoundedSteadyPrecision());
+        };
         if (lowerBound == 0) {
-            multiplier->repeatedMultiply(env, subresult, &b, upperBound);
+            performSteps(submatrix, upperBound);
         } else {
-            multiplier->repeatedMultiply(env, subresult, &b, upperBound - lowerBound + 1);
+            performSteps(submatrix, upperBound - lowerBound + 1);
             submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, true);
-            multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
             b = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
-            multiplier->repeatedMultiply(env, subresult, &b, lowerBound - 1);
+            performSteps(submatrix, lowerBound - 1);
         }
 
         // Set the values of the resulting vector accordingly.
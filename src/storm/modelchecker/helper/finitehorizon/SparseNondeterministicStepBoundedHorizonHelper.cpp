@@ -8,6 +8,7 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/solver/multiplier/Multiplier.h"
 #include "storm/storage/expressions/Expression.h"
@@ -47,7 +48,7 @@ std::vector<ValueType> SparseNondeterministicStepBoundedHorizonHelper<ValueType>
             maybeStates = storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates, true, upperBound);
         }
         if (lowerBound == 0) {
-            maybeStates &= ~psiStates;
+            maybeStates.andNot(psiStates);
         } else {
             makeZeroColumns = psiStates;
         }
@@ -63,15 +64,17 @@ std::vector<ValueType> SparseNondeterministicStepBoundedHorizonHelper<ValueType>
         // Create the vector with which to multiply.
         std::vector<ValueType> subresult(maybeStates.getNumberOfSetBits());
 
+        // The multiplications stop early once the vector no longer changes.
+        double const steadyPrecision = env.modelchecker().getStepBoundedSteadyPrecision();
         auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
         if (lowerBound == 0) {
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, upperBound);
+            multiplier->repeatedMultiplyAndReduceUntilSteady(env, goal.direction(), subresult, &b, upperBound, steadyPrecision);
         } else {
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, upperBound - lowerBound + 1);
+            multiplier->repeatedMultiplyAndReduceUntilSteady(env, goal.direction(), subresult, &b, upperBound - lowerBound + 1, steadyPrecision);
             storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
             auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
             b = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, lowerBound - 1);
+            multiplier->repeatedMultiplyAndReduceUntilSteady(env, goal.direction(), subresult, &b, lowerBound - 1, steadyPrecision);
         }
         // Set the values of the resulting vector accordingly.
         storm::utility::vector::setVectorValues(result, maybeStates, subresult);
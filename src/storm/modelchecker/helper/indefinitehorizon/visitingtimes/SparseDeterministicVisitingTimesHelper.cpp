@@ -1,11 +1,13 @@
 #include "SparseDeterministicVisitingTimesHelper.h"
 
 #include <algorithm>
+#include <atomic>
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/helper/TopologicalSccScheduling.h"
 
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 
@@ -13,6 +15,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/NotSupportedException.h"
@@ -116,39 +119,62 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingT
         // We need to adapt precision if we solve each SCC separately (in topological order) and/or consider CTMCs
         auto sccEnv = getEnvironmentForSolver(env, true);
 
+        // Store for each state its SCC and its index within the SCC
+        stateToScc.resize(stateValues.size());
+        stateToLocalIndex.resize(stateValues.size());
+        for (uint64_t sccIndex = 0; sccIndex < sccDecomposition->size(); ++sccIndex) {
+            uint64_t localIndex = 0;
+            for (auto state : sccDecomposition->getBlock(sccIndex)) {
+                stateToScc[state] = sccIndex;
+                stateToLocalIndex[state] = localIndex++;
+            }
+        }
+
         // We solve each SCC individually in *forward* topological order
         storm::utility::ProgressMeasurement progress("sccs");
         progress.setMaxCount(sccDecomposition->size());
         progress.startNewMeasurement(0);
-        uint64_t sccIndex = 0;
-        auto sccItEnd = std::make_reverse_iterator(sccDecomposition->begin());
-        for (auto sccIt = std::make_reverse_iterator(sccDecomposition->end()); sccIt != sccItEnd; ++sccIt) {
-            auto const& scc = *sccIt;
-            if (scc.size() == 1) {
-                processSingletonScc(*scc.begin(), stateValues);
-            } else {
-                sccAsBitVector.set(scc.begin(), scc.end(), true);
-                if (sccAsBitVector.isSubsetOf(nonBsccStates)) {
-                    // This is not a BSCC
-                    auto sccResult = computeValueForStateSet(sccEnv, sccAsBitVector, stateValues);
-                    storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, sccResult);
-                } else {
-                    // This is a BSCC
-                    if (std::any_of(sccAsBitVector.begin(), sccAsBitVector.end(), isReachableInState)) {
-                        storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::infinity<ValueType>());
-                    } else {
-                        storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::zero<ValueType>());
+        uint64_t const numberOfThreads = storm::solver::helper::getNumberOfThreadsForSccs(env, *sccDecomposition);
+        if (numberOfThreads > 1) {
+            // SCCs that do not depend on each other are solved concurrently, so each of them is solved with a single thread.
+            STORM_LOG_INFO("Computing visiting times of " << sccDecomposition->size() << " SCCs with " << numberOfThreads << " threads.");
+            storm::Environment threadEnv(sccEnv);
+            threadEnv.solver().setNumberOfThreads(1);
+            // As the backward transitions are considered, every SCC depends on the SCCs that have a transition into it.
+            auto dependencies = storm::solver::helper::computeSccDependencies(*backwardTransitions, *sccDecomposition);
+            std::atomic<uint64_t> numberOfProcessedSccs(0);
+            bool finished = storm::utility::parallel::forEachInDependencyOrder(
+                numberOfThreads, dependencies.dependencyCounts, dependencies.dependentOffsets, dependencies.dependents,
+                [&](uint64_t threadIndex, uint64_t sccIndex) {
+                    processScc(threadEnv, sccIndex, stateValues);
+                    uint64_t processedSccs = ++numberOfProcessedSccs;
+                    if (threadIndex == 0) {
+                        progress.updateProgress(processedSccs);
                     }
-                }
-                sccAsBitVector.clear();
+                    return !storm::utility::resources::isTerminate();
+                });
+            if (!finished) {
+                STORM_LOG_WARN("Visiting times computation aborted after analyzing " << numberOfProcessedSccs.load() << "/" << sccDecomposition->size()
+                                                                                     << " SCCs.");
             }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Visiting times computation aborted after analyzing " << sccIndex << "/" << this->computedSccDecomposition->size() << " SCCs.");
-                break;
+        } else {
+            // The decomposition is sorted such that SCCs only have transitions into SCCs with a smaller index.
+            uint64_t numberOfProcessedSccs = 0;
+            for (uint64_t sccIndex = sccDecomposition->size(); sccIndex > 0; --sccIndex) {
+                processScc(sccEnv, sccIndex - 1, stateValues);
+                ++numberOfProcessedSccs;
+                progress.updateProgress(numberOfProcessedSccs);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Visiting times computation aborted after analyzing " << numberOfProcessedSccs << "/" << sccDecomposition->size()
+                                                                                         << " SCCs.");
+                    break;
+                }
             }
         }
+        stateToScc.clear();
+        stateToScc.shrink_to_fit();
+        stateToLocalIndex.clear();
+        stateToLocalIndex.shrink_to_fit();
     } else {
         // We solve the equation system for all non-BSCC in one step (not each SCC individually - adaption of precision is not necessary).
         if (!nonBsccStates.empty()) {
@@ -261,6 +287,22 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
     return upperBounds;
 }
 
+template<>
+std::vector<storm::RationalFunction> SparseDeterministicVisitingTimesHelper<storm::RationalFunction>::computeUpperBounds(
+    storm::storage::SparseMatrix<storm::RationalFunction> const& /*transposedSubsystemMatrix*/,
+    std::vector<storm::RationalFunction> const& /*leavingProbabilities*/) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                    "Computing upper bounds for expected visiting times over rational functions is not supported.");
+}
+
+template<typename ValueType>
+std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::computeUpperBounds(
+    storm::storage::SparseMatrix<ValueType> const& transposedSubsystemMatrix, std::vector<ValueType> const& leavingProbabilities) const {
+    // The transposed matrix serves as backward transitions of the subsystem.
+    return storm::modelchecker::helper::BaierUpperRewardBoundsComputer<ValueType>::computeUpperBoundOnExpectedVisitingTimes(
+        transposedSubsystemMatrix.transpose(), transposedSubsystemMatrix, leavingProbabilities);
+}
+
 template<typename ValueType>
 storm::Environment SparseDeterministicVisitingTimesHelper<ValueType>::getEnvironmentForSolver(storm::Environment const& env, bool topological) const {
     storm::Environment newEnv(env);
@@ -448,6 +490,50 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
     return computeExpectedVisitingTimes(env, stateSetAsBitvector, sccVector);
 }
 
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::processScc(storm::Environment const& env, uint64_t sccIndex,
+                                                                   std::vector<ValueType>& stateValues) const {
+    auto const& scc = sccDecomposition->getBlock(sccIndex);
+    if (scc.size() == 1) {
+        processSingletonScc(*scc.begin(), stateValues);
+        return;
+    }
+
+    auto isEnteringTransitionWithNonZeroValue = [this, sccIndex, &stateValues](auto const& e) {
+        return stateToScc[e.getColumn()] != sccIndex && !storm::utility::isZero(stateValues[e.getColumn()]);
+    };
+    if (nonBsccStates.get(*scc.begin())) {
+        // This is not a BSCC. Get the vector for the equation system, i.e., the initial values plus the values that flow into the SCC.
+        std::vector<ValueType> sccVector;
+        sccVector.reserve(scc.size());
+        for (auto sccState : scc) {
+            sccVector.push_back(stateValues[sccState]);
+            for (auto const& entry : backwardTransitions->getRow(sccState)) {
+                if (stateToScc[entry.getColumn()] != sccIndex) {
+                    sccVector.back() += entry.getValue() * stateValues[entry.getColumn()];
+                }
+            }
+        }
+        auto getLocalIndex = [this, sccIndex, &scc](uint64_t state) { return stateToScc[state] == sccIndex ? stateToLocalIndex[state] : scc.size(); };
+        auto sccResult = solveSubsystem(env, scc, scc.size(), getLocalIndex, sccVector);
+        auto resultIt = sccResult.begin();
+        for (auto sccState : scc) {
+            stateValues[sccState] = std::move(*resultIt);
+            ++resultIt;
+        }
+    } else {
+        // This is a BSCC, we set the values of the states to infinity or 0.
+        bool isReachable = std::any_of(scc.begin(), scc.end(), [this, &stateValues, &isEnteringTransitionWithNonZeroValue](uint64_t state) {
+            auto row = this->backwardTransitions->getRow(state);
+            return !storm::utility::isZero(stateValues[state]) || std::any_of(row.begin(), row.end(), isEnteringTransitionWithNonZeroValue);
+        });
+        ValueType const value = isReachable ? storm::utility::infinity<ValueType>() : storm::utility::zero<ValueType>();
+        for (auto sccState : scc) {
+            stateValues[sccState] = value;
+        }
+    }
+}
+
 template<typename ValueType>
 std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingTimes(Environment const& env,
                                                                                                        storm::storage::BitVector const& subsystem,
@@ -458,6 +544,17 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
         return {};
     }
 
+    std::vector<uint64_t> localIndices = subsystem.getNumberOfSetBitsBeforeIndices();
+    uint64_t const numberOfStates = initialValues.size();
+    auto getLocalIndex = [&subsystem, &localIndices, numberOfStates](uint64_t state) { return subsystem.get(state) ? localIndices[state] : numberOfStates; };
+    return solveSubsystem(env, subsystem, numberOfStates, getLocalIndex, initialValues);
+}
+
+template<typename ValueType>
+template<typename States, typename LocalIndexGetter>
+std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::solveSubsystem(Environment const& env, States const& states, uint64_t numberOfStates,
+                                                                                         LocalIndexGetter const& getLocalIndex,
+                                                                                         std::vector<ValueType> const& initialValues) const {
     // Here we assume that the subsystem does not contain a BSCC
     // Let P be the subsystem matrix. We solve the equation system
     //       x * P + b = x
@@ -467,38 +564,98 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
     // TODO We need to check if SVI works on this kind of equation system (OVI and II are correct)
     storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
     bool isFixpointFormat = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::FixedPointSystem;
+    auto req = linearEquationSolverFactory.getRequirements(env);
+    req.clearLowerBounds();
+    bool const needUpperBounds = req.upperBounds().isCritical();
 
     // Get the matrix for the equation system
-    auto sccMatrix = backwardTransitions->getSubmatrix(false, subsystem, subsystem, !isFixpointFormat);
-    if (!isFixpointFormat) {
-        sccMatrix.convertToEquationSystem();
-    }
-
-    // Get the solver object and satisfy requirements
-    auto solver = linearEquationSolverFactory.create(env, std::move(sccMatrix));
-    solver->setLowerBound(storm::utility::zero<ValueType>());
-    auto req = solver->getRequirements(env);
-    req.clearLowerBounds();
-    if (req.upperBounds().isCritical()) {
+    std::vector<ValueType> leavingProbabilities;
+    auto sccMatrix =
+        createTransposedSubsystemMatrix(states, numberOfStates, getLocalIndex, !isFixpointFormat, needUpperBounds ? &leavingProbabilities : nullptr);
+    std::vector<ValueType> upperBounds;
+    if (needUpperBounds) {
         // Compute upper bounds on EVTs using techniques from Baier et al. [CAV'17] (https://doi.org/10.1007/978-3-319-63387-9_8)
-        std::vector<ValueType> upperBounds = computeUpperBounds(subsystem);
-        solver->setUpperBounds(upperBounds);
+        upperBounds = computeUpperBounds(sccMatrix, leavingProbabilities);
         req.clearUpperBounds();
     }
-
     if (req.acyclic().isCritical()) {
         STORM_LOG_THROW(!storm::utility::graph::hasCycle(sccMatrix), storm::exceptions::UnmetRequirementException,
                         "The solver requires an acyclic model, but the model is not acyclic.");
         req.clearAcyclic();
     }
-
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UnmetRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
+    if (!isFixpointFormat) {
+        sccMatrix.convertToEquationSystem();
+    }
+
+    // Get the solver object
+    auto solver = linearEquationSolverFactory.create(env, std::move(sccMatrix));
+    solver->setLowerBound(storm::utility::zero<ValueType>());
+    if (needUpperBounds) {
+        solver->setUpperBounds(std::move(upperBounds));
+    }
     std::vector<ValueType> eqSysValues(initialValues.size());
     solver->solveEquations(env, eqSysValues, initialValues);
     return eqSysValues;
 }
 
+template<typename ValueType>
+template<typename States, typename LocalIndexGetter>
+storm::storage::SparseMatrix<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::createTransposedSubsystemMatrix(
+    States const& states, uint64_t numberOfStates, LocalIndexGetter const& getLocalIndex, bool insertDiagonalEntries,
+    std::vector<ValueType>* leavingProbabilities) const {
+    typedef typename storm::storage::SparseMatrix<ValueType>::index_type IndexType;
+
+    // Count the entries of each row of the transposed matrix, i.e., of each column of the subsystem matrix. Zero entries are dropped.
+    std::vector<IndexType> rowIndications(numberOfStates + 1, insertDiagonalEntries ? 1 : 0);
+    rowIndications[0] = 0;
+    uint64_t localState = 0;
+    for (auto state : states) {
+        for (auto const& entry : transitionMatrix.getRow(state)) {
+            uint64_t const localColumn = getLocalIndex(entry.getColumn());
+            if (localColumn < numberOfStates && !storm::utility::isZero(entry.getValue()) && !(insertDiagonalEntries && localColumn == localState)) {
+                ++rowIndications[localColumn + 1];
+            }
+        }
+        ++localState;
+    }
+    for (uint64_t row = 0; row < numberOfStates; ++row) {
+        rowIndications[row + 1] += rowIndications[row];
+    }
+
+    // Insert the entries. As the states are processed in ascending order, the entries of each row are sorted by their column.
+    std::vector<storm::storage::MatrixEntry<IndexType, ValueType>> columnsAndValues(rowIndications.back());
+    std::vector<IndexType> nextPositions(rowIndications.begin(), rowIndications.end() - 1);
+    if (leavingProbabilities) {
+        leavingProbabilities->assign(numberOfStates, storm::utility::zero<ValueType>());
+    }
+    localState = 0;
+    for (auto state : states) {
+        IndexType diagonalPosition = 0;
+        if (insertDiagonalEntries) {
+            // All entries of this row that stem from states with a smaller index are already inserted.
+            diagonalPosition = nextPositions[localState]++;
+            columnsAndValues[diagonalPosition] = storm::storage::MatrixEntry<IndexType, ValueType>(localState, storm::utility::zero<ValueType>());
+        }
+        for (auto const& entry : transitionMatrix.getRow(state)) {
+            uint64_t const localColumn = getLocalIndex(entry.getColumn());
+            if (localColumn >= numberOfStates) {
+                if (leavingProbabilities) {
+                    (*leavingProbabilities)[localState] += entry.getValue();
+                }
+            } else if (insertDiagonalEntries && localColumn == localState) {
+                columnsAndValues[diagonalPosition].setValue(entry.getValue());
+            } else if (!storm::utility::isZero(entry.getValue())) {
+                columnsAndValues[nextPositions[localColumn]++] = storm::storage::MatrixEntry<IndexType, ValueType>(localState, entry.getValue());
+            }
+        }
+        ++localState;
+    }
+    STORM_LOG_ASSERT(localState == numberOfStates, "Inconsistent size of subsystem.");
+    return storm::storage::SparseMatrix<ValueType>(numberOfStates, std::move(rowIndications), std::move(columnsAndValues), boost::none);
+}
+
 template class SparseDeterministicVisitingTimesHelper<double>;
 template class SparseDeterministicVisitingTimesHelper<storm::RationalNumber>;
 template class SparseDeterministicVisitingTimesHelper<storm::RationalFunction>;
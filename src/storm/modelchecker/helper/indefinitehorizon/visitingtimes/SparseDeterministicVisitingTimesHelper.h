@@ -130,6 +130,14 @@ class SparseDeterministicVisitingTimesHelper : public SingleValueModelCheckerHel
      */
     std::vector<ValueType> computeUpperBounds(storm::storage::BitVector const& stateSetAsBitVector) const;
 
+    /*!
+     * Computes for each state of a subsystem an upper bound on the expected number of times we are visiting that state.
+     * @param transposedSubsystemMatrix the transposed transition matrix restricted to the subsystem (in fixpoint format).
+     * @param leavingProbabilities for each subsystem state the probability to leave the subsystem in one step.
+     */
+    std::vector<ValueType> computeUpperBounds(storm::storage::SparseMatrix<ValueType> const& transposedSubsystemMatrix,
+                                              std::vector<ValueType> const& leavingProbabilities) const;
+
     /*!
      * Adapts the precision of the solving method if necessary (i.e., if the model is a CTMC or when a topological solving method is used).
      * @param env The environment, containing information on the precision that should be achieved.
@@ -155,6 +163,39 @@ class SparseDeterministicVisitingTimesHelper : public SingleValueModelCheckerHel
     std::vector<ValueType> computeValueForStateSet(storm::Environment const& env, storm::storage::BitVector const& stateSetAsBitVector,
                                                    std::vector<ValueType> const& stateValues) const;
 
+    /*!
+     * Computes the values of the states of the given SCC, assuming that the values of all states with a transition into the SCC are final.
+     * Only the values of the states of the SCC are written, which allows to process SCCs that do not depend on each other concurrently.
+     * @pre stateToScc and stateToLocalIndex are initialized.
+     */
+    void processScc(storm::Environment const& env, uint64_t sccIndex, std::vector<ValueType>& stateValues) const;
+
+    /*!
+     * Solves the equation system for the given subsystem that does not contain a BSCC.
+     * @param states the states of the subsystem in ascending order.
+     * @param numberOfStates the number of states of the subsystem.
+     * @param getLocalIndex returns for each state its index within the subsystem or a value of at least numberOfStates if it is not in the subsystem.
+     * @param initialValues the initial value of each subsystem state, including the values that flow into the subsystem.
+     * @return for each state of the subsystem the expected number of times that state is visited.
+     */
+    template<typename States, typename LocalIndexGetter>
+    std::vector<ValueType> solveSubsystem(storm::Environment const& env, States const& states, uint64_t numberOfStates, LocalIndexGetter const& getLocalIndex,
+                                          std::vector<ValueType> const& initialValues) const;
+
+    /*!
+     * Builds the transposed transition matrix restricted to the given subsystem directly from the transition matrix, i.e., without creating the submatrix
+     * of the (complete) backward transitions.
+     * @param states the states of the subsystem in ascending order.
+     * @param numberOfStates the number of states of the subsystem.
+     * @param getLocalIndex returns for each state its index within the subsystem or a value of at least numberOfStates if it is not in the subsystem.
+     * @param insertDiagonalEntries if set, every row gets a (possibly zero) diagonal entry such that the matrix can be converted to an equation system.
+     * @param leavingProbabilities if given, this is set to the probabilities to leave the subsystem in one step.
+     */
+    template<typename States, typename LocalIndexGetter>
+    storm::storage::SparseMatrix<ValueType> createTransposedSubsystemMatrix(States const& states, uint64_t numberOfStates,
+                                                                            LocalIndexGetter const& getLocalIndex, bool insertDiagonalEntries,
+                                                                            std::vector<ValueType>* leavingProbabilities) const;
+
     storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
     storm::OptionalRef<std::vector<ValueType> const> exitRates;
 
@@ -165,6 +206,10 @@ class SparseDeterministicVisitingTimesHelper : public SingleValueModelCheckerHel
     std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> computedSccDecomposition;
 
     storm::storage::BitVector nonBsccStates;
+
+    // For each state, the index of its SCC and its index within that SCC (only available during the SCC-wise computation).
+    std::vector<uint64_t> stateToScc;
+    std::vector<uint64_t> stateToLocalIndex;
 };
 
 }  // namespace helper
@@ -1,5 +1,7 @@
 #include "SparseDeterministicInfiniteHorizonHelper.h"
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -15,11 +17,15 @@
 #include "storm/solver/LinearEquationSolver.h"
 
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/solver.h"
 #include "storm/utility/vector.h"
 
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/exceptions/NotSupportedException.h"
@@ -272,8 +278,15 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
         alg = storm::SteadyStateDistributionAlgorithm::EquationSystem;
     }
 
+    if (alg == storm::SteadyStateDistributionAlgorithm::PowerIteration && (!std::is_same_v<ValueType, double> || subEnv.solver().isForceExact())) {
+        STORM_LOG_WARN("Power iteration for steady state distributions requires floating point numbers. Solving an equation system instead.");
+        alg = storm::SteadyStateDistributionAlgorithm::EquationSystem;
+    }
+
     if (alg == storm::SteadyStateDistributionAlgorithm::EquationSystem) {
         return computeSteadyStateDistrForBsccEqSys(subEnv, bscc);
+    } else if (alg == storm::SteadyStateDistributionAlgorithm::PowerIteration) {
+        return computeSteadyStateDistrForBsccPower(subEnv, bscc);
     } else {
         STORM_LOG_ASSERT(alg == storm::SteadyStateDistributionAlgorithm::ExpectedVisitingTimes,
                          "Unexpected algorithm for steady state distribution computation.");
@@ -460,6 +473,109 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
     return steadyStateDistr;
 }
 
+template<typename ValueType>
+std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::computeSteadyStateDistrForBsccPower(
+    Environment const& env, storm::storage::StronglyConnectedComponent const& bscc) {
+    if constexpr (!std::is_same_v<ValueType, double>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "Power iteration for steady state distributions is only supported for floating point numbers.");
+    } else {
+        STORM_LOG_ASSERT(std::is_sorted(bscc.begin(), bscc.end()), "Expected that bsccs are sorted.");
+        STORM_LOG_WARN_COND(!env.solver().isForceSoundness(),
+                            "Power iteration does not give sound guarantees for steady state distributions. You might get incorrect results.");
+
+        // Each state keeps its value with probability 1-s and otherwise moves according to its transition probabilities. This makes the chain aperiodic
+        // without changing its steady state distribution. For continuous time, this also uniformizes the chain: s is the exit rate divided by the
+        // uniformization rate.
+        double const laziness = 0.1;
+        uint64_t const numberOfStates = bscc.size();
+        storm::storage::BitVector bsccStates(this->_transitionMatrix.getRowCount(), false);
+        bsccStates.set(bscc.begin(), bscc.end(), true);
+        std::vector<double> moveProbabilities(numberOfStates, 1.0 - laziness);
+        if (this->isContinuousTime()) {
+            double maximalExitRate = 0.0;
+            for (auto state : bsccStates) {
+                maximalExitRate = std::max(maximalExitRate, (*this->_exitRates)[state]);
+            }
+            double const uniformizationRate = maximalExitRate / (1.0 - laziness);
+            auto probIt = moveProbabilities.begin();
+            for (auto state : bsccStates) {
+                *probIt = (*this->_exitRates)[state] / uniformizationRate;
+                ++probIt;
+            }
+        }
+
+        // Row j of the transposed matrix collects the probability flow that enters state j in one step.
+        auto flowMatrix = this->_transitionMatrix.getSubmatrix(false, bsccStates, bsccStates);
+        for (uint64_t row = 0; row < numberOfStates; ++row) {
+            for (auto& entry : flowMatrix.getRow(row)) {
+                entry.setValue(entry.getValue() * moveProbabilities[row]);
+            }
+        }
+        flowMatrix = flowMatrix.transpose();
+
+        auto prec = env.solver().getPrecisionOfLinearEquationSolver(env.solver().getLinearEquationSolverType());
+        double const precision = prec.first.is_initialized() ? storm::utility::convertNumber<double>(*prec.first) : 1e-06;
+        bool const relative = prec.second.is_initialized() ? *prec.second : false;
+        uint64_t const maxIterations = env.solver().native().getMaximalNumberOfIterations();
+        // Spawning threads in every iteration only pays off for large BSCCs.
+        uint64_t const numberOfThreads = numberOfStates >= 10000 ? env.solver().getNumberOfThreads() : 1;
+        auto const& observer = env.solver().getIterationObserver();
+
+        std::vector<double> steadyStateDistr(numberOfStates, 1.0 / numberOfStates);
+        std::vector<double> nextDistr(numberOfStates);
+        std::vector<double> chunkDifferences(numberOfThreads), chunkSums(numberOfThreads);
+        auto multiplyChunk = [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+            double difference = 0.0, sum = 0.0;
+            for (uint64_t state = begin; state < end; ++state) {
+                double value = (1.0 - moveProbabilities[state]) * steadyStateDistr[state];
+                for (auto const& entry : flowMatrix.getRow(state)) {
+                    value += entry.getValue() * steadyStateDistr[entry.getColumn()];
+                }
+                double stateDifference = std::abs(value - steadyStateDistr[state]);
+                if (relative && value > 0.0) {
+                    stateDifference /= value;
+                }
+                difference = std::max(difference, stateDifference);
+                sum += value;
+                nextDistr[state] = value;
+            }
+            chunkDifferences[threadIndex] = difference;
+            chunkSums[threadIndex] = sum;
+        };
+
+        storm::utility::Stopwatch iterationWatch(true);
+        bool converged = false;
+        uint64_t iterations = 0;
+        while (!converged && iterations < maxIterations) {
+            uint64_t numberOfChunks =
+                storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), numberOfStates, multiplyChunk);
+            ++iterations;
+            steadyStateDistr.swap(nextDistr);
+            double const difference = *std::max_element(chunkDifferences.begin(), chunkDifferences.begin() + numberOfChunks);
+            double const sum = std::accumulate(chunkSums.begin(), chunkSums.begin() + numberOfChunks, 0.0);
+            // The iteration preserves the total mass up to numerical inaccuracies, which we counter by normalizing.
+            storm::utility::vector::scaleVectorInPlace(steadyStateDistr, 1.0 / sum);
+            converged = difference <= precision;
+            if (observer) {
+                storm::solver::SolverIterationInfo info;
+                info.iteration = iterations;
+                info.elapsedSeconds = iterationWatch.getTimeInMilliseconds() / 1000.0;
+                info.residual = difference;
+                if (!observer(info)) {
+                    break;
+                }
+            }
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
+        }
+        STORM_LOG_WARN_COND(converged, "Power iteration for steady state distribution did not converge within " << iterations << " iterations.");
+        STORM_LOG_INFO("Power iteration for steady state distribution of BSCC with " << numberOfStates << " states took " << iterations << " iterations.");
+        return steadyStateDistr;
+    }
+}
+
 template<typename ValueType>
 std::pair<ValueType, std::vector<ValueType>> SparseDeterministicInfiniteHorizonHelper<ValueType>::computeLraForBsccSteadyStateDistr(
     Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
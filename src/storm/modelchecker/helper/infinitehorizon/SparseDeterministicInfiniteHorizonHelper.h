@@ -69,6 +69,12 @@ class SparseDeterministicInfiniteHorizonHelper : public SparseInfiniteHorizonHel
     std::vector<ValueType> computeSteadyStateDistrForBsccEqSys(Environment const& env, storm::storage::StronglyConnectedComponent const& bscc);
     std::vector<ValueType> computeSteadyStateDistrForBsccEVTs(Environment const& env, storm::storage::StronglyConnectedComponent const& bscc);
 
+    /*!
+     * Computes the steady state distribution for the given BSCC by a (parallel) power iteration on the uniformized BSCC submatrix.
+     * The number of threads is taken from the solver environment. Only supported for floating point numbers.
+     */
+    std::vector<ValueType> computeSteadyStateDistrForBsccPower(Environment const& env, storm::storage::StronglyConnectedComponent const& bscc);
+
     std::pair<bool, ValueType> computeLraForTrivialBscc(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                                         storm::storage::StronglyConnectedComponent const& bscc);
 
@@ -1,5 +1,7 @@
 #include "SparseInfiniteHorizonHelper.h"
 
+#include <mutex>
+
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
 
@@ -15,19 +17,30 @@
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
+#include "storm/utility/Profiler.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/solver.h"
 #include "storm/utility/vector.h"
 
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/exceptions/UnmetRequirementException.h"
 
 namespace storm {
 namespace modelchecker {
+namespace {
+// Components with at least this many states are solved one after another, each using all threads, as they benefit from a parallel value iteration operator.
+uint64_t const largeComponentSize = 10000;
+// The number of (small) components that a thread processes at once.
+uint64_t const componentBlockSize = 8;
+}  // namespace
+
 namespace helper {
 
 template<typename ValueType, bool Nondeterministic>
@@ -169,11 +182,44 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     progress.setMaxCount(_longRunComponentDecomposition->size());
     progress.startNewMeasurement(0);
     STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
-    std::vector<ValueType> componentLraValues;
-    componentLraValues.reserve(_longRunComponentDecomposition->size());
-    for (auto const& c : *_longRunComponentDecomposition) {
-        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
-        progress.updateProgress(componentLraValues.size());
+    std::vector<ValueType> componentLraValues(_longRunComponentDecomposition->size());
+    uint64_t numberOfProcessedComponents = 0;
+    std::mutex progressMutex;
+    auto processComponent = [&](Environment const& componentEnv, uint64_t componentIndex) {
+        auto const& component = (*_longRunComponentDecomposition)[componentIndex];
+        storm::utility::ProfilerPhase phase("lra-component");
+        phase.addCounter("states", component.size());
+        componentLraValues[componentIndex] = computeLraForComponent(componentEnv, stateRewardsGetter, actionRewardsGetter, component);
+        std::lock_guard<std::mutex> lock(progressMutex);
+        progress.updateProgress(++numberOfProcessedComponents);
+    };
+
+    // The components are independent, so the small ones are distributed among the threads. LP solvers and rational functions are not necessarily thread
+    // safe, which is why components that might need them are processed sequentially.
+    uint64_t const numberOfThreads = std::max<uint64_t>(1, env.solver().getNumberOfThreads());
+    bool const mightUseLpSolver = Nondeterministic && (env.solver().lra().getNondetLraMethod() == storm::solver::LraMethod::LinearProgramming ||
+                                                       ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) &&
+                                                        env.solver().lra().isNondetLraMethodSetFromDefault()));
+    bool const concurrent = numberOfThreads > 1 && !mightUseLpSolver && !std::is_same_v<ValueType, storm::RationalFunction>;
+    std::vector<uint64_t> smallComponents;
+    for (uint64_t componentIndex = 0; componentIndex < _longRunComponentDecomposition->size(); ++componentIndex) {
+        if (concurrent && (*_longRunComponentDecomposition)[componentIndex].size() < largeComponentSize) {
+            smallComponents.push_back(componentIndex);
+        } else {
+            processComponent(underlyingSolverEnvironment, componentIndex);
+        }
+    }
+    if (!smallComponents.empty()) {
+        STORM_LOG_INFO("Computing long run average values for " << smallComponents.size() << " components concurrently using " << numberOfThreads
+                                                                << " threads.");
+        auto sequentialSolverEnvironment = underlyingSolverEnvironment;
+        sequentialSolverEnvironment.solver().setNumberOfThreads(1);
+        storm::utility::parallel::forEachBlock(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(smallComponents.size()), componentBlockSize,
+                                               [&](uint64_t, uint64_t blockBegin, uint64_t blockEnd) {
+                                                   for (uint64_t index = blockBegin; index < blockEnd; ++index) {
+                                                       processComponent(sequentialSolverEnvironment, smallComponents[index]);
+                                                   }
+                                               });
     }
 
     // Solve the resulting SSP where end components are collapsed into single auxiliary states
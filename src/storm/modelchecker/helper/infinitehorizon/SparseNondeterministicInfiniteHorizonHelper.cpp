@@ -81,12 +81,14 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
                                                                                          storm::storage::MaximalEndComponent const& component) {
     // For models with potential nondeterminisim, we compute the LRA for a maximal end component (MEC)
 
-    // Allocate memory for the nondeterministic choices.
+    // Allocate memory for the nondeterministic choices. If the components are processed concurrently, this has already been done.
     if (this->isProduceSchedulerSet()) {
         if (!this->_producedOptimalChoices.is_initialized()) {
             this->_producedOptimalChoices.emplace();
         }
-        this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+        if (this->_producedOptimalChoices->size() != this->_transitionMatrix.getRowGroupCount()) {
+            this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+        }
     }
 
     auto trivialResult = this->computeLraForTrivialMec(env, stateRewardsGetter, actionRewardsGetter, component);
@@ -1,5 +1,5 @@
 #pragma once
 
 namespace storm {
-enum class SteadyStateDistributionAlgorithm { Automatic, EquationSystem, ExpectedVisitingTimes, Classic };
+enum class SteadyStateDistributionAlgorithm { Automatic, EquationSystem, ExpectedVisitingTimes, Classic, PowerIteration };
 }
\ No newline at end of file
@@ -1,20 +1,28 @@
 #include "SparseLTLHelper.h"
 
+#include <algorithm>
+#include <type_traits>
+
 #include "storm/automata/DeterministicAutomaton.h"
 #include "storm/automata/LTL2DeterministicAutomaton.h"
 
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
 #include "storm/logic/ExtractMaximalStateFormulasVisitor.h"
+#include "storm/logic/ProbabilityOperatorFormula.h"
 
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/solver/SolveGoal.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/SchedulerChoice.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
+#include "storm/utility/parallel.h"
+
 #include "storm/exceptions/InvalidPropertyException.h"
 
 namespace storm {
@@ -80,27 +88,52 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
     }
 
     std::vector<std::vector<automata::AcceptanceCondition::acceptance_expr::ptr>> dnf = acceptance.extractFromDNF();
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+
+    // Every accepting EC is contained in an MEC of the product. If there are several disjuncts, the product is therefore decomposed only once. For each
+    // disjunct, the MECs of the product without Fin-states are MECs of the allowed fragment, too. Only the remaining MECs are refined by decomposing their
+    // allowed states, which avoids decomposing the allowed fragment of the whole product for every disjunct.
+    bool const reuseProductMecs = dnf.size() > 1;
+    storm::storage::MaximalEndComponentDecomposition<ValueType> productMecs;
+    storm::storage::BitVector productMecStates(numberOfStates, !reuseProductMecs);
+    std::vector<uint64_t> productMecIndices;
+    if (reuseProductMecs) {
+        productMecs = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions);
+        productMecIndices.resize(numberOfStates);
+        for (uint64_t mecIndex = 0; mecIndex < productMecs.size(); ++mecIndex) {
+            for (auto const& stateChoicePair : productMecs[mecIndex]) {
+                productMecStates.set(stateChoicePair.first);
+                productMecIndices[stateChoicePair.first] = mecIndex;
+            }
+        }
+    }
 
-    storm::storage::BitVector acceptingStates(transitionMatrix.getRowGroupCount(), false);
+    struct DisjunctResult {
+        // The MECs of the allowed fragment that are obtained by refining the MECs of the product.
+        storm::storage::MaximalEndComponentDecomposition<ValueType> refinedMecs;
+        // The accepting MECs of the allowed fragment (either MECs of the product or refined MECs).
+        std::vector<storm::storage::MaximalEndComponent const*> acceptingMecs;
+        std::size_t consideredMecs = 0;
+    };
+    std::vector<DisjunctResult> disjunctResults(dnf.size());
 
-    std::size_t accMECs = 0;
-    std::size_t allMECs = 0;
+    auto processDisjunct = [&](uint64_t disjunctIndex) {
+        auto const& conjunction = dnf[disjunctIndex];
+        DisjunctResult& result = disjunctResults[disjunctIndex];
 
-    for (auto const& conjunction : dnf) {
         // Determine the set of states of the subMDP that can satisfy the condition, remove all states that would violate Fins in the conjunction.
-        storm::storage::BitVector allowed(transitionMatrix.getRowGroupCount(), true);
-
+        // Also collect the sets of states that have to be visited infinitely often.
+        storm::storage::BitVector allowed = productMecStates;
+        std::vector<storm::storage::BitVector> infSets;
         for (auto const& literal : conjunction) {
             if (literal->isTRUE()) {
                 // skip
             } else if (literal->isFALSE()) {
-                allowed.clear();
-                break;
+                return;
             } else if (literal->isAtom()) {
                 const cpphoafparser::AtomAcceptance& atom = literal->getAtom();
+                const storm::storage::BitVector& accSet = acceptance.getAcceptanceSet(atom.getAcceptanceSet());
                 if (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_FIN) {
-                    // only deal with FIN, ignore INF here
-                    const storm::storage::BitVector& accSet = acceptance.getAcceptanceSet(atom.getAcceptanceSet());
                     if (atom.isNegated()) {
                         // allowed = allowed \ ~accSet = allowed & accSet
                         allowed &= accSet;
@@ -108,62 +141,88 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
                         // allowed = allowed \ accSet = allowed & ~accSet
                         allowed &= ~accSet;
                     }
+                } else if (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_INF) {
+                    infSets.push_back(atom.isNegated() ? ~accSet : accSet);
                 }
             }
         }
 
-        if (allowed.empty()) {
-            // skip
-            continue;
-        }
+        auto isAccepting = [&infSets, &allowed](storm::storage::MaximalEndComponent const& mec) {
+            STORM_LOG_ASSERT(!mec.containsAnyState(~allowed), "MEC contains Fin-states, which should have been removed");
+            return std::all_of(infSets.begin(), infSets.end(), [&mec](storm::storage::BitVector const& infSet) { return mec.containsAnyState(infSet); });
+        };
 
-        // Compute MECs in the allowed fragment
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(transitionMatrix, backwardTransitions, allowed);
-        allMECs += mecs.size();
-        for (const auto& mec : mecs) {
-            bool accepting = true;
-            for (auto const& literal : conjunction) {
-                if (literal->isTRUE()) {
-                    // skip
-
-                } else if (literal->isFALSE()) {
-                    accepting = false;
-                    break;
-                } else if (literal->isAtom()) {
-                    const cpphoafparser::AtomAcceptance& atom = literal->getAtom();
-                    const storm::storage::BitVector& accSet = acceptance.getAcceptanceSet(atom.getAcceptanceSet());
-                    if (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_INF) {
-                        if (atom.isNegated()) {
-                            if (!mec.containsAnyState(~accSet)) {
-                                accepting = false;
-                                break;
-                            }
-                        } else {
-                            if (!mec.containsAnyState(accSet)) {
-                                accepting = false;
-                                break;
-                            }
+        storm::storage::BitVector refinementStates;
+        if (reuseProductMecs) {
+            storm::storage::BitVector refinedProductMecs(productMecs.size(), false);
+            for (auto state : productMecStates & ~allowed) {
+                refinedProductMecs.set(productMecIndices[state]);
+            }
+            refinementStates.resize(numberOfStates, false);
+            for (uint64_t mecIndex = 0; mecIndex < productMecs.size(); ++mecIndex) {
+                auto const& mec = productMecs[mecIndex];
+                if (refinedProductMecs.get(mecIndex)) {
+                    for (auto const& stateChoicePair : mec) {
+                        if (allowed.get(stateChoicePair.first)) {
+                            refinementStates.set(stateChoicePair.first);
                         }
-
-                    } else if (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_FIN) {
-                        // Do only sanity checks here.
-                        STORM_LOG_ASSERT(atom.isNegated() ? !mec.containsAnyState(~accSet) : !mec.containsAnyState(accSet),
-                                         "MEC contains Fin-states, which should have been removed");
+                    }
+                } else {
+                    ++result.consideredMecs;
+                    if (isAccepting(mec)) {
+                        result.acceptingMecs.push_back(&mec);
                     }
                 }
             }
+        } else {
+            refinementStates = allowed;
+        }
 
-            if (accepting) {
-                accMECs++;
+        // The refined MECs can only be accepting if the refined states intersect all Inf-sets
+        if (refinementStates.empty() || std::any_of(infSets.begin(), infSets.end(), [&refinementStates](storm::storage::BitVector const& infSet) {
+                return refinementStates.isDisjointFrom(infSet);
+            })) {
+            return;
+        }
 
-                for (auto const& stateChoicePair : mec) {
-                    acceptingStates.set(stateChoicePair.first);
-                }
+        // Compute MECs in the allowed fragment
+        result.refinedMecs = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, refinementStates);
+        result.consideredMecs += result.refinedMecs.size();
+        for (auto const& mec : result.refinedMecs) {
+            if (isAccepting(mec)) {
+                result.acceptingMecs.push_back(&mec);
+            }
+        }
+    };
 
-                if (this->isProduceSchedulerSet()) {
-                    // save choices for states that weren't assigned to any other MEC yet.
-                    this->_schedulerHelper.get().saveProductEcChoices(acceptance, mec, conjunction, product);
-                }
+    // The disjuncts are independent and can be processed concurrently. The arithmetic on rational functions is not thread-safe.
+    uint64_t numberOfThreads = 1;
+    if (!std::is_same_v<ValueType, storm::RationalFunction> && storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+        numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads();
+    }
+    storm::utility::parallel::forEachBlock(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(dnf.size()), 1,
+                                           [&processDisjunct](uint64_t, uint64_t begin, uint64_t end) {
+                                               for (uint64_t disjunctIndex = begin; disjunctIndex < end; ++disjunctIndex) {
+                                                   processDisjunct(disjunctIndex);
+                                               }
+                                           });
+
+    // Collect the accepting states in the order of the disjuncts such that the resulting scheduler does not depend on the number of threads
+    storm::storage::BitVector acceptingStates(numberOfStates, false);
+    std::size_t accMECs = 0;
+    std::size_t allMECs = 0;
+    for (uint64_t disjunctIndex = 0; disjunctIndex < dnf.size(); ++disjunctIndex) {
+        DisjunctResult const& result = disjunctResults[disjunctIndex];
+        allMECs += result.consideredMecs;
+        accMECs += result.acceptingMecs.size();
+        for (auto const* mec : result.acceptingMecs) {
+            for (auto const& stateChoicePair : *mec) {
+                acceptingStates.set(stateChoicePair.first);
+            }
+
+            if (this->isProduceSchedulerSet()) {
+                // save choices for states that weren't assigned to any other MEC yet.
+                this->_schedulerHelper.get().saveProductEcChoices(acceptance, *mec, dnf[disjunctIndex], product);
             }
         }
     }
@@ -316,15 +375,11 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeLTLP
     STORM_LOG_INFO(" in prefix format: " << ltlFormula->toPrefixString());
 
     // Convert LTL formula to a deterministic automaton
-    std::shared_ptr<storm::automata::DeterministicAutomaton> da;
-    if (env.modelchecker().isLtl2daToolSet()) {
-        // Use the external tool given via ltl2da
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daExternalTool(*ltlFormula, env.modelchecker().getLtl2daTool());
-    } else {
-        // Use the internal tool (Spot)
-        // For nondeterministic models the acceptance condition is transformed into DNF
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daSpot(*ltlFormula, Nondeterministic);
-    }
+    // Use the external tool given via ltl2da or the internal tool (Spot) otherwise
+    // For nondeterministic models the acceptance condition is transformed into DNF
+    std::shared_ptr<storm::automata::DeterministicAutomaton> da = storm::automata::LTL2DeterministicAutomaton::ltl2da(
+        *ltlFormula, env.modelchecker().isLtl2daToolSet() ? env.modelchecker().getLtl2daTool() : "", Nondeterministic,
+        env.modelchecker().isLtl2daCacheDirectorySet() ? env.modelchecker().getLtl2daCacheDirectory() : "");
 
     STORM_LOG_INFO("Deterministic automaton for LTL formula has " << da->getNumberOfStates() << " states, " << da->getAPSet().size()
                                                                   << " atomic propositions and " << *da->getAcceptance()->getAcceptanceExpression()
@@ -342,6 +397,48 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeLTLP
     return numericResult;
 }
 
+template<typename ValueType, bool Nondeterministic>
+void SparseLTLHelper<ValueType, Nondeterministic>::translateLTLFormulas(Environment const& env,
+                                                                        std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    std::vector<std::shared_ptr<storm::logic::Formula const>> ltlFormulas;
+    for (auto const& formula : formulas) {
+        if (!formula->isProbabilityOperatorFormula()) {
+            continue;
+        }
+        auto const& operatorFormula = formula->asProbabilityOperatorFormula();
+        auto const& subformula = operatorFormula.getSubformula();
+        if (subformula.isStateFormula() || subformula.hasQualitativeResult() || subformula.isHOAPathFormula() ||
+            subformula.isConditionalProbabilityFormula() || !subformula.info(false).containsComplexPathFormula()) {
+            continue;
+        }
+
+        // Same preprocessing as in computeLTLProbabilities
+        storm::logic::ExtractMaximalStateFormulasVisitor::ApToFormulaMap extracted;
+        std::shared_ptr<storm::logic::Formula const> ltlFormula =
+            storm::logic::ExtractMaximalStateFormulasVisitor::extract(subformula.asPathFormula(), extracted);
+        if (Nondeterministic) {
+            bool minimize;
+            if (operatorFormula.hasOptimalityType()) {
+                minimize = storm::solver::minimize(operatorFormula.getOptimalityType());
+            } else if (operatorFormula.hasBound()) {
+                minimize = storm::logic::isLowerBound(operatorFormula.getComparisonType());
+            } else {
+                continue;
+            }
+            if (minimize) {
+                ltlFormula = std::make_shared<storm::logic::UnaryBooleanPathFormula>(storm::logic::UnaryBooleanOperatorType::Not, ltlFormula);
+            }
+        }
+        ltlFormulas.push_back(ltlFormula);
+    }
+
+    if (!ltlFormulas.empty()) {
+        storm::automata::LTL2DeterministicAutomaton::ltl2daBatch(
+            ltlFormulas, env.modelchecker().isLtl2daToolSet() ? env.modelchecker().getLtl2daTool() : "", Nondeterministic,
+            env.modelchecker().isLtl2daCacheDirectorySet() ? env.modelchecker().getLtl2daCacheDirectory() : "", env.modelchecker().getNumberOfLtl2daThreads());
+    }
+}
+
 template class SparseLTLHelper<double, false>;
 template class SparseLTLHelper<double, true>;
 
@@ -86,6 +86,14 @@ class SparseLTLHelper : public SingleValueModelCheckerHelper<ValueType, storm::m
     std::vector<ValueType> computeLTLProbabilities(Environment const& env, storm::logic::PathFormula const& formula,
                                                    std::map<std::string, storm::storage::BitVector>& apSatSets);
 
+    /*!
+     * Translates the LTL path formulas of the given properties to deterministic automata up front (see LTL2DeterministicAutomaton::ltl2daBatch) such
+     * that the translations in subsequent calls of computeLTLProbabilities are answered from the cache.
+     * Only path formulas directly below the top-level probability operators are considered.
+     * @param formulas the properties
+     */
+    static void translateLTLFormulas(Environment const& env, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas);
+
    private:
     /*!
      * Computes a set S of states that admit a probability 1 strategy of satisfying the given acceptance condition (in DNF).
@@ -0,0 +1,235 @@
+#include "storm/modelchecker/hints/SolutionHintCache.h"
+
+#include <unistd.h>
+#include <atomic>
+#include <boost/functional/hash.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/logic/ProbabilityOperatorFormula.h"
+#include "storm/logic/RewardOperatorFormula.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/Scheduler.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+
+namespace {
+// Identifies hint cache files and their format.
+char const Magic[8] = {'S', 'T', 'O', 'R', 'M', 'H', 'N', 'T'};
+uint32_t const Version = 1;
+
+template<typename T>
+void writeRaw(std::ostream& os, T const& value) {
+    os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool readRaw(std::istream& is, T& value) {
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+template<typename T>
+void writeVector(std::ostream& os, std::vector<T> const& values) {
+    writeRaw(os, static_cast<uint64_t>(values.size()));
+    os.write(reinterpret_cast<char const*>(values.data()), values.size() * sizeof(T));
+}
+
+template<typename T>
+bool readVector(std::istream& is, std::vector<T>& values) {
+    uint64_t size;
+    if (!readRaw(is, size)) {
+        return false;
+    }
+    values.resize(size);
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(values.data()), size * sizeof(T)));
+}
+
+std::string getUniqueSuffix() {
+    static std::atomic<uint64_t> counter(0);
+    return "." + std::to_string(getpid()) + "." + std::to_string(counter++);
+}
+}  // namespace
+
+SolutionHintCache::SolutionHintCache(std::string const& directory) : directory(directory) {
+    // Intentionally left empty.
+}
+
+bool SolutionHintCache::isApplicable(Environment const& env, ModelType const& model, CheckTask<storm::logic::Formula, double> const& task) {
+    if (model.getType() != storm::models::ModelType::Dtmc && model.getType() != storm::models::ModelType::Mdp) {
+        return false;
+    }
+    if (task.isQualitativeSet() || !task.getHint().isEmpty() || env.solver().isForceSoundness() || env.solver().isForceExact()) {
+        return false;
+    }
+    if (model.isNondeterministicModel() && !task.isOptimizationDirectionSet()) {
+        return false;
+    }
+    storm::logic::Formula const& formula = task.getFormula();
+    if (formula.isProbabilityOperatorFormula()) {
+        auto const& subformula = formula.asProbabilityOperatorFormula().getSubformula();
+        return subformula.isUntilFormula() || subformula.isReachabilityProbabilityFormula();
+    } else if (formula.isRewardOperatorFormula()) {
+        auto const& subformula = formula.asRewardOperatorFormula().getSubformula();
+        return subformula.isReachabilityRewardFormula() || subformula.isTotalRewardFormula();
+    }
+    return false;
+}
+
+std::shared_ptr<ExplicitModelCheckerHint<double>> SolutionHintCache::load(ModelType const& model, CheckTask<storm::logic::Formula, double> const& task) const {
+    std::string const key = getKey(model, task);
+    uint64_t const hash = getHash(model, key);
+    std::string const filename = getFilename(hash);
+    std::ifstream stream(filename, std::ios::in | std::ios::binary);
+    if (!stream) {
+        return nullptr;
+    }
+
+    char magic[sizeof(Magic)];
+    uint32_t version;
+    std::vector<char> storedKey;
+    uint64_t storedHash, numberOfStates, numberOfChoices;
+    if (!stream.read(magic, sizeof(magic)) || std::memcmp(magic, Magic, sizeof(Magic)) != 0 || !readRaw(stream, version) || version != Version) {
+        STORM_LOG_WARN("Ignoring the hint cache file '" << filename << "' as it has an unknown format.");
+        return nullptr;
+    }
+    // Different entries may have the same hash, so the key and the dimensions of the model are compared as well.
+    auto const& transitionMatrix = model.getTransitionMatrix();
+    if (!readVector(stream, storedKey) || std::string(storedKey.begin(), storedKey.end()) != key || !readRaw(stream, storedHash) || storedHash != hash ||
+        !readRaw(stream, numberOfStates) || numberOfStates != transitionMatrix.getRowGroupCount() || !readRaw(stream, numberOfChoices) ||
+        numberOfChoices != transitionMatrix.getRowCount()) {
+        STORM_LOG_INFO("The hint cache file '" << filename << "' belongs to a different model or property.");
+        return nullptr;
+    }
+    std::vector<double> values;
+    std::vector<uint64_t> choices;
+    if (!readVector(stream, values) || values.size() != numberOfStates || !readVector(stream, choices) ||
+        (!choices.empty() && choices.size() != numberOfStates)) {
+        STORM_LOG_WARN("Ignoring the corrupted hint cache file '" << filename << "'.");
+        return nullptr;
+    }
+
+    auto hint = std::make_shared<ExplicitModelCheckerHint<double>>();
+    hint->setResultHint(std::move(values));
+    if (!choices.empty()) {
+        storm::storage::Scheduler<double> scheduler(numberOfStates);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (choices[state] >= transitionMatrix.getRowGroupSize(state)) {
+                STORM_LOG_WARN("Ignoring the corrupted hint cache file '" << filename << "'.");
+                return nullptr;
+            }
+            scheduler.setChoice(choices[state], state);
+        }
+        hint->setSchedulerHint(std::move(scheduler));
+    }
+    STORM_LOG_INFO("Loaded a hint for " << key << " from the hint cache file '" << filename << "'.");
+    return hint;
+}
+
+void SolutionHintCache::store(ModelType const& model, CheckTask<storm::logic::Formula, double> const& task, CheckResult const& result) const {
+    if (!result.isExplicitQuantitativeCheckResult() || !result.isResultForAllStates()) {
+        return;
+    }
+    auto const& quantitativeResult = result.asExplicitQuantitativeCheckResult<double>();
+    auto const& transitionMatrix = model.getTransitionMatrix();
+    auto const& values = quantitativeResult.getValueVector();
+    STORM_LOG_ASSERT(values.size() == transitionMatrix.getRowGroupCount(), "Unexpected size of result vector.");
+
+    // Only memoryless deterministic schedulers can serve as scheduler hints. States without a choice (e.g. the target states) take their first choice.
+    std::vector<uint64_t> choices;
+    if (model.isNondeterministicModel() && quantitativeResult.hasScheduler()) {
+        auto const& scheduler = quantitativeResult.getScheduler();
+        if (scheduler.isMemorylessScheduler() && scheduler.isDeterministicScheduler()) {
+            choices.reserve(values.size());
+            for (uint64_t state = 0; state < values.size(); ++state) {
+                auto choice = scheduler.getChoice(state);
+                choices.push_back(choice.isDefined() ? choice.getDeterministicChoice() : 0);
+            }
+        }
+    }
+
+    std::string const key = getKey(model, task);
+    uint64_t const hash = getHash(model, key);
+    std::string const filename = getFilename(hash);
+    // Write to a temporary file first such that concurrent readers never see a partially written file.
+    std::string const temporaryFilename = filename + getUniqueSuffix();
+    {
+        std::ofstream stream(temporaryFilename, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (stream) {
+            stream.write(Magic, sizeof(Magic));
+            writeRaw(stream, Version);
+            writeVector(stream, std::vector<char>(key.begin(), key.end()));
+            writeRaw(stream, hash);
+            writeRaw(stream, static_cast<uint64_t>(transitionMatrix.getRowGroupCount()));
+            writeRaw(stream, static_cast<uint64_t>(transitionMatrix.getRowCount()));
+            writeVector(stream, values);
+            writeVector(stream, choices);
+            stream.flush();
+        }
+        if (!stream) {
+            std::remove(temporaryFilename.c_str());
+            STORM_LOG_WARN("Could not store the result in the hint cache directory " << directory << ".");
+            return;
+        }
+    }
+    if (std::rename(temporaryFilename.c_str(), filename.c_str()) != 0) {
+        std::remove(temporaryFilename.c_str());
+        STORM_LOG_WARN("Could not store the result in the hint cache directory " << directory << ".");
+        return;
+    }
+    STORM_LOG_INFO("Stored the result for " << key << " in the hint cache file '" << filename << "'.");
+}
+
+std::string SolutionHintCache::getKey(ModelType const& model, CheckTask<storm::logic::Formula, double> const& task) {
+    std::stringstream stream;
+    stream << model.getType() << " ";
+    storm::logic::Formula const& formula = task.getFormula();
+    if (formula.isProbabilityOperatorFormula()) {
+        stream << "P";
+    } else {
+        stream << "R{\"" << (task.isRewardModelSet() ? task.getRewardModel() : "") << "\"}";
+    }
+    // Bounds do not affect the computed values, but the optimization direction does.
+    if (task.isOptimizationDirectionSet()) {
+        stream << (storm::solver::minimize(task.getOptimizationDirection()) ? "min" : "max");
+    }
+    stream << " [" << formula.asUnaryStateFormula().getSubformula() << "]";
+    return stream.str();
+}
+
+uint64_t SolutionHintCache::getHash(ModelType const& model, std::string const& key) {
+    // Only the structure of the matrix is considered, the values of its entries are not.
+    auto const& transitionMatrix = model.getTransitionMatrix();
+    std::size_t hash = std::hash<std::string>()(key);
+    boost::hash_combine(hash, transitionMatrix.getRowGroupCount());
+    boost::hash_combine(hash, transitionMatrix.getRowCount());
+    boost::hash_combine(hash, transitionMatrix.getEntryCount());
+    if (!transitionMatrix.hasTrivialRowGrouping()) {
+        boost::hash_combine(hash, boost::hash_range(transitionMatrix.getRowGroupIndices().begin(), transitionMatrix.getRowGroupIndices().end()));
+    }
+    for (uint64_t row = 0; row < transitionMatrix.getRowCount(); ++row) {
+        boost::hash_combine(hash, transitionMatrix.getRow(row).getNumberOfEntries());
+        for (auto const& entry : transitionMatrix.getRow(row)) {
+            boost::hash_combine(hash, entry.getColumn());
+        }
+    }
+    return hash;
+}
+
+std::string SolutionHintCache::getFilename(uint64_t hash) const {
+    std::stringstream stream;
+    stream << directory << "/" << std::hex << hash << ".hint";
+    return stream.str();
+}
+
+}  // namespace modelchecker
+}  // namespace storm
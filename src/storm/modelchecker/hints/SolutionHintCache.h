@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "storm/logic/Formula.h"
+#include "storm/modelchecker/CheckTask.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+
+namespace storm {
+class Environment;
+
+namespace models::sparse {
+template<typename ValueType, typename RewardModelType>
+class Model;
+template<typename ValueType>
+class StandardRewardModel;
+}  // namespace models::sparse
+
+namespace modelchecker {
+class CheckResult;
+
+/*!
+ * Stores the results (and, for MDPs, the optimal schedulers) of reachability properties in a directory such that later invocations can use them as hints
+ * (see ExplicitModelCheckerHint) to warm-start value and policy iteration. An entry is identified by the property and the structure of the transition
+ * matrix, i.e., the entry is also found if only the probabilities of the model have changed, e.g. because a constant has a slightly different value.
+ * The model checker checks the applicability of the hints, so an outdated entry can only slow down the computation.
+ * Only double precision values are cached.
+ */
+class SolutionHintCache {
+   public:
+    typedef storm::models::sparse::Model<double, storm::models::sparse::StandardRewardModel<double>> ModelType;
+
+    /*!
+     * Creates a cache that stores its entries in the given (existing) directory.
+     */
+    explicit SolutionHintCache(std::string const& directory);
+
+    /*!
+     * Retrieves whether results of the given task on the given model are cached. This is the case for unbounded reachability probabilities and rewards as
+     * well as total rewards on DTMCs and MDPs, unless the task is qualitative, already has a hint or the environment demands sound or exact results (as
+     * starting from a hint is not guaranteed to be sound).
+     */
+    static bool isApplicable(Environment const& env, ModelType const& model, CheckTask<storm::logic::Formula, double> const& task);
+
+    /*!
+     * Loads the hint that was stored for the given task on a model with the same transition structure.
+     *
+     * @return The hint or nullptr if there is no (matching) entry.
+     */
+    std::shared_ptr<ExplicitModelCheckerHint<double>> load(ModelType const& model, CheckTask<storm::logic::Formula, double> const& task) const;
+
+    /*!
+     * Stores the given result of the task as entry for the model. Results that are not quantitative results for all states are ignored.
+     */
+    void store(ModelType const& model, CheckTask<storm::logic::Formula, double> const& task, CheckResult const& result) const;
+
+   private:
+    /*!
+     * Retrieves a description of the task that identifies the values it computes.
+     */
+    static std::string getKey(ModelType const& model, CheckTask<storm::logic::Formula, double> const& task);
+
+    /*!
+     * Retrieves a hash of the given key and the transition structure of the model.
+     */
+    static uint64_t getHash(ModelType const& model, std::string const& key);
+
+    std::string getFilename(uint64_t hash) const;
+
+    std::string directory;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
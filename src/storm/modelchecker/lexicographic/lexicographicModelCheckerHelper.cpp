@@ -204,7 +204,7 @@ bool lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministi
     }
     // get easy access to incoming transitions of a state
     auto incomingChoicesMatrix = model.getTransitionMatrix().transpose();
-    auto incomingStatesMatrix = model.getBackwardTransitions();
+    auto const& incomingStatesMatrix = model.getBackwardTransitions();
     bool changedSomething = true;
     while (changedSomething) {
         // iterate until there is no change
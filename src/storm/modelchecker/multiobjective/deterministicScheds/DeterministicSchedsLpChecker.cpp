@@ -579,7 +579,7 @@ void DeterministicSchedsLpChecker<ModelType, GeometryValueType>::initializeLpMod
     flowEncoding = useFlowEncoding(env, objectiveHelper);
     STORM_LOG_INFO("Using " << (flowEncoding ? "flow" : "classical") << " encoding.\n");
     uint64_t initialState = *model.getInitialStates().begin();
-    auto backwardTransitions = model.getBackwardTransitions();
+    auto const& backwardTransitions = model.getBackwardTransitions();
     auto backwardChoices = model.getTransitionMatrix().transpose();
     STORM_LOG_WARN_COND(!storm::settings::getModule<storm::settings::modules::CoreSettings>().isLpSolverSetFromDefaultValue() ||
                             storm::settings::getModule<storm::settings::modules::CoreSettings>().getLpSolver() == storm::solver::LpSolverType::Gurobi,
@@ -89,7 +89,7 @@ void DeterministicSchedsObjectiveHelper<ModelType>::initialize() {
     if (formula.isProbabilityOperatorFormula() && formula.getSubformula().isUntilFormula()) {
         storm::storage::BitVector phiStates = evaluatePropositionalFormula(model, formula.getSubformula().asUntilFormula().getLeftSubformula());
         storm::storage::BitVector psiStates = evaluatePropositionalFormula(model, formula.getSubformula().asUntilFormula().getRightSubformula());
-        auto backwardTransitions = model.getBackwardTransitions();
+        auto const& backwardTransitions = model.getBackwardTransitions();
         auto prob1States = storm::utility::graph::performProb1A(model.getTransitionMatrix(), model.getNondeterministicChoiceIndices(), backwardTransitions,
                                                                 phiStates, psiStates);
         auto prob0States = storm::utility::graph::performProb0A(backwardTransitions, phiStates, psiStates);
@@ -189,7 +189,7 @@ void DeterministicSchedsObjectiveHelper<ModelType>::initialize() {
             negativeRewardChoices.set(rew.first, true);
         }
     }
-    auto backwardTransitions = model.getBackwardTransitions();
+    auto const& backwardTransitions = model.getBackwardTransitions();
     bool hasNegativeEC =
         storm::utility::graph::checkIfECWithChoiceExists(model.getTransitionMatrix(), backwardTransitions, getMaybeStates(), negativeRewardChoices);
     bool hasPositiveEc =
@@ -491,7 +491,7 @@ ValueType getLowerBoundForNonZeroReachProb(storm::storage::SparseMatrix<ValueTyp
 template<typename ModelType>
 void DeterministicSchedsObjectiveHelper<ModelType>::computeLowerUpperBounds(Environment const& env) const {
     assert(!upperResultBounds.has_value() && !lowerResultBounds.has_value());
-    auto backwardTransitions = model.getBackwardTransitions();
+    auto const& backwardTransitions = model.getBackwardTransitions();
     auto nonMaybeStates = ~maybeStates;
     // Eliminate problematic mecs
     storm::storage::MaximalEndComponentDecomposition<ValueType> problMecs(model.getTransitionMatrix(), backwardTransitions, maybeStates,
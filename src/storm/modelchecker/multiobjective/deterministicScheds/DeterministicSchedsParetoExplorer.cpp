@@ -16,6 +16,7 @@
 #include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/io/export.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/solver.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
@@ -304,7 +305,14 @@ DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::Determini
         objectiveHelper.emplace_back(*model, obj);
         STORM_LOG_ASSERT(!objectiveHelper.back().hasThreshold(), "Unexpected input: got a Pareto query with a thresholded objective.");
     }
-    lpChecker = std::make_shared<DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>>(*model, objectiveHelper);
+    // LP queries for different facets are answered concurrently, where each thread uses its own LP checker.
+    uint64_t numberOfLpCheckers = 1;
+    if (storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+        numberOfLpCheckers = std::max<uint64_t>(1, storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads());
+    }
+    for (uint64_t i = 0; i < numberOfLpCheckers; ++i) {
+        lpCheckers.push_back(std::make_shared<DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>>(*model, objectiveHelper));
+    }
     if (preprocessorResult.containsOnlyTotalRewardFormulas()) {
         wvChecker = storm::modelchecker::multiobjective::WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
     } else {
@@ -355,10 +363,14 @@ std::unique_ptr<CheckResult> DeterministicSchedsParetoExplorer<SparseModelType,
         ei += ei;
         eps = std::vector<GeometryValueType>(objectives.size(), ei);
     }
+    std::vector<Facet> facets;
     while (!unprocessedFacets.empty()) {
-        Facet f = std::move(unprocessedFacets.front());
-        unprocessedFacets.pop();
-        processFacet(env, f);
+        facets.clear();
+        while (!unprocessedFacets.empty() && facets.size() < lpCheckers.size()) {
+            facets.push_back(std::move(unprocessedFacets.front()));
+            unprocessedFacets.pop();
+        }
+        processFacets(env, facets);
     }
 
     std::vector<std::vector<ModelValueType>> paretoPoints;
@@ -475,8 +487,8 @@ void DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::init
             negateMinObjectives(upperBoundPoint);
             offset = storm::utility::vector::dotProduct(weightVector, upperBoundPoint);
         } else {
-            lpChecker->setCurrentWeightVector(env, weightVector);
-            auto optionalPoint = lpChecker->check(env, overApproximation);
+            lpCheckers.front()->setCurrentWeightVector(env, weightVector);
+            auto optionalPoint = lpCheckers.front()->check(env, overApproximation);
             STORM_LOG_THROW(optionalPoint.has_value(), storm::exceptions::UnexpectedException, "Unable to find a point in the current overapproximation.");
             pointCoord = std::move(optionalPoint->first);
             offset = std::move(optionalPoint->second);
@@ -516,27 +528,49 @@ std::vector<GeometryValueType> DeterministicSchedsParetoExplorer<SparseModelType
 }
 
 template<class SparseModelType, typename GeometryValueType>
-void DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::processFacet(Environment const& env, Facet& f) {
-    if (!wvChecker) {
-        lpChecker->setCurrentWeightVector(env, f.getHalfspace().normalVector());
-    }
-
-    if (optimizeAndSplitFacet(env, f)) {
-        return;
-    }
-
-    storm::storage::geometry::PolytopeTree<GeometryValueType> polytopeTree(f.getInducedPolytope(pointset, getReferenceCoordinates(env)));
-    for (auto const& point : pointset) {
-        polytopeTree.substractDownwardClosure(point.second.get(), eps);
-        if (polytopeTree.isEmpty()) {
-            break;
+void DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::processFacets(Environment const& env, std::vector<Facet>& facets) {
+    // Optimize in the directions of all facets. The weight vector checker can not be used concurrently.
+    std::vector<std::pair<std::vector<GeometryValueType>, GeometryValueType>> optimizationResults(facets.size());
+    uint64_t const numberOfOptimizationThreads = wvChecker ? 1 : std::min<uint64_t>(lpCheckers.size(), facets.size());
+    storm::utility::parallel::forEachBlock(numberOfOptimizationThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(facets.size()), 1,
+                                           [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+                                               for (uint64_t facetIndex = begin; facetIndex < end; ++facetIndex) {
+                                                   optimizationResults[facetIndex] = optimizeFacet(env, *lpCheckers[threadIndex], facets[facetIndex]);
+                                               }
+                                           });
+
+    // Incorporate the found points. For facets that can not be split any further, the remaining area below the facet has to be checked.
+    std::vector<uint64_t> facetsToCheck;
+    std::vector<storm::storage::geometry::PolytopeTree<GeometryValueType>> polytopeTrees;
+    for (uint64_t facetIndex = 0; facetIndex < facets.size(); ++facetIndex) {
+        Facet& f = facets[facetIndex];
+        if (splitFacet(env, f, std::move(optimizationResults[facetIndex].first), optimizationResults[facetIndex].second)) {
+            continue;
         }
-    }
-    if (!polytopeTree.isEmpty()) {
-        if (wvChecker) {
-            lpChecker->setCurrentWeightVector(env, f.getHalfspace().normalVector());
+        storm::storage::geometry::PolytopeTree<GeometryValueType> polytopeTree(f.getInducedPolytope(pointset, getReferenceCoordinates(env)));
+        for (auto const& point : pointset) {
+            polytopeTree.substractDownwardClosure(point.second.get(), eps);
+            if (polytopeTree.isEmpty()) {
+                break;
+            }
+        }
+        if (!polytopeTree.isEmpty()) {
+            facetsToCheck.push_back(facetIndex);
+            polytopeTrees.push_back(std::move(polytopeTree));
         }
-        auto res = lpChecker->check(env, polytopeTree, eps);
+    }
+
+    // Check the remaining areas. The results are incorporated in the order of the facets so that they do not depend on the thread scheduling.
+    std::vector<std::pair<std::vector<std::vector<GeometryValueType>>, std::vector<Polytope>>> checkResults(facetsToCheck.size());
+    storm::utility::parallel::forEachBlock(std::min<uint64_t>(lpCheckers.size(), facetsToCheck.size()), static_cast<uint64_t>(0),
+                                           static_cast<uint64_t>(facetsToCheck.size()), 1, [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+                                               auto& checker = *lpCheckers[threadIndex];
+                                               for (uint64_t i = begin; i < end; ++i) {
+                                                   checker.setCurrentWeightVector(env, facets[facetsToCheck[i]].getHalfspace().normalVector());
+                                                   checkResults[i] = checker.check(env, polytopeTrees[i], eps);
+                                               }
+                                           });
+    for (auto& res : checkResults) {
         for (auto const& infeasableArea : res.second) {
             addUnachievableArea(env, infeasableArea);
         }
@@ -557,9 +591,8 @@ bool closePoints(std::vector<GeometryValueType> const& first, std::vector<Geomet
 }
 
 template<class SparseModelType, typename GeometryValueType>
-bool DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::optimizeAndSplitFacet(Environment const& env, Facet& f) {
-    // Invoke optimization and insert the explored points
-    boost::optional<PointId> optPointId;
+std::pair<std::vector<GeometryValueType>, GeometryValueType> DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::optimizeFacet(
+    Environment const& env, DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>& checker, Facet const& f) {
     std::vector<GeometryValueType> pointCoord;
     GeometryValueType offset;
     if (wvChecker) {
@@ -570,18 +603,26 @@ bool DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::opti
         negateMinObjectives(upperBoundPoint);
         offset = storm::utility::vector::dotProduct(f.getHalfspace().normalVector(), upperBoundPoint);
     } else {
-        auto currentArea = overApproximation->intersection(f.getHalfspace().invert());
-        auto optionalPoint = lpChecker->check(env, overApproximation, eps);
+        checker.setCurrentWeightVector(env, f.getHalfspace().normalVector());
+        auto optionalPoint = checker.check(env, overApproximation, eps);
         if (optionalPoint.has_value()) {
             pointCoord = std::move(optionalPoint->first);
+            offset = std::move(optionalPoint->second);
         } else {
             // As we did not find any feasable solution in the given area, we take a point that lies on the facet
             pointCoord = pointset.getPoint(f.getPoints().front()).get();
+            offset = f.getHalfspace().offset();
         }
-        offset = std::move(optionalPoint->second);
     }
+    return {std::move(pointCoord), std::move(offset)};
+}
 
-    Point p(pointCoord);
+template<class SparseModelType, typename GeometryValueType>
+bool DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::splitFacet(Environment const& env, Facet& f,
+                                                                                       std::vector<GeometryValueType>&& pointCoord,
+                                                                                       GeometryValueType const& offset) {
+    boost::optional<PointId> optPointId;
+    Point p(std::move(pointCoord));
     p.setOnFacet();
     addHalfspaceToOverApproximation(env, f.getHalfspace().normalVector(), offset);
     optPointId = pointset.addPoint(env, std::move(p));
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <queue>
+#include <vector>
 
 #include "storm/modelchecker/multiobjective/deterministicScheds/DeterministicSchedsLpChecker.h"
 #include "storm/modelchecker/multiobjective/deterministicScheds/DeterministicSchedsObjectiveHelper.h"
@@ -153,17 +154,27 @@ class DeterministicSchedsParetoExplorer {
     std::vector<GeometryValueType> getReferenceCoordinates(Environment const& env) const;
 
     /*!
-     * Processes the given facet
+     * Processes the given facets. The (expensive) LP queries for different facets are independent of each other and are therefore dispatched to the
+     * available LP checkers concurrently, whereas the found points and facets are incorporated sequentially in the order of the given facets.
      */
-    void processFacet(Environment const& env, Facet& f);
+    void processFacets(Environment const& env, std::vector<Facet>& facets);
 
     /*!
-     * Optimizes in the facet direction. If this results in a point that does not lie on the facet,
+     * Optimizes in the facet direction using the given LP checker (unless the weight vector checker is used).
+     * @return the coordinates of an achievable point as well as the offset of a halfspace with the normal vector of the facet that contains all
+     * achievable points.
+     */
+    std::pair<std::vector<GeometryValueType>, GeometryValueType> optimizeFacet(Environment const& env,
+                                                                               DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>& checker,
+                                                                               Facet const& f);
+
+    /*!
+     * Incorporates the result of optimizing in the facet direction. If the given point does not lie on the facet,
      * 1. The new Pareto optimal point is added
      * 2. New facets are generated and (if not already precise enough) added to unprocessedFacets
      * 3. true is returned
      */
-    bool optimizeAndSplitFacet(Environment const& env, Facet& f);
+    bool splitFacet(Environment const& env, Facet& f, std::vector<GeometryValueType>&& pointCoord, GeometryValueType const& offset);
 
     Polytope negateMinObjectives(Polytope const& polytope) const;
     void negateMinObjectives(std::vector<GeometryValueType>& vector) const;
@@ -173,7 +184,8 @@ class DeterministicSchedsParetoExplorer {
     Polytope overApproximation;
     std::vector<Polytope> unachievableAreas;
     std::vector<GeometryValueType> eps;
-    std::shared_ptr<DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>> lpChecker;
+    // One LP checker (each with its own LP solver instance) per thread that processes facets.
+    std::vector<std::shared_ptr<DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>>> lpCheckers;
     std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> wvChecker;
     std::vector<DeterministicSchedsObjectiveHelper<SparseModelType>> objectiveHelper;
 
@@ -1,5 +1,6 @@
 #include "storm/modelchecker/multiobjective/pcaa/RewardBoundedMdpPcaaWeightVectorChecker.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/exceptions/IllegalArgumentException.h"
@@ -75,6 +76,7 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::check(Environm
     // In case we want to export the cdf, we will collect the corresponding data
     std::vector<std::vector<ValueType>> cdfData;
 
+    rewardUnfolding.setMemoryLimitForEpochSolutions(env.modelchecker().getEpochSolutionMemoryLimit());
     auto initEpoch = rewardUnfolding.getStartEpoch();
     auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
     EpochCheckingData cachedData;
@@ -1,5 +1,8 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaParetoQuery.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/modelchecker/multiobjective/MultiObjectivePostprocessing.h"
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
@@ -62,38 +65,49 @@ void SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::exploreSetOfAchi
     STORM_LOG_THROW(env.modelchecker().multi().getPrecisionType() == MultiObjectiveModelCheckerEnvironment::PrecisionType::Absolute,
                     storm::exceptions::IllegalArgumentException, "Unhandled multiobjective precision type.");
 
+    uint64_t maxSteps = env.modelchecker().multi().isMaxStepsSet() ? env.modelchecker().multi().getMaxSteps() : std::numeric_limits<uint64_t>::max();
+
     // First consider the objectives individually
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env); ++objIndex) {
+    std::vector<WeightVector> diracDirections;
+    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && this->refinementSteps.size() + diracDirections.size() < maxSteps; ++objIndex) {
         WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
         direction[objIndex] = storm::utility::one<GeometryValueType>();
-        this->performRefinementStep(env, std::move(direction));
-        if (storm::utility::resources::isTerminate()) {
-            break;
-        }
+        diracDirections.push_back(std::move(direction));
     }
+    this->performRefinementSteps(env, std::move(diracDirections));
 
+    GeometryValueType precision = storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision());
     while (!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-        // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+        // Get the halfspaces of the underApproximation with maximal distance to a vertex of the overApproximation.
+        // If weight vectors are checked concurrently, we consider as many halfspaces as there are threads.
         std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
         std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-        uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-        GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+        std::vector<std::pair<GeometryValueType, uint_fast64_t>> halfspaceDistances;
         for (uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
+            GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
             for (auto const& vertex : overApproxVertices) {
-                GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
-                if (distance > farestDistance) {
-                    farestHalfspaceIndex = halfspaceIndex;
-                    farestDistance = distance;
-                }
+                farestDistance = std::max(farestDistance, underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex));
+            }
+            if (farestDistance > storm::utility::zero<GeometryValueType>()) {
+                halfspaceDistances.emplace_back(farestDistance, halfspaceIndex);
             }
         }
-        if (farestDistance < storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision())) {
+        uint64_t numberOfDirections = std::min<uint64_t>(
+            {env.modelchecker().multi().getNumberOfThreads(), halfspaceDistances.size(), maxSteps - this->refinementSteps.size()});
+        // Among halfspaces with the same distance, the one with the smallest index is preferred
+        std::partial_sort(halfspaceDistances.begin(), halfspaceDistances.begin() + numberOfDirections, halfspaceDistances.end(),
+                          [](auto const& lhs, auto const& rhs) { return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second); });
+        if (numberOfDirections == 0 || halfspaceDistances.front().first < precision) {
             // Goal precision reached!
             return;
         }
-        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-        WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-        this->performRefinementStep(env, std::move(direction));
+        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~"
+                       << storm::utility::convertNumber<double>(halfspaceDistances.front().first));
+        std::vector<WeightVector> directions;
+        for (uint64_t i = 0; i < numberOfDirections && halfspaceDistances[i].first >= precision; ++i) {
+            directions.push_back(underApproxHalfspaces[halfspaceDistances[i].second].normalVector());
+        }
+        this->performRefinementSteps(env, std::move(directions));
     }
     STORM_LOG_ERROR("Could not reach the desired precision: Termination requested or maximum number of refinement steps exceeded.");
 }
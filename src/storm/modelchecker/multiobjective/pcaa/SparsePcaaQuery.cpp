@@ -11,7 +11,9 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/geometry/Hyperrectangle.h"
+#include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/UnexpectedException.h"
@@ -29,7 +31,10 @@ SparsePcaaQuery<SparseModelType, GeometryValueType>::~SparsePcaaQuery() {
 
 template<class SparseModelType, typename GeometryValueType>
 SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType>& preprocessorResult)
-    : originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives) {
+    : originalModel(preprocessorResult.originalModel),
+      originalFormula(preprocessorResult.originalFormula),
+      objectives(preprocessorResult.objectives),
+      preprocessorResult(preprocessorResult) {
     this->weightVectorChecker = WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
 
     this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
@@ -89,16 +94,63 @@ typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector Spars
 
 template<class SparseModelType, typename GeometryValueType>
 void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
+    refinementSteps.push_back(checkWeightVector(env, *weightVectorChecker, std::move(direction)));
+
+    updateOverApproximation();
+    updateUnderApproximation();
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+    uint64_t numberOfThreads = std::min<uint64_t>(env.modelchecker().multi().getNumberOfThreads(), directions.size());
+    if (numberOfThreads <= 1) {
+        for (auto& direction : directions) {
+            performRefinementStep(env, std::move(direction));
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
+        }
+        return;
+    }
+
+    // The checkers are created on the calling thread and reused for later batches
+    while (additionalWeightVectorCheckers.size() + 1 < numberOfThreads) {
+        additionalWeightVectorCheckers.push_back(WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult));
+    }
+    for (auto& checker : additionalWeightVectorCheckers) {
+        checker->setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
+    }
+
+    std::vector<RefinementStep> steps(directions.size());
+    storm::utility::parallel::forEachBlock(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(directions.size()), 1,
+                                           [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+                                               auto& checker = threadIndex == 0 ? *weightVectorChecker : *additionalWeightVectorCheckers[threadIndex - 1];
+                                               for (uint64_t index = begin; index < end; ++index) {
+                                                   steps[index] = checkWeightVector(env, checker, std::move(directions[index]));
+                                               }
+                                           });
+
+    // Each overapproximation update only considers the newest step
+    for (auto& step : steps) {
+        refinementSteps.push_back(std::move(step));
+        updateOverApproximation();
+    }
+    updateUnderApproximation();
+}
+
+template<class SparseModelType, typename GeometryValueType>
+typename SparsePcaaQuery<SparseModelType, GeometryValueType>::RefinementStep SparsePcaaQuery<SparseModelType, GeometryValueType>::checkWeightVector(
+    Environment const& env, PcaaWeightVectorChecker<SparseModelType>& checker, WeightVector&& direction) const {
     // Normalize the direction vector so that the entries sum up to one
     storm::utility::vector::scaleVectorInPlace(
         direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-    weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+    checker.check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
     STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(
-                        storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
+                        storm::utility::vector::convertNumericVector<double>(checker.getUnderApproximationOfInitialStateResults())));
     RefinementStep step;
-    step.weightVector = direction;
-    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
+    step.weightVector = std::move(direction);
+    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
+    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
     // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
     for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
         if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
@@ -106,10 +158,7 @@ void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(
             step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
         }
     }
-    refinementSteps.push_back(std::move(step));
-
-    updateOverApproximation();
-    updateUnderApproximation();
+    return step;
 }
 
 template<class SparseModelType, typename GeometryValueType>
@@ -68,6 +68,17 @@ class SparsePcaaQuery {
      */
     void performRefinementStep(Environment const& env, WeightVector&& direction);
 
+    /*
+     * Refines the current result w.r.t. all of the given direction vectors.
+     * The weight vectors are checked concurrently (as specified in the environment), where each thread uses its own weight vector checker.
+     */
+    void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+
+    /*
+     * Checks the given direction vector with the given weight vector checker and returns the obtained information.
+     */
+    RefinementStep checkWeightVector(Environment const& env, PcaaWeightVectorChecker<SparseModelType>& checker, WeightVector&& direction) const;
+
     /*
      * Updates the overapproximation after a refinement step has been performed
      *
@@ -92,8 +103,13 @@ class SparsePcaaQuery {
 
     std::vector<Objective<typename SparseModelType::ValueType>> objectives;
 
+    // The preprocessed model and objectives from which (additional) weight vector checkers are created
+    preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> const& preprocessorResult;
+
     // The corresponding weight vector checker
     std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
+    // Further weight vector checkers that are only created if weight vectors are checked concurrently
+    std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
 
     // The results in each iteration of the algorithm
     std::vector<RefinementStep> refinementSteps;
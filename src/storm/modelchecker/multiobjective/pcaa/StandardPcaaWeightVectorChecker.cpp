@@ -451,10 +451,34 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(En
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
     solver->setRequirementsChecked(true);
 
-    // Use the (0...0) vector as initial guess for the solution.
-    std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
+    // Use the solution for the closest previously checked weight vector as initial guess. If there is none, we take the (0...0) vector.
+    // Solution methods that require specific initial values (e.g. lower or upper bounds) overwrite the guess.
+    auto closestSolution = ecQuotient->previousSolutions.end();
+    ValueType closestDistance = storm::utility::zero<ValueType>();
+    for (auto solutionIt = ecQuotient->previousSolutions.begin(); solutionIt != ecQuotient->previousSolutions.end(); ++solutionIt) {
+        ValueType distance = storm::utility::zero<ValueType>();
+        for (uint64_t objIndex = 0; objIndex < weightVector.size(); ++objIndex) {
+            ValueType difference = solutionIt->weightVector[objIndex] - weightVector[objIndex];
+            distance += difference * difference;
+        }
+        if (closestSolution == ecQuotient->previousSolutions.end() || distance < closestDistance) {
+            closestSolution = solutionIt;
+            closestDistance = distance;
+        }
+    }
+    if (closestSolution == ecQuotient->previousSolutions.end()) {
+        std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
+    } else {
+        ecQuotient->auxStateValues = closestSolution->stateValues;
+    }
 
     solver->solveEquations(env, ecQuotient->auxStateValues, ecQuotient->auxChoiceValues);
+
+    // Remember the solution. We keep at most one more solution than there are objectives.
+    if (ecQuotient->previousSolutions.size() > this->objectives.size()) {
+        ecQuotient->previousSolutions.erase(ecQuotient->previousSolutions.begin());
+    }
+    ecQuotient->previousSolutions.push_back({weightVector, ecQuotient->auxStateValues});
     this->weightedResult = std::vector<ValueType>(transitionMatrix.getRowGroupCount());
 
     transformEcqSolutionToOriginalModel(ecQuotient->auxStateValues, solver->getSchedulerChoices(), ecqStateToOptimalMecMap, this->weightedResult,
@@ -170,6 +170,13 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
 
         std::vector<ValueType> auxStateValues;
         std::vector<ValueType> auxChoiceValues;
+
+        // The solutions of the most recently checked weight vectors (oldest first). They serve as initial guesses for close weight vectors.
+        struct WeightedSolution {
+            std::vector<ValueType> weightVector;
+            std::vector<ValueType> stateValues;
+        };
+        std::vector<WeightedSolution> previousSolutions;
     };
     boost::optional<EcQuotient> ecQuotient;
 
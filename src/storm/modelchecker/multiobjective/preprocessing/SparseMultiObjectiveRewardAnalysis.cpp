@@ -29,7 +29,7 @@ template<typename SparseModelType>
 typename SparseMultiObjectiveRewardAnalysis<SparseModelType>::ReturnType SparseMultiObjectiveRewardAnalysis<SparseModelType>::analyze(
     storm::modelchecker::multiobjective::preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> const& preprocessorResult) {
     ReturnType result;
-    auto backwardTransitions = preprocessorResult.preprocessedModel->getBackwardTransitions();
+    auto const& backwardTransitions = preprocessorResult.preprocessedModel->getBackwardTransitions();
 
     setReward0States(result, preprocessorResult, backwardTransitions);
     checkRewardFiniteness(result, preprocessorResult, backwardTransitions);
@@ -62,6 +62,18 @@ class SparseMdpPrctlModelChecker : public SparsePropositionalModelChecker<Sparse
                                                                   CheckTask<storm::logic::MultiObjectiveFormula, SolutionType> const& checkTask) override;
     virtual std::unique_ptr<CheckResult> checkQuantileFormula(Environment const& env,
                                                               CheckTask<storm::logic::QuantileFormula, SolutionType> const& checkTask) override;
+
+   private:
+    /*!
+     * Retrieves the backward transitions of the model. If intermediate data is to be released, they are not cached in the model but only live as long
+     * as the returned pointer.
+     */
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getBackwardTransitions(Environment const& env) const;
+
+    /*!
+     * Retrieves the cache for qualitative analyses of the model or nullptr if intermediate data is to be released.
+     */
+    storm::storage::QualitativeAnalysisCache* getQualitativeAnalysisCache(Environment const& env) const;
 };
 }  // namespace modelchecker
 }  // namespace storm
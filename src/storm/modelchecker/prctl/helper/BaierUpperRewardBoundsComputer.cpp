@@ -6,23 +6,32 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/utility/Extremum.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
 
 namespace storm::modelchecker::helper {
 
+// Loops over fewer rows per thread are not worth the overhead of starting a thread.
+static uint64_t const MinimalNumberOfRowsPerThread = 50000;
+
+static uint64_t getNumberOfThreads(uint64_t numberOfThreads, uint64_t numberOfRows) {
+    return std::min<uint64_t>(numberOfThreads, std::max<uint64_t>(1, numberOfRows / MinimalNumberOfRowsPerThread));
+}
+
 template<typename ValueType>
 BaierUpperRewardBoundsComputer<ValueType>::BaierUpperRewardBoundsComputer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                           storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                           std::vector<ValueType> const& rewards,
                                                                           std::vector<ValueType> const& oneStepTargetProbabilities,
-                                                                          std::function<uint64_t(uint64_t)> const& stateToScc)
+                                                                          std::function<uint64_t(uint64_t)> const& stateToScc, uint64_t numberOfThreads)
     : transitionMatrix(transitionMatrix),
       backwardTransitions(&backwardTransitions),
       stateToScc(stateToScc),
       rewards(rewards),
-      oneStepTargetProbabilities(oneStepTargetProbabilities) {
+      oneStepTargetProbabilities(oneStepTargetProbabilities),
+      numberOfThreads(std::max<uint64_t>(1, numberOfThreads)) {
     // Intentionally left empty.
 }
 
@@ -30,12 +39,13 @@ template<typename ValueType>
 BaierUpperRewardBoundsComputer<ValueType>::BaierUpperRewardBoundsComputer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                           std::vector<ValueType> const& rewards,
                                                                           std::vector<ValueType> const& oneStepTargetProbabilities,
-                                                                          std::function<uint64_t(uint64_t)> const& stateToScc)
+                                                                          std::function<uint64_t(uint64_t)> const& stateToScc, uint64_t numberOfThreads)
     : transitionMatrix(transitionMatrix),
       backwardTransitions(nullptr),
       stateToScc(stateToScc),
       rewards(rewards),
-      oneStepTargetProbabilities(oneStepTargetProbabilities) {
+      oneStepTargetProbabilities(oneStepTargetProbabilities),
+      numberOfThreads(std::max<uint64_t>(1, numberOfThreads)) {
     // Intentionally left empty.
 }
 
@@ -58,7 +68,7 @@ std::vector<ValueType> BaierUpperRewardBoundsComputer<ValueType>::computeUpperBo
 template<typename ValueType>
 std::vector<ValueType> BaierUpperRewardBoundsComputer<ValueType>::computeUpperBoundOnExpectedVisitingTimes(
     storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
-    std::vector<ValueType> const& oneStepTargetProbabilities, std::function<uint64_t(uint64_t)> const& stateToScc) {
+    std::vector<ValueType> const& oneStepTargetProbabilities, std::function<uint64_t(uint64_t)> const& stateToScc, uint64_t numberOfThreads) {
     // This first computes for every state s a non-zero lower bound d_s for the probability that starting at s, we never reach s again
     // An upper bound on the expected visiting times is given by 1/d_s
     // More precisely, we maintain a set of processed states.
@@ -79,15 +89,26 @@ std::vector<ValueType> BaierUpperRewardBoundsComputer<ValueType>::computeUpperBo
     // A choice is valid iff it goes to processed states with non-zero probability.
     // Initially, mark all choices as valid that have non-zero probability to go to the target states *or* to a different Scc.
     auto validChoices = storm::utility::vector::filterGreaterZero(oneStepTargetProbabilities);
-    for (uint64_t state = 0; state < numStates; ++state) {
-        auto const scc = stateToScc(state);
-        for (auto rowIndex = rowGroupIndices[state], rowEnd = rowGroupIndices[state + 1]; rowIndex < rowEnd; ++rowIndex) {
-            auto const row = transitionMatrix.getRow(rowIndex);
-            if (std::any_of(row.begin(), row.end(), [&stateToScc, &scc](auto const& entry) { return scc != stateToScc(entry.getColumn()); })) {
-                validChoices.set(rowIndex, true);
+    // The rows are split into chunks of whole buckets of the bit vector (of 64 bits each), so the threads never write to the same bucket.
+    uint64_t const numRows = transitionMatrix.getRowCount();
+    uint64_t const numBuckets = (numRows + 63) / 64;
+    storm::utility::parallel::forEachChunk(
+        getNumberOfThreads(numberOfThreads, numRows), static_cast<uint64_t>(0), numBuckets, [&](uint64_t, uint64_t bucketBegin, uint64_t bucketEnd) {
+            uint64_t const rowBegin = bucketBegin * 64;
+            uint64_t const rowEnd = std::min(numRows, bucketEnd * 64);
+            // The last state whose row group starts at or before the first row of the chunk.
+            uint64_t state = std::upper_bound(rowGroupIndices.begin(), rowGroupIndices.end(), rowBegin) - rowGroupIndices.begin() - 1;
+            for (uint64_t rowIndex = rowBegin; rowIndex < rowEnd; ++rowIndex) {
+                while (rowGroupIndices[state + 1] <= rowIndex) {
+                    ++state;
+                }
+                auto const scc = stateToScc(state);
+                auto const row = transitionMatrix.getRow(rowIndex);
+                if (std::any_of(row.begin(), row.end(), [&stateToScc, &scc](auto const& entry) { return scc != stateToScc(entry.getColumn()); })) {
+                    validChoices.set(rowIndex, true);
+                }
             }
-        }
-    }
+        });
 
     // Vector that holds the result.
     std::vector<ValueType> result(numStates, storm::utility::one<ValueType>());
@@ -191,18 +212,37 @@ ValueType BaierUpperRewardBoundsComputer<ValueType>::computeUpperBound() {
     }
     auto const& backwardTransRef = backwardTransitions ? *backwardTransitions : computedBackwardTransitions;
 
-    auto expVisits = stateToScc ? computeUpperBoundOnExpectedVisitingTimes(transitionMatrix, backwardTransRef, oneStepTargetProbabilities, stateToScc)
-                                : computeUpperBoundOnExpectedVisitingTimes(transitionMatrix, backwardTransRef, oneStepTargetProbabilities);
+    std::vector<ValueType> expVisits;
+    if (stateToScc) {
+        expVisits = computeUpperBoundOnExpectedVisitingTimes(transitionMatrix, backwardTransRef, oneStepTargetProbabilities, stateToScc, numberOfThreads);
+    } else {
+        std::vector<uint64_t> stateToSccIndex =
+            storm::storage::StronglyConnectedComponentDecomposition<ValueType>(
+                transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().numberOfThreads(numberOfThreads))
+                .computeStateToSccIndexMap(transitionMatrix.getRowGroupCount());
+        expVisits = computeUpperBoundOnExpectedVisitingTimes(transitionMatrix, backwardTransRef, oneStepTargetProbabilities,
+                                                             [&stateToSccIndex](uint64_t s) { return stateToSccIndex[s]; }, numberOfThreads);
+    }
 
+    // Sum up the contributions of the states, where each thread computes a partial sum.
+    std::vector<ValueType> partialBounds(getNumberOfThreads(numberOfThreads, transitionMatrix.getRowCount()), storm::utility::zero<ValueType>());
+    storm::utility::parallel::forEachChunk(
+        partialBounds.size(), static_cast<uint64_t>(0), static_cast<uint64_t>(expVisits.size()), [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+            ValueType& partialBound = partialBounds[threadIndex];
+            for (uint64_t state = begin; state < end; ++state) {
+                ValueType maxReward = storm::utility::zero<ValueType>();
+                // By starting the maxReward with zero, negative rewards are essentially ignored which
+                // is necessary to provide a valid upper bound
+                for (auto row = transitionMatrix.getRowGroupIndices()[state], endRow = transitionMatrix.getRowGroupIndices()[state + 1]; row < endRow;
+                     ++row) {
+                    maxReward = std::max(maxReward, rewards[row]);
+                }
+                partialBound += expVisits[state] * maxReward;
+            }
+        });
     ValueType upperBound = storm::utility::zero<ValueType>();
-    for (uint64_t state = 0; state < expVisits.size(); ++state) {
-        ValueType maxReward = storm::utility::zero<ValueType>();
-        // By starting the maxReward with zero, negative rewards are essentially ignored which
-        // is necessary to provide a valid upper bound
-        for (auto row = transitionMatrix.getRowGroupIndices()[state], endRow = transitionMatrix.getRowGroupIndices()[state + 1]; row < endRow; ++row) {
-            maxReward = std::max(maxReward, rewards[row]);
-        }
-        upperBound += expVisits[state] * maxReward;
+    for (auto const& partialBound : partialBounds) {
+        upperBound += partialBound;
     }
 
     STORM_LOG_TRACE("Baier algorithm for reward bound computation (variant 2) computed bound " << upperBound << ".");
@@ -26,9 +26,11 @@ class BaierUpperRewardBoundsComputer {
      * @param rewards The rewards of each choice.
      * @param oneStepTargetProbabilities For each choice the probability to go to a goal state in one step.
      * @param stateToScc if given, the function has to assign to each state the index of its SCC. Useful if the SCC decomposition is already known from context.
+     * @param numberOfThreads The maximal number of threads used for the parts of the computation that can be parallelized.
      */
     BaierUpperRewardBoundsComputer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards,
-                                   std::vector<ValueType> const& oneStepTargetProbabilities, std::function<uint64_t(uint64_t)> const& stateToScc = {});
+                                   std::vector<ValueType> const& oneStepTargetProbabilities, std::function<uint64_t(uint64_t)> const& stateToScc = {},
+                                   uint64_t numberOfThreads = 1);
 
     /*!
      * Creates an object that can compute
@@ -42,10 +44,12 @@ class BaierUpperRewardBoundsComputer {
      * @param rewards The rewards of each choice.
      * @param oneStepTargetProbabilities For each choice the probability to go to a goal state in one step.
      * @param stateToScc if given, the function has to assign to each state the index of its SCC. Useful if the SCC decomposition is already known from context.
+     * @param numberOfThreads The maximal number of threads used for the parts of the computation that can be parallelized.
      */
     BaierUpperRewardBoundsComputer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& rewards,
-                                   std::vector<ValueType> const& oneStepTargetProbabilities, std::function<uint64_t(uint64_t)> const& stateToScc = {});
+                                   std::vector<ValueType> const& oneStepTargetProbabilities, std::function<uint64_t(uint64_t)> const& stateToScc = {},
+                                   uint64_t numberOfThreads = 1);
 
     /*!
      * Computes an upper bound on the expected rewards.
@@ -85,11 +89,12 @@ class BaierUpperRewardBoundsComputer {
      * that lead directly to the goal state.
      * @param oneStepTargetProbabilities For each choice the probability to go to a goal state in one step.
      * @param stateToScc Returns the SCC index for each state
+     * @param numberOfThreads The maximal number of threads used to initially check which choices leave their SCC. The remaining computation is sequential.
      */
     static std::vector<ValueType> computeUpperBoundOnExpectedVisitingTimes(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                            storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                            std::vector<ValueType> const& oneStepTargetProbabilities,
-                                                                           std::function<uint64_t(uint64_t)> const& stateToScc);
+                                                                           std::function<uint64_t(uint64_t)> const& stateToScc, uint64_t numberOfThreads = 1);
 
    private:
     storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
@@ -97,6 +102,7 @@ class BaierUpperRewardBoundsComputer {
     std::function<uint64_t(uint64_t)> stateToScc;
     std::vector<ValueType> const& rewards;
     std::vector<ValueType> const& oneStepTargetProbabilities;
+    uint64_t const numberOfThreads;
 };
 }  // namespace helper
 }  // namespace modelchecker
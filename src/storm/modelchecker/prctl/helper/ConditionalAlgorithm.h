@@ -0,0 +1,9 @@
+#pragma once
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+enum class ConditionalAlgorithm { Transformation, Joint, Bisection };
+}
+}  // namespace modelchecker
+}  // namespace storm
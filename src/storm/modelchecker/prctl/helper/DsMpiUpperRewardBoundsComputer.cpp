@@ -4,30 +4,37 @@
 
 #include "storm/adapters/RationalNumberAdapter.h"
 
+#include "storm/solver/helper/TopologicalSccScheduling.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/ConsecutiveUint64DynamicPriorityQueue.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/Extremum.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace modelchecker {
 namespace helper {
 
+// Loops over fewer rows per thread are not worth the overhead of starting a thread.
+static uint64_t const MinimalNumberOfRowsPerThread = 50000;
+
 template<typename ValueType>
 DsMpiDtmcUpperRewardBoundsComputer<ValueType>::DsMpiDtmcUpperRewardBoundsComputer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                   std::vector<ValueType> const& rewards,
-                                                                                  std::vector<ValueType> const& oneStepTargetProbabilities)
+                                                                                  std::vector<ValueType> const& oneStepTargetProbabilities,
+                                                                                  uint64_t numberOfThreads)
     : transitionMatrix(transitionMatrix),
       originalRewards(rewards),
       originalOneStepTargetProbabilities(oneStepTargetProbabilities),
+      numberOfThreads(std::max<uint64_t>(1, numberOfThreads)),
       backwardTransitions(transitionMatrix.transpose()),
-      p(transitionMatrix.getRowGroupCount()),
-      w(transitionMatrix.getRowGroupCount()),
       rewards(rewards),
       targetProbabilities(oneStepTargetProbabilities) {
     // Intentionally left empty.
@@ -44,9 +51,13 @@ std::vector<ValueType> DsMpiDtmcUpperRewardBoundsComputer<ValueType>::computeUpp
     // Finally compute the upper bounds for the states.
     std::vector<ValueType> result(transitionMatrix.getRowGroupCount());
     auto one = storm::utility::one<ValueType>();
-    for (storm::storage::sparse::state_type state = 0; state < result.size(); ++state) {
-        result[state] = w[state] + (one - p[state]) * lambda;
-    }
+    storm::utility::parallel::forEachChunk(getNumberOfThreads(result.size()), static_cast<uint64_t>(0), static_cast<uint64_t>(result.size()),
+                                           [&](uint64_t, uint64_t begin, uint64_t end) {
+                                               for (uint64_t state = begin; state < end; ++state) {
+                                                   uint64_t const choice = getChoiceInState(state);
+                                                   result[state] = rewards[choice] + (one - targetProbabilities[choice]) * lambda;
+                                               }
+                                           });
 
 #ifndef NDEBUG
     ValueType max = storm::utility::zero<ValueType>();
@@ -66,36 +77,48 @@ std::vector<ValueType> DsMpiDtmcUpperRewardBoundsComputer<ValueType>::computeUpp
 
 template<typename ValueType>
 ValueType DsMpiDtmcUpperRewardBoundsComputer<ValueType>::computeLambda() const {
-    ValueType lambda = storm::utility::zero<ValueType>();
-    for (storm::storage::sparse::state_type state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
-        lambda = std::max(lambda, computeLambdaForChoice(state));
-    }
-    return lambda;
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    std::vector<ValueType> threadLambdas(getNumberOfThreads(numberOfStates), storm::utility::zero<ValueType>());
+    storm::utility::parallel::forEachChunk(threadLambdas.size(), static_cast<uint64_t>(0), numberOfStates,
+                                           [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+                                               ValueType& lambda = threadLambdas[threadIndex];
+                                               for (uint64_t state = begin; state < end; ++state) {
+                                                   lambda = std::max(lambda, computeLambdaForChoice(getChoiceInState(state)));
+                                               }
+                                           });
+    return *std::max_element(threadLambdas.begin(), threadLambdas.end());
+}
+
+template<typename ValueType>
+uint64_t DsMpiDtmcUpperRewardBoundsComputer<ValueType>::getNumberOfThreads(uint64_t numberOfRows) const {
+    return std::min<uint64_t>(numberOfThreads, std::max<uint64_t>(1, numberOfRows / MinimalNumberOfRowsPerThread));
 }
 
 template<typename ValueType>
 ValueType DsMpiDtmcUpperRewardBoundsComputer<ValueType>::computeLambdaForChoice(uint64_t choice) const {
     ValueType localLambda = storm::utility::zero<ValueType>();
     uint64_t state = this->getStateForChoice(choice);
+    ValueType const& p = targetProbabilities[choice];
+    ValueType const& w = rewards[choice];
 
     // Check whether condition (I) or (II) applies.
     ValueType probSum = originalOneStepTargetProbabilities[choice];
     for (auto const& e : transitionMatrix.getRow(choice)) {
-        probSum += e.getValue() * p[e.getColumn()];
+        probSum += e.getValue() * targetProbabilities[this->getChoiceInState(e.getColumn())];
     }
 
-    if (p[state] < probSum) {
-        STORM_LOG_TRACE("Condition (I) does apply for state " << state << " as " << p[state] << " < " << probSum << ".");
+    if (p < probSum) {
+        STORM_LOG_TRACE("Condition (I) does apply for state " << state << " as " << p << " < " << probSum << ".");
         // Condition (I) applies.
-        localLambda = probSum - p[state];
+        localLambda = probSum - p;
         ValueType nominator = originalRewards[choice];
         for (auto const& e : transitionMatrix.getRow(choice)) {
-            nominator += e.getValue() * w[e.getColumn()];
+            nominator += e.getValue() * rewards[this->getChoiceInState(e.getColumn())];
         }
-        nominator -= w[state];
+        nominator -= w;
         localLambda = nominator / localLambda;
     } else {
-        STORM_LOG_TRACE("Condition (I) does not apply for state " << state << std::setprecision(30) << " as " << probSum << " <= " << p[state] << ".");
+        STORM_LOG_TRACE("Condition (I) does not apply for state " << state << std::setprecision(30) << " as " << probSum << " <= " << p << ".");
         // Here, condition (II) automatically applies and as the resulting local lambda is 0, we
         // don't need to consider it.
 
@@ -103,12 +126,12 @@ ValueType DsMpiDtmcUpperRewardBoundsComputer<ValueType>::computeLambdaForChoice(
         // Actually check condition (II).
         ValueType rewardSum = originalRewards[choice];
         for (auto const& e : transitionMatrix.getRow(choice)) {
-            rewardSum += e.getValue() * w[e.getColumn()];
+            rewardSum += e.getValue() * rewards[this->getChoiceInState(e.getColumn())];
         }
-        STORM_LOG_WARN_COND(w[state] >= rewardSum || storm::utility::ConstantsComparator<ValueType>().isEqual(w[state], rewardSum),
-                            "Expected condition (II) to hold in state " << state << ", but " << w[state] << " < " << rewardSum << ".");
-        STORM_LOG_WARN_COND(storm::utility::ConstantsComparator<ValueType>().isEqual(probSum, p[state]),
-                            "Expected condition (II) to hold in state " << state << ", but " << probSum << " != " << p[state] << ".");
+        STORM_LOG_WARN_COND(w >= rewardSum || storm::utility::ConstantsComparator<ValueType>().isEqual(w, rewardSum),
+                            "Expected condition (II) to hold in state " << state << ", but " << w << " < " << rewardSum << ".");
+        STORM_LOG_WARN_COND(storm::utility::ConstantsComparator<ValueType>().isEqual(probSum, p),
+                            "Expected condition (II) to hold in state " << state << ", but " << probSum << " != " << p << ".");
 #endif
     }
 
@@ -120,6 +143,11 @@ uint64_t DsMpiDtmcUpperRewardBoundsComputer<ValueType>::getStateForChoice(uint64
     return choice;
 }
 
+template<typename ValueType>
+uint64_t DsMpiDtmcUpperRewardBoundsComputer<ValueType>::getChoiceInState(uint64_t state) const {
+    return state;
+}
+
 template<typename ValueType>
 class DsMpiDtmcPriorityLess {
    public:
@@ -149,18 +177,16 @@ void DsMpiDtmcUpperRewardBoundsComputer<ValueType>::sweep() {
                                                                                                   DsMpiDtmcPriorityLess<ValueType>(*this));
 
     // Keep track of visited states.
-    storm::storage::BitVector visited(p.size());
+    storm::storage::BitVector visited(transitionMatrix.getRowCount());
 
     while (!queue.empty()) {
         // Get first entry in queue.
         storm::storage::sparse::state_type currentState = queue.popTop();
 
-        // Mark state as visited.
+        // Mark state as visited. This fixes the weight and probability of the state.
         visited.set(currentState);
-
-        // Set weight and probability for the state.
-        w[currentState] = rewards[currentState];
-        p[currentState] = targetProbabilities[currentState];
+        ValueType const& w = rewards[currentState];
+        ValueType const& p = targetProbabilities[currentState];
 
         for (auto const& e : backwardTransitions.getRow(currentState)) {
             if (visited.get(e.getColumn())) {
@@ -168,8 +194,8 @@ void DsMpiDtmcUpperRewardBoundsComputer<ValueType>::sweep() {
             }
 
             // Update reward/probability values.
-            rewards[e.getColumn()] += e.getValue() * w[currentState];
-            targetProbabilities[e.getColumn()] += e.getValue() * p[currentState];
+            rewards[e.getColumn()] += e.getValue() * w;
+            targetProbabilities[e.getColumn()] += e.getValue() * p;
 
             // Increase priority of element.
             queue.increase(e.getColumn());
@@ -180,8 +206,10 @@ void DsMpiDtmcUpperRewardBoundsComputer<ValueType>::sweep() {
 template<typename ValueType>
 DsMpiMdpUpperRewardBoundsComputer<ValueType>::DsMpiMdpUpperRewardBoundsComputer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                 std::vector<ValueType> const& rewards,
-                                                                                std::vector<ValueType> const& oneStepTargetProbabilities)
-    : DsMpiDtmcUpperRewardBoundsComputer<ValueType>(transitionMatrix, rewards, oneStepTargetProbabilities), policy(transitionMatrix.getRowCount()) {
+                                                                                std::vector<ValueType> const& oneStepTargetProbabilities,
+                                                                                uint64_t numberOfThreads)
+    : DsMpiDtmcUpperRewardBoundsComputer<ValueType>(transitionMatrix, rewards, oneStepTargetProbabilities, numberOfThreads),
+      policy(transitionMatrix.getRowGroupCount()) {
     // Create a mapping from choices to states.
     // Also pick a choice in each state that maximizes the target probability and minimizes the reward.
     choiceToState.resize(transitionMatrix.getRowCount());
@@ -208,15 +236,6 @@ DsMpiMdpUpperRewardBoundsComputer<ValueType>::DsMpiMdpUpperRewardBoundsComputer(
     }
 }
 
-template<typename ValueType>
-ValueType DsMpiMdpUpperRewardBoundsComputer<ValueType>::computeLambda() const {
-    ValueType lambda = storm::utility::zero<ValueType>();
-    for (storm::storage::sparse::state_type state = 0; state < this->transitionMatrix.getRowGroupCount(); ++state) {
-        lambda = std::max(lambda, this->computeLambdaForChoice(this->getChoiceInState(state)));
-    }
-    return lambda;
-}
-
 template<typename ValueType>
 uint64_t DsMpiMdpUpperRewardBoundsComputer<ValueType>::getStateForChoice(uint64_t choice) const {
     return choiceToState[choice];
@@ -238,7 +257,7 @@ class DsMpiMdpPriorityLess {
         if (pa < pb) {
             return true;
         } else if (pa == pb) {
-            return dsmpi.rewards[choiceB] > dsmpi.rewards[choiceB];
+            return dsmpi.rewards[choiceA] > dsmpi.rewards[choiceB];
         }
         return false;
     }
@@ -263,10 +282,10 @@ void DsMpiMdpUpperRewardBoundsComputer<ValueType>::sweep() {
         // Mark state as visited.
         visited.set(currentState);
 
-        // Set weight and probability for the state.
+        // The weight and probability of the state are given by its selected choice, which is now final.
         uint64_t choiceInCurrentState = this->getChoiceInState(currentState);
-        this->w[currentState] = this->rewards[choiceInCurrentState];
-        this->p[currentState] = this->targetProbabilities[choiceInCurrentState];
+        ValueType const& w = this->rewards[choiceInCurrentState];
+        ValueType const& p = this->targetProbabilities[choiceInCurrentState];
 
         for (auto const& choiceEntry : this->backwardTransitions.getRow(currentState)) {
             uint64_t predecessor = this->getStateForChoice(choiceEntry.getColumn());
@@ -275,8 +294,8 @@ void DsMpiMdpUpperRewardBoundsComputer<ValueType>::sweep() {
             }
 
             // Update reward/probability values.
-            this->rewards[choiceEntry.getColumn()] += choiceEntry.getValue() * this->w[currentState];
-            this->targetProbabilities[choiceEntry.getColumn()] += choiceEntry.getValue() * this->p[currentState];
+            this->rewards[choiceEntry.getColumn()] += choiceEntry.getValue() * w;
+            this->targetProbabilities[choiceEntry.getColumn()] += choiceEntry.getValue() * p;
 
             // If the choice is not the one that is currently taken in the predecessor state, we might need
             // to update it.
@@ -309,12 +328,144 @@ void DsMpiMdpUpperRewardBoundsComputer<ValueType>::setChoiceInState(uint64_t sta
     policy[state] = choice;
 }
 
+template<typename ValueType>
+DsMpiSccUpperRewardBoundsComputer<ValueType>::DsMpiSccUpperRewardBoundsComputer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                std::vector<ValueType> const& rewards,
+                                                                                std::vector<ValueType> const& oneStepTargetProbabilities,
+                                                                                uint64_t numberOfThreads)
+    : transitionMatrix(transitionMatrix),
+      rewards(rewards),
+      oneStepTargetProbabilities(oneStepTargetProbabilities),
+      numberOfThreads(std::max<uint64_t>(1, numberOfThreads)) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+std::vector<ValueType> DsMpiSccUpperRewardBoundsComputer<ValueType>::computeUpperBounds() {
+    STORM_LOG_TRACE("Computing upper reward bounds using DS-MPI on each SCC.");
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> decomposition(
+        transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().numberOfThreads(numberOfThreads));
+    stateToScc.resize(numberOfStates);
+    stateToLocalIndex.resize(numberOfStates);
+    uint64_t numberOfNonTrivialSccs = 0;
+    for (uint64_t sccIndex = 0; sccIndex < decomposition.size(); ++sccIndex) {
+        auto const& scc = decomposition.getBlock(sccIndex);
+        if (scc.size() > 1) {
+            ++numberOfNonTrivialSccs;
+        }
+        uint64_t localIndex = 0;
+        for (auto state : scc) {
+            stateToScc[state] = sccIndex;
+            stateToLocalIndex[state] = localIndex++;
+        }
+    }
+
+    std::vector<ValueType> result(numberOfStates);
+    if (numberOfThreads > 1 && numberOfNonTrivialSccs > 1) {
+        // Independent SCCs are processed concurrently, so each of them is processed with a single thread.
+        auto dependencies = storm::solver::helper::computeSccDependencies(transitionMatrix, decomposition);
+        storm::utility::parallel::forEachInDependencyOrder(numberOfThreads, dependencies.dependencyCounts, dependencies.dependentOffsets,
+                                                           dependencies.dependents, [&](uint64_t, uint64_t sccIndex) {
+                                                               // Only the bounds of the SCCs this SCC depends on are read and these are final.
+                                                               computeSccBounds(sccIndex, decomposition.getBlock(sccIndex), 1, result);
+                                                               return true;
+                                                           });
+    } else {
+        // The SCCs are sorted topologically such that every SCC only depends on SCCs with a smaller index.
+        for (uint64_t sccIndex = 0; sccIndex < decomposition.size(); ++sccIndex) {
+            computeSccBounds(sccIndex, decomposition.getBlock(sccIndex), numberOfThreads, result);
+        }
+    }
+    stateToScc.clear();
+    stateToScc.shrink_to_fit();
+    stateToLocalIndex.clear();
+    stateToLocalIndex.shrink_to_fit();
+    return result;
+}
+
+template<typename ValueType>
+void DsMpiSccUpperRewardBoundsComputer<ValueType>::computeSccBounds(uint64_t sccIndex, storm::storage::StronglyConnectedComponent const& scc,
+                                                                     uint64_t numberOfThreadsForScc, std::vector<ValueType>& result) const {
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    if (scc.size() == 1) {
+        // For a single state s, the bound of each choice c satisfies x = r(c) + P(c,s) * x + sum_{t != s} P(c,t) * bound(t), which we can solve directly.
+        uint64_t const state = *scc.begin();
+        storm::utility::Minimum<ValueType> stateBound;
+        for (uint64_t row = rowGroupIndices[state], rowEnd = rowGroupIndices[state + 1]; row < rowEnd; ++row) {
+            ValueType choiceBound = rewards[row];
+            ValueType selfLoopProbability = storm::utility::zero<ValueType>();
+            for (auto const& entry : transitionMatrix.getRow(row)) {
+                if (entry.getColumn() == state) {
+                    selfLoopProbability += entry.getValue();
+                } else {
+                    choiceBound += entry.getValue() * result[entry.getColumn()];
+                }
+            }
+            if (selfLoopProbability < storm::utility::one<ValueType>()) {
+                stateBound &= choiceBound / (storm::utility::one<ValueType>() - selfLoopProbability);
+            }
+        }
+        if (!stateBound.empty()) {
+            result[state] = *stateBound;
+            return;
+        }
+        // Otherwise, every choice is a self loop, which is left to DS-MPI below.
+    }
+
+    // Build the system restricted to the SCC, where leaving the SCC counts as reaching a goal state that collects the bound of the successor state.
+    bool const isDtmc = transitionMatrix.hasTrivialRowGrouping();
+    uint64_t numberOfLocalRows = 0;
+    for (auto state : scc) {
+        numberOfLocalRows += rowGroupIndices[state + 1] - rowGroupIndices[state];
+    }
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfLocalRows, scc.size(), 0, true, !isDtmc, isDtmc ? 0 : scc.size());
+    std::vector<ValueType> localRewards, localTargetProbabilities;
+    localRewards.reserve(numberOfLocalRows);
+    localTargetProbabilities.reserve(numberOfLocalRows);
+    uint64_t localRow = 0;
+    for (auto state : scc) {
+        if (!isDtmc) {
+            builder.newRowGroup(localRow);
+        }
+        for (uint64_t row = rowGroupIndices[state], rowEnd = rowGroupIndices[state + 1]; row < rowEnd; ++row, ++localRow) {
+            ValueType reward = rewards[row];
+            ValueType targetProbability = oneStepTargetProbabilities[row];
+            for (auto const& entry : transitionMatrix.getRow(row)) {
+                if (stateToScc[entry.getColumn()] == sccIndex) {
+                    builder.addNextValue(localRow, stateToLocalIndex[entry.getColumn()], entry.getValue());
+                } else {
+                    reward += entry.getValue() * result[entry.getColumn()];
+                    targetProbability += entry.getValue();
+                }
+            }
+            localRewards.push_back(std::move(reward));
+            localTargetProbabilities.push_back(std::move(targetProbability));
+        }
+    }
+    storm::storage::SparseMatrix<ValueType> localMatrix = builder.build();
+
+    std::vector<ValueType> localBounds;
+    if (isDtmc) {
+        localBounds =
+            DsMpiDtmcUpperRewardBoundsComputer<ValueType>(localMatrix, localRewards, localTargetProbabilities, numberOfThreadsForScc).computeUpperBounds();
+    } else {
+        localBounds =
+            DsMpiMdpUpperRewardBoundsComputer<ValueType>(localMatrix, localRewards, localTargetProbabilities, numberOfThreadsForScc).computeUpperBounds();
+    }
+    for (auto state : scc) {
+        result[state] = std::move(localBounds[stateToLocalIndex[state]]);
+    }
+}
+
 template class DsMpiDtmcUpperRewardBoundsComputer<double>;
 template class DsMpiMdpUpperRewardBoundsComputer<double>;
+template class DsMpiSccUpperRewardBoundsComputer<double>;
 
 #ifdef STORM_HAVE_CARL
 template class DsMpiDtmcUpperRewardBoundsComputer<storm::RationalNumber>;
 template class DsMpiMdpUpperRewardBoundsComputer<storm::RationalNumber>;
+template class DsMpiSccUpperRewardBoundsComputer<storm::RationalNumber>;
 #endif
 }  // namespace helper
 }  // namespace modelchecker
@@ -7,6 +7,7 @@ namespace storm {
 namespace storage {
 template<typename ValueType>
 class SparseMatrix;
+class StronglyConnectedComponent;
 }
 
 namespace modelchecker {
@@ -25,9 +26,10 @@ class DsMpiDtmcUpperRewardBoundsComputer {
      * that lead directly to the goal state.
      * @param rewards The rewards of each state.
      * @param oneStepTargetProbabilities For each state the probability to go to a goal state in one step.
+     * @param numberOfThreads The maximal number of threads used to derive the bounds once the (inherently sequential) sweep is done.
      */
     DsMpiDtmcUpperRewardBoundsComputer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards,
-                                       std::vector<ValueType> const& oneStepTargetProbabilities);
+                                       std::vector<ValueType> const& oneStepTargetProbabilities, uint64_t numberOfThreads = 1);
 
     virtual ~DsMpiDtmcUpperRewardBoundsComputer() = default;
 
@@ -43,7 +45,7 @@ class DsMpiDtmcUpperRewardBoundsComputer {
     virtual void sweep();
 
     /*!
-     * Computes the lambda used for the estimation.
+     * Computes the lambda used for the estimation. Only the selected choices of the states are considered.
      */
     virtual ValueType computeLambda() const;
 
@@ -57,17 +59,27 @@ class DsMpiDtmcUpperRewardBoundsComputer {
      */
     virtual uint64_t getStateForChoice(uint64_t choice) const;
 
+    /*!
+     * Retrieves the choice that is selected in the given state.
+     */
+    virtual uint64_t getChoiceInState(uint64_t state) const;
+
+    /*!
+     * Retrieves the number of threads to use for a loop over the given number of rows.
+     */
+    uint64_t getNumberOfThreads(uint64_t numberOfRows) const;
+
     // References to input data.
     storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
     std::vector<ValueType> const& originalRewards;
     std::vector<ValueType> const& originalOneStepTargetProbabilities;
+    uint64_t const numberOfThreads;
 
     // Derived from input data.
     storm::storage::SparseMatrix<ValueType> backwardTransitions;
 
-    // Data that the algorithm uses internally.
-    std::vector<ValueType> p;
-    std::vector<ValueType> w;
+    // Data that the algorithm uses internally. Once a state is swept, the values of its selected choice are final. They are the weight w and the
+    // probability p of the state in the terminology of the paper, so these do not need to be stored separately.
     std::vector<ValueType> rewards;
     std::vector<ValueType> targetProbabilities;
 
@@ -87,15 +99,15 @@ class DsMpiMdpUpperRewardBoundsComputer : public DsMpiDtmcUpperRewardBoundsCompu
      * that lead directly to the goal state.
      * @param rewards The rewards of each choice.
      * @param oneStepTargetProbabilities For each choice the probability to go to a goal state in one step.
+     * @param numberOfThreads The maximal number of threads used to derive the bounds once the (inherently sequential) sweep is done.
      */
     DsMpiMdpUpperRewardBoundsComputer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards,
-                                      std::vector<ValueType> const& oneStepTargetProbabilities);
+                                      std::vector<ValueType> const& oneStepTargetProbabilities, uint64_t numberOfThreads = 1);
 
    private:
     virtual void sweep() override;
-    virtual ValueType computeLambda() const override;
     virtual uint64_t getStateForChoice(uint64_t choice) const override;
-    uint64_t getChoiceInState(uint64_t state) const;
+    virtual uint64_t getChoiceInState(uint64_t state) const override;
     void setChoiceInState(uint64_t state, uint64_t choice);
 
     std::vector<uint64_t> choiceToState;
@@ -103,6 +115,45 @@ class DsMpiMdpUpperRewardBoundsComputer : public DsMpiDtmcUpperRewardBoundsCompu
 
     friend class DsMpiMdpPriorityLess<ValueType>;
 };
+
+template<typename ValueType>
+class DsMpiSccUpperRewardBoundsComputer {
+   public:
+    /*!
+     * Creates an object that computes upper bounds on the (for MDPs: *minimal*) expected rewards with DS-MPI for one SCC at a time. The SCCs are processed
+     * bottom-up, where the transitions leaving an SCC are treated like transitions to a goal state that additionally collect the bound of their target.
+     * As DS-MPI scales the bounds of all states with a single factor, this typically yields much tighter bounds on large models. Moreover, trivial SCCs
+     * are handled directly and independent SCCs are processed concurrently.
+     * @param transitionMatrix The matrix defining the transitions of the system without the transitions that lead directly to the goal state. If the row
+     * grouping is trivial, the matrix is treated as a DTMC.
+     * @param rewards The rewards of each choice.
+     * @param oneStepTargetProbabilities For each choice the probability to go to a goal state in one step.
+     * @param numberOfThreads The maximal number of threads.
+     */
+    DsMpiSccUpperRewardBoundsComputer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards,
+                                      std::vector<ValueType> const& oneStepTargetProbabilities, uint64_t numberOfThreads = 1);
+
+    /*!
+     * Computes upper bounds on the expected rewards.
+     */
+    std::vector<ValueType> computeUpperBounds();
+
+   private:
+    /*!
+     * Computes the bounds of the states of the given SCC, assuming that the bounds of all states the SCC depends on are already computed.
+     */
+    void computeSccBounds(uint64_t sccIndex, storm::storage::StronglyConnectedComponent const& scc, uint64_t numberOfThreadsForScc,
+                          std::vector<ValueType>& result) const;
+
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+    std::vector<ValueType> const& rewards;
+    std::vector<ValueType> const& oneStepTargetProbabilities;
+    uint64_t const numberOfThreads;
+
+    // For each state, the index of its SCC and its index within the SCC.
+    std::vector<uint64_t> stateToScc;
+    std::vector<uint64_t> stateToLocalIndex;
+};
 }  // namespace helper
 }  // namespace modelchecker
 }  // namespace storm
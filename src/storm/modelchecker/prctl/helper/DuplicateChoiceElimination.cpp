@@ -0,0 +1,103 @@
+#include "storm/modelchecker/prctl/helper/DuplicateChoiceElimination.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/vector.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+template<typename ValueType>
+DuplicateChoiceElimination<ValueType>::DuplicateChoiceElimination(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& b,
+                                                                  uint64_t numberOfThreads)
+    : rowGroupIndices(matrix.getRowGroupIndices()), reducedChoices(matrix.getRowCount()), keptRows(matrix.getRowCount()) {
+    STORM_LOG_ASSERT(b.size() == matrix.getRowCount(), "The right-hand side does not match the matrix.");
+
+    // The row groups are independent, so every thread writes the choices of the rows of its chunk only.
+    uint64_t const numberOfRowGroups = matrix.getRowGroupCount();
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), numberOfRowGroups, [&](uint64_t, uint64_t begin, uint64_t end) {
+        std::vector<uint64_t> keptRowsOfGroup;
+        for (uint64_t group = begin; group < end; ++group) {
+            keptRowsOfGroup.clear();
+            for (uint64_t row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+                uint64_t choice = 0;
+                for (; choice < keptRowsOfGroup.size(); ++choice) {
+                    uint64_t const keptRow = keptRowsOfGroup[choice];
+                    if (b[keptRow] == b[row] && matrix.getRow(keptRow).getNumberOfEntries() == matrix.getRow(row).getNumberOfEntries() &&
+                        matrix.compareRows(keptRow, row)) {
+                        break;
+                    }
+                }
+                if (choice == keptRowsOfGroup.size()) {
+                    keptRowsOfGroup.push_back(row);
+                }
+                reducedChoices[row] = choice;
+            }
+        }
+    });
+
+    // A row is kept iff it refers to the next kept row of its group.
+    reducedRowGroupIndices.reserve(numberOfRowGroups + 1);
+    reducedRowGroupIndices.push_back(0);
+    for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+        uint64_t numberOfKeptRows = 0;
+        for (uint64_t row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+            if (reducedChoices[row] == numberOfKeptRows) {
+                keptRows.set(row);
+                originalChoices.push_back(row - rowGroupIndices[group]);
+                ++numberOfKeptRows;
+            }
+        }
+        reducedRowGroupIndices.push_back(reducedRowGroupIndices.back() + numberOfKeptRows);
+    }
+}
+
+template<typename ValueType>
+uint64_t DuplicateChoiceElimination<ValueType>::getNumberOfDuplicateRows() const {
+    return keptRows.size() - originalChoices.size();
+}
+
+template<typename ValueType>
+storm::storage::BitVector const& DuplicateChoiceElimination<ValueType>::getKeptRows() const {
+    return keptRows;
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> DuplicateChoiceElimination<ValueType>::reduceMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) const {
+    return matrix.restrictRows(keptRows);
+}
+
+template<typename ValueType>
+std::vector<ValueType> DuplicateChoiceElimination<ValueType>::reduceVector(std::vector<ValueType> const& vector) const {
+    return storm::utility::vector::filterVector(vector, keptRows);
+}
+
+template<typename ValueType>
+std::vector<uint64_t> DuplicateChoiceElimination<ValueType>::reduceScheduler(std::vector<uint64_t> const& choices) const {
+    STORM_LOG_ASSERT(choices.size() + 1 == rowGroupIndices.size(), "The scheduler does not match the equation system.");
+    std::vector<uint64_t> result(choices.size());
+    for (uint64_t group = 0; group < choices.size(); ++group) {
+        result[group] = reducedChoices[rowGroupIndices[group] + choices[group]];
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> DuplicateChoiceElimination<ValueType>::restoreScheduler(std::vector<uint64_t> const& choices) const {
+    STORM_LOG_ASSERT(choices.size() + 1 == reducedRowGroupIndices.size(), "The scheduler does not match the reduced equation system.");
+    std::vector<uint64_t> result(choices.size());
+    for (uint64_t group = 0; group < choices.size(); ++group) {
+        result[group] = originalChoices[reducedRowGroupIndices[group] + choices[group]];
+    }
+    return result;
+}
+
+template class DuplicateChoiceElimination<double>;
+template class DuplicateChoiceElimination<storm::RationalNumber>;
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
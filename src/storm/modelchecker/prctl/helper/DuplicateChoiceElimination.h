@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}  // namespace storage
+
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Removes the rows of a min-max equation system that coincide with a previous row of the same row group, i.e., the choices of a state that have the
+ * same distribution and the same right-hand side (which includes the rewards) as another choice of the state. As such choices are interchangeable for
+ * every scheduler, the solution of the system is not affected. The (local) choices of schedulers can be translated between both systems.
+ */
+template<typename ValueType>
+class DuplicateChoiceElimination {
+   public:
+    /*!
+     * Detects the duplicate rows of the given equation system. The row groups are processed with (at most) the given number of threads.
+     */
+    DuplicateChoiceElimination(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& b, uint64_t numberOfThreads = 1);
+
+    /*!
+     * Retrieves the number of rows that coincide with a previous row of their row group.
+     */
+    uint64_t getNumberOfDuplicateRows() const;
+
+    /*!
+     * Retrieves the rows that are kept, i.e., the first row of every set of coinciding rows.
+     */
+    storm::storage::BitVector const& getKeptRows() const;
+
+    /*!
+     * Removes the duplicate rows from the given matrix (or vector) of the equation system.
+     */
+    storm::storage::SparseMatrix<ValueType> reduceMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) const;
+    std::vector<ValueType> reduceVector(std::vector<ValueType> const& vector) const;
+
+    /*!
+     * Translates the given choices of a scheduler for the original system to the reduced system.
+     */
+    std::vector<uint64_t> reduceScheduler(std::vector<uint64_t> const& choices) const;
+
+    /*!
+     * Translates the given choices of a scheduler for the reduced system to the original system.
+     */
+    std::vector<uint64_t> restoreScheduler(std::vector<uint64_t> const& choices) const;
+
+   private:
+    // The row group indices of the original system.
+    std::vector<uint64_t> rowGroupIndices;
+
+    // The row group indices of the reduced system.
+    std::vector<uint64_t> reducedRowGroupIndices;
+
+    // For every row of the original system, the local index of the kept row it coincides with in the reduced system.
+    std::vector<uint64_t> reducedChoices;
+
+    // For every row of the reduced system, its local index in the original system.
+    std::vector<uint64_t> originalChoices;
+
+    storm::storage::BitVector keptRows;
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -7,6 +7,7 @@
 
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/BlockedMatrix.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Odd.h"
 
@@ -20,6 +21,7 @@
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQuantitativeCheckResult.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/utility/Stopwatch.h"
 
 #include "storm/exceptions/InvalidPropertyException.h"
@@ -182,15 +184,22 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeBo
         // Create the solution vector.
         std::vector<ValueType> x(maybeStates.getNonZeroCount(), storm::utility::zero<ValueType>());
 
-        // Translate the symbolic matrix/vector to their explicit representations.
-        conversionWatch.start();
-        storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
-        std::vector<ValueType> b = subvector.toVector(odd);
-        conversionWatch.stop();
-        STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+        uint64_t blockSize = env.modelchecker().getHybridBlockSize();
+        if (blockSize > 0 && blockSize < x.size()) {
+            // Convert the matrix block-wise in every multiplication to avoid storing its explicit representation.
+            storm::dd::BlockedMatrix<DdType, ValueType> blockedSubmatrix(submatrix, model.getRowVariables(), {}, odd, odd, blockSize, subvector);
+            blockedSubmatrix.repeatedMultiply(x, stepBound);
+        } else {
+            // Translate the symbolic matrix/vector to their explicit representations.
+            conversionWatch.start();
+            storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+            std::vector<ValueType> b = subvector.toVector(odd);
+            conversionWatch.stop();
+            STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitSubmatrix);
-        multiplier->repeatedMultiply(env, x, &b, stepBound);
+            auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitSubmatrix);
+            multiplier->repeatedMultiply(env, x, &b, stepBound);
+        }
 
         // Return a hybrid check result that stores the numerical values explicitly.
         return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(
@@ -217,14 +226,22 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeIn
     // Create the solution vector (and initialize it to the state rewards of the model).
     std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
 
-    // Translate the symbolic matrix to its explicit representations.
-    storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
-    conversionWatch.stop();
-    STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+    uint64_t blockSize = env.modelchecker().getHybridBlockSize();
+    if (blockSize > 0 && blockSize < x.size()) {
+        // Convert the matrix block-wise in every multiplication to avoid storing its explicit representation.
+        conversionWatch.stop();
+        storm::dd::BlockedMatrix<DdType, ValueType> blockedMatrix(transitionMatrix, model.getRowVariables(), {}, odd, odd, blockSize);
+        blockedMatrix.repeatedMultiply(x, stepBound);
+    } else {
+        // Translate the symbolic matrix to its explicit representations.
+        storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+        conversionWatch.stop();
+        STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-    // Perform the matrix-vector multiplication.
-    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
-    multiplier->repeatedMultiply(env, x, nullptr, stepBound);
+        // Perform the matrix-vector multiplication.
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
+        multiplier->repeatedMultiply(env, x, nullptr, stepBound);
+    }
 
     // Return a hybrid check result that stores the numerical values explicitly.
     return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(
@@ -250,15 +267,23 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeCu
     // Create the ODD for the translation between symbolic and explicit storage.
     storm::dd::Odd odd = model.getReachableStates().createOdd();
 
-    // Translate the symbolic matrix/vector to their explicit representations.
-    storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
-    std::vector<ValueType> b = totalRewardVector.toVector(odd);
-    conversionWatch.stop();
-    STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+    uint64_t blockSize = env.modelchecker().getHybridBlockSize();
+    if (blockSize > 0 && blockSize < x.size()) {
+        // Convert the matrix block-wise in every multiplication to avoid storing its explicit representation.
+        conversionWatch.stop();
+        storm::dd::BlockedMatrix<DdType, ValueType> blockedMatrix(transitionMatrix, model.getRowVariables(), {}, odd, odd, blockSize, totalRewardVector);
+        blockedMatrix.repeatedMultiply(x, stepBound);
+    } else {
+        // Translate the symbolic matrix/vector to their explicit representations.
+        storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+        std::vector<ValueType> b = totalRewardVector.toVector(odd);
+        conversionWatch.stop();
+        STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-    // Perform the matrix-vector multiplication.
-    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
-    multiplier->repeatedMultiply(env, x, &b, stepBound);
+        // Perform the matrix-vector multiplication.
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
+        multiplier->repeatedMultiply(env, x, &b, stepBound);
+    }
 
     // Return a hybrid check result that stores the numerical values explicitly.
     return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(
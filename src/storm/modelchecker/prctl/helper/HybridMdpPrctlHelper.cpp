@@ -5,6 +5,7 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/BlockedMatrix.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Odd.h"
 
@@ -23,6 +24,7 @@
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/utility/Stopwatch.h"
 
 #include "storm/exceptions/InvalidPropertyException.h"
@@ -357,15 +359,23 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeBou
         // Create the solution vector.
         std::vector<ValueType> x(maybeStates.getNonZeroCount(), storm::utility::zero<ValueType>());
 
-        // Translate the symbolic matrix/vector to their explicit representations.
-        conversionWatch.start();
-        std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation =
-            submatrix.toMatrixVector(subvector, model.getNondeterminismVariables(), odd, odd);
-        conversionWatch.stop();
-        STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+        uint64_t blockSize = env.modelchecker().getHybridBlockSize();
+        if (blockSize > 0 && blockSize < x.size()) {
+            // Convert the matrix block-wise in every multiplication to avoid storing its explicit representation.
+            storm::dd::BlockedMatrix<DdType, ValueType> blockedSubmatrix(submatrix, model.getRowVariables(), model.getNondeterminismVariables(), odd, odd,
+                                                                         blockSize, subvector);
+            blockedSubmatrix.repeatedMultiply(x, stepBound, dir);
+        } else {
+            // Translate the symbolic matrix/vector to their explicit representations.
+            conversionWatch.start();
+            std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation =
+                submatrix.toMatrixVector(subvector, model.getNondeterminismVariables(), odd, odd);
+            conversionWatch.stop();
+            STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitRepresentation.first);
-        multiplier->repeatedMultiplyAndReduce(env, dir, x, &explicitRepresentation.second, stepBound);
+            auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitRepresentation.first);
+            multiplier->repeatedMultiplyAndReduce(env, dir, x, &explicitRepresentation.second, stepBound);
+        }
 
         // Return a hybrid check result that stores the numerical values explicitly.
         return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(
@@ -389,17 +399,26 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeIns
     // Create the ODD for the translation between symbolic and explicit storage.
     storm::dd::Odd odd = model.getReachableStates().createOdd();
 
-    // Translate the symbolic matrix to its explicit representations.
-    storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
-
     // Create the solution vector (and initialize it to the state rewards of the model).
     std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
-    conversionWatch.stop();
-    STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-    // Perform the matrix-vector multiplication.
-    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
-    multiplier->repeatedMultiplyAndReduce(env, dir, x, nullptr, stepBound);
+    uint64_t blockSize = env.modelchecker().getHybridBlockSize();
+    if (blockSize > 0 && blockSize < x.size()) {
+        // Convert the matrix block-wise in every multiplication to avoid storing its explicit representation.
+        storm::dd::BlockedMatrix<DdType, ValueType> blockedMatrix(transitionMatrix, model.getRowVariables(), model.getNondeterminismVariables(), odd, odd,
+                                                                  blockSize);
+        blockedMatrix.repeatedMultiply(x, stepBound, dir);
+    } else {
+        // Translate the symbolic matrix to its explicit representations.
+        conversionWatch.start();
+        storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
+        conversionWatch.stop();
+        STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+
+        // Perform the matrix-vector multiplication.
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
+        multiplier->repeatedMultiplyAndReduce(env, dir, x, nullptr, stepBound);
+    }
 
     // Return a hybrid check result that stores the numerical values explicitly.
     return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(
@@ -424,15 +443,24 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeCum
     // Create the ODD for the translation between symbolic and explicit storage.
     storm::dd::Odd odd = model.getReachableStates().createOdd();
 
-    // Translate the symbolic matrix/vector to their explicit representations.
-    std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation =
-        transitionMatrix.toMatrixVector(totalRewardVector, model.getNondeterminismVariables(), odd, odd);
-    conversionWatch.stop();
-    STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+    uint64_t blockSize = env.modelchecker().getHybridBlockSize();
+    if (blockSize > 0 && blockSize < x.size()) {
+        // Convert the matrix block-wise in every multiplication to avoid storing its explicit representation.
+        conversionWatch.stop();
+        storm::dd::BlockedMatrix<DdType, ValueType> blockedMatrix(transitionMatrix, model.getRowVariables(), model.getNondeterminismVariables(), odd, odd,
+                                                                  blockSize, totalRewardVector);
+        blockedMatrix.repeatedMultiply(x, stepBound, dir);
+    } else {
+        // Translate the symbolic matrix/vector to their explicit representations.
+        std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation =
+            transitionMatrix.toMatrixVector(totalRewardVector, model.getNondeterminismVariables(), odd, odd);
+        conversionWatch.stop();
+        STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-    // Perform the matrix-vector multiplication.
-    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitRepresentation.first);
-    multiplier->repeatedMultiplyAndReduce(env, dir, x, &explicitRepresentation.second, stepBound);
+        // Perform the matrix-vector multiplication.
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitRepresentation.first);
+        multiplier->repeatedMultiplyAndReduce(env, dir, x, &explicitRepresentation.second, stepBound);
+    }
 
     // Return a hybrid check result that stores the numerical values explicitly.
     return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(
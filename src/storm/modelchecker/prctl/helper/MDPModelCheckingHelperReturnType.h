@@ -2,6 +2,7 @@
 #define MDPMODELCHECKINGHELPERRETURNTYPE_H
 
 #include <memory>
+#include <optional>
 #include <vector>
 #include "storm/storage/Scheduler.h"
 
@@ -31,6 +32,9 @@ struct MDPSparseModelCheckingHelperReturnType {
 
     // A scheduler, if it was computed.
     std::unique_ptr<storm::storage::Scheduler<ValueType>> scheduler;
+
+    // Sound lower and upper bounds on the values, if the computation was aborted before the values converged.
+    std::optional<std::pair<std::vector<ValueType>, std::vector<ValueType>>> bounds;
 };
 }  // namespace helper
 
@@ -0,0 +1,119 @@
+#include "storm/modelchecker/prctl/helper/PartialBisimulationDtmcPrctlHelper.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/dd/BisimulationDecomposition.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+namespace {
+
+template<typename ValueType>
+std::unique_ptr<CheckResult> checkOnInitialStates(storm::models::sparse::Model<ValueType> const& quotient,
+                                                  CheckTask<storm::logic::Formula, ValueType> const& task, Environment const& env) {
+    std::unique_ptr<CheckResult> result;
+    if (quotient.getType() == storm::models::ModelType::Dtmc) {
+        result = SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ValueType>>(*quotient.template as<storm::models::sparse::Dtmc<ValueType>>())
+                     .check(env, task);
+    } else {
+        result = SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>>(*quotient.template as<storm::models::sparse::Mdp<ValueType>>())
+                     .check(env, task);
+    }
+    result->filter(ExplicitQualitativeCheckResult(quotient.getInitialStates()));
+    return result;
+}
+
+}  // namespace
+
+template<storm::dd::DdType DdType, typename ValueType>
+std::unique_ptr<CheckResult> PartialBisimulationDtmcPrctlHelper<DdType, ValueType>::compute(
+    Environment const& env, storm::models::symbolic::Dtmc<DdType, ValueType> const& model, CheckTask<storm::logic::Formula, ValueType> const& checkTask,
+    std::chrono::milliseconds const& roundTimeLimit, uint64_t nodeLimit) {
+    storm::logic::Formula const& formula = checkTask.getFormula();
+    STORM_LOG_THROW((formula.isProbabilityOperatorFormula() || formula.isRewardOperatorFormula()) && formula.asOperatorFormula().hasQuantitativeResult(),
+                    storm::exceptions::NotSupportedException, "Partial bisimulation is only supported for quantitative probability and reward queries.");
+
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+    bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+    CheckTask<storm::logic::Formula, ValueType> quotientTask = checkTask.substituteFormula(formula);
+    quotientTask.setOnlyInitialStatesRelevant(true);
+
+    std::unique_ptr<CheckResult> result;
+    model.getManager().execute([&]() {
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {formula.asSharedPointer()};
+        storm::dd::BisimulationDecomposition<DdType, ValueType> decomposition(model, formulas, storm::storage::BisimulationType::Strong);
+        uint64_t round = 0;
+        while (!decomposition.compute(roundTimeLimit, nodeLimit)) {
+            ++round;
+            auto quotient = decomposition.getQuotient(storm::dd::bisimulation::QuotientFormat::Sparse)->template as<storm::models::sparse::Model<ValueType>>();
+
+            // The partial quotient is an MDP whose choices mimic the states of a block, so its extremal values bound the values of these states.
+            CheckTask<storm::logic::Formula, ValueType> boundTask(quotientTask);
+            boundTask.setOptimizationDirection(storm::OptimizationDirection::Minimize);
+            auto lowerBounds = checkOnInitialStates(*quotient, boundTask, env);
+            boundTask.setOptimizationDirection(storm::OptimizationDirection::Maximize);
+            auto upperBounds = checkOnInitialStates(*quotient, boundTask, env);
+
+            auto const& lowerValues = lowerBounds->template asExplicitQuantitativeCheckResult<ValueType>();
+            auto const& upperValues = upperBounds->template asExplicitQuantitativeCheckResult<ValueType>();
+            bool boundsMet = true;
+            ValueType maximalDifference = storm::utility::zero<ValueType>();
+            typename ExplicitQuantitativeCheckResult<ValueType>::map_type centers;
+            for (auto state : quotient->getInitialStates()) {
+                ValueType const& lower = lowerValues[state];
+                ValueType const& upper = upperValues[state];
+                if (storm::utility::isInfinity(upper)) {
+                    boundsMet &= storm::utility::isInfinity(lower);
+                    centers[state] = upper;
+                    continue;
+                }
+                ValueType difference = upper - lower;
+                maximalDifference = std::max(maximalDifference, difference);
+                boundsMet &= difference <= (relative ? precision * upper : precision);
+                centers[state] = (lower + upper) / storm::utility::convertNumber<ValueType>(2);
+            }
+            STORM_LOG_INFO("Bounds after " << round << " refinement round(s) on " << quotient->getNumberOfStates() << " blocks differ by at most "
+                                           << maximalDifference << ".");
+            if (boundsMet) {
+                STORM_LOG_INFO("Bounds are sufficiently close, skipping the remaining refinement.");
+                result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::move(centers));
+                return;
+            }
+        }
+
+        auto quotient = decomposition.getQuotient(storm::dd::bisimulation::QuotientFormat::Sparse)->template as<storm::models::sparse::Model<ValueType>>();
+        result = checkOnInitialStates(*quotient, quotientTask, env);
+    });
+    return result;
+}
+
+template class PartialBisimulationDtmcPrctlHelper<storm::dd::DdType::CUDD, double>;
+template class PartialBisimulationDtmcPrctlHelper<storm::dd::DdType::Sylvan, double>;
+
+#ifdef STORM_HAVE_CARL
+template class PartialBisimulationDtmcPrctlHelper<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+#endif
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+
+#include "storm/modelchecker/CheckTask.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/storage/dd/DdType.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+
+class CheckResult;
+
+namespace helper {
+
+/*!
+ * Checks properties of symbolic DTMCs on (partial) bisimulation quotients that are extracted in the sparse format. The partition is refined in rounds
+ * with a limited budget. After each round that does not reach a fixpoint, the partial quotient is checked for minimal and maximal values, which are lower
+ * and upper bounds on the values of the original model. If these bounds are sufficiently close for all initial states, the remaining refinement steps
+ * (which often dominate the time of the bisimulation) are skipped.
+ */
+template<storm::dd::DdType DdType, typename ValueType>
+class PartialBisimulationDtmcPrctlHelper {
+   public:
+    /*!
+     * Computes the values of the initial states for the given probability or reward operator formula.
+     *
+     * @param roundTimeLimit The time after which a refinement round ends and the bounds of the partial quotient are computed.
+     * @param nodeLimit If non-zero, a refinement round also ends once the DD representing the partition has more nodes.
+     * @return The result for the initial states of the (partial) quotient. If the partition is not yet stable, the values are the centers of the computed
+     *         bounds, whose difference does not exceed the precision of the minmax solver environment.
+     */
+    static std::unique_ptr<CheckResult> compute(Environment const& env, storm::models::symbolic::Dtmc<DdType, ValueType> const& model,
+                                                CheckTask<storm::logic::Formula, ValueType> const& checkTask, std::chrono::milliseconds const& roundTimeLimit,
+                                                uint64_t nodeLimit = 0);
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
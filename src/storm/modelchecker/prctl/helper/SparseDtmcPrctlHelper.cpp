@@ -1,5 +1,7 @@
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
+#include <mutex>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
@@ -9,23 +11,26 @@
 
 #include "storm/storage/ConsecutiveUint64DynamicPriorityQueue.h"
 #include "storm/storage/DynamicPriorityQueue.h"
+#include "storm/storage/QualitativeAnalysisCache.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/prctl/helper/ConditionalAlgorithm.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/IOSettings.h"
-#include "storm/settings/modules/ModelCheckerSettings.h"
 
 #include "storm/io/export.h"
 #include "storm/utility/ProgressMeasurement.h"
@@ -59,6 +64,7 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     storm::utility::Stopwatch swAll(true), swBuild, swCheck;
 
     storm::modelchecker::helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true> rewardUnfolding(model, rewardBoundedFormula);
+    rewardUnfolding.setMemoryLimitForEpochSolutions(env.modelchecker().getEpochSolutionMemoryLimit());
 
     // Get lower and upper bounds for the solution.
     auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
@@ -88,28 +94,48 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
+    // The cdf export needs the solutions of all epochs, which are only available when the epochs are analyzed sequentially.
+    uint64_t numberOfThreads =
+        storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() ? 1 : env.modelchecker().getNumberOfEpochThreads();
+    if (numberOfThreads > 1) {
+        // Each thread uses its own vectors and solver.
+        std::vector<std::vector<ValueType>> threadX(numberOfThreads), threadB(numberOfThreads);
+        std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> threadSolvers(numberOfThreads);
+        std::mutex progressMutex;
         swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
+        rewardUnfolding.analyzeEpochs(epochOrder, numberOfThreads, [&](uint64_t threadIndex, auto& epochModel) {
+            auto solution = epochModel.analyzeSingleObjective(preciseEnv, threadX[threadIndex], threadB[threadIndex], threadSolvers[threadIndex],
+                                                                      lowerBound, upperBound);
+            std::lock_guard<std::mutex> lock(progressMutex);
+            ++numCheckedEpochs;
+            progress.updateProgress(numCheckedEpochs);
+            return solution;
+        });
         swCheck.stop();
-        if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
-            !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
-            std::vector<ValueType> cdfEntry;
-            for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
-                uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
-                cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
-                                   rewardUnfolding.getDimension(i).scalingFactor);
+    } else {
+        for (auto const& epoch : epochOrder) {
+            swBuild.start();
+            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+            swBuild.stop();
+            swCheck.start();
+            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
+            swCheck.stop();
+            if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
+                !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
+                std::vector<ValueType> cdfEntry;
+                for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
+                    uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
+                    cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
+                                       rewardUnfolding.getDimension(i).scalingFactor);
+                }
+                cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
+                cdfData.push_back(std::move(cdfEntry));
+            }
+            ++numCheckedEpochs;
+            progress.updateProgress(numCheckedEpochs);
+            if (storm::utility::resources::isTerminate()) {
+                break;
             }
-            cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-            cdfData.push_back(std::move(cdfEntry));
-        }
-        ++numCheckedEpochs;
-        progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
         }
     }
 
@@ -148,7 +174,7 @@ template<typename ValueType, typename RewardModelType>
 std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-    bool qualitative, ModelCheckerHint const& hint) {
+    bool qualitative, ModelCheckerHint const& hint, storm::storage::QualitativeAnalysisCache* qualitativeAnalysisCache) {
     std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
 
     // We need to identify the maybe states (states which have a probability for satisfying the until formula
@@ -176,8 +202,11 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
                                          << " states remaining).");
     } else {
         // Get all states that have probability 0 and 1 of satisfying the until-formula.
+        auto computeProb01 = [&]() { return storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates); };
         std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-            storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+            qualitativeAnalysisCache ? qualitativeAnalysisCache->getOrCompute(storm::storage::QualitativeAnalysisCache::AnalysisType::Prob01, phiStates,
+                                                                              psiStates, computeProb01)
+                                     : computeProb01();
         storm::storage::BitVector statesWithProbability0 = std::move(statesWithProbability01.first);
         statesWithProbability1 = std::move(statesWithProbability01.second);
         maybeStates = ~(statesWithProbability0 | statesWithProbability1);
@@ -423,8 +452,8 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
 // This function computes an upper bound on the reachability rewards (see Baier et al, CAV'17).
 template<typename ValueType>
 std::vector<ValueType> computeUpperRewardBounds(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards,
-                                                std::vector<ValueType> const& oneStepTargetProbabilities) {
-    DsMpiDtmcUpperRewardBoundsComputer<ValueType> dsmpi(transitionMatrix, rewards, oneStepTargetProbabilities);
+                                                std::vector<ValueType> const& oneStepTargetProbabilities, uint64_t numberOfThreads) {
+    DsMpiSccUpperRewardBoundsComputer<ValueType> dsmpi(transitionMatrix, rewards, oneStepTargetProbabilities, numberOfThreads);
     std::vector<ValueType> bounds = dsmpi.computeUpperBounds();
     return bounds;
 }
@@ -432,7 +461,8 @@ std::vector<ValueType> computeUpperRewardBounds(storm::storage::SparseMatrix<Val
 template<>
 std::vector<storm::RationalFunction> computeUpperRewardBounds(storm::storage::SparseMatrix<storm::RationalFunction> const& /*transitionMatrix*/,
                                                               std::vector<storm::RationalFunction> const& /*rewards*/,
-                                                              std::vector<storm::RationalFunction> const& /*oneStepTargetProbabilities*/) {
+                                                              std::vector<storm::RationalFunction> const& /*oneStepTargetProbabilities*/,
+                                                              uint64_t /*numberOfThreads*/) {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Computing upper reward bounds is not supported for rational functions.");
 }
 
@@ -448,7 +478,7 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
 
     // Determine which states have reward zero
     storm::storage::BitVector rew0States;
-    if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isFilterRewZeroSet()) {
+    if (env.modelchecker().isFilterRewZeroSet()) {
         rew0States = storm::utility::graph::performProb1(backwardTransitions, zeroRewardStatesGetter(), targetStates);
     } else {
         rew0States = targetStates;
@@ -509,7 +539,8 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
             boost::optional<std::vector<ValueType>> upperRewardBounds;
             requirements.clearLowerBounds();
             if (requirements.upperBounds()) {
-                upperRewardBounds = computeUpperRewardBounds(submatrix, b, transitionMatrix.getConstrainedRowSumVector(maybeStates, rew0States));
+                upperRewardBounds = computeUpperRewardBounds(submatrix, b, transitionMatrix.getConstrainedRowSumVector(maybeStates, rew0States),
+                                                             env.solver().getNumberOfThreads());
                 requirements.clearUpperBounds();
             }
             STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
@@ -686,11 +717,90 @@ storm::storage::BitVector SparseDtmcPrctlHelper<ValueType, RewardModelType>::Bai
     return result;
 }
 
+/*!
+ * Computes the conditional probabilities P(F target | F condition) as the quotient of the numerator P(F target & F condition) and the denominator
+ * P(F condition). The qualitative analysis is shared between both and the systems are solved by a single value iteration on the original matrix
+ * that multiplies a block of three interleaved vectors: the denominator, the probabilities to reach a target state and the numerator. The latter
+ * is fixed to the target probability on condition states and to the denominator on target states, so the iteration needs no transformed model.
+ */
+template<typename ValueType>
+std::vector<ValueType> computeConditionalProbabilitiesJoint(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                            storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                            storm::storage::BitVector const& targetStates, storm::storage::BitVector const& conditionStates) {
+    uint64_t const numberOfStates = transitionMatrix.getRowCount();
+    storm::storage::BitVector allStates(numberOfStates, true);
+    storm::storage::BitVector conditionReachable = storm::utility::graph::performProbGreater0(backwardTransitions, allStates, conditionStates);
+    storm::storage::BitVector targetReachable = storm::utility::graph::performProbGreater0(backwardTransitions, allStates, targetStates);
+    storm::storage::BitVector bothReachable = storm::utility::graph::performProbGreater0(
+        backwardTransitions, allStates, (conditionStates & targetReachable) | (targetStates & conditionReachable));
+    STORM_LOG_DEBUG("Numerator of conditional probabilities is positive in " << bothReachable.getNumberOfSetBits() << " and denominator in "
+                                                                             << conditionReachable.getNumberOfSetBits() << " states.");
+
+    uint64_t const blockSize = 3;
+    auto fixValues = [&](std::vector<ValueType>& block) {
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            ValueType* values = block.data() + state * blockSize;
+            if (conditionStates.get(state)) {
+                values[0] = storm::utility::one<ValueType>();
+            } else if (!conditionReachable.get(state)) {
+                values[0] = storm::utility::zero<ValueType>();
+            }
+            if (targetStates.get(state)) {
+                values[1] = storm::utility::one<ValueType>();
+            } else if (!targetReachable.get(state)) {
+                values[1] = storm::utility::zero<ValueType>();
+            }
+            if (!bothReachable.get(state)) {
+                values[2] = storm::utility::zero<ValueType>();
+            } else if (conditionStates.get(state)) {
+                values[2] = values[1];
+            } else if (targetStates.get(state)) {
+                values[2] = values[0];
+            }
+        }
+    };
+
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, transitionMatrix);
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+    bool relative = env.solver().native().getRelativeTerminationCriterion();
+    uint64_t maxIterations = env.solver().native().getMaximalNumberOfIterations();
+    std::vector<ValueType> x(blockSize * numberOfStates, storm::utility::zero<ValueType>());
+    std::vector<ValueType> next(x.size());
+    fixValues(x);
+    bool converged = false;
+    uint64_t iterations = 0;
+    while (!converged && iterations < maxIterations && !storm::utility::resources::isTerminate()) {
+        multiplier->multiplyBlock(env, blockSize, x, nullptr, next);
+        fixValues(next);
+        converged = storm::utility::vector::equalModuloPrecision(x, next, precision, relative);
+        std::swap(x, next);
+        ++iterations;
+    }
+    STORM_LOG_WARN_COND(converged, "Iterative computation of conditional probabilities did not converge within " << iterations << " iterations.");
+    STORM_LOG_INFO("Computed conditional probabilities in " << iterations << " iterations.");
+
+    std::vector<ValueType> result(numberOfStates, storm::utility::infinity<ValueType>());
+    for (auto state : conditionReachable) {
+        result[state] = x[state * blockSize + 2] / x[state * blockSize];
+    }
+    return result;
+}
+
 template<typename ValueType, typename RewardModelType>
 std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeConditionalProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates,
     storm::storage::BitVector const& conditionStates, bool qualitative) {
+    if (env.modelchecker().getConditionalAlgorithm() == ConditionalAlgorithm::Joint) {
+        if constexpr (std::is_same_v<ValueType, double>) {
+            if (!conditionStates.empty()) {
+                return computeConditionalProbabilitiesJoint(env, transitionMatrix, backwardTransitions, targetStates, conditionStates);
+            }
+        } else {
+            STORM_LOG_WARN("Computing conditional probabilities jointly is only supported for floating point models. Falling back to the transformation.");
+        }
+    }
+
     // Prepare result vector.
     std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::infinity<ValueType>());
 
@@ -19,6 +19,10 @@
 namespace storm {
 class Environment;
 
+namespace storage {
+class QualitativeAnalysisCache;
+}
+
 namespace modelchecker {
 class CheckResult;
 
@@ -37,7 +41,8 @@ class SparseDtmcPrctlHelper {
                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                             storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                            bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint());
+                                                            bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint(),
+                                                            storm::storage::QualitativeAnalysisCache* qualitativeAnalysisCache = nullptr);
 
     static std::vector<ValueType> computeAllUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
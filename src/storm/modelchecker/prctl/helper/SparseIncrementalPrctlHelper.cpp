@@ -0,0 +1,298 @@
+#include "storm/modelchecker/prctl/helper/SparseIncrementalPrctlHelper.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+template<typename ValueType, bool Nondeterministic>
+SparseIncrementalPrctlHelper<ValueType, Nondeterministic>::SparseIncrementalPrctlHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix)
+    : transitionMatrix(&transitionMatrix), backwardTransitions(transitionMatrix.transpose(true)), numberOfRecomputedStates(0) {
+    STORM_LOG_ASSERT(Nondeterministic || transitionMatrix.hasTrivialRowGrouping(), "Expected a deterministic model.");
+}
+
+template<typename ValueType, bool Nondeterministic>
+void SparseIncrementalPrctlHelper<ValueType, Nondeterministic>::updateTransitionMatrix(storm::storage::SparseMatrix<ValueType> const& newTransitionMatrix,
+                                                                                       storm::storage::BitVector const& changedStates) {
+    STORM_LOG_THROW(newTransitionMatrix.getRowGroupCount() == transitionMatrix->getRowGroupCount() &&
+                        changedStates.size() == newTransitionMatrix.getRowGroupCount(),
+                    storm::exceptions::InvalidArgumentException, "The modified model has to preserve the state space.");
+    STORM_LOG_ASSERT(Nondeterministic || newTransitionMatrix.hasTrivialRowGrouping(), "Expected a deterministic model.");
+    transitionMatrix = &newTransitionMatrix;
+    if (!changedStates.empty()) {
+        backwardTransitions = newTransitionMatrix.transpose(true);
+        for (auto& cachedResult : cachedResults) {
+            cachedResult.changedStates |= changedStates;
+        }
+    }
+}
+
+template<typename ValueType, bool Nondeterministic>
+std::vector<ValueType> SparseIncrementalPrctlHelper<ValueType, Nondeterministic>::computeUntilProbabilities(Environment const& env,
+                                                                                                            storm::solver::SolveGoal<ValueType>&& goal,
+                                                                                                            storm::storage::BitVector const& phiStates,
+                                                                                                            storm::storage::BitVector const& psiStates) {
+    CachedResult query;
+    query.type = QueryType::UntilProbabilities;
+    query.minimize = Nondeterministic && goal.minimize();
+    query.phiStates = phiStates;
+    query.psiStates = psiStates;
+    return compute(env, goal, std::move(query));
+}
+
+template<typename ValueType, bool Nondeterministic>
+std::vector<ValueType> SparseIncrementalPrctlHelper<ValueType, Nondeterministic>::computeReachabilityRewards(Environment const& env,
+                                                                                                             storm::solver::SolveGoal<ValueType>&& goal,
+                                                                                                             std::vector<ValueType> const& choiceRewards,
+                                                                                                             storm::storage::BitVector const& targetStates) {
+    STORM_LOG_ASSERT(choiceRewards.size() == transitionMatrix->getRowCount(), "Dimension mismatch.");
+    CachedResult query;
+    query.type = QueryType::ReachabilityRewards;
+    query.minimize = Nondeterministic && goal.minimize();
+    query.psiStates = targetStates;
+    query.choiceRewards = choiceRewards;
+    query.rowGroupIndices = transitionMatrix->getRowGroupIndices();
+    return compute(env, goal, std::move(query));
+}
+
+template<typename ValueType, bool Nondeterministic>
+uint64_t SparseIncrementalPrctlHelper<ValueType, Nondeterministic>::getNumberOfRecomputedStates() const {
+    return numberOfRecomputedStates;
+}
+
+template<typename ValueType, bool Nondeterministic>
+void SparseIncrementalPrctlHelper<ValueType, Nondeterministic>::clearCache() {
+    cachedResults.clear();
+}
+
+template<typename ValueType, bool Nondeterministic>
+typename SparseIncrementalPrctlHelper<ValueType, Nondeterministic>::CachedResult* SparseIncrementalPrctlHelper<ValueType, Nondeterministic>::findCachedResult(
+    QueryType type, bool minimize) {
+    for (auto& cachedResult : cachedResults) {
+        if (cachedResult.type == type && cachedResult.minimize == minimize) {
+            return &cachedResult;
+        }
+    }
+    return nullptr;
+}
+
+template<typename ValueType, bool Nondeterministic>
+storm::storage::BitVector SparseIncrementalPrctlHelper<ValueType, Nondeterministic>::getFixedStates(CachedResult const& query) const {
+    if (query.type == QueryType::UntilProbabilities) {
+        // psi states have value one and states that are neither phi nor psi states have value zero.
+        return query.psiStates | ~query.phiStates;
+    }
+    // Target states have reward zero.
+    return query.psiStates;
+}
+
+template<typename ValueType, bool Nondeterministic>
+storm::storage::BitVector SparseIncrementalPrctlHelper<ValueType, Nondeterministic>::computeAffectedStates(
+    CachedResult const& query, storm::storage::BitVector const& changedStates) const {
+    // The value of a changed state might change even if it does not depend on its successors, so the search also starts at the predecessors of the
+    // changed states whose values depend on their successors.
+    storm::storage::BitVector const propagatingStates = ~getFixedStates(query);
+    storm::storage::BitVector initialStates = changedStates;
+    for (auto state : changedStates) {
+        for (auto const& entry : backwardTransitions.getRow(state)) {
+            if (propagatingStates.get(entry.getColumn())) {
+                initialStates.set(entry.getColumn(), true);
+            }
+        }
+    }
+    return storm::utility::graph::getReachableStates(backwardTransitions, initialStates, propagatingStates,
+                                                     storm::storage::BitVector(changedStates.size(), false));
+}
+
+template<typename ValueType, bool Nondeterministic>
+std::vector<ValueType> SparseIncrementalPrctlHelper<ValueType, Nondeterministic>::compute(Environment const& env,
+                                                                                          storm::solver::SolveGoal<ValueType> const& goal,
+                                                                                          CachedResult&& query) {
+    uint64_t const numberOfStates = transitionMatrix->getRowGroupCount();
+    STORM_LOG_ASSERT(query.psiStates.size() == numberOfStates, "Dimension mismatch.");
+    query.changedStates = storm::storage::BitVector(numberOfStates, false);
+    CachedResult* cachedResult = findCachedResult(query.type, query.minimize);
+    if (!cachedResult) {
+        STORM_LOG_INFO("Computing the values of all " << numberOfStates << " states as no previous result is available.");
+        query.values = solve(env, goal, query, *transitionMatrix, query.phiStates, query.psiStates, query.choiceRewards, nullptr);
+        numberOfRecomputedStates = numberOfStates;
+        cachedResults.push_back(std::move(query));
+        return cachedResults.back().values;
+    }
+
+    // States with a different role in the query count as changed.
+    storm::storage::BitVector changedStates = cachedResult->changedStates;
+    changedStates |= (query.psiStates ^ cachedResult->psiStates);
+    if (query.type == QueryType::UntilProbabilities) {
+        changedStates |= (query.phiStates ^ cachedResult->phiStates);
+    } else {
+        // The rows of unchanged states are unchanged, but their indices shift if the number of rows of a preceding state changed.
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (!changedStates.get(state)) {
+                uint64_t const oldRow = cachedResult->rowGroupIndices[state];
+                if (!std::equal(query.choiceRewards.begin() + query.rowGroupIndices[state], query.choiceRewards.begin() + query.rowGroupIndices[state + 1],
+                                cachedResult->choiceRewards.begin() + oldRow)) {
+                    changedStates.set(state, true);
+                }
+            }
+        }
+    }
+
+    storm::storage::BitVector const affectedStates = computeAffectedStates(query, changedStates);
+    query.values = std::move(cachedResult->values);
+    numberOfRecomputedStates = affectedStates.getNumberOfSetBits();
+    STORM_LOG_INFO("Recomputing the values of " << numberOfRecomputedStates << " of " << numberOfStates << " states affected by "
+                                                << changedStates.getNumberOfSetBits() << " changed states.");
+    if (numberOfRecomputedStates > 0) {
+        // Build the submodel of the affected states. Transitions to a state with a fixed value v are redirected to the goal and the sink state: for
+        // probabilities with probability v and 1-v, respectively. For rewards, the value is collected as reward when going to the goal state or,
+        // if the value is infinite, the sink state is entered.
+        bool const isRewardQuery = query.type == QueryType::ReachabilityRewards;
+        uint64_t const goalState = numberOfRecomputedStates;
+        uint64_t const sinkState = numberOfRecomputedStates + 1;
+        std::vector<uint64_t> const localIndices = affectedStates.getNumberOfSetBitsBeforeIndices();
+        auto const& rowGroupIndices = transitionMatrix->getRowGroupIndices();
+        uint64_t numberOfRows = 2;
+        for (auto state : affectedStates) {
+            numberOfRows += rowGroupIndices[state + 1] - rowGroupIndices[state];
+        }
+        storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfRows, numberOfRecomputedStates + 2, 0, true, Nondeterministic,
+                                                               Nondeterministic ? numberOfRecomputedStates + 2 : 0);
+        std::vector<ValueType> subRewards;
+        if (isRewardQuery) {
+            subRewards.reserve(numberOfRows);
+        }
+        uint64_t localRow = 0;
+        for (auto state : affectedStates) {
+            if (Nondeterministic) {
+                builder.newRowGroup(localRow);
+            }
+            for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row, ++localRow) {
+                ValueType toGoal = storm::utility::zero<ValueType>();
+                ValueType toSink = storm::utility::zero<ValueType>();
+                ValueType reward = isRewardQuery ? query.choiceRewards[row] : storm::utility::zero<ValueType>();
+                for (auto const& entry : transitionMatrix->getRow(row)) {
+                    if (affectedStates.get(entry.getColumn())) {
+                        builder.addNextValue(localRow, localIndices[entry.getColumn()], entry.getValue());
+                        continue;
+                    }
+                    ValueType const& value = query.values[entry.getColumn()];
+                    if (!isRewardQuery) {
+                        toGoal += entry.getValue() * value;
+                        toSink += entry.getValue() * (storm::utility::one<ValueType>() - value);
+                    } else if (storm::utility::isInfinity(value)) {
+                        toSink += entry.getValue();
+                    } else {
+                        toGoal += entry.getValue();
+                        reward += entry.getValue() * value;
+                    }
+                }
+                if (!storm::utility::isZero(toGoal)) {
+                    builder.addNextValue(localRow, goalState, toGoal);
+                }
+                if (!storm::utility::isZero(toSink)) {
+                    builder.addNextValue(localRow, sinkState, toSink);
+                }
+                if (isRewardQuery) {
+                    subRewards.push_back(std::move(reward));
+                }
+            }
+        }
+        for (auto absorbingState : {goalState, sinkState}) {
+            if (Nondeterministic) {
+                builder.newRowGroup(localRow);
+            }
+            builder.addNextValue(localRow, absorbingState, storm::utility::one<ValueType>());
+            if (isRewardQuery) {
+                subRewards.push_back(storm::utility::zero<ValueType>());
+            }
+            ++localRow;
+        }
+        storm::storage::SparseMatrix<ValueType> subMatrix = builder.build();
+
+        storm::storage::BitVector subPhiStates;
+        if (!isRewardQuery) {
+            subPhiStates = query.phiStates % affectedStates;
+            subPhiStates.resize(numberOfRecomputedStates + 2, false);
+        }
+        storm::storage::BitVector subPsiStates = query.psiStates % affectedStates;
+        subPsiStates.resize(numberOfRecomputedStates + 2, false);
+        subPsiStates.set(goalState, true);
+
+        // The previous values of the affected states serve as initial guess (the values of the goal and the sink state are never used).
+        std::vector<ValueType> initialValues = storm::utility::vector::filterVector(query.values, affectedStates);
+        initialValues.resize(numberOfRecomputedStates + 2, storm::utility::zero<ValueType>());
+        bool const useInitialValues =
+            std::none_of(initialValues.begin(), initialValues.end(), [](ValueType const& value) { return storm::utility::isInfinity(value); });
+
+        std::vector<ValueType> subValues =
+            solve(env, goal, query, subMatrix, subPhiStates, subPsiStates, subRewards, useInitialValues ? &initialValues : nullptr);
+        storm::utility::vector::setVectorValues(query.values, affectedStates, subValues);
+    }
+    *cachedResult = std::move(query);
+    return cachedResult->values;
+}
+
+template<typename ValueType, bool Nondeterministic>
+std::vector<ValueType> SparseIncrementalPrctlHelper<ValueType, Nondeterministic>::solve(
+    Environment const& env, storm::solver::SolveGoal<ValueType> const& goal, CachedResult const& query, storm::storage::SparseMatrix<ValueType> const& matrix,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& choiceRewards,
+    std::vector<ValueType> const* initialValues) const {
+    // The values of all states are needed for subsequent computations, so neither relevant values nor bounds of the given goal are considered.
+    storm::solver::SolveGoal<ValueType> solveGoal =
+        Nondeterministic ? storm::solver::SolveGoal<ValueType>(goal.direction()) : storm::solver::SolveGoal<ValueType>();
+    ExplicitModelCheckerHint<ValueType> hint;
+    if (initialValues) {
+        hint.setResultHint(*initialValues);
+    }
+    bool const isCompleteModel = &matrix == transitionMatrix;
+    storm::storage::SparseMatrix<ValueType> subBackwardTransitions;
+    if (!isCompleteModel) {
+        subBackwardTransitions = matrix.transpose(true);
+    }
+    storm::storage::SparseMatrix<ValueType> const& backward = isCompleteModel ? backwardTransitions : subBackwardTransitions;
+
+    if (query.type == QueryType::UntilProbabilities) {
+        if constexpr (Nondeterministic) {
+            return SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(env, std::move(solveGoal), matrix, backward, phiStates, psiStates, false, false,
+                                                                              hint)
+                .values;
+        } else {
+            return SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(env, std::move(solveGoal), matrix, backward, phiStates, psiStates, false, hint);
+        }
+    } else {
+        if constexpr (Nondeterministic) {
+            storm::models::sparse::StandardRewardModel<ValueType> rewardModel(std::nullopt, choiceRewards);
+            return SparseMdpPrctlHelper<ValueType>::computeReachabilityRewards(env, std::move(solveGoal), matrix, backward, rewardModel, psiStates, false,
+                                                                               false, hint)
+                .values;
+        } else {
+            return SparseDtmcPrctlHelper<ValueType>::computeReachabilityRewards(env, std::move(solveGoal), matrix, backward, choiceRewards, psiStates, false,
+                                                                                hint);
+        }
+    }
+}
+
+template class SparseIncrementalPrctlHelper<double, false>;
+template class SparseIncrementalPrctlHelper<double, true>;
+#ifdef STORM_HAVE_CARL
+template class SparseIncrementalPrctlHelper<storm::RationalNumber, false>;
+template class SparseIncrementalPrctlHelper<storm::RationalNumber, true>;
+#endif
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/SolveGoal.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Helper class for repeatedly checking reachability properties on a model that is only slightly modified between the computations, e.g., during a
+ * design-space exploration. The results of previous computations are cached. After the rows of some states have been changed, only the values of the
+ * states that can reach a changed state are recomputed: These are solved on a submodel in which every transition to a state whose value is unaffected
+ * is redirected to two sink states according to the cached value of that state. The previous values of the recomputed states serve as initial guess.
+ *
+ * @note The state space has to be preserved by modifications. Removing a state can be modeled by changing the rows of its predecessors.
+ * @note Only the optimization direction of the given solve goals is considered, as the values of all states are needed for subsequent computations.
+ *       For inexact solution methods, the errors of subsequent computations may accumulate.
+ * @tparam ValueType the type a value can have
+ * @tparam Nondeterministic true iff the transition matrix is the one of an MDP
+ */
+template<typename ValueType, bool Nondeterministic>
+class SparseIncrementalPrctlHelper {
+   public:
+    /*!
+     * Initializes the helper for the given transition matrix.
+     * Be aware that this class does not take ownership, i.e. the caller has to make sure that the reference to the given matrix remains valid (until the
+     * matrix is replaced using updateTransitionMatrix).
+     */
+    SparseIncrementalPrctlHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+    /*!
+     * Replaces the transition matrix by the given matrix that only differs from the current one in the rows of the given states.
+     * Be aware that this class does not take ownership of the given matrix.
+     *
+     * @param changedStates the states whose rows (including their number) may have been changed.
+     */
+    void updateTransitionMatrix(storm::storage::SparseMatrix<ValueType> const& newTransitionMatrix, storm::storage::BitVector const& changedStates);
+
+    /*!
+     * Computes for each state the (optimal) probability to reach a psi state while only visiting phi states.
+     * States with a different membership in phi or psi than in the previous computation are treated as changed.
+     */
+    std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                     storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+    /*!
+     * Computes for each state the (optimal) expected reward accumulated until a target state is reached.
+     * States that have a different reward for one of their choices or a different membership in the target states than in the previous computation
+     * are treated as changed.
+     *
+     * @param choiceRewards the reward of each row of the transition matrix.
+     */
+    std::vector<ValueType> computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                      std::vector<ValueType> const& choiceRewards, storm::storage::BitVector const& targetStates);
+
+    /*!
+     * @return the number of states whose values were (re-)computed by the most recent computation.
+     */
+    uint64_t getNumberOfRecomputedStates() const;
+
+    /*!
+     * Discards all cached results, such that the next computations are performed on the complete model.
+     */
+    void clearCache();
+
+   private:
+    enum class QueryType { UntilProbabilities, ReachabilityRewards };
+
+    struct CachedResult {
+        QueryType type;
+        bool minimize;
+        // The constraint and target states (for probabilities) or the target states (for rewards) of the computation.
+        storm::storage::BitVector phiStates;
+        storm::storage::BitVector psiStates;
+        // For rewards, the choice rewards and the row groups of the matrix used in the computation.
+        std::vector<ValueType> choiceRewards;
+        std::vector<uint64_t> rowGroupIndices;
+        std::vector<ValueType> values;
+        // The states that have been changed since the values were computed.
+        storm::storage::BitVector changedStates;
+    };
+
+    /*!
+     * Retrieves the cached result of the given query or null, if there is none.
+     */
+    CachedResult* findCachedResult(QueryType type, bool minimize);
+
+    /*!
+     * Retrieves the (non-propagating) states whose values do not depend on their successors.
+     */
+    storm::storage::BitVector getFixedStates(CachedResult const& query) const;
+
+    /*!
+     * Computes the states whose values may differ from the cached values, i.e., the states that can reach a changed state via states whose values depend
+     * on their successors.
+     */
+    storm::storage::BitVector computeAffectedStates(CachedResult const& query, storm::storage::BitVector const& changedStates) const;
+
+    /*!
+     * Computes the values of the given query, either on the complete model or (if possible) only for the states affected since the last computation.
+     */
+    std::vector<ValueType> compute(Environment const& env, storm::solver::SolveGoal<ValueType> const& goal, CachedResult&& query);
+
+    /*!
+     * Computes the values of the given query for the given states on the complete model (if all states are given) or on the submodel described above,
+     * whose additional goal and sink states are the last two states.
+     */
+    std::vector<ValueType> solve(Environment const& env, storm::solver::SolveGoal<ValueType> const& goal, CachedResult const& query,
+                                 storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::BitVector const& phiStates,
+                                 storm::storage::BitVector const& psiStates, std::vector<ValueType> const& choiceRewards,
+                                 std::vector<ValueType> const* initialValues) const;
+
+    storm::storage::SparseMatrix<ValueType> const* transitionMatrix;
+    storm::storage::SparseMatrix<ValueType> backwardTransitions;
+    std::vector<CachedResult> cachedResults;
+    uint64_t numberOfRecomputedStates;
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
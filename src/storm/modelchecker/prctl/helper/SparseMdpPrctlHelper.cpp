@@ -1,18 +1,27 @@
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <mutex>
+#include <optional>
+
 #include <boost/container/flat_map.hpp>
 
 #include "storm/modelchecker/prctl/helper/SemanticSolutionType.h"
 
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
+#include "storm/modelchecker/prctl/helper/ConditionalAlgorithm.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
+#include "storm/modelchecker/prctl/helper/DuplicateChoiceElimination.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/QualitativeAnalysisCache.h"
 
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
@@ -24,24 +33,30 @@
 
 #include "storm/solver/LpSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/SolverIterationObserver.h"
+#include "storm/solver/helper/MinMaxMethodSelection.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/IOSettings.h"
-#include "storm/settings/modules/ModelCheckerSettings.h"
 
 #include "storm/io/export.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/TaskRuntime.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
+#include "storm/exceptions/BaseException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
@@ -62,6 +77,7 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
         STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We do not support computing reward bounded values with interval models.");
     } else {
         storm::utility::Stopwatch swAll(true), swBuild, swCheck;
+        rewardUnfolding.setMemoryLimitForEpochSolutions(env.modelchecker().getEpochSolutionMemoryLimit());
 
         // Get lower and upper bounds for the solution.
         auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
@@ -87,28 +103,48 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
         progress.setMaxCount(epochOrder.size());
         progress.startNewMeasurement(0);
         uint64_t numCheckedEpochs = 0;
-        for (auto const& epoch : epochOrder) {
-            swBuild.start();
-            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-            swBuild.stop();
+        // The cdf export needs the solutions of all epochs, which are only available when the epochs are analyzed sequentially.
+        uint64_t numberOfThreads =
+            storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() ? 1 : env.modelchecker().getNumberOfEpochThreads();
+        if (numberOfThreads > 1) {
+            // Each thread uses its own vectors and solver.
+            std::vector<std::vector<ValueType>> threadX(numberOfThreads), threadB(numberOfThreads);
+            std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> threadSolvers(numberOfThreads);
+            std::mutex progressMutex;
             swCheck.start();
-            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
+            rewardUnfolding.analyzeEpochs(epochOrder, numberOfThreads, [&](uint64_t threadIndex, auto& epochModel) {
+                auto solution = epochModel.analyzeSingleObjective(preciseEnv, dir, threadX[threadIndex], threadB[threadIndex], threadSolvers[threadIndex],
+                                                                          lowerBound, upperBound);
+                std::lock_guard<std::mutex> lock(progressMutex);
+                ++numCheckedEpochs;
+                progress.updateProgress(numCheckedEpochs);
+                return solution;
+            });
             swCheck.stop();
-            if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
-                !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
-                std::vector<ValueType> cdfEntry;
-                for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
-                    uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
-                    cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
-                                       rewardUnfolding.getDimension(i).scalingFactor);
+        } else {
+            for (auto const& epoch : epochOrder) {
+                swBuild.start();
+                auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+                swBuild.stop();
+                swCheck.start();
+                rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
+                swCheck.stop();
+                if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
+                    !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
+                    std::vector<ValueType> cdfEntry;
+                    for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
+                        uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
+                        cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
+                                           rewardUnfolding.getDimension(i).scalingFactor);
+                    }
+                    cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
+                    cdfData.push_back(std::move(cdfEntry));
+                }
+                ++numCheckedEpochs;
+                progress.updateProgress(numCheckedEpochs);
+                if (storm::utility::resources::isTerminate()) {
+                    break;
                 }
-                cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-                cdfData.push_back(std::move(cdfEntry));
-            }
-            ++numCheckedEpochs;
-            progress.updateProgress(numCheckedEpochs);
-            if (storm::utility::resources::isTerminate()) {
-                break;
             }
         }
 
@@ -264,6 +300,8 @@ struct SparseMdpHintType {
     bool computeUpperBounds;
     bool uniqueSolution;
     bool noEndComponents;
+    // The solution methods that are raced against each other before solving (if any).
+    std::vector<storm::solver::MinMaxMethod> raceCandidates;
 };
 
 template<typename ValueType, typename SolutionType>
@@ -323,6 +361,42 @@ void extractValueAndSchedulerHint(SparseMdpHintType<SolutionType>& hintStorage,
     }
 }
 
+/*!
+ * If the automatic method selection is enabled and no method was set explicitly, selects the solution method based on features of the system of the maybe
+ * states. As the method determines the requirements of the solver, this needs to happen before the hints are computed.
+ *
+ * @param raceCandidates If the candidates are to be raced, the most promising methods are stored here.
+ * @return A copy of the given environment with the selected method or nothing if no method was selected.
+ */
+template<typename ValueType>
+std::optional<Environment> selectMinMaxMethod(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                              storm::storage::BitVector const& maybeStates, std::vector<storm::solver::MinMaxMethod>& raceCandidates) {
+    auto const& minMaxEnvironment = env.solver().minMax();
+    if (!minMaxEnvironment.isAutomaticMethodSelectionSet()) {
+        return std::nullopt;
+    }
+    if constexpr (!std::is_same_v<ValueType, double>) {
+        STORM_LOG_WARN("Automatic selection of the min/max method is only supported for floating point models. Using "
+                       << toString(minMaxEnvironment.getMethod()) << " instead.");
+        return std::nullopt;
+    } else {
+        if (!minMaxEnvironment.isMethodSetFromDefault() || env.solver().isForceExact()) {
+            STORM_LOG_INFO("Not selecting the min/max method automatically as " << toString(minMaxEnvironment.getMethod()) << " was requested explicitly.");
+            return std::nullopt;
+        }
+        storm::solver::helper::MinMaxProblemFeatures features = storm::solver::helper::computeMinMaxProblemFeatures(transitionMatrix, maybeStates);
+        std::vector<storm::solver::MinMaxMethod> ranking = storm::solver::helper::rankMinMaxMethods(features, env.solver().isForceSoundness());
+        STORM_LOG_INFO("Selected min/max method " << toString(ranking.front()) << " for a system with " << features << ".");
+
+        std::optional<Environment> result(env);
+        result->solver().minMax().setMethod(ranking.front());
+        if (minMaxEnvironment.getAutomaticMethodRaceTime() > 0) {
+            raceCandidates.assign(ranking.begin(), ranking.begin() + std::min<uint64_t>(3, ranking.size()));
+        }
+        return result;
+    }
+}
+
 template<typename ValueType, typename SolutionType>
 SparseMdpHintType<SolutionType> computeHints(Environment const& env, SemanticSolutionType const& type, ModelCheckerHint const& hint,
                                              storm::OptimizationDirection const& dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -429,10 +503,164 @@ struct MaybeStateResult {
         return values;
     }
 
+    bool hasBounds() const {
+        return static_cast<bool>(bounds);
+    }
+
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> const& getBounds() const {
+        return bounds.get();
+    }
+
     std::vector<ValueType> values;
     boost::optional<std::vector<uint64_t>> scheduler;
+    // Sound bounds on the values if the solver was aborted before the values converged.
+    boost::optional<std::pair<std::vector<ValueType>, std::vector<ValueType>>> bounds;
 };
 
+/*!
+ * Runs the race candidates of the hint in parallel on the given system until one of them converges or the time budget of the race is exhausted.
+ *
+ * @param env The environment of the race. If no candidate converges in time, the method that made the most progress is set in this environment.
+ * @return The result of the first candidate that converged (if any).
+ */
+template<typename ValueType, typename SolutionType>
+std::optional<MaybeStateResult<SolutionType>> raceMinMaxMethods(Environment& env, storm::OptimizationDirection const& dir,
+                                                                storm::storage::SparseMatrix<ValueType> const& submatrix, std::vector<ValueType> const& b,
+                                                                std::vector<SolutionType> const& x, bool produceScheduler,
+                                                                SparseMdpHintType<SolutionType> const& hint) {
+    storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType, SolutionType> minMaxLinearEquationSolverFactory;
+
+    // The hints were computed for the first candidate, so we drop the candidates whose requirements are not met by the hints.
+    std::vector<storm::solver::MinMaxMethod> candidates;
+    for (auto const& method : hint.raceCandidates) {
+        Environment candidateEnv(env);
+        candidateEnv.solver().minMax().setMethod(method);
+        storm::solver::MinMaxLinearEquationSolverRequirements requirements = minMaxLinearEquationSolverFactory.getRequirements(
+            candidateEnv, hint.hasUniqueSolution(), hint.hasNoEndComponents(), dir, hint.hasSchedulerHint(), produceScheduler);
+        if (hint.hasUniqueSolution()) {
+            requirements.clearUniqueSolution();
+        }
+        if (hint.hasSchedulerHint() || hint.hasNoEndComponents()) {
+            requirements.clearValidInitialScheduler();
+        }
+        if (hint.hasLowerResultBound()) {
+            requirements.clearLowerBounds();
+        }
+        if (hint.hasUpperResultBound() || hint.hasUpperResultBounds()) {
+            requirements.clearUpperBounds();
+        }
+        if (requirements.hasEnabledCriticalRequirement()) {
+            STORM_LOG_INFO("Not racing min/max method " << toString(method) << " as its requirements " << requirements.getEnabledRequirementsAsString()
+                                                        << " are not met.");
+        } else {
+            candidates.push_back(method);
+        }
+    }
+    if (candidates.size() < 2) {
+        return std::nullopt;
+    }
+
+    struct Racer {
+        storm::solver::MinMaxMethod method;
+        std::vector<SolutionType> values;
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType, SolutionType>> solver;
+        std::optional<storm::solver::SolverIterationInfo> lastIteration;
+        bool interrupted = false;
+        bool failed = false;
+        double seconds = 0;
+    };
+    std::vector<Racer> racers(candidates.size());
+    std::atomic<bool> someRacerConverged(false);
+    double const budgetSeconds = env.solver().minMax().getAutomaticMethodRaceTime() / 1000.0;
+    auto const start = std::chrono::steady_clock::now();
+    auto elapsedSeconds = [&start]() { return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(); };
+
+    storm::utility::parallel::TaskGroup race;
+    for (uint64_t racerIndex = 0; racerIndex < racers.size(); ++racerIndex) {
+        racers[racerIndex].method = candidates[racerIndex];
+        race.run([&, racerIndex]() {
+            Racer& racer = racers[racerIndex];
+            Environment racerEnv(env);
+            racerEnv.solver().minMax().setMethod(racer.method);
+            racerEnv.solver().setIterationObserver([&](storm::solver::SolverIterationInfo const& info) {
+                racer.lastIteration = info;
+                if (someRacerConverged.load() || elapsedSeconds() > budgetSeconds) {
+                    racer.interrupted = true;
+                    return false;
+                }
+                return true;
+            });
+            try {
+                racer.solver = minMaxLinearEquationSolverFactory.create(racerEnv, submatrix);
+                racer.solver->setOptimizationDirection(dir);
+                racer.solver->setRequirementsChecked();
+                racer.solver->setHasUniqueSolution(hint.hasUniqueSolution());
+                racer.solver->setHasNoEndComponents(hint.hasNoEndComponents());
+                if (hint.hasLowerResultBound()) {
+                    racer.solver->setLowerBound(hint.getLowerResultBound());
+                }
+                if (hint.hasUpperResultBound()) {
+                    racer.solver->setUpperBound(hint.getUpperResultBound());
+                }
+                if (hint.hasUpperResultBounds()) {
+                    racer.solver->setUpperBounds(hint.getUpperResultBounds());
+                }
+                if (hint.hasSchedulerHint()) {
+                    racer.solver->setInitialScheduler(std::vector<uint64_t>(hint.schedulerHint.get()));
+                }
+                racer.solver->setTrackScheduler(produceScheduler);
+                racer.values = x;
+                racer.solver->solveEquations(racerEnv, racer.values, b);
+            } catch (storm::exceptions::BaseException const& e) {
+                STORM_LOG_INFO("Min/max method " << toString(racer.method) << " failed during the race: " << e.what());
+                racer.failed = true;
+            }
+            racer.seconds = elapsedSeconds();
+            if (!racer.interrupted && !racer.failed) {
+                someRacerConverged.store(true);
+            }
+        });
+    }
+    race.wait();
+
+    // A racer that converged wins the race, otherwise the racer with the smallest bounds gap (or residual) is used.
+    auto progress = [](Racer const& racer) {
+        if (racer.lastIteration && racer.lastIteration->boundsGap) {
+            return racer.lastIteration->boundsGap.value();
+        } else if (racer.lastIteration && racer.lastIteration->residual) {
+            return racer.lastIteration->residual.value();
+        }
+        return std::numeric_limits<double>::infinity();
+    };
+    Racer* winner = nullptr;
+    for (auto& racer : racers) {
+        if (racer.failed) {
+            continue;
+        }
+        if (!racer.interrupted) {
+            if (!winner || winner->interrupted || racer.seconds < winner->seconds) {
+                winner = &racer;
+            }
+        } else if (!winner || (winner->interrupted && progress(racer) < progress(*winner))) {
+            winner = &racer;
+        }
+    }
+    if (!winner) {
+        STORM_LOG_INFO("All min/max methods failed during the race, falling back to " << toString(env.solver().minMax().getMethod()) << ".");
+        return std::nullopt;
+    }
+    STORM_LOG_INFO("Min/max method " << toString(winner->method) << " won the race after " << elapsedSeconds() << "s.");
+    if (winner->interrupted) {
+        env.solver().minMax().setMethod(winner->method);
+        return std::nullopt;
+    }
+    MaybeStateResult<SolutionType> result(std::move(winner->values));
+    if (produceScheduler) {
+        result.scheduler = std::move(winner->solver->getSchedulerChoices());
+    }
+    return result;
+}
+
 template<typename ValueType, typename SolutionType>
 MaybeStateResult<SolutionType> computeValuesForMaybeStates(Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal,
                                                            storm::storage::SparseMatrix<ValueType>&& submatrix, std::vector<ValueType> const& b,
@@ -443,10 +671,52 @@ MaybeStateResult<SolutionType> computeValuesForMaybeStates(Environment const& en
                             : std::vector<SolutionType>(submatrix.getRowGroupCount(),
                                                         hint.hasLowerResultBound() ? hint.getLowerResultBound() : storm::utility::zero<SolutionType>());
 
+    // Choices of a state that coincide with another choice of the state (including the rewards) do not affect the values, so they are removed.
+    std::optional<DuplicateChoiceElimination<ValueType>> duplicateChoiceElimination;
+    std::vector<ValueType> reducedB;
+    if constexpr (!std::is_same_v<ValueType, storm::Interval>) {
+        if (env.solver().minMax().isDuplicateChoiceEliminationSet() && submatrix.getRowCount() > submatrix.getRowGroupCount()) {
+            // Only use several threads if every thread obtains a considerable number of rows.
+            uint64_t const numberOfThreads = std::min<uint64_t>(env.solver().getNumberOfThreads(), std::max<uint64_t>(1, submatrix.getRowCount() / 100000));
+            duplicateChoiceElimination.emplace(submatrix, b, numberOfThreads);
+            if (duplicateChoiceElimination->getNumberOfDuplicateRows() > 0) {
+                STORM_LOG_INFO("Removed " << duplicateChoiceElimination->getNumberOfDuplicateRows() << " duplicate choices of " << submatrix.getRowCount()
+                                          << " choices before solving.");
+                submatrix = duplicateChoiceElimination->reduceMatrix(submatrix);
+                reducedB = duplicateChoiceElimination->reduceVector(b);
+                if (hint.hasSchedulerHint()) {
+                    hint.getSchedulerHint() = duplicateChoiceElimination->reduceScheduler(hint.getSchedulerHint());
+                }
+            } else {
+                duplicateChoiceElimination.reset();
+            }
+        }
+    }
+    std::vector<ValueType> const& solverB = duplicateChoiceElimination ? reducedB : b;
+    auto restoreScheduler = [&duplicateChoiceElimination](MaybeStateResult<SolutionType>& result) {
+        if (duplicateChoiceElimination && result.hasScheduler()) {
+            result.scheduler = duplicateChoiceElimination->restoreScheduler(result.getScheduler());
+        }
+    };
+
+    // If requested, race the candidate methods first. Their result can be used directly if one of them converged within the time budget.
+    std::optional<Environment> racedEnv;
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (hint.raceCandidates.size() > 1) {
+            racedEnv.emplace(env);
+            auto racedResult = raceMinMaxMethods(*racedEnv, goal.direction(), submatrix, solverB, x, produceScheduler, hint);
+            if (racedResult) {
+                restoreScheduler(racedResult.value());
+                return std::move(racedResult.value());
+            }
+        }
+    }
+    Environment const& solverEnv = racedEnv ? *racedEnv : env;
+
     // Set up the solver.
     storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType, SolutionType> minMaxLinearEquationSolverFactory;
     std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType, SolutionType>> solver =
-        storm::solver::configureMinMaxLinearEquationSolver(env, std::move(goal), minMaxLinearEquationSolverFactory, std::move(submatrix));
+        storm::solver::configureMinMaxLinearEquationSolver(solverEnv, std::move(goal), minMaxLinearEquationSolverFactory, std::move(submatrix));
     solver->setRequirementsChecked();
     solver->setUncertaintyIsRobust(goal.isRobust());
     solver->setHasUniqueSolution(hint.hasUniqueSolution());
@@ -466,7 +736,7 @@ MaybeStateResult<SolutionType> computeValuesForMaybeStates(Environment const& en
     solver->setTrackScheduler(produceScheduler);
 
     // Solve the corresponding system of equations.
-    solver->solveEquations(env, x, b);
+    solver->solveEquations(solverEnv, x, solverB);
 
 #ifndef NDEBUG
     // As a sanity check, make sure our local upper bounds were in fact correct.
@@ -483,14 +753,41 @@ MaybeStateResult<SolutionType> computeValuesForMaybeStates(Environment const& en
 
     // Create result.
     MaybeStateResult<SolutionType> result(std::move(x));
+    if (solver->hasAbortedSolveBounds()) {
+        STORM_LOG_WARN("The solver was aborted, the result is only an approximation within the reported bounds.");
+        result.bounds = solver->getAbortedSolveBounds();
+    }
 
     // If requested, return the requested scheduler.
     if (produceScheduler) {
         result.scheduler = std::move(solver->getSchedulerChoices());
+        restoreScheduler(result);
     }
     return result;
 }
 
+/*!
+ * If the solver was aborted, extends its bounds for the maybe states to bounds for all states. The values of the other states are exact, so they are taken
+ * from the given result.
+ */
+template<typename ValueType>
+std::optional<std::pair<std::vector<ValueType>, std::vector<ValueType>>> extendBoundsForMaybeStates(
+    std::vector<ValueType> const& result, storm::storage::BitVector const& maybeStates, MaybeStateResult<ValueType> const& resultForMaybeStates,
+    boost::optional<SparseMdpEndComponentInformation<ValueType>>& ecInformation) {
+    if (!resultForMaybeStates.hasBounds()) {
+        return std::nullopt;
+    }
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> bounds(result, result);
+    if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
+        ecInformation.get().setValues(bounds.first, maybeStates, resultForMaybeStates.getBounds().first);
+        ecInformation.get().setValues(bounds.second, maybeStates, resultForMaybeStates.getBounds().second);
+    } else {
+        storm::utility::vector::setVectorValues<ValueType>(bounds.first, maybeStates, resultForMaybeStates.getBounds().first);
+        storm::utility::vector::setVectorValues<ValueType>(bounds.second, maybeStates, resultForMaybeStates.getBounds().second);
+    }
+    return bounds;
+}
+
 struct QualitativeStateSetsUntilProbabilities {
     storm::storage::BitVector maybeStates;
     storm::storage::BitVector statesWithProbability0;
@@ -525,17 +822,25 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
                                                                                      storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                      storm::storage::BitVector const& phiStates,
-                                                                                     storm::storage::BitVector const& psiStates) {
+                                                                                     storm::storage::BitVector const& psiStates,
+                                                                                     storm::storage::QualitativeAnalysisCache* qualitativeAnalysisCache) {
     QualitativeStateSetsUntilProbabilities result;
 
     // Get all states that have probability 0 and 1 of satisfying the until-formula.
+    auto computeProb01 = [&]() {
+        if (goal.minimize()) {
+            return storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        } else {
+            return storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        }
+    };
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
-    if (goal.minimize()) {
-        statesWithProbability01 =
-            storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    if (qualitativeAnalysisCache) {
+        auto type = goal.minimize() ? storm::storage::QualitativeAnalysisCache::AnalysisType::Prob01Min
+                                    : storm::storage::QualitativeAnalysisCache::AnalysisType::Prob01Max;
+        statesWithProbability01 = qualitativeAnalysisCache->getOrCompute(type, phiStates, psiStates, computeProb01);
     } else {
-        statesWithProbability01 =
-            storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        statesWithProbability01 = computeProb01();
     }
     result.statesWithProbability0 = std::move(statesWithProbability01.first);
     result.statesWithProbability1 = std::move(statesWithProbability01.second);
@@ -549,11 +854,12 @@ QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities
                                                                                  storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
-                                                                                 storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint) {
+                                                                                 storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint,
+                                                                                 storm::storage::QualitativeAnalysisCache* qualitativeAnalysisCache) {
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
         return getQualitativeStateSetsUntilProbabilitiesFromHint<ValueType>(hint);
     } else {
-        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates);
+        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, qualitativeAnalysisCache);
     }
 }
 
@@ -681,9 +987,11 @@ template<typename ValueType, typename SolutionType>
 MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint, storm::storage::QualitativeAnalysisCache* qualitativeAnalysisCache) {
     STORM_LOG_THROW(!qualitative || !produceScheduler, storm::exceptions::InvalidSettingsException,
                     "Cannot produce scheduler when performing qualitative model checking only.");
+    storm::utility::ProfilerPhase phase("mdp-until");
+    phase.addCounter("backward-transitions-bytes", backwardTransitions.getSizeInBytes());
 
     // Prepare resulting vector.
     std::vector<SolutionType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<SolutionType>());
@@ -691,7 +999,7 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
     // We need to identify the maybe states (states which have a probability for satisfying the until formula
     // that is strictly between 0 and 1) and the states that satisfy the formula with probablity 1 and 0, respectively.
     QualitativeStateSetsUntilProbabilities qualitativeStateSets =
-        getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
+        getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint, qualitativeAnalysisCache);
 
     STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.statesWithProbability1.getNumberOfSetBits() << " states with probability 1, "
                                      << qualitativeStateSets.statesWithProbability0.getNumberOfSetBits() << " with probability 0 ("
@@ -703,6 +1011,9 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
     // Check if the values of the maybe states are relevant for the SolveGoal
     bool maybeStatesNotRelevant = goal.hasRelevantValues() && goal.relevantValues().isDisjointFrom(qualitativeStateSets.maybeStates);
 
+    // If the solver is aborted, these are the bounds on the values.
+    std::optional<std::pair<std::vector<SolutionType>, std::vector<SolutionType>>> bounds;
+
     // If requested, we will produce a scheduler.
     std::unique_ptr<storm::storage::Scheduler<SolutionType>> scheduler;
     if (produceScheduler) {
@@ -723,10 +1034,16 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
         if (!qualitativeStateSets.maybeStates.empty()) {
             // In this case we have have to compute the remaining probabilities.
 
+            // If requested, select the solution method based on the system of the maybe states.
+            std::vector<storm::solver::MinMaxMethod> raceCandidates;
+            std::optional<Environment> selectedEnv = selectMinMaxMethod(env, transitionMatrix, qualitativeStateSets.maybeStates, raceCandidates);
+            Environment const& solverEnv = selectedEnv ? *selectedEnv : env;
+
             // Obtain proper hint information either from the provided hint or from requirements of the solver.
             SparseMdpHintType<SolutionType> hintInformation = computeHints<ValueType, SolutionType>(
-                env, SemanticSolutionType::UntilProbabilities, hint, goal.direction(), transitionMatrix, backwardTransitions, qualitativeStateSets.maybeStates,
-                phiStates, qualitativeStateSets.statesWithProbability1, produceScheduler);
+                solverEnv, SemanticSolutionType::UntilProbabilities, hint, goal.direction(), transitionMatrix, backwardTransitions,
+                qualitativeStateSets.maybeStates, phiStates, qualitativeStateSets.statesWithProbability1, produceScheduler);
+            hintInformation.raceCandidates = std::move(raceCandidates);
 
             // Declare the components of the equation system we will solve.
             storm::storage::SparseMatrix<ValueType> submatrix;
@@ -743,8 +1060,9 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
             }
 
             // Now compute the results for the maybe states.
+            phase.addCounter("submatrix-bytes", submatrix.getSizeInBytes());
             MaybeStateResult<SolutionType> resultForMaybeStates =
-                computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
+                computeValuesForMaybeStates(solverEnv, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
 
             // If we eliminated end components, we need to extract the result differently.
             if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
@@ -772,6 +1090,9 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
                                                                                                        qualitativeStateSets.maybeStates);
                 }
             }
+            if constexpr (!std::is_same_v<ValueType, storm::Interval>) {
+                bounds = extendBoundsForMaybeStates(result, qualitativeStateSets.maybeStates, resultForMaybeStates, ecInformation);
+            }
         }
     }
 
@@ -787,7 +1108,9 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
     STORM_LOG_ASSERT((!produceScheduler && !scheduler) || scheduler->isMemorylessScheduler(), "Expected a memoryless scheduler");
 
     // Return result.
-    return MDPSparseModelCheckingHelperReturnType<SolutionType>(std::move(result), std::move(scheduler));
+    MDPSparseModelCheckingHelperReturnType<SolutionType> returnValue(std::move(result), std::move(scheduler));
+    returnValue.bounds = std::move(bounds);
+    return returnValue;
 }
 
 template<typename ValueType, typename SolutionType>
@@ -815,6 +1138,15 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
         for (auto& element : result.values) {
             element = storm::utility::one<SolutionType>() - element;
         }
+        if (result.bounds) {
+            // The complement of the lower bound is an upper bound and vice versa.
+            std::swap(result.bounds->first, result.bounds->second);
+            for (auto* bound : {&result.bounds->first, &result.bounds->second}) {
+                for (auto& element : *bound) {
+                    element = storm::utility::one<SolutionType>() - element;
+                }
+            }
+        }
         return result;
     }
 }
@@ -1065,7 +1397,7 @@ QualitativeStateSetsReachabilityRewards getQualitativeStateSetsReachabilityRewar
 
 template<typename ValueType, typename SolutionType>
 QualitativeStateSetsReachabilityRewards computeQualitativeStateSetsReachabilityRewards(
-    storm::solver::SolveGoal<ValueType, SolutionType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates,
     std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter) {
     QualitativeStateSetsReachabilityRewards result;
@@ -1079,7 +1411,7 @@ QualitativeStateSetsReachabilityRewards computeQualitativeStateSetsReachabilityR
     }
     result.infinityStates.complement();
 
-    if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isFilterRewZeroSet()) {
+    if (env.modelchecker().isFilterRewZeroSet()) {
         if (goal.minimize()) {
             result.rewardZeroStates = storm::utility::graph::performProb1E(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions,
                                                                            trueStates, targetStates, zeroRewardChoicesGetter());
@@ -1095,7 +1427,8 @@ QualitativeStateSetsReachabilityRewards computeQualitativeStateSetsReachabilityR
 }
 
 template<typename ValueType, typename SolutionType>
-QualitativeStateSetsReachabilityRewards getQualitativeStateSetsReachabilityRewards(storm::solver::SolveGoal<ValueType, SolutionType> const& goal,
+QualitativeStateSetsReachabilityRewards getQualitativeStateSetsReachabilityRewards(Environment const& env,
+                                                                                   storm::solver::SolveGoal<ValueType, SolutionType> const& goal,
                                                                                    storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                    storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                    storm::storage::BitVector const& targetStates, ModelCheckerHint const& hint,
@@ -1104,7 +1437,7 @@ QualitativeStateSetsReachabilityRewards getQualitativeStateSetsReachabilityRewar
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
         return getQualitativeStateSetsReachabilityRewardsFromHint<ValueType>(hint, targetStates);
     } else {
-        return computeQualitativeStateSetsReachabilityRewards(goal, transitionMatrix, backwardTransitions, targetStates, zeroRewardStatesGetter,
+        return computeQualitativeStateSetsReachabilityRewards(env, goal, transitionMatrix, backwardTransitions, targetStates, zeroRewardStatesGetter,
                                                               zeroRewardChoicesGetter);
     }
 }
@@ -1272,16 +1605,16 @@ boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSy
 template<typename ValueType, typename SolutionType>
 void computeUpperRewardBounds(SparseMdpHintType<SolutionType>& hintInformation, storm::OptimizationDirection const& direction,
                               storm::storage::SparseMatrix<ValueType> const& submatrix, std::vector<ValueType> const& choiceRewards,
-                              std::vector<ValueType> const& oneStepTargetProbabilities) {
+                              std::vector<ValueType> const& oneStepTargetProbabilities, uint64_t numberOfThreads) {
     if constexpr (std::is_same_v<ValueType, storm::Interval>) {
         STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We do not support computing upper reward bounds with interval models.");
     } else {
-        // For the min-case, we use DS-MPI, for the max-case variant 2 of the Baier et al. paper (CAV'17).
+        // For the min-case, we use DS-MPI (applied to each SCC), for the max-case variant 2 of the Baier et al. paper (CAV'17).
         if (direction == storm::OptimizationDirection::Minimize) {
-            DsMpiMdpUpperRewardBoundsComputer<ValueType> dsmpi(submatrix, choiceRewards, oneStepTargetProbabilities);
+            DsMpiSccUpperRewardBoundsComputer<ValueType> dsmpi(submatrix, choiceRewards, oneStepTargetProbabilities, numberOfThreads);
             hintInformation.upperResultBounds = dsmpi.computeUpperBounds();
         } else {
-            BaierUpperRewardBoundsComputer<ValueType> baier(submatrix, choiceRewards, oneStepTargetProbabilities);
+            BaierUpperRewardBoundsComputer<ValueType> baier(submatrix, choiceRewards, oneStepTargetProbabilities, {}, numberOfThreads);
             hintInformation.upperResultBound = baier.computeUpperBound();
         }
     }
@@ -1296,12 +1629,15 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
     storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
     std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter,
     ModelCheckerHint const& hint) {
+    storm::utility::ProfilerPhase phase("mdp-reachability-rewards");
+    phase.addCounter("backward-transitions-bytes", backwardTransitions.getSizeInBytes());
+
     // Prepare resulting vector.
     std::vector<SolutionType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<SolutionType>());
 
     // Determine which states have a reward that is infinity or less than infinity.
     QualitativeStateSetsReachabilityRewards qualitativeStateSets = getQualitativeStateSetsReachabilityRewards(
-        goal, transitionMatrix, backwardTransitions, targetStates, hint, zeroRewardStatesGetter, zeroRewardChoicesGetter);
+        env, goal, transitionMatrix, backwardTransitions, targetStates, hint, zeroRewardStatesGetter, zeroRewardChoicesGetter);
 
     STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.infinityStates.getNumberOfSetBits() << " states with reward infinity, "
                                      << qualitativeStateSets.rewardZeroStates.getNumberOfSetBits() << " states with reward zero ("
@@ -1309,6 +1645,9 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
 
     storm::utility::vector::setVectorValues(result, qualitativeStateSets.infinityStates, storm::utility::infinity<SolutionType>());
 
+    // If the solver is aborted, these are the bounds on the values.
+    std::optional<std::pair<std::vector<SolutionType>, std::vector<SolutionType>>> bounds;
+
     // If requested, we will produce a scheduler.
     std::unique_ptr<storm::storage::Scheduler<SolutionType>> scheduler;
     if (produceScheduler) {
@@ -1338,10 +1677,17 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
                 selectedChoices = transitionMatrix.getRowFilter(qualitativeStateSets.maybeStates, ~qualitativeStateSets.infinityStates);
             }
 
+            // If requested, select the solution method based on the system of the maybe states.
+            std::vector<storm::solver::MinMaxMethod> raceCandidates;
+            std::optional<Environment> selectedEnv = selectMinMaxMethod(env, transitionMatrix, qualitativeStateSets.maybeStates, raceCandidates);
+            Environment const& solverEnv = selectedEnv ? *selectedEnv : env;
+
             // Obtain proper hint information either from the provided hint or from requirements of the solver.
             SparseMdpHintType<SolutionType> hintInformation = computeHints<ValueType, SolutionType>(
-                env, SemanticSolutionType::ExpectedRewards, hint, goal.direction(), transitionMatrix, backwardTransitions, qualitativeStateSets.maybeStates,
-                ~qualitativeStateSets.rewardZeroStates, qualitativeStateSets.rewardZeroStates, produceScheduler, selectedChoices);
+                solverEnv, SemanticSolutionType::ExpectedRewards, hint, goal.direction(), transitionMatrix, backwardTransitions,
+                qualitativeStateSets.maybeStates, ~qualitativeStateSets.rewardZeroStates, qualitativeStateSets.rewardZeroStates, produceScheduler,
+                selectedChoices);
+            hintInformation.raceCandidates = std::move(raceCandidates);
 
             // Declare the components of the equation system we will solve.
             storm::storage::SparseMatrix<ValueType> submatrix;
@@ -1373,12 +1719,13 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
             // If we need to compute upper bounds, do so now.
             if (hintInformation.getComputeUpperBounds()) {
                 STORM_LOG_ASSERT(oneStepTargetProbabilities, "Expecting one step target probability vector to be available.");
-                computeUpperRewardBounds(hintInformation, goal.direction(), submatrix, b, oneStepTargetProbabilities.get());
+                computeUpperRewardBounds(hintInformation, goal.direction(), submatrix, b, oneStepTargetProbabilities.get(), env.solver().getNumberOfThreads());
             }
 
             // Now compute the results for the maybe states.
+            phase.addCounter("submatrix-bytes", submatrix.getSizeInBytes());
             MaybeStateResult<SolutionType> resultForMaybeStates =
-                computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
+                computeValuesForMaybeStates(solverEnv, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
 
             // If we eliminated end components, we need to extract the result differently.
             if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
@@ -1399,6 +1746,9 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
                                             selectedChoices);
                 }
             }
+            if constexpr (!std::is_same_v<ValueType, storm::Interval>) {
+                bounds = extendBoundsForMaybeStates(result, qualitativeStateSets.maybeStates, resultForMaybeStates, ecInformation);
+            }
         }
     }
 
@@ -1416,8 +1766,76 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
     if constexpr (std::is_same_v<ValueType, storm::Interval>) {
         return MDPSparseModelCheckingHelperReturnType<SolutionType>(std::move(result));
     } else {
-        return MDPSparseModelCheckingHelperReturnType<SolutionType>(std::move(result), std::move(scheduler));
+        MDPSparseModelCheckingHelperReturnType<SolutionType> returnValue(std::move(result), std::move(scheduler));
+        returnValue.bounds = std::move(bounds);
+        return returnValue;
+    }
+}
+
+/*!
+ * Computes the maximal conditional probability to reach a goal in the given MDP by bisection. Every choice of the MDP either has transitions or
+ * stops the computation, in which case the offsets give the probabilities to reach a goal state (numerator) and to satisfy the condition
+ * (denominator) afterwards. A value lambda is below the maximal conditional probability iff some scheduler has a positive expected total value
+ * for the offsets numerator - lambda * denominator. Since stopping without satisfying the condition has value zero, the bisection only needs the
+ * sign of this value, which is approached from below by value iteration. The multiplier and the vector are reused between the steps: after a
+ * step with lambda, the vector shifted by the increase of lambda is a lower bound for the next step.
+ */
+template<typename ValueType>
+ValueType computeConditionalValueBisection(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix,
+                                           std::vector<ValueType> const& numeratorOffsets, std::vector<ValueType> const& denominatorOffsets,
+                                           uint64_t initialState) {
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, matrix);
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+    uint64_t maxIterations = env.solver().minMax().getMaximalNumberOfIterations();
+
+    ValueType lowerBound = storm::utility::zero<ValueType>();
+    ValueType upperBound = storm::utility::one<ValueType>();
+    ValueType previousLambda = storm::utility::zero<ValueType>();
+    std::vector<ValueType> x(matrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+    std::vector<ValueType> next(x.size());
+    std::vector<ValueType> offsets(matrix.getRowCount());
+    uint64_t steps = 0;
+    uint64_t totalIterations = 0;
+    while (upperBound - lowerBound > precision && !storm::utility::resources::isTerminate()) {
+        ValueType lambda = (lowerBound + upperBound) / storm::utility::convertNumber<ValueType>(2);
+        for (uint64_t row = 0; row < offsets.size(); ++row) {
+            offsets[row] = numeratorOffsets[row] - lambda * denominatorOffsets[row];
+        }
+        if (lambda > previousLambda) {
+            ValueType shift = lambda - previousLambda;
+            for (auto& value : x) {
+                value -= shift;
+            }
+        }
+        previousLambda = lambda;
+
+        // The iterates increase monotonically, so the value at the initial state is positive as soon as one iterate is.
+        bool positive = false;
+        bool converged = false;
+        uint64_t iterations = 0;
+        while (!positive && !converged && iterations < maxIterations) {
+            multiplier->multiplyAndReduce(env, storm::OptimizationDirection::Maximize, x, &offsets, next);
+            ValueType maxDiff = storm::utility::zero<ValueType>();
+            for (uint64_t state = 0; state < x.size(); ++state) {
+                maxDiff = std::max(maxDiff, next[state] - x[state]);
+            }
+            std::swap(x, next);
+            positive = x[initialState] > storm::utility::zero<ValueType>();
+            converged = maxDiff <= precision;
+            ++iterations;
+        }
+        totalIterations += iterations;
+        STORM_LOG_WARN_COND(positive || converged, "Value iteration for conditional probability threshold " << lambda << " did not converge within "
+                                                                                                             << iterations << " iterations.");
+        if (positive) {
+            lowerBound = lambda;
+        } else {
+            upperBound = lambda;
+        }
+        ++steps;
     }
+    STORM_LOG_INFO("Bisection for conditional probabilities took " << steps << " steps with " << totalIterations << " iterations in total.");
+    return (lowerBound + upperBound) / storm::utility::convertNumber<ValueType>(2);
 }
 
 template<typename ValueType, typename SolutionType>
@@ -1507,6 +1925,54 @@ std::unique_ptr<CheckResult> SparseMdpPrctlHelper<ValueType, SolutionType>::comp
                                                                                              extendedConditionStates | fixedTargetStates | pureResetStates);
         STORM_LOG_TRACE("Found " << relevantStates.getNumberOfSetBits() << " relevant states for conditional probability computation.");
         std::vector<uint_fast64_t> numberOfStatesBeforeRelevantStates = relevantStates.getNumberOfSetBitsBeforeIndices();
+
+        if (env.modelchecker().getConditionalAlgorithm() == ConditionalAlgorithm::Bisection) {
+            if constexpr (std::is_same_v<ValueType, double>) {
+                // Instead of restarting, the states that reach a goal, satisfy the condition or fail stop with the corresponding offsets.
+                storm::storage::SparseMatrixBuilder<ValueType> builder(0, relevantStates.getNumberOfSetBits(), 0, true, true);
+                std::vector<ValueType> numeratorOffsets, denominatorOffsets;
+                uint_fast64_t currentRow = 0;
+                auto addStopRow = [&](ValueType const& numerator, ValueType const& denominator) {
+                    numeratorOffsets.push_back(numerator);
+                    denominatorOffsets.push_back(denominator);
+                    ++currentRow;
+                };
+                for (auto state : relevantStates) {
+                    builder.newRowGroup(currentRow);
+                    if (fixedTargetStates.get(state)) {
+                        addStopRow(conditionProbabilities[state], conditionProbabilities[state]);
+                    } else if (extendedConditionStates.get(state)) {
+                        addStopRow(targetProbabilities[state], storm::utility::one<ValueType>());
+                    } else if (pureResetStates.get(state)) {
+                        addStopRow(storm::utility::zero<ValueType>(), storm::utility::zero<ValueType>());
+                    } else {
+                        for (uint_fast64_t row = transitionMatrix.getRowGroupIndices()[state]; row < transitionMatrix.getRowGroupIndices()[state + 1]; ++row) {
+                            for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                                builder.addNextValue(currentRow, numberOfStatesBeforeRelevantStates[successorEntry.getColumn()], successorEntry.getValue());
+                            }
+                            addStopRow(storm::utility::zero<ValueType>(), storm::utility::zero<ValueType>());
+                        }
+                        if (problematicStates.get(state)) {
+                            addStopRow(storm::utility::zero<ValueType>(), storm::utility::zero<ValueType>());
+                        }
+                    }
+                }
+                storm::storage::SparseMatrix<ValueType> newTransitionMatrix =
+                    builder.build(currentRow, relevantStates.getNumberOfSetBits(), relevantStates.getNumberOfSetBits());
+                std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+                STORM_LOG_DEBUG("Computed threshold model with " << newTransitionMatrix.getRowGroupCount() << " states in "
+                                                                 << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
+
+                ValueType value = computeConditionalValueBisection(env, newTransitionMatrix, numeratorOffsets, denominatorOffsets,
+                                                                   numberOfStatesBeforeRelevantStates[initialState]);
+                return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(
+                    initialState, goal.minimize() ? storm::utility::one<ValueType>() - value : value));
+            } else {
+                STORM_LOG_WARN("Computing conditional probabilities by bisection is only supported for floating point models. Falling back to the "
+                               "transformation.");
+            }
+        }
+
         storm::storage::sparse::state_type newGoalState = relevantStates.getNumberOfSetBits();
         storm::storage::sparse::state_type newStopState = newGoalState + 1;
         storm::storage::sparse::state_type newFailState = newStopState + 1;
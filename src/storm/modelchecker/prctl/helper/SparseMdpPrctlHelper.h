@@ -20,6 +20,7 @@ class Environment;
 
 namespace storage {
 class BitVector;
+class QualitativeAnalysisCache;
 }
 
 namespace models {
@@ -48,7 +49,8 @@ class SparseMdpPrctlHelper {
     static MDPSparseModelCheckingHelperReturnType<SolutionType> computeUntilProbabilities(
         Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
         storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-        storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
+        storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint(),
+        storm::storage::QualitativeAnalysisCache* qualitativeAnalysisCache = nullptr);
 
     static MDPSparseModelCheckingHelperReturnType<SolutionType> computeGloballyProbabilities(Environment const& env,
                                                                                              storm::solver::SolveGoal<ValueType, SolutionType>&& goal,
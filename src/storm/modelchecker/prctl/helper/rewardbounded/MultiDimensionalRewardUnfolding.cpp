@@ -1,5 +1,6 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
+#include <algorithm>
 #include <functional>
 #include <set>
 #include <string>
@@ -17,7 +18,11 @@
 #include "storm/storage/expressions/Expressions.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 
+#include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -377,14 +382,23 @@ typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch
 template<typename ValueType, bool SingleObjectiveMode>
 std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>
 MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationOrder(Epoch const& startEpoch, bool stopAtComputedEpochs) {
+    return getEpochComputationOrder(std::vector<Epoch>({startEpoch}), stopAtComputedEpochs);
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationOrder(std::vector<Epoch> const& startEpochs, bool stopAtComputedEpochs) {
     // Perform a DFS to find all the reachable epochs
     std::vector<Epoch> dfsStack;
     std::set<Epoch, std::function<bool(Epoch const&, Epoch const&)>> collectedEpochs(
         std::bind(&EpochManager::epochClassZigZagOrder, &epochManager, std::placeholders::_1, std::placeholders::_2));
 
-    if (!stopAtComputedEpochs || epochSolutions.count(startEpoch) == 0) {
-        collectedEpochs.insert(startEpoch);
-        dfsStack.push_back(startEpoch);
+    for (auto const& startEpoch : startEpochs) {
+        if (!stopAtComputedEpochs || epochSolutions.count(startEpoch) == 0) {
+            if (collectedEpochs.insert(startEpoch).second) {
+                dfsStack.push_back(startEpoch);
+            }
+        }
     }
     while (!dfsStack.empty()) {
         Epoch currentEpoch = dfsStack.back();
@@ -403,19 +417,25 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputa
 
 template<typename ValueType, bool SingleObjectiveMode>
 EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch) {
+    return setCurrentEpoch(epoch, epochModelSlots.front());
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch,
+                                                                                                            EpochModelSlot& slot) {
     STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
 
     // Check if we need to update the current epoch class
-    if (!currentEpoch || !epochManager.compareEpochClass(epoch, currentEpoch.get())) {
-        setCurrentEpochClass(epoch);
-        epochModel.epochMatrixChanged = true;
+    if (!slot.currentEpoch || !epochManager.compareEpochClass(epoch, slot.currentEpoch.get())) {
+        setCurrentEpochClass(epoch, slot);
+        slot.epochModel.epochMatrixChanged = true;
         if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-            if (storm::utility::graph::hasCycle(epochModel.epochMatrix)) {
+            if (storm::utility::graph::hasCycle(slot.epochModel.epochMatrix)) {
                 std::cout << "Epoch model for epoch " << epochManager.toString(epoch) << " is cyclic.\n";
             }
         }
     } else {
-        epochModel.epochMatrixChanged = false;
+        slot.epochModel.epochMatrixChanged = false;
     }
 
     bool containsLowerBoundedObjective = false;
@@ -426,18 +446,27 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         }
     }
     std::map<Epoch, EpochSolution const*> subSolutions;
-    for (auto const& step : possibleEpochSteps) {
-        Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
-        if (successorEpoch != epoch) {
-            auto successorSolIt = epochSolutions.find(successorEpoch);
-            STORM_LOG_ASSERT(successorSolIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
-            subSolutions.emplace(successorEpoch, &successorSolIt->second);
+    {
+        // The solutions of the successor epochs are neither erased nor spilled before the solution for this epoch is set
+        std::lock_guard<std::mutex> lock(epochSolutionsMutex);
+        for (auto const& step : possibleEpochSteps) {
+            Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
+            if (successorEpoch != epoch && subSolutions.count(successorEpoch) == 0) {
+                auto successorSolIt = epochSolutions.find(successorEpoch);
+                STORM_LOG_ASSERT(successorSolIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
+                if (successorSolIt->second.spillFilePosition) {
+                    loadEpochSolution(successorEpoch, successorSolIt->second);
+                }
+                ++successorSolIt->second.numberOfReaders;
+                subSolutions.emplace(successorEpoch, &successorSolIt->second);
+            }
         }
+        spillEpochSolutions();
     }
-    epochModel.stepSolutions.resize(epochModel.stepChoices.getNumberOfSetBits());
-    auto stepSolIt = epochModel.stepSolutions.begin();
-    for (auto reducedChoice : epochModel.stepChoices) {
-        uint64_t productChoice = epochModelToProductChoiceMap[reducedChoice];
+    slot.epochModel.stepSolutions.resize(slot.epochModel.stepChoices.getNumberOfSetBits());
+    auto stepSolIt = slot.epochModel.stepSolutions.begin();
+    for (auto reducedChoice : slot.epochModel.stepChoices) {
+        uint64_t productChoice = slot.epochModelToProductChoiceMap[reducedChoice];
         uint64_t productState = productModel->getProductStateFromChoice(productChoice);
         auto const& memoryState = productModel->getMemoryState(productState);
         Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, productModel->getSteps()[productChoice]);
@@ -447,7 +476,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         // a) there is an upper bounded subObjective that is __still_relevant__ but the corresponding reward bound is passed after taking the choice
         // b) there is a lower bounded subObjective and the corresponding reward bound is not passed yet.
         for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-            bool rewardEarned = !storm::utility::isZero(epochModel.objectiveRewards[objIndex][reducedChoice]);
+            bool rewardEarned = !storm::utility::isZero(slot.epochModel.objectiveRewards[objIndex][reducedChoice]);
             if (rewardEarned) {
                 for (auto dim : objectiveDimensions[objIndex]) {
                     if ((dimensions[dim].boundType == DimensionBoundType::UpperBound) == epochManager.isBottomDimension(successorEpoch, dim) &&
@@ -457,7 +486,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
                     }
                 }
             }
-            epochModel.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
+            slot.epochModel.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
         }
         // compute the solution for the stepChoices
         // For optimization purposes, we distinguish the case where the memory state does not have to be transformed
@@ -490,32 +519,32 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         ++stepSolIt;
     }
 
-    assert(epochModel.objectiveRewards.size() == objectives.size());
-    assert(epochModel.objectiveRewardFilter.size() == objectives.size());
-    assert(epochModel.epochMatrix.getRowCount() == epochModel.stepChoices.size());
-    assert(epochModel.stepChoices.size() == epochModel.objectiveRewards.front().size());
-    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewards.back().size());
-    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewardFilter.front().size());
-    assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
-    assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
+    assert(slot.epochModel.objectiveRewards.size() == objectives.size());
+    assert(slot.epochModel.objectiveRewardFilter.size() == objectives.size());
+    assert(slot.epochModel.epochMatrix.getRowCount() == slot.epochModel.stepChoices.size());
+    assert(slot.epochModel.stepChoices.size() == slot.epochModel.objectiveRewards.front().size());
+    assert(slot.epochModel.objectiveRewards.front().size() == slot.epochModel.objectiveRewards.back().size());
+    assert(slot.epochModel.objectiveRewards.front().size() == slot.epochModel.objectiveRewardFilter.front().size());
+    assert(slot.epochModel.objectiveRewards.back().size() == slot.epochModel.objectiveRewardFilter.back().size());
+    assert(slot.epochModel.stepChoices.getNumberOfSetBits() == slot.epochModel.stepSolutions.size());
 
-    currentEpoch = epoch;
+    slot.currentEpoch = epoch;
     /*
     std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << '\n';
-    std::cout << "Matrix: \n" << epochModel.epochMatrix << '\n';
-    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << '\n';
-    std::cout << "steps: " << epochModel.stepChoices << '\n';
+    std::cout << "Matrix: \n" << slot.epochModel.epochMatrix << '\n';
+    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(slot.epochModel.objectiveRewards[0]) << '\n';
+    std::cout << "steps: " << slot.epochModel.stepChoices << '\n';
     std::cout << "step solutions: ";
-    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
-        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
+    for (int i = 0; i < slot.epochModel.stepSolutions.size(); ++i) {
+        std::cout << "   " << slot.epochModel.stepSolutions[i].weightedValue;
     }
     std::cout << '\n';
     */
-    return epochModel;
+    return slot.epochModel;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
-void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(Epoch const& epoch) {
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(Epoch const& epoch, EpochModelSlot& slot) {
     EpochClass epochClass = epochManager.getEpochClass(epoch);
     // std::cout << "Setting epoch class for epoch " << epochManager.toString(epoch) << '\n';
     auto productObjectiveRewards = productModel->computeObjectiveRewards(epochClass, objectives);
@@ -528,7 +557,7 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
         }
         ++choice;
     }
-    epochModel.epochMatrix = productModel->getProduct().getTransitionMatrix().filterEntries(~stepChoices);
+    slot.epochModel.epochMatrix = productModel->getProduct().getTransitionMatrix().filterEntries(~stepChoices);
     // redirect transitions for the case where the lower reward bounds are not met yet
     storm::storage::BitVector violatedLowerBoundedDimensions(dimensions.size(), false);
     for (uint64_t dim = 0; dim < dimensions.size(); ++dim) {
@@ -537,9 +566,9 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
         }
     }
     if (!violatedLowerBoundedDimensions.empty()) {
-        for (uint64_t state = 0; state < epochModel.epochMatrix.getRowGroupCount(); ++state) {
+        for (uint64_t state = 0; state < slot.epochModel.epochMatrix.getRowGroupCount(); ++state) {
             auto const& memoryState = productModel->getMemoryState(state);
-            for (auto& entry : epochModel.epochMatrix.getRowGroup(state)) {
+            for (auto& entry : slot.epochModel.epochMatrix.getRowGroup(state)) {
                 entry.setColumn(productModel->transformProductState(entry.getColumn(), epochClass, memoryState));
             }
         }
@@ -557,11 +586,11 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
     storm::storage::BitVector productInStates = productModel->getInStates(epochClass);
     // The epoch model only needs to consider the states that are reachable from a relevant state
     storm::storage::BitVector consideredStates =
-        storm::utility::graph::getReachableStates(epochModel.epochMatrix, productInStates, allProductStates, ~allProductStates);
+        storm::utility::graph::getReachableStates(slot.epochModel.epochMatrix, productInStates, allProductStates, ~allProductStates);
 
     // We assume that there is no end component in which objective reward is earned
-    STORM_LOG_ASSERT(!storm::utility::graph::checkIfECWithChoiceExists(epochModel.epochMatrix, epochModel.epochMatrix.transpose(true), allProductStates,
-                                                                       ~zeroObjRewardChoices & ~stepChoices),
+    STORM_LOG_ASSERT(!storm::utility::graph::checkIfECWithChoiceExists(slot.epochModel.epochMatrix, slot.epochModel.epochMatrix.transpose(true),
+                                                                       allProductStates, ~zeroObjRewardChoices & ~stepChoices),
                      "There is a scheduler that yields infinite reward for one objective. This case should be excluded");
 
     // Create the epoch model matrix
@@ -569,11 +598,11 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
     if (model.isOfType(storm::models::ModelType::Dtmc)) {
         assert(zeroObjRewardChoices.size() == productModel->getProduct().getNumberOfStates());
         assert(stepChoices.size() == productModel->getProduct().getNumberOfStates());
-        STORM_LOG_ASSERT(epochModel.equationSolverProblemFormat.is_initialized(), "Linear equation problem format was not set.");
-        bool convertToEquationSystem = epochModel.equationSolverProblemFormat.get() == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+        STORM_LOG_ASSERT(slot.epochModel.equationSolverProblemFormat.is_initialized(), "Linear equation problem format was not set.");
+        bool convertToEquationSystem = slot.epochModel.equationSolverProblemFormat.get() == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
         // For DTMCs we consider the subsystem induced by the considered states.
         // The transitions for states with zero reward are filtered out to guarantee a unique solution of the eq-system.
-        auto backwardTransitions = epochModel.epochMatrix.transpose(true);
+        auto backwardTransitions = slot.epochModel.epochMatrix.transpose(true);
         storm::storage::BitVector nonZeroRewardStates =
             storm::utility::graph::performProbGreater0(backwardTransitions, consideredStates, consideredStates & (~zeroObjRewardChoices | stepChoices));
         // If there is at least one considered state with reward zero, we have to add a 'zero-reward-state' to the epoch model.
@@ -586,85 +615,85 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
         storm::storage::SparseMatrixBuilder<ValueType> builder;
         if (!nonZeroRewardStates.empty()) {
             builder = storm::storage::SparseMatrixBuilder<ValueType>(
-                epochModel.epochMatrix.getSubmatrix(true, nonZeroRewardStates, nonZeroRewardStates, convertToEquationSystem));
+                slot.epochModel.epochMatrix.getSubmatrix(true, nonZeroRewardStates, nonZeroRewardStates, convertToEquationSystem));
         }
         if (requiresZeroRewardState) {
             if (convertToEquationSystem) {
                 // add a diagonal entry
                 builder.addNextValue(zeroRewardInState, zeroRewardInState, storm::utility::zero<ValueType>());
             }
-            epochModel.epochMatrix = builder.build(numEpochModelStates, numEpochModelStates);
+            slot.epochModel.epochMatrix = builder.build(numEpochModelStates, numEpochModelStates);
         } else {
             assert(!nonZeroRewardStates.empty());
-            epochModel.epochMatrix = builder.build();
+            slot.epochModel.epochMatrix = builder.build();
         }
         if (convertToEquationSystem) {
-            epochModel.epochMatrix.convertToEquationSystem();
+            slot.epochModel.epochMatrix.convertToEquationSystem();
         }
 
-        epochModelToProductChoiceMap.clear();
-        epochModelToProductChoiceMap.reserve(numEpochModelStates);
+        slot.epochModelToProductChoiceMap.clear();
+        slot.epochModelToProductChoiceMap.reserve(numEpochModelStates);
         productToEpochModelStateMapping.assign(nonZeroRewardStates.size(), zeroRewardInState);
         for (auto productState : nonZeroRewardStates) {
-            productToEpochModelStateMapping[productState] = epochModelToProductChoiceMap.size();
-            epochModelToProductChoiceMap.push_back(productState);
+            productToEpochModelStateMapping[productState] = slot.epochModelToProductChoiceMap.size();
+            slot.epochModelToProductChoiceMap.push_back(productState);
         }
         if (requiresZeroRewardState) {
             uint64_t zeroRewardProductState = (consideredStates & ~nonZeroRewardStates).getNextSetIndex(0);
             assert(zeroRewardProductState < consideredStates.size());
-            epochModelToProductChoiceMap.push_back(zeroRewardProductState);
+            slot.epochModelToProductChoiceMap.push_back(zeroRewardProductState);
         }
     } else if (model.isOfType(storm::models::ModelType::Mdp)) {
         // Eliminate zero-reward end components
-        auto ecElimResult = storm::transformer::EndComponentEliminator<ValueType>::transform(epochModel.epochMatrix, consideredStates,
+        auto ecElimResult = storm::transformer::EndComponentEliminator<ValueType>::transform(slot.epochModel.epochMatrix, consideredStates,
                                                                                              zeroObjRewardChoices & ~stepChoices, consideredStates);
-        epochModel.epochMatrix = std::move(ecElimResult.matrix);
-        epochModelToProductChoiceMap = std::move(ecElimResult.newToOldRowMapping);
+        slot.epochModel.epochMatrix = std::move(ecElimResult.matrix);
+        slot.epochModelToProductChoiceMap = std::move(ecElimResult.newToOldRowMapping);
         productToEpochModelStateMapping = std::move(ecElimResult.oldToNewStateMapping);
     } else {
         STORM_LOG_THROW(false, storm::exceptions::UnexpectedException, "Unsupported model type.");
     }
 
-    epochModel.stepChoices = storm::storage::BitVector(epochModel.epochMatrix.getRowCount(), false);
-    for (uint64_t choice = 0; choice < epochModel.epochMatrix.getRowCount(); ++choice) {
-        if (stepChoices.get(epochModelToProductChoiceMap[choice])) {
-            epochModel.stepChoices.set(choice, true);
+    slot.epochModel.stepChoices = storm::storage::BitVector(slot.epochModel.epochMatrix.getRowCount(), false);
+    for (uint64_t choice = 0; choice < slot.epochModel.epochMatrix.getRowCount(); ++choice) {
+        if (stepChoices.get(slot.epochModelToProductChoiceMap[choice])) {
+            slot.epochModel.stepChoices.set(choice, true);
         }
     }
 
-    epochModel.objectiveRewards.clear();
+    slot.epochModel.objectiveRewards.clear();
     for (uint64_t objIndex = 0; objIndex < objectives.size(); ++objIndex) {
         std::vector<ValueType> const& productObjRew = productObjectiveRewards[objIndex];
         std::vector<ValueType> reducedModelObjRewards;
-        reducedModelObjRewards.reserve(epochModel.epochMatrix.getRowCount());
-        for (auto const& productChoice : epochModelToProductChoiceMap) {
+        reducedModelObjRewards.reserve(slot.epochModel.epochMatrix.getRowCount());
+        for (auto const& productChoice : slot.epochModelToProductChoiceMap) {
             reducedModelObjRewards.push_back(productObjRew[productChoice]);
         }
         // Check if the objective is violated in the current epoch
         if (!violatedLowerBoundedDimensions.isDisjointFrom(objectiveDimensions[objIndex])) {
-            storm::utility::vector::setVectorValues(reducedModelObjRewards, ~epochModel.stepChoices, storm::utility::zero<ValueType>());
+            storm::utility::vector::setVectorValues(reducedModelObjRewards, ~slot.epochModel.stepChoices, storm::utility::zero<ValueType>());
         }
-        epochModel.objectiveRewards.push_back(std::move(reducedModelObjRewards));
+        slot.epochModel.objectiveRewards.push_back(std::move(reducedModelObjRewards));
     }
 
-    epochModel.epochInStates = storm::storage::BitVector(epochModel.epochMatrix.getRowGroupCount(), false);
+    slot.epochModel.epochInStates = storm::storage::BitVector(slot.epochModel.epochMatrix.getRowGroupCount(), false);
     for (auto productState : productInStates) {
-        STORM_LOG_ASSERT(productToEpochModelStateMapping[productState] < epochModel.epochMatrix.getRowGroupCount(),
+        STORM_LOG_ASSERT(productToEpochModelStateMapping[productState] < slot.epochModel.epochMatrix.getRowGroupCount(),
                          "Selected product state does not exist in the epoch model.");
-        epochModel.epochInStates.set(productToEpochModelStateMapping[productState], true);
+        slot.epochModel.epochInStates.set(productToEpochModelStateMapping[productState], true);
     }
 
     std::vector<uint64_t> toEpochModelInStatesMap(productModel->getProduct().getNumberOfStates(), std::numeric_limits<uint64_t>::max());
-    std::vector<uint64_t> epochModelStateToInStateMap = epochModel.epochInStates.getNumberOfSetBitsBeforeIndices();
+    std::vector<uint64_t> epochModelStateToInStateMap = slot.epochModel.epochInStates.getNumberOfSetBitsBeforeIndices();
     for (auto productState : productInStates) {
         toEpochModelInStatesMap[productState] = epochModelStateToInStateMap[productToEpochModelStateMapping[productState]];
     }
-    productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
+    slot.productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
 
-    epochModel.objectiveRewardFilter.clear();
-    for (auto const& objRewards : epochModel.objectiveRewards) {
-        epochModel.objectiveRewardFilter.push_back(storm::utility::vector::filterZero(objRewards));
-        epochModel.objectiveRewardFilter.back().complement();
+    slot.epochModel.objectiveRewardFilter.clear();
+    for (auto const& objRewards : slot.epochModel.objectiveRewards) {
+        slot.epochModel.objectiveRewardFilter.push_back(storm::utility::vector::filterZero(objRewards));
+        slot.epochModel.objectiveRewardFilter.back().complement();
     }
 }
 
@@ -672,7 +701,9 @@ template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setEquationSystemFormatForEpochModel(
     storm::solver::LinearEquationSolverProblemFormat eqSysFormat) {
     STORM_LOG_ASSERT(model.isOfType(storm::models::ModelType::Dtmc), "Trying to set the equation problem format although the model is not deterministic.");
-    epochModel.equationSolverProblemFormat = eqSysFormat;
+    for (auto& slot : epochModelSlots) {
+        slot.epochModel.equationSolverProblemFormat = eqSysFormat;
+    }
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -863,23 +894,36 @@ boost::optional<ValueType> MultiDimensionalRewardUnfolding<ValueType, SingleObje
 
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
-    STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
-    STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+    setSolutionForCurrentEpoch(std::move(inStateSolutions), epochModelSlots.front());
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions,
+                                                                                 EpochModelSlot& slot) {
+    STORM_LOG_ASSERT(slot.currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
+    STORM_LOG_ASSERT(inStateSolutions.size() == slot.epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
 
     std::set<Epoch> predecessorEpochs, successorEpochs;
     for (auto const& step : possibleEpochSteps) {
-        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+        epochManager.gatherPredecessorEpochs(predecessorEpochs, slot.currentEpoch.get(), step);
+        successorEpochs.insert(epochManager.getSuccessorEpoch(slot.currentEpoch.get(), step));
     }
-    predecessorEpochs.erase(currentEpoch.get());
-    successorEpochs.erase(currentEpoch.get());
+    predecessorEpochs.erase(slot.currentEpoch.get());
+    successorEpochs.erase(slot.currentEpoch.get());
 
+    std::lock_guard<std::mutex> lock(epochSolutionsMutex);
     // clean up solutions that are not needed anymore
     for (auto const& successorEpoch : successorEpochs) {
         auto successorEpochSolutionIt = epochSolutions.find(successorEpoch);
         STORM_LOG_ASSERT(successorEpochSolutionIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
+        if (successorEpochSolutionIt->second.numberOfReaders > 0) {
+            --successorEpochSolutionIt->second.numberOfReaders;
+        }
         --successorEpochSolutionIt->second.count;
         if (successorEpochSolutionIt->second.count == 0) {
+            if (!successorEpochSolutionIt->second.spillFilePosition) {
+                epochSolutionMemory -= getMemoryOfEpochSolution(successorEpochSolutionIt->second);
+            }
             epochSolutions.erase(successorEpochSolutionIt);
         }
     }
@@ -887,17 +931,215 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutio
     // add the new solution
     EpochSolution solution;
     solution.count = predecessorEpochs.size();
-    solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
+    solution.productStateToSolutionVectorMap = slot.productStateToEpochModelInStateMap;
     solution.solutions = std::move(inStateSolutions);
-    epochSolutions[currentEpoch.get()] = std::move(solution);
+    epochSolutionMemory += getMemoryOfEpochSolution(solution);
+    auto previousSolutionIt = epochSolutions.find(slot.currentEpoch.get());
+    if (previousSolutionIt != epochSolutions.end() && !previousSolutionIt->second.spillFilePosition) {
+        // The epoch was analyzed before, e.g., for a different weight vector
+        epochSolutionMemory -= getMemoryOfEpochSolution(previousSolutionIt->second);
+    }
+    epochSolutions[slot.currentEpoch.get()] = std::move(solution);
+    if (epochSolutionMemoryLimit > 0) {
+        spillCandidates.push_back(slot.currentEpoch.get());
+        spillEpochSolutions();
+    }
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
-typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const&
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setMemoryLimitForEpochSolutions(uint64_t bytes) {
+    std::lock_guard<std::mutex> lock(epochSolutionsMutex);
+    epochSolutionMemoryLimit = bytes;
+    spillEpochSolutions();
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getMemoryOfEpochSolution(EpochSolution const& solution) const {
+    if constexpr (SingleObjectiveMode) {
+        return solution.solutions.size() * sizeof(ValueType);
+    } else {
+        return solution.solutions.size() * (sizeof(SolutionType) + objectives.size() * sizeof(ValueType));
+    }
+}
+
+namespace {
+template<typename ValueType>
+void writeSpilledValue(std::FILE* file, ValueType const& value) {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        STORM_LOG_THROW(std::fwrite(&value, sizeof(double), 1, file) == 1, storm::exceptions::FileIoException, "Unable to spill epoch solutions.");
+    } else {
+        std::string representation = storm::utility::to_string(value);
+        uint64_t length = representation.size();
+        STORM_LOG_THROW(std::fwrite(&length, sizeof(uint64_t), 1, file) == 1 && std::fwrite(representation.data(), 1, length, file) == length,
+                        storm::exceptions::FileIoException, "Unable to spill epoch solutions.");
+    }
+}
+
+template<typename ValueType>
+ValueType readSpilledValue(std::FILE* file) {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        double value;
+        STORM_LOG_THROW(std::fread(&value, sizeof(double), 1, file) == 1, storm::exceptions::FileIoException, "Unable to load spilled epoch solutions.");
+        return value;
+    } else {
+        uint64_t length;
+        STORM_LOG_THROW(std::fread(&length, sizeof(uint64_t), 1, file) == 1, storm::exceptions::FileIoException, "Unable to load spilled epoch solutions.");
+        std::string representation(length, ' ');
+        STORM_LOG_THROW(std::fread(&representation[0], 1, length, file) == length, storm::exceptions::FileIoException,
+                        "Unable to load spilled epoch solutions.");
+        return storm::utility::convertNumber<ValueType>(representation);
+    }
+}
+}  // namespace
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::spillEpochSolutions() {
+    if (epochSolutionMemoryLimit == 0) {
+        return;
+    }
+    // Every candidate is considered at most once so that we terminate even if all remaining solutions are in use.
+    uint64_t remainingCandidates = spillCandidates.size();
+    while (epochSolutionMemory > epochSolutionMemoryLimit && remainingCandidates > 0) {
+        --remainingCandidates;
+        Epoch epoch = std::move(spillCandidates.front());
+        spillCandidates.pop_front();
+        auto solutionIt = epochSolutions.find(epoch);
+        if (solutionIt == epochSolutions.end() || solutionIt->second.spillFilePosition) {
+            continue;
+        }
+        EpochSolution& solution = solutionIt->second;
+        if (solution.numberOfReaders > 0) {
+            spillCandidates.push_back(std::move(epoch));
+            continue;
+        }
+
+        if (!spillFile) {
+            spillFile.reset(std::tmpfile());
+            STORM_LOG_THROW(spillFile, storm::exceptions::FileIoException, "Unable to create a temporary file for spilling epoch solutions.");
+            STORM_LOG_INFO("Spilling epoch solutions as they exceed the memory limit of " << epochSolutionMemoryLimit << " bytes.");
+        }
+        STORM_LOG_THROW(std::fseek(spillFile.get(), 0, SEEK_END) == 0, storm::exceptions::FileIoException, "Unable to spill epoch solutions.");
+        long position = std::ftell(spillFile.get());
+        uint64_t numberOfSolutions = solution.solutions.size();
+        STORM_LOG_THROW(position >= 0 && std::fwrite(&numberOfSolutions, sizeof(uint64_t), 1, spillFile.get()) == 1, storm::exceptions::FileIoException,
+                        "Unable to spill epoch solutions.");
+        for (auto const& stateSolution : solution.solutions) {
+            if constexpr (SingleObjectiveMode) {
+                writeSpilledValue(spillFile.get(), stateSolution);
+            } else {
+                for (auto const& value : stateSolution) {
+                    writeSpilledValue(spillFile.get(), value);
+                }
+            }
+        }
+        epochSolutionMemory -= getMemoryOfEpochSolution(solution);
+        std::vector<SolutionType>().swap(solution.solutions);
+        solution.spillFilePosition = position;
+    }
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::loadEpochSolution(Epoch const& epoch, EpochSolution& solution) {
+    STORM_LOG_ASSERT(solution.spillFilePosition && spillFile, "Tried to load an epoch solution that was not spilled.");
+    STORM_LOG_THROW(std::fseek(spillFile.get(), solution.spillFilePosition.get(), SEEK_SET) == 0, storm::exceptions::FileIoException,
+                    "Unable to load spilled epoch solutions.");
+    uint64_t numberOfSolutions;
+    STORM_LOG_THROW(std::fread(&numberOfSolutions, sizeof(uint64_t), 1, spillFile.get()) == 1, storm::exceptions::FileIoException,
+                    "Unable to load spilled epoch solutions.");
+    solution.solutions.reserve(numberOfSolutions);
+    for (uint64_t index = 0; index < numberOfSolutions; ++index) {
+        if constexpr (SingleObjectiveMode) {
+            solution.solutions.push_back(readSpilledValue<ValueType>(spillFile.get()));
+        } else {
+            SolutionType stateSolution;
+            stateSolution.reserve(objectives.size());
+            for (uint64_t objIndex = 0; objIndex < objectives.size(); ++objIndex) {
+                stateSolution.push_back(readSpilledValue<ValueType>(spillFile.get()));
+            }
+            solution.solutions.push_back(std::move(stateSolution));
+        }
+    }
+    solution.spillFilePosition = boost::none;
+    epochSolutionMemory += getMemoryOfEpochSolution(solution);
+    spillCandidates.push_back(epoch);
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+bool MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochs(std::vector<Epoch> const& epochs, uint64_t numberOfThreads,
+                                                                                    EpochAnalyzer const& analyzer,
+                                                                                    std::function<void(Epoch const&)> const& solvedEpochCallback) {
+    if (numberOfThreads <= 1 || epochs.size() <= 1) {
+        for (auto const& epoch : epochs) {
+            auto& epochModel = setCurrentEpoch(epoch);
+            setSolutionForCurrentEpoch(analyzer(0, epochModel));
+            if (solvedEpochCallback) {
+                solvedEpochCallback(epoch);
+            }
+            if (storm::utility::resources::isTerminate()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Every epoch depends on its successor epochs that are analyzed as well.
+    std::map<Epoch, uint64_t> epochIndices;
+    for (uint64_t epochIndex = 0; epochIndex < epochs.size(); ++epochIndex) {
+        epochIndices.emplace(epochs[epochIndex], epochIndex);
+    }
+    std::vector<uint64_t> dependencyCounts(epochs.size(), 0);
+    std::vector<std::vector<uint64_t>> predecessorIndices(epochs.size());
+    for (uint64_t epochIndex = 0; epochIndex < epochs.size(); ++epochIndex) {
+        std::set<uint64_t> successorIndices;
+        for (auto const& step : possibleEpochSteps) {
+            auto successorIt = epochIndices.find(epochManager.getSuccessorEpoch(epochs[epochIndex], step));
+            if (successorIt != epochIndices.end() && successorIt->second != epochIndex) {
+                successorIndices.insert(successorIt->second);
+            }
+        }
+        dependencyCounts[epochIndex] = successorIndices.size();
+        for (auto successorIndex : successorIndices) {
+            predecessorIndices[successorIndex].push_back(epochIndex);
+        }
+    }
+    std::vector<uint64_t> dependentOffsets, dependents;
+    dependentOffsets.reserve(epochs.size() + 1);
+    for (auto const& predecessors : predecessorIndices) {
+        dependentOffsets.push_back(dependents.size());
+        dependents.insert(dependents.end(), predecessors.begin(), predecessors.end());
+    }
+    dependentOffsets.push_back(dependents.size());
+
+    // Each thread builds its epoch models in its own slot.
+    numberOfThreads = std::min<uint64_t>(numberOfThreads, epochs.size());
+    while (epochModelSlots.size() < numberOfThreads) {
+        epochModelSlots.emplace_back();
+        epochModelSlots.back().epochModel.equationSolverProblemFormat = epochModelSlots.front().epochModel.equationSolverProblemFormat;
+    }
+    return storm::utility::parallel::forEachInDependencyOrder(numberOfThreads, dependencyCounts, dependentOffsets, dependents,
+                                                              [&](uint64_t threadIndex, uint64_t epochIndex) {
+                                                                  EpochModelSlot& slot = epochModelSlots[threadIndex];
+                                                                  auto& epochModel = setCurrentEpoch(epochs[epochIndex], slot);
+                                                                  setSolutionForCurrentEpoch(analyzer(threadIndex, epochModel), slot);
+                                                                  if (solvedEpochCallback) {
+                                                                      solvedEpochCallback(epochs[epochIndex]);
+                                                                  }
+                                                                  return !storm::utility::resources::isTerminate();
+                                                              });
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType
 MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(Epoch const& epoch, uint64_t const& productState) {
+    std::lock_guard<std::mutex> lock(epochSolutionsMutex);
     auto epochSolutionIt = epochSolutions.find(epoch);
     STORM_LOG_ASSERT(epochSolutionIt != epochSolutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
-    return getStateSolution(epochSolutionIt->second, productState);
+    if (epochSolutionIt->second.spillFilePosition) {
+        loadEpochSolution(epoch, epochSolutionIt->second);
+    }
+    SolutionType result = getStateSolution(epochSolutionIt->second, productState);
+    spillEpochSolutions();
+    return result;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <mutex>
+
 #include <boost/optional.hpp>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
@@ -28,6 +33,9 @@ class MultiDimensionalRewardUnfolding {
 
     typedef typename std::conditional<SingleObjectiveMode, ValueType, std::vector<ValueType>>::type SolutionType;
 
+    // Computes the solution for the given epoch model. The first argument is the index of the thread that analyzes the epoch.
+    typedef std::function<std::vector<SolutionType>(uint64_t, EpochModel<ValueType, SingleObjectiveMode>&)> EpochAnalyzer;
+
     /*
      *
      * @param model The (preprocessed) model
@@ -62,6 +70,13 @@ class MultiDimensionalRewardUnfolding {
      */
     std::vector<Epoch> getEpochComputationOrder(Epoch const& startEpoch, bool stopAtComputedEpochs = false);
 
+    /*!
+     * Computes a sequence of epochs that need to be analyzed to get a result at each of the given start epochs. Epochs that are needed for several
+     * start epochs occur only once.
+     * @param stopAtComputedEpochs if set, the search for epochs that need to be computed is stopped at epochs that already have been computed earlier.
+     */
+    std::vector<Epoch> getEpochComputationOrder(std::vector<Epoch> const& startEpochs, bool stopAtComputedEpochs = false);
+
     EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch);
 
     void setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat);
@@ -78,14 +93,44 @@ class MultiDimensionalRewardUnfolding {
     boost::optional<ValueType> getLowerObjectiveBound(uint64_t objectiveIndex = 0);
 
     void setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions);
+
+    /*!
+     * Analyzes the given epochs with the given number of threads, where an epoch is analyzed as soon as the solutions of all its successor epochs are
+     * available. Each thread keeps its own epoch model, i.e., the given analyzer may be invoked concurrently but never twice at the same time with the
+     * same thread index. With a single thread, the epochs are analyzed in the given order.
+     * @param epochs the epochs to analyze. The successors of each epoch need to be contained in this list or need to be analyzed before.
+     * @param solvedEpochCallback if given, this is invoked (possibly concurrently) for each epoch right after its solution is set. At this point, the
+     * solution for the epoch is still available, e.g., via getInitialStateResult.
+     * @return true iff all epochs were analyzed, i.e., the analysis was not aborted.
+     */
+    bool analyzeEpochs(std::vector<Epoch> const& epochs, uint64_t numberOfThreads, EpochAnalyzer const& analyzer,
+                       std::function<void(Epoch const&)> const& solvedEpochCallback = {});
+
     SolutionType getInitialStateResult(Epoch const& epoch);  // Assumes that the initial state is unique
     SolutionType getInitialStateResult(Epoch const& epoch, uint64_t initialStateIndex);
 
+    /*!
+     * Limits the (estimated) memory in bytes that is consumed by the stored epoch solutions. If the limit is exceeded, the solutions that are stored
+     * the longest and are currently not needed for building an epoch model are spilled to a temporary file. They are loaded again once they are
+     * needed. Zero means that there is no limit.
+     */
+    void setMemoryLimitForEpochSolutions(uint64_t bytes);
+
     EpochManager const& getEpochManager() const;
     Dimension<ValueType> const& getDimension(uint64_t dim) const;
 
    private:
-    void setCurrentEpochClass(Epoch const& epoch);
+    // The epoch model of the epoch that is currently analyzed together with its relation to the product model.
+    struct EpochModelSlot {
+        EpochModel<ValueType, SingleObjectiveMode> epochModel;
+        boost::optional<Epoch> currentEpoch;
+        std::vector<uint64_t> epochModelToProductChoiceMap;
+        std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
+    };
+
+    EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch, EpochModelSlot& slot);
+    void setCurrentEpochClass(Epoch const& epoch, EpochModelSlot& slot);
+    void setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions, EpochModelSlot& slot);
     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
 
     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -114,13 +159,30 @@ class MultiDimensionalRewardUnfolding {
     template<bool SO = SingleObjectiveMode, typename std::enable_if<!SO, int>::type = 0>
     std::string solutionToString(SolutionType const& solution) const;
 
-    SolutionType const& getStateSolution(Epoch const& epoch, uint64_t const& productState);
+    SolutionType getStateSolution(Epoch const& epoch, uint64_t const& productState);
     struct EpochSolution {
         uint64_t count;
         std::shared_ptr<std::vector<uint64_t> const> productStateToSolutionVectorMap;
         std::vector<SolutionType> solutions;
+        // The number of epoch models that are currently built from this solution. Such solutions are not spilled.
+        uint64_t numberOfReaders = 0;
+        // If the solutions are spilled, their position in the spill file.
+        boost::optional<long> spillFilePosition;
     };
     std::map<Epoch, EpochSolution> epochSolutions;
+    // Guards the modifications of the solution map (including spilling) when epochs are analyzed concurrently.
+    std::mutex epochSolutionsMutex;
+
+    // The following methods assume that the solution map is locked.
+    uint64_t getMemoryOfEpochSolution(EpochSolution const& solution) const;
+    void spillEpochSolutions();
+    void loadEpochSolution(Epoch const& epoch, EpochSolution& solution);
+
+    uint64_t epochSolutionMemoryLimit = 0;
+    uint64_t epochSolutionMemory = 0;
+    // The stored epochs in the order in which they are considered for spilling. May contain epochs that are already spilled or released.
+    std::deque<Epoch> spillCandidates;
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> spillFile = {nullptr, &std::fclose};
     EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
     SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
 
@@ -129,12 +191,10 @@ class MultiDimensionalRewardUnfolding {
 
     std::unique_ptr<ProductModel<ValueType>> productModel;
 
-    std::vector<uint64_t> epochModelToProductChoiceMap;
-    std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
     std::set<Epoch> possibleEpochSteps;
 
-    EpochModel<ValueType, SingleObjectiveMode> epochModel;
-    boost::optional<Epoch> currentEpoch;
+    // The first slot is used by the sequential interface. Further slots are added for the threads of analyzeEpochs.
+    std::vector<EpochModelSlot> epochModelSlots = std::vector<EpochModelSlot>(1);
 
     EpochManager epochManager;
 
@@ -2,9 +2,11 @@
 
 #include <boost/optional.hpp>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <vector>
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
@@ -393,18 +395,29 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                                                 storm::logic::ProbabilityOperatorFormula const& boundedUntilOperator,
                                                 storm::storage::BitVector const& lowerBoundedDimensions, CostLimitClosure& satCostLimits,
                                                 CostLimitClosure& unsatCostLimits, MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding) {
+    rewardUnfolding.setMemoryLimitForEpochSolutions(env.modelchecker().getEpochSolutionMemoryLimit());
     auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
     auto upperBound = rewardUnfolding.getUpperObjectiveBound();
-    std::vector<ValueType> x, b;
-    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;  // Needed for MDP
-    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;         // Needed for DTMC
+    // Each thread that analyzes epochs uses its own vectors and solvers
+    uint64_t const numberOfThreads = env.modelchecker().getNumberOfEpochThreads();
+    std::vector<std::vector<ValueType>> threadX(numberOfThreads), threadB(numberOfThreads);
+    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> minMaxSolvers(numberOfThreads);  // Needed for MDP
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> linEqSolvers(numberOfThreads);         // Needed for DTMC
     if (!model.isNondeterministicModel()) {
         rewardUnfolding.setEquationSystemFormatForEpochModel(storm::solver::GeneralLinearEquationSolverFactory<ValueType>().getEquationProblemFormat(env));
     }
 
     swExploration.start();
+    // The epochs that are analyzed for a candidate include the epochs of (almost) all smaller cost limits. Until cost limits that satisfy and
+    // violate the property are both found, we therefore double the candidate sum (exponential search). Afterwards, the sums are considered one
+    // by one starting from the first skipped sum such that no cost limit is missed, e.g., if the costs only allow for every second epoch.
+    // Candidates that are already covered by the (un)sat cost limits are skipped quickly.
+    bool exponentialSearch = true;
+    bool foundSatCostLimit = false;
+    bool foundUnsatCostLimit = false;
+    auto const initialStartEpoch = rewardUnfolding.getStartEpoch(true);
     bool progress = true;
-    for (CostLimit candidateCostLimitSum(0); progress; ++candidateCostLimitSum.get()) {
+    for (CostLimit candidateCostLimitSum(0); progress;) {
         CostLimits currentCandidate(satCostLimits.dimension(), CostLimit(0));
         if (!currentCandidate.empty()) {
             currentCandidate.back() = candidateCostLimitSum;
@@ -412,11 +425,14 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
         // We can still have progress if one of the closures is empty and the other is not full.
         // This ensures that we do not terminate too early in case that the (un)satCostLimits are initially non-empty.
         progress = (satCostLimits.empty() && !unsatCostLimits.full()) || (unsatCostLimits.empty() && !satCostLimits.full());
+        // The candidates with the same sum are checked together: epochs that are needed for several candidates are analyzed only once and the epochs
+        // of different candidates can be analyzed concurrently.
+        std::vector<EpochManager::Epoch> startEpochs;
         do {
             if (!satCostLimits.contains(currentCandidate) && !unsatCostLimits.contains(currentCandidate)) {
                 progress = true;
                 // Transform candidate cost limits to an appropriate start epoch
-                auto startEpoch = rewardUnfolding.getStartEpoch(true);
+                auto startEpoch = initialStartEpoch;
                 auto costLimitIt = currentCandidate.begin();
                 for (auto dim : consideredDimensions) {
                     if (lowerBoundedDimensions.get(dim)) {
@@ -431,49 +447,83 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                     ++costLimitIt;
                 }
                 STORM_LOG_DEBUG("Checking start epoch " << rewardUnfolding.getEpochManager().toString(startEpoch) << ".");
-                auto epochSequence = rewardUnfolding.getEpochComputationOrder(startEpoch, true);
-                for (auto const& epoch : epochSequence) {
-                    ++numCheckedEpochs;
-                    swEpochAnalysis.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+                startEpochs.push_back(startEpoch);
+            }
+        } while (getNextCandidateCostLimit(candidateCostLimitSum, currentCandidate));
+
+        if (!startEpochs.empty()) {
+            auto epochSequence = rewardUnfolding.getEpochComputationOrder(startEpochs, true);
+            // Epochs whose successors are all analyzed can be analyzed concurrently. The solution of an epoch might be released as soon as its
+            // predecessors are analyzed, so the results at the initial state are gathered right after an epoch is solved.
+            std::map<EpochManager::Epoch, ValueType> initialStateResults;
+            std::mutex initialStateResultsMutex;
+            numCheckedEpochs += epochSequence.size();
+            swEpochAnalysis.start();
+            rewardUnfolding.analyzeEpochs(
+                epochSequence, numberOfThreads,
+                [&](uint64_t threadIndex, auto& epochModel) {
                     if (model.isNondeterministicModel()) {
-                        rewardUnfolding.setSolutionForCurrentEpoch(
-                            epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), x, b, minMaxSolver, lowerBound, upperBound));
+                        return epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), threadX[threadIndex], threadB[threadIndex],
+                                                                 minMaxSolvers[threadIndex], lowerBound, upperBound);
                     } else {
-                        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(env, x, b, linEqSolver, lowerBound, upperBound));
+                        return epochModel.analyzeSingleObjective(env, threadX[threadIndex], threadB[threadIndex], linEqSolvers[threadIndex], lowerBound,
+                                                                 upperBound);
                     }
-                    swEpochAnalysis.stop();
-
+                },
+                [&](EpochManager::Epoch const& epoch) {
                     CostLimits epochAsCostLimits;
-                    if (translateEpochToCostLimits(epoch, startEpoch, consideredDimensions, lowerBoundedDimensions, rewardUnfolding.getEpochManager(),
+                    if (translateEpochToCostLimits(epoch, initialStartEpoch, consideredDimensions, lowerBoundedDimensions, rewardUnfolding.getEpochManager(),
                                                    epochAsCostLimits)) {
                         ValueType currValue = rewardUnfolding.getInitialStateResult(epoch);
-                        bool propertySatisfied;
-                        if (env.solver().isForceSoundness()) {
-                            ValueType sumOfEpochDimensions =
-                                storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getSumOfDimensions(epoch) + 1);
-                            auto lowerUpperValue = getLowerUpperBound(env, sumOfEpochDimensions, currValue);
-                            propertySatisfied = boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.first);
-                            if (propertySatisfied != boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.second)) {
-                                // unclear result due to insufficient precision.
-                                swExploration.stop();
-                                return false;
-                            }
-                        } else {
-                            propertySatisfied = boundedUntilOperator.getBound().isSatisfied(currValue);
-                        }
-                        if (propertySatisfied) {
-                            satCostLimits.insert(epochAsCostLimits);
-                        } else {
-                            unsatCostLimits.insert(epochAsCostLimits);
+                        std::lock_guard<std::mutex> lock(initialStateResultsMutex);
+                        initialStateResults.emplace(epoch, std::move(currValue));
+                    }
+                });
+            swEpochAnalysis.stop();
+
+            for (auto const& epoch : epochSequence) {
+                CostLimits epochAsCostLimits;
+                auto resultIt = initialStateResults.find(epoch);
+                if (resultIt != initialStateResults.end()) {
+                    translateEpochToCostLimits(epoch, initialStartEpoch, consideredDimensions, lowerBoundedDimensions, rewardUnfolding.getEpochManager(),
+                                               epochAsCostLimits);
+                    ValueType const& currValue = resultIt->second;
+                    bool propertySatisfied;
+                    if (env.solver().isForceSoundness()) {
+                        ValueType sumOfEpochDimensions =
+                            storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getSumOfDimensions(epoch) + 1);
+                        auto lowerUpperValue = getLowerUpperBound(env, sumOfEpochDimensions, currValue);
+                        propertySatisfied = boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.first);
+                        if (propertySatisfied != boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.second)) {
+                            // unclear result due to insufficient precision.
+                            swExploration.stop();
+                            return false;
                         }
+                    } else {
+                        propertySatisfied = boundedUntilOperator.getBound().isSatisfied(currValue);
+                    }
+                    if (propertySatisfied) {
+                        satCostLimits.insert(epochAsCostLimits);
+                        foundSatCostLimit = true;
+                    } else {
+                        unsatCostLimits.insert(epochAsCostLimits);
+                        foundUnsatCostLimit = true;
                     }
                 }
             }
-        } while (getNextCandidateCostLimit(candidateCostLimitSum, currentCandidate));
+        }
         if (!progress) {
             progress = !CostLimitClosure::unionFull(satCostLimits, unsatCostLimits);
         }
+        if (exponentialSearch && foundSatCostLimit && foundUnsatCostLimit) {
+            exponentialSearch = false;
+            // The doubling visits the sums 0, 1, 2, 4, 8, ..., so 3 is the first skipped sum.
+            candidateCostLimitSum.get() = std::min<uint64_t>(3, candidateCostLimitSum.get() + 1);
+        } else if (exponentialSearch) {
+            candidateCostLimitSum.get() += std::max<uint64_t>(1, candidateCostLimitSum.get());
+        } else {
+            ++candidateCostLimitSum.get();
+        }
     }
     swExploration.stop();
     return true;
@@ -81,7 +81,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
     STORM_LOG_THROW(checkTask.isOnlyInitialStatesRelevantSet(), storm::exceptions::IllegalArgumentException,
                     "Cannot compute long-run probabilities for all states.");
 
-    storm::storage::SparseMatrix<ValueType> backwardTransitions = this->getModel().getBackwardTransitions();
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions = this->getModel().getBackwardTransitions();
     storm::storage::BitVector maybeStates =
         storm::utility::graph::performProbGreater0(backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowCount(), true), psiStates);
 
@@ -152,7 +152,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
         ++index;
     }
 
-    storm::storage::SparseMatrix<ValueType> backwardTransitions = this->getModel().getBackwardTransitions();
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions = this->getModel().getBackwardTransitions();
 
     storm::storage::BitVector allStates(numberOfStates, true);
     maybeStates = storm::utility::graph::performProbGreater0(backwardTransitions, allStates, maybeStates);
@@ -242,7 +242,7 @@ SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeLongRunValues(sto
         }
         ++currentIndex;
     }
-    regularStatesInBsccs &= ~bsccRepresentativesAsBitVector;
+    regularStatesInBsccs.andNot(bsccRepresentativesAsBitVector);
 
     // Compute the average time to stay in each state for all states in BSCCs.
     std::vector<ValueType> averageTimeInStates(stateValues.size(), storm::utility::one<ValueType>());
@@ -364,7 +364,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
     // time bound.
     storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(
         this->getModel().getBackwardTransitions(), phiStates, psiStates, true, pathFormula.getUpperBound<uint64_t>());
-    statesWithProbabilityGreater0 &= ~psiStates;
+    statesWithProbabilityGreater0.andNot(psiStates);
 
     // Determine whether we need to perform some further computation.
     bool furtherComputationNeeded = true;
@@ -671,7 +671,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
                     "Cannot compute conditional probabilities for all states.");
     storm::storage::sparse::state_type initialState = *this->getModel().getInitialStates().begin();
 
-    storm::storage::SparseMatrix<ValueType> backwardTransitions = this->getModel().getBackwardTransitions();
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions = this->getModel().getBackwardTransitions();
 
     // Compute the 'true' psi states, i.e. those psi states that can be reached without passing through another psi state first.
     psiStates = storm::utility::graph::getReachableStates(this->getModel().getTransitionMatrix(), this->getModel().getInitialStates(), trueStates, psiStates) &
@@ -878,6 +878,17 @@ void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performPrioritizedS
     bool computeResultsForInitialStatesOnly) {
     storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, priorityQueue, values);
 
+    uint_fast64_t numberOfThreads = storm::settings::getModule<storm::settings::modules::EliminationSettings>().getNumberOfThreads();
+    if (numberOfThreads > 1) {
+        stateEliminator.eliminateAllInParallel(numberOfThreads, [&](storm::storage::sparse::state_type state) {
+            return computeResultsForInitialStatesOnly && !initialStates.get(state);
+        });
+#ifdef STORM_DEV
+        STORM_LOG_ASSERT(checkConsistent(transitionMatrix, backwardTransitions), "The forward and backward transition matrices became inconsistent.");
+#endif
+        return;
+    }
+
     while (priorityQueue->hasNext()) {
         storm::storage::sparse::state_type state = priorityQueue->pop();
         bool removeForwardTransitions = computeResultsForInitialStatesOnly && !initialStates.get(state);
@@ -1,7 +1,10 @@
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 
+#include <algorithm>
+
 #include "storm/adapters/JsonAdapter.h"
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/io/JsonWriter.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -14,7 +17,7 @@ ExplicitQualitativeCheckResult::ExplicitQualitativeCheckResult(map_type const& m
     // Intentionally left empty.
 }
 
-ExplicitQualitativeCheckResult::ExplicitQualitativeCheckResult(map_type&& map) : truthValues(map) {
+ExplicitQualitativeCheckResult::ExplicitQualitativeCheckResult(map_type&& map) : truthValues(std::move(map)) {
     // Intentionally left empty.
 }
 
@@ -216,26 +219,33 @@ void ExplicitQualitativeCheckResult::filter(QualitativeCheckResult const& filter
     ExplicitQualitativeCheckResult const& explicitFilter = filter.asExplicitQualitativeCheckResult();
     vector_type const& filterTruthValues = explicitFilter.getTruthValuesVector();
 
+    // As both the filter and the map are ordered by state, every new element is inserted at the end of the new map in amortized constant time.
     if (this->isResultForAllStates()) {
+        vector_type const& vector = this->getTruthValuesVector();
         map_type newMap;
         for (auto element : filterTruthValues) {
-            newMap.emplace(element, this->getTruthValuesVector().get(element));
+            newMap.emplace_hint(newMap.end(), element, vector.get(element));
         }
-        this->truthValues = newMap;
+        this->truthValues = std::move(newMap);
     } else {
         map_type const& map = boost::get<map_type>(truthValues);
+        if (map.size() == filterTruthValues.getNumberOfSetBits() &&
+            std::all_of(map.begin(), map.end(), [&filterTruthValues](auto const& element) { return filterTruthValues.get(element.first); })) {
+            // The result already is restricted to the filtered states.
+            return;
+        }
 
         map_type newMap;
         for (auto const& element : map) {
             if (filterTruthValues.get(element.first)) {
-                newMap.insert(element);
+                newMap.emplace_hint(newMap.end(), element);
             }
         }
 
         STORM_LOG_THROW(newMap.size() == filterTruthValues.getNumberOfSetBits(), storm::exceptions::InvalidOperationException,
                         "The check result fails to contain some results referred to by the filter.");
 
-        this->truthValues = newMap;
+        this->truthValues = std::move(newMap);
     }
 }
 
@@ -275,6 +285,57 @@ storm::json<JsonRationalType> ExplicitQualitativeCheckResult::toJson(std::option
     return result;
 }
 
+void writeJsonEntry(storm::exporter::JsonWriter& writer, uint64_t const& id, bool value,
+                    std::optional<storm::storage::sparse::StateValuations> const& stateValuations,
+                    std::optional<storm::models::sparse::StateLabeling> const& stateLabels) {
+    writer.beginObject();
+    if (stateLabels) {
+        writer.key("l").beginArray();
+        for (auto const& label : stateLabels->getLabelsOfState(id)) {
+            writer.value(label);
+        }
+        writer.endArray();
+    }
+    writer.key("s");
+    if (stateValuations) {
+        writer.value(stateValuations->toJson<storm::RationalNumber>(id));
+    } else {
+        writer.value(id);
+    }
+    writer.key("v").value(value);
+    writer.endObject();
+}
+
+void ExplicitQualitativeCheckResult::printJsonToStream(std::ostream& out, std::optional<storm::storage::sparse::StateValuations> const& stateValuations,
+                                                       std::optional<storm::models::sparse::StateLabeling> const& stateLabels) const {
+    storm::exporter::JsonWriter writer(out);
+    if (this->isResultForAllStates()) {
+        vector_type const& valuesAsVector = boost::get<vector_type>(truthValues);
+        if (valuesAsVector.size() > 0) {
+            writer.beginArray();
+            for (uint64_t state = 0; state < valuesAsVector.size(); ++state) {
+                writeJsonEntry(writer, state, valuesAsVector.get(state), stateValuations, stateLabels);
+            }
+            writer.endArray();
+        } else {
+            // As for storm::dumpJson, an empty result is exported as null.
+            writer.null();
+        }
+    } else {
+        map_type const& valuesAsMap = boost::get<map_type>(truthValues);
+        if (!valuesAsMap.empty()) {
+            writer.beginArray();
+            for (auto const& stateValue : valuesAsMap) {
+                writeJsonEntry(writer, stateValue.first, stateValue.second, stateValuations, stateLabels);
+            }
+            writer.endArray();
+        } else {
+            writer.null();
+        }
+    }
+    writer.flush();
+}
+
 template storm::json<double> ExplicitQualitativeCheckResult::toJson<double>(std::optional<storm::storage::sparse::StateValuations> const&,
                                                                             std::optional<storm::models::sparse::StateLabeling> const&) const;
 template storm::json<storm::RationalNumber> ExplicitQualitativeCheckResult::toJson<storm::RationalNumber>(
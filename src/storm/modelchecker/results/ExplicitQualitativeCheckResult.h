@@ -68,6 +68,12 @@ class ExplicitQualitativeCheckResult : public QualitativeCheckResult {
     storm::json<JsonRationalType> toJson(std::optional<storm::storage::sparse::StateValuations> const& stateValuations = std::nullopt,
                                          std::optional<storm::models::sparse::StateLabeling> const& stateLabels = std::nullopt) const;
 
+    /*!
+     * Writes the json representation (see toJson) to the given stream without building it in memory first.
+     */
+    void printJsonToStream(std::ostream& out, std::optional<storm::storage::sparse::StateValuations> const& stateValuations = std::nullopt,
+                           std::optional<storm::models::sparse::StateLabeling> const& stateLabels = std::nullopt) const;
+
    private:
     static void performLogicalOperation(ExplicitQualitativeCheckResult& first, QualitativeCheckResult const& second, bool logicalAnd);
 
@@ -1,14 +1,20 @@
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
+#include <algorithm>
+
 #include "storm/adapters/JsonAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidAccessException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/JsonWriter.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/BitVector.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -75,7 +81,7 @@ ExplicitQuantitativeCheckResult<ValueType>::ExplicitQuantitativeCheckResult(Expl
 
         map_type newMap;
         for (auto const& e : bitMap) {
-            newMap[e.first] = e.second ? storm::utility::one<ValueType>() : storm::utility::zero<ValueType>();
+            newMap.emplace_hint(newMap.end(), e.first, e.second ? storm::utility::one<ValueType>() : storm::utility::zero<ValueType>());
         }
 
         values = newMap;
@@ -84,7 +90,7 @@ ExplicitQuantitativeCheckResult<ValueType>::ExplicitQuantitativeCheckResult(Expl
 
 template<typename ValueType>
 std::unique_ptr<CheckResult> ExplicitQuantitativeCheckResult<ValueType>::clone() const {
-    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(this->values, this->scheduler);
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(*this);
 }
 
 template<typename ValueType>
@@ -103,35 +109,137 @@ typename ExplicitQuantitativeCheckResult<ValueType>::map_type const& ExplicitQua
 }
 
 template<typename ValueType>
-void ExplicitQuantitativeCheckResult<ValueType>::filter(QualitativeCheckResult const& filter) {
-    STORM_LOG_THROW(filter.isExplicitQualitativeCheckResult(), storm::exceptions::InvalidOperationException,
-                    "Cannot filter explicit check result with non-explicit filter.");
-    STORM_LOG_THROW(filter.isResultForAllStates(), storm::exceptions::InvalidOperationException, "Cannot filter check result with non-complete filter.");
-    ExplicitQualitativeCheckResult const& explicitFilter = filter.asExplicitQualitativeCheckResult();
-    ExplicitQualitativeCheckResult::vector_type const& filterTruthValues = explicitFilter.getTruthValuesVector();
-
-    if (this->isResultForAllStates()) {
+boost::variant<std::vector<ValueType>, std::map<storm::storage::sparse::state_type, ValueType>> filterValues(
+    boost::variant<std::vector<ValueType>, std::map<storm::storage::sparse::state_type, ValueType>> const& values,
+    storm::storage::BitVector const& filterTruthValues) {
+    typedef std::map<storm::storage::sparse::state_type, ValueType> map_type;
+    // As both the filter and the map are ordered by state, every new element is inserted at the end of the new map in amortized constant time.
+    if (values.which() == 0) {
+        std::vector<ValueType> const& valuesAsVector = boost::get<std::vector<ValueType>>(values);
+        STORM_LOG_THROW(filterTruthValues.getStartOfZeroSequenceBefore(filterTruthValues.size()) <= valuesAsVector.size(),
+                        storm::exceptions::InvalidAccessException, "Invalid index in results.");
         map_type newMap;
-
         for (auto element : filterTruthValues) {
-            STORM_LOG_THROW(element < this->getValueVector().size(), storm::exceptions::InvalidAccessException, "Invalid index in results.");
-            newMap.emplace(element, this->getValueVector()[element]);
+            newMap.emplace_hint(newMap.end(), element, valuesAsVector[element]);
         }
-        this->values = newMap;
+        return newMap;
     } else {
         map_type const& map = boost::get<map_type>(values);
+        if (map.size() == filterTruthValues.getNumberOfSetBits() &&
+            std::all_of(map.begin(), map.end(), [&filterTruthValues](auto const& element) { return filterTruthValues.get(element.first); })) {
+            // The result already is restricted to the filtered states, e.g., because only the initial states were relevant.
+            return map;
+        }
 
         map_type newMap;
         for (auto const& element : map) {
             if (filterTruthValues.get(element.first)) {
-                newMap.insert(element);
+                newMap.emplace_hint(newMap.end(), element);
             }
         }
 
         STORM_LOG_THROW(newMap.size() == filterTruthValues.getNumberOfSetBits(), storm::exceptions::InvalidOperationException,
                         "The check result fails to contain some results referred to by the filter.");
 
-        this->values = newMap;
+        return newMap;
+    }
+}
+
+template<typename ValueType>
+void ExplicitQuantitativeCheckResult<ValueType>::filter(QualitativeCheckResult const& filter) {
+    STORM_LOG_THROW(filter.isExplicitQualitativeCheckResult(), storm::exceptions::InvalidOperationException,
+                    "Cannot filter explicit check result with non-explicit filter.");
+    STORM_LOG_THROW(filter.isResultForAllStates(), storm::exceptions::InvalidOperationException, "Cannot filter check result with non-complete filter.");
+    ExplicitQualitativeCheckResult const& explicitFilter = filter.asExplicitQualitativeCheckResult();
+    ExplicitQualitativeCheckResult::vector_type const& filterTruthValues = explicitFilter.getTruthValuesVector();
+
+    this->values = filterValues(this->values, filterTruthValues);
+    if (bounds) {
+        bounds->first = filterValues(bounds->first, filterTruthValues);
+        bounds->second = filterValues(bounds->second, filterTruthValues);
+    }
+}
+
+template<typename ValueType>
+uint64_t getNumberOfReductionThreads(uint64_t numberOfValues) {
+    // Only floating point values are reduced concurrently, as the arithmetic of the other value types is not thread-safe.
+    if (!std::is_same<ValueType, double>::value || !storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+        return 1;
+    }
+    return std::min<uint64_t>(storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads(),
+                              std::max<uint64_t>(1, numberOfValues / 100000));
+}
+
+/*
+ * Reduces the given values in a single pass in which every thread reduces a contiguous chunk. The results of the chunks are combined in the order of the
+ * chunks, so the result only depends on the number of threads.
+ */
+template<typename ValueType, typename ReduceChunkFunction, typename CombineFunction>
+auto reduceValues(std::vector<ValueType> const& values, ReduceChunkFunction const& reduceChunk, CombineFunction const& combine) {
+    uint64_t const numberOfThreads = getNumberOfReductionThreads<ValueType>(values.size());
+    if (numberOfThreads <= 1) {
+        return reduceChunk(values.begin(), values.end());
+    }
+    std::vector<decltype(reduceChunk(values.begin(), values.end()))> chunkResults(numberOfThreads);
+    uint64_t const numberOfChunks =
+        storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(values.size()),
+                                               [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+                                                   chunkResults[threadIndex] = reduceChunk(values.begin() + begin, values.begin() + end);
+                                               });
+    auto result = std::move(chunkResults.front());
+    for (uint64_t chunk = 1; chunk < numberOfChunks; ++chunk) {
+        result = combine(result, chunkResults[chunk]);
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::pair<ValueType, ValueType> minmaxOfValues(std::vector<ValueType> const& values) {
+    STORM_LOG_THROW(!values.empty(), storm::exceptions::InvalidOperationException, "Minimum/maximum of empty set is not defined.");
+    if constexpr (std::is_same<ValueType, double>::value) {
+        return reduceValues(
+            values,
+            [](auto begin, auto end) {
+                ValueType min = *begin;
+                ValueType max = *begin;
+                for (; begin != end; ++begin) {
+                    min = *begin < min ? *begin : min;
+                    max = *begin > max ? *begin : max;
+                }
+                return std::make_pair(min, max);
+            },
+            [](std::pair<ValueType, ValueType> const& first, std::pair<ValueType, ValueType> const& second) {
+                return std::make_pair(second.first < first.first ? second.first : first.first, second.second > first.second ? second.second : first.second);
+            });
+    } else {
+        // The exact value types treat infinity separately.
+        return storm::utility::minmax(values);
+    }
+}
+
+template<typename ValueType, typename ValueRange>
+ValueType sumOfValues(ValueRange const& values, std::string const& operation) {
+    ValueType const infinity = storm::utility::infinity<ValueType>();
+    auto sumOfChunk = [&](auto begin, auto end) {
+        ValueType sum = storm::utility::zero<ValueType>();
+        bool containsInfinity = false;
+        for (; begin != end; ++begin) {
+            if constexpr (std::is_same<typename ValueRange::value_type, ValueType>::value) {
+                containsInfinity |= *begin == infinity;
+                sum += *begin;
+            } else {
+                containsInfinity |= begin->second == infinity;
+                sum += begin->second;
+            }
+        }
+        STORM_LOG_THROW(!containsInfinity, storm::exceptions::InvalidOperationException,
+                        "Cannot compute the " << operation << " of values containing infinity.");
+        return sum;
+    };
+    if constexpr (std::is_same<typename ValueRange::value_type, ValueType>::value) {
+        return reduceValues(values, sumOfChunk, [](ValueType const& first, ValueType const& second) { return first + second; });
+    } else {
+        return sumOfChunk(values.begin(), values.end());
     }
 }
 
@@ -140,7 +248,7 @@ ValueType ExplicitQuantitativeCheckResult<ValueType>::getMin() const {
     STORM_LOG_THROW(!values.empty(), storm::exceptions::InvalidOperationException, "Minimum of empty set is not defined.");
 
     if (this->isResultForAllStates()) {
-        return storm::utility::minimum(boost::get<vector_type>(values));
+        return minmaxOfValues(boost::get<vector_type>(values)).first;
     } else {
         return storm::utility::minimum(boost::get<map_type>(values));
     }
@@ -151,7 +259,7 @@ ValueType ExplicitQuantitativeCheckResult<ValueType>::getMax() const {
     STORM_LOG_THROW(!values.empty(), storm::exceptions::InvalidOperationException, "Minimum of empty set is not defined.");
 
     if (this->isResultForAllStates()) {
-        return storm::utility::maximum(boost::get<vector_type>(values));
+        return minmaxOfValues(boost::get<vector_type>(values)).second;
     } else {
         return storm::utility::maximum(boost::get<map_type>(values));
     }
@@ -162,7 +270,7 @@ std::pair<ValueType, ValueType> ExplicitQuantitativeCheckResult<ValueType>::getM
     STORM_LOG_THROW(!values.empty(), storm::exceptions::InvalidOperationException, "Minimum/maximum of empty set is not defined.");
 
     if (this->isResultForAllStates()) {
-        return storm::utility::minmax(boost::get<vector_type>(values));
+        return minmaxOfValues(boost::get<vector_type>(values));
     } else {
         return storm::utility::minmax(boost::get<map_type>(values));
     }
@@ -172,42 +280,21 @@ template<typename ValueType>
 ValueType ExplicitQuantitativeCheckResult<ValueType>::sum() const {
     STORM_LOG_THROW(!values.empty(), storm::exceptions::InvalidOperationException, "Sum of empty set is not defined");
 
-    ValueType sum = storm::utility::zero<ValueType>();
     if (this->isResultForAllStates()) {
-        for (auto& element : boost::get<vector_type>(values)) {
-            STORM_LOG_THROW(element != storm::utility::infinity<ValueType>(), storm::exceptions::InvalidOperationException,
-                            "Cannot compute the sum of values containing infinity.");
-            sum += element;
-        }
+        return sumOfValues<ValueType>(boost::get<vector_type>(values), "sum");
     } else {
-        for (auto& element : boost::get<map_type>(values)) {
-            STORM_LOG_THROW(element.second != storm::utility::infinity<ValueType>(), storm::exceptions::InvalidOperationException,
-                            "Cannot compute the sum of values containing infinity.");
-            sum += element.second;
-        }
+        return sumOfValues<ValueType>(boost::get<map_type>(values), "sum");
     }
-    return sum;
 }
 
 template<typename ValueType>
 ValueType ExplicitQuantitativeCheckResult<ValueType>::average() const {
     STORM_LOG_THROW(!values.empty(), storm::exceptions::InvalidOperationException, "Average of empty set is not defined");
 
-    ValueType sum = storm::utility::zero<ValueType>();
     if (this->isResultForAllStates()) {
-        for (auto& element : boost::get<vector_type>(values)) {
-            STORM_LOG_THROW(element != storm::utility::infinity<ValueType>(), storm::exceptions::InvalidOperationException,
-                            "Cannot compute the average of values containing infinity.");
-            sum += element;
-        }
-        return sum / boost::get<vector_type>(values).size();
+        return sumOfValues<ValueType>(boost::get<vector_type>(values), "average") / boost::get<vector_type>(values).size();
     } else {
-        for (auto& element : boost::get<map_type>(values)) {
-            STORM_LOG_THROW(element.second != storm::utility::infinity<ValueType>(), storm::exceptions::InvalidOperationException,
-                            "Cannot compute the average of values containing infinity.");
-            sum += element.second;
-        }
-        return sum / boost::get<map_type>(values).size();
+        return sumOfValues<ValueType>(boost::get<map_type>(values), "average") / boost::get<map_type>(values).size();
     }
 }
 
@@ -233,6 +320,45 @@ storm::storage::Scheduler<ValueType>& ExplicitQuantitativeCheckResult<ValueType>
     return *scheduler.get();
 }
 
+template<typename ValueType>
+bool ExplicitQuantitativeCheckResult<ValueType>::hasBounds() const {
+    return static_cast<bool>(bounds);
+}
+
+template<typename ValueType>
+void ExplicitQuantitativeCheckResult<ValueType>::setBounds(boost::variant<vector_type, map_type>&& lowerBounds,
+                                                           boost::variant<vector_type, map_type>&& upperBounds) {
+    STORM_LOG_ASSERT(lowerBounds.which() == values.which() && upperBounds.which() == values.which(), "The bounds do not match the values.");
+    bounds = std::make_pair(std::move(lowerBounds), std::move(upperBounds));
+}
+
+template<typename ValueType>
+ValueType const& getValueOfState(boost::variant<std::vector<ValueType>, std::map<storm::storage::sparse::state_type, ValueType>> const& values,
+                                 storm::storage::sparse::state_type state) {
+    if (values.which() == 0) {
+        std::vector<ValueType> const& valuesAsVector = boost::get<std::vector<ValueType>>(values);
+        STORM_LOG_THROW(state < valuesAsVector.size(), storm::exceptions::InvalidAccessException, "Invalid index in results.");
+        return valuesAsVector[state];
+    } else {
+        auto const& valuesAsMap = boost::get<std::map<storm::storage::sparse::state_type, ValueType>>(values);
+        auto const& keyValuePair = valuesAsMap.find(state);
+        STORM_LOG_THROW(keyValuePair != valuesAsMap.end(), storm::exceptions::InvalidOperationException, "Unknown key '" << state << "'.");
+        return keyValuePair->second;
+    }
+}
+
+template<typename ValueType>
+ValueType const& ExplicitQuantitativeCheckResult<ValueType>::getLowerBound(storm::storage::sparse::state_type state) const {
+    STORM_LOG_THROW(this->hasBounds(), storm::exceptions::InvalidOperationException, "Unable to retrieve non-existing bounds.");
+    return getValueOfState(bounds->first, state);
+}
+
+template<typename ValueType>
+ValueType const& ExplicitQuantitativeCheckResult<ValueType>::getUpperBound(storm::storage::sparse::state_type state) const {
+    STORM_LOG_THROW(this->hasBounds(), storm::exceptions::InvalidOperationException, "Unable to retrieve non-existing bounds.");
+    return getValueOfState(bounds->second, state);
+}
+
 template<typename ValueType>
 void print(std::ostream& out, ValueType const& value) {
     if (value == storm::utility::infinity<ValueType>()) {
@@ -328,6 +454,16 @@ std::ostream& ExplicitQuantitativeCheckResult<ValueType>::writeToStream(std::ost
         printRange(out, minmax.first, minmax.second);
     }
 
+    if (bounds && !this->isResultForAllStates() && boost::get<map_type>(values).size() == 1) {
+        // The values are only approximations, so we also print their bounds.
+        storm::storage::sparse::state_type state = boost::get<map_type>(values).begin()->first;
+        out << " (aborted, bounds: [";
+        print(out, getLowerBound(state));
+        out << ", ";
+        print(out, getUpperBound(state));
+        out << "])";
+    }
+
     return out;
 }
 
@@ -453,6 +589,21 @@ void ExplicitQuantitativeCheckResult<ValueType>::oneMinus() {
             element.second = storm::utility::one<ValueType>() - element.second;
         }
     }
+    if (bounds) {
+        // The complement of the lower bound is an upper bound and vice versa.
+        std::swap(bounds->first, bounds->second);
+        for (auto* bound : {&bounds->first, &bounds->second}) {
+            if (bound->which() == 0) {
+                for (auto& element : boost::get<vector_type>(*bound)) {
+                    element = storm::utility::one<ValueType>() - element;
+                }
+            } else {
+                for (auto& element : boost::get<map_type>(*bound)) {
+                    element.second = storm::utility::one<ValueType>() - element.second;
+                }
+            }
+        }
+    }
 }
 
 template<typename ValueType>
@@ -491,12 +642,72 @@ storm::json<ValueType> ExplicitQuantitativeCheckResult<ValueType>::toJson(std::o
     return result;
 }
 
+template<typename ValueType>
+void writeJsonEntry(storm::exporter::JsonWriter& writer, uint64_t const& id, ValueType const& value,
+                    std::optional<storm::storage::sparse::StateValuations> const& stateValuations,
+                    std::optional<storm::models::sparse::StateLabeling> const& stateLabels) {
+    writer.beginObject();
+    if (stateLabels) {
+        writer.key("l").beginArray();
+        for (auto const& label : stateLabels->getLabelsOfState(id)) {
+            writer.value(label);
+        }
+        writer.endArray();
+    }
+    writer.key("s");
+    if (stateValuations) {
+        writer.value(stateValuations->template toJson<ValueType>(id));
+    } else {
+        writer.value(id);
+    }
+    writer.key("v").value(value);
+    writer.endObject();
+}
+
+template<typename ValueType>
+void ExplicitQuantitativeCheckResult<ValueType>::printJsonToStream(std::ostream& out,
+                                                                   std::optional<storm::storage::sparse::StateValuations> const& stateValuations,
+                                                                   std::optional<storm::models::sparse::StateLabeling> const& stateLabels) const {
+    storm::exporter::JsonWriter writer(out);
+    if (this->isResultForAllStates()) {
+        vector_type const& valuesAsVector = boost::get<vector_type>(values);
+        if (!valuesAsVector.empty()) {
+            writer.beginArray();
+            for (uint64_t state = 0; state < valuesAsVector.size(); ++state) {
+                writeJsonEntry(writer, state, valuesAsVector[state], stateValuations, stateLabels);
+            }
+            writer.endArray();
+        } else {
+            // As for storm::dumpJson, an empty result is exported as null.
+            writer.null();
+        }
+    } else {
+        map_type const& valuesAsMap = boost::get<map_type>(values);
+        if (!valuesAsMap.empty()) {
+            writer.beginArray();
+            for (auto const& stateValue : valuesAsMap) {
+                writeJsonEntry(writer, stateValue.first, stateValue.second, stateValuations, stateLabels);
+            }
+            writer.endArray();
+        } else {
+            writer.null();
+        }
+    }
+    writer.flush();
+}
+
 template<>
 storm::json<storm::RationalFunction> ExplicitQuantitativeCheckResult<storm::RationalFunction>::toJson(
     std::optional<storm::storage::sparse::StateValuations> const&, std::optional<storm::models::sparse::StateLabeling> const&) const {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Export of Check results is not supported for Rational Functions.");
 }
 
+template<>
+void ExplicitQuantitativeCheckResult<storm::RationalFunction>::printJsonToStream(std::ostream&, std::optional<storm::storage::sparse::StateValuations> const&,
+                                                                                 std::optional<storm::models::sparse::StateLabeling> const&) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Export of Check results is not supported for Rational Functions.");
+}
+
 template class ExplicitQuantitativeCheckResult<double>;
 
 #ifdef STORM_HAVE_CARL
@@ -81,15 +81,41 @@ class ExplicitQuantitativeCheckResult : public QuantitativeCheckResult<ValueType
     storm::storage::Scheduler<ValueType> const& getScheduler() const;
     storm::storage::Scheduler<ValueType>& getScheduler();
 
+    /*!
+     * Retrieves whether the result carries sound lower and upper bounds on the values. This is the case if the computation of the values was aborted (e.g.
+     * because of a timeout) before the values converged, in which case the values themselves are only approximations.
+     */
+    bool hasBounds() const;
+
+    /*!
+     * Sets the lower and upper bounds on the values. The bounds need to be given for the same states as the values.
+     */
+    void setBounds(boost::variant<vector_type, map_type>&& lowerBounds, boost::variant<vector_type, map_type>&& upperBounds);
+
+    /*!
+     * Retrieves the lower and upper bound on the value of the given state, respectively.
+     */
+    ValueType const& getLowerBound(storm::storage::sparse::state_type state) const;
+    ValueType const& getUpperBound(storm::storage::sparse::state_type state) const;
+
     storm::json<ValueType> toJson(std::optional<storm::storage::sparse::StateValuations> const& stateValuations = std::nullopt,
                                   std::optional<storm::models::sparse::StateLabeling> const& stateLabels = std::nullopt) const;
 
+    /*!
+     * Writes the json representation (see toJson) to the given stream without building it in memory first.
+     */
+    void printJsonToStream(std::ostream& out, std::optional<storm::storage::sparse::StateValuations> const& stateValuations = std::nullopt,
+                           std::optional<storm::models::sparse::StateLabeling> const& stateLabels = std::nullopt) const;
+
    private:
     // The values of the quantitative check result.
     boost::variant<vector_type, map_type> values;
 
     // An optional scheduler that accompanies the values.
     boost::optional<std::shared_ptr<storm::storage::Scheduler<ValueType>>> scheduler;
+
+    // Optional lower and upper bounds on the values.
+    boost::optional<std::pair<boost::variant<vector_type, map_type>, boost::variant<vector_type, map_type>>> bounds;
 };
 }  // namespace modelchecker
 }  // namespace storm
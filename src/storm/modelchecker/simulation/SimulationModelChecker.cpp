@@ -0,0 +1,238 @@
+#include "storm/modelchecker/simulation/SimulationModelChecker.h"
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/logic/Formulas.h"
+
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/SimulationSettings.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/random.h"
+
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+
+namespace {
+/*!
+ * Samples paths of a program from its (unique) initial state and checks whether they satisfy a step-bounded until formula.
+ */
+template<typename ValueType>
+class PathSampler {
+   public:
+    PathSampler(storm::prism::Program const& program, storm::expressions::Expression const& conditionExpression,
+                storm::expressions::Expression const& targetExpression, uint64_t lowerBound, uint64_t upperBound, uint64_t seed)
+        : generator(program),
+          conditionExpression(conditionExpression),
+          targetExpression(targetExpression),
+          lowerBound(lowerBound),
+          upperBound(upperBound),
+          randomGenerator(seed) {
+        stateToIdCallback = [this](storm::generator::CompressedState const& state) {
+            successors.push_back(state);
+            return static_cast<uint32_t>(successors.size() - 1);
+        };
+        std::vector<uint32_t> initialStates = generator.getInitialStates(stateToIdCallback);
+        STORM_LOG_THROW(initialStates.size() == 1, storm::exceptions::NotSupportedException,
+                        "The simulation engine only supports programs with a unique initial state.");
+        initialState = successors[initialStates.front()];
+    }
+
+    /*!
+     * Samples a path and returns whether it satisfies the formula. The path is only sampled up to the first state that determines the outcome.
+     */
+    bool samplePath() {
+        storm::generator::CompressedState state = initialState;
+        for (uint64_t step = 0;; ++step) {
+            generator.load(state);
+            bool isTarget = generator.evaluateBooleanExpressionInCurrentState(targetExpression);
+            if (step >= lowerBound && isTarget) {
+                return true;
+            }
+            if (step == upperBound || !generator.evaluateBooleanExpressionInCurrentState(conditionExpression)) {
+                return false;
+            }
+
+            successors.clear();
+            storm::generator::StateBehavior<ValueType, uint32_t> behavior = generator.expand(stateToIdCallback);
+            if (behavior.empty()) {
+                // Like the model builders, we treat deadlock states as if they had a self-loop. As the path stays in a state that satisfies the condition,
+                // it satisfies the formula iff the state is a target state.
+                return isTarget;
+            }
+            STORM_LOG_ASSERT(behavior.getNumberOfChoices() == 1, "Expected exactly one choice in deterministic model.");
+            state = successors[behavior.getChoices().front().sampleFromDistribution(randomGenerator.random())];
+        }
+    }
+
+   private:
+    storm::generator::PrismNextStateGenerator<ValueType, uint32_t> generator;
+    storm::expressions::Expression conditionExpression;
+    storm::expressions::Expression targetExpression;
+    uint64_t lowerBound;
+    uint64_t upperBound;
+    storm::utility::RandomProbabilityGenerator<ValueType> randomGenerator;
+
+    // The successors of the state that was expanded last. The generator refers to them by their index.
+    std::vector<storm::generator::CompressedState> successors;
+    std::function<uint32_t(storm::generator::CompressedState const&)> stateToIdCallback;
+    storm::generator::CompressedState initialState;
+};
+}  // namespace
+
+template<typename ModelType>
+SimulationModelChecker<ModelType>::SimulationModelChecker(storm::prism::Program const& program) : program(program.substituteConstantsFormulas()) {
+    // Intentionally left empty.
+}
+
+template<typename ModelType>
+bool SimulationModelChecker<ModelType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+    storm::logic::FragmentSpecification fragment = storm::logic::propositional();
+    fragment.setProbabilityOperatorsAllowed(true);
+    fragment.setBoundedUntilFormulasAllowed(true);
+    fragment.setStepBoundedUntilFormulasAllowed(true);
+    // In discrete-time models, time bounds count steps.
+    fragment.setTimeBoundedUntilFormulasAllowed(true);
+    fragment.setOperatorAtTopLevelRequired(true);
+    fragment.setNestedOperatorsAllowed(false);
+    return checkTask.getFormula().isInFragment(fragment) && checkTask.isOnlyInitialStatesRelevantSet();
+}
+
+template<typename ModelType>
+bool SimulationModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    return canHandleStatic(checkTask);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> SimulationModelChecker<ModelType>::checkProbabilityOperatorFormula(
+    Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) {
+    storm::logic::ProbabilityOperatorFormula const& stateFormula = checkTask.getFormula();
+    if (!checkTask.isBoundSet() || !stateFormula.getSubformula().isBoundedUntilFormula()) {
+        return AbstractModelChecker<ModelType>::checkProbabilityOperatorFormula(env, checkTask);
+    }
+
+    // Decide whether the probability p lies above or below the threshold with the sequential probability ratio test for the hypotheses p >= p0 and
+    // p <= p1, where the indifference region (p1, p0) surrounds the threshold.
+    auto const& settings = storm::settings::getModule<storm::settings::modules::SimulationSettings>();
+    double const threshold = storm::utility::convertNumber<double>(checkTask.getBoundThreshold());
+    double const p0 = std::min(1.0, threshold + settings.getIndifference());
+    double const p1 = std::max(0.0, threshold - settings.getIndifference());
+    STORM_LOG_THROW(p0 < 1.0 || p1 > 0.0, storm::exceptions::InvalidSettingsException, "The indifference region must not cover all probabilities.");
+    double const errorProbability = settings.getErrorProbability();
+    double const acceptLowerBound = std::log(errorProbability / (1.0 - errorProbability));
+    double const acceptUpperBound = std::log((1.0 - errorProbability) / errorProbability);
+
+    auto getLogLikelihoodRatio = [p0, p1](uint64_t samples, uint64_t successes) {
+        // The terms are only added if they are needed as they may be infinite if the indifference region touches 0 or 1.
+        double result = 0.0;
+        if (successes > 0) {
+            result += static_cast<double>(successes) * std::log(p1 / p0);
+        }
+        if (samples > successes) {
+            result += static_cast<double>(samples - successes) * std::log((1.0 - p1) / (1.0 - p0));
+        }
+        return result;
+    };
+    auto samplesAndSuccesses =
+        samplePaths(env, stateFormula.getSubformula().asBoundedUntilFormula(), std::numeric_limits<uint64_t>::max(),
+                    [&](uint64_t samples, uint64_t successes) {
+                        double logLikelihoodRatio = getLogLikelihoodRatio(samples, successes);
+                        return logLikelihoodRatio <= acceptLowerBound || logLikelihoodRatio >= acceptUpperBound;
+                    });
+    bool probabilityIsAboveThreshold = getLogLikelihoodRatio(samplesAndSuccesses.first, samplesAndSuccesses.second) <= acceptLowerBound;
+    STORM_LOG_INFO("The sequential probability ratio test decided that the probability is " << (probabilityIsAboveThreshold ? "above" : "below")
+                                                                                              << " the threshold " << threshold << " after "
+                                                                                              << samplesAndSuccesses.first << " paths.");
+    bool result = storm::logic::isLowerBound(checkTask.getBoundComparisonType()) == probabilityIsAboveThreshold;
+    return std::make_unique<ExplicitQualitativeCheckResult>(0, result);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> SimulationModelChecker<ModelType>::computeBoundedUntilProbabilities(
+    Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+    // By the Okamoto bound, the estimate deviates from the probability by more than the precision with probability at most 2 * exp(-2 * n * precision^2).
+    auto const& settings = storm::settings::getModule<storm::settings::modules::SimulationSettings>();
+    double const precision = settings.getPrecision();
+    uint64_t const numberOfSamples = static_cast<uint64_t>(std::ceil(std::log(2.0 / settings.getErrorProbability()) / (2.0 * precision * precision)));
+    auto samplesAndSuccesses = samplePaths(env, checkTask.getFormula(), numberOfSamples, [](uint64_t, uint64_t) { return false; });
+    ValueType estimate = storm::utility::convertNumber<ValueType>(static_cast<double>(samplesAndSuccesses.second) / samplesAndSuccesses.first);
+    STORM_LOG_INFO("Estimated the probability as " << estimate << " from " << samplesAndSuccesses.first << " paths.");
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, estimate);
+}
+
+template<typename ModelType>
+std::pair<uint64_t, uint64_t> SimulationModelChecker<ModelType>::samplePaths(Environment const& env, storm::logic::BoundedUntilFormula const& pathFormula,
+                                                                              uint64_t maximalNumberOfSamples,
+                                                                              std::function<bool(uint64_t, uint64_t)> const& isDone) const {
+    STORM_LOG_THROW(!pathFormula.isMultiDimensional() && !pathFormula.getTimeBoundReference().isRewardBound(), storm::exceptions::NotSupportedException,
+                    "The simulation engine only supports step-bounded until formulas.");
+    STORM_LOG_THROW(pathFormula.hasUpperBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have (a single) upper step bound.");
+    STORM_LOG_THROW(pathFormula.hasIntegerLowerBound(), storm::exceptions::InvalidPropertyException, "Formula lower step bound must be discrete/integral.");
+    STORM_LOG_THROW(pathFormula.hasIntegerUpperBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have discrete upper step bound.");
+    uint64_t const lowerBound = pathFormula.hasLowerBound() ? pathFormula.getNonStrictLowerBound<uint64_t>() : 0;
+    uint64_t const upperBound = pathFormula.getNonStrictUpperBound<uint64_t>();
+
+    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
+    storm::expressions::Expression conditionExpression = pathFormula.getLeftSubformula().toExpression(program.getManager(), labelToExpressionMapping);
+    storm::expressions::Expression targetExpression = pathFormula.getRightSubformula().toExpression(program.getManager(), labelToExpressionMapping);
+
+    // Every thread gets its own sampler. They are created up front, because setting up a next-state generator is not thread-safe.
+    auto const& settings = storm::settings::getModule<storm::settings::modules::SimulationSettings>();
+    uint64_t const seed = settings.getSeed() ? settings.getSeed().value() : std::chrono::system_clock::now().time_since_epoch().count();
+    uint64_t const numberOfThreads = std::max<uint64_t>(1, env.solver().getNumberOfThreads());
+    std::vector<std::unique_ptr<PathSampler<ValueType>>> samplers;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        samplers.push_back(std::make_unique<PathSampler<ValueType>>(program, conditionExpression, targetExpression, lowerBound, upperBound, seed + thread));
+    }
+
+    uint64_t const batchSize = settings.getBatchSize();
+    std::vector<uint64_t> successesPerThread(numberOfThreads);
+    uint64_t samples = 0;
+    uint64_t successes = 0;
+    while (samples < maximalNumberOfSamples && !isDone(samples, successes)) {
+        uint64_t const currentBatchSize = std::min(batchSize, maximalNumberOfSamples - samples);
+        std::fill(successesPerThread.begin(), successesPerThread.end(), 0);
+        storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), currentBatchSize,
+                                               [&](uint64_t threadIndex, uint64_t chunkBegin, uint64_t chunkEnd) {
+                                                   uint64_t localSuccesses = 0;
+                                                   for (; chunkBegin != chunkEnd; ++chunkBegin) {
+                                                       if (samplers[threadIndex]->samplePath()) {
+                                                           ++localSuccesses;
+                                                       }
+                                                   }
+                                                   successesPerThread[threadIndex] = localSuccesses;
+                                               });
+        samples += currentBatchSize;
+        successes += std::accumulate(successesPerThread.begin(), successesPerThread.end(), static_cast<uint64_t>(0));
+    }
+    return std::make_pair(samples, successes);
+}
+
+template class SimulationModelChecker<storm::models::sparse::Dtmc<double>>;
+
+}  // namespace modelchecker
+}  // namespace storm
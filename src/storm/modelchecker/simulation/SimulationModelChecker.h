@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+
+/*!
+ * A statistical model checker that estimates the probabilities of step-bounded until formulas by sampling paths of a PRISM program, i.e., without
+ * building its state space. The paths are sampled in batches that are distributed over the threads of the solver environment, where each thread
+ * evaluates the program with its own next-state generator and random number generator.
+ *
+ * Quantitative queries sample as many paths as required by the Okamoto (Chernoff-Hoeffding) bound to estimate the probability up to the precision with
+ * the error probability given in the simulation settings. Queries that compare the probability against a bound are decided by Wald's sequential
+ * probability ratio test instead, which typically needs far fewer paths if the probability is not close to the bound.
+ */
+template<typename ModelType>
+class SimulationModelChecker : public AbstractModelChecker<ModelType> {
+   public:
+    typedef typename ModelType::ValueType ValueType;
+
+    SimulationModelChecker(storm::prism::Program const& program);
+
+    static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+
+    virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+    virtual std::unique_ptr<CheckResult> checkProbabilityOperatorFormula(
+        Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) override;
+
+    virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env,
+                                                                          CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+
+   private:
+    /*!
+     * Samples batches of paths and counts the paths that satisfy the given formula.
+     *
+     * @param pathFormula The formula to check on the paths.
+     * @param maximalNumberOfSamples The number of paths after which the sampling stops in any case.
+     * @param isDone Is called with the number of sampled and satisfying paths after each batch and returns true if no more paths need to be sampled.
+     * @return The number of sampled paths and the number of paths that satisfy the formula.
+     */
+    std::pair<uint64_t, uint64_t> samplePaths(Environment const& env, storm::logic::BoundedUntilFormula const& pathFormula, uint64_t maximalNumberOfSamples,
+                                              std::function<bool(uint64_t, uint64_t)> const& isDone) const;
+
+    // The program whose paths are sampled.
+    storm::prism::Program program;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -2,6 +2,8 @@
 
 #include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/split.hpp>
+#include <memory>
+#include <mutex>
 
 #include "storm/adapters/JsonAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -22,6 +24,17 @@ namespace storm {
 namespace models {
 namespace sparse {
 
+namespace {
+/*!
+ * Retrieves the mutex that guards the creation of the data that models derive lazily from their transition matrix.
+ * Creating this data is rare, so a single mutex for all models suffices.
+ */
+std::mutex& getLazyDataMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+}  // namespace
+
 template<typename ValueType, typename RewardModelType>
 Model<ValueType, RewardModelType>::Model(ModelType modelType, storm::storage::sparse::ModelComponents<ValueType, RewardModelType> const& components)
     : storm::models::Model<ValueType>(modelType),
@@ -149,8 +162,43 @@ void Model<ValueType, RewardModelType>::assertValidityOfComponents(
 }
 
 template<typename ValueType, typename RewardModelType>
-storm::storage::SparseMatrix<ValueType> Model<ValueType, RewardModelType>::getBackwardTransitions() const {
-    return this->getTransitionMatrix().transpose(true);
+storm::storage::SparseMatrix<ValueType> const& Model<ValueType, RewardModelType>::getBackwardTransitions() const {
+    // The lazily created data may be requested concurrently, e.g., if several properties are checked on the same model in parallel.
+    auto result = std::atomic_load(&backwardTransitions);
+    if (!result) {
+        std::lock_guard<std::mutex> lock(getLazyDataMutex());
+        result = std::atomic_load(&backwardTransitions);
+        if (!result) {
+            result = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(this->getTransitionMatrix().transpose(true));
+            // Materialize the trivial row grouping now, as it would otherwise be created lazily by concurrent readers.
+            result->getRowGroupIndices();
+            std::atomic_store(&backwardTransitions, result);
+        }
+    }
+    return *result;
+}
+
+template<typename ValueType, typename RewardModelType>
+storm::storage::QualitativeAnalysisCache& Model<ValueType, RewardModelType>::getQualitativeAnalysisCache() const {
+    auto result = std::atomic_load(&qualitativeAnalysisCache);
+    if (!result) {
+        std::lock_guard<std::mutex> lock(getLazyDataMutex());
+        result = std::atomic_load(&qualitativeAnalysisCache);
+        if (!result) {
+            result = std::make_shared<storm::storage::QualitativeAnalysisCache>();
+            std::atomic_store(&qualitativeAnalysisCache, result);
+        }
+    }
+    return *result;
+}
+
+template<typename ValueType, typename RewardModelType>
+void Model<ValueType, RewardModelType>::discardBackwardTransitions() {
+    if (backwardTransitions) {
+        discardedBackwardTransitions = std::move(backwardTransitions);
+    }
+    // Copies of this model might still use the cache, so we do not clear it.
+    qualitativeAnalysisCache.reset();
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -200,6 +248,7 @@ storm::storage::SparseMatrix<ValueType> const& Model<ValueType, RewardModelType>
 
 template<typename ValueType, typename RewardModelType>
 storm::storage::SparseMatrix<ValueType>& Model<ValueType, RewardModelType>::getTransitionMatrix() {
+    discardBackwardTransitions();
     return transitionMatrix;
 }
 
@@ -620,11 +669,13 @@ std::set<std::string> Model<ValueType, RewardModelType>::getLabelsOfState(storm:
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
     this->transitionMatrix = transitionMatrix;
+    discardBackwardTransitions();
 }
 
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType>&& transitionMatrix) {
     this->transitionMatrix = std::move(transitionMatrix);
+    discardBackwardTransitions();
 }
 
 template<typename ValueType, typename RewardModelType>
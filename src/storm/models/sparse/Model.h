@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -8,6 +9,7 @@
 #include "storm/models/ModelRepresentation.h"
 #include "storm/models/sparse/ChoiceLabeling.h"
 #include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/QualitativeAnalysisCache.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/ChoiceOrigins.h"
 #include "storm/storage/sparse/ModelComponents.h"
@@ -54,9 +56,20 @@ class Model : public storm::models::Model<CValueType> {
      * Retrieves the backward transition relation of the model, i.e. a set of transitions between states
      * that correspond to the reversed transition relation of this model.
      *
+     * The backward transitions are computed on the first call and kept until the transition matrix is modified through
+     * the non-constant getter or a setter. Copies of the model share them. This method may be called concurrently.
+     *
      * @return A sparse matrix that represents the backward transitions of this model.
      */
-    storm::storage::SparseMatrix<ValueType> getBackwardTransitions() const;
+    storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions() const;
+
+    /*!
+     * Retrieves a cache for the results of qualitative analyses of this model. Like the backward transitions, the cache is discarded when the transition
+     * matrix is modified through the non-constant getter or a setter and copies of the model share it. This method may be called concurrently.
+     *
+     * @return The cache of qualitative analysis results.
+     */
+    storm::storage::QualitativeAnalysisCache& getQualitativeAnalysisCache() const;
 
     /*!
      * Returns an object representing the matrix rows associated with the given state.
@@ -448,12 +461,27 @@ class Model : public storm::models::Model<CValueType> {
     virtual std::string additionalDotStateInfo(uint64_t state) const;
 
    private:
+    /*!
+     * Discards the backward transitions as the transition matrix might be modified.
+     */
+    void discardBackwardTransitions();
+
     // Upon construction of a model, this function asserts that the specified components are valid
     void assertValidityOfComponents(storm::storage::sparse::ModelComponents<ValueType, RewardModelType> const& components) const;
 
     //  A matrix representing transition relation.
     storm::storage::SparseMatrix<ValueType> transitionMatrix;
 
+    // The backward transitions, if they have already been computed.
+    mutable std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> backwardTransitions;
+
+    // The backward transitions that were discarded because the transition matrix might have been modified. They are kept until they are discarded again
+    // such that references obtained earlier, e.g., for another argument of the same call, remain valid.
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> discardedBackwardTransitions;
+
+    // The results of qualitative analyses, if any have been requested.
+    mutable std::shared_ptr<storm::storage::QualitativeAnalysisCache> qualitativeAnalysisCache;
+
     // The labeling of the states.
     storm::models::sparse::StateLabeling stateLabeling;
 
@@ -32,35 +32,41 @@ StandardRewardModel<ValueType>::StandardRewardModel(std::optional<std::vector<Va
 
 template<typename ValueType>
 bool StandardRewardModel<ValueType>::hasStateRewards() const {
-    return static_cast<bool>(this->optionalStateRewardVector);
+    return static_cast<bool>(this->optionalStateRewardVector) || static_cast<bool>(this->compressedStateRewardVector);
 }
 
 template<typename ValueType>
 bool StandardRewardModel<ValueType>::hasOnlyStateRewards() const {
-    return static_cast<bool>(this->optionalStateRewardVector) && !static_cast<bool>(this->optionalStateActionRewardVector) &&
-           !static_cast<bool>(this->optionalTransitionRewardMatrix);
+    return this->hasStateRewards() && !this->hasStateActionRewards() && !static_cast<bool>(this->optionalTransitionRewardMatrix);
 }
 
 template<typename ValueType>
 std::vector<ValueType> const& StandardRewardModel<ValueType>::getStateRewardVector() const {
     STORM_LOG_ASSERT(this->hasStateRewards(), "No state rewards available.");
+    expandStateRewards();
     return this->optionalStateRewardVector.value();
 }
 
 template<typename ValueType>
 std::vector<ValueType>& StandardRewardModel<ValueType>::getStateRewardVector() {
     STORM_LOG_ASSERT(this->hasStateRewards(), "No state rewards available.");
+    expandStateRewards();
+    invalidateSharedTotalRewardVector();
     return this->optionalStateRewardVector.value();
 }
 
 template<typename ValueType>
 std::optional<std::vector<ValueType>> const& StandardRewardModel<ValueType>::getOptionalStateRewardVector() const {
+    expandStateRewards();
     return this->optionalStateRewardVector;
 }
 
 template<typename ValueType>
 ValueType const& StandardRewardModel<ValueType>::getStateReward(uint_fast64_t state) const {
     STORM_LOG_ASSERT(this->hasStateRewards(), "No state rewards available.");
+    if (this->compressedStateRewardVector) {
+        return this->compressedStateRewardVector.value()[state];
+    }
     STORM_LOG_ASSERT(state < this->optionalStateRewardVector.value().size(), "Invalid state.");
     return this->optionalStateRewardVector.value()[state];
 }
@@ -69,30 +75,38 @@ template<typename ValueType>
 template<typename T>
 void StandardRewardModel<ValueType>::setStateReward(uint_fast64_t state, T const& newReward) {
     STORM_LOG_ASSERT(this->hasStateRewards(), "No state rewards available.");
+    expandStateRewards();
+    invalidateSharedTotalRewardVector();
     STORM_LOG_ASSERT(state < this->optionalStateRewardVector.value().size(), "Invalid state.");
     this->optionalStateRewardVector.value()[state] = newReward;
 }
 
 template<typename ValueType>
 bool StandardRewardModel<ValueType>::hasStateActionRewards() const {
-    return static_cast<bool>(this->optionalStateActionRewardVector);
+    return static_cast<bool>(this->optionalStateActionRewardVector) || static_cast<bool>(this->compressedStateActionRewardVector);
 }
 
 template<typename ValueType>
 std::vector<ValueType> const& StandardRewardModel<ValueType>::getStateActionRewardVector() const {
     STORM_LOG_ASSERT(this->hasStateActionRewards(), "No state action rewards available.");
+    expandStateActionRewards();
     return this->optionalStateActionRewardVector.value();
 }
 
 template<typename ValueType>
 std::vector<ValueType>& StandardRewardModel<ValueType>::getStateActionRewardVector() {
     STORM_LOG_ASSERT(this->hasStateActionRewards(), "No state action rewards available.");
+    expandStateActionRewards();
+    invalidateSharedTotalRewardVector();
     return this->optionalStateActionRewardVector.value();
 }
 
 template<typename ValueType>
 ValueType const& StandardRewardModel<ValueType>::getStateActionReward(uint_fast64_t choiceIndex) const {
     STORM_LOG_ASSERT(this->hasStateActionRewards(), "No state action rewards available.");
+    if (this->compressedStateActionRewardVector) {
+        return this->compressedStateActionRewardVector.value()[choiceIndex];
+    }
     STORM_LOG_ASSERT(choiceIndex < this->optionalStateActionRewardVector.value().size(), "Invalid choiceIndex.");
     return this->optionalStateActionRewardVector.value()[choiceIndex];
 }
@@ -101,15 +115,89 @@ template<typename ValueType>
 template<typename T>
 void StandardRewardModel<ValueType>::setStateActionReward(uint_fast64_t choiceIndex, T const& newValue) {
     STORM_LOG_ASSERT(this->hasStateActionRewards(), "No state action rewards available.");
+    expandStateActionRewards();
+    invalidateSharedTotalRewardVector();
     STORM_LOG_ASSERT(choiceIndex < this->optionalStateActionRewardVector.value().size(), "Invalid choiceIndex.");
     this->optionalStateActionRewardVector.value()[choiceIndex] = newValue;
 }
 
 template<typename ValueType>
 std::optional<std::vector<ValueType>> const& StandardRewardModel<ValueType>::getOptionalStateActionRewardVector() const {
+    expandStateActionRewards();
     return this->optionalStateActionRewardVector;
 }
 
+template<typename ValueType>
+void StandardRewardModel<ValueType>::expandStateRewards() const {
+    if (this->compressedStateRewardVector) {
+        this->optionalStateRewardVector = this->compressedStateRewardVector->toVector();
+        this->compressedStateRewardVector = std::nullopt;
+    }
+}
+
+template<typename ValueType>
+void StandardRewardModel<ValueType>::expandStateActionRewards() const {
+    if (this->compressedStateActionRewardVector) {
+        this->optionalStateActionRewardVector = this->compressedStateActionRewardVector->toVector();
+        this->compressedStateActionRewardVector = std::nullopt;
+    }
+}
+
+template<typename ValueType>
+std::vector<ValueType> const& StandardRewardModel<ValueType>::getStateRewardsAsVector(std::vector<ValueType>& buffer) const {
+    STORM_LOG_ASSERT(this->hasStateRewards(), "No state rewards available.");
+    if (this->compressedStateRewardVector) {
+        buffer = this->compressedStateRewardVector->toVector();
+        return buffer;
+    }
+    return this->optionalStateRewardVector.value();
+}
+
+template<typename ValueType>
+std::vector<ValueType> const& StandardRewardModel<ValueType>::getStateActionRewardsAsVector(std::vector<ValueType>& buffer) const {
+    STORM_LOG_ASSERT(this->hasStateActionRewards(), "No state action rewards available.");
+    if (this->compressedStateActionRewardVector) {
+        buffer = this->compressedStateActionRewardVector->toVector();
+        return buffer;
+    }
+    return this->optionalStateActionRewardVector.value();
+}
+
+template<typename ValueType>
+void StandardRewardModel<ValueType>::addStateActionRewardsTo(std::vector<ValueType>& target) const {
+    if (this->compressedStateActionRewardVector) {
+        this->compressedStateActionRewardVector->addTo(target);
+    } else if (this->optionalStateActionRewardVector) {
+        storm::utility::vector::addVectors(target, this->optionalStateActionRewardVector.value(), target);
+    }
+}
+
+template<typename ValueType>
+void StandardRewardModel<ValueType>::invalidateSharedTotalRewardVector() {
+    this->sharedTotalRewardVector.reset();
+}
+
+template<typename ValueType>
+void StandardRewardModel<ValueType>::compress() {
+    if (this->optionalStateRewardVector) {
+        this->compressedStateRewardVector = storm::storage::CompressedVector<ValueType>::compress(this->optionalStateRewardVector.value());
+        if (this->compressedStateRewardVector) {
+            this->optionalStateRewardVector = std::nullopt;
+        }
+    }
+    if (this->optionalStateActionRewardVector) {
+        this->compressedStateActionRewardVector = storm::storage::CompressedVector<ValueType>::compress(this->optionalStateActionRewardVector.value());
+        if (this->compressedStateActionRewardVector) {
+            this->optionalStateActionRewardVector = std::nullopt;
+        }
+    }
+}
+
+template<typename ValueType>
+bool StandardRewardModel<ValueType>::isCompressed() const {
+    return static_cast<bool>(this->compressedStateRewardVector) || static_cast<bool>(this->compressedStateActionRewardVector);
+}
+
 template<typename ValueType>
 bool StandardRewardModel<ValueType>::hasTransitionRewards() const {
     return static_cast<bool>(this->optionalTransitionRewardMatrix);
@@ -122,6 +210,7 @@ storm::storage::SparseMatrix<ValueType> const& StandardRewardModel<ValueType>::g
 
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType>& StandardRewardModel<ValueType>::getTransitionRewardMatrix() {
+    invalidateSharedTotalRewardVector();
     return this->optionalTransitionRewardMatrix.value();
 }
 
@@ -132,49 +221,67 @@ std::optional<storm::storage::SparseMatrix<ValueType>> const& StandardRewardMode
 
 template<typename ValueType>
 StandardRewardModel<ValueType> StandardRewardModel<ValueType>::restrictActions(storm::storage::BitVector const& enabledActions) const {
-    std::optional<std::vector<ValueType>> newStateRewardVector(this->getOptionalStateRewardVector());
+    std::vector<ValueType> buffer;
+    std::optional<std::vector<ValueType>> newStateRewardVector;
+    if (this->hasStateRewards()) {
+        newStateRewardVector = this->getStateRewardsAsVector(buffer);
+    }
     std::optional<std::vector<ValueType>> newStateActionRewardVector;
     if (this->hasStateActionRewards()) {
         newStateActionRewardVector = std::vector<ValueType>(enabledActions.getNumberOfSetBits());
-        storm::utility::vector::selectVectorValues(newStateActionRewardVector.value(), enabledActions, this->getStateActionRewardVector());
+        storm::utility::vector::selectVectorValues(newStateActionRewardVector.value(), enabledActions, this->getStateActionRewardsAsVector(buffer));
     }
     std::optional<storm::storage::SparseMatrix<ValueType>> newTransitionRewardMatrix;
     if (this->hasTransitionRewards()) {
         newTransitionRewardMatrix = this->getTransitionRewardMatrix().restrictRows(enabledActions);
     }
-    return StandardRewardModel(std::move(newStateRewardVector), std::move(newStateActionRewardVector), std::move(newTransitionRewardMatrix));
+    StandardRewardModel result(std::move(newStateRewardVector), std::move(newStateActionRewardVector), std::move(newTransitionRewardMatrix));
+    if (this->isCompressed()) {
+        result.compress();
+    }
+    return result;
 }
 
 template<typename ValueType>
 StandardRewardModel<ValueType> StandardRewardModel<ValueType>::permuteActions(std::vector<uint64_t> const& inversePermutation) const {
-    std::optional<std::vector<ValueType>> newStateRewardVector(this->getOptionalStateRewardVector());
+    std::vector<ValueType> buffer;
+    std::optional<std::vector<ValueType>> newStateRewardVector;
+    if (this->hasStateRewards()) {
+        newStateRewardVector = this->getStateRewardsAsVector(buffer);
+    }
     std::optional<std::vector<ValueType>> newStateActionRewardVector;
     if (this->hasStateActionRewards()) {
-        newStateActionRewardVector = storm::utility::vector::applyInversePermutation(inversePermutation, this->getStateActionRewardVector());
+        newStateActionRewardVector = storm::utility::vector::applyInversePermutation(inversePermutation, this->getStateActionRewardsAsVector(buffer));
     }
     std::optional<storm::storage::SparseMatrix<ValueType>> newTransitionRewardMatrix;
     if (this->hasTransitionRewards()) {
         newTransitionRewardMatrix = this->getTransitionRewardMatrix().permuteRows(inversePermutation);
     }
-    return StandardRewardModel(std::move(newStateRewardVector), std::move(newStateActionRewardVector), std::move(newTransitionRewardMatrix));
+    StandardRewardModel result(std::move(newStateRewardVector), std::move(newStateActionRewardVector), std::move(newTransitionRewardMatrix));
+    if (this->isCompressed()) {
+        result.compress();
+    }
+    return result;
 }
 
 template<typename ValueType>
 StandardRewardModel<ValueType> StandardRewardModel<ValueType>::permuteStates(std::vector<uint64_t> const& inversePermutation,
                                                                              storm::OptionalRef<std::vector<uint64_t> const> rowGroupIndices,
                                                                              storm::OptionalRef<std::vector<uint64_t> const> permutation) const {
+    std::vector<ValueType> buffer;
     std::optional<std::vector<ValueType>> newStateRewardVector;
     if (hasStateRewards()) {
-        newStateRewardVector = storm::utility::vector::applyInversePermutation(inversePermutation, getStateRewardVector());
+        newStateRewardVector = storm::utility::vector::applyInversePermutation(inversePermutation, getStateRewardsAsVector(buffer));
     }
     std::optional<std::vector<ValueType>> newStateActionRewardVector;
     if (this->hasStateActionRewards()) {
+        auto const& stateActionRewardVector = this->getStateActionRewardsAsVector(buffer);
         if (rowGroupIndices) {
             newStateActionRewardVector =
-                storm::utility::vector::applyInversePermutationToGroupedVector(inversePermutation, this->getStateActionRewardVector(), rowGroupIndices.value());
+                storm::utility::vector::applyInversePermutationToGroupedVector(inversePermutation, stateActionRewardVector, rowGroupIndices.value());
         } else {
-            STORM_LOG_ASSERT(inversePermutation.size() == this->getStateActionRewardVector().size(), "Invalid permutation size.");
-            newStateActionRewardVector = storm::utility::vector::applyInversePermutation(inversePermutation, this->getStateActionRewardVector());
+            STORM_LOG_ASSERT(inversePermutation.size() == stateActionRewardVector.size(), "Invalid permutation size.");
+            newStateActionRewardVector = storm::utility::vector::applyInversePermutation(inversePermutation, stateActionRewardVector);
         }
     }
     std::optional<storm::storage::SparseMatrix<ValueType>> newTransitionRewardMatrix;
@@ -185,7 +292,11 @@ StandardRewardModel<ValueType> StandardRewardModel<ValueType>::permuteStates(std
         this->getTransitionRewardMatrix().permuteRowGroupsAndColumns(inversePermutation, permutation.value());
     }
 
-    return StandardRewardModel(std::move(newStateRewardVector), std::move(newStateActionRewardVector), std::move(newTransitionRewardMatrix));
+    StandardRewardModel result(std::move(newStateRewardVector), std::move(newStateActionRewardVector), std::move(newTransitionRewardMatrix));
+    if (this->isCompressed()) {
+        result.compress();
+    }
+    return result;
 }
 
 template<typename ValueType>
@@ -215,6 +326,9 @@ template<typename ValueType>
 template<typename MatrixValueType>
 void StandardRewardModel<ValueType>::reduceToStateBasedRewards(storm::storage::SparseMatrix<MatrixValueType> const& transitionMatrix, bool reduceToStateRewards,
                                                                std::vector<MatrixValueType> const* weights) {
+    expandStateRewards();
+    expandStateActionRewards();
+    invalidateSharedTotalRewardVector();
     if (this->hasTransitionRewards()) {
         if (this->hasStateActionRewards()) {
             storm::utility::vector::addVectors<ValueType>(this->getStateActionRewardVector(),
@@ -253,40 +367,71 @@ void StandardRewardModel<ValueType>::reduceToStateBasedRewards(storm::storage::S
 template<typename ValueType>
 template<typename MatrixValueType>
 std::vector<ValueType> StandardRewardModel<ValueType>::getTotalRewardVector(storm::storage::SparseMatrix<MatrixValueType> const& transitionMatrix) const {
-    std::vector<ValueType> result = this->hasTransitionRewards() ? transitionMatrix.getPointwiseProductRowSumVector(this->getTransitionRewardMatrix())
-                                                                 : (this->hasStateActionRewards() ? this->getStateActionRewardVector()
-                                                                                                  : std::vector<ValueType>(transitionMatrix.getRowCount()));
-    if (this->hasStateActionRewards() && this->hasTransitionRewards()) {
-        storm::utility::vector::addVectors(result, this->getStateActionRewardVector(), result);
+    std::vector<ValueType> result;
+    if (this->hasTransitionRewards()) {
+        result = transitionMatrix.getPointwiseProductRowSumVector(this->getTransitionRewardMatrix());
+        addStateActionRewardsTo(result);
+    } else if (this->compressedStateActionRewardVector) {
+        result = this->compressedStateActionRewardVector->toVector();
+    } else if (this->optionalStateActionRewardVector) {
+        result = this->optionalStateActionRewardVector.value();
+    } else {
+        result = std::vector<ValueType>(transitionMatrix.getRowCount());
     }
     if (this->hasStateRewards()) {
-        storm::utility::vector::addVectorToGroupedVector(result, this->getStateRewardVector(), transitionMatrix.getRowGroupIndices());
+        std::vector<ValueType> buffer;
+        storm::utility::vector::addVectorToGroupedVector(result, this->getStateRewardsAsVector(buffer), transitionMatrix.getRowGroupIndices());
     }
     return result;
 }
 
+template<typename ValueType>
+template<typename MatrixValueType>
+std::shared_ptr<std::vector<ValueType> const> StandardRewardModel<ValueType>::getSharedTotalRewardVector(
+    storm::storage::SparseMatrix<MatrixValueType> const& transitionMatrix) const {
+    if (this->hasTransitionRewards()) {
+        // The result depends on the values of the transition matrix, so we do not cache it.
+        return std::make_shared<std::vector<ValueType> const>(this->getTotalRewardVector(transitionMatrix));
+    }
+    auto cache = this->sharedTotalRewardVector;
+    if (!cache || cache->rowGroupIndices != transitionMatrix.getRowGroupIndices()) {
+        auto newCache = std::make_shared<SharedTotalRewardVector>();
+        newCache->rowGroupIndices = transitionMatrix.getRowGroupIndices();
+        newCache->vector = std::make_shared<std::vector<ValueType> const>(this->getTotalRewardVector(transitionMatrix));
+        this->sharedTotalRewardVector = newCache;
+        cache = std::move(newCache);
+    }
+    return cache->vector;
+}
+
 template<typename ValueType>
 template<typename MatrixValueType>
 std::vector<ValueType> StandardRewardModel<ValueType>::getTotalRewardVector(storm::storage::SparseMatrix<MatrixValueType> const& transitionMatrix,
                                                                             std::vector<MatrixValueType> const& weights) const {
+    std::vector<ValueType> buffer;
     std::vector<ValueType> result;
     if (this->hasTransitionRewards()) {
         result = transitionMatrix.getPointwiseProductRowSumVector(this->getTransitionRewardMatrix());
-        storm::utility::vector::applyPointwiseTernary<MatrixValueType, ValueType, ValueType>(
-            weights, this->getStateActionRewardVector(), result,
-            [](MatrixValueType const& weight, ValueType const& rewardElement, ValueType const& resultElement) {
-                return weight * (resultElement + rewardElement);
-            });
+        if (this->hasStateActionRewards()) {
+            storm::utility::vector::applyPointwiseTernary<MatrixValueType, ValueType, ValueType>(
+                weights, this->getStateActionRewardsAsVector(buffer), result,
+                [](MatrixValueType const& weight, ValueType const& rewardElement, ValueType const& resultElement) {
+                    return weight * (resultElement + rewardElement);
+                });
+        } else {
+            storm::utility::vector::applyPointwise<MatrixValueType, ValueType, ValueType>(
+                weights, result, result, [](MatrixValueType const& weight, ValueType const& resultElement) { return weight * resultElement; });
+        }
     } else {
         result = std::vector<ValueType>(transitionMatrix.getRowCount());
         if (this->hasStateActionRewards()) {
             storm::utility::vector::applyPointwise<MatrixValueType, ValueType, ValueType>(
-                weights, this->getStateActionRewardVector(), result,
+                weights, this->getStateActionRewardsAsVector(buffer), result,
                 [](MatrixValueType const& weight, ValueType const& rewardElement) { return weight * rewardElement; });
         }
     }
     if (this->hasStateRewards()) {
-        storm::utility::vector::addVectorToGroupedVector(result, this->getStateRewardVector(), transitionMatrix.getRowGroupIndices());
+        storm::utility::vector::addVectorToGroupedVector(result, this->getStateRewardsAsVector(buffer), transitionMatrix.getRowGroupIndices());
     }
     return result;
 }
@@ -296,6 +441,7 @@ template<typename MatrixValueType>
 std::vector<ValueType> StandardRewardModel<ValueType>::getTotalRewardVector(uint_fast64_t numberOfRows,
                                                                             storm::storage::SparseMatrix<MatrixValueType> const& transitionMatrix,
                                                                             storm::storage::BitVector const& filter) const {
+    std::vector<ValueType> buffer;
     std::vector<ValueType> result(numberOfRows);
     if (this->hasTransitionRewards()) {
         std::vector<ValueType> pointwiseProductRowSumVector = transitionMatrix.getPointwiseProductRowSumVector(this->getTransitionRewardMatrix());
@@ -303,11 +449,11 @@ std::vector<ValueType> StandardRewardModel<ValueType>::getTotalRewardVector(uint
     }
 
     if (this->hasStateActionRewards()) {
-        storm::utility::vector::addFilteredVectorGroupsToGroupedVector(result, this->getStateActionRewardVector(), filter,
+        storm::utility::vector::addFilteredVectorGroupsToGroupedVector(result, this->getStateActionRewardsAsVector(buffer), filter,
                                                                        transitionMatrix.getRowGroupIndices());
     }
     if (this->hasStateRewards()) {
-        storm::utility::vector::addFilteredVectorToGroupedVector(result, this->getStateRewardVector(), filter, transitionMatrix.getRowGroupIndices());
+        storm::utility::vector::addFilteredVectorToGroupedVector(result, this->getStateRewardsAsVector(buffer), filter, transitionMatrix.getRowGroupIndices());
     }
     return result;
 }
@@ -322,12 +468,11 @@ std::vector<ValueType> StandardRewardModel<ValueType>::getTotalActionRewardVecto
     } else {
         result = std::vector<ValueType>(transitionMatrix.getRowCount());
     }
-    if (this->hasStateActionRewards()) {
-        storm::utility::vector::addVectors(result, this->getStateActionRewardVector(), result);
-    }
+    addStateActionRewardsTo(result);
     if (this->hasStateRewards()) {
+        std::vector<ValueType> buffer;
         std::vector<ValueType> scaledStateRewardVector(transitionMatrix.getRowGroupCount());
-        storm::utility::vector::multiplyVectorsPointwise(this->getStateRewardVector(), stateRewardWeights, scaledStateRewardVector);
+        storm::utility::vector::multiplyVectorsPointwise(this->getStateRewardsAsVector(buffer), stateRewardWeights, scaledStateRewardVector);
         storm::utility::vector::addVectorToGroupedVector(result, scaledStateRewardVector, transitionMatrix.getRowGroupIndices());
     }
     return result;
@@ -343,12 +488,14 @@ template<typename ValueType>
 template<typename MatrixValueType>
 storm::storage::BitVector StandardRewardModel<ValueType>::getStatesWithFilter(storm::storage::SparseMatrix<MatrixValueType> const& transitionMatrix,
                                                                               std::function<bool(ValueType const&)> const& filter) const {
-    storm::storage::BitVector result = this->hasStateRewards() ? storm::utility::vector::filter(this->getStateRewardVector(), filter)
+    std::vector<ValueType> buffer;
+    storm::storage::BitVector result = this->hasStateRewards() ? storm::utility::vector::filter(this->getStateRewardsAsVector(buffer), filter)
                                                                : storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true);
     if (this->hasStateActionRewards()) {
+        auto const& stateActionRewardVector = this->getStateActionRewardsAsVector(buffer);
         for (uint_fast64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
             for (uint_fast64_t row = transitionMatrix.getRowGroupIndices()[state]; row < transitionMatrix.getRowGroupIndices()[state + 1]; ++row) {
-                if (!filter(this->getStateActionRewardVector()[row])) {
+                if (!filter(stateActionRewardVector[row])) {
                     result.set(state, false);
                     break;
                 }
@@ -379,15 +526,16 @@ template<typename ValueType>
 template<typename MatrixValueType>
 storm::storage::BitVector StandardRewardModel<ValueType>::getChoicesWithFilter(storm::storage::SparseMatrix<MatrixValueType> const& transitionMatrix,
                                                                                std::function<bool(ValueType const&)> const& filter) const {
+    std::vector<ValueType> buffer;
     storm::storage::BitVector result;
     if (this->hasStateActionRewards()) {
-        result = storm::utility::vector::filter(this->getStateActionRewardVector(), filter);
+        result = storm::utility::vector::filter(this->getStateActionRewardsAsVector(buffer), filter);
         if (this->hasStateRewards()) {
-            result &= transitionMatrix.getRowFilter(storm::utility::vector::filter(this->getStateRewardVector(), filter));
+            result &= transitionMatrix.getRowFilter(storm::utility::vector::filter(this->getStateRewardsAsVector(buffer), filter));
         }
     } else {
         if (this->hasStateRewards()) {
-            result = transitionMatrix.getRowFilter(storm::utility::vector::filter(this->getStateRewardVector(), filter));
+            result = transitionMatrix.getRowFilter(storm::utility::vector::filter(this->getStateRewardsAsVector(buffer), filter));
         } else {
             result = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
         }
@@ -425,16 +573,21 @@ void StandardRewardModel<ValueType>::clearRewardAtState(uint_fast64_t state, sto
 
 template<typename ValueType>
 bool StandardRewardModel<ValueType>::empty() const {
-    return !(static_cast<bool>(this->optionalStateRewardVector) || static_cast<bool>(this->optionalStateActionRewardVector) ||
-             static_cast<bool>(this->optionalTransitionRewardMatrix));
+    return !(this->hasStateRewards() || this->hasStateActionRewards() || static_cast<bool>(this->optionalTransitionRewardMatrix));
 }
 
 template<typename ValueType>
 bool StandardRewardModel<ValueType>::isAllZero() const {
-    if (hasStateRewards() && !std::all_of(getStateRewardVector().begin(), getStateRewardVector().end(), storm::utility::isZero<ValueType>)) {
-        return false;
-    }
-    if (hasStateActionRewards() && !std::all_of(getStateActionRewardVector().begin(), getStateActionRewardVector().end(), storm::utility::isZero<ValueType>)) {
+    auto isAllZeroVector = [](std::optional<std::vector<ValueType>> const& vector,
+                              std::optional<storm::storage::CompressedVector<ValueType>> const& compressed) {
+        if (compressed) {
+            return (compressed->size() == 0 || storm::utility::isZero(compressed->getDefaultValue())) &&
+                   std::all_of(compressed->getValues().begin(), compressed->getValues().end(), storm::utility::isZero<ValueType>);
+        }
+        return !vector || std::all_of(vector->begin(), vector->end(), storm::utility::isZero<ValueType>);
+    };
+    if (!isAllZeroVector(optionalStateRewardVector, compressedStateRewardVector) ||
+        !isAllZeroVector(optionalStateActionRewardVector, compressedStateActionRewardVector)) {
         return false;
     }
     if (hasTransitionRewards() && !std::all_of(getTransitionRewardMatrix().begin(), getTransitionRewardMatrix().end(),
@@ -449,11 +602,13 @@ bool StandardRewardModel<ValueType>::isAllZero() const {
 template<typename ValueType>
 bool StandardRewardModel<ValueType>::isCompatible(uint_fast64_t nrStates, uint_fast64_t nrChoices) const {
     if (hasStateRewards()) {
-        if (optionalStateRewardVector.value().size() != nrStates)
+        uint64_t size = compressedStateRewardVector ? compressedStateRewardVector->size() : optionalStateRewardVector.value().size();
+        if (size != nrStates)
             return false;
     }
     if (hasStateActionRewards()) {
-        if (optionalStateActionRewardVector.value().size() != nrChoices)
+        uint64_t size = compressedStateActionRewardVector ? compressedStateActionRewardVector->size() : optionalStateActionRewardVector.value().size();
+        if (size != nrChoices)
             return false;
     }
     return true;
@@ -462,11 +617,14 @@ bool StandardRewardModel<ValueType>::isCompatible(uint_fast64_t nrStates, uint_f
 template<typename ValueType>
 std::size_t StandardRewardModel<ValueType>::hash() const {
     size_t seed = 0;
+    std::vector<ValueType> buffer;
     if (hasStateRewards()) {
-        boost::hash_combine(seed, boost::hash_range(optionalStateRewardVector->begin(), optionalStateRewardVector->end()));
+        auto const& stateRewardVector = getStateRewardsAsVector(buffer);
+        boost::hash_combine(seed, boost::hash_range(stateRewardVector.begin(), stateRewardVector.end()));
     }
     if (hasStateActionRewards()) {
-        boost::hash_combine(seed, boost::hash_range(optionalStateActionRewardVector->begin(), optionalStateActionRewardVector->end()));
+        auto const& stateActionRewardVector = getStateActionRewardsAsVector(buffer);
+        boost::hash_combine(seed, boost::hash_range(stateActionRewardVector.begin(), stateActionRewardVector.end()));
     }
     if (hasTransitionRewards()) {
         boost::hash_combine(seed, optionalTransitionRewardMatrix->hash());
@@ -500,6 +658,8 @@ std::set<storm::RationalFunctionVariable> getRewardModelParameters(StandardRewar
 
 // Explicitly instantiate the class.
 template std::vector<double> StandardRewardModel<double>::getTotalRewardVector(storm::storage::SparseMatrix<double> const& transitionMatrix) const;
+template std::shared_ptr<std::vector<double> const> StandardRewardModel<double>::getSharedTotalRewardVector(
+    storm::storage::SparseMatrix<double> const& transitionMatrix) const;
 template std::vector<double> StandardRewardModel<double>::getTotalRewardVector(uint_fast64_t numberOfRows,
                                                                                storm::storage::SparseMatrix<double> const& transitionMatrix,
                                                                                storm::storage::BitVector const& filter) const;
@@ -531,6 +691,8 @@ template std::vector<storm::RationalNumber> StandardRewardModel<storm::RationalN
     uint_fast64_t numberOfRows, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::BitVector const& filter) const;
 template std::vector<storm::RationalNumber> StandardRewardModel<storm::RationalNumber>::getTotalRewardVector(
     storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix) const;
+template std::shared_ptr<std::vector<storm::RationalNumber> const> StandardRewardModel<storm::RationalNumber>::getSharedTotalRewardVector(
+    storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix) const;
 template std::vector<storm::RationalNumber> StandardRewardModel<storm::RationalNumber>::getTotalRewardVector(
     storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<storm::RationalNumber> const& weights) const;
 template std::vector<storm::RationalNumber> StandardRewardModel<storm::RationalNumber>::getTotalActionRewardVector(
@@ -558,6 +720,8 @@ template void StandardRewardModel<storm::RationalNumber>::setStateReward(uint_fa
 template class StandardRewardModel<storm::RationalNumber>;
 template std::ostream& operator<< <storm::RationalNumber>(std::ostream& out, StandardRewardModel<storm::RationalNumber> const& rewardModel);
 
+template std::shared_ptr<std::vector<storm::RationalFunction> const> StandardRewardModel<storm::RationalFunction>::getSharedTotalRewardVector(
+    storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix) const;
 template std::vector<storm::RationalFunction> StandardRewardModel<storm::RationalFunction>::getTotalRewardVector(
     uint_fast64_t numberOfRows, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::BitVector const& filter) const;
 template std::vector<storm::RationalFunction> StandardRewardModel<storm::RationalFunction>::getTotalRewardVector(
@@ -594,6 +758,10 @@ template std::vector<storm::Interval> StandardRewardModel<storm::Interval>::getT
                                                                                                  storm::storage::BitVector const& filter) const;
 template std::vector<storm::Interval> StandardRewardModel<storm::Interval>::getTotalRewardVector(
     storm::storage::SparseMatrix<double> const& transitionMatrix) const;
+template std::shared_ptr<std::vector<storm::Interval> const> StandardRewardModel<storm::Interval>::getSharedTotalRewardVector(
+    storm::storage::SparseMatrix<double> const& transitionMatrix) const;
+template std::shared_ptr<std::vector<storm::Interval> const> StandardRewardModel<storm::Interval>::getSharedTotalRewardVector(
+    storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix) const;
 template std::vector<storm::Interval> StandardRewardModel<storm::Interval>::getTotalRewardVector(storm::storage::SparseMatrix<double> const& transitionMatrix,
                                                                                                  std::vector<double> const& weights) const;
 template std::vector<storm::Interval> StandardRewardModel<storm::Interval>::getTotalRewardVector(
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <set>
 #include <vector>
 
 #include "storm/adapters/RationalFunctionForward.h"
+#include "storm/storage/CompressedVector.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/utility/OptionalRef.h"
 #include "storm/utility/OsDetection.h"
@@ -283,6 +285,13 @@ class StandardRewardModel {
     std::vector<ValueType> getTotalActionRewardVector(storm::storage::SparseMatrix<MatrixValueType> const& transitionMatrix,
                                                       std::vector<MatrixValueType> const& stateRewardWeights) const;
 
+    /*!
+     * Retrieves the same vector as getTotalRewardVector(transitionMatrix). Unless the reward model has transition rewards, the vector is computed
+     * only once and then shared among all calls for transition matrices with the same row grouping.
+     */
+    template<typename MatrixValueType>
+    std::shared_ptr<std::vector<ValueType> const> getSharedTotalRewardVector(storm::storage::SparseMatrix<MatrixValueType> const& transitionMatrix) const;
+
     /*!
      * Returns the set of states at which a all rewards (state-, action- and transition-rewards) are zero.
      *
@@ -317,6 +326,18 @@ class StandardRewardModel {
     storm::storage::BitVector getChoicesWithFilter(storm::storage::SparseMatrix<MatrixValueType> const& transitionMatrix,
                                                    std::function<bool(ValueType const&)> const& filter) const;
 
+    /*!
+     * Stores the state and state-action rewards in compressed form if they are constant or sparse. Compressed rewards are expanded again once they
+     * are accessed as a vector (e.g. via getStateActionRewardVector), while accessing single rewards or computing total reward vectors keeps them
+     * compressed.
+     */
+    void compress();
+
+    /*!
+     * Retrieves whether the state or the state-action rewards are currently stored in compressed form.
+     */
+    bool isCompressed() const;
+
     /*!
      * Retrieves whether the reward model is empty, i.e. contains no state-, state-action- or transition-based
      * rewards.
@@ -350,14 +371,47 @@ class StandardRewardModel {
     friend std::ostream& operator<<(std::ostream& out, StandardRewardModel<ValueTypePrime> const& rewardModel);
 
    private:
-    // An (optional) vector representing the state rewards.
-    std::optional<std::vector<ValueType>> optionalStateRewardVector;
+    /*!
+     * Expands the compressed state (or state-action) rewards (if any).
+     */
+    void expandStateRewards() const;
+    void expandStateActionRewards() const;
 
-    // An (optional) vector representing the state-action rewards.
-    std::optional<std::vector<ValueType>> optionalStateActionRewardVector;
+    /*!
+     * Retrieves the state (or state-action) rewards as a vector. If they are compressed, the given buffer is filled and returned instead of
+     * expanding the rewards permanently.
+     */
+    std::vector<ValueType> const& getStateRewardsAsVector(std::vector<ValueType>& buffer) const;
+    std::vector<ValueType> const& getStateActionRewardsAsVector(std::vector<ValueType>& buffer) const;
+
+    /*!
+     * Adds the state-action rewards to the given vector.
+     */
+    void addStateActionRewardsTo(std::vector<ValueType>& target) const;
+
+    /*!
+     * Discards the shared total reward vector. This is necessary whenever the rewards might be changed.
+     */
+    void invalidateSharedTotalRewardVector();
+
+    // An (optional) vector representing the state rewards. The vector is not present while the state rewards are compressed. Note that expanding
+    // compressed rewards modifies this member even for const access, so concurrent access to a reward model with compressed rewards is not safe.
+    mutable std::optional<std::vector<ValueType>> optionalStateRewardVector;
+    mutable std::optional<storm::storage::CompressedVector<ValueType>> compressedStateRewardVector;
+
+    // An (optional) vector representing the state-action rewards. As for the state rewards, it is not present while the rewards are compressed.
+    mutable std::optional<std::vector<ValueType>> optionalStateActionRewardVector;
+    mutable std::optional<storm::storage::CompressedVector<ValueType>> compressedStateActionRewardVector;
 
     // An (optional) matrix representing the transition rewards.
     std::optional<storm::storage::SparseMatrix<ValueType>> optionalTransitionRewardMatrix;
+
+    // The total reward vector that is shared among calls of getSharedTotalRewardVector together with the row grouping it was computed for.
+    struct SharedTotalRewardVector {
+        std::vector<storm::storage::SparseMatrixIndexType> rowGroupIndices;
+        std::shared_ptr<std::vector<ValueType> const> vector;
+    };
+    mutable std::shared_ptr<SharedTotalRewardVector const> sharedTotalRewardVector;
 };
 
 template<typename ValueType>
@@ -34,6 +34,7 @@ const std::string AbstractionSettings::injectRefinementPredicatesOptionName = "i
 const std::string AbstractionSettings::fixPlayer1StrategyOptionName = "fixpl1strat";
 const std::string AbstractionSettings::fixPlayer2StrategyOptionName = "fixpl2strat";
 const std::string AbstractionSettings::validBlockModeOptionName = "validmode";
+const std::string AbstractionSettings::threadsOptionName = "threads";
 
 AbstractionSettings::AbstractionSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> methods = {"games", "bisimulation", "bisim"};
@@ -214,6 +215,15 @@ AbstractionSettings::AbstractionSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("morepreds")
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true,
+                                                   "Sets the number of threads that concurrently enumerate the abstractions of commands (or edges).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 AbstractionSettings::Method AbstractionSettings::getAbstractionRefinementMethod() const {
@@ -358,6 +368,10 @@ AbstractionSettings::ValidBlockMode AbstractionSettings::getValidBlockMode() con
     return ValidBlockMode::MorePredicates;
 }
 
+uint_fast64_t AbstractionSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -183,6 +183,11 @@ class AbstractionSettings : public ModuleSettings {
      */
     ValidBlockMode getValidBlockMode() const;
 
+    /*!
+     * Retrieves the number of threads that concurrently enumerate the abstractions of commands (or edges).
+     */
+    uint_fast64_t getNumberOfThreads() const;
+
     const static std::string moduleName;
 
    private:
@@ -207,6 +212,7 @@ class AbstractionSettings : public ModuleSettings {
     const static std::string fixPlayer1StrategyOptionName;
     const static std::string fixPlayer2StrategyOptionName;
     const static std::string validBlockModeOptionName;
+    const static std::string threadsOptionName;
 };
 
 }  // namespace modules
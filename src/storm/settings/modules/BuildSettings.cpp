@@ -11,6 +11,7 @@
 
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace settings {
@@ -36,10 +37,21 @@ const std::string buildObservationValuationsOptionName = "buildobsval";
 const std::string buildAllLabelsOptionName = "build-all-labels";
 const std::string buildOutOfBoundsStateOptionName = "build-out-of-bounds-state";
 const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-guards-label";
+const std::string symmetryReductionOptionName = "symmetry-reduction";
+const std::string partialOrderReductionOptionName = "partial-order-reduction";
 const std::string noSimplifyOptionName = "no-simplify";
+const std::string noSlicingOptionName = "no-slicing";
+const std::string compressChainsOptionName = "compress-chains";
 const std::string bitsForUnboundedVariablesOptionName = "int-bits";
 const std::string performLocationElimination = "location-elimination";
 const std::string explorationStateLimitOptionName = "state-limit";
+const std::string explorationMassThresholdOptionName = "mass-threshold";
+const std::string buildThreadsOptionName = "build-threads";
+const std::string buildCacheOptionName = "build-cache";
+const std::string diskStateStorageOptionName = "disk-states";
+const std::string ddVariableOrderOptionName = "ddvarorder";
+const std::string ddReorderingOptionName = "ddreorder";
+const std::string ddReachabilityOptionName = "ddreach";
 
 BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, prismCompatibilityOptionName, false,
@@ -72,7 +84,7 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, buildAllLabelsOptionName, false, "If set, build all labels").setIsAdvanced().build());
     this->addOption(storm::settings::OptionBuilder(moduleName, noBuildOptionName, false, "If set, do not build the model.").setIsAdvanced().build());
 
-    std::vector<std::string> explorationOrders = {"dfs", "bfs"};
+    std::vector<std::string> explorationOrders = {"dfs", "bfs", "prob"};
     this->addOption(storm::settings::OptionBuilder(moduleName, explorationOrderOptionName, false, "Sets which exploration order to use.")
                         .setShortName(explorationOrderOptionShortName)
                         .setIsAdvanced()
@@ -92,8 +104,26 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                                    "For states where multiple guards are enabled, we add a label (for debugging DTMCs)")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, symmetryReductionOptionName, false,
+                                                   "If set, states that only differ by a permutation of replicated PRISM modules are merged (sparse engine).")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, partialOrderReductionOptionName, false,
+                                                   "If set, partial order reduction is applied when building MDPs from PRISM programs (sparse engine). Only "
+                                                   "sound for next-free linear-time properties over the labels, e.g., reachability probabilities.")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, noSimplifyOptionName, false, "If set, simplification PRISM input is disabled.").setIsAdvanced().build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, noSlicingOptionName, false,
+                                                   "If set, variables of PRISM input that can not influence the properties are not removed before building.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, compressChainsOptionName, false,
+                                                   "If set, unlabeled states of DTMCs and MDPs without rewards that have a single successor are skipped while "
+                                                   "building (sparse engine). Only sound for properties without step bounds and next operators.")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, bitsForUnboundedVariablesOptionName, false,
                                                    "Sets the number of bits that is used for unbounded integer variables.")
                         .setIsAdvanced()
@@ -122,6 +152,68 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "states to explore before stopping.").build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationMassThresholdOptionName, false,
+                                                   "Stops the probability-guided exploration once the estimated probability mass of the unexplored states is "
+                                                   "below the given threshold. The remaining states are labeled as 'unexplored'.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("epsilon", "The probability mass threshold.")
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, buildThreadsOptionName, false,
+                                                   "Sets the number of threads used for explicit state space exploration and for parsing DRN files.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, buildCacheOptionName, false,
+                                       "Caches explicitly built models in the given directory and reuses them if the same model is built again.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The cache directory (created if it does not exist).").build())
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The maximal size of the cache in megabytes.")
+                             .setDefaultValueUnsignedInteger(4096)
+                             .makeOptional()
+                             .build())
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, diskStateStorageOptionName, false,
+                                                   "Keeps only the given number of states in memory during explicit breadth-first exploration and moves the "
+                                                   "others to sorted files on disk.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("states", "The number of states kept in memory.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "directory", "The directory for the files (empty means the directory for temporary files).")
+                                         .setDefaultValueString("")
+                                         .makeOptional()
+                                         .build())
+                        .build());
+    std::vector<std::string> ddVariableOrders = {"declaration", "force"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderOptionName, false,
+                                                   "Sets the order in which the symbolic PRISM builder allocates the DD variables of the model variables.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the variable order to choose.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrders))
+                                         .setDefaultValueString("declaration")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddReorderingOptionName, false,
+                                                   "If set, the symbolic builders reorder the DD variables with CUDD's reordering technique once the reachable "
+                                                   "states are known.")
+                        .setIsAdvanced()
+                        .build());
+    std::vector<std::string> ddReachabilityStrategies = {"bfs", "chaining", "saturation"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddReachabilityOptionName, false,
+                                                   "Sets how the symbolic builders compute the reachable states. Except for bfs, the transition relation is "
+                                                   "partitioned by modules and actions.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the strategy to choose.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddReachabilityStrategies))
+                                         .setDefaultValueString("bfs")
+                                         .build())
+                        .build());
 }
 
 bool BuildSettings::isExplorationOrderSet() const {
@@ -176,6 +268,14 @@ bool BuildSettings::isAddOverlappingGuardsLabelSet() const {
     return this->getOption(buildOverlappingGuardsLabelOptionName).getHasOptionBeenSet();
 }
 
+bool BuildSettings::isSymmetryReductionSet() const {
+    return this->getOption(symmetryReductionOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isPartialOrderReductionSet() const {
+    return this->getOption(partialOrderReductionOptionName).getHasOptionBeenSet();
+}
+
 bool BuildSettings::isBuildAllLabelsSet() const {
     return this->getOption(buildAllLabelsOptionName).getHasOptionBeenSet();
 }
@@ -186,6 +286,8 @@ storm::builder::ExplorationOrder BuildSettings::getExplorationOrder() const {
         return storm::builder::ExplorationOrder::Dfs;
     } else if (explorationOrderAsString == "bfs") {
         return storm::builder::ExplorationOrder::Bfs;
+    } else if (explorationOrderAsString == "prob") {
+        return storm::builder::ExplorationOrder::Probability;
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
 }
@@ -198,6 +300,14 @@ bool BuildSettings::isNoSimplifySet() const {
     return this->getOption(noSimplifyOptionName).getHasOptionBeenSet();
 }
 
+bool BuildSettings::isNoSlicingSet() const {
+    return this->getOption(noSlicingOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isCompressChainsSet() const {
+    return this->getOption(compressChainsOptionName).getHasOptionBeenSet();
+}
+
 uint64_t BuildSettings::getBitsForUnboundedVariables() const {
     return this->getOption(bitsForUnboundedVariablesOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
 }
@@ -222,6 +332,73 @@ uint64_t BuildSettings::getExplorationStateLimit() const {
     return this->getOption(explorationStateLimitOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
 }
 
+bool BuildSettings::isExplorationMassThresholdSet() const {
+    return this->getOption(explorationMassThresholdOptionName).getHasOptionBeenSet();
+}
+
+double BuildSettings::getExplorationMassThreshold() const {
+    return this->getOption(explorationMassThresholdOptionName).getArgumentByName("epsilon").getValueAsDouble();
+}
+
+uint64_t BuildSettings::getNumberOfBuildThreads() const {
+    uint64_t numberFromSettings = this->getOption(buildThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    if (numberFromSettings != 0u) {
+        return numberFromSettings;
+    }
+    // Automatic detection
+    return std::max(1u, storm::utility::getNumberOfThreads());
+}
+
+bool BuildSettings::isBuildCacheSet() const {
+    return this->getOption(buildCacheOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getBuildCacheDirectory() const {
+    return this->getOption(buildCacheOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+uint64_t BuildSettings::getBuildCacheSizeLimit() const {
+    return this->getOption(buildCacheOptionName).getArgumentByName("size").getValueAsUnsignedInteger() * 1024 * 1024;
+}
+
+bool BuildSettings::isDiskBackedStateStorageSet() const {
+    return this->getOption(diskStateStorageOptionName).getHasOptionBeenSet();
+}
+
+uint64_t BuildSettings::getMaximalNumberOfStatesInMemory() const {
+    return this->getOption(diskStateStorageOptionName).getArgumentByName("states").getValueAsUnsignedInteger();
+}
+
+std::string BuildSettings::getStateStorageDirectory() const {
+    return this->getOption(diskStateStorageOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+storm::builder::DdVariableOrder BuildSettings::getDdVariableOrder() const {
+    std::string ddVariableOrderAsString = this->getOption(ddVariableOrderOptionName).getArgumentByName("name").getValueAsString();
+    if (ddVariableOrderAsString == "declaration") {
+        return storm::builder::DdVariableOrder::Declaration;
+    } else if (ddVariableOrderAsString == "force") {
+        return storm::builder::DdVariableOrder::Force;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown DD variable order '" << ddVariableOrderAsString << "'.");
+}
+
+bool BuildSettings::isDdReorderingSet() const {
+    return this->getOption(ddReorderingOptionName).getHasOptionBeenSet();
+}
+
+storm::builder::DdReachabilityStrategy BuildSettings::getDdReachabilityStrategy() const {
+    std::string strategyAsString = this->getOption(ddReachabilityOptionName).getArgumentByName("name").getValueAsString();
+    if (strategyAsString == "bfs") {
+        return storm::builder::DdReachabilityStrategy::BreadthFirst;
+    } else if (strategyAsString == "chaining") {
+        return storm::builder::DdReachabilityStrategy::Chaining;
+    } else if (strategyAsString == "saturation") {
+        return storm::builder::DdReachabilityStrategy::Saturation;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown DD reachability strategy '" << strategyAsString << "'.");
+}
+
 }  // namespace modules
 
 }  // namespace settings
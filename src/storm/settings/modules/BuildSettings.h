@@ -1,6 +1,8 @@
 #pragma once
 
 #include "storm-config.h"
+#include "storm/builder/DdReachabilityStrategy.h"
+#include "storm/builder/DdVariableOrder.h"
 #include "storm/builder/ExplorationOrder.h"
 #include "storm/settings/modules/ModuleSettings.h"
 
@@ -108,6 +110,16 @@ class BuildSettings : public ModuleSettings {
      */
     bool isAddOverlappingGuardsLabelSet() const;
 
+    /*!
+     * Retrieves whether states that only differ by a permutation of replicated modules are to be merged.
+     */
+    bool isSymmetryReductionSet() const;
+
+    /*!
+     * Retrieves whether partial order reduction is to be applied when building MDPs.
+     */
+    bool isPartialOrderReductionSet() const;
+
     /*!
      * Retrieves whether all labels should be build
      */
@@ -124,6 +136,16 @@ class BuildSettings : public ModuleSettings {
      */
     bool isNoSimplifySet() const;
 
+    /*!
+     * Retrieves whether removing the parts of symbolic inputs that can not influence the properties shall be disabled
+     */
+    bool isNoSlicingSet() const;
+
+    /*!
+     * Retrieves whether deterministic chains of unlabeled states without rewards shall be compressed during the explicit exploration
+     */
+    bool isCompressChainsSet() const;
+
     /*!
      * Retrieves whether location elimination is enabled
      */
@@ -149,6 +171,68 @@ class BuildSettings : public ModuleSettings {
      */
     uint64_t getExplorationStateLimit() const;
 
+    /*!
+     * Retrieves whether a probability mass threshold has been set for the probability-guided exploration.
+     */
+    bool isExplorationMassThresholdSet() const;
+
+    /*!
+     * Retrieves the probability mass threshold (if set). The probability-guided exploration stops once the estimated probability mass of the unexplored
+     * states is below this threshold.
+     */
+    double getExplorationMassThreshold() const;
+
+    /*!
+     * Retrieves the number of threads that are to be used for explicit state space exploration (and parsing). If the number was set to zero, the number of
+     * available hardware threads is returned.
+     */
+    uint64_t getNumberOfBuildThreads() const;
+
+    /*!
+     * Retrieves whether built models are to be cached on disk.
+     */
+    bool isBuildCacheSet() const;
+
+    /*!
+     * Retrieves the directory in which built models are cached.
+     */
+    std::string getBuildCacheDirectory() const;
+
+    /*!
+     * Retrieves the maximal size (in bytes) of the files in the build cache directory.
+     */
+    uint64_t getBuildCacheSizeLimit() const;
+
+    /*!
+     * Retrieves whether the explicit state space exploration is to keep only a bounded number of states in memory (and the others on disk).
+     */
+    bool isDiskBackedStateStorageSet() const;
+
+    /*!
+     * Retrieves the number of states that the explicit state space exploration keeps in memory before writing them to disk.
+     */
+    uint64_t getMaximalNumberOfStatesInMemory() const;
+
+    /*!
+     * Retrieves the directory in which the states written to disk are stored. If empty, the directory for temporary files is used.
+     */
+    std::string getStateStorageDirectory() const;
+
+    /*!
+     * Retrieves the order in which the symbolic builders allocate the DD variables of the model variables.
+     */
+    storm::builder::DdVariableOrder getDdVariableOrder() const;
+
+    /*!
+     * Retrieves whether the symbolic builders reorder the DD variables after the reachable states have been computed.
+     */
+    bool isDdReorderingSet() const;
+
+    /*!
+     * Retrieves the strategy with which the symbolic builders compute the reachable states.
+     */
+    storm::builder::DdReachabilityStrategy getDdReachabilityStrategy() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
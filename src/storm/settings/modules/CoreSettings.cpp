@@ -10,6 +10,8 @@
 
 #include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/storage/dd/DdType.h"
+#include "storm/utility/TaskRuntime.h"
+#include "storm/utility/threads.h"
 
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/exceptions/InvalidOptionException.h"
@@ -28,8 +30,13 @@ const std::string CoreSettings::statisticsOptionShortName = "stats";
 const std::string CoreSettings::engineOptionName = "engine";
 const std::string CoreSettings::engineOptionShortName = "e";
 const std::string CoreSettings::ddLibraryOptionName = "ddlib";
+const std::string CoreSettings::ddStatisticsOptionName = "ddstats";
 const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
 const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+const std::string CoreSettings::solverThreadsOptionName = "solver-threads";
+const std::string CoreSettings::threadAffinityOptionName = "thread-affinity";
+const std::string CoreSettings::distributedOptionName = "distributed";
+const std::string CoreSettings::solverCheckpointOptionName = "solver-checkpoint";
 
 CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility::Engine::Sparse) {
     std::vector<std::string> engines;
@@ -81,11 +88,53 @@ CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility
     this->addOption(storm::settings::OptionBuilder(moduleName, statisticsOptionName, false, "Sets whether to display statistics if available.")
                         .setShortName(statisticsOptionShortName)
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddStatisticsOptionName, false,
+                                                   "Sets whether to display statistics of the DD library after model construction and model checking.")
+                        .setIsAdvanced()
+                        .build());
 
     this->addOption(
         storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).")
             .setShortName(intelTbbOptionShortName)
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, solverThreadsOptionName, false,
+                                                   "Sets the number of threads used by value iteration based solvers.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    std::vector<std::string> threadAffinityPolicies = {"none", "numa"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadAffinityOptionName, false,
+                                                   "Sets how the threads of parallel computations are placed on the processors.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "policy", "The name of the policy. 'numa' binds the threads to NUMA nodes and places their data on the local node.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(threadAffinityPolicies))
+                                         .setDefaultValueString("none")
+                                         .build())
+                        .build());
+    std::vector<std::string> statePartitionings = {"blocks", "hash"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, distributedOptionName, false,
+                                                   "Sets whether value iteration distributes the states over the processes of the MPI job (if Storm was "
+                                                   "built with support for MPI).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "partitioning", "How the states are distributed. 'blocks' assigns contiguous ranges, 'hash' scatters the states.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(statePartitionings))
+                                         .setDefaultValueString("blocks")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, solverCheckpointOptionName, false,
+                                                   "Sets a file to which iterative solvers periodically write their state. Solving an equation system whose "
+                                                   "state is stored in the file resumes from this state.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the checkpoint file.").build())
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("interval", "The time between two checkpoints in seconds.")
+                                         .setDefaultValueUnsignedInteger(600)
+                                         .makeOptional()
+                                         .build())
+                        .build());
 }
 
 storm::solver::EquationSolverType CoreSettings::getEquationSolver() const {
@@ -160,10 +209,59 @@ bool CoreSettings::isShowStatisticsSet() const {
     return this->getOption(statisticsOptionName).getHasOptionBeenSet();
 }
 
+bool CoreSettings::isShowDdStatisticsSet() const {
+    return this->getOption(ddStatisticsOptionName).getHasOptionBeenSet();
+}
+
 bool CoreSettings::isUseIntelTbbSet() const {
     return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
 }
 
+uint64_t CoreSettings::getNumberOfSolverThreads() const {
+    uint64_t numberFromSettings = this->getOption(solverThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    if (numberFromSettings != 0u) {
+        return numberFromSettings;
+    }
+    // Automatic detection
+    return storm::utility::parallel::TaskRuntime::runtime().getNumberOfThreads();
+}
+
+storm::utility::ThreadAffinityPolicy CoreSettings::getThreadAffinityPolicy() const {
+    std::string policyAsString = this->getOption(threadAffinityOptionName).getArgumentByName("policy").getValueAsString();
+    if (policyAsString == "none") {
+        return storm::utility::ThreadAffinityPolicy::None;
+    } else if (policyAsString == "numa") {
+        return storm::utility::ThreadAffinityPolicy::NumaNodes;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown thread affinity policy '" << policyAsString << "'.");
+}
+
+bool CoreSettings::isDistributedSet() const {
+    return this->getOption(distributedOptionName).getHasOptionBeenSet();
+}
+
+storm::utility::mpi::StatePartitioning CoreSettings::getDistributedStatePartitioning() const {
+    std::string partitioningAsString = this->getOption(distributedOptionName).getArgumentByName("partitioning").getValueAsString();
+    if (partitioningAsString == "blocks") {
+        return storm::utility::mpi::StatePartitioning::Blocks;
+    } else if (partitioningAsString == "hash") {
+        return storm::utility::mpi::StatePartitioning::Hash;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown state partitioning '" << partitioningAsString << "'.");
+}
+
+bool CoreSettings::isSolverCheckpointSet() const {
+    return this->getOption(solverCheckpointOptionName).getHasOptionBeenSet();
+}
+
+std::string CoreSettings::getSolverCheckpointFilename() const {
+    return this->getOption(solverCheckpointOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+uint64_t CoreSettings::getSolverCheckpointInterval() const {
+    return this->getOption(solverCheckpointOptionName).getArgumentByName("interval").getValueAsUnsignedInteger();
+}
+
 storm::utility::Engine CoreSettings::getEngine() const {
     return engine;
 }
@@ -180,6 +278,8 @@ void CoreSettings::finalize() {
 }
 
 bool CoreSettings::check() const {
+    STORM_LOG_WARN_COND(!isDistributedSet() || storm::utility::mpi::isSupported(),
+                        "Distributed value iteration is not supported in this version of Storm as it was not built with support for MPI.");
 #ifdef STORM_HAVE_INTELTBB
     return true;
 #else
@@ -6,6 +6,8 @@
 
 #include "storm/builder/ExplorationOrder.h"
 #include "storm/utility/Engine.h"
+#include "storm/utility/mpi.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace solver {
@@ -95,6 +97,13 @@ class CoreSettings : public ModuleSettings {
      */
     bool isShowStatisticsSet() const;
 
+    /*!
+     * Retrieves whether statistics of the DD library are to be shown.
+     *
+     * @return True iff DD statistics are to be shown.
+     */
+    bool isShowDdStatisticsSet() const;
+
     /*!
      * Retrieves whether the option to use Intel TBB is set.
      *
@@ -102,6 +111,55 @@ class CoreSettings : public ModuleSettings {
      */
     bool isUseIntelTbbSet() const;
 
+    /*!
+     * Retrieves the number of threads that iterative solvers (value iteration and its variants) use.
+     *
+     * @return The number of threads. If 'auto-detect' is selected, this is the number of hardware threads.
+     */
+    uint64_t getNumberOfSolverThreads() const;
+
+    /*!
+     * Retrieves the policy that determines how the threads of parallel computations are placed on the processors.
+     *
+     * @return The thread affinity policy.
+     */
+    storm::utility::ThreadAffinityPolicy getThreadAffinityPolicy() const;
+
+    /*!
+     * Retrieves whether value iteration is to be distributed over the processes of the MPI job.
+     *
+     * @return True iff the option was set.
+     */
+    bool isDistributedSet() const;
+
+    /*!
+     * Retrieves how the states are distributed over the processes of the MPI job.
+     *
+     * @return The state partitioning.
+     */
+    storm::utility::mpi::StatePartitioning getDistributedStatePartitioning() const;
+
+    /*!
+     * Retrieves whether iterative solvers write checkpoints of their state.
+     *
+     * @return True iff the option was set.
+     */
+    bool isSolverCheckpointSet() const;
+
+    /*!
+     * Retrieves the name of the file to which iterative solvers write checkpoints of their state.
+     *
+     * @return The name of the checkpoint file.
+     */
+    std::string getSolverCheckpointFilename() const;
+
+    /*!
+     * Retrieves the time between two checkpoints of iterative solvers.
+     *
+     * @return The interval in seconds.
+     */
+    uint64_t getSolverCheckpointInterval() const;
+
     /*!
      * Retrieves the selected engine.
      *
@@ -132,8 +190,13 @@ class CoreSettings : public ModuleSettings {
     static const std::string engineOptionName;
     static const std::string engineOptionShortName;
     static const std::string ddLibraryOptionName;
+    static const std::string ddStatisticsOptionName;
     static const std::string intelTbbOptionName;
     static const std::string intelTbbOptionShortName;
+    static const std::string solverThreadsOptionName;
+    static const std::string threadAffinityOptionName;
+    static const std::string distributedOptionName;
+    static const std::string solverCheckpointOptionName;
 };
 
 }  // namespace modules
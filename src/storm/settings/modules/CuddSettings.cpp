@@ -19,6 +19,7 @@ const std::string CuddSettings::precisionOptionName = "precision";
 const std::string CuddSettings::maximalMemoryOptionName = "maxmem";
 const std::string CuddSettings::reorderOptionName = "dynreorder";
 const std::string CuddSettings::reorderTechniqueOptionName = "reordertechnique";
+const std::string CuddSettings::cacheSizeOptionName = "cachesize";
 
 CuddSettings::CuddSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, true, "Sets the precision used by Cudd.")
@@ -38,6 +39,14 @@ CuddSettings::CuddSettings() : ModuleSettings(moduleName) {
                              .build())
             .build());
 
+    this->addOption(storm::settings::OptionBuilder(moduleName, cacheSizeOptionName, true, "Sets the initial number of slots in the operation cache of Cudd.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The number of cache slots.")
+                                         .setDefaultValueUnsignedInteger(262144)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorIncluding(1, 1ull << 31))
+                                         .build())
+                        .build());
+
     this->addOption(
         storm::settings::OptionBuilder(moduleName, reorderOptionName, false, "Sets whether dynamic reordering is allowed.").setIsAdvanced().build());
 
@@ -78,6 +87,10 @@ uint_fast64_t CuddSettings::getMaximalMemory() const {
     return this->getOption(maximalMemoryOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
 }
 
+uint_fast64_t CuddSettings::getCacheSize() const {
+    return this->getOption(cacheSizeOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
 bool CuddSettings::isReorderingEnabled() const {
     return this->getOption(reorderOptionName).getHasOptionBeenSet();
 }
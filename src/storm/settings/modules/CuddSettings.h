@@ -53,6 +53,13 @@ class CuddSettings : public ModuleSettings {
      */
     uint_fast64_t getMaximalMemory() const;
 
+    /*!
+     * Retrieves the initial number of slots in the operation cache of CUDD.
+     *
+     * @return The number of cache slots.
+     */
+    uint_fast64_t getCacheSize() const;
+
     /*!
      * Retrieves whether dynamic reordering is enabled.
      *
@@ -76,6 +83,7 @@ class CuddSettings : public ModuleSettings {
     static const std::string maximalMemoryOptionName;
     static const std::string reorderOptionName;
     static const std::string reorderTechniqueOptionName;
+    static const std::string cacheSizeOptionName;
 };
 
 }  // namespace modules
@@ -23,6 +23,8 @@ const std::string EigenEquationSolverSettings::maximalIterationsOptionName = "ma
 const std::string EigenEquationSolverSettings::maximalIterationsOptionShortName = "i";
 const std::string EigenEquationSolverSettings::precisionOptionName = "precision";
 const std::string EigenEquationSolverSettings::restartOptionName = "restart";
+const std::string EigenEquationSolverSettings::noFloatingPointPresolveOptionName = "nofloatpresolve";
+const std::string EigenEquationSolverSettings::refinementStepsOptionName = "refinesteps";
 
 EigenEquationSolverSettings::EigenEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> methods = {"sparselu", "bicgstab", "dgmres", "gmres"};
@@ -68,6 +70,21 @@ EigenEquationSolverSettings::EigenEquationSolverSettings() : ModuleSettings(modu
                                          .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, noFloatingPointPresolveOptionName, false,
+                                                   "If set, rational equation systems are directly solved with an exact LU factorization instead of first "
+                                                   "solving them in floating point and certifying the rounded solution.")
+                        .setIsAdvanced()
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, refinementStepsOptionName, false,
+                                                   "The maximal number of iterative refinement steps applied to a floating point solution that could not be "
+                                                   "certified as exact solution.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The maximal number of refinement steps.")
+                                         .setDefaultValueUnsignedInteger(2)
+                                         .build())
+                        .build());
 }
 
 bool EigenEquationSolverSettings::isLinearEquationSystemMethodSet() const {
@@ -135,6 +152,14 @@ double EigenEquationSolverSettings::getPrecision() const {
     return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
 }
 
+bool EigenEquationSolverSettings::isFloatingPointPresolveSet() const {
+    return !this->getOption(noFloatingPointPresolveOptionName).getHasOptionBeenSet();
+}
+
+uint_fast64_t EigenEquationSolverSettings::getNumberOfRefinementSteps() const {
+    return this->getOption(refinementStepsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool EigenEquationSolverSettings::check() const {
     // This list does not include the precision, because this option is shared with other modules.
     bool optionsSet = isLinearEquationSystemMethodSet() || isPreconditioningMethodSet() || isMaximalIterationCountSet();
@@ -100,6 +100,21 @@ class EigenEquationSolverSettings : public ModuleSettings {
      */
     double getPrecision() const;
 
+    /*!
+     * Retrieves whether rational equation systems are to be solved in floating point first, where the (rounded) solution is only used if it can be
+     * certified to be the exact solution.
+     *
+     * @return True iff the floating point presolve is enabled.
+     */
+    bool isFloatingPointPresolveSet() const;
+
+    /*!
+     * Retrieves the maximal number of iterative refinement steps applied to a floating point solution that could not be certified.
+     *
+     * @return The maximal number of refinement steps.
+     */
+    uint_fast64_t getNumberOfRefinementSteps() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -113,6 +128,8 @@ class EigenEquationSolverSettings : public ModuleSettings {
     static const std::string maximalIterationsOptionShortName;
     static const std::string precisionOptionName;
     static const std::string restartOptionName;
+    static const std::string noFloatingPointPresolveOptionName;
+    static const std::string refinementStepsOptionName;
 };
 
 std::ostream& operator<<(std::ostream& out, EigenEquationSolverSettings::LinearEquationMethod const& method);
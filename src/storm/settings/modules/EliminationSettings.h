@@ -62,6 +62,13 @@ class EliminationSettings : public ModuleSettings {
      */
     bool isUseDedicatedModelCheckerSet() const;
 
+    /*!
+     * Retrieves the number of threads that are used to eliminate states concurrently.
+     *
+     * @return The number of threads.
+     */
+    uint_fast64_t getNumberOfThreads() const;
+
     const static std::string moduleName;
 
    private:
@@ -70,6 +77,7 @@ class EliminationSettings : public ModuleSettings {
     const static std::string entryStatesLastOptionName;
     const static std::string maximalSccSizeOptionName;
     const static std::string useDedicatedModelCheckerOptionName;
+    const static std::string threadsOptionName;
 };
 
 }  // namespace modules
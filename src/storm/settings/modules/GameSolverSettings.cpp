@@ -17,6 +17,7 @@ const std::string GameSolverSettings::maximalIterationsOptionName = "maxiter";
 const std::string GameSolverSettings::maximalIterationsOptionShortName = "i";
 const std::string GameSolverSettings::precisionOptionName = "precision";
 const std::string GameSolverSettings::absoluteOptionName = "absolute";
+const std::string GameSolverSettings::valueIterationMultiplicationStyleOptionName = "vimult";
 
 GameSolverSettings::GameSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> gameSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration"};
@@ -47,6 +48,17 @@ GameSolverSettings::GameSolverSettings() : ModuleSettings(moduleName) {
                                                    "Sets whether the relative or the absolute error is considered for detecting convergence.")
                         .setIsAdvanced()
                         .build());
+
+    std::vector<std::string> multiplicationStyles = {"gaussseidel", "regular", "gs", "r"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, valueIterationMultiplicationStyleOptionName, false,
+                                                   "Sets which multiplication style to prefer for value iteration. Regular multiplications may use multiple "
+                                                   "threads, Gauss-Seidel updates the values in place.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplication style.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplicationStyles))
+                                         .setDefaultValueString("regular")
+                                         .build())
+                        .build());
 }
 
 storm::solver::GameMethod GameSolverSettings::getGameSolvingMethod() const {
@@ -93,6 +105,16 @@ GameSolverSettings::ConvergenceCriterion GameSolverSettings::getConvergenceCrite
                                                                      : GameSolverSettings::ConvergenceCriterion::Relative;
 }
 
+storm::solver::MultiplicationStyle GameSolverSettings::getValueIterationMultiplicationStyle() const {
+    std::string multiplicationStyleString = this->getOption(valueIterationMultiplicationStyleOptionName).getArgumentByName("name").getValueAsString();
+    if (multiplicationStyleString == "gaussseidel" || multiplicationStyleString == "gs") {
+        return storm::solver::MultiplicationStyle::GaussSeidel;
+    } else if (multiplicationStyleString == "regular" || multiplicationStyleString == "r") {
+        return storm::solver::MultiplicationStyle::Regular;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown multiplication style '" << multiplicationStyleString << "'.");
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -3,6 +3,7 @@
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 
+#include "storm/solver/MultiplicationStyle.h"
 #include "storm/solver/SolverSelectionOptions.h"
 
 namespace storm {
@@ -82,6 +83,13 @@ class GameSolverSettings : public ModuleSettings {
      */
     ConvergenceCriterion getConvergenceCriterion() const;
 
+    /*!
+     * Retrieves the multiplication style to use in value iteration.
+     *
+     * @return The multiplication style.
+     */
+    storm::solver::MultiplicationStyle getValueIterationMultiplicationStyle() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -91,6 +99,7 @@ class GameSolverSettings : public ModuleSettings {
     static const std::string maximalIterationsOptionShortName;
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
+    static const std::string valueIterationMultiplicationStyleOptionName;
 };
 
 }  // namespace modules
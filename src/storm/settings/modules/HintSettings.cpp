@@ -13,11 +13,22 @@ namespace modules {
 const std::string HintSettings::moduleName = "hints";
 
 const std::string stateHintOption = "states";
+const std::string memoryHintOption = "memory";
+const std::string estimationStatesOption = "estimationstates";
 
 HintSettings::HintSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, stateHintOption, true, "Estimate of the number of reachable states")
                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "size.").build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, memoryHintOption, true,
+                                                   "Available memory in megabytes. If not given, it is read from the cgroup of the process and /proc/meminfo.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "size.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, estimationStatesOption, true,
+                                                   "Number of states that the automatic engine explores to estimate the memory consumption of the model (0 "
+                                                   "disables the estimation).")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "size.").setDefaultValueUnsignedInteger(100000).build())
+                        .build());
 }
 
 bool HintSettings::isNumberStatesSet() const {
@@ -28,6 +39,18 @@ uint64_t HintSettings::getNumberStates() const {
     return this->getOption(stateHintOption).getArgumentByName("number").getValueAsUnsignedInteger();
 }
 
+bool HintSettings::isAvailableMemorySet() const {
+    return this->getOption(memoryHintOption).getHasOptionBeenSet();
+}
+
+uint64_t HintSettings::getAvailableMemory() const {
+    return this->getOption(memoryHintOption).getArgumentByName("number").getValueAsUnsignedInteger() * 1024 * 1024;
+}
+
+uint64_t HintSettings::getEstimationStateLimit() const {
+    return this->getOption(estimationStatesOption).getArgumentByName("number").getValueAsUnsignedInteger();
+}
+
 bool HintSettings::check() const {
     return true;
 }
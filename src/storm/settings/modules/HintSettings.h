@@ -24,6 +24,21 @@ class HintSettings : public ModuleSettings {
 
     uint64_t getNumberStates() const;
 
+    /*!
+     * Retrieves whether the option that specifies the available memory is set.
+     */
+    bool isAvailableMemorySet() const;
+
+    /*!
+     * Retrieves the available memory in bytes.
+     */
+    uint64_t getAvailableMemory() const;
+
+    /*!
+     * Retrieves the number of states that the automatic engine explores to estimate the size of the model. Zero disables the estimation.
+     */
+    uint64_t getEstimationStateLimit() const;
+
     bool check() const override;
 
     void finalize() override;
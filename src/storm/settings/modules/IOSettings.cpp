@@ -31,6 +31,7 @@ const std::string IOSettings::explicitOptionName = "explicit";
 const std::string IOSettings::explicitOptionShortName = "exp";
 const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
 const std::string IOSettings::explicitDrnOptionShortName = "drn";
+const std::string IOSettings::explicitBinaryOptionName = "explicit-binary";
 const std::string IOSettings::explicitImcaOptionName = "explicit-imca";
 const std::string IOSettings::explicitImcaOptionShortName = "imca";
 const std::string IOSettings::prismInputOptionName = "prism";
@@ -74,7 +75,7 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(0)
                                          .build())
                         .build());
-    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "json"});
+    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "json", "bin"});
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exportBuildOptionName, false, "Exports the built model to a file.")
             .addArgument(storm::settings::ArgumentBuilder::createStringArgument("file", "The output file.").build())
@@ -143,6 +144,12 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
                                          .build())
                         .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, explicitBinaryOptionName, false, "Parses the model given in the binary format (see --exportbuild).")
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("binary filename", "The name of the binary file containing the model.")
+                             .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                             .build())
+            .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explicitImcaOptionName, false, "Parses the model given in the IMCA format.")
                         .setShortName(explicitImcaOptionShortName)
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("imca filename", "The name of the imca file containing the model.")
@@ -219,12 +226,13 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .makeOptional()
                                          .build())
                         .build());
-    std::vector<std::string> steadyStateDistrAlgorithms({"auto", "eqsys", "evt", "classic"});
+    std::vector<std::string> steadyStateDistrAlgorithms({"auto", "eqsys", "evt", "classic", "power"});
     this->addOption(
         storm::settings::OptionBuilder(moduleName, steadyStateDistrOptionName, false,
                                        "Computes the steady state distribution. Result can be exported using --" + exportCheckResultOptionName + ".")
             .addArgument(
-                storm::settings::ArgumentBuilder::createStringArgument("algorithm", "The used algorithm. 'auto' chooses according to accuracy requirements.")
+                storm::settings::ArgumentBuilder::createStringArgument(
+                    "algorithm", "The used algorithm. 'auto' chooses according to accuracy requirements. 'power' runs a (multi-threaded) power iteration.")
                     .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(steadyStateDistrAlgorithms))
                     .setDefaultValueString("auto")
                     .makeOptional()
@@ -371,6 +379,14 @@ std::string IOSettings::getExplicitDRNFilename() const {
     return this->getOption(explicitDrnOptionName).getArgumentByName("drn filename").getValueAsString();
 }
 
+bool IOSettings::isExplicitBinarySet() const {
+    return this->getOption(explicitBinaryOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExplicitBinaryFilename() const {
+    return this->getOption(explicitBinaryOptionName).getArgumentByName("binary filename").getValueAsString();
+}
+
 bool IOSettings::isExplicitIMCASet() const {
     return this->getOption(explicitImcaOptionName).getHasOptionBeenSet();
 }
@@ -472,6 +488,8 @@ storm::SteadyStateDistributionAlgorithm IOSettings::getSteadyStateDistributionAl
         return storm::SteadyStateDistributionAlgorithm::EquationSystem;
     } else if (alg == "classic") {
         return storm::SteadyStateDistributionAlgorithm::Classic;
+    } else if (alg == "power") {
+        return storm::SteadyStateDistributionAlgorithm::PowerIteration;
     } else {
         STORM_LOG_ASSERT(alg == "evt", "Unexpected algorithm type.");
         return storm::SteadyStateDistributionAlgorithm::ExpectedVisitingTimes;
@@ -541,6 +559,7 @@ bool IOSettings::check() const {
     // Ensure that not two explicit input models were given.
     uint64_t numExplicitInputs = isExplicitSet() ? 1 : 0;
     numExplicitInputs += isExplicitDRNSet() ? 1 : 0;
+    numExplicitInputs += isExplicitBinarySet() ? 1 : 0;
     numExplicitInputs += isExplicitIMCASet() ? 1 : 0;
     STORM_LOG_THROW(numExplicitInputs <= 1, storm::exceptions::InvalidSettingsException, "Multiple explicit input models");
 
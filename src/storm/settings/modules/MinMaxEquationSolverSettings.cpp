@@ -19,12 +19,17 @@ const std::string precisionOptionName = "precision";
 const std::string absoluteOptionName = "absolute";
 const std::string valueIterationMultiplicationStyleOptionName = "vimult";
 const std::string forceUniqueSolutionRequirementOptionName = "force-require-unique";
+const std::string mixedPrecisionOptionName = "mixedprecision";
+const std::string asynchronousUpdatesOptionName = "async-updates";
+const std::string automaticMethodOptionName = "auto-method";
+const std::string automaticMethodRaceOptionName = "auto-method-race";
+const std::string noDuplicateEliminationOptionName = "no-duplicate-elimination";
 
 MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> minMaxSolvingTechniques = {
         "vi",     "value-iteration",    "pi",  "policy-iteration",      "lp",  "linear-programming",         "rs",          "ratsearch",
         "ii",     "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "topological", "vi-to-pi",
-        "acyclic"};
+        "acyclic", "pvi",                "prioritized-value-iteration", "multigrid"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, solvingMethodOptionName, false, "Sets which min/max linear equation solving technique is preferred.")
             .setIsAdvanced()
@@ -69,6 +74,40 @@ MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(mo
                                                    "simplify solving but causes some overhead.")
                         .setIsAdvanced()
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionOptionName, false,
+                                                   "If set, value iteration first iterates with the matrix entries stored in single precision and then "
+                                                   "refines the result in double precision.")
+                        .setIsAdvanced()
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, asynchronousUpdatesOptionName, false,
+                                                   "If set, the threads of Gauss-Seidel value iteration update the shared values in place (asynchronously) "
+                                                   "instead of buffering their results until the end of each iteration.")
+                        .setIsAdvanced()
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, automaticMethodOptionName, false,
+                                                   "If set, the solution method is selected based on features of the equation system (such as its size and "
+                                                   "SCC structure) unless a method is set explicitly.")
+                        .setIsAdvanced()
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, automaticMethodRaceOptionName, false,
+                                                   "If set, the most promising solution methods of the automatic method selection are run in parallel for the "
+                                                   "given time and the one that made the most progress is used. Implies --" +
+                                                       automaticMethodOptionName + ".")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "The time budget of the race in milliseconds.")
+                                         .setDefaultValueUnsignedInteger(500)
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, noDuplicateEliminationOptionName, false,
+                                                   "If set, choices of a state that coincide with another choice of the state (including their rewards) "
+                                                   "are not removed before solving.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -93,6 +132,10 @@ storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvi
         return storm::solver::MinMaxMethod::ViToPi;
     } else if (minMaxEquationSolvingTechnique == "acyclic") {
         return storm::solver::MinMaxMethod::Acyclic;
+    } else if (minMaxEquationSolvingTechnique == "prioritized-value-iteration" || minMaxEquationSolvingTechnique == "pvi") {
+        return storm::solver::MinMaxMethod::PrioritizedValueIteration;
+    } else if (minMaxEquationSolvingTechnique == "multigrid") {
+        return storm::solver::MinMaxMethod::Multigrid;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
@@ -147,6 +190,30 @@ bool MinMaxEquationSolverSettings::isForceUniqueSolutionRequirementSet() const {
     return this->getOption(forceUniqueSolutionRequirementOptionName).getHasOptionBeenSet();
 }
 
+bool MinMaxEquationSolverSettings::isMixedPrecisionSet() const {
+    return this->getOption(mixedPrecisionOptionName).getHasOptionBeenSet();
+}
+
+bool MinMaxEquationSolverSettings::isAsynchronousUpdatesSet() const {
+    return this->getOption(asynchronousUpdatesOptionName).getHasOptionBeenSet();
+}
+
+bool MinMaxEquationSolverSettings::isAutomaticMethodSelectionSet() const {
+    return this->getOption(automaticMethodOptionName).getHasOptionBeenSet() || isAutomaticMethodRaceSet();
+}
+
+bool MinMaxEquationSolverSettings::isAutomaticMethodRaceSet() const {
+    return this->getOption(automaticMethodRaceOptionName).getHasOptionBeenSet();
+}
+
+bool MinMaxEquationSolverSettings::isNoDuplicateEliminationSet() const {
+    return this->getOption(noDuplicateEliminationOptionName).getHasOptionBeenSet();
+}
+
+uint64_t MinMaxEquationSolverSettings::getAutomaticMethodRaceTime() const {
+    return this->getOption(automaticMethodRaceOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -95,6 +95,36 @@ class MinMaxEquationSolverSettings : public ModuleSettings {
      */
     bool isForceUniqueSolutionRequirementSet() const;
 
+    /*!
+     * @return if value iteration should first iterate with the matrix entries stored in single precision before refining the result in double precision.
+     */
+    bool isMixedPrecisionSet() const;
+
+    /*!
+     * @return if the threads of Gauss-Seidel value iteration should update the values in place without waiting for the end of each iteration.
+     */
+    bool isAsynchronousUpdatesSet() const;
+
+    /*!
+     * @return if the solution method should be selected based on features of the equation system.
+     */
+    bool isAutomaticMethodSelectionSet() const;
+
+    /*!
+     * @return if the most promising methods of the automatic method selection should be raced against each other.
+     */
+    bool isAutomaticMethodRaceSet() const;
+
+    /*!
+     * @return the time budget (in milliseconds) of a race between solution methods.
+     */
+    uint64_t getAutomaticMethodRaceTime() const;
+
+    /*!
+     * @return if the elimination of duplicate choices before solving is disabled.
+     */
+    bool isNoDuplicateEliminationSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
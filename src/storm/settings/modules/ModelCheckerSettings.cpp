@@ -6,6 +6,7 @@
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace settings {
@@ -14,6 +15,16 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::ltl2daCacheOptionName = "ltl2da-cache";
+const std::string ModelCheckerSettings::ltl2daThreadsOptionName = "ltl2da-threads";
+const std::string ModelCheckerSettings::hintCacheOptionName = "hint-cache";
+const std::string ModelCheckerSettings::hybridBlockSizeOptionName = "hybrid-blocksize";
+const std::string ModelCheckerSettings::epochThreadsOptionName = "epoch-threads";
+const std::string ModelCheckerSettings::epochMemoryOptionName = "epoch-memory";
+const std::string ModelCheckerSettings::releaseMemoryOptionName = "release-memory";
+const std::string ModelCheckerSettings::stepBoundedSteadyOptionName = "stepbound-steady";
+const std::string ModelCheckerSettings::stepBoundedSquaringOptionName = "stepbound-squaring";
+const std::string ModelCheckerSettings::conditionalAlgorithmOptionName = "conditional";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +38,87 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ltl2daCacheOptionName, false,
+                                                   "If set, the deterministic automata for LTL formulas are cached in the given directory and reused "
+                                                   "across invocations.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "An existing directory for the cached automata.")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ltl2daThreadsOptionName, false,
+                                                   "Sets the number of threads that translate the LTL formulas of all properties to deterministic automata "
+                                                   "up front. Only applies to external tools set via --" +
+                                                       ltl2daToolOptionName + ".")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, hintCacheOptionName, false,
+                                                   "If set, the results and schedulers of reachability properties of DTMCs and MDPs are cached in the given "
+                                                   "directory. They warm-start later computations of the same property on a model with the same state space.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "An existing directory for the cached results.")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, hybridBlockSizeOptionName, false,
+                                                   "If set, the hybrid engine converts the matrix to explicit form in blocks of the given number of states "
+                                                   "whenever it only multiplies with the matrix. Only one block is held in explicit form at a time.")
+                        .setIsAdvanced()
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of states per block (0 means all states).")
+                                .setDefaultValueUnsignedInteger(0)
+                                .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, epochThreadsOptionName, false,
+                                                   "Sets the number of threads that analyze the epochs of reward-bounded properties. Epochs whose "
+                                                   "successor epochs are all analyzed are processed concurrently.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, epochMemoryOptionName, false,
+                                                   "Limits the memory for the stored epoch solutions of reward-bounded properties. Solutions exceeding the "
+                                                   "limit are spilled to a temporary file.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("megabytes", "The memory limit (0 means no limit).")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, releaseMemoryOptionName, false,
+                                                   "If set, intermediate data such as backward transitions is not cached in the model but released as soon as "
+                                                   "the computation that needs it finishes. This lowers the peak memory at the cost of recomputations.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, stepBoundedSteadyOptionName, false,
+                                                   "Sets the precision with which step-bounded computations stop early once no value changes by more than it "
+                                                   "in one step. A positive precision gives approximate results for models that converge only slowly.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("epsilon", "The precision (0 means only exact fixpoints).")
+                                         .setDefaultValueDouble(0.0)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, stepBoundedSquaringOptionName, false,
+                                                   "If set, step-bounded properties of DTMCs with at most the given number of relevant states are computed by "
+                                                   "repeatedly squaring the (dense) transition matrix whenever this is cheaper than multiplying step by step.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The maximal number of states (0 means never).")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
+    std::vector<std::string> conditionalAlgorithms = {"transformation", "joint", "bisection"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, conditionalAlgorithmOptionName, false,
+                                                   "Sets the algorithm for conditional probabilities. 'transformation' solves a transformed model, 'joint' "
+                                                   "iterates the numerator and denominator of DTMCs in one pass and 'bisection' searches the value for MDPs "
+                                                   "by solving a sequence of threshold problems.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the algorithm.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(conditionalAlgorithms))
+                                         .setDefaultValueString("transformation")
+                                         .build())
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -41,6 +133,70 @@ std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool ModelCheckerSettings::isLtl2daCacheDirectorySet() const {
+    return this->getOption(ltl2daCacheOptionName).getHasOptionBeenSet();
+}
+
+std::string ModelCheckerSettings::getLtl2daCacheDirectory() const {
+    return this->getOption(ltl2daCacheOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+bool ModelCheckerSettings::isHintCacheDirectorySet() const {
+    return this->getOption(hintCacheOptionName).getHasOptionBeenSet();
+}
+
+std::string ModelCheckerSettings::getHintCacheDirectory() const {
+    return this->getOption(hintCacheOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+uint64_t ModelCheckerSettings::getNumberOfLtl2daThreads() const {
+    uint64_t numberFromSettings = this->getOption(ltl2daThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    if (numberFromSettings != 0u) {
+        return numberFromSettings;
+    }
+    // Automatic detection
+    return std::max(1u, storm::utility::getNumberOfThreads());
+}
+
+uint64_t ModelCheckerSettings::getHybridBlockSize() const {
+    return this->getOption(hybridBlockSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t ModelCheckerSettings::getNumberOfEpochThreads() const {
+    uint64_t numberFromSettings = this->getOption(epochThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    if (numberFromSettings != 0u) {
+        return numberFromSettings;
+    }
+    // Automatic detection
+    return std::max(1u, storm::utility::getNumberOfThreads());
+}
+
+uint64_t ModelCheckerSettings::getEpochSolutionMemoryLimit() const {
+    return this->getOption(epochMemoryOptionName).getArgumentByName("megabytes").getValueAsUnsignedInteger();
+}
+
+bool ModelCheckerSettings::isReleaseIntermediateDataSet() const {
+    return this->getOption(releaseMemoryOptionName).getHasOptionBeenSet();
+}
+
+double ModelCheckerSettings::getStepBoundedSteadyPrecision() const {
+    return this->getOption(stepBoundedSteadyOptionName).getArgumentByName("epsilon").getValueAsDouble();
+}
+
+uint64_t ModelCheckerSettings::getStepBoundedSquaringStateLimit() const {
+    return this->getOption(stepBoundedSquaringOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+storm::modelchecker::helper::ConditionalAlgorithm ModelCheckerSettings::getConditionalAlgorithm() const {
+    std::string algorithm = this->getOption(conditionalAlgorithmOptionName).getArgumentByName("name").getValueAsString();
+    if (algorithm == "joint") {
+        return storm::modelchecker::helper::ConditionalAlgorithm::Joint;
+    } else if (algorithm == "bisection") {
+        return storm::modelchecker::helper::ConditionalAlgorithm::Bisection;
+    }
+    return storm::modelchecker::helper::ConditionalAlgorithm::Transformation;
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
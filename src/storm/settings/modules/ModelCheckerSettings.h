@@ -4,6 +4,7 @@
 #include "storm/settings/modules/ModuleSettings.h"
 
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/modelchecker/prctl/helper/ConditionalAlgorithm.h"
 
 namespace storm {
 namespace settings {
@@ -35,6 +36,69 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves whether a directory for caching the deterministic automata of LTL formulas has been set.
+     */
+    bool isLtl2daCacheDirectorySet() const;
+
+    /*!
+     * Retrieves the directory in which the deterministic automata of LTL formulas are cached.
+     */
+    std::string getLtl2daCacheDirectory() const;
+
+    /*!
+     * Retrieves whether a directory for caching the results and schedulers of reachability properties has been set.
+     */
+    bool isHintCacheDirectorySet() const;
+
+    /*!
+     * Retrieves the directory in which the results and schedulers of reachability properties are cached.
+     */
+    std::string getHintCacheDirectory() const;
+
+    /*!
+     * Retrieves the number of threads that translate LTL formulas to deterministic automata up front.
+     */
+    uint64_t getNumberOfLtl2daThreads() const;
+
+    /*!
+     * Retrieves the maximal number of states whose rows the hybrid engine converts to explicit form at once when it only needs to multiply with the
+     * matrix. Zero means that the matrix is converted as a whole.
+     */
+    uint64_t getHybridBlockSize() const;
+
+    /*!
+     * Retrieves the number of threads that analyze the epochs of reward-bounded properties concurrently.
+     */
+    uint64_t getNumberOfEpochThreads() const;
+
+    /*!
+     * Retrieves the memory limit (in megabytes) for the stored epoch solutions of reward-bounded properties. Zero means that there is no limit.
+     */
+    uint64_t getEpochSolutionMemoryLimit() const;
+
+    /*!
+     * Retrieves whether intermediate data of the computations (such as backward transitions) shall be released as soon as possible.
+     */
+    bool isReleaseIntermediateDataSet() const;
+
+    /*!
+     * Retrieves the precision with which the vector of step-bounded computations counts as steady. Zero means that the computation only terminates
+     * early once the vector does not change at all.
+     */
+    double getStepBoundedSteadyPrecision() const;
+
+    /*!
+     * Retrieves the maximal number of states for which step-bounded properties of DTMCs are computed by repeatedly squaring the transition matrix.
+     * Zero means that the matrix is never squared.
+     */
+    uint64_t getStepBoundedSquaringStateLimit() const;
+
+    /*!
+     * Retrieves the algorithm with which conditional probabilities of DTMCs and MDPs are computed.
+     */
+    storm::modelchecker::helper::ConditionalAlgorithm getConditionalAlgorithm() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +106,16 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string ltl2daCacheOptionName;
+    static const std::string ltl2daThreadsOptionName;
+    static const std::string hintCacheOptionName;
+    static const std::string hybridBlockSizeOptionName;
+    static const std::string epochThreadsOptionName;
+    static const std::string epochMemoryOptionName;
+    static const std::string releaseMemoryOptionName;
+    static const std::string stepBoundedSteadyOptionName;
+    static const std::string stepBoundedSquaringOptionName;
+    static const std::string conditionalAlgorithmOptionName;
 };
 
 }  // namespace modules
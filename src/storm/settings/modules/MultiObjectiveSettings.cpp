@@ -5,6 +5,7 @@
 #include "storm/settings/ArgumentValidators.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace settings {
@@ -19,6 +20,7 @@ const std::string MultiObjectiveSettings::schedulerRestrictionOptionName = "pure
 const std::string MultiObjectiveSettings::printResultsOptionName = "printres";
 const std::string MultiObjectiveSettings::encodingOptionName = "encoding";
 const std::string MultiObjectiveSettings::lexicographicOptionName = "lex";
+const std::string MultiObjectiveSettings::threadsOptionName = "threads";
 
 MultiObjectiveSettings::MultiObjectiveSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> methods = {"pcaa", "constraintbased"};
@@ -101,6 +103,13 @@ MultiObjectiveSettings::MultiObjectiveSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, lexicographicOptionName, false,
                                                    "If set, lexicographic model checking instead of normal multi objective is performed.")
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true,
+                                                   "Sets the number of threads that check weight vectors of Pareto queries concurrently.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 storm::modelchecker::multiobjective::MultiObjectiveMethod MultiObjectiveSettings::getMultiObjectiveMethod() const {
@@ -219,6 +228,15 @@ bool MultiObjectiveSettings::isLexicographicModelCheckingSet() const {
     return this->getOption(lexicographicOptionName).getHasOptionBeenSet();
 }
 
+uint64_t MultiObjectiveSettings::getNumberOfThreads() const {
+    uint64_t numberFromSettings = this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    if (numberFromSettings != 0u) {
+        return numberFromSettings;
+    }
+    // Automatic detection
+    return std::max(1u, storm::utility::getNumberOfThreads());
+}
+
 bool MultiObjectiveSettings::check() const {
     std::shared_ptr<storm::settings::ArgumentValidator<std::string>> validator = ArgumentValidatorFactory::createWritableFileValidator();
 
@@ -126,6 +126,12 @@ class MultiObjectiveSettings : public ModuleSettings {
      */
     bool isRedundantBsccConstraintsSet() const;
 
+    /*!
+     * Retrieves the number of threads that check weight vectors concurrently. If the number was set to zero, the number of available hardware threads is
+     * returned.
+     */
+    uint64_t getNumberOfThreads() const;
+
     /*!
      * Checks whether the settings are consistent. If they are inconsistent, an exception is thrown.
      *
@@ -144,6 +150,7 @@ class MultiObjectiveSettings : public ModuleSettings {
     const static std::string printResultsOptionName;
     const static std::string encodingOptionName;
     const static std::string lexicographicOptionName;
+    const static std::string threadsOptionName;
 };
 
 }  // namespace modules
@@ -13,9 +13,11 @@ namespace modules {
 
 const std::string MultiplierSettings::moduleName = "multiplier";
 const std::string MultiplierSettings::multiplierTypeOptionName = "type";
+const std::string MultiplierSettings::splitStorageOptionName = "split-storage";
+const std::string MultiplierSettings::compressedValuesOptionName = "compressed-values";
 
 MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> multiplierTypes = {"native", "gmmxx"};
+    std::vector<std::string> multiplierTypes = {"native", "gmmxx", "simd", "cuda"};
     this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred.")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplier.")
@@ -23,6 +25,15 @@ MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("gmmxx")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, splitStorageOptionName, false,
+                                                   "If set, the native multiplier stores column indices (32 bit if possible) and values in separate arrays.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, compressedValuesOptionName, false,
+                                                   "If set, value iteration stores the matrix values as one byte indices into a dictionary of the "
+                                                   "distinct values (if there are at most 256 of them).")
+                        .setIsAdvanced()
+                        .build());
 }
 
 storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
@@ -31,6 +42,10 @@ storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
         return storm::solver::MultiplierType::Native;
     } else if (type == "gmmxx") {
         return storm::solver::MultiplierType::Gmmxx;
+    } else if (type == "simd") {
+        return storm::solver::MultiplierType::Simd;
+    } else if (type == "cuda") {
+        return storm::solver::MultiplierType::Cuda;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown multiplier type '" << type << "'.");
@@ -40,6 +55,14 @@ bool MultiplierSettings::isMultiplierTypeSetFromDefaultValue() const {
     return !this->getOption(multiplierTypeOptionName).getArgumentByName("name").getHasBeenSet() ||
            this->getOption(multiplierTypeOptionName).getArgumentByName("name").wasSetFromDefaultValue();
 }
+
+bool MultiplierSettings::isSplitStorageSet() const {
+    return this->getOption(splitStorageOptionName).getHasOptionBeenSet();
+}
+
+bool MultiplierSettings::isCompressedValuesSet() const {
+    return this->getOption(compressedValuesOptionName).getHasOptionBeenSet();
+}
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
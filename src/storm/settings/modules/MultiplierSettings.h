@@ -21,11 +21,23 @@ class MultiplierSettings : public ModuleSettings {
 
     bool isMultiplierTypeSetFromDefaultValue() const;
 
+    /*!
+     * Retrieves whether the native multiplier should operate on a copy of the matrix that stores columns and values in separate arrays.
+     */
+    bool isSplitStorageSet() const;
+
+    /*!
+     * Retrieves whether value iteration should store the matrix values as indices into a dictionary of the distinct values.
+     */
+    bool isCompressedValuesSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
    private:
     static const std::string multiplierTypeOptionName;
+    static const std::string splitStorageOptionName;
+    static const std::string compressedValuesOptionName;
 };
 
 }  // namespace modules
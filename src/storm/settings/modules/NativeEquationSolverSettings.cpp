@@ -24,11 +24,13 @@ const std::string NativeEquationSolverSettings::precisionOptionName = "precision
 const std::string NativeEquationSolverSettings::absoluteOptionName = "absolute";
 const std::string NativeEquationSolverSettings::powerMethodMultiplicationStyleOptionName = "powmult";
 const std::string NativeEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+const std::string NativeEquationSolverSettings::mixedPrecisionOptionName = "mixedprecision";
+const std::string NativeEquationSolverSettings::preconditionOptionName = "precond";
+const std::string NativeEquationSolverSettings::restartOptionName = "restart";
 
 NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> methods = {"jacobi", "gaussseidel",           "sor", "walkerchae",
-                                        "power",  "sound-value-iteration", "svi", "optimistic-value-iteration",
-                                        "ovi",    "interval-iteration",    "ii",  "ratsearch"};
+    std::vector<std::string> methods = {"jacobi", "gaussseidel", "sor", "walkerchae", "power", "sound-value-iteration", "svi", "optimistic-value-iteration",
+                                        "ovi", "interval-iteration", "ii", "ratsearch", "bicgstab", "gmres", "multigrid"};
     this->addOption(storm::settings::OptionBuilder(moduleName, techniqueOptionName, true,
                                                    "The method to be used for solving linear equation systems with the native engine.")
                         .setIsAdvanced()
@@ -38,6 +40,24 @@ NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(mo
                                          .build())
                         .build());
 
+    std::vector<std::string> preconditioners = {"ilu", "diagonal", "none"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, preconditionOptionName, false,
+                                                   "The preconditioning technique used by the Krylov methods (bicgstab and gmres).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the preconditioning method.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(preconditioners))
+                                         .setDefaultValueString("ilu")
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, restartOptionName, false, "The number of iterations after which gmres is restarted.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of iterations.")
+                                         .setDefaultValueUnsignedInteger(50)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+
     this->addOption(storm::settings::OptionBuilder(moduleName, maximalIterationsOptionName, false,
                                                    "The maximal number of iterations to perform before iterative solving is aborted.")
                         .setIsAdvanced()
@@ -80,6 +100,12 @@ NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(mo
                                                    "If set, interval iteration performs an update on both, lower and upper bound in each iteration")
                         .setIsAdvanced()
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionOptionName, false,
+                                                   "If set, the power method first iterates with the matrix entries stored in single precision and then "
+                                                   "refines the result in double precision.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool NativeEquationSolverSettings::isLinearEquationSystemTechniqueSet() const {
@@ -111,11 +137,34 @@ storm::solver::NativeLinearEquationSolverMethod NativeEquationSolverSettings::ge
         return storm::solver::NativeLinearEquationSolverMethod::IntervalIteration;
     } else if (linearEquationSystemTechniqueAsString == "ratsearch") {
         return storm::solver::NativeLinearEquationSolverMethod::RationalSearch;
+    } else if (linearEquationSystemTechniqueAsString == "bicgstab") {
+        return storm::solver::NativeLinearEquationSolverMethod::Bicgstab;
+    } else if (linearEquationSystemTechniqueAsString == "gmres") {
+        return storm::solver::NativeLinearEquationSolverMethod::Gmres;
+    } else if (linearEquationSystemTechniqueAsString == "multigrid") {
+        return storm::solver::NativeLinearEquationSolverMethod::Multigrid;
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
                     "Unknown solution technique '" << linearEquationSystemTechniqueAsString << "' selected.");
 }
 
+storm::solver::NativeLinearEquationSolverPreconditioner NativeEquationSolverSettings::getPreconditioningMethod() const {
+    std::string preconditioningMethodAsString = this->getOption(preconditionOptionName).getArgumentByName("name").getValueAsString();
+    if (preconditioningMethodAsString == "ilu") {
+        return storm::solver::NativeLinearEquationSolverPreconditioner::Ilu;
+    } else if (preconditioningMethodAsString == "diagonal") {
+        return storm::solver::NativeLinearEquationSolverPreconditioner::Diagonal;
+    } else if (preconditioningMethodAsString == "none") {
+        return storm::solver::NativeLinearEquationSolverPreconditioner::None;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
+                    "Unknown preconditioning technique '" << preconditioningMethodAsString << "' selected.");
+}
+
+uint64_t NativeEquationSolverSettings::getRestartIterationCount() const {
+    return this->getOption(restartOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool NativeEquationSolverSettings::isMaximalIterationCountSet() const {
     return this->getOption(maximalIterationsOptionName).getHasOptionBeenSet();
 }
@@ -159,6 +208,10 @@ bool NativeEquationSolverSettings::isForceIntervalIterationSymmetricUpdatesSet()
     return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
 }
 
+bool NativeEquationSolverSettings::isMixedPrecisionSet() const {
+    return this->getOption(mixedPrecisionOptionName).getHasOptionBeenSet();
+}
+
 bool NativeEquationSolverSettings::check() const {
     return true;
 }
@@ -98,6 +98,22 @@ class NativeEquationSolverSettings : public ModuleSettings {
      */
     bool isForceIntervalIterationSymmetricUpdatesSet() const;
 
+    /*!
+     * Retrieves whether the power method should first iterate with the matrix entries stored in single precision before refining the result in double
+     * precision.
+     */
+    bool isMixedPrecisionSet() const;
+
+    /*!
+     * Retrieves the preconditioner that is used by the Krylov methods.
+     */
+    storm::solver::NativeLinearEquationSolverPreconditioner getPreconditioningMethod() const;
+
+    /*!
+     * Retrieves the number of iterations after which GMRES is restarted.
+     */
+    uint64_t getRestartIterationCount() const;
+
     /*!
      * Retrieves the multiplication style to use in the power method.
      *
@@ -126,6 +142,9 @@ class NativeEquationSolverSettings : public ModuleSettings {
     static const std::string intervalIterationSymmetricUpdatesOptionName;
     static const std::string powerMethodMultiplicationStyleOptionName;
     static const std::string forceBoundsOptionName;
+    static const std::string mixedPrecisionOptionName;
+    static const std::string preconditionOptionName;
+    static const std::string restartOptionName;
 };
 
 }  // namespace modules
@@ -10,6 +10,7 @@ namespace modules {
 
 const std::string OviSolverSettings::moduleName = "ovi";
 const std::string OviSolverSettings::upperBoundGuessingFactorOptionName = "upper-bound-factor";
+const std::string OviSolverSettings::nonAdaptiveOptionName = "non-adaptive";
 
 OviSolverSettings::OviSolverSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, upperBoundGuessingFactorOptionName, false, "Sets how optimistic the upper bound is guessed.")
@@ -19,6 +20,11 @@ OviSolverSettings::OviSolverSettings() : ModuleSettings(moduleName) {
                                          .addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterValidator(0.0))
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, nonAdaptiveOptionName, false,
+                                                   "If set, the precision and the iteration budget of verification phases are not adapted to the observed "
+                                                   "convergence rate.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool OviSolverSettings::hasUpperBoundGuessingFactorBeenSet() const {
@@ -29,6 +35,10 @@ double OviSolverSettings::getUpperBoundGuessingFactor() const {
     return this->getOption(upperBoundGuessingFactorOptionName).getArgumentByName("factor").getValueAsDouble();
 }
 
+bool OviSolverSettings::isAdaptiveSet() const {
+    return !this->getOption(nonAdaptiveOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -24,11 +24,17 @@ class OviSolverSettings : public ModuleSettings {
      */
     double getUpperBoundGuessingFactor() const;
 
+    /*!
+     * @return true if the precision and the verification budget are adapted to the observed convergence rate
+     */
+    bool isAdaptiveSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
    private:
     static const std::string upperBoundGuessingFactorOptionName;
+    static const std::string nonAdaptiveOptionName;
 };
 
 }  // namespace modules
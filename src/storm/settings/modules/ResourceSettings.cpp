@@ -15,6 +15,7 @@ const std::string ResourceSettings::timeoutOptionName = "timeout";
 const std::string ResourceSettings::timeoutOptionShortName = "t";
 const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
 const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
+const std::string ResourceSettings::profileTraceOptionName = "profile-trace";
 const std::string ResourceSettings::signalWaitingTimeOptionName = "signal-timeout";
 
 ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
@@ -28,6 +29,13 @@ ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, printTimeAndMemoryOptionName, false, "Prints CPU time and memory consumption at the end.")
                         .setShortName(printTimeAndMemoryOptionShortName)
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, profileTraceOptionName, false,
+                                                   "Records the phases of the computation (parsing, building, solving, ...) and exports them in the Chrome trace "
+                                                   "format. With --" +
+                                                       printTimeAndMemoryOptionName + ", the phases are also printed at the end.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The file to which the trace is written.").build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, signalWaitingTimeOptionName, false,
                                                    "Specifies how much time can pass until termination when receiving a termination signal.")
                         .setIsAdvanced()
@@ -49,6 +57,14 @@ bool ResourceSettings::isPrintTimeAndMemorySet() const {
     return this->getOption(printTimeAndMemoryOptionName).getHasOptionBeenSet();
 }
 
+bool ResourceSettings::isProfileTraceSet() const {
+    return this->getOption(profileTraceOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getProfileTraceFilename() const {
+    return this->getOption(profileTraceOptionName).getArgumentByName("filename").getValueAsString();
+}
+
 uint_fast64_t ResourceSettings::getSignalWaitingTimeInSeconds() const {
     return this->getOption(signalWaitingTimeOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
 }
@@ -24,6 +24,20 @@ class ResourceSettings : public ModuleSettings {
      */
     bool isPrintTimeAndMemorySet() const;
 
+    /*!
+     * Retrieves whether the phases of the computation (parsing, building, solving, ...) shall be exported as a profile trace.
+     *
+     * @return True iff the option was set.
+     */
+    bool isProfileTraceSet() const;
+
+    /*!
+     * Retrieves the file to which the profile trace shall be written.
+     *
+     * @return The name of the file.
+     */
+    std::string getProfileTraceFilename() const;
+
     /*!
      * Retrieves whether the timeout option was set.
      *
@@ -56,6 +70,7 @@ class ResourceSettings : public ModuleSettings {
     static const std::string timeoutOptionShortName;
     static const std::string printTimeAndMemoryOptionName;
     static const std::string printTimeAndMemoryOptionShortName;
+    static const std::string profileTraceOptionName;
     static const std::string signalWaitingTimeOptionName;
 };
 }  // namespace modules
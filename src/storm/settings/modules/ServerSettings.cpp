@@ -0,0 +1,66 @@
+#include "storm/settings/modules/ServerSettings.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string ServerSettings::moduleName = "server";
+const std::string ServerSettings::serverOptionName = "server";
+const std::string ServerSettings::workerThreadsOptionName = "workers";
+const std::string ServerSettings::modelsOptionName = "models";
+
+ServerSettings::ServerSettings() : ModuleSettings(moduleName) {
+    this->addOption(storm::settings::OptionBuilder(moduleName, serverOptionName, false,
+                                                   "Runs Storm as server that answers model checking requests (one JSON object per line) on a local port.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("port", "The port.")
+                                         .setDefaultValueUnsignedInteger(8081)
+                                         .makeOptional()
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorIncluding(1, 65535))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, workerThreadsOptionName, false, "Sets the number of threads that process requests concurrently.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, modelsOptionName, false,
+                                                   "Sets how many built models are kept in memory. Loading more models discards the least recently used one.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of models.")
+                                         .setDefaultValueUnsignedInteger(8)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+}
+
+bool ServerSettings::isServerSet() const {
+    return this->getOption(serverOptionName).getHasOptionBeenSet();
+}
+
+uint_fast64_t ServerSettings::getPort() const {
+    return this->getOption(serverOptionName).getArgumentByName("port").getValueAsUnsignedInteger();
+}
+
+uint_fast64_t ServerSettings::getNumberOfWorkerThreads() const {
+    uint_fast64_t numberOfThreads = this->getOption(workerThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    if (numberOfThreads == 0) {
+        numberOfThreads = std::max<uint_fast64_t>(1, std::thread::hardware_concurrency());
+    }
+    return numberOfThreads;
+}
+
+uint_fast64_t ServerSettings::getMaximalNumberOfModels() const {
+    return this->getOption(modelsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
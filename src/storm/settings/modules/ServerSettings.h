@@ -0,0 +1,48 @@
+#pragma once
+
+#include "storm-config.h"
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings for running Storm as a long-running model checking server.
+ */
+class ServerSettings : public ModuleSettings {
+   public:
+    ServerSettings();
+
+    /*!
+     * @return true if Storm is to be run as server
+     */
+    bool isServerSet() const;
+
+    /*!
+     * @return the port on which the server listens for connections
+     */
+    uint_fast64_t getPort() const;
+
+    /*!
+     * @return the number of threads that process requests concurrently
+     */
+    uint_fast64_t getNumberOfWorkerThreads() const;
+
+    /*!
+     * @return the maximal number of built models that are kept in memory
+     */
+    uint_fast64_t getMaximalNumberOfModels() const;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+   private:
+    static const std::string serverOptionName;
+    static const std::string workerThreadsOptionName;
+    static const std::string modelsOptionName;
+};
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -0,0 +1,97 @@
+#include "storm/settings/modules/SimulationSettings.h"
+
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/utility/Engine.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string SimulationSettings::moduleName = "simulation";
+const std::string SimulationSettings::precisionOptionName = "precision";
+const std::string SimulationSettings::errorProbabilityOptionName = "errorprob";
+const std::string SimulationSettings::indifferenceOptionName = "indifference";
+const std::string SimulationSettings::batchSizeOptionName = "batch";
+const std::string SimulationSettings::seedOptionName = "seed";
+
+SimulationSettings::SimulationSettings() : ModuleSettings(moduleName) {
+    this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, true, "The maximal absolute error of estimated probabilities.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, errorProbabilityOptionName, true,
+                                                   "The probability with which an estimated probability may exceed the precision or the decision whether a "
+                                                   "probability bound holds may be wrong.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The error probability.")
+                                         .setDefaultValueDouble(0.05)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, indifferenceOptionName, true,
+                                                   "The half-width of the region around the bound of a property in which the sequential test may decide "
+                                                   "either way.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The half-width of the indifference region.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, batchSizeOptionName, true,
+                                                   "The number of paths that are sampled (distributed over all threads) before the stopping criterion is "
+                                                   "checked.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of paths per batch.")
+                                         .setDefaultValueUnsignedInteger(1000)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, true, "If set, the paths are sampled with the given seed.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed.").build())
+                        .build());
+}
+
+double SimulationSettings::getPrecision() const {
+    return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double SimulationSettings::getErrorProbability() const {
+    return this->getOption(errorProbabilityOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double SimulationSettings::getIndifference() const {
+    return this->getOption(indifferenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+uint64_t SimulationSettings::getBatchSize() const {
+    return this->getOption(batchSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+std::optional<uint64_t> SimulationSettings::getSeed() const {
+    if (this->getOption(seedOptionName).getHasOptionBeenSet()) {
+        return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+    }
+    return std::nullopt;
+}
+
+bool SimulationSettings::check() const {
+    bool optionsSet = this->getOption(precisionOptionName).getHasOptionBeenSet() || this->getOption(errorProbabilityOptionName).getHasOptionBeenSet() ||
+                      this->getOption(indifferenceOptionName).getHasOptionBeenSet() || this->getOption(batchSizeOptionName).getHasOptionBeenSet() ||
+                      this->getOption(seedOptionName).getHasOptionBeenSet();
+    STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Simulation || !optionsSet,
+                        "Simulation engine is not selected, so setting options for it has no effect.");
+    return true;
+}
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <optional>
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings of the simulation (i.e., statistical model checking) engine.
+ */
+class SimulationSettings : public ModuleSettings {
+   public:
+    /*!
+     * Creates a new set of simulation settings.
+     */
+    SimulationSettings();
+
+    /*!
+     * Retrieves the maximal absolute error of the estimated probabilities.
+     */
+    double getPrecision() const;
+
+    /*!
+     * Retrieves the probability with which the estimated probability may violate the precision or a decision about a probability bound may be wrong.
+     */
+    double getErrorProbability() const;
+
+    /*!
+     * Retrieves the half-width of the region around the probability bound of a property in which the sequential probability ratio test may decide
+     * either way.
+     */
+    double getIndifference() const;
+
+    /*!
+     * Retrieves the number of paths that are sampled before the stopping criterion is checked again.
+     */
+    uint64_t getBatchSize() const;
+
+    /*!
+     * Retrieves the seed for the random number generators (if one was given).
+     */
+    std::optional<uint64_t> getSeed() const;
+
+    virtual bool check() const override;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+   private:
+    // Define the string names of the options as constants.
+    static const std::string precisionOptionName;
+    static const std::string errorProbabilityOptionName;
+    static const std::string indifferenceOptionName;
+    static const std::string batchSizeOptionName;
+    static const std::string seedOptionName;
+};
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
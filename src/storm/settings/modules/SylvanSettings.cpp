@@ -6,6 +6,7 @@
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
+#include "storm/utility/TaskRuntime.h"
 #include "storm/utility/threads.h"
 
 namespace storm {
@@ -15,6 +16,7 @@ namespace modules {
 const std::string SylvanSettings::moduleName = "sylvan";
 const std::string SylvanSettings::maximalMemoryOptionName = "maxmem";
 const std::string SylvanSettings::threadCountOptionName = "threads";
+const std::string SylvanSettings::tableRatioOptionName = "tableratio";
 
 SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Sylvan in MB.")
@@ -29,12 +31,25 @@ SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
                                          "value", "The number of threads available to Sylvan (0 means 'auto-detect').")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, tableRatioOptionName, true,
+                                                   "Sets how the memory of Sylvan is split between the node table and the operation cache.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createIntegerArgument(
+                                         "value", "A value of k > 0 (k < 0) makes the node table 2^k times larger (smaller) than the cache.")
+                                         .setDefaultValueInteger(0)
+                                         .addValidatorInteger(ArgumentValidatorFactory::createIntegerRangeValidatorExcluding(-16, 16))
+                                         .build())
+                        .build());
 }
 
 uint_fast64_t SylvanSettings::getMaximalMemory() const {
     return this->getOption(maximalMemoryOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
 }
 
+int_fast64_t SylvanSettings::getTableRatio() const {
+    return this->getOption(tableRatioOptionName).getArgumentByName("value").getValueAsInteger();
+}
+
 bool SylvanSettings::isNumberOfThreadsSet() const {
     return this->getOption(threadCountOptionName).getArgumentByName("value").getHasBeenSet();
 }
@@ -47,7 +62,7 @@ uint_fast64_t SylvanSettings::getNumberOfThreads() const {
         }
     }
     // Automatic detection
-    return std::max(1u, storm::utility::getNumberOfThreads());
+    return storm::utility::parallel::TaskRuntime::runtime().getNumberOfThreads();
 }
 
 bool SylvanSettings::check() const {
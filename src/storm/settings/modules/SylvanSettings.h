@@ -37,6 +37,13 @@ class SylvanSettings : public ModuleSettings {
      */
     bool isNumberOfThreadsSet() const;
 
+    /*!
+     * Retrieves the binary logarithm of the ratio between the sizes of the node table and the operation cache.
+     *
+     * @return The table ratio.
+     */
+    int_fast64_t getTableRatio() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -46,6 +53,7 @@ class SylvanSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string maximalMemoryOptionName;
     static const std::string threadCountOptionName;
+    static const std::string tableRatioOptionName;
 };
 
 }  // namespace modules
@@ -13,6 +13,7 @@ namespace modules {
 const std::string TimeBoundedSolverSettings::moduleName = "timebounded";
 
 const std::string TimeBoundedSolverSettings::maMethodOptionName = "mamethod";
+const std::string TimeBoundedSolverSettings::ctmcMethodOptionName = "ctmcmethod";
 const std::string TimeBoundedSolverSettings::precisionOptionName = "precision";
 const std::string TimeBoundedSolverSettings::absoluteOptionName = "absolute";
 const std::string TimeBoundedSolverSettings::unifPlusKappaOptionName = "kappa";
@@ -27,6 +28,17 @@ TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleNa
                                          .build())
                         .build());
 
+    std::vector<std::string> ctmcMethods = {"auto", "uniformization", "krylov"};
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, ctmcMethodOptionName, false,
+                                       "The method to use to compute transient probabilities on CTMCs. 'auto' uses the Krylov method for stiff problems.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.")
+                             .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ctmcMethods))
+                             .setDefaultValueString("auto")
+                             .build())
+            .build());
+
     this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The precision used for detecting convergence of iterative methods.")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.")
@@ -75,6 +87,16 @@ bool TimeBoundedSolverSettings::isMaMethodSetFromDefaultValue() const {
            this->getOption(maMethodOptionName).getArgumentByName("name").wasSetFromDefaultValue();
 }
 
+storm::solver::CtmcTransientMethod TimeBoundedSolverSettings::getCtmcMethod() const {
+    std::string techniqueAsString = this->getOption(ctmcMethodOptionName).getArgumentByName("name").getValueAsString();
+    if (techniqueAsString == "uniformization") {
+        return storm::solver::CtmcTransientMethod::Uniformization;
+    } else if (techniqueAsString == "krylov") {
+        return storm::solver::CtmcTransientMethod::Krylov;
+    }
+    return storm::solver::CtmcTransientMethod::Automatic;
+}
+
 double TimeBoundedSolverSettings::getUnifPlusKappa() const {
     return this->getOption(unifPlusKappaOptionName).getArgumentByName("kappa").getValueAsDouble();
 }
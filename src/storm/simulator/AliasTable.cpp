@@ -0,0 +1,62 @@
+#include "storm/simulator/AliasTable.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace simulator {
+
+AliasTable::AliasTable(std::vector<double> const& weights) : probabilities(weights.size()), aliases(weights.size()) {
+    double const totalWeight = std::accumulate(weights.begin(), weights.end(), 0.0);
+    STORM_LOG_THROW(!weights.empty() && totalWeight > 0.0, storm::exceptions::InvalidArgumentException,
+                    "Cannot create an alias table for a distribution without positive weights.");
+
+    // Scale the weights such that the average bucket is filled exactly. Then, repeatedly fill up an underfull bucket with the probability of an
+    // overfull outcome, which becomes its alias.
+    uint64_t const numberOfOutcomes = weights.size();
+    std::vector<uint64_t> underfull, overfull;
+    for (uint64_t outcome = 0; outcome < numberOfOutcomes; ++outcome) {
+        probabilities[outcome] = weights[outcome] * static_cast<double>(numberOfOutcomes) / totalWeight;
+        aliases[outcome] = outcome;
+        (probabilities[outcome] < 1.0 ? underfull : overfull).push_back(outcome);
+    }
+    while (!underfull.empty() && !overfull.empty()) {
+        uint64_t small = underfull.back();
+        underfull.pop_back();
+        uint64_t large = overfull.back();
+        aliases[small] = large;
+        probabilities[large] -= 1.0 - probabilities[small];
+        if (probabilities[large] < 1.0) {
+            overfull.pop_back();
+            underfull.push_back(large);
+        }
+    }
+    // Due to rounding, the remaining buckets may be slightly off. They are (almost) full, so they keep their own outcome.
+    for (auto outcome : underfull) {
+        probabilities[outcome] = 1.0;
+    }
+    for (auto outcome : overfull) {
+        probabilities[outcome] = 1.0;
+    }
+}
+
+uint64_t AliasTable::sample(double uniform) const {
+    // The integral part of the scaled number selects the bucket and the fractional part decides between its outcome and its alias.
+    double const scaled = uniform * static_cast<double>(probabilities.size());
+    uint64_t const bucket = std::min<uint64_t>(static_cast<uint64_t>(scaled), probabilities.size() - 1);
+    return scaled - static_cast<double>(bucket) < probabilities[bucket] ? bucket : aliases[bucket];
+}
+
+uint64_t AliasTable::size() const {
+    return probabilities.size();
+}
+
+uint64_t AliasTable::getMemoryUsage(uint64_t numberOfOutcomes) {
+    return sizeof(AliasTable) + numberOfOutcomes * (sizeof(double) + sizeof(uint64_t));
+}
+
+}  // namespace simulator
+}  // namespace storm
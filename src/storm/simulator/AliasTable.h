@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace storm {
+namespace simulator {
+
+/*!
+ * A table for sampling from a discrete distribution in constant time using Walker's alias method (in the numerically stable variant of Vose). The
+ * outcomes are split into equally likely buckets, each of which holds (a part of) the probability of its own outcome and the remaining probability of
+ * one other outcome (its alias).
+ */
+class AliasTable {
+   public:
+    /*!
+     * Creates the table for the distribution given by the weights. The weights need not be normalized but must not all be zero.
+     *
+     * @param weights The (non-negative) weights of the outcomes.
+     */
+    AliasTable(std::vector<double> const& weights);
+
+    /*!
+     * Samples an outcome.
+     *
+     * @param uniform A number drawn uniformly from [0, 1).
+     * @return The index of the sampled outcome.
+     */
+    uint64_t sample(double uniform) const;
+
+    /*!
+     * Retrieves the number of outcomes.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the (approximate) number of bytes occupied by a table with the given number of outcomes.
+     */
+    static uint64_t getMemoryUsage(uint64_t numberOfOutcomes);
+
+   private:
+    // For each bucket, the probability of its own outcome (relative to the bucket) and the outcome that is sampled otherwise.
+    std::vector<double> probabilities;
+    std::vector<uint64_t> aliases;
+};
+
+}  // namespace simulator
+}  // namespace storm
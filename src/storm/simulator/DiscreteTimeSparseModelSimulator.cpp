@@ -1,12 +1,26 @@
 #include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
+
+#include <type_traits>
+
 #include "storm/models/sparse/Model.h"
+#include "storm/utility/constants.h"
 
 namespace storm {
 namespace simulator {
+
+namespace {
+// For rows with fewer entries, scanning the row is about as fast as using an alias table.
+uint64_t const minimalRowSizeForAliasTables = 16;
+}  // namespace
+
 template<typename ValueType, typename RewardModelType>
 DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::DiscreteTimeSparseModelSimulator(
     storm::models::sparse::Model<ValueType, RewardModelType> const& model)
-    : model(model), currentState(*model.getInitialStates().begin()), zeroRewards(model.getNumberOfRewardModels(), storm::utility::zero<ValueType>()) {
+    : model(model),
+      currentState(*model.getInitialStates().begin()),
+      zeroRewards(model.getNumberOfRewardModels(), storm::utility::zero<ValueType>()),
+      aliasTableMemoryBudget(64 * 1024 * 1024),
+      aliasTableMemoryUsage(0) {
     STORM_LOG_WARN_COND(model.getInitialStates().getNumberOfSetBits() == 1,
                         "The model has multiple initial states. This simulator assumes it starts from the initial state with the lowest index.");
     lastRewards = zeroRewards;
@@ -24,6 +38,34 @@ void DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::setSeed(uint6
     generator = storm::utility::RandomProbabilityGenerator<ValueType>(seed);
 }
 
+template<typename ValueType, typename RewardModelType>
+void DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::setAliasTableMemoryBudget(uint64_t bytes) {
+    aliasTableMemoryBudget = bytes;
+}
+
+template<typename ValueType, typename RewardModelType>
+AliasTable const* DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::getAliasTable(uint64_t row) {
+    auto const& transitionRow = model.getTransitionMatrix().getRow(row);
+    if (transitionRow.getNumberOfEntries() < minimalRowSizeForAliasTables) {
+        return nullptr;
+    }
+    auto it = aliasTables.find(row);
+    if (it != aliasTables.end()) {
+        return &it->second;
+    }
+    uint64_t memoryUsage = AliasTable::getMemoryUsage(transitionRow.getNumberOfEntries());
+    if (aliasTableMemoryUsage + memoryUsage > aliasTableMemoryBudget) {
+        return nullptr;
+    }
+    aliasTableMemoryUsage += memoryUsage;
+    std::vector<double> weights;
+    weights.reserve(transitionRow.getNumberOfEntries());
+    for (auto const& entry : transitionRow) {
+        weights.push_back(storm::utility::convertNumber<double>(entry.getValue()));
+    }
+    return &aliasTables.emplace(row, AliasTable(weights)).first->second;
+}
+
 template<typename ValueType, typename RewardModelType>
 bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::randomStep() {
     // TODO random_uint is slow
@@ -48,23 +90,38 @@ bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::step(uint64_t
         }
         ++i;
     }
-    ValueType sum = storm::utility::zero<ValueType>();
-    for (auto const& entry : model.getTransitionMatrix().getRow(row)) {
-        sum += entry.getValue();
-        if (sum >= probability) {
-            currentState = entry.getColumn();
-            i = 0;
-            for (auto const& rewModPair : model.getRewardModels()) {
-                if (rewModPair.second.hasStateRewards()) {
-                    lastRewards[i] += rewModPair.second.getStateReward(currentState);
-                }
-                ++i;
+    auto const& transitionRow = model.getTransitionMatrix().getRow(row);
+    bool foundSuccessor = false;
+    AliasTable const* aliasTable = nullptr;
+    if constexpr (std::is_same<ValueType, double>::value) {
+        aliasTable = getAliasTable(row);
+    }
+    if (aliasTable) {
+        currentState = (transitionRow.begin() + aliasTable->sample(storm::utility::convertNumber<double>(probability)))->getColumn();
+        foundSuccessor = true;
+    } else {
+        ValueType sum = storm::utility::zero<ValueType>();
+        for (auto const& entry : transitionRow) {
+            sum += entry.getValue();
+            if (sum >= probability) {
+                currentState = entry.getColumn();
+                foundSuccessor = true;
+                break;
             }
-            return true;
         }
     }
-    // This position should never be reached
-    return false;
+    if (!foundSuccessor) {
+        // This position should never be reached
+        return false;
+    }
+    i = 0;
+    for (auto const& rewModPair : model.getRewardModels()) {
+        if (rewModPair.second.hasStateRewards()) {
+            lastRewards[i] += rewModPair.second.getStateReward(currentState);
+        }
+        ++i;
+    }
+    return true;
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -1,5 +1,7 @@
 #include <cstdint>
+#include <unordered_map>
 #include "storm/models/sparse/Model.h"
+#include "storm/simulator/AliasTable.h"
 #include "storm/utility/random.h"
 
 namespace storm {
@@ -18,6 +20,12 @@ class DiscreteTimeSparseModelSimulator {
    public:
     DiscreteTimeSparseModelSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model);
     void setSeed(uint64_t);
+    /**
+     * Sets the number of bytes that may be used for alias tables. Successors of rows with many entries are sampled in constant time with an alias table
+     * that is created when the row is first taken. Once the budget is exhausted, the successors of the remaining rows are found by scanning the row.
+     * Alias tables are only used for floating point models.
+     */
+    void setAliasTableMemoryBudget(uint64_t bytes);
     bool step(uint64_t action);
     bool randomStep();
     std::vector<ValueType> const& getLastRewards() const;
@@ -25,11 +33,16 @@ class DiscreteTimeSparseModelSimulator {
     bool resetToInitial();
 
    protected:
+    AliasTable const* getAliasTable(uint64_t row);
+
     storm::models::sparse::Model<ValueType, RewardModelType> const& model;
     uint64_t currentState;
     std::vector<ValueType> lastRewards;
     std::vector<ValueType> zeroRewards;
     storm::utility::RandomProbabilityGenerator<ValueType> generator;
+    std::unordered_map<uint64_t, AliasTable> aliasTables;
+    uint64_t aliasTableMemoryBudget;
+    uint64_t aliasTableMemoryUsage;
 };
 }  // namespace simulator
 }  // namespace storm
\ No newline at end of file
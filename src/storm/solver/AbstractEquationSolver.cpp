@@ -1,5 +1,7 @@
 #include "storm/solver/AbstractEquationSolver.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/exceptions/InvalidOperationException.h"
@@ -7,6 +9,7 @@
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -307,9 +310,92 @@ void AbstractEquationSolver<ValueType>::showProgressIterative(uint64_t iteration
     }
 }
 
+template<typename ValueType>
+void AbstractEquationSolver<ValueType>::startObservingIterations(SolverIterationObserver const& observer) const {
+    iterationObserver = observer;
+    iterationObservationStart = std::chrono::steady_clock::now();
+    pendingIterationInfo = SolverIterationInfo();
+    previousObservedIterate.clear();
+}
+
+template<typename ValueType>
+bool AbstractEquationSolver<ValueType>::isObservingIterations() const {
+    return static_cast<bool>(iterationObserver);
+}
+
+template<typename ValueType>
+void AbstractEquationSolver<ValueType>::observeIterate(std::vector<ValueType> const& x) const {
+    if (!isObservingIterations()) {
+        return;
+    }
+    // Rational functions can not be compared numerically.
+    if constexpr (!std::is_same_v<ValueType, storm::RationalFunction>) {
+        if (previousObservedIterate.size() == x.size()) {
+            double residual = 0;
+            uint64_t numberOfUpdatedStates = 0;
+            for (uint64_t i = 0; i < x.size(); ++i) {
+                if (x[i] != previousObservedIterate[i]) {
+                    ++numberOfUpdatedStates;
+                    residual = std::max(residual, storm::utility::convertNumber<double>(storm::utility::abs<ValueType>(x[i] - previousObservedIterate[i])));
+                }
+            }
+            pendingIterationInfo.residual = residual;
+            pendingIterationInfo.numberOfUpdatedStates = numberOfUpdatedStates;
+        }
+        previousObservedIterate = x;
+    }
+}
+
+template<typename ValueType>
+void AbstractEquationSolver<ValueType>::observeBounds(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper) const {
+    if (!isObservingIterations()) {
+        return;
+    }
+    if constexpr (!std::is_same_v<ValueType, storm::RationalFunction>) {
+        STORM_LOG_ASSERT(lower.size() == upper.size(), "Bounds have different sizes.");
+        double gap = 0;
+        for (uint64_t i = 0; i < lower.size(); ++i) {
+            gap = std::max(gap, storm::utility::convertNumber<double>(upper[i] - lower[i]));
+        }
+        pendingIterationInfo.boundsGap = gap;
+    }
+}
+
+template<typename ValueType>
+void AbstractEquationSolver<ValueType>::observeVerificationPhases(bool inVerificationPhase, uint64_t numberOfVerificationPhases,
+                                                                  uint64_t numberOfFailedVerificationPhases) const {
+    if (isObservingIterations()) {
+        pendingIterationInfo.inVerificationPhase = inVerificationPhase;
+        pendingIterationInfo.numberOfVerificationPhases = numberOfVerificationPhases;
+        pendingIterationInfo.numberOfFailedVerificationPhases = numberOfFailedVerificationPhases;
+    }
+}
+
+template<typename ValueType>
+bool AbstractEquationSolver<ValueType>::hasAbortedSolveBounds() const {
+    return static_cast<bool>(abortedSolveBounds);
+}
+
+template<typename ValueType>
+std::pair<std::vector<ValueType>, std::vector<ValueType>> const& AbstractEquationSolver<ValueType>::getAbortedSolveBounds() const {
+    STORM_LOG_THROW(hasAbortedSolveBounds(), storm::exceptions::InvalidOperationException, "No bounds of an aborted solve available.");
+    return abortedSolveBounds.get();
+}
+
+template<typename ValueType>
+void AbstractEquationSolver<ValueType>::setAbortedSolveBounds(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper) const {
+    abortedSolveBounds = std::make_pair(lower, upper);
+}
+
+template<typename ValueType>
+void AbstractEquationSolver<ValueType>::clearAbortedSolveBounds() const {
+    abortedSolveBounds = boost::none;
+}
+
 template<typename ValueType>
 void AbstractEquationSolver<ValueType>::reportStatus(SolverStatus status, boost::optional<uint64_t> const& iterations) const {
     if (iterations) {
+        storm::utility::Profiler::getInstance().addCounter("iterations", iterations.get());
         switch (status) {
             case SolverStatus::Converged:
                 STORM_LOG_TRACE("Iterative solver converged after " << iterations.get() << " iterations.");
@@ -359,12 +445,22 @@ SolverStatus AbstractEquationSolver<ValueType>::updateStatus(SolverStatus status
             status = SolverStatus::Aborted;
         }
     }
+    if (isObservingIterations()) {
+        SolverIterationInfo info = std::move(pendingIterationInfo);
+        pendingIterationInfo = SolverIterationInfo();
+        info.iteration = iterations;
+        info.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - iterationObservationStart).count();
+        if (!iterationObserver(info) && status == SolverStatus::InProgress) {
+            status = SolverStatus::Aborted;
+        }
+    }
     return status;
 }
 
 template<typename ValueType>
 SolverStatus AbstractEquationSolver<ValueType>::updateStatus(SolverStatus status, std::vector<ValueType> const& x, SolverGuarantee const& guarantee,
                                                              uint64_t iterations, uint64_t maximalNumberOfIterations) const {
+    observeIterate(x);
     return this->updateStatus(status, this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(x, guarantee), iterations,
                               maximalNumberOfIterations);
 }
@@ -5,7 +5,9 @@
 #include <chrono>
 #include <iostream>
 #include <memory>
+#include <vector>
 
+#include "storm/solver/SolverIterationObserver.h"
 #include "storm/solver/SolverStatus.h"
 #include "storm/solver/TerminationCondition.h"
 #include "storm/utility/ProgressMeasurement.h"
@@ -190,6 +192,27 @@ class AbstractEquationSolver {
      */
     void showProgressIterative(uint64_t iterations, boost::optional<uint64_t> const& bound = boost::none) const;
 
+    /*!
+     * Starts to report the iterations of this solver to the given observer. An empty observer disables the reporting.
+     */
+    void startObservingIterations(SolverIterationObserver const& observer) const;
+
+    /*!
+     * Retrieves whether the iterations of this solver are reported to an observer.
+     */
+    bool isObservingIterations() const;
+
+    /*!
+     * Retrieves whether the last solve was aborted (e.g. because of a timeout) and the solution method provided sound lower and upper bounds on the solution
+     * at that point.
+     */
+    bool hasAbortedSolveBounds() const;
+
+    /*!
+     * Retrieves the lower and upper bounds on the solution at the point where the last solve was aborted.
+     */
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> const& getAbortedSolveBounds() const;
+
    protected:
     /*!
      * Retrieves the custom termination condition (if any was set).
@@ -232,6 +255,33 @@ class AbstractEquationSolver {
      */
     SolverStatus updateStatus(SolverStatus status, bool earlyTermination, uint64_t iterations, uint64_t maximalNumberOfIterations) const;
 
+    /*!
+     * If the iterations are observed, compares the given iterate with the previously observed one. The resulting residual and number of updated entries are
+     * passed to the observer with the next status update. Status updates that are given the current iterate do this automatically.
+     */
+    void observeIterate(std::vector<ValueType> const& x) const;
+
+    /*!
+     * If the iterations are observed, computes the largest difference between the given bounds and passes it to the observer with the next status update.
+     */
+    void observeBounds(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper) const;
+
+    /*!
+     * If the iterations are observed, passes the given information on the verification phases of optimistic value iteration to the observer with the next
+     * status update.
+     */
+    void observeVerificationPhases(bool inVerificationPhase, uint64_t numberOfVerificationPhases, uint64_t numberOfFailedVerificationPhases) const;
+
+    /*!
+     * Records the given bounds on the solution, which sound solution methods call once they are aborted.
+     */
+    void setAbortedSolveBounds(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper) const;
+
+    /*!
+     * Removes the bounds of a previously aborted solve (if any).
+     */
+    void clearAbortedSolveBounds() const;
+
     // A termination condition to be used (can be unset).
     std::unique_ptr<TerminationCondition<ValueType>> terminationCondition;
 
@@ -253,6 +303,15 @@ class AbstractEquationSolver {
    private:
     // Indicates the progress of this solver.
     mutable boost::optional<storm::utility::ProgressMeasurement> progressMeasurement;
+
+    // The observer of the iterations (if any) along with the information that is passed to it with the next status update.
+    mutable SolverIterationObserver iterationObserver;
+    mutable std::chrono::steady_clock::time_point iterationObservationStart;
+    mutable SolverIterationInfo pendingIterationInfo;
+    mutable std::vector<ValueType> previousObservedIterate;
+
+    // The bounds on the solution at the point where the last solve was aborted (if any).
+    mutable boost::optional<std::pair<std::vector<ValueType>, std::vector<ValueType>>> abortedSolveBounds;
 };
 
 }  // namespace solver
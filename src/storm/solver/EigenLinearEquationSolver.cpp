@@ -1,5 +1,8 @@
 #include "storm/solver/EigenLinearEquationSolver.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "storm/adapters/EigenAdapter.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -7,6 +10,8 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 
 #include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/utility/KwekMehlhorn.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
@@ -68,12 +73,114 @@ EigenLinearEquationSolverMethod EigenLinearEquationSolver<ValueType>::getMethod(
 }
 
 #ifdef STORM_HAVE_CARL
+namespace {
+/*!
+ * Computes the residual b - A*x exactly.
+ *
+ * @return True iff the residual is zero, i.e., x is the exact solution.
+ */
+bool computeResidual(Eigen::SparseMatrix<storm::RationalNumber> const& A, std::vector<storm::RationalNumber> const& x,
+                     std::vector<storm::RationalNumber> const& b, std::vector<storm::RationalNumber>& residual) {
+    residual = b;
+    for (Eigen::Index outer = 0; outer < A.outerSize(); ++outer) {
+        for (Eigen::SparseMatrix<storm::RationalNumber>::InnerIterator it(A, outer); it; ++it) {
+            residual[it.row()] -= it.value() * x[it.col()];
+        }
+    }
+    return std::all_of(residual.begin(), residual.end(), [](storm::RationalNumber const& value) { return storm::utility::isZero(value); });
+}
+
+/*!
+ * Tries to obtain the exact solution of the given rational equation system from floating point computations: The system is solved with a sparse LU
+ * factorization in double precision, the solution is rounded to nearby rationals with small denominators (the Kwek-Mehlhorn algorithm) and each
+ * rounded candidate is checked exactly. If no candidate is the solution, the (exact) approximation is refined by solving for the exact residual with
+ * the same floating point factorization, which allows certifying solutions that need more digits than a double provides.
+ *
+ * @return True iff the exact solution was found and written to x.
+ */
+bool solveWithFloatingPointPresolve(Eigen::SparseMatrix<storm::RationalNumber> const& A, std::vector<storm::RationalNumber>& x,
+                                    std::vector<storm::RationalNumber> const& b, uint64_t maximalNumberOfRefinementSteps) {
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(A.nonZeros());
+    for (Eigen::Index outer = 0; outer < A.outerSize(); ++outer) {
+        for (Eigen::SparseMatrix<storm::RationalNumber>::InnerIterator it(A, outer); it; ++it) {
+            triplets.emplace_back(it.row(), it.col(), storm::utility::convertNumber<double>(it.value()));
+        }
+    }
+    Eigen::SparseMatrix<double> doubleA(A.rows(), A.cols());
+    doubleA.setFromTriplets(triplets.begin(), triplets.end());
+    triplets = std::vector<Eigen::Triplet<double>>();
+
+    Eigen::SparseLU<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> solver;
+    solver.compute(doubleA);
+    if (solver.info() != Eigen::ComputationInfo::Success) {
+        return false;
+    }
+
+    Eigen::VectorXd doubleRhs(b.size());
+    for (uint64_t row = 0; row < b.size(); ++row) {
+        doubleRhs(row) = storm::utility::convertNumber<double>(b[row]);
+    }
+    std::vector<storm::RationalNumber> approximation(x.size(), storm::utility::zero<storm::RationalNumber>());
+    std::vector<storm::RationalNumber> candidate(x.size());
+    std::vector<storm::RationalNumber> previousCandidate;
+    std::vector<storm::RationalNumber> residual;
+    uint64_t const digitsPerStep = std::numeric_limits<double>::digits10;
+    for (uint64_t step = 0; step <= maximalNumberOfRefinementSteps; ++step) {
+        Eigen::VectorXd correction = solver.solve(doubleRhs);
+        if (solver.info() != Eigen::ComputationInfo::Success) {
+            return false;
+        }
+        for (uint64_t row = 0; row < approximation.size(); ++row) {
+            if (!std::isfinite(correction(row))) {
+                return false;
+            }
+            approximation[row] += storm::utility::convertNumber<storm::RationalNumber>(correction(row));
+        }
+
+        // After this step, the approximation is accurate up to roughly (step + 1) * digitsPerStep digits, so rounding to more digits is pointless.
+        uint64_t const firstPrecision = step * digitsPerStep;
+        uint64_t const lastPrecision = (step + 1) * std::numeric_limits<double>::max_digits10;
+        for (uint64_t precision = firstPrecision; precision <= lastPrecision; ++precision) {
+            storm::utility::kwek_mehlhorn::sharpen(precision, approximation, candidate);
+            // Neighboring precisions often yield the same candidate, which only needs to be checked once.
+            if (precision > firstPrecision && candidate == previousCandidate) {
+                continue;
+            }
+            if (computeResidual(A, candidate, b, residual)) {
+                STORM_LOG_INFO("Certified the rounded floating point solution with precision " << precision << " after " << step << " refinement steps.");
+                x = std::move(candidate);
+                return true;
+            }
+            std::swap(candidate, previousCandidate);
+            candidate.resize(x.size());
+        }
+
+        if (computeResidual(A, approximation, b, residual)) {
+            x = std::move(approximation);
+            return true;
+        }
+        for (uint64_t row = 0; row < residual.size(); ++row) {
+            doubleRhs(row) = storm::utility::convertNumber<double>(residual[row]);
+        }
+    }
+    return false;
+}
+}  // namespace
+
 // Specialization for storm::RationalNumber
 template<>
 bool EigenLinearEquationSolver<storm::RationalNumber>::internalSolveEquations(Environment const& env, std::vector<storm::RationalNumber>& x,
                                                                               std::vector<storm::RationalNumber> const& b) const {
     auto solutionMethod = getMethod(env, true);
     STORM_LOG_WARN_COND(solutionMethod == EigenLinearEquationSolverMethod::SparseLU, "Switching method to SparseLU.");
+    if (env.solver().eigen().isFloatingPointPresolveSet()) {
+        STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) in floating point and certifying the rounded solution.");
+        if (solveWithFloatingPointPresolve(*eigenA, x, b, env.solver().eigen().getNumberOfRefinementSteps())) {
+            return true;
+        }
+        STORM_LOG_INFO("Could not certify a floating point solution.");
+    }
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with with rational numbers using LU factorization (Eigen library).");
 
     // Map the input vectors to Eigen's format.
@@ -2,12 +2,15 @@
 
 #include <numeric>
 
+#include "storm/adapters/SmallRationalNumber.h"
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/EliminationSettings.h"
 
 #include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
 
+#include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/stateelimination.h"
@@ -48,6 +51,32 @@ void EliminationLinearEquationSolver<ValueType>::setMatrix(storm::storage::Spars
     this->clearCache();
 }
 
+namespace {
+/*!
+ * Eliminates all states of the given system, which turns the given values (initially the right-hand side) into the solution.
+ */
+template<typename ValueType>
+void eliminateAllStates(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                        std::vector<ValueType> const& b, std::vector<ValueType>& x,
+                        boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
+    // Translate the matrix and its transpose into the flexible format.
+    storm::storage::FlexibleSparseMatrix<ValueType> flexibleMatrix(transitionMatrix, false);
+    storm::storage::FlexibleSparseMatrix<ValueType> flexibleBackwardTransitions(backwardTransitions, true);
+
+    std::shared_ptr<StatePriorityQueue> priorityQueue =
+        createStatePriorityQueue<ValueType>(distanceBasedPriorities, flexibleMatrix, flexibleBackwardTransitions, b, storm::storage::BitVector(x.size(), true));
+
+    // Create a state eliminator to perform the actual elimination.
+    PrioritizedStateEliminator<ValueType> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, x);
+
+    // Eliminate all states.
+    while (priorityQueue->hasNext()) {
+        auto state = priorityQueue->pop();
+        eliminator.eliminateState(state, false);
+    }
+}
+}  // namespace
+
 template<typename ValueType>
 bool EliminationLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, std::vector<ValueType>& x,
                                                                         std::vector<ValueType> const& b) const {
@@ -60,13 +89,6 @@ bool EliminationLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     storm::storage::SparseMatrix<ValueType> const& transitionMatrix = localA ? *localA : *A;
     storm::storage::SparseMatrix<ValueType> backwardTransitions = transitionMatrix.transpose();
 
-    // Initialize the solution to the right-hand side of the equation system.
-    x = b;
-
-    // Translate the matrix and its transpose into the flexible format.
-    storm::storage::FlexibleSparseMatrix<ValueType> flexibleMatrix(transitionMatrix, false);
-    storm::storage::FlexibleSparseMatrix<ValueType> flexibleBackwardTransitions(backwardTransitions, true);
-
     boost::optional<std::vector<uint_fast64_t>> distanceBasedPriorities;
 
     // TODO: get the order from the environment
@@ -82,16 +104,24 @@ bool EliminationLinearEquationSolver<ValueType>::internalSolveEquations(Environm
                                                              eliminationOrderNeedsForwardDistances(order), eliminationOrderNeedsReversedDistances(order));
     }
 
-    std::shared_ptr<StatePriorityQueue> priorityQueue =
-        createStatePriorityQueue<ValueType>(distanceBasedPriorities, flexibleMatrix, flexibleBackwardTransitions, b, storm::storage::BitVector(x.size(), true));
-
-    // Create a state eliminator to perform the actual elimination.
-    PrioritizedStateEliminator<ValueType> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, x);
-
-    // Eliminate all states.
-    while (priorityQueue->hasNext()) {
-        auto state = priorityQueue->pop();
-        eliminator.eliminateState(state, false);
+    if constexpr (std::is_same<ValueType, storm::RationalNumber>::value) {
+        // The probabilities of exact models (and most values obtained while eliminating states) have small denominators, so we eliminate with
+        // rationals that are stored inline whenever they fit into 64 bits.
+        std::vector<storm::SmallRationalNumber> smallB;
+        smallB.reserve(b.size());
+        for (auto const& value : b) {
+            smallB.emplace_back(value);
+        }
+        std::vector<storm::SmallRationalNumber> smallX = smallB;
+        eliminateAllStates(transitionMatrix.template toValueType<storm::SmallRationalNumber>(),
+                           backwardTransitions.template toValueType<storm::SmallRationalNumber>(), smallB, smallX, distanceBasedPriorities);
+        for (uint64_t row = 0; row < x.size(); ++row) {
+            x[row] = smallX[row].toRationalNumber();
+        }
+    } else {
+        // Initialize the solution to the right-hand side of the equation system.
+        x = b;
+        eliminateAllStates(transitionMatrix, backwardTransitions, b, x, distanceBasedPriorities);
     }
 
     return true;
@@ -1,28 +1,45 @@
+#include <algorithm>
 #include <functional>
 #include <limits>
 
 #include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/solver/helper/DistributedValueIterationHelper.h"
 #include "storm/solver/helper/IntervalterationHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
+#include "storm/solver/helper/PrioritizedValueIterationHelper.h"
 #include "storm/solver/helper/RationalSearchHelper.h"
 #include "storm/solver/helper/SchedulerTrackingHelper.h"
+#include "storm/solver/helper/SolverCheckpoint.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/helper/ValueIterationHelper.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
 namespace solver {
 
+namespace {
+// The multigrid method is policy iteration whose policies are evaluated by the native multigrid linear equation solver.
+Environment createMultigridEnvironment(Environment const& env) {
+    Environment multigridEnv = env;
+    multigridEnv.solver().setLinearEquationSolverType(EquationSolverType::Native);
+    multigridEnv.solver().native().setMethod(NativeLinearEquationSolverMethod::Multigrid);
+    return multigridEnv;
+}
+}  // namespace
+
 template<typename ValueType, typename SolutionType>
 IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::IterativeMinMaxLinearEquationSolver() : linearEquationSolverFactory(nullptr) {
     STORM_LOG_ASSERT(static_cast<bool>(std::is_same_v<storm::Interval, ValueType>),
@@ -65,7 +82,8 @@ MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::getMe
             STORM_LOG_WARN("The selected solution method " << toString(method) << " does not guarantee exact results.");
         }
     } else if (env.solver().isForceSoundness() && method != MinMaxMethod::SoundValueIteration && method != MinMaxMethod::IntervalIteration &&
-               method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch && method != MinMaxMethod::OptimisticValueIteration) {
+               method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch && method != MinMaxMethod::OptimisticValueIteration &&
+               method != MinMaxMethod::PrioritizedValueIteration && method != MinMaxMethod::Multigrid) {
         if (env.solver().minMax().isMethodSetFromDefault()) {
             method = MinMaxMethod::OptimisticValueIteration;
             STORM_LOG_INFO(
@@ -78,7 +96,8 @@ MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::getMe
     }
     STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
                         method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration ||
-                        method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi,
+                        method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi ||
+                        method == MinMaxMethod::PrioritizedValueIteration || method == MinMaxMethod::Multigrid,
                     storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method '" << toString(method) << "'.");
     return method;
 }
@@ -109,6 +128,12 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSolve
         case MinMaxMethod::ViToPi:
             result = solveEquationsViToPi(env, dir, x, b);
             break;
+        case MinMaxMethod::PrioritizedValueIteration:
+            result = solveEquationsPrioritizedValueIteration(env, dir, x, b);
+            break;
+        case MinMaxMethod::Multigrid:
+            result = solveEquationsMultigrid(env, dir, x, b);
+            break;
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "This solver does not implement the selected solution method");
     }
@@ -117,11 +142,16 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSolve
 }
 
 template<typename ValueType, typename SolutionType>
-void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::setUpViOperator() const {
+void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::setUpViOperator(uint64_t numberOfThreads, bool compressValues,
+                                                                                   bool asynchronousUpdates) const {
     if (!viOperator) {
         viOperator = std::make_shared<helper::ValueIterationOperator<ValueType, false, SolutionType>>();
+        viOperator->setCompressedValues(compressValues);
         viOperator->setMatrixBackwards(*this->A);
     }
+    viOperator->setCompressedValues(compressValues);
+    viOperator->setNumberOfThreads(numberOfThreads);
+    viOperator->setAsynchronousUpdates(asynchronousUpdates);
     if (this->choiceFixedForRowGroup) {
         // Ignore those rows that are not selected
         assert(this->initialScheduler);
@@ -211,6 +241,10 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::performPolicy
         }
         std::vector<ValueType>& subB = *auxiliaryRowGroupVector;
 
+        // The matrix of the equation system induced by the current scheduler. When the scheduler changes, only the rows of the changed row groups are
+        // updated (if possible). As the solver might only refer to this matrix, it needs to be declared before the solver.
+        storm::storage::SparseMatrix<ValueType> inducedMatrix;
+        std::vector<uint64_t> changedRowGroups;
         // The solver that we will use throughout the procedure.
         std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver;
         // The linear equation solver should be at least as precise as this solver
@@ -236,50 +270,104 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::performPolicy
 
         SolverStatus status = SolverStatus::InProgress;
         uint64_t iterations = 0;
+        // Resume an interrupted solve (if any) from the stored scheduler and values.
+        auto checkpoint = helper::createSolverCheckpoint<ValueType, SolutionType>(env, "pi", *this->A, b, dir);
+        if (checkpoint && checkpoint->restore(1) && checkpoint->getScheduler().size() == scheduler.size()) {
+            scheduler = std::move(checkpoint->getScheduler());
+            x = std::move(checkpoint->getVector(0));
+            iterations = checkpoint->getIterations();
+        }
+        bool const convertToEquationSystem =
+            this->linearEquationSolverFactory->getEquationProblemFormat(environmentOfSolver) == LinearEquationSolverProblemFormat::EquationSystem;
+        auto const& rowGroupIndices = this->A->getRowGroupIndices();
+        uint64_t const numberOfThreads = std::max<uint64_t>(1, env.solver().getNumberOfThreads());
+        // The row groups whose choice is improved by each thread together with their improved values.
+        std::vector<std::vector<std::pair<uint64_t, ValueType>>> improvementsOfThread(numberOfThreads);
         this->startMeasureProgress();
         do {
-            // Solve the equation system for the 'DTMC'.
-            solveInducedEquationSystem(environmentOfSolver, solver, scheduler, x, subB, b);
-
-            // Go through the multiplication result and see whether we can improve any of the choices.
-            bool schedulerImproved = false;
-            // Group refers to the state number
-            for (uint_fast64_t group = 0; group < this->A->getRowGroupCount(); ++group) {
-                if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
-                    //  Only update when the choice is not fixed
-                    uint_fast64_t currentChoice = scheduler[group];
-                    for (uint_fast64_t choice = this->A->getRowGroupIndices()[group]; choice < this->A->getRowGroupIndices()[group + 1]; ++choice) {
-                        // If the choice is the currently selected one, we can skip it.
-                        if (choice - this->A->getRowGroupIndices()[group] == currentChoice) {
+            // Set up the equation system for the 'DTMC', patching the rows of the changed choices if possible.
+            if (!solver || !patchInducedMatrix(inducedMatrix, scheduler, changedRowGroups, convertToEquationSystem)) {
+                inducedMatrix = this->A->selectRowsFromRowGroups(scheduler, convertToEquationSystem);
+                if (convertToEquationSystem) {
+                    inducedMatrix.convertToEquationSystem();
+                }
+                storm::utility::vector::selectVectorValues<ValueType>(subB, scheduler, rowGroupIndices, b);
+            } else {
+                for (auto group : changedRowGroups) {
+                    subB[group] = b[rowGroupIndices[group] + scheduler[group]];
+                }
+            }
+            if (!solver) {
+                solver = this->linearEquationSolverFactory->create(environmentOfSolver, inducedMatrix);
+                solver->setBoundsFromOtherSolver(*this);
+                solver->setCachingEnabled(true);
+            } else {
+                solver->setMatrix(inducedMatrix);
+            }
+
+            // Solve the equation system for the 'DTMC'. Iterative solvers start from the values of the previous scheduler.
+            solver->solveEquations(environmentOfSolver, x, subB);
+
+            // Go through the multiplication result and see whether we can improve any of the choices. The row groups are processed in parallel, which is why
+            // the improved values are only written to x afterwards.
+            uint64_t numberOfChunks = storm::utility::parallel::forEachChunk(
+                numberOfThreads, static_cast<uint64_t>(0), this->A->getRowGroupCount(), [&](uint64_t threadIndex, uint64_t groupBegin, uint64_t groupEnd) {
+                    auto& improvements = improvementsOfThread[threadIndex];
+                    improvements.clear();
+                    // Group refers to the state number
+                    for (uint64_t group = groupBegin; group < groupEnd; ++group) {
+                        if (this->choiceFixedForRowGroup && this->choiceFixedForRowGroup.get()[group]) {
+                            //  Only update when the choice is not fixed
                             continue;
                         }
-
-                        // Create the value of the choice.
-                        ValueType choiceValue = storm::utility::zero<ValueType>();
-                        for (auto const& entry : this->A->getRow(choice)) {
-                            choiceValue += entry.getValue() * x[entry.getColumn()];
+                        uint_fast64_t currentChoice = scheduler[group];
+                        bool groupImproved = false;
+                        ValueType bestValue = x[group];
+                        for (uint_fast64_t choice = rowGroupIndices[group]; choice < rowGroupIndices[group + 1]; ++choice) {
+                            // If the choice is the currently selected one, we can skip it.
+                            if (choice - rowGroupIndices[group] == currentChoice) {
+                                continue;
+                            }
+
+                            // Create the value of the choice.
+                            ValueType choiceValue = storm::utility::zero<ValueType>();
+                            for (auto const& entry : this->A->getRow(choice)) {
+                                choiceValue += entry.getValue() * x[entry.getColumn()];
+                            }
+                            choiceValue += b[choice];
+
+                            // If the value is strictly better than the solution of the inner system, we need to improve the scheduler.
+                            // TODO: If the underlying solver is not precise, this might run forever (i.e. when a state has two choices where the (exact) values
+                            // are equal). only changing the scheduler if the values are not equal (modulo precision) would make this unsound.
+                            if (valueImproved(dir, bestValue, choiceValue)) {
+                                groupImproved = true;
+                                scheduler[group] = choice - rowGroupIndices[group];
+                                bestValue = std::move(choiceValue);
+                            }
                         }
-                        choiceValue += b[choice];
-
-                        // If the value is strictly better than the solution of the inner system, we need to improve the scheduler.
-                        // TODO: If the underlying solver is not precise, this might run forever (i.e. when a state has two choices where the (exact) values are
-                        // equal). only changing the scheduler if the values are not equal (modulo precision) would make this unsound.
-                        if (valueImproved(dir, x[group], choiceValue)) {
-                            schedulerImproved = true;
-                            scheduler[group] = choice - this->A->getRowGroupIndices()[group];
-                            x[group] = std::move(choiceValue);
+                        if (groupImproved) {
+                            improvements.emplace_back(group, std::move(bestValue));
                         }
                     }
+                });
+            changedRowGroups.clear();
+            for (uint64_t threadIndex = 0; threadIndex < numberOfChunks; ++threadIndex) {
+                for (auto& improvement : improvementsOfThread[threadIndex]) {
+                    changedRowGroups.push_back(improvement.first);
+                    x[improvement.first] = std::move(improvement.second);
                 }
             }
 
             // If the scheduler did not improve, we are done.
-            if (!schedulerImproved) {
+            if (changedRowGroups.empty()) {
                 status = SolverStatus::Converged;
             }
 
             // Update environment variables.
             ++iterations;
+            if (checkpoint) {
+                checkpoint->storeIfDue(iterations, {&x}, &scheduler);
+            }
             status =
                 this->updateStatus(status, x, dir == storm::OptimizationDirection::Minimize ? SolverGuarantee::GreaterOrEqual : SolverGuarantee::LessOrEqual,
                                    iterations, env.solver().minMax().getMaximalNumberOfIterations());
@@ -304,6 +392,63 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::performPolicy
     }
 }
 
+template<typename ValueType, typename SolutionType>
+bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::patchInducedMatrix(storm::storage::SparseMatrix<ValueType>& inducedMatrix,
+                                                                                      std::vector<uint64_t> const& scheduler,
+                                                                                      std::vector<uint64_t> const& changedRowGroups,
+                                                                                      bool convertToEquationSystem) const {
+    if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We did not implement policy iteration for interval-based models.");
+        return false;
+    } else {
+        auto const& rowGroupIndices = this->A->getRowGroupIndices();
+        // The equation system format requires an entry on the diagonal, which selectRowsFromRowGroups inserts if necessary.
+        auto numberOfInducedEntries = [&](uint64_t group) {
+            auto row = this->A->getRow(rowGroupIndices[group] + scheduler[group]);
+            uint64_t result = row.getNumberOfEntries();
+            if (convertToEquationSystem && std::none_of(row.begin(), row.end(), [group](auto const& entry) { return entry.getColumn() == group; })) {
+                ++result;
+            }
+            return result;
+        };
+        for (auto group : changedRowGroups) {
+            if (numberOfInducedEntries(group) != inducedMatrix.getRow(group).getNumberOfEntries()) {
+                return false;
+            }
+        }
+
+        int64_t nonzeroEntryDifference = 0;
+        for (auto group : changedRowGroups) {
+            auto target = inducedMatrix.getRow(group).begin();
+            auto setNextEntry = [&](uint64_t column, ValueType value) {
+                if (convertToEquationSystem) {
+                    value = column == group ? storm::utility::one<ValueType>() - value : -value;
+                }
+                nonzeroEntryDifference +=
+                    static_cast<int64_t>(!storm::utility::isZero(value)) - static_cast<int64_t>(!storm::utility::isZero(target->getValue()));
+                target->setColumn(column);
+                target->setValue(std::move(value));
+                ++target;
+            };
+            bool diagonalEntrySet = !convertToEquationSystem;
+            for (auto const& entry : this->A->getRow(rowGroupIndices[group] + scheduler[group])) {
+                if (!diagonalEntrySet && entry.getColumn() >= group) {
+                    if (entry.getColumn() > group) {
+                        setNextEntry(group, storm::utility::zero<ValueType>());
+                    }
+                    diagonalEntrySet = true;
+                }
+                setNextEntry(entry.getColumn(), entry.getValue());
+            }
+            if (!diagonalEntrySet) {
+                setNextEntry(group, storm::utility::zero<ValueType>());
+            }
+        }
+        inducedMatrix.updateNonzeroEntryCount(nonzeroEntryDifference);
+        return true;
+    }
+}
+
 template<typename ValueType, typename SolutionType>
 bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::valueImproved(OptimizationDirection dir, ValueType const& value1,
                                                                                  ValueType const& value2) const {
@@ -327,10 +472,12 @@ MinMaxLinearEquationSolverRequirements IterativeMinMaxLinearEquationSolver<Value
 
     MinMaxLinearEquationSolverRequirements requirements;
     if constexpr (std::is_same_v<ValueType, storm::Interval>) {
-        STORM_LOG_ASSERT(!needsLinEqSolver, "Intervals should not require a linear equation solver.");
+        STORM_LOG_ASSERT(!needsLinEqSolver && method != MinMaxMethod::Multigrid, "Intervals should not require a linear equation solver.");
         // nothing to be done;
     } else if (needsLinEqSolver) {
         requirements = MinMaxLinearEquationSolverRequirements(this->linearEquationSolverFactory->getRequirements(env));
+    } else if (method == MinMaxMethod::Multigrid) {
+        requirements = MinMaxLinearEquationSolverRequirements(this->linearEquationSolverFactory->getRequirements(createMultigridEnvironment(env)));
     } else {
         // nothing to be done.
     }
@@ -371,7 +518,7 @@ MinMaxLinearEquationSolverRequirements IterativeMinMaxLinearEquationSolver<Value
             (env.solver().minMax().isForceRequireUnique() || !direction || direction.get() == OptimizationDirection::Minimize || this->isTrackSchedulerSet())) {
             requirements.requireUniqueSolution();
         }
-    } else if (method == MinMaxMethod::PolicyIteration) {
+    } else if (method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::Multigrid) {
         // The initial scheduler shall not select an end component
         if (!this->hasUniqueSolution() && env.solver().minMax().isForceRequireUnique()) {
             requirements.requireUniqueSolution();
@@ -384,6 +531,26 @@ MinMaxLinearEquationSolverRequirements IterativeMinMaxLinearEquationSolver<Value
             requirements.requireUniqueSolution();
         }
         requirements.requireBounds(false);
+    } else if (method == MinMaxMethod::PrioritizedValueIteration) {
+        if (env.solver().isForceSoundness()) {
+            // The sound variant approaches the solution from below and above, just like interval iteration.
+            if (!this->hasUniqueSolution()) {
+                requirements.requireUniqueSolution();
+            }
+            requirements.requireBounds();
+        } else if (!this->hasUniqueSolution()) {
+            // The unsound variant has the same requirements as traditional value iteration.
+            if (env.solver().minMax().isForceRequireUnique() || this->isTrackSchedulerSet()) {
+                requirements.requireUniqueSolution();
+            } else {
+                if (!direction || direction.get() == OptimizationDirection::Maximize) {
+                    requirements.requireLowerBounds();
+                }
+                if (!direction || direction.get() == OptimizationDirection::Minimize) {
+                    requirements.requireUpperBounds();
+                }
+            }
+        }
     } else if (method == MinMaxMethod::ViToPi) {
         // Since we want to use value iteration to extract an initial scheduler, the solution has to be unique.
         if (!this->hasUniqueSolution()) {
@@ -433,9 +600,9 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
             return true;
         }
 
-        setUpViOperator();
+        setUpViOperator(env.solver().getNumberOfThreads(), env.solver().multiplier().isCompressedValuesSet());
 
-        helper::OptimisticValueIterationHelper<ValueType, false> oviHelper(viOperator);
+        helper::OptimisticValueIterationHelper<ValueType, false> oviHelper(viOperator, env.solver().ovi().isAdaptiveSet());
         auto prec = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
         std::optional<ValueType> lowerBound, upperBound;
         if (this->hasLowerBound()) {
@@ -447,6 +614,8 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         uint64_t numIterations{0};
         auto oviCallback = [&](SolverStatus const& current, std::vector<ValueType> const& v) {
             this->showProgressIterative(numIterations);
+            auto const& statistics = oviHelper.getStatistics();
+            this->observeVerificationPhases(statistics.inVerificationPhase, statistics.numberOfVerificationPhases, statistics.numberOfFailedVerificationPhases);
             return this->updateStatus(current, v, SolverGuarantee::LessOrEqual, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
         };
         this->createLowerBoundsVector(x);
@@ -476,7 +645,14 @@ template<typename ValueType, typename SolutionType>
 bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquationsValueIteration(Environment const& env, OptimizationDirection dir,
                                                                                                 std::vector<SolutionType>& x,
                                                                                                 std::vector<ValueType> const& b) const {
-    setUpViOperator();
+    // Distributed value iteration decides convergence jointly for all processes, which is why custom termination conditions are not supported.
+    bool const distributed = std::is_same_v<ValueType, double> && std::is_same_v<SolutionType, double> && env.solver().isDistributedSet() &&
+                             !this->hasCustomTerminationCondition();
+    STORM_LOG_WARN_COND(distributed || !env.solver().isDistributedSet(), "Value iteration is not distributed for this equation system.");
+    if (!distributed) {
+        setUpViOperator(env.solver().getNumberOfThreads(), env.solver().multiplier().isCompressedValuesSet(),
+                        env.solver().minMax().isAsynchronousUpdatesSet());
+    }
     // By default, we can not provide any guarantee
     SolverGuarantee guarantee = SolverGuarantee::None;
 
@@ -529,16 +705,76 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         }
     }
 
+    if constexpr (std::is_same_v<ValueType, double> && std::is_same_v<SolutionType, double>) {
+        if (distributed) {
+            if (!distributedViHelper) {
+                distributedViHelper = std::make_shared<helper::DistributedValueIterationHelper<false>>(
+                    *this->A, env.solver().getDistributedStatePartitioning(), env.solver().getNumberOfThreads());
+            }
+            uint64_t numIterations{0};
+            this->startMeasureProgress();
+            auto status = distributedViHelper->VI(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
+                                                  storm::utility::convertNumber<double>(env.solver().minMax().getPrecision()), dir,
+                                                  env.solver().minMax().getMaximalNumberOfIterations());
+            this->reportStatus(status, numIterations);
+            if (this->isTrackSchedulerSet()) {
+                // The scheduler is extracted locally from the (complete) result.
+                setUpViOperator(env.solver().getNumberOfThreads(), env.solver().multiplier().isCompressedValuesSet());
+                this->extractScheduler(x, b, dir, this->isUncertaintyRobust());
+            }
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            return status == SolverStatus::Converged;
+        }
+    }
+
     storm::solver::helper::ValueIterationHelper<ValueType, false, SolutionType> viHelper(viOperator);
     uint64_t numIterations{0};
+    // Resume an interrupted solve (if any). As the stored iterate was obtained from the same initial values, it maintains the same guarantee.
+    auto checkpoint = helper::createSolverCheckpoint<ValueType, SolutionType>(env, "vi", *this->A, b, dir);
+    if (checkpoint && checkpoint->restore(1)) {
+        x = std::move(checkpoint->getVector(0));
+        numIterations = checkpoint->getIterations();
+    }
     auto viCallback = [&](SolverStatus const& current) {
         this->showProgressIterative(numIterations);
+        if (checkpoint) {
+            checkpoint->storeIfDue(numIterations, {&x});
+        }
         return this->updateStatus(current, x, guarantee, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
     };
     this->startMeasureProgress();
-    auto status = viHelper.VI(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
-                              storm::utility::convertNumber<SolutionType>(env.solver().minMax().getPrecision()), dir, viCallback,
-                              env.solver().minMax().getMultiplicationStyle(), this->isUncertaintyRobust());
+    bool const relative = env.solver().minMax().getRelativeTerminationCriterion();
+    SolutionType const precision = storm::utility::convertNumber<SolutionType>(env.solver().minMax().getPrecision());
+    auto status = SolverStatus::InProgress;
+    if (env.solver().minMax().isMixedPrecisionSet()) {
+        // Rounding the matrix entries can move the iterates past the solution, so this is only done if no guarantee has to be maintained.
+        STORM_LOG_WARN_COND(guarantee == SolverGuarantee::None, "Mixed precision is not used as the iteration has to maintain a guarantee.");
+        STORM_LOG_WARN_COND((std::is_same_v<ValueType, double>), "Mixed precision is only supported for double precision models.");
+        if constexpr (std::is_same_v<ValueType, double>) {
+            if (guarantee == SolverGuarantee::None) {
+                // Iterate with single precision matrix entries until the (perturbed) fixpoint is approximated as closely as single precision allows.
+                // The result is then refined with the exact matrix entries, which typically only takes a few more iterations.
+                viOperator->setSinglePrecisionValues(true);
+                auto singlePrecisionCallback = [&](SolverStatus const& current) {
+                    this->showProgressIterative(numIterations);
+                    if (checkpoint) {
+                        checkpoint->storeIfDue(numIterations, {&x});
+                    }
+                    return this->updateStatus(current, false, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+                };
+                status = viHelper.VI(x, b, numIterations, relative, std::max<SolutionType>(precision, std::numeric_limits<float>::epsilon()), dir,
+                                     singlePrecisionCallback, env.solver().minMax().getMultiplicationStyle(), this->isUncertaintyRobust());
+                viOperator->setSinglePrecisionValues(false);
+                STORM_LOG_INFO("Performed " << numIterations << " iterations with single precision matrix entries.");
+            }
+        }
+    }
+    if (status == SolverStatus::InProgress || status == SolverStatus::Converged) {
+        status = viHelper.VI(x, b, numIterations, relative, precision, dir, viCallback, env.solver().minMax().getMultiplicationStyle(),
+                             this->isUncertaintyRobust());
+    }
     this->reportStatus(status, numIterations);
 
     // If requested, we store the scheduler for retrieval.
@@ -572,18 +808,45 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We did not implement intervaliteration for interval-based models");
         return false;
     } else {
-        setUpViOperator();
+        setUpViOperator(env.solver().getNumberOfThreads(), env.solver().multiplier().isCompressedValuesSet());
         helper::IntervalIterationHelper<ValueType, false> iiHelper(viOperator);
         auto prec = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
-        auto lowerBoundsCallback = [&](std::vector<SolutionType>& vector) { this->createLowerBoundsVector(vector); };
-        auto upperBoundsCallback = [&](std::vector<SolutionType>& vector) { this->createUpperBoundsVector(vector); };
-
         uint64_t numIterations{0};
+        // Resume an interrupted solve (if any) from the stored lower and upper bounds.
+        auto checkpoint = helper::createSolverCheckpoint<ValueType, SolutionType>(env, "ii", *this->A, b, dir);
+        bool const restored = checkpoint && checkpoint->restore(2);
+        if (restored) {
+            numIterations = checkpoint->getIterations();
+        }
+        auto lowerBoundsCallback = [&](std::vector<SolutionType>& vector) {
+            if (restored) {
+                vector = std::move(checkpoint->getVector(0));
+            } else {
+                this->createLowerBoundsVector(vector);
+            }
+        };
+        auto upperBoundsCallback = [&](std::vector<SolutionType>& vector) {
+            if (restored) {
+                vector = std::move(checkpoint->getVector(1));
+            } else {
+                this->createUpperBoundsVector(vector);
+            }
+        };
+
         auto iiCallback = [&](helper::IIData<ValueType> const& data) {
             this->showProgressIterative(numIterations);
+            this->observeBounds(data.x, data.y);
+            if (checkpoint) {
+                checkpoint->storeIfDue(numIterations, {&data.x, &data.y});
+            }
             bool terminateEarly = this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(data.x, SolverGuarantee::LessOrEqual) &&
                                   this->getTerminationCondition().terminateNow(data.y, SolverGuarantee::GreaterOrEqual);
-            return this->updateStatus(data.status, terminateEarly, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+            auto status = this->updateStatus(data.status, terminateEarly, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+            if (status == SolverStatus::Aborted) {
+                // Keep the current bounds, so that an anytime result can be reported.
+                this->setAbortedSolveBounds(data.x, data.y);
+            }
+            return status;
         };
         std::optional<storm::storage::BitVector> optionalRelevantValues;
         if (this->hasRelevantValues()) {
@@ -626,15 +889,27 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
             upperBound = this->getUpperBound(true);
         }
 
-        setUpViOperator();
+        setUpViOperator(env.solver().getNumberOfThreads(), env.solver().multiplier().isCompressedValuesSet());
 
         auto precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
         uint64_t numIterations{0};
         auto sviCallback = [&](typename helper::SoundValueIterationHelper<ValueType, false>::SVIData const& current) {
             this->showProgressIterative(numIterations);
-            return this->updateStatus(current.status,
-                                      this->hasCustomTerminationCondition() && current.checkCustomTerminationCondition(this->getTerminationCondition()),
-                                      numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+            if (this->isObservingIterations() && current.a && current.b) {
+                std::vector<ValueType> lower(x.size()), upper(x.size());
+                current.trySetLowerUpper(lower, upper);
+                this->observeBounds(lower, upper);
+            }
+            auto status = this->updateStatus(current.status,
+                                             this->hasCustomTerminationCondition() && current.checkCustomTerminationCondition(this->getTerminationCondition()),
+                                             numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+            if (status == SolverStatus::Aborted && current.a && current.b) {
+                // Keep the current bounds, so that an anytime result can be reported.
+                std::vector<ValueType> lower(x.size()), upper(x.size());
+                current.trySetLowerUpper(lower, upper);
+                this->setAbortedSolveBounds(lower, upper);
+            }
+            return status;
         };
         this->startMeasureProgress();
         helper::SoundValueIterationHelper<ValueType, false> sviHelper(viOperator);
@@ -660,6 +935,76 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
     }
 }
 
+/*!
+ * Prioritized value iteration only updates the row groups whose value changes significantly, in the order of their residuals. If soundness is required,
+ * the solution is approached from below and above as in interval iteration.
+ */
+template<typename ValueType, typename SolutionType>
+bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquationsPrioritizedValueIteration(Environment const& env, OptimizationDirection dir,
+                                                                                                           std::vector<SolutionType>& x,
+                                                                                                           std::vector<ValueType> const& b) const {
+    if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Prioritized value iteration does not handle interval-based models");
+        return false;
+    } else {
+        if (!prioritizedViHelper) {
+            prioritizedViHelper = std::make_shared<helper::PrioritizedValueIterationHelper<ValueType>>(*this->A);
+        }
+        bool const relative = env.solver().minMax().getRelativeTerminationCriterion();
+        auto const precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+        uint64_t numIterations{0};
+        SolverStatus status;
+        this->startMeasureProgress();
+        if (env.solver().isForceSoundness()) {
+            auto lowerBoundsCallback = [&](std::vector<SolutionType>& vector) { this->createLowerBoundsVector(vector); };
+            auto upperBoundsCallback = [&](std::vector<SolutionType>& vector) { this->createUpperBoundsVector(vector); };
+            auto iiCallback = [&](helper::IIData<ValueType> const& data) {
+                this->showProgressIterative(numIterations);
+                this->observeBounds(data.x, data.y);
+                bool terminateEarly = this->hasCustomTerminationCondition() &&
+                                      this->getTerminationCondition().terminateNow(data.x, SolverGuarantee::LessOrEqual) &&
+                                      this->getTerminationCondition().terminateNow(data.y, SolverGuarantee::GreaterOrEqual);
+                return this->updateStatus(data.status, terminateEarly, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+            };
+            std::optional<storm::storage::BitVector> optionalRelevantValues;
+            if (this->hasRelevantValues()) {
+                optionalRelevantValues = this->getRelevantValues();
+            }
+            status = prioritizedViHelper->PII(x, b, numIterations, relative, precision, lowerBoundsCallback, upperBoundsCallback, dir, iiCallback,
+                                              optionalRelevantValues);
+        } else {
+            // As for traditional value iteration, we have to approach the solution from below (above) if it is not unique.
+            SolverGuarantee guarantee = SolverGuarantee::None;
+            if (!this->hasUniqueSolution()) {
+                if (maximize(dir)) {
+                    this->createLowerBoundsVector(x);
+                    guarantee = SolverGuarantee::LessOrEqual;
+                } else {
+                    this->createUpperBoundsVector(x);
+                    guarantee = SolverGuarantee::GreaterOrEqual;
+                }
+            }
+            auto viCallback = [&](SolverStatus const& current) {
+                this->showProgressIterative(numIterations);
+                return this->updateStatus(current, x, guarantee, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+            };
+            status = prioritizedViHelper->PVI(x, b, numIterations, relative, precision, dir, viCallback);
+        }
+        this->reportStatus(status, numIterations);
+
+        // If requested, we store the scheduler for retrieval.
+        if (this->isTrackSchedulerSet()) {
+            this->extractScheduler(x, b, dir, this->isUncertaintyRobust());
+        }
+
+        if (!this->isCachingEnabled()) {
+            clearCache();
+        }
+
+        return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+    }
+}
+
 template<typename ValueType, typename SolutionType>
 bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquationsViToPi(Environment const& env, OptimizationDirection dir,
                                                                                         std::vector<SolutionType>& x, std::vector<ValueType> const& b) const {
@@ -690,6 +1035,21 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
     return performPolicyIteration(env, dir, x, b, std::move(initialSched));
 }
 
+template<typename ValueType, typename SolutionType>
+bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquationsMultigrid(Environment const& env, OptimizationDirection dir,
+                                                                                           std::vector<SolutionType>& x,
+                                                                                           std::vector<ValueType> const& b) const {
+    if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "The multigrid method does not handle interval-based models");
+        return false;
+    } else {
+        STORM_LOG_INFO("Solving min/max equation system with policy iteration whose policies are evaluated by the native multigrid solver.");
+        std::vector<storm::storage::sparse::state_type> scheduler =
+            this->hasInitialScheduler() ? this->getInitialScheduler() : std::vector<storm::storage::sparse::state_type>(this->A->getRowGroupCount());
+        return performPolicyIteration(createMultigridEnvironment(env), dir, x, b, std::move(scheduler));
+    }
+}
+
 template<typename ValueType, typename SolutionType>
 bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquationsRationalSearch(Environment const& env, OptimizationDirection dir,
                                                                                                 std::vector<SolutionType>& x,
@@ -699,7 +1059,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         return false;
     } else {
         // Set up two value iteration operators. One for exact and one for imprecise computations
-        setUpViOperator();
+        setUpViOperator(env.solver().getNumberOfThreads(), env.solver().multiplier().isCompressedValuesSet());
         std::shared_ptr<helper::ValueIterationOperator<storm::RationalNumber, false>> exactOp;
         std::shared_ptr<helper::ValueIterationOperator<double, false>> impreciseOp;
         std::function<bool(uint64_t, uint64_t)> fixedChoicesCallback;
@@ -755,6 +1115,8 @@ template<typename ValueType, typename SolutionType>
 void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::clearCache() const {
     auxiliaryRowGroupVector.reset();
     viOperator.reset();
+    prioritizedViHelper.reset();
+    distributedViHelper.reset();
     StandardMinMaxLinearEquationSolver<ValueType, SolutionType>::clearCache();
 }
 
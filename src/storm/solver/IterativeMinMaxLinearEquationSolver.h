@@ -17,6 +17,13 @@ class Environment;
 
 namespace solver {
 
+namespace helper {
+template<typename ValueType>
+class PrioritizedValueIterationHelper;
+template<bool TrivialRowGrouping>
+class DistributedValueIterationHelper;
+}
+
 template<typename ValueType, typename SolutionType = ValueType>
 class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationSolver<ValueType, SolutionType> {
    public:
@@ -42,6 +49,14 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
     bool solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver,
                                     std::vector<uint64_t> const& scheduler, std::vector<SolutionType>& x, std::vector<ValueType>& subB,
                                     std::vector<ValueType> const& originalB) const;
+    /*!
+     * Changes the rows of the given changed row groups in the given matrix (that is induced by some scheduler as in selectRowsFromRowGroups) to the rows
+     * selected by the given scheduler. This is only possible if the number of entries of these rows does not change.
+     *
+     * @return False if the rows could not be changed in place. The matrix then remains unchanged.
+     */
+    bool patchInducedMatrix(storm::storage::SparseMatrix<ValueType>& inducedMatrix, std::vector<uint64_t> const& scheduler,
+                            std::vector<uint64_t> const& changedRowGroups, bool convertToEquationSystem) const;
     bool solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b) const;
     bool performPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b,
                                 std::vector<storm::storage::sparse::state_type>&& initialPolicy) const;
@@ -54,11 +69,14 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
                                          std::vector<ValueType> const& b) const;
     bool solveEquationsSoundValueIteration(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x,
                                            std::vector<ValueType> const& b) const;
+    bool solveEquationsPrioritizedValueIteration(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x,
+                                                 std::vector<ValueType> const& b) const;
     bool solveEquationsViToPi(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b) const;
+    bool solveEquationsMultigrid(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b) const;
 
     bool solveEquationsRationalSearch(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b) const;
 
-    void setUpViOperator() const;
+    void setUpViOperator(uint64_t numberOfThreads = 1, bool compressValues = false, bool asynchronousUpdates = false) const;
     void extractScheduler(std::vector<SolutionType>& x, std::vector<ValueType> const& b, OptimizationDirection const& dir, bool robust,
                           bool updateX = true) const;
 
@@ -70,6 +88,8 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
     // possibly cached data
     mutable std::shared_ptr<storm::solver::helper::ValueIterationOperator<ValueType, false, SolutionType>> viOperator;
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector;  // A.rowGroupCount() entries
+    mutable std::shared_ptr<storm::solver::helper::PrioritizedValueIterationHelper<ValueType>> prioritizedViHelper;
+    mutable std::shared_ptr<storm::solver::helper::DistributedValueIterationHelper<false>> distributedViHelper;
 };
 
 }  // namespace solver
@@ -17,6 +17,7 @@
 
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -29,6 +30,11 @@ LinearEquationSolver<ValueType>::LinearEquationSolver() : cachingEnabled(false)
 
 template<typename ValueType>
 bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    storm::utility::ProfilerPhase phase("solve");
+    phase.addCounter("rows", b.size());
+    phase.addCounter("columns", x.size());
+    this->startObservingIterations(env.solver().getIterationObserver());
+    this->clearAbortedSolveBounds();
     return this->internalSolveEquations(env, x, b);
 }
 
@@ -1,5 +1,7 @@
 #include "storm/solver/LpMinMaxLinearEquationSolver.h"
 
+#include <optional>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnexpectedException.h"
@@ -41,9 +43,10 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
     // Set up the LP solver
     std::unique_ptr<storm::solver::LpSolver<ValueType>> solver = lpSolverFactory->create("");
     solver->setOptimizationDirection(invert(dir));
-    // Create a variable for each row group
+    // Create a variable for each row group. Row groups whose value is already fixed by the bounds get a constant instead.
     std::vector<storm::expressions::Expression> variableExpressions;
     variableExpressions.reserve(this->A->getRowGroupCount());
+    std::vector<std::optional<ValueType>> fixedValues(this->A->getRowGroupCount());
     for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
         if (this->hasLowerBound()) {
             ValueType lowerBound = this->getLowerBound(rowGroup);
@@ -53,6 +56,7 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
                     // Some solvers (like glpk) don't support variables with bounds [x,x]. We therefore just use a constant instead. This should be more
                     // efficient anyways.
                     variableExpressions.push_back(solver->getConstant(lowerBound));
+                    fixedValues[rowGroup] = lowerBound;
                 } else {
                     STORM_LOG_ASSERT(lowerBound <= upperBound,
                                      "Lower Bound at row group " << rowGroup << " is " << lowerBound << " which exceeds the upper bound " << upperBound << ".");
@@ -74,8 +78,15 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
     }
     solver->update();
 
-    // Add a constraint for each row
+    // Add a constraint for each row.
+    // The constraints of row groups with a fixed value (e.g. states whose value is already known from the bounds) are satisfied by every solution and can
+    // thus be skipped. Entries of fixed row groups are added to the constant part of a constraint.
+    uint64_t numberOfFixedRowGroups = 0;
     for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
+        if (fixedValues[rowGroup]) {
+            ++numberOfFixedRowGroups;
+            continue;
+        }
         // The rowgroup refers to the state number
         uint64_t rowIndex, rowGroupEnd;
         if (this->choiceFixedForRowGroup && this->choiceFixedForRowGroup.get()[rowGroup]) {
@@ -89,10 +100,18 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
             auto row = this->A->getRow(rowIndex);
             std::vector<storm::expressions::Expression> summands;
             summands.reserve(1 + row.getNumberOfEntries());
-            summands.push_back(solver->getConstant(b[rowIndex]));
+            ValueType constantPart = b[rowIndex];
             for (auto const& entry : row) {
-                summands.push_back(solver->getConstant(entry.getValue()) * variableExpressions[entry.getColumn()]);
+                if (storm::utility::isZero(entry.getValue())) {
+                    continue;
+                }
+                if (auto const& fixedValue = fixedValues[entry.getColumn()]) {
+                    constantPart += entry.getValue() * *fixedValue;
+                } else {
+                    summands.push_back(solver->getConstant(entry.getValue()) * variableExpressions[entry.getColumn()]);
+                }
             }
+            summands.push_back(solver->getConstant(constantPart));
             storm::expressions::Expression rowConstraint = storm::expressions::sum(summands);
             if (minimize(dir)) {
                 rowConstraint = variableExpressions[rowGroup] <= rowConstraint;
@@ -103,11 +122,16 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
         }
     }
 
-    // Invoke optimization
-    solver->optimize();
-    STORM_LOG_THROW(!solver->isInfeasible(), storm::exceptions::UnexpectedException, "The MinMax equation system is infeasible.");
-    STORM_LOG_THROW(!solver->isUnbounded(), storm::exceptions::UnexpectedException, "The MinMax equation system is unbounded.");
-    STORM_LOG_THROW(solver->isOptimal(), storm::exceptions::UnexpectedException, "Unable to find optimal solution for MinMax equation system.");
+    STORM_LOG_DEBUG("Skipped the constraints of " << numberOfFixedRowGroups << " of " << this->A->getRowGroupCount()
+                                                  << " row groups whose value is fixed by the bounds.");
+
+    // Invoke optimization (unless all values are fixed)
+    if (numberOfFixedRowGroups < this->A->getRowGroupCount()) {
+        solver->optimize();
+        STORM_LOG_THROW(!solver->isInfeasible(), storm::exceptions::UnexpectedException, "The MinMax equation system is infeasible.");
+        STORM_LOG_THROW(!solver->isUnbounded(), storm::exceptions::UnexpectedException, "The MinMax equation system is unbounded.");
+        STORM_LOG_THROW(solver->isOptimal(), storm::exceptions::UnexpectedException, "Unable to find optimal solution for MinMax equation system.");
+    }
 
     // write the solution into the solution vector
     STORM_LOG_ASSERT(x.size() == variableExpressions.size(), "Dimension of x-vector does not match number of varibales.");
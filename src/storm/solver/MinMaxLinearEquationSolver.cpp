@@ -9,12 +9,14 @@
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/storage/Scheduler.h"
 
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/macros.h"
 
 namespace storm::solver {
@@ -36,6 +38,11 @@ bool MinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquations(Environ
     STORM_LOG_WARN_COND_DEBUG(this->isRequirementsCheckedSet(),
                               "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements "
                               "as checked (if applicable).");
+    storm::utility::ProfilerPhase phase("solve");
+    phase.addCounter("rows", b.size());
+    phase.addCounter("columns", x.size());
+    this->startObservingIterations(env.solver().getIterationObserver());
+    this->clearAbortedSolveBounds();
     return internalSolveEquations(env, d, x, b);
 }
 
@@ -239,7 +246,7 @@ std::unique_ptr<MinMaxLinearEquationSolver<ValueType, SolutionType>> GeneralMinM
         auto method = env.solver().minMax().getMethod();
         if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
             method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::OptimisticValueIteration ||
-            method == MinMaxMethod::ViToPi) {
+            method == MinMaxMethod::ViToPi || method == MinMaxMethod::PrioritizedValueIteration || method == MinMaxMethod::Multigrid) {
             result = std::make_unique<IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>>(
                 std::make_unique<GeneralLinearEquationSolverFactory<ValueType>>());
         } else if (method == MinMaxMethod::Topological) {
@@ -263,7 +270,7 @@ std::unique_ptr<MinMaxLinearEquationSolver<storm::RationalNumber>> GeneralMinMax
     auto method = env.solver().minMax().getMethod();
     if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
         method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::OptimisticValueIteration ||
-        method == MinMaxMethod::ViToPi) {
+        method == MinMaxMethod::ViToPi || method == MinMaxMethod::PrioritizedValueIteration || method == MinMaxMethod::Multigrid) {
         result = std::make_unique<IterativeMinMaxLinearEquationSolver<storm::RationalNumber>>(
             std::make_unique<GeneralLinearEquationSolverFactory<storm::RationalNumber>>());
     } else if (method == MinMaxMethod::LinearProgramming) {
@@ -2,16 +2,25 @@
 
 #include <limits>
 
+#include "storm-config.h"
+
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/solver/helper/DistributedValueIterationHelper.h"
 #include "storm/solver/helper/IntervalterationHelper.h"
+#include "storm/solver/helper/KrylovSolverHelper.h"
+#include "storm/solver/helper/MultigridSolverHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 #include "storm/solver/helper/RationalSearchHelper.h"
+#include "storm/solver/helper/SolverCheckpoint.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/solver/multiplier/CudaMultiplier.h"
 #include "storm/solver/multiplier/Multiplier.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/NumberTraits.h"
@@ -52,11 +61,14 @@ void NativeLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatr
 }
 
 template<typename ValueType>
-void NativeLinearEquationSolver<ValueType>::setUpViOperator() const {
+void NativeLinearEquationSolver<ValueType>::setUpViOperator(uint64_t numberOfThreads, bool compressValues) const {
     if (!viOperator) {
         viOperator = std::make_shared<helper::ValueIterationOperator<ValueType, true>>();
+        viOperator->setCompressedValues(compressValues);
         viOperator->setMatrixBackwards(*this->A);
     }
+    viOperator->setCompressedValues(compressValues);
+    viOperator->setNumberOfThreads(numberOfThreads);
 }
 
 template<typename ValueType>
@@ -144,10 +156,10 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsJacobi(Environment con
         // Compute D^-1 * (b - LU * x) and store result in nextX.
         jacobiDecomposition->multiplier->multiply(env, *currentX, nullptr, *nextX);
         storm::utility::vector::subtractVectors(b, *nextX, *nextX);
-        storm::utility::vector::multiplyVectorsPointwise(jacobiDecomposition->DVector, *nextX, *nextX);
 
-        // Now check if the process already converged within our precision.
-        if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *nextX, precision, relative)) {
+        // Apply D^-1 and check in the same pass whether the process already converged within our precision.
+        if (storm::utility::vector::applyPointwiseAndCheckConvergence(jacobiDecomposition->DVector, *nextX, *nextX, *currentX, precision, relative,
+                                                                      std::multiplies<>())) {
             status = SolverStatus::Converged;
         }
         // Swap the two pointers as a preparation for the next iteration.
@@ -177,6 +189,97 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsJacobi(Environment con
     return status == SolverStatus::Converged;
 }
 
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::solveEquationsKrylov(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                                 NativeLinearEquationSolverMethod method) const {
+    STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (" << toString(method) << ", preconditioner "
+                                                      << toString(env.solver().native().getPreconditioner()) << ")");
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (!krylovHelper) {
+            krylovHelper = std::make_shared<helper::KrylovSolverHelper<ValueType>>(*A, env.solver().native().getPreconditioner(),
+                                                                                  env.solver().getNumberOfThreads());
+        }
+
+        uint64_t numIterations = 0;
+        uint64_t const maxIter = env.solver().native().getMaximalNumberOfIterations();
+        auto callback = [&](SolverStatus const& current) {
+            this->showProgressIterative(numIterations);
+            return this->updateStatus(current, x, SolverGuarantee::None, numIterations, maxIter);
+        };
+        bool const relative = env.solver().native().getRelativeTerminationCriterion();
+        ValueType const precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+        this->startMeasureProgress();
+        SolverStatus status;
+        if (method == NativeLinearEquationSolverMethod::Bicgstab) {
+            status = krylovHelper->bicgstab(x, b, numIterations, relative, precision, maxIter, callback);
+        } else {
+            STORM_LOG_ASSERT(method == NativeLinearEquationSolverMethod::Gmres, "Unexpected Krylov method.");
+            status = krylovHelper->gmres(x, b, numIterations, relative, precision, maxIter, env.solver().native().getRestartThreshold(), callback);
+        }
+
+        if (!this->isCachingEnabled()) {
+            clearCache();
+        }
+        this->reportStatus(status, numIterations);
+        return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "The method " << toString(method) << " is only supported for double precision values.");
+        return false;
+    }
+}
+
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::solveEquationsMultigrid(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Multigrid)");
+    if (!multigridHelper) {
+        multigridHelper = std::make_shared<helper::MultigridSolverHelper<ValueType>>(*A);
+    }
+
+    uint64_t numIterations = 0;
+    uint64_t const maxIter = env.solver().native().getMaximalNumberOfIterations();
+    bool const relative = env.solver().native().getRelativeTerminationCriterion();
+    ValueType const precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+    this->startMeasureProgress();
+    SolverStatus status;
+    if (env.solver().isForceSoundness()) {
+        std::optional<std::vector<ValueType>> lowerBounds, upperBounds;
+        if (this->hasLowerBound()) {
+            lowerBounds.emplace(x.size());
+            this->createLowerBoundsVector(*lowerBounds);
+        }
+        if (this->hasUpperBound()) {
+            upperBounds.emplace(x.size());
+            this->createUpperBoundsVector(*upperBounds);
+        }
+        auto callback = [&](SolverStatus const& current, std::vector<ValueType> const& lower, std::vector<ValueType> const& upper) {
+            this->showProgressIterative(numIterations);
+            this->observeBounds(lower, upper);
+            bool terminateEarly = this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(lower, SolverGuarantee::LessOrEqual) &&
+                                  this->getTerminationCondition().terminateNow(upper, SolverGuarantee::GreaterOrEqual);
+            auto newStatus = this->updateStatus(current, terminateEarly, numIterations, maxIter);
+            if (newStatus == SolverStatus::Aborted) {
+                // Keep the current bounds, so that an anytime result can be reported.
+                this->setAbortedSolveBounds(lower, upper);
+            }
+            return newStatus;
+        };
+        status = multigridHelper->solveSound(x, b, numIterations, relative, precision, maxIter, lowerBounds, upperBounds, callback);
+    } else {
+        auto callback = [&](SolverStatus const& current) {
+            this->showProgressIterative(numIterations);
+            return this->updateStatus(current, x, SolverGuarantee::None, numIterations, maxIter);
+        };
+        status = multigridHelper->solve(x, b, numIterations, relative, precision, maxIter, callback);
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+    this->reportStatus(status, numIterations);
+    return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+}
+
 template<typename ValueType>
 NativeLinearEquationSolver<ValueType>::WalkerChaeData::WalkerChaeData(Environment const& env, storm::storage::SparseMatrix<ValueType> const& originalMatrix,
                                                                       std::vector<ValueType> const& originalB)
@@ -359,8 +462,45 @@ typename NativeLinearEquationSolver<ValueType>::PowerIterationResult NativeLinea
 template<typename ValueType>
 bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Power)");
+#ifdef STORM_HAVE_CUDA
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (env.solver().multiplier().getType() == MultiplierType::Cuda && !this->hasCustomTerminationCondition() &&
+            env.solver().native().getPowerMethodMultiplicationStyle() == MultiplicationStyle::Regular && CudaMultiplier<ValueType>::isSupported(*this->A)) {
+            // The matrix stays on the device during the whole iteration, so only a convergence flag is transferred per iteration.
+            CudaMultiplier<ValueType> deviceMultiplier(*this->A);
+            uint64_t numIterations{0};
+            this->startMeasureProgress();
+            auto status = deviceMultiplier.iterate(std::nullopt, x, &b, storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()),
+                                                   env.solver().native().getRelativeTerminationCriterion(),
+                                                   env.solver().native().getMaximalNumberOfIterations(), numIterations);
+            this->reportStatus(status, numIterations);
+            return status == SolverStatus::Converged;
+        }
+    }
+#endif
+    if constexpr (std::is_same_v<ValueType, double>) {
+        // Distributed value iteration decides convergence jointly for all processes, which is why custom termination conditions are not supported.
+        STORM_LOG_WARN_COND(!env.solver().isDistributedSet() || !this->hasCustomTerminationCondition(),
+                            "Value iteration is not distributed for this equation system.");
+        if (env.solver().isDistributedSet() && !this->hasCustomTerminationCondition()) {
+            if (!distributedViHelper) {
+                distributedViHelper = std::make_shared<helper::DistributedValueIterationHelper<true>>(
+                    *this->A, env.solver().getDistributedStatePartitioning(), env.solver().getNumberOfThreads());
+            }
+            uint64_t numIterations{0};
+            this->startMeasureProgress();
+            auto status = distributedViHelper->VI(x, b, numIterations, env.solver().native().getRelativeTerminationCriterion(),
+                                                  storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()), {},
+                                                  env.solver().native().getMaximalNumberOfIterations());
+            this->reportStatus(status, numIterations);
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            return status == SolverStatus::Converged;
+        }
+    }
     // Prepare the solution vectors.
-    setUpViOperator();
+    setUpViOperator(env.solver().getNumberOfThreads(), env.solver().multiplier().isCompressedValuesSet());
 
     SolverGuarantee guarantee = SolverGuarantee::None;
     if (this->hasCustomTerminationCondition()) {
@@ -375,14 +515,49 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment cons
 
     storm::solver::helper::ValueIterationHelper<ValueType, true> viHelper(viOperator);
     uint64_t numIterations{0};
+    // Resume an interrupted solve (if any). As the stored iterate was obtained from the same initial values, it maintains the same guarantee.
+    auto checkpoint = helper::createSolverCheckpoint<ValueType, ValueType>(env, "vi", *this->A, b);
+    if (checkpoint && checkpoint->restore(1)) {
+        x = std::move(checkpoint->getVector(0));
+        numIterations = checkpoint->getIterations();
+    }
     auto viCallback = [&](SolverStatus const& current) {
         this->showProgressIterative(numIterations);
+        if (checkpoint) {
+            checkpoint->storeIfDue(numIterations, {&x});
+        }
         return this->updateStatus(current, x, guarantee, numIterations, env.solver().native().getMaximalNumberOfIterations());
     };
     this->startMeasureProgress();
-    auto status = viHelper.VI(x, b, numIterations, env.solver().native().getRelativeTerminationCriterion(),
-                              storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()), {}, viCallback,
-                              env.solver().native().getPowerMethodMultiplicationStyle());
+    bool const relative = env.solver().native().getRelativeTerminationCriterion();
+    ValueType const precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+    auto status = SolverStatus::InProgress;
+    if (env.solver().native().isMixedPrecisionSet()) {
+        // Rounding the matrix entries can move the iterates past the solution, so this is only done if no guarantee has to be maintained.
+        STORM_LOG_WARN_COND(guarantee == SolverGuarantee::None, "Mixed precision is not used as the iteration has to maintain a guarantee.");
+        STORM_LOG_WARN_COND((std::is_same_v<ValueType, double>), "Mixed precision is only supported for double precision models.");
+        if constexpr (std::is_same_v<ValueType, double>) {
+            if (guarantee == SolverGuarantee::None) {
+                // Iterate with single precision matrix entries until the (perturbed) fixpoint is approximated as closely as single precision allows.
+                // The result is then refined with the exact matrix entries, which typically only takes a few more iterations.
+                viOperator->setSinglePrecisionValues(true);
+                auto singlePrecisionCallback = [&](SolverStatus const& current) {
+                    this->showProgressIterative(numIterations);
+                    if (checkpoint) {
+                        checkpoint->storeIfDue(numIterations, {&x});
+                    }
+                    return this->updateStatus(current, false, numIterations, env.solver().native().getMaximalNumberOfIterations());
+                };
+                status = viHelper.VI(x, b, numIterations, relative, std::max<ValueType>(precision, std::numeric_limits<float>::epsilon()), {},
+                                     singlePrecisionCallback, env.solver().native().getPowerMethodMultiplicationStyle());
+                viOperator->setSinglePrecisionValues(false);
+                STORM_LOG_INFO("Performed " << numIterations << " iterations with single precision matrix entries.");
+            }
+        }
+    }
+    if (status == SolverStatus::InProgress || status == SolverStatus::Converged) {
+        status = viHelper.VI(x, b, numIterations, relative, precision, {}, viCallback, env.solver().native().getPowerMethodMultiplicationStyle());
+    }
 
     this->reportStatus(status, numIterations);
 
@@ -424,18 +599,45 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
     STORM_LOG_THROW(this->hasLowerBound(), storm::exceptions::UnmetRequirementException, "Solver requires lower bound, but none was given.");
     STORM_LOG_THROW(this->hasUpperBound(), storm::exceptions::UnmetRequirementException, "Solver requires upper bound, but none was given.");
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (IntervalIteration)");
-    setUpViOperator();
+    setUpViOperator(env.solver().getNumberOfThreads(), env.solver().multiplier().isCompressedValuesSet());
     helper::IntervalIterationHelper<ValueType, true> iiHelper(viOperator);
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
-    auto lowerBoundsCallback = [&](std::vector<ValueType>& vector) { this->createLowerBoundsVector(vector); };
-    auto upperBoundsCallback = [&](std::vector<ValueType>& vector) { this->createUpperBoundsVector(vector); };
-
     uint64_t numIterations{0};
+    // Resume an interrupted solve (if any) from the stored lower and upper bounds.
+    auto checkpoint = helper::createSolverCheckpoint<ValueType, ValueType>(env, "ii", *this->A, b);
+    bool const restored = checkpoint && checkpoint->restore(2);
+    if (restored) {
+        numIterations = checkpoint->getIterations();
+    }
+    auto lowerBoundsCallback = [&](std::vector<ValueType>& vector) {
+        if (restored) {
+            vector = std::move(checkpoint->getVector(0));
+        } else {
+            this->createLowerBoundsVector(vector);
+        }
+    };
+    auto upperBoundsCallback = [&](std::vector<ValueType>& vector) {
+        if (restored) {
+            vector = std::move(checkpoint->getVector(1));
+        } else {
+            this->createUpperBoundsVector(vector);
+        }
+    };
+
     auto iiCallback = [&](helper::IIData<ValueType> const& data) {
         this->showProgressIterative(numIterations);
+        this->observeBounds(data.x, data.y);
+        if (checkpoint) {
+            checkpoint->storeIfDue(numIterations, {&data.x, &data.y});
+        }
         bool terminateEarly = this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(data.x, SolverGuarantee::LessOrEqual) &&
                               this->getTerminationCondition().terminateNow(data.y, SolverGuarantee::GreaterOrEqual);
-        return this->updateStatus(data.status, terminateEarly, numIterations, env.solver().native().getMaximalNumberOfIterations());
+        auto status = this->updateStatus(data.status, terminateEarly, numIterations, env.solver().native().getMaximalNumberOfIterations());
+        if (status == SolverStatus::Aborted) {
+            // Keep the current bounds, so that an anytime result can be reported.
+            this->setAbortedSolveBounds(data.x, data.y);
+        }
+        return status;
     };
     std::optional<storm::storage::BitVector> optionalRelevantValues;
     if (this->hasRelevantValues()) {
@@ -467,15 +669,27 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(En
         upperBound = this->getUpperBound(true);
     }
 
-    setUpViOperator();
+    setUpViOperator(env.solver().getNumberOfThreads(), env.solver().multiplier().isCompressedValuesSet());
 
     auto precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
     uint64_t numIterations{0};
     auto sviCallback = [&](typename helper::SoundValueIterationHelper<ValueType, true>::SVIData const& current) {
         this->showProgressIterative(numIterations);
-        return this->updateStatus(current.status,
-                                  this->hasCustomTerminationCondition() && current.checkCustomTerminationCondition(this->getTerminationCondition()),
-                                  numIterations, env.solver().native().getMaximalNumberOfIterations());
+        if (this->isObservingIterations() && current.a && current.b) {
+            std::vector<ValueType> lower(x.size()), upper(x.size());
+            current.trySetLowerUpper(lower, upper);
+            this->observeBounds(lower, upper);
+        }
+        auto status = this->updateStatus(current.status,
+                                         this->hasCustomTerminationCondition() && current.checkCustomTerminationCondition(this->getTerminationCondition()),
+                                         numIterations, env.solver().native().getMaximalNumberOfIterations());
+        if (status == SolverStatus::Aborted && current.a && current.b) {
+            // Keep the current bounds, so that an anytime result can be reported.
+            std::vector<ValueType> lower(x.size()), upper(x.size());
+            current.trySetLowerUpper(lower, upper);
+            this->setAbortedSolveBounds(lower, upper);
+        }
+        return status;
     };
     std::optional<storm::storage::BitVector> optionalRelevantValues;
     if (this->hasRelevantValues()) {
@@ -504,9 +718,9 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIterati
         return true;
     }
 
-    setUpViOperator();
+    setUpViOperator(env.solver().getNumberOfThreads(), env.solver().multiplier().isCompressedValuesSet());
 
-    helper::OptimisticValueIterationHelper<ValueType, true> oviHelper(viOperator);
+    helper::OptimisticValueIterationHelper<ValueType, true> oviHelper(viOperator, env.solver().ovi().isAdaptiveSet());
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
     std::optional<ValueType> lowerBound, upperBound;
     if (this->hasLowerBound()) {
@@ -518,6 +732,8 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIterati
     uint64_t numIterations{0};
     auto oviCallback = [&](SolverStatus const& current, std::vector<ValueType> const& v) {
         this->showProgressIterative(numIterations);
+        auto const& statistics = oviHelper.getStatistics();
+        this->observeVerificationPhases(statistics.inVerificationPhase, statistics.numberOfVerificationPhases, statistics.numberOfFailedVerificationPhases);
         return this->updateStatus(current, v, SolverGuarantee::LessOrEqual, numIterations, env.solver().native().getMaximalNumberOfIterations());
     };
     this->createLowerBoundsVector(x);
@@ -526,7 +742,8 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIterati
         guessingFactor = storm::utility::convertNumber<ValueType>(*env.solver().ovi().getUpperBoundGuessingFactor());
     }
     this->startMeasureProgress();
-    auto status = oviHelper.OVI(x, b, env.solver().native().getRelativeTerminationCriterion(), prec, {}, guessingFactor, lowerBound, upperBound, oviCallback);
+    auto status = oviHelper.OVI(x, b, numIterations, env.solver().native().getRelativeTerminationCriterion(), prec, {}, guessingFactor, lowerBound,
+                                upperBound, oviCallback);
     this->reportStatus(status, numIterations);
 
     if (!this->isCachingEnabled()) {
@@ -540,7 +757,7 @@ template<typename ValueType>
 bool NativeLinearEquationSolver<ValueType>::solveEquationsRationalSearch(Environment const& env, std::vector<ValueType>& x,
                                                                          std::vector<ValueType> const& b) const {
     // Set up two value iteration operators. One for exact and one for imprecise computations
-    setUpViOperator();
+    setUpViOperator(env.solver().getNumberOfThreads(), env.solver().multiplier().isCompressedValuesSet());
     std::shared_ptr<helper::ValueIterationOperator<storm::RationalNumber, true>> exactOp;
     std::shared_ptr<helper::ValueIterationOperator<double, true>> impreciseOp;
 
@@ -588,7 +805,7 @@ NativeLinearEquationSolverMethod NativeLinearEquationSolver<ValueType>::getMetho
         }
     } else if (env.solver().isForceSoundness() && method != NativeLinearEquationSolverMethod::SoundValueIteration &&
                method != NativeLinearEquationSolverMethod::OptimisticValueIteration && method != NativeLinearEquationSolverMethod::IntervalIteration &&
-               method != NativeLinearEquationSolverMethod::RationalSearch) {
+               method != NativeLinearEquationSolverMethod::RationalSearch && method != NativeLinearEquationSolverMethod::Multigrid) {
         if (env.solver().native().isMethodSetFromDefault()) {
             method = NativeLinearEquationSolverMethod::OptimisticValueIteration;
             STORM_LOG_INFO(
@@ -603,7 +820,8 @@ NativeLinearEquationSolverMethod NativeLinearEquationSolver<ValueType>::getMetho
 
 template<typename ValueType>
 bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
-    switch (getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact())) {
+    auto const method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
+    switch (method) {
         case NativeLinearEquationSolverMethod::SOR:
             return this->solveEquationsSOR(env, x, b, storm::utility::convertNumber<ValueType>(env.solver().native().getSorOmega()));
         case NativeLinearEquationSolverMethod::GaussSeidel:
@@ -622,6 +840,11 @@ bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment c
             return this->solveEquationsIntervalIteration(env, x, b);
         case NativeLinearEquationSolverMethod::RationalSearch:
             return this->solveEquationsRationalSearch(env, x, b);
+        case NativeLinearEquationSolverMethod::Bicgstab:
+        case NativeLinearEquationSolverMethod::Gmres:
+            return this->solveEquationsKrylov(env, x, b, method);
+        case NativeLinearEquationSolverMethod::Multigrid:
+            return this->solveEquationsMultigrid(env, x, b);
     }
     STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unknown solving technique.");
     return false;
@@ -632,7 +855,7 @@ LinearEquationSolverProblemFormat NativeLinearEquationSolver<ValueType>::getEqua
     auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
     if (method == NativeLinearEquationSolverMethod::Power || method == NativeLinearEquationSolverMethod::SoundValueIteration ||
         method == NativeLinearEquationSolverMethod::OptimisticValueIteration || method == NativeLinearEquationSolverMethod::RationalSearch ||
-        method == NativeLinearEquationSolverMethod::IntervalIteration) {
+        method == NativeLinearEquationSolverMethod::IntervalIteration || method == NativeLinearEquationSolverMethod::Multigrid) {
         return LinearEquationSolverProblemFormat::FixedPointSystem;
     } else {
         return LinearEquationSolverProblemFormat::EquationSystem;
@@ -659,6 +882,9 @@ void NativeLinearEquationSolver<ValueType>::clearCache() const {
     walkerChaeData.reset();
     multiplier.reset();
     viOperator.reset();
+    distributedViHelper.reset();
+    krylovHelper.reset();
+    multigridHelper.reset();
     LinearEquationSolver<ValueType>::clearCache();
 }
 
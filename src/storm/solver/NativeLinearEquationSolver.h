@@ -18,6 +18,15 @@ class Environment;
 
 namespace solver {
 
+namespace helper {
+template<bool TrivialRowGrouping>
+class DistributedValueIterationHelper;
+template<typename ValueType>
+class KrylovSolverHelper;
+template<typename ValueType>
+class MultigridSolverHelper;
+}
+
 /*!
  * A class that uses storm's native matrix operations to implement the LinearEquationSolver interface.
  */
@@ -72,8 +81,11 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
     virtual bool solveEquationsOptimisticValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsRationalSearch(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    virtual bool solveEquationsKrylov(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                      NativeLinearEquationSolverMethod method) const;
+    virtual bool solveEquationsMultigrid(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
-    void setUpViOperator() const;
+    void setUpViOperator(uint64_t numberOfThreads = 1, bool compressValues = false) const;
 
     // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
     // when the solver is destructed.
@@ -84,6 +96,9 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
     storm::storage::SparseMatrix<ValueType> const* A;
 
     mutable std::shared_ptr<storm::solver::helper::ValueIterationOperator<ValueType, true>> viOperator;
+    mutable std::shared_ptr<storm::solver::helper::DistributedValueIterationHelper<true>> distributedViHelper;
+    mutable std::shared_ptr<storm::solver::helper::KrylovSolverHelper<ValueType>> krylovHelper;
+    mutable std::shared_ptr<storm::solver::helper::MultigridSolverHelper<ValueType>> multigridHelper;
 
     // An object to dispatch all multiplication operations.
     mutable std::unique_ptr<Multiplier<ValueType>> multiplier;
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+namespace storm {
+namespace solver {
+
+/*!
+ * Information about a single iteration of an iterative solver that is passed to a SolverIterationObserver.
+ */
+struct SolverIterationInfo {
+    // The number of iterations performed so far by the solver.
+    uint64_t iteration = 0;
+    // The time that passed since the solver started.
+    double elapsedSeconds = 0;
+    // The largest absolute difference between the current and the previously observed iterate (if the solver exposes its iterates).
+    std::optional<double> residual;
+    // The number of entries that changed compared to the previously observed iterate (if the solver exposes its iterates).
+    std::optional<uint64_t> numberOfUpdatedStates;
+    // The largest difference between the current upper and lower bound (for sound methods such as interval iteration and sound value iteration).
+    std::optional<double> boundsGap;
+    // For optimistic value iteration: whether the iteration belongs to a verification phase (in which a guessed upper bound is checked) as well as the
+    // number of verification phases that were started and that failed so far.
+    std::optional<bool> inVerificationPhase;
+    std::optional<uint64_t> numberOfVerificationPhases;
+    std::optional<uint64_t> numberOfFailedVerificationPhases;
+};
+
+/*!
+ * A callback that is invoked after each iteration of an iterative solver. If the callback returns false, the solver aborts.
+ * Observers are installed via SolverEnvironment::setIterationObserver. Computing the residual and bounds gap takes one additional pass over the values
+ * per iteration, which is only done if an observer is installed.
+ */
+typedef std::function<bool(SolverIterationInfo const&)> SolverIterationObserver;
+
+}  // namespace solver
+}  // namespace storm
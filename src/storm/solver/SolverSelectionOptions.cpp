@@ -24,6 +24,10 @@ std::string toString(MinMaxMethod m) {
             return "vi-to-pi";
         case MinMaxMethod::Acyclic:
             return "vi-to-pi";
+        case MinMaxMethod::PrioritizedValueIteration:
+            return "prioritizedvalueiteration";
+        case MinMaxMethod::Multigrid:
+            return "multigrid";
     }
     return "invalid";
 }
@@ -34,6 +38,10 @@ std::string toString(MultiplierType t) {
             return "Native";
         case MultiplierType::Gmmxx:
             return "Gmmxx";
+        case MultiplierType::Simd:
+            return "Simd";
+        case MultiplierType::Cuda:
+            return "Cuda";
     }
     return "invalid";
 }
@@ -72,6 +80,18 @@ std::string toString(MaBoundedReachabilityMethod m) {
     return "invalid";
 }
 
+std::string toString(CtmcTransientMethod m) {
+    switch (m) {
+        case CtmcTransientMethod::Automatic:
+            return "auto";
+        case CtmcTransientMethod::Uniformization:
+            return "uniformization";
+        case CtmcTransientMethod::Krylov:
+            return "krylov";
+    }
+    return "invalid";
+}
+
 std::string toString(LpSolverType t) {
     switch (t) {
         case LpSolverType::Gurobi:
@@ -134,6 +154,24 @@ std::string toString(NativeLinearEquationSolverMethod t) {
             return "IntervalIteration";
         case NativeLinearEquationSolverMethod::RationalSearch:
             return "RationalSearch";
+        case NativeLinearEquationSolverMethod::Bicgstab:
+            return "BiCGSTAB";
+        case NativeLinearEquationSolverMethod::Gmres:
+            return "GMRES";
+        case NativeLinearEquationSolverMethod::Multigrid:
+            return "Multigrid";
+    }
+    return "invalid";
+}
+
+std::string toString(NativeLinearEquationSolverPreconditioner t) {
+    switch (t) {
+        case NativeLinearEquationSolverPreconditioner::Diagonal:
+            return "diagonal";
+        case NativeLinearEquationSolverPreconditioner::Ilu:
+            return "ilu";
+        case NativeLinearEquationSolverPreconditioner::None:
+            return "none";
     }
     return "invalid";
 }
@@ -6,17 +6,20 @@
 namespace storm {
 namespace solver {
 ExtendEnumsWithSelectionField(MinMaxMethod, ValueIteration, PolicyIteration, LinearProgramming, Topological, RationalSearch, IntervalIteration,
-                              SoundValueIteration, OptimisticValueIteration, ViToPi, Acyclic) ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx)
+                              SoundValueIteration, OptimisticValueIteration, ViToPi, Acyclic, PrioritizedValueIteration, Multigrid)
+    ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx, Simd, Cuda)
     ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration)
         ExtendEnumsWithSelectionField(LraMethod, LinearProgramming, ValueIteration, GainBiasEquations, LraDistributionEquations)
             ExtendEnumsWithSelectionField(MaBoundedReachabilityMethod, Imca, UnifPlus)
+                ExtendEnumsWithSelectionField(CtmcTransientMethod, Automatic, Uniformization, Krylov)
 
                 ExtendEnumsWithSelectionField(LpSolverType, Gurobi, Glpk, Z3, Soplex)
                     ExtendEnumsWithSelectionField(EquationSolverType, Native, Gmmxx, Eigen, Elimination, Topological, Acyclic)
                         ExtendEnumsWithSelectionField(SmtSolverType, Z3, Mathsat)
 
                             ExtendEnumsWithSelectionField(NativeLinearEquationSolverMethod, Jacobi, GaussSeidel, SOR, WalkerChae, Power, SoundValueIteration,
-                                                          OptimisticValueIteration, IntervalIteration, RationalSearch)
+                                                          OptimisticValueIteration, IntervalIteration, RationalSearch, Bicgstab, Gmres, Multigrid)
+                                ExtendEnumsWithSelectionField(NativeLinearEquationSolverPreconditioner, Ilu, Diagonal, None)
                                 ExtendEnumsWithSelectionField(GmmxxLinearEquationSolverMethod, Bicgstab, Qmr, Gmres)
                                     ExtendEnumsWithSelectionField(GmmxxLinearEquationSolverPreconditioner, Ilu, Diagonal, None)
                                         ExtendEnumsWithSelectionField(EigenLinearEquationSolverMethod, SparseLU, Bicgstab, DGmres, Gmres)
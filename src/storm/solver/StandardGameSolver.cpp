@@ -1,5 +1,7 @@
 #include "storm/solver/StandardGameSolver.h"
 
+#include <algorithm>
+
 #include "storm/solver/EigenLinearEquationSolver.h"
 #include "storm/solver/EliminationLinearEquationSolver.h"
 #include "storm/solver/GmmxxLinearEquationSolver.h"
@@ -15,6 +17,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -300,10 +303,6 @@ template<typename ValueType>
 bool StandardGameSolver<ValueType>::solveGameValueIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
                                                             std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<uint64_t>* player1Choices,
                                                             std::vector<uint64_t>* player2Choices) const {
-    if (!multiplierPlayer2Matrix) {
-        multiplierPlayer2Matrix = storm::solver::MultiplierFactory<ValueType>().create(env, player2Matrix);
-    }
-
     if (!auxiliaryP2RowGroupVector) {
         auxiliaryP2RowGroupVector = std::make_unique<std::vector<ValueType>>(player2Matrix.getRowGroupCount());
     }
@@ -351,24 +350,47 @@ bool StandardGameSolver<ValueType>::solveGameValueIteration(Environment const& e
 
     std::vector<ValueType>* newX = auxiliaryP1RowGroupVector.get();
     std::vector<ValueType>* currentX = &x;
+    std::vector<uint64_t>* player1SchedulerChoices =
+        trackSchedulersInValueIteration ? (trackingSchedulersInProvidedStorage ? player1Choices : &this->player1SchedulerChoices.get()) : nullptr;
+    std::vector<uint64_t>* player2SchedulerChoices =
+        trackSchedulersInValueIteration ? (trackingSchedulersInProvidedStorage ? player2Choices : &this->player2SchedulerChoices.get()) : nullptr;
+
+    bool const gaussSeidel = env.solver().game().getMultiplicationStyle() == MultiplicationStyle::GaussSeidel;
+    // If player 1 is represented by a matrix, several player 1 states may share a player 2 state, whose choice must then not be written concurrently.
+    // Distributing the states over threads also only pays off for sufficiently large games.
+    uint64_t numberOfThreads = 1;
+    if (!gaussSeidel && (!trackSchedulersInValueIteration || !this->player1RepresentedByMatrix()) && this->getNumberOfPlayer1States() >= 1000) {
+        numberOfThreads = env.solver().getNumberOfThreads();
+    }
+    bool const useMultiplier = !gaussSeidel && numberOfThreads == 1;
+    if (useMultiplier && !multiplierPlayer2Matrix) {
+        multiplierPlayer2Matrix = storm::solver::MultiplierFactory<ValueType>().create(env, player2Matrix);
+    }
 
     // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
     uint64_t iterations = 0;
 
     SolverStatus status = SolverStatus::InProgress;
     while (status == SolverStatus::InProgress) {
-        multiplyAndReduce(
-            env, player1Dir, player2Dir, *currentX, &b, *multiplierPlayer2Matrix, reducedPlayer2Result, *newX,
-            trackSchedulersInValueIteration ? (trackingSchedulersInProvidedStorage ? player1Choices : &this->player1SchedulerChoices.get()) : nullptr,
-            trackSchedulersInValueIteration ? (trackingSchedulersInProvidedStorage ? player2Choices : &this->player2SchedulerChoices.get()) : nullptr);
+        bool converged;
+        if (useMultiplier) {
+            multiplyAndReduce(env, player1Dir, player2Dir, *currentX, &b, *multiplierPlayer2Matrix, reducedPlayer2Result, *newX, player1SchedulerChoices,
+                              player2SchedulerChoices);
+            converged = storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative);
+        } else {
+            converged = performValueIterationStep(player1Dir, player2Dir, *currentX, *newX, b, gaussSeidel, numberOfThreads, precision, relative,
+                                                  player1SchedulerChoices, player2SchedulerChoices);
+        }
 
         // Determine whether the method converged.
-        if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative)) {
+        if (converged) {
             status = SolverStatus::Converged;
         }
 
         // Update environment variables.
-        std::swap(currentX, newX);
+        if (!gaussSeidel) {
+            std::swap(currentX, newX);
+        }
         ++iterations;
         status = this->updateStatus(status, *currentX, SolverGuarantee::None, iterations, maxIter);
     }
@@ -461,6 +483,97 @@ void StandardGameSolver<ValueType>::multiplyAndReduce(Environment const& env, Op
     }
 }
 
+template<typename ValueType>
+ValueType StandardGameSolver<ValueType>::computePlayer1StateValue(OptimizationDirection player1Dir, OptimizationDirection player2Dir, uint64_t player1State,
+                                                                  std::vector<ValueType> const& x, std::vector<ValueType> const& b,
+                                                                  std::vector<uint64_t>* player1SchedulerChoices,
+                                                                  std::vector<uint64_t>* player2SchedulerChoices) const {
+    auto isBetter = [](OptimizationDirection dir, ValueType const& newValue, ValueType const& oldValue) {
+        return minimize(dir) ? newValue < oldValue : newValue > oldValue;
+    };
+    auto computePlayer2StateValue = [&](uint64_t player2State) {
+        uint64_t const firstRow = player2Matrix.getRowGroupIndices()[player2State];
+        uint64_t const endRow = player2Matrix.getRowGroupIndices()[player2State + 1];
+        ValueType result = player2Matrix.multiplyRowWithVector(firstRow, x) + b[firstRow];
+        uint64_t bestChoice = 0;
+        for (uint64_t row = firstRow + 1; row < endRow; ++row) {
+            ValueType rowValue = player2Matrix.multiplyRowWithVector(row, x) + b[row];
+            if (isBetter(player2Dir, rowValue, result)) {
+                result = std::move(rowValue);
+                bestChoice = row - firstRow;
+            }
+        }
+        if (player2SchedulerChoices) {
+            (*player2SchedulerChoices)[player2State] = bestChoice;
+        }
+        return result;
+    };
+
+    uint64_t numberOfPlayer1Choices;
+    auto getPlayer2Successor = [&](uint64_t player1Choice) -> uint64_t {
+        if (this->player1RepresentedByMatrix()) {
+            return this->getPlayer1Matrix().getRow(player1State, player1Choice).begin()->getColumn();
+        } else {
+            return this->getPlayer1Grouping()[player1State] + player1Choice;
+        }
+    };
+    if (this->player1RepresentedByMatrix()) {
+        numberOfPlayer1Choices = this->getPlayer1Matrix().getRowGroupSize(player1State);
+    } else {
+        numberOfPlayer1Choices = this->getPlayer1Grouping()[player1State + 1] - this->getPlayer1Grouping()[player1State];
+    }
+    STORM_LOG_ASSERT(numberOfPlayer1Choices > 0, "There is a choice of player 1 that does not lead to any player 2 choice");
+
+    ValueType result = computePlayer2StateValue(getPlayer2Successor(0));
+    uint64_t bestChoice = 0;
+    for (uint64_t player1Choice = 1; player1Choice < numberOfPlayer1Choices; ++player1Choice) {
+        ValueType choiceValue = computePlayer2StateValue(getPlayer2Successor(player1Choice));
+        if (isBetter(player1Dir, choiceValue, result)) {
+            result = std::move(choiceValue);
+            bestChoice = player1Choice;
+        }
+    }
+    if (player1SchedulerChoices) {
+        (*player1SchedulerChoices)[player1State] = bestChoice;
+    }
+    return result;
+}
+
+template<typename ValueType>
+bool StandardGameSolver<ValueType>::performValueIterationStep(OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
+                                                              std::vector<ValueType>& newX, std::vector<ValueType> const& b, bool gaussSeidel,
+                                                              uint64_t numberOfThreads, ValueType const& precision, bool relative,
+                                                              std::vector<uint64_t>* player1SchedulerChoices,
+                                                              std::vector<uint64_t>* player2SchedulerChoices) const {
+    uint64_t const numberOfPlayer1States = this->getNumberOfPlayer1States();
+    if (gaussSeidel) {
+        bool converged = true;
+        for (uint64_t player1State = 0; player1State < numberOfPlayer1States; ++player1State) {
+            ValueType value = computePlayer1StateValue(player1Dir, player2Dir, player1State, x, b, player1SchedulerChoices, player2SchedulerChoices);
+            if (converged && !storm::utility::vector::equalModuloPrecision(x[player1State], value, precision, relative)) {
+                converged = false;
+            }
+            x[player1State] = std::move(value);
+        }
+        return converged;
+    }
+
+    // We use char instead of bool so that the threads write to distinct memory locations.
+    std::vector<char> chunkConverged(numberOfThreads, true);
+    uint64_t numberOfChunks = storm::utility::parallel::forEachChunk(
+        numberOfThreads, static_cast<uint64_t>(0), numberOfPlayer1States, [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+            bool converged = true;
+            for (uint64_t player1State = begin; player1State < end; ++player1State) {
+                newX[player1State] = computePlayer1StateValue(player1Dir, player2Dir, player1State, x, b, player1SchedulerChoices, player2SchedulerChoices);
+                if (converged && !storm::utility::vector::equalModuloPrecision(x[player1State], newX[player1State], precision, relative)) {
+                    converged = false;
+                }
+            }
+            chunkConverged[threadIndex] = converged;
+        });
+    return std::all_of(chunkConverged.begin(), chunkConverged.begin() + numberOfChunks, [](char converged) { return converged; });
+}
+
 template<typename ValueType>
 bool StandardGameSolver<ValueType>::extractChoices(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
                                                    std::vector<ValueType> const& x, std::vector<ValueType> const& b,
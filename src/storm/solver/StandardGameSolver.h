@@ -50,6 +50,19 @@ class StandardGameSolver : public GameSolver<ValueType> {
                            std::vector<ValueType>& player2ReducedResult, std::vector<ValueType>& player1ReducedResult,
                            std::vector<uint64_t>* player1SchedulerChoices = nullptr, std::vector<uint64_t>* player2SchedulerChoices = nullptr) const;
 
+    // Computes the value of the given player 1 state under the given values of the player 1 states, i.e., the optimum over its player 2 successors of the
+    // optimum over their rows. If choice vectors are given, the optimal choices of the involved states are stored in them.
+    ValueType computePlayer1StateValue(OptimizationDirection player1Dir, OptimizationDirection player2Dir, uint64_t player1State,
+                                       std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<uint64_t>* player1SchedulerChoices,
+                                       std::vector<uint64_t>* player2SchedulerChoices) const;
+
+    // Performs one value iteration step that updates the values of all player 1 states. With Gauss-Seidel multiplications, x is updated in place.
+    // Otherwise, the new values are written to newX and the player 1 states are distributed over the given number of threads.
+    // Returns true iff the old and the new values are equal modulo the given precision.
+    bool performValueIterationStep(OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x, std::vector<ValueType>& newX,
+                                   std::vector<ValueType> const& b, bool gaussSeidel, uint64_t numberOfThreads, ValueType const& precision, bool relative,
+                                   std::vector<uint64_t>* player1SchedulerChoices, std::vector<uint64_t>* player2SchedulerChoices) const;
+
     // Solves the equation system given by the two choice selections
     void getInducedMatrixVector(std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<uint_fast64_t> const& player1Choices,
                                 std::vector<uint_fast64_t> const& player2Choices, storm::storage::SparseMatrix<ValueType>& inducedMatrix,
@@ -8,6 +8,7 @@
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/SymbolicEliminationLinearEquationSolver.h"
 #include "storm/solver/SymbolicNativeLinearEquationSolver.h"
+#include "storm/solver/SymbolicTopologicalLinearEquationSolver.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
 
@@ -147,7 +148,7 @@ std::unique_ptr<storm::solver::SymbolicLinearEquationSolver<DdType, ValueType>>
     EquationSolverType type = env.solver().getLinearEquationSolverType();
 
     // Adjust the solver type if it is not supported in the Dd engine
-    if (type != EquationSolverType::Native && type != EquationSolverType::Elimination) {
+    if (type != EquationSolverType::Native && type != EquationSolverType::Elimination && type != EquationSolverType::Topological) {
         type = EquationSolverType::Native;
         STORM_LOG_INFO("The selected equation solver is not available in the dd engine. Falling back to " << toString(type) << " solver.");
     }
@@ -157,6 +158,8 @@ std::unique_ptr<storm::solver::SymbolicLinearEquationSolver<DdType, ValueType>>
             return std::make_unique<SymbolicNativeLinearEquationSolver<DdType, ValueType>>();
         case EquationSolverType::Elimination:
             return std::make_unique<SymbolicEliminationLinearEquationSolver<DdType, ValueType>>();
+        case EquationSolverType::Topological:
+            return std::make_unique<SymbolicTopologicalLinearEquationSolver<DdType, ValueType>>();
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unknown solver type.");
             return nullptr;
@@ -60,7 +60,8 @@ MinMaxMethod SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::getMethod(En
             STORM_LOG_WARN("The selected solution method does not guarantee exact results.");
         }
     }
-    if (method != MinMaxMethod::ValueIteration && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch) {
+    if (method != MinMaxMethod::ValueIteration && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch &&
+        method != MinMaxMethod::Topological) {
         STORM_LOG_WARN("Selected method is not supported for this solver, switching to value iteration.");
         method = MinMaxMethod::ValueIteration;
     }
@@ -87,6 +88,9 @@ storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, Val
         case MinMaxMethod::RationalSearch:
             return solveEquationsRationalSearch(env, dir, x, b);
             break;
+        case MinMaxMethod::Topological:
+            return solveEquationsTopological(env, dir, x, b);
+            break;
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "The selected min max technique is not supported by this solver.");
     }
@@ -295,10 +299,8 @@ storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, Val
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
-storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsValueIteration(
-    Environment const& env, storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x,
-    storm::dd::Add<DdType, ValueType> const& b) const {
-    // Set up the environment.
+storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::getValueIterationStartValues(
+    Environment const& env, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
     storm::dd::Add<DdType, ValueType> localX;
 
     if (this->hasUniqueSolution()) {
@@ -331,6 +333,15 @@ storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, Val
             localX = this->getLowerBoundsVector();
         }
     }
+    return localX;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsValueIteration(
+    Environment const& env, storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x,
+    storm::dd::Add<DdType, ValueType> const& b) const {
+    // Set up the environment.
+    storm::dd::Add<DdType, ValueType> localX = getValueIterationStartValues(env, x, b);
 
     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
     ValueIterationResult viResult = performValueIteration(dir, localX, b, precision, env.solver().minMax().getRelativeTerminationCriterion(),
@@ -345,6 +356,113 @@ storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, Val
     return viResult.values;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsTopological(
+    Environment const& env, storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x,
+    storm::dd::Add<DdType, ValueType> const& b) const {
+    storm::dd::DdManager<DdType>& manager = this->getDdManager();
+    storm::dd::Add<DdType, ValueType> zero = manager.template getAddZero<ValueType>();
+
+    bool sound = env.solver().isForceSoundness();
+    if (sound && !this->hasUpperBound() && !this->hasUpperBounds()) {
+        STORM_LOG_WARN("Sound computations require upper bounds, which are not available. Falling back to topological value iteration.");
+        sound = false;
+    }
+
+    // In sound mode, the lower and upper values enclose the solution. Otherwise, only the lower values are iterated.
+    storm::dd::Add<DdType, ValueType> lowerX = sound ? this->getLowerBoundsVector() : getValueIterationStartValues(env, x, b);
+    storm::dd::Add<DdType, ValueType> upperX = sound ? this->getUpperBoundsVector() : zero;
+
+    storm::dd::Bdd<DdType> transitions = this->A.notZero().existsAbstract(this->choiceVariables);
+    std::vector<storm::dd::Bdd<DdType>> levels = storm::utility::dd::computeTopologicalLevels(this->allRows, transitions, this->rowMetaVariables,
+                                                                                              this->columnMetaVariables, this->rowColumnMetaVariablePairs);
+    STORM_LOG_INFO("Solving symbolic min/max equation system with topological " << (sound ? "interval" : "value") << " iteration on " << levels.size()
+                                                                                << " levels.");
+
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+    bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().minMax().getMaximalNumberOfIterations();
+
+    // Computes min/max (levelA * values + levelB) for the rows of a level.
+    auto multiplyAndReduce = [&](storm::dd::Add<DdType, ValueType> const& levelA, storm::dd::Add<DdType, ValueType> const& levelIllegalMaskAdd,
+                                 storm::dd::Add<DdType, ValueType> const& values, storm::dd::Add<DdType, ValueType> const& levelB) {
+        storm::dd::Add<DdType, ValueType> tmp = levelA.multiplyMatrix(values.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables);
+        tmp += levelB;
+        if (dir == storm::solver::OptimizationDirection::Minimize) {
+            tmp += levelIllegalMaskAdd;
+            return tmp.minAbstract(this->choiceVariables);
+        } else {
+            return tmp.maxAbstract(this->choiceVariables);
+        }
+    };
+
+    SolverStatus status = SolverStatus::Converged;
+    uint64_t overallIterations = 0;
+    storm::dd::Bdd<DdType> solvedStates = manager.getBddZero();
+    for (auto const& level : levels) {
+        // Restrict the matrix to the rows of the level and split it into the transitions within the level and the transitions to solved states.
+        storm::dd::Add<DdType, ValueType> levelRows = level.ite(this->A, zero);
+        storm::dd::Add<DdType, ValueType> levelA = level.swapVariables(this->rowColumnMetaVariablePairs).ite(levelRows, zero);
+        storm::dd::Add<DdType, ValueType> solvedA = solvedStates.swapVariables(this->rowColumnMetaVariablePairs).ite(levelRows, zero);
+        storm::dd::Add<DdType, ValueType> levelIllegalMaskAdd = level.ite(illegalMaskAdd, zero);
+        storm::dd::Add<DdType, ValueType> levelB = level.ite(b, zero);
+
+        // The values of the solved states are constant for this level.
+        storm::dd::Add<DdType, ValueType> levelLowerB =
+            levelB + solvedA.multiplyMatrix(lowerX.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables);
+        storm::dd::Add<DdType, ValueType> levelUpperB;
+        if (sound) {
+            levelUpperB = levelB + solvedA.multiplyMatrix(upperX.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables);
+        }
+
+        storm::dd::Add<DdType, ValueType> levelLowerX = level.ite(lowerX, zero);
+        storm::dd::Add<DdType, ValueType> levelUpperX = level.ite(upperX, zero);
+        uint64_t iterations = 0;
+        SolverStatus levelStatus = SolverStatus::InProgress;
+        while (levelStatus == SolverStatus::InProgress && iterations < maxIter) {
+            storm::dd::Add<DdType, ValueType> newLowerX = multiplyAndReduce(levelA, levelIllegalMaskAdd, levelLowerX, levelLowerB);
+            if (sound) {
+                levelUpperX = multiplyAndReduce(levelA, levelIllegalMaskAdd, levelUpperX, levelUpperB);
+                if (newLowerX.equalModuloPrecision(levelUpperX, precision, relative)) {
+                    levelStatus = SolverStatus::Converged;
+                }
+            } else if (newLowerX.equalModuloPrecision(levelLowerX, precision, relative)) {
+                levelStatus = SolverStatus::Converged;
+            }
+            levelLowerX = newLowerX;
+            ++iterations;
+            if (storm::utility::resources::isTerminate()) {
+                levelStatus = SolverStatus::Aborted;
+            }
+        }
+        overallIterations += iterations;
+
+        lowerX = level.ite(levelLowerX, lowerX);
+        if (sound) {
+            upperX = level.ite(levelUpperX, upperX);
+        }
+        solvedStates |= level;
+
+        if (levelStatus != SolverStatus::Converged) {
+            status = levelStatus == SolverStatus::InProgress ? SolverStatus::MaximalIterationsExceeded : levelStatus;
+            if (status == SolverStatus::Aborted) {
+                break;
+            }
+        }
+    }
+
+    if (status == SolverStatus::Converged) {
+        STORM_LOG_INFO("Iterative solver (topological value iteration) converged in " << overallIterations << " iterations.");
+    } else {
+        STORM_LOG_WARN("Iterative solver (topological value iteration) did not converge in " << overallIterations << " iterations.");
+    }
+
+    if (sound) {
+        return (lowerX + upperX) / manager.getConstant(storm::utility::convertNumber<ValueType, uint64_t>(2));
+    }
+    return lowerX;
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsWithScheduler(
     Environment const& env, storm::dd::Bdd<DdType> const& scheduler, storm::dd::Add<DdType, ValueType> const& x,
@@ -532,6 +650,22 @@ MinMaxLinearEquationSolverRequirements SymbolicMinMaxLinearEquationSolver<DdType
                 requirements.requireValidInitialScheduler();
             }
         }
+    } else if (method == MinMaxMethod::Topological) {
+        if (env.solver().isForceSoundness()) {
+            // Without upper bounds, the solver falls back to unsound value iteration.
+            requirements.requireLowerBounds();
+            requirements.requireUpperBounds(false);
+            if (!this->hasUniqueSolution()) {
+                requirements.requireUniqueSolution();
+            }
+        } else if (!this->hasUniqueSolution()) {
+            if (!direction || direction.get() == storm::solver::OptimizationDirection::Maximize) {
+                requirements.requireLowerBounds();
+            }
+            if (!direction || direction.get() == storm::solver::OptimizationDirection::Minimize) {
+                requirements.requireValidInitialScheduler();
+            }
+        }
     } else if (method == MinMaxMethod::RationalSearch) {
         requirements.requireLowerBounds();
         if (!this->hasUniqueSolution() && (!direction || direction.get() == storm::solver::OptimizationDirection::Minimize)) {
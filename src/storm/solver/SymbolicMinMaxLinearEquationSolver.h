@@ -159,6 +159,20 @@ class SymbolicMinMaxLinearEquationSolver : public SymbolicEquationSolver<DdType,
                                                                    storm::dd::Add<DdType, ValueType> const& x,
                                                                    storm::dd::Add<DdType, ValueType> const& b) const;
 
+    /*!
+     * Solves the equation system level by level along a coarse topological decomposition of the states (see
+     * storm::utility::dd::computeTopologicalLevels). Every level only iterates on the part of the matrix that belongs to its rows. Sound
+     * computations perform interval iteration on every level, where the bounds of the solved levels are propagated symbolically.
+     */
+    storm::dd::Add<DdType, ValueType> solveEquationsTopological(Environment const& env, storm::solver::OptimizationDirection const& dir,
+                                                                storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const;
+
+    /*!
+     * Retrieves the values from which value iteration can start (depending on the uniqueness of the solution and the initial scheduler).
+     */
+    storm::dd::Add<DdType, ValueType> getValueIterationStartValues(Environment const& env, storm::dd::Add<DdType, ValueType> const& x,
+                                                                   storm::dd::Add<DdType, ValueType> const& b) const;
+
     template<typename RationalType, typename ImpreciseType>
     static storm::dd::Add<DdType, RationalType> sharpen(OptimizationDirection dir, uint64_t precision,
                                                         SymbolicMinMaxLinearEquationSolver<DdType, RationalType> const& rationalSolver,
@@ -0,0 +1,164 @@
+#include "storm/solver/SymbolicTopologicalLinearEquationSolver.h"
+
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/dd.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+template<storm::dd::DdType DdType, typename ValueType>
+SymbolicTopologicalLinearEquationSolver<DdType, ValueType>::SymbolicTopologicalLinearEquationSolver() : SymbolicLinearEquationSolver<DdType, ValueType>() {
+    // Intentionally left empty.
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+SymbolicTopologicalLinearEquationSolver<DdType, ValueType>::SymbolicTopologicalLinearEquationSolver(
+    storm::dd::Add<DdType, ValueType> const& A, storm::dd::Bdd<DdType> const& allRows, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs)
+    : SymbolicTopologicalLinearEquationSolver(allRows, rowMetaVariables, columnMetaVariables, rowColumnMetaVariablePairs) {
+    this->setMatrix(A);
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+SymbolicTopologicalLinearEquationSolver<DdType, ValueType>::SymbolicTopologicalLinearEquationSolver(
+    storm::dd::Bdd<DdType> const& allRows, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs)
+    : SymbolicLinearEquationSolver<DdType, ValueType>(allRows, rowMetaVariables, columnMetaVariables, rowColumnMetaVariablePairs) {
+    // Intentionally left empty.
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> SymbolicTopologicalLinearEquationSolver<DdType, ValueType>::solveEquations(Environment const& env,
+                                                                                                             storm::dd::Add<DdType, ValueType> const& x,
+                                                                                                             storm::dd::Add<DdType, ValueType> const& b) const {
+    storm::dd::DdManager<DdType>& manager = this->getDdManager();
+    storm::dd::Add<DdType, ValueType> zero = manager.template getAddZero<ValueType>();
+    STORM_LOG_WARN_COND(!storm::NumberTraits<ValueType>::IsExact, "The topological solver of the dd engine does not guarantee exact results.");
+
+    bool sound = env.solver().isForceSoundness();
+    if (sound && !((this->hasLowerBound() || this->hasLowerBounds()) && (this->hasUpperBound() || this->hasUpperBounds()))) {
+        STORM_LOG_WARN("Sound computations require lower and upper bounds, which are not available. Falling back to topological power iteration.");
+        sound = false;
+    }
+
+    // In sound mode, the lower and upper values enclose the solution. Otherwise, only the lower values are iterated.
+    storm::dd::Add<DdType, ValueType> lowerX = sound ? this->getLowerBoundsVector() : x;
+    storm::dd::Add<DdType, ValueType> upperX = sound ? this->getUpperBoundsVector() : zero;
+
+    std::vector<storm::dd::Bdd<DdType>> levels = storm::utility::dd::computeTopologicalLevels(this->allRows, this->A.notZero(), this->rowMetaVariables,
+                                                                                              this->columnMetaVariables, this->rowColumnMetaVariablePairs);
+    STORM_LOG_INFO("Solving symbolic linear equation system with topological " << (sound ? "interval" : "power") << " iteration on " << levels.size()
+                                                                               << " levels.");
+
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+    bool relative = env.solver().native().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+
+    SolverStatus status = SolverStatus::Converged;
+    uint64_t overallIterations = 0;
+    storm::dd::Bdd<DdType> solvedStates = manager.getBddZero();
+    for (auto const& level : levels) {
+        // Restrict the matrix to the rows of the level and split it into the transitions within the level and the transitions to solved states.
+        storm::dd::Add<DdType, ValueType> levelRows = level.ite(this->A, zero);
+        storm::dd::Add<DdType, ValueType> levelA = level.swapVariables(this->rowColumnMetaVariablePairs).ite(levelRows, zero);
+        storm::dd::Add<DdType, ValueType> solvedA = solvedStates.swapVariables(this->rowColumnMetaVariablePairs).ite(levelRows, zero);
+        storm::dd::Add<DdType, ValueType> levelB = level.ite(b, zero);
+
+        // The values of the solved states are constant for this level.
+        storm::dd::Add<DdType, ValueType> levelLowerB =
+            levelB + solvedA.multiplyMatrix(lowerX.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables);
+        storm::dd::Add<DdType, ValueType> levelUpperB;
+        if (sound) {
+            levelUpperB = levelB + solvedA.multiplyMatrix(upperX.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables);
+        }
+
+        storm::dd::Add<DdType, ValueType> levelLowerX = level.ite(lowerX, zero);
+        storm::dd::Add<DdType, ValueType> levelUpperX = level.ite(upperX, zero);
+        uint64_t iterations = 0;
+        SolverStatus levelStatus = SolverStatus::InProgress;
+        while (levelStatus == SolverStatus::InProgress && iterations < maxIter) {
+            storm::dd::Add<DdType, ValueType> newLowerX =
+                levelA.multiplyMatrix(levelLowerX.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables) + levelLowerB;
+            if (sound) {
+                levelUpperX = levelA.multiplyMatrix(levelUpperX.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables) + levelUpperB;
+                if (newLowerX.equalModuloPrecision(levelUpperX, precision, relative)) {
+                    levelStatus = SolverStatus::Converged;
+                }
+            } else if (newLowerX.equalModuloPrecision(levelLowerX, precision, relative)) {
+                levelStatus = SolverStatus::Converged;
+            }
+            levelLowerX = newLowerX;
+            ++iterations;
+            if (storm::utility::resources::isTerminate()) {
+                levelStatus = SolverStatus::Aborted;
+            }
+        }
+        overallIterations += iterations;
+
+        lowerX = level.ite(levelLowerX, lowerX);
+        if (sound) {
+            upperX = level.ite(levelUpperX, upperX);
+        }
+        solvedStates |= level;
+
+        if (levelStatus != SolverStatus::Converged) {
+            status = levelStatus == SolverStatus::InProgress ? SolverStatus::MaximalIterationsExceeded : levelStatus;
+            if (status == SolverStatus::Aborted) {
+                break;
+            }
+        }
+    }
+
+    if (status == SolverStatus::Converged) {
+        STORM_LOG_INFO("Iterative solver (topological) converged in " << overallIterations << " iterations.");
+    } else {
+        STORM_LOG_WARN("Iterative solver (topological) did not converge in " << overallIterations << " iterations.");
+    }
+
+    if (sound) {
+        return (lowerX + upperX) / manager.getConstant(storm::utility::convertNumber<ValueType, uint64_t>(2));
+    }
+    return lowerX;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+LinearEquationSolverProblemFormat SymbolicTopologicalLinearEquationSolver<DdType, ValueType>::getEquationProblemFormat(Environment const& env) const {
+    return LinearEquationSolverProblemFormat::FixedPointSystem;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+LinearEquationSolverRequirements SymbolicTopologicalLinearEquationSolver<DdType, ValueType>::getRequirements(Environment const& env) const {
+    LinearEquationSolverRequirements requirements;
+    if (env.solver().isForceSoundness()) {
+        // Without bounds, the solver falls back to unsound power iteration.
+        requirements.requireBounds(false);
+    }
+    return requirements;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+std::unique_ptr<storm::solver::SymbolicLinearEquationSolver<DdType, ValueType>> SymbolicTopologicalLinearEquationSolverFactory<DdType, ValueType>::create(
+    Environment const& env) const {
+    return std::make_unique<SymbolicTopologicalLinearEquationSolver<DdType, ValueType>>();
+}
+
+template class SymbolicTopologicalLinearEquationSolver<storm::dd::DdType::CUDD, double>;
+template class SymbolicTopologicalLinearEquationSolver<storm::dd::DdType::CUDD, storm::RationalNumber>;
+template class SymbolicTopologicalLinearEquationSolver<storm::dd::DdType::Sylvan, double>;
+template class SymbolicTopologicalLinearEquationSolver<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+
+template class SymbolicTopologicalLinearEquationSolverFactory<storm::dd::DdType::CUDD, double>;
+template class SymbolicTopologicalLinearEquationSolverFactory<storm::dd::DdType::CUDD, storm::RationalNumber>;
+template class SymbolicTopologicalLinearEquationSolverFactory<storm::dd::DdType::Sylvan, double>;
+template class SymbolicTopologicalLinearEquationSolverFactory<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "storm/solver/SymbolicLinearEquationSolver.h"
+
+namespace storm {
+namespace solver {
+
+/*!
+ * A symbolic linear equation solver that solves the equation system level by level along a coarse topological decomposition of the states (see
+ * storm::utility::dd::computeTopologicalLevels). Every level is solved by power iteration on the part of the matrix that belongs to its rows, using the
+ * precision settings of the native solver. Sound computations perform interval iteration on every level instead.
+ */
+template<storm::dd::DdType DdType, typename ValueType = double>
+class SymbolicTopologicalLinearEquationSolver : public SymbolicLinearEquationSolver<DdType, ValueType> {
+   public:
+    SymbolicTopologicalLinearEquationSolver();
+
+    SymbolicTopologicalLinearEquationSolver(
+        storm::dd::Add<DdType, ValueType> const& A, storm::dd::Bdd<DdType> const& allRows, std::set<storm::expressions::Variable> const& rowMetaVariables,
+        std::set<storm::expressions::Variable> const& columnMetaVariables,
+        std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
+    SymbolicTopologicalLinearEquationSolver(
+        storm::dd::Bdd<DdType> const& allRows, std::set<storm::expressions::Variable> const& rowMetaVariables,
+        std::set<storm::expressions::Variable> const& columnMetaVariables,
+        std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
+    virtual storm::dd::Add<DdType, ValueType> solveEquations(Environment const& env, storm::dd::Add<DdType, ValueType> const& x,
+                                                             storm::dd::Add<DdType, ValueType> const& b) const override;
+
+    virtual LinearEquationSolverProblemFormat getEquationProblemFormat(Environment const& env) const override;
+    virtual LinearEquationSolverRequirements getRequirements(Environment const& env) const override;
+};
+
+template<storm::dd::DdType DdType, typename ValueType>
+class SymbolicTopologicalLinearEquationSolverFactory : public SymbolicLinearEquationSolverFactory<DdType, ValueType> {
+   public:
+    using SymbolicLinearEquationSolverFactory<DdType, ValueType>::create;
+
+    virtual std::unique_ptr<storm::solver::SymbolicLinearEquationSolver<DdType, ValueType>> create(Environment const& env) const override;
+};
+
+}  // namespace solver
+}  // namespace storm
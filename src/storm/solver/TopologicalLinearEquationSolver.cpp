@@ -1,15 +1,19 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include <atomic>
+
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/solver/helper/TopologicalSccScheduling.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -95,6 +99,8 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
         } else {
             returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, x, b);
         }
+    } else if (uint64_t numberOfThreads = helper::getNumberOfThreadsForSccs(env, *this->sortedSccDecomposition); numberOfThreads > 1) {
+        returnValue = solveSccsConcurrently(sccSolverEnvironment, numberOfThreads, x, b);
     } else {
         // Solve each SCC individually
         storm::storage::BitVector sccAsBitVector(x.size(), false);
@@ -110,7 +116,7 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
                 for (auto const& state : scc) {
                     sccAsBitVector.set(state, true);
                 }
-                returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
+                returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b, this->sccSolver) && returnValue;
             }
             ++sccIndex;
             progress.updateProgress(sccIndex);
@@ -128,6 +134,52 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     return returnValue;
 }
 
+template<typename ValueType>
+bool TopologicalLinearEquationSolver<ValueType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads,
+                                                                       std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    STORM_LOG_INFO("Solving " << this->sortedSccDecomposition->size() << " SCCs with " << numberOfThreads << " threads.");
+    // The SCCs are already solved concurrently, so each of them is solved with a single thread.
+    storm::Environment threadEnvironment(sccSolverEnvironment);
+    threadEnvironment.solver().setNumberOfThreads(1);
+
+    helper::SccDependencies dependencies = helper::computeSccDependencies(*this->A, *this->sortedSccDecomposition);
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> threadSolvers(numberOfThreads);
+    std::vector<storm::storage::BitVector> threadSccAsBitVectors(numberOfThreads, storm::storage::BitVector(x.size(), false));
+    std::atomic<bool> allSolved(true);
+    std::atomic<uint64_t> numberOfSolvedSccs(0);
+    storm::utility::ProgressMeasurement progress("states");
+    progress.setMaxCount(x.size());
+    progress.startNewMeasurement(0);
+    bool finished = storm::utility::parallel::forEachInDependencyOrder(
+        numberOfThreads, dependencies.dependencyCounts, dependencies.dependentOffsets, dependencies.dependents, [&](uint64_t threadIndex, uint64_t sccIndex) {
+            // Every SCC only reads the values of the SCCs it depends on (which are final) and writes the values of its own states.
+            auto const& scc = this->sortedSccDecomposition->getBlock(sccIndex);
+            bool solved;
+            if (scc.size() == 1) {
+                solved = solveTrivialScc(*scc.begin(), x, b);
+            } else {
+                auto& sccAsBitVector = threadSccAsBitVectors[threadIndex];
+                sccAsBitVector.clear();
+                for (auto const& state : scc) {
+                    sccAsBitVector.set(state, true);
+                }
+                solved = solveScc(threadEnvironment, sccAsBitVector, x, b, threadSolvers[threadIndex]);
+            }
+            if (!solved) {
+                allSolved.store(false);
+            }
+            uint64_t solvedSccs = ++numberOfSolvedSccs;
+            if (threadIndex == 0) {
+                progress.updateProgress(solvedSccs);
+            }
+            return !storm::utility::resources::isTerminate();
+        });
+    if (!finished) {
+        STORM_LOG_WARN("Topological solver aborted after analyzing " << numberOfSolvedSccs.load() << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+    }
+    return allSolved.load();
+}
+
 template<typename ValueType>
 void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
     // Obtain the scc decomposition
@@ -189,20 +241,21 @@ bool TopologicalLinearEquationSolver<ValueType>::solveFullyConnectedEquationSyst
 
 template<typename ValueType>
 bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc,
-                                                          std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+                                                          std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
+                                                          std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver) const {
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!sccSolver) {
+        sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        sccSolver->setCachingEnabled(true);
     }
 
     // Matrix
-    bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+    bool asEquationSystem = sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
     storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
     if (asEquationSystem) {
         sccA.convertToEquationSystem();
     }
-    this->sccSolver->setMatrix(std::move(sccA));
+    sccSolver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -222,20 +275,20 @@ bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment con
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        sccSolver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+        sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        sccSolver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+        sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
     }
 
     // std::cout << "rhs is " << storm::utility::vector::toString(sccB) << '\n';
     // std::cout << "x is " << storm::utility::vector::toString(sccX) << '\n';
 
-    bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+    bool returnvalue = sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
     storm::utility::vector::setVectorValues(globalX, scc, sccX);
     return returnvalue;
 }
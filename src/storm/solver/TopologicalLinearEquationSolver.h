@@ -46,7 +46,11 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
     bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
-                  std::vector<ValueType> const& globalB) const;
+                  std::vector<ValueType> const& globalB, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver) const;
+
+    // Solves the SCCs with the given number of threads, where each SCC is solved as soon as all SCCs it depends on are solved.
+    bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, std::vector<ValueType>& x,
+                               std::vector<ValueType> const& b) const;
 
     // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
     // when the solver is destructed.
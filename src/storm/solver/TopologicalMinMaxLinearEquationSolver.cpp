@@ -1,5 +1,9 @@
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
+#include <algorithm>
+#include <atomic>
+#include <optional>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
@@ -7,10 +11,12 @@
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/solver/helper/TopologicalSccScheduling.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -99,39 +105,25 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
                 this->schedulerChoices = std::vector<uint64_t>(x.size());
             }
         }
-        storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-        storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-            } else {
-                STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                sccRowGroupsAsBitVector.clear();
-                sccRowsAsBitVector.clear();
-                for (auto const& group : scc) {  // Group refers to state
-                    sccRowGroupsAsBitVector.set(group, true);
-
-                    if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
-                        for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                            sccRowsAsBitVector.set(row, true);
-                        }
-                    } else {
-                        auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
-                        sccRowsAsBitVector.set(row, true);
-                        STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
-                    }
+        uint64_t numberOfThreads = helper::getNumberOfThreadsForSccs(env, *this->sortedSccDecomposition);
+        if (numberOfThreads > 1) {
+            returnValue = solveSccsConcurrently(sccSolverEnvironment, numberOfThreads, dir, x, b);
+        } else {
+            storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+            storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+            uint64_t sccIndex = 0;
+            storm::utility::ProgressMeasurement progress("states");
+            progress.setMaxCount(x.size());
+            progress.startNewMeasurement(0);
+            for (auto const& scc : *this->sortedSccDecomposition) {
+                returnValue = solveSccOfDecomposition(sccSolverEnvironment, dir, scc, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b, this->sccSolver) &&
+                              returnValue;
+                ++sccIndex;
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                    break;
                 }
-                returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
             }
         }
 
@@ -152,6 +144,71 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
     return returnValue;
 }
 
+template<typename ValueType, typename SolutionType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveSccOfDecomposition(
+    storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, storm::storage::StronglyConnectedComponent const& scc,
+    storm::storage::BitVector& sccRowGroupsAsBitVector, storm::storage::BitVector& sccRowsAsBitVector, std::vector<SolutionType>& x,
+    std::vector<ValueType> const& b, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver) const {
+    if (scc.size() == 1) {
+        return solveTrivialScc(*scc.begin(), dir, x, b);
+    }
+    STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+    sccRowGroupsAsBitVector.clear();
+    sccRowsAsBitVector.clear();
+    for (auto const& group : scc) {  // Group refers to state
+        sccRowGroupsAsBitVector.set(group, true);
+
+        if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
+            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                sccRowsAsBitVector.set(row, true);
+            }
+        } else {
+            auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
+            sccRowsAsBitVector.set(row, true);
+            STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
+        }
+    }
+    return solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b, sccSolver);
+}
+
+template<typename ValueType, typename SolutionType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment,
+                                                                                           uint64_t numberOfThreads, OptimizationDirection dir,
+                                                                                           std::vector<SolutionType>& x,
+                                                                                           std::vector<ValueType> const& b) const {
+    STORM_LOG_INFO("Solving " << this->sortedSccDecomposition->size() << " SCCs with " << numberOfThreads << " threads.");
+    // The SCCs are already solved concurrently, so each of them is solved with a single thread.
+    storm::Environment threadEnvironment(sccSolverEnvironment);
+    threadEnvironment.solver().setNumberOfThreads(1);
+
+    helper::SccDependencies dependencies = helper::computeSccDependencies(*this->A, *this->sortedSccDecomposition);
+    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> threadSolvers(numberOfThreads);
+    std::vector<storm::storage::BitVector> threadSccRowGroupsAsBitVectors(numberOfThreads, storm::storage::BitVector(x.size(), false));
+    std::vector<storm::storage::BitVector> threadSccRowsAsBitVectors(numberOfThreads, storm::storage::BitVector(b.size(), false));
+    std::atomic<bool> allSolved(true);
+    std::atomic<uint64_t> numberOfSolvedSccs(0);
+    storm::utility::ProgressMeasurement progress("states");
+    progress.setMaxCount(x.size());
+    progress.startNewMeasurement(0);
+    bool finished = storm::utility::parallel::forEachInDependencyOrder(
+        numberOfThreads, dependencies.dependencyCounts, dependencies.dependentOffsets, dependencies.dependents, [&](uint64_t threadIndex, uint64_t sccIndex) {
+            // Every SCC only reads the values of the SCCs it depends on (which are final) and writes the values (and choices) of its own states.
+            if (!solveSccOfDecomposition(threadEnvironment, dir, this->sortedSccDecomposition->getBlock(sccIndex), threadSccRowGroupsAsBitVectors[threadIndex],
+                                         threadSccRowsAsBitVectors[threadIndex], x, b, threadSolvers[threadIndex])) {
+                allSolved.store(false);
+            }
+            uint64_t solvedSccs = ++numberOfSolvedSccs;
+            if (threadIndex == 0) {
+                progress.updateProgress(solvedSccs);
+            }
+            return !storm::utility::resources::isTerminate();
+        });
+    if (!finished) {
+        STORM_LOG_WARN("Topological solver aborted after analyzing " << numberOfSolvedSccs.load() << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+    }
+    return allSolved.load();
+}
+
 template<typename ValueType, typename SolutionType>
 void TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::createSortedSccDecomposition(bool needLongestChainSize) const {
     // Obtain the scc decomposition
@@ -292,18 +349,18 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveFullyC
 }
 
 template<typename ValueType, typename SolutionType>
-bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
-                                                                              storm::storage::BitVector const& sccRowGroups,
-                                                                              storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX,
-                                                                              std::vector<ValueType> const& globalB) const {
+bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(
+    storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups,
+    storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
+    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver) const {
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!sccSolver) {
+        sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        sccSolver->setCachingEnabled(true);
     }
-    this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-    this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-    this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+    sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
+    sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
+    sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
 
     storm::storage::SparseMatrix<ValueType> sccA;
     if (this->choiceFixedForRowGroup) {
@@ -317,7 +374,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
             // As we removed the entries where the choice was fixed, we need to change the scheduler.
             // We set the scheduler to 0 for those states.
             storm::utility::vector::setVectorValues<uint_fast64_t>(sccInitChoices, choiceFixedForStateSCC, 0);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            sccSolver->setInitialScheduler(std::move(sccInitChoices));
         }
 
     } else {
@@ -326,46 +383,81 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
         // initial scheduler
         if (this->hasInitialScheduler()) {
             auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            sccSolver->setInitialScheduler(std::move(sccInitChoices));
         }
     }
 
-    this->sccSolver->setMatrix(std::move(sccA));
+    sccSolver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
 
     // b Vector
+    // For sound computations, we also derive bounds for the SCC from the values of the states it exits to (see below).
+    bool deriveExitBounds = sccSolverEnvironment.solver().isForceSoundness();
+    auto isNegligible = [](ValueType const& value) {
+        return storm::NumberTraits<ValueType>::IsExact ? storm::utility::isZero(value) : storm::utility::isAlmostZero(value);
+    };
+    std::optional<std::pair<ValueType, ValueType>> exitBounds;
     std::vector<ValueType> sccB;
     sccB.reserve(sccRows.getNumberOfSetBits());
     for (auto row : sccRows) {
         ValueType bi = globalB[row];
+        ValueType exitProbability = storm::utility::one<ValueType>();
         for (auto const& entry : this->A->getRow(row)) {
             if (!sccRowGroups.get(entry.getColumn())) {
                 bi += entry.getValue() * globalX[entry.getColumn()];
+            } else if (deriveExitBounds) {
+                exitProbability -= entry.getValue();
+            }
+        }
+        if (deriveExitBounds) {
+            if (isNegligible(exitProbability)) {
+                // Choices that do not exit the SCC only keep the bounds valid if they do not collect any value.
+                deriveExitBounds = isNegligible(bi);
+            } else if (exitProbability < storm::utility::zero<ValueType>()) {
+                deriveExitBounds = false;
+            } else {
+                ValueType exitValue = bi / exitProbability;
+                if (!exitBounds) {
+                    exitBounds.emplace(exitValue, exitValue);
+                } else {
+                    exitBounds->first = std::min(exitBounds->first, exitValue);
+                    exitBounds->second = std::max(exitBounds->second, std::move(exitValue));
+                }
             }
         }
         sccB.push_back(std::move(bi));
     }
 
-    // lower/upper bounds
+    // lower/upper bounds (the solver is reused for all SCCs, so bounds derived for a previous SCC must be removed)
+    sccSolver->clearBounds();
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        sccSolver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+        sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        sccSolver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+        sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+    }
+    if (deriveExitBounds && exitBounds) {
+        // Every scheduler that leaves the SCC almost surely yields a convex combination of the exit values bi/(exit probability of the choice). A
+        // scheduler that stays in the SCC forever collects nothing, so zero is included unless there are no end components.
+        if (!this->hasNoEndComponents()) {
+            exitBounds->first = std::min(exitBounds->first, storm::utility::zero<ValueType>());
+            exitBounds->second = std::max(exitBounds->second, storm::utility::zero<ValueType>());
+        }
+        tightenSccBounds(*sccSolver, sccRowGroups, exitBounds->first, exitBounds->second);
     }
 
     // Requirements
-    auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
-    if (req.upperBounds() && this->hasUpperBound()) {
+    auto req = sccSolver->getRequirements(sccSolverEnvironment, dir);
+    if (req.upperBounds() && sccSolver->hasUpperBound()) {
         req.clearUpperBounds();
     }
-    if (req.lowerBounds() && this->hasLowerBound()) {
+    if (req.lowerBounds() && sccSolver->hasLowerBound()) {
         req.clearLowerBounds();
     }
     if (req.validInitialScheduler() && this->hasInitialScheduler()) {
@@ -376,14 +468,14 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
     }
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-    this->sccSolver->setRequirementsChecked(true);
+    sccSolver->setRequirementsChecked(true);
 
     // Invoke scc solver
-    bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+    bool res = sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
 
     // Set Scheduler choices
     if (this->isTrackSchedulerSet()) {
-        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, sccSolver->getSchedulerChoices());
     }
 
     // Set solution
@@ -392,6 +484,32 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
     return res;
 }
 
+template<typename ValueType, typename SolutionType>
+void TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::tightenSccBounds(storm::solver::MinMaxLinearEquationSolver<ValueType>& sccSolver,
+                                                                                      storm::storage::BitVector const& sccRowGroups,
+                                                                                      ValueType const& lowerBound, ValueType const& upperBound) const {
+    typedef typename storm::solver::AbstractEquationSolver<ValueType>::BoundType BoundType;
+    STORM_LOG_TRACE("Bounds [" << lowerBound << ", " << upperBound << "] derived from the exits of the SCC.");
+    if (this->hasLowerBound(BoundType::Local)) {
+        auto lowerBounds = storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups);
+        for (auto& bound : lowerBounds) {
+            bound = std::max(bound, lowerBound);
+        }
+        sccSolver.setLowerBounds(std::move(lowerBounds));
+    } else {
+        sccSolver.setLowerBound(this->hasLowerBound(BoundType::Global) ? std::max(this->getLowerBound(), lowerBound) : lowerBound);
+    }
+    if (this->hasUpperBound(BoundType::Local)) {
+        auto upperBounds = storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups);
+        for (auto& bound : upperBounds) {
+            bound = std::min(bound, upperBound);
+        }
+        sccSolver.setUpperBounds(std::move(upperBounds));
+    } else {
+        sccSolver.setUpperBound(this->hasUpperBound(BoundType::Global) ? std::min(this->getUpperBound(), upperBound) : upperBound);
+    }
+}
+
 template<typename ValueType, typename SolutionType>
 MinMaxLinearEquationSolverRequirements TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::getRequirements(
     Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& direction, bool const& hasInitialScheduler) const {
@@ -44,7 +44,21 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
                                            std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
     bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups,
-                  storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+                  storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
+                  std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver) const;
+    // ... for an arbitrary SCC of the decomposition, where the given bit vectors are used as auxiliary storage
+    bool solveSccOfDecomposition(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::StronglyConnectedComponent const& scc,
+                                 storm::storage::BitVector& sccRowGroupsAsBitVector, storm::storage::BitVector& sccRowsAsBitVector,
+                                 std::vector<SolutionType>& x, std::vector<ValueType> const& b,
+                                 std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver) const;
+
+    // Sets the bounds of the SCC solver to the intersection of the given bounds with the bounds of this solver.
+    void tightenSccBounds(storm::solver::MinMaxLinearEquationSolver<ValueType>& sccSolver, storm::storage::BitVector const& sccRowGroups,
+                          ValueType const& lowerBound, ValueType const& upperBound) const;
+
+    // Solves the SCCs with the given number of threads, where each SCC is solved as soon as all SCCs it depends on are solved.
+    bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, OptimizationDirection d,
+                               std::vector<SolutionType>& x, std::vector<ValueType> const& b) const;
 
     // cached auxiliary data
     mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
@@ -0,0 +1,431 @@
+#include "storm/solver/helper/DistributedValueIterationHelper.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/utility/Extremum.h"
+#include "storm/utility/Profiler.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm::solver::helper {
+
+namespace detail {
+// Spreads consecutive state indices evenly (the finalizer of splitmix64).
+uint64_t hashState(uint64_t state) {
+    state ^= state >> 30;
+    state *= 0xbf58476d1ce4e5b9ull;
+    state ^= state >> 27;
+    state *= 0x94d049bb133111ebull;
+    state ^= state >> 31;
+    return state;
+}
+}  // namespace detail
+
+DistributedStatePartition::DistributedStatePartition(uint64_t numberOfStates, uint64_t numberOfRanks, storm::utility::mpi::StatePartitioning partitioning)
+    : numberOfStates(numberOfStates), numberOfRanks(numberOfRanks), partitioning(partitioning) {
+    STORM_LOG_THROW(numberOfRanks > 0, storm::exceptions::InvalidArgumentException, "The number of processes must be positive.");
+}
+
+DistributedStatePartition::DistributedStatePartition(std::vector<uint64_t> const& firstStateOfRank)
+    : numberOfStates(firstStateOfRank.empty() ? 0 : firstStateOfRank.back()),
+      numberOfRanks(firstStateOfRank.empty() ? 0 : firstStateOfRank.size() - 1),
+      partitioning(storm::utility::mpi::StatePartitioning::Blocks),
+      firstStateOfRank(firstStateOfRank) {
+    STORM_LOG_THROW(numberOfRanks > 0, storm::exceptions::InvalidArgumentException, "The number of processes must be positive.");
+    STORM_LOG_THROW(firstStateOfRank.front() == 0 && std::is_sorted(firstStateOfRank.begin(), firstStateOfRank.end()),
+                    storm::exceptions::InvalidArgumentException, "The ranges of states are invalid.");
+}
+
+uint64_t DistributedStatePartition::getOwner(uint64_t state) const {
+    STORM_LOG_ASSERT(state < numberOfStates, "State index out of range.");
+    if (!firstStateOfRank.empty()) {
+        // Processes that own no states are skipped by searching for the last range that starts at or before the state.
+        return static_cast<uint64_t>(std::upper_bound(firstStateOfRank.begin(), firstStateOfRank.end(), state) - firstStateOfRank.begin()) - 1;
+    }
+    if (partitioning == storm::utility::mpi::StatePartitioning::Hash) {
+        return detail::hashState(state) % numberOfRanks;
+    }
+    // Process r owns the states in [r * n / R, (r + 1) * n / R). The division is done in a way that can not overflow.
+    uint64_t const statesPerRank = numberOfStates / numberOfRanks;
+    uint64_t const remainder = numberOfStates % numberOfRanks;
+    // The first 'remainder' processes own one additional state.
+    uint64_t const boundary = remainder * (statesPerRank + 1);
+    if (state < boundary) {
+        return state / (statesPerRank + 1);
+    }
+    return remainder + (state - boundary) / statesPerRank;
+}
+
+std::vector<uint64_t> DistributedStatePartition::getOwnedStates(uint64_t rank) const {
+    STORM_LOG_ASSERT(rank < numberOfRanks, "Process index out of range.");
+    std::vector<uint64_t> result;
+    if (!firstStateOfRank.empty()) {
+        result.reserve(firstStateOfRank[rank + 1] - firstStateOfRank[rank]);
+        for (uint64_t state = firstStateOfRank[rank]; state < firstStateOfRank[rank + 1]; ++state) {
+            result.push_back(state);
+        }
+    } else if (partitioning == storm::utility::mpi::StatePartitioning::Hash) {
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (getOwner(state) == rank) {
+                result.push_back(state);
+            }
+        }
+    } else {
+        uint64_t const statesPerRank = numberOfStates / numberOfRanks;
+        uint64_t const remainder = numberOfStates % numberOfRanks;
+        uint64_t const first = rank * statesPerRank + std::min(rank, remainder);
+        uint64_t const end = first + statesPerRank + (rank < remainder ? 1 : 0);
+        result.reserve(end - first);
+        for (uint64_t state = first; state < end; ++state) {
+            result.push_back(state);
+        }
+    }
+    return result;
+}
+
+uint64_t DistributedStatePartition::getNumberOfStates() const {
+    return numberOfStates;
+}
+
+uint64_t DistributedStatePartition::getNumberOfRanks() const {
+    return numberOfRanks;
+}
+
+template<storm::OptimizationDirection Dir, bool Relative>
+class DistributedVIBackend {
+   public:
+    DistributedVIBackend(double precision) : precision{precision} {
+        // intentionally empty
+    }
+
+    void startNewIteration() {
+        isConverged = true;
+    }
+
+    void firstRow(double&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best = std::move(value);
+    }
+
+    void nextRow(double&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best &= value;
+    }
+
+    void applyUpdate(double& currValue, [[maybe_unused]] uint64_t rowGroup) {
+        if (isConverged) {
+            if constexpr (Relative) {
+                isConverged = storm::utility::abs<double>(currValue - *best) <= storm::utility::abs<double>(precision * currValue);
+            } else {
+                isConverged = storm::utility::abs<double>(currValue - *best) <= precision;
+            }
+        }
+        currValue = *best;
+    }
+
+    void endOfIteration() const {
+        // intentionally left empty.
+    }
+
+    void merge(DistributedVIBackend const& other) {
+        isConverged &= other.isConverged;
+    }
+
+    bool converged() const {
+        return isConverged;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+   private:
+    storm::utility::Extremum<Dir, double> best;
+    double const precision;
+    bool isConverged{true};
+};
+
+template<bool TrivialRowGrouping>
+DistributedValueIterationHelper<TrivialRowGrouping>::DistributedValueIterationHelper(storm::storage::SparseMatrix<double> const& matrix,
+                                                                                     storm::utility::mpi::StatePartitioning partitioning,
+                                                                                     uint64_t numberOfThreads,
+                                                                                     storm::utility::mpi::Communicator const& communicator)
+    : communicator(communicator), partition(matrix.getRowGroupCount(), communicator.getNumberOfRanks(), partitioning) {
+    initialize(matrix, 0, numberOfThreads);
+}
+
+template<bool TrivialRowGrouping>
+DistributedValueIterationHelper<TrivialRowGrouping>::DistributedValueIterationHelper(storm::storage::SparseMatrix<double> const& localRows,
+                                                                                     std::vector<uint64_t> const& firstStateOfRank,
+                                                                                     uint64_t numberOfThreads,
+                                                                                     storm::utility::mpi::Communicator const& communicator)
+    : communicator(communicator), partition(firstStateOfRank) {
+    STORM_LOG_THROW(partition.getNumberOfRanks() == communicator.getNumberOfRanks(), storm::exceptions::InvalidArgumentException,
+                    "Expected one range of states per process.");
+    uint64_t const rank = communicator.getRank();
+    STORM_LOG_THROW(localRows.getRowGroupCount() == firstStateOfRank[rank + 1] - firstStateOfRank[rank] &&
+                        localRows.getColumnCount() <= partition.getNumberOfStates(),
+                    storm::exceptions::InvalidArgumentException, "The local rows do not match the dimensions of the distributed matrix.");
+    initialize(localRows, firstStateOfRank[rank], numberOfThreads);
+}
+
+template<bool TrivialRowGrouping>
+void DistributedValueIterationHelper<TrivialRowGrouping>::initialize(storm::storage::SparseMatrix<double> const& matrix, uint64_t rowGroupOffset,
+                                                                     uint64_t numberOfThreads) {
+    STORM_LOG_THROW(!TrivialRowGrouping || matrix.hasTrivialRowGrouping(), storm::exceptions::InvalidArgumentException,
+                    "Expected a matrix with trivial row grouping.");
+    storm::utility::ProfilerPhase phase("distributed-vi-setup");
+    uint64_t const rank = communicator.getRank();
+    uint64_t const numberOfRanks = communicator.getNumberOfRanks();
+    ownedStates = partition.getOwnedStates(rank);
+    auto getLocalIndexOfOwnedState = [this](uint64_t state) {
+        auto it = std::lower_bound(ownedStates.begin(), ownedStates.end(), state);
+        STORM_LOG_ASSERT(it != ownedStates.end() && *it == state, "State " << state << " is not owned by this process.");
+        return static_cast<uint64_t>(it - ownedStates.begin());
+    };
+
+    // Collect the successors owned by other processes, grouped by their owner.
+    uint64_t numberOfOwnedRows = 0;
+    uint64_t numberOfOwnedEntries = 0;
+    for (auto const& state : ownedStates) {
+        for (uint64_t row = matrix.getRowGroupIndices()[state - rowGroupOffset]; row < matrix.getRowGroupIndices()[state - rowGroupOffset + 1]; ++row) {
+            ++numberOfOwnedRows;
+            for (auto const& entry : matrix.getRow(row)) {
+                ++numberOfOwnedEntries;
+                if (partition.getOwner(entry.getColumn()) != rank) {
+                    ghostStates.push_back(entry.getColumn());
+                }
+            }
+        }
+    }
+    std::sort(ghostStates.begin(), ghostStates.end(), [this](uint64_t const& lhs, uint64_t const& rhs) {
+        uint64_t const lhsOwner = partition.getOwner(lhs);
+        uint64_t const rhsOwner = partition.getOwner(rhs);
+        return lhsOwner < rhsOwner || (lhsOwner == rhsOwner && lhs < rhs);
+    });
+    ghostStates.erase(std::unique(ghostStates.begin(), ghostStates.end()), ghostStates.end());
+    std::unordered_map<uint64_t, uint64_t> localIndexOfGhostState;
+    std::vector<std::vector<uint64_t>> requestedStates(numberOfRanks);
+    for (uint64_t ghost = 0; ghost < ghostStates.size(); ++ghost) {
+        localIndexOfGhostState.emplace(ghostStates[ghost], ownedStates.size() + ghost);
+        requestedStates[partition.getOwner(ghostStates[ghost])].push_back(ghostStates[ghost]);
+    }
+
+    // Tell every owner which of its states are needed here.
+    receiveCounts.resize(numberOfRanks);
+    for (uint64_t peer = 0; peer < numberOfRanks; ++peer) {
+        receiveCounts[peer] = requestedStates[peer].size();
+    }
+    std::vector<uint64_t> sendCounts = communicator.allToAll(receiveCounts);
+    std::vector<std::vector<uint64_t>> statesToSend(numberOfRanks);
+    for (uint64_t peer = 0; peer < numberOfRanks; ++peer) {
+        statesToSend[peer].resize(sendCounts[peer]);
+    }
+    communicator.exchange(requestedStates, statesToSend);
+    sendIndices.resize(numberOfRanks);
+    sendBuffers.resize(numberOfRanks);
+    receiveBuffers.resize(numberOfRanks);
+    for (uint64_t peer = 0; peer < numberOfRanks; ++peer) {
+        sendIndices[peer].reserve(statesToSend[peer].size());
+        for (auto const& state : statesToSend[peer]) {
+            sendIndices[peer].push_back(getLocalIndexOfOwnedState(state));
+        }
+        sendBuffers[peer].resize(sendIndices[peer].size());
+        receiveBuffers[peer].resize(receiveCounts[peer]);
+    }
+
+    // Build the local matrix. As the ghost states are numbered after the owned states, the columns of a row have to be sorted again.
+    uint64_t const numberOfLocalStates = ownedStates.size() + ghostStates.size();
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfOwnedRows + ghostStates.size(), numberOfLocalStates,
+                                                        numberOfOwnedEntries + ghostStates.size(), true, !TrivialRowGrouping,
+                                                        TrivialRowGrouping ? 0 : numberOfLocalStates);
+    ownedRows.reserve(numberOfOwnedRows);
+    std::vector<std::pair<uint64_t, double>> rowEntries;
+    for (auto const& state : ownedStates) {
+        if constexpr (!TrivialRowGrouping) {
+            builder.newRowGroup(ownedRows.size());
+        }
+        for (uint64_t row = matrix.getRowGroupIndices()[state - rowGroupOffset]; row < matrix.getRowGroupIndices()[state - rowGroupOffset + 1]; ++row) {
+            rowEntries.clear();
+            for (auto const& entry : matrix.getRow(row)) {
+                uint64_t const column = entry.getColumn();
+                uint64_t const localColumn = partition.getOwner(column) == rank ? getLocalIndexOfOwnedState(column) : localIndexOfGhostState.at(column);
+                rowEntries.emplace_back(localColumn, entry.getValue());
+            }
+            std::sort(rowEntries.begin(), rowEntries.end());
+            for (auto const& [localColumn, value] : rowEntries) {
+                builder.addNextValue(ownedRows.size(), localColumn, value);
+            }
+            ownedRows.push_back(row);
+        }
+    }
+    for (uint64_t ghost = 0; ghost < ghostStates.size(); ++ghost) {
+        uint64_t const localRow = numberOfOwnedRows + ghost;
+        if constexpr (!TrivialRowGrouping) {
+            builder.newRowGroup(localRow);
+        }
+        builder.addNextValue(localRow, ownedStates.size() + ghost, storm::utility::one<double>());
+    }
+    localMatrix = builder.build(numberOfOwnedRows + ghostStates.size(), numberOfLocalStates, TrivialRowGrouping ? 0 : numberOfLocalStates);
+
+    // A process might not own any state (e.g. if there are more processes than states).
+    if (numberOfLocalStates > 0) {
+        localOperator = std::make_shared<ValueIterationOperator<double, TrivialRowGrouping>>();
+        localOperator->setMatrixBackwards(localMatrix);
+        localOperator->setNumberOfThreads(numberOfThreads);
+    }
+    phase.addCounter("ghost-states", ghostStates.size());
+    STORM_LOG_INFO("Process " << rank << " owns " << ownedStates.size() << " states (" << numberOfOwnedEntries << " transitions) and copies the values of "
+                              << ghostStates.size() << " states of other processes.");
+}
+
+template<bool TrivialRowGrouping>
+void DistributedValueIterationHelper<TrivialRowGrouping>::exchangeGhostValues(std::vector<double>& localOperand) const {
+    for (uint64_t peer = 0; peer < sendIndices.size(); ++peer) {
+        auto bufferIt = sendBuffers[peer].begin();
+        for (auto const& index : sendIndices[peer]) {
+            *bufferIt = localOperand[index];
+            ++bufferIt;
+        }
+    }
+    communicator.exchange(sendBuffers, receiveBuffers);
+    // The ghost states are grouped by their owner (in ascending order).
+    auto operandIt = localOperand.begin() + ownedStates.size();
+    for (auto const& buffer : receiveBuffers) {
+        operandIt = std::copy(buffer.begin(), buffer.end(), operandIt);
+    }
+}
+
+template<bool TrivialRowGrouping>
+template<storm::OptimizationDirection Dir, bool Relative>
+SolverStatus DistributedValueIterationHelper<TrivialRowGrouping>::VI(std::vector<double>& localOperand, std::vector<double> const& localOffsets,
+                                                                     uint64_t& numIterations, double precision, uint64_t maximalNumberOfIterations) const {
+    DistributedVIBackend<Dir, Relative> backend{precision};
+    SolverStatus status{SolverStatus::InProgress};
+    while (status == SolverStatus::InProgress) {
+        ++numIterations;
+        // Within a process, the values are updated in place (Gauss-Seidel). Across processes, the values of the previous iteration are used.
+        bool const converged = !localOperator || localOperator->applyInPlace(localOperand, localOffsets, backend);
+        exchangeGhostValues(localOperand);
+        if (communicator.allReduceAnd(converged)) {
+            status = SolverStatus::Converged;
+        } else if (communicator.allReduceOr(storm::utility::resources::isTerminate())) {
+            status = SolverStatus::Aborted;
+        } else if (numIterations >= maximalNumberOfIterations) {
+            status = SolverStatus::MaximalIterationsExceeded;
+        }
+    }
+    return status;
+}
+
+template<bool TrivialRowGrouping>
+SolverStatus DistributedValueIterationHelper<TrivialRowGrouping>::VI(std::vector<double>& operand, std::vector<double> const& offsets,
+                                                                     uint64_t& numIterations, bool relative, double precision,
+                                                                     std::optional<storm::OptimizationDirection> const& dir,
+                                                                     uint64_t maximalNumberOfIterations) const {
+    STORM_LOG_THROW(TrivialRowGrouping || dir.has_value(), storm::exceptions::InvalidArgumentException, "No optimization direction given.");
+    STORM_LOG_THROW(operand.size() == partition.getNumberOfStates(), storm::exceptions::InvalidArgumentException,
+                    "The operand does not match the dimensions of the matrix.");
+    storm::utility::ProfilerPhase phase("distributed-vi");
+
+    // Extract the values of the local states.
+    std::vector<double> localOperand;
+    localOperand.reserve(ownedStates.size() + ghostStates.size());
+    for (auto const& state : ownedStates) {
+        localOperand.push_back(operand[state]);
+    }
+    for (auto const& state : ghostStates) {
+        localOperand.push_back(operand[state]);
+    }
+    SolverStatus status = solveLocally(localOperand, getLocalOffsets(offsets), numIterations, relative, precision, dir, maximalNumberOfIterations);
+
+    // Collect the values of all states. The values of each process are ordered by the state indices, so they can be distributed in a single pass.
+    std::vector<uint64_t> counts(partition.getNumberOfRanks(), 0);
+    for (uint64_t state = 0; state < partition.getNumberOfStates(); ++state) {
+        ++counts[partition.getOwner(state)];
+    }
+    localOperand.resize(ownedStates.size());
+    std::vector<double> allValues = communicator.allGather(localOperand, counts);
+    std::vector<uint64_t> positions(partition.getNumberOfRanks(), 0);
+    for (uint64_t rank = 1; rank < partition.getNumberOfRanks(); ++rank) {
+        positions[rank] = positions[rank - 1] + counts[rank - 1];
+    }
+    for (uint64_t state = 0; state < partition.getNumberOfStates(); ++state) {
+        operand[state] = allValues[positions[partition.getOwner(state)]++];
+    }
+    phase.addCounter("iterations", numIterations);
+    return status;
+}
+
+template<bool TrivialRowGrouping>
+SolverStatus DistributedValueIterationHelper<TrivialRowGrouping>::VIOnOwnedStates(std::vector<double>& ownedValues, std::vector<double> const& ownedOffsets,
+                                                                                  uint64_t& numIterations, bool relative, double precision,
+                                                                                  std::optional<storm::OptimizationDirection> const& dir,
+                                                                                  uint64_t maximalNumberOfIterations) const {
+    STORM_LOG_THROW(TrivialRowGrouping || dir.has_value(), storm::exceptions::InvalidArgumentException, "No optimization direction given.");
+    STORM_LOG_THROW(ownedValues.size() == ownedStates.size(), storm::exceptions::InvalidArgumentException,
+                    "The number of values does not match the number of owned states.");
+    storm::utility::ProfilerPhase phase("distributed-vi");
+
+    // The initial values of the ghost states are obtained from their owners.
+    std::vector<double> localOperand(ownedStates.size() + ghostStates.size());
+    std::copy(ownedValues.begin(), ownedValues.end(), localOperand.begin());
+    exchangeGhostValues(localOperand);
+    SolverStatus status = solveLocally(localOperand, getLocalOffsets(ownedOffsets), numIterations, relative, precision, dir, maximalNumberOfIterations);
+    std::copy(localOperand.begin(), localOperand.begin() + ownedStates.size(), ownedValues.begin());
+    phase.addCounter("iterations", numIterations);
+    return status;
+}
+
+template<bool TrivialRowGrouping>
+std::vector<double> DistributedValueIterationHelper<TrivialRowGrouping>::getLocalOffsets(std::vector<double> const& offsets) const {
+    std::vector<double> localOffsets;
+    localOffsets.reserve(ownedRows.size() + ghostStates.size());
+    for (auto const& row : ownedRows) {
+        STORM_LOG_ASSERT(row < offsets.size(), "The offsets do not match the dimensions of the matrix.");
+        localOffsets.push_back(offsets[row]);
+    }
+    localOffsets.resize(ownedRows.size() + ghostStates.size(), storm::utility::zero<double>());
+    return localOffsets;
+}
+
+template<bool TrivialRowGrouping>
+SolverStatus DistributedValueIterationHelper<TrivialRowGrouping>::solveLocally(std::vector<double>& localOperand, std::vector<double> const& localOffsets,
+                                                                               uint64_t& numIterations, bool relative, double precision,
+                                                                               std::optional<storm::OptimizationDirection> const& dir,
+                                                                               uint64_t maximalNumberOfIterations) const {
+    numIterations = 0;
+    if (!dir.has_value() || maximize(*dir)) {
+        if (relative) {
+            return VI<storm::OptimizationDirection::Maximize, true>(localOperand, localOffsets, numIterations, precision, maximalNumberOfIterations);
+        }
+        return VI<storm::OptimizationDirection::Maximize, false>(localOperand, localOffsets, numIterations, precision, maximalNumberOfIterations);
+    }
+    if (relative) {
+        return VI<storm::OptimizationDirection::Minimize, true>(localOperand, localOffsets, numIterations, precision, maximalNumberOfIterations);
+    }
+    return VI<storm::OptimizationDirection::Minimize, false>(localOperand, localOffsets, numIterations, precision, maximalNumberOfIterations);
+}
+
+template<bool TrivialRowGrouping>
+std::vector<uint64_t> const& DistributedValueIterationHelper<TrivialRowGrouping>::getOwnedStates() const {
+    return ownedStates;
+}
+
+template<bool TrivialRowGrouping>
+uint64_t DistributedValueIterationHelper<TrivialRowGrouping>::getNumberOfOwnedStates() const {
+    return ownedStates.size();
+}
+
+template<bool TrivialRowGrouping>
+uint64_t DistributedValueIterationHelper<TrivialRowGrouping>::getNumberOfGhostStates() const {
+    return ghostStates.size();
+}
+
+template class DistributedValueIterationHelper<true>;
+template class DistributedValueIterationHelper<false>;
+
+}  // namespace storm::solver::helper
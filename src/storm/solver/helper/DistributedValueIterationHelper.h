@@ -0,0 +1,181 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/solver/helper/ValueIterationOperatorForward.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/mpi.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * Assigns the states of a model to the processes of a distributed computation.
+ */
+class DistributedStatePartition {
+   public:
+    DistributedStatePartition(uint64_t numberOfStates, uint64_t numberOfRanks, storm::utility::mpi::StatePartitioning partitioning);
+
+    /*!
+     * Creates a partition in which every process owns a contiguous range of states.
+     *
+     * @param firstStateOfRank For every process, the first state it owns, followed by the total number of states.
+     */
+    explicit DistributedStatePartition(std::vector<uint64_t> const& firstStateOfRank);
+
+    /*!
+     * Retrieves the process that owns the given state.
+     */
+    uint64_t getOwner(uint64_t state) const;
+
+    /*!
+     * Retrieves the states owned by the given process (in ascending order).
+     */
+    std::vector<uint64_t> getOwnedStates(uint64_t rank) const;
+
+    uint64_t getNumberOfStates() const;
+    uint64_t getNumberOfRanks() const;
+
+   private:
+    uint64_t numberOfStates;
+    uint64_t numberOfRanks;
+    storm::utility::mpi::StatePartitioning partitioning;
+    // If not empty, the explicitly given ranges of states (which take precedence over the partitioning).
+    std::vector<uint64_t> firstStateOfRank;
+};
+
+/*!
+ * Performs value iteration with the row groups (states) of the matrix distributed over the processes of an MPI job. Every process applies the value
+ * iteration operator to the states it owns. For the successors owned by other processes (the ghost states), it keeps copies whose values are exchanged
+ * with their owners after every iteration. Convergence is decided jointly by all processes.
+ *
+ * @tparam TrivialRowGrouping True iff the underlying model is deterministic
+ */
+template<bool TrivialRowGrouping>
+class DistributedValueIterationHelper {
+   public:
+    /*!
+     * Sets up the local part of the matrix. This is a collective operation.
+     *
+     * @param matrix The complete matrix. All processes have to pass the same matrix, of which each one only keeps the rows of the states it owns.
+     * @param partitioning Determines which process owns which state.
+     * @param numberOfThreads The number of threads each process uses for the local iterations.
+     * @param communicator The processes among which the states are distributed.
+     */
+    DistributedValueIterationHelper(storm::storage::SparseMatrix<double> const& matrix, storm::utility::mpi::StatePartitioning partitioning,
+                                    uint64_t numberOfThreads = 1,
+                                    storm::utility::mpi::Communicator const& communicator = storm::utility::mpi::Communicator::world());
+
+    /*!
+     * Sets up the local part of a matrix that is already distributed over the processes (e.g. because the processes built it in a distributed
+     * fashion). This is a collective operation.
+     *
+     * @param localRows The row groups of the states owned by this process. The columns refer to the global state indices.
+     * @param firstStateOfRank For every process, the (global) index of the first state it owns, followed by the total number of states.
+     * @param numberOfThreads The number of threads each process uses for the local iterations.
+     * @param communicator The processes among which the states are distributed.
+     */
+    DistributedValueIterationHelper(storm::storage::SparseMatrix<double> const& localRows, std::vector<uint64_t> const& firstStateOfRank,
+                                    uint64_t numberOfThreads = 1,
+                                    storm::utility::mpi::Communicator const& communicator = storm::utility::mpi::Communicator::world());
+
+    // The local operator refers to the row grouping of the local matrix.
+    DistributedValueIterationHelper(DistributedValueIterationHelper const& other) = delete;
+    DistributedValueIterationHelper& operator=(DistributedValueIterationHelper const& other) = delete;
+
+    /*!
+     * Iterates until no value of any process changes by more than the precision in the same iteration. This is a collective operation.
+     *
+     * @param operand The initial values (of all states). Is overwritten with the result, which is then available at all processes.
+     * @param offsets The offset of each row (of the complete matrix).
+     * @param numIterations Is set to the number of performed iterations.
+     * @param relative Whether the precision is relative to the current values.
+     * @param precision The precision used to detect convergence.
+     * @param dir The optimization direction. Is required if the row grouping is not trivial.
+     * @param maximalNumberOfIterations The maximal number of iterations.
+     */
+    SolverStatus VI(std::vector<double>& operand, std::vector<double> const& offsets, uint64_t& numIterations, bool relative, double precision,
+                    std::optional<storm::OptimizationDirection> const& dir = {},
+                    uint64_t maximalNumberOfIterations = std::numeric_limits<uint64_t>::max()) const;
+
+    /*!
+     * Like VI, but only takes and returns the values of the states owned by this process, which are never gathered at a single process. This is a
+     * collective operation.
+     *
+     * @param ownedValues The initial values of the owned states (in ascending order). Is overwritten with the result.
+     * @param ownedOffsets The offset of each row that belongs to an owned state (in the order of the rows of the matrix given at construction).
+     */
+    SolverStatus VIOnOwnedStates(std::vector<double>& ownedValues, std::vector<double> const& ownedOffsets, uint64_t& numIterations, bool relative,
+                                 double precision, std::optional<storm::OptimizationDirection> const& dir = {},
+                                 uint64_t maximalNumberOfIterations = std::numeric_limits<uint64_t>::max()) const;
+
+    /*!
+     * Retrieves the (global) indices of the states owned by this process in ascending order.
+     */
+    std::vector<uint64_t> const& getOwnedStates() const;
+
+    /*!
+     * Retrieves the number of states owned by this process.
+     */
+    uint64_t getNumberOfOwnedStates() const;
+
+    /*!
+     * Retrieves the number of states whose values this process copies from other processes.
+     */
+    uint64_t getNumberOfGhostStates() const;
+
+   private:
+    /*!
+     * Builds the local matrix and determines which values have to be exchanged with which process.
+     *
+     * @param matrix A matrix that contains the row groups of all owned states.
+     * @param rowGroupOffset The rows of each owned state s form the row group s - rowGroupOffset of the matrix.
+     */
+    void initialize(storm::storage::SparseMatrix<double> const& matrix, uint64_t rowGroupOffset, uint64_t numberOfThreads);
+
+    /*!
+     * Performs the iterations on the given local values in the given direction.
+     */
+    SolverStatus solveLocally(std::vector<double>& localOperand, std::vector<double> const& localOffsets, uint64_t& numIterations, bool relative,
+                              double precision, std::optional<storm::OptimizationDirection> const& dir, uint64_t maximalNumberOfIterations) const;
+
+    /*!
+     * Extracts the offsets of the local rows. The ghost states obtain offset zero.
+     */
+    std::vector<double> getLocalOffsets(std::vector<double> const& offsets) const;
+
+    template<storm::OptimizationDirection Dir, bool Relative>
+    SolverStatus VI(std::vector<double>& localOperand, std::vector<double> const& localOffsets, uint64_t& numIterations, double precision,
+                    uint64_t maximalNumberOfIterations) const;
+
+    /*!
+     * Sends the values of the owned states that other processes need and writes the received values to the ghost states.
+     */
+    void exchangeGhostValues(std::vector<double>& localOperand) const;
+
+    storm::utility::mpi::Communicator const& communicator;
+    DistributedStatePartition partition;
+
+    // The global indices of the owned states (which come first in the local numbering) and the ghost states (which follow, grouped by their owner).
+    std::vector<uint64_t> ownedStates;
+    std::vector<uint64_t> ghostStates;
+    // For each owned row (in local order), its row in the matrix given at construction.
+    std::vector<uint64_t> ownedRows;
+
+    // For each process, the local indices of the owned states whose values it receives, and the number of ghost states that it owns.
+    std::vector<std::vector<uint64_t>> sendIndices;
+    std::vector<uint64_t> receiveCounts;
+    mutable std::vector<std::vector<double>> sendBuffers;
+    mutable std::vector<std::vector<double>> receiveBuffers;
+
+    // The local matrix over the owned and ghost states. Every ghost state has a single row with a self-loop, so it keeps its value in the iterations.
+    storm::storage::SparseMatrix<double> localMatrix;
+    std::shared_ptr<ValueIterationOperator<double, TrivialRowGrouping>> localOperator;
+};
+
+}  // namespace storm::solver::helper
@@ -41,6 +41,10 @@ class IIBackend {
         // intentionally left empty.
     }
 
+    void merge(IIBackend const&) {
+        // intentionally left empty, there is no state to combine.
+    }
+
     bool constexpr converged() const {
         return false;
     }
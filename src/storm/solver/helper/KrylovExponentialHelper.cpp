@@ -0,0 +1,407 @@
+#include "storm/solver/helper/KrylovExponentialHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/solver/LinearEquationSolver.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/PrecisionExceededException.h"
+#include "storm/exceptions/UncheckedRequirementException.h"
+
+namespace storm::solver::helper {
+
+namespace {
+// The maximal dimension of the Krylov subspaces.
+uint64_t const MaximalKrylovDimension = 40;
+// The shift is this fraction of the time span that the subspace is built for.
+double const ShiftFraction = 0.1;
+// If the Krylov subspace is not accurate enough for a time span, the span is halved at most this many times.
+uint64_t const MaximalNumberOfHalvings = 30;
+// If the orthogonalization reduces the norm of a new vector below this fraction, the subspace is invariant and the approximation is exact.
+double const BreakdownTolerance = 1e-12;
+// The linear equation systems are solved with this fraction of the requested precision.
+double const SolverPrecisionFactor = 1e-2;
+
+template<typename ValueType>
+ValueType twoNorm(std::vector<ValueType> const& vector) {
+    ValueType result = storm::utility::zero<ValueType>();
+    for (auto const& value : vector) {
+        result += value * value;
+    }
+    return std::sqrt(result);
+}
+
+// Overwrites the given (row-major) right-hand sides with the solution of matrix*X = rightHandSides using Gaussian elimination with partial pivoting.
+template<typename ValueType>
+void solveDenseSystem(std::vector<ValueType> matrix, std::vector<ValueType>& rightHandSides, uint64_t dimension) {
+    auto index = [dimension](uint64_t row, uint64_t column) { return row * dimension + column; };
+    for (uint64_t pivot = 0; pivot < dimension; ++pivot) {
+        uint64_t pivotRow = pivot;
+        for (uint64_t row = pivot + 1; row < dimension; ++row) {
+            if (std::abs(matrix[index(row, pivot)]) > std::abs(matrix[index(pivotRow, pivot)])) {
+                pivotRow = row;
+            }
+        }
+        if (pivotRow != pivot) {
+            for (uint64_t column = 0; column < dimension; ++column) {
+                std::swap(matrix[index(pivot, column)], matrix[index(pivotRow, column)]);
+                std::swap(rightHandSides[index(pivot, column)], rightHandSides[index(pivotRow, column)]);
+            }
+        }
+        for (uint64_t row = pivot + 1; row < dimension; ++row) {
+            ValueType const factor = matrix[index(row, pivot)] / matrix[index(pivot, pivot)];
+            if (factor != storm::utility::zero<ValueType>()) {
+                for (uint64_t column = pivot; column < dimension; ++column) {
+                    matrix[index(row, column)] -= factor * matrix[index(pivot, column)];
+                }
+                for (uint64_t column = 0; column < dimension; ++column) {
+                    rightHandSides[index(row, column)] -= factor * rightHandSides[index(pivot, column)];
+                }
+            }
+        }
+    }
+    for (uint64_t row = dimension; row > 0; --row) {
+        for (uint64_t column = 0; column < dimension; ++column) {
+            ValueType value = rightHandSides[index(row - 1, column)];
+            for (uint64_t k = row; k < dimension; ++k) {
+                value -= matrix[index(row - 1, k)] * rightHandSides[index(k, column)];
+            }
+            rightHandSides[index(row - 1, column)] = value / matrix[index(row - 1, row - 1)];
+        }
+    }
+}
+
+// Computes the exponential of the given (row-major) dense matrix with the diagonal Pade approximation of degree six and scaling and squaring.
+template<typename ValueType>
+std::vector<ValueType> computeDenseExponential(std::vector<ValueType> matrix, uint64_t dimension) {
+    auto product = [dimension](std::vector<ValueType> const& first, std::vector<ValueType> const& second) {
+        std::vector<ValueType> result(dimension * dimension, storm::utility::zero<ValueType>());
+        for (uint64_t row = 0; row < dimension; ++row) {
+            for (uint64_t k = 0; k < dimension; ++k) {
+                ValueType const factor = first[row * dimension + k];
+                if (factor != storm::utility::zero<ValueType>()) {
+                    for (uint64_t column = 0; column < dimension; ++column) {
+                        result[row * dimension + column] += factor * second[k * dimension + column];
+                    }
+                }
+            }
+        }
+        return result;
+    };
+
+    // Scale the matrix such that its infinity norm is at most one half.
+    ValueType norm = storm::utility::zero<ValueType>();
+    for (uint64_t row = 0; row < dimension; ++row) {
+        ValueType rowSum = storm::utility::zero<ValueType>();
+        for (uint64_t column = 0; column < dimension; ++column) {
+            rowSum += std::abs(matrix[row * dimension + column]);
+        }
+        norm = std::max(norm, rowSum);
+    }
+    int numberOfSquarings = 0;
+    while (norm > static_cast<ValueType>(0.5)) {
+        norm /= 2;
+        ++numberOfSquarings;
+    }
+    for (auto& entry : matrix) {
+        entry = std::ldexp(entry, -numberOfSquarings);
+    }
+
+    // Evaluate the numerator and the denominator of the Pade approximant.
+    uint64_t const degree = 6;
+    std::vector<ValueType> numerator(dimension * dimension, storm::utility::zero<ValueType>());
+    for (uint64_t row = 0; row < dimension; ++row) {
+        numerator[row * dimension + row] = storm::utility::one<ValueType>();
+    }
+    std::vector<ValueType> denominator = numerator;
+    std::vector<ValueType> power = numerator;
+    ValueType coefficient = storm::utility::one<ValueType>();
+    for (uint64_t k = 1; k <= degree; ++k) {
+        coefficient *= static_cast<ValueType>(degree + 1 - k) / static_cast<ValueType>(k * (2 * degree + 1 - k));
+        power = product(power, matrix);
+        ValueType const sign = k % 2 == 0 ? storm::utility::one<ValueType>() : -storm::utility::one<ValueType>();
+        for (uint64_t entry = 0; entry < power.size(); ++entry) {
+            numerator[entry] += coefficient * power[entry];
+            denominator[entry] += sign * coefficient * power[entry];
+        }
+    }
+    solveDenseSystem(std::move(denominator), numerator, dimension);
+
+    // Undo the scaling.
+    for (int squaring = 0; squaring < numberOfSquarings; ++squaring) {
+        numerator = product(numerator, numerator);
+    }
+    return numerator;
+}
+
+// The coefficients of the approximation with the given Hessenberg matrix, i.e., beta * exp(time/shift * (I - H^-1)) * e_1 for the leading
+// dimension x dimension block H of the given matrix with the given row length.
+template<typename ValueType>
+std::vector<ValueType> computeCoefficients(std::vector<ValueType> const& hessenberg, uint64_t rowLength, uint64_t dimension, ValueType const& beta,
+                                           ValueType const& time, ValueType const& shift) {
+    std::vector<ValueType> matrix(dimension * dimension);
+    std::vector<ValueType> inverse(dimension * dimension, storm::utility::zero<ValueType>());
+    for (uint64_t row = 0; row < dimension; ++row) {
+        for (uint64_t column = 0; column < dimension; ++column) {
+            matrix[row * dimension + column] = hessenberg[row * rowLength + column];
+        }
+        inverse[row * dimension + row] = storm::utility::one<ValueType>();
+    }
+    solveDenseSystem(std::move(matrix), inverse, dimension);
+    ValueType const factor = time / shift;
+    for (uint64_t row = 0; row < dimension; ++row) {
+        for (uint64_t column = 0; column < dimension; ++column) {
+            ValueType const identity = row == column ? storm::utility::one<ValueType>() : storm::utility::zero<ValueType>();
+            inverse[row * dimension + column] = factor * (identity - inverse[row * dimension + column]);
+        }
+    }
+    std::vector<ValueType> exponential = computeDenseExponential(std::move(inverse), dimension);
+    std::vector<ValueType> coefficients(dimension);
+    for (uint64_t row = 0; row < dimension; ++row) {
+        coefficients[row] = beta * exponential[row * dimension];
+    }
+    return coefficients;
+}
+}  // namespace
+
+template<typename ValueType>
+KrylovExponentialHelper<ValueType>::KrylovExponentialHelper(storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                            std::vector<ValueType> const* addVector, ValueType const& uniformizationRate)
+    : uniformizedMatrix(uniformizedMatrix), addVector(addVector), uniformizationRate(uniformizationRate), shift(storm::utility::zero<ValueType>()) {
+    STORM_LOG_ASSERT(uniformizedMatrix.getRowCount() == uniformizedMatrix.getColumnCount(), "Expected a square matrix.");
+}
+
+template<typename ValueType>
+KrylovExponentialHelper<ValueType>::~KrylovExponentialHelper() = default;
+
+template<typename ValueType>
+void KrylovExponentialHelper<ValueType>::createSolver(Environment const& env, ValueType const& newShift) const {
+    // I - shift*G = (1 + shift*q) * (I - c*P) for c = shift*q / (1 + shift*q). Hence, the system is y = c*P*y + u for a scaled right-hand side u.
+    ValueType const scaledRate = newShift * uniformizationRate;
+    ValueType const factor = scaledRate / (storm::utility::one<ValueType>() + scaledRate);
+    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+    bool const convertToEquationSystem =
+        linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+    auto requirements = linearEquationSolverFactory.getRequirements(env);
+    requirements.clearLowerBounds();
+    requirements.clearUpperBounds();
+    STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
+                    "Solver requirements " + requirements.getEnabledRequirementsAsString() + " not checked.");
+
+    uint64_t const numberOfStates = uniformizedMatrix.getRowCount();
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfStates, numberOfStates, uniformizedMatrix.getEntryCount() + numberOfStates);
+    for (uint64_t row = 0; row < numberOfStates; ++row) {
+        bool diagonalInserted = !convertToEquationSystem;
+        for (auto const& entry : uniformizedMatrix.getRow(row)) {
+            if (!diagonalInserted && entry.getColumn() >= row) {
+                if (entry.getColumn() > row) {
+                    builder.addNextValue(row, row, storm::utility::one<ValueType>());
+                }
+                diagonalInserted = true;
+            }
+            if (!convertToEquationSystem) {
+                builder.addNextValue(row, entry.getColumn(), factor * entry.getValue());
+            } else if (entry.getColumn() == row) {
+                builder.addNextValue(row, row, storm::utility::one<ValueType>() - factor * entry.getValue());
+            } else {
+                builder.addNextValue(row, entry.getColumn(), -factor * entry.getValue());
+            }
+        }
+        if (!diagonalInserted) {
+            builder.addNextValue(row, row, storm::utility::one<ValueType>());
+        }
+    }
+    solver = linearEquationSolverFactory.create(env, builder.build());
+    solver->setCachingEnabled(true);
+    shift = newShift;
+    solverRightHandSide.resize(numberOfStates);
+    solverSolution.resize(numberOfStates);
+}
+
+template<typename ValueType>
+void KrylovExponentialHelper<ValueType>::applyShiftedInverse(Environment const& env, std::vector<ValueType> const& vector,
+                                                             std::vector<ValueType>& result) const {
+    // (I - shift*G) * y = v + shift*r*s for the vector (v, s), which is divided by 1 + shift*q for the scaled system.
+    ValueType const scaledRate = shift * uniformizationRate;
+    ValueType const scaling = storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() + scaledRate);
+    ValueType lower = storm::utility::zero<ValueType>();
+    ValueType upper = storm::utility::zero<ValueType>();
+    for (uint64_t row = 0; row < solverRightHandSide.size(); ++row) {
+        ValueType value = vector[row];
+        if (addVector) {
+            value += scaledRate * (*addVector)[row] * vector.back();
+        }
+        // As P is substochastic, the solution is within the range of the unscaled right-hand side (and zero).
+        lower = std::min(lower, value);
+        upper = std::max(upper, value);
+        solverRightHandSide[row] = value * scaling;
+    }
+    solverSolution = solverRightHandSide;
+    solver->setBounds(lower, upper);
+    solver->solveEquations(env, solverSolution, solverRightHandSide);
+    std::copy(solverSolution.begin(), solverSolution.end(), result.begin());
+    if (addVector) {
+        result.back() = vector.back();
+    }
+}
+
+template<typename ValueType>
+std::vector<std::vector<ValueType>> KrylovExponentialHelper<ValueType>::compute(Environment const& env, std::vector<ValueType> const& timePoints,
+                                                                                std::vector<ValueType> const& initialValues, ValueType const& epsilon) const {
+    uint64_t const numberOfStates = uniformizedMatrix.getRowCount();
+    STORM_LOG_ASSERT(initialValues.size() == numberOfStates, "Unexpected size of the initial values.");
+    std::vector<std::vector<ValueType>> results(timePoints.size());
+    std::vector<bool> finished(timePoints.size(), false);
+    std::vector<uint64_t> order(timePoints.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&timePoints](uint64_t first, uint64_t second) { return timePoints[first] < timePoints[second]; });
+    if (timePoints.empty()) {
+        return results;
+    }
+
+    // The error of the approximation for a time span may be proportional to the length of the span such that the accumulated error stays below epsilon.
+    ValueType const finalTime = timePoints[order.back()];
+    auto tolerance = [&](ValueType const& time) { return epsilon * time / finalTime; };
+    Environment solverEnvironment = env;
+    solverEnvironment.solver().setLinearEquationSolverPrecision(storm::utility::convertNumber<storm::RationalNumber>(epsilon * SolverPrecisionFactor), false);
+
+    std::vector<ValueType> current = initialValues;
+    if (addVector) {
+        current.push_back(storm::utility::one<ValueType>());
+    }
+    uint64_t const dimension = current.size();
+    uint64_t const maximalKrylovDimension = std::min<uint64_t>(MaximalKrylovDimension, dimension);
+    ValueType beta = twoNorm(current);
+    ValueType currentTime = storm::utility::zero<ValueType>();
+
+    // The basis of the Krylov subspace and the Hessenberg matrix of the Arnoldi process.
+    std::vector<std::vector<ValueType>> basis;
+    uint64_t const rowLength = maximalKrylovDimension + 1;
+    std::vector<ValueType> hessenberg(rowLength * rowLength);
+    std::vector<ValueType> image(dimension);
+    uint64_t numberOfSubspaces = 0;
+    uint64_t numberOfSolves = 0;
+
+    for (uint64_t position = 0; position < order.size(); ++position) {
+        uint64_t const timePointIndex = order[position];
+        if (finished[timePointIndex]) {
+            continue;
+        }
+        // The vector stays zero once it is zero.
+        while (currentTime < timePoints[timePointIndex] && beta > storm::utility::zero<ValueType>()) {
+            ValueType const timeSpan = timePoints[timePointIndex] - currentTime;
+            ValueType const newShift = ShiftFraction * timeSpan;
+            if (!solver || newShift != shift) {
+                createSolver(solverEnvironment, newShift);
+            }
+            ++numberOfSubspaces;
+
+            // Extend the subspace until the approximation for the whole time span is accurate enough.
+            basis.assign(1, current);
+            for (auto& value : basis.front()) {
+                value /= beta;
+            }
+            std::fill(hessenberg.begin(), hessenberg.end(), storm::utility::zero<ValueType>());
+            auto estimateError = [&](uint64_t size, ValueType const& time) {
+                std::vector<ValueType> coefficients = computeCoefficients(hessenberg, rowLength, size, beta, time, shift);
+                std::vector<ValueType> previousCoefficients = computeCoefficients(hessenberg, rowLength, size - 1, beta, time, shift);
+                ValueType error = coefficients.back() * coefficients.back();
+                for (uint64_t i = 0; i + 1 < size; ++i) {
+                    error += (coefficients[i] - previousCoefficients[i]) * (coefficients[i] - previousCoefficients[i]);
+                }
+                return std::sqrt(error);
+            };
+            uint64_t size = 0;
+            bool exact = false;
+            bool accurate = false;
+            for (uint64_t j = 0; j < maximalKrylovDimension; ++j) {
+                applyShiftedInverse(solverEnvironment, basis[j], image);
+                ++numberOfSolves;
+                ValueType const imageNorm = twoNorm(image);
+                for (uint64_t i = 0; i <= j; ++i) {
+                    ValueType const coefficient = std::inner_product(basis[i].begin(), basis[i].end(), image.begin(), storm::utility::zero<ValueType>());
+                    hessenberg[i * rowLength + j] = coefficient;
+                    for (uint64_t row = 0; row < dimension; ++row) {
+                        image[row] -= coefficient * basis[i][row];
+                    }
+                }
+                size = j + 1;
+                ValueType const remainingNorm = twoNorm(image);
+                if (remainingNorm <= BreakdownTolerance * imageNorm) {
+                    exact = true;
+                    break;
+                }
+                hessenberg[(j + 1) * rowLength + j] = remainingNorm;
+                if (size > 1 && estimateError(size, timeSpan) <= tolerance(timeSpan)) {
+                    accurate = true;
+                    break;
+                }
+                if (j + 1 < maximalKrylovDimension) {
+                    basis.push_back(image);
+                    for (auto& value : basis.back()) {
+                        value /= remainingNorm;
+                    }
+                }
+            }
+
+            // If the subspace is not accurate enough, cover only a part of the time span.
+            ValueType step = timeSpan;
+            if (!exact && !accurate) {
+                uint64_t halvings = 0;
+                do {
+                    STORM_LOG_THROW(halvings < MaximalNumberOfHalvings && size > 1, storm::exceptions::PrecisionExceededException,
+                                    "The Krylov method could not achieve the requested precision of " << epsilon << ".");
+                    step /= 2;
+                    ++halvings;
+                } while (estimateError(size, step) > tolerance(step));
+            }
+            auto approximate = [&](ValueType const& time, std::vector<ValueType>& result) {
+                std::vector<ValueType> coefficients = computeCoefficients(hessenberg, rowLength, size, beta, time, shift);
+                result.assign(dimension, storm::utility::zero<ValueType>());
+                for (uint64_t i = 0; i < size; ++i) {
+                    for (uint64_t row = 0; row < dimension; ++row) {
+                        result[row] += coefficients[i] * basis[i][row];
+                    }
+                }
+                if (addVector) {
+                    // The constant component is one for all times. Rescaling with it removes the drift that rounding errors cause over long time spans.
+                    ValueType const scaling = storm::utility::one<ValueType>() / result.back();
+                    for (auto& value : result) {
+                        value *= scaling;
+                    }
+                }
+            };
+
+            // Later time points whose approximation with this subspace is accurate enough do not need to be considered again.
+            if (exact || accurate) {
+                for (uint64_t laterPosition = position + 1; laterPosition < order.size(); ++laterPosition) {
+                    uint64_t const laterIndex = order[laterPosition];
+                    ValueType const laterTimeSpan = timePoints[laterIndex] - currentTime;
+                    if (laterTimeSpan > timeSpan && (exact || estimateError(size, laterTimeSpan) <= tolerance(laterTimeSpan))) {
+                        approximate(laterTimeSpan, image);
+                        results[laterIndex].assign(image.begin(), image.begin() + numberOfStates);
+                        finished[laterIndex] = true;
+                    }
+                }
+            }
+            approximate(step, current);
+            beta = twoNorm(current);
+            currentTime = step == timeSpan ? timePoints[timePointIndex] : currentTime + step;
+        }
+        results[timePointIndex].assign(current.begin(), current.begin() + numberOfStates);
+        finished[timePointIndex] = true;
+    }
+    STORM_LOG_DEBUG("Krylov method used " << numberOfSubspaces << " subspaces and solved " << numberOfSolves << " equation systems.");
+    return results;
+}
+
+template class KrylovExponentialHelper<double>;
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace storm {
+class Environment;
+
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
+namespace solver {
+template<typename ValueType>
+class LinearEquationSolver;
+
+namespace helper {
+
+/*!
+ * Computes the solution of the linear differential equation x'(t) = G*x(t) + r with a shift-and-invert Krylov subspace approximation of the matrix
+ * exponential, where G = q*(P - I) and r = q*b are given by a uniformized matrix P, an (optional) add vector b and the uniformization rate q. This is the
+ * equation system that uniformization solves on a CTMC. The add vector is handled by augmenting the system with a constant component.
+ *
+ * The Arnoldi process builds an orthonormal basis V of the Krylov subspace of the current vector w and Z = (I - s*G)^-1 for a shift s that is a fraction of
+ * the considered time span (J. van den Eshof and M. Hochbruck, SIAM J. Sci. Comput. 27(4), 2006). With the Hessenberg matrix H of Z, exp(t*G)*w is then
+ * approximated by |w| * V * exp(t/s * (I - H^-1)) * e_1. As Z damps the fast transitions, a few dozen basis vectors typically cover arbitrarily long time
+ * spans, whereas uniformization needs about q*t matrix-vector multiplications. Every basis vector requires the solution of a linear equation system, which
+ * is delegated to the linear equation solver of the environment.
+ *
+ * The error is estimated by the difference of the approximations with the last two subspaces, i.e., it is not a guaranteed bound. If the estimate does not
+ * meet the requested precision, the time span is split.
+ */
+template<typename ValueType>
+class KrylovExponentialHelper {
+   public:
+    /*!
+     * Prepares the computation for the given uniformized matrix and add vector, which need to remain valid for the lifetime of this object.
+     *
+     * @param addVector If not nullptr, the vector b.
+     */
+    KrylovExponentialHelper(storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector,
+                            ValueType const& uniformizationRate);
+    ~KrylovExponentialHelper();
+
+    /*!
+     * Computes x(t) for the given time points. Later time points are computed with the subspaces of earlier ones whenever this is accurate enough.
+     *
+     * @param initialValues x(0).
+     * @param epsilon The (estimated) error in the 2-norm that is accumulated until the largest time point.
+     * @return x(t) for every given time point (in the given order).
+     */
+    std::vector<std::vector<ValueType>> compute(Environment const& env, std::vector<ValueType> const& timePoints, std::vector<ValueType> const& initialValues,
+                                                ValueType const& epsilon) const;
+
+   private:
+    // Creates the solver for the equation system of I - shift*G.
+    void createSolver(Environment const& env, ValueType const& shift) const;
+    // result = Z * vector, where Z is (I - shift*G)^-1 augmented with the column shift*r (and a one on the diagonal) if there is an add vector.
+    void applyShiftedInverse(Environment const& env, std::vector<ValueType> const& vector, std::vector<ValueType>& result) const;
+
+    storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix;
+    std::vector<ValueType> const* addVector;
+    ValueType uniformizationRate;
+
+    // The solver for the current shift and the vectors passed to it.
+    mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver;
+    mutable ValueType shift;
+    mutable std::vector<ValueType> solverRightHandSide;
+    mutable std::vector<ValueType> solverSolution;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
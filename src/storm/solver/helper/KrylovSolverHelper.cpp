@@ -0,0 +1,387 @@
+#include "storm/solver/helper/KrylovSolverHelper.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm::solver::helper {
+
+namespace {
+// Vector operations are only distributed if every thread obtains at least this many entries as the synchronization would dominate otherwise.
+uint64_t const MinimalEntriesPerThread = 10000;
+}  // namespace
+
+template<typename ValueType>
+KrylovSolverHelper<ValueType>::KrylovSolverHelper(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                  NativeLinearEquationSolverPreconditioner preconditioner, uint64_t numberOfThreads)
+    : matrix(matrix),
+      preconditioner(preconditioner),
+      numberOfThreads(std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, matrix.getRowCount() / MinimalEntriesPerThread))) {
+    STORM_LOG_ASSERT(matrix.getRowCount() == matrix.getColumnCount(), "Expected a square matrix.");
+    if (this->preconditioner == NativeLinearEquationSolverPreconditioner::Ilu) {
+        computeIlu();
+    }
+    if (this->preconditioner == NativeLinearEquationSolverPreconditioner::Diagonal) {
+        inverseDiagonal.assign(matrix.getRowCount(), storm::utility::one<ValueType>());
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            for (auto const& entry : matrix.getRow(row)) {
+                if (entry.getColumn() == row && !storm::utility::isZero(entry.getValue())) {
+                    inverseDiagonal[row] = storm::utility::one<ValueType>() / entry.getValue();
+                }
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+void KrylovSolverHelper<ValueType>::computeIlu() {
+    // The factorization keeps the sparsity pattern of the matrix: L (without its unit diagonal) is stored below and U on and above the diagonal.
+    uint64_t const numberOfRows = matrix.getRowCount();
+    auto const firstEntry = matrix.begin();
+    luValues.reserve(matrix.getEntryCount());
+    for (auto const& entry : matrix) {
+        luValues.push_back(entry.getValue());
+    }
+    diagonalPositions.assign(numberOfRows, 0);
+    // For the current row, maps every column to the position of its entry (or to the number of entries if the row has no entry in that column).
+    uint64_t const noEntry = matrix.getEntryCount();
+    std::vector<uint64_t> positionOfColumn(matrix.getColumnCount(), noEntry);
+    for (uint64_t row = 0; row < numberOfRows; ++row) {
+        uint64_t const rowBegin = matrix.begin(row) - firstEntry;
+        uint64_t const rowEnd = matrix.end(row) - firstEntry;
+        bool hasDiagonal = false;
+        for (uint64_t position = rowBegin; position < rowEnd; ++position) {
+            uint64_t const column = firstEntry[position].getColumn();
+            positionOfColumn[column] = position;
+            if (column == row) {
+                diagonalPositions[row] = position;
+                hasDiagonal = true;
+            }
+        }
+        if (hasDiagonal) {
+            // The entries of a row are sorted by column, so the entries of L come first.
+            for (uint64_t position = rowBegin; position < rowEnd && firstEntry[position].getColumn() < row; ++position) {
+                uint64_t const pivotRow = firstEntry[position].getColumn();
+                luValues[position] /= luValues[diagonalPositions[pivotRow]];
+                uint64_t const pivotRowEnd = matrix.end(pivotRow) - firstEntry;
+                for (uint64_t pivotPosition = diagonalPositions[pivotRow] + 1; pivotPosition < pivotRowEnd; ++pivotPosition) {
+                    uint64_t const targetPosition = positionOfColumn[firstEntry[pivotPosition].getColumn()];
+                    if (targetPosition != noEntry) {
+                        luValues[targetPosition] -= luValues[position] * luValues[pivotPosition];
+                    }
+                }
+            }
+        }
+        for (uint64_t position = rowBegin; position < rowEnd; ++position) {
+            positionOfColumn[firstEntry[position].getColumn()] = noEntry;
+        }
+        if (!hasDiagonal || storm::utility::isZero(luValues[diagonalPositions[row]])) {
+            STORM_LOG_WARN("The incomplete LU factorization does not exist as the pivot of row "
+                           << row << " is zero. Using the diagonal preconditioner instead.");
+            luValues.clear();
+            diagonalPositions.clear();
+            preconditioner = NativeLinearEquationSolverPreconditioner::Diagonal;
+            return;
+        }
+    }
+}
+
+template<typename ValueType>
+void KrylovSolverHelper<ValueType>::forEachRange(std::function<void(uint64_t, uint64_t)> const& function) const {
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(matrix.getRowCount()),
+                                           [&function](uint64_t, uint64_t begin, uint64_t end) { function(begin, end); });
+}
+
+template<typename ValueType>
+void KrylovSolverHelper<ValueType>::multiply(std::vector<ValueType> const& vector, std::vector<ValueType>& result) const {
+    forEachRange([&](uint64_t begin, uint64_t end) {
+        for (uint64_t row = begin; row < end; ++row) {
+            ValueType sum = storm::utility::zero<ValueType>();
+            for (auto const& entry : matrix.getRow(row)) {
+                sum += entry.getValue() * vector[entry.getColumn()];
+            }
+            result[row] = sum;
+        }
+    });
+}
+
+template<typename ValueType>
+void KrylovSolverHelper<ValueType>::residual(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result) const {
+    forEachRange([&](uint64_t begin, uint64_t end) {
+        for (uint64_t row = begin; row < end; ++row) {
+            ValueType sum = b[row];
+            for (auto const& entry : matrix.getRow(row)) {
+                sum -= entry.getValue() * x[entry.getColumn()];
+            }
+            result[row] = sum;
+        }
+    });
+}
+
+template<typename ValueType>
+void KrylovSolverHelper<ValueType>::precondition(std::vector<ValueType>& vector) const {
+    if (preconditioner == NativeLinearEquationSolverPreconditioner::Diagonal) {
+        forEachRange([&](uint64_t begin, uint64_t end) {
+            for (uint64_t row = begin; row < end; ++row) {
+                vector[row] *= inverseDiagonal[row];
+            }
+        });
+    } else if (preconditioner == NativeLinearEquationSolverPreconditioner::Ilu) {
+        auto const firstEntry = matrix.begin();
+        uint64_t const numberOfRows = matrix.getRowCount();
+        // Forward substitution with L (which has a unit diagonal).
+        for (uint64_t row = 0; row < numberOfRows; ++row) {
+            ValueType value = vector[row];
+            for (uint64_t position = matrix.begin(row) - firstEntry; position < diagonalPositions[row]; ++position) {
+                value -= luValues[position] * vector[firstEntry[position].getColumn()];
+            }
+            vector[row] = value;
+        }
+        // Backward substitution with U.
+        for (uint64_t row = numberOfRows; row > 0;) {
+            --row;
+            ValueType value = vector[row];
+            uint64_t const rowEnd = matrix.end(row) - firstEntry;
+            for (uint64_t position = diagonalPositions[row] + 1; position < rowEnd; ++position) {
+                value -= luValues[position] * vector[firstEntry[position].getColumn()];
+            }
+            vector[row] = value / luValues[diagonalPositions[row]];
+        }
+    }
+}
+
+template<typename ValueType>
+ValueType KrylovSolverHelper<ValueType>::dotProduct(std::vector<ValueType> const& first, std::vector<ValueType> const& second) const {
+    // Every thread sums up its range and the partial sums are added in a fixed order, so the result does not depend on the scheduling of the threads.
+    std::vector<ValueType> partialSums(numberOfThreads, storm::utility::zero<ValueType>());
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(first.size()),
+                                           [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+                                               ValueType sum = storm::utility::zero<ValueType>();
+                                               for (uint64_t index = begin; index < end; ++index) {
+                                                   sum += first[index] * second[index];
+                                               }
+                                               partialSums[threadIndex] = sum;
+                                           });
+    ValueType result = storm::utility::zero<ValueType>();
+    for (auto const& sum : partialSums) {
+        result += sum;
+    }
+    return result;
+}
+
+template<typename ValueType>
+ValueType KrylovSolverHelper<ValueType>::norm(std::vector<ValueType> const& vector) const {
+    return std::sqrt(dotProduct(vector, vector));
+}
+
+template<typename ValueType>
+SolverStatus KrylovSolverHelper<ValueType>::bicgstab(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations, bool relative,
+                                                     ValueType const& precision, uint64_t maxIterations,
+                                                     std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    uint64_t const n = x.size();
+    ValueType const normB = norm(b);
+    if (relative && storm::utility::isZero(normB)) {
+        x.assign(n, storm::utility::zero<ValueType>());
+        return SolverStatus::Converged;
+    }
+    ValueType const tolerance = relative ? precision * normB : precision;
+
+    std::vector<ValueType> r(n), rHat, p(n, storm::utility::zero<ValueType>()), v(n, storm::utility::zero<ValueType>()), pHat(n), s(n), sHat(n), t(n);
+    residual(x, b, r);
+    if (norm(r) <= tolerance) {
+        return SolverStatus::Converged;
+    }
+    rHat = r;
+    ValueType rho = storm::utility::one<ValueType>(), alpha = storm::utility::one<ValueType>(), omega = storm::utility::one<ValueType>();
+
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress && numIterations < maxIterations) {
+        ValueType const rhoNew = dotProduct(rHat, r);
+        if (storm::utility::isZero(rhoNew) || storm::utility::isZero(omega)) {
+            // The method broke down. Restart with the current residual as shadow residual.
+            if (rHat == r) {
+                STORM_LOG_WARN("BiCGSTAB broke down after " << numIterations << " iterations.");
+                return SolverStatus::Aborted;
+            }
+            STORM_LOG_TRACE("Restarting BiCGSTAB after a breakdown in iteration " << numIterations << ".");
+            rHat = r;
+            std::fill(p.begin(), p.end(), storm::utility::zero<ValueType>());
+            std::fill(v.begin(), v.end(), storm::utility::zero<ValueType>());
+            rho = alpha = omega = storm::utility::one<ValueType>();
+            continue;
+        }
+        ValueType const beta = (rhoNew / rho) * (alpha / omega);
+        forEachRange([&](uint64_t begin, uint64_t end) {
+            for (uint64_t index = begin; index < end; ++index) {
+                p[index] = r[index] + beta * (p[index] - omega * v[index]);
+                pHat[index] = p[index];
+            }
+        });
+        precondition(pHat);
+        multiply(pHat, v);
+        alpha = rhoNew / dotProduct(rHat, v);
+        forEachRange([&](uint64_t begin, uint64_t end) {
+            for (uint64_t index = begin; index < end; ++index) {
+                s[index] = r[index] - alpha * v[index];
+                sHat[index] = s[index];
+            }
+        });
+        precondition(sHat);
+        multiply(sHat, t);
+        ValueType const tt = dotProduct(t, t);
+        omega = storm::utility::isZero(tt) ? storm::utility::zero<ValueType>() : dotProduct(t, s) / tt;
+        forEachRange([&](uint64_t begin, uint64_t end) {
+            for (uint64_t index = begin; index < end; ++index) {
+                x[index] += alpha * pHat[index] + omega * sHat[index];
+                r[index] = s[index] - omega * t[index];
+            }
+        });
+        rho = rhoNew;
+        ++numIterations;
+
+        if (norm(r) <= tolerance) {
+            status = SolverStatus::Converged;
+        }
+        if (iterationCallback) {
+            status = iterationCallback(status);
+        }
+    }
+    return status == SolverStatus::InProgress ? SolverStatus::MaximalIterationsExceeded : status;
+}
+
+template<typename ValueType>
+SolverStatus KrylovSolverHelper<ValueType>::gmres(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations, bool relative,
+                                                  ValueType const& precision, uint64_t maxIterations, uint64_t restart,
+                                                  std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    STORM_LOG_ASSERT(restart > 0, "The restart threshold must be positive.");
+    uint64_t const n = x.size();
+    ValueType const normB = norm(b);
+    if (relative && storm::utility::isZero(normB)) {
+        x.assign(n, storm::utility::zero<ValueType>());
+        return SolverStatus::Converged;
+    }
+    ValueType const tolerance = relative ? precision * normB : precision;
+
+    // The orthonormal basis of the Krylov subspace, the Hessenberg matrix (column-wise) and the Givens rotations that make it upper triangular.
+    std::vector<std::vector<ValueType>> basis;
+    std::vector<std::vector<ValueType>> hessenberg(restart, std::vector<ValueType>(restart + 1));
+    std::vector<ValueType> cosines(restart), sines(restart), g(restart + 1), y(restart);
+    std::vector<ValueType> r(n), w(n), z(n);
+
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress && numIterations < maxIterations) {
+        residual(x, b, r);
+        ValueType const beta = norm(r);
+        if (beta <= tolerance) {
+            status = SolverStatus::Converged;
+            break;
+        }
+        basis.resize(1);
+        basis[0] = std::move(r);
+        r.resize(n);
+        forEachRange([&](uint64_t begin, uint64_t end) {
+            for (uint64_t index = begin; index < end; ++index) {
+                basis[0][index] /= beta;
+            }
+        });
+        std::fill(g.begin(), g.end(), storm::utility::zero<ValueType>());
+        g[0] = beta;
+
+        uint64_t dimension = 0;
+        while (dimension < restart && numIterations < maxIterations) {
+            uint64_t const j = dimension;
+            // w = A * M^-1 * v_j, orthogonalized against the basis with modified Gram-Schmidt.
+            z = basis[j];
+            precondition(z);
+            multiply(z, w);
+            auto& column = hessenberg[j];
+            for (uint64_t i = 0; i <= j; ++i) {
+                column[i] = dotProduct(w, basis[i]);
+                forEachRange([&](uint64_t begin, uint64_t end) {
+                    for (uint64_t index = begin; index < end; ++index) {
+                        w[index] -= column[i] * basis[i][index];
+                    }
+                });
+            }
+            column[j + 1] = norm(w);
+
+            // Apply the previous rotations to the new column and eliminate its subdiagonal entry.
+            for (uint64_t i = 0; i < j; ++i) {
+                ValueType const temp = cosines[i] * column[i] + sines[i] * column[i + 1];
+                column[i + 1] = -sines[i] * column[i] + cosines[i] * column[i + 1];
+                column[i] = temp;
+            }
+            ValueType const denominator = std::hypot(column[j], column[j + 1]);
+            bool const luckyBreakdown = storm::utility::isZero(column[j + 1]);
+            if (storm::utility::isZero(denominator)) {
+                cosines[j] = storm::utility::one<ValueType>();
+                sines[j] = storm::utility::zero<ValueType>();
+            } else {
+                cosines[j] = column[j] / denominator;
+                sines[j] = column[j + 1] / denominator;
+            }
+            ValueType const subdiagonal = column[j + 1];
+            column[j] = cosines[j] * column[j] + sines[j] * subdiagonal;
+            column[j + 1] = storm::utility::zero<ValueType>();
+            g[j + 1] = -sines[j] * g[j];
+            g[j] = cosines[j] * g[j];
+
+            ++dimension;
+            ++numIterations;
+            if (std::abs(g[j + 1]) <= tolerance || luckyBreakdown) {
+                break;
+            }
+            basis.push_back(w);
+            forEachRange([&](uint64_t begin, uint64_t end) {
+                for (uint64_t index = begin; index < end; ++index) {
+                    basis.back()[index] /= subdiagonal;
+                }
+            });
+        }
+
+        // Solve the triangular system H * y = g and update x by M^-1 * (V * y).
+        for (uint64_t i = dimension; i > 0;) {
+            --i;
+            ValueType value = g[i];
+            for (uint64_t k = i + 1; k < dimension; ++k) {
+                value -= hessenberg[k][i] * y[k];
+            }
+            y[i] = storm::utility::isZero(hessenberg[i][i]) ? storm::utility::zero<ValueType>() : value / hessenberg[i][i];
+        }
+        forEachRange([&](uint64_t begin, uint64_t end) {
+            for (uint64_t index = begin; index < end; ++index) {
+                ValueType sum = storm::utility::zero<ValueType>();
+                for (uint64_t i = 0; i < dimension; ++i) {
+                    sum += y[i] * basis[i][index];
+                }
+                w[index] = sum;
+            }
+        });
+        precondition(w);
+        forEachRange([&](uint64_t begin, uint64_t end) {
+            for (uint64_t index = begin; index < end; ++index) {
+                x[index] += w[index];
+            }
+        });
+
+        if (std::abs(g[dimension]) <= tolerance) {
+            // The estimate of the residual might be inaccurate due to rounding, so the actual residual is checked.
+            residual(x, b, r);
+            if (norm(r) <= tolerance) {
+                status = SolverStatus::Converged;
+            }
+        }
+        if (iterationCallback) {
+            status = iterationCallback(status);
+        }
+    }
+    return status == SolverStatus::InProgress ? SolverStatus::MaximalIterationsExceeded : status;
+}
+
+template class KrylovSolverHelper<double>;
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/SolverStatus.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
+namespace solver::helper {
+
+/*!
+ * Solves linear equation systems A*x = b with the Krylov subspace methods BiCGSTAB and restarted GMRES directly on the given matrix. Both methods are
+ * preconditioned from the right, either with the diagonal of A or with an incomplete LU factorization of A without fill-in (ILU(0)), so the residual that they
+ * observe is the one of the original system.
+ *
+ * Matrix-vector products and vector operations are distributed over the given number of threads. The triangular solves of the ILU(0) preconditioner are
+ * inherently sequential.
+ */
+template<typename ValueType>
+class KrylovSolverHelper {
+   public:
+    /*!
+     * Prepares the solver for the given matrix, which needs to remain valid for the lifetime of this object.
+     *
+     * @param preconditioner The preconditioner to use. If the ILU(0) factorization does not exist (because a pivot is zero), the diagonal is used instead.
+     * @param numberOfThreads The maximal number of threads to use.
+     */
+    KrylovSolverHelper(storm::storage::SparseMatrix<ValueType> const& matrix, NativeLinearEquationSolverPreconditioner preconditioner,
+                       uint64_t numberOfThreads);
+
+    /*!
+     * Solves the equation system with BiCGSTAB.
+     *
+     * @param x The initial guess, which is overwritten with the solution.
+     * @param numIterations The number of iterations so far, which is incremented with every iteration.
+     * @param relative If set, the residual is considered relative to the right-hand side.
+     * @param precision The precision that the (2-norm of the) residual has to achieve.
+     * @param maxIterations The maximal number of iterations.
+     * @param iterationCallback If given, invoked after every iteration (with x being the current iterate). It returns the new status of the solver.
+     */
+    SolverStatus bicgstab(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations, bool relative, ValueType const& precision,
+                          uint64_t maxIterations, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {}) const;
+
+    /*!
+     * Solves the equation system with GMRES that is restarted after the given number of iterations. The parameters are as for bicgstab. As GMRES only
+     * computes the iterate at the end of every cycle, the callback is only invoked after every cycle.
+     */
+    SolverStatus gmres(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations, bool relative, ValueType const& precision,
+                       uint64_t maxIterations, uint64_t restart, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {}) const;
+
+   private:
+    // result = A * vector
+    void multiply(std::vector<ValueType> const& vector, std::vector<ValueType>& result) const;
+    // result = b - A * x
+    void residual(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result) const;
+    // vector = M^-1 * vector, where M is the preconditioner
+    void precondition(std::vector<ValueType>& vector) const;
+
+    ValueType dotProduct(std::vector<ValueType> const& first, std::vector<ValueType> const& second) const;
+    ValueType norm(std::vector<ValueType> const& vector) const;
+
+    // Applies the given function to all index ranges of the vectors in parallel.
+    void forEachRange(std::function<void(uint64_t, uint64_t)> const& function) const;
+
+    void computeIlu();
+
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+    NativeLinearEquationSolverPreconditioner preconditioner;
+    uint64_t numberOfThreads;
+
+    // The inverted diagonal of the matrix (for the diagonal preconditioner).
+    std::vector<ValueType> inverseDiagonal;
+    // The entries of the ILU(0) factorization (aligned with the entries of the matrix) and the position of the diagonal entry of every row.
+    std::vector<ValueType> luValues;
+    std::vector<uint64_t> diagonalPositions;
+};
+
+}  // namespace solver::helper
+}  // namespace storm
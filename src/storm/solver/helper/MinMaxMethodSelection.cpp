@@ -0,0 +1,103 @@
+#include "storm/solver/helper/MinMaxMethodSelection.h"
+
+#include <algorithm>
+
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/constants.h"
+
+namespace storm::solver::helper {
+
+namespace {
+// Systems up to this size are solved quickly by policy iteration as each of its (few) iterations only solves a small linear equation system.
+uint64_t const smallNumberOfStates = 1000;
+// If no probability is smaller than this, value iteration typically converges within a reasonable number of iterations.
+double const smallProbability = 1e-3;
+}  // namespace
+
+std::ostream& operator<<(std::ostream& out, MinMaxProblemFeatures const& features) {
+    out << features.numberOfStates << " states, " << features.numberOfChoices << " choices, " << features.numberOfEntries << " entries, "
+        << features.numberOfNonTrivialSccs << " non-trivial SCCs (largest has " << features.largestSccSize << " states), row group size "
+        << features.averageRowGroupSize << " on average and " << features.maximalRowGroupSize << " at most, minimal probability "
+        << features.minimalProbability;
+    return out;
+}
+
+template<typename ValueType>
+MinMaxProblemFeatures computeMinMaxProblemFeatures(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                   storm::storage::BitVector const& subsystem) {
+    MinMaxProblemFeatures features;
+    features.numberOfStates = subsystem.getNumberOfSetBits();
+    for (auto state : subsystem) {
+        uint64_t rowGroupSize = transitionMatrix.getRowGroupSize(state);
+        features.numberOfChoices += rowGroupSize;
+        features.maximalRowGroupSize = std::max(features.maximalRowGroupSize, rowGroupSize);
+        for (auto row = transitionMatrix.getRowGroupIndices()[state], rowEnd = transitionMatrix.getRowGroupIndices()[state + 1]; row < rowEnd; ++row) {
+            for (auto const& entry : transitionMatrix.getRow(row)) {
+                if (storm::utility::isZero(entry.getValue())) {
+                    continue;
+                }
+                features.minimalProbability = std::min(features.minimalProbability, storm::utility::convertNumber<double>(entry.getValue()));
+                if (subsystem.get(entry.getColumn())) {
+                    ++features.numberOfEntries;
+                }
+            }
+        }
+    }
+    if (features.numberOfStates > 0) {
+        features.averageRowGroupSize = static_cast<double>(features.numberOfChoices) / features.numberOfStates;
+    }
+
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(
+        transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().subsystem(subsystem).dropNaiveSccs());
+    features.numberOfNonTrivialSccs = sccDecomposition.size();
+    for (auto const& scc : sccDecomposition) {
+        features.largestSccSize = std::max<uint64_t>(features.largestSccSize, scc.size());
+    }
+    return features;
+}
+
+std::vector<storm::solver::MinMaxMethod> rankMinMaxMethods(MinMaxProblemFeatures const& features, bool requireSound) {
+    std::vector<storm::solver::MinMaxMethod> result;
+    auto add = [&result](storm::solver::MinMaxMethod method) {
+        if (std::find(result.begin(), result.end(), method) == result.end()) {
+            result.push_back(method);
+        }
+    };
+    // The topological solver pays off if the system decomposes into several SCCs (or none at all), as the SCCs are then solved one after another.
+    bool decomposes = features.isAcyclic() || (features.numberOfNonTrivialSccs > 1 && 2 * features.largestSccSize <= features.numberOfStates);
+    bool slowConvergence = features.minimalProbability < smallProbability;
+
+    if (requireSound) {
+        // The SCCs of a decomposing system are solved soundly one after another, each with the bounds derived from the SCCs it exits to.
+        if (decomposes) {
+            add(storm::solver::MinMaxMethod::Topological);
+        }
+        // Optimistic value iteration usually needs the fewest iterations, but its guesses are often off for systems with small probabilities.
+        if (slowConvergence) {
+            add(storm::solver::MinMaxMethod::IntervalIteration);
+        }
+        add(storm::solver::MinMaxMethod::OptimisticValueIteration);
+        add(storm::solver::MinMaxMethod::SoundValueIteration);
+        add(storm::solver::MinMaxMethod::IntervalIteration);
+    } else {
+        if (features.numberOfStates <= smallNumberOfStates) {
+            add(storm::solver::MinMaxMethod::PolicyIteration);
+        }
+        if (decomposes) {
+            add(storm::solver::MinMaxMethod::Topological);
+        }
+        if (slowConvergence) {
+            // Switching to policy iteration after a few value iterations avoids the long tail of value iteration.
+            add(storm::solver::MinMaxMethod::ViToPi);
+        }
+        add(storm::solver::MinMaxMethod::ValueIteration);
+        add(storm::solver::MinMaxMethod::Topological);
+        add(storm::solver::MinMaxMethod::PolicyIteration);
+    }
+    return result;
+}
+
+template MinMaxProblemFeatures computeMinMaxProblemFeatures(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                            storm::storage::BitVector const& subsystem);
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * Cheap structural features of a MinMax equation system that are used to select a solution method.
+ */
+struct MinMaxProblemFeatures {
+    uint64_t numberOfStates = 0;
+    uint64_t numberOfChoices = 0;
+    // The number of matrix entries whose column is a state of the system.
+    uint64_t numberOfEntries = 0;
+    // The number of SCCs that consist of more than one state or of a state with a self-loop.
+    uint64_t numberOfNonTrivialSccs = 0;
+    uint64_t largestSccSize = 0;
+    uint64_t maximalRowGroupSize = 0;
+    double averageRowGroupSize = 0;
+    // The smallest non-zero entry. Small probabilities usually slow down the convergence of value iteration.
+    double minimalProbability = 1;
+
+    bool isAcyclic() const {
+        return numberOfNonTrivialSccs == 0;
+    }
+};
+
+std::ostream& operator<<(std::ostream& out, MinMaxProblemFeatures const& features);
+
+/*!
+ * Computes the features of the system given by the rows of the states in the subsystem, restricted to the columns of the subsystem.
+ * This takes one pass over the entries and one SCC decomposition.
+ */
+template<typename ValueType>
+MinMaxProblemFeatures computeMinMaxProblemFeatures(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& subsystem);
+
+/*!
+ * Ranks the (floating point) solution methods for a system with the given features, most promising method first.
+ * Only the three first methods are worth trying, the remaining methods are ordered arbitrarily.
+ *
+ * @param requireSound If set, only methods that give sound guarantees on the precision are considered.
+ */
+std::vector<storm::solver::MinMaxMethod> rankMinMaxMethods(MinMaxProblemFeatures const& features, bool requireSound);
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,383 @@
+#include "storm/solver/helper/MultigridSolverHelper.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+namespace storm::solver::helper {
+
+namespace {
+// A transition is a strong coupling if its probability is at least this fraction of the largest probability of its row (ignoring self-loops).
+double const StrongCouplingThreshold = 0.25;
+// Coarsening stops once a level has no more than this fraction of states fewer than the previous one, as further levels would hardly pay off.
+double const MinimalCoarseningRatio = 0.9;
+uint64_t const MaximalNumberOfLevels = 25;
+// The coarsest level is solved directly if it has at most this many states and approximated by sweeps otherwise.
+uint64_t const MaximalDenseSize = 400;
+uint64_t const CoarsestLevelSweeps = 10;
+}  // namespace
+
+template<typename ValueType>
+MultigridSolverHelper<ValueType>::MultigridSolverHelper(storm::storage::SparseMatrix<ValueType> const& matrix) : matrix(matrix) {
+    STORM_LOG_ASSERT(matrix.getRowCount() == matrix.getColumnCount(), "Expected a square matrix.");
+    uint64_t currentSize = matrix.getRowCount();
+    while (coarseMatrices.size() + 1 < MaximalNumberOfLevels && currentSize > MaximalDenseSize) {
+        std::vector<uint64_t> aggregates;
+        uint64_t const numberOfAggregates = computeAggregates(getMatrix(coarseMatrices.size()), aggregates);
+        if (numberOfAggregates > MinimalCoarseningRatio * currentSize) {
+            break;
+        }
+        std::vector<ValueType> inverseSizes(numberOfAggregates, storm::utility::zero<ValueType>());
+        for (auto aggregate : aggregates) {
+            inverseSizes[aggregate] += storm::utility::one<ValueType>();
+        }
+        for (auto& value : inverseSizes) {
+            value = storm::utility::one<ValueType>() / value;
+        }
+        auto coarseMatrix = computeCoarseMatrix(getMatrix(coarseMatrices.size()), aggregates, numberOfAggregates);
+        coarseMatrices.push_back(std::move(coarseMatrix));
+        aggregateOfState.push_back(std::move(aggregates));
+        inverseAggregateSizes.push_back(std::move(inverseSizes));
+        currentSize = numberOfAggregates;
+    }
+    if (currentSize <= MaximalDenseSize) {
+        computeDenseFactorization();
+    }
+
+    residuals.resize(coarseMatrices.size());
+    coarseSolutions.resize(coarseMatrices.size());
+    coarseRightHandSides.resize(coarseMatrices.size());
+    for (uint64_t level = 0; level < coarseMatrices.size(); ++level) {
+        residuals[level].resize(getMatrix(level).getRowCount());
+        coarseSolutions[level].resize(coarseMatrices[level].getRowCount());
+        coarseRightHandSides[level].resize(coarseMatrices[level].getRowCount());
+    }
+    STORM_LOG_INFO("Multigrid hierarchy has " << getNumberOfLevels() << " levels, the coarsest one has " << currentSize << " states"
+                                              << (denseFactorization.empty() ? "." : " and is solved directly."));
+}
+
+template<typename ValueType>
+uint64_t MultigridSolverHelper<ValueType>::getNumberOfLevels() const {
+    return coarseMatrices.size() + 1;
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> const& MultigridSolverHelper<ValueType>::getMatrix(uint64_t level) const {
+    return level == 0 ? matrix : coarseMatrices[level - 1];
+}
+
+template<typename ValueType>
+uint64_t MultigridSolverHelper<ValueType>::computeAggregates(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t>& aggregateOfState) {
+    uint64_t const numberOfStates = matrix.getRowCount();
+    ValueType const threshold = storm::utility::convertNumber<ValueType>(StrongCouplingThreshold);
+
+    // Only keep the strong couplings.
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfStates, numberOfStates, 0, true, false);
+    for (uint64_t row = 0; row < numberOfStates; ++row) {
+        ValueType largest = storm::utility::zero<ValueType>();
+        for (auto const& entry : matrix.getRow(row)) {
+            if (entry.getColumn() != row) {
+                largest = std::max(largest, entry.getValue());
+            }
+        }
+        for (auto const& entry : matrix.getRow(row)) {
+            if (entry.getColumn() != row && !storm::utility::isZero(entry.getValue()) && entry.getValue() >= threshold * largest) {
+                builder.addNextValue(row, entry.getColumn(), entry.getValue());
+            }
+        }
+    }
+    storm::storage::SparseMatrix<ValueType> strongCouplings = builder.build(numberOfStates, numberOfStates);
+
+    // Strongly connected states form an aggregate.
+    uint64_t const noAggregate = std::numeric_limits<uint64_t>::max();
+    aggregateOfState.assign(numberOfStates, noAggregate);
+    uint64_t numberOfAggregates = 0;
+    for (auto const& scc : storm::storage::StronglyConnectedComponentDecomposition<ValueType>(strongCouplings)) {
+        if (scc.size() > 1) {
+            for (auto state : scc) {
+                aggregateOfState[state] = numberOfAggregates;
+            }
+            ++numberOfAggregates;
+        }
+    }
+
+    // The remaining states are paired with their most strongly coupled remaining successor.
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (aggregateOfState[state] != noAggregate) {
+            continue;
+        }
+        aggregateOfState[state] = numberOfAggregates;
+        std::optional<uint64_t> partner;
+        ValueType partnerCoupling = storm::utility::zero<ValueType>();
+        for (auto const& entry : strongCouplings.getRow(state)) {
+            if (aggregateOfState[entry.getColumn()] == noAggregate && (!partner || entry.getValue() > partnerCoupling)) {
+                partner = entry.getColumn();
+                partnerCoupling = entry.getValue();
+            }
+        }
+        if (partner) {
+            aggregateOfState[partner.value()] = numberOfAggregates;
+        }
+        ++numberOfAggregates;
+    }
+    return numberOfAggregates;
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> MultigridSolverHelper<ValueType>::computeCoarseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                                                              std::vector<uint64_t> const& aggregateOfState,
+                                                                                              uint64_t numberOfAggregates) {
+    // Sort the states by their aggregate.
+    std::vector<uint64_t> aggregateBegin(numberOfAggregates + 1, 0);
+    for (auto aggregate : aggregateOfState) {
+        ++aggregateBegin[aggregate + 1];
+    }
+    for (uint64_t aggregate = 0; aggregate < numberOfAggregates; ++aggregate) {
+        aggregateBegin[aggregate + 1] += aggregateBegin[aggregate];
+    }
+    std::vector<uint64_t> states(aggregateOfState.size());
+    std::vector<uint64_t> nextPosition(aggregateBegin.begin(), aggregateBegin.end() - 1);
+    for (uint64_t state = 0; state < aggregateOfState.size(); ++state) {
+        states[nextPosition[aggregateOfState[state]]++] = state;
+    }
+
+    // The row of an aggregate is the average of the rows of its states with the columns of every aggregate summed up.
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfAggregates, numberOfAggregates, 0, true, false);
+    std::vector<ValueType> rowValues(numberOfAggregates, storm::utility::zero<ValueType>());
+    storm::storage::BitVector touchedColumns(numberOfAggregates);
+    for (uint64_t aggregate = 0; aggregate < numberOfAggregates; ++aggregate) {
+        for (uint64_t position = aggregateBegin[aggregate]; position < aggregateBegin[aggregate + 1]; ++position) {
+            for (auto const& entry : matrix.getRow(states[position])) {
+                uint64_t const column = aggregateOfState[entry.getColumn()];
+                rowValues[column] += entry.getValue();
+                touchedColumns.set(column);
+            }
+        }
+        uint64_t const aggregateSize = aggregateBegin[aggregate + 1] - aggregateBegin[aggregate];
+        ValueType const inverseSize = storm::utility::one<ValueType>() / storm::utility::convertNumber<ValueType>(aggregateSize);
+        for (auto column : touchedColumns) {
+            builder.addNextValue(aggregate, column, rowValues[column] * inverseSize);
+            rowValues[column] = storm::utility::zero<ValueType>();
+        }
+        touchedColumns.clear();
+    }
+    return builder.build(numberOfAggregates, numberOfAggregates);
+}
+
+template<typename ValueType>
+void MultigridSolverHelper<ValueType>::computeDenseFactorization() {
+    auto const& coarsestMatrix = getMatrix(coarseMatrices.size());
+    uint64_t const size = coarsestMatrix.getRowCount();
+    denseFactorization.assign(size * size, storm::utility::zero<ValueType>());
+    for (uint64_t row = 0; row < size; ++row) {
+        denseFactorization[row * size + row] = storm::utility::one<ValueType>();
+        for (auto const& entry : coarsestMatrix.getRow(row)) {
+            denseFactorization[row * size + entry.getColumn()] -= entry.getValue();
+        }
+    }
+    // I-A is a non-singular M-matrix, so Gaussian elimination does not need pivoting.
+    for (uint64_t pivot = 0; pivot < size; ++pivot) {
+        ValueType const pivotValue = denseFactorization[pivot * size + pivot];
+        if (storm::utility::isZero(pivotValue)) {
+            STORM_LOG_WARN("Coarsest level of the multigrid hierarchy is numerically singular. Approximating it instead.");
+            denseFactorization.clear();
+            return;
+        }
+        for (uint64_t row = pivot + 1; row < size; ++row) {
+            ValueType& factor = denseFactorization[row * size + pivot];
+            if (storm::utility::isZero(factor)) {
+                continue;
+            }
+            factor /= pivotValue;
+            for (uint64_t column = pivot + 1; column < size; ++column) {
+                denseFactorization[row * size + column] -= factor * denseFactorization[pivot * size + column];
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+void MultigridSolverHelper<ValueType>::performSweep(uint64_t level, std::vector<ValueType>& x, std::vector<ValueType> const& b, bool forward) const {
+    auto const& levelMatrix = getMatrix(level);
+    uint64_t const numberOfRows = levelMatrix.getRowCount();
+    for (uint64_t index = 0; index < numberOfRows; ++index) {
+        uint64_t const row = forward ? index : numberOfRows - 1 - index;
+        ValueType value = b[row];
+        ValueType selfLoop = storm::utility::zero<ValueType>();
+        for (auto const& entry : levelMatrix.getRow(row)) {
+            if (entry.getColumn() == row) {
+                selfLoop += entry.getValue();
+            } else {
+                value += entry.getValue() * x[entry.getColumn()];
+            }
+        }
+        ValueType const denominator = storm::utility::one<ValueType>() - selfLoop;
+        if (!storm::utility::isZero(denominator)) {
+            x[row] = value / denominator;
+        }
+    }
+}
+
+template<typename ValueType>
+void MultigridSolverHelper<ValueType>::computeResidual(uint64_t level, std::vector<ValueType> const& x, std::vector<ValueType> const& b,
+                                                       std::vector<ValueType>& residual) const {
+    getMatrix(level).multiplyWithVector(x, residual, &b);
+    storm::utility::vector::subtractVectors(residual, x, residual);
+}
+
+template<typename ValueType>
+void MultigridSolverHelper<ValueType>::performCycle(uint64_t level, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    if (level == coarseMatrices.size()) {
+        if (denseFactorization.empty()) {
+            for (uint64_t sweep = 0; sweep < CoarsestLevelSweeps; ++sweep) {
+                performSweep(level, x, b, true);
+                performSweep(level, x, b, false);
+            }
+        } else {
+            // Solve (I-A)*x = b with the LU factorization.
+            uint64_t const size = x.size();
+            for (uint64_t row = 0; row < size; ++row) {
+                ValueType value = b[row];
+                for (uint64_t column = 0; column < row; ++column) {
+                    value -= denseFactorization[row * size + column] * x[column];
+                }
+                x[row] = value;
+            }
+            for (uint64_t row = size; row > 0; --row) {
+                ValueType value = x[row - 1];
+                for (uint64_t column = row; column < size; ++column) {
+                    value -= denseFactorization[(row - 1) * size + column] * x[column];
+                }
+                x[row - 1] = value / denseFactorization[(row - 1) * size + row - 1];
+            }
+        }
+        return;
+    }
+
+    performSweep(level, x, b, true);
+
+    // The error e of x satisfies e = A*e + r for the residual r. We approximate e by a vector that is constant on every aggregate which yields the coarse
+    // system for the averaged residual.
+    auto& residual = residuals[level];
+    computeResidual(level, x, b, residual);
+    auto const& aggregates = aggregateOfState[level];
+    auto& coarseB = coarseRightHandSides[level];
+    std::fill(coarseB.begin(), coarseB.end(), storm::utility::zero<ValueType>());
+    for (uint64_t state = 0; state < aggregates.size(); ++state) {
+        coarseB[aggregates[state]] += residual[state];
+    }
+    storm::utility::vector::multiplyVectorsPointwise(coarseB, inverseAggregateSizes[level], coarseB);
+    auto& coarseX = coarseSolutions[level];
+    std::fill(coarseX.begin(), coarseX.end(), storm::utility::zero<ValueType>());
+    performCycle(level + 1, coarseX, coarseB);
+    for (uint64_t state = 0; state < aggregates.size(); ++state) {
+        x[state] += coarseX[aggregates[state]];
+    }
+
+    performSweep(level, x, b, false);
+}
+
+template<typename ValueType>
+SolverStatus MultigridSolverHelper<ValueType>::solve(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations, bool relative,
+                                                     ValueType const& precision, uint64_t maxIterations,
+                                                     std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    std::vector<ValueType> previous;
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress && numIterations < maxIterations) {
+        previous = x;
+        performCycle(0, x, b);
+        ++numIterations;
+        if (storm::utility::vector::equalModuloPrecision<ValueType>(previous, x, precision, relative)) {
+            status = SolverStatus::Converged;
+        }
+        if (iterationCallback) {
+            status = iterationCallback(status);
+        }
+    }
+    if (status == SolverStatus::InProgress) {
+        status = SolverStatus::MaximalIterationsExceeded;
+    }
+    return status;
+}
+
+template<typename ValueType>
+SolverStatus MultigridSolverHelper<ValueType>::solveSound(
+    std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations, bool relative, ValueType const& precision, uint64_t maxIterations,
+    std::optional<std::vector<ValueType>> const& lowerBounds, std::optional<std::vector<ValueType>> const& upperBounds,
+    std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&, std::vector<ValueType> const&)> const& iterationCallback) const {
+    uint64_t const numberOfStates = x.size();
+    std::vector<ValueType> residual(numberOfStates);
+
+    if (expectedSteps.empty()) {
+        // Approximate the expected number of steps s = A*s + 1 until A is left. If its residual is below 1/2, we have s - A*s >= 1/2 for every state.
+        std::vector<ValueType> steps(numberOfStates, storm::utility::zero<ValueType>());
+        std::vector<ValueType> const ones(numberOfStates, storm::utility::one<ValueType>());
+        ValueType const half = storm::utility::convertNumber<ValueType>(0.5);
+        bool stepsFound = false;
+        while (!stepsFound && numIterations < maxIterations) {
+            performCycle(0, steps, ones);
+            ++numIterations;
+            computeResidual(0, steps, ones, residual);
+            stepsFound = std::all_of(residual.begin(), residual.end(), [&half](ValueType const& value) { return value <= half; });
+        }
+        if (!stepsFound) {
+            STORM_LOG_WARN("Could not approximate the expected number of steps within " << maxIterations << " cycles, so no sound bounds are available.");
+            return SolverStatus::MaximalIterationsExceeded;
+        }
+        // Now d(i) = 1 - residual(i) = s(i) - (A*s)(i) >= 1/2.
+        stepDecrease.resize(numberOfStates);
+        storm::utility::vector::applyPointwise(residual, stepDecrease, [](ValueType const& value) { return storm::utility::one<ValueType>() - value; });
+        expectedSteps = std::move(steps);
+    }
+
+    // For l = x - delta*s, we have A*l + b - l = r + delta*d for the residual r of x. Hence l is a lower bound (as A*l + b >= l) if delta >= -r(i)/d(i) for all
+    // states. The upper bound is symmetric.
+    std::vector<ValueType> lower(numberOfStates), upper(numberOfStates);
+    ValueType const two = storm::utility::convertNumber<ValueType>(2.0);
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress && numIterations < maxIterations) {
+        performCycle(0, x, b);
+        ++numIterations;
+        computeResidual(0, x, b, residual);
+        ValueType lowerDelta = storm::utility::zero<ValueType>();
+        ValueType upperDelta = storm::utility::zero<ValueType>();
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            ValueType const scaledResidual = residual[state] / stepDecrease[state];
+            lowerDelta = std::max(lowerDelta, -scaledResidual);
+            upperDelta = std::max(upperDelta, scaledResidual);
+        }
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            lower[state] = x[state] - lowerDelta * expectedSteps[state];
+            upper[state] = x[state] + upperDelta * expectedSteps[state];
+            if (lowerBounds) {
+                lower[state] = std::max(lower[state], (*lowerBounds)[state]);
+            }
+            if (upperBounds) {
+                upper[state] = std::min(upper[state], (*upperBounds)[state]);
+            }
+        }
+        if (storm::utility::vector::equalModuloPrecision<ValueType>(lower, upper, two * precision, relative)) {
+            status = SolverStatus::Converged;
+        }
+        if (iterationCallback) {
+            status = iterationCallback(status, lower, upper);
+        }
+    }
+    if (status == SolverStatus::InProgress) {
+        status = SolverStatus::MaximalIterationsExceeded;
+    }
+    // The center of the bounds is at most half their difference away from the solution.
+    storm::utility::vector::applyPointwise(lower, upper, x, [&two](ValueType const& l, ValueType const& u) { return (l + u) / two; });
+    return status;
+}
+
+template class MultigridSolverHelper<double>;
+template class MultigridSolverHelper<storm::RationalNumber>;
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/SolverStatus.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * Solves fixed point systems x = A*x + b (where A is substochastic and I-A is non-singular) with an aggregation-based algebraic multigrid method.
+ *
+ * The coarse levels aggregate states that are strongly coupled, i.e., states of the same SCC of the graph that only retains the transitions whose probability
+ * is at least a fraction of the largest (non-self-loop) probability of their row. The values of such states converge to each other quickly, while their common
+ * value converges very slowly for nearly completely decomposable (stiff) chains. The remaining states are aggregated in pairs. The coarse system of a level
+ * averages the rows of every aggregate and sums up the columns of every aggregate, so it is again a fixed point system of the same kind. Every cycle
+ * smoothes the current iterate with a Gauss-Seidel sweep, corrects it with the (recursively approximated) solution of the coarse system for its residual and
+ * smoothes it again. The coarsest level is solved directly if it is small enough.
+ */
+template<typename ValueType>
+class MultigridSolverHelper {
+   public:
+    /*!
+     * Builds the hierarchy of the given matrix, which needs to remain valid for the lifetime of this object.
+     */
+    explicit MultigridSolverHelper(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Retrieves the number of levels of the hierarchy (including the level of the original system).
+     */
+    uint64_t getNumberOfLevels() const;
+
+    /*!
+     * Solves the system by performing cycles until the values change by at most the given precision.
+     *
+     * @param x The initial guess, which is overwritten with the solution.
+     * @param numIterations The number of cycles so far, which is incremented with every cycle.
+     * @param iterationCallback If given, invoked after every cycle (with x being the current iterate). It returns the new status of the solver.
+     */
+    SolverStatus solve(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations, bool relative, ValueType const& precision,
+                       uint64_t maxIterations, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {}) const;
+
+    /*!
+     * Solves the system by performing cycles until sound lower and upper bounds on the solution are close enough. The bounds are derived from the residual
+     * of the iterate and an approximation of the expected number of steps until A is left, which is computed with the same hierarchy beforehand.
+     * The solution is the center of the final bounds. The approximation of the expected number of steps is kept for subsequent calls.
+     *
+     * @param lowerBounds If given, known lower bounds on the solution that tighten the computed ones.
+     * @param upperBounds If given, known upper bounds on the solution that tighten the computed ones.
+     * @param iterationCallback If given, invoked after every cycle with the current lower and upper bounds. It returns the new status of the solver.
+     */
+    SolverStatus solveSound(
+        std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations, bool relative, ValueType const& precision,
+        uint64_t maxIterations, std::optional<std::vector<ValueType>> const& lowerBounds, std::optional<std::vector<ValueType>> const& upperBounds,
+        std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&, std::vector<ValueType> const&)> const& iterationCallback = {}) const;
+
+   private:
+    // Performs one cycle on the given level, where x = A*x + b is the system of that level.
+    void performCycle(uint64_t level, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    // Performs a Gauss-Seidel sweep over the rows of the given level in forward or backward order.
+    void performSweep(uint64_t level, std::vector<ValueType>& x, std::vector<ValueType> const& b, bool forward) const;
+    // residual = A*x + b - x on the given level.
+    void computeResidual(uint64_t level, std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& residual) const;
+
+    // Computes the aggregate of every state of the given matrix and returns the number of aggregates.
+    static uint64_t computeAggregates(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t>& aggregateOfState);
+    static storm::storage::SparseMatrix<ValueType> computeCoarseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                                       std::vector<uint64_t> const& aggregateOfState, uint64_t numberOfAggregates);
+    void computeDenseFactorization();
+
+    storm::storage::SparseMatrix<ValueType> const& getMatrix(uint64_t level) const;
+
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+    // The matrices of the coarse levels, i.e., the matrix of level i+1 is stored at index i.
+    std::vector<storm::storage::SparseMatrix<ValueType>> coarseMatrices;
+    // For every level but the coarsest, the aggregate (i.e., state of the next level) of every state and the inverse size of every aggregate.
+    std::vector<std::vector<uint64_t>> aggregateOfState;
+    std::vector<std::vector<ValueType>> inverseAggregateSizes;
+    // If the coarsest level is small enough, the LU factorization of I-A for its matrix A (as dense row-major matrix).
+    std::vector<ValueType> denseFactorization;
+
+    // Auxiliary vectors of every level that are reused by all cycles.
+    mutable std::vector<std::vector<ValueType>> residuals;
+    mutable std::vector<std::vector<ValueType>> coarseSolutions;
+    mutable std::vector<std::vector<ValueType>> coarseRightHandSides;
+    // The approximation s of the expected number of steps used by solveSound (once computed) and s - A*s.
+    mutable std::vector<ValueType> expectedSteps;
+    mutable std::vector<ValueType> stepDecrease;
+};
+
+}  // namespace storm::solver::helper
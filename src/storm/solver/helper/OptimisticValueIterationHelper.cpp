@@ -23,12 +23,13 @@ static ValueType diff(ValueType const& oldValue, ValueType const& newValue) {
 template<typename ValueType, storm::OptimizationDirection Dir, bool Relative>
 class GSVIBackend {
    public:
-    GSVIBackend(ValueType const& precision) : precision{precision} {
+    GSVIBackend(ValueType const& precision, bool trackDifference = false) : precision{precision}, trackDifference{trackDifference} {
         // intentionally empty
     }
 
     void startNewIteration() {
         isConverged = true;
+        maxDifference.reset();
     }
 
     void firstRow(ValueType&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
@@ -40,7 +41,13 @@ class GSVIBackend {
     }
 
     void applyUpdate(ValueType& currValue, [[maybe_unused]] uint64_t rowGroup) {
-        if (isConverged) {
+        if (trackDifference) {
+            if (!storm::utility::isZero(*best)) {
+                ValueType difference = diff<Relative>(currValue, *best);
+                isConverged &= difference <= precision;
+                maxDifference &= std::move(difference);
+            }
+        } else if (isConverged) {
             isConverged = storm::utility::isZero(*best) || diff<Relative>(currValue, *best) <= precision;
         }
         currValue = std::move(*best);
@@ -50,6 +57,11 @@ class GSVIBackend {
         // intentionally left empty.
     }
 
+    void merge(GSVIBackend const& other) {
+        isConverged &= other.isConverged;
+        maxDifference &= other.maxDifference;
+    }
+
     bool converged() const {
         return isConverged;
     }
@@ -58,22 +70,40 @@ class GSVIBackend {
         return false;
     }
 
+    /*!
+     * @return the largest difference between old and new values in the last iteration (only available if differences are tracked)
+     */
+    std::optional<ValueType> getMaxDifference() const {
+        return maxDifference.getOptionalValue();
+    }
+
    private:
     storm::utility::Extremum<Dir, ValueType> best;
     ValueType const precision;
+    bool const trackDifference;
     bool isConverged{true};
+    storm::utility::Extremum<OptimizationDirection::Maximize, ValueType> maxDifference;
 };
 
 template<typename ValueType, bool TrivialRowGrouping>
 template<storm::OptimizationDirection Dir, bool Relative>
 SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::GSVI(
     std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, ValueType const& precision,
-    std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback) const {
-    GSVIBackend<ValueType, Dir, Relative> backend{precision};
+    std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback, ConvergenceEstimate* estimate) const {
+    GSVIBackend<ValueType, Dir, Relative> backend{precision, estimate != nullptr};
     SolverStatus status{SolverStatus::InProgress};
     while (status == SolverStatus::InProgress) {
         ++numIterations;
-        if (viOperator->template applyInPlace(operand, offsets, backend)) {
+        bool const converged = viOperator->template applyInPlace(operand, offsets, backend);
+        if (estimate) {
+            // The ratio of two consecutive differences estimates the contraction factor of the value iteration.
+            auto difference = backend.getMaxDifference();
+            if (difference && estimate->lastDifference && !storm::utility::isZero(*estimate->lastDifference)) {
+                estimate->rate = *difference / *estimate->lastDifference;
+            }
+            estimate->lastDifference = std::move(difference);
+        }
+        if (converged) {
             status = SolverStatus::Converged;
         } else if (iterationCallback) {
             status = iterationCallback(status, operand);
@@ -152,6 +182,13 @@ class OVIBackend {
         // intentionally left empty.
     }
 
+    void merge(OVIBackend const& other) {
+        isAllUp &= other.isAllUp;
+        isAllDown &= other.isAllDown;
+        crossed |= other.crossed;
+        errorValue &= other.errorValue;
+    }
+
     bool converged() const {
         return isAllDown || isAllUp;
     }
@@ -182,23 +219,49 @@ class OVIBackend {
 
 template<typename ValueType, bool TrivialRowGrouping>
 OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OptimisticValueIterationHelper(
-    std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator)
-    : viOperator(viOperator) {
+    std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator, bool adaptive)
+    : viOperator(viOperator), adaptive(adaptive) {
     // Intentionally left empty.
 }
 
+template<typename ValueType, bool TrivialRowGrouping>
+OviStatistics const& OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::getStatistics() const {
+    return statistics;
+}
+
+template<typename ValueType>
+static bool isContraction(std::optional<ValueType> const& rate) {
+    return rate && *rate > storm::utility::zero<ValueType>() && *rate < storm::utility::one<ValueType>();
+}
+
 template<typename ValueType, bool TrivialRowGrouping>
 template<OptimizationDirection Dir, bool Relative>
 SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
     std::pair<std::vector<ValueType>, std::vector<ValueType>>& vu, std::vector<ValueType> const& offsets, uint64_t& numIterations, ValueType const& precision,
     ValueType const& guessValue, std::optional<ValueType> const& lowerBound, std::optional<ValueType> const& upperBound,
     std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback) const {
+    ValueType const two = storm::utility::convertNumber<ValueType, uint64_t>(2u);
     ValueType currentGuessValue = guessValue;
+    ConvergenceEstimate estimate;
+    ConvergenceEstimate* estimatePtr = adaptive ? &estimate : nullptr;
     for (uint64_t numTries = 1; true; ++numTries) {
-        if (SolverStatus status = GSVI<Dir, Relative>(vu.first, offsets, numIterations, currentGuessValue, iterationCallback);
+        if (SolverStatus status = GSVI<Dir, Relative>(vu.first, offsets, numIterations, currentGuessValue, iterationCallback, estimatePtr);
             status != SolverStatus::Converged) {
             return status;
         }
+        if (adaptive && isContraction(estimate.rate) && estimate.lastDifference) {
+            // The remaining error of the lower bound is roughly lastDifference * rate / (1 - rate). If this exceeds half of the guess distance, the guess
+            // is unlikely to be an upper bound, so we rather continue with value iteration until the estimated error is small enough.
+            ValueType const& rate = *estimate.rate;
+            ValueType const requiredDifference = precision / two * (storm::utility::one<ValueType>() - rate) / rate;
+            if (*estimate.lastDifference > requiredDifference && requiredDifference < currentGuessValue) {
+                currentGuessValue = requiredDifference;
+                if (SolverStatus status = GSVI<Dir, Relative>(vu.first, offsets, numIterations, currentGuessValue, iterationCallback, estimatePtr);
+                    status != SolverStatus::Converged) {
+                    return status;
+                }
+            }
+        }
         guessCandidate<Relative>(vu, precision, lowerBound, upperBound);
         OVIBackend<ValueType, Dir, Relative> backend;
         uint64_t maxIters;
@@ -208,13 +271,31 @@ SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
             maxIters = numIterations + storm::utility::convertNumber<uint64_t, ValueType>(
                                            storm::utility::ceil<ValueType>(storm::utility::one<ValueType>() / currentGuessValue));
         }
+        if (adaptive && isContraction(estimate.rate)) {
+            // The error of the iterates shrinks by a constant factor within roughly 1/(1-rate) iterations. A valid upper bound is typically confirmed within a
+            // few of these periods, so a longer verification phase is likely wasted. The budget grows with the number of failed attempts.
+            uint64_t const adaptiveBudget = std::max<uint64_t>(
+                10, numTries * storm::utility::convertNumber<uint64_t, ValueType>(storm::utility::ceil<ValueType>(
+                                   storm::utility::convertNumber<ValueType, uint64_t>(4u) / (storm::utility::one<ValueType>() - *estimate.rate))));
+            if (adaptiveBudget < maxIters - numIterations) {
+                maxIters = numIterations + adaptiveBudget;
+            }
+        }
+        ++statistics.numberOfVerificationPhases;
+        statistics.inVerificationPhase = true;
+        uint64_t const verificationStart = numIterations;
+        bool reuseGuess = false;
         while (numIterations < maxIters) {
             ++numIterations;
+            ++statistics.numberOfVerificationIterations;
             if (viOperator->template applyInPlace(vu, offsets, backend)) {
                 if (backend.allDown()) {
+                    statistics.inVerificationPhase = false;
                     return SolverStatus::Converged;
                 } else {
                     assert(backend.allUp());
+                    // No value of the guess decreased, i.e., the guess is a lower bound of the fixpoint.
+                    reuseGuess = true;
                     break;
                 }
             }
@@ -223,12 +304,23 @@ SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
             }
             if (iterationCallback) {
                 if (auto status = iterationCallback(SolverStatus::InProgress, vu.first); status != SolverStatus::InProgress) {
+                    statistics.inVerificationPhase = false;
                     return status;
                 }
             }
         }
+        statistics.inVerificationPhase = false;
+        ++statistics.numberOfFailedVerificationPhases;
+        STORM_LOG_TRACE("Verification phase " << statistics.numberOfVerificationPhases << " failed after " << (numIterations - verificationStart)
+                                              << " iterations.");
         STORM_LOG_WARN_COND(numTries != 20, "Optimistic Value Iteration did not terminate after 20 refinements. It might be stuck.");
-        currentGuessValue = backend.error() / storm::utility::convertNumber<ValueType, uint64_t>(2u);
+        if (adaptive && reuseGuess) {
+            // Instead of discarding the progress of the verification phase, we continue value iteration from the guess. As both vectors are lower bounds,
+            // so is their pointwise maximum.
+            storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
+                vu.first, vu.second, vu.first, [](ValueType const& v, ValueType const& u) -> ValueType { return std::max(v, u); });
+        }
+        currentGuessValue = backend.error() / two;
     }
 }
 
@@ -238,6 +330,7 @@ SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
     ValueType const& precision, std::optional<storm::OptimizationDirection> const& dir, ValueType const& guessValue, std::optional<ValueType> const& lowerBound,
     std::optional<ValueType> const& upperBound,
     std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback) const {
+    statistics = OviStatistics();
     // Catch the case where lower- and upper bound are already close enough. (when guessing candidates, OVI handles this case not very well, in particular
     // when lowerBound==upperBound)
     if (lowerBound && upperBound) {
@@ -12,6 +12,19 @@
 
 namespace storm::solver::helper {
 
+/*!
+ * Statistics on the verification phases of optimistic value iteration, i.e., the phases in which a guessed upper bound is checked.
+ */
+struct OviStatistics {
+    // The number of verification phases that were started and the number of those that did not confirm the guess.
+    uint64_t numberOfVerificationPhases{0};
+    uint64_t numberOfFailedVerificationPhases{0};
+    // The number of iterations performed within verification phases.
+    uint64_t numberOfVerificationIterations{0};
+    // Whether a verification phase is currently running.
+    bool inVerificationPhase{false};
+};
+
 /*!
  * Implements Optimistic value iteration
  * @see https://doi.org/10.1007/978-3-030-53291-8_26
@@ -19,7 +32,11 @@ namespace storm::solver::helper {
 template<typename ValueType, bool TrivialRowGrouping>
 class OptimisticValueIterationHelper {
    public:
-    OptimisticValueIterationHelper(std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator);
+    /*!
+     * @param adaptive If true, the precision of the value iterations before guessing and the iteration budget of the verification phases are adapted to the
+     * observed convergence rate. Moreover, the guess becomes the new lower bound whenever a verification phase shows that it is one.
+     */
+    OptimisticValueIterationHelper(std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator, bool adaptive = false);
 
     template<OptimizationDirection Dir, bool Relative>
     SolverStatus OVI(std::pair<std::vector<ValueType>, std::vector<ValueType>>& vu, std::vector<ValueType> const& offsets, uint64_t& numIterations,
@@ -42,12 +59,26 @@ class OptimisticValueIterationHelper {
                      std::optional<ValueType> const& lowerBound = {}, std::optional<ValueType> const& upperBound = {},
                      std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback = {}) const;
 
+    /*!
+     * @return statistics on the verification phases of the last (or current) invocation of OVI
+     */
+    OviStatistics const& getStatistics() const;
+
    private:
+    // The observed convergence of value iterations, given by the largest difference in the last iteration and the ratio of the last two differences.
+    struct ConvergenceEstimate {
+        std::optional<ValueType> lastDifference;
+        std::optional<ValueType> rate;
+    };
+
     template<storm::OptimizationDirection Dir, bool Relative>
     SolverStatus GSVI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, ValueType const& precision,
-                      std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback = {}) const;
+                      std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback = {},
+                      ConvergenceEstimate* estimate = nullptr) const;
 
     std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator;
+    bool const adaptive;
+    mutable OviStatistics statistics;
 };
 
 }  // namespace storm::solver::helper
@@ -0,0 +1,97 @@
+#include "storm/solver/helper/OutOfCoreValueIterationHelper.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/storage/OutOfCoreMatrix.h"
+#include "storm/utility/Profiler.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+namespace storm::solver::helper {
+
+OutOfCoreValueIterationHelper::OutOfCoreValueIterationHelper(storm::storage::OutOfCoreMatrix const& matrix, uint64_t blockSize,
+                                                             uint64_t maximalNumberOfSweepsPerBlock)
+    : matrix(matrix), blockSize(blockSize), maximalNumberOfSweepsPerBlock(std::max<uint64_t>(maximalNumberOfSweepsPerBlock, 1)) {
+    // Intentionally left empty.
+}
+
+SolverStatus OutOfCoreValueIterationHelper::VI(std::vector<double>& operand, std::vector<double> const& offsets, uint64_t& numIterations, bool relative,
+                                               double precision, std::optional<storm::OptimizationDirection> const& dir,
+                                               uint64_t maximalNumberOfPasses) const {
+    STORM_LOG_THROW(dir.has_value() || matrix.hasTrivialRowGrouping(), storm::exceptions::InvalidArgumentException,
+                    "Value iteration on a matrix with row groups requires an optimization direction.");
+    STORM_LOG_THROW(operand.size() == matrix.getRowGroupCount() && operand.size() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "The operand does not match the dimensions of the matrix.");
+    STORM_LOG_THROW(offsets.size() == matrix.getRowCount(), storm::exceptions::InvalidArgumentException,
+                    "The offsets do not match the dimensions of the matrix.");
+    bool const minimize = dir.has_value() && storm::solver::minimize(*dir);
+    std::vector<uint64_t> const& rowIndications = matrix.getRowIndications();
+
+    storm::utility::ProfilerPhase phase("out-of-core-vi");
+    uint64_t numberOfSweeps = 0;
+
+    // Sweeps once over the given block and returns whether no value changed by more than the precision.
+    auto sweep = [&](uint64_t firstRowGroup, uint64_t endRowGroup, storm::storage::OutOfCoreMatrix::Entry const* entries) {
+        uint64_t const firstEntry = rowIndications[matrix.getRowGroupStart(firstRowGroup)];
+        bool converged = true;
+        for (uint64_t rowGroup = firstRowGroup; rowGroup < endRowGroup; ++rowGroup) {
+            uint64_t const firstRow = matrix.getRowGroupStart(rowGroup);
+            uint64_t const endRow = matrix.getRowGroupStart(rowGroup + 1);
+            if (firstRow == endRow) {
+                continue;
+            }
+            double best = 0;
+            for (uint64_t row = firstRow; row < endRow; ++row) {
+                double value = offsets[row];
+                for (auto entry = entries + (rowIndications[row] - firstEntry), end = entries + (rowIndications[row + 1] - firstEntry); entry != end;
+                     ++entry) {
+                    value += entry->getValue() * operand[entry->getColumn()];
+                }
+                if (row == firstRow || (minimize ? value < best : value > best)) {
+                    best = value;
+                }
+            }
+            double& current = operand[rowGroup];
+            if (converged) {
+                double const difference = std::abs(best - current);
+                converged = relative ? difference <= std::abs(precision * current) : difference <= precision;
+            }
+            current = best;
+        }
+        ++numberOfSweeps;
+        return converged;
+    };
+
+    numIterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress) {
+        bool converged = true;
+        matrix.forEachBlock(blockSize, [&](uint64_t firstRowGroup, uint64_t endRowGroup, storm::storage::OutOfCoreMatrix::Entry const* entries) {
+            // The first sweep decides the convergence of the pass as in standard Gauss-Seidel iteration. Further sweeps exploit that the block is
+            // already in memory.
+            bool blockConverged = sweep(firstRowGroup, endRowGroup, entries);
+            converged &= blockConverged;
+            for (uint64_t sweepIndex = 1; !blockConverged && sweepIndex < maximalNumberOfSweepsPerBlock; ++sweepIndex) {
+                blockConverged = sweep(firstRowGroup, endRowGroup, entries);
+            }
+        });
+        ++numIterations;
+
+        if (converged) {
+            status = SolverStatus::Converged;
+        } else if (storm::utility::resources::isTerminate()) {
+            status = SolverStatus::Aborted;
+        } else if (numIterations >= maximalNumberOfPasses) {
+            status = SolverStatus::MaximalIterationsExceeded;
+        }
+    }
+    phase.addCounter("passes", numIterations);
+    phase.addCounter("sweeps", numberOfSweeps);
+    STORM_LOG_INFO("Out-of-core value iteration terminated with status " << status << " after " << numIterations << " passes (" << numberOfSweeps
+                                                                          << " block sweeps).");
+    return status;
+}
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+
+namespace storm {
+namespace storage {
+class OutOfCoreMatrix;
+}
+
+namespace solver::helper {
+
+/*!
+ * Performs value iteration on a matrix whose entries reside on disk (see storm::storage::OutOfCoreMatrix). Only the operand and the offsets are kept
+ * in memory. The matrix is streamed block by block and each block is swept Gauss-Seidel style. As reading a block from disk dominates the costs, a
+ * block is swept repeatedly (while its values still change) before moving on to the next block, which maximizes the progress per pass over the file.
+ */
+class OutOfCoreValueIterationHelper {
+   public:
+    /*!
+     * @param matrix The matrix. It must remain valid while this helper is used.
+     * @param blockSize The maximal size (in bytes) of the entries of a block that is held in memory.
+     * @param maximalNumberOfSweepsPerBlock The maximal number of sweeps over a block within one pass over the matrix.
+     */
+    OutOfCoreValueIterationHelper(storm::storage::OutOfCoreMatrix const& matrix, uint64_t blockSize = 1ull << 28, uint64_t maximalNumberOfSweepsPerBlock = 8);
+
+    /*!
+     * Iterates operand[g] := opt_{rows r of group g} (offsets[r] + sum_j matrix[r][j] * operand[j]) until a complete pass changes no value by more
+     * than the precision.
+     *
+     * @param operand The initial values. Is overwritten with the result.
+     * @param offsets The offset of each row.
+     * @param numIterations Is set to the number of performed passes over the matrix.
+     * @param relative Whether the precision is relative to the current values.
+     * @param precision The precision used to detect convergence.
+     * @param dir The optimization direction. Is required if the matrix has a non-trivial row grouping.
+     * @param maximalNumberOfPasses The maximal number of passes over the matrix.
+     */
+    SolverStatus VI(std::vector<double>& operand, std::vector<double> const& offsets, uint64_t& numIterations, bool relative, double precision,
+                    std::optional<storm::OptimizationDirection> const& dir = {}, uint64_t maximalNumberOfPasses = std::numeric_limits<uint64_t>::max()) const;
+
+   private:
+    storm::storage::OutOfCoreMatrix const& matrix;
+    uint64_t blockSize;
+    uint64_t maximalNumberOfSweepsPerBlock;
+};
+
+}  // namespace solver::helper
+}  // namespace storm
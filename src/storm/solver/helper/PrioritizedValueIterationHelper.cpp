@@ -0,0 +1,284 @@
+#include "storm/solver/helper/PrioritizedValueIterationHelper.h"
+
+#include <type_traits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/DynamicPriorityQueue.h"
+#include "storm/utility/Extremum.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+namespace storm::solver::helper {
+
+namespace {
+
+/*!
+ * A max-priority queue of row groups. Instead of updating the priority of a queued row group, the row group is queued again and outdated entries are
+ * skipped, i.e., an entry is only valid if its priority matches the current priority of its row group.
+ */
+template<typename ValueType>
+class ResidualQueue {
+   public:
+    typedef std::pair<ValueType, uint64_t> Entry;
+
+    ResidualQueue(uint64_t numberOfRowGroups, ValueType const& threshold)
+        : queue(std::less<Entry>()), priorities(numberOfRowGroups, storm::utility::zero<ValueType>()), threshold(threshold) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Sets the priority of the given row group. Row groups are only queued if their priority exceeds the threshold.
+     */
+    void setPriority(uint64_t rowGroup, ValueType priority) {
+        if (priority != priorities[rowGroup]) {
+            priorities[rowGroup] = std::move(priority);
+            if (priorities[rowGroup] > threshold) {
+                queue.push(Entry(priorities[rowGroup], rowGroup));
+                if (queue.size() > 4 * priorities.size()) {
+                    compact();
+                }
+            }
+        }
+    }
+
+    /*!
+     * Removes and returns the row group with the highest priority. Returns std::nullopt if no row group exceeds the threshold.
+     */
+    std::optional<uint64_t> popTop() {
+        while (!queue.empty()) {
+            Entry entry = queue.popTop();
+            if (entry.first == priorities[entry.second]) {
+                priorities[entry.second] = storm::utility::zero<ValueType>();
+                return entry.second;
+            }
+        }
+        return std::nullopt;
+    }
+
+   private:
+    void compact() {
+        std::vector<Entry> entries;
+        for (uint64_t rowGroup = 0; rowGroup < priorities.size(); ++rowGroup) {
+            if (priorities[rowGroup] > threshold) {
+                entries.emplace_back(priorities[rowGroup], rowGroup);
+            }
+        }
+        queue = storm::storage::DynamicPriorityQueue<Entry>(std::move(entries), std::less<Entry>());
+        queue.fix();
+    }
+
+    storm::storage::DynamicPriorityQueue<Entry> queue;
+    std::vector<ValueType> priorities;
+    ValueType const threshold;
+};
+
+template<typename ValueType>
+ValueType computeResidual(ValueType const& oldValue, ValueType const& newValue, bool relative) {
+    ValueType residual = storm::utility::abs<ValueType>(newValue - oldValue);
+    if (relative) {
+        // Mirrors the criterion of storm::utility::vector::equalModuloPrecision.
+        if (storm::utility::isZero<ValueType>(newValue)) {
+            return storm::utility::isZero<ValueType>(oldValue) ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
+        }
+        residual /= storm::utility::abs<ValueType>(newValue);
+    }
+    return residual;
+}
+
+template<typename ValueType>
+bool isClosed(ValueType const& lower, ValueType const& upper, bool relative, ValueType const& precision) {
+    // Mirrors the criterion of the IntervalIterationHelper.
+    if (relative) {
+        if (lower > storm::utility::zero<ValueType>()) {
+            return upper - lower <= lower * precision;
+        } else if (upper < storm::utility::zero<ValueType>()) {
+            return lower - upper >= upper * precision;
+        } else {
+            return lower == upper;
+        }
+    }
+    return upper - lower <= precision;
+}
+
+}  // namespace
+
+template<typename ValueType>
+PrioritizedValueIterationHelper<ValueType>::PrioritizedValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : matrix(matrix), backwardTransitions(matrix.transpose(true)) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+template<OptimizationDirection Dir>
+ValueType PrioritizedValueIterationHelper<ValueType>::computeRowGroupValue(uint64_t rowGroup, std::vector<ValueType> const& operand,
+                                                                           std::vector<ValueType> const& offsets) const {
+    storm::utility::Extremum<Dir, ValueType> best;
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    for (uint64_t row = rowGroupIndices[rowGroup]; row < rowGroupIndices[rowGroup + 1]; ++row) {
+        ValueType rowValue = offsets[row];
+        for (auto const& entry : matrix.getRow(row)) {
+            rowValue += entry.getValue() * operand[entry.getColumn()];
+        }
+        best &= std::move(rowValue);
+    }
+    // Row groups without rows keep their current value.
+    return best.empty() ? operand[rowGroup] : *best;
+}
+
+template<typename ValueType>
+template<OptimizationDirection Dir>
+SolverStatus PrioritizedValueIterationHelper<ValueType>::PVI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations,
+                                                             bool relative, ValueType const& precision,
+                                                             std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    uint64_t const numberOfRowGroups = operand.size();
+    ResidualQueue<ValueType> queue(numberOfRowGroups, precision);
+    auto updatePriority = [&](uint64_t rowGroup) {
+        queue.setPriority(rowGroup, computeResidual(operand[rowGroup], computeRowGroupValue<Dir>(rowGroup, operand, offsets), relative));
+    };
+
+    // Computing the initial residuals takes as much effort as a regular iteration.
+    for (uint64_t rowGroup = 0; rowGroup < numberOfRowGroups; ++rowGroup) {
+        updatePriority(rowGroup);
+    }
+    ++numIterations;
+
+    SolverStatus status{SolverStatus::InProgress};
+    uint64_t updatesInCurrentIteration = 0;
+    while (status == SolverStatus::InProgress) {
+        auto rowGroup = queue.popTop();
+        if (!rowGroup) {
+            // No row group changes by more than the precision when updating it.
+            status = SolverStatus::Converged;
+            break;
+        }
+        operand[*rowGroup] = computeRowGroupValue<Dir>(*rowGroup, operand, offsets);
+        for (auto const& predecessor : backwardTransitions.getRow(*rowGroup)) {
+            updatePriority(predecessor.getColumn());
+        }
+        if (++updatesInCurrentIteration == numberOfRowGroups) {
+            updatesInCurrentIteration = 0;
+            ++numIterations;
+            if (iterationCallback) {
+                status = iterationCallback(status);
+            }
+        }
+    }
+    if (updatesInCurrentIteration > 0) {
+        ++numIterations;
+    }
+    return status;
+}
+
+template<typename ValueType>
+SolverStatus PrioritizedValueIterationHelper<ValueType>::PVI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations,
+                                                             bool relative, ValueType const& precision, std::optional<storm::OptimizationDirection> const& dir,
+                                                             std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    STORM_LOG_ASSERT(operand.size() == matrix.getRowGroupCount(), "The operand does not match the number of row groups.");
+    if (!dir.has_value() || maximize(*dir)) {
+        return PVI<OptimizationDirection::Maximize>(operand, offsets, numIterations, relative, precision, iterationCallback);
+    } else {
+        return PVI<OptimizationDirection::Minimize>(operand, offsets, numIterations, relative, precision, iterationCallback);
+    }
+}
+
+template<typename ValueType>
+template<OptimizationDirection Dir>
+SolverStatus PrioritizedValueIterationHelper<ValueType>::PII(std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy,
+                                                             std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative,
+                                                             ValueType const& precision,
+                                                             std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
+                                                             std::optional<storm::storage::BitVector> const& relevantValues) const {
+    auto& lower = xy.first;
+    auto& upper = xy.second;
+    uint64_t const numberOfRowGroups = lower.size();
+
+    // The priority of a row group is the amount by which a single update improves its lower or upper bound. As the bounds only need to converge at the
+    // relevant values, all row groups that can still be improved are queued.
+    ResidualQueue<ValueType> queue(numberOfRowGroups, storm::utility::zero<ValueType>());
+    auto updatePriority = [&](uint64_t rowGroup) {
+        ValueType lowerImprovement = computeRowGroupValue<Dir>(rowGroup, lower, offsets) - lower[rowGroup];
+        ValueType upperImprovement = upper[rowGroup] - computeRowGroupValue<Dir>(rowGroup, upper, offsets);
+        queue.setPriority(rowGroup, std::max(std::max(lowerImprovement, upperImprovement), storm::utility::zero<ValueType>()));
+    };
+    auto isRelevant = [&relevantValues](uint64_t rowGroup) { return !relevantValues || relevantValues->get(rowGroup); };
+
+    // Count the relevant row groups whose bounds are not yet close enough.
+    uint64_t numberOfOpenRowGroups = 0;
+    for (uint64_t rowGroup = 0; rowGroup < numberOfRowGroups; ++rowGroup) {
+        updatePriority(rowGroup);
+        if (isRelevant(rowGroup) && !isClosed(lower[rowGroup], upper[rowGroup], relative, precision)) {
+            ++numberOfOpenRowGroups;
+        }
+    }
+    ++numIterations;
+
+    SolverStatus status{SolverStatus::InProgress};
+    uint64_t updatesInCurrentIteration = 0;
+    while (status == SolverStatus::InProgress) {
+        if (numberOfOpenRowGroups == 0) {
+            status = SolverStatus::Converged;
+            break;
+        }
+        auto rowGroup = queue.popTop();
+        if (!rowGroup) {
+            // Both bounds are fixpoints but do not coincide. Conventional interval iteration would not make any progress either.
+            STORM_LOG_WARN("Prioritized interval iteration can not improve the bounds any further.");
+            status = SolverStatus::MaximalIterationsExceeded;
+            break;
+        }
+        bool const wasClosed = isClosed(lower[*rowGroup], upper[*rowGroup], relative, precision);
+        lower[*rowGroup] = std::max(lower[*rowGroup], computeRowGroupValue<Dir>(*rowGroup, lower, offsets));
+        upper[*rowGroup] = std::min(upper[*rowGroup], computeRowGroupValue<Dir>(*rowGroup, upper, offsets));
+        if (!wasClosed && isRelevant(*rowGroup) && isClosed(lower[*rowGroup], upper[*rowGroup], relative, precision)) {
+            --numberOfOpenRowGroups;
+        }
+        for (auto const& predecessor : backwardTransitions.getRow(*rowGroup)) {
+            updatePriority(predecessor.getColumn());
+        }
+        if (++updatesInCurrentIteration == numberOfRowGroups) {
+            updatesInCurrentIteration = 0;
+            ++numIterations;
+            if (iterationCallback) {
+                status = iterationCallback(IIData<ValueType>({lower, upper, status}));
+            }
+        }
+    }
+    if (updatesInCurrentIteration > 0) {
+        ++numIterations;
+    }
+    return status;
+}
+
+template<typename ValueType>
+SolverStatus PrioritizedValueIterationHelper<ValueType>::PII(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations,
+                                                             bool relative, ValueType const& precision,
+                                                             std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds,
+                                                             std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds,
+                                                             std::optional<storm::OptimizationDirection> const& dir,
+                                                             std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
+                                                             std::optional<storm::storage::BitVector> const& relevantValues) const {
+    STORM_LOG_ASSERT(operand.size() == matrix.getRowGroupCount(), "The operand does not match the number of row groups.");
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> xy;
+    xy.first.swap(operand);
+    xy.second.resize(xy.first.size());
+    prepareLowerBounds(xy.first);
+    prepareUpperBounds(xy.second);
+    SolverStatus status;
+    if (!dir.has_value() || maximize(*dir)) {
+        status = PII<OptimizationDirection::Maximize>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues);
+    } else {
+        status = PII<OptimizationDirection::Minimize>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues);
+    }
+    // get the average of lower- and upper result
+    auto two = storm::utility::convertNumber<ValueType>(2.0);
+    storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
+        xy.first, xy.second, xy.first, [&two](ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
+    xy.first.swap(operand);
+    return status;
+}
+
+template class PrioritizedValueIterationHelper<double>;
+template class PrioritizedValueIterationHelper<storm::RationalNumber>;
+
+}  // namespace storm::solver::helper
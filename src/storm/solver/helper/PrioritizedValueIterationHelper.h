@@ -0,0 +1,69 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/solver/helper/IntervalterationHelper.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * Implements prioritized (Gauss-Seidel) value iteration: Instead of sweeping over all row groups in every iteration, the row groups are updated one at a
+ * time in the order of their current residual, i.e., the difference between their current value and the value obtained by a single Bellman update. After
+ * updating a row group, only the residuals of its predecessors are recomputed. Row groups whose residual is below the precision are not updated at all,
+ * which pays off if most of the row groups converge within a few iterations.
+ *
+ * An unsound variant (approximating the fixpoint from a single initial vector) and a sound variant (approximating the fixpoint from below and above as in
+ * interval iteration) are provided. For the purpose of progress reporting and iteration limits, an iteration is counted whenever as many row groups have
+ * been updated as there are row groups.
+ */
+template<typename ValueType>
+class PrioritizedValueIterationHelper {
+   public:
+    explicit PrioritizedValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Approximates the fixpoint starting from the given operand. Terminates if no row group changes by more than the precision when it is updated.
+     */
+    SolverStatus PVI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative, ValueType const& precision,
+                     std::optional<storm::OptimizationDirection> const& dir = {},
+                     std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {}) const;
+
+    /*!
+     * Approximates the fixpoint from below and above, starting from the given lower and upper bounds. Terminates if the two approximations are equal
+     * modulo the precision (at the relevant values, if given). The operand is then set to the average of the two approximations.
+     */
+    SolverStatus PII(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative, ValueType const& precision,
+                     std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds,
+                     std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds, std::optional<storm::OptimizationDirection> const& dir = {},
+                     std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback = {},
+                     std::optional<storm::storage::BitVector> const& relevantValues = {}) const;
+
+   private:
+    template<OptimizationDirection Dir>
+    SolverStatus PVI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative, ValueType const& precision,
+                     std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const;
+
+    template<OptimizationDirection Dir>
+    SolverStatus PII(std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy, std::vector<ValueType> const& offsets, uint64_t& numIterations,
+                     bool relative, ValueType const& precision, std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
+                     std::optional<storm::storage::BitVector> const& relevantValues) const;
+
+    /*!
+     * Computes the result of a single Bellman update of the given row group.
+     */
+    template<OptimizationDirection Dir>
+    ValueType computeRowGroupValue(uint64_t rowGroup, std::vector<ValueType> const& operand, std::vector<ValueType> const& offsets) const;
+
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+
+    // The predecessors of each row group.
+    storm::storage::SparseMatrix<ValueType> backwardTransitions;
+};
+
+}  // namespace storm::solver::helper
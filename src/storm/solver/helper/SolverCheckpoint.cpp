@@ -0,0 +1,190 @@
+#include "storm/solver/helper/SolverCheckpoint.h"
+
+#include <boost/functional/hash.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/FileIoException.h"
+
+namespace storm::solver::helper {
+
+namespace {
+// Identifies checkpoint files and their format.
+char const Magic[8] = {'S', 'T', 'O', 'R', 'M', 'C', 'K', 'P'};
+uint32_t const Version = 1;
+
+template<typename T>
+void writeRaw(std::ostream& os, T const& value) {
+    os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool readRaw(std::istream& is, T& value) {
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+template<typename T>
+void writeVector(std::ostream& os, std::vector<T> const& values) {
+    writeRaw(os, static_cast<uint64_t>(values.size()));
+    os.write(reinterpret_cast<char const*>(values.data()), values.size() * sizeof(T));
+}
+
+template<typename T>
+bool readVector(std::istream& is, std::vector<T>& values) {
+    uint64_t size;
+    if (!readRaw(is, size)) {
+        return false;
+    }
+    values.resize(size);
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(values.data()), size * sizeof(T)));
+}
+}  // namespace
+
+template<typename ValueType>
+SolverCheckpoint<ValueType>::SolverCheckpoint(std::string const& filename, std::chrono::seconds const& interval, std::string const& method,
+                                              uint64_t systemHash)
+    : filename(filename), interval(interval), method(method), systemHash(systemHash), lastCheckpoint(std::chrono::steady_clock::now()), iterations(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+bool SolverCheckpoint<ValueType>::restore(uint64_t numberOfVectors) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        std::ifstream stream(filename, std::ios::in | std::ios::binary);
+        if (!stream) {
+            return false;
+        }
+        char magic[sizeof(Magic)];
+        uint32_t version;
+        uint64_t hash;
+        std::vector<char> methodName;
+        uint64_t storedNumberOfVectors;
+        if (!stream.read(magic, sizeof(magic)) || std::memcmp(magic, Magic, sizeof(Magic)) != 0 || !readRaw(stream, version) || version != Version) {
+            STORM_LOG_WARN("Ignoring the checkpoint file '" << filename << "' as it has an unknown format.");
+            return false;
+        }
+        if (!readVector(stream, methodName) || std::string(methodName.begin(), methodName.end()) != method || !readRaw(stream, hash) || hash != systemHash) {
+            STORM_LOG_INFO("The checkpoint file '" << filename << "' belongs to a different equation system or solution method.");
+            return false;
+        }
+        if (!readRaw(stream, iterations) || !readRaw(stream, storedNumberOfVectors) || storedNumberOfVectors != numberOfVectors) {
+            STORM_LOG_WARN("Ignoring the corrupted checkpoint file '" << filename << "'.");
+            return false;
+        }
+        vectors.resize(numberOfVectors);
+        for (auto& vector : vectors) {
+            if (!readVector(stream, vector)) {
+                STORM_LOG_WARN("Ignoring the corrupted checkpoint file '" << filename << "'.");
+                return false;
+            }
+        }
+        if (!readVector(stream, scheduler)) {
+            STORM_LOG_WARN("Ignoring the corrupted checkpoint file '" << filename << "'.");
+            return false;
+        }
+        STORM_LOG_INFO("Resuming from the checkpoint in '" << filename << "' after " << iterations << " iterations.");
+        return true;
+    } else {
+        return false;
+    }
+}
+
+template<typename ValueType>
+uint64_t SolverCheckpoint<ValueType>::getIterations() const {
+    return iterations;
+}
+
+template<typename ValueType>
+std::vector<ValueType>& SolverCheckpoint<ValueType>::getVector(uint64_t index) {
+    STORM_LOG_ASSERT(index < vectors.size(), "Invalid index of restored vector.");
+    return vectors[index];
+}
+
+template<typename ValueType>
+std::vector<uint64_t>& SolverCheckpoint<ValueType>::getScheduler() {
+    return scheduler;
+}
+
+template<typename ValueType>
+void SolverCheckpoint<ValueType>::storeIfDue(uint64_t numberOfIterations, std::vector<std::vector<ValueType> const*> const& currentVectors,
+                                             std::vector<uint64_t> const* currentScheduler) {
+    if (std::chrono::steady_clock::now() - lastCheckpoint >= interval || storm::utility::resources::isTerminate()) {
+        store(numberOfIterations, currentVectors, currentScheduler);
+    }
+}
+
+template<typename ValueType>
+void SolverCheckpoint<ValueType>::store(uint64_t numberOfIterations, std::vector<std::vector<ValueType> const*> const& currentVectors,
+                                        std::vector<uint64_t> const* currentScheduler) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        // Write to a temporary file first, so that an interruption while writing does not destroy the previous checkpoint.
+        std::string const temporaryFilename = filename + ".tmp";
+        {
+            std::ofstream stream(temporaryFilename, std::ios::out | std::ios::binary | std::ios::trunc);
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Unable to open checkpoint file '" << temporaryFilename << "'.");
+            stream.write(Magic, sizeof(Magic));
+            writeRaw(stream, Version);
+            writeVector(stream, std::vector<char>(method.begin(), method.end()));
+            writeRaw(stream, systemHash);
+            writeRaw(stream, numberOfIterations);
+            writeRaw(stream, static_cast<uint64_t>(currentVectors.size()));
+            for (auto const* vector : currentVectors) {
+                writeVector(stream, *vector);
+            }
+            writeVector(stream, currentScheduler ? *currentScheduler : std::vector<uint64_t>());
+            stream.flush();
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Unable to write checkpoint file '" << temporaryFilename << "'.");
+        }
+        STORM_LOG_THROW(std::rename(temporaryFilename.c_str(), filename.c_str()) == 0, storm::exceptions::FileIoException,
+                        "Unable to replace checkpoint file '" << filename << "'.");
+        STORM_LOG_INFO("Wrote checkpoint to '" << filename << "' after " << numberOfIterations << " iterations.");
+    } else {
+        STORM_LOG_ASSERT(false, "Checkpoints are only written for double precision values.");
+    }
+    lastCheckpoint = std::chrono::steady_clock::now();
+}
+
+template<typename ValueType, typename SolutionType>
+std::unique_ptr<SolverCheckpoint<SolutionType>> createSolverCheckpoint(Environment const& env, std::string const& method,
+                                                                       storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& b,
+                                                                       std::optional<storm::OptimizationDirection> const& dir) {
+    auto const& filename = env.solver().getCheckpointFilename();
+    if (!filename) {
+        return nullptr;
+    }
+    if constexpr (std::is_same_v<ValueType, double> && std::is_same_v<SolutionType, double>) {
+        std::size_t hash = matrix.hash();
+        boost::hash_combine(hash, boost::hash_range(b.begin(), b.end()));
+        boost::hash_combine(hash, dir ? static_cast<int>(*dir) : -1);
+        return std::make_unique<SolverCheckpoint<SolutionType>>(*filename, std::chrono::seconds(env.solver().getCheckpointInterval()), method, hash);
+    } else {
+        STORM_LOG_WARN("Not writing checkpoints as these are only supported for double precision values.");
+        return nullptr;
+    }
+}
+
+template class SolverCheckpoint<double>;
+template class SolverCheckpoint<storm::RationalNumber>;
+
+template std::unique_ptr<SolverCheckpoint<double>> createSolverCheckpoint(Environment const& env, std::string const& method,
+                                                                          storm::storage::SparseMatrix<double> const& matrix, std::vector<double> const& b,
+                                                                          std::optional<storm::OptimizationDirection> const& dir);
+template std::unique_ptr<SolverCheckpoint<storm::RationalNumber>> createSolverCheckpoint(Environment const& env, std::string const& method,
+                                                                                         storm::storage::SparseMatrix<storm::RationalNumber> const& matrix,
+                                                                                         std::vector<storm::RationalNumber> const& b,
+                                                                                         std::optional<storm::OptimizationDirection> const& dir);
+template std::unique_ptr<SolverCheckpoint<double>> createSolverCheckpoint(Environment const& env, std::string const& method,
+                                                                          storm::storage::SparseMatrix<storm::Interval> const& matrix,
+                                                                          std::vector<storm::Interval> const& b,
+                                                                          std::optional<storm::OptimizationDirection> const& dir);
+
+}  // namespace storm::solver::helper
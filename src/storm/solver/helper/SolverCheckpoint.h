@@ -0,0 +1,106 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+class Environment;
+
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
+namespace solver::helper {
+
+/*!
+ * The state of an iterative solver (its iterates, the number of performed iterations and possibly a scheduler) that is written to a (binary) file
+ * periodically. If a solve is interrupted, e.g. because the process is preempted, a later solve of the same equation system with the same method resumes
+ * from the stored state. The equation system is identified by a hash of the matrix and the right-hand side.
+ * Only solves with double precision values write checkpoints.
+ */
+template<typename ValueType>
+class SolverCheckpoint {
+   public:
+    /*!
+     * Creates a checkpoint for the given file.
+     *
+     * @param filename The name of the checkpoint file.
+     * @param interval The time between two checkpoints.
+     * @param method A name of the solution method. States written by other methods are ignored.
+     * @param systemHash The hash of the equation system.
+     */
+    SolverCheckpoint(std::string const& filename, std::chrono::seconds const& interval, std::string const& method, uint64_t systemHash);
+
+    /*!
+     * Tries to read the state of the same method and equation system from the checkpoint file.
+     *
+     * @param numberOfVectors The number of iterates that the method stores.
+     * @return True iff a matching state was read.
+     */
+    bool restore(uint64_t numberOfVectors);
+
+    /*!
+     * Retrieves the number of iterations of the restored state.
+     */
+    uint64_t getIterations() const;
+
+    /*!
+     * Retrieves the restored iterate with the given index.
+     */
+    std::vector<ValueType>& getVector(uint64_t index);
+
+    /*!
+     * Retrieves the restored scheduler (which is empty if none was stored).
+     */
+    std::vector<uint64_t>& getScheduler();
+
+    /*!
+     * Writes the given state to the checkpoint file if the interval has passed since the last checkpoint or the computation is to be aborted (see
+     * storm::utility::resources::isTerminate).
+     *
+     * @param numberOfIterations The number of performed iterations.
+     * @param currentVectors The current iterates.
+     * @param currentScheduler If given, the current scheduler.
+     */
+    void storeIfDue(uint64_t numberOfIterations, std::vector<std::vector<ValueType> const*> const& currentVectors,
+                    std::vector<uint64_t> const* currentScheduler = nullptr);
+
+    /*!
+     * Writes the given state to the checkpoint file.
+     */
+    void store(uint64_t numberOfIterations, std::vector<std::vector<ValueType> const*> const& currentVectors,
+               std::vector<uint64_t> const* currentScheduler = nullptr);
+
+   private:
+    std::string filename;
+    std::chrono::seconds interval;
+    std::string method;
+    uint64_t systemHash;
+    std::chrono::steady_clock::time_point lastCheckpoint;
+
+    uint64_t iterations;
+    std::vector<std::vector<ValueType>> vectors;
+    std::vector<uint64_t> scheduler;
+};
+
+/*!
+ * Creates a checkpoint for solving the given equation system if the solver environment specifies a checkpoint file.
+ *
+ * @param method A name of the solution method.
+ * @param dir If given, the optimization direction of the (min-max) equation system.
+ * @return The checkpoint or nullptr if no checkpoints are to be written (which is also the case if the values are not double precision numbers).
+ */
+template<typename ValueType, typename SolutionType>
+std::unique_ptr<SolverCheckpoint<SolutionType>> createSolverCheckpoint(Environment const& env, std::string const& method,
+                                                                       storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& b,
+                                                                       std::optional<storm::OptimizationDirection> const& dir = {});
+
+}  // namespace solver::helper
+}  // namespace storm
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "storm/adapters/RationalFunctionForward.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+/*!
+ * The dependencies between the SCCs of a decomposition: an SCC depends on another one if one of its states has a transition into the other SCC. The SCCs are
+ * thus solved in an order in which every SCC is solved after all SCCs it depends on.
+ */
+struct SccDependencies {
+    // For each SCC, the number of distinct SCCs it depends on.
+    std::vector<uint64_t> dependencyCounts;
+
+    // The SCCs depending on SCC i are dependents[dependentOffsets[i]], ..., dependents[dependentOffsets[i + 1] - 1].
+    std::vector<uint64_t> dependentOffsets;
+    std::vector<uint64_t> dependents;
+};
+
+/*!
+ * Computes the dependencies between the SCCs of the given decomposition of the given matrix.
+ */
+template<typename ValueType>
+SccDependencies computeSccDependencies(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                       storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& decomposition) {
+    uint64_t const numberOfSccs = decomposition.size();
+    std::vector<uint64_t> stateToScc(matrix.getRowGroupCount());
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        for (auto state : decomposition.getBlock(sccIndex)) {
+            stateToScc[state] = sccIndex;
+        }
+    }
+
+    SccDependencies result;
+    result.dependencyCounts.assign(numberOfSccs, 0);
+    result.dependentOffsets.assign(numberOfSccs + 1, 0);
+    // Pairs of an SCC and an SCC depending on it.
+    std::vector<std::pair<uint64_t, uint64_t>> dependencies;
+    std::vector<uint64_t> lastDependent(numberOfSccs, numberOfSccs);
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        for (auto state : decomposition.getBlock(sccIndex)) {
+            for (auto const& entry : matrix.getRowGroup(state)) {
+                uint64_t const successorScc = stateToScc[entry.getColumn()];
+                if (successorScc != sccIndex && lastDependent[successorScc] != sccIndex) {
+                    lastDependent[successorScc] = sccIndex;
+                    ++result.dependencyCounts[sccIndex];
+                    ++result.dependentOffsets[successorScc + 1];
+                    dependencies.emplace_back(successorScc, sccIndex);
+                }
+            }
+        }
+    }
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        result.dependentOffsets[sccIndex + 1] += result.dependentOffsets[sccIndex];
+    }
+    result.dependents.resize(dependencies.size());
+    std::vector<uint64_t> nextPositions(result.dependentOffsets.begin(), result.dependentOffsets.end() - 1);
+    for (auto const& [sccIndex, dependent] : dependencies) {
+        result.dependents[nextPositions[sccIndex]++] = dependent;
+    }
+    return result;
+}
+
+/*!
+ * Retrieves the number of threads with which the SCCs of the given decomposition are to be solved. Solving SCCs concurrently only pays off if there are
+ * several non-trivial SCCs. Rational functions are always handled sequentially as their arithmetic is not thread-safe.
+ */
+template<typename ValueType>
+uint64_t getNumberOfThreadsForSccs(storm::Environment const& env, storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& decomposition) {
+    if (std::is_same_v<ValueType, storm::RationalFunction> || env.solver().getNumberOfThreads() <= 1) {
+        return 1;
+    }
+    uint64_t numberOfNonTrivialSccs = 0;
+    for (auto const& scc : decomposition) {
+        if (scc.size() > 1 && ++numberOfNonTrivialSccs > 1) {
+            return env.solver().getNumberOfThreads();
+        }
+    }
+    return 1;
+}
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
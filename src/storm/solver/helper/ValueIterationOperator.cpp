@@ -1,9 +1,13 @@
 #include "storm/solver/helper/ValueIterationOperator.h"
 
+#include <algorithm>
+#include <cmath>
+#include <map>
 #include <optional>
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/threads.h"
 
 namespace storm::solver::helper {
 
@@ -24,6 +28,11 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMat
     }
     this->backwards = Backward;
     this->hasSkippedRows = false;
+    this->usingCompressedValues = false;
+    compressedMatrixValues.clear();
+    valueDictionary.clear();
+    this->usingCompactIndices = false;
+    compactMatrixColumns.clear();
     auto const numRows = matrix.getRowCount();
     matrixValues.clear();
     matrixColumns.clear();
@@ -53,6 +62,11 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMat
             matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
         }
     }
+    initializeCompactIndices(matrix.getColumnCount());
+    initializeCompressedValues();
+    initializeSinglePrecisionValues();
+    initializeRobustOrder();
+    initializeParallelChunks();
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
@@ -68,12 +82,308 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMat
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::unsetIgnoredRows() {
-    for (auto& c : matrixColumns) {
-        if (c >= StartOfRowIndicator) {
-            c &= StartOfRowGroupIndicator;
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setNumberOfThreads(uint64_t numberOfThreads, uint64_t entriesPerChunk) {
+    STORM_LOG_ASSERT(numberOfThreads > 0, "The number of threads must be positive.");
+    STORM_LOG_WARN_COND(numberOfThreads == 1 || !(std::is_same_v<ValueType, storm::Interval>),
+                        "Value iteration on interval models is not parallelized.");
+    entriesPerChunk = std::max<uint64_t>(1, entriesPerChunk);
+    if (this->numberOfThreads == numberOfThreads && this->entriesPerChunk == entriesPerChunk) {
+        return;
+    }
+    this->numberOfThreads = numberOfThreads;
+    this->entriesPerChunk = entriesPerChunk;
+    initializeParallelChunks();
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setAsynchronousUpdates(bool value) {
+    asynchronousUpdates = value;
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+bool ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::isUsingAsynchronousUpdates() const {
+    return asynchronousUpdates;
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setSinglePrecisionValues(bool value) {
+    STORM_LOG_WARN_COND(!value || (std::is_same_v<ValueType, double>), "Single precision matrix values are only supported for double precision models.");
+    value &= std::is_same_v<ValueType, double>;
+    if (useSinglePrecisionValues == value) {
+        return;
+    }
+    useSinglePrecisionValues = value;
+    initializeSinglePrecisionValues();
+    if (placedOnThreads && !singlePrecisionMatrixValues.empty()) {
+        placeVectorOnThreads(singlePrecisionMatrixValues, &ParallelChunk::valueOffset);
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+bool ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::isUsingSinglePrecisionValues() const {
+    return useSinglePrecisionValues;
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::initializeSinglePrecisionValues() {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (useSinglePrecisionValues && !usingCompressedValues) {
+            // Values are rounded towards zero. For non-negative matrices, this can not increase the spectral radius, i.e., iterating with the rounded
+            // entries converges whenever iterating with the exact entries does.
+            singlePrecisionMatrixValues.clear();
+            singlePrecisionMatrixValues.reserve(matrixValues.size());
+            for (auto const& value : matrixValues) {
+                float roundedValue = static_cast<float>(value);
+                if (std::abs(static_cast<double>(roundedValue)) > std::abs(value)) {
+                    roundedValue = std::nextafter(roundedValue, 0.0f);
+                }
+                singlePrecisionMatrixValues.push_back(roundedValue);
+            }
+            return;
+        }
+    }
+    singlePrecisionMatrixValues.clear();
+    singlePrecisionMatrixValues.shrink_to_fit();
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setCompressedValues(bool value) {
+    STORM_LOG_WARN_COND(!value || !(std::is_same_v<ValueType, storm::Interval>), "Compressed matrix values are not supported for interval models.");
+    value &= !std::is_same_v<ValueType, storm::Interval>;
+    if (compressValues == value) {
+        return;
+    }
+    compressValues = value;
+    initializeCompressedValues();
+    initializeSinglePrecisionValues();
+    placeOnThreads();
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+bool ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::isUsingCompressedValues() const {
+    return usingCompressedValues;
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::initializeCompressedValues() {
+    if constexpr (!std::is_same_v<ValueType, storm::Interval>) {
+        uint64_t const maximalDictionarySize = 1ull << (8 * sizeof(uint8_t));
+        if (compressValues && !usingCompressedValues) {
+            std::map<ValueType, uint8_t> indices;
+            for (auto const& value : matrixValues) {
+                if (indices.count(value) == 0) {
+                    if (indices.size() == maximalDictionarySize) {
+                        STORM_LOG_INFO("The matrix values are not compressed as there are more than " << maximalDictionarySize << " distinct values.");
+                        return;
+                    }
+                    indices.emplace(value, static_cast<uint8_t>(indices.size()));
+                }
+            }
+            valueDictionary.resize(indices.size());
+            for (auto const& [value, index] : indices) {
+                valueDictionary[index] = value;
+            }
+            compressedMatrixValues.clear();
+            compressedMatrixValues.reserve(matrixValues.size());
+            for (auto const& value : matrixValues) {
+                compressedMatrixValues.push_back(indices.at(value));
+            }
+            // Release the memory of the uncompressed values.
+            PlacedVector<ValueType>().swap(matrixValues);
+            usingCompressedValues = true;
+        } else if (!compressValues && usingCompressedValues) {
+            matrixValues.clear();
+            matrixValues.reserve(compressedMatrixValues.size());
+            for (auto index : compressedMatrixValues) {
+                matrixValues.push_back(valueDictionary[index]);
+            }
+            PlacedVector<uint8_t>().swap(compressedMatrixValues);
+            std::vector<ValueType>().swap(valueDictionary);
+            usingCompressedValues = false;
         }
     }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setCompactIndices(bool value) {
+    if (compactIndices == value) {
+        return;
+    }
+    compactIndices = value;
+    if (matrixColumns.empty() && compactMatrixColumns.empty()) {
+        // No matrix has been set so far.
+        return;
+    }
+    // The number of columns is only relevant if the columns are currently stored with 64 bits, in which case we can determine it from them.
+    uint64_t columnCount = 0;
+    for (auto const& column : matrixColumns) {
+        if (column < StartOfRowIndicator) {
+            columnCount = std::max<uint64_t>(columnCount, column + 1);
+        }
+    }
+    initializeCompactIndices(columnCount);
+    initializeRobustOrder();
+    placeOnThreads();
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+bool ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::isUsingCompactIndices() const {
+    return usingCompactIndices;
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::initializeCompactIndices(uint64_t columnCount) {
+    using CompactEncoding = ColumnEncoding<CompactIndexType>;
+    if (compactIndices && !usingCompactIndices) {
+        // Columns have to be smaller than the row indicators. As each row has at most one entry per column, the number of skipped entries of an ignored
+        // row then fits into the indicator as well.
+        if (columnCount >= CompactEncoding::StartOfRowIndicator / 2) {
+            STORM_LOG_INFO("The matrix columns are stored with 64 bits as the matrix has " << columnCount << " columns.");
+            return;
+        }
+        compactMatrixColumns.clear();
+        compactMatrixColumns.reserve(matrixColumns.size());
+        for (auto const& column : matrixColumns) {
+            if (column < StartOfRowIndicator) {
+                compactMatrixColumns.push_back(static_cast<CompactIndexType>(column));
+            } else {
+                CompactIndexType indicator =
+                    column >= StartOfRowGroupIndicator ? CompactEncoding::StartOfRowGroupIndicator : CompactEncoding::StartOfRowIndicator;
+                compactMatrixColumns.push_back(indicator + static_cast<CompactIndexType>(column & ColumnEncoding<IndexType>::SkipNumEntriesMask));
+            }
+        }
+        // Release the memory of the 64 bit columns.
+        PlacedVector<IndexType>().swap(matrixColumns);
+        usingCompactIndices = true;
+    } else if (!compactIndices && usingCompactIndices) {
+        matrixColumns.clear();
+        matrixColumns.reserve(compactMatrixColumns.size());
+        for (auto const& column : compactMatrixColumns) {
+            if (column < CompactEncoding::StartOfRowIndicator) {
+                matrixColumns.push_back(column);
+            } else {
+                IndexType indicator = column >= CompactEncoding::StartOfRowGroupIndicator ? StartOfRowGroupIndicator : StartOfRowIndicator;
+                matrixColumns.push_back(indicator + (column & CompactEncoding::SkipNumEntriesMask));
+            }
+        }
+        PlacedVector<CompactIndexType>().swap(compactMatrixColumns);
+        usingCompactIndices = false;
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::initializeRobustOrder() {
+    if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+        visitColumns([this](auto const& columns) {
+            using Encoding = ColumnEncoding<typename std::decay_t<decltype(columns)>::value_type>;
+            auto& robustOrder = applyCache.robustOrder;
+            robustOrder.assign(columns.size(), 0);
+            uint64_t rowStart = 0;
+            auto matrixValueIt = matrixValues.cbegin();
+            for (uint64_t position = 1; position < columns.size(); ++position) {
+                if (columns[position] >= Encoding::StartOfRowIndicator) {
+                    rowStart = position;
+                    continue;
+                }
+                if (!storm::utility::isZero(matrixValueIt->upper() - matrixValueIt->lower())) {
+                    ++robustOrder[rowStart];
+                    robustOrder[rowStart + robustOrder[rowStart]] = position - rowStart - 1;
+                }
+                ++matrixValueIt;
+            }
+            STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected number of matrix values.");
+        });
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::initializeParallelChunks() {
+    parallelChunks.clear();
+    if (numberOfThreads <= 1 || (matrixColumns.empty() && compactMatrixColumns.empty())) {
+        return;
+    }
+    visitColumns([this](auto const& columns) {
+        using Encoding = ColumnEncoding<typename std::decay_t<decltype(columns)>::value_type>;
+        // Row groups end at a row group indicator (or at a row indicator if the row grouping is trivial). The number of skipped entries that might be
+        // encoded in the indicators does not matter here.
+        auto const endOfGroupIndicator = TrivialRowGrouping ? Encoding::StartOfRowIndicator : Encoding::StartOfRowGroupIndicator;
+        ParallelChunk currentChunk{0, 0, 0, 0};
+        uint64_t valueOffset = 0;
+        for (uint64_t columnOffset = 1; columnOffset < columns.size(); ++columnOffset) {
+            if (columns[columnOffset] < Encoding::StartOfRowIndicator) {
+                ++valueOffset;
+            } else if (columns[columnOffset] >= endOfGroupIndicator) {
+                ++currentChunk.endPosition;
+                if (valueOffset - currentChunk.valueOffset >= entriesPerChunk && columnOffset + 1 < columns.size()) {
+                    parallelChunks.push_back(currentChunk);
+                    currentChunk = ParallelChunk{currentChunk.endPosition, currentChunk.endPosition, columnOffset, valueOffset};
+                }
+            }
+        }
+        if (currentChunk.endPosition > currentChunk.firstPosition) {
+            parallelChunks.push_back(currentChunk);
+        }
+    });
+    if (parallelChunks.size() <= 1) {
+        parallelChunks.clear();
+    }
+    placeOnThreads();
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::placeOnThreads() {
+    placedOnThreads = false;
+    if (parallelChunks.empty() || storm::utility::getThreadAffinityPolicy() != storm::utility::ThreadAffinityPolicy::NumaNodes) {
+        return;
+    }
+    if constexpr (!std::is_same_v<ValueType, storm::Interval>) {
+        // Depending on the settings, some representations of the columns and values are not present.
+        visitColumns([this](auto& columns) { placeVectorOnThreads(columns, &ParallelChunk::columnOffset); });
+        if (!matrixValues.empty()) {
+            placeVectorOnThreads(matrixValues, &ParallelChunk::valueOffset);
+        }
+        if (!singlePrecisionMatrixValues.empty()) {
+            placeVectorOnThreads(singlePrecisionMatrixValues, &ParallelChunk::valueOffset);
+        }
+        if (!compressedMatrixValues.empty()) {
+            placeVectorOnThreads(compressedMatrixValues, &ParallelChunk::valueOffset);
+        }
+        placedOnThreads = true;
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<typename T>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::placeVectorOnThreads(PlacedVector<T>& vector,
+                                                                                               uint64_t ParallelChunk::*offset) const {
+    // The memory of the new vector is not touched by resizing it, so each page is placed on the node of the thread that writes to it first.
+    // The chunks are distributed among the threads in the same way as in applyParallel.
+    PlacedVector<T> placedVector;
+    placedVector.resize(vector.size());
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(parallelChunks.size()),
+                                           [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                                               uint64_t const begin = parallelChunks[chunkBegin].*offset;
+                                               uint64_t const end = chunkEnd < parallelChunks.size() ? parallelChunks[chunkEnd].*offset : vector.size();
+                                               std::copy(vector.begin() + begin, vector.begin() + end, placedVector.begin() + begin);
+                                           });
+    vector = std::move(placedVector);
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::unsetIgnoredRows() {
+    visitColumns([](auto& columns) {
+        using Encoding = ColumnEncoding<typename std::decay_t<decltype(columns)>::value_type>;
+        for (auto& c : columns) {
+            if (c >= Encoding::StartOfRowIndicator) {
+                c &= Encoding::StartOfRowGroupIndicator;
+            }
+        }
+    });
     hasSkippedRows = false;
 }
 
@@ -82,29 +392,33 @@ template<bool Backward>
 void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setIgnoredRows(bool useLocalRowIndices,
                                                                                          std::function<bool(IndexType, IndexType)> const& ignore) {
     STORM_LOG_ASSERT(!TrivialRowGrouping, "Tried to ignroe rows but the row grouping is trivial.");
-    auto colIt = matrixColumns.begin();
-    for (auto groupIndex : indexRange<Backward>(0, this->rowGroupIndices->size() - 1)) {
-        STORM_LOG_ASSERT(colIt != matrixColumns.end(), "VI Operator in invalid state.");
-        STORM_LOG_ASSERT(*colIt >= StartOfRowGroupIndicator, "VI Operator in invalid state.");
-        auto const rowIndexRange = useLocalRowIndices ? indexRange<false>(0ull, (*this->rowGroupIndices)[groupIndex + 1] - (*this->rowGroupIndices)[groupIndex])
-                                                      : indexRange<false>((*this->rowGroupIndices)[groupIndex], (*this->rowGroupIndices)[groupIndex + 1]);
-        for (auto const rowIndex : rowIndexRange) {
-            if (!ignore(groupIndex, rowIndex)) {
-                *colIt &= StartOfRowGroupIndicator;  // Clear number of skipped entries
-                moveToEndOfRow(colIt);
-            } else if ((*colIt & SkipNumEntriesMask) == 0) {  // i.e. should ignore but is not already ignored
-                auto currColIt = colIt;
-                moveToEndOfRow(colIt);
-                *currColIt += std::distance(currColIt, colIt);  // set number of skipped entries
+    visitColumns([this, &useLocalRowIndices, &ignore](auto& columns) {
+        using Encoding = ColumnEncoding<typename std::decay_t<decltype(columns)>::value_type>;
+        auto colIt = columns.begin();
+        for (auto groupIndex : indexRange<Backward>(0, this->rowGroupIndices->size() - 1)) {
+            STORM_LOG_ASSERT(colIt != columns.end(), "VI Operator in invalid state.");
+            STORM_LOG_ASSERT(*colIt >= Encoding::StartOfRowGroupIndicator, "VI Operator in invalid state.");
+            auto const rowIndexRange = useLocalRowIndices
+                                           ? indexRange<false>(0ull, (*this->rowGroupIndices)[groupIndex + 1] - (*this->rowGroupIndices)[groupIndex])
+                                           : indexRange<false>((*this->rowGroupIndices)[groupIndex], (*this->rowGroupIndices)[groupIndex + 1]);
+            for (auto const rowIndex : rowIndexRange) {
+                if (!ignore(groupIndex, rowIndex)) {
+                    *colIt &= Encoding::StartOfRowGroupIndicator;  // Clear number of skipped entries
+                    moveToEndOfRow(colIt);
+                } else if ((*colIt & Encoding::SkipNumEntriesMask) == 0) {  // i.e. should ignore but is not already ignored
+                    auto currColIt = colIt;
+                    moveToEndOfRow(colIt);
+                    *currColIt += std::distance(currColIt, colIt);  // set number of skipped entries
+                }
+                STORM_LOG_ASSERT(!std::all_of(rowIndexRange.begin(), rowIndexRange.end(),
+                                              [&ignore, &groupIndex](IndexType rowIndex) { return ignore(groupIndex, rowIndex); }),
+                                 "All rows in row group " << groupIndex << " are ignored.");
+                STORM_LOG_ASSERT(colIt != columns.end(), "VI Operator in invalid state.");
+                STORM_LOG_ASSERT(*colIt >= Encoding::StartOfRowIndicator, "VI Operator in invalid state.");
             }
-            STORM_LOG_ASSERT(
-                !std::all_of(rowIndexRange.begin(), rowIndexRange.end(), [&ignore, &groupIndex](IndexType rowIndex) { return ignore(groupIndex, rowIndex); }),
-                "All rows in row group " << groupIndex << " are ignored.");
-            STORM_LOG_ASSERT(colIt != matrixColumns.end(), "VI Operator in invalid state.");
-            STORM_LOG_ASSERT(*colIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+            STORM_LOG_ASSERT(*colIt == Encoding::StartOfRowGroupIndicator, "VI Operator in invalid state.");
         }
-        STORM_LOG_ASSERT(*colIt == StartOfRowGroupIndicator, "VI Operator in invalid state.");
-    }
+    });
     hasSkippedRows = true;
 }
 
@@ -143,37 +457,6 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::freeAu
     auxiliaryVectorUsedExternally = false;
 }
 
-template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::moveToEndOfRow(std::vector<IndexType>::iterator& matrixColumnIt) const {
-    do {
-        ++matrixColumnIt;
-    } while (*matrixColumnIt < StartOfRowIndicator);
-}
-
-template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-bool ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::skipIgnoredRow(std::vector<IndexType>::const_iterator& matrixColumnIt,
-                                                                                         typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
-    if (IndexType entriesToSkip = (*matrixColumnIt & SkipNumEntriesMask)) {
-        matrixColumnIt += entriesToSkip;
-        matrixValueIt += entriesToSkip - 1;
-        return true;
-    }
-    return false;
-}
-
-template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::skipMultipleIgnoredRows(
-    std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
-    IndexType result{0ull};
-    while (skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
-        ++result;
-        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "Undexpected state of VI operator");
-        // We (currently) don't use this past the end of a row group, so we may have this additional sanity check:
-        STORM_LOG_ASSERT(*matrixColumnIt < StartOfRowGroupIndicator, "Undexpected state of VI operator");
-    }
-    return result;
-}
-
 template class ValueIterationOperator<double, true>;
 template class ValueIterationOperator<double, false>;
 template class ValueIterationOperator<storm::RationalNumber, true>;
@@ -1,6 +1,11 @@
 #pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <optional>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -10,6 +15,7 @@
 #include "storm/solver/helper/ValueIterationOperatorForward.h"
 #include "storm/storage/sparse/StateType.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"  // TODO
 
 namespace storm {
@@ -35,6 +41,11 @@ class ValueIterationOperator {
    public:
     using IndexType = storm::storage::sparse::state_type;
 
+    /*!
+     * The type with which the columns are stored if the matrix is small enough (see setCompactIndices)
+     */
+    using CompactIndexType = uint32_t;
+
     /*!
      * Initializes this operator with the given data
      * @tparam backwards if true, we iterate backwards starting with the largest rowgroup. This often makes in place (Gauss-Seidel) iterations more efficient
@@ -76,6 +87,13 @@ class ValueIterationOperator {
      * * backend.endOfIteration(); invoked when all groups are processed
      * * backend.converged(); invoked when abort() returns true or all groups are processed. Determines the return value of this method
      *
+     * If more than one thread is set (see setNumberOfThreads) and the backend has a method
+     * * backend.merge(otherBackend); that combines the state (e.g. convergence flags) of another backend into this one,
+     * the row groups are processed in parallel. Each thread then invokes firstRow/nextRow/applyUpdate/abort on its own copy of the backend (taken after
+     * startNewIteration), and these copies are merged into the given backend before endOfIteration and converged are invoked. An abort of one thread
+     * stops the other threads at the next chunk of row groups. For in-place applications, the threads only read values of the previous iteration,
+     * i.e., the update is Jacobi-style rather than Gauss-Seidel-style. Backends without a merge method are always processed sequentially.
+     *
      * @tparam OperandType The type of input and output operand. Can be a value vector or a pair of two value vectors with one entry per group.
      *                      In the latter case, the rowResult for backend.firstRow and backend.nextRow is a pair of values and
      *                      applyUpdate gets two operandOutReference's to write the group result to.
@@ -126,6 +144,76 @@ class ValueIterationOperator {
         return applyRobust<RobustDir>(operand, operand, offsets, backend);
     }
 
+    /*!
+     * Sets the number of threads with which the operator is applied (for backends that support it, see apply).
+     * The row groups are partitioned into chunks of consecutive row groups with (roughly) the given number of matrix entries each, which are
+     * distributed dynamically among the threads. If the matrix has too few entries for more than one chunk, the operator is applied sequentially.
+     * @param numberOfThreads the number of threads. If this is 1, the operator is always applied sequentially
+     * @param entriesPerChunk the (minimal) number of matrix entries of a chunk. The default is chosen such that the data of a chunk fits into the L2 cache
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads, uint64_t entriesPerChunk = DefaultEntriesPerChunk);
+
+    /*!
+     * @return the number of threads with which the operator is applied (for backends that support it)
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Sets whether in-place parallel applications update the operand asynchronously. By default, each thread writes its results to a buffer first so
+     * that all threads read the values of the previous application (as in a Jacobi iteration). With asynchronous updates, the threads write their
+     * results directly to the operand (using relaxed atomic accesses), where they are picked up by the rows that are processed afterwards, regardless of
+     * the thread processing them. This retains most of the faster convergence of Gauss-Seidel iterations, but the results (within the precision) may
+     * differ between runs. As for Gauss-Seidel iterations, iterating from a lower (upper) bound remains below (above) the least fixpoint.
+     * @note This only affects floating point operands that consist of a single vector.
+     */
+    void setAsynchronousUpdates(bool value);
+
+    /*!
+     * @return true iff in-place parallel applications update the operand asynchronously (see setAsynchronousUpdates)
+     */
+    bool isUsingAsynchronousUpdates() const;
+
+    /*!
+     * Sets whether the operator is applied with the matrix entries stored in single precision. The products and sums are still computed with the
+     * (double precision) operand type, so this only introduces the rounding errors of the matrix entries (which are rounded towards zero) while halving
+     * the memory traffic for them.
+     * As the resulting fixpoint generally differs slightly from the exact one, callers should finish with a pass in full precision.
+     * @note This is only supported if the ValueType is double. The setting persists across calls of setMatrix.
+     */
+    void setSinglePrecisionValues(bool value);
+
+    /*!
+     * @return true iff the operator is applied with matrix entries stored in single precision (see setSinglePrecisionValues)
+     */
+    bool isUsingSinglePrecisionValues() const;
+
+    /*!
+     * Sets whether the matrix values are stored as one byte indices into a dictionary of the distinct values. As matrices of models with symmetric or
+     * replicated components typically have only a few distinct values, this reduces the memory for the matrix values by a factor of eight (and the
+     * memory of the matrix by almost a half) without affecting the results.
+     * If the matrix has more than 256 distinct values, the values are stored uncompressed. The setting persists across calls of setMatrix.
+     * While the values are compressed, single precision values (see setSinglePrecisionValues) are not used.
+     * @note This is not supported if the ValueType is storm::Interval.
+     */
+    void setCompressedValues(bool value);
+
+    /*!
+     * @return true iff the matrix values are currently stored compressed (see setCompressedValues)
+     */
+    bool isUsingCompressedValues() const;
+
+    /*!
+     * Sets whether the columns of the matrix entries (and the row indicators) are stored with 32 bits whenever the matrix has few enough columns
+     * (see CompactIndexType). This is the default as it halves the memory for the columns (and the memory traffic for them) without affecting the
+     * results. The setting persists across calls of setMatrix.
+     */
+    void setCompactIndices(bool value);
+
+    /*!
+     * @return true iff the columns of the matrix entries are currently stored with 32 bits (see setCompactIndices)
+     */
+    bool isUsingCompactIndices() const;
+
     /*!
      * Sets rows that will be skipped when applying the operator.
      * @note each row group shall have at least one row that is not ignored
@@ -159,6 +247,10 @@ class ValueIterationOperator {
     void freeAuxiliaryVector();
 
    private:
+    // Vectors whose memory is not touched when they are resized (see placeOnThreads)
+    template<typename T>
+    using PlacedVector = std::vector<T, storm::utility::parallel::UninitializedAllocator<T>>;
+
     /*!
      * Internal variant of `apply`
      * @note This and other apply methods are intentionally implemented in the header file as there are potentially many different BackendTypes
@@ -168,12 +260,79 @@ class ValueIterationOperator {
         STORM_LOG_ASSERT(getSize(operandIn) == getSize(operandOut), "Input and Output Operands have different sizes.");
         auto const operandSize = getSize(operandIn);
         STORM_LOG_ASSERT(TrivialRowGrouping || rowGroupIndices->size() == operandSize + 1, "Dimension mismatch");
+        if constexpr (!std::is_same_v<ValueType, storm::Interval>) {
+            if (usingCompressedValues) {
+                return applyWithValues<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(
+                    operandOut, operandIn, offsets, backend, DictionaryValueIterator{compressedMatrixValues.cbegin(), valueDictionary.data()},
+                    DictionaryValueIterator{compressedMatrixValues.cend(), valueDictionary.data()});
+            }
+        }
+        if constexpr (std::is_same_v<ValueType, double>) {
+            if (useSinglePrecisionValues) {
+                return applyWithValues<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(
+                    operandOut, operandIn, offsets, backend, singlePrecisionMatrixValues.cbegin(), singlePrecisionMatrixValues.cend());
+            }
+        }
+        return applyWithValues<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(operandOut, operandIn, offsets, backend,
+                                                                                                                matrixValues.cbegin(), matrixValues.cend());
+    }
+
+    /*!
+     * Internal variant of `apply` that reads the matrix values from the given range (of matrixValues, singlePrecisionMatrixValues, or the compressed values)
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection,
+             typename MatrixValueIterator>
+    bool applyWithValues(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend,
+                         MatrixValueIterator const& valuesBegin, MatrixValueIterator const& valuesEnd) const {
+        if (usingCompactIndices) {
+            return applyWithColumnsAndValues<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection, CompactIndexType>(
+                operandOut, operandIn, offsets, backend, valuesBegin, valuesEnd);
+        }
+        return applyWithColumnsAndValues<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection, IndexType>(
+            operandOut, operandIn, offsets, backend, valuesBegin, valuesEnd);
+    }
+
+    /*!
+     * Internal variant of `apply` that reads the matrix columns from the given representation (matrixColumns or compactMatrixColumns)
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection,
+             typename ColumnType, typename MatrixValueIterator>
+    bool applyWithColumnsAndValues(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend,
+                                   MatrixValueIterator const& valuesBegin, [[maybe_unused]] MatrixValueIterator const& valuesEnd) const {
+        auto const operandSize = getSize(operandIn);
+        if constexpr (!std::is_same_v<ValueType, storm::Interval> && SupportsParallelApply<BackendType>::value) {
+            if (parallelChunks.size() > 1) {
+                return applyParallel<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection, ColumnType>(operandOut, operandIn,
+                                                                                                                                 offsets, backend, valuesBegin);
+            }
+        }
         backend.startNewIteration();
-        auto matrixValueIt = matrixValues.cbegin();
-        auto matrixColumnIt = matrixColumns.cbegin();
-        for (auto groupIndex : indexRange<Backward>(0, operandSize)) {
-            STORM_LOG_ASSERT(matrixColumnIt != matrixColumns.end(), "VI Operator in invalid state.");
-            STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+        auto matrixValueIt = valuesBegin;
+        auto matrixColumnIt = getColumns<ColumnType>().cbegin();
+        if (!applyGroups<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(0, operandSize, operandSize, matrixColumnIt,
+                                                                                                         matrixValueIt, operandOut, operandIn, offsets,
+                                                                                                         backend)) {
+            return backend.converged();
+        }
+        STORM_LOG_ASSERT(matrixColumnIt + 1 == getColumns<ColumnType>().cend(), "Unexpected position of matrix column iterator.");
+        STORM_LOG_ASSERT(matrixValueIt == valuesEnd, "Unexpected position of matrix column iterator.");
+        backend.endOfIteration();
+        return backend.converged();
+    }
+
+    /*!
+     * Applies the operator to the row groups at the given positions (in the order in which the matrix is stored), starting at the given iterators.
+     * @return false iff the backend requested to abort
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection,
+             typename MatrixColumnIterator, typename MatrixValueIterator>
+    bool applyGroups(uint64_t firstPosition, uint64_t endPosition, uint64_t operandSize, MatrixColumnIterator& matrixColumnIt,
+                     MatrixValueIterator& matrixValueIt, OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets,
+                     BackendType& backend) const {
+        using Encoding = ColumnEncoding<typename std::iterator_traits<MatrixColumnIterator>::value_type>;
+        for (uint64_t position = firstPosition; position < endPosition; ++position) {
+            IndexType const groupIndex = Backward ? operandSize - 1 - position : position;
+            STORM_LOG_ASSERT(*matrixColumnIt >= Encoding::StartOfRowIndicator, "VI Operator in invalid state.");
             //            STORM_LOG_ASSERT(matrixValueIt != matrixValues.end(), "VI Operator in invalid state.");
             if constexpr (TrivialRowGrouping) {
                 backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex), groupIndex, groupIndex);
@@ -183,7 +342,7 @@ class ValueIterationOperator {
                     rowIndex += skipMultipleIgnoredRows(matrixColumnIt, matrixValueIt);
                 }
                 backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
-                while (*matrixColumnIt < StartOfRowGroupIndicator) {
+                while (*matrixColumnIt < Encoding::StartOfRowGroupIndicator) {
                     ++rowIndex;
                     if (!SkipIgnoredRows || !skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
                         backend.nextRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
@@ -192,21 +351,155 @@ class ValueIterationOperator {
             }
             if constexpr (isPair<OperandType>::value) {
                 backend.applyUpdate(operandOut.first[groupIndex], operandOut.second[groupIndex], groupIndex);
+            } else if constexpr (std::is_same_v<OperandType, RelaxedOperand>) {
+                SolutionType value = operandOut[groupIndex];
+                backend.applyUpdate(value, groupIndex);
+                operandOut.store(groupIndex, value);
             } else {
                 backend.applyUpdate(operandOut[groupIndex], groupIndex);
             }
             if (backend.abort()) {
-                return backend.converged();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*!
+     * Parallel variant of `apply`. Each thread processes chunks of row groups with its own copy of the backend.
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection,
+             typename ColumnType, typename MatrixValueIterator>
+    bool applyParallel(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend,
+                       MatrixValueIterator const& valuesBegin) const {
+        auto const operandSize = getSize(operandIn);
+        backend.startNewIteration();
+        bool const inPlace = &operandOut == &operandIn;
+        if constexpr (!isPair<OperandType>::value && std::is_floating_point_v<SolutionType>) {
+            if (inPlace && asynchronousUpdates) {
+                return applyParallelAsynchronous<OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection, ColumnType>(operandOut, offsets,
+                                                                                                                                     backend, valuesBegin);
+            }
+        }
+
+        // For in-place applications, the results are written to a buffer first so that no thread reads values that are concurrently written.
+        OperandType& target = inPlace ? getParallelBuffer<OperandType>(operandSize) : operandOut;
+        auto groupRange = [&operandSize](ParallelChunk const& chunk) {
+            return Backward ? std::pair<uint64_t, uint64_t>(operandSize - chunk.endPosition, operandSize - chunk.firstPosition)
+                            : std::pair<uint64_t, uint64_t>(chunk.firstPosition, chunk.endPosition);
+        };
+
+        std::vector<BackendType> threadBackends(numberOfThreads, backend);
+        std::vector<char> chunkStarted(parallelChunks.size(), false);
+        std::atomic<bool> aborted(false);
+        auto processChunks = [&](uint64_t threadIndex, uint64_t chunkBegin, uint64_t chunkEnd) {
+            for (uint64_t chunkIndex = chunkBegin; chunkIndex < chunkEnd && !aborted.load(std::memory_order_relaxed); ++chunkIndex) {
+                ParallelChunk const& chunk = parallelChunks[chunkIndex];
+                if (inPlace) {
+                    auto const [firstGroup, endGroup] = groupRange(chunk);
+                    copyGroups(operandIn, target, firstGroup, endGroup);
+                }
+                chunkStarted[chunkIndex] = true;
+                auto matrixColumnIt = getColumns<ColumnType>().cbegin() + chunk.columnOffset;
+                auto matrixValueIt = valuesBegin + chunk.valueOffset;
+                if (!applyGroups<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(
+                        chunk.firstPosition, chunk.endPosition, operandSize, matrixColumnIt, matrixValueIt, target, operandIn, offsets,
+                        threadBackends[threadIndex])) {
+                    aborted = true;
+                }
+            }
+        };
+        if (placedOnThreads) {
+            // Every thread processes the chunks whose matrix entries it placed (see placeOnThreads).
+            storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(parallelChunks.size()), processChunks);
+        } else {
+            storm::utility::parallel::forEachBlock(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(parallelChunks.size()), 1, processChunks);
+        }
+
+        if (inPlace) {
+            storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(parallelChunks.size()),
+                                                   [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                                                       for (uint64_t chunkIndex = chunkBegin; chunkIndex < chunkEnd; ++chunkIndex) {
+                                                           if (chunkStarted[chunkIndex]) {
+                                                               auto const [firstGroup, endGroup] = groupRange(parallelChunks[chunkIndex]);
+                                                               copyGroups(target, operandOut, firstGroup, endGroup);
+                                                           }
+                                                       }
+                                                   });
+        }
+        for (auto const& threadBackend : threadBackends) {
+            backend.merge(threadBackend);
+        }
+        if (aborted) {
+            return backend.converged();
+        }
+        backend.endOfIteration();
+        return backend.converged();
+    }
+
+    /*!
+     * Variant of `applyParallel` for asynchronous in-place applications (see setAsynchronousUpdates). The given backend has already started the iteration.
+     */
+    template<typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection, typename ColumnType,
+             typename MatrixValueIterator>
+    bool applyParallelAsynchronous(std::vector<SolutionType>& operand, OffsetType const& offsets, BackendType& backend,
+                                   MatrixValueIterator const& valuesBegin) const {
+        uint64_t const operandSize = operand.size();
+        // The threads read and write the shared operand concurrently, so all accesses to it are (relaxed) atomic.
+        RelaxedOperand relaxedOperand{operand.data()};
+        std::vector<BackendType> threadBackends(numberOfThreads, backend);
+        std::atomic<bool> aborted(false);
+        auto processChunks = [&](uint64_t threadIndex, uint64_t chunkBegin, uint64_t chunkEnd) {
+            for (uint64_t chunkIndex = chunkBegin; chunkIndex < chunkEnd && !aborted.load(std::memory_order_relaxed); ++chunkIndex) {
+                ParallelChunk const& chunk = parallelChunks[chunkIndex];
+                auto matrixColumnIt = getColumns<ColumnType>().cbegin() + chunk.columnOffset;
+                auto matrixValueIt = valuesBegin + chunk.valueOffset;
+                if (!applyGroups<RelaxedOperand, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(
+                        chunk.firstPosition, chunk.endPosition, operandSize, matrixColumnIt, matrixValueIt, relaxedOperand, relaxedOperand, offsets,
+                        threadBackends[threadIndex])) {
+                    aborted = true;
+                }
             }
+        };
+        if (placedOnThreads) {
+            storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(parallelChunks.size()), processChunks);
+        } else {
+            storm::utility::parallel::forEachBlock(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(parallelChunks.size()), 1, processChunks);
+        }
+        for (auto const& threadBackend : threadBackends) {
+            backend.merge(threadBackend);
+        }
+        if (aborted) {
+            return backend.converged();
         }
-        STORM_LOG_ASSERT(matrixColumnIt + 1 == matrixColumns.cend(), "Unexpected position of matrix column iterator.");
-        STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected position of matrix column iterator.");
         backend.endOfIteration();
         return backend.converged();
     }
 
+    /*!
+     * A view on an operand whose entries are read and written with relaxed atomic operations (see setAsynchronousUpdates)
+     */
+    struct RelaxedOperand {
+        SolutionType* data;
+
+        SolutionType operator[](uint64_t index) const {
+            SolutionType result;
+            __atomic_load(data + index, &result, __ATOMIC_RELAXED);
+            return result;
+        }
+
+        void store(uint64_t index, SolutionType value) const {
+            __atomic_store(data + index, &value, __ATOMIC_RELAXED);
+        }
+    };
+
     // Auxiliary methods to deal with various OperandTypes and OffsetTypes
 
+    template<typename OffT>
+    SolutionType initializeRowRes(RelaxedOperand const&, std::vector<OffT> const& offsets, uint64_t offsetIndex) const {
+        return offsets[offsetIndex];
+    }
+
     template<typename OpT, typename OffT>
     OpT initializeRowRes(std::vector<OpT> const&, std::vector<OffT> const& offsets, uint64_t offsetIndex) const {
         return offsets[offsetIndex];
@@ -248,9 +541,9 @@ class ValueIterationOperator {
     /*!
      * Computes the result for a single row and advances the given iterators to the end of the row
      */
-    template<OptimizationDirection RobustDirection, typename OperandType, typename OffsetType>
-    auto applyRow(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
-                  OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
+    template<OptimizationDirection RobustDirection, typename OperandType, typename OffsetType, typename MatrixColumnIterator, typename MatrixValueIterator>
+    auto applyRow(MatrixColumnIterator& matrixColumnIt, MatrixValueIterator& matrixValueIt, OperandType const& operand, OffsetType const& offsets,
+                  uint64_t offsetIndex) const {
         if constexpr (std::is_same_v<ValueType, storm::Interval>) {
             return applyRowRobust<RobustDirection>(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex);
         } else {
@@ -258,12 +551,13 @@ class ValueIterationOperator {
         }
     }
 
-    template<typename OperandType, typename OffsetType>
-    auto applyRowStandard(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
-                          OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
-        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+    template<typename OperandType, typename OffsetType, typename MatrixColumnIterator, typename MatrixValueIterator>
+    auto applyRowStandard(MatrixColumnIterator& matrixColumnIt, MatrixValueIterator& matrixValueIt, OperandType const& operand, OffsetType const& offsets,
+                          uint64_t offsetIndex) const {
+        using Encoding = ColumnEncoding<typename std::iterator_traits<MatrixColumnIterator>::value_type>;
+        STORM_LOG_ASSERT(*matrixColumnIt >= Encoding::StartOfRowIndicator, "VI Operator in invalid state.");
         auto result{initializeRowRes(operand, offsets, offsetIndex)};
-        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
+        for (++matrixColumnIt; *matrixColumnIt < Encoding::StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
             if constexpr (isPair<OperandType>::value) {
                 result.first += operand.first[*matrixColumnIt] * (*matrixValueIt);
                 result.second += operand.second[*matrixColumnIt] * (*matrixValueIt);
@@ -274,28 +568,18 @@ class ValueIterationOperator {
         return result;
     }
 
-    // Aux function for applyRowRobust
-    template<OptimizationDirection RobustDirection>
-    struct AuxCompare {
-        bool operator()(const std::pair<SolutionType, SolutionType>& a, const std::pair<SolutionType, SolutionType>& b) const {
-            if constexpr (RobustDirection == OptimizationDirection::Maximize) {
-                return a.first > b.first;
-            } else {
-                return a.first < b.first;
-            }
-        }
-    };
-
-    template<OptimizationDirection RobustDirection, typename OperandType, typename OffsetType>
-    auto applyRowRobust(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
-                        OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
-        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+    template<OptimizationDirection RobustDirection, typename OperandType, typename OffsetType, typename MatrixColumnIterator>
+    auto applyRowRobust(MatrixColumnIterator& matrixColumnIt, typename PlacedVector<ValueType>::const_iterator& matrixValueIt, OperandType const& operand,
+                        OffsetType const& offsets, uint64_t offsetIndex) const {
+        using ColumnType = typename std::iterator_traits<MatrixColumnIterator>::value_type;
+        using Encoding = ColumnEncoding<ColumnType>;
+        STORM_LOG_ASSERT(*matrixColumnIt >= Encoding::StartOfRowIndicator, "VI Operator in invalid state.");
         auto result{robustInitializeRowRes<RobustDirection>(operand, offsets, offsetIndex)};
-        AuxCompare<RobustDirection> compare;
-        applyCache.robustOrder.clear();
+        auto const rowStartIt = matrixColumnIt;
+        auto const rowValuesIt = matrixValueIt;
 
         SolutionType remainingValue{storm::utility::one<SolutionType>()};
-        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
+        for (++matrixColumnIt; *matrixColumnIt < Encoding::StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
             auto const lower = matrixValueIt->lower();
             if constexpr (isPair<OperandType>::value) {
                 STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Value Iteration is not implemented with pairs and interval-models.");
@@ -304,23 +588,37 @@ class ValueIterationOperator {
                 result += operand[*matrixColumnIt] * lower;
             }
             remainingValue -= lower;
-            auto const diameter = matrixValueIt->upper() - lower;
-            if (!storm::utility::isZero(diameter)) {
-                applyCache.robustOrder.emplace_back(operand[*matrixColumnIt], diameter);
-            }
         }
         if (storm::utility::isZero(remainingValue) || storm::utility::isOne(remainingValue)) {
             return result;
         }
 
-        std::sort(applyCache.robustOrder.begin(), applyCache.robustOrder.end(), compare);
+        if constexpr (!isPair<OperandType>::value) {
+            // The uncertain entries of this row in the order of the previous application (see ApplyCache). As the order of the operand values rarely changes
+            // between two applications, the entries only need to be sorted again if that order became invalid.
+            auto const orderIt = applyCache.robustOrder.begin() + (rowStartIt - getColumns<ColumnType>().cbegin());
+            auto const orderBegin = orderIt + 1;
+            auto const orderEnd = orderBegin + *orderIt;
+            auto operandValue = [&operand, &rowStartIt](uint32_t entryOffset) { return operand[*(rowStartIt + 1 + entryOffset)]; };
+            auto isBetter = [&operandValue](uint32_t lhs, uint32_t rhs) {
+                if constexpr (RobustDirection == OptimizationDirection::Maximize) {
+                    return operandValue(lhs) > operandValue(rhs);
+                } else {
+                    return operandValue(lhs) < operandValue(rhs);
+                }
+            };
+            if (!std::is_sorted(orderBegin, orderEnd, isBetter)) {
+                std::sort(orderBegin, orderEnd, isBetter);
+            }
 
-        for (auto const& pair : applyCache.robustOrder) {
-            auto availableMass = std::min(pair.second, remainingValue);
-            result += availableMass * pair.first;
-            remainingValue -= availableMass;
-            if (storm::utility::isZero(remainingValue)) {
-                return result;
+            for (auto entryIt = orderBegin; entryIt != orderEnd; ++entryIt) {
+                auto const& interval = *(rowValuesIt + *entryIt);
+                auto availableMass = std::min<SolutionType>(interval.upper() - interval.lower(), remainingValue);
+                result += availableMass * operandValue(*entryIt);
+                remainingValue -= availableMass;
+                if (storm::utility::isZero(remainingValue)) {
+                    return result;
+                }
             }
         }
         STORM_LOG_ASSERT(storm::utility::isAlmostZero(remainingValue), "Remaining value should be zero (all prob mass taken) but is " << remainingValue);
@@ -353,6 +651,48 @@ class ValueIterationOperator {
     template<typename T1, typename T2>
     struct isPair<std::pair<T1, T2>> : std::true_type {};
 
+    template<typename BackendType, typename = void>
+    struct SupportsParallelApply : std::false_type {};
+
+    template<typename BackendType>
+    struct SupportsParallelApply<BackendType, std::void_t<decltype(std::declval<BackendType&>().merge(std::declval<BackendType const&>()))>>
+        : std::true_type {};
+
+    /*!
+     * Retrieves the buffer that holds the results of an in-place parallel application
+     */
+    template<typename OperandType>
+    OperandType& getParallelBuffer(uint64_t size) const {
+        if constexpr (isPair<OperandType>::value) {
+            static_assert(std::is_same_v<OperandType, std::pair<std::vector<SolutionType>, std::vector<SolutionType>>>, "Unexpected operand type.");
+            parallelPairBuffer.first.resize(size);
+            parallelPairBuffer.second.resize(size);
+            return parallelPairBuffer;
+        } else {
+            static_assert(std::is_same_v<OperandType, std::vector<SolutionType>>, "Unexpected operand type.");
+            parallelBuffer.resize(size);
+            return parallelBuffer;
+        }
+    }
+
+    /*!
+     * Copies the entries firstGroup,...,endGroup-1 of the given operand
+     */
+    template<typename OperandType>
+    void copyGroups(OperandType const& from, OperandType& to, uint64_t firstGroup, uint64_t endGroup) const {
+        if constexpr (isPair<OperandType>::value) {
+            std::copy(from.first.begin() + firstGroup, from.first.begin() + endGroup, to.first.begin() + firstGroup);
+            std::copy(from.second.begin() + firstGroup, from.second.begin() + endGroup, to.second.begin() + firstGroup);
+        } else {
+            std::copy(from.begin() + firstGroup, from.begin() + endGroup, to.begin() + firstGroup);
+        }
+    }
+
+    /*!
+     * Partitions the row groups into chunks for parallel applications (or clears the chunks if only one thread is used)
+     */
+    void initializeParallelChunks();
+
     /*!
      * Internal variant of setIgnoredRows
      */
@@ -362,29 +702,172 @@ class ValueIterationOperator {
     /*!
      * Moves the given iterator to the end of the current row
      */
-    void moveToEndOfRow(std::vector<IndexType>::iterator& matrixColumnIt) const;
+    template<typename MatrixColumnIterator>
+    void moveToEndOfRow(MatrixColumnIterator& matrixColumnIt) const {
+        using Encoding = ColumnEncoding<typename std::iterator_traits<MatrixColumnIterator>::value_type>;
+        do {
+            ++matrixColumnIt;
+        } while (*matrixColumnIt < Encoding::StartOfRowIndicator);
+    }
 
     /*!
      * Skips the current row, if it is ignored. Advances the iterators accordingly
      */
-    bool skipIgnoredRow(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt) const;
+    template<typename MatrixColumnIterator, typename MatrixValueIterator>
+    bool skipIgnoredRow(MatrixColumnIterator& matrixColumnIt, MatrixValueIterator& matrixValueIt) const {
+        using Encoding = ColumnEncoding<typename std::iterator_traits<MatrixColumnIterator>::value_type>;
+        if (uint64_t entriesToSkip = (*matrixColumnIt & Encoding::SkipNumEntriesMask)) {
+            matrixColumnIt += entriesToSkip;
+            matrixValueIt += entriesToSkip - 1;
+            return true;
+        }
+        return false;
+    }
 
     /*!
      * Skips all ignored rows, advancing the iterators to the first successor row that is not ignored
      */
-    uint64_t skipMultipleIgnoredRows(std::vector<IndexType>::const_iterator& matrixColumnIt,
-                                     typename std::vector<ValueType>::const_iterator& matrixValueIt) const;
+    template<typename MatrixColumnIterator, typename MatrixValueIterator>
+    uint64_t skipMultipleIgnoredRows(MatrixColumnIterator& matrixColumnIt, MatrixValueIterator& matrixValueIt) const {
+        using Encoding = ColumnEncoding<typename std::iterator_traits<MatrixColumnIterator>::value_type>;
+        IndexType result{0ull};
+        while (skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
+            ++result;
+            STORM_LOG_ASSERT(*matrixColumnIt >= Encoding::StartOfRowIndicator, "Undexpected state of VI operator");
+            // We (currently) don't use this past the end of a row group, so we may have this additional sanity check:
+            STORM_LOG_ASSERT(*matrixColumnIt < Encoding::StartOfRowGroupIndicator, "Undexpected state of VI operator");
+        }
+        return result;
+    }
+
+    /*!
+     * Fills singlePrecisionMatrixValues with the rounded matrix entries (or clears it if single precision values are not used)
+     */
+    void initializeSinglePrecisionValues();
 
     /*!
      * The non-zero matrix entries.
      */
-    std::vector<ValueType> matrixValues;
+    PlacedVector<ValueType> matrixValues;
+
+    /*!
+     * The non-zero matrix entries rounded to single precision. Only filled if useSinglePrecisionValues is true.
+     */
+    PlacedVector<float> singlePrecisionMatrixValues;
+
+    /*!
+     * True iff the operator is applied with the single precision matrix entries
+     */
+    bool useSinglePrecisionValues{false};
+
+    /*!
+     * True iff in-place parallel applications update the operand asynchronously
+     */
+    bool asynchronousUpdates{false};
+
+    /*!
+     * Compresses the matrix values into a dictionary (if requested and possible) or decompresses them (if not requested)
+     */
+    void initializeCompressedValues();
+
+    /*!
+     * Iterates over the compressed matrix values, i.e., dereferencing yields the dictionary value of the current index
+     */
+    struct DictionaryValueIterator {
+        typename PlacedVector<uint8_t>::const_iterator indexIt;
+        ValueType const* dictionary;
+
+        ValueType const& operator*() const {
+            return dictionary[*indexIt];
+        }
+        DictionaryValueIterator& operator++() {
+            ++indexIt;
+            return *this;
+        }
+        DictionaryValueIterator& operator+=(uint64_t offset) {
+            indexIt += offset;
+            return *this;
+        }
+        DictionaryValueIterator operator+(uint64_t offset) const {
+            return {indexIt + offset, dictionary};
+        }
+        bool operator==(DictionaryValueIterator const& other) const {
+            return indexIt == other.indexIt;
+        }
+    };
+
+    /*!
+     * True iff the matrix values shall be compressed
+     */
+    bool compressValues{false};
+
+    /*!
+     * True iff the matrix values are compressed, i.e., matrixValues is empty and the values are given by compressedMatrixValues and valueDictionary
+     */
+    bool usingCompressedValues{false};
+
+    /*!
+     * For each non-zero matrix entry, the index of its value in the dictionary. Only filled if usingCompressedValues is true.
+     */
+    PlacedVector<uint8_t> compressedMatrixValues;
+
+    /*!
+     * The distinct values of the matrix. Only filled if usingCompressedValues is true.
+     */
+    std::vector<ValueType> valueDictionary;
 
     /*!
      * Row indicators and columns of the matrix entries. Has size #non-zero matrix entries + #rows + 1
      * A row indicator is an index >= 1000...000. Before and after each row there is a row indicator.
+     * Empty if usingCompactIndices is true.
      */
-    std::vector<IndexType> matrixColumns;
+    PlacedVector<IndexType> matrixColumns;
+
+    /*!
+     * The same as matrixColumns, but with 32 bits per entry. Only filled if usingCompactIndices is true.
+     */
+    PlacedVector<CompactIndexType> compactMatrixColumns;
+
+    /*!
+     * True iff the columns shall be stored with 32 bits whenever possible
+     */
+    bool compactIndices{true};
+
+    /*!
+     * True iff the columns are stored with 32 bits, i.e., matrixColumns is empty and compactMatrixColumns is used instead
+     */
+    bool usingCompactIndices{false};
+
+    /*!
+     * Stores the columns with 32 bits (if requested and possible) or with 64 bits (if not requested)
+     * @param columnCount the number of columns of the matrix. Only relevant if the columns are currently stored with 64 bits
+     */
+    void initializeCompactIndices(uint64_t columnCount);
+
+    /*!
+     * Retrieves the row indicators and columns that are stored with the given type (i.e., matrixColumns or compactMatrixColumns)
+     */
+    template<typename ColumnType>
+    PlacedVector<ColumnType> const& getColumns() const {
+        if constexpr (std::is_same_v<ColumnType, IndexType>) {
+            return matrixColumns;
+        } else {
+            static_assert(std::is_same_v<ColumnType, CompactIndexType>, "Unexpected column type.");
+            return compactMatrixColumns;
+        }
+    }
+
+    /*!
+     * Invokes the given function with the currently used representation of the row indicators and columns (matrixColumns or compactMatrixColumns)
+     */
+    template<typename Function>
+    void visitColumns(Function const& function) {
+        if (usingCompactIndices) {
+            function(compactMatrixColumns);
+        } else {
+            function(matrixColumns);
+        }
+    }
 
     /*!
      * Row group indices as in the sparse matrix (even if the matrix is set in backwards order, this vector will not be reversed)
@@ -401,6 +884,61 @@ class ValueIterationOperator {
      */
     bool hasSkippedRows{false};
 
+    /*!
+     * A range of consecutive row groups that is processed by a single thread during a parallel application.
+     * Positions refer to the order in which the row groups are stored, i.e., they are reversed if the matrix was set backwards.
+     */
+    struct ParallelChunk {
+        uint64_t firstPosition;
+        uint64_t endPosition;
+        // The positions within matrixColumns and matrixValues at which the first row group of this chunk starts
+        uint64_t columnOffset;
+        uint64_t valueOffset;
+    };
+
+    /*!
+     * If threads are bound to NUMA nodes (see storm/utility/threads.h), the matrix entries of each chunk are moved to memory that is first touched by
+     * the thread that processes the chunk. The chunks are then statically assigned to the threads so that every thread reads node-local memory.
+     */
+    void placeOnThreads();
+
+    /*!
+     * Moves the given vector to memory whose part for each chunk (starting at the given offset of the chunk) is first touched by the thread processing it
+     */
+    template<typename T>
+    void placeVectorOnThreads(PlacedVector<T>& vector, uint64_t ParallelChunk::*offset) const;
+
+    /*!
+     * The default number of matrix entries of a chunk. With 8 byte columns and values (and the corresponding operand entries) this is about 512KB.
+     */
+    static constexpr uint64_t DefaultEntriesPerChunk = 1ull << 15;
+
+    /*!
+     * The number of threads used for parallel applications
+     */
+    uint64_t numberOfThreads{1};
+
+    /*!
+     * The (minimal) number of matrix entries per chunk
+     */
+    uint64_t entriesPerChunk{DefaultEntriesPerChunk};
+
+    /*!
+     * The chunks for parallel applications. Empty if only one thread is used
+     */
+    std::vector<ParallelChunk> parallelChunks;
+
+    /*!
+     * True iff the matrix entries of the chunks have been placed on the threads that process them (see placeOnThreads)
+     */
+    bool placedOnThreads{false};
+
+    /*!
+     * Buffers for in-place parallel applications
+     */
+    mutable std::vector<SolutionType> parallelBuffer;
+    mutable std::pair<std::vector<SolutionType>, std::vector<SolutionType>> parallelPairBuffer;
+
     /*!
      * Storage for the auxiliary vector
      */
@@ -418,7 +956,10 @@ class ValueIterationOperator {
 
     template<typename Dummy>
     struct ApplyCache<storm::Interval, Dummy> {
-        mutable std::vector<std::pair<SolutionType, SolutionType>> robustOrder;
+        // Has the same layout as matrixColumns. At the position of a row indicator, it stores the number k of entries of that row with a non-zero
+        // diameter. The subsequent k positions store the offsets of these entries within the row, ordered w.r.t. the operand values they were last
+        // applied with.
+        mutable std::vector<uint32_t> robustOrder;
     };
 
     /*!
@@ -427,19 +968,37 @@ class ValueIterationOperator {
     ApplyCache<ValueType, int> applyCache;
 
     /*!
-     * Bitmask that indicates the start of a row in the 'matrixColumns' vector
+     * Initializes the cached order of the uncertain row entries used in robust value iteration (if ValueType is storm::Interval)
      */
-    IndexType const StartOfRowIndicator = 1ull << 63;  // 10000..0
+    void initializeRobustOrder();
 
     /*!
-     * Bitmask that indicates the start of a row group in the 'matrixColumns' vector
+     * The bitmasks used in the 'matrixColumns' (or 'compactMatrixColumns') vector, depending on the number of bits per entry.
+     * Columns must be smaller than the smallest bitmask.
      */
-    IndexType const StartOfRowGroupIndicator = StartOfRowIndicator + (1ull << 62);  // 11000..0
+    template<typename ColumnType>
+    struct ColumnEncoding {
+        static_assert(std::is_unsigned_v<ColumnType>, "Unexpected column type.");
+
+        /*!
+         * Bitmask that indicates the start of a row
+         */
+        static constexpr ColumnType StartOfRowIndicator = static_cast<ColumnType>(1) << (8 * sizeof(ColumnType) - 1);  // 10000..0
+
+        /*!
+         * Bitmask that indicates the start of a row group
+         */
+        static constexpr ColumnType StartOfRowGroupIndicator =
+            StartOfRowIndicator + (static_cast<ColumnType>(1) << (8 * sizeof(ColumnType) - 2));  // 11000..0
+
+        /*!
+         * Ignored rows are encoded by adding the number of skipped entries to the row indicator. This Bitmask helps to get the number of skipped entries
+         */
+        static constexpr ColumnType SkipNumEntriesMask = static_cast<ColumnType>(~StartOfRowGroupIndicator);  // 00111..1
+    };
 
-    /*!
-     * Ignored rows are encoded by adding the number of skipped entries to the row indicator. This Bitmask helps to get the number of skipped entries
-     */
-    IndexType const SkipNumEntriesMask = ~StartOfRowGroupIndicator;  // 00111..1
+    static constexpr IndexType StartOfRowIndicator = ColumnEncoding<IndexType>::StartOfRowIndicator;
+    static constexpr IndexType StartOfRowGroupIndicator = ColumnEncoding<IndexType>::StartOfRowGroupIndicator;
 };
 
 }  // namespace solver::helper
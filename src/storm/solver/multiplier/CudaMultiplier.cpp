@@ -0,0 +1,336 @@
+#include "storm/solver/multiplier/CudaMultiplier.h"
+
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CUDA
+
+#include <type_traits>
+
+#include <cuda_runtime_api.h>
+
+#include "storm/solver/multiplier/cuda/CudaKernels.h"
+#include "storm/storage/SplitSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/SignalHandler.h"
+
+#include "storm/exceptions/UnexpectedException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+namespace {
+
+// The number of matrix entries that are converted at once when the matrix is copied to the device.
+uint64_t const entryStagingSize = 1ull << 20;
+
+void checkCuda(cudaError_t error, char const* operation) {
+    STORM_LOG_THROW(error == cudaSuccess, storm::exceptions::UnexpectedException, "CUDA error while " << operation << ": " << cudaGetErrorString(error));
+}
+
+/*!
+ * An array in device memory.
+ */
+template<typename T>
+class DeviceArray {
+   public:
+    DeviceArray() = default;
+    DeviceArray(DeviceArray const&) = delete;
+    DeviceArray& operator=(DeviceArray const&) = delete;
+
+    ~DeviceArray() {
+        if (pointer) {
+            cudaFree(pointer);
+        }
+    }
+
+    /*!
+     * Ensures that the array can hold the given number of elements. The content is not preserved if the array has to be reallocated.
+     */
+    void reserve(uint64_t size) {
+        if (size > capacity) {
+            if (pointer) {
+                checkCuda(cudaFree(pointer), "freeing device memory");
+                pointer = nullptr;
+            }
+            checkCuda(cudaMalloc(reinterpret_cast<void**>(&pointer), size * sizeof(T)), "allocating device memory");
+            capacity = size;
+        }
+    }
+
+    void upload(T const* source, uint64_t size, uint64_t offset = 0) {
+        checkCuda(cudaMemcpy(pointer + offset, source, size * sizeof(T), cudaMemcpyHostToDevice), "copying data to the device");
+    }
+
+    void download(T* target, uint64_t size) const {
+        checkCuda(cudaMemcpy(target, pointer, size * sizeof(T), cudaMemcpyDeviceToHost), "copying data from the device");
+    }
+
+    void swap(DeviceArray& other) {
+        std::swap(pointer, other.pointer);
+        std::swap(capacity, other.capacity);
+    }
+
+    T* data() {
+        return pointer;
+    }
+
+    T const* data() const {
+        return pointer;
+    }
+
+   private:
+    T* pointer = nullptr;
+    uint64_t capacity = 0;
+};
+
+}  // namespace
+
+template<typename ValueType>
+struct CudaMultiplier<ValueType>::DeviceStorage {
+    uint64_t rowCount;
+    uint64_t columnCount;
+    uint64_t rowGroupCount;
+
+    // The matrix in CSR format and its row groups.
+    DeviceArray<uint64_t> rowIndications;
+    DeviceArray<uint32_t> columns;
+    DeviceArray<double> values;
+    DeviceArray<uint64_t> rowGroupIndices;
+
+    // The current and the next iterate, the summand and the values of the rows before they are reduced.
+    DeviceArray<double> x;
+    DeviceArray<double> nextX;
+    DeviceArray<double> b;
+    DeviceArray<double> rowValues;
+    DeviceArray<uint64_t> choices;
+    DeviceArray<int> notConverged;
+};
+
+template<typename ValueType>
+CudaMultiplier<ValueType>::CudaMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : Multiplier<ValueType>(matrix), device(std::make_unique<DeviceStorage>()) {
+    static_assert(std::is_same_v<ValueType, double>, "The CUDA multiplier only supports double matrices.");
+    STORM_LOG_THROW(isSupported(matrix), storm::exceptions::UnexpectedException,
+                    "The matrix has " << matrix.getColumnCount() << " columns, which exceeds the range of the column indices of the CUDA multiplier.");
+    device->rowCount = matrix.getRowCount();
+    device->columnCount = matrix.getColumnCount();
+    device->rowGroupCount = matrix.getRowGroupCount();
+
+    // The entries are converted to the split representation in chunks to avoid a full copy of the matrix on the host.
+    std::vector<uint64_t> rowIndications;
+    rowIndications.reserve(device->rowCount + 1);
+    std::vector<uint32_t> columnStaging;
+    std::vector<double> valueStaging;
+    columnStaging.reserve(entryStagingSize);
+    valueStaging.reserve(entryStagingSize);
+    device->columns.reserve(matrix.getEntryCount());
+    device->values.reserve(matrix.getEntryCount());
+    uint64_t uploadedEntries = 0;
+    auto flushStaging = [&]() {
+        device->columns.upload(columnStaging.data(), columnStaging.size(), uploadedEntries);
+        device->values.upload(valueStaging.data(), valueStaging.size(), uploadedEntries);
+        uploadedEntries += columnStaging.size();
+        columnStaging.clear();
+        valueStaging.clear();
+    };
+    for (uint64_t row = 0; row < device->rowCount; ++row) {
+        rowIndications.push_back(uploadedEntries + columnStaging.size());
+        for (auto const& entry : matrix.getRow(row)) {
+            columnStaging.push_back(static_cast<uint32_t>(entry.getColumn()));
+            valueStaging.push_back(entry.getValue());
+            if (columnStaging.size() == entryStagingSize) {
+                flushStaging();
+            }
+        }
+    }
+    flushStaging();
+    rowIndications.push_back(uploadedEntries);
+    device->rowIndications.reserve(rowIndications.size());
+    device->rowIndications.upload(rowIndications.data(), rowIndications.size());
+
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    device->rowGroupIndices.reserve(rowGroupIndices.size());
+    device->rowGroupIndices.upload(rowGroupIndices.data(), rowGroupIndices.size());
+
+    // The iterates are swapped after each iteration, so both vectors have the same size.
+    device->x.reserve(std::max(device->rowCount, device->columnCount));
+    device->nextX.reserve(std::max(device->rowCount, device->columnCount));
+    device->notConverged.reserve(1);
+    STORM_LOG_INFO("Copied matrix with " << matrix.getEntryCount() << " entries to the CUDA device.");
+}
+
+template<typename ValueType>
+CudaMultiplier<ValueType>::~CudaMultiplier() = default;
+
+template<typename ValueType>
+bool CudaMultiplier<ValueType>::isSupported(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    return storm::storage::SplitSparseMatrix<ValueType, uint32_t>::fitsColumnIndexType(matrix);
+}
+
+template<typename ValueType>
+void CudaMultiplier<ValueType>::upload(std::vector<ValueType> const& x, std::vector<ValueType> const* b) const {
+    device->x.upload(x.data(), device->columnCount);
+    if (b) {
+        device->b.reserve(device->rowCount);
+        device->b.upload(b->data(), device->rowCount);
+    }
+}
+
+template<typename ValueType>
+void CudaMultiplier<ValueType>::multiplyOnDevice(std::optional<OptimizationDirection> const& dir, bool addSummand,
+                                                 std::vector<uint_fast64_t>* choices) const {
+    double const* summand = addSummand ? device->b.data() : nullptr;
+    if (!dir) {
+        cuda::launchMultiply(device->rowCount, device->rowIndications.data(), device->columns.data(), device->values.data(), device->x.data(), summand,
+                             device->nextX.data());
+    } else {
+        device->rowValues.reserve(device->rowCount);
+        cuda::launchMultiply(device->rowCount, device->rowIndications.data(), device->columns.data(), device->values.data(), device->x.data(), summand,
+                             device->rowValues.data());
+        cuda::launchReduce(device->rowGroupCount, device->rowGroupIndices.data(), device->rowValues.data(), *dir == OptimizationDirection::Minimize,
+                           device->nextX.data(), choices ? device->choices.data() : nullptr);
+    }
+    checkCuda(cudaGetLastError(), "launching a kernel");
+}
+
+template<typename ValueType>
+void CudaMultiplier<ValueType>::repeatedMultiplyOnDevice(std::optional<OptimizationDirection> const& dir, bool addSummand, uint64_t n) const {
+    for (uint64_t i = 0; i < n; ++i) {
+        multiplyOnDevice(dir, addSummand, nullptr);
+        device->x.swap(device->nextX);
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Aborting after " << i << " of " << n << " multiplications.");
+            break;
+        }
+    }
+}
+
+template<typename ValueType>
+void CudaMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                         std::vector<ValueType>& result) const {
+    upload(x, b);
+    multiplyOnDevice(std::nullopt, b != nullptr, nullptr);
+    device->nextX.download(result.data(), device->rowCount);
+}
+
+template<typename ValueType>
+void CudaMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+    if (backwards) {
+        this->matrix.multiplyWithVectorBackward(x, x, b);
+    } else {
+        this->matrix.multiplyWithVectorForward(x, x, b);
+    }
+}
+
+template<typename ValueType>
+void CudaMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                  std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                  std::vector<uint_fast64_t>* choices) const {
+    if (&rowGroupIndices != &this->matrix.getRowGroupIndices() && rowGroupIndices != this->matrix.getRowGroupIndices()) {
+        // Only the row groups of the matrix are available on the device.
+        std::vector<ValueType>* target = &result;
+        if (&x == &result) {
+            if (this->cachedVector) {
+                this->cachedVector->resize(x.size());
+            } else {
+                this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+            }
+            target = this->cachedVector.get();
+        }
+        this->matrix.multiplyAndReduce(dir, rowGroupIndices, x, b, *target, choices);
+        if (&x == &result) {
+            std::swap(result, *this->cachedVector);
+        }
+        return;
+    }
+    upload(x, b);
+    if (choices) {
+        device->choices.reserve(device->rowGroupCount);
+        device->choices.upload(choices->data(), device->rowGroupCount);
+    }
+    multiplyOnDevice(dir, b != nullptr, choices);
+    device->nextX.download(result.data(), device->rowGroupCount);
+    if (choices) {
+        device->choices.download(choices->data(), device->rowGroupCount);
+    }
+}
+
+template<typename ValueType>
+void CudaMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir,
+                                                             std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                             std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+    if (backwards) {
+        this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+    } else {
+        this->matrix.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+    }
+}
+
+template<typename ValueType>
+void CudaMultiplier<ValueType>::repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const {
+    upload(x, b);
+    repeatedMultiplyOnDevice(std::nullopt, b != nullptr, n);
+    device->x.download(x.data(), device->columnCount);
+}
+
+template<typename ValueType>
+void CudaMultiplier<ValueType>::repeatedMultiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x,
+                                                          std::vector<ValueType> const* b, uint64_t n) const {
+    upload(x, b);
+    repeatedMultiplyOnDevice(dir, b != nullptr, n);
+    device->x.download(x.data(), device->columnCount);
+}
+
+template<typename ValueType>
+SolverStatus CudaMultiplier<ValueType>::iterate(std::optional<OptimizationDirection> const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b,
+                                                ValueType precision, bool relative, uint64_t maximalNumberOfIterations, uint64_t& numberOfIterations) const {
+    upload(x, b);
+    SolverStatus status = SolverStatus::InProgress;
+    for (uint64_t iteration = 0; iteration < maximalNumberOfIterations; ++iteration) {
+        multiplyOnDevice(dir, b != nullptr, nullptr);
+        int const reset = 0;
+        device->notConverged.upload(&reset, 1);
+        cuda::launchCheckConvergence(device->columnCount, device->x.data(), device->nextX.data(), precision, relative, device->notConverged.data());
+        checkCuda(cudaGetLastError(), "launching a kernel");
+        device->x.swap(device->nextX);
+        ++numberOfIterations;
+
+        // Only the convergence flag is transferred in each iteration.
+        int notConverged;
+        device->notConverged.download(&notConverged, 1);
+        if (notConverged == 0) {
+            status = SolverStatus::Converged;
+            break;
+        }
+        if (storm::utility::resources::isTerminate()) {
+            status = SolverStatus::Aborted;
+            break;
+        }
+    }
+    device->x.download(x.data(), device->columnCount);
+    return status == SolverStatus::InProgress ? SolverStatus::MaximalIterationsExceeded : status;
+}
+
+template<typename ValueType>
+void CudaMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+    for (auto const& entry : this->matrix.getRow(rowIndex)) {
+        value += entry.getValue() * x[entry.getColumn()];
+    }
+}
+
+template<typename ValueType>
+void CudaMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
+                                             ValueType& val2) const {
+    for (auto const& entry : this->matrix.getRow(rowIndex)) {
+        val1 += entry.getValue() * x1[entry.getColumn()];
+        val2 += entry.getValue() * x2[entry.getColumn()];
+    }
+}
+
+template class CudaMultiplier<double>;
+
+}  // namespace solver
+}  // namespace storm
+
+#endif
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "storm/solver/multiplier/Multiplier.h"
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
+namespace solver {
+
+/*!
+ * A multiplier for double matrices that performs the multiplications on a CUDA device. The matrix is copied to the device (in CSR format with 32-bit
+ * column indices) upon construction and stays there for the lifetime of the multiplier. Single multiplications transfer the input vector to the
+ * device and the result back. Repeated multiplications and iterate() keep the vectors on the device such that only the final vector (and, for
+ * iterate(), a convergence flag per iteration) is transferred back.
+ *
+ * Gauss-Seidel style multiplications and the multiplication of single rows are performed on the host with the original matrix. This multiplier is
+ * only available if storm was built with STORM_USE_CUDA.
+ */
+template<typename ValueType>
+class CudaMultiplier : public Multiplier<ValueType> {
+   public:
+    CudaMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+    virtual ~CudaMultiplier();
+
+    /*!
+     * Checks whether the given matrix can be handled by this multiplier, i.e., whether its column indices fit into 32 bits.
+     */
+    static bool isSupported(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                          std::vector<ValueType>& result) const override;
+    virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+    virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                   std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                   std::vector<uint_fast64_t>* choices = nullptr) const override;
+    virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                              std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr,
+                                              bool backwards = true) const override;
+    virtual void repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const override;
+    virtual void repeatedMultiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x,
+                                           std::vector<ValueType> const* b, uint64_t n) const override;
+    virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
+    virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
+                              ValueType& val2) const override;
+
+    /*!
+     * Performs value iteration x' = A*x + b (followed by a reduction over the row groups if a direction is given) on the device until two
+     * consecutive iterates are equal modulo the given precision or the maximal number of iterations is reached.
+     *
+     * @param dir If given, the result of each multiplication is minimized/maximized over the row groups.
+     * @param x The initial vector. After the iteration, it contains the last iterate.
+     * @param b If non-null, this vector is added after each multiplication.
+     * @param numberOfIterations The number of performed iterations is added to this value.
+     * @return Converged or MaximalIterationsExceeded.
+     */
+    SolverStatus iterate(std::optional<OptimizationDirection> const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, ValueType precision,
+                         bool relative, uint64_t maximalNumberOfIterations, uint64_t& numberOfIterations) const;
+
+   private:
+    struct DeviceStorage;
+
+    /*!
+     * Performs n iterations on the vectors that are stored on the device. The current iterate is always in the first vector.
+     */
+    void repeatedMultiplyOnDevice(std::optional<OptimizationDirection> const& dir, bool addSummand, uint64_t n) const;
+
+    /*!
+     * Performs a single iteration on the device, writing the next iterate to the second vector.
+     */
+    void multiplyOnDevice(std::optional<OptimizationDirection> const& dir, bool addSummand, std::vector<uint_fast64_t>* choices) const;
+
+    /*!
+     * Copies the given vectors to the device.
+     */
+    void upload(std::vector<ValueType> const& x, std::vector<ValueType> const* b) const;
+
+    // The device memory that holds the matrix and the vectors.
+    std::unique_ptr<DeviceStorage> device;
+};
+
+}  // namespace solver
+}  // namespace storm
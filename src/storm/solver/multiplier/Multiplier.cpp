@@ -1,5 +1,7 @@
 #include "Multiplier.h"
 
+#include <algorithm>
+
 #include "storm-config.h"
 
 #include "storm/storage/SparseMatrix.h"
@@ -11,16 +13,94 @@
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/multiplier/CudaMultiplier.h"
 #include "storm/solver/multiplier/GmmxxMultiplier.h"
+#include "storm/solver/multiplier/SimdMultiplier.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
 
 namespace storm {
 namespace solver {
 
+namespace detail {
+
+/*!
+ * Adds the product of the given row with each vector of the interleaved block x to the corresponding entry of values.
+ * If FixedBlockSize is non-zero, it has to coincide with blockSize. The compiler can then unroll and vectorize the loop over the block.
+ */
+template<uint64_t FixedBlockSize, typename ValueType>
+void multiplyRowWithBlock(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t row, uint64_t blockSize, ValueType const* x, ValueType* values) {
+    uint64_t const k = FixedBlockSize == 0 ? blockSize : FixedBlockSize;
+    for (auto const& entry : matrix.getRow(row)) {
+        ValueType const& value = entry.getValue();
+        ValueType const* xBlock = x + entry.getColumn() * k;
+        for (uint64_t i = 0; i < k; ++i) {
+            values[i] += value * xBlock[i];
+        }
+    }
+}
+
+template<uint64_t FixedBlockSize, typename ValueType>
+void multiplyBlock(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t blockSize, ValueType const* x, ValueType const* b, ValueType* result) {
+    uint64_t const k = FixedBlockSize == 0 ? blockSize : FixedBlockSize;
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        ValueType* values = result + row * k;
+        for (uint64_t i = 0; i < k; ++i) {
+            values[i] = b ? b[row * k + i] : storm::utility::zero<ValueType>();
+        }
+        multiplyRowWithBlock<FixedBlockSize>(matrix, row, k, x, values);
+    }
+}
+
+template<uint64_t FixedBlockSize, typename ValueType>
+void multiplyAndReduceBlock(storm::storage::SparseMatrix<ValueType> const& matrix, OptimizationDirection const& dir, uint64_t blockSize, ValueType const* x,
+                            ValueType const* b, ValueType* result) {
+    uint64_t const k = FixedBlockSize == 0 ? blockSize : FixedBlockSize;
+    std::vector<ValueType> values(k);
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    for (uint64_t group = 0; group + 1 < rowGroupIndices.size(); ++group) {
+        ValueType* best = result + group * k;
+        for (uint64_t row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+            for (uint64_t i = 0; i < k; ++i) {
+                values[i] = b ? b[row * k + i] : storm::utility::zero<ValueType>();
+            }
+            multiplyRowWithBlock<FixedBlockSize>(matrix, row, k, x, values.data());
+            if (row == rowGroupIndices[group]) {
+                std::copy(values.begin(), values.end(), best);
+            } else if (minimize(dir)) {
+                for (uint64_t i = 0; i < k; ++i) {
+                    best[i] = std::min(best[i], values[i]);
+                }
+            } else {
+                for (uint64_t i = 0; i < k; ++i) {
+                    best[i] = std::max(best[i], values[i]);
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * Retrieves whether the two vectors are equal. For floating point values, a positive precision bounds the allowed absolute difference.
+ */
+template<typename ValueType>
+bool isSteady(std::vector<ValueType> const& x, std::vector<ValueType> const& next, double precision) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (precision > 0.0) {
+            return storm::utility::vector::equalModuloPrecision(x, next, precision, false);
+        }
+    }
+    return x == next;
+}
+
+}  // namespace detail
+
 template<typename ValueType>
 Multiplier<ValueType>::Multiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : matrix(matrix) {
     // Intentionally left empty.
@@ -73,6 +153,128 @@ void Multiplier<ValueType>::repeatedMultiplyAndReduce(Environment const& env, Op
     }
 }
 
+template<typename ValueType>
+uint64_t Multiplier<ValueType>::repeatedMultiplyUntilSteady(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n,
+                                                            double precision) const {
+    storm::utility::ProgressMeasurement progress("multiplications");
+    progress.setMaxCount(n);
+    progress.startNewMeasurement(0);
+    std::vector<ValueType> next(this->matrix.getRowCount());
+    for (uint64_t i = 0; i < n; ++i) {
+        progress.updateProgress(i);
+        multiply(env, x, b, next);
+        bool const steady = detail::isSteady(x, next, precision);
+        std::swap(x, next);
+        if (steady) {
+            STORM_LOG_INFO("Vector is steady after " << (i + 1) << " of " << n << " multiplications.");
+            return i + 1;
+        }
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Aborting after " << i << " of " << n << " multiplications.");
+            return i + 1;
+        }
+    }
+    return n;
+}
+
+template<typename ValueType>
+uint64_t Multiplier<ValueType>::repeatedMultiplyAndReduceUntilSteady(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x,
+                                                                     std::vector<ValueType> const* b, uint64_t n, double precision) const {
+    storm::utility::ProgressMeasurement progress("multiplications");
+    progress.setMaxCount(n);
+    progress.startNewMeasurement(0);
+    std::vector<ValueType> next(this->matrix.getRowGroupCount());
+    for (uint64_t i = 0; i < n; ++i) {
+        progress.updateProgress(i);
+        multiplyAndReduce(env, dir, x, b, next);
+        bool const steady = detail::isSteady(x, next, precision);
+        std::swap(x, next);
+        if (steady) {
+            STORM_LOG_INFO("Vector is steady after " << (i + 1) << " of " << n << " multiplications.");
+            return i + 1;
+        }
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Aborting after " << i << " of " << n << " multiplications.");
+            return i + 1;
+        }
+    }
+    return n;
+}
+
+template<typename ValueType>
+void Multiplier<ValueType>::multiplyBlock(Environment const&, uint64_t blockSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                          std::vector<ValueType>& result) const {
+    STORM_LOG_ASSERT(x.size() == blockSize * this->matrix.getColumnCount(), "Unexpected size of input block.");
+    STORM_LOG_ASSERT(!b || b->size() == blockSize * this->matrix.getRowCount(), "Unexpected size of offset block.");
+    if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Block multiplication is not supported for interval matrices.");
+    } else {
+        // The input block is still needed while the result is written, so we write to a separate block if both coincide.
+        std::vector<ValueType>* target = &result;
+        if (&x == &result) {
+            if (!this->cachedVector) {
+                this->cachedVector = std::make_unique<std::vector<ValueType>>();
+            }
+            target = this->cachedVector.get();
+        }
+        target->resize(blockSize * this->matrix.getRowCount());
+        ValueType const* offsets = b ? b->data() : nullptr;
+        switch (blockSize) {
+            case 2:
+                detail::multiplyBlock<2>(this->matrix, blockSize, x.data(), offsets, target->data());
+                break;
+            case 4:
+                detail::multiplyBlock<4>(this->matrix, blockSize, x.data(), offsets, target->data());
+                break;
+            case 8:
+                detail::multiplyBlock<8>(this->matrix, blockSize, x.data(), offsets, target->data());
+                break;
+            default:
+                detail::multiplyBlock<0>(this->matrix, blockSize, x.data(), offsets, target->data());
+        }
+        if (target != &result) {
+            std::swap(result, *target);
+        }
+    }
+}
+
+template<typename ValueType>
+void Multiplier<ValueType>::multiplyAndReduceBlock(Environment const&, OptimizationDirection const& dir, uint64_t blockSize, std::vector<ValueType> const& x,
+                                                   std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+    STORM_LOG_ASSERT(x.size() == blockSize * this->matrix.getColumnCount(), "Unexpected size of input block.");
+    STORM_LOG_ASSERT(!b || b->size() == blockSize * this->matrix.getRowCount(), "Unexpected size of offset block.");
+    if constexpr (std::is_same_v<ValueType, storm::Interval> || std::is_same_v<ValueType, storm::RationalFunction>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Block multiplication with reduction is not supported for this value type.");
+    } else {
+        // The input block is still needed while the result is written, so we write to a separate block if both coincide.
+        std::vector<ValueType>* target = &result;
+        if (&x == &result) {
+            if (!this->cachedVector) {
+                this->cachedVector = std::make_unique<std::vector<ValueType>>();
+            }
+            target = this->cachedVector.get();
+        }
+        target->resize(blockSize * this->matrix.getRowGroupCount());
+        ValueType const* offsets = b ? b->data() : nullptr;
+        switch (blockSize) {
+            case 2:
+                detail::multiplyAndReduceBlock<2>(this->matrix, dir, blockSize, x.data(), offsets, target->data());
+                break;
+            case 4:
+                detail::multiplyAndReduceBlock<4>(this->matrix, dir, blockSize, x.data(), offsets, target->data());
+                break;
+            case 8:
+                detail::multiplyAndReduceBlock<8>(this->matrix, dir, blockSize, x.data(), offsets, target->data());
+                break;
+            default:
+                detail::multiplyAndReduceBlock<0>(this->matrix, dir, blockSize, x.data(), offsets, target->data());
+        }
+        if (target != &result) {
+            std::swap(result, *target);
+        }
+    }
+}
+
 template<typename ValueType>
 void Multiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
                                          ValueType& val2) const {
@@ -107,6 +309,27 @@ std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Envi
             return std::make_unique<GmmxxMultiplier<ValueType>>(matrix);
         case MultiplierType::Native:
             return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+        case MultiplierType::Simd:
+            if constexpr (std::is_same_v<ValueType, double>) {
+                return std::make_unique<SimdMultiplier<ValueType>>(matrix);
+            } else {
+                STORM_LOG_WARN("The SIMD multiplier only supports double matrices. Falling back to the native multiplier.");
+                return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+            }
+        case MultiplierType::Cuda:
+#ifdef STORM_HAVE_CUDA
+            if constexpr (std::is_same_v<ValueType, double>) {
+                if (CudaMultiplier<ValueType>::isSupported(matrix)) {
+                    return std::make_unique<CudaMultiplier<ValueType>>(matrix);
+                }
+                STORM_LOG_WARN("The matrix has too many columns for the CUDA multiplier. Falling back to the native multiplier.");
+            } else {
+                STORM_LOG_WARN("The CUDA multiplier only supports double matrices. Falling back to the native multiplier.");
+            }
+#else
+            STORM_LOG_WARN("Storm was built without support for CUDA. Falling back to the native multiplier.");
+#endif
+            return std::make_unique<NativeMultiplier<ValueType>>(matrix);
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Unknown MultiplierType");
 }
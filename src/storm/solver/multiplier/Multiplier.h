@@ -104,7 +104,7 @@ class Multiplier {
      * to the number of rows of A.
      * @param n The number of times to perform the multiplication.
      */
-    void repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const;
+    virtual void repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const;
 
     /*!
      * Performs repeated matrix-vector multiplication x' = A*x + b and then minimizes/maximizes over the row groups
@@ -119,8 +119,53 @@ class Multiplier {
      * to the number of rows of A.
      * @param n The number of times to perform the multiplication.
      */
-    void repeatedMultiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b,
-                                   uint64_t n) const;
+    virtual void repeatedMultiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x,
+                                           std::vector<ValueType> const* b, uint64_t n) const;
+
+    /*!
+     * Performs (at most) n repeated matrix-vector multiplications as repeatedMultiply, but stops as soon as one multiplication does not change x.
+     * Since all further multiplications would then yield the same vector, the result is exact.
+     *
+     * @param precision If positive, the (absolute) precision with which the vector already counts as unchanged. This is only considered for
+     * floating point values. Stopping at such an approximate fixpoint gives an approximate result.
+     * @return The number of multiplications that were performed.
+     */
+    uint64_t repeatedMultiplyUntilSteady(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n,
+                                         double precision = 0.0) const;
+
+    /*!
+     * Performs (at most) n repeated matrix-vector multiplications with reduction as repeatedMultiplyAndReduce, but stops as soon as one
+     * multiplication does not change x (see repeatedMultiplyUntilSteady).
+     *
+     * @return The number of multiplications that were performed.
+     */
+    uint64_t repeatedMultiplyAndReduceUntilSteady(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x,
+                                                  std::vector<ValueType> const* b, uint64_t n, double precision = 0.0) const;
+
+    /*!
+     * Performs the matrix-vector multiplications x_i' = A*x_i + b_i for a block of k vectors x_1, ..., x_k at once. The vectors of a block are stored
+     * interleaved, i.e., entry j of vector i is at position j*k+i. Each matrix entry is thus loaded once for all vectors of the block.
+     *
+     * @param blockSize The number k of vectors in the block.
+     * @param x The input block. Its length must be k times the number of columns of A.
+     * @param b If non-null, this block is added after the multiplication. If given, its length must be k times the number of rows of A.
+     * @param result The target block. Its length must be k times the number of rows of A. Can be the same as x.
+     */
+    virtual void multiplyBlock(Environment const& env, uint64_t blockSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                               std::vector<ValueType>& result) const;
+
+    /*!
+     * Performs the matrix-vector multiplications x_i' = A*x_i + b_i for a block of k interleaved vectors (see multiplyBlock) and then
+     * minimizes/maximizes each vector over the row groups of A.
+     *
+     * @param dir The direction for the reduction step.
+     * @param blockSize The number k of vectors in the block.
+     * @param x The input block. Its length must be k times the number of columns of A.
+     * @param b If non-null, this block is added after the multiplication. If given, its length must be k times the number of rows of A.
+     * @param result The target block. Its length must be k times the number of row groups of A. Can be the same as x.
+     */
+    virtual void multiplyAndReduceBlock(Environment const& env, OptimizationDirection const& dir, uint64_t blockSize, std::vector<ValueType> const& x,
+                                        std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
 
     /*!
      * Multiplies the row with the given index with x and adds the result to the provided value
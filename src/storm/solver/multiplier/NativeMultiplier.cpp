@@ -1,28 +1,69 @@
 #include "NativeMultiplier.h"
 
+#include <algorithm>
+#include <type_traits>
+
 #include "storm-config.h"
 
 #include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/storage/SparseMatrix.h"
 
-#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace solver {
 
+namespace {
+// The minimal number of rows that each thread processes in a parallel multiplication. For fewer rows, starting the threads costs more than it saves.
+uint64_t const minimalNumberOfRowsPerThread = 50000;
+}  // namespace
+
 template<typename ValueType>
 NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix) {
     // Intentionally left empty.
 }
 
 template<typename ValueType>
-bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
-    return false;
+void NativeMultiplier<ValueType>::clearCache() const {
+    splitMatrix32.reset();
+    splitMatrix64.reset();
+    Multiplier<ValueType>::clearCache();
+}
+
+template<typename ValueType>
+uint64_t NativeMultiplier<ValueType>::getNumberOfThreads(Environment const& env) const {
+    // Arithmetic on rational functions uses shared caches and is therefore not thread-safe.
+    if constexpr (std::is_same_v<ValueType, double> || std::is_same_v<ValueType, storm::RationalNumber>) {
+        return std::min<uint64_t>(env.solver().getNumberOfThreads(), std::max<uint64_t>(1, this->matrix.getRowCount() / minimalNumberOfRowsPerThread));
+    } else {
+        return 1;
+    }
+}
+
+template<typename ValueType>
+bool NativeMultiplier<ValueType>::useSplitStorage(Environment const& env) const {
+    if constexpr (std::is_same_v<ValueType, double> || std::is_same_v<ValueType, storm::RationalNumber>) {
+        if (!env.solver().multiplier().isSplitStorageSet()) {
+            return false;
+        }
+        if (!splitMatrix32 && !splitMatrix64) {
+            if (storm::storage::SplitSparseMatrix<ValueType, uint32_t>::fitsColumnIndexType(this->matrix)) {
+                splitMatrix32 = std::make_unique<storm::storage::SplitSparseMatrix<ValueType, uint32_t>>(this->matrix);
+            } else {
+                splitMatrix64 = std::make_unique<storm::storage::SplitSparseMatrix<ValueType, uint64_t>>(this->matrix);
+            }
+        }
+        return true;
+    } else {
+        STORM_LOG_WARN_COND(!env.solver().multiplier().isSplitStorageSet(), "Split storage is not supported for this value type, ignoring it.");
+        return false;
+    }
 }
 
 template<typename ValueType>
@@ -37,8 +78,10 @@ void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<V
         }
         target = this->cachedVector.get();
     }
-    if (parallelize(env)) {
-        multAddParallel(x, b, *target);
+    if (uint64_t const numberOfThreads = getNumberOfThreads(env); numberOfThreads > 1) {
+        multAddParallel(numberOfThreads, x, b, *target);
+    } else if (useSplitStorage(env)) {
+        multAddSplit(x, b, *target);
     } else {
         multAdd(x, b, *target);
     }
@@ -70,8 +113,10 @@ void NativeMultiplier<ValueType>::multiplyAndReduce(Environment const& env, Opti
         }
         target = this->cachedVector.get();
     }
-    if (parallelize(env)) {
-        multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
+    if (uint64_t const numberOfThreads = getNumberOfThreads(env); numberOfThreads > 1 && !choices) {
+        multAddReduceParallel(numberOfThreads, dir, rowGroupIndices, x, b, *target, choices);
+    } else if (useSplitStorage(env)) {
+        multAddReduceSplit(dir, rowGroupIndices, x, b, *target, choices);
     } else {
         multAddReduce(dir, rowGroupIndices, x, b, *target, choices);
     }
@@ -120,25 +165,72 @@ void NativeMultiplier<ValueType>::multAddReduce(storm::solver::OptimizationDirec
 }
 
 template<typename ValueType>
-void NativeMultiplier<ValueType>::multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
-#ifdef STORM_HAVE_INTELTBB
-    this->matrix.multiplyWithVectorParallel(x, result, b);
-#else
-    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-    multAdd(x, b, result);
-#endif
+void NativeMultiplier<ValueType>::multAddParallel(uint64_t numberOfThreads, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                  std::vector<ValueType>& result) const {
+    STORM_LOG_ASSERT(&x != &result, "In-place multiplication is not supported.");
+    result.resize(this->matrix.getRowCount());
+    auto multiplyRows = [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t row = begin; row < end; ++row) {
+            ValueType rowValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+            multiplyRow(row, x, rowValue);
+            result[row] = std::move(rowValue);
+        }
+    };
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), this->matrix.getRowCount(), multiplyRows);
 }
 
 template<typename ValueType>
-void NativeMultiplier<ValueType>::multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
-                                                        std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
-                                                        std::vector<uint64_t>* choices) const {
-#ifdef STORM_HAVE_INTELTBB
-    this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
-#else
-    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-    multAddReduce(dir, rowGroupIndices, x, b, result, choices);
-#endif
+void NativeMultiplier<ValueType>::multAddReduceParallel(uint64_t numberOfThreads, storm::solver::OptimizationDirection const& dir,
+                                                        std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
+                                                        std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    if constexpr (std::is_same_v<ValueType, double> || std::is_same_v<ValueType, storm::RationalNumber>) {
+        STORM_LOG_ASSERT(&x != &result, "In-place multiplication is not supported.");
+        STORM_LOG_ASSERT(!choices, "Choices are not tracked in parallel multiplications.");
+        // Like the sequential reduction, this leaves the results of empty row groups untouched.
+        auto multiplyGroups = [&](uint64_t, uint64_t begin, uint64_t end) {
+            for (uint64_t group = begin; group < end; ++group) {
+                uint64_t const groupEnd = rowGroupIndices[group + 1];
+                for (uint64_t row = rowGroupIndices[group]; row < groupEnd; ++row) {
+                    ValueType rowValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                    multiplyRow(row, x, rowValue);
+                    if (row == rowGroupIndices[group] || (minimize(dir) ? rowValue < result[group] : rowValue > result[group])) {
+                        result[group] = std::move(rowValue);
+                    }
+                }
+            }
+        };
+        storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(rowGroupIndices.size() - 1), multiplyGroups);
+    } else {
+        multAddReduce(dir, rowGroupIndices, x, b, result, choices);
+    }
+}
+
+template<typename ValueType>
+void NativeMultiplier<ValueType>::multAddSplit(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+    if constexpr (std::is_same_v<ValueType, double> || std::is_same_v<ValueType, storm::RationalNumber>) {
+        if (splitMatrix32) {
+            splitMatrix32->multiplyWithVector(x, result, b);
+        } else {
+            splitMatrix64->multiplyWithVector(x, result, b);
+        }
+    } else {
+        multAdd(x, b, result);
+    }
+}
+
+template<typename ValueType>
+void NativeMultiplier<ValueType>::multAddReduceSplit(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                     std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                     std::vector<uint64_t>* choices) const {
+    if constexpr (std::is_same_v<ValueType, double> || std::is_same_v<ValueType, storm::RationalNumber>) {
+        if (splitMatrix32) {
+            splitMatrix32->multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+        } else {
+            splitMatrix64->multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+        }
+    } else {
+        multAddReduce(dir, rowGroupIndices, x, b, result, choices);
+    }
 }
 
 template class NativeMultiplier<double>;
@@ -3,6 +3,7 @@
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SplitSparseMatrix.h"
 
 namespace storm {
 namespace storage {
@@ -18,6 +19,8 @@ class NativeMultiplier : public Multiplier<ValueType> {
     NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
     virtual ~NativeMultiplier() = default;
 
+    virtual void clearCache() const override;
+
     virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
                           std::vector<ValueType>& result) const override;
     virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
@@ -32,16 +35,34 @@ class NativeMultiplier : public Multiplier<ValueType> {
                               ValueType& val2) const override;
 
    private:
-    bool parallelize(Environment const& env) const;
+    /*!
+     * Retrieves the number of threads to use for one multiplication with the matrix. If this is one, the multiplication is performed sequentially.
+     */
+    uint64_t getNumberOfThreads(Environment const& env) const;
+
+    /*!
+     * Checks whether the split storage (separate arrays for columns and values) is to be used and, if so, makes sure that it has been created.
+     */
+    bool useSplitStorage(Environment const& env) const;
 
     void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
 
     void multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
                        std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
 
-    void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
-    void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
-                               std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+    void multAddParallel(uint64_t numberOfThreads, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+    void multAddReduceParallel(uint64_t numberOfThreads, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                               std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                               std::vector<uint64_t>* choices = nullptr) const;
+
+    void multAddSplit(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+    void multAddReduceSplit(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
+                            std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+
+    // Copies of the matrix in which columns and values are stored separately. At most one of them is set, where the one with 32-bit columns is
+    // preferred whenever the column count of the matrix permits it.
+    mutable std::unique_ptr<storm::storage::SplitSparseMatrix<ValueType, uint32_t>> splitMatrix32;
+    mutable std::unique_ptr<storm::storage::SplitSparseMatrix<ValueType, uint64_t>> splitMatrix64;
 };
 
 }  // namespace solver
@@ -0,0 +1,353 @@
+#include "storm/solver/multiplier/SimdMultiplier.h"
+
+#include <type_traits>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_SIMD_MULTIPLIER_X86
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define STORM_SIMD_MULTIPLIER_NEON
+#include <arm_neon.h>
+#endif
+
+namespace storm {
+namespace solver {
+
+std::string toString(SimdInstructionSet instructionSet) {
+    switch (instructionSet) {
+        case SimdInstructionSet::Scalar:
+            return "scalar";
+        case SimdInstructionSet::Avx2:
+            return "AVX2";
+        case SimdInstructionSet::Avx512:
+            return "AVX-512";
+        case SimdInstructionSet::Neon:
+            return "NEON";
+    }
+    return "invalid";
+}
+
+namespace {
+
+// The maximal number of rows whose values are buffered at once during multiplyAndReduce.
+uint64_t const rowValueBufferSize = 4096;
+
+/*!
+ * A kernel computes the values (A*x + b)_i of the rows firstRow <= i < endRow and writes them to out[i - firstRow].
+ */
+typedef void (*RowValuesKernel)(uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand,
+                                uint64_t firstRow, uint64_t endRow, double* out);
+
+void rowValuesScalar(uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand,
+                     uint64_t firstRow, uint64_t endRow, double* out) {
+    for (uint64_t row = firstRow; row < endRow; ++row) {
+        double rowValue = summand ? summand[row] : 0.0;
+        for (uint64_t entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+            rowValue += values[entry] * x[columns[entry]];
+        }
+        out[row - firstRow] = rowValue;
+    }
+}
+
+#ifdef STORM_SIMD_MULTIPLIER_X86
+__attribute__((target("avx2,fma"))) double horizontalSumAvx2(__m256d sum) {
+    __m128d lower = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(lower, _mm_unpackhi_pd(lower, lower)));
+}
+
+__attribute__((target("avx2,fma"))) void rowValuesAvx2(uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x,
+                                                       double const* summand, uint64_t firstRow, uint64_t endRow, double* out) {
+    for (uint64_t row = firstRow; row < endRow; ++row) {
+        uint64_t entry = rowIndications[row];
+        uint64_t const entryEnd = rowIndications[row + 1];
+        double rowValue = 0.0;
+        if (entry + 4 <= entryEnd) {
+            __m256d sum = _mm256_setzero_pd();
+            for (; entry + 4 <= entryEnd; entry += 4) {
+                __m128i indices = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + entry));
+                sum = _mm256_fmadd_pd(_mm256_loadu_pd(values + entry), _mm256_i32gather_pd(x, indices, 8), sum);
+            }
+            rowValue = horizontalSumAvx2(sum);
+        }
+        for (; entry < entryEnd; ++entry) {
+            rowValue += values[entry] * x[columns[entry]];
+        }
+        out[row - firstRow] = summand ? summand[row] + rowValue : rowValue;
+    }
+}
+
+__attribute__((target("avx512f,avx2,fma"))) void rowValuesAvx512(uint64_t const* rowIndications, uint32_t const* columns, double const* values,
+                                                                 double const* x, double const* summand, uint64_t firstRow, uint64_t endRow, double* out) {
+    for (uint64_t row = firstRow; row < endRow; ++row) {
+        uint64_t entry = rowIndications[row];
+        uint64_t const entryEnd = rowIndications[row + 1];
+        double rowValue = 0.0;
+        if (entry + 8 <= entryEnd) {
+            __m512d sum = _mm512_setzero_pd();
+            for (; entry + 8 <= entryEnd; entry += 8) {
+                __m256i indices = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns + entry));
+                sum = _mm512_fmadd_pd(_mm512_loadu_pd(values + entry), _mm512_i32gather_pd(indices, x, 8), sum);
+            }
+            rowValue = _mm512_reduce_add_pd(sum);
+        }
+        if (entry + 4 <= entryEnd) {
+            __m128i indices = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + entry));
+            rowValue += horizontalSumAvx2(_mm256_mul_pd(_mm256_loadu_pd(values + entry), _mm256_i32gather_pd(x, indices, 8)));
+            entry += 4;
+        }
+        for (; entry < entryEnd; ++entry) {
+            rowValue += values[entry] * x[columns[entry]];
+        }
+        out[row - firstRow] = summand ? summand[row] + rowValue : rowValue;
+    }
+}
+#endif
+
+#ifdef STORM_SIMD_MULTIPLIER_NEON
+void rowValuesNeon(uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* summand,
+                   uint64_t firstRow, uint64_t endRow, double* out) {
+    for (uint64_t row = firstRow; row < endRow; ++row) {
+        uint64_t entry = rowIndications[row];
+        uint64_t const entryEnd = rowIndications[row + 1];
+        double rowValue = 0.0;
+        if (entry + 2 <= entryEnd) {
+            // NEON has no gather instruction, so the referenced entries of x are loaded lane by lane.
+            float64x2_t sum = vdupq_n_f64(0.0);
+            for (; entry + 2 <= entryEnd; entry += 2) {
+                float64x2_t gathered = vld1q_lane_f64(x + columns[entry], vdupq_n_f64(0.0), 0);
+                gathered = vld1q_lane_f64(x + columns[entry + 1], gathered, 1);
+                sum = vfmaq_f64(sum, vld1q_f64(values + entry), gathered);
+            }
+            rowValue = vaddvq_f64(sum);
+        }
+        for (; entry < entryEnd; ++entry) {
+            rowValue += values[entry] * x[columns[entry]];
+        }
+        out[row - firstRow] = summand ? summand[row] + rowValue : rowValue;
+    }
+}
+#endif
+
+RowValuesKernel getKernel(SimdInstructionSet instructionSet) {
+    switch (instructionSet) {
+#ifdef STORM_SIMD_MULTIPLIER_X86
+        case SimdInstructionSet::Avx2:
+            return &rowValuesAvx2;
+        case SimdInstructionSet::Avx512:
+            return &rowValuesAvx512;
+#endif
+#ifdef STORM_SIMD_MULTIPLIER_NEON
+        case SimdInstructionSet::Neon:
+            return &rowValuesNeon;
+#endif
+        default:
+            return &rowValuesScalar;
+    }
+}
+
+}  // namespace
+
+template<typename ValueType>
+SimdMultiplier<ValueType>::SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : SimdMultiplier(matrix, detectInstructionSet()) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+SimdMultiplier<ValueType>::SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix, SimdInstructionSet instructionSet)
+    : Multiplier<ValueType>(matrix), instructionSet(instructionSet) {
+    static_assert(std::is_same_v<ValueType, double>, "The SIMD multiplier only supports double matrices.");
+    STORM_LOG_THROW(isSupported(instructionSet), storm::exceptions::NotSupportedException,
+                    "The instruction set " << toString(instructionSet) << " is not supported on this machine.");
+    useSplitMatrix32 = storm::storage::SplitSparseMatrix<ValueType, uint32_t>::fitsColumnIndexType(matrix);
+    if (useSplitMatrix32) {
+        splitMatrix32 = storm::storage::SplitSparseMatrix<ValueType, uint32_t>(matrix);
+    } else {
+        STORM_LOG_WARN("The column indices of the matrix do not fit into 32 bits. The SIMD multiplier falls back to scalar kernels.");
+        splitMatrix64 = storm::storage::SplitSparseMatrix<ValueType, uint64_t>(matrix);
+    }
+    STORM_LOG_DEBUG("SIMD multiplier uses " << toString(useSplitMatrix32 ? instructionSet : SimdInstructionSet::Scalar) << " kernels.");
+}
+
+template<typename ValueType>
+SimdInstructionSet SimdMultiplier<ValueType>::detectInstructionSet() {
+    static SimdInstructionSet const detectedInstructionSet = []() {
+        for (auto candidate : {SimdInstructionSet::Avx512, SimdInstructionSet::Avx2, SimdInstructionSet::Neon}) {
+            if (isSupported(candidate)) {
+                return candidate;
+            }
+        }
+        return SimdInstructionSet::Scalar;
+    }();
+    return detectedInstructionSet;
+}
+
+template<typename ValueType>
+bool SimdMultiplier<ValueType>::isSupported(SimdInstructionSet instructionSet) {
+    switch (instructionSet) {
+        case SimdInstructionSet::Scalar:
+            return true;
+#ifdef STORM_SIMD_MULTIPLIER_X86
+        case SimdInstructionSet::Avx2:
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        case SimdInstructionSet::Avx512:
+            return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+#ifdef STORM_SIMD_MULTIPLIER_NEON
+        case SimdInstructionSet::Neon:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+template<typename ValueType>
+SimdInstructionSet SimdMultiplier<ValueType>::getInstructionSet() const {
+    return instructionSet;
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                         std::vector<ValueType>& result) const {
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+        }
+        target = this->cachedVector.get();
+    }
+    if (useSplitMatrix32) {
+        getKernel(instructionSet)(splitMatrix32.getRowIndications().data(), splitMatrix32.getColumns().data(), splitMatrix32.getValues().data(), x.data(),
+                                  b ? b->data() : nullptr, 0, splitMatrix32.getRowCount(), target->data());
+    } else {
+        splitMatrix64.multiplyWithVector(x, *target, b);
+    }
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+    if (backwards) {
+        this->matrix.multiplyWithVectorBackward(x, x, b);
+    } else {
+        this->matrix.multiplyWithVectorForward(x, x, b);
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                  std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                  std::vector<uint_fast64_t>* choices) const {
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+        }
+        target = this->cachedVector.get();
+    }
+    if (!useSplitMatrix32) {
+        splitMatrix64.multiplyAndReduce(dir, rowGroupIndices, x, b, *target, choices);
+    } else if (dir == OptimizationDirection::Minimize) {
+        multAddReduce<storm::utility::ElementLess<ValueType>>(rowGroupIndices, x, b, *target, choices);
+    } else {
+        multAddReduce<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, x, b, *target, choices);
+    }
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+template<typename Compare>
+void SimdMultiplier<ValueType>::multAddReduce(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                              std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    Compare compare;
+    RowValuesKernel kernel = getKernel(instructionSet);
+    uint64_t const groupCount = result.size();
+    uint64_t blockStart = 0;
+    while (blockStart < groupCount) {
+        // Collect as many row groups as fit into the buffer (but at least one).
+        uint64_t blockEnd = blockStart + 1;
+        while (blockEnd < groupCount && rowGroupIndices[blockEnd + 1] - rowGroupIndices[blockStart] <= rowValueBufferSize) {
+            ++blockEnd;
+        }
+        uint64_t const firstRow = rowGroupIndices[blockStart];
+        uint64_t const endRow = rowGroupIndices[blockEnd];
+        rowValueBuffer.resize(std::max<uint64_t>(rowValueBuffer.size(), endRow - firstRow));
+        kernel(splitMatrix32.getRowIndications().data(), splitMatrix32.getColumns().data(), splitMatrix32.getValues().data(), x.data(),
+               b ? b->data() : nullptr, firstRow, endRow, rowValueBuffer.data());
+
+        // Reduce the row values within each group. As for SparseMatrix::multiplyAndReduce, choices are only updated if the new choice is strictly better.
+        for (uint64_t group = blockStart; group < blockEnd; ++group) {
+            uint64_t const groupStart = rowGroupIndices[group];
+            uint64_t const groupEnd = rowGroupIndices[group + 1];
+            if (groupStart == groupEnd) {
+                continue;
+            }
+            ValueType const* groupValues = rowValueBuffer.data() + (groupStart - firstRow);
+            ValueType currentValue = groupValues[0];
+            uint64_t selectedChoice = 0;
+            for (uint64_t choice = 1; choice < groupEnd - groupStart; ++choice) {
+                if (compare(groupValues[choice], currentValue)) {
+                    currentValue = groupValues[choice];
+                    selectedChoice = choice;
+                }
+            }
+            result[group] = currentValue;
+            if (choices) {
+                uint64_t& oldChoice = (*choices)[group];
+                // Note that the previous choice might not exist if choices are uninitialized.
+                if (oldChoice >= groupEnd - groupStart || compare(currentValue, groupValues[oldChoice])) {
+                    oldChoice = selectedChoice;
+                }
+            }
+        }
+        blockStart = blockEnd;
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir,
+                                                             std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                             std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+    if (backwards) {
+        this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+    } else {
+        this->matrix.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+    for (auto const& entry : this->matrix.getRow(rowIndex)) {
+        value += entry.getValue() * x[entry.getColumn()];
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
+                                             ValueType& val2) const {
+    for (auto const& entry : this->matrix.getRow(rowIndex)) {
+        val1 += entry.getValue() * x1[entry.getColumn()];
+        val2 += entry.getValue() * x2[entry.getColumn()];
+    }
+}
+
+template class SimdMultiplier<double>;
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <string>
+
+#include "storm/solver/multiplier/Multiplier.h"
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SplitSparseMatrix.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
+namespace solver {
+
+/*!
+ * The instruction sets for which the SIMD multiplier provides kernels.
+ */
+enum class SimdInstructionSet { Scalar, Avx2, Avx512, Neon };
+
+std::string toString(SimdInstructionSet instructionSet);
+
+/*!
+ * A multiplier for double matrices whose row dot products are computed with vector instructions (gathering the entries of the input vector
+ * that are referenced by the columns of a row). The kernel is selected at runtime according to the instruction sets supported by the CPU.
+ * The matrix is copied into a split representation with 32-bit column indices. If the column indices do not fit, the scalar kernels of the
+ * split representation are used instead.
+ *
+ * As the vectorized kernels sum up the products of a row in a different order, results may differ from the ones of the native multiplier
+ * within floating point precision. Gauss-Seidel style multiplications are delegated to the original matrix.
+ */
+template<typename ValueType>
+class SimdMultiplier : public Multiplier<ValueType> {
+   public:
+    /*!
+     * Creates a multiplier for the given matrix that uses the best instruction set supported by this CPU.
+     */
+    SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Creates a multiplier for the given matrix that uses the given instruction set. It must be supported by this CPU.
+     */
+    SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix, SimdInstructionSet instructionSet);
+
+    virtual ~SimdMultiplier() = default;
+
+    virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                          std::vector<ValueType>& result) const override;
+    virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+    virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                   std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                   std::vector<uint_fast64_t>* choices = nullptr) const override;
+    virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                              std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr,
+                                              bool backwards = true) const override;
+    virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
+    virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
+                              ValueType& val2) const override;
+
+    /*!
+     * Retrieves the most powerful instruction set that is supported by this CPU (and for which kernels were compiled).
+     */
+    static SimdInstructionSet detectInstructionSet();
+
+    /*!
+     * Checks whether the given instruction set can be used on this CPU.
+     */
+    static bool isSupported(SimdInstructionSet instructionSet);
+
+    /*!
+     * Retrieves the instruction set used by this multiplier.
+     */
+    SimdInstructionSet getInstructionSet() const;
+
+   private:
+    template<typename Compare>
+    void multAddReduce(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                       std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+
+    // The instruction set of the kernels.
+    SimdInstructionSet instructionSet;
+
+    // The copy of the matrix that is used by the kernels. If the columns do not fit into 32 bits, the second one is used (without SIMD kernels).
+    storm::storage::SplitSparseMatrix<ValueType, uint32_t> splitMatrix32;
+    storm::storage::SplitSparseMatrix<ValueType, uint64_t> splitMatrix64;
+    bool useSplitMatrix32;
+
+    // A buffer that holds the values of the rows of a block of row groups during multiplyAndReduce.
+    mutable std::vector<ValueType> rowValueBuffer;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,108 @@
+#include "storm/solver/multiplier/cuda/CudaKernels.h"
+
+namespace storm {
+namespace solver {
+namespace cuda {
+
+namespace {
+
+// The number of threads per block of all kernels.
+unsigned const threadsPerBlock = 256;
+
+unsigned numberOfBlocks(uint64_t numberOfThreads) {
+    return static_cast<unsigned>((numberOfThreads + threadsPerBlock - 1) / threadsPerBlock);
+}
+
+// Values of smaller magnitude are considered zero by the relative convergence criterion (as by storm::utility::isAlmostZero).
+__device__ double const almostZero = 1e-12;
+
+__global__ void multiplyKernel(uint64_t rowCount, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x,
+                               double const* b, double* result) {
+    uint64_t const row = static_cast<uint64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (row >= rowCount) {
+        return;
+    }
+    double rowValue = b ? b[row] : 0.0;
+    for (uint64_t entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+        rowValue += values[entry] * __ldg(x + columns[entry]);
+    }
+    result[row] = rowValue;
+}
+
+__global__ void reduceKernel(uint64_t rowGroupCount, uint64_t const* rowGroupIndices, double const* rowValues, bool minimize, double* result,
+                             uint64_t* choices) {
+    uint64_t const group = static_cast<uint64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (group >= rowGroupCount) {
+        return;
+    }
+    uint64_t const groupStart = rowGroupIndices[group];
+    uint64_t const groupSize = rowGroupIndices[group + 1] - groupStart;
+    if (groupSize == 0) {
+        return;
+    }
+    double const* groupValues = rowValues + groupStart;
+    double currentValue = groupValues[0];
+    uint64_t selectedChoice = 0;
+    for (uint64_t choice = 1; choice < groupSize; ++choice) {
+        if (minimize ? groupValues[choice] < currentValue : groupValues[choice] > currentValue) {
+            currentValue = groupValues[choice];
+            selectedChoice = choice;
+        }
+    }
+    result[group] = currentValue;
+    if (choices) {
+        uint64_t const oldChoice = choices[group];
+        // Note that the previous choice might not exist if choices are uninitialized.
+        if (oldChoice >= groupSize || (minimize ? currentValue < groupValues[oldChoice] : currentValue > groupValues[oldChoice])) {
+            choices[group] = selectedChoice;
+        }
+    }
+}
+
+__global__ void checkConvergenceKernel(uint64_t size, double const* oldValues, double const* newValues, double precision, bool relative, int* notConverged) {
+    uint64_t const index = static_cast<uint64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (index >= size) {
+        return;
+    }
+    double const oldValue = oldValues[index];
+    double const newValue = newValues[index];
+    bool converged;
+    if (relative) {
+        if (fabs(oldValue) < almostZero) {
+            converged = fabs(newValue) < almostZero;
+        } else {
+            converged = fabs((newValue - oldValue) / newValue) <= precision;
+        }
+    } else {
+        converged = fabs(newValue - oldValue) <= precision;
+    }
+    if (!converged) {
+        // All threads that write to the flag write the same value, so no atomic operation is required.
+        *notConverged = 1;
+    }
+}
+
+}  // namespace
+
+void launchMultiply(uint64_t rowCount, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* b,
+                    double* result) {
+    if (rowCount > 0) {
+        multiplyKernel<<<numberOfBlocks(rowCount), threadsPerBlock>>>(rowCount, rowIndications, columns, values, x, b, result);
+    }
+}
+
+void launchReduce(uint64_t rowGroupCount, uint64_t const* rowGroupIndices, double const* rowValues, bool minimize, double* result, uint64_t* choices) {
+    if (rowGroupCount > 0) {
+        reduceKernel<<<numberOfBlocks(rowGroupCount), threadsPerBlock>>>(rowGroupCount, rowGroupIndices, rowValues, minimize, result, choices);
+    }
+}
+
+void launchCheckConvergence(uint64_t size, double const* oldValues, double const* newValues, double precision, bool relative, int* notConverged) {
+    if (size > 0) {
+        checkConvergenceKernel<<<numberOfBlocks(size), threadsPerBlock>>>(size, oldValues, newValues, precision, relative, notConverged);
+    }
+}
+
+}  // namespace cuda
+}  // namespace solver
+}  // namespace storm
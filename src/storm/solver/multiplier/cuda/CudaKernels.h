@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+namespace solver {
+namespace cuda {
+
+/*
+ * The kernels of the CUDA multiplier. They are compiled by the CUDA compiler, so this header must not depend on any other part of storm. All pointers
+ * refer to device memory and all kernels are launched on the default stream, i.e., they are executed in the order in which they are launched.
+ */
+
+/*!
+ * Computes result = A*x (+ b) for the matrix A that is given in CSR format. The summand b may be null.
+ */
+void launchMultiply(uint64_t rowCount, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* b,
+                    double* result);
+
+/*!
+ * Computes the minimum (maximum) of the given row values within each row group. If choices are given, the choice of a group is only changed
+ * if the new choice is strictly better than the previous one (as done by SparseMatrix::multiplyAndReduce).
+ */
+void launchReduce(uint64_t rowGroupCount, uint64_t const* rowGroupIndices, double const* rowValues, bool minimize, double* result, uint64_t* choices);
+
+/*!
+ * Sets the given flag to a non-zero value if any entry of the new values differs from the corresponding old value by more than the given
+ * precision (with the same criterion as storm::utility::vector::equalModuloPrecision). The flag is never reset.
+ */
+void launchCheckConvergence(uint64_t size, double const* oldValues, double const* newValues, double precision, bool relative, int* notConverged);
+
+}  // namespace cuda
+}  // namespace solver
+}  // namespace storm
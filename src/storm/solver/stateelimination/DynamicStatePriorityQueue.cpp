@@ -1,6 +1,7 @@
 #include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/SmallRationalNumber.h"
 
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -76,6 +77,7 @@ template class DynamicStatePriorityQueue<double>;
 #ifdef STORM_HAVE_CARL
 template class DynamicStatePriorityQueue<storm::RationalNumber>;
 template class DynamicStatePriorityQueue<storm::RationalFunction>;
+template class DynamicStatePriorityQueue<storm::SmallRationalNumber>;
 #endif
 }  // namespace stateelimination
 }  // namespace solver
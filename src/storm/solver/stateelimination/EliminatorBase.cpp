@@ -1,5 +1,6 @@
 #include "storm/solver/stateelimination/EliminatorBase.h"
 
+#include "storm/adapters/SmallRationalNumber.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/stateelimination.h"
@@ -78,10 +79,17 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
     FlexibleRowType rowsKeepingEntryInColumnEqualRow;
 
     // For each entry in the row d, we need to build a list of other rows that will contain an element in the
-    // column d.
-    std::vector<FlexibleRowType> newBackwardEntries(entriesInRow.size());
-    for (auto& backwardEntry : newBackwardEntries) {
-        backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
+    // column d. These lists and the buffer used for merging rows are kept per thread and reused across eliminations,
+    // so that their storage only needs to be allocated when they grow. Merged rows are swapped with the buffer, which
+    // thereby takes over the storage of the replaced row for the next merge.
+    static thread_local std::vector<FlexibleRowType> newBackwardEntries;
+    static thread_local FlexibleRowType mergeBuffer;
+    if (newBackwardEntries.size() < entriesInRow.size()) {
+        newBackwardEntries.resize(entriesInRow.size());
+    }
+    for (uint64_t index = 0; index < entriesInRow.size(); ++index) {
+        newBackwardEntries[index].clear();
+        newBackwardEntries[index].reserve(elementsWithEntryInColumnEqualRow.size());
     }
 
     // Now go through the rows with an entry in the column corresponding to the current row and substitute
@@ -122,7 +130,8 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = entriesInRow.begin();
         FlexibleRowIterator last2 = entriesInRow.end();
 
-        FlexibleRowType newSuccessors;
+        FlexibleRowType& newSuccessors = mergeBuffer;
+        newSuccessors.clear();
         newSuccessors.reserve((last1 - first1) + (last2 - first2));
         std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
 
@@ -174,7 +183,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         }
 
         // Now move the new transitions in place.
-        predecessorForwardTransitions = std::move(newSuccessors);
+        std::swap(predecessorForwardTransitions, newSuccessors);
         STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
 
         updatePredecessor(predecessor, multiplyFactor, row);
@@ -207,7 +216,8 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
         FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
 
-        FlexibleRowType newPredecessors;
+        FlexibleRowType& newPredecessors = mergeBuffer;
+        newPredecessors.clear();
         newPredecessors.reserve((last1 - first1) + (last2 - first2));
         std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
 
@@ -240,7 +250,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
             std::copy_if(first2, last2, result, [&](MatrixEntry const& a) { return a.getColumn() != row; });
         }
         // Now move the new predecessors in place.
-        successorBackwardTransitions = std::move(newPredecessors);
+        std::swap(successorBackwardTransitions, newPredecessors);
         ++successorOffsetInNewBackwardTransitions;
     }
     STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
@@ -337,6 +347,7 @@ template class EliminatorBase<storm::RationalFunction, ScalingMode::Divide>;
 
 template class EliminatorBase<storm::RationalNumber, ScalingMode::DivideOneMinus>;
 template class EliminatorBase<storm::RationalFunction, ScalingMode::DivideOneMinus>;
+template class EliminatorBase<storm::SmallRationalNumber, ScalingMode::DivideOneMinus>;
 #endif
 }  // namespace stateelimination
 }  // namespace solver
@@ -1,9 +1,14 @@
 #include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/SmallRationalNumber.h"
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
+#include "storm/storage/BitVector.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "StaticStatePriorityQueue.h"
 
@@ -22,7 +27,7 @@ template<typename ValueType>
 PrioritizedStateEliminator<ValueType>::PrioritizedStateEliminator(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
                                                                   storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions,
                                                                   PriorityQueuePointer priorityQueue, std::vector<ValueType>& stateValues)
-    : StateEliminator<ValueType>(transitionMatrix, backwardTransitions), priorityQueue(priorityQueue), stateValues(stateValues) {}
+    : StateEliminator<ValueType>(transitionMatrix, backwardTransitions), priorityQueue(priorityQueue), stateValues(stateValues), deferPriorityUpdates(false) {}
 
 template<typename ValueType>
 void PrioritizedStateEliminator<ValueType>::updateValue(storm::storage::sparse::state_type const& state, ValueType const& loopProbability) {
@@ -38,7 +43,12 @@ void PrioritizedStateEliminator<ValueType>::updatePredecessor(storm::storage::sp
 
 template<typename ValueType>
 void PrioritizedStateEliminator<ValueType>::updatePriority(storm::storage::sparse::state_type const& state) {
-    priorityQueue->update(state);
+    if (deferPriorityUpdates) {
+        std::lock_guard<std::mutex> lock(deferredPriorityUpdatesMutex);
+        deferredPriorityUpdates.push_back(state);
+    } else {
+        priorityQueue->update(state);
+    }
 }
 
 template<typename ValueType>
@@ -52,6 +62,94 @@ void PrioritizedStateEliminator<ValueType>::eliminateAll(bool removeForwardTrans
     }
 }
 
+template<typename ValueType>
+void PrioritizedStateEliminator<ValueType>::eliminateAllInParallel(uint64_t numberOfThreads,
+                                                                   std::function<bool(storm::storage::sparse::state_type)> const& removeForwardTransitions) {
+    if (numberOfThreads <= 1 || !this->matrix.hasTrivialRowGrouping()) {
+        while (priorityQueue->hasNext()) {
+            storm::storage::sparse::state_type state = priorityQueue->pop();
+            bool removeForward = removeForwardTransitions(state);
+            this->eliminateState(state, removeForward);
+            if (removeForward) {
+                clearStateValues(state);
+            }
+        }
+        return;
+    }
+
+    // Bounds the number of states per round (and the number of states that are taken from the queue while searching them) so that the priorities
+    // still guide the elimination order.
+    uint64_t const maximalRoundSize = 16 * numberOfThreads;
+    storm::storage::BitVector neighbourhoods(this->matrix.getRowCount());
+    std::vector<storm::storage::sparse::state_type> round, postponedStates, touchedStates;
+    uint64_t numberOfRounds = 0;
+    while (priorityQueue->hasNext() || !postponedStates.empty()) {
+        // States that were postponed in the previous round have a higher priority than the ones remaining in the queue.
+        std::vector<storm::storage::sparse::state_type> candidates = std::move(postponedStates);
+        postponedStates.clear();
+        while (candidates.size() < 2 * maximalRoundSize && priorityQueue->hasNext()) {
+            candidates.push_back(priorityQueue->pop());
+        }
+
+        round.clear();
+        for (auto state : candidates) {
+            bool disjoint = round.size() < maximalRoundSize && !neighbourhoods.get(state);
+            if (disjoint) {
+                for (auto const& entry : this->matrix.getRow(state)) {
+                    disjoint &= !neighbourhoods.get(entry.getColumn());
+                }
+                for (auto const& entry : this->transposedMatrix.getRow(state)) {
+                    disjoint &= !neighbourhoods.get(entry.getColumn());
+                }
+            }
+            if (!disjoint) {
+                postponedStates.push_back(state);
+                continue;
+            }
+            round.push_back(state);
+            auto markState = [&](storm::storage::sparse::state_type neighbour) {
+                if (!neighbourhoods.get(neighbour)) {
+                    neighbourhoods.set(neighbour);
+                    touchedStates.push_back(neighbour);
+                }
+            };
+            markState(state);
+            for (auto const& entry : this->matrix.getRow(state)) {
+                markState(entry.getColumn());
+            }
+            for (auto const& entry : this->transposedMatrix.getRow(state)) {
+                markState(entry.getColumn());
+            }
+        }
+        for (auto state : touchedStates) {
+            neighbourhoods.set(state, false);
+        }
+        touchedStates.clear();
+
+        deferPriorityUpdates = true;
+        storm::utility::parallel::forEachBlock(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(round.size()), 1,
+                                               [&](uint64_t, uint64_t begin, uint64_t end) {
+                                                   for (uint64_t index = begin; index < end; ++index) {
+                                                       bool removeForward = removeForwardTransitions(round[index]);
+                                                       this->eliminateState(round[index], removeForward);
+                                                       if (removeForward) {
+                                                           clearStateValues(round[index]);
+                                                       }
+                                                   }
+                                               });
+        deferPriorityUpdates = false;
+
+        std::sort(deferredPriorityUpdates.begin(), deferredPriorityUpdates.end());
+        deferredPriorityUpdates.erase(std::unique(deferredPriorityUpdates.begin(), deferredPriorityUpdates.end()), deferredPriorityUpdates.end());
+        for (auto state : deferredPriorityUpdates) {
+            priorityQueue->update(state);
+        }
+        deferredPriorityUpdates.clear();
+        ++numberOfRounds;
+    }
+    STORM_LOG_INFO("Eliminated states concurrently in " << numberOfRounds << " rounds using " << numberOfThreads << " threads.");
+}
+
 template<typename ValueType>
 void PrioritizedStateEliminator<ValueType>::clearStateValues(storm::storage::sparse::state_type const& state) {
     stateValues[state] = storm::utility::zero<ValueType>();
@@ -62,6 +160,7 @@ template class PrioritizedStateEliminator<double>;
 #ifdef STORM_HAVE_CARL
 template class PrioritizedStateEliminator<storm::RationalNumber>;
 template class PrioritizedStateEliminator<storm::RationalFunction>;
+template class PrioritizedStateEliminator<storm::SmallRationalNumber>;
 #endif
 }  // namespace stateelimination
 }  // namespace solver
@@ -1,6 +1,9 @@
 #ifndef STORM_SOLVER_STATEELIMINATION_PRIORITIZEDSTATEELIMINATOR_H_
 #define STORM_SOLVER_STATEELIMINATION_PRIORITIZEDSTATEELIMINATOR_H_
 
+#include <functional>
+#include <mutex>
+
 #include "storm/solver/stateelimination/StateEliminator.h"
 
 namespace storm {
@@ -30,9 +33,26 @@ class PrioritizedStateEliminator : public StateEliminator<ValueType> {
     virtual void eliminateAll(bool eliminateForwardTransitions = true);
     virtual void clearStateValues(storm::storage::sparse::state_type const& state);
 
+    /*!
+     * Eliminates all states of the priority queue using (at most) the given number of threads. In every round, states are taken from the queue (in the
+     * order of their priority) as long as their neighbourhoods (i.e., the states together with their predecessors and successors) are pairwise
+     * disjoint. As the elimination of a state only modifies the rows and values of its neighbourhood, these states are then eliminated concurrently.
+     * Updates of priorities are deferred to the end of each round. States of a row-grouped matrix are eliminated sequentially.
+     *
+     * @param numberOfThreads The maximal number of threads.
+     * @param removeForwardTransitions Decides for each state whether its forward transitions are removed (and its value cleared) after it has been
+     * eliminated.
+     */
+    void eliminateAllInParallel(uint64_t numberOfThreads, std::function<bool(storm::storage::sparse::state_type)> const& removeForwardTransitions);
+
    protected:
     PriorityQueuePointer priorityQueue;
     std::vector<ValueType>& stateValues;
+
+    // While eliminating states concurrently, the states whose priority needs to be updated are collected here (guarded by the mutex).
+    bool deferPriorityUpdates;
+    std::vector<storm::storage::sparse::state_type> deferredPriorityUpdates;
+    std::mutex deferredPriorityUpdatesMutex;
 };
 
 }  // namespace stateelimination
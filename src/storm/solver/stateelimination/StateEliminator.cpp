@@ -1,6 +1,7 @@
 #include "storm/solver/stateelimination/StateEliminator.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/SmallRationalNumber.h"
 
 #include "storm/storage/BitVector.h"
 
@@ -40,6 +41,7 @@ template class StateEliminator<double>;
 #ifdef STORM_HAVE_CARL
 template class StateEliminator<storm::RationalNumber>;
 template class StateEliminator<storm::RationalFunction>;
+template class StateEliminator<storm::SmallRationalNumber>;
 #endif
 }  // namespace stateelimination
 }  // namespace solver
@@ -13,9 +13,177 @@
 #define ASSERT_BITVECTOR
 #endif
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_BITVECTOR_X86
+#include <immintrin.h>
+#endif
+
 namespace storm {
 namespace storage {
 
+namespace {
+
+// Bit vectors with fewer buckets are processed by the scalar code, because the dispatch does not pay off for them.
+uint64_t const minimalBucketCountForAvx2 = 16;
+
+bool useAvx2(uint64_t bucketCount) {
+#ifdef STORM_BITVECTOR_X86
+    static bool const hasAvx2 = __builtin_cpu_supports("avx2");
+    return hasAvx2 && bucketCount >= minimalBucketCountForAvx2;
+#else
+    return false;
+#endif
+}
+
+uint64_t popcount(uint64_t bucket) {
+#if (defined(__GNUG__) || defined(__clang__))
+    return __builtin_popcountll(bucket);
+#else
+    uint64_t result = 0;
+    for (; bucket; ++result) {
+        bucket &= bucket - 1;
+    }
+    return result;
+#endif
+}
+
+enum class BucketOperation { And, Or, AndNot, Not };
+
+template<BucketOperation Operation>
+uint64_t applyToBucket(uint64_t first, uint64_t second) {
+    if constexpr (Operation == BucketOperation::And) {
+        return first & second;
+    } else if constexpr (Operation == BucketOperation::Or) {
+        return first | second;
+    } else if constexpr (Operation == BucketOperation::AndNot) {
+        return first & ~second;
+    } else {
+        return ~first;
+    }
+}
+
+/*!
+ * Writes first[i] op second[i] to result[i] for all buckets. The result may be the same as the first operand.
+ * For the (unary) Not operation, the second operand is ignored.
+ */
+template<BucketOperation Operation>
+void applyToBucketsScalar(uint64_t* result, uint64_t const* first, uint64_t const* second, uint64_t count) {
+    for (uint64_t i = 0; i < count; ++i) {
+        result[i] = applyToBucket<Operation>(first[i], Operation == BucketOperation::Not ? 0 : second[i]);
+    }
+}
+
+uint64_t countSetBitsScalar(uint64_t const* buckets, uint64_t count) {
+    uint64_t result = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+        result += popcount(buckets[i]);
+    }
+    return result;
+}
+
+#ifdef STORM_BITVECTOR_X86
+template<BucketOperation Operation>
+__attribute__((target("avx2"))) void applyToBucketsAvx2(uint64_t* result, uint64_t const* first, uint64_t const* second, uint64_t count) {
+    uint64_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i firstBuckets = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first + i));
+        __m256i resultBuckets;
+        if constexpr (Operation == BucketOperation::Not) {
+            resultBuckets = _mm256_xor_si256(firstBuckets, _mm256_set1_epi64x(-1));
+        } else {
+            __m256i secondBuckets = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(second + i));
+            if constexpr (Operation == BucketOperation::And) {
+                resultBuckets = _mm256_and_si256(firstBuckets, secondBuckets);
+            } else if constexpr (Operation == BucketOperation::Or) {
+                resultBuckets = _mm256_or_si256(firstBuckets, secondBuckets);
+            } else {
+                resultBuckets = _mm256_andnot_si256(secondBuckets, firstBuckets);
+            }
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + i), resultBuckets);
+    }
+    applyToBucketsScalar<Operation>(result + i, first + i, second ? second + i : nullptr, count - i);
+}
+
+/*!
+ * Counts the set bits of four buckets at once by looking up the number of set bits of each half-byte (see Mula et al., "Faster Population Counts
+ * Using AVX2 Instructions", 2018).
+ */
+__attribute__((target("avx2"))) uint64_t countSetBitsAvx2(uint64_t const* buckets, uint64_t count) {
+    __m256i const lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    __m256i const lowHalfBytes = _mm256_set1_epi8(0x0f);
+    __m256i sums = _mm256_setzero_si256();
+    uint64_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i bits = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(buckets + i));
+        __m256i low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(bits, lowHalfBytes));
+        __m256i high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(bits, 4), lowHalfBytes));
+        sums = _mm256_add_epi64(sums, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+    }
+    uint64_t result = static_cast<uint64_t>(_mm256_extract_epi64(sums, 0)) + static_cast<uint64_t>(_mm256_extract_epi64(sums, 1)) +
+                      static_cast<uint64_t>(_mm256_extract_epi64(sums, 2)) + static_cast<uint64_t>(_mm256_extract_epi64(sums, 3));
+    return result + countSetBitsScalar(buckets + i, count - i);
+}
+
+/*!
+ * Checks whether first[i] & ~second[i] is zero (if Subset is set) or whether first[i] & second[i] is zero (otherwise) for all buckets.
+ */
+template<bool Subset>
+__attribute__((target("avx2"))) bool testBucketsAvx2(uint64_t const* first, uint64_t const* second, uint64_t count) {
+    uint64_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i firstBuckets = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first + i));
+        __m256i secondBuckets = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(second + i));
+        if (!(Subset ? _mm256_testc_si256(secondBuckets, firstBuckets) : _mm256_testz_si256(firstBuckets, secondBuckets))) {
+            return false;
+        }
+    }
+    for (; i < count; ++i) {
+        if ((Subset ? (first[i] & ~second[i]) : (first[i] & second[i])) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+template<BucketOperation Operation>
+void applyToBuckets(uint64_t* result, uint64_t const* first, uint64_t const* second, uint64_t count) {
+#ifdef STORM_BITVECTOR_X86
+    if (useAvx2(count)) {
+        applyToBucketsAvx2<Operation>(result, first, second, count);
+        return;
+    }
+#endif
+    applyToBucketsScalar<Operation>(result, first, second, count);
+}
+
+uint64_t countSetBits(uint64_t const* buckets, uint64_t count) {
+#ifdef STORM_BITVECTOR_X86
+    if (useAvx2(count)) {
+        return countSetBitsAvx2(buckets, count);
+    }
+#endif
+    return countSetBitsScalar(buckets, count);
+}
+
+template<bool Subset>
+bool testBuckets(uint64_t const* first, uint64_t const* second, uint64_t count) {
+#ifdef STORM_BITVECTOR_X86
+    if (useAvx2(count)) {
+        return testBucketsAvx2<Subset>(first, second, count);
+    }
+#endif
+    for (uint64_t i = 0; i < count; ++i) {
+        if ((Subset ? (first[i] & ~second[i]) : (first[i] & second[i])) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
 BitVector::const_iterator::const_iterator(uint64_t const* dataPtr, uint_fast64_t startIndex, uint_fast64_t endIndex, bool setOnFirstBit)
     : dataPtr(dataPtr), endIndex(endIndex) {
     if (setOnFirstBit) {
@@ -113,11 +281,11 @@ bool BitVector::const_reverse_iterator::operator==(const_reverse_iterator const&
     return currentIndex == other.currentIndex;
 }
 
-BitVector::BitVector() : bitCount(0), buckets(nullptr) {
+BitVector::BitVector() : bitCount(0), buckets(inlineBuckets) {
     // Intentionally left empty.
 }
 
-BitVector::BitVector(uint_fast64_t length, bool init) : bitCount(length), buckets(nullptr) {
+BitVector::BitVector(uint_fast64_t length, bool init) : bitCount(length), buckets(inlineBuckets) {
     // Compute the correct number of buckets needed to store the given number of bits.
     uint_fast64_t bucketCount = length >> 6;
     if ((length & mod64mask) != 0) {
@@ -125,17 +293,35 @@ BitVector::BitVector(uint_fast64_t length, bool init) : bitCount(length), bucket
     }
 
     // Initialize the storage with the required values.
+    allocateBuckets(bucketCount);
     if (init) {
-        buckets = new uint64_t[bucketCount];
         std::fill_n(buckets, bucketCount, -1ull);
         truncateLastBucket();
     } else {
-        buckets = new uint64_t[bucketCount]();
+        std::fill_n(buckets, bucketCount, 0ull);
     }
 }
 
 BitVector::~BitVector() {
-    delete[] buckets;
+    releaseBuckets();
+}
+
+void BitVector::allocateBuckets(uint_fast64_t bucketCount) {
+    STORM_LOG_ASSERT(hasInlineBuckets(), "Expected the storage to be released.");
+    if (bucketCount > InlineBucketCount) {
+        buckets = new uint64_t[bucketCount];
+    }
+}
+
+void BitVector::releaseBuckets() {
+    if (!hasInlineBuckets()) {
+        delete[] buckets;
+        buckets = inlineBuckets;
+    }
+}
+
+bool BitVector::hasInlineBuckets() const {
+    return buckets == inlineBuckets;
 }
 
 template<typename InputIterator>
@@ -147,27 +333,25 @@ BitVector::BitVector(uint_fast64_t length, std::vector<uint_fast64_t> setEntries
     // Intentionally left empty.
 }
 
-BitVector::BitVector(uint_fast64_t bucketCount, uint_fast64_t bitCount) : bitCount(bitCount), buckets(nullptr) {
+BitVector::BitVector(uint_fast64_t bucketCount, uint_fast64_t bitCount) : bitCount(bitCount), buckets(inlineBuckets) {
     STORM_LOG_ASSERT((bucketCount << 6) == bitCount, "Bit count does not match number of buckets.");
-    buckets = new uint64_t[bucketCount]();
+    allocateBuckets(bucketCount);
+    std::fill_n(buckets, bucketCount, 0ull);
 }
 
-BitVector::BitVector(BitVector const& other) : bitCount(other.bitCount), buckets(nullptr) {
-    buckets = new uint64_t[other.bucketCount()];
+BitVector::BitVector(BitVector const& other) : bitCount(other.bitCount), buckets(inlineBuckets) {
+    allocateBuckets(other.bucketCount());
     std::copy_n(other.buckets, other.bucketCount(), buckets);
 }
 
 BitVector& BitVector::operator=(BitVector const& other) {
     // Only perform the assignment if the source and target are not identical.
     if (this != &other) {
-        if (buckets && bucketCount() != other.bucketCount()) {
-            delete[] buckets;
-            buckets = nullptr;
+        if (bucketCount() != other.bucketCount()) {
+            releaseBuckets();
+            allocateBuckets(other.bucketCount());
         }
         bitCount = other.bitCount;
-        if (!buckets) {
-            buckets = new uint64_t[other.bucketCount()];
-        }
         std::copy_n(other.buckets, other.bucketCount(), buckets);
     }
     return *this;
@@ -194,19 +378,28 @@ bool BitVector::operator<(BitVector const& other) const {
     return false;
 }
 
-BitVector::BitVector(BitVector&& other) : bitCount(other.bitCount), buckets(other.buckets) {
+BitVector::BitVector(BitVector&& other) : bitCount(other.bitCount), buckets(inlineBuckets) {
+    if (other.hasInlineBuckets()) {
+        std::copy_n(other.inlineBuckets, InlineBucketCount, inlineBuckets);
+    } else {
+        buckets = other.buckets;
+        other.buckets = other.inlineBuckets;
+    }
     other.bitCount = 0;
-    other.buckets = nullptr;
 }
 
 BitVector& BitVector::operator=(BitVector&& other) {
     // Only perform the assignment if the source and target are not identical.
     if (this != &other) {
+        releaseBuckets();
         bitCount = other.bitCount;
         other.bitCount = 0;
-        delete[] this->buckets;
-        this->buckets = other.buckets;
-        other.buckets = nullptr;
+        if (other.hasInlineBuckets()) {
+            std::copy_n(other.inlineBuckets, InlineBucketCount, inlineBuckets);
+        } else {
+            buckets = other.buckets;
+            other.buckets = other.inlineBuckets;
+        }
     }
 
     return *this;
@@ -263,18 +456,21 @@ void BitVector::resize(uint_fast64_t newLength, bool init) {
         }
 
         if (newBucketCount > this->bucketCount()) {
-            uint64_t* newBuckets = new uint64_t[newBucketCount];
-            std::copy_n(buckets, this->bucketCount(), newBuckets);
+            uint64_t oldBucketCount = this->bucketCount();
+            if (newBucketCount > InlineBucketCount) {
+                uint64_t* newBuckets = new uint64_t[newBucketCount];
+                std::copy_n(buckets, oldBucketCount, newBuckets);
+                releaseBuckets();
+                buckets = newBuckets;
+            }
             if (init) {
-                if (this->bucketCount() > 0) {
-                    newBuckets[this->bucketCount() - 1] |= ((1ull << (64 - (bitCount & mod64mask))) - 1ull);
+                if (oldBucketCount > 0) {
+                    buckets[oldBucketCount - 1] |= ((1ull << (64 - (bitCount & mod64mask))) - 1ull);
                 }
-                std::fill_n(newBuckets + this->bucketCount(), newBucketCount - this->bucketCount(), -1ull);
+                std::fill_n(buckets + oldBucketCount, newBucketCount - oldBucketCount, -1ull);
             } else {
-                std::fill_n(newBuckets + this->bucketCount(), newBucketCount - this->bucketCount(), 0);
+                std::fill_n(buckets + oldBucketCount, newBucketCount - oldBucketCount, 0);
             }
-            delete[] buckets;
-            buckets = newBuckets;
             bitCount = newLength;
         } else {
             // If the underlying storage does not need to grow, we have to insert the missing bits.
@@ -292,12 +488,12 @@ void BitVector::resize(uint_fast64_t newLength, bool init) {
 
         // If the number of buckets needs to be reduced, we resize it now. Otherwise, we can just truncate the
         // last bucket.
-        if (newBucketCount < this->bucketCount()) {
-            uint64_t* newBuckets = new uint64_t[newBucketCount];
-            std::copy_n(buckets, newBucketCount, newBuckets);
-            delete[] buckets;
-            buckets = newBuckets;
-            bitCount = newLength;
+        if (newBucketCount < this->bucketCount() && !hasInlineBuckets()) {
+            uint64_t* oldBuckets = buckets;
+            buckets = inlineBuckets;
+            allocateBuckets(newBucketCount);
+            std::copy_n(oldBuckets, newBucketCount, buckets);
+            delete[] oldBuckets;
         }
         bitCount = newLength;
         truncateLastBucket();
@@ -336,30 +532,32 @@ void BitVector::grow(uint_fast64_t minimumLength, bool init) {
 BitVector BitVector::operator&(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a & b; });
+    applyToBuckets<BucketOperation::And>(result.buckets, this->buckets, other.buckets, this->bucketCount());
     return result;
 }
 
 BitVector& BitVector::operator&=(BitVector const& other) {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, this->buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a & b; });
+    applyToBuckets<BucketOperation::And>(this->buckets, this->buckets, other.buckets, this->bucketCount());
     return *this;
 }
 
 BitVector BitVector::operator|(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a | b; });
+    applyToBuckets<BucketOperation::Or>(result.buckets, this->buckets, other.buckets, this->bucketCount());
     return result;
 }
 
 BitVector& BitVector::operator|=(BitVector const& other) {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, this->buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a | b; });
+    applyToBuckets<BucketOperation::Or>(this->buckets, this->buckets, other.buckets, this->bucketCount());
+    return *this;
+}
+
+BitVector& BitVector::andNot(BitVector const& other) {
+    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    applyToBuckets<BucketOperation::AndNot>(this->buckets, this->buckets, other.buckets, this->bucketCount());
     return *this;
 }
 
@@ -388,11 +586,11 @@ BitVector BitVector::operator%(BitVector const& filter) const {
             ++position;
         }
     } else {
-        // If the given bit vector had much fewer elements, we iterate over its elements and accept calling the
-        // more costly operation getNumberOfSetBitsBeforeIndex on the current bit vector.
+        // If the given bit vector had much fewer elements, we iterate over its elements and look up the position of each element in the filter.
+        BitVectorRankIndex filterRanks(filter);
         for (auto bit : (*this)) {
             if (filter[bit]) {
-                result.set(filter.getNumberOfSetBitsBeforeIndex(bit));
+                result.set(filterRanks.getNumberOfSetBitsBeforeIndex(bit));
             }
         }
     }
@@ -402,13 +600,13 @@ BitVector BitVector::operator%(BitVector const& filter) const {
 
 BitVector BitVector::operator~() const {
     BitVector result(this->bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), result.buckets, [](uint64_t const& a) { return ~a; });
+    applyToBuckets<BucketOperation::Not>(result.buckets, this->buckets, nullptr, this->bucketCount());
     result.truncateLastBucket();
     return result;
 }
 
 void BitVector::complement() {
-    std::transform(this->buckets, this->buckets + this->bucketCount(), this->buckets, [](uint64_t const& a) { return ~a; });
+    applyToBuckets<BucketOperation::Not>(this->buckets, this->buckets, nullptr, this->bucketCount());
     truncateLastBucket();
 }
 
@@ -450,32 +648,12 @@ BitVector BitVector::implies(BitVector const& other) const {
 
 bool BitVector::isSubsetOf(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
-
-    uint64_t const* it1 = buckets;
-    uint64_t const* ite1 = buckets + bucketCount();
-    uint64_t const* it2 = other.buckets;
-
-    for (; it1 != ite1; ++it1, ++it2) {
-        if ((*it1 & *it2) != *it1) {
-            return false;
-        }
-    }
-    return true;
+    return testBuckets<true>(buckets, other.buckets, bucketCount());
 }
 
 bool BitVector::isDisjointFrom(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
-
-    uint64_t const* it1 = buckets;
-    uint64_t const* ite1 = buckets + bucketCount();
-    uint64_t const* it2 = other.buckets;
-
-    for (; it1 != ite1; ++it1, ++it2) {
-        if ((*it1 & *it2) != 0) {
-            return false;
-        }
-    }
-    return true;
+    return testBuckets<false>(buckets, other.buckets, bucketCount());
 }
 
 bool BitVector::matches(uint_fast64_t bitIndex, BitVector const& other) const {
@@ -698,44 +876,16 @@ uint_fast64_t BitVector::getNumberOfSetBits() const {
 }
 
 uint_fast64_t BitVector::getNumberOfSetBitsBeforeIndex(uint_fast64_t index) const {
-    uint_fast64_t result = 0;
-
     // First, count all full buckets.
     uint_fast64_t bucket = index >> 6;
-    for (uint_fast64_t i = 0; i < bucket; ++i) {
-        // Check if we are using g++ or clang++ and, if so, use the built-in function
-#if (defined(__GNUG__) || defined(__clang__))
-        result += __builtin_popcountll(buckets[i]);
-#elif defined WINDOWS
-#include <nmmintrin.h>
-        // If the target machine does not support SSE4, this will fail.
-        result += _mm_popcnt_u64(bucketVector[i]);
-#else
-        uint_fast32_t cnt;
-        uint_fast64_t bitset = buckets[i];
-        for (cnt = 0; bitset; cnt++) {
-            bitset &= bitset - 1;
-        }
-        result += cnt;
-#endif
-    }
+    uint_fast64_t result = countSetBits(buckets, bucket);
 
     // Now check if we have to count part of a bucket.
     uint64_t tmp = index & mod64mask;
     if (tmp != 0) {
         tmp = ~((1ll << (64 - (tmp & mod64mask))) - 1ll);
         tmp &= buckets[bucket];
-        // Check if we are using g++ or clang++ and, if so, use the built-in function
-#if (defined(__GNUG__) || defined(__clang__))
-        result += __builtin_popcountll(tmp);
-#else
-        uint_fast32_t cnt;
-        uint64_t bitset = tmp;
-        for (cnt = 0; bitset; cnt++) {
-            bitset &= bitset - 1;
-        }
-        result += cnt;
-#endif
+        result += popcount(tmp);
     }
 
     return result;
@@ -761,7 +911,7 @@ size_t BitVector::size() const {
 }
 
 std::size_t BitVector::getSizeInBytes() const {
-    return sizeof(*this) + sizeof(uint64_t) * bucketCount();
+    return sizeof(*this) + (hasInlineBuckets() ? 0 : sizeof(uint64_t) * bucketCount());
 }
 
 BitVector::const_iterator BitVector::begin() const {
@@ -1182,6 +1332,45 @@ void BitVector::printBits(std::ostream& out) const {
     out << '\n';
 }
 
+BitVectorRankIndex::BitVectorRankIndex(BitVector const& bitVector) : bitVector(bitVector) {
+    uint64_t const bucketCount = bitVector.bucketCount();
+    setBitsBeforeBucket.reserve(bucketCount + 1);
+    uint64_t numberOfSetBits = 0;
+    for (uint64_t bucket = 0; bucket < bucketCount; ++bucket) {
+        setBitsBeforeBucket.push_back(numberOfSetBits);
+        numberOfSetBits += popcount(bitVector.buckets[bucket]);
+    }
+    setBitsBeforeBucket.push_back(numberOfSetBits);
+}
+
+uint64_t BitVectorRankIndex::getNumberOfSetBitsBeforeIndex(uint64_t index) const {
+    STORM_LOG_ASSERT(index <= bitVector.size(), "Invalid index " << index << " for bit vector of size " << bitVector.size() << ".");
+    uint64_t const bucket = index >> 6;
+    uint64_t result = setBitsBeforeBucket[bucket];
+    uint64_t const indexInBucket = index & BitVector::mod64mask;
+    if (indexInBucket != 0) {
+        result += popcount(bitVector.buckets[bucket] & ~(-1ull >> indexInBucket));
+    }
+    return result;
+}
+
+uint64_t BitVectorRankIndex::getNumberOfSetBits() const {
+    return setBitsBeforeBucket.back();
+}
+
+uint64_t BitVectorRankIndex::getIndexOfSetBit(uint64_t rank) const {
+    if (rank >= getNumberOfSetBits()) {
+        return bitVector.size();
+    }
+    // Find the last bucket that has at most rank set bits before it. This bucket contains the desired bit.
+    uint64_t const bucket = std::upper_bound(setBitsBeforeBucket.begin(), setBitsBeforeBucket.end(), rank) - setBitsBeforeBucket.begin() - 1;
+    uint64_t bits = bitVector.buckets[bucket];
+    for (uint64_t remaining = rank - setBitsBeforeBucket[bucket]; remaining > 0; --remaining) {
+        bits ^= 1ull << (63 - BitVector::countLeadingZeros(bits));
+    }
+    return (bucket << 6) + BitVector::countLeadingZeros(bits);
+}
+
 std::size_t FNV1aBitVectorHash::operator()(storm::storage::BitVector const& bv) const {
     std::size_t seed = 14695981039346656037ull;
 
@@ -1397,6 +1586,76 @@ uint64_t Murmur3BitVectorHash<uint64_t>::operator()(storm::storage::BitVector co
     return h1 ^ h2;
 }
 
+// The default secret of wyhash.
+uint64_t const wyhashSecret[4] = {0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull};
+
+// Computes the 128-bit product of the two values and stores its low half in a and its high half in b.
+inline __attribute__((always_inline)) void wymum(uint64_t& a, uint64_t& b) {
+#ifdef __SIZEOF_INT128__
+    __uint128_t product = static_cast<__uint128_t>(a) * b;
+    a = static_cast<uint64_t>(product);
+    b = static_cast<uint64_t>(product >> 64);
+#else
+    uint64_t highA = a >> 32, highB = b >> 32, lowA = static_cast<uint32_t>(a), lowB = static_cast<uint32_t>(b);
+    uint64_t high = highA * highB, middle0 = highA * lowB, middle1 = highB * lowA, low = lowA * lowB;
+    uint64_t t = low + (middle0 << 32);
+    uint64_t carry = t < low;
+    uint64_t lo = t + (middle1 << 32);
+    carry += lo < t;
+    a = lo;
+    b = high + (middle0 >> 32) + (middle1 >> 32) + carry;
+#endif
+}
+
+inline __attribute__((always_inline)) uint64_t wymix(uint64_t a, uint64_t b) {
+    wymum(a, b);
+    return a ^ b;
+}
+
+template<>
+uint64_t WyhashBitVectorHash<uint64_t>::operator()(storm::storage::BitVector const& bv) const {
+    // As the length of the key is a multiple of 8 bytes, the key is consumed word by word rather than byte by byte.
+    uint64_t const* words = bv.buckets;
+    uint64_t const numberOfWords = bv.bucketCount();
+    uint64_t seed = wymix(wyhashSecret[0], wyhashSecret[1]);
+
+    uint64_t i = 0;
+    if (numberOfWords >= 6) {
+        // Three independent lanes that consume 48 bytes per iteration.
+        uint64_t seed1 = seed;
+        uint64_t seed2 = seed;
+        for (; i + 6 <= numberOfWords; i += 6) {
+            seed = wymix(words[i] ^ wyhashSecret[1], words[i + 1] ^ seed);
+            seed1 = wymix(words[i + 2] ^ wyhashSecret[2], words[i + 3] ^ seed1);
+            seed2 = wymix(words[i + 4] ^ wyhashSecret[3], words[i + 5] ^ seed2);
+        }
+        seed ^= seed1 ^ seed2;
+    }
+    for (; i + 2 < numberOfWords; i += 2) {
+        seed = wymix(words[i] ^ wyhashSecret[1], words[i + 1] ^ seed);
+    }
+
+    // The (at most) two remaining words.
+    uint64_t a = 0;
+    uint64_t b = 0;
+    if (i + 2 == numberOfWords) {
+        a = words[i];
+        b = words[i + 1];
+    } else if (i + 1 == numberOfWords) {
+        a = words[i];
+    }
+    a ^= wyhashSecret[1];
+    b ^= seed;
+    wymum(a, b);
+    return wymix(a ^ wyhashSecret[0] ^ (numberOfWords * 8), b ^ wyhashSecret[1]);
+}
+
+template<>
+uint32_t WyhashBitVectorHash<uint32_t>::operator()(storm::storage::BitVector const& bv) const {
+    uint64_t hash = WyhashBitVectorHash<uint64_t>()(bv);
+    return static_cast<uint32_t>(hash >> 32) ^ static_cast<uint32_t>(hash);
+}
+
 void BitVector::store(std::ostream& os) const {
     os << bitCount;
     for (uint64_t i = 0; i < bucketCount(); ++i) {
@@ -1442,6 +1701,8 @@ template void BitVector::set(storm::storage::FlatSet<uint_fast64_t>::const_itera
 
 template struct Murmur3BitVectorHash<uint32_t>;
 template struct Murmur3BitVectorHash<uint64_t>;
+template struct WyhashBitVectorHash<uint32_t>;
+template struct WyhashBitVectorHash<uint64_t>;
 }  // namespace storage
 }  // namespace storm
 
@@ -8,6 +8,8 @@
 #include <ostream>
 #include <vector>
 
+#include "storm-config.h"
+
 namespace storm {
 namespace storage {
 
@@ -381,6 +383,14 @@ class BitVector {
      */
     BitVector& operator|=(BitVector const& other);
 
+    /*!
+     * Clears all bits that are set in the given bit vector. This is equivalent to *this &= ~other, but does not create a temporary bit vector.
+     *
+     * @param other A reference to the bit vector whose set bits are to be cleared.
+     * @return A reference to the current bit vector.
+     */
+    BitVector& andNot(BitVector const& other);
+
     /*!
      * Performs a logical "xor" with the given bit vector. In case the sizes of the bit vectors do not match,
      * only the matching portion is considered and the overlapping bits are set to 0.
@@ -575,6 +585,25 @@ class BitVector {
      */
     std::vector<uint_fast64_t> getNumberOfSetBitsBeforeIndices() const;
 
+    /*!
+     * Calls the given function with the index of each set bit in ascending order. This is faster than iterating over the bit vector, as
+     * each bucket is only loaded once and the set bits within a bucket are found without searching from the previous index.
+     *
+     * @param function The function to call for each index of a set bit.
+     */
+    template<typename Function>
+    void forEachSetBit(Function&& function) const {
+        for (uint64_t bucketIndex = 0, bucketEnd = bucketCount(); bucketIndex < bucketEnd; ++bucketIndex) {
+            uint64_t bucket = buckets[bucketIndex];
+            while (bucket != 0) {
+                // The bits are stored with the most significant bit first.
+                uint64_t const indexInBucket = countLeadingZeros(bucket);
+                function((bucketIndex << 6) + indexInBucket);
+                bucket ^= 1ull << (63 - indexInBucket);
+            }
+        }
+    }
+
     /*!
      * Retrieves the number of bits this bit vector can store.
      *
@@ -688,6 +717,10 @@ class BitVector {
 
     template<typename StateType>
     friend struct Murmur3BitVectorHash;
+    template<typename StateType>
+    friend struct WyhashBitVectorHash;
+    friend class BitVectorRankIndex;
+    friend class CompressedBitVector;
 
    private:
     /*!
@@ -751,16 +784,86 @@ class BitVector {
      */
     size_t bucketCount() const;
 
+    /*!
+     * Points the storage to (uninitialized) memory for the given number of buckets. Bit vectors with at most InlineBucketCount buckets use the
+     * inline storage, larger ones allocate their buckets on the heap. The previous storage must have been released.
+     */
+    void allocateBuckets(uint_fast64_t bucketCount);
+
+    /*!
+     * Releases the heap storage (if any) and points the storage to the (empty) inline buckets.
+     */
+    void releaseBuckets();
+
+    /*!
+     * Retrieves whether the buckets are stored inline.
+     */
+    bool hasInlineBuckets() const;
+
+    /*!
+     * Retrieves the number of leading zeros of the given (non-zero) bucket, i.e., the index of the first set bit within the bucket.
+     */
+    static uint64_t countLeadingZeros(uint64_t bucket) {
+#if (defined(__GNUG__) || defined(__clang__))
+        return __builtin_clzll(bucket);
+#else
+        uint64_t result = 0;
+        for (uint64_t mask = 1ull << 63; (bucket & mask) == 0; mask >>= 1) {
+            ++result;
+        }
+        return result;
+#endif
+    }
+
+    // The number of buckets that are stored within the bit vector itself. This avoids heap allocations for small bit vectors, e.g., states.
+    static const uint_fast64_t InlineBucketCount = 2;
+
     // The number of bits that this bit vector can hold.
     uint_fast64_t bitCount;
 
-    // The underlying storage of 64-bit buckets for all bits of this bit vector.
+    // The underlying storage of 64-bit buckets for all bits of this bit vector. This either points to inlineBuckets or to heap memory.
     uint64_t* buckets;
 
+    // The storage for bit vectors with at most InlineBucketCount buckets.
+    uint64_t inlineBuckets[InlineBucketCount];
+
     // A bit mask that can be used to reduce a modulo 64 operation to a logical "and".
     static const uint_fast64_t mod64mask = (1 << 6) - 1;
 };
 
+/*!
+ * An index over a bit vector that retrieves the number of set bits before an index (rank) in constant time and the index of the i-th set bit
+ * (select) in logarithmic time. This pays off if BitVector::getNumberOfSetBitsBeforeIndex would otherwise be called many times. The index
+ * stores the number of set bits before each bucket, i.e., it takes as much memory as the bit vector itself.
+ * The bit vector must neither be modified nor destroyed while the index is used.
+ */
+class BitVectorRankIndex {
+   public:
+    explicit BitVectorRankIndex(BitVector const& bitVector);
+
+    /*!
+     * Retrieves the number of bits set in the bit vector with an index strictly smaller than the given one.
+     */
+    uint64_t getNumberOfSetBitsBeforeIndex(uint64_t index) const;
+
+    /*!
+     * Retrieves the number of bits set in the bit vector.
+     */
+    uint64_t getNumberOfSetBits() const;
+
+    /*!
+     * Retrieves the index of the set bit that has the given number of set bits before it.
+     *
+     * @return The index of the set bit or the size of the bit vector if less than rank + 1 bits are set.
+     */
+    uint64_t getIndexOfSetBit(uint64_t rank) const;
+
+   private:
+    BitVector const& bitVector;
+    // The number of set bits before each bucket (and the total number of set bits at the last position).
+    std::vector<uint64_t> setBitsBeforeBucket;
+};
+
 struct FNV1aBitVectorHash {
     std::size_t operator()(storm::storage::BitVector const& bv) const;
 };
@@ -770,6 +873,27 @@ struct Murmur3BitVectorHash {
     StateType operator()(storm::storage::BitVector const& bv) const;
 };
 
+/*!
+ * Hashes the buckets of the bit vector with wyhash (final version 4), which consumes 16 bytes per multiplication and is typically considerably
+ * faster than MurmurHash3 for the long keys of state storages.
+ */
+template<typename StateType>
+struct WyhashBitVectorHash {
+    StateType operator()(storm::storage::BitVector const& bv) const;
+};
+
+/*!
+ * The hash that bit vector hash maps use unless specified otherwise. It can be selected with the CMake option STORM_BITVECTOR_WYHASH. Note that
+ * the hash determines the order in which the maps enumerate their keys.
+ */
+#ifdef STORM_BITVECTOR_WYHASH
+template<typename StateType>
+using DefaultBitVectorHash = WyhashBitVectorHash<StateType>;
+#else
+template<typename StateType>
+using DefaultBitVectorHash = Murmur3BitVectorHash<StateType>;
+#endif
+
 }  // namespace storage
 }  // namespace storm
 
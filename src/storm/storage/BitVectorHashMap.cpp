@@ -3,6 +3,10 @@
 #include <algorithm>
 #include <iostream>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "storm/exceptions/InternalException.h"
 #include "storm/utility/macros.h"
 
@@ -54,6 +58,7 @@ BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_
     // Create the underlying containers.
     buckets = storm::storage::BitVector(bucketSize * (1ull << currentSize));
     occupied = storm::storage::BitVector(1ull << currentSize);
+    metadata = std::vector<uint8_t>((1ull << currentSize) + groupSize - 1, 0);
     values = std::vector<ValueType>(1ull << currentSize);
 }
 
@@ -82,6 +87,7 @@ void BitVectorHashMap<ValueType, Hash>::increaseSize() {
     std::swap(oldBuckets, buckets);
     storm::storage::BitVector oldOccupied = storm::storage::BitVector(1ull << currentSize);
     std::swap(oldOccupied, occupied);
+    metadata = std::vector<uint8_t>((1ull << currentSize) + groupSize - 1, 0);
     std::vector<ValueType> oldValues = std::vector<ValueType>(1ull << currentSize);
     std::swap(oldValues, values);
 
@@ -103,13 +109,14 @@ template<class ValueType, class Hash>
 std::pair<ValueType, uint64_t> BitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value) {
     checkIncreaseSize();
 
-    std::pair<bool, uint64_t> flagAndBucket = this->findBucket(key);
+    uint64_t hash = hasher(key);
+    std::pair<bool, uint64_t> flagAndBucket = this->findBucket(key, hash);
     if (flagAndBucket.first) {
         return std::make_pair(values[flagAndBucket.second], flagAndBucket.second);
     } else {
         // Insert the new bits into the bucket.
         buckets.set(flagAndBucket.second * bucketSize, key);
-        occupied.set(flagAndBucket.second);
+        setOccupied(flagAndBucket.second, hash);
         values[flagAndBucket.second] = value;
         ++numberOfElements;
         return std::make_pair(value, flagAndBucket.second);
@@ -143,6 +150,15 @@ bool BitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const
     return findBucket(key).first;
 }
 
+template<class ValueType, class Hash>
+std::optional<ValueType> BitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+    std::pair<bool, uint64_t> flagBucketPair = this->findBucket(key);
+    if (flagBucketPair.first) {
+        return values[flagBucketPair.second];
+    }
+    return std::nullopt;
+}
+
 template<class ValueType, class Hash>
 typename BitVectorHashMap<ValueType, Hash>::const_iterator BitVectorHashMap<ValueType, Hash>::begin() const {
     return const_iterator(*this, occupied.begin());
@@ -160,20 +176,57 @@ uint64_t BitVectorHashMap<ValueType, Hash>::getCurrentShiftWidth() const {
 
 template<class ValueType, class Hash>
 std::pair<bool, uint64_t> BitVectorHashMap<ValueType, Hash>::findBucket(storm::storage::BitVector const& key) const {
-    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
-    uint64_t bucket = hasher(key) >> this->getCurrentShiftWidth();
+    return findBucket(key, hasher(key));
+}
 
-    while (isBucketOccupied(bucket)) {
-        if (buckets.matches(bucket * bucketSize, key)) {
-            return std::make_pair(true, bucket);
+template<class ValueType, class Hash>
+std::pair<bool, uint64_t> BitVectorHashMap<ValueType, Hash>::findBucket(storm::storage::BitVector const& key, uint64_t hash) const {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    uint64_t const mask = (1ull << currentSize) - 1;
+    // The highest bits of the hash determine the bucket, so the fingerprint is taken from the lowest bits.
+    uint8_t const fingerprint = 0x80 | static_cast<uint8_t>(hash & 0x7f);
+    uint64_t group = hash >> this->getCurrentShiftWidth();
+
+    // Since the load factor is below one, there is an empty bucket that terminates the search.
+    while (true) {
+#if defined(__SSE2__)
+        __m128i fingerprints = _mm_loadu_si128(reinterpret_cast<__m128i const*>(metadata.data() + group));
+        uint32_t matching = _mm_movemask_epi8(_mm_cmpeq_epi8(fingerprints, _mm_set1_epi8(static_cast<char>(fingerprint))));
+        uint32_t empty = _mm_movemask_epi8(_mm_cmpeq_epi8(fingerprints, _mm_setzero_si128()));
+#else
+        uint32_t matching = 0;
+        uint32_t empty = 0;
+        for (uint64_t offset = 0; offset < groupSize; ++offset) {
+            uint8_t const entry = metadata[group + offset];
+            matching |= static_cast<uint32_t>(entry == fingerprint) << offset;
+            empty |= static_cast<uint32_t>(entry == 0) << offset;
         }
-        ++bucket;
-        if (bucket == (1ull << currentSize)) {
-            bucket = 0;
+#endif
+        if (empty != 0) {
+            // Buckets behind the first empty bucket are not part of the probe sequence.
+            matching &= (empty & (~empty + 1)) - 1;
         }
+        while (matching != 0) {
+            uint64_t bucket = (group + __builtin_ctz(matching)) & mask;
+            if (buckets.matches(bucket * bucketSize, key)) {
+                return std::make_pair(true, bucket);
+            }
+            matching &= matching - 1;
+        }
+        if (empty != 0) {
+            return std::make_pair(false, (group + __builtin_ctz(empty)) & mask);
+        }
+        group = (group + groupSize) & mask;
     }
+}
 
-    return std::make_pair(false, bucket);
+template<class ValueType, class Hash>
+void BitVectorHashMap<ValueType, Hash>::setOccupied(uint64_t bucket, uint64_t hash) {
+    occupied.set(bucket);
+    uint8_t const fingerprint = 0x80 | static_cast<uint8_t>(hash & 0x7f);
+    for (uint64_t position = bucket; position < metadata.size(); position += (1ull << currentSize)) {
+        metadata[position] = fingerprint;
+    }
 }
 
 template<class ValueType, class Hash>
@@ -188,8 +241,30 @@ void BitVectorHashMap<ValueType, Hash>::remap(std::function<ValueType(ValueType
     }
 }
 
+template<class ValueType, class Hash>
+double BitVectorHashMap<ValueType, Hash>::getAverageProbeLength() const {
+    if (numberOfElements == 0) {
+        return 0.0;
+    }
+    uint64_t const mask = (1ull << currentSize) - 1;
+    uint64_t totalProbeLength = 0;
+    for (auto bucket : occupied) {
+        uint64_t initialBucket = hasher(buckets.get(bucket * bucketSize, bucketSize)) >> this->getCurrentShiftWidth();
+        totalProbeLength += ((bucket - initialBucket) & mask) + 1;
+    }
+    return static_cast<double>(totalProbeLength) / numberOfElements;
+}
+
 template class BitVectorHashMap<uint64_t>;
 template class BitVectorHashMap<uint32_t>;
+// The hash that is not the default one is instantiated as well, such that both can be compared.
+#ifdef STORM_BITVECTOR_WYHASH
+template class BitVectorHashMap<uint64_t, Murmur3BitVectorHash<uint64_t>>;
+template class BitVectorHashMap<uint32_t, Murmur3BitVectorHash<uint32_t>>;
+#else
+template class BitVectorHashMap<uint64_t, WyhashBitVectorHash<uint64_t>>;
+template class BitVectorHashMap<uint32_t, WyhashBitVectorHash<uint32_t>>;
+#endif
 // These instantiations allow you to "group" states in a BitVectorHashMap. I.e.,
 // if you want to look at a state and know what "group" it is in (with groups
 // controlled by an 8 bit group index) you can instantiate a BitVectorHashMap<uint8_t>
@@ -199,5 +274,7 @@ template class BitVectorHashMap<uint32_t>;
 // in its multithreading implementation.
 template class BitVectorHashMap<uint8_t, Murmur3BitVectorHash<uint32_t>>;
 template class BitVectorHashMap<uint8_t, Murmur3BitVectorHash<uint64_t>>;
+template class BitVectorHashMap<uint8_t, WyhashBitVectorHash<uint32_t>>;
+template class BitVectorHashMap<uint8_t, WyhashBitVectorHash<uint64_t>>;
 }  // namespace storage
 }  // namespace storm
@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <optional>
 
 #include "storm/storage/BitVector.h"
 
@@ -13,10 +14,14 @@ namespace storage {
  * This class represents a hash-map whose keys are bit vectors. The value type is arbitrary. Currently, only
  * queries and insertions are supported. Also, the keys must be bit vectors with a length that is a multiple of
  * 64.
+ *
+ * Collisions are resolved by linear probing. Similar to Swiss tables, every bucket has a one-byte fingerprint of the hash of its key, such that a
+ * lookup compares (with SSE2, if available) the fingerprints of 16 consecutive buckets at once and only compares the keys of buckets with a matching
+ * fingerprint.
  */
 //        template<typename ValueType, typename Hash = std::hash<storm::storage::BitVector>>
 //        template<typename ValueType, typename Hash = FNV1aBitVectorHash>
-template<typename ValueType, typename Hash = Murmur3BitVectorHash<ValueType>>
+template<typename ValueType, typename Hash = DefaultBitVectorHash<ValueType>>
 class BitVectorHashMap {
    public:
     class BitVectorHashMapIterator {
@@ -117,6 +122,15 @@ class BitVectorHashMap {
      */
     bool contains(storm::storage::BitVector const& key) const;
 
+    /*!
+     * Retrieves the value associated with the given key if the key is contained in the map. As this does not
+     * modify the map, it may be called concurrently from several threads as long as no thread inserts keys.
+     *
+     * @param key The key to search.
+     * @return The associated value if the key is contained in the map and nothing otherwise.
+     */
+    std::optional<ValueType> find(storm::storage::BitVector const& key) const;
+
     /*!
      * Retrieves an iterator to the elements of the map.
      *
@@ -152,7 +166,17 @@ class BitVectorHashMap {
      */
     void remap(std::function<ValueType(ValueType const&)> const& remapping);
 
+    /*!
+     * Retrieves the average number of buckets that are inspected when looking up a key that is contained in the map. As this rehashes all keys,
+     * it is meant for statistics only.
+     *
+     * @return The average probe length (which is at least one if the map is not empty).
+     */
+    double getAverageProbeLength() const;
+
    private:
+    // The number of fingerprints that a lookup inspects at once.
+    static const uint64_t groupSize = 16;
     /*!
      * Retrieves whether the given bucket holds a value.
      *
@@ -170,6 +194,21 @@ class BitVectorHashMap {
      */
     std::pair<bool, uint64_t> findBucket(storm::storage::BitVector const& key) const;
 
+    /*!
+     * Searches for the bucket with the given key.
+     *
+     * @param key The key to search for.
+     * @param hash The hash of the key.
+     * @return A pair whose first component indicates whether the key is already contained in the map and whose
+     * second component indicates in which bucket the key is stored.
+     */
+    std::pair<bool, uint64_t> findBucket(storm::storage::BitVector const& key, uint64_t hash) const;
+
+    /*!
+     * Marks the given bucket as occupied by a key with the given hash.
+     */
+    void setOccupied(uint64_t bucket, uint64_t hash);
+
     /*!
      * Inserts the given key-value pair without resizing the underlying storage. If that fails, this is
      * indicated by the return value.
@@ -212,6 +251,10 @@ class BitVectorHashMap {
     // A bit vector that stores which buckets actually hold a value.
     storm::storage::BitVector occupied;
 
+    // The fingerprint of the key in every bucket (with the most significant bit set) or zero if the bucket is empty. The entries are repeated
+    // cyclically for groupSize - 1 positions after the last bucket, such that the fingerprints of groupSize consecutive buckets can be loaded at once.
+    std::vector<uint8_t> metadata;
+
     // A vector of the mapped-to values. The entry at position i is the "target" of the key in bucket i.
     std::vector<ValueType> values;
 
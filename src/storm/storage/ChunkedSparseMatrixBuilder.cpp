@@ -0,0 +1,241 @@
+#include "storm/storage/ChunkedSparseMatrixBuilder.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidStateException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace {
+template<typename EntryType, typename IndexType>
+EntryType* findEntryOfColumn(EntryType* begin, EntryType* end, IndexType column) {
+    return std::lower_bound(begin, end, column, [](EntryType const& entry, IndexType const& value) { return entry.getColumn() < value; });
+}
+}  // namespace
+
+template<typename ValueType>
+ChunkedSparseMatrixBuilder<ValueType>::RowWriter::RowWriter(ChunkedSparseMatrixBuilder<ValueType>& builder)
+    : builder(builder), rowEntries(nullptr), currentRow(0), numberOfEntriesInRow(0), rowSize(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+void ChunkedSparseMatrixBuilder<ValueType>::RowWriter::addNextValue(index_type row, index_type column, ValueType const& value) {
+    if (rowEntries == nullptr || row != currentRow) {
+        STORM_LOG_ASSERT(rowEntries == nullptr || row > currentRow, "Adding an element in row " << row << " after an element in row " << currentRow << ".");
+        STORM_LOG_ASSERT(rowEntries == nullptr || numberOfEntriesInRow == rowSize,
+                         "Row " << currentRow << " has " << numberOfEntriesInRow << " entries, but " << rowSize << " were reserved.");
+        rowEntries = builder.getRowEntries(row);
+        currentRow = row;
+        numberOfEntriesInRow = 0;
+        rowSize = builder.getRowSize(row);
+    }
+
+    // As the entries of the row may be given in any order, the new entry is inserted at its position.
+    Entry* rowEnd = rowEntries + numberOfEntriesInRow;
+    Entry* position = findEntryOfColumn(rowEntries, rowEnd, column);
+    if (position != rowEnd && position->getColumn() == column) {
+        position->setValue(position->getValue() + value);
+        return;
+    }
+    STORM_LOG_THROW(numberOfEntriesInRow < rowSize, storm::exceptions::InvalidArgumentException,
+                    "Only " << rowSize << " entries were reserved for row " << row << ".");
+    std::move_backward(position, rowEnd, rowEnd + 1);
+    *position = Entry(column, value);
+    ++numberOfEntriesInRow;
+}
+
+template<typename ValueType>
+void ChunkedSparseMatrixBuilder<ValueType>::RowWriter::newRowGroup(index_type) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+ChunkedSparseMatrixBuilder<ValueType>::ChunkedSparseMatrixBuilder(bool hasCustomRowGrouping, index_type chunkSize)
+    : hasCustomRowGrouping(hasCustomRowGrouping), chunkSize(std::max<index_type>(chunkSize, 1)), numberOfEntries(0), lastColumn(0), firstOpenRow(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+void ChunkedSparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type column, ValueType const& value) {
+    STORM_LOG_THROW(row >= firstOpenRow, storm::exceptions::InvalidArgumentException,
+                    "Adding an element in row " << row << ", but rows up to " << firstOpenRow << " have already been added.");
+    firstOpenRow = row;
+    if (row >= rowIndications.size()) {
+        rowIndications.resize(row + 1, numberOfEntries);
+    } else if (numberOfEntries > rowIndications.back() && column <= lastColumn) {
+        // The entry needs to be inserted before the last entry of the row (or be added to an existing entry). The entries of the current row are
+        // the last ones of the last chunk.
+        Chunk* chunk = &chunks.back();
+        index_type const rowOffset = rowIndications.back() - chunk->firstEntry;
+        Entry* rowEnd = chunk->entries.data() + chunk->numberOfUsedEntries;
+        Entry* position = findEntryOfColumn(chunk->entries.data() + rowOffset, rowEnd, column);
+        if (position->getColumn() == column) {
+            position->setValue(position->getValue() + value);
+            return;
+        }
+        index_type const positionInRow = std::distance(chunk->entries.data() + rowOffset, position);
+        makeRoomForEntry();
+        chunk = &chunks.back();
+        Entry* rowBegin = chunk->entries.data() + (rowIndications.back() - chunk->firstEntry);
+        rowEnd = chunk->entries.data() + chunk->numberOfUsedEntries;
+        std::move_backward(rowBegin + positionInRow, rowEnd, rowEnd + 1);
+        rowBegin[positionInRow] = Entry(column, value);
+        ++chunk->numberOfUsedEntries;
+        ++numberOfEntries;
+        return;
+    }
+
+    makeRoomForEntry();
+    Chunk& chunk = chunks.back();
+    chunk.entries[chunk.numberOfUsedEntries] = Entry(column, value);
+    ++chunk.numberOfUsedEntries;
+    ++numberOfEntries;
+    lastColumn = column;
+}
+
+template<typename ValueType>
+void ChunkedSparseMatrixBuilder<ValueType>::newRowGroup(index_type startingRow) {
+    STORM_LOG_THROW(hasCustomRowGrouping, storm::exceptions::InvalidStateException, "Matrix was not created to have a custom row grouping.");
+    STORM_LOG_THROW(startingRow >= rowIndications.size(), storm::exceptions::InvalidStateException,
+                    "Cannot start a row group at row " << startingRow << " as rows up to " << rowIndications.size() << " have already been started.");
+    rowGroupIndices.push_back(startingRow);
+}
+
+template<typename ValueType>
+void ChunkedSparseMatrixBuilder<ValueType>::appendRows(index_type firstRow, std::vector<index_type> const& rowEntryCounts,
+                                                       std::vector<index_type> const& rowGroupStarts) {
+    STORM_LOG_THROW(firstRow >= rowIndications.size(), storm::exceptions::InvalidArgumentException,
+                    "Cannot append row " << firstRow << " as rows up to " << rowIndications.size() << " have already been started.");
+    STORM_LOG_THROW(hasCustomRowGrouping || rowGroupStarts.empty(), storm::exceptions::InvalidStateException,
+                    "Matrix was not created to have a custom row grouping.");
+    rowIndications.resize(firstRow, numberOfEntries);
+    rowIndications.reserve(firstRow + rowEntryCounts.size());
+    index_type numberOfAppendedEntries = 0;
+    for (auto const& rowEntryCount : rowEntryCounts) {
+        rowIndications.push_back(numberOfEntries + numberOfAppendedEntries);
+        numberOfAppendedEntries += rowEntryCount;
+    }
+    for (auto const& rowGroupStart : rowGroupStarts) {
+        STORM_LOG_ASSERT(rowGroupStart >= firstRow && rowGroupStart < rowIndications.size(), "Row group start " << rowGroupStart << " is out of range.");
+        STORM_LOG_ASSERT(rowGroupIndices.empty() || rowGroupStart >= rowGroupIndices.back(), "Row group starts are not ascending.");
+        rowGroupIndices.push_back(rowGroupStart);
+    }
+
+    if (numberOfAppendedEntries > 0) {
+        // The appended entries are placed in the remaining part of the last chunk if they fit and in a new chunk of the exact size otherwise.
+        if (chunks.empty() || chunks.back().entries.size() - chunks.back().numberOfUsedEntries < numberOfAppendedEntries) {
+            chunks.push_back(Chunk{numberOfEntries, 0, std::vector<Entry>(numberOfAppendedEntries)});
+        }
+        chunks.back().numberOfUsedEntries += numberOfAppendedEntries;
+        numberOfEntries += numberOfAppendedEntries;
+    }
+    firstOpenRow = rowIndications.size();
+    lastColumn = 0;
+}
+
+template<typename ValueType>
+typename ChunkedSparseMatrixBuilder<ValueType>::Entry* ChunkedSparseMatrixBuilder<ValueType>::getRowEntries(index_type row) {
+    STORM_LOG_ASSERT(row < rowIndications.size(), "Row " << row << " has not been started.");
+    index_type const entry = rowIndications[row];
+    // Find the last chunk that starts at or before the entry.
+    auto chunkIt = std::upper_bound(chunks.begin(), chunks.end(), entry, [](index_type const& value, Chunk const& chunk) { return value < chunk.firstEntry; });
+    if (chunkIt == chunks.begin()) {
+        STORM_LOG_ASSERT(getRowSize(row) == 0, "Row " << row << " is not stored in any chunk.");
+        return nullptr;
+    }
+    --chunkIt;
+    return chunkIt->entries.data() + (entry - chunkIt->firstEntry);
+}
+
+template<typename ValueType>
+typename ChunkedSparseMatrixBuilder<ValueType>::index_type ChunkedSparseMatrixBuilder<ValueType>::getCurrentRowCount() const {
+    return rowIndications.size();
+}
+
+template<typename ValueType>
+typename ChunkedSparseMatrixBuilder<ValueType>::index_type ChunkedSparseMatrixBuilder<ValueType>::getCurrentRowGroupCount() const {
+    return hasCustomRowGrouping ? rowGroupIndices.size() : rowIndications.size();
+}
+
+template<typename ValueType>
+SparseMatrix<ValueType> ChunkedSparseMatrixBuilder<ValueType>::build(index_type overriddenRowCount, index_type overriddenColumnCount,
+                                                                    index_type overriddenRowGroupCount) {
+    index_type rowCount = std::max<index_type>(rowIndications.size(), overriddenRowCount);
+    if (hasCustomRowGrouping && !rowGroupIndices.empty()) {
+        // The last row group consists of at least one (possibly empty) row.
+        rowCount = std::max<index_type>(rowCount, rowGroupIndices.back() + 1);
+    }
+    // The additional entry is the sentinel, i.e., the end of the last row.
+    rowIndications.resize(rowCount + 1, numberOfEntries);
+
+    std::vector<Entry> columnsAndValues;
+    if (chunks.size() == 1) {
+        columnsAndValues = std::move(chunks.front().entries);
+        columnsAndValues.resize(chunks.front().numberOfUsedEntries);
+    } else {
+        columnsAndValues.reserve(numberOfEntries);
+        for (auto& chunk : chunks) {
+            columnsAndValues.insert(columnsAndValues.end(), std::make_move_iterator(chunk.entries.begin()),
+                                    std::make_move_iterator(chunk.entries.begin() + chunk.numberOfUsedEntries));
+            std::vector<Entry>().swap(chunk.entries);
+        }
+    }
+    chunks.clear();
+    STORM_LOG_ASSERT(columnsAndValues.size() == numberOfEntries, "Unexpected number of entries.");
+
+    index_type columnCount = overriddenColumnCount;
+    for (auto const& entry : columnsAndValues) {
+        columnCount = std::max(columnCount, entry.getColumn() + 1);
+    }
+
+    boost::optional<std::vector<index_type>> resultRowGroupIndices;
+    if (hasCustomRowGrouping) {
+        index_type const rowGroupCount = std::max<index_type>(rowGroupIndices.size(), overriddenRowGroupCount);
+        rowGroupIndices.resize(rowGroupCount + 1, rowCount);
+        resultRowGroupIndices = std::move(rowGroupIndices);
+    }
+    return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(resultRowGroupIndices));
+}
+
+template<typename ValueType>
+void ChunkedSparseMatrixBuilder<ValueType>::makeRoomForEntry() {
+    if (!chunks.empty() && chunks.back().numberOfUsedEntries < chunks.back().entries.size()) {
+        return;
+    }
+
+    // The entries of the current row are moved to the new chunk.
+    index_type const rowStart = rowIndications.empty() ? numberOfEntries : rowIndications.back();
+    index_type const numberOfEntriesInRow = numberOfEntries - rowStart;
+    Chunk newChunk{rowStart, numberOfEntriesInRow, std::vector<Entry>(std::max(chunkSize, numberOfEntriesInRow + 1))};
+    if (numberOfEntriesInRow > 0) {
+        Chunk& lastChunk = chunks.back();
+        auto rowBegin = lastChunk.entries.begin() + (rowStart - lastChunk.firstEntry);
+        std::move(rowBegin, rowBegin + numberOfEntriesInRow, newChunk.entries.begin());
+        lastChunk.numberOfUsedEntries -= numberOfEntriesInRow;
+        if (lastChunk.numberOfUsedEntries == 0) {
+            chunks.pop_back();
+        }
+    }
+    chunks.push_back(std::move(newChunk));
+}
+
+template<typename ValueType>
+typename ChunkedSparseMatrixBuilder<ValueType>::index_type ChunkedSparseMatrixBuilder<ValueType>::getRowSize(index_type row) const {
+    return (row + 1 < rowIndications.size() ? rowIndications[row + 1] : numberOfEntries) - rowIndications[row];
+}
+
+template class ChunkedSparseMatrixBuilder<double>;
+#ifdef STORM_HAVE_CARL
+template class ChunkedSparseMatrixBuilder<storm::RationalNumber>;
+template class ChunkedSparseMatrixBuilder<storm::RationalFunction>;
+template class ChunkedSparseMatrixBuilder<storm::Interval>;
+#endif
+
+}  // namespace storage
+}  // namespace storm
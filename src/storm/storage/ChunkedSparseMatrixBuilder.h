@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * Builds a sparse matrix whose entries are stored in chunks of fixed capacity, so adding entries never reallocates (and copies) the entries added
+ * before. The interface for adding entries one after another mirrors the one of SparseMatrixBuilder. Additionally, a range of rows whose numbers of
+ * entries are known in advance can be appended at once. The storage for these rows is then allocated exactly and the rows can be written in place
+ * (and concurrently for different rows) via RowWriter objects.
+ */
+template<typename ValueType>
+class ChunkedSparseMatrixBuilder {
+   public:
+    typedef SparseMatrixIndexType index_type;
+    typedef MatrixEntry<index_type, ValueType> Entry;
+
+    /*!
+     * Writes the entries of rows that were appended via appendRows in place. The interface mirrors the one of SparseMatrixBuilder, i.e., the rows
+     * need to be given in ascending order. Within a row, entries may be given in any order (and entries with the same column are added up), but each
+     * row needs to obtain exactly the number of distinct columns that was given when appending it.
+     */
+    class RowWriter {
+       public:
+        explicit RowWriter(ChunkedSparseMatrixBuilder<ValueType>& builder);
+
+        void addNextValue(index_type row, index_type column, ValueType const& value);
+
+        /*!
+         * Does nothing as the row groups were already given when appending the rows.
+         */
+        void newRowGroup(index_type startingRow);
+
+       private:
+        ChunkedSparseMatrixBuilder<ValueType>& builder;
+        Entry* rowEntries;
+        index_type currentRow;
+        index_type numberOfEntriesInRow;
+        index_type rowSize;
+    };
+
+    /*!
+     * Creates an empty builder.
+     *
+     * @param hasCustomRowGrouping A flag indicating whether the matrix has a non-trivial row grouping.
+     * @param chunkSize The number of entries of a chunk, which is allocated whenever the previous chunk is full.
+     */
+    ChunkedSparseMatrixBuilder(bool hasCustomRowGrouping, index_type chunkSize = 1ull << 16);
+
+    /*!
+     * Adds the given entry. The rows need to be given in non-decreasing order. If an entry is added out-of-order within a row, it is inserted at the
+     * correct position (and added to an entry with the same column).
+     */
+    void addNextValue(index_type row, index_type column, ValueType const& value);
+
+    /*!
+     * Starts a new row group with the given first row.
+     */
+    void newRowGroup(index_type startingRow);
+
+    /*!
+     * Appends rows whose numbers of entries are known. The entries of these rows are stored consecutively in a chunk that fits exactly (or in the
+     * remaining part of the last chunk) and need to be set via RowWriter objects before the matrix is built. Rows that have been skipped before the
+     * first appended row are treated as empty.
+     *
+     * @param firstRow The first row to append, which must be larger than all rows that have entries so far.
+     * @param rowEntryCounts The number of entries of each appended row.
+     * @param rowGroupStarts The first rows of the row groups that start within the appended rows (if the matrix has a custom row grouping).
+     */
+    void appendRows(index_type firstRow, std::vector<index_type> const& rowEntryCounts, std::vector<index_type> const& rowGroupStarts = {});
+
+    /*!
+     * Retrieves the storage of the entries of the given row. Different rows can be accessed concurrently as long as no further entries or rows are
+     * added in the meantime.
+     */
+    Entry* getRowEntries(index_type row);
+
+    /*!
+     * Retrieves the number of rows that were started so far.
+     */
+    index_type getCurrentRowCount() const;
+
+    /*!
+     * Retrieves the number of row groups that were started so far (or the number of rows if the matrix has a trivial row grouping).
+     */
+    index_type getCurrentRowGroupCount() const;
+
+    /*!
+     * Builds the matrix. If the entries are stored in a single chunk, this chunk is taken over by the matrix. Otherwise, the chunks are moved to the
+     * matrix one after another, releasing each chunk once it is moved. The parameters have the same meaning as for SparseMatrixBuilder::build.
+     */
+    SparseMatrix<ValueType> build(index_type overriddenRowCount = 0, index_type overriddenColumnCount = 0, index_type overriddenRowGroupCount = 0);
+
+   private:
+    struct Chunk {
+        // The index (within the whole matrix) of the first entry of this chunk.
+        index_type firstEntry;
+        // The number of entries of the chunk that are in use.
+        index_type numberOfUsedEntries;
+        std::vector<Entry> entries;
+    };
+
+    /*!
+     * Makes sure there is room for one more entry in the current (last) row. If the last chunk is full, the entries of the current row are moved to
+     * a new chunk, so the entries of every row are stored consecutively.
+     */
+    void makeRoomForEntry();
+
+    /*!
+     * Retrieves the number of entries that are reserved for the given (started) row.
+     */
+    index_type getRowSize(index_type row) const;
+
+    bool hasCustomRowGrouping;
+    index_type chunkSize;
+    std::vector<Chunk> chunks;
+
+    // The index of the first entry of each row that was started so far.
+    std::vector<index_type> rowIndications;
+    std::vector<index_type> rowGroupIndices;
+    index_type numberOfEntries;
+    index_type lastColumn;
+
+    // The first row to which entries may still be added via addNextValue.
+    index_type firstOpenRow;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,270 @@
+#include "storm/storage/CompressedBitVector.h"
+
+#include <algorithm>
+#include <tuple>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace {
+
+uint64_t popcount(uint64_t word) {
+#if (defined(__GNUG__) || defined(__clang__))
+    return __builtin_popcountll(word);
+#else
+    uint64_t result = 0;
+    for (; word; ++result) {
+        word &= word - 1;
+    }
+    return result;
+#endif
+}
+
+/*!
+ * Sets the bits with indices in [begin, end) in the given words (in the layout of BitVector buckets).
+ */
+void setRange(uint64_t* words, uint64_t begin, uint64_t end) {
+    while (begin < end) {
+        uint64_t const indexInWord = begin & 63;
+        uint64_t const numberOfBits = std::min<uint64_t>(64 - indexInWord, end - begin);
+        uint64_t const mask = numberOfBits == 64 ? -1ull : ((1ull << numberOfBits) - 1) << (64 - indexInWord - numberOfBits);
+        words[begin >> 6] |= mask;
+        begin += numberOfBits;
+    }
+}
+
+}  // namespace
+
+CompressedBitVector::Chunk CompressedBitVector::Chunk::fromWords(uint64_t const* words, uint64_t numberOfWords) {
+    uint64_t numberOfSetBits = 0;
+    uint64_t numberOfRuns = 0;
+    uint64_t previousLastBit = 0;
+    for (uint64_t word = 0; word < numberOfWords; ++word) {
+        uint64_t const bits = words[word];
+        numberOfSetBits += popcount(bits);
+        // A run starts at every set bit whose predecessor is not set.
+        numberOfRuns += popcount(bits & ~((bits >> 1) | (previousLastBit << 63)));
+        previousLastBit = bits & 1ull;
+    }
+
+    Chunk result;
+    result.numberOfSetBits = numberOfSetBits;
+    uint64_t const runBytes = 4 * numberOfRuns;
+    uint64_t const arrayBytes = 2 * numberOfSetBits;
+    uint64_t const bitmapBytes = 8 * numberOfWords;
+    if (runBytes <= arrayBytes && runBytes <= bitmapBytes) {
+        result.type = ChunkType::Runs;
+        result.values.reserve(2 * numberOfRuns);
+    } else if (arrayBytes <= bitmapBytes) {
+        result.type = ChunkType::Array;
+        result.values.reserve(numberOfSetBits);
+    } else {
+        result.type = ChunkType::Bitmap;
+        result.words.assign(words, words + numberOfWords);
+        return result;
+    }
+
+    for (uint64_t word = 0; word < numberOfWords; ++word) {
+        uint64_t bits = words[word];
+        while (bits != 0) {
+            uint64_t const indexInWord = BitVector::countLeadingZeros(bits);
+            uint64_t const index = (word << 6) + indexInWord;
+            bits ^= 1ull << (63 - indexInWord);
+            if (result.type == ChunkType::Array) {
+                result.values.push_back(static_cast<uint16_t>(index));
+            } else if (!result.values.empty() && result.values[result.values.size() - 2] + result.values.back() + 1ull == index) {
+                ++result.values.back();
+            } else {
+                result.values.push_back(static_cast<uint16_t>(index));
+                result.values.push_back(0);
+            }
+        }
+    }
+    return result;
+}
+
+void CompressedBitVector::Chunk::writeTo(uint64_t* words) const {
+    if (type == ChunkType::Array) {
+        for (auto value : values) {
+            words[value >> 6] |= 1ull << (63 - (value & 63));
+        }
+    } else if (type == ChunkType::Runs) {
+        for (uint64_t run = 0; run < values.size(); run += 2) {
+            setRange(words, values[run], values[run] + values[run + 1] + 1ull);
+        }
+    } else {
+        std::copy(this->words.begin(), this->words.end(), words);
+    }
+}
+
+bool CompressedBitVector::Chunk::get(uint64_t indexInChunk) const {
+    if (type == ChunkType::Array) {
+        return std::binary_search(values.begin(), values.end(), indexInChunk);
+    } else if (type == ChunkType::Runs) {
+        // Find the last run that starts at or before the index.
+        uint64_t lower = 0, upper = values.size() / 2;
+        while (lower < upper) {
+            uint64_t const middle = (lower + upper) / 2;
+            if (values[2 * middle] <= indexInChunk) {
+                lower = middle + 1;
+            } else {
+                upper = middle;
+            }
+        }
+        return lower > 0 && indexInChunk <= values[2 * (lower - 1)] + static_cast<uint64_t>(values[2 * (lower - 1) + 1]);
+    } else {
+        return (words[indexInChunk >> 6] >> (63 - (indexInChunk & 63))) & 1ull;
+    }
+}
+
+bool CompressedBitVector::Chunk::operator==(Chunk const& other) const {
+    return type == other.type && values == other.values && words == other.words;
+}
+
+bool CompressedBitVector::Chunk::operator<(Chunk const& other) const {
+    return std::tie(type, values, words) < std::tie(other.type, other.values, other.words);
+}
+
+CompressedBitVector::CompressedBitVector() : bitCount(0) {
+    // Intentionally left empty.
+}
+
+CompressedBitVector::CompressedBitVector(uint64_t length, bool init) : bitCount(length) {
+    uint64_t const numberOfChunks = (length + (1ull << chunkBits) - 1) >> chunkBits;
+    chunks.resize(numberOfChunks);
+    if (init) {
+        for (uint64_t chunkIndex = 0; chunkIndex < numberOfChunks; ++chunkIndex) {
+            uint64_t const chunkLength = std::min<uint64_t>(length - (chunkIndex << chunkBits), 1ull << chunkBits);
+            chunks[chunkIndex].numberOfSetBits = chunkLength;
+            chunks[chunkIndex].values = {0, static_cast<uint16_t>(chunkLength - 1)};
+        }
+    }
+}
+
+CompressedBitVector::CompressedBitVector(BitVector const& bitVector) : bitCount(bitVector.size()) {
+    uint64_t const numberOfChunks = (bitCount + (1ull << chunkBits) - 1) >> chunkBits;
+    chunks.reserve(numberOfChunks);
+    for (uint64_t chunkIndex = 0; chunkIndex < numberOfChunks; ++chunkIndex) {
+        chunks.push_back(Chunk::fromWords(bitVector.buckets + chunkIndex * wordsPerChunk, getNumberOfWordsInChunk(chunkIndex)));
+    }
+}
+
+BitVector CompressedBitVector::toBitVector() const {
+    BitVector result(bitCount);
+    for (uint64_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+        chunks[chunkIndex].writeTo(result.buckets + chunkIndex * wordsPerChunk);
+    }
+    return result;
+}
+
+bool CompressedBitVector::operator==(CompressedBitVector const& other) const {
+    return bitCount == other.bitCount && chunks == other.chunks;
+}
+
+bool CompressedBitVector::operator!=(CompressedBitVector const& other) const {
+    return !(*this == other);
+}
+
+bool CompressedBitVector::operator<(CompressedBitVector const& other) const {
+    return std::tie(bitCount, chunks) < std::tie(other.bitCount, other.chunks);
+}
+
+uint64_t CompressedBitVector::getNumberOfWordsInChunk(uint64_t chunkIndex) const {
+    return std::min<uint64_t>(wordsPerChunk, (bitCount - (chunkIndex << chunkBits) + 63) / 64);
+}
+
+template<typename Operation>
+CompressedBitVector CompressedBitVector::combine(CompressedBitVector const& other, Operation const& operation) const {
+    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    CompressedBitVector result;
+    result.bitCount = bitCount;
+    result.chunks.reserve(chunks.size());
+    std::vector<uint64_t> first(wordsPerChunk), second(wordsPerChunk);
+    for (uint64_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+        uint64_t const numberOfWords = getNumberOfWordsInChunk(chunkIndex);
+        std::fill_n(first.begin(), numberOfWords, 0ull);
+        std::fill_n(second.begin(), numberOfWords, 0ull);
+        chunks[chunkIndex].writeTo(first.data());
+        other.chunks[chunkIndex].writeTo(second.data());
+        for (uint64_t word = 0; word < numberOfWords; ++word) {
+            first[word] = operation(first[word], second[word]);
+        }
+        if (chunkIndex + 1 == chunks.size() && (bitCount & 63) != 0) {
+            // Clear the bits beyond the size of the bit vector.
+            first[numberOfWords - 1] &= ~(-1ull >> (bitCount & 63));
+        }
+        result.chunks.push_back(Chunk::fromWords(first.data(), numberOfWords));
+    }
+    return result;
+}
+
+CompressedBitVector CompressedBitVector::operator&(CompressedBitVector const& other) const {
+    return combine(other, [](uint64_t a, uint64_t b) { return a & b; });
+}
+
+CompressedBitVector CompressedBitVector::operator|(CompressedBitVector const& other) const {
+    return combine(other, [](uint64_t a, uint64_t b) { return a | b; });
+}
+
+CompressedBitVector CompressedBitVector::operator~() const {
+    return combine(*this, [](uint64_t a, uint64_t) { return ~a; });
+}
+
+uint64_t CompressedBitVector::size() const {
+    return bitCount;
+}
+
+bool CompressedBitVector::get(uint64_t index) const {
+    STORM_LOG_ASSERT(index < bitCount, "Invalid call to CompressedBitVector::get: written index " << index << " out of bounds.");
+    return chunks[index >> chunkBits].get(index & ((1ull << chunkBits) - 1));
+}
+
+void CompressedBitVector::set(uint64_t index, bool value) {
+    STORM_LOG_ASSERT(index < bitCount, "Invalid call to CompressedBitVector::set: written index " << index << " out of bounds.");
+    uint64_t const chunkIndex = index >> chunkBits;
+    uint64_t const indexInChunk = index & ((1ull << chunkBits) - 1);
+    if (chunks[chunkIndex].get(indexInChunk) == value) {
+        return;
+    }
+    uint64_t const numberOfWords = getNumberOfWordsInChunk(chunkIndex);
+    std::vector<uint64_t> words(numberOfWords, 0ull);
+    chunks[chunkIndex].writeTo(words.data());
+    words[indexInChunk >> 6] ^= 1ull << (63 - (indexInChunk & 63));
+    chunks[chunkIndex] = Chunk::fromWords(words.data(), numberOfWords);
+}
+
+uint64_t CompressedBitVector::getNumberOfSetBits() const {
+    uint64_t result = 0;
+    for (auto const& chunk : chunks) {
+        result += chunk.numberOfSetBits;
+    }
+    return result;
+}
+
+bool CompressedBitVector::empty() const {
+    return std::all_of(chunks.begin(), chunks.end(), [](Chunk const& chunk) { return chunk.numberOfSetBits == 0; });
+}
+
+bool CompressedBitVector::full() const {
+    return getNumberOfSetBits() == bitCount;
+}
+
+std::size_t CompressedBitVector::getSizeInBytes() const {
+    std::size_t result = sizeof(*this) + chunks.capacity() * sizeof(Chunk);
+    for (auto const& chunk : chunks) {
+        result += chunk.values.capacity() * sizeof(uint16_t) + chunk.words.capacity() * sizeof(uint64_t);
+    }
+    return result;
+}
+
+std::ostream& operator<<(std::ostream& out, CompressedBitVector const& bitVector) {
+    out << "compressed bit vector(" << bitVector.getNumberOfSetBits() << "/" << bitVector.bitCount << ") [";
+    bitVector.forEachSetBit([&out](uint64_t index) { out << index << " "; });
+    out << "]";
+    return out;
+}
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A compressed representation of a bit vector for large sets that are (mostly) very sparse, very dense or consist of few long runs of set bits.
+ * The bits are split into chunks of 2^16 bits. Each chunk is stored as a sorted array of the set bits, as a list of runs of set bits or as a plain
+ * bitmap, whichever takes the least memory (similar to roaring bitmaps). An empty or a full chunk thus takes only a few bytes.
+ *
+ * The representation of a set is unique, i.e., two compressed bit vectors are equal iff their chunks are stored in the same way. Modifying a single
+ * bit re-encodes the affected chunk. Bit vectors that are modified frequently should thus be dense BitVectors that are compressed once they are final.
+ */
+class CompressedBitVector {
+   public:
+    /*!
+     * Creates an empty compressed bit vector of size zero.
+     */
+    CompressedBitVector();
+
+    /*!
+     * Creates a compressed bit vector of the given size in which all bits have the given value.
+     */
+    explicit CompressedBitVector(uint64_t length, bool init = false);
+
+    /*!
+     * Creates a compressed bit vector that holds the same bits as the given bit vector.
+     */
+    explicit CompressedBitVector(BitVector const& bitVector);
+
+    /*!
+     * Retrieves a (dense) bit vector that holds the same bits.
+     */
+    BitVector toBitVector() const;
+
+    bool operator==(CompressedBitVector const& other) const;
+    bool operator!=(CompressedBitVector const& other) const;
+
+    /*!
+     * Compares the compressed bit vectors in an arbitrary (but strict and total) order, e.g., to use them as keys of a map.
+     */
+    bool operator<(CompressedBitVector const& other) const;
+
+    CompressedBitVector operator&(CompressedBitVector const& other) const;
+    CompressedBitVector operator|(CompressedBitVector const& other) const;
+    CompressedBitVector operator~() const;
+
+    /*!
+     * Retrieves the number of bits this bit vector can store.
+     */
+    uint64_t size() const;
+
+    bool get(uint64_t index) const;
+
+    /*!
+     * Sets the given bit to the given value. This re-encodes the chunk of the bit.
+     */
+    void set(uint64_t index, bool value = true);
+
+    uint64_t getNumberOfSetBits() const;
+
+    /*!
+     * Retrieves whether no bit is set.
+     */
+    bool empty() const;
+
+    /*!
+     * Retrieves whether all bits are set.
+     */
+    bool full() const;
+
+    /*!
+     * Calls the given function with the index of each set bit in ascending order.
+     */
+    template<typename Function>
+    void forEachSetBit(Function&& function) const {
+        for (uint64_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+            Chunk const& chunk = chunks[chunkIndex];
+            uint64_t const offset = chunkIndex << chunkBits;
+            if (chunk.type == ChunkType::Array) {
+                for (auto value : chunk.values) {
+                    function(offset + value);
+                }
+            } else if (chunk.type == ChunkType::Runs) {
+                for (uint64_t run = 0; run < chunk.values.size(); run += 2) {
+                    for (uint64_t index = offset + chunk.values[run], end = index + chunk.values[run + 1] + 1; index < end; ++index) {
+                        function(index);
+                    }
+                }
+            } else {
+                for (uint64_t word = 0; word < chunk.words.size(); ++word) {
+                    uint64_t bits = chunk.words[word];
+                    while (bits != 0) {
+                        uint64_t const indexInWord = BitVector::countLeadingZeros(bits);
+                        function(offset + (word << 6) + indexInWord);
+                        bits ^= 1ull << (63 - indexInWord);
+                    }
+                }
+            }
+        }
+    }
+
+    /*!
+     * Retrieves the number of bytes this bit vector occupies in memory.
+     */
+    std::size_t getSizeInBytes() const;
+
+    friend std::ostream& operator<<(std::ostream& out, CompressedBitVector const& bitVector);
+
+   private:
+    // Each chunk holds 2^chunkBits bits.
+    static constexpr uint64_t chunkBits = 16;
+    static constexpr uint64_t wordsPerChunk = (1ull << chunkBits) / 64;
+
+    enum class ChunkType : uint8_t { Runs, Array, Bitmap };
+
+    struct Chunk {
+        /*!
+         * Encodes the given bits (in the layout of BitVector buckets) in the smallest possible way.
+         */
+        static Chunk fromWords(uint64_t const* words, uint64_t numberOfWords);
+
+        /*!
+         * Sets the bits of this chunk in the given (zero-initialized) words.
+         */
+        void writeTo(uint64_t* words) const;
+
+        bool get(uint64_t indexInChunk) const;
+
+        bool operator==(Chunk const& other) const;
+        bool operator<(Chunk const& other) const;
+
+        ChunkType type = ChunkType::Runs;
+        uint32_t numberOfSetBits = 0;
+        // For arrays, the indices of the set bits. For runs, the start index and the length minus one of each run.
+        std::vector<uint16_t> values;
+        // For bitmaps, the bits in the same layout as the buckets of a BitVector.
+        std::vector<uint64_t> words;
+    };
+
+    uint64_t getNumberOfWordsInChunk(uint64_t chunkIndex) const;
+
+    /*!
+     * Applies the given operation to the words of each pair of chunks of this and the other bit vector.
+     */
+    template<typename Operation>
+    CompressedBitVector combine(CompressedBitVector const& other, Operation const& operation) const;
+
+    uint64_t bitCount;
+    std::vector<Chunk> chunks;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,120 @@
+#include "storm/storage/CompressedVector.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+std::optional<CompressedVector<ValueType>> CompressedVector<ValueType>::compress(std::vector<ValueType> const& vector) {
+    if (vector.empty()) {
+        return CompressedVector<ValueType>(0, storm::utility::zero<ValueType>());
+    }
+    // Storing an entry explicitly takes an index in addition to the value, so at most a quarter of the entries may differ from the default value.
+    uint64_t const maximalNumberOfExplicitEntries = vector.size() / 4;
+    ValueType const zero = storm::utility::zero<ValueType>();
+    uint64_t numberOfZeros = std::count(vector.begin(), vector.end(), zero);
+    ValueType defaultValue = zero;
+    if (vector.size() - numberOfZeros > maximalNumberOfExplicitEntries) {
+        defaultValue = vector.front();
+        if (vector.size() - static_cast<uint64_t>(std::count(vector.begin(), vector.end(), defaultValue)) > maximalNumberOfExplicitEntries) {
+            return std::nullopt;
+        }
+    }
+
+    std::vector<uint64_t> indices;
+    std::vector<ValueType> values;
+    for (uint64_t index = 0; index < vector.size(); ++index) {
+        if (!(vector[index] == defaultValue)) {
+            indices.push_back(index);
+            values.push_back(vector[index]);
+        }
+    }
+    return CompressedVector<ValueType>(vector.size(), defaultValue, std::move(indices), std::move(values));
+}
+
+template<typename ValueType>
+CompressedVector<ValueType>::CompressedVector(uint64_t size, ValueType const& defaultValue, std::vector<uint64_t>&& indices, std::vector<ValueType>&& values)
+    : numberOfEntries(size), defaultValue(defaultValue), indices(std::move(indices)), values(std::move(values)) {
+    STORM_LOG_ASSERT(this->indices.size() == this->values.size(), "Expected one value per index.");
+    STORM_LOG_ASSERT(std::is_sorted(this->indices.begin(), this->indices.end()), "Expected sorted indices.");
+    STORM_LOG_ASSERT(this->indices.empty() || this->indices.back() < size, "Index out of range.");
+}
+
+template<typename ValueType>
+uint64_t CompressedVector<ValueType>::size() const {
+    return numberOfEntries;
+}
+
+template<typename ValueType>
+ValueType const& CompressedVector<ValueType>::operator[](uint64_t index) const {
+    STORM_LOG_ASSERT(index < numberOfEntries, "Index out of range.");
+    auto it = std::lower_bound(indices.begin(), indices.end(), index);
+    if (it != indices.end() && *it == index) {
+        return values[std::distance(indices.begin(), it)];
+    }
+    return defaultValue;
+}
+
+template<typename ValueType>
+ValueType const& CompressedVector<ValueType>::getDefaultValue() const {
+    return defaultValue;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> const& CompressedVector<ValueType>::getIndices() const {
+    return indices;
+}
+
+template<typename ValueType>
+std::vector<ValueType> const& CompressedVector<ValueType>::getValues() const {
+    return values;
+}
+
+template<typename ValueType>
+std::vector<ValueType> CompressedVector<ValueType>::toVector() const {
+    std::vector<ValueType> result(numberOfEntries, defaultValue);
+    for (uint64_t position = 0; position < indices.size(); ++position) {
+        result[indices[position]] = values[position];
+    }
+    return result;
+}
+
+template<typename ValueType>
+void CompressedVector<ValueType>::addTo(std::vector<ValueType>& target) const {
+    STORM_LOG_ASSERT(target.size() == numberOfEntries, "Vector sizes do not match.");
+    if (storm::utility::isZero(defaultValue)) {
+        for (uint64_t position = 0; position < indices.size(); ++position) {
+            target[indices[position]] += values[position];
+        }
+    } else {
+        auto indexIt = indices.begin();
+        for (uint64_t index = 0; index < numberOfEntries; ++index) {
+            if (indexIt != indices.end() && *indexIt == index) {
+                target[index] += values[std::distance(indices.begin(), indexIt)];
+                ++indexIt;
+            } else {
+                target[index] += defaultValue;
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+bool CompressedVector<ValueType>::operator==(CompressedVector<ValueType> const& other) const {
+    return numberOfEntries == other.numberOfEntries && defaultValue == other.defaultValue && indices == other.indices && values == other.values;
+}
+
+template class CompressedVector<double>;
+#ifdef STORM_HAVE_CARL
+template class CompressedVector<storm::RationalNumber>;
+template class CompressedVector<storm::RationalFunction>;
+template class CompressedVector<storm::Interval>;
+#endif
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A vector of fixed size in which all entries have the same (default) value except for a few ones. Only the default value and the other entries
+ * (sorted by their index) are stored. This is suited for reward vectors that are constant or sparse.
+ */
+template<typename ValueType>
+class CompressedVector {
+   public:
+    /*!
+     * Compresses the given vector if this saves at least half of the memory. The default value is either zero or the first entry of the vector,
+     * whichever occurs more often.
+     *
+     * @return The compressed vector if the given one is suited for compression.
+     */
+    static std::optional<CompressedVector<ValueType>> compress(std::vector<ValueType> const& vector);
+
+    /*!
+     * Creates a vector of the given size with the given default value and the given other entries.
+     *
+     * @param indices The (strictly increasing) indices of the entries that differ from the default value.
+     * @param values The values of these entries.
+     */
+    CompressedVector(uint64_t size, ValueType const& defaultValue, std::vector<uint64_t>&& indices = {}, std::vector<ValueType>&& values = {});
+
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the entry at the given index (which takes logarithmic time in the number of entries that differ from the default value).
+     */
+    ValueType const& operator[](uint64_t index) const;
+
+    ValueType const& getDefaultValue() const;
+
+    /*!
+     * Retrieves the (sorted) indices of the entries that differ from the default value.
+     */
+    std::vector<uint64_t> const& getIndices() const;
+
+    /*!
+     * Retrieves the values of the entries that differ from the default value in the order of their indices.
+     */
+    std::vector<ValueType> const& getValues() const;
+
+    /*!
+     * Retrieves the vector with all entries.
+     */
+    std::vector<ValueType> toVector() const;
+
+    /*!
+     * Adds all entries of this vector to the entries of the given vector (of the same size).
+     */
+    void addTo(std::vector<ValueType>& target) const;
+
+    bool operator==(CompressedVector<ValueType> const& other) const;
+
+   private:
+    uint64_t numberOfEntries;
+    ValueType defaultValue;
+    std::vector<uint64_t> indices;
+    std::vector<ValueType> values;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,280 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace detail {
+// The number of bits of a bucket identifier that encode the bucket within its segment.
+static const uint64_t localBucketBits = 40;
+}  // namespace detail
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::Segment::Segment(uint64_t bucketSize, uint64_t logCapacity)
+    : logCapacity(logCapacity),
+      buckets(bucketSize * (1ull << logCapacity)),
+      status(new std::atomic<uint8_t>[1ull << logCapacity]),
+      values(1ull << logCapacity),
+      numberOfElements(0) {
+    for (uint64_t bucket = 0; bucket < (1ull << logCapacity); ++bucket) {
+        status[bucket].store(BucketStatus::Empty, std::memory_order_relaxed);
+    }
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor,
+                                                                        uint64_t numberOfSegments)
+    : loadFactor(loadFactor), bucketSize(bucketSize), logNumberOfSegments(0) {
+    STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+    STORM_LOG_ASSERT(loadFactor > 0.0 && loadFactor < 1.0, "Illegal load factor " << loadFactor << ".");
+    while ((1ull << logNumberOfSegments) < numberOfSegments) {
+        ++logNumberOfSegments;
+    }
+
+    // Distribute the initial size among the segments.
+    uint64_t initialSegmentSize = initialSize >> logNumberOfSegments;
+    uint64_t logSegmentCapacity = 1;
+    while (initialSegmentSize > 0) {
+        ++logSegmentCapacity;
+        initialSegmentSize >>= 1;
+    }
+
+    segments.reserve(1ull << logNumberOfSegments);
+    for (uint64_t segment = 0; segment < (1ull << logNumberOfSegments); ++segment) {
+        segments.push_back(std::make_unique<Segment>(bucketSize, logSegmentCapacity));
+    }
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getSegmentIndex(uint64_t hash) const {
+    return hash & ((1ull << logNumberOfSegments) - 1);
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getInitialBucket(Segment const& segment, uint64_t hash) const {
+    // The lower bits of the hash value determine the segment, so we use the upper ones to determine the bucket.
+    uint64_t const hashBits = sizeof(decltype(hasher(storm::storage::BitVector()))) * 8;
+    if (segment.logCapacity >= hashBits) {
+        return hash;
+    }
+    return hash >> (hashBits - segment.logCapacity);
+}
+
+template<class ValueType, class Hash>
+std::optional<uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findInSegment(Segment const& segment, uint64_t hash,
+                                                                                   storm::storage::BitVector const& key) const {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    uint64_t const capacity = 1ull << segment.logCapacity;
+    uint64_t bucket = getInitialBucket(segment, hash);
+    for (uint64_t probes = 0; probes < capacity; ++probes) {
+        uint8_t status = segment.status[bucket].load(std::memory_order_acquire);
+        if (status == BucketStatus::Empty) {
+            return std::nullopt;
+        }
+        while (status == BucketStatus::Claimed) {
+            // Another thread is currently writing the key of this bucket.
+            std::this_thread::yield();
+            status = segment.status[bucket].load(std::memory_order_acquire);
+        }
+        if (segment.buckets.matches(bucket * bucketSize, key)) {
+            return bucket;
+        }
+        bucket = (bucket + 1) & (capacity - 1);
+    }
+    return std::nullopt;
+}
+
+template<class ValueType, class Hash>
+std::tuple<std::optional<uint64_t>, ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrInsertInSegment(
+    Segment& segment, uint64_t hash, storm::storage::BitVector const& key, std::function<ValueType()> const* valueGenerator) const {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    uint64_t const capacity = 1ull << segment.logCapacity;
+    uint64_t bucket = getInitialBucket(segment, hash);
+    for (uint64_t probes = 0; probes < capacity; ++probes) {
+        uint8_t status = segment.status[bucket].load(std::memory_order_acquire);
+        if (status == BucketStatus::Empty) {
+            if (valueGenerator == nullptr) {
+                return {std::nullopt, ValueType(), false};
+            }
+            // Try to claim the bucket. If this fails, another thread claimed it in the meantime and we need to check its key.
+            if (segment.status[bucket].compare_exchange_strong(status, BucketStatus::Claimed, std::memory_order_acq_rel)) {
+                segment.numberOfElements.fetch_add(1, std::memory_order_relaxed);
+                segment.buckets.set(bucket * bucketSize, key);
+                ValueType value = (*valueGenerator)();
+                segment.values[bucket] = value;
+                segment.status[bucket].store(BucketStatus::Occupied, std::memory_order_release);
+                return {bucket, value, true};
+            }
+        }
+        while (status == BucketStatus::Claimed) {
+            // Another thread is currently writing the key of this bucket.
+            std::this_thread::yield();
+            status = segment.status[bucket].load(std::memory_order_acquire);
+        }
+        if (segment.buckets.matches(bucket * bucketSize, key)) {
+            return {bucket, segment.values[bucket], false};
+        }
+        bucket = (bucket + 1) & (capacity - 1);
+    }
+    // The segment is completely filled.
+    return {std::nullopt, ValueType(), false};
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::insertWithoutCheck(Segment& segment, storm::storage::BitVector const& key, ValueType const& value) const {
+    uint64_t const capacity = 1ull << segment.logCapacity;
+    uint64_t bucket = getInitialBucket(segment, hasher(key));
+    while (segment.status[bucket].load(std::memory_order_relaxed) != BucketStatus::Empty) {
+        bucket = (bucket + 1) & (capacity - 1);
+    }
+    segment.buckets.set(bucket * bucketSize, key);
+    segment.values[bucket] = value;
+    segment.status[bucket].store(BucketStatus::Occupied, std::memory_order_relaxed);
+    segment.numberOfElements.fetch_add(1, std::memory_order_relaxed);
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::increaseSizeIfNecessary(Segment& segment) {
+    std::unique_lock<std::shared_mutex> lock(segment.resizeMutex);
+    uint64_t const oldCapacity = 1ull << segment.logCapacity;
+    uint64_t const numberOfElements = segment.numberOfElements.load(std::memory_order_relaxed);
+    // Another thread might have resized the segment already.
+    if (numberOfElements < loadFactor * oldCapacity) {
+        return;
+    }
+    STORM_LOG_TRACE("Increasing size of hash map segment from " << oldCapacity << " to " << 2 * oldCapacity << ".");
+
+    // As we hold the lock exclusively, all buckets are either empty or occupied.
+    Segment newSegment(bucketSize, segment.logCapacity + 1);
+    for (uint64_t bucket = 0; bucket < oldCapacity; ++bucket) {
+        if (segment.status[bucket].load(std::memory_order_relaxed) == BucketStatus::Occupied) {
+            insertWithoutCheck(newSegment, segment.buckets.get(bucket * bucketSize, bucketSize), segment.values[bucket]);
+        }
+    }
+    STORM_LOG_ASSERT(newSegment.numberOfElements.load() == numberOfElements, "Size mismatch in rehashing.");
+
+    segment.logCapacity = newSegment.logCapacity;
+    segment.buckets = std::move(newSegment.buckets);
+    segment.status = std::move(newSegment.status);
+    segment.values = std::move(newSegment.values);
+}
+
+template<class ValueType, class Hash>
+std::tuple<uint64_t, ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddImpl(storm::storage::BitVector const& key,
+                                                                                                 std::function<ValueType()> const& valueGenerator) {
+    uint64_t const hash = hasher(key);
+    uint64_t const segmentIndex = getSegmentIndex(hash);
+    Segment& segment = *segments[segmentIndex];
+    while (true) {
+        {
+            std::shared_lock<std::shared_mutex> lock(segment.resizeMutex);
+            bool const mayInsert = segment.numberOfElements.load(std::memory_order_relaxed) < loadFactor * (1ull << segment.logCapacity);
+            auto [bucket, value, inserted] = findOrInsertInSegment(segment, hash, key, mayInsert ? &valueGenerator : nullptr);
+            if (bucket) {
+                return {(segmentIndex << detail::localBucketBits) | bucket.value(), value, inserted};
+            }
+        }
+        // The key is not contained and the segment is too full to insert it.
+        increaseSizeIfNecessary(segment);
+    }
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    return std::get<1>(findOrAddImpl(key, [&value]() { return value; }));
+}
+
+template<class ValueType, class Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddWithGenerator(storm::storage::BitVector const& key,
+                                                                                              std::function<ValueType()> const& valueGenerator) {
+    auto [bucket, value, inserted] = findOrAddImpl(key, valueGenerator);
+    return std::make_pair(value, inserted);
+}
+
+template<class ValueType, class Hash>
+std::pair<ValueType, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key,
+                                                                                                 ValueType const& value) {
+    auto [bucket, foundValue, inserted] = findOrAddImpl(key, [&value]() { return value; });
+    return std::make_pair(foundValue, bucket);
+}
+
+template<class ValueType, class Hash>
+std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
+    Segment const& segment = *segments[bucket >> detail::localBucketBits];
+    std::shared_lock<std::shared_mutex> lock(segment.resizeMutex);
+    uint64_t const localBucket = bucket & ((1ull << detail::localBucketBits) - 1);
+    return std::make_pair(segment.buckets.get(localBucket * bucketSize, bucketSize), segment.values[localBucket]);
+}
+
+template<class ValueType, class Hash>
+std::optional<ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+    uint64_t const hash = hasher(key);
+    Segment const& segment = *segments[getSegmentIndex(hash)];
+    std::shared_lock<std::shared_mutex> lock(segment.resizeMutex);
+    if (auto bucket = findInSegment(segment, hash, key)) {
+        return segment.values[bucket.value()];
+    }
+    return std::nullopt;
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+    auto value = find(key);
+    STORM_LOG_ASSERT(value.has_value(), "Unknown key.");
+    return value.value();
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+    return find(key).has_value();
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::forEach(std::function<void(storm::storage::BitVector const&, ValueType const&)> const& function) const {
+    for (auto const& segment : segments) {
+        for (uint64_t bucket = 0; bucket < (1ull << segment->logCapacity); ++bucket) {
+            if (segment->status[bucket].load(std::memory_order_relaxed) == BucketStatus::Occupied) {
+                function(segment->buckets.get(bucket * bucketSize, bucketSize), segment->values[bucket]);
+            }
+        }
+    }
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+    uint64_t result = 0;
+    for (auto const& segment : segments) {
+        result += segment->numberOfElements.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+    uint64_t result = 0;
+    for (auto const& segment : segments) {
+        result += 1ull << segment->logCapacity;
+    }
+    return result;
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+    for (auto& segment : segments) {
+        for (uint64_t bucket = 0; bucket < (1ull << segment->logCapacity); ++bucket) {
+            if (segment->status[bucket].load(std::memory_order_relaxed) == BucketStatus::Occupied) {
+                segment->values[bucket] = remapping(segment->values[bucket]);
+            }
+        }
+    }
+}
+
+template class ConcurrentBitVectorHashMap<uint64_t>;
+template class ConcurrentBitVectorHashMap<uint32_t>;
+}  // namespace storage
+}  // namespace storm
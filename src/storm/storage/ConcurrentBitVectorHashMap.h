@@ -0,0 +1,214 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <tuple>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * This class represents a hash-map whose keys are bit vectors that can be queried and extended by several threads at the same time. Its interface
+ * mirrors the one of BitVectorHashMap. As for BitVectorHashMap, the keys must be bit vectors with a length that is a multiple of 64.
+ *
+ * The map is split into a (fixed) number of segments, where the segment of a key is determined by its hash value. Every segment is an open
+ * addressing table in which inserting threads claim buckets via compare-and-swap operations, i.e., insertions into the same segment do not block
+ * each other. Only when a segment exceeds its load factor, this segment (and only this one) is rehashed while inserting threads of the segment wait.
+ * Hence, the map grows incrementally, one segment at a time.
+ */
+template<typename ValueType, typename Hash = DefaultBitVectorHash<ValueType>>
+class ConcurrentBitVectorHashMap {
+   public:
+    /*!
+     * Creates a new hash map with the given bucket size and initial size.
+     *
+     * @param bucketSize The size of the buckets that this map can hold. This value must be a multiple of 64.
+     * @param initialSize The number of buckets that is initially available (over all segments).
+     * @param loadFactor The load factor that determines at which point the size of a segment is increased.
+     * @param numberOfSegments The number of segments. This value is rounded up to the next power of two.
+     */
+    ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75, uint64_t numberOfSegments = 64);
+
+    ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+    ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+    ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap&&) = default;
+    ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap&&) = default;
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value. This method may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return The found value if the key is already contained in the map and the provided new value otherwise.
+     */
+    ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the key is inserted with the value
+     * obtained from the given generator. The generator is invoked at most once and only if this call inserts the key. This allows to, e.g.,
+     * hand out consecutive ids from a shared counter without gaps. This method may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param valueGenerator The function that yields the value of a newly inserted key.
+     * @return A pair whose first component is the value mapped to the key and whose second component indicates whether the key was inserted.
+     */
+    std::pair<ValueType, bool> findOrAddWithGenerator(storm::storage::BitVector const& key, std::function<ValueType()> const& valueGenerator);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value. This method may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return A pair whose first component is the found value if the key is already contained in the map and
+     * the provided new value otherwise and whose second component is the identifier of the bucket into which the key
+     * was inserted. Note that bucket identifiers are invalidated whenever the segment of the bucket is resized.
+     */
+    std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Retrieves the key stored in the given bucket (if any) and the value it is mapped to.
+     *
+     * @param bucket The identifier of the bucket.
+     * @return The content and value of the named bucket.
+     */
+    std::pair<storm::storage::BitVector, ValueType> getBucketAndValue(uint64_t bucket) const;
+
+    /*!
+     * Retrieves the value associated with the given key if the key is contained in the map. This method may be called concurrently.
+     *
+     * @param key The key to search.
+     * @return The associated value if the key is contained in the map and nothing otherwise.
+     */
+    std::optional<ValueType> find(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the value associated with the given key (if any). If the key does not exist, the behaviour is
+     * undefined.
+     *
+     * @return The value associated with the given key (if any).
+     */
+    ValueType getValue(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Checks if the given key is already contained in the map.
+     *
+     * @param key The key to search
+     * @return True if the key is already contained in the map
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Calls the given function for every key-value pair in the map. This must not be called while other threads modify the map.
+     */
+    void forEach(std::function<void(storm::storage::BitVector const&, ValueType const&)> const& function) const;
+
+    /*!
+     * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+     *
+     * @return The size of the map.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the capacity of the underlying containers (over all segments).
+     *
+     * @return The capacity of the underlying containers.
+     */
+    uint64_t capacity() const;
+
+    /*!
+     * Performs a remapping of all values stored by applying the given remapping. This must not be called while other threads access the map.
+     *
+     * @param remapping The remapping to apply.
+     */
+    void remap(std::function<ValueType(ValueType const&)> const& remapping);
+
+   private:
+    /// The possible states of a bucket.
+    enum BucketStatus : uint8_t { Empty = 0, Claimed = 1, Occupied = 2 };
+
+    /*!
+     * A part of the map that is rehashed independently of the others.
+     */
+    struct Segment {
+        Segment(uint64_t bucketSize, uint64_t logCapacity);
+
+        // The number of buckets is 2^logCapacity.
+        uint64_t logCapacity;
+
+        // The buckets that hold the keys of this segment. The key in a bucket may only be read once its status is Occupied.
+        storm::storage::BitVector buckets;
+
+        // The status of each bucket.
+        std::unique_ptr<std::atomic<uint8_t>[]> status;
+
+        // The mapped-to values. The entry at position i is the "target" of the key in bucket i.
+        std::vector<ValueType> values;
+
+        // The number of buckets that are claimed or occupied.
+        std::atomic<uint64_t> numberOfElements;
+
+        // The lock that is held exclusively while the segment is resized and shared otherwise.
+        mutable std::shared_mutex resizeMutex;
+    };
+
+    /*!
+     * Searches the given key in the given segment or, if it is not found and a generator is given, inserts it. Assumes that the caller holds
+     * the (shared) lock of the segment.
+     *
+     * @return If the key was found or inserted: the bucket, the mapped-to value and whether it was inserted by this call. Otherwise, the first
+     * component is none.
+     */
+    std::tuple<std::optional<uint64_t>, ValueType, bool> findOrInsertInSegment(Segment& segment, uint64_t hash, storm::storage::BitVector const& key,
+                                                                                 std::function<ValueType()> const* valueGenerator) const;
+
+    /*!
+     * Searches the given key in the given segment without inserting it. Assumes that the caller holds the (shared) lock of the segment.
+     */
+    std::optional<uint64_t> findInSegment(Segment const& segment, uint64_t hash, storm::storage::BitVector const& key) const;
+
+    /*!
+     * Inserts the given key-value pair into the given segment, which must not contain the key. This is not thread-safe.
+     */
+    void insertWithoutCheck(Segment& segment, storm::storage::BitVector const& key, ValueType const& value) const;
+
+    /*!
+     * Doubles the capacity of the given segment if its load exceeds the load factor.
+     */
+    void increaseSizeIfNecessary(Segment& segment);
+
+    /*!
+     * Performs the actual lookup and insertion of the key.
+     */
+    std::tuple<uint64_t, ValueType, bool> findOrAddImpl(storm::storage::BitVector const& key, std::function<ValueType()> const& valueGenerator);
+
+    uint64_t getSegmentIndex(uint64_t hash) const;
+    uint64_t getInitialBucket(Segment const& segment, uint64_t hash) const;
+
+    // The load factor determining when the size of a segment is increased.
+    double loadFactor;
+
+    // The size of one bucket.
+    uint64_t bucketSize;
+
+    // The number of bits of the hash value that determine the segment.
+    uint64_t logNumberOfSegments;
+
+    // The segments of the map.
+    std::vector<std::unique_ptr<Segment>> segments;
+
+    // Functor object that are used to perform the actual hashing.
+    Hash hasher;
+};
+
+}  // namespace storage
+}  // namespace storm
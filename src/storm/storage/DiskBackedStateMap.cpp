@@ -0,0 +1,301 @@
+#include "storm/storage/DiskBackedStateMap.h"
+
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <numeric>
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace {
+// The number of bits of the Bloom filter of a run per contained state and the number of positions that are set per state. This yields a false
+// positive rate of roughly one percent.
+uint64_t const filterBitsPerState = 10;
+uint64_t const numberOfFilterHashes = 7;
+
+// The number of states per block of a run, i.e., the granularity of the sparse index.
+uint64_t const statesPerBlock = 256;
+
+// Distinguishes the runs of different maps in the same directory.
+std::atomic<uint64_t> numberOfCreatedMaps{0};
+
+// The finalizer of splitmix64.
+uint64_t mix(uint64_t value) {
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ull;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebull;
+    value ^= value >> 31;
+    return value;
+}
+}  // namespace
+
+template<typename StateType>
+DiskBackedStateMap<StateType>::DiskBackedStateMap(uint64_t bitsPerState, uint64_t maximalNumberOfStatesInMemory, std::string const& directory)
+    : bitsPerState(bitsPerState),
+      wordsPerState(std::max<uint64_t>(1, (bitsPerState + 63) / 64)),
+      wordsPerRecord(wordsPerState + 1),
+      maximalNumberOfStatesInMemory(maximalNumberOfStatesInMemory),
+      statesInMemory(bitsPerState, std::min<uint64_t>(maximalNumberOfStatesInMemory, 100000)),
+      numberOfStates(0) {
+    STORM_LOG_THROW(maximalNumberOfStatesInMemory > 0, storm::exceptions::InvalidArgumentException, "At least one state has to be kept in memory.");
+    std::filesystem::path path = directory.empty() ? std::filesystem::temp_directory_path() : std::filesystem::path(directory);
+    STORM_LOG_THROW(std::filesystem::is_directory(path), storm::exceptions::FileIoException, "The directory '" << path.string() << "' does not exist.");
+    filenamePrefix = (path / ("storm-states-" + std::to_string(getpid()) + "-" + std::to_string(numberOfCreatedMaps++) + "-")).string();
+}
+
+template<typename StateType>
+DiskBackedStateMap<StateType>::~DiskBackedStateMap() {
+    for (auto const& run : runs) {
+        std::error_code error;
+        std::filesystem::remove(run.filename, error);
+    }
+}
+
+template<typename StateType>
+std::optional<StateType> DiskBackedStateMap<StateType>::findInMemory(storm::storage::BitVector const& state) const {
+    return statesInMemory.find(state);
+}
+
+template<typename StateType>
+std::vector<std::optional<StateType>> DiskBackedStateMap<StateType>::findOnDisk(std::vector<storm::storage::BitVector> const& states) const {
+    std::vector<std::optional<StateType>> result(states.size());
+    if (runs.empty() || states.empty()) {
+        return result;
+    }
+
+    // Sort the states, so the blocks of every run are read in ascending order and each one only once.
+    std::vector<uint64_t> words;
+    words.reserve(states.size() * wordsPerState);
+    for (auto const& state : states) {
+        serialize(state, words);
+    }
+    std::vector<uint64_t> order(states.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&](uint64_t const& lhs, uint64_t const& rhs) { return compare(words.data() + lhs * wordsPerState, words.data() + rhs * wordsPerState) < 0; });
+    std::vector<std::pair<uint64_t, uint64_t>> hashes(states.size());
+    for (uint64_t index = 0; index < states.size(); ++index) {
+        hashes[index] = getHashes(words.data() + index * wordsPerState);
+    }
+
+    std::vector<uint64_t> block;
+    for (auto const& run : runs) {
+        std::ifstream file;
+        uint64_t loadedBlock = std::numeric_limits<uint64_t>::max();
+        uint64_t numberOfRecordsInBlock = 0;
+        for (auto const& index : order) {
+            // Every state is contained in at most one run.
+            if (result[index].has_value() || !mightContain(run, hashes[index])) {
+                continue;
+            }
+            uint64_t const* key = words.data() + index * wordsPerState;
+
+            // Find the last block whose first state is not larger than the state.
+            uint64_t lowerBlock = 0;
+            uint64_t upperBlock = run.blockKeys.size() / wordsPerState;
+            while (lowerBlock < upperBlock) {
+                uint64_t const middle = lowerBlock + (upperBlock - lowerBlock) / 2;
+                if (compare(run.blockKeys.data() + middle * wordsPerState, key) <= 0) {
+                    lowerBlock = middle + 1;
+                } else {
+                    upperBlock = middle;
+                }
+            }
+            if (lowerBlock == 0) {
+                continue;
+            }
+            uint64_t const blockIndex = lowerBlock - 1;
+
+            if (blockIndex != loadedBlock) {
+                if (!file.is_open()) {
+                    file.open(run.filename, std::ios::binary);
+                    STORM_LOG_THROW(file.good(), storm::exceptions::FileIoException, "Unable to open '" << run.filename << "'.");
+                }
+                numberOfRecordsInBlock = std::min(statesPerBlock, run.numberOfStates - blockIndex * statesPerBlock);
+                block.resize(numberOfRecordsInBlock * wordsPerRecord);
+                file.seekg(static_cast<std::streamoff>(blockIndex * statesPerBlock * wordsPerRecord * sizeof(uint64_t)));
+                file.read(reinterpret_cast<char*>(block.data()), static_cast<std::streamsize>(block.size() * sizeof(uint64_t)));
+                STORM_LOG_THROW(file.good(), storm::exceptions::FileIoException, "Unable to read from '" << run.filename << "'.");
+                loadedBlock = blockIndex;
+            }
+
+            // Search the state within the block.
+            uint64_t lower = 0;
+            uint64_t upper = numberOfRecordsInBlock;
+            while (lower < upper) {
+                uint64_t const middle = lower + (upper - lower) / 2;
+                int const comparison = compare(block.data() + middle * wordsPerRecord, key);
+                if (comparison == 0) {
+                    result[index] = static_cast<StateType>(block[middle * wordsPerRecord + wordsPerState]);
+                    break;
+                } else if (comparison < 0) {
+                    lower = middle + 1;
+                } else {
+                    upper = middle;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+template<typename StateType>
+std::optional<StateType> DiskBackedStateMap<StateType>::find(storm::storage::BitVector const& state) const {
+    if (auto index = findInMemory(state)) {
+        return index;
+    }
+    return findOnDisk({state}).front();
+}
+
+template<typename StateType>
+void DiskBackedStateMap<StateType>::insert(storm::storage::BitVector const& state, StateType const& id) {
+    STORM_LOG_ASSERT(!find(state).has_value(), "The state is already contained.");
+    statesInMemory.findOrAdd(state, id);
+    ++numberOfStates;
+    if (statesInMemory.size() >= maximalNumberOfStatesInMemory) {
+        flush();
+    }
+}
+
+template<typename StateType>
+void DiskBackedStateMap<StateType>::flush() {
+    std::vector<uint64_t> records;
+    records.reserve(statesInMemory.size() * wordsPerRecord);
+    for (auto const& stateIdPair : statesInMemory) {
+        serialize(stateIdPair.first, records);
+        records.push_back(static_cast<uint64_t>(stateIdPair.second));
+    }
+    uint64_t const numberOfRecords = records.size() / wordsPerRecord;
+    std::vector<uint64_t> order(numberOfRecords);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](uint64_t const& lhs, uint64_t const& rhs) {
+        return compare(records.data() + lhs * wordsPerRecord, records.data() + rhs * wordsPerRecord) < 0;
+    });
+
+    Run run{filenamePrefix + std::to_string(runs.size()) + ".bin", numberOfRecords,
+            storm::storage::BitVector(std::max<uint64_t>(64, numberOfRecords * filterBitsPerState)), {}};
+    std::ofstream file(run.filename, std::ios::binary | std::ios::trunc);
+    STORM_LOG_THROW(file.good(), storm::exceptions::FileIoException, "Unable to create '" << run.filename << "'.");
+    for (uint64_t position = 0; position < numberOfRecords; ++position) {
+        uint64_t const* record = records.data() + order[position] * wordsPerRecord;
+        if (position % statesPerBlock == 0) {
+            run.blockKeys.insert(run.blockKeys.end(), record, record + wordsPerState);
+        }
+        auto const [firstHash, secondHash] = getHashes(record);
+        for (uint64_t hash = 0; hash < numberOfFilterHashes; ++hash) {
+            run.filter.set((firstHash + hash * secondHash) % run.filter.size());
+        }
+        file.write(reinterpret_cast<char const*>(record), static_cast<std::streamsize>(wordsPerRecord * sizeof(uint64_t)));
+    }
+    file.close();
+    STORM_LOG_THROW(file.good(), storm::exceptions::FileIoException, "Unable to write to '" << run.filename << "'.");
+    STORM_LOG_DEBUG("Wrote " << numberOfRecords << " states to '" << run.filename << "'.");
+    runs.push_back(std::move(run));
+
+    statesInMemory = storm::storage::BitVectorHashMap<StateType>(bitsPerState, std::min<uint64_t>(maximalNumberOfStatesInMemory, 100000));
+}
+
+template<typename StateType>
+void DiskBackedStateMap<StateType>::forEachChunk(
+    std::function<void(std::vector<std::pair<storm::storage::BitVector, StateType>> const&)> const& callback) const {
+    std::vector<std::pair<storm::storage::BitVector, StateType>> chunk;
+    if (statesInMemory.size() > 0) {
+        chunk.reserve(statesInMemory.size());
+        for (auto const& stateIdPair : statesInMemory) {
+            chunk.emplace_back(stateIdPair.first, stateIdPair.second);
+        }
+        callback(chunk);
+    }
+
+    std::vector<uint64_t> records;
+    for (auto const& run : runs) {
+        records.resize(run.numberOfStates * wordsPerRecord);
+        std::ifstream file(run.filename, std::ios::binary);
+        file.read(reinterpret_cast<char*>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(uint64_t)));
+        STORM_LOG_THROW(file.good(), storm::exceptions::FileIoException, "Unable to read from '" << run.filename << "'.");
+        chunk.clear();
+        chunk.reserve(run.numberOfStates);
+        for (uint64_t position = 0; position < run.numberOfStates; ++position) {
+            uint64_t const* record = records.data() + position * wordsPerRecord;
+            chunk.emplace_back(deserialize(record), static_cast<StateType>(record[wordsPerState]));
+        }
+        callback(chunk);
+    }
+}
+
+template<typename StateType>
+uint64_t DiskBackedStateMap<StateType>::size() const {
+    return numberOfStates;
+}
+
+template<typename StateType>
+uint64_t DiskBackedStateMap<StateType>::getNumberOfStatesInMemory() const {
+    return statesInMemory.size();
+}
+
+template<typename StateType>
+uint64_t DiskBackedStateMap<StateType>::getNumberOfRuns() const {
+    return runs.size();
+}
+
+template<typename StateType>
+void DiskBackedStateMap<StateType>::serialize(storm::storage::BitVector const& state, std::vector<uint64_t>& words) const {
+    for (uint64_t bitIndex = 0; bitIndex < wordsPerState * 64; bitIndex += 64) {
+        uint64_t const numberOfBits = bitIndex < bitsPerState ? std::min<uint64_t>(64, bitsPerState - bitIndex) : 0;
+        words.push_back(numberOfBits > 0 ? state.getAsInt(bitIndex, numberOfBits) : 0);
+    }
+}
+
+template<typename StateType>
+storm::storage::BitVector DiskBackedStateMap<StateType>::deserialize(uint64_t const* words) const {
+    storm::storage::BitVector state(bitsPerState);
+    for (uint64_t bitIndex = 0; bitIndex < bitsPerState; bitIndex += 64) {
+        state.setFromInt(bitIndex, std::min<uint64_t>(64, bitsPerState - bitIndex), words[bitIndex / 64]);
+    }
+    return state;
+}
+
+template<typename StateType>
+int DiskBackedStateMap<StateType>::compare(uint64_t const* lhs, uint64_t const* rhs) const {
+    for (uint64_t word = 0; word < wordsPerState; ++word) {
+        if (lhs[word] != rhs[word]) {
+            return lhs[word] < rhs[word] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+template<typename StateType>
+std::pair<uint64_t, uint64_t> DiskBackedStateMap<StateType>::getHashes(uint64_t const* words) const {
+    uint64_t hash = 0;
+    for (uint64_t word = 0; word < wordsPerState; ++word) {
+        hash = mix(hash ^ words[word]);
+    }
+    // The positions in the filters are derived from two hash values by double hashing.
+    return {hash, mix(hash + 0x9e3779b97f4a7c15ull) | 1};
+}
+
+template<typename StateType>
+bool DiskBackedStateMap<StateType>::mightContain(Run const& run, std::pair<uint64_t, uint64_t> const& hashes) const {
+    for (uint64_t hash = 0; hash < numberOfFilterHashes; ++hash) {
+        if (!run.filter.get((hashes.first + hash * hashes.second) % run.filter.size())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template class DiskBackedStateMap<uint32_t>;
+template class DiskBackedStateMap<uint_fast64_t>;
+
+}  // namespace storage
+}  // namespace storm
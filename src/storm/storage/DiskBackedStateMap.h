@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A map from states (bit vectors of fixed size) to their ids that keeps only a bounded number of states in memory. Once this number is reached, the
+ * states in memory are written to a new file (a run) in which they are sorted. For every run, a Bloom filter and a sparse index of its contents are
+ * kept in memory, so that most lookups of states that are not contained in a run do not access the disk at all and the others only read a
+ * single block of the run.
+ *
+ * States are looked up on disk in batches (delayed duplicate detection), which is how a breadth-first exploration uses this map: The successors
+ * of a complete level are collected first, and only the ones that are not in memory are then looked up in the runs.
+ */
+template<typename StateType>
+class DiskBackedStateMap {
+   public:
+    /*!
+     * Creates an empty map.
+     *
+     * @param bitsPerState The number of bits of each state.
+     * @param maximalNumberOfStatesInMemory The number of states after which the states in memory are written to disk.
+     * @param directory The directory in which the runs are stored. If empty, the directory for temporary files is used.
+     */
+    DiskBackedStateMap(uint64_t bitsPerState, uint64_t maximalNumberOfStatesInMemory, std::string const& directory = "");
+
+    /*!
+     * Removes all runs from the disk.
+     */
+    ~DiskBackedStateMap();
+
+    // The runs are owned by this object.
+    DiskBackedStateMap(DiskBackedStateMap const& other) = delete;
+    DiskBackedStateMap& operator=(DiskBackedStateMap const& other) = delete;
+
+    /*!
+     * Retrieves the id of the given state if the state is currently held in memory.
+     */
+    std::optional<StateType> findInMemory(storm::storage::BitVector const& state) const;
+
+    /*!
+     * Looks up the given states in the runs on disk. Every run is read at most once and only in the blocks that possibly contain one of the states.
+     *
+     * @return For each state, its id if the state is contained in a run.
+     */
+    std::vector<std::optional<StateType>> findOnDisk(std::vector<storm::storage::BitVector> const& states) const;
+
+    /*!
+     * Retrieves the id of the given state (if the state is contained in any way).
+     */
+    std::optional<StateType> find(storm::storage::BitVector const& state) const;
+
+    /*!
+     * Inserts the given state, which must not be contained yet. If afterwards too many states are held in memory, they are written to disk.
+     */
+    void insert(storm::storage::BitVector const& state, StateType const& id);
+
+    /*!
+     * Calls the given function for disjoint chunks of states that together contain all states. Each chunk contains at most the maximal number of
+     * states in memory.
+     */
+    void forEachChunk(std::function<void(std::vector<std::pair<storm::storage::BitVector, StateType>> const&)> const& callback) const;
+
+    /*!
+     * Retrieves the number of contained states.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the number of states that are currently held in memory.
+     */
+    uint64_t getNumberOfStatesInMemory() const;
+
+    /*!
+     * Retrieves the number of runs on disk.
+     */
+    uint64_t getNumberOfRuns() const;
+
+   private:
+    /*!
+     * A sorted sequence of states (and their ids) on disk.
+     */
+    struct Run {
+        std::string filename;
+        uint64_t numberOfStates;
+        // The Bloom filter of the states in the run.
+        storm::storage::BitVector filter;
+        // The (serialized) first state of every block of the run.
+        std::vector<uint64_t> blockKeys;
+    };
+
+    /*!
+     * Writes all states that are held in memory to a new run.
+     */
+    void flush();
+
+    /*!
+     * Appends the words that represent the given state (and which are also used to order the states within a run) to the given vector.
+     */
+    void serialize(storm::storage::BitVector const& state, std::vector<uint64_t>& words) const;
+
+    /*!
+     * Restores the state with the given words.
+     */
+    storm::storage::BitVector deserialize(uint64_t const* words) const;
+
+    /*!
+     * Compares the states with the given words lexicographically.
+     */
+    int compare(uint64_t const* lhs, uint64_t const* rhs) const;
+
+    /*!
+     * Retrieves the (two) hash values of the state with the given words from which the positions in the Bloom filters are derived.
+     */
+    std::pair<uint64_t, uint64_t> getHashes(uint64_t const* words) const;
+
+    /*!
+     * Retrieves whether the given run possibly contains the state with the given hash values.
+     */
+    bool mightContain(Run const& run, std::pair<uint64_t, uint64_t> const& hashes) const;
+
+    uint64_t bitsPerState;
+    // The number of words per state and per record (which additionally contains the id) in a run.
+    uint64_t wordsPerState;
+    uint64_t wordsPerRecord;
+    uint64_t maximalNumberOfStatesInMemory;
+    // The prefix of the names of the runs.
+    std::string filenamePrefix;
+
+    storm::storage::BitVectorHashMap<StateType> statesInMemory;
+    std::vector<Run> runs;
+    uint64_t numberOfStates;
+};
+
+}  // namespace storage
+}  // namespace storm
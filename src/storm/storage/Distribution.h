@@ -34,6 +34,11 @@ class Distribution {
      */
     void reserve(uint64_t size);
 
+    /*!
+     * Removes all entries of the distribution. The underlying storage is kept, so that the distribution can be refilled without allocations.
+     */
+    void clear();
+
     /*!
      * Adds the given distribution to the current one.
      */
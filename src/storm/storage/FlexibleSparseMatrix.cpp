@@ -1,6 +1,7 @@
 #include "storm/storage/FlexibleSparseMatrix.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/SmallRationalNumber.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
 
@@ -347,6 +348,9 @@ template std::ostream& operator<<(std::ostream& out, FlexibleSparseMatrix<double
 template class FlexibleSparseMatrix<storm::RationalNumber>;
 template std::ostream& operator<<(std::ostream& out, FlexibleSparseMatrix<storm::RationalNumber> const& matrix);
 
+template class FlexibleSparseMatrix<storm::SmallRationalNumber>;
+template std::ostream& operator<<(std::ostream& out, FlexibleSparseMatrix<storm::SmallRationalNumber> const& matrix);
+
 template class FlexibleSparseMatrix<storm::RationalFunction>;
 template std::ostream& operator<<(std::ostream& out, FlexibleSparseMatrix<storm::RationalFunction> const& matrix);
 #endif
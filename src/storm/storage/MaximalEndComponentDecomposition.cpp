@@ -1,13 +1,18 @@
+#include <limits>
 #include <list>
 #include <numeric>
 #include <queue>
+#include <type_traits>
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace storage {
@@ -73,11 +78,36 @@ MaximalEndComponentDecomposition<ValueType>& MaximalEndComponentDecomposition<Va
     return *this;
 }
 
+namespace {
+
+// The number of states below which MECs are computed sequentially as the parallel algorithm does not pay off.
+uint64_t const MinimalNumberOfStatesForParallelMecDecomposition = 100000;
+
+}  // namespace
+
 template<typename ValueType>
 void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                           storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                           storm::OptionalRef<storm::storage::BitVector const> states,
                                                                                           storm::OptionalRef<storm::storage::BitVector const> choices) {
+    uint64_t numberOfThreads = 1;
+    // The arithmetic on rational functions is not thread-safe.
+    if (!std::is_same_v<ValueType, storm::RationalFunction> && storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+        numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads();
+    }
+    uint64_t numberOfConsideredStates = states ? states->getNumberOfSetBits() : transitionMatrix.getRowGroupCount();
+    if (numberOfThreads > 1 && numberOfConsideredStates >= MinimalNumberOfStatesForParallelMecDecomposition) {
+        performParallelMaximalEndComponentDecomposition(transitionMatrix, states, choices, numberOfThreads);
+    } else {
+        performSequentialMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, states, choices, numberOfThreads);
+    }
+    STORM_LOG_DEBUG("MEC decomposition found " << this->size() << " MEC(s).");
+}
+
+template<typename ValueType>
+void MaximalEndComponentDecomposition<ValueType>::performSequentialMaximalEndComponentDecomposition(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::OptionalRef<storm::storage::BitVector const> states, storm::OptionalRef<storm::storage::BitVector const> choices, uint64_t numberOfThreads) {
     // Get some data for convenient access.
     auto const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
 
@@ -85,7 +115,7 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
     SccDecompositionResult sccDecRes;
     SccDecompositionMemoryCache sccDecCache;
     StronglyConnectedComponentDecompositionOptions sccDecOptions;
-    sccDecOptions.dropNaiveSccs();
+    sccDecOptions.dropNaiveSccs().numberOfThreads(numberOfThreads);
     if (states) {
         sccDecOptions.subsystem(*states);
     }
@@ -128,25 +158,27 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
 
         // process the MECs that we've found, i.e. SCCs where every state can stay inside the SCC
         ecSccIndices &= nonTrivSccIndices;
+        std::vector<uint64_t> sccToMecIndex(sccDecRes.sccCount, std::numeric_limits<uint64_t>::max());
         for (auto sccIndex : ecSccIndices) {
-            MaximalEndComponent newMec;
-            for (auto state : remainingEcCandidates) {
-                // skip states from different SCCs
-                if (sccDecRes.stateToSccMapping[state] != sccIndex) {
-                    continue;
-                }
-                // This is no longer a candidate
-                remainingEcCandidates.set(state, false);
-                // Add choices to the MEC
-                MaximalEndComponent::set_type containedChoices;
-                for (auto ecChoiceIt = ecChoices.begin(nondeterministicChoiceIndices[state]); *ecChoiceIt < nondeterministicChoiceIndices[state + 1];
-                     ++ecChoiceIt) {
-                    containedChoices.insert(*ecChoiceIt);
-                }
-                STORM_LOG_ASSERT(!containedChoices.empty(), "The contained choices of any state in an MEC must be non-empty.");
-                newMec.addState(state, std::move(containedChoices));
+            sccToMecIndex[sccIndex] = this->blocks.size();
+            this->blocks.emplace_back();
+        }
+        for (auto state : remainingEcCandidates) {
+            // skip states of SCCs that are not MECs
+            uint64_t const mecIndex = sccToMecIndex[sccDecRes.stateToSccMapping[state]];
+            if (mecIndex == std::numeric_limits<uint64_t>::max()) {
+                continue;
+            }
+            // This is no longer a candidate
+            remainingEcCandidates.set(state, false);
+            // Add choices to the MEC
+            MaximalEndComponent::set_type containedChoices;
+            for (auto ecChoiceIt = ecChoices.begin(nondeterministicChoiceIndices[state]); *ecChoiceIt < nondeterministicChoiceIndices[state + 1];
+                 ++ecChoiceIt) {
+                containedChoices.insert(*ecChoiceIt);
             }
-            this->blocks.emplace_back(std::move(newMec));
+            STORM_LOG_ASSERT(!containedChoices.empty(), "The contained choices of any state in an MEC must be non-empty.");
+            this->blocks[mecIndex].addState(state, std::move(containedChoices));
         }
 
         if (nonTrivSccIndices == ecSccIndices) {
@@ -162,8 +194,138 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
         sccDecOptions.subsystem(remainingEcCandidates);
         sccDecOptions.choices(ecChoices);
     }
+}
 
-    STORM_LOG_DEBUG("MEC decomposition found " << this->size() << " MEC(s).");
+template<typename ValueType>
+void MaximalEndComponentDecomposition<ValueType>::performParallelMaximalEndComponentDecomposition(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::OptionalRef<storm::storage::BitVector const> states,
+    storm::OptionalRef<storm::storage::BitVector const> choices, uint64_t numberOfThreads) {
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+
+    // Every MEC is contained in an SCC of the subsystem.
+    SccDecompositionResult sccDecRes;
+    StronglyConnectedComponentDecompositionOptions sccDecOptions;
+    sccDecOptions.dropNaiveSccs().numberOfThreads(numberOfThreads);
+    if (states) {
+        sccDecOptions.subsystem(*states);
+    }
+    if (choices) {
+        sccDecOptions.choices(*choices);
+    }
+    performSccDecomposition(transitionMatrix, sccDecOptions, sccDecRes);
+
+    // Group the states of the non-trivial SCCs.
+    std::vector<uint64_t> sccStateOffsets(sccDecRes.sccCount + 1, 0);
+    for (auto state : sccDecRes.nonTrivialStates) {
+        ++sccStateOffsets[sccDecRes.stateToSccMapping[state] + 1];
+    }
+    std::vector<uint64_t> nonTrivialSccs;
+    for (uint64_t sccIndex = 0; sccIndex < sccDecRes.sccCount; ++sccIndex) {
+        if (sccStateOffsets[sccIndex + 1] > 0) {
+            nonTrivialSccs.push_back(sccIndex);
+        }
+        sccStateOffsets[sccIndex + 1] += sccStateOffsets[sccIndex];
+    }
+    std::vector<uint64_t> sccStates(sccStateOffsets.back());
+    {
+        std::vector<uint64_t> nextPositions(sccStateOffsets.begin(), sccStateOffsets.end() - 1);
+        for (auto state : sccDecRes.nonTrivialStates) {
+            sccStates[nextPositions[sccDecRes.stateToSccMapping[state]]++] = state;
+        }
+    }
+    // Larger SCCs are refined first to balance the load.
+    std::sort(nonTrivialSccs.begin(), nonTrivialSccs.end(), [&sccStateOffsets](uint64_t first, uint64_t second) {
+        return sccStateOffsets[first + 1] - sccStateOffsets[first] > sccStateOffsets[second + 1] - sccStateOffsets[second];
+    });
+
+    // Refine each SCC into MECs. As the SCCs are disjoint, the threads write to disjoint parts of the local state indices.
+    std::vector<uint64_t> localStateIndices(transitionMatrix.getRowGroupCount());
+    std::vector<std::vector<MaximalEndComponent>> sccMecs(sccDecRes.sccCount);
+    auto refineScc = [&](uint64_t sccIndex) {
+        uint64_t const firstState = sccStateOffsets[sccIndex];
+        uint64_t const numberOfSccStates = sccStateOffsets[sccIndex + 1] - firstState;
+        for (uint64_t localState = 0; localState < numberOfSccStates; ++localState) {
+            localStateIndices[sccStates[firstState + localState]] = localState;
+        }
+
+        // Only the choices that stay inside the SCC can be part of an MEC.
+        std::vector<uint64_t> localRowGroupIndices = {0};
+        std::vector<uint64_t> localToGlobalRow;
+        bool allChoicesStay = true;
+        for (uint64_t localState = 0; localState < numberOfSccStates; ++localState) {
+            uint64_t const state = sccStates[firstState + localState];
+            for (uint64_t row = rowGroupIndices[state], rowEnd = rowGroupIndices[state + 1]; row != rowEnd; ++row) {
+                if (choices && !choices->get(row)) {
+                    continue;
+                }
+                auto const& rowEntries = transitionMatrix.getRow(row);
+                if (std::all_of(rowEntries.begin(), rowEntries.end(), [&](auto const& entry) {
+                        return sccDecRes.stateToSccMapping[entry.getColumn()] == sccIndex || storm::utility::isZero(entry.getValue());
+                    })) {
+                    localToGlobalRow.push_back(row);
+                } else {
+                    allChoicesStay = false;
+                }
+            }
+            localRowGroupIndices.push_back(localToGlobalRow.size());
+        }
+
+        if (allChoicesStay) {
+            // The SCC itself is an MEC.
+            MaximalEndComponent mec;
+            for (uint64_t localState = 0; localState < numberOfSccStates; ++localState) {
+                MaximalEndComponent::set_type containedChoices;
+                for (uint64_t localRow = localRowGroupIndices[localState]; localRow < localRowGroupIndices[localState + 1]; ++localRow) {
+                    containedChoices.insert(localToGlobalRow[localRow]);
+                }
+                mec.addState(sccStates[firstState + localState], std::move(containedChoices));
+            }
+            sccMecs[sccIndex].push_back(std::move(mec));
+            return;
+        }
+
+        // Otherwise, decompose the SCC restricted to the staying choices.
+        storm::storage::SparseMatrixBuilder<ValueType> builder(localToGlobalRow.size(), numberOfSccStates, 0, true, true, numberOfSccStates);
+        for (uint64_t localState = 0; localState < numberOfSccStates; ++localState) {
+            builder.newRowGroup(localRowGroupIndices[localState]);
+            for (uint64_t localRow = localRowGroupIndices[localState]; localRow < localRowGroupIndices[localState + 1]; ++localRow) {
+                for (auto const& entry : transitionMatrix.getRow(localToGlobalRow[localRow])) {
+                    if (!storm::utility::isZero(entry.getValue())) {
+                        builder.addNextValue(localRow, localStateIndices[entry.getColumn()], entry.getValue());
+                    }
+                }
+            }
+        }
+        storm::storage::SparseMatrix<ValueType> localMatrix = builder.build();
+        MaximalEndComponentDecomposition<ValueType> localDecomposition;
+        // If there is just one SCC, its SCC decompositions can use all threads.
+        uint64_t const numberOfSccThreads = nonTrivialSccs.size() == 1 ? numberOfThreads : 1;
+        localDecomposition.performSequentialMaximalEndComponentDecomposition(localMatrix, localMatrix.transpose(true), storm::NullRef, storm::NullRef,
+                                                                             numberOfSccThreads);
+        for (auto const& localMec : localDecomposition) {
+            MaximalEndComponent mec;
+            for (auto const& [localState, localChoices] : localMec) {
+                MaximalEndComponent::set_type containedChoices;
+                for (auto localRow : localChoices) {
+                    containedChoices.insert(localToGlobalRow[localRow]);
+                }
+                mec.addState(sccStates[firstState + localState], std::move(containedChoices));
+            }
+            sccMecs[sccIndex].push_back(std::move(mec));
+        }
+    };
+    storm::utility::parallel::forEachBlock(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(nonTrivialSccs.size()), 1,
+                                           [&](uint64_t, uint64_t begin, uint64_t end) {
+                                               for (uint64_t index = begin; index != end; ++index) {
+                                                   refineScc(nonTrivialSccs[index]);
+                                               }
+                                           });
+
+    for (auto& mecs : sccMecs) {
+        for (auto& mec : mecs) {
+            this->blocks.push_back(std::move(mec));
+        }
+    }
 }
 
 // Explicitly instantiate the MEC decomposition.
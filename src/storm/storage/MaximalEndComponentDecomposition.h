@@ -110,5 +110,22 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
                                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                  storm::OptionalRef<storm::storage::BitVector const> states = storm::NullRef,
                                                  storm::OptionalRef<storm::storage::BitVector const> choices = storm::NullRef);
+
+    /*!
+     * Decomposes the given subsystem into MECs by repeatedly computing SCCs on the whole subsystem, where the SCCs are computed with the given number of
+     * threads.
+     */
+    void performSequentialMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                           storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                           storm::OptionalRef<storm::storage::BitVector const> states,
+                                                           storm::OptionalRef<storm::storage::BitVector const> choices, uint64_t numberOfThreads);
+
+    /*!
+     * Decomposes the given subsystem into MECs with the given number of threads. After an initial SCC decomposition of the subsystem, the SCCs are refined
+     * into MECs independently of each other.
+     */
+    void performParallelMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                         storm::OptionalRef<storm::storage::BitVector const> states,
+                                                         storm::OptionalRef<storm::storage::BitVector const> choices, uint64_t numberOfThreads);
 };
 }  // namespace storm::storage
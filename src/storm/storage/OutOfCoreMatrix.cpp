@@ -0,0 +1,297 @@
+#include "storm/storage/OutOfCoreMatrix.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <type_traits>
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace binary = storm::exporter::binary;
+
+namespace {
+
+static_assert(sizeof(OutOfCoreMatrix::Entry) == 2 * sizeof(uint64_t) && std::is_trivially_copyable_v<OutOfCoreMatrix::Entry>,
+              "Unexpected layout of matrix entries.");
+
+template<typename T>
+void writeRaw(std::ostream& os, T const& value) {
+    os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+void writeSection(std::ostream& os, binary::SectionKind kind, std::vector<uint64_t> const& data) {
+    writeRaw(os, static_cast<uint32_t>(kind));
+    writeRaw(os, static_cast<uint32_t>(0));
+    writeRaw(os, static_cast<uint64_t>(0));
+    writeRaw(os, static_cast<uint64_t>(data.size() * sizeof(uint64_t)));
+    os.write(reinterpret_cast<char const*>(data.data()), data.size() * sizeof(uint64_t));
+}
+
+/*!
+ * Gives the kernel the given advice for all pages that lie completely within the given range.
+ */
+void adviseRange(char const* begin, char const* end, int advice) {
+    uint64_t const pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    uint64_t const first = (reinterpret_cast<uintptr_t>(begin) + pageSize - 1) / pageSize * pageSize;
+    uint64_t const last = reinterpret_cast<uintptr_t>(end) / pageSize * pageSize;
+    if (first < last) {
+        madvise(reinterpret_cast<void*>(first), last - first, advice);
+    }
+}
+
+}  // namespace
+
+OutOfCoreMatrix::OutOfCoreMatrix(std::string const& filename, uint64_t entriesOffset, std::vector<uint64_t>&& rowIndications,
+                                 std::optional<std::vector<uint64_t>>&& rowGroupIndices, uint64_t columnCount)
+    : filename(filename),
+      entriesOffset(entriesOffset),
+      rowIndications(std::move(rowIndications)),
+      rowGroupIndices(std::move(rowGroupIndices)),
+      columnCount(columnCount),
+      mapping(nullptr),
+      mappingSize(0) {
+    STORM_LOG_ASSERT(!this->rowIndications.empty(), "Expected at least one row indication.");
+    STORM_LOG_ASSERT(entriesOffset % binary::Alignment == 0, "Misaligned matrix entries.");
+    if (getEntryCount() == 0) {
+        return;
+    }
+
+    int file = open(filename.c_str(), O_RDONLY);
+    STORM_LOG_THROW(file >= 0, storm::exceptions::FileIoException, "Unable to open '" << filename << "': " << std::strerror(errno));
+    struct stat fileStatus;
+    if (fstat(file, &fileStatus) != 0) {
+        close(file);
+        STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Unable to retrieve the size of '" << filename << "': " << std::strerror(errno));
+    }
+    mappingSize = static_cast<uint64_t>(fileStatus.st_size);
+    if (mappingSize < entriesOffset + getEntryCount() * sizeof(Entry)) {
+        close(file);
+        STORM_LOG_THROW(false, storm::exceptions::FileIoException, "The file '" << filename << "' does not contain all matrix entries.");
+    }
+    void* result = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, file, 0);
+    // The mapping stays valid after closing the file.
+    close(file);
+    STORM_LOG_THROW(result != MAP_FAILED, storm::exceptions::FileIoException, "Unable to map '" << filename << "': " << std::strerror(errno));
+    mapping = static_cast<char*>(result);
+    madvise(mapping, mappingSize, MADV_SEQUENTIAL);
+}
+
+OutOfCoreMatrix::OutOfCoreMatrix(OutOfCoreMatrix&& other)
+    : filename(std::move(other.filename)),
+      entriesOffset(other.entriesOffset),
+      rowIndications(std::move(other.rowIndications)),
+      rowGroupIndices(std::move(other.rowGroupIndices)),
+      columnCount(other.columnCount),
+      mapping(other.mapping),
+      mappingSize(other.mappingSize) {
+    other.mapping = nullptr;
+    other.mappingSize = 0;
+}
+
+OutOfCoreMatrix::~OutOfCoreMatrix() {
+    unmap();
+}
+
+void OutOfCoreMatrix::unmap() {
+    if (mapping != nullptr) {
+        munmap(mapping, mappingSize);
+        mapping = nullptr;
+    }
+}
+
+uint64_t OutOfCoreMatrix::getRowCount() const {
+    return rowIndications.size() - 1;
+}
+
+uint64_t OutOfCoreMatrix::getColumnCount() const {
+    return columnCount;
+}
+
+uint64_t OutOfCoreMatrix::getEntryCount() const {
+    return rowIndications.back();
+}
+
+uint64_t OutOfCoreMatrix::getRowGroupCount() const {
+    return rowGroupIndices ? rowGroupIndices->size() - 1 : getRowCount();
+}
+
+bool OutOfCoreMatrix::hasTrivialRowGrouping() const {
+    return !rowGroupIndices.has_value();
+}
+
+uint64_t OutOfCoreMatrix::getRowGroupStart(uint64_t rowGroup) const {
+    return rowGroupIndices ? rowGroupIndices.value()[rowGroup] : rowGroup;
+}
+
+std::vector<uint64_t> const& OutOfCoreMatrix::getRowIndications() const {
+    return rowIndications;
+}
+
+std::string const& OutOfCoreMatrix::getFilename() const {
+    return filename;
+}
+
+void OutOfCoreMatrix::forEachBlock(uint64_t maximalBlockSize,
+                                   std::function<void(uint64_t firstRowGroup, uint64_t endRowGroup, Entry const* entries)> const& callback) const {
+    Entry const* entries = mapping == nullptr ? nullptr : reinterpret_cast<Entry const*>(mapping + entriesOffset);
+    uint64_t const numberOfRowGroups = getRowGroupCount();
+    auto firstEntryOfGroup = [&](uint64_t rowGroup) { return rowIndications[getRowGroupStart(rowGroup)]; };
+    auto endOfBlock = [&](uint64_t firstRowGroup) {
+        uint64_t end = firstRowGroup + 1;
+        uint64_t const firstEntry = firstEntryOfGroup(firstRowGroup);
+        while (end < numberOfRowGroups && (firstEntryOfGroup(end + 1) - firstEntry) * sizeof(Entry) <= maximalBlockSize) {
+            ++end;
+        }
+        return end;
+    };
+
+    uint64_t blockEnd = numberOfRowGroups > 0 ? endOfBlock(0) : 0;
+    for (uint64_t blockBegin = 0; blockBegin < numberOfRowGroups;) {
+        uint64_t const nextBlockEnd = blockEnd < numberOfRowGroups ? endOfBlock(blockEnd) : blockEnd;
+        Entry const* blockEntries = entries == nullptr ? nullptr : entries + firstEntryOfGroup(blockBegin);
+        Entry const* blockEntriesEnd = entries == nullptr ? nullptr : entries + firstEntryOfGroup(blockEnd);
+        if (entries != nullptr && blockEnd < numberOfRowGroups) {
+            // Read the next block ahead while the current one is being processed.
+            Entry const* nextBlockEntriesEnd = entries + firstEntryOfGroup(nextBlockEnd);
+            adviseRange(reinterpret_cast<char const*>(blockEntriesEnd), reinterpret_cast<char const*>(nextBlockEntriesEnd), MADV_WILLNEED);
+        }
+
+        callback(blockBegin, blockEnd, blockEntries);
+
+        if (entries != nullptr) {
+            // The pages are clean, so they are simply dropped and reread from the file when needed again.
+            adviseRange(reinterpret_cast<char const*>(blockEntries), reinterpret_cast<char const*>(blockEntriesEnd), MADV_DONTNEED);
+        }
+        blockBegin = blockEnd;
+        blockEnd = nextBlockEnd;
+    }
+}
+
+SparseMatrix<double> OutOfCoreMatrix::toSparseMatrix() const {
+    std::vector<Entry> entries(getEntryCount());
+    if (!entries.empty()) {
+        std::memcpy(entries.data(), mapping + entriesOffset, entries.size() * sizeof(Entry));
+    }
+    boost::optional<std::vector<SparseMatrixIndexType>> groups;
+    if (rowGroupIndices) {
+        groups = std::vector<SparseMatrixIndexType>(rowGroupIndices->begin(), rowGroupIndices->end());
+    }
+    return SparseMatrix<double>(columnCount, std::vector<SparseMatrixIndexType>(rowIndications.begin(), rowIndications.end()), std::move(entries),
+                                std::move(groups));
+}
+
+OutOfCoreMatrixWriter::OutOfCoreMatrixWriter(std::string const& filename, bool hasCustomRowGrouping, storm::models::ModelType modelType, uint64_t bufferSize)
+    : filename(filename),
+      stream(filename, std::ios::out | std::ios::binary | std::ios::trunc),
+      hasCustomRowGrouping(hasCustomRowGrouping),
+      bufferSize(std::max<uint64_t>(bufferSize, 1)),
+      numberOfEntries(0),
+      highestColumn(0),
+      lastRow(0),
+      lastColumn(0) {
+    STORM_LOG_THROW(stream.good(), storm::exceptions::FileIoException, "Unable to create '" << filename << "'.");
+    buffer.reserve(this->bufferSize);
+
+    // The header. The number of sections and the size of the entries are written once they are known.
+    stream.write(binary::Magic, sizeof(binary::Magic));
+    writeRaw(stream, binary::Version);
+    writeRaw(stream, binary::ByteOrderMarker);
+    writeRaw(stream, static_cast<uint32_t>(binary::ValueTypeTag::Double));
+    writeRaw(stream, static_cast<uint32_t>(modelType));
+    numberOfSectionsPosition = stream.tellp();
+    writeRaw(stream, static_cast<uint64_t>(0));
+
+    // The entries are the first section, so they can be written as they come in.
+    writeRaw(stream, static_cast<uint32_t>(binary::SectionKind::MatrixEntries));
+    writeRaw(stream, static_cast<uint32_t>(0));
+    writeRaw(stream, static_cast<uint64_t>(0));
+    entriesSizePosition = stream.tellp();
+    writeRaw(stream, static_cast<uint64_t>(0));
+    entriesOffset = static_cast<uint64_t>(stream.tellp());
+    STORM_LOG_THROW(stream.good(), storm::exceptions::FileIoException, "Error while writing to '" << filename << "'.");
+}
+
+void OutOfCoreMatrixWriter::addNextValue(uint64_t row, uint64_t column, double const& value) {
+    STORM_LOG_ASSERT(row >= lastRow, "Adding an element in row " << row << ", but an element in row " << lastRow << " has already been added.");
+    STORM_LOG_ASSERT(row > lastRow || numberOfEntries == 0 || column > lastColumn,
+                     "Adding an element in column " << column << " of row " << row << ", but an element in column " << lastColumn
+                                                    << " has already been added.");
+    while (rowIndications.size() <= row) {
+        rowIndications.push_back(numberOfEntries);
+    }
+    buffer.emplace_back(column, value);
+    ++numberOfEntries;
+    highestColumn = std::max(highestColumn, column);
+    lastRow = row;
+    lastColumn = column;
+    if (buffer.size() >= bufferSize) {
+        flush();
+    }
+}
+
+void OutOfCoreMatrixWriter::newRowGroup(uint64_t startingRow) {
+    STORM_LOG_ASSERT(hasCustomRowGrouping, "Matrix was not created to have a custom row grouping.");
+    STORM_LOG_ASSERT(rowGroupIndices.empty() || startingRow >= rowGroupIndices.back(), "Illegal row group with negative size.");
+    rowGroupIndices.push_back(startingRow);
+}
+
+uint64_t OutOfCoreMatrixWriter::getCurrentRowGroupCount() const {
+    return hasCustomRowGrouping ? rowGroupIndices.size() : rowIndications.size();
+}
+
+void OutOfCoreMatrixWriter::flush() {
+    stream.write(reinterpret_cast<char const*>(buffer.data()), buffer.size() * sizeof(Entry));
+    STORM_LOG_THROW(stream.good(), storm::exceptions::FileIoException, "Error while writing to '" << filename << "'.");
+    buffer.clear();
+}
+
+OutOfCoreMatrix OutOfCoreMatrixWriter::build(uint64_t overriddenRowCount, uint64_t overriddenColumnCount, uint64_t overriddenRowGroupCount) {
+    flush();
+
+    uint64_t rowCount = std::max<uint64_t>(overriddenRowCount, rowIndications.size());
+    if (hasCustomRowGrouping && !rowGroupIndices.empty()) {
+        rowCount = std::max(rowCount, rowGroupIndices.back());
+    }
+    while (rowIndications.size() <= rowCount) {
+        rowIndications.push_back(numberOfEntries);
+    }
+    uint64_t const columnCount = std::max(overriddenColumnCount, numberOfEntries > 0 ? highestColumn + 1 : 0);
+    std::optional<std::vector<uint64_t>> groups;
+    if (hasCustomRowGrouping) {
+        while (rowGroupIndices.size() < overriddenRowGroupCount) {
+            rowGroupIndices.push_back(rowCount);
+        }
+        rowGroupIndices.push_back(rowCount);
+        groups = std::move(rowGroupIndices);
+    }
+
+    // Append the remaining sections and complete the header. As entries take 16 bytes, no padding is required.
+    uint64_t numberOfSections = 3;
+    writeSection(stream, binary::SectionKind::RowIndications, rowIndications);
+    if (groups) {
+        writeSection(stream, binary::SectionKind::RowGroupIndices, *groups);
+        ++numberOfSections;
+    }
+    uint64_t const numberOfRowGroups = groups ? groups->size() - 1 : rowCount;
+    writeSection(stream, binary::SectionKind::ModelInfo, {numberOfRowGroups, rowCount, numberOfEntries, columnCount, static_cast<uint64_t>(groups ? 1 : 0)});
+    stream.seekp(numberOfSectionsPosition);
+    writeRaw(stream, numberOfSections);
+    stream.seekp(entriesSizePosition);
+    writeRaw(stream, static_cast<uint64_t>(numberOfEntries * sizeof(Entry)));
+    stream.close();
+    STORM_LOG_THROW(!stream.fail(), storm::exceptions::FileIoException, "Error while writing to '" << filename << "'.");
+
+    return OutOfCoreMatrix(filename, entriesOffset, std::move(rowIndications), std::move(groups), columnCount);
+}
+
+}  // namespace storage
+}  // namespace storm
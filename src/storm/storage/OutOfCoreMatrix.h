@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "storm/models/ModelType.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A read-only sparse matrix over doubles whose entries reside in a file on disk. Only the row indications and the row group indices are kept in
+ * memory, which allows to handle matrices with more entries than fit into the main memory (as long as the vectors over the rows fit).
+ *
+ * The file is a binary model file (see storm/io/BinaryModelFormat.h) that holds the transition matrix only. The entries are accessed block-wise
+ * through a memory mapping of the file: the pages of the next block are read ahead and the pages of processed blocks are released again.
+ */
+class OutOfCoreMatrix {
+   public:
+    typedef MatrixEntry<SparseMatrixIndexType, double> Entry;
+
+    /*!
+     * Maps the matrix entries stored in the given file.
+     *
+     * @param filename The file holding the entries.
+     * @param entriesOffset The position (in bytes) of the first entry within the file. Must be a multiple of 8.
+     * @param rowIndications For each row, the index of its first entry, followed by the number of entries.
+     * @param rowGroupIndices For each row group, its first row, followed by the number of rows. If not given, every row forms its own group.
+     * @param columnCount The number of columns.
+     */
+    OutOfCoreMatrix(std::string const& filename, uint64_t entriesOffset, std::vector<uint64_t>&& rowIndications,
+                    std::optional<std::vector<uint64_t>>&& rowGroupIndices, uint64_t columnCount);
+    ~OutOfCoreMatrix();
+
+    OutOfCoreMatrix(OutOfCoreMatrix const& other) = delete;
+    OutOfCoreMatrix& operator=(OutOfCoreMatrix const& other) = delete;
+    OutOfCoreMatrix(OutOfCoreMatrix&& other);
+    OutOfCoreMatrix& operator=(OutOfCoreMatrix&& other) = delete;
+
+    uint64_t getRowCount() const;
+    uint64_t getColumnCount() const;
+    uint64_t getEntryCount() const;
+    uint64_t getRowGroupCount() const;
+    bool hasTrivialRowGrouping() const;
+
+    /*!
+     * Retrieves the first row of the given row group. The group index may be the number of groups, which yields the number of rows.
+     */
+    uint64_t getRowGroupStart(uint64_t rowGroup) const;
+
+    std::vector<uint64_t> const& getRowIndications() const;
+    std::string const& getFilename() const;
+
+    /*!
+     * Splits the row groups into consecutive blocks such that the entries of a block take at most the given number of bytes (unless the block
+     * consists of a single row group) and invokes the callback for each block in ascending order. While the callback is invoked, the entries of
+     * the block are readable; afterwards, the memory used for them is released.
+     *
+     * @param maximalBlockSize The maximal size (in bytes) of the entries of a block.
+     * @param callback Is called with the first row group of the block, the row group one past the last row group of the block and a pointer to
+     * the first entry of the first row of the block. The entries of row r are pointed to by entries + (rowIndications[r] - rowIndications[first row]).
+     */
+    void forEachBlock(uint64_t maximalBlockSize, std::function<void(uint64_t firstRowGroup, uint64_t endRowGroup, Entry const* entries)> const& callback) const;
+
+    /*!
+     * Loads the whole matrix into memory.
+     */
+    SparseMatrix<double> toSparseMatrix() const;
+
+   private:
+    void unmap();
+
+    std::string filename;
+    uint64_t entriesOffset;
+    std::vector<uint64_t> rowIndications;
+    std::optional<std::vector<uint64_t>> rowGroupIndices;
+    uint64_t columnCount;
+
+    // The mapping of the file (or null if the matrix has no entries).
+    char* mapping;
+    uint64_t mappingSize;
+};
+
+/*!
+ * Writes the rows of a matrix (in ascending order) to a file from which it can then be accessed as an OutOfCoreMatrix. The entries are buffered
+ * and written in blocks, so the entries never need to be in memory at once. The interface mirrors the one of SparseMatrixBuilder.
+ */
+class OutOfCoreMatrixWriter {
+   public:
+    typedef OutOfCoreMatrix::Entry Entry;
+
+    /*!
+     * Creates the given file (overwriting any previous contents).
+     *
+     * @param filename The file.
+     * @param hasCustomRowGrouping Whether the matrix has row groups that may consist of several rows.
+     * @param modelType The model type written to the header of the file.
+     * @param bufferSize The number of entries that are buffered before they are written to the file.
+     */
+    OutOfCoreMatrixWriter(std::string const& filename, bool hasCustomRowGrouping, storm::models::ModelType modelType, uint64_t bufferSize = 1ull << 20);
+
+    /*!
+     * Appends the given entry. Rows must be given in non-decreasing order and within a row, the columns must be ascending.
+     */
+    void addNextValue(uint64_t row, uint64_t column, double const& value);
+
+    /*!
+     * Starts a new row group with the given first row.
+     */
+    void newRowGroup(uint64_t startingRow);
+
+    uint64_t getCurrentRowGroupCount() const;
+
+    /*!
+     * Writes the remaining entries and the row structure to the file and makes the matrix accessible.
+     *
+     * @param overriddenRowCount If larger than the number of rows that have entries, trailing empty rows are added.
+     * @param overriddenColumnCount If larger than the highest column plus one, this is the number of columns.
+     * @param overriddenRowGroupCount If larger than the number of started row groups, trailing empty row groups are added.
+     */
+    OutOfCoreMatrix build(uint64_t overriddenRowCount = 0, uint64_t overriddenColumnCount = 0, uint64_t overriddenRowGroupCount = 0);
+
+   private:
+    void flush();
+
+    std::string filename;
+    std::ofstream stream;
+    bool hasCustomRowGrouping;
+    uint64_t bufferSize;
+
+    std::vector<Entry> buffer;
+    std::vector<uint64_t> rowIndications;
+    std::vector<uint64_t> rowGroupIndices;
+    uint64_t numberOfEntries;
+    uint64_t highestColumn;
+    uint64_t lastRow;
+    uint64_t lastColumn;
+
+    // The positions (within the file) of the header fields that are only known once the matrix is complete.
+    std::streampos numberOfSectionsPosition;
+    std::streampos entriesSizePosition;
+    uint64_t entriesOffset;
+};
+
+}  // namespace storage
+}  // namespace storm
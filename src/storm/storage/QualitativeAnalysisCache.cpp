@@ -0,0 +1,52 @@
+#include "storm/storage/QualitativeAnalysisCache.h"
+
+namespace storm {
+namespace storage {
+
+QualitativeAnalysisCache::QualitativeAnalysisCache(uint64_t maximalNumberOfEntries) : maximalNumberOfEntries(maximalNumberOfEntries) {
+    // Intentionally left empty.
+}
+
+std::pair<BitVector, BitVector> QualitativeAnalysisCache::getOrCompute(AnalysisType type, BitVector const& constraintStates, BitVector const& targetStates,
+                                                                       std::function<std::pair<BitVector, BitVector>()> const& compute) {
+    KeyType key(type, CompressedBitVector(constraintStates), CompressedBitVector(targetStates));
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto entryIt = entries.find(key);
+        if (entryIt != entries.end()) {
+            return std::make_pair(entryIt->second.first.toBitVector(), entryIt->second.second.toBitVector());
+        }
+    }
+
+    // The computation may take long, so other threads can use the cache in the meantime.
+    std::pair<BitVector, BitVector> result = compute();
+    if (maximalNumberOfEntries == 0) {
+        return result;
+    }
+
+    auto compressedResult = std::make_pair(CompressedBitVector(result.first), CompressedBitVector(result.second));
+    std::lock_guard<std::mutex> lock(mutex);
+    auto insertionResult = entries.emplace(std::move(key), std::move(compressedResult));
+    if (insertionResult.second) {
+        insertionOrder.push_back(insertionResult.first);
+        if (insertionOrder.size() > maximalNumberOfEntries) {
+            entries.erase(insertionOrder.front());
+            insertionOrder.pop_front();
+        }
+    }
+    return result;
+}
+
+uint64_t QualitativeAnalysisCache::getNumberOfEntries() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+void QualitativeAnalysisCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    insertionOrder.clear();
+}
+
+}  // namespace storage
+}  // namespace storm
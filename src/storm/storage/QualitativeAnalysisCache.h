@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/CompressedBitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * Stores the results of qualitative (graph-based) analyses of a model such that they can be reused when several properties with the same constraint and
+ * target states are checked on the same model. The number of stored results is bounded and the oldest results are discarded first.
+ * The state sets are stored compressed, as they are typically (almost) empty or full and the cache lives as long as the model.
+ * All methods may be called concurrently.
+ */
+class QualitativeAnalysisCache {
+   public:
+    enum class AnalysisType {
+        // The states with probability 0 and 1 in a deterministic model.
+        Prob01,
+        // The states with minimal probability 0 and 1 in a nondeterministic model.
+        Prob01Min,
+        // The states with maximal probability 0 and 1 in a nondeterministic model.
+        Prob01Max
+    };
+
+    /*!
+     * Creates an empty cache.
+     *
+     * @param maximalNumberOfEntries The maximal number of results that are stored at the same time.
+     */
+    explicit QualitativeAnalysisCache(uint64_t maximalNumberOfEntries = 16);
+
+    /*!
+     * Retrieves the result of the given analysis for the given constraint and target states. If no such result is stored, it is computed with the given
+     * function and stored.
+     *
+     * @param type The type of the analysis.
+     * @param constraintStates The states that may be visited before a target state is reached.
+     * @param targetStates The target states.
+     * @param compute A function computing the result. It is called without holding a lock.
+     * @return The (possibly stored) result of the analysis.
+     */
+    std::pair<BitVector, BitVector> getOrCompute(AnalysisType type, BitVector const& constraintStates, BitVector const& targetStates,
+                                                 std::function<std::pair<BitVector, BitVector>()> const& compute);
+
+    /*!
+     * Retrieves the number of stored results.
+     */
+    uint64_t getNumberOfEntries() const;
+
+    /*!
+     * Discards all stored results.
+     */
+    void clear();
+
+   private:
+    typedef std::tuple<AnalysisType, CompressedBitVector, CompressedBitVector> KeyType;
+    typedef std::map<KeyType, std::pair<CompressedBitVector, CompressedBitVector>> MapType;
+
+    uint64_t maximalNumberOfEntries;
+    MapType entries;
+    // The stored entries in the order in which they were inserted.
+    std::deque<MapType::iterator> insertionOrder;
+    mutable std::mutex mutex;
+};
+
+}  // namespace storage
+}  // namespace storm
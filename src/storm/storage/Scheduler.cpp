@@ -4,6 +4,7 @@
 #include "storm/adapters/JsonAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/io/JsonWriter.h"
 #include "storm/storage/Scheduler.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
@@ -13,30 +14,78 @@ namespace storage {
 
 template<typename ValueType>
 Scheduler<ValueType>::Scheduler(uint_fast64_t numberOfModelStates, boost::optional<storm::storage::MemoryStructure> const& memoryStructure)
-    : memoryStructure(memoryStructure) {
-    uint_fast64_t numOfMemoryStates = memoryStructure ? memoryStructure->getNumberOfStates() : 1;
-    schedulerChoices = std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
-    dontCareStates = std::vector<storm::storage::BitVector>(numOfMemoryStates, storm::storage::BitVector(numberOfModelStates, false));
-    numOfUndefinedChoices = numOfMemoryStates * numberOfModelStates;
-    numOfDeterministicChoices = 0;
-    numOfDontCareStates = 0;
+    : Scheduler(numberOfModelStates, boost::optional<storm::storage::MemoryStructure>(memoryStructure)) {
+    // Intentionally left empty.
 }
 
 template<typename ValueType>
 Scheduler<ValueType>::Scheduler(uint_fast64_t numberOfModelStates, boost::optional<storm::storage::MemoryStructure>&& memoryStructure)
-    : memoryStructure(std::move(memoryStructure)) {
+    : memoryStructure(std::move(memoryStructure)), numberOfModelStates(numberOfModelStates) {
     uint_fast64_t numOfMemoryStates = this->memoryStructure ? this->memoryStructure->getNumberOfStates() : 1;
-    schedulerChoices = std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
+    if (numOfMemoryStates == 1) {
+        deterministicChoices.assign(numberOfModelStates, undefinedDeterministicChoice);
+    } else {
+        schedulerChoices =
+            std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
+    }
     dontCareStates = std::vector<storm::storage::BitVector>(numOfMemoryStates, storm::storage::BitVector(numberOfModelStates, false));
     numOfUndefinedChoices = numOfMemoryStates * numberOfModelStates;
     numOfDeterministicChoices = 0;
     numOfDontCareStates = 0;
 }
 
+template<typename ValueType>
+bool Scheduler<ValueType>::usesDenseRepresentation() const {
+    return schedulerChoices.empty();
+}
+
+template<typename ValueType>
+void Scheduler<ValueType>::switchToGeneralRepresentation() {
+    STORM_LOG_ASSERT(usesDenseRepresentation(), "The scheduler already uses the general representation.");
+    STORM_LOG_DEBUG("Storing a SchedulerChoice for each of the " << numberOfModelStates << " states of the scheduler.");
+    schedulerChoices.emplace_back(numberOfModelStates);
+    for (uint_fast64_t modelState = 0; modelState < numberOfModelStates; ++modelState) {
+        if (deterministicChoices[modelState] != undefinedDeterministicChoice) {
+            schedulerChoices.front()[modelState] = SchedulerChoice<ValueType>(deterministicChoices[modelState]);
+        }
+    }
+    std::vector<uint32_t>().swap(deterministicChoices);
+}
+
+template<typename ValueType>
+void Scheduler<ValueType>::setDenseChoice(uint32_t deterministicChoice, uint_fast64_t modelState) {
+    // In the dense representation, all defined choices are deterministic.
+    uint32_t& storedChoice = deterministicChoices[modelState];
+    if (storedChoice == undefinedDeterministicChoice) {
+        if (deterministicChoice != undefinedDeterministicChoice) {
+            assert(numOfUndefinedChoices > 0);
+            --numOfUndefinedChoices;
+            ++numOfDeterministicChoices;
+        }
+    } else if (deterministicChoice == undefinedDeterministicChoice) {
+        ++numOfUndefinedChoices;
+        assert(numOfDeterministicChoices > 0);
+        --numOfDeterministicChoices;
+    }
+    storedChoice = deterministicChoice;
+}
+
 template<typename ValueType>
 void Scheduler<ValueType>::setChoice(SchedulerChoice<ValueType> const& choice, uint_fast64_t modelState, uint_fast64_t memoryState) {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
+
+    if (usesDenseRepresentation()) {
+        if (!choice.isDefined()) {
+            setDenseChoice(undefinedDeterministicChoice, modelState);
+            return;
+        } else if (choice.isDeterministic() && choice.getDeterministicChoice() < undefinedDeterministicChoice &&
+                   storm::utility::isOne(choice.getChoiceAsDistribution().begin()->second)) {
+            setDenseChoice(choice.getDeterministicChoice(), modelState);
+            return;
+        }
+        switchToGeneralRepresentation();
+    }
 
     auto& schedulerChoice = schedulerChoices[memoryState][modelState];
 
@@ -64,11 +113,21 @@ void Scheduler<ValueType>::setChoice(SchedulerChoice<ValueType> const& choice, u
     schedulerChoice = choice;
 }
 
+template<typename ValueType>
+void Scheduler<ValueType>::setChoice(uint_fast64_t deterministicChoice, uint_fast64_t modelState, uint_fast64_t memoryState) {
+    if (usesDenseRepresentation() && deterministicChoice < undefinedDeterministicChoice) {
+        STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
+        setDenseChoice(deterministicChoice, modelState);
+    } else {
+        setChoice(SchedulerChoice<ValueType>(deterministicChoice), modelState, memoryState);
+    }
+}
+
 template<typename ValueType>
 bool Scheduler<ValueType>::isChoiceSelected(BitVector const& selectedStates, uint64_t memoryState) const {
     for (auto selectedState : selectedStates) {
-        auto& schedulerChoice = schedulerChoices[memoryState][selectedState];
-        if (!schedulerChoice.isDefined()) {
+        if (usesDenseRepresentation() ? deterministicChoices[selectedState] == undefinedDeterministicChoice
+                                      : !schedulerChoices[memoryState][selectedState].isDefined()) {
             return false;
         }
     }
@@ -78,25 +137,30 @@ bool Scheduler<ValueType>::isChoiceSelected(BitVector const& selectedStates, uin
 template<typename ValueType>
 void Scheduler<ValueType>::clearChoice(uint_fast64_t modelState, uint_fast64_t memoryState) {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
     setChoice(SchedulerChoice<ValueType>(), modelState, memoryState);
 }
 
 template<typename ValueType>
-SchedulerChoice<ValueType> const& Scheduler<ValueType>::getChoice(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+SchedulerChoice<ValueType> Scheduler<ValueType>::getChoice(uint_fast64_t modelState, uint_fast64_t memoryState) const {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
+    if (usesDenseRepresentation()) {
+        uint32_t deterministicChoice = deterministicChoices[modelState];
+        return deterministicChoice == undefinedDeterministicChoice ? SchedulerChoice<ValueType>() : SchedulerChoice<ValueType>(deterministicChoice);
+    }
     return schedulerChoices[memoryState][modelState];
 }
 
 template<typename ValueType>
 void Scheduler<ValueType>::setDontCare(uint_fast64_t modelState, uint_fast64_t memoryState, bool setArbitraryChoice) {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
 
     if (!dontCareStates[memoryState].get(modelState)) {
-        auto& schedulerChoice = schedulerChoices[memoryState][modelState];
-        if (!schedulerChoice.isDefined() && setArbitraryChoice) {
+        bool isDefined = usesDenseRepresentation() ? deterministicChoices[modelState] != undefinedDeterministicChoice
+                                                   : schedulerChoices[memoryState][modelState].isDefined();
+        if (!isDefined && setArbitraryChoice) {
             // Set an arbitrary choice
             this->setChoice(0, modelState, memoryState);
         }
@@ -108,7 +172,7 @@ void Scheduler<ValueType>::setDontCare(uint_fast64_t modelState, uint_fast64_t m
 template<typename ValueType>
 void Scheduler<ValueType>::unSetDontCare(uint_fast64_t modelState, uint_fast64_t memoryState) {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
 
     if (dontCareStates[memoryState].get(modelState)) {
         dontCareStates[memoryState].set(modelState, false);
@@ -126,8 +190,22 @@ storm::storage::BitVector Scheduler<ValueType>::computeActionSupport(std::vector
     auto nrActions = nondeterministicChoiceIndices.back();
     storm::storage::BitVector result(nrActions);
 
+    STORM_LOG_ASSERT(nondeterministicChoiceIndices.size() - 2 < numberOfModelStates, "Illegal model state index");
+    if (usesDenseRepresentation()) {
+        for (uint64_t stateId = 0; stateId < nondeterministicChoiceIndices.size() - 1; ++stateId) {
+            if (deterministicChoices[stateId] != undefinedDeterministicChoice) {
+                STORM_LOG_ASSERT(deterministicChoices[stateId] < nondeterministicChoiceIndices[stateId + 1] - nondeterministicChoiceIndices[stateId],
+                                 "Scheduler chooses action indexed " << deterministicChoices[stateId] << " in state id " << stateId
+                                                                     << " but state contains only "
+                                                                     << nondeterministicChoiceIndices[stateId + 1] - nondeterministicChoiceIndices[stateId]
+                                                                     << " choices .");
+                result.set(nondeterministicChoiceIndices[stateId] + deterministicChoices[stateId]);
+            }
+        }
+        return result;
+    }
+
     for (auto const& choicesPerMemoryNode : schedulerChoices) {
-        STORM_LOG_ASSERT(nondeterministicChoiceIndices.size() - 2 < choicesPerMemoryNode.size(), "Illegal model state index");
         for (uint64_t stateId = 0; stateId < nondeterministicChoiceIndices.size() - 1; ++stateId) {
             for (auto const& schedChoice : choicesPerMemoryNode[stateId].getChoiceAsDistribution()) {
                 STORM_LOG_ASSERT(schedChoice.first < nondeterministicChoiceIndices[stateId + 1] - nondeterministicChoiceIndices[stateId],
@@ -148,7 +226,7 @@ bool Scheduler<ValueType>::isPartialScheduler() const {
 
 template<typename ValueType>
 bool Scheduler<ValueType>::isDeterministicScheduler() const {
-    return numOfDeterministicChoices == (schedulerChoices.size() * schedulerChoices.begin()->size()) - numOfUndefinedChoices;
+    return numOfDeterministicChoices == (getNumberOfMemoryStates() * numberOfModelStates) - numOfUndefinedChoices;
 }
 
 template<typename ValueType>
@@ -161,6 +239,11 @@ uint_fast64_t Scheduler<ValueType>::getNumberOfMemoryStates() const {
     return memoryStructure ? memoryStructure->getNumberOfStates() : 1;
 }
 
+template<typename ValueType>
+uint_fast64_t Scheduler<ValueType>::getNumberOfModelStates() const {
+    return numberOfModelStates;
+}
+
 template<typename ValueType>
 boost::optional<storm::storage::MemoryStructure> const& Scheduler<ValueType>::getMemoryStructure() const {
     return memoryStructure;
@@ -169,15 +252,15 @@ boost::optional<storm::storage::MemoryStructure> const& Scheduler<ValueType>::ge
 template<typename ValueType>
 void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model, bool skipUniqueChoices,
                                          bool skipDontCareStates) const {
-    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == schedulerChoices.front().size(), storm::exceptions::InvalidOperationException,
+    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == numberOfModelStates, storm::exceptions::InvalidOperationException,
                     "The given model is not compatible with this scheduler.");
 
     bool const stateValuationsGiven = model != nullptr && model->hasStateValuations();
     bool const choiceLabelsGiven = model != nullptr && model->hasChoiceLabeling();
     bool const choiceOriginsGiven = model != nullptr && model->hasChoiceOrigins();
-    uint_fast64_t widthOfStates = std::to_string(schedulerChoices.front().size()).length();
+    uint_fast64_t widthOfStates = std::to_string(numberOfModelStates).length();
     if (stateValuationsGiven) {
-        widthOfStates += model->getStateValuations().getStateInfo(schedulerChoices.front().size() - 1).length() + 5;
+        widthOfStates += model->getStateValuations().getStateInfo(numberOfModelStates - 1).length() + 5;
     }
     widthOfStates = std::max(widthOfStates, (uint_fast64_t)12);
     uint_fast64_t numOfSkippedStatesWithUniqueChoice = 0;
@@ -193,7 +276,7 @@ void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<stor
     STORM_LOG_WARN_COND(!(skipUniqueChoices && model == nullptr), "Can not skip unique choices if the model is not given.");
     out << std::setw(widthOfStates) << "model state:"
         << "    " << (isMemorylessScheduler() ? "" : " memory:     ") << "choice(s)" << (isMemorylessScheduler() ? "" : "     memory updates:     ") << '\n';
-    for (uint_fast64_t state = 0; state < schedulerChoices.front().size(); ++state) {
+    for (uint_fast64_t state = 0; state < numberOfModelStates; ++state) {
         // Check whether the state is skipped
         if (skipUniqueChoices && model != nullptr && model->getTransitionMatrix().getRowGroupSize(state) == 1) {
             ++numOfSkippedStatesWithUniqueChoice;
@@ -228,7 +311,7 @@ void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<stor
             }
 
             // Print choice info
-            SchedulerChoice<ValueType> const& choice = schedulerChoices[memoryState][state];
+            SchedulerChoice<ValueType> const choice = getChoice(state, memoryState);
             if (choice.isDefined()) {
                 if (choice.isDeterministic()) {
                     if (choiceOriginsGiven) {
@@ -304,11 +387,14 @@ void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<stor
 template<typename ValueType>
 void Scheduler<ValueType>::printJsonToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model, bool skipUniqueChoices,
                                              bool skipDontCareStates) const {
-    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == schedulerChoices.front().size(), storm::exceptions::InvalidOperationException,
+    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == numberOfModelStates, storm::exceptions::InvalidOperationException,
                     "The given model is not compatible with this scheduler.");
     STORM_LOG_WARN_COND(!(skipUniqueChoices && model == nullptr), "Can not skip unique choices if the model is not given.");
-    storm::json<storm::RationalNumber> output;
-    for (uint64_t state = 0; state < schedulerChoices.front().size(); ++state) {
+    // The entries are written one after another instead of building the json representation of the whole scheduler first. The result is formatted like
+    // storm::dumpJson, so the keys of every object are written in lexicographic order.
+    storm::exporter::JsonWriter writer(out);
+    bool firstEntry = true;
+    for (uint64_t state = 0; state < numberOfModelStates; ++state) {
         // Check whether the state is skipped
         if (skipUniqueChoices && model != nullptr && model->getTransitionMatrix().getRowGroupSize(state) == 1) {
             continue;
@@ -320,65 +406,83 @@ void Scheduler<ValueType>::printJsonToStream(std::ostream& out, std::shared_ptr<
                 continue;
             }
 
-            storm::json<storm::RationalNumber> stateChoicesJson;
-            if (model && model->hasStateValuations()) {
-                stateChoicesJson["s"] = model->getStateValuations().template toJson<storm::RationalNumber>(state);
-            } else {
-                stateChoicesJson["s"] = state;
-            }
-
-            if (!isMemorylessScheduler()) {
-                stateChoicesJson["m"] = memoryState;
+            if (firstEntry) {
+                writer.beginArray();
+                firstEntry = false;
             }
-
-            auto const& choice = schedulerChoices[memoryState][state];
-            storm::json<storm::RationalNumber> choicesJson;
+            writer.beginObject();
+            writer.key("c");
+            auto const choice = getChoice(state, memoryState);
             if (choice.isDefined()) {
+                writer.beginArray();
                 for (auto const& choiceProbPair : choice.getChoiceAsDistribution()) {
                     uint64_t globalChoiceIndex = model->getTransitionMatrix().getRowGroupIndices()[state] + choiceProbPair.first;
-                    storm::json<storm::RationalNumber> choiceJson;
-                    if (model && model->hasChoiceOrigins() &&
-                        model->getChoiceOrigins()->getIdentifier(globalChoiceIndex) != model->getChoiceOrigins()->getIdentifierForChoicesWithNoOrigin()) {
-                        choiceJson["origin"] = model->getChoiceOrigins()->getChoiceAsJson(globalChoiceIndex);
-                    }
+                    writer.beginObject();
+                    writer.key("index").value(globalChoiceIndex);
                     if (model && model->hasChoiceLabeling()) {
                         auto choiceLabels = model->getChoiceLabeling().getLabelsOfChoice(globalChoiceIndex);
-                        choiceJson["labels"] = std::vector<std::string>(choiceLabels.begin(), choiceLabels.end());
+                        writer.key("labels").beginArray();
+                        for (auto const& label : choiceLabels) {
+                            writer.value(label);
+                        }
+                        writer.endArray();
                     }
-                    choiceJson["index"] = globalChoiceIndex;
-                    choiceJson["prob"] = storm::utility::convertNumber<storm::RationalNumber>(choiceProbPair.second);
 
                     // Memory updates
                     if (!isMemorylessScheduler()) {
                         STORM_LOG_THROW(model != nullptr, storm::exceptions::InvalidOperationException,
                                         "Schedulers with memory can only be printed when the model is passed.");
-                        choiceJson["memory-updates"] = std::vector<storm::json<storm::RationalNumber>>();
+                        writer.key("memory-updates").beginArray();
                         uint64_t row = model->getTransitionMatrix().getRowGroupIndices()[state] + choiceProbPair.first;
                         for (auto entryIt = model->getTransitionMatrix().getRow(row).begin(); entryIt < model->getTransitionMatrix().getRow(row).end();
                              ++entryIt) {
-                            storm::json<storm::RationalNumber> updateJson;
+                            writer.beginObject();
+                            // next memory state
+                            writer.key("m'").value(this->memoryStructure->getSuccessorMemoryState(memoryState, entryIt - model->getTransitionMatrix().begin()));
                             // next model state
+                            writer.key("s'");
                             if (model && model->hasStateValuations()) {
-                                updateJson["s'"] = model->getStateValuations().template toJson<storm::RationalNumber>(entryIt->getColumn());
+                                writer.value(model->getStateValuations().template toJson<storm::RationalNumber>(entryIt->getColumn()));
                             } else {
-                                updateJson["s'"] = entryIt->getColumn();
+                                writer.value(entryIt->getColumn());
                             }
-                            // next memory state
-                            updateJson["m'"] = this->memoryStructure->getSuccessorMemoryState(memoryState, entryIt - model->getTransitionMatrix().begin());
-                            choiceJson["memory-updates"].push_back(std::move(updateJson));
+                            writer.endObject();
                         }
+                        writer.endArray();
                     }
 
-                    choicesJson.push_back(std::move(choiceJson));
+                    if (model && model->hasChoiceOrigins() &&
+                        model->getChoiceOrigins()->getIdentifier(globalChoiceIndex) != model->getChoiceOrigins()->getIdentifierForChoicesWithNoOrigin()) {
+                        writer.key("origin").value(model->getChoiceOrigins()->getChoiceAsJson(globalChoiceIndex));
+                    }
+                    writer.key("prob").value(storm::utility::convertNumber<storm::RationalNumber>(choiceProbPair.second));
+                    writer.endObject();
                 }
+                writer.endArray();
+            } else {
+                writer.value("undefined");
+            }
+
+            if (!isMemorylessScheduler()) {
+                writer.key("m").value(memoryState);
+            }
+
+            writer.key("s");
+            if (model && model->hasStateValuations()) {
+                writer.value(model->getStateValuations().template toJson<storm::RationalNumber>(state));
             } else {
-                choicesJson = "undefined";
+                writer.value(state);
             }
-            stateChoicesJson["c"] = std::move(choicesJson);
-            output.push_back(std::move(stateChoicesJson));
+            writer.endObject();
         }
     }
-    out << storm::dumpJson(output);
+    if (firstEntry) {
+        // No entry has been written, which storm::dumpJson would export as null.
+        writer.null();
+    } else {
+        writer.endArray();
+    }
+    writer.flush();
 }
 
 template class Scheduler<double>;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SchedulerChoice.h"
 #include "storm/storage/memorystructure/MemoryStructure.h"
@@ -13,6 +14,9 @@ namespace storage {
  * This class defines which action is chosen in a particular state of a non-deterministic model. More concretely, a scheduler maps a state s to i
  * if the scheduler takes the i-th action available in s (i.e. the choices are relative to the states).
  * A Choice can be undefined, deterministic
+ *
+ * As long as the scheduler is memoryless and all its choices are deterministic, the choices are stored densely, i.e., with a single index per state.
+ * Only when memory or a randomized choice is needed, the scheduler switches to storing a SchedulerChoice for each pair of model and memory state.
  */
 template<typename ValueType>
 class Scheduler {
@@ -35,6 +39,15 @@ class Scheduler {
      */
     void setChoice(SchedulerChoice<ValueType> const& choice, uint_fast64_t modelState, uint_fast64_t memoryState = 0);
 
+    /*!
+     * Sets the given deterministic choice for the given state. In contrast to passing a SchedulerChoice, this does not allocate memory for the choice.
+     *
+     * @param deterministicChoice The (local) index of the choice to set for the given state.
+     * @param modelState The state of the model for which to set the choice.
+     * @param memoryState The state of the memoryStructure for which to set the choice.
+     */
+    void setChoice(uint_fast64_t deterministicChoice, uint_fast64_t modelState, uint_fast64_t memoryState = 0);
+
     /*!
      * Is the scheduler defined on the states indicated by the selected-states bitvector?
      */
@@ -54,7 +67,7 @@ class Scheduler {
      * @param state The state for which to get the choice.
      * @param memoryState the memory state which we consider.
      */
-    SchedulerChoice<ValueType> const& getChoice(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
+    SchedulerChoice<ValueType> getChoice(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
 
     /*!
      * Set the combination of model state and memoryStructure state to dontCare.
@@ -105,6 +118,11 @@ class Scheduler {
      */
     uint_fast64_t getNumberOfMemoryStates() const;
 
+    /*!
+     * Retrieves the number of model states this scheduler considers.
+     */
+    uint_fast64_t getNumberOfModelStates() const;
+
     /*!
      * Retrieves the memory structure associated with this scheduler
      */
@@ -115,11 +133,16 @@ class Scheduler {
      */
     template<typename NewValueType>
     Scheduler<NewValueType> toValueType() const {
-        uint_fast64_t numModelStates = schedulerChoices.front().size();
-        Scheduler<NewValueType> newScheduler(numModelStates, memoryStructure);
+        Scheduler<NewValueType> newScheduler(numberOfModelStates, memoryStructure);
         for (uint_fast64_t memState = 0; memState < this->getNumberOfMemoryStates(); ++memState) {
-            for (uint_fast64_t modelState = 0; modelState < numModelStates; ++modelState) {
-                newScheduler.setChoice(getChoice(modelState, memState).template toValueType<NewValueType>(), modelState, memState);
+            for (uint_fast64_t modelState = 0; modelState < numberOfModelStates; ++modelState) {
+                if (usesDenseRepresentation()) {
+                    if (deterministicChoices[modelState] != undefinedDeterministicChoice) {
+                        newScheduler.setChoice(deterministicChoices[modelState], modelState, memState);
+                    }
+                } else {
+                    newScheduler.setChoice(schedulerChoices[memState][modelState].template toValueType<NewValueType>(), modelState, memState);
+                }
             }
         }
         return newScheduler;
@@ -150,7 +173,29 @@ class Scheduler {
                            bool skipDontCareStates = false) const;
 
    private:
+    /*!
+     * Retrieves whether the choices are stored densely (see the class description).
+     */
+    bool usesDenseRepresentation() const;
+
+    /*!
+     * Converts the densely stored choices into scheduler choices.
+     */
+    void switchToGeneralRepresentation();
+
+    /*!
+     * Sets the densely stored choice for the given state and updates the statistics.
+     */
+    void setDenseChoice(uint32_t deterministicChoice, uint_fast64_t modelState);
+
+    // Marks undefined choices in the dense representation.
+    static const uint32_t undefinedDeterministicChoice = std::numeric_limits<uint32_t>::max();
+
     boost::optional<storm::storage::MemoryStructure> memoryStructure;
+    uint_fast64_t numberOfModelStates;
+    // The densely stored choices. Empty if the scheduler choices are used instead.
+    std::vector<uint32_t> deterministicChoices;
+    // The choices for each memory and model state. Empty as long as the choices are stored densely.
     std::vector<std::vector<SchedulerChoice<ValueType>>> schedulerChoices;
     std::vector<storm::storage::BitVector> dontCareStates;
     uint_fast64_t numOfUndefinedChoices;
@@ -1,6 +1,8 @@
+#include <algorithm>
 #include <boost/functional/hash.hpp>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/SmallRationalNumber.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/StateType.h"
 
@@ -399,6 +401,8 @@ void print(std::vector<typename SparseMatrix<ValueType>::index_type> const& rowG
 template<typename ValueType>
 void SparseMatrixBuilder<ValueType>::replaceColumns(std::vector<index_type> const& replacements, index_type offset) {
     index_type maxColumn = 0;
+    // Entries of a row that are replaced by the same column are merged, so the entries are moved to the front.
+    index_type writePosition = 0;
 
     for (index_type row = 0; row < rowIndications.size(); ++row) {
         bool changed = false;
@@ -416,14 +420,22 @@ void SparseMatrixBuilder<ValueType>::replaceColumns(std::vector<index_type> cons
             // Sort columns in row
             std::sort(startRow, endRow,
                       [](MatrixEntry<index_type, value_type> const& a, MatrixEntry<index_type, value_type> const& b) { return a.getColumn() < b.getColumn(); });
-            // Assert no equal elements
-            STORM_LOG_ASSERT(std::is_sorted(startRow, endRow,
-                                            [](MatrixEntry<index_type, value_type> const& a, MatrixEntry<index_type, value_type> const& b) {
-                                                return a.getColumn() < b.getColumn();
-                                            }),
-                             "Columns not sorted.");
         }
+        index_type const rowStart = writePosition;
+        for (auto entry = startRow; entry != endRow; ++entry) {
+            if (writePosition > rowStart && columnsAndValues[writePosition - 1].getColumn() == entry->getColumn()) {
+                columnsAndValues[writePosition - 1].setValue(columnsAndValues[writePosition - 1].getValue() + entry->getValue());
+            } else {
+                if (std::next(columnsAndValues.begin(), writePosition) != entry) {
+                    columnsAndValues[writePosition] = std::move(*entry);
+                }
+                ++writePosition;
+            }
+        }
+        rowIndications[row] = rowStart;
     }
+    columnsAndValues.resize(writePosition);
+    currentEntryCount = writePosition;
 
     highestColumn = maxColumn;
     lastColumn = columnsAndValues.empty() ? 0 : columnsAndValues.back().getColumn();
@@ -1121,6 +1133,20 @@ template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrix(bool useGroups, storm::storage::BitVector const& rowConstraint,
                                                               storm::storage::BitVector const& columnConstraint, bool insertDiagonalElements,
                                                               storm::storage::BitVector const& makeZeroColumns) const {
+    // If all rows and columns are kept, the submatrix coincides with this matrix. We then copy the matrix instead of rebuilding it entry by entry.
+    if (!insertDiagonalElements && makeZeroColumns.empty() && rowConstraint.full() && !rowConstraint.empty() && columnConstraint.full() &&
+        columnConstraint.size() == this->getColumnCount() && rowConstraint.size() == (useGroups ? this->getRowGroupCount() : this->getRowCount())) {
+        // Without groups, empty row groups would be dropped.
+        bool hasEmptyRowGroups = false;
+        if (!useGroups && !this->hasTrivialRowGrouping()) {
+            auto const& groupIndices = this->getRowGroupIndices();
+            hasEmptyRowGroups = std::adjacent_find(groupIndices.begin(), groupIndices.end()) != groupIndices.end();
+        }
+        if (!hasEmptyRowGroups) {
+            return *this;
+        }
+    }
+
     if (useGroups) {
         return getSubmatrix(rowConstraint, columnConstraint, this->getRowGroupIndices(), insertDiagonalElements, makeZeroColumns);
     } else {
@@ -2613,6 +2639,17 @@ void SparseMatrix<ValueType>::printAsMatlabMatrix(std::ostream& out) const {
     }
 }
 
+template<typename ValueType>
+std::size_t SparseMatrix<ValueType>::getSizeInBytes() const {
+    std::size_t result = sizeof(*this);
+    result += columnsAndValues.capacity() * sizeof(MatrixEntry<index_type, value_type>);
+    result += rowIndications.capacity() * sizeof(index_type);
+    if (rowGroupIndices) {
+        result += rowGroupIndices->capacity() * sizeof(index_type);
+    }
+    return result;
+}
+
 template<typename ValueType>
 std::size_t SparseMatrix<ValueType>::hash() const {
     std::size_t result = 0;
@@ -2690,6 +2727,14 @@ template std::vector<storm::GmpRationalNumber> SparseMatrix<GmpRationalNumber>::
 template bool SparseMatrix<storm::GmpRationalNumber>::isSubmatrixOf(SparseMatrix<storm::GmpRationalNumber> const& matrix) const;
 #endif
 
+// Small rational numbers
+template class MatrixEntry<typename SparseMatrix<SmallRationalNumber>::index_type, SmallRationalNumber>;
+template std::ostream& operator<<(std::ostream& out, MatrixEntry<typename SparseMatrix<SmallRationalNumber>::index_type, SmallRationalNumber> const& entry);
+template class SparseMatrixBuilder<SmallRationalNumber>;
+template class SparseMatrix<SmallRationalNumber>;
+template std::ostream& operator<<(std::ostream& out, SparseMatrix<SmallRationalNumber> const& matrix);
+template bool SparseMatrix<storm::SmallRationalNumber>::isSubmatrixOf(SparseMatrix<storm::SmallRationalNumber> const& matrix) const;
+
 // Rational Function
 template class MatrixEntry<typename SparseMatrix<RationalFunction>::index_type, RationalFunction>;
 template std::ostream& operator<<(std::ostream& out, MatrixEntry<typename SparseMatrix<RationalFunction>::index_type, RationalFunction> const& entry);
@@ -233,7 +233,7 @@ class SparseMatrixBuilder {
     /*!
      * Replaces all columns with id > offset according to replacements.
      * Every state  with id offset+i is replaced by the id in replacements[i].
-     * Afterwards the columns are sorted.
+     * Afterwards the columns are sorted and entries of the same row that obtained the same column are merged.
      *
      * @param replacements Mapping indicating the replacements from offset+i -> value of i.
      * @param offset Offset to add to each id in vector index.
@@ -1077,6 +1077,13 @@ class SparseMatrix {
      */
     std::size_t hash() const;
 
+    /*!
+     * Retrieves the (approximate) size of the matrix in memory, i.e., the memory allocated for its entries, row indications and row groups.
+     *
+     * @return The size of the matrix measured in bytes.
+     */
+    std::size_t getSizeInBytes() const;
+
     /*!
      * Returns an object representing the consecutive rows given by the parameters.
      *
@@ -0,0 +1,244 @@
+#include "storm/storage/SplitSparseMatrix.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType, typename ColumnIndexType>
+SplitSparseMatrix<ValueType, ColumnIndexType>::Entry::Entry(ColumnIndexType const* column, ValueType const* value) : column(column), value(value) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename SplitSparseMatrix<ValueType, ColumnIndexType>::index_type SplitSparseMatrix<ValueType, ColumnIndexType>::Entry::getColumn() const {
+    return *column;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+ValueType const& SplitSparseMatrix<ValueType, ColumnIndexType>::Entry::getValue() const {
+    return *value;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+SplitSparseMatrix<ValueType, ColumnIndexType>::const_iterator::const_iterator(ColumnIndexType const* column, ValueType const* value)
+    : column(column), value(value) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename SplitSparseMatrix<ValueType, ColumnIndexType>::Entry SplitSparseMatrix<ValueType, ColumnIndexType>::const_iterator::operator*() const {
+    return Entry(column, value);
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename SplitSparseMatrix<ValueType, ColumnIndexType>::const_iterator& SplitSparseMatrix<ValueType, ColumnIndexType>::const_iterator::operator++() {
+    ++column;
+    ++value;
+    return *this;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename SplitSparseMatrix<ValueType, ColumnIndexType>::const_iterator SplitSparseMatrix<ValueType, ColumnIndexType>::const_iterator::operator+(
+    index_type offset) const {
+    return const_iterator(column + offset, value + offset);
+}
+
+template<typename ValueType, typename ColumnIndexType>
+bool SplitSparseMatrix<ValueType, ColumnIndexType>::const_iterator::operator==(const_iterator const& other) const {
+    return column == other.column;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+bool SplitSparseMatrix<ValueType, ColumnIndexType>::const_iterator::operator!=(const_iterator const& other) const {
+    return column != other.column;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+SplitSparseMatrix<ValueType, ColumnIndexType>::const_rows::const_rows(const_iterator begin, index_type entryCount)
+    : beginIterator(begin), entryCount(entryCount) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename SplitSparseMatrix<ValueType, ColumnIndexType>::const_iterator SplitSparseMatrix<ValueType, ColumnIndexType>::const_rows::begin() const {
+    return beginIterator;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename SplitSparseMatrix<ValueType, ColumnIndexType>::const_iterator SplitSparseMatrix<ValueType, ColumnIndexType>::const_rows::end() const {
+    return beginIterator + entryCount;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename SplitSparseMatrix<ValueType, ColumnIndexType>::index_type SplitSparseMatrix<ValueType, ColumnIndexType>::const_rows::getNumberOfEntries() const {
+    return entryCount;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+SplitSparseMatrix<ValueType, ColumnIndexType>::SplitSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : columnCount(matrix.getColumnCount()), rowIndications(matrix.getRowCount() + 1) {
+    STORM_LOG_THROW(fitsColumnIndexType(matrix), storm::exceptions::InvalidArgumentException,
+                    "The matrix has " << matrix.getColumnCount() << " columns, which exceeds the range of the column index type.");
+    columns.reserve(matrix.getEntryCount());
+    values.reserve(matrix.getEntryCount());
+    rowIndications[0] = 0;
+    for (index_type row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            columns.push_back(static_cast<ColumnIndexType>(entry.getColumn()));
+            values.push_back(entry.getValue());
+        }
+        rowIndications[row + 1] = columns.size();
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType>
+bool SplitSparseMatrix<ValueType, ColumnIndexType>::fitsColumnIndexType(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    return matrix.getColumnCount() == 0 || matrix.getColumnCount() - 1 <= static_cast<uint64_t>(std::numeric_limits<ColumnIndexType>::max());
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename SplitSparseMatrix<ValueType, ColumnIndexType>::index_type SplitSparseMatrix<ValueType, ColumnIndexType>::getRowCount() const {
+    return rowIndications.size() - 1;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename SplitSparseMatrix<ValueType, ColumnIndexType>::index_type SplitSparseMatrix<ValueType, ColumnIndexType>::getColumnCount() const {
+    return columnCount;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename SplitSparseMatrix<ValueType, ColumnIndexType>::index_type SplitSparseMatrix<ValueType, ColumnIndexType>::getEntryCount() const {
+    return columns.size();
+}
+
+template<typename ValueType, typename ColumnIndexType>
+std::vector<typename SplitSparseMatrix<ValueType, ColumnIndexType>::index_type> const& SplitSparseMatrix<ValueType, ColumnIndexType>::getRowIndications() const {
+    return rowIndications;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+std::vector<ColumnIndexType> const& SplitSparseMatrix<ValueType, ColumnIndexType>::getColumns() const {
+    return columns;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+std::vector<ValueType> const& SplitSparseMatrix<ValueType, ColumnIndexType>::getValues() const {
+    return values;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename SplitSparseMatrix<ValueType, ColumnIndexType>::const_rows SplitSparseMatrix<ValueType, ColumnIndexType>::getRow(index_type row) const {
+    return const_rows(begin(row), rowIndications[row + 1] - rowIndications[row]);
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename SplitSparseMatrix<ValueType, ColumnIndexType>::const_iterator SplitSparseMatrix<ValueType, ColumnIndexType>::begin(index_type row) const {
+    return const_iterator(columns.data() + rowIndications[row], values.data() + rowIndications[row]);
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename SplitSparseMatrix<ValueType, ColumnIndexType>::const_iterator SplitSparseMatrix<ValueType, ColumnIndexType>::end(index_type row) const {
+    return begin(row + 1);
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename SplitSparseMatrix<ValueType, ColumnIndexType>::const_iterator SplitSparseMatrix<ValueType, ColumnIndexType>::end() const {
+    return const_iterator(columns.data() + columns.size(), values.data() + values.size());
+}
+
+template<typename ValueType, typename ColumnIndexType>
+void SplitSparseMatrix<ValueType, ColumnIndexType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                                       std::vector<ValueType> const* summand) const {
+    STORM_LOG_ASSERT(&vector != &result, "Vectors must not be aliased.");
+    ColumnIndexType const* columnIt = columns.data();
+    ValueType const* valueIt = values.data();
+    ValueType const* x = vector.data();
+    index_type const rowCount = getRowCount();
+    for (index_type row = 0; row < rowCount; ++row) {
+        ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        for (ColumnIndexType const* columnIte = columns.data() + rowIndications[row + 1]; columnIt != columnIte; ++columnIt, ++valueIt) {
+            newValue += *valueIt * x[*columnIt];
+        }
+        result[row] = newValue;
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType>
+void SplitSparseMatrix<ValueType, ColumnIndexType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir,
+                                                                      std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                                                      std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                                      std::vector<uint64_t>* choices) const {
+    if (dir == storm::OptimizationDirection::Minimize) {
+        multiplyAndReduce<storm::utility::ElementLess<ValueType>>(rowGroupIndices, vector, summand, result, choices);
+    } else {
+        multiplyAndReduce<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, vector, summand, result, choices);
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType>
+template<typename Compare>
+void SplitSparseMatrix<ValueType, ColumnIndexType>::multiplyAndReduce(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                                                      std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                                      std::vector<uint64_t>* choices) const {
+    STORM_LOG_ASSERT(&vector != &result, "Vectors must not be aliased.");
+    Compare compare;
+    ColumnIndexType const* columnIt = columns.data();
+    ValueType const* valueIt = values.data();
+    ValueType const* x = vector.data();
+    auto multiplyRow = [&](index_type row) {
+        ValueType rowValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        for (ColumnIndexType const* columnIte = columns.data() + rowIndications[row + 1]; columnIt != columnIte; ++columnIt, ++valueIt) {
+            rowValue += *valueIt * x[*columnIt];
+        }
+        return rowValue;
+    };
+
+    index_type const groupCount = result.size();
+    for (index_type group = 0; group < groupCount; ++group) {
+        index_type const groupStart = rowGroupIndices[group];
+        index_type const groupEnd = rowGroupIndices[group + 1];
+
+        // Only multiply and reduce if there is at least one row in the group.
+        if (groupStart == groupEnd) {
+            continue;
+        }
+
+        ValueType currentValue = multiplyRow(groupStart);
+        // Variables for correctly tracking choices (only update if new choice is strictly better).
+        uint64_t selectedChoice = 0;
+        ValueType oldSelectedChoiceValue;
+        if (choices && (*choices)[group] == 0) {
+            oldSelectedChoiceValue = currentValue;
+        }
+
+        for (index_type row = groupStart + 1; row < groupEnd; ++row) {
+            ValueType newValue = multiplyRow(row);
+            if (choices && row == (*choices)[group] + groupStart) {
+                oldSelectedChoiceValue = newValue;
+            }
+            if (compare(newValue, currentValue)) {
+                currentValue = newValue;
+                selectedChoice = row - groupStart;
+            }
+        }
+
+        result[group] = currentValue;
+        if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+    }
+}
+
+template class SplitSparseMatrix<double, uint32_t>;
+template class SplitSparseMatrix<double, uint64_t>;
+template class SplitSparseMatrix<storm::RationalNumber, uint32_t>;
+template class SplitSparseMatrix<storm::RationalNumber, uint64_t>;
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+class SparseMatrix;
+
+/*!
+ * A read-only copy of a sparse matrix in which the column indices and the values of the entries are stored in two separate arrays
+ * (structure-of-arrays) instead of one array of (column, value) pairs. For doubles and 32-bit column indices, this reduces the
+ * size of an entry from 16 to 12 bytes and lets the multiplication kernels stream over densely packed columns and values, which
+ * reduces the memory traffic of bandwidth-bound iterative methods.
+ *
+ * @tparam ValueType The type of the matrix entries.
+ * @tparam ColumnIndexType The type used to store column indices. The number of columns must be representable by this type.
+ */
+template<typename ValueType, typename ColumnIndexType = uint64_t>
+class SplitSparseMatrix {
+   public:
+    typedef uint64_t index_type;
+    typedef ValueType value_type;
+
+    /*!
+     * A (column, value) pair referring to an entry of the matrix. It offers the same accessors as MatrixEntry so that code iterating over
+     * the rows of a matrix can be used for both representations.
+     */
+    class Entry {
+       public:
+        Entry(ColumnIndexType const* column, ValueType const* value);
+
+        index_type getColumn() const;
+        ValueType const& getValue() const;
+
+       private:
+        ColumnIndexType const* column;
+        ValueType const* value;
+    };
+
+    /*!
+     * An iterator over the entries of a number of consecutive rows.
+     */
+    class const_iterator {
+       public:
+        const_iterator(ColumnIndexType const* column, ValueType const* value);
+
+        Entry operator*() const;
+        const_iterator& operator++();
+        const_iterator operator+(index_type offset) const;
+        bool operator==(const_iterator const& other) const;
+        bool operator!=(const_iterator const& other) const;
+
+       private:
+        ColumnIndexType const* column;
+        ValueType const* value;
+    };
+
+    /*!
+     * The range of entries of a number of consecutive rows.
+     */
+    class const_rows {
+       public:
+        const_rows(const_iterator begin, index_type entryCount);
+
+        const_iterator begin() const;
+        const_iterator end() const;
+        index_type getNumberOfEntries() const;
+
+       private:
+        const_iterator beginIterator;
+        index_type entryCount;
+    };
+
+    /*!
+     * Creates an empty matrix.
+     */
+    SplitSparseMatrix() = default;
+
+    /*!
+     * Creates a copy of the given matrix in the split representation.
+     *
+     * @param matrix The matrix to copy. Its column count must be representable by the column index type.
+     */
+    explicit SplitSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Checks whether the columns of the given matrix can be represented by the given column index type.
+     */
+    static bool fitsColumnIndexType(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    index_type getRowCount() const;
+    index_type getColumnCount() const;
+    index_type getEntryCount() const;
+
+    /*!
+     * Retrieves the raw arrays of this matrix, e.g., to hand them to specialized multiplication kernels.
+     */
+    std::vector<index_type> const& getRowIndications() const;
+    std::vector<ColumnIndexType> const& getColumns() const;
+    std::vector<ValueType> const& getValues() const;
+
+    /*!
+     * Retrieves the entries of the given row.
+     */
+    const_rows getRow(index_type row) const;
+
+    /*!
+     * Retrieves an iterator pointing to the first entry of the given row.
+     */
+    const_iterator begin(index_type row = 0) const;
+
+    /*!
+     * Retrieves an iterator pointing past the last entry of the given row.
+     */
+    const_iterator end(index_type row) const;
+
+    /*!
+     * Retrieves an iterator pointing past the last entry of the matrix.
+     */
+    const_iterator end() const;
+
+    /*!
+     * Performs result = A * vector + summand, with the same semantics as SparseMatrix::multiplyWithVector.
+     *
+     * @param vector The vector with which to multiply the matrix.
+     * @param result The vector into which to write the result. It must not be an alias of the input vector.
+     * @param summand If given, this vector is added to the product.
+     */
+    void multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand = nullptr) const;
+
+    /*!
+     * Multiplies the matrix with the given vector and reduces the results of the rows within each row group, with the same semantics as
+     * SparseMatrix::multiplyAndReduce.
+     *
+     * @param dir The optimization direction of the reduction.
+     * @param rowGroupIndices The row groups over which to reduce.
+     * @param vector The vector with which to multiply the matrix.
+     * @param summand If given, this vector is added to the product.
+     * @param result The vector into which to write the result. It must not be an alias of the input vector.
+     * @param choices If given, the selected choices are written to this vector (and only updated if the new choice is strictly better).
+     */
+    void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                           std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+
+   private:
+    template<typename Compare>
+    void multiplyAndReduce(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                           std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+
+    // The number of columns of the matrix.
+    index_type columnCount = 0;
+
+    // The position of the first entry of each row (plus one trailing element pointing past the last entry).
+    std::vector<index_type> rowIndications = {0};
+
+    // The column indices of all entries.
+    std::vector<ColumnIndexType> columns;
+
+    // The values of all entries.
+    std::vector<ValueType> values;
+};
+
+}  // namespace storage
+}  // namespace storm
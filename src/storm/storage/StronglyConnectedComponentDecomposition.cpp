@@ -1,9 +1,17 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/UnexpectedException.h"
@@ -40,6 +48,11 @@ StronglyConnectedComponentDecompositionOptions& StronglyConnectedComponentDecomp
     return *this;
 }
 
+StronglyConnectedComponentDecompositionOptions& StronglyConnectedComponentDecompositionOptions::numberOfThreads(uint64_t value) {
+    optNumberOfThreads = value;
+    return *this;
+}
+
 void SccDecompositionMemoryCache::initialize(uint64_t numStates) {
     preorderNumbers.assign(numStates, std::numeric_limits<uint64_t>::max());
     recursionStateStack.clear();
@@ -223,11 +236,360 @@ void performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& t
     }
 }
 
+namespace {
+
+// The number of states below which SCCs are computed sequentially as the parallel algorithm does not pay off.
+uint64_t const MinimalNumberOfStatesForParallelSccDecomposition = 100000;
+
+// The number of items (states or SCCs) below which a round of the parallel algorithm is processed by the calling thread only.
+uint64_t const MinimalNumberOfItemsPerThread = 4096;
+
+uint64_t const NoScc = std::numeric_limits<uint64_t>::max();
+
+/*!
+ * Calls the given function as function(threadIndex, element) for every element of the given vector, using (at most) the given number of threads.
+ *
+ * @return The number of thread indices that have been used.
+ */
+template<typename Function>
+uint64_t forEachElement(uint64_t numberOfThreads, std::vector<uint64_t> const& elements, Function const& function) {
+    if (elements.size() < MinimalNumberOfItemsPerThread) {
+        numberOfThreads = 1;
+    }
+    return storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(elements.size()),
+                                                  [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+                                                      for (uint64_t index = begin; index != end; ++index) {
+                                                          function(threadIndex, elements[index]);
+                                                      }
+                                                  });
+}
+
+/*!
+ * Collects the elements produced by the given function, which is invoked as function(element, output) for every element of the given vector and may push
+ * elements to output. The result is independent of the number of threads.
+ */
+template<typename Function>
+std::vector<uint64_t> collect(uint64_t numberOfThreads, std::vector<uint64_t> const& elements, Function const& function) {
+    std::vector<std::vector<uint64_t>> threadResults(std::max<uint64_t>(1, numberOfThreads));
+    uint64_t usedThreads =
+        forEachElement(numberOfThreads, elements, [&](uint64_t threadIndex, uint64_t element) { function(element, threadResults[threadIndex]); });
+    std::vector<uint64_t> result;
+    for (uint64_t threadIndex = 0; threadIndex < usedThreads; ++threadIndex) {
+        result.insert(result.end(), threadResults[threadIndex].begin(), threadResults[threadIndex].end());
+    }
+    return result;
+}
+
+/*!
+ * Atomically sets the given value to the maximum of its current value and the given one.
+ *
+ * @return True iff the value was changed.
+ */
+bool atomicMax(std::atomic<uint64_t>& value, uint64_t newValue) {
+    uint64_t currentValue = value.load(std::memory_order_relaxed);
+    while (currentValue < newValue) {
+        if (value.compare_exchange_weak(currentValue, newValue, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*!
+ * Computes the SCCs of the given system with multiple threads. Singleton SCCs are first removed by repeatedly trimming states without (remaining)
+ * predecessors or successors. The remaining states are decomposed by the coloring algorithm of Orzan ("On Distributed Verification and Verified
+ * Distribution", 2004): every state gets the largest index of a state that reaches it (computed by a parallel fixpoint iteration) and the SCC of each state
+ * whose color is its own index consists of the states of the same color that reach it. As the number of coloring rounds may be large, the sequential
+ * algorithm takes over once the remaining system is small or a round does not make enough progress. Finally, the SCCs are numbered by a level-synchronous
+ * traversal of the SCC graph that starts at the bottom SCCs. This yields the same (reverse) topological order as the sequential algorithm and the depths.
+ */
+template<typename ValueType>
+void performParallelSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                     StronglyConnectedComponentDecompositionOptions const& options, uint64_t numberOfThreads, SccDecompositionResult& result) {
+    auto const& subsystem = options.optSubsystem;
+    auto const& choices = options.optChoices;
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+
+    // Calls the given function for every transition from the given state to another state of the subsystem. Self-loops are reported via the flag.
+    auto forEachSuccessor = [&](uint64_t state, bool& hasSelfLoop, auto const& function) {
+        for (uint64_t row = rowGroupIndices[state], rowEnd = rowGroupIndices[state + 1]; row != rowEnd; ++row) {
+            if (choices && !choices->get(row)) {
+                continue;
+            }
+            for (auto const& successor : transitionMatrix.getRow(row)) {
+                if ((!subsystem || subsystem->get(successor.getColumn())) && successor.getValue() != storm::utility::zero<ValueType>()) {
+                    if (successor.getColumn() == state) {
+                        hasSelfLoop = true;
+                    } else {
+                        function(successor.getColumn());
+                    }
+                }
+            }
+        }
+    };
+
+    std::vector<uint64_t> states;
+    if (subsystem) {
+        states.assign(subsystem->begin(), subsystem->end());
+    } else {
+        states.resize(numberOfStates);
+        std::iota(states.begin(), states.end(), 0ull);
+    }
+
+    // Count the predecessors and successors of each state and build the backward transitions (without self-loops).
+    std::vector<uint8_t> nonTrivial(numberOfStates, 0);
+    std::vector<std::atomic<uint64_t>> inDegrees(numberOfStates);
+    std::vector<std::atomic<uint64_t>> outDegrees(numberOfStates);
+    forEachElement(numberOfThreads, states, [&](uint64_t, uint64_t state) {
+        bool hasSelfLoop = false;
+        uint64_t outDegree = 0;
+        forEachSuccessor(state, hasSelfLoop, [&](uint64_t successor) {
+            ++outDegree;
+            inDegrees[successor].fetch_add(1, std::memory_order_relaxed);
+        });
+        outDegrees[state].store(outDegree, std::memory_order_relaxed);
+        nonTrivial[state] = hasSelfLoop ? 1 : 0;
+    });
+    std::vector<uint64_t> predecessorOffsets(numberOfStates + 1, 0);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        predecessorOffsets[state + 1] = predecessorOffsets[state] + inDegrees[state].load(std::memory_order_relaxed);
+    }
+    std::vector<uint64_t> predecessors(predecessorOffsets.back());
+    {
+        std::vector<std::atomic<uint64_t>> nextPositions(numberOfStates);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            nextPositions[state].store(predecessorOffsets[state], std::memory_order_relaxed);
+        }
+        forEachElement(numberOfThreads, states, [&](uint64_t, uint64_t state) {
+            bool hasSelfLoop = false;
+            forEachSuccessor(state, hasSelfLoop,
+                             [&](uint64_t successor) { predecessors[nextPositions[successor].fetch_add(1, std::memory_order_relaxed)] = state; });
+        });
+    }
+    auto forEachPredecessor = [&](uint64_t state, auto const& function) {
+        for (uint64_t index = predecessorOffsets[state], indexEnd = predecessorOffsets[state + 1]; index != indexEnd; ++index) {
+            function(predecessors[index]);
+        }
+    };
+    auto forEachSuccessorWithoutSelfLoop = [&](uint64_t state, auto const& function) {
+        bool hasSelfLoop = false;
+        forEachSuccessor(state, hasSelfLoop, function);
+    };
+
+    // Until the SCCs are numbered, every SCC is identified by one of its states (its representative).
+    std::vector<std::atomic<uint64_t>> representatives(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        representatives[state].store(NoScc, std::memory_order_relaxed);
+    }
+    auto getRepresentative = [&](uint64_t state) { return representatives[state].load(std::memory_order_relaxed); };
+    auto claimAsSingleton = [&](uint64_t state) {
+        uint64_t expected = NoScc;
+        return representatives[state].compare_exchange_strong(expected, state, std::memory_order_relaxed);
+    };
+
+    // Trim states without predecessors or successors among the remaining states. Each of them forms a singleton SCC.
+    std::vector<uint64_t> frontier = collect(numberOfThreads, states, [&](uint64_t state, std::vector<uint64_t>& output) {
+        if ((inDegrees[state].load(std::memory_order_relaxed) == 0 || outDegrees[state].load(std::memory_order_relaxed) == 0) && claimAsSingleton(state)) {
+            output.push_back(state);
+        }
+    });
+    while (!frontier.empty()) {
+        frontier = collect(numberOfThreads, frontier, [&](uint64_t state, std::vector<uint64_t>& output) {
+            forEachSuccessorWithoutSelfLoop(state, [&](uint64_t successor) {
+                if (inDegrees[successor].fetch_sub(1, std::memory_order_relaxed) == 1 && claimAsSingleton(successor)) {
+                    output.push_back(successor);
+                }
+            });
+            forEachPredecessor(state, [&](uint64_t predecessor) {
+                if (outDegrees[predecessor].fetch_sub(1, std::memory_order_relaxed) == 1 && claimAsSingleton(predecessor)) {
+                    output.push_back(predecessor);
+                }
+            });
+        });
+    }
+    inDegrees = std::vector<std::atomic<uint64_t>>();
+    outDegrees = std::vector<std::atomic<uint64_t>>();
+
+    auto keepStatesWithoutScc = [&](uint64_t state, std::vector<uint64_t>& output) {
+        if (getRepresentative(state) == NoScc) {
+            output.push_back(state);
+        }
+    };
+    std::vector<uint64_t> remainingStates = collect(numberOfThreads, states, keepStatesWithoutScc);
+
+    // Decompose the remaining states by coloring.
+    std::vector<std::atomic<uint64_t>> colors(numberOfStates);
+    while (remainingStates.size() >= MinimalNumberOfStatesForParallelSccDecomposition) {
+        forEachElement(numberOfThreads, remainingStates, [&](uint64_t, uint64_t state) { colors[state].store(state, std::memory_order_relaxed); });
+        std::atomic<bool> changed(true);
+        while (changed.load()) {
+            changed.store(false);
+            forEachElement(numberOfThreads, remainingStates, [&](uint64_t, uint64_t state) {
+                uint64_t const color = colors[state].load(std::memory_order_relaxed);
+                forEachSuccessorWithoutSelfLoop(state, [&](uint64_t successor) {
+                    if (getRepresentative(successor) == NoScc && atomicMax(colors[successor], color)) {
+                        changed.store(true, std::memory_order_relaxed);
+                    }
+                });
+            });
+        }
+
+        // The SCC of each root consists of the states with the same color that reach the root.
+        std::vector<uint64_t> roots = collect(numberOfThreads, remainingStates, [&](uint64_t state, std::vector<uint64_t>& output) {
+            if (colors[state].load(std::memory_order_relaxed) == state) {
+                output.push_back(state);
+            }
+        });
+        auto collectScc = [&](uint64_t root, std::vector<uint64_t>& sccStates) {
+            representatives[root].store(root, std::memory_order_relaxed);
+            sccStates.assign(1, root);
+            for (uint64_t index = 0; index < sccStates.size(); ++index) {
+                forEachPredecessor(sccStates[index], [&](uint64_t predecessor) {
+                    if (getRepresentative(predecessor) == NoScc && colors[predecessor].load(std::memory_order_relaxed) == root) {
+                        representatives[predecessor].store(root, std::memory_order_relaxed);
+                        sccStates.push_back(predecessor);
+                    }
+                });
+            }
+            if (sccStates.size() > 1) {
+                for (auto state : sccStates) {
+                    nonTrivial[state] = 1;
+                }
+            }
+        };
+        // As the SCCs may differ strongly in size, the roots are distributed dynamically.
+        uint64_t const threadsForRoots = roots.size() < MinimalNumberOfItemsPerThread ? 1 : numberOfThreads;
+        storm::utility::parallel::forEachBlock(threadsForRoots, static_cast<uint64_t>(0), static_cast<uint64_t>(roots.size()), 64,
+                                               [&](uint64_t, uint64_t begin, uint64_t end) {
+                                                   std::vector<uint64_t> sccStates;
+                                                   for (uint64_t index = begin; index != end; ++index) {
+                                                       collectScc(roots[index], sccStates);
+                                                   }
+                                               });
+
+        uint64_t previousNumberOfRemainingStates = remainingStates.size();
+        remainingStates = collect(numberOfThreads, remainingStates, keepStatesWithoutScc);
+        if (remainingStates.size() * 100 > previousNumberOfRemainingStates * 99) {
+            // Less than one percent of the states were assigned to an SCC in this round.
+            break;
+        }
+    }
+    colors = std::vector<std::atomic<uint64_t>>();
+
+    // Decompose the rest sequentially.
+    if (!remainingStates.empty()) {
+        storm::storage::BitVector remainingSubsystem(numberOfStates);
+        for (auto state : remainingStates) {
+            remainingSubsystem.set(state);
+        }
+        SccDecompositionResult remainingResult;
+        remainingResult.initialize(numberOfStates, false);
+        SccDecompositionMemoryCache cache;
+        cache.initialize(numberOfStates);
+        uint64_t currentIndex = 0;
+        for (auto state : remainingStates) {
+            if (!cache.hasPreorderNumber(state)) {
+                performSccDecompositionGCM(transitionMatrix, storm::OptionalRef<storm::storage::BitVector const>(remainingSubsystem), choices, false, state,
+                                           currentIndex, remainingResult, cache);
+            }
+        }
+        // The first state of each SCC is its representative.
+        std::vector<uint64_t> sccRepresentatives(remainingResult.sccCount, NoScc);
+        for (auto state : remainingStates) {
+            uint64_t& representative = sccRepresentatives[remainingResult.stateToSccMapping[state]];
+            if (representative == NoScc) {
+                representative = state;
+            }
+            representatives[state].store(representative, std::memory_order_relaxed);
+            if (remainingResult.nonTrivialStates.get(state)) {
+                nonTrivial[state] = 1;
+            }
+        }
+    }
+
+    // Group the states by their SCCs and count the transitions leaving each SCC.
+    std::vector<uint64_t> memberOffsets(numberOfStates + 1, 0);
+    for (auto state : states) {
+        ++memberOffsets[getRepresentative(state) + 1];
+    }
+    std::vector<uint64_t> sccRepresentatives;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (memberOffsets[state + 1] > 0) {
+            sccRepresentatives.push_back(state);
+        }
+        memberOffsets[state + 1] += memberOffsets[state];
+    }
+    std::vector<uint64_t> members(states.size());
+    {
+        std::vector<uint64_t> nextPositions(memberOffsets.begin(), memberOffsets.end() - 1);
+        for (auto state : states) {
+            members[nextPositions[getRepresentative(state)]++] = state;
+        }
+    }
+    std::vector<std::atomic<uint64_t>> outgoingTransitions(numberOfStates);
+    forEachElement(numberOfThreads, states, [&](uint64_t, uint64_t state) {
+        uint64_t const representative = getRepresentative(state);
+        uint64_t count = 0;
+        forEachSuccessorWithoutSelfLoop(state, [&](uint64_t successor) {
+            if (getRepresentative(successor) != representative) {
+                ++count;
+            }
+        });
+        if (count > 0) {
+            outgoingTransitions[representative].fetch_add(count, std::memory_order_relaxed);
+        }
+    });
+
+    // Number the SCCs level by level, starting with the bottom SCCs. The SCCs in the i-th level are exactly the ones with depth i.
+    std::vector<uint64_t> sccIndices(numberOfStates, NoScc);
+    frontier = collect(numberOfThreads, sccRepresentatives, [&](uint64_t representative, std::vector<uint64_t>& output) {
+        if (outgoingTransitions[representative].load(std::memory_order_relaxed) == 0) {
+            output.push_back(representative);
+        }
+    });
+    uint64_t level = 0;
+    while (!frontier.empty()) {
+        std::sort(frontier.begin(), frontier.end());
+        for (auto representative : frontier) {
+            sccIndices[representative] = result.sccCount++;
+            if (result.sccDepths) {
+                result.sccDepths->push_back(level);
+            }
+        }
+        frontier = collect(numberOfThreads, frontier, [&](uint64_t representative, std::vector<uint64_t>& output) {
+            for (uint64_t index = memberOffsets[representative], indexEnd = memberOffsets[representative + 1]; index != indexEnd; ++index) {
+                forEachPredecessor(members[index], [&](uint64_t predecessor) {
+                    uint64_t const predecessorRepresentative = getRepresentative(predecessor);
+                    if (predecessorRepresentative != representative &&
+                        outgoingTransitions[predecessorRepresentative].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                        output.push_back(predecessorRepresentative);
+                    }
+                });
+            }
+        });
+        ++level;
+    }
+    STORM_LOG_ASSERT(result.sccCount == sccRepresentatives.size(), "Not all SCCs were numbered.");
+
+    for (auto state : states) {
+        result.stateToSccMapping[state] = sccIndices[getRepresentative(state)];
+        if (nonTrivial[state]) {
+            result.nonTrivialStates.set(state, true);
+        }
+    }
+}
+
+}  // namespace
+
 template<typename ValueType>
 void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  StronglyConnectedComponentDecompositionOptions const& options) {
+    storm::utility::ProfilerPhase phase("scc");
     SccDecompositionResult result;
     storm::storage::performSccDecomposition(transitionMatrix, options, result);
+    phase.addCounter("states", transitionMatrix.getRowGroupCount());
+    phase.addCounter("sccs", result.sccCount);
 
     STORM_LOG_ASSERT(!options.areOnlyBottomSccsConsidered || result.sccDepths.has_value(), "Scc depths not computed but needed.");
     if (result.sccDepths) {
@@ -282,6 +644,19 @@ void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& tran
 
     uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
     result.initialize(numberOfStates, options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered);
+
+    uint64_t numberOfThreads = 1;
+    if (options.optNumberOfThreads) {
+        numberOfThreads = std::max<uint64_t>(1, *options.optNumberOfThreads);
+    } else if (storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+        numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads();
+    }
+    uint64_t numberOfConsideredStates = options.optSubsystem ? options.optSubsystem->getNumberOfSetBits() : numberOfStates;
+    if (numberOfThreads > 1 && numberOfConsideredStates >= MinimalNumberOfStatesForParallelSccDecomposition) {
+        performParallelSccDecomposition(transitionMatrix, options, numberOfThreads, result);
+        return;
+    }
+
     cache.initialize(numberOfStates);
 
     // Start the search for SCCs from every state in the block.
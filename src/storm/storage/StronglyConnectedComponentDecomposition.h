@@ -33,12 +33,17 @@ struct StronglyConnectedComponentDecompositionOptions {
     /// Sets if scc depths can be retrieved.
     StronglyConnectedComponentDecompositionOptions& computeSccDepths(bool value = true);
 
+    /// Sets the number of threads used for the decomposition. If not set, the number of solver threads is used. Small systems are always decomposed
+    /// sequentially.
+    StronglyConnectedComponentDecompositionOptions& numberOfThreads(uint64_t value);
+
     storm::OptionalRef<storm::storage::BitVector const> optSubsystem;
     storm::OptionalRef<storm::storage::BitVector const> optChoices;
     bool areNaiveSccsDropped = false;
     bool areOnlyBottomSccsConsidered = false;
     bool isTopologicalSortForced = false;
     bool isComputeSccDepthsSet = false;
+    std::optional<uint64_t> optNumberOfThreads;
 };
 
 /*!
@@ -178,6 +178,30 @@ SymbolicModelDescription SymbolicModelDescription::preprocess(
     return *this;
 }
 
+SymbolicModelDescription SymbolicModelDescription::slice(std::vector<storm::jani::Property> const& properties) const {
+    if (!this->isPrismProgram()) {
+        return *this;
+    }
+    storm::prism::Program const& program = this->asPrismProgram();
+    std::set<storm::expressions::Variable> variables;
+    std::set<std::string> labels;
+    std::set<std::string> rewardModels;
+    for (auto const& property : properties) {
+        auto propertyVariables = property.getUsedVariablesAndConstants();
+        variables.insert(propertyVariables.begin(), propertyVariables.end());
+        auto propertyLabels = property.getUsedLabels();
+        labels.insert(propertyLabels.begin(), propertyLabels.end());
+        property.gatherReferencedRewardModels(rewardModels);
+    }
+    if (rewardModels.erase("") > 0) {
+        // Reward operators without a name refer to the only reward model of the program. If there is more than one, we keep all of them.
+        for (auto const& rewardModel : program.getRewardModels()) {
+            rewardModels.insert(rewardModel.getName());
+        }
+    }
+    return SymbolicModelDescription(program.slice(variables, labels, rewardModels));
+}
+
 std::map<storm::expressions::Variable, storm::expressions::Expression> SymbolicModelDescription::parseConstantDefinitions(
     std::string const& constantDefinitionString) const {
     if (this->isJaniModel()) {
@@ -52,6 +52,11 @@ class SymbolicModelDescription {
     SymbolicModelDescription preprocess(std::string const& constantDefinitionString = "") const;
     SymbolicModelDescription preprocess(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) const;
 
+    /*!
+     * Removes the parts of the model that can not influence the given properties (see storm::prism::Program::slice). JANI models are returned unchanged.
+     */
+    SymbolicModelDescription slice(std::vector<storm::jani::Property> const& properties) const;
+
     std::map<storm::expressions::Variable, storm::expressions::Expression> parseConstantDefinitions(std::string const& constantDefinitionString) const;
 
     void requireNoUndefinedConstants() const;
@@ -19,12 +19,15 @@
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BisimulationSettings.h"
 #include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
 
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace storage {
@@ -60,6 +63,9 @@ BisimulationDecomposition<ModelType, BlockDataType>::Options::Options()
       psiStates(),
       respectedAtomicPropositions(),
       buildQuotient(true),
+      signatureBasedRefinement(storm::settings::hasModule<storm::settings::modules::BisimulationSettings>() &&
+                               storm::settings::getModule<storm::settings::modules::BisimulationSettings>().getSparseRefinementMode() ==
+                                   storm::settings::modules::BisimulationSettings::SparseRefinementMode::Signature),
       keepRewards(false),
       type(BisimulationType::Strong),
       bounded(false) {
@@ -220,10 +226,21 @@ void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDec
     STORM_LOG_WARN_COND(partition.size() > 1, "Initial partition consists only of a single block.");
     std::chrono::high_resolution_clock::duration initialPartitionTime = std::chrono::high_resolution_clock::now() - initialPartitionStart;
 
-    this->initialize();
+    bool useSignatureBasedRefinement = options.signatureBasedRefinement;
+    if (useSignatureBasedRefinement && options.getType() != BisimulationType::Strong) {
+        STORM_LOG_WARN("Signature-based refinement is only supported for strong bisimulation. Falling back to splitter-based refinement.");
+        useSignatureBasedRefinement = false;
+    }
 
     std::chrono::high_resolution_clock::time_point refinementStart = std::chrono::high_resolution_clock::now();
-    this->performPartitionRefinement();
+    if (useSignatureBasedRefinement) {
+        // The signature-based refinement does not need the auxiliary data structures, so we only initialize them wrt. the final partition.
+        this->performSignatureBasedRefinement();
+        this->initialize();
+    } else {
+        this->initialize();
+        this->performPartitionRefinement();
+    }
     std::chrono::high_resolution_clock::duration refinementTime = std::chrono::high_resolution_clock::now() - refinementStart;
 
     std::chrono::high_resolution_clock::time_point extractionStart = std::chrono::high_resolution_clock::now();
@@ -288,6 +305,124 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
     }
 }
 
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::computeSignature(storm::storage::sparse::state_type state,
+                                                                           std::vector<storm::storage::DistributionWithReward<ValueType>>& signature) const {
+    auto const& transitionMatrix = model.getTransitionMatrix();
+    bool const useActionRewards = model.isNondeterministicModel() && options.getKeepRewards() && model.hasRewardModel() &&
+                                  model.getUniqueRewardModel().hasStateActionRewards();
+
+    signature.clear();
+    for (auto row : transitionMatrix.getRowGroupIndices(state)) {
+        storm::storage::DistributionWithReward<ValueType> distribution;
+        if (useActionRewards) {
+            distribution.setReward(model.getUniqueRewardModel().getStateActionReward(row));
+        }
+        for (auto const& entry : transitionMatrix.getRow(row)) {
+            if (!comparator.isZero(entry.getValue())) {
+                distribution.addProbability(partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+            }
+        }
+        signature.push_back(std::move(distribution));
+    }
+
+    // The signature is the set of distributions, so we sort them and remove duplicates.
+    std::sort(signature.begin(), signature.end(),
+              [this](storm::storage::DistributionWithReward<ValueType> const& distribution1,
+                     storm::storage::DistributionWithReward<ValueType> const& distribution2) { return distribution1.less(distribution2, comparator); });
+    signature.erase(std::unique(signature.begin(), signature.end(),
+                                [this](storm::storage::DistributionWithReward<ValueType> const& distribution1,
+                                       storm::storage::DistributionWithReward<ValueType> const& distribution2) {
+                                    return distribution1.equals(distribution2, comparator);
+                                }),
+                    signature.end());
+}
+
+template<typename ModelType, typename BlockDataType>
+bool BisimulationDecomposition<ModelType, BlockDataType>::signatureLess(
+    std::vector<storm::storage::DistributionWithReward<ValueType>> const& signature1,
+    std::vector<storm::storage::DistributionWithReward<ValueType>> const& signature2) const {
+    return std::lexicographical_compare(signature1.begin(), signature1.end(), signature2.begin(), signature2.end(),
+                                        [this](storm::storage::DistributionWithReward<ValueType> const& distribution1,
+                                               storm::storage::DistributionWithReward<ValueType> const& distribution2) {
+                                            return distribution1.less(distribution2, comparator);
+                                        });
+}
+
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureBasedRefinement() {
+    // The minimal number of states that each thread processes in a round.
+    uint64_t const minimalNumberOfStatesPerThread = 10000;
+    uint64_t const numberOfThreads = std::min<uint64_t>(storm::utility::getNumberOfThreads(),
+                                                        std::max<uint64_t>(1, model.getNumberOfStates() / minimalNumberOfStatesPerThread));
+    STORM_LOG_INFO("Performing signature-based partition refinement with " << numberOfThreads << " thread(s).");
+
+    // Make sure that the row grouping of the transition matrix is not created lazily by the threads.
+    model.getTransitionMatrix().getRowGroupIndices();
+
+    std::vector<std::vector<storm::storage::DistributionWithReward<ValueType>>> signatures(model.getNumberOfStates());
+    uint_fast64_t iterations = 0;
+    bool changed = true;
+    while (changed) {
+        ++iterations;
+        changed = false;
+
+        // Only blocks with more than one state that are not absorbing can be split.
+        std::vector<Block<BlockDataType>*> candidateBlocks;
+        for (auto const& block : partition.getBlocks()) {
+            if (block->getNumberOfStates() > 1 && !block->data().absorbing()) {
+                candidateBlocks.push_back(block.get());
+            }
+        }
+
+        // Compute the signatures of the states (wrt. the partition at the beginning of the round), sort every block by the signatures of its states
+        // and determine the positions at which the block is to be split. As the blocks occupy disjoint ranges of the partition, this can be done for
+        // all blocks in parallel.
+        std::vector<std::vector<storm::storage::sparse::state_type>> splitPositions(candidateBlocks.size());
+        storm::utility::parallel::forEachBlock(
+            numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(candidateBlocks.size()), 16, [&](uint64_t, uint64_t begin, uint64_t end) {
+                for (uint64_t index = begin; index < end; ++index) {
+                    Block<BlockDataType>& block = *candidateBlocks[index];
+                    for (auto stateIt = partition.begin(block), stateIte = partition.end(block); stateIt != stateIte; ++stateIt) {
+                        computeSignature(*stateIt, signatures[*stateIt]);
+                    }
+
+                    // Ties are broken by the state indices to keep the result deterministic.
+                    std::sort(partition.begin(block), partition.end(block),
+                              [&](storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+                                  return signatureLess(signatures[state1], signatures[state2]) ||
+                                         (!signatureLess(signatures[state2], signatures[state1]) && state1 < state2);
+                              });
+                    partition.mapStatesToPositions(block);
+
+                    for (auto position = block.getBeginIndex() + 1; position < block.getEndIndex(); ++position) {
+                        if (signatureLess(signatures[partition.getState(position - 1)], signatures[partition.getState(position)])) {
+                            splitPositions[index].push_back(position);
+                        }
+                    }
+                }
+            });
+
+        // Now split the blocks. Every split creates a new block holding the states before the given position.
+        for (uint64_t index = 0; index < candidateBlocks.size(); ++index) {
+            Block<BlockDataType>& block = *candidateBlocks[index];
+            for (auto position : splitPositions[index]) {
+                auto result = partition.splitBlock(block, position);
+                if (result.second) {
+                    (*result.first)->data().setHasRewards(block.data().hasRewards());
+                    changed = true;
+                }
+            }
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            std::cout << "Performed " << iterations << " rounds of signature-based partition refinement before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+        }
+    }
+    STORM_LOG_INFO("Signature-based partition refinement converged after " << iterations << " round(s) with " << partition.size() << " block(s).");
+}
+
 template<typename ModelType, typename BlockDataType>
 std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
     STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException,
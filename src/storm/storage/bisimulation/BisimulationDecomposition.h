@@ -5,6 +5,7 @@
 #include "storm/settings/modules/BisimulationSettings.h"
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/storage/Decomposition.h"
+#include "storm/storage/DistributionWithReward.h"
 #include "storm/storage/StateBlock.h"
 #include "storm/storage/bisimulation/BisimulationType.h"
 #include "storm/storage/bisimulation/Partition.h"
@@ -126,6 +127,10 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
         /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
         bool buildQuotient;
 
+        /// A flag that governs whether the partition is refined by splitting all blocks wrt. the signatures of their states in every round
+        /// (instead of refining it wrt. one splitter at a time). This is only supported for strong bisimulation.
+        bool signatureBasedRefinement;
+
        private:
         boost::optional<OptimizationDirection> optimalityType;
 
@@ -208,6 +213,13 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
      */
     void performPartitionRefinement();
 
+    /*!
+     * Performs the partition refinement by repeatedly splitting all blocks at once wrt. the signatures of their states, where the signature of a state
+     * is the set of its (quotient) distributions over the current blocks. The signatures are computed and the blocks are sorted in parallel. This
+     * computes the equivalence classes under strong bisimulation equivalence.
+     */
+    void performSignatureBasedRefinement();
+
     /*!
      * Refines the partition by considering the given splitter. All blocks that become potential splitters
      * because of this refinement, are marked as splitters and inserted into the splitter vector.
@@ -267,6 +279,16 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
      */
     void extractDecompositionBlocks();
 
+    /*!
+     * Computes the signature of the given state wrt. the current partition, i.e., the ordered set of distributions over the blocks that the choices of
+     * the state induce. For nondeterministic models, the distributions carry the action rewards (if these are to be kept).
+     */
+    void computeSignature(storm::storage::sparse::state_type state, std::vector<storm::storage::DistributionWithReward<ValueType>>& signature) const;
+
+    // Retrieves whether the first signature is considered to be less than the second one.
+    bool signatureLess(std::vector<storm::storage::DistributionWithReward<ValueType>> const& signature1,
+                       std::vector<storm::storage::DistributionWithReward<ValueType>> const& signature2) const;
+
     // The model to decompose.
     ModelType const& model;
 
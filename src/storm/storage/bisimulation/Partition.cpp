@@ -176,45 +176,6 @@ std::vector<storm::storage::sparse::state_type>::const_iterator Partition<DataTy
     return this->states.end();
 }
 
-template<typename DataType>
-void Partition<DataType>::sortRange(storm::storage::sparse::state_type beginIndex, storm::storage::sparse::state_type endIndex,
-                                    std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less,
-                                    bool updatePositions) {
-    // FIXME, TODO: Wrapping less argument in a lambda here, as clang and the GCC stdlib do not play nicely
-    // Pass 'less' directly to std::sort when this has been resolved (problem with clang 3.7, gcc 5.1)
-    std::sort(this->states.begin() + beginIndex, this->states.begin() + endIndex,
-              [&](const storm::storage::sparse::state_type& a, storm::storage::sparse::state_type& b) { return less(a, b); });
-
-    if (updatePositions) {
-        mapStatesToPositions(this->states.begin() + beginIndex, this->states.begin() + endIndex);
-    }
-}
-
-template<typename DataType>
-void Partition<DataType>::sortBlock(Block<DataType>& block,
-                                    std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less,
-                                    bool updatePositions) {
-    sortRange(block.getBeginIndex(), block.getEndIndex(), less, updatePositions);
-}
-
-template<typename DataType>
-std::vector<uint_fast64_t> Partition<DataType>::computeRangesOfEqualValue(
-    uint_fast64_t startIndex, uint_fast64_t endIndex, std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less) {
-    auto it = this->states.cbegin() + startIndex;
-    auto ite = this->states.cbegin() + endIndex;
-
-    std::vector<storm::storage::sparse::state_type>::const_iterator upperBound;
-    std::vector<uint_fast64_t> result;
-    result.push_back(startIndex);
-    do {
-        upperBound = std::upper_bound(it, ite, *it, less);
-        result.push_back(std::distance(this->states.cbegin(), upperBound));
-        it = upperBound;
-    } while (upperBound != ite);
-
-    return result;
-}
-
 template<typename DataType>
 std::pair<typename std::vector<std::unique_ptr<Block<DataType>>>::iterator, bool> Partition<DataType>::splitBlock(Block<DataType>& block,
                                                                                                                   storm::storage::sparse::state_type position) {
@@ -242,64 +203,6 @@ std::pair<typename std::vector<std::unique_ptr<Block<DataType>>>::iterator, bool
     return std::make_pair(newBlockIt, true);
 }
 
-template<typename DataType>
-bool Partition<DataType>::splitBlock(Block<DataType>& block,
-                                     std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less,
-                                     std::function<void(Block<DataType>&)> const& newBlockCallback) {
-    // Sort the block, but leave the positions untouched.
-    this->sortBlock(block, less, false);
-
-    auto originalBegin = block.getBeginIndex();
-    auto originalEnd = block.getEndIndex();
-
-    auto it = this->states.cbegin() + block.getBeginIndex();
-    auto ite = this->states.cbegin() + block.getEndIndex();
-
-    bool wasSplit = false;
-    std::vector<storm::storage::sparse::state_type>::const_iterator upperBound;
-    do {
-        upperBound = std::upper_bound(it, ite, *it, less);
-
-        if (upperBound != ite) {
-            wasSplit = true;
-            auto result = this->splitBlock(block, std::distance(this->states.cbegin(), upperBound));
-            newBlockCallback(**result.first);
-        }
-        it = upperBound;
-    } while (upperBound != ite);
-
-    // Finally, repair the positions mapping.
-    mapStatesToPositions(this->states.begin() + originalBegin, this->states.begin() + originalEnd);
-
-    return wasSplit;
-}
-
-// Splits the block by sorting the states according to the given function and then identifying the split
-// points.
-template<typename DataType>
-bool Partition<DataType>::splitBlock(Block<DataType>& block,
-                                     std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less) {
-    return this->splitBlock(block, less, [](Block<DataType>&) {});
-}
-
-template<typename DataType>
-bool Partition<DataType>::split(std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less,
-                                std::function<void(Block<DataType>&)> const& newBlockCallback) {
-    bool result = false;
-    // Since the underlying storage of the blocks may change during iteration, we remember the current size
-    // and iterate over indices. This assumes that new blocks will be added at the end of the blocks vector.
-    std::size_t currentSize = this->size();
-    for (uint_fast64_t index = 0; index < currentSize; ++index) {
-        result |= splitBlock(*blocks[index], less, newBlockCallback);
-    }
-    return result;
-}
-
-template<typename DataType>
-bool Partition<DataType>::split(std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less) {
-    return this->split(less, [](Block<DataType>&) {});
-}
-
 template<typename DataType>
 void Partition<DataType>::splitStates(Block<DataType>& block, storm::storage::BitVector const& states) {
     this->splitBlock(
@@ -1,9 +1,13 @@
 #ifndef STORM_STORAGE_BISIMULATION_PARTITION_H_
 #define STORM_STORAGE_BISIMULATION_PARTITION_H_
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <list>
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 #include "storm/storage/bisimulation/Block.h"
 
@@ -55,35 +59,41 @@ class Partition {
     std::pair<typename std::vector<std::unique_ptr<Block<DataType>>>::iterator, bool> splitBlock(Block<DataType>& block,
                                                                                                  storm::storage::sparse::state_type position);
 
+    // The comparators and callbacks of the following functions are template parameters (rather than std::function objects), so that they can be
+    // inlined into the sorting loops. Comparators are invoked as less(state1, state2) and callbacks as newBlockCallback(newBlock).
+
     // Sorts the given range of the partitition according to the given order.
-    void sortRange(storm::storage::sparse::state_type beginIndex, storm::storage::sparse::state_type endIndex,
-                   std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less, bool updatePositions = true);
+    template<typename LessFunction>
+    void sortRange(storm::storage::sparse::state_type beginIndex, storm::storage::sparse::state_type endIndex, LessFunction const& less,
+                   bool updatePositions = true);
 
     // Sorts the block according to the given order.
-    void sortBlock(Block<DataType>& block, std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less,
-                   bool updatePositions = true);
+    template<typename LessFunction>
+    void sortBlock(Block<DataType>& block, LessFunction const& less, bool updatePositions = true);
 
     // Computes the start indices of equal ranges within the given range wrt. to the given less function.
-    std::vector<uint_fast64_t> computeRangesOfEqualValue(
-        uint_fast64_t startIndex, uint_fast64_t endIndex,
-        std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less);
+    template<typename LessFunction>
+    std::vector<uint_fast64_t> computeRangesOfEqualValue(uint_fast64_t startIndex, uint_fast64_t endIndex, LessFunction const& less);
 
     // Splits the block by sorting the states according to the given function and then identifying the split
     // points. The callback function is called for every newly created block.
-    bool splitBlock(Block<DataType>& block, std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less,
-                    std::function<void(Block<DataType>&)> const& newBlockCallback);
+    template<typename LessFunction, typename NewBlockCallback>
+    bool splitBlock(Block<DataType>& block, LessFunction const& less, NewBlockCallback const& newBlockCallback);
 
     // Splits the block by sorting the states according to the given function and then identifying the split
     // points.
-    bool splitBlock(Block<DataType>& block, std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less);
+    template<typename LessFunction, typename = std::enable_if_t<std::is_invocable_r_v<bool, LessFunction const&, storm::storage::sparse::state_type,
+                                                                                      storm::storage::sparse::state_type>>>
+    bool splitBlock(Block<DataType>& block, LessFunction const& less);
 
     // Splits all blocks by using the sorting-based splitting. The callback is called for all newly created
     // blocks.
-    bool split(std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less,
-               std::function<void(Block<DataType>&)> const& newBlockCallback);
+    template<typename LessFunction, typename NewBlockCallback>
+    bool split(LessFunction const& less, NewBlockCallback const& newBlockCallback);
 
     // Splits all blocks by using the sorting-based splitting.
-    bool split(std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& less);
+    template<typename LessFunction>
+    bool split(LessFunction const& less);
 
     // Splits the block such that the resulting blocks contain only states in the given set or none at all.
     // If the block is split, the given block will contain the states *not* in the given set and the newly
@@ -175,6 +185,97 @@ class Partition {
     // This vector keeps track of the position of each state in the state vector.
     std::vector<storm::storage::sparse::state_type> positions;
 };
+
+template<typename DataType>
+template<typename LessFunction>
+void Partition<DataType>::sortRange(storm::storage::sparse::state_type beginIndex, storm::storage::sparse::state_type endIndex, LessFunction const& less,
+                                    bool updatePositions) {
+    std::sort(this->states.begin() + beginIndex, this->states.begin() + endIndex, less);
+
+    if (updatePositions) {
+        mapStatesToPositions(this->states.begin() + beginIndex, this->states.begin() + endIndex);
+    }
+}
+
+template<typename DataType>
+template<typename LessFunction>
+void Partition<DataType>::sortBlock(Block<DataType>& block, LessFunction const& less, bool updatePositions) {
+    sortRange(block.getBeginIndex(), block.getEndIndex(), less, updatePositions);
+}
+
+template<typename DataType>
+template<typename LessFunction>
+std::vector<uint_fast64_t> Partition<DataType>::computeRangesOfEqualValue(uint_fast64_t startIndex, uint_fast64_t endIndex, LessFunction const& less) {
+    auto it = this->states.cbegin() + startIndex;
+    auto ite = this->states.cbegin() + endIndex;
+
+    std::vector<storm::storage::sparse::state_type>::const_iterator upperBound;
+    std::vector<uint_fast64_t> result;
+    result.push_back(startIndex);
+    do {
+        upperBound = std::upper_bound(it, ite, *it, less);
+        result.push_back(std::distance(this->states.cbegin(), upperBound));
+        it = upperBound;
+    } while (upperBound != ite);
+
+    return result;
+}
+
+template<typename DataType>
+template<typename LessFunction, typename NewBlockCallback>
+bool Partition<DataType>::splitBlock(Block<DataType>& block, LessFunction const& less, NewBlockCallback const& newBlockCallback) {
+    // Sort the block, but leave the positions untouched.
+    this->sortBlock(block, less, false);
+
+    auto originalBegin = block.getBeginIndex();
+    auto originalEnd = block.getEndIndex();
+
+    auto it = this->states.cbegin() + block.getBeginIndex();
+    auto ite = this->states.cbegin() + block.getEndIndex();
+
+    bool wasSplit = false;
+    std::vector<storm::storage::sparse::state_type>::const_iterator upperBound;
+    do {
+        upperBound = std::upper_bound(it, ite, *it, less);
+
+        if (upperBound != ite) {
+            wasSplit = true;
+            auto result = this->splitBlock(block, std::distance(this->states.cbegin(), upperBound));
+            newBlockCallback(**result.first);
+        }
+        it = upperBound;
+    } while (upperBound != ite);
+
+    // Finally, repair the positions mapping.
+    mapStatesToPositions(this->states.begin() + originalBegin, this->states.begin() + originalEnd);
+
+    return wasSplit;
+}
+
+template<typename DataType>
+template<typename LessFunction, typename>
+bool Partition<DataType>::splitBlock(Block<DataType>& block, LessFunction const& less) {
+    return this->splitBlock(block, less, [](Block<DataType>&) {});
+}
+
+template<typename DataType>
+template<typename LessFunction, typename NewBlockCallback>
+bool Partition<DataType>::split(LessFunction const& less, NewBlockCallback const& newBlockCallback) {
+    bool result = false;
+    // Since the underlying storage of the blocks may change during iteration, we remember the current size
+    // and iterate over indices. This assumes that new blocks will be added at the end of the blocks vector.
+    std::size_t currentSize = this->size();
+    for (uint_fast64_t index = 0; index < currentSize; ++index) {
+        result |= splitBlock(*blocks[index], less, newBlockCallback);
+    }
+    return result;
+}
+
+template<typename DataType>
+template<typename LessFunction>
+bool Partition<DataType>::split(LessFunction const& less) {
+    return this->split(less, [](Block<DataType>&) {});
+}
 }  // namespace bisimulation
 }  // namespace storage
 }  // namespace storm
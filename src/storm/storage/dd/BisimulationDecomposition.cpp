@@ -147,6 +147,36 @@ bool BisimulationDecomposition<DdType, ValueType, ExportValueType>::compute(uint
     return !refined;
 }
 
+template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
+bool BisimulationDecomposition<DdType, ValueType, ExportValueType>::compute(std::chrono::milliseconds const& timeLimit, uint64_t nodeLimit,
+                                                                            bisimulation::SignatureMode const& mode) {
+    STORM_LOG_ASSERT(refiner, "No suitable refiner.");
+    if (this->refiner->getStatus() == Status::FixedPoint) {
+        return true;
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    uint64_t iterations = 0;
+    bool refined = true;
+    while (refined) {
+        refined = refiner->refine(mode);
+        ++iterations;
+
+        if (std::chrono::high_resolution_clock::now() - start >= timeLimit) {
+            break;
+        }
+        if (nodeLimit > 0 && refiner->getStatePartition().getNodeCount() > nodeLimit) {
+            STORM_LOG_INFO("State partition exceeds the limit of " << nodeLimit << " nodes.");
+            break;
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    STORM_LOG_INFO("State partition after " << iterations << " budgeted iterations ("
+                                            << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms) has "
+                                            << refiner->getStatePartition().getNumberOfBlocks() << " blocks" << (refined ? "." : " and is stable."));
+    return !refined;
+}
+
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
 bool BisimulationDecomposition<DdType, ValueType, ExportValueType>::getReachedFixedPoint() const {
     return this->refiner->getStatus() == Status::FixedPoint;
@@ -165,9 +195,8 @@ std::shared_ptr<storm::models::Model<ExportValueType>> BisimulationDecomposition
                         storm::exceptions::InvalidOperationException, "Can only extract partial quotient for discrete-time models.");
 
         STORM_LOG_INFO("Starting partial quotient extraction.");
-        if (!partialQuotientExtractor) {
-            partialQuotientExtractor = std::make_unique<bisimulation::PartialQuotientExtractor<DdType, ValueType, ExportValueType>>(model, quotientFormat);
-        }
+        // The requested format may differ between calls, so the (cheap) extractor is recreated.
+        partialQuotientExtractor = std::make_unique<bisimulation::PartialQuotientExtractor<DdType, ValueType, ExportValueType>>(model, quotientFormat);
 
         quotient = partialQuotientExtractor->extract(refiner->getStatePartition(), preservationInformation);
     }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <vector>
 
@@ -61,6 +62,17 @@ class BisimulationDecomposition {
      */
     bool compute(uint64_t steps, bisimulation::SignatureMode const& mode = bisimulation::SignatureMode::Eager);
 
+    /*!
+     * Performs refinement steps until a fixpoint has been reached or the given budget is exhausted. At least one step is performed (unless a fixpoint
+     * has already been reached), so repeated calls make progress. If no fixpoint is reached, a partial quotient can be extracted afterwards.
+     *
+     * @param timeLimit The time after which no further refinement step is started.
+     * @param nodeLimit If non-zero, no further refinement step is started once the DD representing the state partition has more nodes.
+     * @return True iff the computation arrived at a fixpoint.
+     */
+    bool compute(std::chrono::milliseconds const& timeLimit, uint64_t nodeLimit = 0,
+                 bisimulation::SignatureMode const& mode = bisimulation::SignatureMode::Eager);
+
     /*!
      * Retrieves whether a fixed point has been reached. Depending on this, extracting a quotient will either
      * give a full quotient or a partial one.
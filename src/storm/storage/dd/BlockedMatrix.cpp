@@ -0,0 +1,107 @@
+#include "storm/storage/dd/BlockedMatrix.h"
+
+#include <algorithm>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdManager.h"
+
+#include "storm/utility/macros.h"
+
+#include "storm-config.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+namespace storm {
+namespace dd {
+
+template<storm::dd::DdType LibraryType, typename ValueType>
+BlockedMatrix<LibraryType, ValueType>::BlockedMatrix(storm::dd::Add<LibraryType, ValueType> const& matrix,
+                                                     std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                     std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd,
+                                                     storm::dd::Odd const& columnOdd, uint64_t maximalNumberOfRowGroupsPerBlock,
+                                                     std::optional<storm::dd::Add<LibraryType, ValueType>> const& offsets)
+    : rowMetaVariables(rowMetaVariables), groupMetaVariables(groupMetaVariables), columnOdd(columnOdd), numberOfRowGroups(rowOdd.getTotalOffset()) {
+    STORM_LOG_ASSERT(maximalNumberOfRowGroupsPerBlock > 0, "Blocks need to contain at least one row group.");
+    for (auto const& variable : matrix.getContainedMetaVariables()) {
+        if (rowMetaVariables.count(variable) == 0 && groupMetaVariables.count(variable) == 0) {
+            columnMetaVariables.insert(variable);
+        }
+    }
+
+    // Each block is obtained by restricting the matrix to the row groups whose indices wrt. the row ODD lie in a contiguous range. The ODD of these row
+    // groups enumerates them in the same order as the row ODD, so the row groups of every block are consecutive in the explicit representation.
+    for (uint64_t blockStart = 0; blockStart < numberOfRowGroups; blockStart += maximalNumberOfRowGroupsPerBlock) {
+        uint64_t blockEnd = std::min(numberOfRowGroups, blockStart + maximalNumberOfRowGroupsPerBlock);
+        storm::storage::BitVector blockRowGroups(numberOfRowGroups);
+        blockRowGroups.setMultiple(blockStart, blockEnd - blockStart);
+        storm::dd::Bdd<LibraryType> blockStates = storm::dd::Bdd<LibraryType>::fromVector(matrix.getDdManager(), blockRowGroups, rowOdd, rowMetaVariables);
+        storm::dd::Add<LibraryType, ValueType> blockStatesAdd = blockStates.template toAdd<ValueType>();
+
+        blockStarts.push_back(blockStart);
+        blockMatrices.push_back(matrix * blockStatesAdd);
+        if (offsets) {
+            blockOffsets.push_back(offsets.value() * blockStatesAdd);
+        }
+        blockOdds.push_back(blockStates.createOdd());
+    }
+    blockStarts.push_back(numberOfRowGroups);
+    STORM_LOG_INFO("Splitting the symbolic matrix into " << getNumberOfBlocks() << " block(s) of at most " << maximalNumberOfRowGroupsPerBlock
+                                                         << " row group(s).");
+}
+
+template<storm::dd::DdType LibraryType, typename ValueType>
+uint64_t BlockedMatrix<LibraryType, ValueType>::getNumberOfBlocks() const {
+    return blockMatrices.size();
+}
+
+template<storm::dd::DdType LibraryType, typename ValueType>
+void BlockedMatrix<LibraryType, ValueType>::multiply(std::vector<ValueType> const& x, std::vector<ValueType>& result,
+                                                     std::optional<storm::OptimizationDirection> const& dir) const {
+    STORM_LOG_ASSERT(&x != &result, "Input and output vector must not be the same.");
+    STORM_LOG_ASSERT(result.size() == numberOfRowGroups, "Result vector has unexpected size.");
+    STORM_LOG_ASSERT(groupMetaVariables.empty() || dir.has_value(), "Multiplying with a row-grouped matrix requires an optimization direction.");
+    std::vector<ValueType> blockResult;
+    for (uint64_t block = 0; block < getNumberOfBlocks(); ++block) {
+        blockResult.resize(blockStarts[block + 1] - blockStarts[block]);
+        if (groupMetaVariables.empty()) {
+            storm::storage::SparseMatrix<ValueType> blockMatrix =
+                blockMatrices[block].toMatrix(rowMetaVariables, columnMetaVariables, blockOdds[block], columnOdd);
+            if (blockOffsets.empty()) {
+                blockMatrix.multiplyWithVector(x, blockResult);
+            } else {
+                std::vector<ValueType> b = blockOffsets[block].toVector(blockOdds[block]);
+                blockMatrix.multiplyWithVector(x, blockResult, &b);
+            }
+        } else if (blockOffsets.empty()) {
+            storm::storage::SparseMatrix<ValueType> blockMatrix = blockMatrices[block].toMatrix(groupMetaVariables, blockOdds[block], columnOdd);
+            blockMatrix.multiplyAndReduce(dir.value(), blockMatrix.getRowGroupIndices(), x, nullptr, blockResult, nullptr);
+        } else {
+            auto blockMatrixVector = blockMatrices[block].toMatrixVector(blockOffsets[block], groupMetaVariables, blockOdds[block], columnOdd);
+            blockMatrixVector.first.multiplyAndReduce(dir.value(), blockMatrixVector.first.getRowGroupIndices(), x, &blockMatrixVector.second, blockResult,
+                                                      nullptr);
+        }
+        std::copy(blockResult.begin(), blockResult.end(), result.begin() + blockStarts[block]);
+    }
+}
+
+template<storm::dd::DdType LibraryType, typename ValueType>
+void BlockedMatrix<LibraryType, ValueType>::repeatedMultiply(std::vector<ValueType>& x, uint64_t n,
+                                                             std::optional<storm::OptimizationDirection> const& dir) const {
+    std::vector<ValueType> result(x.size());
+    for (uint64_t i = 0; i < n; ++i) {
+        multiply(x, result, dir);
+        std::swap(x, result);
+    }
+}
+
+template class BlockedMatrix<storm::dd::DdType::CUDD, double>;
+template class BlockedMatrix<storm::dd::DdType::Sylvan, double>;
+
+#ifdef STORM_HAVE_CARL
+template class BlockedMatrix<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+template class BlockedMatrix<storm::dd::DdType::Sylvan, storm::RationalFunction>;
+#endif
+
+}  // namespace dd
+}  // namespace storm
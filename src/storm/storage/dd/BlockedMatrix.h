@@ -0,0 +1,74 @@
+#pragma once
+
+#include <optional>
+#include <set>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/Odd.h"
+
+namespace storm {
+namespace dd {
+
+/*!
+ * A symbolic matrix that is converted to explicit form in blocks of consecutive row groups (wrt. the row ODD) whenever it is multiplied with a vector.
+ * Only one block is held in explicit form at a time, which trades the time to convert the blocks in every multiplication for not having to store the
+ * explicit matrix in addition to the symbolic one.
+ */
+template<storm::dd::DdType LibraryType, typename ValueType>
+class BlockedMatrix {
+   public:
+    /*!
+     * Creates the blocked matrix.
+     *
+     * @param matrix The symbolic matrix.
+     * @param rowMetaVariables The meta variables that encode the row groups of the matrix.
+     * @param groupMetaVariables The meta variables that are used to distinguish the rows of a row group. If empty, the matrix has a trivial row grouping.
+     * @param rowOdd The ODD used for determining the correct row group.
+     * @param columnOdd The ODD used for determining the correct column.
+     * @param maximalNumberOfRowGroupsPerBlock The maximal number of row groups per block.
+     * @param offsets If given, a symbolic vector that is added to the result of every multiplication. If there are group meta variables, the vector
+     * may depend on them.
+     */
+    BlockedMatrix(storm::dd::Add<LibraryType, ValueType> const& matrix, std::set<storm::expressions::Variable> const& rowMetaVariables,
+                  std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd,
+                  uint64_t maximalNumberOfRowGroupsPerBlock, std::optional<storm::dd::Add<LibraryType, ValueType>> const& offsets = std::nullopt);
+
+    /*!
+     * Retrieves the number of blocks.
+     */
+    uint64_t getNumberOfBlocks() const;
+
+    /*!
+     * Multiplies the matrix with the given vector, adds the offsets (if any) and stores the result in the given result vector. If the matrix has a
+     * non-trivial row grouping, the result of each row group is the minimum or maximum over its rows (depending on the given direction).
+     */
+    void multiply(std::vector<ValueType> const& x, std::vector<ValueType>& result, std::optional<storm::OptimizationDirection> const& dir = std::nullopt) const;
+
+    /*!
+     * Performs the given number of multiplications, starting with (and overwriting) the given vector.
+     */
+    void repeatedMultiply(std::vector<ValueType>& x, uint64_t n, std::optional<storm::OptimizationDirection> const& dir = std::nullopt) const;
+
+   private:
+    std::set<storm::expressions::Variable> rowMetaVariables;
+    std::set<storm::expressions::Variable> columnMetaVariables;
+    std::set<storm::expressions::Variable> groupMetaVariables;
+    storm::dd::Odd columnOdd;
+
+    // The number of row groups.
+    uint64_t numberOfRowGroups;
+
+    // The first row group of each block followed by the number of row groups.
+    std::vector<uint64_t> blockStarts;
+
+    // For each block, the part of the matrix (and the offsets) restricted to the row groups of the block and the ODD of these row groups.
+    std::vector<storm::dd::Add<LibraryType, ValueType>> blockMatrices;
+    std::vector<storm::dd::Add<LibraryType, ValueType>> blockOffsets;
+    std::vector<storm::dd::Odd> blockOdds;
+};
+
+}  // namespace dd
+}  // namespace storm
@@ -461,6 +461,11 @@ void DdManager<LibraryType>::triggerReordering() {
     internalDdManager.triggerReordering();
 }
 
+template<DdType LibraryType>
+DdManagerStatistics DdManager<LibraryType>::getStatistics() const {
+    return internalDdManager.getStatistics();
+}
+
 template<DdType LibraryType>
 std::set<storm::expressions::Variable> DdManager<LibraryType>::getAllMetaVariables() const {
     std::set<storm::expressions::Variable> result;
@@ -282,6 +282,11 @@ class DdManager : public std::enable_shared_from_this<DdManager<LibraryType>> {
      */
     void triggerReordering();
 
+    /*!
+     * Retrieves statistics about the unique table(s), the operation cache and the garbage collections of the underlying library.
+     */
+    DdManagerStatistics getStatistics() const;
+
     /*!
      * Retrieves the meta variable with the given name if it exists.
      *
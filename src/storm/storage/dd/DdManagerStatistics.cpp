@@ -0,0 +1,26 @@
+#include "storm/storage/dd/DdManagerStatistics.h"
+
+namespace storm {
+namespace dd {
+
+std::ostream& operator<<(std::ostream& out, DdManagerStatistics const& statistics) {
+    out << "nodes: " << statistics.nodeCount;
+    if (statistics.peakNodeCount) {
+        out << " (peak " << statistics.peakNodeCount.value() << ")";
+    }
+    out << ", unique table size: " << statistics.uniqueTableSize << ", cache size: " << statistics.cacheSize;
+    if (statistics.cacheLookups && statistics.cacheHits) {
+        out << ", cache hits: " << statistics.cacheHits.value() << "/" << statistics.cacheLookups.value();
+        if (statistics.cacheLookups.value() > 0) {
+            out << " (" << (100.0 * statistics.cacheHits.value() / statistics.cacheLookups.value()) << "%)";
+        }
+    }
+    out << ", garbage collections: " << statistics.garbageCollections << " (" << statistics.garbageCollectionTime << "ms)";
+    if (statistics.memoryInUse) {
+        out << ", memory in use: " << (statistics.memoryInUse.value() / (1024 * 1024)) << "MB";
+    }
+    return out;
+}
+
+}  // namespace dd
+}  // namespace storm
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <ostream>
+
+namespace storm {
+namespace dd {
+
+/*!
+ * Statistics about the tables of a DD manager. Values that the underlying library does not provide are not set.
+ */
+struct DdManagerStatistics {
+    // The number of nodes currently stored in the unique table(s).
+    uint64_t nodeCount = 0;
+
+    // The maximal number of nodes that were stored in the unique table(s) so far.
+    std::optional<uint64_t> peakNodeCount;
+
+    // The number of slots of the unique table(s).
+    uint64_t uniqueTableSize = 0;
+
+    // The number of slots in the operation cache.
+    uint64_t cacheSize = 0;
+
+    // The number of lookups in the operation cache and how many of them were hits.
+    std::optional<uint64_t> cacheLookups;
+    std::optional<uint64_t> cacheHits;
+
+    // The number of garbage collections and the total time (in milliseconds) spent in them.
+    uint64_t garbageCollections = 0;
+    uint64_t garbageCollectionTime = 0;
+
+    // The memory (in bytes) that is currently in use by the library.
+    std::optional<uint64_t> memoryInUse;
+};
+
+std::ostream& operator<<(std::ostream& out, DdManagerStatistics const& statistics);
+
+}  // namespace dd
+}  // namespace storm
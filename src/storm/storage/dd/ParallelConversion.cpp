@@ -0,0 +1,34 @@
+#include "storm/storage/dd/ParallelConversion.h"
+
+#include <algorithm>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+namespace storm {
+namespace dd {
+
+// The minimal number of rows per thread for which a concurrent conversion pays off.
+static const uint64_t minimalNumberOfRowsPerThread = 50000;
+
+// The number of parts per thread. Several parts per thread balance the load if the entries are not spread evenly over the rows.
+static const uint64_t numberOfPartsPerThread = 16;
+
+uint64_t getNumberOfConversionThreads(uint64_t numberOfRows) {
+    if (!storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+        return 1;
+    }
+    return std::min<uint64_t>(storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads(),
+                              std::max<uint64_t>(1, numberOfRows / minimalNumberOfRowsPerThread));
+}
+
+uint64_t getConversionSplitLevel(uint64_t numberOfThreads, uint64_t numberOfRowLevels) {
+    uint64_t level = 0;
+    while (level < numberOfRowLevels && (1ull << level) < numberOfThreads * numberOfPartsPerThread) {
+        ++level;
+    }
+    return level;
+}
+
+}  // namespace dd
+}  // namespace storm
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace dd {
+
+/*!
+ * Retrieves the number of threads with which a DD over the given number of rows is converted to a sparse matrix. Small DDs are converted sequentially.
+ * Only DDs over double values should be converted concurrently, as the arithmetic of the other value types is not thread-safe.
+ */
+uint64_t getNumberOfConversionThreads(uint64_t numberOfRows);
+
+/*!
+ * Retrieves the number of row levels after which the conversion splits the DD into parts that are converted concurrently by the given number of threads.
+ */
+uint64_t getConversionSplitLevel(uint64_t numberOfThreads, uint64_t numberOfRowLevels);
+
+/*!
+ * Converts the given subproblems of a split DD concurrently. Subproblems with the same row offset write to the same rows, so they are converted by the
+ * same thread in the order in which the sequential traversal would have visited them. All other subproblems are converted independently.
+ *
+ * @param numberOfThreads The maximal number of threads to use.
+ * @param subproblems The subproblems in the order of the sequential traversal. Each subproblem has a field rowOffset. The subproblems are reordered.
+ * @param convert The function that converts a single subproblem.
+ */
+template<typename Subproblem, typename Function>
+void convertSubproblemsConcurrently(uint64_t numberOfThreads, std::vector<Subproblem>& subproblems, Function const& convert) {
+    std::stable_sort(subproblems.begin(), subproblems.end(), [](Subproblem const& a, Subproblem const& b) { return a.rowOffset < b.rowOffset; });
+    std::vector<uint64_t> groupIndices;
+    for (uint64_t index = 0; index < subproblems.size(); ++index) {
+        if (index == 0 || subproblems[index].rowOffset != subproblems[index - 1].rowOffset) {
+            groupIndices.push_back(index);
+        }
+    }
+    groupIndices.push_back(subproblems.size());
+
+    storm::utility::parallel::forEachBlock(numberOfThreads, static_cast<uint64_t>(0), groupIndices.size() - 1, 1, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t group = begin; group < end; ++group) {
+            for (uint64_t index = groupIndices[group]; index < groupIndices[group + 1]; ++index) {
+                convert(subproblems[index]);
+            }
+        }
+    });
+}
+
+}  // namespace dd
+}  // namespace storm
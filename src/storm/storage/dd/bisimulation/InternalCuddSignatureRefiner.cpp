@@ -25,6 +25,8 @@ InternalSignatureRefiner<storm::dd::DdType::CUDD, ValueType>::InternalSignatureR
       options(options),
       nextFreeBlockIndex(0),
       numberOfRefinements(0),
+      lastSignatureCacheSize(0),
+      lastReuseBlocksCacheSize(0),
       signatureCache(),
       reuseBlocksCache() {
     // Initialize precomputed data.
@@ -47,6 +49,8 @@ Partition<storm::dd::DdType::CUDD, ValueType> InternalSignatureRefiner<storm::dd
 
 template<typename ValueType>
 void InternalSignatureRefiner<storm::dd::DdType::CUDD, ValueType>::clearCaches() {
+    lastSignatureCacheSize = signatureCache.size();
+    lastReuseBlocksCacheSize = reuseBlocksCache.size();
     signatureCache.clear();
     reuseBlocksCache.clear();
 }
@@ -59,6 +63,10 @@ InternalSignatureRefiner<storm::dd::DdType::CUDD, ValueType>::refine(Partition<s
 
     nextFreeBlockIndex = options.reuseBlockNumbers ? oldPartition.getNextFreeBlockIndex() : 0;
 
+    // Subsequent refinements traverse DDs of similar size, so we avoid growing the caches step by step (clearing them releases their memory).
+    signatureCache.reserve(lastSignatureCacheSize);
+    reuseBlocksCache.reserve(lastReuseBlocksCacheSize);
+
     // Perform the actual recursive refinement step.
     std::pair<DdNodePtr, DdNodePtr> result =
         refine(oldPartition.asAdd().getInternalAdd().getCuddDdNode(), signatureAdd.getInternalAdd().getCuddDdNode(),
@@ -78,6 +78,10 @@ class InternalSignatureRefiner<storm::dd::DdType::CUDD, ValueType> {
     // The number of completed refinements.
     uint64_t numberOfRefinements;
 
+    // The sizes of the caches in the last refinement, which are used to reserve space for the next one.
+    uint64_t lastSignatureCacheSize;
+    uint64_t lastReuseBlocksCacheSize;
+
     // The cache used to identify states with identical signature.
     phmap::flat_hash_map<std::pair<DdNode const*, DdNode const*>, std::pair<DdNodePtr, DdNodePtr>, CuddPointerPairHash> signatureCache;
 
@@ -1,16 +1,24 @@
 #include "storm/storage/dd/bisimulation/PartialQuotientExtractor.h"
 
+#include <algorithm>
+
+#include "storm/storage/BitVector.h"
 #include "storm/storage/dd/DdManager.h"
 
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/Mdp.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/models/symbolic/StochasticTwoPlayerGame.h"
 
+#include "storm/transformer/SymbolicToSparseTransformer.h"
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BisimulationSettings.h"
 
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -22,21 +30,106 @@ template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
 PartialQuotientExtractor<DdType, ValueType, ExportValueType>::PartialQuotientExtractor(storm::models::symbolic::Model<DdType, ValueType> const& model,
                                                                                        storm::dd::bisimulation::QuotientFormat const& quotientFormat)
     : model(model), quotientFormat(quotientFormat) {
-    if (this->quotientFormat != storm::dd::bisimulation::QuotientFormat::Dd) {
-        STORM_LOG_ERROR("Only DD-based partial quotient extraction is currently supported. Switching to DD-based extraction.");
+    if (this->quotientFormat == storm::dd::bisimulation::QuotientFormat::Sparse && model.getType() != storm::models::ModelType::Dtmc) {
+        STORM_LOG_ERROR("Sparse partial quotient extraction is only supported for DTMCs. Switching to DD-based extraction.");
         this->quotientFormat = storm::dd::bisimulation::QuotientFormat::Dd;
     }
 }
 
+namespace {
+
+/*!
+ * Retrieves whether the given rows of an MDP have the same entries and the same rewards.
+ */
+template<typename ValueType>
+bool areRowsEqual(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<std::vector<ValueType> const*> const& choiceRewards, uint64_t firstRow,
+                  uint64_t secondRow) {
+    auto firstRowEntries = matrix.getRow(firstRow);
+    auto secondRowEntries = matrix.getRow(secondRow);
+    if (firstRowEntries.getNumberOfEntries() != secondRowEntries.getNumberOfEntries() ||
+        !std::equal(firstRowEntries.begin(), firstRowEntries.end(), secondRowEntries.begin(),
+                    [](auto const& first, auto const& second) { return first.getColumn() == second.getColumn() && first.getValue() == second.getValue(); })) {
+        return false;
+    }
+    return std::all_of(choiceRewards.begin(), choiceRewards.end(), [&](auto const* rewards) { return (*rewards)[firstRow] == (*rewards)[secondRow]; });
+}
+
+/*!
+ * Removes the choices of the given (partial quotient) MDP that are identical to another choice of the same state. In a partial quotient, every state of
+ * the original model yields a choice of its block, but many of them typically coincide.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Mdp<ValueType>> removeDuplicateChoices(storm::models::sparse::Mdp<ValueType> const& mdp) {
+    storm::storage::SparseMatrix<ValueType> const& matrix = mdp.getTransitionMatrix();
+    std::vector<std::vector<ValueType> const*> choiceRewards;
+    for (auto const& rewardModel : mdp.getRewardModels()) {
+        if (rewardModel.second.hasStateActionRewards()) {
+            choiceRewards.push_back(&rewardModel.second.getStateActionRewardVector());
+        }
+    }
+
+    // Rows are sorted by their columns such that only rows with the same columns need to be compared.
+    auto hasSmallerColumns = [&matrix](uint64_t firstRow, uint64_t secondRow) {
+        auto firstRowEntries = matrix.getRow(firstRow);
+        auto secondRowEntries = matrix.getRow(secondRow);
+        return std::lexicographical_compare(firstRowEntries.begin(), firstRowEntries.end(), secondRowEntries.begin(), secondRowEntries.end(),
+                                            [](auto const& first, auto const& second) { return first.getColumn() < second.getColumn(); });
+    };
+    storm::storage::BitVector keptRows(matrix.getRowCount(), false);
+    std::vector<uint64_t> rows;
+    for (uint64_t state = 0; state < matrix.getRowGroupCount(); ++state) {
+        rows.clear();
+        for (auto row : matrix.getRowGroupIndices(state)) {
+            rows.push_back(row);
+        }
+        std::stable_sort(rows.begin(), rows.end(), hasSmallerColumns);
+        auto rangeStart = rows.begin();
+        while (rangeStart != rows.end()) {
+            auto rangeEnd = std::upper_bound(rangeStart, rows.end(), *rangeStart, hasSmallerColumns);
+            for (auto rowIt = rangeStart; rowIt != rangeEnd; ++rowIt) {
+                auto isDuplicate = [&](uint64_t keptRow) { return keptRows.get(keptRow) && areRowsEqual(matrix, choiceRewards, keptRow, *rowIt); };
+                if (std::none_of(rangeStart, rowIt, isDuplicate)) {
+                    keptRows.set(*rowIt);
+                }
+            }
+            rangeStart = rangeEnd;
+        }
+    }
+    if (keptRows.full()) {
+        return std::make_shared<storm::models::sparse::Mdp<ValueType>>(mdp);
+    }
+
+    storm::storage::SparseMatrix<ValueType> reducedMatrix = matrix.restrictRows(keptRows, true);
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
+    for (auto const& rewardModel : mdp.getRewardModels()) {
+        std::optional<std::vector<ValueType>> stateRewards;
+        std::optional<std::vector<ValueType>> stateActionRewards;
+        if (rewardModel.second.hasStateRewards()) {
+            stateRewards = rewardModel.second.getStateRewardVector();
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            stateActionRewards = storm::utility::vector::filterVector(rewardModel.second.getStateActionRewardVector(), keptRows);
+        }
+        rewardModels.emplace(rewardModel.first, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewards), std::move(stateActionRewards)));
+    }
+    STORM_LOG_TRACE("Removed " << (matrix.getRowCount() - reducedMatrix.getRowCount()) << " duplicate choices from the partial quotient.");
+    return std::make_shared<storm::models::sparse::Mdp<ValueType>>(std::move(reducedMatrix), storm::models::sparse::StateLabeling(mdp.getStateLabeling()),
+                                                                   std::move(rewardModels));
+}
+
+}  // namespace
+
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
 std::shared_ptr<storm::models::Model<ExportValueType>> PartialQuotientExtractor<DdType, ValueType, ExportValueType>::extract(
     Partition<DdType, ValueType> const& partition, PreservationInformation<DdType, ValueType> const& preservationInformation) {
     auto start = std::chrono::high_resolution_clock::now();
     std::shared_ptr<storm::models::Model<ExportValueType>> result;
 
-    STORM_LOG_THROW(this->quotientFormat == storm::dd::bisimulation::QuotientFormat::Dd, storm::exceptions::NotSupportedException,
-                    "Only DD-based partial quotient extraction is currently supported.");
-    result = extractDdQuotient(partition, preservationInformation);
+    if (this->quotientFormat == storm::dd::bisimulation::QuotientFormat::Sparse) {
+        result = extractSparseQuotient(partition, preservationInformation);
+    } else {
+        result = extractDdQuotient(partition, preservationInformation);
+    }
     auto end = std::chrono::high_resolution_clock::now();
     STORM_LOG_TRACE("Quotient extraction completed in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
 
@@ -45,6 +138,17 @@ std::shared_ptr<storm::models::Model<ExportValueType>> PartialQuotientExtractor<
     return result;
 }
 
+template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
+std::shared_ptr<storm::models::sparse::Model<ExportValueType>> PartialQuotientExtractor<DdType, ValueType, ExportValueType>::extractSparseQuotient(
+    Partition<DdType, ValueType> const& partition, PreservationInformation<DdType, ValueType> const& preservationInformation) {
+    // The symbolic quotient is built first as it allows to determine the quotient transitions of all states of a block at once.
+    auto ddQuotient = extractDdQuotient(partition, preservationInformation);
+    STORM_LOG_ASSERT(ddQuotient->getType() == storm::models::ModelType::Mdp, "Expected the partial quotient of a DTMC to be an MDP.");
+    auto sparseQuotient = storm::transformer::SymbolicMdpToSparseMdpTransformer<DdType, ExportValueType>::translate(
+        *ddQuotient->template as<storm::models::symbolic::Mdp<DdType, ExportValueType>>());
+    return removeDuplicateChoices(*sparseQuotient);
+}
+
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
 std::shared_ptr<storm::models::symbolic::Model<DdType, ExportValueType>> PartialQuotientExtractor<DdType, ValueType, ExportValueType>::extractDdQuotient(
     Partition<DdType, ValueType> const& partition, PreservationInformation<DdType, ValueType> const& preservationInformation) {
@@ -15,6 +15,12 @@ namespace storm {
 namespace dd {
 namespace bisimulation {
 
+/*!
+ * Extracts quotients for partitions that are not yet stable. For a DTMC, the partial quotient is an MDP that can choose in each block which of its states
+ * it mimics, so minimal and maximal values in the quotient are lower and upper bounds on the values of the states in the block. Likewise, the quotient
+ * of an MDP is a stochastic game. Partial quotients of DTMCs can also be extracted in the sparse format, in which choices that are identical in the
+ * quotient are merged.
+ */
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType = ValueType>
 class PartialQuotientExtractor {
    public:
@@ -24,6 +30,9 @@ class PartialQuotientExtractor {
                                                                    PreservationInformation<DdType, ValueType> const& preservationInformation);
 
    private:
+    std::shared_ptr<storm::models::sparse::Model<ExportValueType>> extractSparseQuotient(
+        Partition<DdType, ValueType> const& partition, PreservationInformation<DdType, ValueType> const& preservationInformation);
+
     std::shared_ptr<storm::models::symbolic::Model<DdType, ExportValueType>> extractDdQuotient(
         Partition<DdType, ValueType> const& partition, PreservationInformation<DdType, ValueType> const& preservationInformation);
 
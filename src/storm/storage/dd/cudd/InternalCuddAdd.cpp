@@ -1,6 +1,7 @@
 #include "storm/storage/dd/cudd/InternalCuddAdd.h"
 
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/ParallelConversion.h"
 #include "storm/storage/dd/cudd/CuddAddIterator.h"
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
 #include "storm/storage/dd/cudd/InternalCuddDdManager.h"
@@ -729,9 +730,23 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_f
                                                               std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                               Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0,
-                                 ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices,
-                                 writeValues);
+    uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+    uint64_t numberOfThreads = std::is_same<ValueType, double>::value ? getNumberOfConversionThreads(rowOdd.getTotalOffset()) : 1;
+    if (numberOfThreads == 1) {
+        toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0,
+                              ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        return;
+    }
+
+    // Split the DD along the first row levels of the ODD and convert the parts that cover disjoint row ranges concurrently.
+    MatrixComponentsSplit split;
+    split.level = getConversionSplitLevel(numberOfThreads, ddRowVariableIndices.size());
+    toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0,
+                          ddRowVariableIndices, ddColumnVariableIndices, writeValues, &split);
+    convertSubproblemsConcurrently(numberOfThreads, split.subproblems, [&](MatrixComponentsSubproblem const& subproblem) {
+        toMatrixComponentsRec(subproblem.dd, rowGroupIndices, rowIndications, columnsAndValues, *subproblem.rowOdd, *subproblem.columnOdd, split.level,
+                              split.level, maxLevel, subproblem.rowOffset, subproblem.columnOffset, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+    });
 }
 
 template<typename ValueType>
@@ -741,12 +756,19 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* d
                                                                  Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel,
                                                                  uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
                                                                  uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
+                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues,
+                                                                 MatrixComponentsSplit* split) const {
     // For the empty DD, we do not need to add any entries.
     if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
         return;
     }
 
+    // Stop at the split level and leave the conversion of the subproblem to the caller.
+    if (split != nullptr && currentRowLevel == split->level) {
+        split->subproblems.push_back({dd, &rowOdd, &columnOdd, currentRowOffset, currentColumnOffset});
+        return;
+    }
+
     // If we are at the maximal level, the value to be set is stored as a constant in the DD.
     if (currentRowLevel + currentColumnLevel == maxLevel) {
         if (generateValues) {
@@ -786,19 +808,19 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* d
         // Visit else-else.
         toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(),
                               currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices,
-                              ddColumnVariableIndices, generateValues);
+                              ddColumnVariableIndices, generateValues, split);
         // Visit else-then.
         toMatrixComponentsRec(elseThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(),
                               currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(),
-                              ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              ddRowVariableIndices, ddColumnVariableIndices, generateValues, split);
         // Visit then-else.
         toMatrixComponentsRec(thenElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(),
                               currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset,
-                              ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              ddRowVariableIndices, ddColumnVariableIndices, generateValues, split);
         // Visit then-then.
         toMatrixComponentsRec(thenThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(),
                               currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(),
-                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues, split);
     }
 }
 
@@ -8,7 +8,10 @@
 namespace storm {
 namespace dd {
 
-InternalDdManager<DdType::CUDD>::InternalDdManager() : cuddManager(), reorderingTechnique(CUDD_REORDER_NONE), numberOfDdVariables(0) {
+InternalDdManager<DdType::CUDD>::InternalDdManager()
+    : cuddManager(0, 0, CUDD_UNIQUE_SLOTS, static_cast<unsigned int>(storm::settings::getModule<storm::settings::modules::CuddSettings>().getCacheSize())),
+      reorderingTechnique(CUDD_REORDER_NONE),
+      numberOfDdVariables(0) {
     this->cuddManager.SetMaxMemory(
         static_cast<unsigned long>(storm::settings::getModule<storm::settings::modules::CuddSettings>().getMaximalMemory() * 1024ul * 1024ul));
 
@@ -196,6 +199,21 @@ void InternalDdManager<DdType::CUDD>::triggerReordering() {
     this->getCuddManager().ReduceHeap(this->reorderingTechnique, 0);
 }
 
+DdManagerStatistics InternalDdManager<DdType::CUDD>::getStatistics() const {
+    ::DdManager* manager = this->getCuddManager().getManager();
+    DdManagerStatistics statistics;
+    statistics.nodeCount = Cudd_ReadKeys(manager) - Cudd_ReadDead(manager);
+    statistics.peakNodeCount = Cudd_ReadPeakNodeCount(manager);
+    statistics.uniqueTableSize = Cudd_ReadSlots(manager);
+    statistics.cacheSize = Cudd_ReadCacheSlots(manager);
+    statistics.cacheLookups = static_cast<uint64_t>(Cudd_ReadCacheLookUps(manager));
+    statistics.cacheHits = static_cast<uint64_t>(Cudd_ReadCacheHits(manager));
+    statistics.garbageCollections = Cudd_ReadGarbageCollections(manager);
+    statistics.garbageCollectionTime = Cudd_ReadGarbageCollectionTime(manager);
+    statistics.memoryInUse = Cudd_ReadMemoryInUse(manager);
+    return statistics;
+}
+
 void InternalDdManager<DdType::CUDD>::debugCheck() const {
     this->getCuddManager().CheckKeys();
     this->getCuddManager().DebugCheck();
@@ -4,6 +4,7 @@
 #include <boost/optional.hpp>
 #include <functional>
 
+#include "storm/storage/dd/DdManagerStatistics.h"
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalDdManager.h"
 
@@ -132,6 +133,11 @@ class InternalDdManager<DdType::CUDD> {
      */
     void debugCheck() const;
 
+    /*!
+     * Retrieves statistics about the unique table(s), the operation cache and the garbage collections.
+     */
+    DdManagerStatistics getStatistics() const;
+
     /*!
      * All code that manipulates DDs shall be called through this function.
      * This is generally needed to set-up the correct context.
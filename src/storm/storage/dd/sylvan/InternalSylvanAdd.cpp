@@ -3,6 +3,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/ParallelConversion.h"
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 #include "storm/storage/dd/sylvan/SylvanAddIterator.h"
 
@@ -1233,9 +1234,26 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint
                                                                 std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                                 Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
-                                 rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
-                                 ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+    MTBDD dd = this->getSylvanMtbdd().GetMTBDD();
+    uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+    uint64_t numberOfThreads = std::is_same<ValueType, double>::value ? getNumberOfConversionThreads(rowOdd.getTotalOffset()) : 1;
+    if (numberOfThreads == 1) {
+        toMatrixComponentsRec(mtbdd_regular(dd), mtbdd_hascomp(dd), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0,
+                              0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        return;
+    }
+
+    // Split the DD along the first row levels of the ODD and convert the parts that cover disjoint row ranges concurrently. The traversal only reads
+    // nodes, so the threads do not need to be workers of sylvan.
+    MatrixComponentsSplit split;
+    split.level = getConversionSplitLevel(numberOfThreads, ddRowVariableIndices.size());
+    toMatrixComponentsRec(mtbdd_regular(dd), mtbdd_hascomp(dd), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0,
+                          ddRowVariableIndices, ddColumnVariableIndices, writeValues, &split);
+    convertSubproblemsConcurrently(numberOfThreads, split.subproblems, [&](MatrixComponentsSubproblem const& subproblem) {
+        toMatrixComponentsRec(subproblem.dd, subproblem.negated, rowGroupIndices, rowIndications, columnsAndValues, *subproblem.rowOdd, *subproblem.columnOdd,
+                              split.level, split.level, maxLevel, subproblem.rowOffset, subproblem.columnOffset, ddRowVariableIndices, ddColumnVariableIndices,
+                              writeValues);
+    });
 }
 
 template<typename ValueType>
@@ -1245,12 +1263,19 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
                                                                    Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel,
                                                                    uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
                                                                    uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                                   std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
+                                                                   std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues,
+                                                                   MatrixComponentsSplit* split) const {
     // For the empty DD, we do not need to add any entries.
     if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
         return;
     }
 
+    // Stop at the split level and leave the conversion of the subproblem to the caller.
+    if (split != nullptr && currentRowLevel == split->level) {
+        split->subproblems.push_back({dd, negated, &rowOdd, &columnOdd, currentRowOffset, currentColumnOffset});
+        return;
+    }
+
     // If we are at the maximal level, the value to be set is stored as a constant in the DD.
     if (currentRowLevel + currentColumnLevel == maxLevel) {
         if (generateValues) {
@@ -1290,20 +1315,21 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
         // Visit else-else.
         toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
                               rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset,
-                              currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues, split);
         // Visit else-then.
         toMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
                               rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset,
-                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues, split);
         // Visit then-else.
         toMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
                               rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
-                              currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues,
+                              split);
         // Visit then-then.
         toMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
                               rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
                               currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices,
-                              ddColumnVariableIndices, generateValues);
+                              ddColumnVariableIndices, generateValues, split);
     }
 }
 
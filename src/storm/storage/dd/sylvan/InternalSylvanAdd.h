@@ -781,6 +781,27 @@ class InternalAdd<DdType::Sylvan, ValueType> {
     static MTBDD fromVectorRec(uint_fast64_t& currentOffset, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<ValueType> const& values,
                                Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices);
 
+    /*!
+     * The part of the matrix encoded by a DD node below the first row levels.
+     */
+    struct MatrixComponentsSubproblem {
+        MTBDD dd;
+        bool negated;
+        Odd const* rowOdd;
+        Odd const* columnOdd;
+        uint_fast64_t rowOffset;
+        uint_fast64_t columnOffset;
+    };
+
+    /*!
+     * The subproblems below the first row levels of a DD in the order of the sequential traversal. Subproblems with different row offsets cover
+     * disjoint row ranges and can thus be converted concurrently.
+     */
+    struct MatrixComponentsSplit {
+        uint_fast64_t level;
+        std::vector<MatrixComponentsSubproblem> subproblems;
+    };
+
     /*!
      * Helper function to convert the DD into a (sparse) matrix.
      *
@@ -806,12 +827,14 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      * @param generateValues If set to true, the vector columnsAndValues is filled with the actual entries, which
      * only works if the offsets given in rowIndications are already correct. If they need to be computed first,
      * this flag needs to be false.
+     * @param split If given, the traversal stops after the row levels of the split and records the remaining subproblems in
+     * the split instead of converting them.
      */
     void toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications,
                                std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd,
                                uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
                                uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
+                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues, MatrixComponentsSplit* split = nullptr) const;
 
     /*!
      * Retrieves the sylvan representation of the given double value.
@@ -1,5 +1,6 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
+#include <chrono>
 #include <cmath>
 #include <iostream>
 
@@ -8,11 +9,13 @@
 
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/TaskRuntime.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/sylvan.h"
+#include "sylvan_cache.h"
 
 #include "storm-config.h"
 
@@ -25,15 +28,23 @@ namespace dd {
 #pragma clang diagnostic ignored "-Wc99-extensions"
 #endif
 
-#ifndef NDEBUG
+namespace {
+// Sylvan only collects garbage in a single (stop-the-world) phase at a time, so the hooks do not need to synchronize.
+uint64_t numberOfGarbageCollections = 0;
+uint64_t garbageCollectionTime = 0;
+std::chrono::steady_clock::time_point garbageCollectionStart;
+}  // namespace
+
 VOID_TASK_0(gc_start) {
     STORM_LOG_TRACE("Starting sylvan garbage collection...");
+    garbageCollectionStart = std::chrono::steady_clock::now();
 }
 
 VOID_TASK_0(gc_end) {
+    ++numberOfGarbageCollections;
+    garbageCollectionTime += std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - garbageCollectionStart).count();
     STORM_LOG_TRACE("Sylvan garbage collection done.");
 }
-#endif
 
 VOID_TASK_2(execute_sylvan, std::function<void()> const*, f, std::exception_ptr*, e) {
     try {
@@ -72,17 +83,27 @@ InternalDdManager<DdType::Sylvan>::InternalDdManager() {
 
         lace_start(settings.getNumberOfThreads(), task_deque_size);
 
-        sylvan_set_limits(storm::settings::getModule<storm::settings::modules::SylvanSettings>().getMaximalMemory() * 1024 * 1024, 0, 0);
+        sylvan_set_limits(settings.getMaximalMemory() * 1024 * 1024, static_cast<int>(settings.getTableRatio()), 0);
         sylvan_init_package();
 
         sylvan::Sylvan::initBdd();
         sylvan::Sylvan::initMtbdd();
         sylvan::Sylvan::initCustomMtbdd();
 
-#ifndef NDEBUG
         sylvan_gc_hook_pregc(TASK(gc_start));
         sylvan_gc_hook_postgc(TASK(gc_end));
-#endif
+
+        // Let the lace threads sleep while the workers of the task runtime are busy. Suspending and resuming lace is reference counted, so this does not
+        // interfere with DD operations that are started concurrently. Computations that run inside a lace worker can not suspend lace.
+        storm::utility::parallel::TaskRuntime::runtime().setExternalPoolHooks(
+            []() {
+                if (lace_is_worker()) {
+                    return false;
+                }
+                lace_suspend();
+                return true;
+            },
+            []() { lace_resume(); });
         // TODO: uncomment these to disable lace threads whenever they are not used. This requires that *all* DD code is run through execute
         // lace_suspend();
         // suspended = true;
@@ -98,6 +119,7 @@ InternalDdManager<DdType::Sylvan>::~InternalDdManager() {
         //                sylvan_stats_report(filePointer, 0);
         //                fclose(filePointer);
 
+        storm::utility::parallel::TaskRuntime::runtime().resetExternalPoolHooks();
         sylvan::Sylvan::quitPackage();
         lace_stop();
     }
@@ -241,6 +263,19 @@ void InternalDdManager<DdType::Sylvan>::triggerReordering() {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
 }
 
+DdManagerStatistics InternalDdManager<DdType::Sylvan>::getStatistics() const {
+    DdManagerStatistics statistics;
+    size_t filled = 0;
+    size_t total = 0;
+    sylvan_table_usage(&filled, &total);
+    statistics.nodeCount = filled;
+    statistics.uniqueTableSize = total;
+    statistics.cacheSize = cache_getsize();
+    statistics.garbageCollections = numberOfGarbageCollections;
+    statistics.garbageCollectionTime = garbageCollectionTime;
+    return statistics;
+}
+
 void InternalDdManager<DdType::Sylvan>::debugCheck() const {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
 }
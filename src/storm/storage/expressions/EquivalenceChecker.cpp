@@ -21,6 +21,10 @@ void EquivalenceChecker::addConstraints(std::vector<storm::expressions::Expressi
 }
 
 bool EquivalenceChecker::areEquivalent(storm::expressions::Expression const& first, storm::expressions::Expression const& second) {
+    // Shared (e.g. hash-consed) expressions are trivially equivalent.
+    if (first.areSame(second)) {
+        return true;
+    }
     this->smtSolver->push();
     this->smtSolver->add(!storm::expressions::iff(first, second));
     bool equivalent = smtSolver->check() == storm::solver::SmtSolver::CheckResult::Unsat;
@@ -29,6 +33,9 @@ bool EquivalenceChecker::areEquivalent(storm::expressions::Expression const& fir
 }
 
 bool EquivalenceChecker::areEquivalentModuloNegation(storm::expressions::Expression const& first, storm::expressions::Expression const& second) {
+    if (first.areSame(second)) {
+        return true;
+    }
     this->smtSolver->push();
     this->smtSolver->add(!storm::expressions::iff(first, second));
     bool equivalent = smtSolver->check() == storm::solver::SmtSolver::CheckResult::Unsat;
@@ -3,6 +3,7 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/UniqueExpressionTable.h"
 #include "storm/storage/expressions/Variable.h"
 #include "storm/utility/macros.h"
 
@@ -78,7 +79,10 @@ ExpressionManager::~ExpressionManager() {
 }
 
 std::shared_ptr<ExpressionManager> ExpressionManager::clone() const {
-    return std::shared_ptr<ExpressionManager>(new ExpressionManager(*this));
+    std::shared_ptr<ExpressionManager> result(new ExpressionManager(*this));
+    // The representatives refer to this manager, so they must not be shared with the clone.
+    result->uniqueExpressions.reset();
+    return result;
 }
 
 Expression ExpressionManager::boolean(bool value) const {
@@ -328,6 +332,30 @@ std::shared_ptr<ExpressionManager const> ExpressionManager::getSharedPointer() c
     return this->shared_from_this();
 }
 
+Expression ExpressionManager::getUniqueExpression(Expression const& expression) const {
+    STORM_LOG_THROW(expression.getManager() == *this, storm::exceptions::InvalidArgumentException, "Expression is managed by a different manager.");
+    if (!uniqueExpressions) {
+        uniqueExpressions = std::make_shared<UniqueExpressionTable>();
+    }
+    return Expression(uniqueExpressions->getUnique(expression.getBaseExpressionPointer()));
+}
+
+Expression ExpressionManager::getSimplifiedUniqueExpression(Expression const& expression) const {
+    STORM_LOG_THROW(expression.getManager() == *this, storm::exceptions::InvalidArgumentException, "Expression is managed by a different manager.");
+    if (!uniqueExpressions) {
+        uniqueExpressions = std::make_shared<UniqueExpressionTable>();
+    }
+    return Expression(uniqueExpressions->getSimplifiedUnique(expression.getBaseExpressionPointer()));
+}
+
+uint64_t ExpressionManager::getNumberOfUniqueExpressionNodes() const {
+    return uniqueExpressions ? uniqueExpressions->size() : 0;
+}
+
+void ExpressionManager::clearUniqueExpressions() const {
+    uniqueExpressions.reset();
+}
+
 std::ostream& operator<<(std::ostream& out, ExpressionManager const& manager) {
     out << "manager {\n";
 
@@ -19,6 +19,7 @@ namespace storm {
 namespace expressions {
 // Forward-declare manager class for iterator class.
 class ExpressionManager;
+class UniqueExpressionTable;
 
 class VariableIterator {
    public:
@@ -395,6 +396,34 @@ class ExpressionManager : public std::enable_shared_from_this<ExpressionManager>
      */
     std::shared_ptr<ExpressionManager const> getSharedPointer() const;
 
+    /*!
+     * Retrieves the unique representative of the given expression (hash-consing). Structurally equal expressions of this manager are mapped to
+     * representatives with the same base expression that also share all common subexpressions. Syntactic equality of representatives can thus be checked
+     * in constant time via Expression::areSame.
+     *
+     * @param expression The expression whose representative to retrieve.
+     * @return The representative.
+     */
+    Expression getUniqueExpression(Expression const& expression) const;
+
+    /*!
+     * Retrieves the unique representative of the simplified given expression. The simplification of each representative is only computed once.
+     *
+     * @param expression The expression to simplify.
+     * @return The representative of the simplified expression.
+     */
+    Expression getSimplifiedUniqueExpression(Expression const& expression) const;
+
+    /*!
+     * Retrieves the number of expression nodes that are currently kept as unique representatives.
+     */
+    uint64_t getNumberOfUniqueExpressionNodes() const;
+
+    /*!
+     * Releases all unique representatives. Representatives retrieved afterwards are thus not shared with the ones retrieved before.
+     */
+    void clearUniqueExpressions() const;
+
     friend std::ostream& operator<<(std::ostream& out, ExpressionManager const& manager);
 
    private:
@@ -487,6 +516,9 @@ class ExpressionManager : public std::enable_shared_from_this<ExpressionManager>
     mutable boost::optional<Type> rationalType;
     mutable std::unordered_set<Type> arrayTypes;
 
+    // The unique representatives of expressions (created on demand).
+    mutable std::shared_ptr<UniqueExpressionTable> uniqueExpressions;
+
     // A mask that can be used to query whether a variable is an auxiliary variable.
     static const uint64_t auxiliaryMask = (1ull << 50);
 
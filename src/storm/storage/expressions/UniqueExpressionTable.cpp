@@ -0,0 +1,158 @@
+#include "storm/storage/expressions/UniqueExpressionTable.h"
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/constants.h"
+
+namespace storm {
+namespace expressions {
+
+bool UniqueExpressionTable::NodeKey::operator==(NodeKey const& other) const {
+    return kind == other.kind && operatorType == other.operatorType && value == other.value && rationalValue == other.rationalValue && type == other.type &&
+           operands == other.operands;
+}
+
+std::size_t UniqueExpressionTable::NodeKeyHash::operator()(NodeKey const& key) const {
+    std::size_t seed = static_cast<std::size_t>(key.kind);
+    boost::hash_combine(seed, key.operatorType);
+    boost::hash_combine(seed, key.value);
+    boost::hash_combine(seed, std::hash<Type>()(key.type));
+    if (!key.rationalValue.empty()) {
+        boost::hash_combine(seed, key.rationalValue);
+    }
+    for (auto operand : key.operands) {
+        boost::hash_combine(seed, operand);
+    }
+    return seed;
+}
+
+std::shared_ptr<BaseExpression const> UniqueExpressionTable::getUnique(std::shared_ptr<BaseExpression const> const& expression) {
+    if (representativeAddresses.count(expression.get()) > 0) {
+        return expression;
+    }
+
+    NodeKey key;
+    key.type = expression->getType();
+    if (expression->isVariableExpression()) {
+        key.kind = NodeKind::Variable;
+        key.value = static_cast<int64_t>(static_cast<VariableExpression const&>(*expression).getVariable().getIndex());
+    } else if (expression->isBooleanLiteralExpression()) {
+        key.kind = NodeKind::BooleanLiteral;
+        key.value = static_cast<BooleanLiteralExpression const&>(*expression).getValue();
+    } else if (expression->isIntegerLiteralExpression()) {
+        key.kind = NodeKind::IntegerLiteral;
+        key.value = static_cast<IntegerLiteralExpression const&>(*expression).getValue();
+    } else if (expression->isRationalLiteralExpression()) {
+        key.kind = NodeKind::RationalLiteral;
+        key.rationalValue = storm::utility::to_string(static_cast<RationalLiteralExpression const&>(*expression).getValue());
+    } else if (expression->isIfThenElseExpression()) {
+        key.kind = NodeKind::IfThenElse;
+    } else if (expression->isBinaryBooleanFunctionExpression()) {
+        key.kind = NodeKind::BinaryBooleanFunction;
+        key.operatorType = static_cast<uint64_t>(static_cast<BinaryBooleanFunctionExpression const&>(*expression).getOperatorType());
+    } else if (expression->isBinaryNumericalFunctionExpression()) {
+        key.kind = NodeKind::BinaryNumericalFunction;
+        key.operatorType = static_cast<uint64_t>(static_cast<BinaryNumericalFunctionExpression const&>(*expression).getOperatorType());
+    } else if (expression->isBinaryRelationExpression()) {
+        key.kind = NodeKind::BinaryRelation;
+        key.operatorType = static_cast<uint64_t>(static_cast<BinaryRelationExpression const&>(*expression).getRelationType());
+    } else if (expression->isUnaryBooleanFunctionExpression()) {
+        key.kind = NodeKind::UnaryBooleanFunction;
+        key.operatorType = static_cast<uint64_t>(static_cast<UnaryBooleanFunctionExpression const&>(*expression).getOperatorType());
+    } else if (expression->isUnaryNumericalFunctionExpression()) {
+        key.kind = NodeKind::UnaryNumericalFunction;
+        key.operatorType = static_cast<uint64_t>(static_cast<UnaryNumericalFunctionExpression const&>(*expression).getOperatorType());
+    } else if (expression->isPredicateExpression()) {
+        key.kind = NodeKind::Predicate;
+        key.operatorType = static_cast<uint64_t>(static_cast<PredicateExpression const&>(*expression).getPredicateType());
+    } else {
+        key.kind = NodeKind::Opaque;
+        key.value = reinterpret_cast<int64_t>(expression.get());
+    }
+
+    // Retrieve the representatives of the operands first.
+    std::vector<std::shared_ptr<BaseExpression const>> operands;
+    bool operandsChanged = false;
+    if (key.kind != NodeKind::Opaque) {
+        operands.reserve(expression->getArity());
+        key.operands.reserve(expression->getArity());
+        for (uint64_t operandIndex = 0; operandIndex < expression->getArity(); ++operandIndex) {
+            auto operand = expression->getOperand(operandIndex);
+            operands.push_back(getUnique(operand));
+            operandsChanged |= operands.back() != operand;
+            key.operands.push_back(operands.back().get());
+        }
+    }
+
+    auto representativeIt = representatives.find(key);
+    if (representativeIt != representatives.end()) {
+        return representativeIt->second;
+    }
+
+    // The node is new, so it becomes the representative. We only need to create a fresh node if some operand was replaced by its representative.
+    std::shared_ptr<BaseExpression const> representative = expression;
+    if (operandsChanged) {
+        ExpressionManager const& manager = expression->getManager();
+        switch (key.kind) {
+            case NodeKind::IfThenElse:
+                representative = std::make_shared<IfThenElseExpression>(manager, key.type, operands[0], operands[1], operands[2]);
+                break;
+            case NodeKind::BinaryBooleanFunction:
+                representative = std::make_shared<BinaryBooleanFunctionExpression>(
+                    manager, key.type, operands[0], operands[1], static_cast<BinaryBooleanFunctionExpression::OperatorType>(key.operatorType));
+                break;
+            case NodeKind::BinaryNumericalFunction:
+                representative = std::make_shared<BinaryNumericalFunctionExpression>(
+                    manager, key.type, operands[0], operands[1], static_cast<BinaryNumericalFunctionExpression::OperatorType>(key.operatorType));
+                break;
+            case NodeKind::BinaryRelation:
+                representative = std::make_shared<BinaryRelationExpression>(manager, key.type, operands[0], operands[1],
+                                                                             static_cast<RelationType>(key.operatorType));
+                break;
+            case NodeKind::UnaryBooleanFunction:
+                representative = std::make_shared<UnaryBooleanFunctionExpression>(manager, key.type, operands[0],
+                                                                                   static_cast<UnaryBooleanFunctionExpression::OperatorType>(key.operatorType));
+                break;
+            case NodeKind::UnaryNumericalFunction:
+                representative = std::make_shared<UnaryNumericalFunctionExpression>(
+                    manager, key.type, operands[0], static_cast<UnaryNumericalFunctionExpression::OperatorType>(key.operatorType));
+                break;
+            case NodeKind::Predicate:
+                representative =
+                    std::make_shared<PredicateExpression>(manager, key.type, operands, static_cast<PredicateExpression::PredicateType>(key.operatorType));
+                break;
+            default:
+                // Leaves have no operands that could have changed.
+                break;
+        }
+    }
+    representativeAddresses.insert(representative.get());
+    representatives.emplace(std::move(key), representative);
+    return representative;
+}
+
+std::shared_ptr<BaseExpression const> UniqueExpressionTable::getSimplifiedUnique(std::shared_ptr<BaseExpression const> const& expression) {
+    auto unique = getUnique(expression);
+    auto simplifiedIt = simplifiedRepresentatives.find(unique.get());
+    if (simplifiedIt != simplifiedRepresentatives.end()) {
+        return simplifiedIt->second;
+    }
+    auto result = getUnique(unique->simplify());
+    simplifiedRepresentatives.emplace(unique.get(), result);
+    return result;
+}
+
+uint64_t UniqueExpressionTable::size() const {
+    return representatives.size();
+}
+
+void UniqueExpressionTable::clear() {
+    simplifiedRepresentatives.clear();
+    representativeAddresses.clear();
+    representatives.clear();
+}
+
+}  // namespace expressions
+}  // namespace storm
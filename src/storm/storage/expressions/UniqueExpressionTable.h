@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "storm/storage/expressions/Type.h"
+
+namespace storm {
+namespace expressions {
+
+class BaseExpression;
+
+/*!
+ * A table that hash-conses expressions, i.e., it maps every expression to a unique representative such that structurally equal (sub)expressions are
+ * represented by the very same node. Expressions retrieved from the table thus form a DAG without duplicated subexpressions, are syntactically equal iff
+ * their base expressions are the same and the simplification of each representative is computed only once.
+ *
+ * All representatives are kept alive by the table until it is cleared or destroyed.
+ */
+class UniqueExpressionTable {
+   public:
+    /*!
+     * Retrieves the unique representative of the given expression. The representatives of all subexpressions are unique as well.
+     */
+    std::shared_ptr<BaseExpression const> getUnique(std::shared_ptr<BaseExpression const> const& expression);
+
+    /*!
+     * Retrieves the unique representative of the simplified given expression. The simplification is cached for each representative.
+     */
+    std::shared_ptr<BaseExpression const> getSimplifiedUnique(std::shared_ptr<BaseExpression const> const& expression);
+
+    /*!
+     * Retrieves the number of unique nodes stored in this table.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Removes all representatives from the table.
+     */
+    void clear();
+
+   private:
+    enum class NodeKind : uint8_t {
+        IfThenElse,
+        BinaryBooleanFunction,
+        BinaryNumericalFunction,
+        BinaryRelation,
+        Variable,
+        UnaryBooleanFunction,
+        UnaryNumericalFunction,
+        BooleanLiteral,
+        IntegerLiteral,
+        RationalLiteral,
+        Predicate,
+        // Nodes of other kinds (e.g. JANI expressions) are never merged with other nodes.
+        Opaque
+    };
+
+    /*!
+     * The structure of a node. As the operands are unique representatives, it suffices to store their addresses.
+     */
+    struct NodeKey {
+        bool operator==(NodeKey const& other) const;
+
+        NodeKind kind;
+        // The operator, relation or predicate type (if any).
+        uint64_t operatorType = 0;
+        // The value of integer or boolean literals, the variable index or (for opaque nodes) the address of the node.
+        int64_t value = 0;
+        // The value of rational literals.
+        std::string rationalValue;
+        Type type;
+        std::vector<BaseExpression const*> operands;
+    };
+
+    struct NodeKeyHash {
+        std::size_t operator()(NodeKey const& key) const;
+    };
+
+    // The representatives indexed by their structure.
+    std::unordered_map<NodeKey, std::shared_ptr<BaseExpression const>, NodeKeyHash> representatives;
+
+    // The addresses of all representatives to recognize them quickly.
+    std::unordered_set<BaseExpression const*> representativeAddresses;
+
+    // The representative of the simplification of each representative.
+    std::unordered_map<BaseExpression const*, std::shared_ptr<BaseExpression const>> simplifiedRepresentatives;
+};
+
+}  // namespace expressions
+}  // namespace storm
@@ -1,10 +1,16 @@
 #include "storm/storage/geometry/NativePolytope.h"
 
+#include <set>
+#include <unordered_set>
+
 #include "storm/solver/SmtSolver.h"
 #include "storm/solver/Z3LpSolver.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/geometry/nativepolytopeconversion/HyperplaneEnumeration.h"
 #include "storm/storage/geometry/nativepolytopeconversion/QuickHull.h"
+#include "storm/storage/geometry/nativepolytopeconversion/SubsetEnumerator.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/solver.h"
 
@@ -46,11 +52,20 @@ NativePolytope<ValueType>::NativePolytope(std::vector<Point> const& points) {
             eigenPoints.emplace_back(storm::adapters::EigenAdapter::toEigenVector(p));
         }
 
+        // QuickHull might modify the given points, so we keep a copy which is used to retrieve the vertices.
+        std::vector<EigenVector> candidates;
+        if (storm::NumberTraits<ValueType>::IsExact) {
+            candidates = eigenPoints;
+        }
+
         storm::storage::geometry::QuickHull<ValueType> qh;
         qh.generateHalfspacesFromPoints(eigenPoints, false);
         A = std::move(qh.getResultMatrix());
         b = std::move(qh.getResultVector());
         emptyStatus = EmptyStatus::Nonempty;
+        if (storm::NumberTraits<ValueType>::IsExact) {
+            vertexRepresentation = createVertexRepresentation(A, b, candidates, false);
+        }
     }
 }
 
@@ -68,13 +83,14 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::create(boost::op
 }
 
 template<typename ValueType>
-NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType> const& other) : emptyStatus(other.emptyStatus), A(other.A), b(other.b) {
+NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType> const& other)
+    : emptyStatus(other.emptyStatus), A(other.A), b(other.b), vertexRepresentation(other.vertexRepresentation) {
     // Intentionally left empty
 }
 
 template<typename ValueType>
 NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType>&& other)
-    : emptyStatus(std::move(other.emptyStatus)), A(std::move(other.A)), b(std::move(other.b)) {
+    : emptyStatus(std::move(other.emptyStatus)), A(std::move(other.A)), b(std::move(other.b)), vertexRepresentation(std::move(other.vertexRepresentation)) {
     // Intentionally left empty
 }
 
@@ -206,6 +222,13 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::intersection(std
         resultA << A, nativeRhs.A;
         EigenVector resultb(resultA.rows());
         resultb << b, nativeRhs.b;
+        if (hasIncrementalVertexRepresentation()) {
+            auto resultRepresentation = cutVertexRepresentation(*vertexRepresentation, resultA, resultb, A.rows());
+            EmptyStatus resultEmptyStatus = resultRepresentation->vertices.empty() ? EmptyStatus::Empty : EmptyStatus::Nonempty;
+            auto result = std::make_shared<NativePolytope<ValueType>>(resultEmptyStatus, std::move(resultA), std::move(resultb));
+            result->vertexRepresentation = std::move(resultRepresentation);
+            return result;
+        }
         return std::make_shared<NativePolytope<ValueType>>(EmptyStatus::Unknown, std::move(resultA), std::move(resultb));
     }
 }
@@ -223,6 +246,13 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::intersection(Hal
     resultA << A, storm::adapters::EigenAdapter::toEigenVector(halfspace.normalVector()).transpose();
     EigenVector resultb(resultA.rows());
     resultb << b, halfspace.offset();
+    if (hasIncrementalVertexRepresentation()) {
+        auto resultRepresentation = cutVertexRepresentation(*vertexRepresentation, resultA, resultb, A.rows());
+        EmptyStatus resultEmptyStatus = resultRepresentation->vertices.empty() ? EmptyStatus::Empty : EmptyStatus::Nonempty;
+        auto result = std::make_shared<NativePolytope<ValueType>>(resultEmptyStatus, std::move(resultA), std::move(resultb));
+        result->vertexRepresentation = std::move(resultRepresentation);
+        return result;
+    }
     return std::make_shared<NativePolytope<ValueType>>(EmptyStatus::Unknown, std::move(resultA), std::move(resultb));
 }
 
@@ -244,9 +274,19 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::convexUnion(std:
     std::vector<EigenVector> resultVertices = this->getEigenVertices();
     resultVertices.insert(resultVertices.end(), std::make_move_iterator(rhsVertices.begin()), std::make_move_iterator(rhsVertices.end()));
 
+    // The vertices of the union are among the vertices of both polytopes. QuickHull might modify the given points, so we keep a copy.
+    std::vector<EigenVector> candidates;
+    if (storm::NumberTraits<ValueType>::IsExact) {
+        candidates = resultVertices;
+    }
+
     storm::storage::geometry::QuickHull<ValueType> qh;
     qh.generateHalfspacesFromPoints(resultVertices, false);
-    return std::make_shared<NativePolytope<ValueType>>(EmptyStatus::Nonempty, std::move(qh.getResultMatrix()), std::move(qh.getResultVector()));
+    auto result = std::make_shared<NativePolytope<ValueType>>(EmptyStatus::Nonempty, std::move(qh.getResultMatrix()), std::move(qh.getResultVector()));
+    if (storm::NumberTraits<ValueType>::IsExact) {
+        result->vertexRepresentation = createVertexRepresentation(result->A, result->b, candidates, false);
+    }
+    return result;
 }
 
 template<typename ValueType>
@@ -312,7 +352,16 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::affineTransforma
     }
     EigenMatrix newA = A * luMatrix.inverse();
     EigenVector newb = b + (newA * eigenVector);
-    return std::make_shared<NativePolytope<ValueType>>(emptyStatus, std::move(newA), std::move(newb));
+    auto result = std::make_shared<NativePolytope<ValueType>>(emptyStatus, std::move(newA), std::move(newb));
+    if (vertexRepresentation) {
+        // The transformation is invertible, so it maps vertices to vertices and preserves the tight constraints.
+        auto resultRepresentation = std::make_shared<VertexRepresentation>(*vertexRepresentation);
+        for (auto& vertex : resultRepresentation->vertices) {
+            vertex = eigenMatrix * vertex + eigenVector;
+        }
+        result->vertexRepresentation = std::move(resultRepresentation);
+    }
+    return result;
 }
 
 template<typename ValueType>
@@ -382,9 +431,200 @@ bool NativePolytope<ValueType>::isNativePolytope() const {
 }
 template<typename ValueType>
 std::vector<typename NativePolytope<ValueType>::EigenVector> NativePolytope<ValueType>::getEigenVertices() const {
-    storm::storage::geometry::HyperplaneEnumeration<ValueType> he;
-    he.generateVerticesFromConstraints(A, b, false);
-    return he.getResultVertices();
+    return getVertexRepresentation().vertices;
+}
+
+template<typename ValueType>
+typename NativePolytope<ValueType>::VertexRepresentation const& NativePolytope<ValueType>::getVertexRepresentation() const {
+    if (!vertexRepresentation) {
+        storm::storage::geometry::HyperplaneEnumeration<ValueType> he;
+        he.generateVerticesFromConstraints(A, b, false);
+        vertexRepresentation = createVertexRepresentation(A, b, he.getResultVertices(), true);
+        if (vertexRepresentation->pointed) {
+            emptyStatus = vertexRepresentation->vertices.empty() ? EmptyStatus::Empty : EmptyStatus::Nonempty;
+        }
+    }
+    return *vertexRepresentation;
+}
+
+template<typename ValueType>
+bool NativePolytope<ValueType>::hasIncrementalVertexRepresentation() const {
+    // Whether a vertex lies on a hyperplane is decided by an exact comparison, so incremental updates are only sound for exact number types.
+    return storm::NumberTraits<ValueType>::IsExact && vertexRepresentation && vertexRepresentation->pointed;
+}
+
+template<typename ValueType>
+std::shared_ptr<typename NativePolytope<ValueType>::VertexRepresentation const> NativePolytope<ValueType>::createVertexRepresentation(
+    EigenMatrix const& matrix, EigenVector const& vector, std::vector<EigenVector> const& candidates, bool candidatesAreVertices) {
+    auto result = std::make_shared<VertexRepresentation>();
+    result->pointed = matrix.rows() > 0 && matrix.cols() > 0 && matrix.fullPivLu().rank() == matrix.cols();
+    std::unordered_set<EigenVector> insertedVertices;
+    for (auto const& candidate : candidates) {
+        storm::storage::BitVector incidence(matrix.rows(), false);
+        for (Eigen::Index row = 0; row < matrix.rows(); ++row) {
+            if ((matrix.row(row) * candidate)(0) == vector(row)) {
+                incidence.set(row, true);
+            }
+        }
+        if (!candidatesAreVertices && getRankOfRows(matrix, incidence) < matrix.cols()) {
+            // The candidate is not a vertex
+            continue;
+        }
+        if (insertedVertices.insert(candidate).second) {
+            result->vertices.push_back(candidate);
+            result->incidences.push_back(std::move(incidence));
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::shared_ptr<typename NativePolytope<ValueType>::VertexRepresentation const> NativePolytope<ValueType>::cutVertexRepresentation(
+    VertexRepresentation const& representation, EigenMatrix const& matrix, EigenVector const& vector, Eigen::Index firstNewRow) {
+    STORM_LOG_ASSERT(representation.pointed, "Incremental computation of vertices is only possible for pointed polytopes.");
+    Eigen::Index dimension = matrix.cols();
+    auto result = std::make_shared<VertexRepresentation>(representation);
+    for (auto& incidence : result->incidences) {
+        incidence.resize(matrix.rows(), false);
+    }
+
+    for (Eigen::Index row = firstNewRow; row < matrix.rows(); ++row) {
+        std::vector<EigenVector> const& vertices = result->vertices;
+        std::vector<storm::storage::BitVector> const& incidences = result->incidences;
+
+        // The (signed) distance of each vertex to the new hyperplane, scaled by the length of the normal vector.
+        std::vector<ValueType> slacks;
+        slacks.reserve(vertices.size());
+        for (auto const& vertex : vertices) {
+            slacks.push_back((matrix.row(row) * vertex)(0) - vector(row));
+        }
+
+        VertexRepresentation cutRepresentation;
+        cutRepresentation.pointed = true;
+
+        // Keep the vertices that satisfy the new constraint
+        for (uint64_t vertexIndex = 0; vertexIndex < vertices.size(); ++vertexIndex) {
+            if (slacks[vertexIndex] <= storm::utility::zero<ValueType>()) {
+                cutRepresentation.vertices.push_back(vertices[vertexIndex]);
+                cutRepresentation.incidences.push_back(incidences[vertexIndex]);
+                if (storm::utility::isZero(slacks[vertexIndex])) {
+                    cutRepresentation.incidences.back().set(row, true);
+                }
+            }
+        }
+
+        // Intersect the new hyperplane with the bounded edges whose endpoints lie strictly on different sides.
+        // Two vertices are adjacent iff the constraints that are tight at both of them have rank dimension-1.
+        for (uint64_t insideIndex = 0; insideIndex < vertices.size(); ++insideIndex) {
+            if (slacks[insideIndex] >= storm::utility::zero<ValueType>()) {
+                continue;
+            }
+            for (uint64_t outsideIndex = 0; outsideIndex < vertices.size(); ++outsideIndex) {
+                if (slacks[outsideIndex] <= storm::utility::zero<ValueType>()) {
+                    continue;
+                }
+                storm::storage::BitVector commonIncidence = incidences[insideIndex] & incidences[outsideIndex];
+                if ((Eigen::Index)commonIncidence.getNumberOfSetBits() + 1 < dimension || getRankOfRows(matrix, commonIncidence) + 1 != dimension) {
+                    continue;
+                }
+                ValueType factor = slacks[insideIndex] / (slacks[insideIndex] - slacks[outsideIndex]);
+                cutRepresentation.vertices.push_back(vertices[insideIndex] + (vertices[outsideIndex] - vertices[insideIndex]) * factor);
+                commonIncidence.set(row, true);
+                cutRepresentation.incidences.push_back(std::move(commonIncidence));
+            }
+        }
+
+        // Intersect the new hyperplane with the unbounded edges that cross it.
+        for (uint64_t vertexIndex = 0; vertexIndex < vertices.size(); ++vertexIndex) {
+            if (storm::utility::isZero(slacks[vertexIndex])) {
+                continue;
+            }
+            for (auto& edge : getUnboundedEdges(matrix, row, incidences[vertexIndex])) {
+                ValueType change = (matrix.row(row) * edge.first)(0);
+                bool crossing = slacks[vertexIndex] < storm::utility::zero<ValueType>() ? change > storm::utility::zero<ValueType>()
+                                                                                         : change < storm::utility::zero<ValueType>();
+                if (crossing) {
+                    cutRepresentation.vertices.push_back(vertices[vertexIndex] - edge.first * (slacks[vertexIndex] / change));
+                    edge.second.set(row, true);
+                    cutRepresentation.incidences.push_back(std::move(edge.second));
+                }
+            }
+        }
+
+        *result = std::move(cutRepresentation);
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<std::pair<typename NativePolytope<ValueType>::EigenVector, storm::storage::BitVector>> NativePolytope<ValueType>::getUnboundedEdges(
+    EigenMatrix const& matrix, Eigen::Index numberOfRows, storm::storage::BitVector const& vertexIncidence) {
+    Eigen::Index dimension = matrix.cols();
+    std::vector<Eigen::Index> tightRows(vertexIncidence.begin(), vertexIncidence.end());
+    EigenMatrix tightMatrix(tightRows.size(), dimension);
+    for (uint64_t i = 0; i < tightRows.size(); ++i) {
+        tightMatrix.row(i) = matrix.row(tightRows[i]);
+    }
+
+    std::vector<std::pair<EigenVector, storm::storage::BitVector>> result;
+    std::set<storm::storage::BitVector> foundEdges;
+    auto processDirection = [&](EigenVector direction) {
+        // Orient the direction such that the tight constraints remain satisfied
+        EigenVector tightValues = tightMatrix * direction;
+        if (tightValues.maxCoeff() > storm::utility::zero<ValueType>()) {
+            if (tightValues.minCoeff() < storm::utility::zero<ValueType>()) {
+                return;
+            }
+            direction = -direction;
+        }
+        // The edge is unbounded iff no constraint bounds the direction
+        for (Eigen::Index row = 0; row < numberOfRows; ++row) {
+            if ((matrix.row(row) * direction)(0) > storm::utility::zero<ValueType>()) {
+                return;
+            }
+        }
+        storm::storage::BitVector edgeIncidence(matrix.rows(), false);
+        for (uint64_t i = 0; i < tightRows.size(); ++i) {
+            if (storm::utility::isZero((tightMatrix.row(i) * direction)(0))) {
+                edgeIncidence.set(tightRows[i], true);
+            }
+        }
+        if (foundEdges.insert(edgeIncidence).second) {
+            result.emplace_back(std::move(direction), std::move(edgeIncidence));
+        }
+    };
+
+    if (dimension == 1) {
+        processDirection(EigenVector::Ones(1));
+    } else {
+        // Each edge direction is the kernel of dimension-1 linearly independent constraints that are tight at the vertex
+        storm::storage::geometry::SubsetEnumerator<EigenMatrix> subsetEnum(tightRows.size(), dimension - 1, tightMatrix,
+                                                                          HyperplaneEnumeration<ValueType>::linearDependenciesFilter);
+        if (subsetEnum.setToFirstSubset()) {
+            do {
+                std::vector<uint_fast64_t> const& subset = subsetEnum.getCurrentSubset();
+                EigenMatrix subMatrix(dimension - 1, dimension);
+                for (Eigen::Index i = 0; i < dimension - 1; ++i) {
+                    subMatrix.row(i) = tightMatrix.row(subset[i]);
+                }
+                processDirection(subMatrix.fullPivLu().kernel().col(0));
+            } while (subsetEnum.incrementSubset());
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+Eigen::Index NativePolytope<ValueType>::getRankOfRows(EigenMatrix const& matrix, storm::storage::BitVector const& rows) {
+    if (rows.empty()) {
+        return 0;
+    }
+    EigenMatrix subMatrix(rows.getNumberOfSetBits(), matrix.cols());
+    Eigen::Index subMatrixRow = 0;
+    for (auto row : rows) {
+        subMatrix.row(subMatrixRow++) = matrix.row(row);
+    }
+    return subMatrix.fullPivLu().rank();
 }
 
 template<typename ValueType>
@@ -3,6 +3,7 @@
 
 #include <memory>
 #include "storm/adapters/EigenAdapter.h"
+#include "storm/storage/BitVector.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/geometry/Polytope.h"
 
@@ -140,9 +141,47 @@ class NativePolytope : public Polytope<ValueType> {
     virtual std::shared_ptr<Polytope<ValueType>> clean() override;
 
    private:
+    // The vertices of a polytope together with, for each vertex, the constraints (i.e. rows of A) whose hyperplanes contain the vertex
+    struct VertexRepresentation {
+        std::vector<EigenVector> vertices;
+        std::vector<storm::storage::BitVector> incidences;
+        // True iff the polytope contains no line, i.e., iff every nonempty face contains a vertex
+        bool pointed;
+    };
+
     // returns the vertices of this polytope as EigenVectors
     std::vector<EigenVector> getEigenVertices() const;
 
+    // Returns the vertex representation of this polytope. It is computed and stored if this has not been done before.
+    VertexRepresentation const& getVertexRepresentation() const;
+
+    // Returns true iff the vertex representation is stored and can be updated incrementally when intersecting with further halfspaces.
+    bool hasIncrementalVertexRepresentation() const;
+
+    /*
+     * Creates the vertex representation of the polytope { x | matrix*x <= vector } from the given candidate points, which all need to be inside the polytope.
+     * If the candidates are not known to be vertices, only the candidates at which the tight constraints have full rank are kept.
+     */
+    static std::shared_ptr<VertexRepresentation const> createVertexRepresentation(EigenMatrix const& matrix, EigenVector const& vector,
+                                                                                  std::vector<EigenVector> const& candidates, bool candidatesAreVertices);
+
+    /*
+     * Computes the vertex representation of the polytope { x | matrix*x <= vector } from the vertex representation of the polytope given by the rows
+     * before firstNewRow. The remaining rows are added one at a time (double description method): Vertices violating the new constraint are dropped and
+     * the new vertices are obtained by intersecting the hyperplane with the (bounded or unbounded) edges between both sides of the hyperplane.
+     * The given representation must be pointed.
+     */
+    static std::shared_ptr<VertexRepresentation const> cutVertexRepresentation(VertexRepresentation const& representation, EigenMatrix const& matrix,
+                                                                               EigenVector const& vector, Eigen::Index firstNewRow);
+
+    // Returns the directions of the unbounded edges of the polytope given by the first numberOfRows rows of the matrix that emanate from the given vertex.
+    // Each direction is paired with the constraints that are tight on the whole edge.
+    static std::vector<std::pair<EigenVector, storm::storage::BitVector>> getUnboundedEdges(EigenMatrix const& matrix, Eigen::Index numberOfRows,
+                                                                                           storm::storage::BitVector const& vertexIncidence);
+
+    // Returns the rank of the given rows of the matrix
+    static Eigen::Index getRankOfRows(EigenMatrix const& matrix, storm::storage::BitVector const& rows);
+
     // As optimize(..) but with EigenVectors
     std::pair<EigenVector, bool> optimize(EigenVector const& direction) const;
 
@@ -152,6 +191,10 @@ class NativePolytope : public Polytope<ValueType> {
     // Intern representation of the polytope as { x | Ax<=b }
     EigenMatrix A;
     EigenVector b;
+
+    // Stores the vertex representation (if already computed). Polytopes obtained by applying an operation on this polytope might derive their vertex
+    // representation from this one.
+    mutable std::shared_ptr<VertexRepresentation const> vertexRepresentation;
 };
 
 }  // namespace geometry
@@ -23,6 +23,7 @@
 
 #include "storm/storage/expressions/LinearityCheckVisitor.h"
 
+#include "storm/utility/Profiler.h"
 #include "storm/utility/combinatorics.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -446,6 +447,9 @@ Model Model::flattenComposition(std::shared_ptr<storm::utility::solver::SmtSolve
         return *this;
     }
 
+    storm::utility::ProfilerPhase phase("jani-flatten");
+    phase.addCounter("automata", this->getNumberOfAutomata());
+
     // Check for current restrictions of flatting process.
     STORM_LOG_THROW(this->hasStandardCompliantComposition(), storm::exceptions::WrongFormatException,
                     "Flatting composition is only supported for standard-compliant compositions.");
@@ -1101,6 +1105,7 @@ Model& Model::replaceUnassignedVariablesWithConstants() {
 }
 
 Model& Model::substituteConstantsInPlace() {
+    storm::utility::ProfilerPhase phase("jani-substitute-constants");
     // Gather all defining expressions of constants.
     std::map<storm::expressions::Variable, storm::expressions::Expression> constantSubstitution;
     for (auto& constant : this->getConstants()) {
@@ -1207,6 +1212,7 @@ void Model::substituteFunctions() {
 }
 
 void Model::substituteFunctions(std::vector<Property>& properties) {
+    storm::utility::ProfilerPhase phase("jani-eliminate-functions");
     eliminateFunctions(*this, properties);
 }
 
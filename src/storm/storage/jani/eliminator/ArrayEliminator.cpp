@@ -18,6 +18,10 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+#include "storm/utility/Profiler.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace jani {
@@ -822,9 +826,24 @@ class ArrayVariableReplacer : public JaniTraverser {
         }
         STORM_LOG_ASSERT(model.getGlobalFunctionDefinitions().empty(), "Expected functions to be eliminated at this point");
         JaniTraverser::traverse(model.getGlobalVariables(), data);
-        for (auto& aut : model.getAutomata()) {
-            traverse(aut, data);
+
+        // The automata are independent of each other, so we rewrite them concurrently (each block with its own replacer).
+        // The manager creates the basic types lazily, which is not thread-safe. We therefore create them beforehand.
+        auto& automata = model.getAutomata();
+        uint64_t numberOfThreads = 1;
+        if (automata.size() > 1 && storm::settings::hasModule<storm::settings::modules::BuildSettings>()) {
+            numberOfThreads = storm::settings::getModule<storm::settings::modules::BuildSettings>().getNumberOfBuildThreads();
+            model.getExpressionManager().getBooleanType();
+            model.getExpressionManager().getIntegerType();
+            model.getExpressionManager().getRationalType();
         }
+        storm::utility::parallel::forEachBlock(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(automata.size()), 1,
+                                               [&](uint64_t, uint64_t begin, uint64_t end) {
+                                                   ArrayVariableReplacer automatonReplacer(elimData, keepNonTrivialArrayAccess);
+                                                   for (uint64_t automatonIndex = begin; automatonIndex < end; ++automatonIndex) {
+                                                       automatonReplacer.traverse(automata[automatonIndex], data);
+                                                   }
+                                               });
 
         // Replace expressions
         if (model.hasInitialStatesRestriction()) {
@@ -959,13 +978,17 @@ class ArrayVariableReplacer : public JaniTraverser {
     }
 
    private:
+    /*!
+     * Inserts the assignments to the replacement variables for the given array (access) assignment. The array expressions in the given indices have to be
+     * eliminated already, so that each index is only eliminated once (and not once for each combination of outer indices).
+     */
     template<class InsertionCallback>
     void insertArrayAssignmentReplacements(std::vector<storm::expressions::Expression> const& aaIndices, uint64_t const& currDepth,
                                            typename ArrayEliminatorData::Replacement const& currReplacement, storm::expressions::Expression const& currRhs,
                                            storm::expressions::Expression const& currCondition, InsertionCallback const& insert) {
         if (currDepth < aaIndices.size()) {
             STORM_LOG_ASSERT(!currReplacement.isVariable(), "Did not expect a variable replacement at this depth.");
-            auto currIndexExpr = arrayExprEliminator.eliminate(aaIndices[currDepth]);
+            auto const& currIndexExpr = aaIndices[currDepth];
             if (currIndexExpr.containsVariables()) {
                 for (uint64_t index = 0; index < currReplacement.size(); ++index) {
                     auto indexExpr = currIndexExpr.getManager().integer(index);
@@ -1073,8 +1096,12 @@ class ArrayVariableReplacer : public JaniTraverser {
         for (auto aa : arrayAssignments) {
             auto const& lValue = aa->getLValue();
             if (lValue.isArrayAccess()) {
-                insertArrayAssignmentReplacements(lValue.getArrayIndexVector(), 0, replacements, aa->getAssignedExpression(), storm::expressions::Expression(),
-                                                  insert);
+                std::vector<storm::expressions::Expression> eliminatedIndices;
+                eliminatedIndices.reserve(lValue.getArrayIndexVector().size());
+                for (auto const& index : lValue.getArrayIndexVector()) {
+                    eliminatedIndices.push_back(arrayExprEliminator.eliminate(index));
+                }
+                insertArrayAssignmentReplacements(eliminatedIndices, 0, replacements, aa->getAssignedExpression(), storm::expressions::Expression(), insert);
             } else {
                 insertArrayAssignmentReplacements({}, 0, replacements, aa->getAssignedExpression(), storm::expressions::Expression(), insert);
             }
@@ -1196,7 +1223,9 @@ void ArrayEliminatorData::transformProperty(storm::jani::Property& property) con
 ArrayEliminatorData ArrayEliminator::eliminate(Model& model, bool keepNonTrivialArrayAccess) {
     // Only perform actions if there actually are arrays.
     if (model.getModelFeatures().hasArrays()) {
+        storm::utility::ProfilerPhase phase("jani-eliminate-arrays");
         auto elimData = detail::ArrayEliminatorDataCollector(model).get();
+        phase.addCounter("eliminated-arrays", elimData.eliminatedArrayVariables.size());
         detail::ArrayVariableReplacer(elimData, keepNonTrivialArrayAccess).replace(model);
         if (!keepNonTrivialArrayAccess) {
             model.getModelFeatures().remove(ModelFeature::Arrays);
@@ -45,7 +45,8 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::initialize() {
     if (!isInitialized) {
         uint64_t modelStateCount = model.getNumberOfStates();
 
-        computeMemorySuccessors();
+        // The memory successors are only computed for the memory states that occur in reachable states (and kept if we initialize again).
+        memorySuccessors.resize(memoryStateCount);
 
         // Get the initial states and reachable states. A stateIndex s corresponds to the model state (s / memoryStateCount) and memory state (s %
         // memoryStateCount)
@@ -91,6 +92,11 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::setBuildFullProduct()
     reachableStates.fill();
 }
 
+template<typename ValueType, typename RewardModelType>
+void SparseModelMemoryProduct<ValueType, RewardModelType>::setRelevantRewardModels(std::set<std::string> const& rewardModelNames) {
+    relevantRewardModels = rewardModelNames;
+}
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> SparseModelMemoryProduct<ValueType, RewardModelType>::build() {
     initialize();
@@ -126,22 +132,28 @@ uint64_t const& SparseModelMemoryProduct<ValueType, RewardModelType>::getResultS
 }
 
 template<typename ValueType, typename RewardModelType>
-void SparseModelMemoryProduct<ValueType, RewardModelType>::computeMemorySuccessors() {
-    uint64_t modelTransitionCount = model.getTransitionMatrix().getEntryCount();
-    memorySuccessors = std::vector<uint64_t>(modelTransitionCount * memoryStateCount, std::numeric_limits<uint64_t>::max());
-
-    for (uint64_t memoryState = 0; memoryState < memoryStateCount; ++memoryState) {
-        for (uint64_t transitionGoal = 0; transitionGoal < memoryStateCount; ++transitionGoal) {
-            auto const& memoryTransition = memory.getTransitionMatrix()[memoryState][transitionGoal];
-            if (memoryTransition) {
-                for (auto modelTransitionIndex : memoryTransition.get()) {
-                    memorySuccessors[modelTransitionIndex * memoryStateCount + memoryState] = transitionGoal;
-                }
+void SparseModelMemoryProduct<ValueType, RewardModelType>::computeMemorySuccessors(uint64_t memoryState) {
+    std::vector<uint64_t>& successors = memorySuccessors[memoryState];
+    successors.assign(model.getTransitionMatrix().getEntryCount(), std::numeric_limits<uint64_t>::max());
+    for (uint64_t transitionGoal = 0; transitionGoal < memoryStateCount; ++transitionGoal) {
+        auto const& memoryTransition = memory.getTransitionMatrix()[memoryState][transitionGoal];
+        if (memoryTransition) {
+            for (auto modelTransitionIndex : memoryTransition.get()) {
+                successors[modelTransitionIndex] = transitionGoal;
             }
         }
     }
 }
 
+template<typename ValueType, typename RewardModelType>
+uint64_t SparseModelMemoryProduct<ValueType, RewardModelType>::getMemorySuccessor(uint64_t modelTransitionIndex, uint64_t memoryState) {
+    // Note that the successors are only empty if they have not been computed as every model state has at least one transition.
+    if (memorySuccessors[memoryState].empty()) {
+        computeMemorySuccessors(memoryState);
+    }
+    return memorySuccessors[memoryState][modelTransitionIndex];
+}
+
 template<typename ValueType, typename RewardModelType>
 void SparseModelMemoryProduct<ValueType, RewardModelType>::computeReachableStates(storm::storage::BitVector const& initialStates) {
     // Explore the reachable states via DFS.
@@ -166,7 +178,7 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::computeReachableState
                         if (!storm::utility::isZero(modelTransitionIt->getValue())) {
                             uint64_t successorModelState = modelTransitionIt->getColumn();
                             uint64_t modelTransitionId = modelTransitionIt - model.getTransitionMatrix().begin();
-                            uint64_t successorMemoryState = memorySuccessors[modelTransitionId * memoryStateCount + memoryState];
+                            uint64_t successorMemoryState = getMemorySuccessor(modelTransitionId, memoryState);
                             uint64_t successorStateIndex = successorModelState * memoryStateCount + successorMemoryState;
                             if (!reachableStates.get(successorStateIndex)) {
                                 reachableStates.set(successorStateIndex, true);
@@ -181,7 +193,7 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::computeReachableState
                     if (!storm::utility::isZero(modelTransitionIt->getValue())) {
                         uint64_t successorModelState = modelTransitionIt->getColumn();
                         uint64_t modelTransitionId = modelTransitionIt - model.getTransitionMatrix().begin();
-                        uint64_t successorMemoryState = memorySuccessors[modelTransitionId * memoryStateCount + memoryState];
+                        uint64_t successorMemoryState = getMemorySuccessor(modelTransitionId, memoryState);
                         uint64_t successorStateIndex = successorModelState * memoryStateCount + successorMemoryState;
                         if (!reachableStates.get(successorStateIndex)) {
                             reachableStates.set(successorStateIndex, true);
@@ -210,7 +222,7 @@ storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, Rewa
         auto const& modelRow = model.getTransitionMatrix().getRow(modelState);
         for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
             uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-            uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+            uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
             builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
         }
         ++currentRow;
@@ -244,7 +256,7 @@ storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, Rewa
             auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
             for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
                 uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-                uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                 builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
             }
             ++currentRow;
@@ -308,7 +320,7 @@ storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, Rewa
                 auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
                 for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
                     uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-                    uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                    uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                     builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
                 }
             } else {
@@ -319,7 +331,7 @@ storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, Rewa
                         auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
                         for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
                             uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-                            uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                            uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                             ValueType transitionValue = choiceIndex.second * entryIt->getValue();
                             auto insertionRes = transitions.insert(std::make_pair(getResultState(entryIt->getColumn(), successorMemoryState), transitionValue));
                             if (!insertionRes.second) {
@@ -339,7 +351,7 @@ storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, Rewa
                 auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
                 for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
                     uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-                    uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                    uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                     builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
                 }
                 ++currentRow;
@@ -406,6 +418,9 @@ std::unordered_map<std::string, RewardModelType> SparseModelMemoryProduct<ValueT
     uint64_t numResStates = resultTransitionMatrix.getRowGroupCount();
 
     for (auto const& rewardModel : model.getRewardModels()) {
+        if (relevantRewardModels && relevantRewardModels->count(rewardModel.first) == 0) {
+            continue;
+        }
         std::optional<std::vector<RewardValueType>> stateRewards;
         if (rewardModel.second.hasStateRewards()) {
             stateRewards = std::vector<RewardValueType>(numResStates, storm::utility::zero<RewardValueType>());
@@ -469,7 +484,7 @@ std::unordered_map<std::string, RewardModelType> SparseModelMemoryProduct<ValueT
                                     ++transitionEntryIt;
                                 }
                                 uint64_t transitionId = transitionEntryIt - model.getTransitionMatrix().begin();
-                                uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                                uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                                 auto insertionRes =
                                     rewards.insert(std::make_pair(getResultState(rewardEntry.getColumn(), successorMemoryState), rewardEntry.getValue()));
                                 if (!insertionRes.second) {
@@ -493,7 +508,7 @@ std::unordered_map<std::string, RewardModelType> SparseModelMemoryProduct<ValueT
                                     ++transitionEntryIt;
                                 }
                                 uint64_t transitionId = transitionEntryIt - model.getTransitionMatrix().begin();
-                                uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                                uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                                 builder.addNextValue(resRowIndex, getResultState(rewardEntry.getColumn(), successorMemoryState), rewardEntry.getValue());
                             }
                         }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
 
@@ -39,6 +40,9 @@ class SparseModelMemoryProduct {
     // Enforces that every state is considered reachable. If this is set, the result has size #modelStates * #memoryStates
     void setBuildFullProduct();
 
+    // Restricts the reward models of the result to the ones with the given names. By default, all reward models are considered.
+    void setRelevantRewardModels(std::set<std::string> const& rewardModelNames);
+
     // Returns true iff the given model and memory state is reachable in the product
     bool isStateReachable(uint64_t const& modelState, uint64_t const& memoryState);
 
@@ -56,9 +60,11 @@ class SparseModelMemoryProduct {
     // Initializes auxiliary data for building the product
     void initialize();
 
-    // Computes for each pair of memory state and model transition index the successor memory state
-    // The resulting vector maps (modelTransition * memoryStateCount) + memoryState to the corresponding successor state of the memory structure
-    void computeMemorySuccessors();
+    // Computes for the given memory state and each model transition index the successor memory state
+    void computeMemorySuccessors(uint64_t memoryState);
+
+    // Retrieves the successor memory state when taking the given model transition in the given memory state. The successors are computed on demand.
+    uint64_t getMemorySuccessor(uint64_t modelTransitionIndex, uint64_t memoryState);
 
     // Computes the reachable states of the resulting model
     void computeReachableStates(storm::storage::BitVector const& initialStates);
@@ -83,8 +89,8 @@ class SparseModelMemoryProduct {
     // Stores whether this builder has already been initialized.
     bool isInitialized;
 
-    // stores the successor memory states for each transition in the product
-    std::vector<uint64_t> memorySuccessors;
+    // stores for each memory state the successor memory state for each model transition. The vector of a memory state is empty if it is not yet computed.
+    std::vector<std::vector<uint64_t>> memorySuccessors;
 
     // Maps (modelState * memoryStateCount) + memoryState to the state in the result that represents (memoryState,modelState)
     std::vector<uint64_t> toResultStateMapping;
@@ -98,6 +104,9 @@ class SparseModelMemoryProduct {
     boost::optional<storm::storage::MemoryStructure> localMemory;
     storm::storage::MemoryStructure const& memory;
     boost::optional<storm::storage::Scheduler<ValueType> const&> scheduler;
+
+    // If set, only the reward models with these names are built
+    boost::optional<std::set<std::string>> relevantRewardModels;
 };
 }  // namespace storage
 }  // namespace storm
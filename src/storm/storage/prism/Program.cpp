@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <boost/algorithm/string/join.hpp>
 #include <sstream>
+#include <type_traits>
 
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/Property.h"
@@ -345,7 +346,9 @@ bool Program::undefinedConstantsAreGraphPreserving() const {
 
     // Check the reward models.
     for (auto const& rewardModel : this->getRewardModels()) {
-        rewardModel.containsVariablesOnlyInRewardValueExpressions(undefinedConstantVariables);
+        if (!rewardModel.containsVariablesOnlyInRewardValueExpressions(undefinedConstantVariables)) {
+            return false;
+        }
     }
 
     // Initial construct.
@@ -920,6 +923,191 @@ Program Program::restrictCommands(storm::storage::FlatSet<uint_fast64_t> const&
                    this->getObservationLabels(), this->getOptionalInitialConstruct(), this->getOptionalSystemCompositionConstruct(), prismCompatibility);
 }
 
+Program Program::slice(std::set<storm::expressions::Variable> const& relevantVariables, std::set<std::string> const& relevantLabels,
+                       std::set<std::string> const& relevantRewardModels) const {
+    if (this->hasInitialConstruct() || this->getNumberOfObservationLabels() > 0 || this->getNumberOfPlayers() > 0 || this->getModelType() == ModelType::PTA ||
+        this->getModelType() == ModelType::POMDP) {
+        STORM_LOG_INFO("Not slicing the program as it has an initial construct, observations, players or clocks.");
+        return *this;
+    }
+
+    // Variables that are never assigned keep their initial value, so we replace them by it (unless they are referred to directly).
+    std::set<storm::expressions::Variable> assignedVariables;
+    for (auto const& module : this->getModules()) {
+        for (auto const& command : module.getCommands()) {
+            for (auto const& update : command.getUpdates()) {
+                for (auto const& assignment : update.getAssignments()) {
+                    assignedVariables.insert(assignment.getVariable());
+                }
+            }
+        }
+    }
+    std::map<storm::expressions::Variable, storm::expressions::Expression> substitution;
+    auto addConstantVariable = [&](storm::prism::Variable const& variable) {
+        if (variable.hasInitialValue() && assignedVariables.count(variable.getExpressionVariable()) == 0 &&
+            relevantVariables.count(variable.getExpressionVariable()) == 0) {
+            substitution.emplace(variable.getExpressionVariable(), variable.getInitialValueExpression());
+        }
+    };
+    for (auto const& variable : this->getGlobalBooleanVariables()) {
+        addConstantVariable(variable);
+    }
+    for (auto const& variable : this->getGlobalIntegerVariables()) {
+        addConstantVariable(variable);
+    }
+    for (auto const& module : this->getModules()) {
+        for (auto const& variable : module.getBooleanVariables()) {
+            addConstantVariable(variable);
+        }
+        for (auto const& variable : module.getIntegerVariables()) {
+            addConstantVariable(variable);
+        }
+    }
+
+    std::vector<Module> substitutedModules;
+    substitutedModules.reserve(this->getNumberOfModules());
+    for (auto const& module : this->getModules()) {
+        substitutedModules.push_back(module.substitute(substitution));
+    }
+    std::vector<Label> newLabels;
+    for (auto const& label : this->getLabels()) {
+        if (relevantLabels.count(label.getName()) > 0) {
+            newLabels.push_back(label.substitute(substitution));
+        }
+    }
+    std::vector<RewardModel> newRewardModels;
+    for (auto const& rewardModel : this->getRewardModels()) {
+        if (relevantRewardModels.count(rewardModel.getName()) > 0) {
+            newRewardModels.push_back(rewardModel.substitute(substitution));
+        }
+    }
+
+    // Start with the variables that are referred to directly, by the labels and reward models, the guards and the update probabilities.
+    std::set<storm::expressions::Variable> coneOfInfluence = relevantVariables;
+    auto addVariables = [&coneOfInfluence](storm::expressions::Expression const& expression) {
+        if (expression.isInitialized()) {
+            auto variables = expression.getVariables();
+            coneOfInfluence.insert(variables.begin(), variables.end());
+        }
+    };
+    for (auto const& label : newLabels) {
+        addVariables(label.getStatePredicateExpression());
+    }
+    for (auto const& rewardModel : newRewardModels) {
+        for (auto const& reward : rewardModel.getStateRewards()) {
+            addVariables(reward.getStatePredicateExpression());
+            addVariables(reward.getRewardValueExpression());
+        }
+        for (auto const& reward : rewardModel.getStateActionRewards()) {
+            addVariables(reward.getStatePredicateExpression());
+            addVariables(reward.getRewardValueExpression());
+        }
+        for (auto const& reward : rewardModel.getTransitionRewards()) {
+            addVariables(reward.getSourceStatePredicateExpression());
+            addVariables(reward.getTargetStatePredicateExpression());
+            addVariables(reward.getRewardValueExpression());
+        }
+    }
+    for (auto const& module : substitutedModules) {
+        for (auto const& command : module.getCommands()) {
+            addVariables(command.getGuardExpression());
+            for (auto const& update : command.getUpdates()) {
+                addVariables(update.getLikelihoodExpression());
+            }
+        }
+    }
+
+    // Then, close the set under the assignments to relevant variables.
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (auto const& module : substitutedModules) {
+            for (auto const& command : module.getCommands()) {
+                for (auto const& update : command.getUpdates()) {
+                    for (auto const& assignment : update.getAssignments()) {
+                        if (coneOfInfluence.count(assignment.getVariable()) > 0) {
+                            for (auto const& variable : assignment.getExpression().getVariables()) {
+                                changed |= coneOfInfluence.insert(variable).second;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Finally, drop the irrelevant variables along with their assignments.
+    uint64_t numberOfRemovedVariables = 0;
+    auto restrictVariables = [&](auto const& variables) {
+        std::remove_const_t<std::remove_reference_t<decltype(variables)>> result;
+        for (auto const& variable : variables) {
+            if (coneOfInfluence.count(variable.getExpressionVariable()) > 0) {
+                result.push_back(variable.substitute(substitution));
+            } else {
+                ++numberOfRemovedVariables;
+            }
+        }
+        return result;
+    };
+    std::vector<BooleanVariable> newBooleanVariables = restrictVariables(this->getGlobalBooleanVariables());
+    std::vector<IntegerVariable> newIntegerVariables = restrictVariables(this->getGlobalIntegerVariables());
+    std::vector<Module> newModules;
+    newModules.reserve(substitutedModules.size());
+    for (auto const& module : substitutedModules) {
+        std::vector<Command> newCommands;
+        newCommands.reserve(module.getNumberOfCommands());
+        for (auto const& command : module.getCommands()) {
+            // Unlabelled commands that can never be executed are dropped. Labelled ones may still block the synchronization.
+            if (!command.isLabeled() && command.getGuardExpression().isFalse()) {
+                continue;
+            }
+            std::vector<Update> newUpdates;
+            newUpdates.reserve(command.getNumberOfUpdates());
+            for (auto const& update : command.getUpdates()) {
+                std::vector<Assignment> newAssignments;
+                for (auto const& assignment : update.getAssignments()) {
+                    if (coneOfInfluence.count(assignment.getVariable()) > 0) {
+                        newAssignments.push_back(assignment);
+                    }
+                }
+                newUpdates.emplace_back(update.getGlobalIndex(), update.getLikelihoodExpression(), newAssignments, update.getFilename(),
+                                        update.getLineNumber());
+            }
+            newCommands.emplace_back(command.getGlobalIndex(), command.isMarkovian(), command.getActionIndex(), command.getActionName(),
+                                     command.getGuardExpression(), newUpdates, command.getFilename(), command.getLineNumber());
+        }
+        std::vector<BooleanVariable> newModuleBooleanVariables = restrictVariables(module.getBooleanVariables());
+        std::vector<IntegerVariable> newModuleIntegerVariables = restrictVariables(module.getIntegerVariables());
+        if (newCommands.empty() && newModuleBooleanVariables.empty() && newModuleIntegerVariables.empty() && !this->specifiesSystemComposition()) {
+            // The module does not contribute anything anymore.
+            STORM_LOG_INFO("Slicing removed module '" << module.getName() << "'.");
+            continue;
+        }
+        newModules.emplace_back(module.getName(), newModuleBooleanVariables, newModuleIntegerVariables, module.getClockVariables(), module.getInvariant(),
+                                newCommands, module.getFilename(), module.getLineNumber());
+    }
+
+    // Formulas that refer to removed variables can not be kept.
+    std::set<storm::expressions::Variable> removedVariables;
+    for (auto const& variable : this->getAllExpressionVariables()) {
+        if (coneOfInfluence.count(variable) == 0 && !this->hasConstant(variable.getName())) {
+            removedVariables.insert(variable);
+        }
+    }
+    std::vector<Formula> newFormulas;
+    for (auto const& formula : this->getFormulas()) {
+        if (!formula.getExpression().containsVariable(removedVariables)) {
+            newFormulas.push_back(formula.substitute(substitution));
+        }
+    }
+
+    STORM_LOG_INFO("Slicing removed " << numberOfRemovedVariables << " variables, " << (this->getNumberOfLabels() - newLabels.size()) << " labels and "
+                                      << (this->getNumberOfRewardModels() - newRewardModels.size()) << " reward models.");
+    return Program(this->manager, this->getModelType(), this->getConstants(), newBooleanVariables, newIntegerVariables, newFormulas, this->getPlayers(),
+                   newModules, this->getActionNameToIndexMapping(), newRewardModels, newLabels, this->getObservationLabels(), boost::none,
+                   this->getOptionalSystemCompositionConstruct(), prismCompatibility);
+}
+
 void Program::createMappings() {
     // Build the mappings for constants, global variables, formulas, modules, reward models and labels.
     for (uint_fast64_t constantIndex = 0; constantIndex < this->getNumberOfConstants(); ++constantIndex) {
@@ -649,6 +649,20 @@ class Program : public LocatedInformation {
      */
     Program restrictCommands(storm::storage::FlatSet<uint_fast64_t> const& indexSet) const;
 
+    /*!
+     * Creates a new program that only keeps the variables that can influence the given variables, labels and reward models (cone of influence). All
+     * guards and update probabilities are considered to be relevant, so the resulting program is bisimilar to this one with respect to the given labels and
+     * reward models. Variables that are never assigned are replaced by their initial values first. Labels and reward models that are not given are removed.
+     * Programs with an initial construct, observations, players or clocks are returned unchanged.
+     *
+     * @param relevantVariables The variables that are referred to directly, e.g. by the properties to check.
+     * @param relevantLabels The names of the labels that are to be kept.
+     * @param relevantRewardModels The names of the reward models that are to be kept.
+     * @return The sliced program.
+     */
+    Program slice(std::set<storm::expressions::Variable> const& relevantVariables, std::set<std::string> const& relevantLabels,
+                  std::set<std::string> const& relevantRewardModels) const;
+
     /*!
      * Defines the undefined constants according to the given map and returns the resulting program.
      *
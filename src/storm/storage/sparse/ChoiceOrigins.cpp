@@ -1,7 +1,10 @@
 #include "storm/storage/sparse/ChoiceOrigins.h"
 
+#include <limits>
+
 #include "storm/adapters/JsonAdapter.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/storage/sparse/JaniChoiceOrigins.h"
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
 #include "storm/utility/vector.h"
@@ -12,11 +15,16 @@ namespace storm {
 namespace storage {
 namespace sparse {
 
-ChoiceOrigins::ChoiceOrigins(std::vector<uint_fast64_t> const& indexToIdentifierMapping) : indexToIdentifier(indexToIdentifierMapping) {
-    // Intentionally left empty
+ChoiceOrigins::ChoiceOrigins(std::vector<uint_fast64_t> const& indexToIdentifierMapping) {
+    indexToIdentifier.reserve(indexToIdentifierMapping.size());
+    for (auto const& identifier : indexToIdentifierMapping) {
+        STORM_LOG_THROW(identifier <= std::numeric_limits<uint32_t>::max(), storm::exceptions::InvalidArgumentException,
+                        "Choice origin identifier " << identifier << " exceeds the supported range.");
+        indexToIdentifier.push_back(static_cast<uint32_t>(identifier));
+    }
 }
 
-ChoiceOrigins::ChoiceOrigins(std::vector<uint_fast64_t>&& indexToIdentifierMapping) : indexToIdentifier(std::move(indexToIdentifierMapping)) {
+ChoiceOrigins::ChoiceOrigins(std::vector<uint32_t>&& indexToIdentifierMapping) : indexToIdentifier(std::move(indexToIdentifierMapping)) {
     // Intentionally left empty
 }
 
@@ -82,7 +90,7 @@ typename ChoiceOrigins::Json const& ChoiceOrigins::getChoiceAsJson(uint_fast64_t
 }
 
 std::shared_ptr<ChoiceOrigins> ChoiceOrigins::selectChoices(storm::storage::BitVector const& selectedChoices) const {
-    std::vector<uint_fast64_t> indexToIdentifierMapping(selectedChoices.getNumberOfSetBits());
+    std::vector<uint32_t> indexToIdentifierMapping(selectedChoices.getNumberOfSetBits());
     storm::utility::vector::selectVectorValues(indexToIdentifierMapping, selectedChoices, indexToIdentifier);
     return cloneWithNewIndexToIdentifierMapping(std::move(indexToIdentifierMapping));
 }
@@ -92,7 +100,7 @@ void ChoiceOrigins::clearOriginOfChoice(uint_fast64_t choiceIndex) {
 }
 
 std::shared_ptr<ChoiceOrigins> ChoiceOrigins::selectChoices(std::vector<uint_fast64_t> const& selectedChoices) const {
-    std::vector<uint_fast64_t> indexToIdentifierMapping;
+    std::vector<uint32_t> indexToIdentifierMapping;
     indexToIdentifierMapping.reserve(selectedChoices.size());
     for (auto const& selectedChoice : selectedChoices) {
         if (selectedChoice < this->indexToIdentifier.size()) {
@@ -105,12 +113,19 @@ std::shared_ptr<ChoiceOrigins> ChoiceOrigins::selectChoices(std::vector<uint_fas
 }
 
 storm::models::sparse::ChoiceLabeling ChoiceOrigins::toChoiceLabeling() const {
+    // Collect the choices of all identifiers in a single pass over the choices.
+    std::vector<storm::storage::BitVector> choicesWithIdentifier(this->getNumberOfIdentifiers());
+    for (uint_fast64_t choice = 0; choice < indexToIdentifier.size(); ++choice) {
+        auto& choices = choicesWithIdentifier[indexToIdentifier[choice]];
+        if (choices.size() == 0) {
+            choices = storm::storage::BitVector(indexToIdentifier.size(), false);
+        }
+        choices.set(choice, true);
+    }
     storm::models::sparse::ChoiceLabeling result(indexToIdentifier.size());
-    for (uint_fast64_t identifier = 0; identifier < this->getNumberOfIdentifiers(); ++identifier) {
-        storm::storage::BitVector choicesWithIdentifier =
-            storm::utility::vector::filter<uint_fast64_t>(indexToIdentifier, [&identifier](uint_fast64_t i) -> bool { return i == identifier; });
-        if (!choicesWithIdentifier.empty()) {
-            result.addLabel(getIdentifierInfo(identifier), std::move(choicesWithIdentifier));
+    for (uint_fast64_t identifier = 0; identifier < choicesWithIdentifier.size(); ++identifier) {
+        if (!choicesWithIdentifier[identifier].empty()) {
+            result.addLabel(getIdentifierInfo(identifier), std::move(choicesWithIdentifier[identifier]));
         }
     }
     return result;
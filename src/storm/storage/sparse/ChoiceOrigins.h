@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include "storm/models/sparse/ChoiceLabeling.h"
@@ -98,12 +99,12 @@ class ChoiceOrigins {
 
    protected:
     ChoiceOrigins(std::vector<uint_fast64_t> const& indexToIdentifierMapping);
-    ChoiceOrigins(std::vector<uint_fast64_t>&& indexToIdentifierMapping);
+    ChoiceOrigins(std::vector<uint32_t>&& indexToIdentifierMapping);
 
     /*
      * Returns a copy of this object where the mapping of choice indices to origin identifiers is replaced by the given one.
      */
-    virtual std::shared_ptr<ChoiceOrigins> cloneWithNewIndexToIdentifierMapping(std::vector<uint_fast64_t>&& indexToIdentifierMapping) const = 0;
+    virtual std::shared_ptr<ChoiceOrigins> cloneWithNewIndexToIdentifierMapping(std::vector<uint32_t>&& indexToIdentifierMapping) const = 0;
 
     /*
      * Computes the identifier infos (i.e., human readable strings representing the choice origins).
@@ -115,7 +116,8 @@ class ChoiceOrigins {
      */
     virtual void computeIdentifierJson() const = 0;
 
-    std::vector<uint_fast64_t> indexToIdentifier;
+    // The identifiers are stored with 32 bits as there are only few distinct origins, even for models with billions of choices.
+    std::vector<uint32_t> indexToIdentifier;
 
     // cached identifier infos might be empty if identifiers have not been generated yet.
     mutable std::vector<std::string> identifierToInfo;
@@ -17,6 +17,13 @@ JaniChoiceOrigins::JaniChoiceOrigins(std::shared_ptr<storm::jani::Model const> c
                     "The given edge set for the choices without origin is non-empty");
 }
 
+JaniChoiceOrigins::JaniChoiceOrigins(std::shared_ptr<storm::jani::Model const> const& janiModel, std::vector<uint32_t>&& indexToIdentifierMapping,
+                                     std::vector<EdgeIndexSet>&& identifierToEdgeIndexSetMapping)
+    : ChoiceOrigins(std::move(indexToIdentifierMapping)), model(janiModel), identifierToEdgeIndexSet(std::move(identifierToEdgeIndexSetMapping)) {
+    STORM_LOG_THROW(identifierToEdgeIndexSet[this->getIdentifierForChoicesWithNoOrigin()].empty(), storm::exceptions::InvalidArgumentException,
+                    "The given edge set for the choices without origin is non-empty");
+}
+
 bool JaniChoiceOrigins::isJaniChoiceOrigins() const {
     return true;
 }
@@ -33,8 +40,8 @@ JaniChoiceOrigins::EdgeIndexSet const& JaniChoiceOrigins::getEdgeIndexSet(uint_f
     return identifierToEdgeIndexSet[this->getIdentifier(choiceIndex)];
 }
 
-std::shared_ptr<ChoiceOrigins> JaniChoiceOrigins::cloneWithNewIndexToIdentifierMapping(std::vector<uint_fast64_t>&& indexToIdentifierMapping) const {
-    auto result = std::make_shared<JaniChoiceOrigins>(this->model, std::move(indexToIdentifierMapping), std::move(identifierToEdgeIndexSet));
+std::shared_ptr<ChoiceOrigins> JaniChoiceOrigins::cloneWithNewIndexToIdentifierMapping(std::vector<uint32_t>&& indexToIdentifierMapping) const {
+    auto result = std::make_shared<JaniChoiceOrigins>(this->model, std::move(indexToIdentifierMapping), std::vector<EdgeIndexSet>(identifierToEdgeIndexSet));
     result->identifierToInfo = this->identifierToInfo;
     return result;
 }
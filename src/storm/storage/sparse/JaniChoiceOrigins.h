@@ -27,6 +27,8 @@ class JaniChoiceOrigins : public ChoiceOrigins {
      */
     JaniChoiceOrigins(std::shared_ptr<storm::jani::Model const> const& janiModel, std::vector<uint_fast64_t> const& indexToIdentifierMapping,
                       std::vector<EdgeIndexSet> const& identifierToEdgeIndexSetMapping);
+    JaniChoiceOrigins(std::shared_ptr<storm::jani::Model const> const& janiModel, std::vector<uint32_t>&& indexToIdentifierMapping,
+                      std::vector<EdgeIndexSet>&& identifierToEdgeIndexSetMapping);
 
     virtual ~JaniChoiceOrigins() = default;
 
@@ -55,7 +57,7 @@ class JaniChoiceOrigins : public ChoiceOrigins {
     /*
      * Returns a copy of this object where the mapping of choice indices to origin identifiers is replaced by the given one.
      */
-    virtual std::shared_ptr<ChoiceOrigins> cloneWithNewIndexToIdentifierMapping(std::vector<uint_fast64_t>&& indexToIdentifierMapping) const override;
+    virtual std::shared_ptr<ChoiceOrigins> cloneWithNewIndexToIdentifierMapping(std::vector<uint32_t>&& indexToIdentifierMapping) const override;
 
     /*
      * Computes the identifier infos (i.e., human readable strings representing the choice origins).
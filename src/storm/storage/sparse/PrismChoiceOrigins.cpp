@@ -19,7 +19,7 @@ PrismChoiceOrigins::PrismChoiceOrigins(std::shared_ptr<storm::prism::Program con
                     "The given command set for the choices without origin is non-empty");
 }
 
-PrismChoiceOrigins::PrismChoiceOrigins(std::shared_ptr<storm::prism::Program const> const& prismProgram, std::vector<uint_fast64_t>&& indexToIdentifierMapping,
+PrismChoiceOrigins::PrismChoiceOrigins(std::shared_ptr<storm::prism::Program const> const& prismProgram, std::vector<uint32_t>&& indexToIdentifierMapping,
                                        std::vector<CommandSet>&& identifierToCommandSetMapping)
     : ChoiceOrigins(std::move(indexToIdentifierMapping)), program(prismProgram), identifierToCommandSet(std::move(identifierToCommandSetMapping)) {
     STORM_LOG_THROW(identifierToCommandSet[this->getIdentifierForChoicesWithNoOrigin()].empty(), storm::exceptions::InvalidArgumentException,
@@ -42,8 +42,9 @@ PrismChoiceOrigins::CommandSet const& PrismChoiceOrigins::getCommandSet(uint_fas
     return identifierToCommandSet[this->getIdentifier(choiceIndex)];
 }
 
-std::shared_ptr<ChoiceOrigins> PrismChoiceOrigins::cloneWithNewIndexToIdentifierMapping(std::vector<uint_fast64_t>&& indexToIdentifierMapping) const {
-    auto result = std::make_shared<PrismChoiceOrigins>(this->program, std::move(indexToIdentifierMapping), std::move(this->identifierToCommandSet));
+std::shared_ptr<ChoiceOrigins> PrismChoiceOrigins::cloneWithNewIndexToIdentifierMapping(std::vector<uint32_t>&& indexToIdentifierMapping) const {
+    auto result =
+        std::make_shared<PrismChoiceOrigins>(this->program, std::move(indexToIdentifierMapping), std::vector<CommandSet>(this->identifierToCommandSet));
     result->identifierToInfo = this->identifierToInfo;
     return result;
 }
@@ -26,7 +26,7 @@ class PrismChoiceOrigins : public ChoiceOrigins {
      */
     PrismChoiceOrigins(std::shared_ptr<storm::prism::Program const> const& prismProgram, std::vector<uint_fast64_t> const& indexToIdentifierMapping,
                        std::vector<CommandSet> const& identifierToCommandSetMapping);
-    PrismChoiceOrigins(std::shared_ptr<storm::prism::Program const> const& prismProgram, std::vector<uint_fast64_t>&& indexToIdentifierMapping,
+    PrismChoiceOrigins(std::shared_ptr<storm::prism::Program const> const& prismProgram, std::vector<uint32_t>&& indexToIdentifierMapping,
                        std::vector<CommandSet>&& identifierToCommandSetMapping);
 
     virtual ~PrismChoiceOrigins() = default;
@@ -56,7 +56,7 @@ class PrismChoiceOrigins : public ChoiceOrigins {
     /*
      * Returns a copy of this object where the mapping of choice indices to origin identifiers is replaced by the given one.
      */
-    virtual std::shared_ptr<ChoiceOrigins> cloneWithNewIndexToIdentifierMapping(std::vector<uint_fast64_t>&& indexToIdentifierMapping) const override;
+    virtual std::shared_ptr<ChoiceOrigins> cloneWithNewIndexToIdentifierMapping(std::vector<uint32_t>&& indexToIdentifierMapping) const override;
 
     /*
      * Computes the identifier infos (i.e., human readable strings representing the choice origins).
@@ -1,5 +1,6 @@
 #include "storm/storage/sparse/StateValuations.h"
 
+#include <algorithm>
 #include <boost/algorithm/string/join.hpp>
 
 #include "storm/adapters/JsonAdapter.h"
@@ -9,6 +10,7 @@
 #include "storm/storage/BitVector.h"
 
 #include "storm/exceptions/InvalidTypeException.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
@@ -16,19 +18,34 @@ namespace storm {
 namespace storage {
 namespace sparse {
 
-StateValuations::StateValuation::StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues,
-                                                std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues)
-    : booleanValues(std::move(booleanValues)),
-      integerValues(std::move(integerValues)),
-      rationalValues(std::move(rationalValues)),
-      observationLabelValues(std::move(observationLabelValues)) {
-    // Intentionally left empty
+StateValuations::PackedIntegerColumn::PackedIntegerColumn(std::vector<int64_t> const& values) {
+    if (values.empty()) {
+        return;
+    }
+    auto minMax = std::minmax_element(values.begin(), values.end());
+    smallestValue = *minMax.first;
+    // Differences are computed on unsigned numbers to avoid overflows for columns that span (almost) the whole range of int64_t.
+    uint64_t largestDifference = static_cast<uint64_t>(*minMax.second) - static_cast<uint64_t>(smallestValue);
+    while (largestDifference > 0) {
+        ++bitsPerValue;
+        largestDifference >>= 1;
+    }
+    if (bitsPerValue > 0) {
+        bits = storm::storage::BitVector(values.size() * bitsPerValue);
+        uint64_t bitIndex = 0;
+        for (auto const& value : values) {
+            bits.setFromInt(bitIndex, bitsPerValue, static_cast<uint64_t>(value) - static_cast<uint64_t>(smallestValue));
+            bitIndex += bitsPerValue;
+        }
+    }
 }
 
-typename StateValuations::StateValuation const& StateValuations::getValuation(storm::storage::sparse::state_type const& stateIndex) const {
-    STORM_LOG_ASSERT(stateIndex < valuations.size(), "Invalid state index.");
-    STORM_LOG_ASSERT(assertValuation(valuations[stateIndex]), "Invalid  state valuations");
-    return valuations[stateIndex];
+int64_t StateValuations::PackedIntegerColumn::get(uint64_t index) const {
+    if (bitsPerValue == 0) {
+        return smallestValue;
+    }
+    STORM_LOG_ASSERT((index + 1) * bitsPerValue <= bits.size(), "Invalid index " << index << " for packed column.");
+    return static_cast<int64_t>(static_cast<uint64_t>(smallestValue) + bits.getAsInt(index * bitsPerValue, bitsPerValue));
 }
 
 StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -36,14 +53,16 @@ StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm:
                                                         typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableBegin,
                                                         typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                                                         typename std::map<std::string, uint64_t>::const_iterator labelBegin,
-                                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuation const* valuation)
+                                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd,
+                                                        StateValuations const* stateValuations, storm::storage::sparse::state_type state)
     : variableIt(variableIt),
       labelIt(labelIt),
       variableBegin(variableBegin),
       variableEnd(variableEnd),
       labelBegin(labelBegin),
       labelEnd(labelEnd),
-      valuation(valuation) {
+      stateValuations(stateValuations),
+      state(state) {
     // Intentionally left empty.
 }
 
@@ -83,28 +102,28 @@ std::string const& StateValuations::StateValueIterator::getName() const {
 
 bool StateValuations::StateValueIterator::getBooleanValue() const {
     STORM_LOG_ASSERT(isBoolean(), "Variable has no boolean type.");
-    return valuation->booleanValues[variableIt->second];
+    return stateValuations->booleanColumns[variableIt->second][state];
 }
 
 int64_t StateValuations::StateValueIterator::getIntegerValue() const {
     STORM_LOG_ASSERT(isInteger(), "Variable has no integer type.");
-    return valuation->integerValues[variableIt->second];
+    return stateValuations->integerColumns[variableIt->second].get(state);
 }
 
 int64_t StateValuations::StateValueIterator::getLabelValue() const {
     STORM_LOG_ASSERT(isLabelAssignment(), "Not a label assignment");
-    STORM_LOG_ASSERT(labelIt->second < valuation->observationLabelValues.size(),
-                     "Label index " << labelIt->second << " larger than number of labels " << valuation->observationLabelValues.size());
-    return valuation->observationLabelValues[labelIt->second];
+    STORM_LOG_ASSERT(labelIt->second < stateValuations->observationLabelColumns.size(),
+                     "Label index " << labelIt->second << " larger than number of labels " << stateValuations->observationLabelColumns.size());
+    return stateValuations->observationLabelColumns[labelIt->second].get(state);
 }
 
 storm::RationalNumber StateValuations::StateValueIterator::getRationalValue() const {
     STORM_LOG_ASSERT(isRational(), "Variable has no rational type.");
-    return valuation->rationalValues[variableIt->second];
+    return stateValuations->rationalColumns[variableIt->second][state];
 }
 
 bool StateValuations::StateValueIterator::operator==(StateValueIterator const& other) {
-    STORM_LOG_ASSERT(valuation == valuation, "Comparing iterators for different states");
+    STORM_LOG_ASSERT(stateValuations == other.stateValuations && state == other.state, "Comparing iterators for different states");
     return variableIt == other.variableIt && labelIt == other.labelIt;
 }
 bool StateValuations::StateValueIterator::operator!=(StateValueIterator const& other) {
@@ -131,42 +150,43 @@ typename StateValuations::StateValueIterator& StateValuations::StateValueIterato
 }
 
 StateValuations::StateValueIteratorRange::StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap,
-                                                                  std::map<std::string, uint64_t> const& labelMap, StateValuation const* valuation)
-    : variableMap(variableMap), labelMap(labelMap), valuation(valuation) {
+                                                                  std::map<std::string, uint64_t> const& labelMap, StateValuations const* stateValuations,
+                                                                  storm::storage::sparse::state_type state)
+    : variableMap(variableMap), labelMap(labelMap), stateValuations(stateValuations), state(state) {
     // Intentionally left empty.
 }
 
 StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::begin() const {
-    return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuation);
+    return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(),
+                              stateValuations, state);
 }
 
 StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::end() const {
-    return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuation);
+    return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(),
+                              stateValuations, state);
 }
 
 bool StateValuations::getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+    STORM_LOG_ASSERT(!isEmpty(stateIndex), "No valuation for state " << stateIndex << ".");
     STORM_LOG_ASSERT(variableToIndexMap.count(booleanVariable) > 0, "Variable " << booleanVariable.getName() << " is not part of this valuation.");
-    return valuation.booleanValues[variableToIndexMap.at(booleanVariable)];
+    return booleanColumns[variableToIndexMap.at(booleanVariable)][stateIndex];
 }
 
-int64_t const& StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex,
-                                                storm::expressions::Variable const& integerVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+int64_t StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const {
+    STORM_LOG_ASSERT(!isEmpty(stateIndex), "No valuation for state " << stateIndex << ".");
     STORM_LOG_ASSERT(variableToIndexMap.count(integerVariable) > 0, "Variable " << integerVariable.getName() << " is not part of this valuation.");
-    return valuation.integerValues[variableToIndexMap.at(integerVariable)];
+    return integerColumns[variableToIndexMap.at(integerVariable)].get(stateIndex);
 }
 
 storm::RationalNumber const& StateValuations::getRationalValue(storm::storage::sparse::state_type const& stateIndex,
                                                                storm::expressions::Variable const& rationalVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+    STORM_LOG_ASSERT(!isEmpty(stateIndex), "No valuation for state " << stateIndex << ".");
     STORM_LOG_ASSERT(variableToIndexMap.count(rationalVariable) > 0, "Variable " << rationalVariable.getName() << " is not part of this valuation.");
-    return valuation.rationalValues[variableToIndexMap.at(rationalVariable)];
+    return rationalColumns[variableToIndexMap.at(rationalVariable)][stateIndex];
 }
 
 bool StateValuations::isEmpty(storm::storage::sparse::state_type const& stateIndex) const {
-    auto const& valuation = valuations[stateIndex];  // Do not use getValuations, as that is only valid after adding stuff.
-    return valuation.booleanValues.empty() && valuation.integerValues.empty() && valuation.rationalValues.empty() && valuation.observationLabelValues.empty();
+    return stateIndex >= numberOfStates || !statesWithValuation.get(stateIndex);
 }
 
 std::string StateValuations::toString(storm::storage::sparse::state_type const& stateIndex, bool pretty,
@@ -257,43 +277,6 @@ storm::json<JsonRationalType> StateValuations::toJson(storm::storage::sparse::st
     return result;
 }
 
-bool StateValuations::assertValuation(StateValuation const& valuation) const {
-    storm::storage::BitVector foundBooleanValues(valuation.booleanValues.size(), false);
-    storm::storage::BitVector foundIntegerValues(valuation.integerValues.size(), false);
-    storm::storage::BitVector foundRationalValues(valuation.rationalValues.size(), false);
-    for (auto const& varIndex : variableToIndexMap) {
-        storm::storage::BitVector* bv;
-        if (varIndex.first.hasBooleanType()) {
-            bv = &foundBooleanValues;
-        } else if (varIndex.first.hasIntegerType()) {
-            bv = &foundIntegerValues;
-        } else if (varIndex.first.hasRationalType()) {
-            bv = &foundRationalValues;
-        } else {
-            STORM_LOG_THROW(false, storm::exceptions::InvalidTypeException, "Unexpected variable type.");
-        }
-        if (varIndex.second < bv->size()) {
-            if (bv->get(varIndex.second)) {
-                STORM_LOG_ERROR("Multiple variables refer to the same value index");
-                return false;
-            }
-            bv->set(varIndex.second, true);
-        } else {
-            STORM_LOG_ERROR("Valuation does not provide a value for all variables");
-            return false;
-        }
-    }
-    if (!(foundBooleanValues.full() && foundIntegerValues.full() && foundRationalValues.full())) {
-        STORM_LOG_ERROR("Valuation has too many entries.");
-    }
-    return true;
-}
-
-StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations)
-    : variableToIndexMap(variableToIndexMap), valuations(valuations) {
-    // Intentionally left empty
-}
-
 std::string StateValuations::getStateInfo(state_type const& state) const {
     STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
     return this->toString(state);
@@ -301,40 +284,81 @@ std::string StateValuations::getStateInfo(state_type const& state) const {
 
 typename StateValuations::StateValueIteratorRange StateValuations::at(state_type const& state) const {
     STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
-    return StateValueIteratorRange({variableToIndexMap, observationLabels, &(valuations[state])});
+    return StateValueIteratorRange(variableToIndexMap, observationLabels, this, state);
 }
 
 uint_fast64_t StateValuations::getNumberOfStates() const {
-    return valuations.size();
+    return numberOfStates;
 }
 
 std::size_t StateValuations::hash() const {
     return 0;
 }
 
+StateValuations StateValuations::selectStatesInternal(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
+    StateValuations result;
+    result.variableToIndexMap = variableToIndexMap;
+    result.observationLabels = observationLabels;
+    result.numberOfStates = selectedStates.size();
+    result.statesWithValuation = storm::storage::BitVector(selectedStates.size());
+    for (uint64_t newState = 0; newState < selectedStates.size(); ++newState) {
+        if (!isEmpty(selectedStates[newState])) {
+            result.statesWithValuation.set(newState, true);
+        }
+    }
+
+    // Invalid (or empty) states get the value of the first state as placeholder so that they do not widen the range of packed columns.
+    auto getOldState = [&](uint64_t newState) -> storm::storage::sparse::state_type {
+        return result.statesWithValuation.get(newState) ? selectedStates[newState] : 0;
+    };
+    for (auto const& column : booleanColumns) {
+        auto& newColumn = result.booleanColumns.emplace_back(selectedStates.size(), false);
+        for (auto newState : result.statesWithValuation) {
+            newColumn[newState] = column[selectedStates[newState]];
+        }
+    }
+    for (auto const& column : rationalColumns) {
+        auto& newColumn = result.rationalColumns.emplace_back(selectedStates.size(), storm::utility::zero<storm::RationalNumber>());
+        for (auto newState : result.statesWithValuation) {
+            newColumn[newState] = column[selectedStates[newState]];
+        }
+    }
+    std::vector<int64_t> values(selectedStates.size());
+    auto selectPackedColumns = [&](std::vector<PackedIntegerColumn> const& columns, std::vector<PackedIntegerColumn>& newColumns) {
+        for (auto const& column : columns) {
+            for (uint64_t newState = 0; newState < selectedStates.size(); ++newState) {
+                values[newState] = column.get(getOldState(newState));
+            }
+            newColumns.emplace_back(values);
+        }
+    };
+    if (numberOfStates > 0) {
+        selectPackedColumns(integerColumns, result.integerColumns);
+        selectPackedColumns(observationLabelColumns, result.observationLabelColumns);
+    } else {
+        result.integerColumns.resize(integerColumns.size());
+        result.observationLabelColumns.resize(observationLabelColumns.size());
+    }
+    return result;
+}
+
 StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
-    return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates));
+    std::vector<storm::storage::sparse::state_type> selectedStateIndices;
+    selectedStateIndices.reserve(selectedStates.getNumberOfSetBits());
+    for (auto state : selectedStates) {
+        selectedStateIndices.push_back(state);
+    }
+    return selectStatesInternal(selectedStateIndices);
 }
 
 StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
-    std::vector<StateValuation> selectedValuations;
-    selectedValuations.reserve(selectedStates.size());
-    for (auto const& selectedState : selectedStates) {
-        if (selectedState < valuations.size()) {
-            selectedValuations.push_back(valuations[selectedState]);
-        } else {
-            selectedValuations.emplace_back();
-        }
-    }
-    return StateValuations(variableToIndexMap, std::move(selectedValuations));
+    return selectStatesInternal(selectedStates);
 }
 
 StateValuations StateValuations::blowup(const std::vector<uint64_t>& mapNewToOld) const {
-    std::vector<StateValuation> newValuations;
-    for (auto const& oldState : mapNewToOld) {
-        newValuations.push_back(valuations[oldState]);
-    }
-    return StateValuations(variableToIndexMap, std::move(newValuations));
+    STORM_LOG_ASSERT(std::all_of(mapNewToOld.begin(), mapNewToOld.end(), [this](uint64_t oldState) { return oldState < numberOfStates; }),
+                     "Invalid state index.");
+    return selectStatesInternal(mapNewToOld);
 }
 
 StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVarCount(0), rationalVarCount(0), labelCount(0) {
@@ -342,21 +366,26 @@ StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVa
 }
 
 void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable) {
-    STORM_LOG_ASSERT(currentStateValuations.valuations.empty(), "Tried to add a variable, although a state has already been added before.");
+    STORM_LOG_ASSERT(hasValuation.empty(), "Tried to add a variable, although a state has already been added before.");
     STORM_LOG_ASSERT(currentStateValuations.variableToIndexMap.count(variable) == 0, "Variable " << variable.getName() << " already added.");
     if (variable.hasBooleanType()) {
         currentStateValuations.variableToIndexMap[variable] = booleanVarCount++;
+        booleanValues.emplace_back();
     }
     if (variable.hasIntegerType()) {
         currentStateValuations.variableToIndexMap[variable] = integerVarCount++;
+        integerValues.emplace_back();
     }
     if (variable.hasRationalType()) {
         currentStateValuations.variableToIndexMap[variable] = rationalVarCount++;
+        rationalValues.emplace_back();
     }
 }
 
 void StateValuationsBuilder::addObservationLabel(const std::string& label) {
+    STORM_LOG_ASSERT(hasValuation.empty(), "Tried to add an observation label, although a state has already been added before.");
     currentStateValuations.observationLabels[label] = labelCount++;
+    observationLabelValues.emplace_back();
 }
 
 void StateValuationsBuilder::addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues,
@@ -366,16 +395,42 @@ void StateValuationsBuilder::addState(storm::storage::sparse::state_type const&
 
 void StateValuationsBuilder::addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues,
                                       std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues) {
-    if (state > currentStateValuations.valuations.size()) {
-        currentStateValuations.valuations.resize(state);
+    STORM_LOG_ASSERT(booleanValues.size() == booleanVarCount, "Unexpected number of boolean values.");
+    STORM_LOG_ASSERT(integerValues.size() == integerVarCount, "Unexpected number of integer values.");
+    STORM_LOG_ASSERT(rationalValues.size() == rationalVarCount, "Unexpected number of rational values.");
+    STORM_LOG_ASSERT(observationLabelValues.empty() || observationLabelValues.size() == labelCount, "Unexpected number of observation label values.");
+    if (state >= hasValuation.size()) {
+        resizeColumns(state + 1);
     }
-    if (state == currentStateValuations.valuations.size()) {
-        currentStateValuations.valuations.emplace_back(std::move(booleanValues), std::move(integerValues), std::move(rationalValues),
-                                                       std::move(observationLabelValues));
-    } else {
-        STORM_LOG_ASSERT(currentStateValuations.isEmpty(state), "Adding a valuation to the same state multiple times.");
-        currentStateValuations.valuations[state] = typename StateValuations::StateValuation(std::move(booleanValues), std::move(integerValues),
-                                                                                            std::move(rationalValues), std::move(observationLabelValues));
+    STORM_LOG_ASSERT(!hasValuation[state], "Adding a valuation to the same state multiple times.");
+    hasValuation[state] = true;
+    for (uint64_t i = 0; i < booleanValues.size(); ++i) {
+        this->booleanValues[i][state] = booleanValues[i];
+    }
+    for (uint64_t i = 0; i < integerValues.size(); ++i) {
+        this->integerValues[i][state] = integerValues[i];
+    }
+    for (uint64_t i = 0; i < rationalValues.size(); ++i) {
+        this->rationalValues[i][state] = std::move(rationalValues[i]);
+    }
+    for (uint64_t i = 0; i < observationLabelValues.size(); ++i) {
+        this->observationLabelValues[i][state] = observationLabelValues[i];
+    }
+}
+
+void StateValuationsBuilder::resizeColumns(uint64_t numberOfStates) {
+    hasValuation.resize(numberOfStates, false);
+    for (auto& column : booleanValues) {
+        column.resize(numberOfStates, false);
+    }
+    for (auto& column : integerValues) {
+        column.resize(numberOfStates, 0);
+    }
+    for (auto& column : rationalValues) {
+        column.resize(numberOfStates, storm::utility::zero<storm::RationalNumber>());
+    }
+    for (auto& column : observationLabelValues) {
+        column.resize(numberOfStates, 0);
     }
 }
 
@@ -392,11 +447,35 @@ uint64_t StateValuationsBuilder::getLabelCount() const {
 }
 
 StateValuations StateValuationsBuilder::build() {
+    StateValuations result = std::move(currentStateValuations);
+    currentStateValuations = StateValuations();
+    result.numberOfStates = hasValuation.size();
+    result.statesWithValuation = storm::storage::BitVector(hasValuation.size());
+    for (uint64_t state = 0; state < hasValuation.size(); ++state) {
+        if (hasValuation[state]) {
+            result.statesWithValuation.set(state, true);
+        }
+    }
+    result.booleanColumns = std::move(booleanValues);
+    result.rationalColumns = std::move(rationalValues);
+    // Integer values are only packed now, as the number of bits depends on the range of values that actually occur.
+    for (auto const& column : integerValues) {
+        result.integerColumns.emplace_back(column);
+    }
+    for (auto const& column : observationLabelValues) {
+        result.observationLabelColumns.emplace_back(column);
+    }
+    hasValuation.clear();
+    booleanValues.clear();
+    integerValues.clear();
+    rationalValues.clear();
+    observationLabelValues.clear();
+
     booleanVarCount = 0;
     integerVarCount = 0;
     rationalVarCount = 0;
     labelCount = 0;
-    return std::move(currentStateValuations);
+    return result;
 }
 
 template storm::json<double> StateValuations::toJson<double>(storm::storage::sparse::state_type const&,
@@ -2,7 +2,10 @@
 
 #include <boost/optional.hpp>
 #include <cstdint>
+#include <map>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "storm/adapters/JsonForward.h"
 #include "storm/adapters/RationalNumberForward.h"
@@ -22,20 +25,6 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
    public:
     friend class StateValuationsBuilder;
 
-    class StateValuation {
-       public:
-        friend class StateValuations;
-        StateValuation() = default;
-        StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues,
-                       std::vector<int64_t>&& observationLabelValues = {});
-
-       private:
-        std::vector<bool> booleanValues;
-        std::vector<int64_t> integerValues;
-        std::vector<storm::RationalNumber> rationalValues;
-        std::vector<int64_t> observationLabelValues;
-    };
-
     class StateValueIterator {
        public:
         StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -43,7 +32,8 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
                            typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableBegin,
                            typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                            typename std::map<std::string, uint64_t>::const_iterator labelBegin,
-                           typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuation const* valuation);
+                           typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuations const* stateValuations,
+                           storm::storage::sparse::state_type state);
         bool operator==(StateValueIterator const& other);
         bool operator!=(StateValueIterator const& other);
         StateValueIterator& operator++();
@@ -73,20 +63,22 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
         typename std::map<std::string, uint64_t>::const_iterator labelBegin;
         typename std::map<std::string, uint64_t>::const_iterator labelEnd;
 
-        StateValuation const* const valuation;
+        StateValuations const* const stateValuations;
+        storm::storage::sparse::state_type const state;
     };
 
     class StateValueIteratorRange {
        public:
         StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, std::map<std::string, uint64_t> const& labelMap,
-                                StateValuation const* valuation);
+                                StateValuations const* stateValuations, storm::storage::sparse::state_type state);
         StateValueIterator begin() const;
         StateValueIterator end() const;
 
        private:
         std::map<storm::expressions::Variable, uint64_t> const& variableMap;
         std::map<std::string, uint64_t> const& labelMap;
-        StateValuation const* const valuation;
+        StateValuations const* const stateValuations;
+        storm::storage::sparse::state_type const state;
     };
 
     StateValuations() = default;
@@ -95,7 +87,7 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     StateValueIteratorRange at(storm::storage::sparse::state_type const& state) const;
 
     bool getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const;
-    int64_t const& getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
+    int64_t getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
     storm::RationalNumber const& getRationalValue(storm::storage::sparse::state_type const& stateIndex,
                                                   storm::expressions::Variable const& rationalVariable) const;
     /// Returns true, if this valuation does not contain any value.
@@ -138,14 +130,39 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     virtual std::size_t hash() const;
 
    private:
-    StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations);
-    bool assertValuation(StateValuation const& valuation) const;
-    StateValuation const& getValuation(storm::storage::sparse::state_type const& stateIndex) const;
+    /*!
+     * The values of one integer variable (or observation label) for all states. The values are stored column-wise as their difference to the smallest
+     * value, each using the number of bits that is needed for the largest difference. Variables with small ranges thus take only a few bits per state.
+     */
+    class PackedIntegerColumn {
+       public:
+        PackedIntegerColumn() = default;
+        explicit PackedIntegerColumn(std::vector<int64_t> const& values);
+
+        int64_t get(uint64_t index) const;
+
+       private:
+        int64_t smallestValue{0};
+        uint64_t bitsPerValue{0};
+        storm::storage::BitVector bits;
+    };
+
+    /*!
+     * Derives new state valuations from this by taking the valuation of the given state for each new state.
+     * If an invalid state index is given, the corresponding valuation will be empty.
+     */
+    StateValuations selectStatesInternal(std::vector<storm::storage::sparse::state_type> const& selectedStates) const;
 
     std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
     std::map<std::string, uint64_t> observationLabels;
-    // A mapping from state indices to their variable valuations.
-    std::vector<StateValuation> valuations;
+    uint64_t numberOfStates{0};
+    // The states for which a valuation has been added.
+    storm::storage::BitVector statesWithValuation;
+    // For each variable (or label) of the respective type, the values of all states.
+    std::vector<std::vector<bool>> booleanColumns;
+    std::vector<PackedIntegerColumn> integerColumns;
+    std::vector<std::vector<storm::RationalNumber>> rationalColumns;
+    std::vector<PackedIntegerColumn> observationLabelColumns;
 };
 
 class StateValuationsBuilder {
@@ -187,11 +204,20 @@ class StateValuationsBuilder {
     uint64_t getLabelCount() const;
 
    private:
+    void resizeColumns(uint64_t numberOfStates);
+
     StateValuations currentStateValuations;
     uint64_t booleanVarCount;
     uint64_t integerVarCount;
     uint64_t rationalVarCount;
     uint64_t labelCount;
+
+    // The values of the states added so far, one vector per variable (or label). They are packed once the state valuations are built.
+    std::vector<bool> hasValuation;
+    std::vector<std::vector<bool>> booleanValues;
+    std::vector<std::vector<int64_t>> integerValues;
+    std::vector<std::vector<storm::RationalNumber>> rationalValues;
+    std::vector<std::vector<int64_t>> observationLabelValues;
 };
 }  // namespace sparse
 }  // namespace storage
@@ -7,12 +7,20 @@
  */
 
 #include "storm/exceptions/BaseException.h"
+#include "storm/settings/modules/ServerSettings.h"
 #include "storm/utility/macros.h"
 
 #include "storm-cli-utilities/cli.h"
 #include "storm-cli-utilities/model-handling.h"
+#include "storm-cli-utilities/server.h"
 
 void processOptions() {
+    // In server mode, the input is given by the requests sent to the server.
+    if (storm::settings::getModule<storm::settings::modules::ServerSettings>().isServerSet()) {
+        storm::cli::runServer();
+        return;
+    }
+
     // Parse symbolic input (PRISM, JANI, properties, etc.)
     storm::cli::SymbolicInput symbolicInput = storm::cli::parseSymbolicInput();
 
@@ -1,5 +1,6 @@
 #include "storm/transformer/ContinuousToDiscreteTimeModelTransformer.h"
 
+#include <numeric>
 #include <unordered_map>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -7,7 +8,10 @@
 #include "storm/logic/Formulas.h"
 #include "storm/logic/FragmentSpecification.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -16,20 +20,79 @@
 namespace storm {
 namespace transformer {
 
+namespace {
+
+template<typename ValueType>
+uint64_t getNumberOfTransformationThreads(uint64_t numberOfRows) {
+    // Arithmetic on rational functions is not thread-safe.
+    if (std::is_same<ValueType, storm::RationalFunction>::value || !storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+        return 1;
+    }
+    return std::min<uint64_t>(storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads(),
+                              std::max<uint64_t>(1, numberOfRows / 50000));
+}
+
+/*
+ * Divides each row of the given matrix by the corresponding exit rate. The rows are processed in parallel.
+ */
+template<typename ValueType>
+void divideRowsByExitRates(storm::storage::SparseMatrix<ValueType>& matrix, std::vector<ValueType> const& exitRates) {
+    STORM_LOG_ASSERT(exitRates.size() == matrix.getRowCount(), "Can not divide rows: Number of rows and number of exit rates do not match.");
+    storm::utility::parallel::forEachChunk(getNumberOfTransformationThreads<ValueType>(matrix.getRowCount()), static_cast<uint64_t>(0), matrix.getRowCount(),
+                                           [&](uint64_t, uint64_t begin, uint64_t end) {
+                                               for (uint64_t row = begin; row < end; ++row) {
+                                                   STORM_LOG_ASSERT(!storm::utility::isZero(exitRates[row]), "Can not divide row " << row << " by 0.");
+                                                   for (auto& entry : matrix.getRow(row)) {
+                                                       entry.setValue(entry.getValue() / exitRates[row]);
+                                                   }
+                                               }
+                                           });
+}
+
+/*
+ * Creates the matrix whose rows are the rows of the given matrix divided by the corresponding exit rate. The entries are copied and divided in a single
+ * (parallel) pass and directly yield the data of the resulting matrix.
+ */
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> getRowsDividedByExitRates(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                                  std::vector<ValueType> const& exitRates) {
+    typedef typename storm::storage::SparseMatrix<ValueType>::index_type IndexType;
+    STORM_LOG_ASSERT(exitRates.size() == matrix.getRowCount(), "Can not divide rows: Number of rows and number of exit rates do not match.");
+    STORM_LOG_ASSERT(matrix.hasTrivialRowGrouping(), "Expected a matrix with trivial row grouping.");
+    uint64_t const numberOfThreads = getNumberOfTransformationThreads<ValueType>(matrix.getRowCount());
+
+    std::vector<IndexType> rowIndications(matrix.getRowCount() + 1, 0);
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        rowIndications[row + 1] = rowIndications[row] + matrix.getRow(row).getNumberOfEntries();
+    }
+    std::vector<storm::storage::MatrixEntry<IndexType, ValueType>> columnsAndValues(rowIndications.back());
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), matrix.getRowCount(), [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t row = begin; row < end; ++row) {
+            STORM_LOG_ASSERT(!storm::utility::isZero(exitRates[row]), "Can not divide row " << row << " by 0.");
+            auto entryIt = columnsAndValues.begin() + rowIndications[row];
+            for (auto const& entry : matrix.getRow(row)) {
+                *entryIt = storm::storage::MatrixEntry<IndexType, ValueType>(entry.getColumn(), entry.getValue() / exitRates[row]);
+                ++entryIt;
+            }
+        }
+    });
+    return storm::storage::SparseMatrix<ValueType>(matrix.getColumnCount(), std::move(rowIndications), std::move(columnsAndValues), boost::none);
+}
+
+}  // namespace
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::models::sparse::Dtmc<ValueType, RewardModelType>> ContinuousToDiscreteTimeModelTransformer<ValueType, RewardModelType>::transform(
     storm::models::sparse::Ctmc<ValueType, RewardModelType> const& ctmc, boost::optional<std::string> const& timeRewardModelName) {
-    // Init the dtmc components
-    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> dtmcComponents(ctmc.getTransitionMatrix(), ctmc.getStateLabeling(),
-                                                                                       ctmc.getRewardModels());
+    // Init the dtmc components. The rates are turned into probabilities by dividing each row of the transition matrix with the exit rate while copying it
+    std::vector<ValueType> const& exitRates = ctmc.getExitRateVector();
+    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> dtmcComponents(
+        getRowsDividedByExitRates(ctmc.getTransitionMatrix(), exitRates), storm::models::sparse::StateLabeling(ctmc.getStateLabeling()),
+        std::unordered_map<std::string, RewardModelType>(ctmc.getRewardModels()));
     dtmcComponents.choiceLabeling = ctmc.getOptionalChoiceLabeling();
     dtmcComponents.stateValuations = ctmc.getOptionalStateValuations();
     dtmcComponents.choiceOrigins = ctmc.getOptionalChoiceOrigins();
 
-    // Turn the rates into probabilities by dividing each row of the transition matrix with the exit rate
-    std::vector<ValueType> const& exitRates = ctmc.getExitRateVector();
-    dtmcComponents.transitionMatrix.divideRowsInPlace(exitRates);
-
     // Transform the reward models
     for (auto& rewardModel : dtmcComponents.rewardModels) {
         if (rewardModel.second.hasStateRewards()) {
@@ -65,7 +128,7 @@ std::shared_ptr<storm::models::sparse::Dtmc<ValueType, RewardModelType>> Continu
 
     // Turn the rates into probabilities by dividing each row of the transition matrix with the exit rate
     std::vector<ValueType>& exitRates = ctmc.getExitRateVector();
-    dtmcComponents.transitionMatrix.divideRowsInPlace(exitRates);
+    divideRowsByExitRates(dtmcComponents.transitionMatrix, exitRates);
 
     // Transform the reward models
     for (auto& rewardModel : dtmcComponents.rewardModels) {
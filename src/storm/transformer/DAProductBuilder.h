@@ -13,7 +13,17 @@ namespace transformer {
 class DAProductBuilder {
    public:
     DAProductBuilder(const storm::automata::DeterministicAutomaton& da, const std::vector<storm::storage::BitVector>& statesForAP)
-        : da(da), statesForAP(statesForAP) {}
+        : da(da), statesForAP(statesForAP) {
+        // The label of every model state is needed for each of its incoming transitions, so we compute them once.
+        if (!statesForAP.empty()) {
+            labels.assign(statesForAP.front().size(), da.getAPSet().elementAllFalse());
+            for (unsigned int ap = 0; ap < da.getAPSet().size(); ap++) {
+                for (auto s : statesForAP.at(ap)) {
+                    labels[s] = da.getAPSet().elementAddAP(labels[s], ap);
+                }
+            }
+        }
+    }
 
     template<typename Model>
     typename DAProduct<Model>::ptr build(const Model& originalModel, const storm::storage::BitVector& statesOfInterest) const {
@@ -38,18 +48,20 @@ class DAProductBuilder {
         return da.getSuccessor(automatonFrom, getLabelForState(modelTo));
     }
 
+    storm::storage::sparse::state_type getNumberOfAutomatonStates() const {
+        return da.getNumberOfStates();
+    }
+
    private:
     const storm::automata::DeterministicAutomaton& da;
     const std::vector<storm::storage::BitVector>& statesForAP;
+    std::vector<storm::automata::APSet::alphabet_element> labels;
 
     storm::automata::APSet::alphabet_element getLabelForState(storm::storage::sparse::state_type s) const {
-        storm::automata::APSet::alphabet_element label = da.getAPSet().elementAllFalse();
-        for (unsigned int ap = 0; ap < da.getAPSet().size(); ap++) {
-            if (statesForAP.at(ap).get(s)) {
-                label = da.getAPSet().elementAddAP(label, ap);
-            }
+        if (labels.empty()) {
+            return da.getAPSet().elementAllFalse();
         }
-        return label;
+        return labels.at(s);
     }
 };
 }  // namespace transformer
@@ -1,10 +1,15 @@
 #ifndef STORM_TRANSFORMER_ENDCOMPONENTELIMINATOR_H
 #define STORM_TRANSFORMER_ENDCOMPONENTELIMINATOR_H
 
+#include <type_traits>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace transformer {
@@ -171,39 +176,78 @@ class EndComponentEliminator {
                                                                           std::vector<uint_fast64_t> const& newToOldRowMapping,
                                                                           std::vector<uint_fast64_t> const& oldToNewStateMapping,
                                                                           storm::storage::BitVector const& sinkRows, bool addSelfLoopAtSinkStates) {
+        typedef storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType> MatrixEntry;
         uint_fast64_t numRowGroups = newRowGroupIndices.size() - 1;
-        uint_fast64_t newRow = 0;
-        storm::storage::SparseMatrixBuilder<ValueType> builder(newToOldRowMapping.size(), numRowGroups, originalMatrix.getEntryCount(), false, true,
-                                                               numRowGroups);
-        for (uint_fast64_t newRowGroup = 0; newRowGroup < numRowGroups; ++newRowGroup) {
-            builder.newRowGroup(newRow);
-            for (; newRow < newRowGroupIndices[newRowGroup + 1]; ++newRow) {
-                if (sinkRows.get(newRow)) {
-                    if (addSelfLoopAtSinkStates) {
-                        builder.addNextValue(newRow, newRowGroup, storm::utility::one<ValueType>());
+        uint_fast64_t numRows = newToOldRowMapping.size();
+
+        // As the rows are independent of each other, they are built in chunks (by multiple threads for large matrices).
+        uint64_t numberOfThreads = 1;
+        // The arithmetic on rational functions is not thread-safe.
+        if (!std::is_same_v<ValueType, storm::RationalFunction> && originalMatrix.getEntryCount() >= MinimalNumberOfEntriesForParallelTransformation &&
+            storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+            numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads();
+        }
+        std::vector<storm::storage::SparseMatrixIndexType> rowIndications(numRows + 1, 0);
+        std::vector<std::vector<MatrixEntry>> chunkEntries(numberOfThreads);
+        std::vector<uint_fast64_t> chunkBegins(numberOfThreads + 1, numRows);
+        uint64_t numberOfChunks = storm::utility::parallel::forEachChunk(
+            numberOfThreads, static_cast<uint_fast64_t>(0), numRows, [&](uint64_t chunk, uint_fast64_t chunkBegin, uint_fast64_t chunkEnd) {
+                chunkBegins[chunk] = chunkBegin;
+                auto& entries = chunkEntries[chunk];
+                // The new row group of the current row.
+                uint_fast64_t newRowGroup = std::upper_bound(newRowGroupIndices.begin(), newRowGroupIndices.end(), chunkBegin) - newRowGroupIndices.begin() - 1;
+                for (uint_fast64_t newRow = chunkBegin; newRow < chunkEnd; ++newRow) {
+                    while (newRowGroupIndices[newRowGroup + 1] <= newRow) {
+                        ++newRowGroup;
                     }
-                } else {
-                    // Make sure that the entries for this row are inserted in the right order.
-                    // Also, transitions to the same EC need to be merged and transitions to states that are erased need to be ignored
-                    std::map<uint_fast64_t, ValueType> sortedEntries;
-                    for (auto const& entry : originalMatrix.getRow(newToOldRowMapping[newRow])) {
-                        uint_fast64_t newColumn = oldToNewStateMapping[entry.getColumn()];
-                        if (newColumn < numRowGroups) {
-                            auto insertResult = sortedEntries.insert(std::make_pair(newColumn, entry.getValue()));
-                            if (!insertResult.second) {
+                    uint64_t const rowBegin = entries.size();
+                    if (sinkRows.get(newRow)) {
+                        if (addSelfLoopAtSinkStates) {
+                            entries.emplace_back(newRowGroup, storm::utility::one<ValueType>());
+                        }
+                    } else {
+                        // Transitions to the same EC need to be merged and transitions to states that are erased need to be ignored
+                        for (auto const& entry : originalMatrix.getRow(newToOldRowMapping[newRow])) {
+                            uint_fast64_t newColumn = oldToNewStateMapping[entry.getColumn()];
+                            if (newColumn < numRowGroups) {
+                                entries.emplace_back(newColumn, entry.getValue());
+                            }
+                        }
+                        // Make sure that the entries for this row are in the right order. Entries with the same column keep their order, so they
+                        // are merged in the order in which they occur in the original row.
+                        std::stable_sort(entries.begin() + rowBegin, entries.end(),
+                                         [](MatrixEntry const& first, MatrixEntry const& second) { return first.getColumn() < second.getColumn(); });
+                        uint64_t rowEnd = rowBegin;
+                        for (uint64_t index = rowBegin; index < entries.size(); ++index) {
+                            if (rowEnd > rowBegin && entries[rowEnd - 1].getColumn() == entries[index].getColumn()) {
                                 // We have already seen an entry with this column. ==> merge transitions
-                                insertResult.first->second += entry.getValue();
+                                entries[rowEnd - 1].setValue(entries[rowEnd - 1].getValue() + entries[index].getValue());
+                            } else {
+                                entries[rowEnd++] = std::move(entries[index]);
                             }
                         }
+                        entries.resize(rowEnd);
                     }
-                    for (auto const& sortedEntry : sortedEntries) {
-                        builder.addNextValue(newRow, sortedEntry.first, sortedEntry.second);
-                    }
+                    rowIndications[newRow + 1] = entries.size() - rowBegin;
                 }
-            }
+            });
+        for (uint_fast64_t newRow = 0; newRow < numRows; ++newRow) {
+            rowIndications[newRow + 1] += rowIndications[newRow];
         }
-        return builder.build(newToOldRowMapping.size(), numRowGroups, numRowGroups);
+
+        std::vector<MatrixEntry> entries(rowIndications.back());
+        storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), numberOfChunks, [&](uint64_t, uint64_t begin, uint64_t end) {
+            for (uint64_t chunk = begin; chunk < end; ++chunk) {
+                std::move(chunkEntries[chunk].begin(), chunkEntries[chunk].end(), entries.begin() + rowIndications[chunkBegins[chunk]]);
+            }
+        });
+        boost::optional<std::vector<storm::storage::SparseMatrixIndexType>> rowGroupIndices(
+            std::vector<storm::storage::SparseMatrixIndexType>(newRowGroupIndices.begin(), newRowGroupIndices.end()));
+        return storm::storage::SparseMatrix<ValueType>(numRowGroups, std::move(rowIndications), std::move(entries), std::move(rowGroupIndices));
     }
+
+    // The number of entries of the original matrix below which the transformed matrix is built by a single thread.
+    static const uint64_t MinimalNumberOfEntriesForParallelTransformation = 1000000;
 };
 }  // namespace transformer
 }  // namespace storm
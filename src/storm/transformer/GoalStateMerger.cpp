@@ -212,7 +212,7 @@ std::unordered_map<std::string, typename SparseModelType::RewardModelType> GoalS
 
     std::unordered_map<std::string, typename SparseModelType::RewardModelType> rewardModels;
     for (auto rewardModelName : selectedRewardModels) {
-        auto origRewardModel = originalModel.getRewardModel(rewardModelName);
+        auto const& origRewardModel = originalModel.getRewardModel(rewardModelName);
 
         std::optional<std::vector<RewardValueType>> stateRewards;
         if (origRewardModel.hasStateRewards()) {
@@ -229,12 +229,13 @@ std::unordered_map<std::string, typename SparseModelType::RewardModelType> GoalS
         std::optional<storm::storage::SparseMatrix<RewardValueType>> transitionRewards;
         if (origRewardModel.hasTransitionRewards()) {
             storm::storage::SparseMatrixBuilder<RewardValueType> builder(choiceCount, stateCount, 0, true);
+            uint_fast64_t newRow = 0;
             for (auto row : resultData.keptChoices) {
                 boost::optional<typename SparseModelType::ValueType> targetValue, sinkValue;
                 for (auto const& entry : origRewardModel.getTransitionRewardMatrix().getRow(row)) {
                     uint_fast64_t const& newColumn = resultData.oldToNewStateIndexMapping[entry.getColumn()];
                     if (newColumn < maybeStateCount) {
-                        builder.addNextValue(row, newColumn, entry.getValue());
+                        builder.addNextValue(newRow, newColumn, entry.getValue());
                     } else if (resultData.targetState && newColumn == resultData.targetState.get()) {
                         targetValue = targetValue.is_initialized() ? *targetValue + entry.getValue() : entry.getValue();
                     } else if (resultData.sinkState && newColumn == resultData.sinkState.get()) {
@@ -245,11 +246,12 @@ std::unordered_map<std::string, typename SparseModelType::RewardModelType> GoalS
                     }
                 }
                 if (targetValue) {
-                    builder.addNextValue(row, *resultData.targetState, storm::utility::simplify(*targetValue));
+                    builder.addNextValue(newRow, *resultData.targetState, storm::utility::simplify(*targetValue));
                 }
                 if (sinkValue) {
-                    builder.addNextValue(row, *resultData.sinkState, storm::utility::simplify(*sinkValue));
+                    builder.addNextValue(newRow, *resultData.sinkState, storm::utility::simplify(*sinkValue));
                 }
+                ++newRow;
             }
             transitionRewards = builder.build();
         }
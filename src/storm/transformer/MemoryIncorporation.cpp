@@ -88,6 +88,19 @@ std::shared_ptr<SparseModelType> MemoryIncorporation<SparseModelType>::incorpora
     }
 
     storm::storage::SparseModelMemoryProduct<ValueType> product = memory.product(model);
+
+    // Only translate the reward models that are referenced by the formulas. Without a unique reward model, a formula without reward model name is invalid
+    // and we keep all reward models, i.e., the error is raised at the same place as before.
+    std::set<std::string> relevantRewardModels;
+    for (auto const& subFormula : formulas) {
+        subFormula->gatherReferencedRewardModels(relevantRewardModels);
+    }
+    if (relevantRewardModels.count("") == 0 || model.hasUniqueRewardModel()) {
+        if (relevantRewardModels.erase("") > 0) {
+            relevantRewardModels.insert(model.getUniqueRewardModelName());
+        }
+        product.setRelevantRewardModels(relevantRewardModels);
+    }
     return std::dynamic_pointer_cast<SparseModelType>(product.build());
 }
 
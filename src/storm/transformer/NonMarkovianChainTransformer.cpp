@@ -1,5 +1,7 @@
 #include "NonMarkovianChainTransformer.h"
 
+#include <algorithm>
+#include <iterator>
 #include <queue>
 
 #include <storm/solver/stateelimination/NondeterministicModelStateEliminator.h>
@@ -9,16 +11,229 @@
 #include "storm/logic/FragmentSpecification.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/FlexibleSparseMatrix.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
 namespace transformer {
 
+namespace {
+
+uint64_t getNumberOfEliminationThreads(bool threadSafeValueType, uint64_t numberOfStates) {
+    // Arithmetic on rational functions is not thread-safe.
+    if (!threadSafeValueType || !storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+        return 1;
+    }
+    return std::min<uint64_t>(storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads(),
+                              std::max<uint64_t>(1, numberOfStates / 50000));
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<models::sparse::Model<ValueType, RewardModelType>> buildEliminatedModel(
+    models::sparse::MarkovAutomaton<ValueType, RewardModelType> const& ma, storm::storage::SparseMatrix<ValueType>&& matrix,
+    storm::models::sparse::StateLabeling const& stateLabeling, storm::storage::BitVector const& keepStates) {
+    // TODO: obtain the reward model for the resulting system
+
+    // Prepare model components
+    storm::storage::BitVector markovianStates = ma.getMarkovianStates() % keepStates;
+    storm::models::sparse::StateLabeling labeling = stateLabeling.getSubLabeling(keepStates);
+    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(
+        std::move(matrix), std::move(labeling), std::unordered_map<std::string, RewardModelType>(ma.getRewardModels()), false, std::move(markovianStates));
+    std::vector<ValueType> exitRates(keepStates.getNumberOfSetBits());
+    storm::utility::vector::selectVectorValues(exitRates, keepStates, ma.getExitRates());
+    components.exitRates = std::move(exitRates);
+
+    // Build transformed model
+    auto model = std::make_shared<storm::models::sparse::MarkovAutomaton<ValueType, RewardModelType>>(std::move(components));
+    if (model->isConvertibleToCtmc()) {
+        return model->convertToCtmc();
+    } else {
+        return model;
+    }
+}
+
+/*
+ * Eliminates the probabilistic states without nondeterminism, provided that these states do not induce any cycle. For KeepLabels, MergeLabels and
+ * DeleteLabels, the states that are eliminated (and the resulting labeling) do not depend on the order in which states are eliminated one after another,
+ * so the result coincides with the one of the state eliminator. As there are no cycles, the eliminated states can be sorted into levels such that the
+ * successors of a state are kept or lie on lower levels. The distributions over kept states that replace the eliminated states are computed level by
+ * level, where the states of each level are processed in parallel. Finally, the rows of the kept states are assembled in parallel.
+ *
+ * @return The resulting model or nullptr if the eliminated states induce a cycle.
+ */
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<models::sparse::Model<ValueType, RewardModelType>> eliminateAcyclicNonmarkovianStates(
+    models::sparse::MarkovAutomaton<ValueType, RewardModelType> const& ma, EliminationLabelBehavior labelBehavior) {
+    STORM_LOG_ASSERT(labelBehavior != EliminationLabelBehavior::ExtendLabels, "The eliminated states depend on the order of elimination.");
+    typedef typename storm::storage::SparseMatrix<ValueType>::index_type IndexType;
+    typedef storm::storage::MatrixEntry<IndexType, ValueType> EntryType;
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix = ma.getTransitionMatrix();
+    uint64_t const numberOfStates = ma.getNumberOfStates();
+
+    // Determine the states to eliminate
+    storm::storage::BitVector eliminatedStates(numberOfStates, false);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        STORM_LOG_ASSERT(!ma.isHybridState(state), "State is hybrid.");
+        // Only eliminate immediate states without non-determinism
+        if (!ma.isProbabilisticState(state) || ma.getNumberOfChoices(state) > 1) {
+            continue;
+        }
+        STORM_LOG_ASSERT(ma.getNumberOfChoices(state) == 1, "State " << state << " has no choices.");
+        bool eliminate = true;
+        if (labelBehavior == EliminationLabelBehavior::KeepLabels) {
+            // Only eliminate if eliminated state and all its successors have the same labels
+            auto currLabels = ma.getStateLabeling().getLabelsOfState(state);
+            for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+                if (currLabels != ma.getStateLabeling().getLabelsOfState(entry.getColumn())) {
+                    STORM_LOG_TRACE("Do not eliminate state " << state << " because labels of state " << entry.getColumn() << " are different.");
+                    eliminate = false;
+                    break;
+                }
+            }
+        }
+        eliminatedStates.set(state, eliminate);
+    }
+
+    // Sort the eliminated states into levels
+    std::vector<uint64_t> numberOfUnresolvedSuccessors(numberOfStates, 0);
+    std::vector<std::vector<uint64_t>> eliminatedPredecessors(numberOfStates);
+    std::vector<std::vector<uint64_t>> levels(1);
+    for (auto state : eliminatedStates) {
+        for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+            if (eliminatedStates.get(entry.getColumn())) {
+                ++numberOfUnresolvedSuccessors[state];
+                eliminatedPredecessors[entry.getColumn()].push_back(state);
+            }
+        }
+        if (numberOfUnresolvedSuccessors[state] == 0) {
+            levels.front().push_back(state);
+        }
+    }
+    uint64_t numberOfSortedStates = levels.front().size();
+    while (!levels.back().empty()) {
+        std::vector<uint64_t> nextLevel;
+        for (auto state : levels.back()) {
+            for (auto predecessor : eliminatedPredecessors[state]) {
+                if (--numberOfUnresolvedSuccessors[predecessor] == 0) {
+                    nextLevel.push_back(predecessor);
+                }
+            }
+        }
+        numberOfSortedStates += nextLevel.size();
+        levels.push_back(std::move(nextLevel));
+    }
+    levels.pop_back();
+    if (numberOfSortedStates != eliminatedStates.getNumberOfSetBits()) {
+        return nullptr;
+    }
+    eliminatedPredecessors.clear();
+    eliminatedPredecessors.shrink_to_fit();
+
+    // Replaces the eliminated states in the given row by their distributions. The entries refer to the indices of the kept states.
+    storm::storage::BitVector keepStates = ~eliminatedStates;
+    std::vector<uint_fast64_t> newStateIndices = keepStates.getNumberOfSetBitsBeforeIndices();
+    std::vector<std::vector<EntryType>> distributions(numberOfStates);
+    auto resolveRow = [&](typename storm::storage::SparseMatrix<ValueType>::const_rows const& row, std::vector<EntryType>& result) {
+        for (auto const& entry : row) {
+            if (eliminatedStates.get(entry.getColumn())) {
+                for (auto const& distributionEntry : distributions[entry.getColumn()]) {
+                    result.emplace_back(distributionEntry.getColumn(), entry.getValue() * distributionEntry.getValue());
+                }
+            } else {
+                result.emplace_back(newStateIndices[entry.getColumn()], entry.getValue());
+            }
+        }
+        std::sort(result.begin(), result.end(), [](EntryType const& first, EntryType const& second) { return first.getColumn() < second.getColumn(); });
+        // Merge entries with the same column
+        if (result.empty()) {
+            return;
+        }
+        auto lastIt = result.begin();
+        for (auto entryIt = result.begin() + 1; entryIt != result.end(); ++entryIt) {
+            if (entryIt->getColumn() == lastIt->getColumn()) {
+                lastIt->setValue(lastIt->getValue() + entryIt->getValue());
+            } else {
+                *(++lastIt) = std::move(*entryIt);
+            }
+        }
+        result.erase(lastIt + 1, result.end());
+    };
+
+    bool const threadSafe = !std::is_same<ValueType, storm::RationalFunction>::value;
+    for (auto const& level : levels) {
+        storm::utility::parallel::forEachChunk(getNumberOfEliminationThreads(threadSafe, level.size()), static_cast<uint64_t>(0), level.size(),
+                                               [&](uint64_t, uint64_t begin, uint64_t end) {
+                                                   for (uint64_t index = begin; index < end; ++index) {
+                                                       resolveRow(transitionMatrix.getRowGroup(level[index]), distributions[level[index]]);
+                                                   }
+                                               });
+    }
+
+    // Assemble the rows of the kept states
+    storm::storage::BitVector keptRows = transitionMatrix.getRowFilter(keepStates);
+    std::vector<uint64_t> oldRowIndices(keptRows.begin(), keptRows.end());
+    std::vector<IndexType> rowGroupIndices(1, 0);
+    for (auto state : keepStates) {
+        rowGroupIndices.push_back(rowGroupIndices.back() + transitionMatrix.getRowGroupSize(state));
+    }
+    std::vector<std::vector<EntryType>> rows(oldRowIndices.size());
+    storm::utility::parallel::forEachChunk(getNumberOfEliminationThreads(threadSafe, rows.size()), static_cast<uint64_t>(0), rows.size(),
+                                           [&](uint64_t, uint64_t begin, uint64_t end) {
+                                               for (uint64_t row = begin; row < end; ++row) {
+                                                   resolveRow(transitionMatrix.getRow(oldRowIndices[row]), rows[row]);
+                                               }
+                                           });
+    distributions.clear();
+    std::vector<IndexType> rowIndications(rows.size() + 1, 0);
+    for (uint64_t row = 0; row < rows.size(); ++row) {
+        rowIndications[row + 1] = rowIndications[row] + rows[row].size();
+    }
+    std::vector<EntryType> columnsAndValues;
+    columnsAndValues.reserve(rowIndications.back());
+    for (auto& row : rows) {
+        std::move(row.begin(), row.end(), std::back_inserter(columnsAndValues));
+        std::vector<EntryType>().swap(row);
+    }
+    storm::storage::SparseMatrix<ValueType> matrix(keepStates.getNumberOfSetBits(), std::move(rowIndications), std::move(columnsAndValues),
+                                                   std::move(rowGroupIndices));
+
+    // Propagate the labels of eliminated states to their successors, starting with the states on the highest level.
+    storm::models::sparse::StateLabeling stateLabeling = ma.getStateLabeling();
+    std::vector<std::string> propagatedLabels;
+    if (labelBehavior == EliminationLabelBehavior::MergeLabels) {
+        for (std::string const& label : stateLabeling.getLabels()) {
+            propagatedLabels.push_back(label);
+        }
+    } else if (labelBehavior == EliminationLabelBehavior::DeleteLabels && stateLabeling.containsLabel("init")) {
+        // Do not add labels from eliminated state, only exception is label for initial states
+        propagatedLabels.push_back("init");
+    }
+    for (std::string const& label : propagatedLabels) {
+        storm::storage::BitVector states = stateLabeling.getStates(label);
+        for (auto levelIt = levels.rbegin(); levelIt != levels.rend(); ++levelIt) {
+            for (auto state : *levelIt) {
+                if (states.get(state)) {
+                    for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+                        states.set(entry.getColumn());
+                    }
+                }
+            }
+        }
+        stateLabeling.setStates(label, std::move(states));
+    }
+
+    return buildEliminatedModel(ma, std::move(matrix), stateLabeling, keepStates);
+}
+
+}  // namespace
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<models::sparse::Model<ValueType, RewardModelType>> NonMarkovianChainTransformer<ValueType, RewardModelType>::eliminateNonmarkovianStates(
     std::shared_ptr<models::sparse::MarkovAutomaton<ValueType, RewardModelType>> ma, EliminationLabelBehavior labelBehavior) {
@@ -31,17 +246,25 @@ std::shared_ptr<models::sparse::Model<ValueType, RewardModelType>> NonMarkovianC
 
     STORM_LOG_WARN_COND(labelBehavior == EliminationLabelBehavior::KeepLabels || labelBehavior == EliminationLabelBehavior::ExtendLabels,
                         "Labels are not preserved! Results may be incorrect. Continue at your own caution.");
+    STORM_LOG_WARN_COND(ma->getRewardModels().empty(), "Reward models are not preserved in chain elimination.");
+    STORM_LOG_WARN_COND(!ma->hasChoiceLabeling(), "Choice labels are not preserved in chain elimination.");
+    STORM_LOG_WARN_COND(!ma->hasStateValuations(), "State valuations are not preserved in chain elimination.");
+    STORM_LOG_WARN_COND(!ma->hasChoiceOrigins(), "Choice origins are not preserved in chain elimination.");
+
+    // For ExtendLabels, whether a state is eliminated depends on the states that have been eliminated before.
+    if (labelBehavior != EliminationLabelBehavior::ExtendLabels) {
+        if (auto model = eliminateAcyclicNonmarkovianStates(*ma, labelBehavior)) {
+            return model;
+        }
+        STORM_LOG_DEBUG("Probabilistic states induce cycles, falling back to state elimination.");
+    }
 
     // Initialize
     storm::storage::FlexibleSparseMatrix<ValueType> flexibleMatrix(ma->getTransitionMatrix());
     storm::storage::FlexibleSparseMatrix<ValueType> flexibleBackwardTransitions(ma->getTransitionMatrix().transpose(), true);
     storm::models::sparse::StateLabeling stateLabeling = ma->getStateLabeling();
     // TODO: update reward models and choice labels according to kept states
-    STORM_LOG_WARN_COND(ma->getRewardModels().empty(), "Reward models are not preserved in chain elimination.");
     std::unordered_map<std::string, RewardModelType> rewardModels;
-    STORM_LOG_WARN_COND(!ma->hasChoiceLabeling(), "Choice labels are not preserved in chain elimination.");
-    STORM_LOG_WARN_COND(!ma->hasStateValuations(), "State valuations are not preserved in chain elimination.");
-    STORM_LOG_WARN_COND(!ma->hasChoiceOrigins(), "Choice origins are not preserved in chain elimination.");
 
     // Eliminate all probabilistic states by state elimination
     auto actionRewards = std::vector<ValueType>(ma->getTransitionMatrix().getRowCount(), storm::utility::zero<ValueType>());
@@ -138,23 +361,7 @@ std::shared_ptr<models::sparse::Model<ValueType, RewardModelType>> NonMarkovianC
     auto keptRows = ma->getTransitionMatrix().getRowFilter(keepStates);
     storm::storage::SparseMatrix<ValueType> matrix = flexibleMatrix.createSparseMatrix(keptRows, keepStates);
 
-    // TODO: obtain the reward model for the resulting system
-
-    // Prepare model components
-    storm::storage::BitVector markovianStates = ma->getMarkovianStates() % keepStates;
-    storm::models::sparse::StateLabeling labeling = stateLabeling.getSubLabeling(keepStates);
-    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(matrix, labeling, ma->getRewardModels(), false, markovianStates);
-    std::vector<ValueType> exitRates(markovianStates.size());
-    storm::utility::vector::selectVectorValues(exitRates, keepStates, ma->getExitRates());
-    components.exitRates = exitRates;
-
-    // Build transformed model
-    auto model = std::make_shared<storm::models::sparse::MarkovAutomaton<ValueType, RewardModelType>>(std::move(components));
-    if (model->isConvertibleToCtmc()) {
-        return model->convertToCtmc();
-    } else {
-        return model;
-    }
+    return buildEliminatedModel(*ma, std::move(matrix), stateLabeling, keepStates);
 }
 
 template<typename ValueType, typename RewardModelType>
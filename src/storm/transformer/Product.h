@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <unordered_map>
 
 namespace storm {
 namespace transformer {
@@ -11,13 +12,15 @@ class Product {
 
     typedef storm::storage::sparse::state_type state_type;
     typedef std::pair<state_type, state_type> product_state_type;
-    typedef std::map<product_state_type, state_type> product_state_to_product_index_map;
+    // Maps the flat index modelState * numberOfAutomatonStates + automatonState of a product state to its index in the product model
+    typedef std::unordered_map<state_type, state_type> product_state_to_product_index_map;
     typedef std::vector<product_state_type> product_index_to_product_state_vector;
 
-    Product(Model&& productModel, std::string&& productStateOfInterestLabel, product_state_to_product_index_map&& productStateToProductIndex,
-            product_index_to_product_state_vector&& productIndexToProductState)
+    Product(Model&& productModel, std::string&& productStateOfInterestLabel, state_type numberOfAutomatonStates,
+            product_state_to_product_index_map&& productStateToProductIndex, product_index_to_product_state_vector&& productIndexToProductState)
         : productModel(productModel),
           productStateOfInterestLabel(productStateOfInterestLabel),
+          numberOfAutomatonStates(numberOfAutomatonStates),
           productStateToProductIndex(productStateToProductIndex),
           productIndexToProductState(productIndexToProductState) {}
 
@@ -37,11 +40,11 @@ class Product {
     }
 
     state_type getProductStateIndex(state_type modelState, state_type automatonState) const {
-        return productStateToProductIndex.at(product_state_type(modelState, automatonState));
+        return productStateToProductIndex.at(modelState * numberOfAutomatonStates + automatonState);
     }
 
     bool isValidProductState(state_type modelState, state_type automatonState) const {
-        return (productStateToProductIndex.count(product_state_type(modelState, automatonState)) > 0);
+        return automatonState < numberOfAutomatonStates && productStateToProductIndex.count(modelState * numberOfAutomatonStates + automatonState) > 0;
     }
 
     storm::storage::BitVector liftFromAutomaton(const storm::storage::BitVector& vector) const {
@@ -95,6 +98,7 @@ class Product {
    private:
     Model productModel;
     std::string productStateOfInterestLabel;
+    state_type numberOfAutomatonStates;
     product_state_to_product_index_map productStateToProductIndex;
     product_index_to_product_state_vector productIndexToProductState;
 };
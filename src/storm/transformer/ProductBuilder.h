@@ -5,7 +5,7 @@
 #include "storm/storage/SparseMatrix.h"
 
 #include <deque>
-#include <map>
+#include <unordered_map>
 #include <vector>
 
 namespace storm {
@@ -25,7 +25,9 @@ class ProductBuilder {
         typedef std::pair<state_type, state_type> product_state_type;
 
         state_type nextState = 0;
-        std::map<product_state_type, state_type> productStateToProductIndex;
+        // Product states are identified by the flat index modelState * numberOfAutomatonStates + automatonState
+        state_type const numberOfAutomatonStates = prodOp.getNumberOfAutomatonStates();
+        std::unordered_map<state_type, state_type> productStateToProductIndex;
         std::vector<product_state_type> productIndexToProductState;
         std::vector<state_type> prodInitial;
 
@@ -41,7 +43,7 @@ class ProductBuilder {
 
             product_state_type s_q(s_0, q_0);
             state_type index = nextState++;
-            productStateToProductIndex[s_q] = index;
+            productStateToProductIndex[s_0 * numberOfAutomatonStates + q_0] = index;
             productIndexToProductState.push_back(s_q);
             prodInitial.push_back(index);
             todo.push_back(index);
@@ -62,16 +64,13 @@ class ProductBuilder {
                     state_type p = prodOp.getSuccessor(from.second, t);
                     // std::cout << " p = " << p << "\n";
                     product_state_type t_p(t, p);
-                    state_type prodIndexTo;
-                    auto it = productStateToProductIndex.find(t_p);
-                    if (it == productStateToProductIndex.end()) {
-                        prodIndexTo = nextState++;
+                    auto insertionResult = productStateToProductIndex.try_emplace(t * numberOfAutomatonStates + p, nextState);
+                    state_type prodIndexTo = insertionResult.first->second;
+                    if (insertionResult.second) {
+                        ++nextState;
                         todo.push_back(prodIndexTo);
                         productIndexToProductState.push_back(t_p);
-                        productStateToProductIndex[t_p] = prodIndexTo;
                         // std::cout << " Adding " << t_p.first << "," << t_p.second << " as " << prodIndexTo << "\n";
-                    } else {
-                        prodIndexTo = it->second;
                     }
                     // std::cout << " " << t_p.first << "," << t_p.second << ": to = " << prodIndexTo << "\n";
 
@@ -88,16 +87,13 @@ class ProductBuilder {
                         state_type p = prodOp.getSuccessor(from.second, t);
                         // std::cout << " p = " << p << "\n";
                         product_state_type t_p(t, p);
-                        state_type prodIndexTo;
-                        auto it = productStateToProductIndex.find(t_p);
-                        if (it == productStateToProductIndex.end()) {
-                            prodIndexTo = nextState++;
+                        auto insertionResult = productStateToProductIndex.try_emplace(t * numberOfAutomatonStates + p, nextState);
+                        state_type prodIndexTo = insertionResult.first->second;
+                        if (insertionResult.second) {
+                            ++nextState;
                             todo.push_back(prodIndexTo);
                             productIndexToProductState.push_back(t_p);
-                            productStateToProductIndex[t_p] = prodIndexTo;
                             // std::cout << " Adding " << t_p.first << "," << t_p.second << " as " << prodIndexTo << "\n";
-                        } else {
-                            prodIndexTo = it->second;
                         }
                         // std::cout << " " << t_p.first << "," << t_p.second << ": to = " << prodIndexTo << "\n";
 
@@ -122,7 +118,8 @@ class ProductBuilder {
         // for (originalLabels.)
 
         return typename Product<Model>::ptr(
-            new Product<Model>(std::move(product), std::move(prodSoiLabel), std::move(productStateToProductIndex), std::move(productIndexToProductState)));
+            new Product<Model>(std::move(product), std::move(prodSoiLabel), numberOfAutomatonStates, std::move(productStateToProductIndex),
+                               std::move(productIndexToProductState)));
     }
 };
 }  // namespace transformer
@@ -1,6 +1,7 @@
 #include "storm/transformer/SubsystemBuilder.h"
 
 #include <boost/optional.hpp>
+#include <numeric>
 #include <storm/exceptions/UnexpectedException.h>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -10,11 +11,14 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -43,9 +47,115 @@ void transformModelSpecificComponents(storm::models::sparse::Model<ValueType, Re
     // Nothing to be done if the model has deadlock States
 }
 
+// The index maps of a subsystem. They are computed once and shared by the transformations of the transition matrix and the transition reward matrices.
+struct SubsystemIndexMaps {
+    // Gives for each state of the original model its index in the subsystem (or std::numeric_limits<uint64_t>::max() if it is not part of the subsystem)
+    std::vector<uint64_t> oldToNewStateIndexMapping;
+    // The row group indices of the subsystem
+    std::vector<uint64_t> newRowGroupIndices;
+    // Gives for each row of the subsystem the corresponding row of the original model
+    std::vector<uint64_t> newToOldRowIndexMapping;
+    // Marks the rows of the original model that are kept to fix a deadlock
+    storm::storage::BitVector deadlockRows;
+};
+
+SubsystemIndexMaps computeSubsystemIndexMaps(std::vector<uint64_t> const& groupIndices, storm::storage::BitVector const& subsystemStates,
+                                             storm::storage::BitVector const& keptActions, storm::storage::BitVector const& deadlockStates) {
+    SubsystemIndexMaps maps;
+    maps.oldToNewStateIndexMapping.assign(subsystemStates.size(), std::numeric_limits<uint64_t>::max());
+    maps.newRowGroupIndices.reserve(subsystemStates.getNumberOfSetBits() + 1);
+    maps.newToOldRowIndexMapping.reserve(keptActions.getNumberOfSetBits());
+    maps.deadlockRows = storm::storage::BitVector(keptActions.size(), false);
+    maps.newRowGroupIndices.push_back(0);
+    uint64_t newState = 0;
+    for (auto state : subsystemStates) {
+        maps.oldToNewStateIndexMapping[state] = newState++;
+        for (uint64_t row = keptActions.getNextSetIndex(groupIndices[state]); row < groupIndices[state + 1]; row = keptActions.getNextSetIndex(row + 1)) {
+            maps.newToOldRowIndexMapping.push_back(row);
+        }
+        maps.newRowGroupIndices.push_back(maps.newToOldRowIndexMapping.size());
+    }
+    for (auto deadlockState : deadlockStates) {
+        maps.deadlockRows.set(groupIndices[deadlockState], true);
+    }
+    return maps;
+}
+
+uint64_t getNumberOfSubsystemThreads(bool threadSafeValueType, uint64_t numberOfRows) {
+    // Copying the entries of matrices with rational functions is not thread-safe.
+    if (!threadSafeValueType || !storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+        return 1;
+    }
+    return std::min<uint64_t>(storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads(),
+                              std::max<uint64_t>(1, numberOfRows / 50000));
+}
+
+/*
+ * Restricts the given matrix to the subsystem described by the given index maps. Entries leading outside of the subsystem are dropped.
+ * The rows that are kept to fix deadlocks either get a selfloop (with value one) or no entries at all.
+ * The entry counts and the entries of the rows are computed in parallel and directly yield the data of the resulting matrix, i.e., no builder is involved.
+ */
+template<typename MatrixValueType>
+storm::storage::SparseMatrix<MatrixValueType> transformMatrix(storm::storage::SparseMatrix<MatrixValueType> const& matrix, SubsystemIndexMaps const& maps,
+                                                              bool selfloopsAtDeadlocks, bool makeRowGroupingTrivial) {
+    typedef typename storm::storage::SparseMatrix<MatrixValueType>::index_type IndexType;
+    uint64_t const stateCount = maps.newRowGroupIndices.size() - 1;
+    uint64_t const rowCount = maps.newToOldRowIndexMapping.size();
+    uint64_t const numberOfThreads = getNumberOfSubsystemThreads(!std::is_same<MatrixValueType, storm::RationalFunction>::value, rowCount);
+
+    std::vector<IndexType> rowIndications(rowCount + 1, 0);
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), rowCount, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t newRow = begin; newRow < end; ++newRow) {
+            uint64_t oldRow = maps.newToOldRowIndexMapping[newRow];
+            IndexType entryCount = 0;
+            if (maps.deadlockRows.get(oldRow)) {
+                entryCount = selfloopsAtDeadlocks ? 1 : 0;
+            } else {
+                for (auto const& entry : matrix.getRow(oldRow)) {
+                    if (maps.oldToNewStateIndexMapping[entry.getColumn()] != std::numeric_limits<uint64_t>::max()) {
+                        ++entryCount;
+                    }
+                }
+            }
+            rowIndications[newRow + 1] = entryCount;
+        }
+    });
+    std::partial_sum(rowIndications.begin(), rowIndications.end(), rowIndications.begin());
+
+    std::vector<storm::storage::MatrixEntry<IndexType, MatrixValueType>> columnsAndValues(rowIndications.back());
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), stateCount, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t newState = begin; newState < end; ++newState) {
+            for (uint64_t newRow = maps.newRowGroupIndices[newState]; newRow < maps.newRowGroupIndices[newState + 1]; ++newRow) {
+                uint64_t oldRow = maps.newToOldRowIndexMapping[newRow];
+                auto entryIt = columnsAndValues.begin() + rowIndications[newRow];
+                if (maps.deadlockRows.get(oldRow)) {
+                    if (selfloopsAtDeadlocks) {
+                        *entryIt = storm::storage::MatrixEntry<IndexType, MatrixValueType>(newState, storm::utility::one<MatrixValueType>());
+                    }
+                    continue;
+                }
+                for (auto const& entry : matrix.getRow(oldRow)) {
+                    uint64_t newColumn = maps.oldToNewStateIndexMapping[entry.getColumn()];
+                    if (newColumn != std::numeric_limits<uint64_t>::max()) {
+                        *entryIt = storm::storage::MatrixEntry<IndexType, MatrixValueType>(newColumn, entry.getValue());
+                        ++entryIt;
+                    }
+                }
+            }
+        }
+    });
+
+    boost::optional<std::vector<IndexType>> rowGroupIndices;
+    if (!makeRowGroupingTrivial && !matrix.hasTrivialRowGrouping()) {
+        rowGroupIndices = std::vector<IndexType>(maps.newRowGroupIndices.begin(), maps.newRowGroupIndices.end());
+    }
+    STORM_LOG_ASSERT(!makeRowGroupingTrivial || rowCount == stateCount, "Matrix should be square");
+    return storm::storage::SparseMatrix<MatrixValueType>(stateCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+}
+
 template<typename RewardModelType>
 RewardModelType transformRewardModel(RewardModelType const& originalRewardModel, storm::storage::BitVector const& subsystem,
-                                     storm::storage::BitVector const& subsystemActions, bool makeRowGroupingTrivial) {
+                                     storm::storage::BitVector const& subsystemActions, SubsystemIndexMaps const& maps, bool makeRowGroupingTrivial) {
     std::optional<std::vector<typename RewardModelType::ValueType>> stateRewardVector;
     std::optional<std::vector<typename RewardModelType::ValueType>> stateActionRewardVector;
     std::optional<storm::storage::SparseMatrix<typename RewardModelType::ValueType>> transitionRewardMatrix;
@@ -56,11 +166,8 @@ RewardModelType transformRewardModel(RewardModelType const& originalRewardModel,
         stateActionRewardVector = storm::utility::vector::filterVector(originalRewardModel.getStateActionRewardVector(), subsystemActions);
     }
     if (originalRewardModel.hasTransitionRewards()) {
-        transitionRewardMatrix = originalRewardModel.getTransitionRewardMatrix().getSubmatrix(false, subsystemActions, subsystem);
-        if (makeRowGroupingTrivial) {
-            STORM_LOG_ASSERT(transitionRewardMatrix.value().getColumnCount() == transitionRewardMatrix.value().getRowCount(), "Matrix should be square");
-            transitionRewardMatrix.value().makeRowGroupingTrivial();
-        }
+        // Rewards of deadlock choices are cleared anyway, so we do not need to copy them.
+        transitionRewardMatrix = transformMatrix(originalRewardModel.getTransitionRewardMatrix(), maps, false, makeRowGroupingTrivial);
     }
     return RewardModelType(std::move(stateRewardVector), std::move(stateActionRewardVector), std::move(transitionRewardMatrix));
 }
@@ -129,26 +236,16 @@ SubsystemBuilderReturnType<ValueType, RewardModelType> internalBuildSubsystem(st
         keptActions.set(groupIndices[deadlockState], true);
     }
 
-    // Transform the components of the model
+    // Transform the components of the model. The index maps are computed once and used for the transition matrix and all transition reward matrices.
+    // The choices of deadlock states become selfloops.
+    SubsystemIndexMaps maps = computeSubsystemIndexMaps(groupIndices, subsystemStates, keptActions, deadlockStates);
     storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components;
-    if (hasDeadlockStates) {
-        // make deadlock choices a selfloop
-        components.transitionMatrix = originalModel.getTransitionMatrix();
-        components.transitionMatrix.makeRowGroupsAbsorbing(deadlockStates);
-        components.transitionMatrix.dropZeroEntries();
-        components.transitionMatrix = components.transitionMatrix.getSubmatrix(false, keptActions, subsystemStates);
-    } else {
-        components.transitionMatrix = originalModel.getTransitionMatrix().getSubmatrix(false, keptActions, subsystemStates);
-    }
-    if (options.makeRowGroupingTrivial) {
-        STORM_LOG_ASSERT(components.transitionMatrix.getColumnCount() == components.transitionMatrix.getRowCount(), "Matrix should be square");
-        components.transitionMatrix.makeRowGroupingTrivial();
-    }
+    components.transitionMatrix = transformMatrix(originalModel.getTransitionMatrix(), maps, true, options.makeRowGroupingTrivial);
 
     components.stateLabeling = originalModel.getStateLabeling().getSubLabeling(subsystemStates);
     for (auto const& rewardModel : originalModel.getRewardModels()) {
         components.rewardModels.insert(
-            std::make_pair(rewardModel.first, transformRewardModel(rewardModel.second, subsystemStates, keptActions, options.makeRowGroupingTrivial)));
+            std::make_pair(rewardModel.first, transformRewardModel(rewardModel.second, subsystemStates, keptActions, maps, options.makeRowGroupingTrivial)));
     }
     if (originalModel.hasChoiceLabeling()) {
         components.choiceLabeling = originalModel.getChoiceLabeling().getSubLabeling(keptActions);
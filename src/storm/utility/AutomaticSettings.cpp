@@ -1,5 +1,6 @@
 #include "storm/utility/AutomaticSettings.h"
 
+#include <limits>
 #include <sstream>
 
 #include "storm/logic/Formula.h"
@@ -224,6 +225,62 @@ void AutomaticSettings::predict(storm::jani::Model const& model, storm::jani::Pr
     predict(model, property);
 }
 
+namespace pfinternal {
+/*!
+ * Roughly estimates the peak number of bytes that is used when building and checking the given model with the given engine.
+ * For the sparse engine, this includes the state storage and the temporary copy of the matrix in the matrix builder. For the hybrid engine, the transitions
+ * of the model are stored symbolically, but the matrix of the (maybe) states is converted to a sparse matrix for solving. In both cases, the solvers
+ * store a copy of the matrix with 32 bit columns (see ValueIterationOperator) as well as a few vectors over the choices and states.
+ */
+double estimateMemory(storm::utility::Engine engine, storm::builder::ModelSizeEstimate const& estimate, bool exact) {
+    double const states = static_cast<double>(estimate.numberOfStates);
+    double const choices = static_cast<double>(estimate.numberOfChoices);
+    double const transitions = static_cast<double>(estimate.numberOfTransitions);
+    // Exact values have a dynamically allocated numerator and denominator.
+    double const valueBytes = exact ? 48.0 : 8.0;
+    double const matrixBytes = transitions * (8.0 + valueBytes) + choices * 8.0 + states * 8.0;
+    double const solverBytes = transitions * (4.0 + valueBytes) + choices * 2.0 * valueBytes + states * 4.0 * valueBytes;
+    if (engine == storm::utility::Engine::Hybrid) {
+        return matrixBytes + solverBytes;
+    }
+    // Buckets of 64 bits per state with a load factor of 0.75, plus the 32 bit index of each state.
+    double const stateStorageBytes = states * ((static_cast<double>((estimate.bitsPerState + 63) / 64) * 8.0 + 4.0) / 0.75);
+    return stateStorageBytes + 2.0 * matrixBytes + solverBytes;
+}
+}  // namespace pfinternal
+
+void AutomaticSettings::restrictToMemory(storm::builder::ModelSizeEstimate const& estimate, uint64_t availableMemory) {
+    STORM_LOG_THROW(engine != storm::utility::Engine::Unknown, storm::exceptions::InvalidOperationException,
+                    "Tried to restrict the engine to the available memory but apparently no prediction was done before.");
+    if (engine != storm::utility::Engine::Sparse && engine != storm::utility::Engine::Hybrid) {
+        // The remaining engines either work symbolically or only build the (bisimulation) quotient explicitly.
+        return;
+    }
+
+    // Leave some memory for everything that is not accounted for.
+    double const memoryBudget = 0.8 * static_cast<double>(availableMemory);
+    bool const tooManyStates = estimate.numberOfStates >= static_cast<uint64_t>(std::numeric_limits<uint32_t>::max());
+    double const sparseMemory = pfinternal::estimateMemory(storm::utility::Engine::Sparse, estimate, useExact);
+    double const hybridMemory = pfinternal::estimateMemory(storm::utility::Engine::Hybrid, estimate, useExact);
+    STORM_LOG_INFO("Estimated memory consumption: sparse=" << static_cast<uint64_t>(sparseMemory) << " bytes, hybrid=" << static_cast<uint64_t>(hybridMemory)
+                                                           << " bytes, available=" << availableMemory << " bytes.");
+
+    storm::utility::Engine newEngine = engine;
+    if (engine == storm::utility::Engine::Sparse && (tooManyStates || sparseMemory > memoryBudget)) {
+        newEngine = storm::utility::Engine::Hybrid;
+    }
+    if (newEngine == storm::utility::Engine::Hybrid && hybridMemory > memoryBudget) {
+        newEngine = storm::utility::Engine::Dd;
+    }
+    if (newEngine != engine) {
+        STORM_LOG_WARN("Automatic engine switches from " << engine << " to " << newEngine << " engine as the model (approx. " << estimate.numberOfStates
+                                                         << " states, " << estimate.numberOfTransitions << " transitions) is not expected to fit into "
+                                                         << availableMemory / (1024 * 1024) << "MB of available memory"
+                                                         << (tooManyStates ? " or has too many states for the explicit model builder." : "."));
+        engine = newEngine;
+    }
+}
+
 storm::utility::Engine AutomaticSettings::getEngine() const {
     STORM_LOG_THROW(engine != storm::utility::Engine::Unknown, storm::exceptions::InvalidOperationException,
                     "Tried to get the engine but apparently no prediction was done before.");
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "storm/builder/ModelSizeEstimation.h"
 #include "storm/utility/Engine.h"
 
 namespace storm {
@@ -25,6 +26,15 @@ class AutomaticSettings {
      */
     void predict(storm::jani::Model const& model, storm::jani::Property const& property, uint64_t stateEstimate);
 
+    /*!
+     * Switches to a symbolic engine if the estimated memory consumption of the predicted engine exceeds the available memory. The explicit model
+     * builder indexes states with 32 bits, so the sparse engine is also avoided for models with at least 2^32 states. Must be called after predict.
+     *
+     * @param estimate The estimated size of the model.
+     * @param availableMemory The number of bytes that are available.
+     */
+    void restrictToMemory(storm::builder::ModelSizeEstimate const& estimate, uint64_t availableMemory);
+
     /// Retrieve "good" settings after calling predict.
     storm::utility::Engine getEngine() const;
     bool enableBisimulation() const;
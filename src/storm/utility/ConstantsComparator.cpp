@@ -1,6 +1,7 @@
 #include "storm/utility/ConstantsComparator.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/SmallRationalNumber.h"
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -109,6 +110,7 @@ template class ConstantsComparator<GmpRationalNumber>;
 template class ConstantsComparator<RationalFunction>;
 template class ConstantsComparator<Polynomial>;
 template class ConstantsComparator<Interval>;
+template class ConstantsComparator<SmallRationalNumber>;
 #endif
 }  // namespace utility
 }  // namespace storm
@@ -36,6 +36,7 @@ enum class Engine {
     DdSparse,
     Exploration,
     AbstractionRefinement,
+    Simulation,
     Automatic,
     Unknown
 };
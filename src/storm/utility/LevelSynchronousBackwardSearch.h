@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace utility {
+namespace graph {
+
+/*!
+ * A breadth-first search that proceeds backwards from a set of target states, one level at a time. The states of a level are only added to the set of
+ * reached states once the level is complete, which makes the levels independent of the order in which the states are processed. This allows to expand
+ * large levels with multiple threads and to bound the number of levels.
+ *
+ * A level is either expanded top-down, i.e., by inspecting the predecessors of the states found in the previous level, or bottom-up, i.e., by checking
+ * all remaining candidate states. The latter is only possible if the condition under which a candidate is added already implies that it has a successor
+ * among the reached states. It pays off if the previous level is large compared to the remaining candidates, as every candidate is then checked only
+ * once instead of once per predecessor relation. If allowed, the search switches between both directions depending on the sizes of the levels.
+ */
+template<typename ValueType>
+class LevelSynchronousBackwardSearch {
+   public:
+    /*!
+     * Creates a search on the given backward transitions.
+     *
+     * @param backwardTransitions The backward transitions of the model, i.e., row i contains the predecessors of state i.
+     * @param numberOfThreads The maximal number of threads with which a level is expanded.
+     */
+    LevelSynchronousBackwardSearch(storm::storage::SparseMatrix<ValueType> const& backwardTransitions, uint64_t numberOfThreads = 1)
+        : backwardTransitions(backwardTransitions), numberOfThreads(std::max<uint64_t>(1, numberOfThreads)) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Performs the search. The target states form the first level. A candidate state belongs to the next level if it is not yet reached, it is a
+     * predecessor of a state of the current level and the condition holds for it with respect to the states reached so far.
+     *
+     * @param candidateStates The states that may be added by the search.
+     * @param targetStates The states from which the search starts.
+     * @param condition The condition under which a candidate is added. It is invoked as condition(state, reachedStates), must be monotone in the reached
+     * states and may only depend on the reached successors of the state. As it is invoked concurrently if multiple threads are used, it must not modify
+     * any shared state.
+     * @param allowBottomUp If set, the condition must imply that the state has a successor among the reached states. This allows bottom-up levels.
+     * @param maximalNumberOfLevels If given, at most this number of levels is added to the target states.
+     * @return The target states and all candidate states that were reached.
+     */
+    template<typename Condition>
+    storm::storage::BitVector search(storm::storage::BitVector const& candidateStates, storm::storage::BitVector const& targetStates,
+                                     Condition const& condition, bool allowBottomUp,
+                                     std::optional<uint64_t> const& maximalNumberOfLevels = std::nullopt) const {
+        uint64_t const numberOfStates = targetStates.size();
+        storm::storage::BitVector reachedStates(targetStates);
+        storm::storage::BitVector remainingCandidates = candidateStates & ~targetStates;
+        uint64_t numberOfRemainingCandidates = remainingCandidates.getNumberOfSetBits();
+
+        std::vector<uint64_t> currentLevel(targetStates.begin(), targetStates.end());
+        std::vector<uint64_t> nextLevel;
+        std::vector<std::vector<uint64_t>> localStates(numberOfThreads);
+        std::vector<storm::storage::BitVector> localMarks(numberOfThreads);
+        bool bottomUp = false;
+        for (uint64_t level = 0; !currentLevel.empty() && numberOfRemainingCandidates > 0 && (!maximalNumberOfLevels || level < *maximalNumberOfLevels);
+             ++level) {
+            if (allowBottomUp) {
+                if (currentLevel.size() * BottomUpToTopDownFactor < numberOfStates) {
+                    bottomUp = false;
+                } else if (!bottomUp && currentLevel.size() * TopDownToBottomUpFactor > numberOfRemainingCandidates) {
+                    bottomUp = true;
+                }
+            }
+
+            uint64_t numberOfChunks;
+            if (bottomUp) {
+                // Check every remaining candidate. The chunks are aligned with the buckets of the bit vectors.
+                uint64_t const numberOfBuckets = (numberOfStates + 63) / 64;
+                uint64_t const threads = numberOfRemainingCandidates >= MinimalWorkForParallelLevel ? numberOfThreads : 1;
+                numberOfChunks = storm::utility::parallel::forEachChunk(
+                    threads, static_cast<uint64_t>(0), numberOfBuckets, [&](uint64_t threadIndex, uint64_t firstBucket, uint64_t endBucket) {
+                        auto& states = localStates[threadIndex];
+                        uint64_t const endState = std::min(endBucket * 64, numberOfStates);
+                        for (uint64_t state = remainingCandidates.getNextSetIndex(firstBucket * 64); state < endState;
+                             state = remainingCandidates.getNextSetIndex(state + 1)) {
+                            if (condition(state, reachedStates)) {
+                                states.push_back(state);
+                            }
+                        }
+                    });
+            } else {
+                // Inspect the predecessors of the states of the current level. Every thread marks the states it found to avoid duplicates.
+                uint64_t const threads = currentLevel.size() >= MinimalWorkForParallelLevel ? numberOfThreads : 1;
+                numberOfChunks = storm::utility::parallel::forEachChunk(
+                    threads, static_cast<uint64_t>(0), static_cast<uint64_t>(currentLevel.size()), [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+                        auto& states = localStates[threadIndex];
+                        auto& marks = localMarks[threadIndex];
+                        if (marks.size() != numberOfStates) {
+                            marks.resize(numberOfStates);
+                        }
+                        for (uint64_t index = begin; index < end; ++index) {
+                            for (auto const& entry : backwardTransitions.getRow(currentLevel[index])) {
+                                uint64_t const predecessor = entry.getColumn();
+                                if (remainingCandidates.get(predecessor) && !marks.get(predecessor) && condition(predecessor, reachedStates)) {
+                                    marks.set(predecessor);
+                                    states.push_back(predecessor);
+                                }
+                            }
+                        }
+                    });
+            }
+
+            // Complete the level by merging the states found by the threads.
+            for (uint64_t threadIndex = 0; threadIndex < numberOfChunks; ++threadIndex) {
+                for (auto state : localStates[threadIndex]) {
+                    if (!bottomUp) {
+                        localMarks[threadIndex].set(state, false);
+                    }
+                    if (remainingCandidates.get(state)) {
+                        remainingCandidates.set(state, false);
+                        reachedStates.set(state);
+                        nextLevel.push_back(state);
+                    }
+                }
+                localStates[threadIndex].clear();
+            }
+            numberOfRemainingCandidates -= nextLevel.size();
+            std::swap(currentLevel, nextLevel);
+            nextLevel.clear();
+        }
+        return reachedStates;
+    }
+
+   private:
+    // The search switches to bottom-up levels once the current level has more than 1/TopDownToBottomUpFactor times as many states as there are
+    // remaining candidates and back to top-down levels once the current level has less than 1/BottomUpToTopDownFactor times as many states as the model.
+    static const uint64_t TopDownToBottomUpFactor = 14;
+    static const uint64_t BottomUpToTopDownFactor = 24;
+
+    // The number of states to process in a level below which the level is expanded sequentially.
+    static const uint64_t MinimalWorkForParallelLevel = 4096;
+
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions;
+    uint64_t numberOfThreads;
+};
+
+}  // namespace graph
+}  // namespace utility
+}  // namespace storm
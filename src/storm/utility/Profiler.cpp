@@ -0,0 +1,212 @@
+#include "storm/utility/Profiler.h"
+
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+#include "storm/io/file.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+namespace {
+uint64_t const droppedPhaseIndex = std::numeric_limits<uint64_t>::max();
+
+struct OpenPhase {
+    uint64_t index;
+    double startCpuMicroseconds;
+    uint64_t startPeakMemoryKilobytes;
+};
+
+// The open phases of the current thread, innermost phase last.
+thread_local std::vector<OpenPhase> openPhases;
+
+uint64_t getThreadIndex() {
+    static std::atomic<uint64_t> numberOfThreads(0);
+    thread_local uint64_t const threadIndex = numberOfThreads++;
+    return threadIndex;
+}
+
+double getThreadCpuMicroseconds() {
+#ifdef WINDOWS
+    // Only the CPU time of the whole process is available.
+    return 1e6 * std::clock() / CLOCKS_PER_SEC;
+#else
+    timespec time;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return time.tv_sec * 1e6 + time.tv_nsec / 1e3;
+#endif
+}
+
+uint64_t getPeakMemoryKilobytes() {
+#if defined LINUX
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    // For Linux, this is returned in kilobytes.
+    return ru.ru_maxrss;
+#elif defined MACOS
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    // For Mac OS, this is returned in bytes.
+    return ru.ru_maxrss / 1024;
+#else
+    return 0;
+#endif
+}
+}  // namespace
+
+Profiler::Profiler() : enabled(false), maximalNumberOfPhases(1000000), numberOfDroppedPhases(0), creationTime(std::chrono::steady_clock::now()) {
+    // Intentionally left empty.
+}
+
+Profiler& Profiler::getInstance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+void Profiler::setEnabled(bool value) {
+    enabled.store(value, std::memory_order_relaxed);
+}
+
+uint64_t Profiler::beginPhase(std::string const& name) {
+    OpenPhase openPhase{droppedPhaseIndex, getThreadCpuMicroseconds(), getPeakMemoryKilobytes()};
+    std::chrono::duration<double, std::micro> start = std::chrono::steady_clock::now() - creationTime;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (phases.size() < maximalNumberOfPhases) {
+            openPhase.index = phases.size();
+            phases.push_back(Phase{name, getThreadIndex(), openPhases.size(), start.count(), 0, 0, 0, {}, false});
+        } else {
+            ++numberOfDroppedPhases;
+        }
+    }
+    openPhases.push_back(openPhase);
+    return openPhase.index;
+}
+
+void Profiler::endPhase(uint64_t phaseIndex) {
+    STORM_LOG_ASSERT(!openPhases.empty() && openPhases.back().index == phaseIndex, "Phases need to be ended in reverse order of their beginning.");
+    OpenPhase openPhase = openPhases.back();
+    openPhases.pop_back();
+    if (phaseIndex == droppedPhaseIndex) {
+        return;
+    }
+    std::chrono::duration<double, std::micro> end = std::chrono::steady_clock::now() - creationTime;
+    double cpuMicroseconds = getThreadCpuMicroseconds() - openPhase.startCpuMicroseconds;
+    uint64_t peakMemoryGrowth = getPeakMemoryKilobytes() - openPhase.startPeakMemoryKilobytes;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    // The phases might have been cleared in the meantime.
+    if (phaseIndex < phases.size()) {
+        Phase& phase = phases[phaseIndex];
+        phase.wallMicroseconds = end.count() - phase.startMicroseconds;
+        phase.cpuMicroseconds = cpuMicroseconds;
+        phase.peakMemoryGrowthKilobytes = peakMemoryGrowth;
+        phase.finished = true;
+    }
+}
+
+void Profiler::addCounter(std::string const& name, uint64_t value) {
+    if (!isEnabled() || openPhases.empty() || openPhases.back().index == droppedPhaseIndex) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (openPhases.back().index < phases.size()) {
+        phases[openPhases.back().index].counters[name] += value;
+    }
+}
+
+std::vector<Profiler::Phase> Profiler::getPhases() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return std::vector<Phase>(phases.begin(), phases.end());
+}
+
+void Profiler::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    phases.clear();
+    numberOfDroppedPhases = 0;
+}
+
+storm::json<double> Profiler::toChromeTrace() const {
+    std::vector<Phase> recordedPhases = getPhases();
+    storm::json<double> result;
+    result["displayTimeUnit"] = "ms";
+    result["traceEvents"] = storm::json<double>::array();
+    for (auto const& phase : recordedPhases) {
+        if (!phase.finished) {
+            continue;
+        }
+        // Complete events ("X") carry both their start and their duration.
+        storm::json<double> event;
+        event["name"] = phase.name;
+        event["ph"] = "X";
+        event["pid"] = 0;
+        event["tid"] = phase.threadIndex;
+        event["ts"] = phase.startMicroseconds;
+        event["dur"] = phase.wallMicroseconds;
+        event["args"]["cpu-ms"] = phase.cpuMicroseconds / 1000;
+        event["args"]["peak-memory-growth-kb"] = phase.peakMemoryGrowthKilobytes;
+        for (auto const& counter : phase.counters) {
+            event["args"][counter.first] = counter.second;
+        }
+        result["traceEvents"].push_back(std::move(event));
+    }
+    return result;
+}
+
+void Profiler::exportChromeTrace(std::string const& filename) const {
+    std::ofstream stream;
+    storm::utility::openFile(filename, stream);
+    stream << toChromeTrace().dump() << '\n';
+    storm::utility::closeFile(stream);
+    std::lock_guard<std::mutex> lock(mutex);
+    STORM_LOG_WARN_COND(numberOfDroppedPhases == 0, "The profile trace misses " << numberOfDroppedPhases << " phases as too many phases were recorded.");
+}
+
+void Profiler::printSummary(std::ostream& out) const {
+    std::vector<Phase> recordedPhases = getPhases();
+    out << "\nProfiled phases (wall time, CPU time, peak memory growth):\n";
+    auto oldFlags = out.flags();
+    auto oldPrecision = out.precision();
+    out << std::fixed << std::setprecision(3);
+    for (auto const& phase : recordedPhases) {
+        if (!phase.finished) {
+            continue;
+        }
+        out << "  " << std::string(2 * phase.depth, ' ') << "* " << phase.name;
+        if (phase.threadIndex != 0) {
+            out << " [thread " << phase.threadIndex << "]";
+        }
+        out << ": " << phase.wallMicroseconds / 1e6 << "s, " << phase.cpuMicroseconds / 1e6 << "s, +" << phase.peakMemoryGrowthKilobytes / 1024 << "MB";
+        for (auto const& counter : phase.counters) {
+            out << ", " << counter.first << "=" << counter.second;
+        }
+        out << '\n';
+    }
+    out.flags(oldFlags);
+    out.precision(oldPrecision);
+}
+
+ProfilerPhase::ProfilerPhase(char const* name) : active(Profiler::getInstance().isEnabled()), phaseIndex(0) {
+    if (active) {
+        phaseIndex = Profiler::getInstance().beginPhase(name);
+    }
+}
+
+ProfilerPhase::~ProfilerPhase() {
+    if (active) {
+        Profiler::getInstance().endPhase(phaseIndex);
+    }
+}
+
+void ProfilerPhase::addCounter(std::string const& name, uint64_t value) {
+    if (active) {
+        Profiler::getInstance().addCounter(name, value);
+    }
+}
+
+}  // namespace utility
+}  // namespace storm
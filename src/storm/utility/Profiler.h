@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "storm/adapters/JsonAdapter.h"
+
+namespace storm {
+namespace utility {
+
+/*!
+ * Records (nested) phases of a computation such as parsing, model building, precomputations or solving. For each phase, the wall clock time, the CPU time
+ * of the executing thread, the growth of the peak memory consumption of the process and arbitrary counters (e.g. iterations or matrix sizes) are recorded.
+ * Phases are usually recorded via ProfilerPhase objects. If the profiler is disabled (the default), recording a phase has negligible cost.
+ */
+class Profiler {
+   public:
+    struct Phase {
+        std::string name;
+        // The (small) index of the thread that executed the phase, where 0 is the thread that used the profiler first.
+        uint64_t threadIndex;
+        // The number of enclosing phases of the same thread.
+        uint64_t depth;
+        // The start time of the phase relative to the time the profiler has been created.
+        double startMicroseconds;
+        double wallMicroseconds;
+        double cpuMicroseconds;
+        // The amount by which the peak resident set size of the process grew during the phase.
+        uint64_t peakMemoryGrowthKilobytes;
+        std::map<std::string, uint64_t> counters;
+        bool finished;
+    };
+
+    /*!
+     * Retrieves the (global) profiler.
+     */
+    static Profiler& getInstance();
+
+    void setEnabled(bool value);
+
+    bool isEnabled() const {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * Starts a phase of the calling thread that is nested in the currently open phase of the thread (if any).
+     *
+     * @return The index of the phase that needs to be passed to endPhase.
+     */
+    uint64_t beginPhase(std::string const& name);
+
+    /*!
+     * Ends the phase with the given index, which needs to be the innermost open phase of the calling thread.
+     */
+    void endPhase(uint64_t phaseIndex);
+
+    /*!
+     * Adds the given value to the counter with the given name of the innermost open phase of the calling thread. If there is no such phase or the profiler
+     * is disabled, this does nothing.
+     */
+    void addCounter(std::string const& name, uint64_t value);
+
+    /*!
+     * Retrieves all phases recorded so far in the order in which they were started.
+     */
+    std::vector<Phase> getPhases() const;
+
+    /*!
+     * Discards all recorded phases.
+     */
+    void clear();
+
+    /*!
+     * Retrieves the finished phases in the trace event format that can be loaded in chrome://tracing or https://ui.perfetto.dev.
+     */
+    storm::json<double> toChromeTrace() const;
+
+    /*!
+     * Writes the finished phases in the trace event format to the given file.
+     */
+    void exportChromeTrace(std::string const& filename) const;
+
+    /*!
+     * Prints the finished phases as an indented tree.
+     */
+    void printSummary(std::ostream& out) const;
+
+   private:
+    Profiler();
+
+    std::atomic<bool> enabled;
+    mutable std::mutex mutex;
+    // Phases are stored in a deque so references remain valid when new phases are recorded.
+    std::deque<Phase> phases;
+    // Phases that are started after this many phases have been recorded are dropped to bound the memory consumption.
+    uint64_t maximalNumberOfPhases;
+    uint64_t numberOfDroppedPhases;
+    std::chrono::steady_clock::time_point creationTime;
+};
+
+/*!
+ * Records a phase using the global profiler from construction until destruction.
+ */
+class ProfilerPhase {
+   public:
+    explicit ProfilerPhase(char const* name);
+    ~ProfilerPhase();
+
+    ProfilerPhase(ProfilerPhase const&) = delete;
+    ProfilerPhase& operator=(ProfilerPhase const&) = delete;
+
+    /*!
+     * Adds the given value to the counter with the given name of this phase (or of the innermost phase that was started within this phase and is still open).
+     */
+    void addCounter(std::string const& name, uint64_t value);
+
+   private:
+    bool active;
+    uint64_t phaseIndex;
+};
+
+}  // namespace utility
+}  // namespace storm
@@ -10,13 +10,15 @@
 namespace storm {
 namespace utility {
 
-ProgressMeasurement::ProgressMeasurement(std::string const& itemName) : itemName(itemName), maxCount(std::numeric_limits<uint64_t>::max()) {
+ProgressMeasurement::ProgressMeasurement(std::string const& itemName)
+    : itemName(itemName), maxCount(std::numeric_limits<uint64_t>::max()), startCount(0), lastDisplayedCount(0) {
     auto generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
     showProgress = generalSettings.isShowProgressSet();
     delay = generalSettings.getShowProgressDelay();
 }
 
 void ProgressMeasurement::startNewMeasurement(uint64_t startCount) {
+    this->startCount = startCount;
     lastDisplayedCount = startCount;
     timeOfStart = std::chrono::high_resolution_clock::now();
     timeOfLastMessage = timeOfStart;
@@ -41,9 +43,16 @@ bool ProgressMeasurement::updateProgress(uint64_t count, std::ostream& outstream
     auto durationSinceLastMessage = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(now - this->timeOfLastMessage).count());
     if (durationSinceLastMessage >= this->delay * 1000) {
         double itemsPerSecond = (static_cast<double>(count - this->lastDisplayedCount) * 1000.0 / static_cast<double>(durationSinceLastMessage));
+        auto durationSinceStart = std::chrono::duration_cast<std::chrono::milliseconds>(now - timeOfStart).count();
         outstream << "Completed " << count << " " << itemName << " " << (this->isMaxCountSet() ? "(out of " + std::to_string(this->getMaxCount()) + ") " : "")
-                  << "in " << std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count() << "s (currently " << itemsPerSecond << " "
-                  << itemName << " per second).\n";
+                  << "in " << durationSinceStart / 1000 << "s (currently " << itemsPerSecond << " " << itemName << " per second";
+        if (this->isMaxCountSet() && count > this->startCount && count <= this->getMaxCount()) {
+            // Estimate the remaining time based on the average speed since the start of the measurement.
+            double remainingMilliseconds =
+                static_cast<double>(this->getMaxCount() - count) * static_cast<double>(durationSinceStart) / static_cast<double>(count - this->startCount);
+            outstream << ", estimated " << static_cast<uint64_t>(remainingMilliseconds / 1000.0) << "s remaining";
+        }
+        outstream << ").\n";
         timeOfLastMessage = std::chrono::high_resolution_clock::now();
         lastDisplayedCount = count;
         return true;
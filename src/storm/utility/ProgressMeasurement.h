@@ -101,6 +101,9 @@ class ProgressMeasurement {
     // The maximal count that can be achieved. numeric_limits<uint64_t>::max() means unspecified.
     uint64_t maxCount;
 
+    // The count at the start of the measurement
+    uint64_t startCount;
+
     // The last displayed count
     uint64_t lastDisplayedCount;
 
@@ -10,6 +10,10 @@ namespace resources {
 // Maximal waiting time after abort signal before terminating
 int maxWaitTime = 0;
 
+namespace detail {
+thread_local std::optional<std::chrono::steady_clock::time_point> threadDeadline;
+}  // namespace detail
+
 SignalInformation::SignalInformation() : terminate(false), lastSignal(0) {}
 
 SignalInformation::~SignalInformation() {
@@ -30,7 +34,7 @@ SignalInformation& SignalInformation::infos() {
  * @param signal Exit code of signal.
  */
 void signalHandler(int signal) {
-    if (!isTerminate()) {
+    if (!SignalInformation::infos().isTerminate()) {
         // First time we get an abort signal
         // We give the program a number of seconds to print results obtained so far before termination
         std::cerr << "ERROR: The program received signal " << signal << " and will be aborted in " << maxWaitTime << "s.\n";
@@ -55,6 +59,14 @@ void signalHandler(int signal) {
     }
 }
 
+void setThreadTimeout(uint_fast64_t timeout) {
+    detail::threadDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeout);
+}
+
+void resetThreadTimeout() {
+    detail::threadDeadline.reset();
+}
+
 void installSignalHandler(int maximalWaitTime) {
     // Set the waiting time
     maxWaitTime = maximalWaitTime;
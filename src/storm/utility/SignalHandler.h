@@ -1,7 +1,9 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
+#include <optional>
 
 #include "storm-config.h"
 #include "storm/utility/OsDetection.h"
@@ -105,13 +107,32 @@ inline void resetTimeoutAlarm() {
     alarm(0);
 }
 
+namespace detail {
+// The point in time after which the computations of the current thread are to be aborted (if any).
+extern thread_local std::optional<std::chrono::steady_clock::time_point> threadDeadline;
+}  // namespace detail
+
+/*!
+ * Sets a timeout for the computations of the calling thread: After the given number of seconds, isTerminate() returns true on this thread but not on other
+ * threads. In contrast to the alarm-based timeout, this allows to limit the time of single requests of a long-running process.
+ * @note The tasks of parallel computations (see storm/utility/TaskRuntime.h) observe the timeout of the thread that started the computation. Other helper
+ * threads do not observe this timeout.
+ * @param timeout Timeout in seconds.
+ */
+void setThreadTimeout(uint_fast64_t timeout);
+
+/*!
+ * Removes the timeout of the calling thread (if any).
+ */
+void resetThreadTimeout();
+
 /*!
- * Check whether the program should terminate (due to some abort signal).
+ * Check whether the program should terminate (due to some abort signal) or the computations of the calling thread should be aborted (due to a timeout).
  *
  * @return True iff program should terminate.
  */
 inline bool isTerminate() {
-    return SignalInformation::infos().isTerminate();
+    return SignalInformation::infos().isTerminate() || (detail::threadDeadline && std::chrono::steady_clock::now() >= *detail::threadDeadline);
 }
 
 /*!
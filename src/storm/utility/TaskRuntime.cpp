@@ -0,0 +1,301 @@
+#include "storm/utility/TaskRuntime.h"
+
+#include <algorithm>
+#include <deque>
+#include <thread>
+
+#include "storm-config.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
+
+namespace storm {
+namespace utility {
+namespace parallel {
+
+namespace {
+// Whether the calling thread is a worker of the runtime.
+thread_local bool isWorker = false;
+
+#ifdef STORM_HAVE_INTELTBB
+// Limits the parallelism of TBB to the number of threads of the runtime.
+std::unique_ptr<tbb::global_control> tbbParallelismLimit;
+#endif
+
+void limitExternalParallelism(uint64_t numberOfThreads) {
+#ifdef STORM_HAVE_INTELTBB
+    tbbParallelismLimit.reset();
+    tbbParallelismLimit = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, static_cast<size_t>(numberOfThreads));
+#else
+    (void)numberOfThreads;
+#endif
+}
+}  // namespace
+
+CancellationToken::CancellationToken() : cancelled(std::make_shared<std::atomic<bool>>(false)), deadline(storm::utility::resources::detail::threadDeadline) {
+    // Intentionally left empty.
+}
+
+void CancellationToken::cancel() const {
+    cancelled->store(true);
+}
+
+bool CancellationToken::isCancelledExplicitly() const {
+    return cancelled->load();
+}
+
+bool CancellationToken::isCancelled() const {
+    return isCancelledExplicitly() || storm::utility::resources::SignalInformation::infos().isTerminate() ||
+           (deadline && std::chrono::steady_clock::now() >= *deadline);
+}
+
+std::optional<std::chrono::steady_clock::time_point> const& CancellationToken::getDeadline() const {
+    return deadline;
+}
+
+struct TaskRuntime::Worker {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+    std::thread thread;
+};
+
+TaskRuntime::TaskRuntime()
+    : workers(maximalNumberOfWorkers),
+      numberOfWorkers(0),
+      nextWorker(0),
+      numberOfThreads(std::max(1u, storm::utility::getNumberOfThreads())),
+      externalPoolSuspended(false),
+      numberOfActiveGroups(0),
+      numberOfPendingTasks(0),
+      stopping(false) {
+    limitExternalParallelism(numberOfThreads);
+}
+
+TaskRuntime::~TaskRuntime() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (uint64_t workerIndex = 0, end = numberOfWorkers.load(); workerIndex < end; ++workerIndex) {
+        workers[workerIndex]->thread.join();
+    }
+}
+
+TaskRuntime& TaskRuntime::runtime() {
+    static TaskRuntime runtime;
+    return runtime;
+}
+
+bool TaskRuntime::isWorkerThread() {
+    return isWorker;
+}
+
+uint64_t TaskRuntime::getNumberOfThreads() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numberOfThreads;
+}
+
+void TaskRuntime::setNumberOfThreads(uint64_t numberOfThreads) {
+    STORM_LOG_ASSERT(numberOfThreads > 0, "The number of threads must be positive.");
+    std::lock_guard<std::mutex> lock(mutex);
+    this->numberOfThreads = numberOfThreads;
+    limitExternalParallelism(numberOfThreads);
+}
+
+uint64_t TaskRuntime::getNumberOfWorkers() const {
+    return numberOfWorkers.load();
+}
+
+void TaskRuntime::setExternalPoolHooks(std::function<bool()> const& suspend, std::function<void()> const& resume) {
+    std::lock_guard<std::mutex> lock(mutex);
+    STORM_LOG_ASSERT(!externalPoolSuspended, "Replacing the hooks of a suspended external thread pool.");
+    suspendExternalPool = suspend;
+    resumeExternalPool = resume;
+    if (numberOfActiveGroups > 0 && suspendExternalPool) {
+        externalPoolSuspended = suspendExternalPool();
+    }
+}
+
+void TaskRuntime::resetExternalPoolHooks() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (externalPoolSuspended) {
+        resumeExternalPool();
+        externalPoolSuspended = false;
+    }
+    suspendExternalPool = nullptr;
+    resumeExternalPool = nullptr;
+}
+
+void TaskRuntime::ensureNumberOfWorkers(uint64_t numberOfWorkers) {
+    numberOfWorkers = std::min(numberOfWorkers, maximalNumberOfWorkers);
+    if (this->numberOfWorkers.load() >= numberOfWorkers) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    for (uint64_t workerIndex = this->numberOfWorkers.load(); workerIndex < numberOfWorkers; ++workerIndex) {
+        workers[workerIndex] = std::make_unique<Worker>();
+        workers[workerIndex]->thread = std::thread([this, workerIndex]() { work(workerIndex); });
+        // Only publish the worker once it is complete.
+        this->numberOfWorkers.store(workerIndex + 1);
+    }
+}
+
+void TaskRuntime::submit(std::function<void()>&& task) {
+    uint64_t const currentNumberOfWorkers = numberOfWorkers.load();
+    STORM_LOG_ASSERT(currentNumberOfWorkers > 0, "Submitting a task without workers.");
+    Worker& worker = *workers[nextWorker.fetch_add(1) % currentNumberOfWorkers];
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        ++numberOfPendingTasks;
+    }
+    wakeUp.notify_one();
+}
+
+void TaskRuntime::beginGroup() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (numberOfActiveGroups++ == 0 && suspendExternalPool) {
+        externalPoolSuspended = suspendExternalPool();
+    }
+}
+
+void TaskRuntime::endGroup() {
+    std::lock_guard<std::mutex> lock(mutex);
+    STORM_LOG_ASSERT(numberOfActiveGroups > 0, "Ending a task group that has not begun.");
+    if (--numberOfActiveGroups == 0 && externalPoolSuspended) {
+        resumeExternalPool();
+        externalPoolSuspended = false;
+    }
+}
+
+bool TaskRuntime::popTask(uint64_t workerIndex, std::function<void()>& task) {
+    // Take the oldest task of the own queue or the most recent task of another queue.
+    uint64_t const currentNumberOfWorkers = numberOfWorkers.load();
+    for (uint64_t offset = 0; offset < currentNumberOfWorkers; ++offset) {
+        Worker& worker = *workers[(workerIndex + offset) % currentNumberOfWorkers];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.tasks.empty()) {
+            if (offset == 0) {
+                task = std::move(worker.tasks.front());
+                worker.tasks.pop_front();
+            } else {
+                task = std::move(worker.tasks.back());
+                worker.tasks.pop_back();
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskRuntime::work(uint64_t workerIndex) {
+    isWorker = true;
+    std::function<void()> task;
+    while (true) {
+        if (popTask(workerIndex, task)) {
+            {
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                --numberOfPendingTasks;
+            }
+            task();
+            task = nullptr;
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeUp.wait(lock, [this]() { return stopping || numberOfPendingTasks > 0; });
+        if (stopping && numberOfPendingTasks == 0) {
+            return;
+        }
+    }
+}
+
+TaskGroup::TaskGroup(CancellationToken const& token) : token(token), state(std::make_shared<State>()), numberOfSubmittedTasks(0), active(false) {
+    // Intentionally left empty.
+}
+
+TaskGroup::~TaskGroup() {
+    try {
+        wait();
+    } catch (...) {
+        // Exceptions that were not retrieved by an explicit wait are dropped.
+    }
+}
+
+void TaskGroup::execute(std::shared_ptr<State> const& state, CancellationToken const& token, std::function<void()> const& task) {
+    if (token.isCancelledExplicitly()) {
+        return;
+    }
+    auto previousDeadline = storm::utility::resources::detail::threadDeadline;
+    storm::utility::resources::detail::threadDeadline = token.getDeadline();
+    try {
+        task();
+    } catch (...) {
+        token.cancel();
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (!state->exception) {
+            state->exception = std::current_exception();
+        }
+    }
+    storm::utility::resources::detail::threadDeadline = previousDeadline;
+}
+
+void TaskGroup::run(std::function<void()> task) {
+    if (TaskRuntime::isWorkerThread()) {
+        execute(state, token, task);
+        return;
+    }
+
+    TaskRuntime& runtime = TaskRuntime::runtime();
+    if (!active) {
+        runtime.beginGroup();
+        active = true;
+    }
+    // Every task that is submitted since the last wait may run concurrently.
+    runtime.ensureNumberOfWorkers(++numberOfSubmittedTasks);
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        ++state->numberOfPendingTasks;
+    }
+    runtime.submit([state = state, token = token, task = std::move(task)]() {
+        execute(state, token, task);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (--state->numberOfPendingTasks == 0) {
+            state->finished.notify_all();
+        }
+    });
+}
+
+void TaskGroup::wait() {
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->finished.wait(lock, [this]() { return state->numberOfPendingTasks == 0; });
+        std::swap(exception, state->exception);
+    }
+    numberOfSubmittedTasks = 0;
+    if (active) {
+        TaskRuntime::runtime().endGroup();
+        active = false;
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void TaskGroup::cancel() {
+    token.cancel();
+}
+
+CancellationToken const& TaskGroup::getCancellationToken() const {
+    return token;
+}
+
+}  // namespace parallel
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace storm {
+namespace utility {
+namespace parallel {
+
+/*!
+ * A token that signals the tasks of a parallel computation that they are to stop. Copies of a token share their state. Besides being cancelled explicitly, a
+ * token is cancelled if the program is to terminate or the timeout of the thread that created the token has passed (see storm/utility/SignalHandler.h).
+ */
+class CancellationToken {
+   public:
+    /*!
+     * Creates a token that is not cancelled and observes the timeout of the calling thread (if any).
+     */
+    CancellationToken();
+
+    /*!
+     * Cancels this token (and all of its copies).
+     */
+    void cancel() const;
+
+    /*!
+     * Retrieves whether the token has been cancelled explicitly.
+     */
+    bool isCancelledExplicitly() const;
+
+    /*!
+     * Retrieves whether the token has been cancelled explicitly, the program is to terminate or the deadline of the token has passed.
+     */
+    bool isCancelled() const;
+
+    /*!
+     * Retrieves the point in time after which the computations observing this token are to be aborted (if any).
+     */
+    std::optional<std::chrono::steady_clock::time_point> const& getDeadline() const;
+
+   private:
+    std::shared_ptr<std::atomic<bool>> cancelled;
+    std::optional<std::chrono::steady_clock::time_point> deadline;
+};
+
+class TaskGroup;
+
+/*!
+ * The thread pool that executes the tasks of the parallel computations of Storm (see storm/utility/parallel.h). Every worker keeps a local queue of tasks
+ * and steals tasks from the other workers once its queue runs empty. Idle workers sleep until new tasks are submitted. The pool grows lazily with the
+ * parallelism that is requested, so no threads are started by sequential computations.
+ *
+ * Other thread pools (e.g. the one of Sylvan) can register hooks that suspend them while the workers of this runtime are busy and resume them afterwards,
+ * so that the pools do not compete for the processors.
+ */
+class TaskRuntime {
+   public:
+    TaskRuntime(TaskRuntime const&) = delete;
+    TaskRuntime& operator=(TaskRuntime const&) = delete;
+
+    /*!
+     * Retrieves the runtime that is shared by all computations.
+     */
+    static TaskRuntime& runtime();
+
+    /*!
+     * Retrieves whether the calling thread is a worker of the runtime.
+     */
+    static bool isWorkerThread();
+
+    /*!
+     * Retrieves the number of threads that parallel computations use if they are not told otherwise. Unless set explicitly, this is the number of threads
+     * that are available to the process (see storm/utility/threads.h). If Intel TBB is available, its parallelism is limited to this number as well.
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Sets the number of threads that parallel computations use if they are not told otherwise.
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
+    /*!
+     * Retrieves the number of workers that have been started so far.
+     */
+    uint64_t getNumberOfWorkers() const;
+
+    /*!
+     * Registers the hooks of an external thread pool. The suspend hook is called once the workers of this runtime become busy and returns whether the
+     * external pool has been suspended. In that case, the resume hook is called once all task groups have finished.
+     */
+    void setExternalPoolHooks(std::function<bool()> const& suspend, std::function<void()> const& resume);
+
+    /*!
+     * Removes the hooks of the external thread pool (if any). If the external pool is currently suspended by this runtime, it is resumed.
+     */
+    void resetExternalPoolHooks();
+
+   private:
+    friend class TaskGroup;
+
+    struct Worker;
+
+    // The maximal number of workers. Tasks beyond this parallelism are queued.
+    static const uint64_t maximalNumberOfWorkers = 1024;
+
+    TaskRuntime();
+    ~TaskRuntime();
+
+    /*!
+     * Makes sure that (at least) the given number of workers has been started.
+     */
+    void ensureNumberOfWorkers(uint64_t numberOfWorkers);
+
+    /*!
+     * Enqueues the given task at one of the workers.
+     */
+    void submit(std::function<void()>&& task);
+
+    /*!
+     * Notify the runtime that a task group starts or stops to use workers, respectively.
+     */
+    void beginGroup();
+    void endGroup();
+
+    bool popTask(uint64_t workerIndex, std::function<void()>& task);
+    void work(uint64_t workerIndex);
+
+    // The workers. The vector is allocated for the maximal number of workers upon construction and never reallocated, so that workers may access the
+    // queues of others while new workers are started.
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::atomic<uint64_t> numberOfWorkers;
+    std::atomic<uint64_t> nextWorker;
+
+    // Guards the start of workers, the number of threads, the hooks and the number of active groups.
+    mutable std::mutex mutex;
+    uint64_t numberOfThreads;
+    std::function<bool()> suspendExternalPool;
+    std::function<void()> resumeExternalPool;
+    bool externalPoolSuspended;
+    uint64_t numberOfActiveGroups;
+
+    // Guards the number of pending tasks and whether the workers are to stop. Idle workers wait for the condition variable.
+    std::mutex sleepMutex;
+    std::condition_variable wakeUp;
+    uint64_t numberOfPendingTasks;
+    bool stopping;
+};
+
+/*!
+ * A group of tasks that are executed by the workers of the task runtime. Tasks of the group that have not started yet are skipped once the token of the group
+ * has been cancelled explicitly (which in particular happens if a task throws). While a task is executed, the timeout of the thread that created the token
+ * applies to the worker (see storm::utility::resources::isTerminate), so tasks can check for termination as usual.
+ *
+ * If the tasks are added from within a worker, they are executed immediately on the calling worker. This way, nested parallel computations can not exhaust
+ * the workers while waiting for each other.
+ */
+class TaskGroup {
+   public:
+    /*!
+     * Creates an empty group whose tasks observe the given token.
+     */
+    explicit TaskGroup(CancellationToken const& token = CancellationToken());
+
+    TaskGroup(TaskGroup const&) = delete;
+    TaskGroup& operator=(TaskGroup const&) = delete;
+
+    /*!
+     * Waits for all tasks of the group. Exceptions of the tasks are dropped.
+     */
+    ~TaskGroup();
+
+    /*!
+     * Adds the given task to the group.
+     */
+    void run(std::function<void()> task);
+
+    /*!
+     * Waits until all tasks of the group have finished (or were skipped). If a task threw, the first exception is rethrown.
+     */
+    void wait();
+
+    /*!
+     * Cancels the token of this group, i.e., the tasks that have not started yet are skipped.
+     */
+    void cancel();
+
+    /*!
+     * Retrieves the token of this group.
+     */
+    CancellationToken const& getCancellationToken() const;
+
+   private:
+    struct State {
+        std::mutex mutex;
+        std::condition_variable finished;
+        uint64_t numberOfPendingTasks = 0;
+        std::exception_ptr exception;
+    };
+
+    /*!
+     * Executes the given task (unless the group has been cancelled) and records its exception (if any).
+     */
+    static void execute(std::shared_ptr<State> const& state, CancellationToken const& token, std::function<void()> const& task);
+
+    CancellationToken token;
+    std::shared_ptr<State> state;
+    // The number of tasks that have been submitted to the runtime since the last wait.
+    uint64_t numberOfSubmittedTasks;
+    // Whether the group has announced itself to the runtime.
+    bool active;
+};
+
+}  // namespace parallel
+}  // namespace utility
+}  // namespace storm
@@ -8,6 +8,7 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/SmallRationalNumber.h"
 
 #include "storm/utility/NumberTraits.h"
 
@@ -925,6 +926,33 @@ storm::Interval abs(storm::Interval const& interval) {
     return interval.abs();
 }
 
+#ifdef STORM_HAVE_CARL
+template<>
+storm::SmallRationalNumber convertNumber(storm::RationalNumber const& number) {
+    return storm::SmallRationalNumber(number);
+}
+
+template<>
+storm::RationalNumber convertNumber(storm::SmallRationalNumber const& number) {
+    return number.toRationalNumber();
+}
+
+template<>
+storm::SmallRationalNumber convertNumber(double const& number) {
+    return storm::SmallRationalNumber(convertNumber<storm::RationalNumber>(number));
+}
+
+template<>
+double convertNumber(storm::SmallRationalNumber const& number) {
+    return number.toDouble();
+}
+
+template<>
+storm::SmallRationalNumber abs(storm::SmallRationalNumber const& number) {
+    return number < zero<storm::SmallRationalNumber>() ? -number : number;
+}
+#endif
+
 // Explicit instantiations.
 
 // double
@@ -1062,6 +1090,17 @@ template bool isInfinity(Interval const& value);
 template bool isAlmostZero(Interval const& value);
 
 template std::string to_string(storm::Interval const& value);
+
+// Instantiations for small rational numbers.
+template SmallRationalNumber one();
+template SmallRationalNumber zero();
+template bool isOne(SmallRationalNumber const& value);
+template bool isZero(SmallRationalNumber const& value);
+template bool isConstant(SmallRationalNumber const& value);
+template SmallRationalNumber convertNumber(SmallRationalNumber const& number);
+template SmallRationalNumber simplify(SmallRationalNumber value);
+template SmallRationalNumber max(SmallRationalNumber const& first, SmallRationalNumber const& second);
+template SmallRationalNumber min(SmallRationalNumber const& first, SmallRationalNumber const& second);
 #endif
 
 }  // namespace utility
@@ -1,5 +1,8 @@
 #include "storm/utility/dd.h"
 
+#include <algorithm>
+#include <map>
+
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
@@ -22,12 +25,14 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
     auto start = std::chrono::high_resolution_clock::now();
     storm::dd::Bdd<Type> reachableStates = initialStates;
 
-    // Perform the BFS to discover all reachable states.
+    // Perform the BFS to discover all reachable states. Only the successors of the states discovered in the previous iteration can be new, so the
+    // (typically much smaller) frontier is used for the image computation.
+    storm::dd::Bdd<Type> frontier = initialStates;
     bool changed = true;
     uint_fast64_t iteration = 0;
     do {
         changed = false;
-        storm::dd::Bdd<Type> tmp = reachableStates.relationalProduct(transitions, rowMetaVariables, columnMetaVariables);
+        storm::dd::Bdd<Type> tmp = frontier.relationalProduct(transitions, rowMetaVariables, columnMetaVariables);
         storm::dd::Bdd<Type> newReachableStates = tmp && (!reachableStates);
 
         // Check whether new states were indeed discovered.
@@ -36,6 +41,7 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
         }
 
         reachableStates |= newReachableStates;
+        frontier = std::move(newReachableStates);
 
         ++iteration;
         STORM_LOG_TRACE("Iteration " << iteration << " of reachability computation completed: " << reachableStates.getNonZeroCount()
@@ -49,6 +55,186 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
     return {reachableStates, iteration};
 }
 
+template<storm::dd::DdType Type>
+std::vector<TransitionRelationPart<Type>> partitionTransitionRelation(
+    std::vector<storm::dd::Bdd<Type>> const& relations, std::vector<std::set<storm::expressions::Variable>> const& rowMetaVariableGroups,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) {
+    typedef std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> VariablePairs;
+    std::vector<TransitionRelationPart<Type>> result;
+    if (relations.empty()) {
+        return result;
+    }
+    storm::dd::DdManager<Type> const& manager = relations.front().getDdManager();
+    std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> rowVariableToIdentity;
+    for (auto const& variablePair : rowColumnMetaVariablePairs) {
+        rowVariableToIdentity.emplace(variablePair.first, manager.getIdentity(variablePair.first, variablePair.second));
+    }
+
+    // A variable is unchanged if all transitions keep its value.
+    auto getChangedVariablePairs = [&](storm::dd::Bdd<Type> const& relation) {
+        VariablePairs changed;
+        for (auto const& variablePair : rowColumnMetaVariablePairs) {
+            if (!(relation && !rowVariableToIdentity.at(variablePair.first)).isZero()) {
+                changed.push_back(variablePair);
+            }
+        }
+        return changed;
+    };
+
+    // As the relation implies the identity of every unchanged variable, the identity can be recovered from the row variable, so the column variable is
+    // abstracted.
+    auto addRestrictedPart = [&](storm::dd::Bdd<Type> const& relation, VariablePairs&& changed) {
+        if (changed.empty()) {
+            return;
+        }
+        TransitionRelationPart<Type> part;
+        std::set<storm::expressions::Variable> unchangedColumnVariables;
+        auto changedIt = changed.begin();
+        for (auto const& variablePair : rowColumnMetaVariablePairs) {
+            if (changedIt != changed.end() && changedIt->first == variablePair.first) {
+                ++changedIt;
+            } else {
+                unchangedColumnVariables.insert(variablePair.second);
+            }
+        }
+        part.relation = relation.existsAbstract(unchangedColumnVariables);
+        for (auto const& variablePair : changed) {
+            part.rowMetaVariables.insert(variablePair.first);
+        }
+        part.rowColumnMetaVariablePairs = std::move(changed);
+        result.push_back(std::move(part));
+    };
+
+    for (auto const& relation : relations) {
+        if (relation.isZero()) {
+            continue;
+        }
+        auto changed = getChangedVariablePairs(relation);
+
+        // Determine the changed variables of every group.
+        std::vector<std::vector<storm::expressions::Variable>> changedVariablesOfGroups;
+        for (auto const& group : rowMetaVariableGroups) {
+            std::vector<storm::expressions::Variable> changedVariablesOfGroup;
+            for (auto const& variablePair : changed) {
+                if (group.count(variablePair.first) > 0) {
+                    changedVariablesOfGroup.push_back(variablePair.first);
+                }
+            }
+            if (!changedVariablesOfGroup.empty()) {
+                changedVariablesOfGroups.push_back(std::move(changedVariablesOfGroup));
+            }
+        }
+        if (changedVariablesOfGroups.size() <= 1) {
+            addRestrictedPart(relation, std::move(changed));
+            continue;
+        }
+
+        // Split off the transitions that only change the variables of a single group.
+        storm::dd::Bdd<Type> covered = manager.getBddZero();
+        for (uint64_t groupIndex = 0; groupIndex < changedVariablesOfGroups.size(); ++groupIndex) {
+            storm::dd::Bdd<Type> otherGroupsUnchanged = manager.getBddOne();
+            for (uint64_t otherGroupIndex = 0; otherGroupIndex < changedVariablesOfGroups.size(); ++otherGroupIndex) {
+                if (otherGroupIndex != groupIndex) {
+                    for (auto const& variable : changedVariablesOfGroups[otherGroupIndex]) {
+                        otherGroupsUnchanged &= rowVariableToIdentity.at(variable);
+                    }
+                }
+            }
+            storm::dd::Bdd<Type> part = relation && otherGroupsUnchanged;
+            if (!part.isZero()) {
+                covered |= part;
+                addRestrictedPart(part, getChangedVariablePairs(part));
+            }
+        }
+        storm::dd::Bdd<Type> remaining = relation && !covered;
+        if (!remaining.isZero()) {
+            addRestrictedPart(remaining, getChangedVariablePairs(remaining));
+        }
+    }
+    STORM_LOG_TRACE("Partitioned the transition relation into " << result.size() << " part(s).");
+    return result;
+}
+
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates,
+                                                                 std::vector<TransitionRelationPart<Type>> const& parts,
+                                                                 storm::builder::DdReachabilityStrategy strategy) {
+    STORM_LOG_TRACE("Computing reachable states with strategy " << strategy << " and " << parts.size() << " part(s) of the transition relation, "
+                                                                << initialStates.getNonZeroCount() << " initial states.");
+    auto start = std::chrono::high_resolution_clock::now();
+    storm::dd::Bdd<Type> reachableStates = initialStates;
+    storm::dd::Bdd<Type> const zero = initialStates.getDdManager().getBddZero();
+    uint64_t imageComputations = 0;
+
+    // Computes the successors of the given states that are not yet known to be reachable. Only the variables changed by the part are abstracted.
+    auto getNewSuccessors = [&](storm::dd::Bdd<Type> const& states, TransitionRelationPart<Type> const& part) {
+        ++imageComputations;
+        return states.andExists(part.relation, part.rowMetaVariables).swapVariables(part.rowColumnMetaVariablePairs) && !reachableStates;
+    };
+
+    if (strategy == storm::builder::DdReachabilityStrategy::Saturation) {
+        // The parts are ordered such that parts whose topmost variable is closest to the terminal nodes come first.
+        std::vector<uint64_t> order(parts.size());
+        for (uint64_t index = 0; index < parts.size(); ++index) {
+            order[index] = index;
+        }
+        std::stable_sort(order.begin(), order.end(), [&parts](uint64_t first, uint64_t second) {
+            return parts[first].relation.getLevel() > parts[second].relation.getLevel();
+        });
+
+        // The states that were not yet passed to the respective part.
+        std::vector<storm::dd::Bdd<Type>> unprocessed(parts.size(), initialStates);
+        uint64_t position = 0;
+        while (position < order.size()) {
+            uint64_t const partIndex = order[position];
+            storm::dd::Bdd<Type> frontier = std::move(unprocessed[partIndex]);
+            unprocessed[partIndex] = zero;
+            bool foundNewStates = false;
+            while (!frontier.isZero()) {
+                frontier = getNewSuccessors(frontier, parts[partIndex]);
+                if (!frontier.isZero()) {
+                    foundNewStates = true;
+                    reachableStates |= frontier;
+                    for (uint64_t otherPartIndex = 0; otherPartIndex < parts.size(); ++otherPartIndex) {
+                        if (otherPartIndex != partIndex) {
+                            unprocessed[otherPartIndex] |= frontier;
+                        }
+                    }
+                }
+            }
+            // The new states need to be saturated with respect to the lower parts again.
+            position = (foundNewStates && position > 0) ? 0 : position + 1;
+            STORM_LOG_TRACE("Saturated part " << partIndex << ": " << reachableStates.getNonZeroCount() << " reachable states found, "
+                                              << reachableStates.getNodeCount() << " node(s).");
+        }
+    } else {
+        storm::dd::Bdd<Type> frontier = initialStates;
+        uint64_t iteration = 0;
+        while (!frontier.isZero()) {
+            // With chaining, the states found by one part are immediately passed to the subsequent parts.
+            storm::dd::Bdd<Type> newStates = zero;
+            for (auto const& part : parts) {
+                storm::dd::Bdd<Type> successors =
+                    getNewSuccessors(strategy == storm::builder::DdReachabilityStrategy::Chaining ? (frontier || newStates) : frontier, part);
+                if (strategy == storm::builder::DdReachabilityStrategy::Chaining) {
+                    reachableStates |= successors;
+                }
+                newStates |= successors;
+            }
+            reachableStates |= newStates;
+            frontier = std::move(newStates);
+            ++iteration;
+            STORM_LOG_TRACE("Iteration " << iteration << " of reachability computation completed: " << reachableStates.getNonZeroCount()
+                                         << " reachable states found, " << reachableStates.getNodeCount() << " node(s).");
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    STORM_LOG_TRACE("Reachability computation completed with " << imageComputations << " image computations ("
+                                                               << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms).");
+    return {reachableStates, imageComputations};
+}
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates,
                                                      storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
@@ -60,12 +246,13 @@ storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const&
     auto start = std::chrono::high_resolution_clock::now();
     storm::dd::Bdd<Type> reachableStates = initialStates;
 
-    // Perform the BFS to discover all reachable states.
+    // Perform the BFS to discover all reachable states. As for the forward search, only the preimage of the frontier needs to be computed.
+    storm::dd::Bdd<Type> frontier = initialStates;
     bool changed = true;
     uint_fast64_t iteration = 0;
     do {
         changed = false;
-        storm::dd::Bdd<Type> tmp = reachableStates.inverseRelationalProduct(transitions, rowMetaVariables, columnMetaVariables);
+        storm::dd::Bdd<Type> tmp = frontier.inverseRelationalProduct(transitions, rowMetaVariables, columnMetaVariables);
         storm::dd::Bdd<Type> newReachableStates = tmp && (!reachableStates) && constraintStates;
 
         // Check whether new states were indeed discovered.
@@ -74,6 +261,7 @@ storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const&
         }
 
         reachableStates |= newReachableStates;
+        frontier = std::move(newReachableStates);
 
         ++iteration;
         STORM_LOG_TRACE("Iteration " << iteration << " of (backward) reachability computation completed: " << reachableStates.getNonZeroCount()
@@ -87,6 +275,38 @@ storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const&
     return reachableStates;
 }
 
+template<storm::dd::DdType Type>
+std::vector<storm::dd::Bdd<Type>> computeTopologicalLevels(
+    storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) {
+    std::vector<storm::dd::Bdd<Type>> levels;
+    storm::dd::Bdd<Type> transitionsWithoutSelfLoops = transitions && !getRowColumnDiagonal(states.getDdManager(), rowColumnMetaVariablePairs);
+    storm::dd::Bdd<Type> remainingStates = states;
+    while (!remainingStates.isZero()) {
+        // The states that can only stay where they are or leave the remaining states form the next level.
+        storm::dd::Bdd<Type> remainingStatesAsColumn = remainingStates.swapVariables(rowColumnMetaVariablePairs);
+        storm::dd::Bdd<Type> level = remainingStates && !transitionsWithoutSelfLoops.andExists(remainingStatesAsColumn, columnMetaVariables);
+
+        if (level.isZero()) {
+            // The states reachable from any state are closed under the remaining transitions. So are the states among them that can not reach the state
+            // back (all of their successors can not reach it back either).
+            storm::dd::Bdd<Type> remainingTransitions = transitions && remainingStates && remainingStatesAsColumn;
+            storm::dd::Bdd<Type> pivot = remainingStates.existsAbstractRepresentative(rowMetaVariables);
+            level = computeReachableStates(pivot, remainingTransitions, rowMetaVariables, columnMetaVariables).first;
+            storm::dd::Bdd<Type> pivotScc = computeBackwardsReachableStates(pivot, level, remainingTransitions, rowMetaVariables, columnMetaVariables);
+            if (pivotScc != level) {
+                level &= !pivotScc;
+            }
+        }
+
+        levels.push_back(level);
+        remainingStates &= !level;
+    }
+    STORM_LOG_DEBUG("Decomposed " << states.getNonZeroCount() << " states into " << levels.size() << " topological levels.");
+    return levels;
+}
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> getRowColumnDiagonal(
     storm::dd::DdManager<Type> const& ddManager,
@@ -94,6 +314,19 @@ storm::dd::Bdd<Type> getRowColumnDiagonal(
     return ddManager.getIdentity(rowColumnMetaVariablePairs, false);
 }
 
+template<storm::dd::DdType Type>
+void reorderVariables(storm::dd::DdManager<Type>& ddManager, storm::dd::Bdd<Type> const& dd) {
+    if constexpr (Type == storm::dd::DdType::CUDD) {
+        int64_t nodeCountBefore = dd.getNodeCount();
+        ddManager.triggerReordering();
+        int64_t nodeCountAfter = dd.getNodeCount();
+        STORM_LOG_INFO("Reordering the DD variables changed the size of the DD from " << nodeCountBefore << " to " << nodeCountAfter << " nodes ("
+                                                                                       << (nodeCountBefore - nodeCountAfter) << " nodes saved).");
+    } else {
+        STORM_LOG_WARN("Reordering the DD variables is not supported by the selected DD library and is skipped.");
+    }
+}
+
 template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates,
                                                                                              storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
                                                                                              std::set<storm::expressions::Variable> const& rowMetaVariables,
@@ -102,6 +335,20 @@ template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeR
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
     std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+template std::vector<TransitionRelationPart<storm::dd::DdType::CUDD>> partitionTransitionRelation(
+    std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> const& relations, std::vector<std::set<storm::expressions::Variable>> const& rowMetaVariableGroups,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+template std::vector<TransitionRelationPart<storm::dd::DdType::Sylvan>> partitionTransitionRelation(
+    std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> const& relations, std::vector<std::set<storm::expressions::Variable>> const& rowMetaVariableGroups,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
+template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> computeReachableStates(
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, std::vector<TransitionRelationPart<storm::dd::DdType::CUDD>> const& parts,
+    storm::builder::DdReachabilityStrategy strategy);
+template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeReachableStates(
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, std::vector<TransitionRelationPart<storm::dd::DdType::Sylvan>> const& parts,
+    storm::builder::DdReachabilityStrategy strategy);
+
 template storm::dd::Bdd<storm::dd::DdType::CUDD> computeBackwardsReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates,
                                                                                  storm::dd::Bdd<storm::dd::DdType::CUDD> const& constraintStates,
                                                                                  storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
@@ -113,6 +360,15 @@ template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeBackwardsReachableStat
                                                                                    std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                                    std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+template std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> computeTopologicalLevels(
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& states, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> computeTopologicalLevels(
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
 template storm::dd::Bdd<storm::dd::DdType::CUDD> getRowColumnDiagonal(
     storm::dd::DdManager<storm::dd::DdType::CUDD> const& ddManager,
     std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
@@ -120,6 +376,9 @@ template storm::dd::Bdd<storm::dd::DdType::Sylvan> getRowColumnDiagonal(
     storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager,
     std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
+template void reorderVariables(storm::dd::DdManager<storm::dd::DdType::CUDD>& ddManager, storm::dd::Bdd<storm::dd::DdType::CUDD> const& dd);
+template void reorderVariables(storm::dd::DdManager<storm::dd::DdType::Sylvan>& ddManager, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& dd);
+
 }  // namespace dd
 }  // namespace utility
 }  // namespace storm
@@ -4,12 +4,11 @@
 #include <set>
 #include <vector>
 
+#include "storm/builder/DdReachabilityStrategy.h"
 #include "storm/storage/dd/DdType.h"
+#include "storm/storage/expressions/Variable.h"
 
 namespace storm {
-namespace expressions {
-class Variable;
-}
 namespace dd {
 template<storm::dd::DdType Type>
 class DdManager;
@@ -29,11 +28,68 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
                                                                  std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                  std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+/*!
+ * A part of a partitioned transition relation. The part only changes the values of the given meta variables, so its relation is only defined over their row
+ * and column variables and the row variables of the meta variables it reads. All other meta variables keep their values.
+ */
+template<storm::dd::DdType Type>
+struct TransitionRelationPart {
+    storm::dd::Bdd<Type> relation;
+    std::set<storm::expressions::Variable> rowMetaVariables;
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs;
+};
+
+/*!
+ * Partitions the given transition relations for a partitioned reachability analysis. Every relation whose transitions change the variables of more than
+ * one of the given groups (e.g., the variables of the modules) is split into the transitions that only change the variables of one group (and the variables
+ * not belonging to any group) and the remaining transitions. Then, every part is restricted to the variables it actually changes. Parts without transitions
+ * that change a variable are dropped.
+ *
+ * @param relations The relations over the given row and column variables. Their union is the transition relation to partition.
+ * @param rowMetaVariableGroups Disjoint groups of row meta variables.
+ * @param rowColumnMetaVariablePairs All pairs of row and column meta variables.
+ * @return The parts of the transition relation.
+ */
+template<storm::dd::DdType Type>
+std::vector<TransitionRelationPart<Type>> partitionTransitionRelation(
+    std::vector<storm::dd::Bdd<Type>> const& relations, std::vector<std::set<storm::expressions::Variable>> const& rowMetaVariableGroups,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
+/*!
+ * Computes the states reachable from the given initial states with respect to the partitioned transition relation. Compared to a breadth-first search over
+ * the monolithic relation, chaining and saturation typically keep the intermediate BDDs much smaller for asynchronous models.
+ *
+ * @param initialStates The initial states.
+ * @param parts The parts of the transition relation (see partitionTransitionRelation).
+ * @param strategy The order in which the parts are applied.
+ * @return The reachable states and the number of image computations.
+ */
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates,
+                                                                 std::vector<TransitionRelationPart<Type>> const& parts,
+                                                                 storm::builder::DdReachabilityStrategy strategy);
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates,
                                                      storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                      std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+/*!
+ * Computes a coarse topological decomposition of the given states into levels. Every level is a union of SCCs and all transitions leaving a level lead
+ * to earlier levels, so the levels can be solved one after another. States whose only remaining successors are the states themselves are collected
+ * into one level at once. Otherwise, the states reachable from a single (arbitrary) state form the next level, where the SCC of that state is split
+ * off if it does not cover all of them.
+ *
+ * @param states The states to decompose.
+ * @param transitions The transitions over the given row and column variables.
+ * @return The levels in the order in which they can be solved.
+ */
+template<storm::dd::DdType Type>
+std::vector<storm::dd::Bdd<Type>> computeTopologicalLevels(
+    storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Add<Type, ValueType> getRowColumnDiagonal(
     storm::dd::DdManager<Type> const& ddManager,
@@ -43,6 +99,13 @@ template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager,
                                           std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
+/*!
+ * Reorders the DD variables of the given manager using the reordering technique of the DD library (if the library supports it) and reports how the size of
+ * the given DD changed.
+ */
+template<storm::dd::DdType Type>
+void reorderVariables(storm::dd::DdManager<Type>& ddManager, storm::dd::Bdd<Type> const& dd);
+
 }  // namespace dd
 }  // namespace utility
 }  // namespace storm
@@ -23,6 +23,10 @@
 #include "storm/models/symbolic/StochasticTwoPlayerGame.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/LevelSynchronousBackwardSearch.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -318,65 +322,28 @@ std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<T> const& t
     return distances;
 }
 
-template<typename T>
-storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                              storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
-    // Prepare the resulting bit vector.
-    uint_fast64_t numberOfStates = phiStates.size();
-    storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
-
-    // Add all psi states as they already satisfy the condition.
-    statesWithProbabilityGreater0 |= psiStates;
-
-    // Initialize the stack used for the DFS with the states.
-    std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
+namespace {
 
-    // Initialize the stack for the step bound, if the number of steps is bounded.
-    std::vector<uint_fast64_t> stepStack;
-    std::vector<uint_fast64_t> remainingSteps;
-    if (useStepBound) {
-        stepStack.reserve(numberOfStates);
-        stepStack.insert(stepStack.begin(), psiStates.getNumberOfSetBits(), maximalSteps);
-        remainingSteps.resize(numberOfStates);
-        for (auto state : psiStates) {
-            remainingSteps[state] = maximalSteps;
-        }
+/*!
+ * Retrieves the number of threads with which the levels of the backward searches are expanded.
+ */
+uint64_t getNumberOfThreadsForBackwardSearch() {
+    if (storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+        return storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads();
     }
+    return 1;
+}
 
-    // Perform the actual DFS.
-    uint_fast64_t currentState, currentStepBound;
-    while (!stack.empty()) {
-        currentState = stack.back();
-        stack.pop_back();
-
-        if (useStepBound) {
-            currentStepBound = stepStack.back();
-            stepStack.pop_back();
-            if (currentStepBound == 0) {
-                continue;
-            }
-        }
-
-        for (typename storm::storage::SparseMatrix<T>::const_iterator entryIt = backwardTransitions.begin(currentState),
-                                                                      entryIte = backwardTransitions.end(currentState);
-             entryIt != entryIte; ++entryIt) {
-            if (phiStates[entryIt->getColumn()] &&
-                (!statesWithProbabilityGreater0.get(entryIt->getColumn()) || (useStepBound && remainingSteps[entryIt->getColumn()] < currentStepBound - 1))) {
-                statesWithProbabilityGreater0.set(entryIt->getColumn(), true);
-
-                // If we don't have a bound on the number of steps to take, just add the state to the stack.
-                if (useStepBound) {
-                    // As there is at least one more step to go, we need to push the state and the new number of steps.
-                    remainingSteps[entryIt->getColumn()] = currentStepBound - 1;
-                    stepStack.push_back(currentStepBound - 1);
-                }
-                stack.push_back(entryIt->getColumn());
-            }
-        }
-    }
+}  // namespace
 
-    // Return result.
-    return statesWithProbabilityGreater0;
+template<typename T>
+storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                              storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+    // Every phi state that has a reached successor is reached as well.
+    LevelSynchronousBackwardSearch<T> search(backwardTransitions, getNumberOfThreadsForBackwardSearch());
+    return search.search(
+        phiStates, psiStates, [](uint64_t, storm::storage::BitVector const&) { return true; }, false,
+        useStepBound ? std::optional<uint64_t>(maximalSteps) : std::nullopt);
 }
 
 template<typename T>
@@ -401,7 +368,7 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(st
                                                                               storm::storage::BitVector const& phiStates,
                                                                               storm::storage::BitVector const& psiStates) {
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
-    storm::storage::SparseMatrix<T> backwardTransitions = model.getBackwardTransitions();
+    storm::storage::SparseMatrix<T> const& backwardTransitions = model.getBackwardTransitions();
     result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
     result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
     result.first.complement();
@@ -412,6 +379,8 @@ template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                               storm::storage::BitVector const& phiStates,
                                                                               storm::storage::BitVector const& psiStates) {
+    storm::utility::ProfilerPhase phase("prob01");
+    phase.addCounter("states", backwardTransitions.getRowCount());
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
     result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
     result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
@@ -688,61 +657,11 @@ void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm
 template<typename T>
 storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
-    size_t numberOfStates = phiStates.size();
-
-    // Prepare resulting bit vector.
-    storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
-
-    // Add all psi states as the already satisfy the condition.
-    statesWithProbabilityGreater0 |= psiStates;
-
-    // Initialize the stack used for the DFS with the states
-    std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
-
-    // Initialize the stack for the step bound, if the number of steps is bounded.
-    std::vector<uint_fast64_t> stepStack;
-    std::vector<uint_fast64_t> remainingSteps;
-    if (useStepBound) {
-        stepStack.reserve(numberOfStates);
-        stepStack.insert(stepStack.begin(), psiStates.getNumberOfSetBits(), maximalSteps);
-        remainingSteps.resize(numberOfStates);
-        for (auto state : psiStates) {
-            remainingSteps[state] = maximalSteps;
-        }
-    }
-
-    // Perform the actual DFS.
-    uint_fast64_t currentState, currentStepBound;
-    while (!stack.empty()) {
-        currentState = stack.back();
-        stack.pop_back();
-
-        if (useStepBound) {
-            currentStepBound = stepStack.back();
-            stepStack.pop_back();
-            if (currentStepBound == 0) {
-                continue;
-            }
-        }
-
-        for (typename storm::storage::SparseMatrix<T>::const_iterator entryIt = backwardTransitions.begin(currentState),
-                                                                      entryIte = backwardTransitions.end(currentState);
-             entryIt != entryIte; ++entryIt) {
-            if (phiStates.get(entryIt->getColumn()) &&
-                (!statesWithProbabilityGreater0.get(entryIt->getColumn()) || (useStepBound && remainingSteps[entryIt->getColumn()] < currentStepBound - 1))) {
-                // If we don't have a bound on the number of steps to take, just add the state to the stack.
-                if (useStepBound) {
-                    // If there is at least one more step to go, we need to push the state and the new number of steps.
-                    remainingSteps[entryIt->getColumn()] = currentStepBound - 1;
-                    stepStack.push_back(currentStepBound - 1);
-                }
-                statesWithProbabilityGreater0.set(entryIt->getColumn(), true);
-                stack.push_back(entryIt->getColumn());
-            }
-        }
-    }
-
-    return statesWithProbabilityGreater0;
+    // Every phi state that has a reached successor is reached as well.
+    LevelSynchronousBackwardSearch<T> search(backwardTransitions, getNumberOfThreadsForBackwardSearch());
+    return search.search(
+        phiStates, psiStates, [](uint64_t, storm::storage::BitVector const&) { return true; }, false,
+        useStepBound ? std::optional<uint64_t>(maximalSteps) : std::nullopt);
 }
 
 template<typename T>
@@ -759,66 +678,40 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
     size_t numberOfStates = phiStates.size();
+    LevelSynchronousBackwardSearch<T> search(backwardTransitions, getNumberOfThreadsForBackwardSearch());
 
-    // Initialize the environment for the iterative algorithm.
+    // A phi state is added if, for one of its nondeterministic choices, all successors are in the current state set and one of them is reached.
     storm::storage::BitVector currentStates(numberOfStates, true);
-    std::vector<uint_fast64_t> stack;
-    stack.reserve(numberOfStates);
-
-    // Perform the loop as long as the set of states gets larger.
-    bool done = false;
-    uint_fast64_t currentState;
-    while (!done) {
-        stack.clear();
-        storm::storage::BitVector nextStates(psiStates);
-        stack.insert(stack.end(), psiStates.begin(), psiStates.end());
-
-        while (!stack.empty()) {
-            currentState = stack.back();
-            stack.pop_back();
-
-            for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState),
-                                                                          predecessorEntryIte = backwardTransitions.end(currentState);
-                 predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-                if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
-                    // Check whether the predecessor has only successors in the current state set for one of the
-                    // nondeterminstic choices.
-                    for (uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()];
-                         row < nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1]; ++row) {
-                        if (!choiceConstraint || choiceConstraint.get().get(row)) {
-                            bool allSuccessorsInCurrentStates = true;
-                            bool hasNextStateSuccessor = false;
-                            for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row),
-                                                                                          successorEntryIte = transitionMatrix.end(row);
-                                 successorEntryIt != successorEntryIte; ++successorEntryIt) {
-                                if (!currentStates.get(successorEntryIt->getColumn())) {
-                                    allSuccessorsInCurrentStates = false;
-                                    break;
-                                } else if (nextStates.get(successorEntryIt->getColumn())) {
-                                    hasNextStateSuccessor = true;
-                                }
-                            }
-
-                            // If all successors for a given nondeterministic choice are in the current state set, we
-                            // add it to the set of states for the next iteration and perform a backward search from
-                            // that state.
-                            if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
-                                nextStates.set(predecessorEntryIt->getColumn(), true);
-                                stack.push_back(predecessorEntryIt->getColumn());
-                                break;
-                            }
-                        }
+    auto hasChoiceToReachedStates = [&](uint64_t state, storm::storage::BitVector const& reachedStates) {
+        for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+            if (!choiceConstraint || choiceConstraint.get().get(row)) {
+                bool allSuccessorsInCurrentStates = true;
+                bool hasNextStateSuccessor = false;
+                for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                    if (!currentStates.get(successorEntry.getColumn())) {
+                        allSuccessorsInCurrentStates = false;
+                        break;
+                    } else if (reachedStates.get(successorEntry.getColumn())) {
+                        hasNextStateSuccessor = true;
                     }
                 }
+                if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
+                    return true;
+                }
             }
         }
+        return false;
+    };
+
+    // Perform the loop as long as the set of states gets smaller.
+    while (true) {
+        storm::storage::BitVector nextStates = search.search(phiStates, psiStates, hasChoiceToReachedStates, true);
 
         // Check whether we need to perform an additional iteration.
         if (currentStates == nextStates) {
-            done = true;
-        } else {
-            currentStates = std::move(nextStates);
+            break;
         }
+        currentStates = std::move(nextStates);
     }
 
     return currentStates;
@@ -837,6 +730,8 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates) {
+    storm::utility::ProfilerPhase phase("prob01max");
+    phase.addCounter("states", transitionMatrix.getRowGroupCount());
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
 
     result.first = performProb0A(backwardTransitions, phiStates, psiStates);
@@ -859,117 +754,28 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
                                                storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
                                                boost::optional<storm::storage::BitVector> const& choiceConstraint) {
-    size_t numberOfStates = phiStates.size();
-
-    // Prepare resulting bit vector.
-    storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
-
-    // Add all psi states as the already satisfy the condition.
-    statesWithProbabilityGreater0 |= psiStates;
-
-    // Initialize the stack used for the DFS with the states
-    std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
-
-    // Initialize the stack for the step bound, if the number of steps is bounded.
-    std::vector<uint_fast64_t> stepStack;
-    std::vector<uint_fast64_t> remainingSteps;
-    if (useStepBound) {
-        stepStack.reserve(numberOfStates);
-        stepStack.insert(stepStack.begin(), psiStates.getNumberOfSetBits(), maximalSteps);
-        remainingSteps.resize(numberOfStates);
-        for (auto state : psiStates) {
-            remainingSteps[state] = maximalSteps;
+    LevelSynchronousBackwardSearch<T> search(backwardTransitions, getNumberOfThreadsForBackwardSearch());
+
+    // A phi state is added if it has at least one nondeterministic choice within the possibly given choiceConstraint and every such choice has a
+    // reached successor.
+    auto allChoicesHaveReachedSuccessor = [&](uint64_t state, storm::storage::BitVector const& reachedStates) {
+        uint_fast64_t row = nondeterministicChoiceIndices[state];
+        uint_fast64_t const endOfGroup = nondeterministicChoiceIndices[state + 1];
+        if (row == endOfGroup || (choiceConstraint && choiceConstraint->getNextSetIndex(row) >= endOfGroup)) {
+            return false;
         }
-    }
-
-    // Perform the actual DFS.
-    uint_fast64_t currentState, currentStepBound;
-    while (!stack.empty()) {
-        currentState = stack.back();
-        stack.pop_back();
-
-        if (useStepBound) {
-            currentStepBound = stepStack.back();
-            stepStack.pop_back();
-            if (currentStepBound == 0) {
-                continue;
-            }
-        }
-
-        for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState),
-                                                                      predecessorEntryIte = backwardTransitions.end(currentState);
-             predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-            if (phiStates.get(predecessorEntryIt->getColumn())) {
-                if (!statesWithProbabilityGreater0.get(predecessorEntryIt->getColumn())) {
-                    // Check whether the predecessor has at least one successor in the current state set for every
-                    // nondeterministic choice within the possibly given choiceConstraint.
-
-                    // Note: The backwards edge might be induced by a choice that violates the choiceConstraint.
-                    // However this is not problematic as long as there is at least one enabled choice for the predecessor.
-                    uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()];
-                    uint_fast64_t const& endOfGroup = nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1];
-                    if (!choiceConstraint || choiceConstraint->getNextSetIndex(row) < endOfGroup) {
-                        bool addToStatesWithProbabilityGreater0 = true;
-                        for (; row < endOfGroup; ++row) {
-                            if (!choiceConstraint || choiceConstraint->get(row)) {
-                                bool hasAtLeastOneSuccessorWithProbabilityGreater0 = false;
-                                for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row),
-                                                                                              successorEntryIte = transitionMatrix.end(row);
-                                     successorEntryIt != successorEntryIte; ++successorEntryIt) {
-                                    if (statesWithProbabilityGreater0.get(successorEntryIt->getColumn())) {
-                                        hasAtLeastOneSuccessorWithProbabilityGreater0 = true;
-                                        break;
-                                    }
-                                }
-
-                                if (!hasAtLeastOneSuccessorWithProbabilityGreater0) {
-                                    addToStatesWithProbabilityGreater0 = false;
-                                    break;
-                                }
-                            }
-                        }
-
-                        // If we need to add the state, then actually add it and perform further search from the state.
-                        if (addToStatesWithProbabilityGreater0) {
-                            // If we don't have a bound on the number of steps to take, just add the state to the stack.
-                            if (useStepBound) {
-                                // If there is at least one more step to go, we need to push the state and the new number of steps.
-                                remainingSteps[predecessorEntryIt->getColumn()] = currentStepBound - 1;
-                                stepStack.push_back(currentStepBound - 1);
-                            }
-                            statesWithProbabilityGreater0.set(predecessorEntryIt->getColumn(), true);
-                            stack.push_back(predecessorEntryIt->getColumn());
-                        }
-                    }
-
-                } else if (useStepBound && remainingSteps[predecessorEntryIt->getColumn()] < currentStepBound - 1) {
-                    // We have found a shorter path to the predecessor. Hence, we need to explore it again.
-                    // If there is a choiceConstraint, we still need to check whether the backwards edge was induced by a valid action
-                    bool predecessorIsValid = true;
-                    if (choiceConstraint) {
-                        predecessorIsValid = false;
-                        uint_fast64_t row = choiceConstraint->getNextSetIndex(nondeterministicChoiceIndices[predecessorEntryIt->getColumn()]);
-                        uint_fast64_t const& endOfGroup = nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1];
-                        for (; row < endOfGroup && !predecessorIsValid; row = choiceConstraint->getNextSetIndex(row + 1)) {
-                            for (auto const& entry : transitionMatrix.getRow(row)) {
-                                if (entry.getColumn() == currentState) {
-                                    predecessorIsValid = true;
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                    if (predecessorIsValid) {
-                        remainingSteps[predecessorEntryIt->getColumn()] = currentStepBound - 1;
-                        stepStack.push_back(currentStepBound - 1);
-                        stack.push_back(predecessorEntryIt->getColumn());
-                    }
+        for (; row < endOfGroup; ++row) {
+            if (!choiceConstraint || choiceConstraint->get(row)) {
+                auto successors = transitionMatrix.getRow(row);
+                if (std::none_of(successors.begin(), successors.end(),
+                                 [&reachedStates](auto const& successorEntry) { return reachedStates.get(successorEntry.getColumn()); })) {
+                    return false;
                 }
             }
         }
-    }
-
-    return statesWithProbabilityGreater0;
+        return true;
+    };
+    return search.search(phiStates, psiStates, allChoicesHaveReachedSuccessor, true, useStepBound ? std::optional<uint64_t>(maximalSteps) : std::nullopt);
 }
 
 template<typename T, typename RM>
@@ -1006,71 +812,41 @@ storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& t
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates) {
     size_t numberOfStates = phiStates.size();
+    LevelSynchronousBackwardSearch<T> search(backwardTransitions, getNumberOfThreadsForBackwardSearch());
 
-    // Initialize the environment for the iterative algorithm.
+    // A phi state is added if it has a nondeterministic choice and, for all of them, all successors are in the current state set and one of them is
+    // reached.
     storm::storage::BitVector currentStates(numberOfStates, true);
-    std::vector<uint_fast64_t> stack;
-    stack.reserve(numberOfStates);
-
-    // Perform the loop as long as the set of states gets smaller.
-    bool done = false;
-    uint_fast64_t currentState;
-    while (!done) {
-        stack.clear();
-        storm::storage::BitVector nextStates(psiStates);
-        stack.insert(stack.end(), psiStates.begin(), psiStates.end());
-
-        while (!stack.empty()) {
-            currentState = stack.back();
-            stack.pop_back();
-
-            for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState),
-                                                                          predecessorEntryIte = backwardTransitions.end(currentState);
-                 predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-                if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
-                    // Check whether the predecessor has only successors in the current state set for all of the
-                    // nondeterminstic choices and that for each choice there exists a successor that is already
-                    // in the next states.
-                    bool addToStatesWithProbability1 = true;
-                    for (uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()];
-                         row < nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1]; ++row) {
-                        bool hasAtLeastOneSuccessorWithProbability1 = false;
-                        for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row),
-                                                                                      successorEntryIte = transitionMatrix.end(row);
-                             successorEntryIt != successorEntryIte; ++successorEntryIt) {
-                            if (!currentStates.get(successorEntryIt->getColumn())) {
-                                addToStatesWithProbability1 = false;
-                                goto afterCheckLoop;
-                            }
-                            if (nextStates.get(successorEntryIt->getColumn())) {
-                                hasAtLeastOneSuccessorWithProbability1 = true;
-                            }
-                        }
-
-                        if (!hasAtLeastOneSuccessorWithProbability1) {
-                            addToStatesWithProbability1 = false;
-                            break;
-                        }
-                    }
-
-                afterCheckLoop:
-                    // If all successors for all nondeterministic choices are in the current state set, we
-                    // add it to the set of states for the next iteration and perform a backward search from
-                    // that state.
-                    if (addToStatesWithProbability1) {
-                        nextStates.set(predecessorEntryIt->getColumn(), true);
-                        stack.push_back(predecessorEntryIt->getColumn());
-                    }
+    auto allChoicesLeadToReachedStates = [&](uint64_t state, storm::storage::BitVector const& reachedStates) {
+        if (nondeterministicChoiceIndices[state] == nondeterministicChoiceIndices[state + 1]) {
+            return false;
+        }
+        for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+            bool hasAtLeastOneSuccessorWithProbability1 = false;
+            for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                if (!currentStates.get(successorEntry.getColumn())) {
+                    return false;
+                }
+                if (reachedStates.get(successorEntry.getColumn())) {
+                    hasAtLeastOneSuccessorWithProbability1 = true;
                 }
             }
+            if (!hasAtLeastOneSuccessorWithProbability1) {
+                return false;
+            }
         }
+        return true;
+    };
+
+    // Perform the loop as long as the set of states gets smaller.
+    while (true) {
+        storm::storage::BitVector nextStates = search.search(phiStates, psiStates, allChoicesLeadToReachedStates, true);
 
         // Check whether we need to perform an additional iteration.
         if (currentStates == nextStates) {
-            done = true;
-        } else {
-            currentStates = std::move(nextStates);
+            break;
         }
+        currentStates = std::move(nextStates);
     }
     return currentStates;
 }
@@ -1081,6 +857,8 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates) {
+    storm::utility::ProfilerPhase phase("prob01min");
+    phase.addCounter("states", transitionMatrix.getRowGroupCount());
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
     result.first = performProb0E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
     // Instead of calling performProb1A, we call the (more easier) performProb0A on the Prob0E states.
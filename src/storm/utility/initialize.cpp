@@ -4,6 +4,8 @@
 #include <fstream>
 #include <iostream>
 
+#include "storm/utility/mpi.h"
+
 namespace storm {
 namespace utility {
 
@@ -27,7 +29,7 @@ void setUp() {
 }
 
 void cleanUp() {
-    // Intentionally left empty.
+    storm::utility::mpi::finalize();
 }
 
 void setOutputDigits(int digits) {
@@ -0,0 +1,196 @@
+#include "storm/utility/mpi.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_MPI
+#include <mpi.h>
+#endif
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/UnexpectedException.h"
+#include "storm/utility/macros.h"
+
+namespace storm::utility::mpi {
+
+namespace detail {
+#ifdef STORM_HAVE_MPI
+// Whether MPI was initialized by Storm (and thus has to be finalized by Storm).
+static bool initializedByStorm = false;
+
+// The largest number of elements that is transferred with a single MPI call (the counts of MPI are of type int).
+static uint64_t const maximalMessageSize = static_cast<uint64_t>(std::numeric_limits<int>::max());
+
+void checkResult(int result, char const* operation) {
+    STORM_LOG_THROW(result == MPI_SUCCESS, storm::exceptions::UnexpectedException,
+                    "MPI operation " << operation << " failed with error code " << result << ".");
+}
+
+template<typename T>
+MPI_Datatype getDatatype();
+
+template<>
+MPI_Datatype getDatatype<double>() {
+    return MPI_DOUBLE;
+}
+
+template<>
+MPI_Datatype getDatatype<uint64_t>() {
+    return MPI_UINT64_T;
+}
+#endif
+}  // namespace detail
+
+bool isSupported() {
+#ifdef STORM_HAVE_MPI
+    return true;
+#else
+    return false;
+#endif
+}
+
+Communicator const& Communicator::world() {
+    static Communicator const communicator;
+    return communicator;
+}
+
+Communicator::Communicator() : rank(0), numberOfRanks(1) {
+#ifdef STORM_HAVE_MPI
+    int initialized = 0;
+    detail::checkResult(MPI_Initialized(&initialized), "MPI_Initialized");
+    if (!initialized) {
+        // Only the thread that initialized MPI communicates, the threads of parallel computations never do.
+        int provided = 0;
+        detail::checkResult(MPI_Init_thread(nullptr, nullptr, MPI_THREAD_FUNNELED, &provided), "MPI_Init_thread");
+        detail::initializedByStorm = true;
+    }
+    int worldRank = 0;
+    int worldSize = 1;
+    detail::checkResult(MPI_Comm_rank(MPI_COMM_WORLD, &worldRank), "MPI_Comm_rank");
+    detail::checkResult(MPI_Comm_size(MPI_COMM_WORLD, &worldSize), "MPI_Comm_size");
+    rank = static_cast<uint64_t>(worldRank);
+    numberOfRanks = static_cast<uint64_t>(worldSize);
+    STORM_LOG_INFO("Process " << rank << " of " << numberOfRanks << " joined the MPI job.");
+#endif
+}
+
+uint64_t Communicator::getRank() const {
+    return rank;
+}
+
+uint64_t Communicator::getNumberOfRanks() const {
+    return numberOfRanks;
+}
+
+bool Communicator::allReduceAnd(bool value) const {
+#ifdef STORM_HAVE_MPI
+    int local = value ? 1 : 0;
+    int global = 0;
+    detail::checkResult(MPI_Allreduce(&local, &global, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD), "MPI_Allreduce");
+    return global != 0;
+#else
+    return value;
+#endif
+}
+
+bool Communicator::allReduceOr(bool value) const {
+#ifdef STORM_HAVE_MPI
+    int local = value ? 1 : 0;
+    int global = 0;
+    detail::checkResult(MPI_Allreduce(&local, &global, 1, MPI_INT, MPI_LOR, MPI_COMM_WORLD), "MPI_Allreduce");
+    return global != 0;
+#else
+    return value;
+#endif
+}
+
+std::vector<uint64_t> Communicator::allToAll(std::vector<uint64_t> const& values) const {
+    STORM_LOG_THROW(values.size() == numberOfRanks, storm::exceptions::InvalidArgumentException, "Expected one value per process.");
+#ifdef STORM_HAVE_MPI
+    std::vector<uint64_t> result(numberOfRanks);
+    detail::checkResult(MPI_Alltoall(values.data(), 1, MPI_UINT64_T, result.data(), 1, MPI_UINT64_T, MPI_COMM_WORLD), "MPI_Alltoall");
+    return result;
+#else
+    return values;
+#endif
+}
+
+template<typename T>
+void Communicator::exchange(std::vector<std::vector<T>> const& sendBuffers, std::vector<std::vector<T>>& receiveBuffers) const {
+    STORM_LOG_THROW(sendBuffers.size() == numberOfRanks && receiveBuffers.size() == numberOfRanks, storm::exceptions::InvalidArgumentException,
+                    "Expected one buffer per process.");
+    // Data that this process sends to itself is not communicated.
+    STORM_LOG_THROW(sendBuffers[rank].size() == receiveBuffers[rank].size(), storm::exceptions::InvalidArgumentException,
+                    "The size of the receive buffer does not match.");
+    std::copy(sendBuffers[rank].begin(), sendBuffers[rank].end(), receiveBuffers[rank].begin());
+#ifdef STORM_HAVE_MPI
+    std::vector<MPI_Request> requests;
+    for (uint64_t peer = 0; peer < numberOfRanks; ++peer) {
+        if (peer != rank && !receiveBuffers[peer].empty()) {
+            STORM_LOG_THROW(receiveBuffers[peer].size() <= detail::maximalMessageSize, storm::exceptions::InvalidArgumentException, "Message too large.");
+            requests.emplace_back();
+            detail::checkResult(MPI_Irecv(receiveBuffers[peer].data(), static_cast<int>(receiveBuffers[peer].size()), detail::getDatatype<T>(),
+                                          static_cast<int>(peer), 0, MPI_COMM_WORLD, &requests.back()),
+                                "MPI_Irecv");
+        }
+    }
+    for (uint64_t peer = 0; peer < numberOfRanks; ++peer) {
+        if (peer != rank && !sendBuffers[peer].empty()) {
+            STORM_LOG_THROW(sendBuffers[peer].size() <= detail::maximalMessageSize, storm::exceptions::InvalidArgumentException, "Message too large.");
+            requests.emplace_back();
+            // Older MPI versions take a non-const pointer to the send buffer.
+            detail::checkResult(MPI_Isend(const_cast<T*>(sendBuffers[peer].data()), static_cast<int>(sendBuffers[peer].size()), detail::getDatatype<T>(),
+                                          static_cast<int>(peer), 0, MPI_COMM_WORLD, &requests.back()),
+                                "MPI_Isend");
+        }
+    }
+    detail::checkResult(MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE), "MPI_Waitall");
+#endif
+}
+
+std::vector<double> Communicator::allGather(std::vector<double> const& values, std::vector<uint64_t> const& counts) const {
+    STORM_LOG_THROW(counts.size() == numberOfRanks && counts[rank] == values.size(), storm::exceptions::InvalidArgumentException,
+                    "The counts do not match the number of values.");
+#ifdef STORM_HAVE_MPI
+    std::vector<double> result;
+    uint64_t totalCount = 0;
+    for (auto const& count : counts) {
+        totalCount += count;
+    }
+    result.resize(totalCount);
+    // The values of each process are broadcast in chunks, which (unlike MPI_Allgatherv) also works if the result has more than 2^31 entries.
+    uint64_t offset = 0;
+    for (uint64_t sender = 0; sender < numberOfRanks; ++sender) {
+        if (sender == rank) {
+            std::copy(values.begin(), values.end(), result.begin() + offset);
+        }
+        for (uint64_t chunkStart = 0; chunkStart < counts[sender]; chunkStart += detail::maximalMessageSize) {
+            uint64_t const chunkSize = std::min(detail::maximalMessageSize, counts[sender] - chunkStart);
+            detail::checkResult(
+                MPI_Bcast(result.data() + offset + chunkStart, static_cast<int>(chunkSize), MPI_DOUBLE, static_cast<int>(sender), MPI_COMM_WORLD),
+                "MPI_Bcast");
+        }
+        offset += counts[sender];
+    }
+    return result;
+#else
+    return values;
+#endif
+}
+
+void finalize() {
+#ifdef STORM_HAVE_MPI
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (detail::initializedByStorm && !finalized) {
+        MPI_Finalize();
+    }
+#endif
+}
+
+template void Communicator::exchange(std::vector<std::vector<double>> const& sendBuffers, std::vector<std::vector<double>>& receiveBuffers) const;
+template void Communicator::exchange(std::vector<std::vector<uint64_t>> const& sendBuffers, std::vector<std::vector<uint64_t>>& receiveBuffers) const;
+
+}  // namespace storm::utility::mpi
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace storm {
+namespace utility {
+namespace mpi {
+
+/*!
+ * Retrieves whether Storm was built with MPI support. Otherwise, the communicator only consists of the current process.
+ */
+bool isSupported();
+
+/*!
+ * Methods that determine which process of a distributed computation owns which state.
+ */
+enum class StatePartitioning {
+    // Every process owns a contiguous range of states. As the states are numbered in the order of their exploration, this keeps most transitions local.
+    Blocks,
+    // The states are distributed by a hash of their index, which balances the load even if the states of some range are much more expensive.
+    Hash
+};
+
+/*!
+ * The processes of the MPI job. All methods except getRank and getNumberOfRanks are collective, i.e., they have to be called by all processes in the
+ * same order.
+ */
+class Communicator {
+   public:
+    /*!
+     * Retrieves the communicator of all processes. MPI is initialized on the first call.
+     */
+    static Communicator const& world();
+
+    uint64_t getRank() const;
+    uint64_t getNumberOfRanks() const;
+
+    /*!
+     * Retrieves whether the given value holds for all processes.
+     */
+    bool allReduceAnd(bool value) const;
+
+    /*!
+     * Retrieves whether the given value holds for at least one process.
+     */
+    bool allReduceOr(bool value) const;
+
+    /*!
+     * Sends values[r] to process r and retrieves the values that the processes send to this process, i.e., the result at position r is what process
+     * r passed at the position of this process.
+     */
+    std::vector<uint64_t> allToAll(std::vector<uint64_t> const& values) const;
+
+    /*!
+     * Sends sendBuffers[r] to process r and receives the data of process r into receiveBuffers[r]. Empty buffers are neither sent nor received. The
+     * receive buffers must already have the size of the data sent to this process.
+     */
+    template<typename T>
+    void exchange(std::vector<std::vector<T>> const& sendBuffers, std::vector<std::vector<T>>& receiveBuffers) const;
+
+    /*!
+     * Concatenates the given values of all processes (in the order of their ranks).
+     *
+     * @param values The values of this process.
+     * @param counts The number of values of each process.
+     */
+    std::vector<double> allGather(std::vector<double> const& values, std::vector<uint64_t> const& counts) const;
+
+   private:
+    Communicator();
+
+    uint64_t rank;
+    uint64_t numberOfRanks;
+};
+
+/*!
+ * Finalizes MPI if it was initialized by Storm. Afterwards, no communication is possible.
+ */
+void finalize();
+
+}  // namespace mpi
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/TaskRuntime.h"
+#include "storm/utility/threads.h"
+
+namespace storm {
+namespace utility {
+namespace parallel {
+
+/*!
+ * Splits the range [begin, end) into (at most) the given number of contiguous chunks of (almost) equal size and processes each chunk on a separate
+ * thread. The calling thread processes the first chunk itself while the other chunks are processed by the workers of the task runtime (see
+ * storm/utility/TaskRuntime.h), which apply the timeout of the calling thread. If the function throws on any thread, the exception of the thread with the
+ * smallest index is rethrown on the calling thread once all threads have finished. If the thread affinity policy (see storm/utility/threads.h) binds threads
+ * to NUMA nodes or the call is nested in a task of the runtime, dedicated threads are started for the other chunks. In the former case, these threads are
+ * bound accordingly. The calling thread is not bound as the binding would outlast the call.
+ *
+ * @param numberOfThreads The maximal number of threads to use (including the calling thread).
+ * @param begin The first index of the range.
+ * @param end The index one past the last index of the range.
+ * @param function The function to call for each chunk. It is invoked as function(threadIndex, chunkBegin, chunkEnd).
+ * @return The number of chunks that were processed, i.e., the number of thread indices that have been used.
+ */
+template<typename IndexType, typename Function>
+uint64_t forEachChunk(uint64_t numberOfThreads, IndexType begin, IndexType end, Function const& function) {
+    if (end <= begin) {
+        return 0;
+    }
+    uint64_t const rangeSize = static_cast<uint64_t>(end - begin);
+    uint64_t const numberOfChunks = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, rangeSize));
+    if (numberOfChunks == 1) {
+        function(static_cast<uint64_t>(0), begin, end);
+        return 1;
+    }
+
+    uint64_t const chunkSize = rangeSize / numberOfChunks;
+    uint64_t const remainder = rangeSize % numberOfChunks;
+    auto chunkBegin = [&](uint64_t chunk) { return begin + static_cast<IndexType>(chunk * chunkSize + std::min(chunk, remainder)); };
+
+    std::vector<std::exception_ptr> exceptions(numberOfChunks);
+    auto processChunk = [&](uint64_t chunk) {
+        try {
+            function(chunk, chunkBegin(chunk), chunkBegin(chunk + 1));
+        } catch (...) {
+            exceptions[chunk] = std::current_exception();
+        }
+    };
+    bool const bindThreads = storm::utility::getThreadAffinityPolicy() == storm::utility::ThreadAffinityPolicy::NumaNodes;
+    if (bindThreads || TaskRuntime::isWorkerThread()) {
+        // Tasks of the runtime would be executed on the calling worker (and on arbitrary processors), so we use dedicated threads.
+        auto const deadline = storm::utility::resources::detail::threadDeadline;
+        std::vector<std::thread> threads;
+        threads.reserve(numberOfChunks - 1);
+        for (uint64_t chunk = 1; chunk < numberOfChunks; ++chunk) {
+            threads.emplace_back([&, chunk]() {
+                if (bindThreads) {
+                    storm::utility::bindCurrentThreadToNumaNode(chunk, numberOfChunks);
+                }
+                storm::utility::resources::detail::threadDeadline = deadline;
+                processChunk(chunk);
+            });
+        }
+        processChunk(0);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    } else {
+        TaskGroup group;
+        for (uint64_t chunk = 1; chunk < numberOfChunks; ++chunk) {
+            group.run([&processChunk, chunk]() { processChunk(chunk); });
+        }
+        processChunk(0);
+        group.wait();
+    }
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+    return numberOfChunks;
+}
+
+/*!
+ * Processes the range [begin, end) with (at most) the given number of threads, where every thread repeatedly grabs the next block of the given size
+ * until the range is exhausted. In contrast to forEachChunk, this balances the load if the work per index varies strongly.
+ *
+ * @param numberOfThreads The maximal number of threads to use (including the calling thread).
+ * @param begin The first index of the range.
+ * @param end The index one past the last index of the range.
+ * @param blockSize The number of indices that a thread grabs at once.
+ * @param function The function to call for each block. It is invoked as function(threadIndex, blockBegin, blockEnd).
+ */
+template<typename IndexType, typename Function>
+void forEachBlock(uint64_t numberOfThreads, IndexType begin, IndexType end, uint64_t blockSize, Function const& function) {
+    if (end <= begin) {
+        return;
+    }
+    blockSize = std::max<uint64_t>(1, blockSize);
+    uint64_t const numberOfBlocks = (static_cast<uint64_t>(end - begin) + blockSize - 1) / blockSize;
+    std::mutex mutex;
+    uint64_t nextBlock = 0;
+    forEachChunk(std::min(numberOfThreads, numberOfBlocks), static_cast<uint64_t>(0), numberOfBlocks, [&](uint64_t threadIndex, uint64_t, uint64_t) {
+        while (true) {
+            uint64_t block;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (nextBlock == numberOfBlocks) {
+                    return;
+                }
+                block = nextBlock++;
+            }
+            IndexType const blockBegin = begin + static_cast<IndexType>(block * blockSize);
+            IndexType const blockEnd = std::min<IndexType>(end, blockBegin + static_cast<IndexType>(blockSize));
+            function(threadIndex, blockBegin, blockEnd);
+        }
+    });
+}
+
+/*!
+ * Processes tasks that depend on each other with (at most) the given number of threads. A task is ready as soon as all tasks it depends on are finished.
+ * Every thread keeps the tasks that became ready by finishing one of its own tasks in a local queue and steals ready tasks from the other threads once its
+ * queue runs empty. If the function throws on any thread, no further tasks are started and the exception is rethrown on the calling thread.
+ *
+ * @param numberOfThreads The maximal number of threads to use (including the calling thread).
+ * @param dependencyCounts For each task, the number of (not necessarily distinct) dependencies, i.e., how often it occurs in the dependents below.
+ * @param dependentOffsets For each task i, the dependents of i are given by dependents[dependentOffsets[i]], ..., dependents[dependentOffsets[i + 1] - 1].
+ * @param dependents The tasks that depend on each task (see above).
+ * @param function The function to call for each task. It is invoked as function(threadIndex, task) and may return false to stop the processing, in which
+ * case no further tasks are started.
+ * @return True iff all tasks were processed.
+ */
+template<typename Function>
+bool forEachInDependencyOrder(uint64_t numberOfThreads, std::vector<uint64_t> const& dependencyCounts, std::vector<uint64_t> const& dependentOffsets,
+                              std::vector<uint64_t> const& dependents, Function const& function) {
+    uint64_t const numberOfTasks = dependencyCounts.size();
+    numberOfThreads = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, numberOfTasks));
+    std::vector<std::atomic<uint64_t>> remainingDependencies(numberOfTasks);
+    std::vector<std::deque<uint64_t>> queues(numberOfThreads);
+    std::vector<std::mutex> queueMutexes(numberOfThreads);
+    for (uint64_t task = 0, nextThread = 0; task < numberOfTasks; ++task) {
+        remainingDependencies[task].store(dependencyCounts[task], std::memory_order_relaxed);
+        if (dependencyCounts[task] == 0) {
+            queues[nextThread].push_back(task);
+            nextThread = (nextThread + 1) % numberOfThreads;
+        }
+    }
+
+    std::atomic<uint64_t> remainingTasks(numberOfTasks);
+    std::atomic<bool> stopped(false);
+    auto popTask = [&](uint64_t threadIndex, uint64_t& task) {
+        // Take the most recent task of the own queue (whose data is likely still cached) or the oldest task of another queue.
+        for (uint64_t offset = 0; offset < numberOfThreads; ++offset) {
+            uint64_t const queueIndex = (threadIndex + offset) % numberOfThreads;
+            std::lock_guard<std::mutex> lock(queueMutexes[queueIndex]);
+            auto& queue = queues[queueIndex];
+            if (!queue.empty()) {
+                if (offset == 0) {
+                    task = queue.back();
+                    queue.pop_back();
+                } else {
+                    task = queue.front();
+                    queue.pop_front();
+                }
+                return true;
+            }
+        }
+        return false;
+    };
+    forEachChunk(numberOfThreads, static_cast<uint64_t>(0), numberOfThreads, [&](uint64_t threadIndex, uint64_t, uint64_t) {
+        uint64_t task;
+        while (remainingTasks.load() > 0 && !stopped.load()) {
+            if (!popTask(threadIndex, task)) {
+                std::this_thread::yield();
+                continue;
+            }
+            try {
+                if (!function(threadIndex, task)) {
+                    stopped.store(true);
+                }
+            } catch (...) {
+                stopped.store(true);
+                throw;
+            }
+            for (uint64_t index = dependentOffsets[task], indexEnd = dependentOffsets[task + 1]; index != indexEnd; ++index) {
+                uint64_t const dependent = dependents[index];
+                if (remainingDependencies[dependent].fetch_sub(1) == 1) {
+                    std::lock_guard<std::mutex> lock(queueMutexes[threadIndex]);
+                    queues[threadIndex].push_back(dependent);
+                }
+            }
+            remainingTasks.fetch_sub(1);
+        }
+    });
+    return remainingTasks.load() == 0;
+}
+
+/*!
+ * An allocator that default-initializes (instead of value-initializes) the elements of a vector when it is resized, i.e., trivial elements are left
+ * uninitialized. This allows to first touch the memory of a large vector with the threads that later operate on it, so that the operating system places
+ * each part of the vector on the NUMA node of the thread that uses it.
+ */
+template<typename T>
+class UninitializedAllocator : public std::allocator<T> {
+   public:
+    template<typename U>
+    struct rebind {
+        using other = UninitializedAllocator<U>;
+    };
+
+    UninitializedAllocator() = default;
+
+    template<typename U>
+    UninitializedAllocator(UninitializedAllocator<U> const& other) noexcept : std::allocator<T>(other) {
+        // Intentionally left empty.
+    }
+
+    template<typename U>
+    void construct(U* pointer) noexcept(std::is_nothrow_default_constructible<U>::value) {
+        ::new (static_cast<void*>(pointer)) U;
+    }
+
+    template<typename U, typename... Args>
+    void construct(U* pointer, Args&&... args) {
+        ::new (static_cast<void*>(pointer)) U(std::forward<Args>(args)...);
+    }
+};
+
+}  // namespace parallel
+}  // namespace utility
+}  // namespace storm
@@ -9,6 +9,7 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/utility/macros.h"
 
 namespace storm::utility::permutation {
@@ -28,13 +29,18 @@ std::string orderKindtoString(OrderKind order) {
             return "reverse-dfs";
         case OrderKind::Random:
             return "random";
+        case OrderKind::ReverseCuthillMcKee:
+            return "rcm";
+        case OrderKind::Topological:
+            return "topological";
     }
     STORM_LOG_ASSERT(false, "unreachable");
     return "";
 }
 
 OrderKind orderKindFromString(std::string const& order) {
-    for (auto kind : {OrderKind::Bfs, OrderKind::Dfs, OrderKind::ReverseBfs, OrderKind::ReverseDfs, OrderKind::Random}) {
+    for (auto kind : {OrderKind::Bfs, OrderKind::Dfs, OrderKind::ReverseBfs, OrderKind::ReverseDfs, OrderKind::Random, OrderKind::ReverseCuthillMcKee,
+                      OrderKind::Topological}) {
         if (order == orderKindtoString(kind)) {
             return kind;
         }
@@ -45,7 +51,8 @@ OrderKind orderKindFromString(std::string const& order) {
 
 std::vector<std::string> orderKinds() {
     std::vector<std::string> kinds;
-    for (auto kind : {OrderKind::Bfs, OrderKind::Dfs, OrderKind::ReverseBfs, OrderKind::ReverseDfs, OrderKind::Random}) {
+    for (auto kind : {OrderKind::Bfs, OrderKind::Dfs, OrderKind::ReverseBfs, OrderKind::ReverseDfs, OrderKind::Random, OrderKind::ReverseCuthillMcKee,
+                      OrderKind::Topological}) {
         kinds.push_back(orderKindtoString(kind));
     }
     return kinds;
@@ -65,11 +72,87 @@ std::vector<index_type> createRandomPermutation(index_type size, index_type seed
     return permutation;
 }
 
+/*!
+ * Creates the reverse Cuthill-McKee order of the graph in which two states are adjacent if there is a transition between them (in either direction).
+ * Each connected component is traversed in breadth-first order starting from an unvisited state of minimal degree, where the neighbors of a state are
+ * visited in the order of increasing degree. The resulting traversal is then reversed.
+ * @return a vector v such that v[i] is the state placed at position i.
+ */
+template<typename ValueType>
+std::vector<index_type> createReverseCuthillMcKeeOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    auto const numberOfStates = transitionMatrix.getRowGroupCount();
+    auto const backwardTransitions = transitionMatrix.transpose(true);
+    std::vector<index_type> degrees(numberOfStates);
+    for (index_type state = 0; state < numberOfStates; ++state) {
+        degrees[state] = transitionMatrix.getRowGroupEntryCount(state) + backwardTransitions.getRowGroupEntryCount(state);
+    }
+    std::vector<index_type> statesByDegree(numberOfStates);
+    std::iota(statesByDegree.begin(), statesByDegree.end(), 0);
+    std::stable_sort(statesByDegree.begin(), statesByDegree.end(), [&degrees](index_type lhs, index_type rhs) { return degrees[lhs] < degrees[rhs]; });
+
+    std::vector<index_type> order;
+    order.reserve(numberOfStates);
+    storm::storage::BitVector discoveredStates(numberOfStates, false);
+    std::vector<index_type> neighbors;
+    auto discover = [&discoveredStates, &neighbors](index_type state) {
+        if (!discoveredStates.get(state)) {
+            discoveredStates.set(state, true);
+            neighbors.push_back(state);
+        }
+    };
+    for (auto startState : statesByDegree) {
+        if (discoveredStates.get(startState)) {
+            continue;
+        }
+        discoveredStates.set(startState, true);
+        // The order vector doubles as the queue of the breadth-first search.
+        auto queueIndex = order.size();
+        order.push_back(startState);
+        while (queueIndex < order.size()) {
+            auto const current = order[queueIndex++];
+            neighbors.clear();
+            for (auto const& entry : transitionMatrix.getRowGroup(current)) {
+                discover(entry.getColumn());
+            }
+            for (auto const& entry : backwardTransitions.getRow(current)) {
+                discover(entry.getColumn());
+            }
+            std::stable_sort(neighbors.begin(), neighbors.end(), [&degrees](index_type lhs, index_type rhs) { return degrees[lhs] < degrees[rhs]; });
+            order.insert(order.end(), neighbors.begin(), neighbors.end());
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+/*!
+ * Orders the states along the topological order of the strongly connected components, i.e., states of bottom components come last.
+ * @return a vector v such that v[i] is the state placed at position i.
+ */
+template<typename ValueType>
+std::vector<index_type> createTopologicalOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    // The decomposition lists the components in reverse topological order.
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(
+        transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+    std::vector<index_type> order;
+    order.reserve(transitionMatrix.getRowGroupCount());
+    for (auto sccIndex = sccDecomposition.size(); sccIndex > 0; --sccIndex) {
+        auto const& scc = sccDecomposition.getBlock(sccIndex - 1);
+        order.insert(order.end(), scc.begin(), scc.end());
+    }
+    return order;
+}
+
 template<typename ValueType>
 std::vector<index_type> createPermutation(OrderKind order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                           storm::storage::BitVector const& initialStates) {
     if (order == OrderKind::Random) {
         return createRandomPermutation(transitionMatrix.getRowGroupCount());
+    } else if (order == OrderKind::ReverseCuthillMcKee) {
+        // The state at position i of the order shall be moved to position i.
+        return invertPermutation(createReverseCuthillMcKeeOrder(transitionMatrix));
+    } else if (order == OrderKind::Topological) {
+        return invertPermutation(createTopologicalOrder(transitionMatrix));
     }
     STORM_LOG_ASSERT((order == OrderKind::Bfs || order == OrderKind::Dfs || order == OrderKind::ReverseBfs || order == OrderKind::ReverseDfs),
                      "Unknown order kind");
@@ -103,6 +186,20 @@ std::vector<index_type> createPermutation(OrderKind order, storm::storage::Spars
     return permutation;
 }
 
+template<typename ValueType>
+double computeAverageIndexDistance(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    if (transitionMatrix.getEntryCount() == 0) {
+        return 0.0;
+    }
+    double distanceSum = 0.0;
+    for (index_type state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
+        for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+            distanceSum += entry.getColumn() > state ? entry.getColumn() - state : state - entry.getColumn();
+        }
+    }
+    return distanceSum / transitionMatrix.getEntryCount();
+}
+
 std::vector<index_type> invertPermutation(std::vector<index_type> const& permutation) {
     std::vector<index_type> inverted(permutation.size());
     for (index_type i = 0; i < permutation.size(); ++i) {
@@ -135,5 +232,8 @@ template std::vector<index_type> createPermutation(OrderKind order, storm::stora
                                                    storm::storage::BitVector const& initialStates);
 template std::vector<index_type> createPermutation(OrderKind order, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                    storm::storage::BitVector const& initialStates);
+template double computeAverageIndexDistance(storm::storage::SparseMatrix<double> const& transitionMatrix);
+template double computeAverageIndexDistance(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix);
+template double computeAverageIndexDistance(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix);
 
 }  // namespace storm::utility::permutation
\ No newline at end of file
@@ -17,8 +17,12 @@ using index_type = uint64_t;
 
 /*!
  * The order in which the states of a matrix are visited in a depth-first search or breadth-first search traversal.
+ * Besides these traversal orders, there are orders that aim at improving the memory locality of the solvers:
+ * - ReverseCuthillMcKee reduces the bandwidth of the (symmetrized) transition matrix, i.e., transitions tend to connect states with close indices.
+ * - Topological orders the states along the topological order of the strongly connected components, such that the successors of a state (outside of its
+ *   component) have larger indices. Backwards Gauss-Seidel iterations then always use the updated values of those successors.
  */
-enum class OrderKind { Bfs, Dfs, ReverseBfs, ReverseDfs, Random };
+enum class OrderKind { Bfs, Dfs, ReverseBfs, ReverseDfs, Random, ReverseCuthillMcKee, Topological };
 
 /*!
  * Converts the given order to a string.
@@ -57,12 +61,21 @@ std::vector<index_type> createRandomPermutation(index_type size, index_type seed
  * If the order is Dfs, i_1 is a successor of i_0, i_2 is a successor of i_1, etc. (assuming those successors exist).
  * If the order is Bfs, i_1 is the second initial state, ...
  *
+ * @note the orders ReverseCuthillMcKee and Topological do not depend on the initial states and contain all states.
+ *
  * @pre initialStates.size() == transitionMatrix.getRowGroupCount() == transitionMatrix.getColumnCount()
  */
 template<typename ValueType>
 std::vector<index_type> createPermutation(OrderKind order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                           storm::storage::BitVector const& initialStates);
 
+/*!
+ * Computes the average distance between the index of a row group and the column indices of its entries. Smaller values indicate that the values accessed
+ * while multiplying the matrix with a vector are closer to each other, which typically means fewer cache misses.
+ */
+template<typename ValueType>
+double computeAverageIndexDistance(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
 /*!
  * Inverts the given permutation.
  * @return a vector v such that v[permutation[i]] == permutation[v[i]] == i for all i.
@@ -265,12 +265,10 @@ void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
             // add shortest paths to predecessors plus edge to current node
             Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), 1,
                                                  shortestPathDistances[predecessor] * getEdgeDistance(predecessor, node)};
-            candidatePaths[node].insert(pathToPredecessorPlusEdge);
 
             // ... but not the actual shortest path
-            auto it = std::find(candidatePaths[node].begin(), candidatePaths[node].end(), shortestPathToNode);
-            if (it != candidatePaths[node].end()) {
-                candidatePaths[node].erase(it);
+            if (!(pathToPredecessorPlusEdge == shortestPathToNode)) {
+                candidatePaths[node].push(pathToPredecessorPlusEdge);
             }
         }
     }
@@ -298,22 +296,16 @@ void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
             // take that path, add an edge to the current node; that's a candidate
             Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), tailK + 1,
                                                  kShortestPaths[predecessor][tailK + 1 - 1].distance * getEdgeDistance(predecessor, node)};
-            candidatePaths[node].insert(pathToPredecessorPlusEdge);
+            candidatePaths[node].push(pathToPredecessorPlusEdge);
         }
         // else there was no path; TODO: does this need handling? -- yes, but not here (because the step B.1 may have added candidates)
     }
 
     // Step B.6 in J&M paper
+    // each candidate is generated exactly once, so the heap never contains duplicates
     if (!candidatePaths[node].empty()) {
-        Path<T> minDistanceCandidate = *(candidatePaths[node].begin());
-        for (auto path : candidatePaths[node]) {
-            if (path.distance > minDistanceCandidate.distance) {
-                minDistanceCandidate = path;
-            }
-        }
-
-        candidatePaths[node].erase(std::find(candidatePaths[node].begin(), candidatePaths[node].end(), minDistanceCandidate));
-        kShortestPaths[node].push_back(minDistanceCandidate);
+        kShortestPaths[node].push_back(candidatePaths[node].top());
+        candidatePaths[node].pop();
     } else {
         // TODO: kSP does not exist. this is handled later, but it would be nice to catch it as early as possble, wouldn't it?
         STORM_LOG_TRACE("KSP: no candidates, this will trigger nonexisting ksp after exiting these recursions. TODO: handle here");
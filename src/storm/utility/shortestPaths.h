@@ -2,6 +2,7 @@
 #define STORM_UTIL_SHORTESTPATHS_H_
 
 #include <boost/optional/optional.hpp>
+#include <queue>
 #include <unordered_set>
 #include <vector>
 
@@ -58,6 +59,18 @@ struct Path {
 template<typename T>
 std::ostream& operator<<(std::ostream& out, Path<T> const& p);
 
+// priority order for the candidate heaps: the path with the largest distance (i.e., probability) comes first,
+// ties are broken by the (arbitrary) order of `Path` to keep the enumeration deterministic
+template<typename T>
+struct CandidatePathOrder {
+    bool operator()(const Path<T>& lhs, const Path<T>& rhs) const {
+        if (lhs.distance != rhs.distance) {
+            return lhs.distance < rhs.distance;
+        }
+        return rhs < lhs;
+    }
+};
+
 // when using the raw matrix/vector invocation, this enum parameter
 // forces the caller to declare whether the matrix has the evil I-P
 // format, which requires back-conversion of the entries
@@ -130,7 +143,7 @@ class ShortestPathsGenerator {
     std::vector<T> shortestPathDistances;
 
     std::vector<std::vector<Path<T>>> kShortestPaths;
-    std::vector<std::set<Path<T>>> candidatePaths;
+    std::vector<std::priority_queue<Path<T>, std::vector<Path<T>>, CandidatePathOrder<T>>> candidatePaths;
 
     /*!
      * Computes list of predecessors for all nodes.
@@ -185,7 +198,7 @@ class ShortestPathsGenerator {
     // --- tiny helper fcts ---
 
     inline bool isInitialState(state_t node) const {
-        return std::find(initialStates.begin(), initialStates.end(), node) != initialStates.end();
+        return initialStates.get(node);
     }
 
     inline bool isMetaTargetPredecessor(state_t node) const {
@@ -2,6 +2,8 @@
 
 #include <random>
 
+#include "storm/adapters/SmallRationalNumber.h"
+
 #include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
 #include "storm/solver/stateelimination/StaticStatePriorityQueue.h"
@@ -274,6 +276,21 @@ template std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatr
                                                       storm::storage::BitVector const& initialStates,
                                                       std::vector<storm::RationalNumber> const& oneStepProbabilities, bool forward);
 
+template uint_fast64_t estimateComplexity(storm::SmallRationalNumber const& value);
+template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(
+    boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
+    storm::storage::FlexibleSparseMatrix<storm::SmallRationalNumber> const& transitionMatrix,
+    storm::storage::FlexibleSparseMatrix<storm::SmallRationalNumber> const& backwardTransitions,
+    std::vector<storm::SmallRationalNumber> const& oneStepProbabilities, storm::storage::BitVector const& states);
+template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state,
+                                           storm::storage::FlexibleSparseMatrix<storm::SmallRationalNumber> const& transitionMatrix,
+                                           storm::storage::FlexibleSparseMatrix<storm::SmallRationalNumber> const& backwardTransitions,
+                                           std::vector<storm::SmallRationalNumber> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state,
+                                                            storm::storage::FlexibleSparseMatrix<storm::SmallRationalNumber> const& transitionMatrix,
+                                                            storm::storage::FlexibleSparseMatrix<storm::SmallRationalNumber> const& backwardTransitions,
+                                                            std::vector<storm::SmallRationalNumber> const& oneStepProbabilities);
+
 template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                                       storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                                       storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
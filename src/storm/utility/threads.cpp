@@ -1,7 +1,15 @@
 #include "storm/utility/threads.h"
 
 #include <cstdlib>
+#include <mutex>
+#include <sstream>
 #include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 #include "storm/io/file.h"
 
@@ -9,6 +17,7 @@ namespace storm::utility {
 
 namespace detail {
 static uint num_threads = 0u;
+static ThreadAffinityPolicy affinity_policy = ThreadAffinityPolicy::None;
 
 uint tryReadFromSlurm() {
     auto val = std::getenv("SLURM_CPUS_PER_TASK");
@@ -48,6 +57,105 @@ uint tryReadFromCgroups() {
     return 0u;
 }
 
+/*!
+ * Reads the first number of the given file. Returns zero if the file does not exist or does not start with a number (e.g. if it contains "max").
+ */
+uint64_t tryReadNumberFromFile(std::string const& filename) {
+    if (storm::utility::fileExistsAndIsReadable(filename)) {
+        std::ifstream inputFileStream;
+        storm::utility::openFile(filename, inputFileStream);
+        std::string contents;
+        storm::utility::getline(inputFileStream, contents);
+        storm::utility::closeFile(inputFileStream);
+
+        char* end;
+        auto value = std::strtoull(contents.c_str(), &end, 10);
+        if (end != contents.c_str()) {
+            return value;
+        }
+    }
+    return 0;
+}
+
+uint64_t tryReadMemoryFromCgroups() {
+    // cgroups v2 provides memory.max and memory.current, v1 provides memory.limit_in_bytes (which is huge if there is no limit) and memory.usage_in_bytes.
+    uint64_t limit = tryReadNumberFromFile("/sys/fs/cgroup/memory.max");
+    uint64_t usage = tryReadNumberFromFile("/sys/fs/cgroup/memory.current");
+    if (limit == 0) {
+        limit = tryReadNumberFromFile("/sys/fs/cgroup/memory/memory.limit_in_bytes");
+        usage = tryReadNumberFromFile("/sys/fs/cgroup/memory/memory.usage_in_bytes");
+    }
+    if (limit > 0 && limit < (1ull << 60)) {
+        STORM_LOG_INFO("Detected memory limitation via cgroup (max. " << limit << " bytes, " << usage << " bytes in use).");
+        return limit > usage ? limit - usage : 1;
+    }
+    return 0;
+}
+
+uint64_t tryReadMemoryFromMeminfo() {
+    std::string const filename = "/proc/meminfo";
+    if (storm::utility::fileExistsAndIsReadable(filename)) {
+        std::ifstream inputFileStream;
+        storm::utility::openFile(filename, inputFileStream);
+        std::string line;
+        while (storm::utility::getline(inputFileStream, line)) {
+            // The line has the form "MemAvailable:   12345678 kB"
+            if (line.compare(0, 13, "MemAvailable:") == 0) {
+                storm::utility::closeFile(inputFileStream);
+                return std::strtoull(line.c_str() + 13, nullptr, 10) * 1024;
+            }
+        }
+        storm::utility::closeFile(inputFileStream);
+    }
+    return 0;
+}
+
+/*!
+ * Reads the processors of the NUMA nodes from sysfs. Returns an empty vector if the topology can not be determined.
+ */
+std::vector<std::vector<uint>> readNumaNodeProcessors() {
+    std::vector<std::vector<uint>> result;
+    for (uint node = 0;; ++node) {
+        std::string const filename = "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist";
+        if (!storm::utility::fileExistsAndIsReadable(filename)) {
+            break;
+        }
+        std::ifstream inputFileStream;
+        storm::utility::openFile(filename, inputFileStream);
+        std::string contents;
+        storm::utility::getline(inputFileStream, contents);
+        storm::utility::closeFile(inputFileStream);
+
+        // The list has the form "0-3,8,10-11"
+        std::vector<uint> processors;
+        std::istringstream stream(contents);
+        std::string range;
+        while (std::getline(stream, range, ',')) {
+            char* end;
+            auto first = std::strtoul(range.c_str(), &end, 10);
+            if (end == range.c_str()) {
+                continue;
+            }
+            auto last = first;
+            if (*end == '-') {
+                last = std::strtoul(end + 1, nullptr, 10);
+            }
+            for (auto processor = first; processor <= last; ++processor) {
+                processors.push_back(static_cast<uint>(processor));
+            }
+        }
+        result.push_back(std::move(processors));
+    }
+    return result;
+}
+
+std::vector<std::vector<uint>> const& getNumaNodeProcessors() {
+    static std::once_flag flag;
+    static std::vector<std::vector<uint>> processors;
+    std::call_once(flag, []() { processors = readNumaNodeProcessors(); });
+    return processors;
+}
+
 }  // namespace detail
 
 uint getNumberOfThreads() {
@@ -65,4 +173,54 @@ uint getNumberOfThreads() {
     }
     return detail::num_threads;
 }
-}  // namespace storm::utility
\ No newline at end of file
+
+uint64_t getAvailableMemory() {
+    uint64_t result = 0;
+    for (auto bytes : {detail::tryReadMemoryFromCgroups(), detail::tryReadMemoryFromMeminfo()}) {
+        if (bytes > 0 && (result == 0 || bytes < result)) {
+            result = bytes;
+        }
+    }
+    return result;
+}
+
+ThreadAffinityPolicy getThreadAffinityPolicy() {
+    return detail::affinity_policy;
+}
+
+void setThreadAffinityPolicy(ThreadAffinityPolicy policy) {
+    STORM_LOG_WARN_COND(policy != ThreadAffinityPolicy::NumaNodes || getNumberOfNumaNodes() > 1,
+                        "Binding threads to NUMA nodes has no effect as the system has only a single (known) NUMA node.");
+    detail::affinity_policy = policy;
+}
+
+uint64_t getNumberOfNumaNodes() {
+    return std::max<uint64_t>(1, detail::getNumaNodeProcessors().size());
+}
+
+void bindCurrentThreadToNumaNode(uint64_t threadIndex, uint64_t numberOfThreads) {
+#ifdef __linux__
+    auto const& nodeProcessors = detail::getNumaNodeProcessors();
+    if (nodeProcessors.size() <= 1 || numberOfThreads == 0) {
+        return;
+    }
+    auto const& processors = nodeProcessors[threadIndex * nodeProcessors.size() / numberOfThreads];
+    // Restrict the binding to the processors that the thread may currently use (e.g. due to cgroups).
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &allowed) != 0) {
+        return;
+    }
+    cpu_set_t processorSet;
+    CPU_ZERO(&processorSet);
+    for (auto processor : processors) {
+        if (processor < CPU_SETSIZE && CPU_ISSET(processor, &allowed)) {
+            CPU_SET(processor, &processorSet);
+        }
+    }
+    if (CPU_COUNT(&processorSet) > 0) {
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &processorSet);
+    }
+#endif
+}
+}  // namespace storm::utility
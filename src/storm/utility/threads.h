@@ -1,7 +1,50 @@
 #pragma once
 
+#include <sys/types.h>
+#include <cstdint>
+
 namespace storm {
 namespace utility {
 uint getNumberOfThreads();
-}
-}  // namespace storm
\ No newline at end of file
+
+/*!
+ * Retrieves the number of bytes of memory that are still available to this process, i.e., the minimum of the memory that is available on the system and
+ * the memory left under the limit of the cgroup of the process (memory.max). Returns zero if neither can be determined.
+ */
+uint64_t getAvailableMemory();
+
+/*!
+ * Policies that determine on which processors the threads of parallel computations (see storm/utility/parallel.h) are executed.
+ */
+enum class ThreadAffinityPolicy {
+    // The threads are scheduled freely by the operating system.
+    None,
+    // The threads are bound to NUMA nodes such that threads with consecutive indices (which process consecutive parts of the data) share a node.
+    NumaNodes
+};
+
+/*!
+ * Retrieves the thread affinity policy that is used by parallel computations. The default is ThreadAffinityPolicy::None.
+ */
+ThreadAffinityPolicy getThreadAffinityPolicy();
+
+/*!
+ * Sets the thread affinity policy that is used by parallel computations.
+ */
+void setThreadAffinityPolicy(ThreadAffinityPolicy policy);
+
+/*!
+ * Retrieves the number of NUMA nodes of the system (which is one if the NUMA topology can not be determined).
+ */
+uint64_t getNumberOfNumaNodes();
+
+/*!
+ * Binds the calling thread to the processors of the NUMA node that is responsible for the given thread index, where the threads are distributed evenly
+ * among the nodes in order of their indices. Does nothing if the NUMA topology can not be determined or there is only a single node.
+ *
+ * @param threadIndex The index of the calling thread.
+ * @param numberOfThreads The number of threads of the parallel computation.
+ */
+void bindCurrentThreadToNumaNode(uint64_t threadIndex, uint64_t numberOfThreads);
+}  // namespace utility
+}  // namespace storm
@@ -2,9 +2,11 @@
 #define STORM_UTILITY_VECTOR_H_
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iosfwd>
 #include <numeric>
+#include <type_traits>
 #include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
@@ -14,6 +16,7 @@
 #include "storm/storage/BitVector.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/NotImplementedException.h"
 
@@ -21,6 +24,24 @@ namespace storm {
 namespace utility {
 namespace vector {
 
+/*!
+ * The minimal number of elements per thread for which the operations below process vectors in parallel.
+ */
+uint64_t const minimalNumberOfElementsPerThread = 1ull << 16;
+
+/*!
+ * Retrieves the number of threads with which the operations below process vectors of the given size. The threads are taken from the task runtime
+ * (see storm/utility/TaskRuntime.h). Vectors over values whose arithmetic is not thread-safe (e.g. rational functions), small vectors and vectors that
+ * are processed within a task of the runtime (i.e., within a computation that is already parallel) are processed sequentially.
+ */
+template<typename ValueType>
+uint64_t getNumberOfThreadsForVector(uint64_t size) {
+    if (!std::is_arithmetic<ValueType>::value || size < 2 * minimalNumberOfElementsPerThread || storm::utility::parallel::TaskRuntime::isWorkerThread()) {
+        return 1;
+    }
+    return std::min<uint64_t>(storm::utility::parallel::TaskRuntime::runtime().getNumberOfThreads(), size / minimalNumberOfElementsPerThread);
+}
+
 template<typename ValueType>
 struct VectorHash {
     size_t operator()(std::vector<ValueType> const& vec) const {
@@ -192,11 +213,14 @@ void selectVectorValues(std::vector<T>& vector, storm::storage::BitVector const&
                                                                                                            << vector.size() << ").");
     STORM_LOG_ASSERT(positions.size() == values.size(),
                      "Size mismatch of the positions vector (" << positions.size() << ") and the values vector (" << values.size() << ").");
-    auto targetIt = vector.begin();
-    for (auto position : positions) {
-        *targetIt = values[position];
-        ++targetIt;
-    }
+    storm::utility::parallel::forEachChunk(getNumberOfThreadsForVector<T>(values.size()), static_cast<uint64_t>(0), positions.size(),
+                                           [&](uint64_t, uint64_t begin, uint64_t end) {
+                                               auto targetIt = vector.begin() + positions.getNumberOfSetBitsBeforeIndex(begin);
+                                               for (auto positionIt = positions.begin(begin), positionIte = positions.end();
+                                                    positionIt != positionIte && *positionIt < end; ++positionIt, ++targetIt) {
+                                                   *targetIt = values[*positionIt];
+                                               }
+                                           });
 }
 
 /*!
@@ -230,10 +254,12 @@ void selectVectorValues(std::vector<T>& vector, storm::storage::BitVector const&
 template<class T>
 void selectVectorValues(std::vector<T>& vector, std::vector<uint_fast64_t> const& rowGroupToRowIndexMapping, std::vector<uint_fast64_t> const& rowGrouping,
                         std::vector<T> const& values) {
-    auto targetIt = vector.begin();
-    for (uint_fast64_t i = 0; i < vector.size(); ++i, ++targetIt) {
-        *targetIt = values[rowGrouping[i] + rowGroupToRowIndexMapping[i]];
-    }
+    storm::utility::parallel::forEachChunk(getNumberOfThreadsForVector<T>(vector.size()), static_cast<uint64_t>(0), static_cast<uint64_t>(vector.size()),
+                                           [&](uint64_t, uint64_t begin, uint64_t end) {
+                                               for (uint64_t i = begin; i < end; ++i) {
+                                                   vector[i] = values[rowGrouping[i] + rowGroupToRowIndexMapping[i]];
+                                               }
+                                           });
 }
 
 /*!
@@ -248,9 +274,12 @@ void selectVectorValues(std::vector<T>& vector, std::vector<uint_fast64_t> const
     STORM_LOG_ASSERT(indexSequence.size() <= vector.size(),
                      "The number of selected positions (" << indexSequence.size() << ") exceeds the size of the target vector (" << vector.size() << ").");
 
-    for (uint_fast64_t vectorIndex = 0; vectorIndex < vector.size(); ++vectorIndex) {
-        vector[vectorIndex] = values[indexSequence[vectorIndex]];
-    }
+    storm::utility::parallel::forEachChunk(getNumberOfThreadsForVector<T>(vector.size()), static_cast<uint64_t>(0), static_cast<uint64_t>(vector.size()),
+                                           [&](uint64_t, uint64_t begin, uint64_t end) {
+                                               for (uint64_t vectorIndex = begin; vectorIndex < end; ++vectorIndex) {
+                                                   vector[vectorIndex] = values[indexSequence[vectorIndex]];
+                                               }
+                                           });
 }
 
 /*!
@@ -367,24 +396,20 @@ void applyPointwiseTernary(std::vector<InValueType1> const& firstOperand, std::v
     }
 }
 
-#ifdef STORM_HAVE_INTELTBB
+/*!
+ * Applies the given operation pointwise on the three given vectors (as applyPointwiseTernary) with the threads of the task runtime (see
+ * getNumberOfThreadsForVector). The operation must be safe to be called concurrently.
+ */
 template<class InValueType1, class InValueType2, class OutValueType, class Operation>
 void applyPointwiseTernaryParallel(std::vector<InValueType1> const& firstOperand, std::vector<InValueType2> const& secondOperand,
                                    std::vector<OutValueType>& target, Operation f = Operation()) {
-    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, target.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
-        auto firstIt = firstOperand.begin() + range.begin();
-        auto firstIte = firstOperand.begin() + range.end();
-        auto secondIt = secondOperand.begin() + range.begin();
-        auto targetIt = target.begin() + range.begin();
-        while (firstIt != firstIte) {
-            *targetIt = f(*firstIt, *secondIt, *targetIt);
-            ++targetIt;
-            ++firstIt;
-            ++secondIt;
-        }
-    });
+    storm::utility::parallel::forEachChunk(getNumberOfThreadsForVector<OutValueType>(firstOperand.size()), static_cast<uint64_t>(0),
+                                           static_cast<uint64_t>(firstOperand.size()), [&](uint64_t, uint64_t begin, uint64_t end) {
+                                               for (uint64_t i = begin; i < end; ++i) {
+                                                   target[i] = f(firstOperand[i], secondOperand[i], target[i]);
+                                               }
+                                           });
 }
-#endif
 
 /*!
  * Applies the given operation pointwise on the two given vectors and writes the result to the third vector.
@@ -400,16 +425,19 @@ void applyPointwise(std::vector<InValueType1> const& firstOperand, std::vector<I
     std::transform(firstOperand.begin(), firstOperand.end(), secondOperand.begin(), target.begin(), f);
 }
 
-#ifdef STORM_HAVE_INTELTBB
+/*!
+ * Applies the given operation pointwise on the two given vectors (as applyPointwise) with the threads of the task runtime (see
+ * getNumberOfThreadsForVector). The operation must be safe to be called concurrently.
+ */
 template<class InValueType1, class InValueType2, class OutValueType, class Operation>
 void applyPointwiseParallel(std::vector<InValueType1> const& firstOperand, std::vector<InValueType2> const& secondOperand, std::vector<OutValueType>& target,
                             Operation f = Operation()) {
-    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, target.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
-        std::transform(firstOperand.begin() + range.begin(), firstOperand.begin() + range.end(), secondOperand.begin() + range.begin(),
-                       target.begin() + range.begin(), f);
-    });
+    storm::utility::parallel::forEachChunk(getNumberOfThreadsForVector<OutValueType>(firstOperand.size()), static_cast<uint64_t>(0),
+                                           static_cast<uint64_t>(firstOperand.size()), [&](uint64_t, uint64_t begin, uint64_t end) {
+                                               std::transform(firstOperand.begin() + begin, firstOperand.begin() + end, secondOperand.begin() + begin,
+                                                              target.begin() + begin, f);
+                                           });
 }
-#endif
 
 /*!
  * Applies the given function pointwise on the given vector.
@@ -423,14 +451,17 @@ void applyPointwise(std::vector<InValueType> const& operand, std::vector<OutValu
     std::transform(operand.begin(), operand.end(), target.begin(), f);
 }
 
-#ifdef STORM_HAVE_INTELTBB
+/*!
+ * Applies the given function pointwise on the given vector (as applyPointwise) with the threads of the task runtime (see getNumberOfThreadsForVector).
+ * The function must be safe to be called concurrently.
+ */
 template<class InValueType, class OutValueType, class Operation>
 void applyPointwiseParallel(std::vector<InValueType> const& operand, std::vector<OutValueType>& target, Operation f = Operation()) {
-    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, target.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
-        std::transform(operand.begin() + range.begin(), operand.begin() + range.end(), target.begin() + range.begin(), f);
-    });
+    storm::utility::parallel::forEachChunk(getNumberOfThreadsForVector<OutValueType>(operand.size()), static_cast<uint64_t>(0),
+                                           static_cast<uint64_t>(operand.size()), [&](uint64_t, uint64_t begin, uint64_t end) {
+                                               std::transform(operand.begin() + begin, operand.begin() + end, target.begin() + begin, f);
+                                           });
 }
-#endif
 
 /*!
  * Adds the two given vectors and writes the result to the target vector.
@@ -441,7 +472,7 @@ void applyPointwiseParallel(std::vector<InValueType> const& operand, std::vector
  */
 template<class InValueType1, class InValueType2, class OutValueType>
 void addVectors(std::vector<InValueType1> const& firstOperand, std::vector<InValueType2> const& secondOperand, std::vector<OutValueType>& target) {
-    applyPointwise<InValueType1, InValueType2, OutValueType, std::plus<>>(firstOperand, secondOperand, target);
+    applyPointwiseParallel<InValueType1, InValueType2, OutValueType, std::plus<>>(firstOperand, secondOperand, target);
 }
 
 /*!
@@ -453,7 +484,7 @@ void addVectors(std::vector<InValueType1> const& firstOperand, std::vector<InVal
  */
 template<class InValueType1, class InValueType2, class OutValueType>
 void subtractVectors(std::vector<InValueType1> const& firstOperand, std::vector<InValueType2> const& secondOperand, std::vector<OutValueType>& target) {
-    applyPointwise<InValueType1, InValueType2, OutValueType, std::minus<>>(firstOperand, secondOperand, target);
+    applyPointwiseParallel<InValueType1, InValueType2, OutValueType, std::minus<>>(firstOperand, secondOperand, target);
 }
 
 /*!
@@ -466,7 +497,7 @@ void subtractVectors(std::vector<InValueType1> const& firstOperand, std::vector<
 template<class InValueType1, class InValueType2, class OutValueType>
 void multiplyVectorsPointwise(std::vector<InValueType1> const& firstOperand, std::vector<InValueType2> const& secondOperand,
                               std::vector<OutValueType>& target) {
-    applyPointwise<InValueType1, InValueType2, OutValueType, std::multiplies<>>(firstOperand, secondOperand, target);
+    applyPointwiseParallel<InValueType1, InValueType2, OutValueType, std::multiplies<>>(firstOperand, secondOperand, target);
 }
 
 /*!
@@ -478,7 +509,7 @@ void multiplyVectorsPointwise(std::vector<InValueType1> const& firstOperand, std
  */
 template<class InValueType1, class InValueType2, class OutValueType>
 void divideVectorsPointwise(std::vector<InValueType1> const& firstOperand, std::vector<InValueType2> const& secondOperand, std::vector<OutValueType>& target) {
-    applyPointwise<InValueType1, InValueType2, OutValueType, std::divides<>>(firstOperand, secondOperand, target);
+    applyPointwiseParallel<InValueType1, InValueType2, OutValueType, std::divides<>>(firstOperand, secondOperand, target);
 }
 
 /*!
@@ -489,7 +520,7 @@ void divideVectorsPointwise(std::vector<InValueType1> const& firstOperand, std::
  */
 template<class ValueType1, class ValueType2>
 void scaleVectorInPlace(std::vector<ValueType1>& target, ValueType2 const& factor) {
-    applyPointwise<ValueType1, ValueType1>(target, target, [&](ValueType1 const& argument) -> ValueType1 { return argument * factor; });
+    applyPointwiseParallel<ValueType1, ValueType1>(target, target, [&](ValueType1 const& argument) -> ValueType1 { return argument * factor; });
 }
 
 /*!
@@ -502,7 +533,7 @@ void scaleVectorInPlace(std::vector<ValueType1>& target, ValueType2 const& facto
  */
 template<class InValueType1, class InValueType2, class InValueType3>
 void addScaledVector(std::vector<InValueType1>& firstOperand, std::vector<InValueType2> const& secondOperand, InValueType3 const& factor) {
-    applyPointwise<InValueType1, InValueType2, InValueType1>(
+    applyPointwiseParallel<InValueType1, InValueType2, InValueType1>(
         firstOperand, secondOperand, firstOperand, [&](InValueType1 const& val1, InValueType2 const& val2) -> InValueType1 { return val1 + (factor * val2); });
 }
 
@@ -648,107 +679,35 @@ VT min_if(std::vector<VT> const& values, storm::storage::BitVector const& filter
     return current;
 }
 
-#ifdef STORM_HAVE_INTELTBB
-template<class T, class Filter>
-class TbbReduceVectorFunctor {
-   public:
-    TbbReduceVectorFunctor(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
-                           std::vector<uint_fast64_t>* choices, Filter const& f)
-        : source(source), target(target), rowGrouping(rowGrouping), choices(choices), f(f) {
-        // Intentionally left empty.
-    }
-
-    void operator()(tbb::blocked_range<uint64_t> const& range) const {
-        uint_fast64_t startRow = range.begin();
-        uint_fast64_t endRow = range.end();
-
-        typename std::vector<T>::iterator targetIt = target.begin() + startRow;
-        typename std::vector<T>::iterator targetIte = target.begin() + endRow;
-        typename std::vector<uint_fast64_t>::const_iterator rowGroupingIt = rowGrouping.begin() + startRow;
-        typename std::vector<T>::const_iterator sourceIt = source.begin() + *rowGroupingIt;
-        typename std::vector<T>::const_iterator sourceIte;
-        typename std::vector<uint_fast64_t>::iterator choiceIt;
-        if (choices) {
-            choiceIt = choices->begin() + startRow;
-        }
-
-        // Variables for correctly tracking choices (only update if new choice is strictly better).
-        T oldSelectedChoiceValue;
-        uint64_t selectedChoice;
-
-        uint64_t currentRow = 0;
-        for (; targetIt != targetIte; ++targetIt, ++rowGroupingIt, ++choiceIt) {
-            // Only traverse elements if the row group is non-empty.
-            if (*rowGroupingIt != *(rowGroupingIt + 1)) {
-                *targetIt = *sourceIt;
-
-                if (choices) {
-                    selectedChoice = 0;
-                    if (*choiceIt == 0) {
-                        oldSelectedChoiceValue = *targetIt;
-                    }
-                }
-
-                ++sourceIt;
-                ++currentRow;
-
-                for (sourceIte = source.begin() + *(rowGroupingIt + 1); sourceIt != sourceIte; ++sourceIt, ++currentRow) {
-                    if (choices && *choiceIt + *rowGroupingIt == currentRow) {
-                        oldSelectedChoiceValue = *sourceIt;
-                    }
-
-                    if (f(*sourceIt, *targetIt)) {
-                        *targetIt = *sourceIt;
-                        if (choices) {
-                            selectedChoice = std::distance(source.begin(), sourceIt) - *rowGroupingIt;
-                        }
-                    }
-                }
-
-                if (choices && f(*targetIt, oldSelectedChoiceValue)) {
-                    *choiceIt = selectedChoice;
-                }
-            }
-        }
-    }
-
-   private:
-    std::vector<T> const& source;
-    std::vector<T>& target;
-    std::vector<uint_fast64_t> const& rowGrouping;
-    std::vector<uint_fast64_t>* choices;
-    Filter const& f;
-};
-#endif
-
 /*!
- * Reduces the given source vector by selecting an element according to the given filter out of each row group.
+ * Reduces the given row groups of the given source vector by selecting an element according to the given filter out of each row group.
  *
  * @param source The source vector which is to be reduced.
  * @param target The target vector into which a single element from each row group is written.
  * @param rowGrouping A vector that specifies the begin and end of each group of elements in the values vector.
- * @param filter A function that compares two elements v1 and v2 according to some filter criterion. This function must
- * return true iff v1 is supposed to be taken instead of v2.
  * @param choices If non-null, this vector is used to store the choices made during the selection.
+ * @param firstGroup The first row group to reduce.
+ * @param lastGroup The row group one past the last row group to reduce.
  */
 template<class T, class Filter>
-void reduceVector(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices) {
+void reduceVectorGroups(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
+                        std::vector<uint_fast64_t>* choices, uint64_t firstGroup, uint64_t lastGroup) {
     Filter f;
-    typename std::vector<T>::iterator targetIt = target.begin();
-    typename std::vector<T>::iterator targetIte = target.end();
-    typename std::vector<uint_fast64_t>::const_iterator rowGroupingIt = rowGrouping.begin();
-    typename std::vector<T>::const_iterator sourceIt = source.begin();
+    typename std::vector<T>::iterator targetIt = target.begin() + firstGroup;
+    typename std::vector<T>::iterator targetIte = target.begin() + lastGroup;
+    typename std::vector<uint_fast64_t>::const_iterator rowGroupingIt = rowGrouping.begin() + firstGroup;
+    typename std::vector<T>::const_iterator sourceIt = source.begin() + rowGrouping[firstGroup];
     typename std::vector<T>::const_iterator sourceIte;
     typename std::vector<uint_fast64_t>::iterator choiceIt;
     if (choices) {
-        choiceIt = choices->begin();
+        choiceIt = choices->begin() + firstGroup;
     }
 
     // Variables for correctly tracking choices (only update if new choice is strictly better).
     T oldSelectedChoiceValue;
     uint64_t selectedChoice;
 
-    uint64_t currentRow = 0;
+    uint64_t currentRow = rowGrouping[firstGroup];
     for (; targetIt != targetIte; ++targetIt, ++rowGroupingIt, ++choiceIt) {
         // Only traverse elements if the row group is non-empty.
         if (*rowGroupingIt != *(rowGroupingIt + 1)) {
@@ -781,19 +740,40 @@ void reduceVector(std::vector<T> const& source, std::vector<T>& target, std::vec
                 *choiceIt = selectedChoice;
             }
         } else {
-            *choiceIt = 0;
+            if (choices) {
+                *choiceIt = 0;
+            }
             *targetIt = storm::utility::zero<T>();
         }
     }
 }
 
-#ifdef STORM_HAVE_INTELTBB
+/*!
+ * Reduces the given source vector by selecting an element according to the given filter out of each row group.
+ *
+ * @param source The source vector which is to be reduced.
+ * @param target The target vector into which a single element from each row group is written.
+ * @param rowGrouping A vector that specifies the begin and end of each group of elements in the values vector.
+ * @param filter A function that compares two elements v1 and v2 according to some filter criterion. This function must
+ * return true iff v1 is supposed to be taken instead of v2.
+ * @param choices If non-null, this vector is used to store the choices made during the selection.
+ */
+template<class T, class Filter>
+void reduceVector(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices) {
+    reduceVectorGroups<T, Filter>(source, target, rowGrouping, choices, 0, target.size());
+}
+
+/*!
+ * Reduces the given source vector (as reduceVector) with the threads of the task runtime (see getNumberOfThreadsForVector). Every thread reduces a
+ * contiguous range of row groups.
+ */
 template<class T, class Filter>
 void reduceVectorParallel(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
                           std::vector<uint_fast64_t>* choices) {
-    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, target.size()), TbbReduceVectorFunctor<T, Filter>(source, target, rowGrouping, choices, Filter()));
+    storm::utility::parallel::forEachChunk(
+        getNumberOfThreadsForVector<T>(source.size()), static_cast<uint64_t>(0), static_cast<uint64_t>(target.size()),
+        [&](uint64_t, uint64_t begin, uint64_t end) { reduceVectorGroups<T, Filter>(source, target, rowGrouping, choices, begin, end); });
 }
-#endif
 
 /*!
  * Reduces the given source vector by selecting the smallest element out of each row group.
@@ -806,16 +786,14 @@ void reduceVectorParallel(std::vector<T> const& source, std::vector<T>& target,
 template<class T>
 void reduceVectorMin(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
                      std::vector<uint_fast64_t>* choices = nullptr) {
-    reduceVector<T, storm::utility::ElementLess<T>>(source, target, rowGrouping, choices);
+    reduceVectorParallel<T, storm::utility::ElementLess<T>>(source, target, rowGrouping, choices);
 }
 
-#ifdef STORM_HAVE_INTELTBB
 template<class T>
 void reduceVectorMinParallel(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
                              std::vector<uint_fast64_t>* choices = nullptr) {
-    reduceVector<T, storm::utility::ElementLess<T>>(source, target, rowGrouping, choices);
+    reduceVectorParallel<T, storm::utility::ElementLess<T>>(source, target, rowGrouping, choices);
 }
-#endif
 
 /*!
  * Reduces the given source vector by selecting the largest element out of each row group.
@@ -828,16 +806,14 @@ void reduceVectorMinParallel(std::vector<T> const& source, std::vector<T>& targe
 template<class T>
 void reduceVectorMax(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
                      std::vector<uint_fast64_t>* choices = nullptr) {
-    reduceVector<T, storm::utility::ElementGreater<T>>(source, target, rowGrouping, choices);
+    reduceVectorParallel<T, storm::utility::ElementGreater<T>>(source, target, rowGrouping, choices);
 }
 
-#ifdef STORM_HAVE_INTELTBB
 template<class T>
 void reduceVectorMaxParallel(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
                              std::vector<uint_fast64_t>* choices = nullptr) {
-    reduceVector<T, storm::utility::ElementGreater<T>>(source, target, rowGrouping, choices);
+    reduceVectorParallel<T, storm::utility::ElementGreater<T>>(source, target, rowGrouping, choices);
 }
-#endif
 
 /*!
  * Reduces the given source vector by selecting either the smallest or the largest out of each row group.
@@ -858,7 +834,6 @@ void reduceVectorMinOrMax(storm::solver::OptimizationDirection dir, std::vector<
     }
 }
 
-#ifdef STORM_HAVE_INTELTBB
 template<class T>
 void reduceVectorMinOrMaxParallel(storm::solver::OptimizationDirection dir, std::vector<T> const& source, std::vector<T>& target,
                                   std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices = nullptr) {
@@ -868,7 +843,6 @@ void reduceVectorMinOrMaxParallel(storm::solver::OptimizationDirection dir, std:
         reduceVectorMaxParallel(source, target, rowGrouping, choices);
     }
 }
-#endif
 
 /*!
  * Compares the given elements and determines whether they are equal modulo the given precision. The provided flag
@@ -932,16 +906,90 @@ template<class T>
 bool equalModuloPrecision(std::vector<T> const& vectorLeft, std::vector<T> const& vectorRight, T const& precision, bool relativeError) {
     STORM_LOG_ASSERT(vectorLeft.size() == vectorRight.size(), "Lengths of vectors does not match.");
 
-    auto leftIt = vectorLeft.begin();
-    auto leftIte = vectorLeft.end();
-    auto rightIt = vectorRight.begin();
-    for (; leftIt != leftIte; ++leftIt, ++rightIt) {
-        if (!equalModuloPrecision(*leftIt, *rightIt, precision, relativeError)) {
-            return false;
-        }
-    }
+    // The threads check every few thousand elements whether another thread already found a difference.
+    uint64_t const blockSize = 4096;
+    std::atomic<bool> equal(true);
+    storm::utility::parallel::forEachChunk(getNumberOfThreadsForVector<T>(vectorLeft.size()), static_cast<uint64_t>(0),
+                                           static_cast<uint64_t>(vectorLeft.size()), [&](uint64_t, uint64_t begin, uint64_t end) {
+                                               for (uint64_t blockBegin = begin; blockBegin < end && equal.load(std::memory_order_relaxed);
+                                                    blockBegin += blockSize) {
+                                                   for (uint64_t i = blockBegin, blockEnd = std::min(end, blockBegin + blockSize); i < blockEnd; ++i) {
+                                                       if (!equalModuloPrecision(vectorLeft[i], vectorRight[i], precision, relativeError)) {
+                                                           equal.store(false, std::memory_order_relaxed);
+                                                           return;
+                                                       }
+                                                   }
+                                               }
+                                           });
+    return equal.load();
+}
 
-    return true;
+/*!
+ * Applies the given operation pointwise on the two given vectors and writes the result to the target vector (as applyPointwise). In the same pass, it
+ * checks whether the written values are equal to the given reference values modulo the given precision (as equalModuloPrecision with the reference vector
+ * as the first vector). This saves the separate pass over both vectors when checking the convergence of iterative methods.
+ * The vectors are processed with the threads of the task runtime (see getNumberOfThreadsForVector), so the operation must be safe to be called concurrently.
+ *
+ * @param firstOperand The first operand.
+ * @param secondOperand The second operand.
+ * @param target The target vector, which may be equal to one of the operands but not to the reference vector.
+ * @param reference The vector to which the result is compared.
+ * @param precision The precision up to which the vectors are to be checked for equality.
+ * @param relativeError If set, the difference between the vectors is computed relative to the value or in absolute terms.
+ * @return True iff the result is equal to the reference vector modulo the given precision.
+ */
+template<class InValueType1, class InValueType2, class T, class Operation>
+bool applyPointwiseAndCheckConvergence(std::vector<InValueType1> const& firstOperand, std::vector<InValueType2> const& secondOperand, std::vector<T>& target,
+                                       std::vector<T> const& reference, T const& precision, bool relativeError, Operation f = Operation()) {
+    STORM_LOG_ASSERT(&target != &reference, "The target vector must not be the reference vector.");
+    std::atomic<bool> equal(true);
+    storm::utility::parallel::forEachChunk(getNumberOfThreadsForVector<T>(firstOperand.size()), static_cast<uint64_t>(0),
+                                           static_cast<uint64_t>(firstOperand.size()), [&](uint64_t, uint64_t begin, uint64_t end) {
+                                               bool chunkEqual = true;
+                                               for (uint64_t i = begin; i < end; ++i) {
+                                                   target[i] = f(firstOperand[i], secondOperand[i]);
+                                                   chunkEqual = chunkEqual && equalModuloPrecision(reference[i], target[i], precision, relativeError);
+                                               }
+                                               if (!chunkEqual) {
+                                                   equal.store(false, std::memory_order_relaxed);
+                                               }
+                                           });
+    return equal.load();
+}
+
+/*!
+ * Applies the given operation pointwise on the two given vectors and writes the result to the target vector (as applyPointwise). In the same pass, it
+ * computes the maximal absolute difference between the written values and the given reference values.
+ * The vectors are processed with the threads of the task runtime (see getNumberOfThreadsForVector), so the operation must be safe to be called concurrently.
+ *
+ * @param firstOperand The first operand.
+ * @param secondOperand The second operand.
+ * @param target The target vector, which may be equal to one of the operands but not to the reference vector.
+ * @param reference The vector to which the result is compared.
+ * @return The maximal absolute difference between the result and the reference vector.
+ */
+template<class InValueType1, class InValueType2, class T, class Operation>
+T applyPointwiseAndComputeMaximalDifference(std::vector<InValueType1> const& firstOperand, std::vector<InValueType2> const& secondOperand,
+                                            std::vector<T>& target, std::vector<T> const& reference, Operation f = Operation()) {
+    STORM_LOG_ASSERT(&target != &reference, "The target vector must not be the reference vector.");
+    uint64_t const numberOfThreads = getNumberOfThreadsForVector<T>(firstOperand.size());
+    std::vector<T> maximalDifferences(numberOfThreads, storm::utility::zero<T>());
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(firstOperand.size()),
+                                           [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+                                               T maximalDifference = storm::utility::zero<T>();
+                                               for (uint64_t i = begin; i < end; ++i) {
+                                                   target[i] = f(firstOperand[i], secondOperand[i]);
+                                                   T diff = target[i] - reference[i];
+                                                   T difference = storm::utility::abs(diff);
+                                                   maximalDifference = maximalDifference < difference ? difference : maximalDifference;
+                                               }
+                                               maximalDifferences[threadIndex] = maximalDifference;
+                                           });
+    T result = storm::utility::zero<T>();
+    for (auto const& difference : maximalDifferences) {
+        result = result < difference ? difference : result;
+    }
+    return result;
 }
 
 /*!
@@ -1005,13 +1053,20 @@ T maximumElementAbs(std::vector<T> const& vector) {
 
 template<class T>
 T maximumElementDiff(std::vector<T> const& vectorLeft, std::vector<T> const& vectorRight) {
+    uint64_t const numberOfThreads = getNumberOfThreadsForVector<T>(vectorLeft.size());
+    std::vector<T> maxDiffs(numberOfThreads, storm::utility::zero<T>());
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), static_cast<uint64_t>(vectorLeft.size()),
+                                           [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+                                               T maxDiff = storm::utility::zero<T>();
+                                               for (uint64_t i = begin; i < end; ++i) {
+                                                   T diff = vectorLeft[i] - vectorRight[i];
+                                                   T possDiff = storm::utility::abs(diff);
+                                                   maxDiff = maxDiff < possDiff ? possDiff : maxDiff;
+                                               }
+                                               maxDiffs[threadIndex] = maxDiff;
+                                           });
     T maxDiff = storm::utility::zero<T>();
-    auto leftIt = vectorLeft.begin();
-    auto leftIte = vectorLeft.end();
-    auto rightIt = vectorRight.begin();
-    for (; leftIt != leftIte; ++leftIt, ++rightIt) {
-        T diff = *leftIt - *rightIt;
-        T possDiff = storm::utility::abs(diff);
+    for (auto const& possDiff : maxDiffs) {
         maxDiff = maxDiff < possDiff ? possDiff : maxDiff;
     }
     return maxDiff;
@@ -52,6 +52,17 @@ TEST(DftSmtTest, FDEPBoundTest) {
     EXPECT_EQ(storm::dft::utility::FailureBoundFinder::getAlwaysFailedBound(*dft, true, 30), uint64_t(5));
 }
 
+TEST(DftSmtTest, ParallelBoundTest) {
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft = storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/spare5.dft");
+    EXPECT_EQ(storm::dft::utility::FailureBoundFinder::getLeastFailureBound(*dft, true, 30, 3), uint64_t(2));
+    EXPECT_EQ(storm::dft::utility::FailureBoundFinder::getAlwaysFailedBound(*dft, true, 30, 3), uint64_t(4));
+
+    dft = storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/fdep_bound.dft");
+    EXPECT_EQ(storm::dft::utility::FailureBoundFinder::getLeastFailureBound(*dft, true, 30, 3), uint64_t(1));
+    EXPECT_EQ(storm::dft::utility::FailureBoundFinder::getAlwaysFailedBound(*dft, true, 30, 3), uint64_t(5));
+    EXPECT_EQ(storm::dft::api::computeBEFailureBounds(*dft, true, 30, 4), std::make_pair(uint64_t(1), uint64_t(5)));
+}
+
 TEST(DftSmtTest, FDEPConflictTest) {
     std::shared_ptr<storm::dft::storage::DFT<double>> dft =
         storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/spare_conflict_test.dft");
@@ -28,6 +28,20 @@ TEST_P(BddModularizerTest, ProbabilityAtTimeOne) {
     EXPECT_NEAR(checker->getProbabilityAtTimebound(1), param.probabilityAtTimeboundOne, 1e-6);
 }
 
+TEST_P(BddModularizerTest, ProbabilitiesConcurrent) {
+    auto const &param{TestWithParam::GetParam()};
+    auto dft{storm::dft::api::loadDFTGalileoFile<double>(param.filepath)};
+    storm::dft::modelchecker::DftModularizationChecker<double> concurrentChecker{dft, 2};
+    std::vector<double> const timepoints{0.5, 1, 2};
+    auto const expected{checker->getProbabilitiesAtTimepoints(timepoints)};
+    auto const result{concurrentChecker.getProbabilitiesAtTimepoints(timepoints)};
+    ASSERT_EQ(expected.size(), result.size());
+    for (size_t i{0}; i < result.size(); ++i) {
+        EXPECT_NEAR(expected[i], result[i], 1e-6);
+    }
+    EXPECT_NEAR(result[1], param.probabilityAtTimeboundOne, 1e-6);
+}
+
 static std::vector<ModularizerTestData> modularizerTestData{
     {
         "And",
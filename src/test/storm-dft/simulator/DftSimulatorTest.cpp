@@ -4,6 +4,7 @@
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/generator/DftNextStateGenerator.h"
 #include "storm-dft/simulator/DFTTraceSimulator.h"
+#include "storm-dft/simulator/DFTUnreliabilitySimulator.h"
 #include "storm-dft/storage/DftSymmetries.h"
 
 namespace {
@@ -188,4 +189,28 @@ TEST(DftSimulatorTest, HecsUnreliability) {
     EXPECT_NEAR(result, 0.00021997582, 0.001);
 }
 
+TEST(DftSimulatorTest, ConcurrentUnreliability) {
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+        storm::dft::api::prepareForMarkovAnalysis<double>(*(storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/and.dft")));
+    dft->setRelevantEvents(storm::dft::api::computeRelevantEvents({}, {}), false);
+    storm::dft::storage::DftSymmetries symmetries;
+    storm::dft::storage::DFTStateGenerationInfo stateGenerationInfo(dft->buildStateGenerationInfo(symmetries));
+
+    // The estimate only depends on the seed and not on the number of threads
+    storm::dft::simulator::DFTUnreliabilitySimulator<double> sequentialSimulator(*dft, stateGenerationInfo, 5u, 1, 1000);
+    storm::dft::simulator::DFTUnreliabilitySimulator<double> concurrentSimulator(*dft, stateGenerationInfo, 5u, 4, 1000);
+    auto sequentialStatistics = sequentialSimulator.simulate(2, 20000);
+    auto concurrentStatistics = concurrentSimulator.simulate(2, 20000);
+    EXPECT_EQ(20000ul, concurrentStatistics.numberOfTraces);
+    EXPECT_EQ(sequentialStatistics.numberOfSuccessfulTraces, concurrentStatistics.numberOfSuccessfulTraces);
+    EXPECT_NEAR(concurrentStatistics.getProbability(), 0.3995764009, 0.01);
+    EXPECT_LT(concurrentStatistics.confidenceHalfWidth, 0.01);
+
+    // Stop early once the confidence interval is narrow enough
+    auto earlyStatistics = concurrentSimulator.simulate(2, 1000000, 0.01);
+    EXPECT_LT(earlyStatistics.numberOfTraces, 1000000ul);
+    EXPECT_LE(earlyStatistics.confidenceHalfWidth, 0.01);
+    EXPECT_NEAR(earlyStatistics.getProbability(), 0.3995764009, 0.02);
+}
+
 }  // namespace
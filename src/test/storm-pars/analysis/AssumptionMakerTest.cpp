@@ -68,6 +68,50 @@ TEST(AssumptionMakerTest, Brp_without_bisimulation) {
     EXPECT_EQ(storm::expressions::RelationType::Greater, itr->first->getRelationType());
 }
 
+TEST(AssumptionMakerTest, Brp_without_bisimulation_parallel) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=4 & i=N ]";
+    std::string constantsAsString = "";  // e.g. pL=0.9,TOACK=0.5
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto simplifier = storm::transformer::SparseParametricDtmcSimplifier<storm::models::sparse::Dtmc<storm::RationalFunction>>(*model);
+    ASSERT_TRUE(simplifier.simplify(*(formulas[0])));
+    model = simplifier.getSimplifiedModel();
+
+    // Create the region
+    auto vars = storm::models::sparse::getProbabilityParameters(*model);
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.00001 <= pK <= 0.999999, 0.00001 <= pL <= 0.999999", vars);
+
+    auto *extender = new storm::analysis::OrderExtender<storm::RationalFunction, double>(model, formulas[0]);
+    auto criticalTuple = extender->toOrder(region, nullptr);
+    ASSERT_EQ(183ul, std::get<1>(criticalTuple));
+    ASSERT_EQ(186ul, std::get<2>(criticalTuple));
+
+    // The assumptions (and the samples) are checked concurrently, which should not change the results
+    auto assumptionMaker = storm::analysis::AssumptionMaker<storm::RationalFunction, double>(model->getTransitionMatrix());
+    assumptionMaker.setNumberOfThreads(3);
+    auto result = assumptionMaker.createAndCheckAssumptions(std::get<1>(criticalTuple), std::get<2>(criticalTuple), std::get<0>(criticalTuple), region);
+    EXPECT_EQ(3ul, result.size());
+    for (auto res : result) {
+        EXPECT_EQ(storm::analysis::AssumptionStatus::UNKNOWN, res.second);
+    }
+
+    assumptionMaker.initializeCheckingOnSamples(formulas[0], model, region, 10);
+    result = assumptionMaker.createAndCheckAssumptions(std::get<1>(criticalTuple), std::get<2>(criticalTuple), std::get<0>(criticalTuple), region);
+    EXPECT_EQ(1ul, result.size());
+    auto itr = result.begin();
+    EXPECT_EQ(storm::analysis::AssumptionStatus::UNKNOWN, itr->second);
+    EXPECT_EQ("186", itr->first->getFirstOperand()->asVariableExpression().getVariable().getName());
+    EXPECT_EQ("183", itr->first->getSecondOperand()->asVariableExpression().getVariable().getName());
+    EXPECT_EQ(storm::expressions::RelationType::Greater, itr->first->getRelationType());
+}
+
 TEST(AssumptionMakerTest, Simple1) {
     std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/simple1.pm";
     std::string formulaAsString = "P=? [F s=3 ]";
@@ -141,6 +141,41 @@ TYPED_TEST(GradientDescentInstantiationSearcherTest, Simple) {
     ASSERT_NEAR(doubleInstantiation * 4, 1, 1e-6);
 }
 
+TYPED_TEST(GradientDescentInstantiationSearcherTest, SimpleParallel) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/gradient1.pm";
+    std::string formulaAsString = "P>=0.2499 [F s=2]";
+    std::string constantsAsString = "";  // e.g. pL=0.9,TOACK=0.5
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = model->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto simplifier = storm::transformer::SparseParametricDtmcSimplifier<storm::models::sparse::Dtmc<storm::RationalFunction>>(*dtmc);
+    ASSERT_TRUE(simplifier.simplify(*formulas[0]));
+    model = simplifier.getSimplifiedModel();
+    dtmc = model->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    auto vars = storm::models::sparse::getProbabilityParameters(*dtmc);
+
+    storm::derivative::GradientDescentInstantiationSearcher<typename TestFixture::FunctionType, typename TestFixture::ConstantType> checker(*dtmc);
+    std::shared_ptr<storm::logic::Formula> formulaWithoutBounds = formulas[0]->clone();
+    std::shared_ptr<storm::logic::Formula const> formulaNoBound = formulaWithoutBounds->asSharedPointer();
+    std::shared_ptr<FeasibilitySynthesisTask> t = std::make_shared<FeasibilitySynthesisTask>(formulaNoBound);
+    t->setBound(formulas[0]->asOperatorFormula().getBound());
+    std::shared_ptr<FeasibilitySynthesisTask const> feasibilityTask = std::make_shared<FeasibilitySynthesisTask const>(std::move(*t));
+
+    checker.setNumberOfThreads(2);
+    checker.setup(this->env(), feasibilityTask);
+    // The second thread starts at a random point, so we only know that the bound is satisfied.
+    typename TestFixture::ConstantType doubleInstantiation = checker.gradientDescent().second;
+    ASSERT_GE(doubleInstantiation, 0.2499);
+    ASSERT_LE(doubleInstantiation * 4, 1 + 1e-6);
+}
+
 TYPED_TEST(GradientDescentInstantiationSearcherTest, Crowds) {
     std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/crowds3_5.pm";
     std::string formulaAsString = "P<=0.00000001 [F \"observe0Greater1\"]";
@@ -161,6 +161,16 @@ void SparseDerivativeInstantiationModelCheckerTest<TestType>::testModel(std::sha
             ASSERT_NEAR(storm::utility::convertNumber<double>(derivative->getValueVector()[0]), storm::utility::convertNumber<double>(expectedResult), 1e-6)
                 << instantiation;
         }
+
+        // The derivatives w.r.t. all parameters are computed in a single pass.
+        std::vector<VariableType<ValueType>> allParameters(parameters.begin(), parameters.end());
+        auto allDerivatives = derivativeModelChecker.check(env(), instantiation, allParameters);
+        ASSERT_EQ(allParameters.size(), allDerivatives.size());
+        for (uint64_t i = 0; i < allParameters.size(); ++i) {
+            ASSERT_NEAR(storm::utility::convertNumber<double>(allDerivatives[i]->getValueVector()[0]),
+                        storm::utility::convertNumber<double>(testCase.second.at(allParameters[i])), 1e-6)
+                << instantiation;
+        }
     }
 }
 
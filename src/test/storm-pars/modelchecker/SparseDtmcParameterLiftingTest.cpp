@@ -109,6 +109,47 @@ TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob) {
                                            storm::modelchecker::RegionResult::Unknown, true));
 }
 
+TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_Subregions) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P<=0.84 [F s=5 ]";
+    std::string constantsAsString = "";  // e.g. pL=0.9,TOACK=0.5
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+    modelParameters.insert(rewParameters.begin(), rewParameters.end());
+
+    auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(
+        this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+
+    // The bounds for the subregions are computed after the ones for the parent region, i.e., the previous results are reused.
+    // They need to coincide with the bounds computed from scratch.
+    auto parentRegion = storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.9,0.5<=pK<=0.95", modelParameters);
+    std::vector<storm::storage::ParameterRegion<storm::RationalFunction>> subRegions;
+    parentRegion.split(parentRegion.getCenterPoint(), subRegions);
+    for (auto const dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        regionChecker->getBoundAtInitState(this->env(), parentRegion, dir);
+    }
+    for (auto const& subRegion : subRegions) {
+        for (auto const dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            auto freshRegionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(
+                this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+            double expected = storm::utility::convertNumber<double>(freshRegionChecker->getBoundAtInitState(this->env(), subRegion, dir).constantPart());
+            double actual = storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), subRegion, dir).constantPart());
+            EXPECT_NEAR(expected, actual, 1e-5) << subRegion;
+        }
+    }
+}
+
 TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
     typedef typename TestFixture::ValueType ValueType;
 
@@ -0,0 +1,35 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include <carl/core/VariablePool.h>
+
+#include "storm-pars/utility/CompiledRationalFunction.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+TEST(CompiledRationalFunctionTest, Evaluate) {
+    carl::VariablePool::getInstance().clear();
+    storm::RationalFunctionVariable varP = carl::VariablePool::getInstance().getFreshPersistentVariable("p");
+    storm::RationalFunctionVariable varQ = carl::VariablePool::getInstance().getFreshPersistentVariable("q");
+    std::shared_ptr<storm::RawPolynomialCache> cache = std::make_shared<storm::RawPolynomialCache>();
+    auto p = storm::RationalFunction(storm::Polynomial(storm::RawPolynomial(varP), cache));
+    auto q = storm::RationalFunction(storm::Polynomial(storm::RawPolynomial(varQ), cache));
+    auto three = storm::RationalFunction(storm::utility::convertNumber<storm::RationalFunctionCoefficient>(3));
+
+    std::vector<storm::RationalFunction> functions = {p * (storm::RationalFunction(1) - q) / three, p * p * q + q, p / (p + q),
+                                                      storm::RationalFunction(1) - p};
+    for (auto const& function : functions) {
+        storm::utility::parametric::CompiledRationalFunction compiledFunction(function, {varQ, varP});
+        for (double pValue : {0.1, 0.5, 0.75}) {
+            for (double qValue : {0.2, 0.9}) {
+                std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+                valuation.emplace(varP, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(pValue));
+                valuation.emplace(varQ, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(qValue));
+                EXPECT_NEAR(storm::utility::convertNumber<double>(function.evaluate(valuation)), compiledFunction.evaluate({qValue, pValue}), 1e-12);
+            }
+        }
+    }
+}
+
+#endif
@@ -10,9 +10,11 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
 
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
 #include "storm-pars/utility/ModelInstantiator.h"
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
@@ -144,6 +146,62 @@ TEST(ModelInstantiatorTest, BrpProb) {
     }
 }
 
+TEST(ModelInstantiatorTest, BrpProbBatch) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size() == 1);
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc =
+        storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+    std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> valuations;
+    for (double value : {0.8, 0.9, 0.6}) {
+        std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+        valuation.insert(std::make_pair(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value)));
+        valuation.insert(std::make_pair(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(1.5 - value)));
+        valuations.push_back(std::move(valuation));
+    }
+
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> modelInstantiator(*dtmc);
+    std::vector<double> entryValues = modelInstantiator.instantiateTransitionMatrixEntries(valuations);
+    ASSERT_EQ(dtmc->getTransitionMatrix().getEntryCount() * valuations.size(), entryValues.size());
+    for (uint64_t valuation = 0; valuation < valuations.size(); ++valuation) {
+        storm::models::sparse::Dtmc<double> const& instantiated(modelInstantiator.instantiate(valuations[valuation]));
+        uint64_t entry = 0;
+        for (auto const& instantiatedEntry : instantiated.getTransitionMatrix()) {
+            EXPECT_EQ(instantiatedEntry.getValue(), entryValues[entry * valuations.size() + valuation]);
+            ++entry;
+        }
+    }
+
+    storm::Environment env;
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> batchChecker(*dtmc);
+    batchChecker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formulas.front(), true));
+    batchChecker.setInstantiationsAreGraphPreserving(true);
+    auto batchResults = batchChecker.checkBatch(env, valuations);
+    ASSERT_EQ(valuations.size(), batchResults.size());
+
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> checker(*dtmc);
+    checker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formulas.front(), true));
+    uint64_t initialState = *dtmc->getInitialStates().begin();
+    for (uint64_t valuation = 0; valuation < valuations.size(); ++valuation) {
+        auto result = checker.check(env, valuations[valuation]);
+        EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[initialState],
+                    batchResults[valuation]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-4);
+    }
+}
+
 TEST(ModelInstantiatorTest, Brp_Rew) {
     carl::VariablePool::getInstance().clear();
 
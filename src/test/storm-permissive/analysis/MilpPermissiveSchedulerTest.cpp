@@ -64,4 +64,29 @@ TEST(MilpPermissiveSchedulerTest, DieSelection) {
     EXPECT_TRUE(qualitativeResult1[0]);
 }
 
+TEST(MilpPermissiveSchedulerTest, DieSelectionPerScc) {
+    storm::Environment env;
+
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/die_c1.nm");
+    storm::parser::FormulaParser formulaParser(program.getManager().getSharedPointer());
+    auto formulas = formulaParser.parseFromString("P>=0.10 [ F \"one\"];\nP>=0.17 [ F \"one\"];\n");
+    auto const& formula02 = formulas[0].getRawFormula()->asProbabilityOperatorFormula();
+    auto const& formula001 = formulas[1].getRawFormula()->asProbabilityOperatorFormula();
+
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildAllLabels();
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp =
+        storm::builder::ExplicitModelBuilder<double>(program, options).build()->as<storm::models::sparse::Mdp<double>>();
+
+    // The decomposition is sound, so there is no scheduler for an unachievable bound and the found scheduler satisfies the property.
+    EXPECT_FALSE(storm::ps::computePermissiveSchedulerViaMILP<>(*mdp, formula001, true).is_initialized());
+    boost::optional<storm::ps::SubMDPPermissiveScheduler<>> perms = storm::ps::computePermissiveSchedulerViaMILP<>(*mdp, formula02, true);
+    ASSERT_TRUE(perms.is_initialized());
+
+    auto submdp = perms->apply();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(submdp);
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, formula02);
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+}
+
 #endif
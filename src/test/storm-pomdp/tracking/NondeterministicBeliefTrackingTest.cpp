@@ -0,0 +1,88 @@
+#include "storm-config.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-pomdp/generator/BatchedBeliefTracker.h"
+#include "storm-pomdp/generator/NondeterministicBeliefTracker.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm/api/storm.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "test/storm_gtest.h"
+
+namespace {
+std::shared_ptr<storm::models::sparse::Pomdp<double>> buildMaze() {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism");
+    program = storm::utility::prism::preprocess(program, "sl=0.4");
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"goal\" ]", program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp =
+        storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+    return makeCanonic.transform();
+}
+
+std::vector<double> getRisk(storm::models::sparse::Pomdp<double> const& pomdp) {
+    std::vector<double> risk;
+    for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+        risk.push_back(static_cast<double>(state) / pomdp.getNumberOfStates());
+    }
+    return risk;
+}
+}  // namespace
+
+TEST(NondeterministicBeliefTracking, SparseAndDenseAgree) {
+    auto pomdp = buildMaze();
+    uint32_t initialObservation = pomdp->getObservation(pomdp->getInitialStates().getNextSetIndex(0));
+
+    storm::generator::NondeterministicBeliefTracker<double, storm::generator::SparseBeliefState<double>> sparseTracker(*pomdp);
+    storm::generator::NondeterministicBeliefTracker<double, storm::generator::ObservationDenseBeliefState<double>> denseTracker(*pomdp);
+    sparseTracker.setRisk(getRisk(*pomdp));
+    denseTracker.setRisk(getRisk(*pomdp));
+    ASSERT_TRUE(sparseTracker.reset(initialObservation));
+    ASSERT_TRUE(denseTracker.reset(initialObservation));
+    for (uint64_t observation : {0ul, 0ul, 1ul}) {
+        bool sparseConsistent = sparseTracker.track(observation);
+        EXPECT_EQ(sparseConsistent, denseTracker.track(observation));
+        if (!sparseConsistent) {
+            break;
+        }
+        EXPECT_EQ(sparseTracker.getNumberOfBeliefs(), denseTracker.getNumberOfBeliefs());
+        EXPECT_EQ(sparseTracker.getCurrentDimension(), denseTracker.getCurrentDimension());
+        EXPECT_NEAR(sparseTracker.getCurrentRisk(true), denseTracker.getCurrentRisk(true), 1e-10);
+        EXPECT_NEAR(sparseTracker.getCurrentRisk(false), denseTracker.getCurrentRisk(false), 1e-10);
+    }
+}
+
+TEST(NondeterministicBeliefTracking, BatchedAndPruned) {
+    auto pomdp = buildMaze();
+    uint32_t initialObservation = pomdp->getObservation(pomdp->getInitialStates().getNextSetIndex(0));
+    typedef storm::generator::ObservationDenseBeliefState<double> BeliefState;
+
+    typedef storm::generator::NondeterministicBeliefTracker<double, BeliefState>::Options Options;
+    Options prunedOptions;
+    prunedOptions.maxNumberOfBeliefs = 1;
+    storm::generator::BatchedBeliefTracker<double, BeliefState> batchedTracker(*pomdp, 4, Options(), 2);
+    storm::generator::BatchedBeliefTracker<double, BeliefState> prunedTracker(*pomdp, 4, prunedOptions);
+    batchedTracker.setRisk(getRisk(*pomdp));
+    prunedTracker.setRisk(getRisk(*pomdp));
+    std::vector<uint32_t> initialObservations(4, initialObservation);
+    EXPECT_EQ(4ul, batchedTracker.reset(initialObservations).getNumberOfSetBits());
+    EXPECT_EQ(4ul, prunedTracker.reset(initialObservations).getNumberOfSetBits());
+
+    // Traces 0 and 2 as well as traces 1 and 3 observe the same.
+    std::vector<std::vector<uint64_t>> observations = {{0, 0, 0, 0}, {0, 1, 0, 1}, {1, 0, 1, 0}};
+    for (auto const& batch : observations) {
+        auto consistent = batchedTracker.track(batch);
+        auto prunedConsistent = prunedTracker.track(batch);
+        for (uint64_t trace = 0; trace < 4; ++trace) {
+            EXPECT_EQ(consistent.get(trace), consistent.get(trace % 2));
+            if (consistent.get(trace)) {
+                EXPECT_EQ(batchedTracker.getTracker(trace).getNumberOfBeliefs(), batchedTracker.getTracker(trace % 2).getNumberOfBeliefs());
+            }
+            if (prunedConsistent.get(trace)) {
+                EXPECT_LE(prunedTracker.getTracker(trace).getNumberOfBeliefs(), 1ul);
+            }
+        }
+    }
+    EXPECT_GE(batchedTracker.getStatistics().numberOfUpdates, 4ul);
+    EXPECT_GE(batchedTracker.getStatistics().maxLatency, batchedTracker.getStatistics().getAverageLatency());
+}
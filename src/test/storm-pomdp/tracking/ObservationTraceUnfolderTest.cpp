@@ -0,0 +1,48 @@
+#include "storm-config.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm-pomdp/transformer/ObservationTraceUnfolder.h"
+#include "storm/api/storm.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "test/storm_gtest.h"
+
+TEST(ObservationTraceUnfolder, ReusePrefixes) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism");
+    program = storm::utility::prism::preprocess(program, "sl=0.4");
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"goal\" ]", program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp =
+        storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+    pomdp = makeCanonic.transform();
+
+    std::vector<double> risk(pomdp->getNumberOfStates(), 0.0);
+    for (auto state : pomdp->getStates("goal")) {
+        risk[state] = 1.0;
+    }
+    uint32_t initialObservation = pomdp->getObservation(pomdp->getInitialStates().getNextSetIndex(0));
+    auto exprManager = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::pomdp::ObservationTraceUnfolder<double> unfolder(*pomdp, risk, exprManager);
+
+    // Every trace is compared to the unfolding of a fresh unfolder.
+    std::vector<std::vector<uint32_t>> traces = {
+        {initialObservation, 0, 0, 1}, {initialObservation, 0, 0, 0}, {initialObservation, 0}, {initialObservation, 0, 1, 0, 0}, {initialObservation}};
+    for (auto const& trace : traces) {
+        storm::pomdp::ObservationTraceUnfolder<double> freshUnfolder(*pomdp, risk, exprManager);
+        auto expected = freshUnfolder.transform(trace);
+        auto unfolded = unfolder.transform(trace);
+        EXPECT_EQ(expected->getNumberOfStates(), unfolded->getNumberOfStates());
+        EXPECT_EQ(expected->getTransitionMatrix(), unfolded->getTransitionMatrix());
+    }
+
+    // Extending the trace incrementally yields the same unfoldings.
+    unfolder.reset(initialObservation);
+    std::vector<uint32_t> trace = {initialObservation};
+    for (uint32_t observation : {0, 0, 1}) {
+        trace.push_back(observation);
+        storm::pomdp::ObservationTraceUnfolder<double> freshUnfolder(*pomdp, risk, exprManager);
+        EXPECT_EQ(freshUnfolder.transform(trace)->getTransitionMatrix(), unfolder.extend(observation)->getTransitionMatrix());
+    }
+}
@@ -0,0 +1,33 @@
+#include "storm-config.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-pomdp/storage/PomdpMemory.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm-pomdp/transformer/PomdpMemoryUnfolder.h"
+#include "storm/api/storm.h"
+#include "storm/utility/graph.h"
+#include "test/storm_gtest.h"
+
+TEST(PomdpMemoryUnfolder, DropUnreachableStates) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism");
+    program = storm::utility::prism::preprocess(program, "slippery=0.4");
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"goal\" ]", program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp =
+        storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    pomdp = storm::transformer::MakePOMDPCanonic<double>(*pomdp).transform();
+
+    storm::storage::PomdpMemory memory = storm::storage::PomdpMemoryBuilder().build(storm::storage::PomdpMemoryPattern::SelectiveCounter, 3);
+    storm::transformer::PomdpMemoryUnfolder<double> memoryUnfolder(*pomdp, memory);
+    auto fullUnfolding = memoryUnfolder.transform(false);
+    auto reducedUnfolding = memoryUnfolder.transform(true);
+    EXPECT_EQ(pomdp->getNumberOfStates() * memory.getNumberOfStates(), fullUnfolding->getNumberOfStates());
+
+    storm::storage::BitVector allStates(fullUnfolding->getNumberOfStates(), true);
+    auto reachableStates =
+        storm::utility::graph::getReachableStates(fullUnfolding->getTransitionMatrix(), fullUnfolding->getInitialStates(), allStates, ~allStates);
+    EXPECT_EQ(reachableStates.getNumberOfSetBits(), reducedUnfolding->getNumberOfStates());
+    EXPECT_EQ(fullUnfolding->getTransitionMatrix().getSubmatrix(true, reachableStates, reachableStates).getEntryCount(),
+              reducedUnfolding->getTransitionMatrix().getEntryCount());
+    EXPECT_EQ(fullUnfolding->getInitialStates().getNumberOfSetBits(), reducedUnfolding->getInitialStates().getNumberOfSetBits());
+    EXPECT_EQ((fullUnfolding->getStates("goal") & reachableStates).getNumberOfSetBits(), reducedUnfolding->getStates("goal").getNumberOfSetBits());
+}
@@ -0,0 +1,60 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <limits>
+
+#include "storm/adapters/SmallRationalNumber.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+
+TEST(SmallRationalNumberTest, Arithmetic) {
+    storm::SmallRationalNumber const half(1, 2);
+    storm::SmallRationalNumber const third(-2, -6);
+    EXPECT_TRUE(half.isSmall());
+    EXPECT_EQ(storm::SmallRationalNumber(5, 6), half + third);
+    EXPECT_EQ(storm::SmallRationalNumber(1, 6), half - third);
+    EXPECT_EQ(storm::SmallRationalNumber(1, 6), half * third);
+    EXPECT_EQ(storm::SmallRationalNumber(3, 2), half / third);
+    EXPECT_EQ(storm::SmallRationalNumber(-1, 2), -half);
+    EXPECT_TRUE(third < half);
+    EXPECT_TRUE(storm::utility::isOne(half + half));
+    EXPECT_TRUE(storm::utility::isZero(half - half));
+    EXPECT_EQ(0.5, storm::utility::convertNumber<double>(half));
+    EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("1/3")), storm::utility::convertNumber<storm::RationalNumber>(third));
+}
+
+TEST(SmallRationalNumberTest, Overflow) {
+    int64_t const maximalValue = std::numeric_limits<int64_t>::max();
+    storm::SmallRationalNumber const large(maximalValue);
+    storm::SmallRationalNumber const sum = large + storm::utility::one<storm::SmallRationalNumber>();
+    EXPECT_FALSE(sum.isSmall());
+    storm::RationalNumber const expectedSum =
+        storm::utility::convertNumber<storm::RationalNumber>(static_cast<int_fast64_t>(maximalValue)) + storm::utility::one<storm::RationalNumber>();
+    EXPECT_EQ(expectedSum, sum.toRationalNumber());
+
+    // Values are compared and hashed independently of how they are stored.
+    storm::SmallRationalNumber const difference = sum - storm::utility::one<storm::SmallRationalNumber>();
+    EXPECT_FALSE(difference.isSmall());
+    EXPECT_EQ(large, difference);
+    EXPECT_EQ(large.hash(), difference.hash());
+    EXPECT_TRUE(large < sum);
+
+    storm::SmallRationalNumber const tiny(1, maximalValue);
+    storm::SmallRationalNumber const product = tiny * tiny;
+    EXPECT_FALSE(product.isSmall());
+    EXPECT_EQ(tiny, product / tiny);
+    EXPECT_TRUE(storm::SmallRationalNumber(product.toRationalNumber()) == product);
+    EXPECT_TRUE(storm::SmallRationalNumber(tiny.toRationalNumber()).isSmall());
+}
+
+TEST(SmallRationalNumberTest, Matrix) {
+    storm::storage::SparseMatrixBuilder<storm::RationalNumber> builder;
+    builder.addNextValue(0, 0, storm::utility::convertNumber<storm::RationalNumber>(std::string("1/3")));
+    builder.addNextValue(0, 1, storm::utility::convertNumber<storm::RationalNumber>(std::string("2/3")));
+    builder.addNextValue(1, 1, storm::utility::one<storm::RationalNumber>());
+    storm::storage::SparseMatrix<storm::RationalNumber> matrix = builder.build();
+
+    storm::storage::SparseMatrix<storm::SmallRationalNumber> smallMatrix = matrix.toValueType<storm::SmallRationalNumber>();
+    EXPECT_EQ(storm::SmallRationalNumber(1), smallMatrix.getRowSum(0));
+    EXPECT_EQ(matrix, smallMatrix.toValueType<storm::RationalNumber>());
+}
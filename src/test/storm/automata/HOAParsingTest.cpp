@@ -1,4 +1,5 @@
 #include "storm/automata/DeterministicAutomaton.h"
+#include "storm/exceptions/InvalidOperationException.h"
 #include "test/storm_gtest.h"
 
 #include <sstream>
@@ -28,4 +29,47 @@ TEST(DeterministicAutomaton, ParseAutomaton) {
     storm::automata::DeterministicAutomaton::ptr da;
     ASSERT_NO_THROW(da = storm::automata::DeterministicAutomaton::parse(in));
     // da->printHOA(std::cout);
+    EXPECT_EQ(2ul, da->getSuccessor(0, 0));
+    EXPECT_EQ(0ul, da->getSuccessor(0, 1));
+    EXPECT_EQ(1ul, da->getSuccessor(0, 2));
+    EXPECT_EQ(1ul, da->getSuccessor(0, 3));
+    EXPECT_EQ(2ul, da->getSuccessor(2, 1));
+}
+
+TEST(DeterministicAutomaton, ParseAutomatonWithManyAPs) {
+    // F (p0 & p23) over 24 atomic propositions, where the labels only refer to some of them
+    std::string automaton =
+        "HOA: v1\n"
+        "States: 2\n"
+        "Start: 0\n"
+        "acc-name: Buchi\n"
+        "Acceptance: 1 Inf(0)\n"
+        "AP: 24";
+    for (unsigned int ap = 0; ap < 24; ++ap) {
+        automaton += " \"p" + std::to_string(ap) + "\"";
+    }
+    automaton +=
+        "\n--BODY--\n"
+        "State: 0\n"
+        "  [0 & 23] 1\n"
+        "  [!0 | !23] 0\n"
+        "State: 1 { 0 }\n"
+        "  [t] 1\n"
+        "--END--\n";
+
+    std::istringstream in(automaton);
+    storm::automata::DeterministicAutomaton::ptr da;
+    ASSERT_NO_THROW(da = storm::automata::DeterministicAutomaton::parse(in));
+    EXPECT_EQ(2ul, da->getNumberOfStates());
+    EXPECT_EQ(0ul, da->getSuccessor(0, 0));
+    EXPECT_EQ(0ul, da->getSuccessor(0, 1ul | (1ul << 5)));
+    EXPECT_EQ(1ul, da->getSuccessor(0, 1ul | (1ul << 23)));
+    EXPECT_EQ(1ul, da->getSuccessor(0, (1ul << 24) - 1));
+    EXPECT_EQ(1ul, da->getSuccessor(1, 42));
+
+    // Letters for which state 0 has no successor are rejected.
+    std::string incomplete = automaton;
+    incomplete.replace(incomplete.find("[!0 | !23]"), 10, "[!0]");
+    std::istringstream incompleteIn(incomplete);
+    STORM_SILENT_EXPECT_THROW(storm::automata::DeterministicAutomaton::parse(incompleteIn), storm::exceptions::InvalidOperationException);
 }
@@ -0,0 +1,82 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+TEST(CompiledStateExpressionTest, AgreesWithEvaluator) {
+    std::string input = R"(dtmc
+module test
+    b : bool init false;
+    x : [-2..5] init 0;
+    y : [3..3] init 3;
+    [] true -> 1 : (x' = 0);
+endmodule
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "testfile");
+    storm::generator::VariableInformation variableInformation(program, 32);
+    auto& manager = program.getManager();
+    storm::expressions::Variable b = manager.getVariable("b");
+    storm::expressions::Variable x = manager.getVariable("x");
+    storm::expressions::Variable y = manager.getVariable("y");
+
+    std::vector<storm::expressions::Expression> expressions = {
+        b.getExpression(),
+        !b.getExpression() || x.getExpression() > manager.integer(2),
+        storm::expressions::iff(b.getExpression(), x.getExpression() <= y.getExpression()),
+        storm::expressions::implies(b.getExpression(), x.getExpression() != manager.integer(-1)),
+        storm::expressions::xclusiveor(b.getExpression(), x.getExpression() == manager.integer(5)),
+        x.getExpression() * x.getExpression() - y.getExpression() + manager.integer(1),
+        storm::expressions::ite(b.getExpression(), -x.getExpression(), storm::expressions::minimum(x.getExpression(), y.getExpression())),
+        storm::expressions::maximum(x.getExpression(), manager.integer(0)) >= y.getExpression(),
+        storm::expressions::floor(x.getExpression())};
+    std::vector<storm::generator::CompiledStateExpression> compiledExpressions;
+    for (auto const& expression : expressions) {
+        auto compiledExpression = storm::generator::CompiledStateExpression::compile(expression, variableInformation);
+        ASSERT_TRUE(compiledExpression.has_value()) << expression;
+        compiledExpressions.push_back(std::move(compiledExpression.value()));
+    }
+
+    auto const& booleanVariable = variableInformation.booleanVariables.front();
+    auto const& integerVariable =
+        variableInformation.integerVariables.front().variable == x ? variableInformation.integerVariables.front() : variableInformation.integerVariables.back();
+    storm::expressions::ExpressionEvaluator<double> evaluator(manager);
+    for (bool bValue : {false, true}) {
+        for (int64_t xValue = -2; xValue <= 5; ++xValue) {
+            storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+            state.set(booleanVariable.bitOffset, bValue);
+            state.setFromInt(integerVariable.bitOffset, integerVariable.bitWidth, xValue - integerVariable.lowerBound);
+            storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+            for (uint64_t i = 0; i < expressions.size(); ++i) {
+                if (expressions[i].hasBooleanType()) {
+                    EXPECT_EQ(evaluator.asBool(expressions[i]), compiledExpressions[i].evaluateAsBool(state)) << expressions[i];
+                } else {
+                    EXPECT_EQ(evaluator.asInt(expressions[i]), compiledExpressions[i].evaluateAsInt(state)) << expressions[i];
+                }
+            }
+        }
+    }
+}
+
+TEST(CompiledStateExpressionTest, UnsupportedExpressions) {
+    std::string input = R"(dtmc
+module test
+    x : [0..5] init 0;
+    [] true -> 1 : (x' = 0);
+endmodule
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "testfile");
+    storm::generator::VariableInformation variableInformation(program, 32);
+    auto& manager = program.getManager();
+    storm::expressions::Variable x = manager.getVariable("x");
+    storm::expressions::Variable z = manager.declareIntegerVariable("z");
+
+    // Rational arithmetic and variables that are not part of the state are evaluated by the evaluator.
+    EXPECT_FALSE(storm::generator::CompiledStateExpression::compile(x.getExpression() / manager.integer(2), variableInformation).has_value());
+    EXPECT_FALSE(storm::generator::CompiledStateExpression::compile(x.getExpression() > manager.rational(0.5), variableInformation).has_value());
+    EXPECT_FALSE(storm::generator::CompiledStateExpression::compile(x.getExpression() + z.getExpression(), variableInformation).has_value());
+    EXPECT_TRUE(storm::generator::CompiledStateExpression::compile(x.getExpression() + manager.integer(2), variableInformation).has_value());
+}
@@ -0,0 +1,71 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/api/builder.h"
+#include "storm/builder/ConstantSweepModelBuilder.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+namespace {
+
+void expectApproximatelyEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+    ASSERT_EQ(expected.getType(), actual.getType());
+    ASSERT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+    ASSERT_EQ(expected.getNumberOfTransitions(), actual.getNumberOfTransitions());
+    EXPECT_EQ(expected.getStateLabeling(), actual.getStateLabeling());
+    auto const& expectedMatrix = expected.getTransitionMatrix();
+    auto const& actualMatrix = actual.getTransitionMatrix();
+    ASSERT_EQ(expectedMatrix.getRowCount(), actualMatrix.getRowCount());
+    for (uint64_t row = 0; row < expectedMatrix.getRowCount(); ++row) {
+        auto actualIt = actualMatrix.begin(row);
+        for (auto const& entry : expectedMatrix.getRow(row)) {
+            EXPECT_EQ(entry.getColumn(), actualIt->getColumn());
+            EXPECT_NEAR(entry.getValue(), actualIt->getValue(), 1e-12);
+            ++actualIt;
+        }
+    }
+    ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+}
+
+}  // namespace
+
+TEST(ConstantSweepModelBuilderTest, ReuseStateSpace) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/pdtmc/parametric_die.pm");
+    storm::builder::BuilderOptions options(true, true);
+    storm::builder::ConstantSweepModelBuilder<double> builder(program, options);
+    EXPECT_TRUE(builder.isReusingStateSpace());
+
+    auto& manager = program.getManager();
+    storm::expressions::Variable p = manager.getVariable("p");
+    for (double value : {0.5, 0.3, 0.9}) {
+        std::map<storm::expressions::Variable, storm::expressions::Expression> definitions = {{p, manager.rational(value)}};
+        auto model = builder.build(definitions);
+        auto expectedModel = storm::api::buildSparseModel<double>(program.defineUndefinedConstants(definitions).substituteConstantsFormulas(), options);
+        expectApproximatelyEqualModels(*expectedModel, *model);
+    }
+
+    // For p=1, some transitions get probability zero which changes the reachable states.
+    std::map<storm::expressions::Variable, storm::expressions::Expression> definitions = {{p, manager.rational(1.0)}};
+    auto model = builder.build(definitions);
+    auto expectedModel = storm::api::buildSparseModel<double>(program.defineUndefinedConstants(definitions).substituteConstantsFormulas(), options);
+    expectApproximatelyEqualModels(*expectedModel, *model);
+}
+
+TEST(ConstantSweepModelBuilderTest, StructuralConstants) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/crowds_cost_bounded.pm");
+    storm::builder::BuilderOptions options(true, true);
+    storm::builder::ConstantSweepModelBuilder<double> builder(program, options);
+    EXPECT_FALSE(builder.isReusingStateSpace());
+
+    auto& manager = program.getManager();
+    std::vector<std::map<storm::expressions::Variable, storm::expressions::Expression>> sweep;
+    for (int64_t n = 3; n <= 4; ++n) {
+        sweep.push_back({{manager.getVariable("CrowdSize"), manager.integer(n)}});
+    }
+    auto models = storm::api::buildSparseModelsForConstantSweep<double>(program, sweep, options);
+    ASSERT_EQ(2ul, models.size());
+    for (uint64_t i = 0; i < sweep.size(); ++i) {
+        auto expectedModel = storm::api::buildSparseModel<double>(program.defineUndefinedConstants(sweep[i]).substituteConstantsFormulas(), options);
+        expectApproximatelyEqualModels(*expectedModel, *models[i]);
+    }
+}
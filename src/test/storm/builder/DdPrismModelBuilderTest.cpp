@@ -1,6 +1,7 @@
 #include "storm-config.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/builder/DdVariableOrder.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Dtmc.h"
@@ -10,6 +11,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
 #include "storm/storage/SymbolicModelDescription.h"
+#include "storm/utility/dd.h"
 #include "test/storm_gtest.h"
 
 TEST(DdPrismModelBuilderTest_Sylvan, Dtmc) {
@@ -357,3 +359,51 @@ TEST(UnboundedTest_Cudd, Mdp) {
     storm::prism::Program program = modelDescription.preprocess("N=1").asPrismProgram();
     EXPECT_FALSE(storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().canHandle(program));
 }
+
+TEST(DdPrismModelBuilderTest, ForceVariableOrder) {
+    // A chain whose vertices are declared in an interleaved order.
+    std::vector<std::vector<uint64_t>> hyperedges = {{0, 5}, {1, 6}, {2, 7}, {3, 8}, {4, 9}, {5, 1}, {6, 2}, {7, 3}, {8, 4}};
+    std::vector<uint64_t> declarationOrder = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<uint64_t> forceOrder = storm::builder::computeForceOrder(10, hyperedges);
+    EXPECT_EQ(41ul, storm::builder::computeTotalSpan(declarationOrder, hyperedges));
+    EXPECT_EQ(9ul, storm::builder::computeTotalSpan(forceOrder, hyperedges));
+
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::vector<storm::expressions::Variable> variables = storm::builder::computeVariableOrder(program, storm::builder::DdVariableOrder::Force);
+    std::set<storm::expressions::Variable> allVariables;
+    for (auto const& module : program.getModules()) {
+        auto moduleVariables = module.getAllExpressionVariables();
+        allVariables.insert(moduleVariables.begin(), moduleVariables.end());
+    }
+    for (auto const& variable : program.getGlobalIntegerVariables()) {
+        allVariables.insert(variable.getExpressionVariable());
+    }
+    for (auto const& variable : program.getGlobalBooleanVariables()) {
+        allVariables.insert(variable.getExpressionVariable());
+    }
+    EXPECT_EQ(allVariables.size(), variables.size());
+    EXPECT_EQ(allVariables, std::set<storm::expressions::Variable>(variables.begin(), variables.end()));
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, PartitionedReachability) {
+    for (std::string const& file : {"/mdp/leader3.nm", "/mdp/csma2-2.nm", "/dtmc/crowds-5-5.pm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file).preprocess().asPrismProgram();
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> model =
+            storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program);
+
+        // Every variable forms its own group, so the interleaved transitions are split as far as possible.
+        std::vector<std::set<storm::expressions::Variable>> groups;
+        for (auto const& variable : model->getRowVariables()) {
+            groups.push_back({variable});
+        }
+        auto parts = storm::utility::dd::partitionTransitionRelation<storm::dd::DdType::CUDD>({model->getQualitativeTransitionMatrix(false)}, groups,
+                                                                                               model->getRowColumnMetaVariablePairs());
+        EXPECT_LT(1ul, parts.size());
+        for (auto strategy : {storm::builder::DdReachabilityStrategy::BreadthFirst, storm::builder::DdReachabilityStrategy::Chaining,
+                              storm::builder::DdReachabilityStrategy::Saturation}) {
+            auto reachableStates = storm::utility::dd::computeReachableStates(model->getInitialStates(), parts, strategy).first;
+            EXPECT_EQ(model->getReachableStates(), reachableStates) << "Strategy " << strategy << " on " << file;
+        }
+    }
+}
@@ -1,11 +1,14 @@
 #include <storm/generator/PrismNextStateGenerator.h>
+#include <numeric>
 #include "storm-config.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/helper/DistributedValueIterationHelper.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/PrismChoiceOrigins.h"
 #include "test/storm_gtest.h"
 
 TEST(ExplicitPrismModelBuilderTest, Dtmc) {
@@ -225,3 +228,253 @@ TEST(ExplicitPrismModelBuilderTest, CallbackActionMask) {
     EXPECT_EQ(13ul, model->getNumberOfStates());
     EXPECT_EQ(20ul, model->getNumberOfTransitions());
 }
+
+TEST(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions;
+    parallelOptions.numberOfThreads = 4;
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels().setBuildAllRewardModels().setBuildChoiceLabels().setBuildStateValuations();
+
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/csma2-2.nm", "/mdp/firewire3-0.5.nm", "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        auto parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+        ASSERT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates()) << file;
+        EXPECT_EQ(sequentialModel->getTransitionMatrix(), parallelModel->getTransitionMatrix()) << file;
+        EXPECT_EQ(sequentialModel->getInitialStates(), parallelModel->getInitialStates()) << file;
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling()) << file;
+        EXPECT_TRUE(sequentialModel->getChoiceLabeling() == parallelModel->getChoiceLabeling()) << file;
+        for (auto const& rewModel : sequentialModel->getRewardModels()) {
+            auto const& parallelRewModel = parallelModel->getRewardModel(rewModel.first);
+            if (rewModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewModel.second.getStateRewardVector(), parallelRewModel.getStateRewardVector()) << file << ": " << rewModel.first;
+            }
+            if (rewModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewModel.second.getStateActionRewardVector(), parallelRewModel.getStateActionRewardVector()) << file << ": " << rewModel.first;
+            }
+        }
+        for (uint64_t state = 0; state < sequentialModel->getNumberOfStates(); ++state) {
+            EXPECT_EQ(sequentialModel->getStateValuations().toString(state), parallelModel->getStateValuations().toString(state)) << file;
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, SymmetryReduction) {
+    std::string input = R"(dtmc
+        module p1
+            s1 : [0..2] init 0;
+            [] s1 < 2 -> 0.5 : (s1'=s1+1) + 0.5 : (s1'=s1);
+            [] s1 = 2 -> true;
+        endmodule
+        module p2 = p1 [s1=s2] endmodule
+        module p3 = p1 [s1=s3] endmodule
+        label "first" = s1 = 2;
+    )";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "testfile");
+
+    storm::generator::NextStateGeneratorOptions options;
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(27ul, model->getNumberOfStates());
+    EXPECT_EQ(81ul, model->getNumberOfTransitions());
+
+    // Only the multisets of the local states of the three replicas are explored.
+    options.setApplySymmetryReduction();
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(10ul, model->getNumberOfStates());
+    EXPECT_EQ(22ul, model->getNumberOfTransitions());
+    auto const& initialRow = model->getTransitionMatrix().getRow(*model->getInitialStates().begin());
+    for (auto const& entry : initialRow) {
+        EXPECT_EQ(0.5, entry.getValue());
+    }
+
+    // The label distinguishes the first replica, so the reduction must not be applied.
+    options.setBuildAllLabels();
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(27ul, model->getNumberOfStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, PartialOrderReduction) {
+    std::string input = R"(mdp
+        module m1
+            x1 : [0..2] init 0;
+            [] x1 < 2 -> (x1'=x1+1);
+        endmodule
+        module m2
+            x2 : [0..2] init 0;
+            [] x2 < 2 -> (x2'=x2+1);
+        endmodule
+        label "first" = x1 = 2;
+        label "both" = x1 = 2 & x2 = 2;
+    )";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "testfile");
+
+    storm::generator::NextStateGeneratorOptions options;
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(9ul, model->getNumberOfStates());
+    EXPECT_EQ(13ul, model->getNumberOfTransitions());
+
+    // The commands of both modules are independent and invisible, so only one interleaving is explored.
+    options.setApplyPartialOrderReduction();
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(5ul, model->getNumberOfStates());
+    EXPECT_EQ(5ul, model->getNumberOfTransitions());
+
+    // Only the command of the second module is invisible for the first label, so it is executed first.
+    options.addLabel("first");
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(5ul, model->getNumberOfStates());
+    EXPECT_EQ(1ul, model->getStates("first").getNumberOfSetBits());
+
+    // The second label makes all commands visible.
+    options.addLabel("both");
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(9ul, model->getNumberOfStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, DistributedExploration) {
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels().setBuildAllRewardModels();
+    bool const singleProcess = storm::utility::mpi::Communicator::world().getNumberOfRanks() == 1;
+
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/two_dice.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        auto components = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).buildDistributed();
+        EXPECT_EQ(sequentialModel->getType(), components.modelType) << file;
+        EXPECT_EQ(sequentialModel->getNumberOfStates(), components.firstStateOfRank.back()) << file;
+        if (singleProcess) {
+            // Within a single process, the states are explored in the same order as in a sequential exploration.
+            EXPECT_EQ(sequentialModel->getTransitionMatrix(), components.transitionMatrix) << file;
+            EXPECT_TRUE(sequentialModel->getStateLabeling() == components.stateLabeling) << file;
+        }
+    }
+
+    // The local parts of the model can be passed to the distributed value iteration without gathering the model.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto components = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).buildDistributed();
+    storm::solver::helper::DistributedValueIterationHelper<true> helper(components.transitionMatrix, components.firstStateOfRank);
+    std::vector<double> values(helper.getNumberOfOwnedStates(), 0.0);
+    uint64_t numIterations = 0;
+    EXPECT_EQ(storm::solver::SolverStatus::Converged,
+              helper.VIOnOwnedStates(values, components.rewardModels.at("coin_flips").getStateActionRewardVector(), numIterations, false, 1e-10));
+    for (auto const& initialState : components.stateLabeling.getStates("init")) {
+        EXPECT_NEAR(11.0 / 3.0, values[initialState], 1e-6);
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, DiskBackedStateStorage) {
+    storm::builder::ExplicitModelBuilder<double>::Options diskOptions;
+    diskOptions.maximalNumberOfStatesInMemory = 100;
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels().setBuildAllRewardModels();
+
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/csma2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        auto diskBackedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, diskOptions).build();
+        ASSERT_EQ(sequentialModel->getNumberOfStates(), diskBackedModel->getNumberOfStates()) << file;
+        EXPECT_EQ(sequentialModel->getTransitionMatrix(), diskBackedModel->getTransitionMatrix()) << file;
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == diskBackedModel->getStateLabeling()) << file;
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, ChoiceOriginsAndLabels) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildChoiceLabels().setBuildChoiceOrigins();
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    ASSERT_TRUE(model->hasChoiceOrigins());
+    ASSERT_TRUE(model->hasChoiceLabeling());
+    auto const& choiceOrigins = model->getChoiceOrigins()->asPrismChoiceOrigins();
+    auto const& choiceLabeling = model->getChoiceLabeling();
+    ASSERT_EQ(model->getNumberOfChoices(), choiceOrigins.getNumberOfChoices());
+
+    // Equal command sets have to share their identifier and choices with the same origin have the same labels.
+    std::map<storm::storage::sparse::PrismChoiceOrigins::CommandSet, uint64_t> commandSetToIdentifier = {
+        {{}, storm::storage::sparse::ChoiceOrigins::getIdentifierForChoicesWithNoOrigin()}};
+    std::map<uint64_t, std::set<std::string>> identifierToLabels;
+    for (uint64_t choice = 0; choice < model->getNumberOfChoices(); ++choice) {
+        uint64_t identifier = choiceOrigins.getIdentifier(choice);
+        ASSERT_LT(identifier, choiceOrigins.getNumberOfIdentifiers());
+        EXPECT_EQ(identifier, commandSetToIdentifier.emplace(choiceOrigins.getCommandSet(choice), identifier).first->second);
+        auto labels = choiceLabeling.getLabelsOfChoice(choice);
+        EXPECT_EQ(labels, identifierToLabels.emplace(identifier, labels).first->second);
+    }
+    EXPECT_EQ(commandSetToIdentifier.size(), choiceOrigins.getNumberOfIdentifiers());
+}
+
+TEST(ExplicitPrismModelBuilderTest, ProbabilityGuidedExploration) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    auto fullModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+
+    // Without a budget, all states are explored.
+    storm::builder::ExplicitModelBuilder<double>::Options builderOptions;
+    builderOptions.explorationOrder = storm::builder::ExplorationOrder::Probability;
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, builderOptions).build();
+    EXPECT_EQ(fullModel->getNumberOfStates(), model->getNumberOfStates());
+    EXPECT_EQ(fullModel->getNumberOfTransitions(), model->getNumberOfTransitions());
+    EXPECT_TRUE(model->getStates("unexplored").empty());
+
+    // Otherwise, the exploration stops early and the remaining states become absorbing.
+    builderOptions.explorationMassThreshold = 0.5;
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, builderOptions).build();
+    EXPECT_LT(model->getNumberOfStates(), fullModel->getNumberOfStates());
+    auto const& unexploredStates = model->getStates("unexplored");
+    EXPECT_FALSE(unexploredStates.empty());
+    for (auto const& state : unexploredStates) {
+        auto row = model->getTransitionMatrix().getRow(state);
+        ASSERT_EQ(1ull, row.getNumberOfEntries());
+        EXPECT_EQ(state, row.begin()->getColumn());
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, ChainCompression) {
+    std::string input = R"(dtmc
+        module m
+            s : [0..6] init 0;
+            [] s = 0 -> 0.5 : (s'=1) + 0.5 : (s'=3);
+            [] s = 1 -> (s'=2);
+            [] s = 2 -> (s'=4);
+            [] s = 3 -> (s'=5);
+            [] s = 4 -> true;
+            [] s = 5 -> (s'=6);
+            [] s = 6 -> (s'=5);
+        endmodule
+        rewards "r"
+            s = 2 : 1;
+        endrewards
+        label "goal" = s = 4;
+    )";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "testfile");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.addLabel("goal");
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(7ul, model->getNumberOfStates());
+
+    // The chains of the states 1 and 3 are skipped. The latter ends in a cycle, of which one state is kept.
+    storm::builder::ExplicitModelBuilder<double>::Options builderOptions;
+    builderOptions.compressChains = true;
+    for (auto explorationOrder : {storm::builder::ExplorationOrder::Bfs, storm::builder::ExplorationOrder::Dfs}) {
+        builderOptions.explorationOrder = explorationOrder;
+        model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, builderOptions).build();
+        EXPECT_EQ(3ul, model->getNumberOfStates());
+        EXPECT_EQ(4ul, model->getNumberOfTransitions());
+        ASSERT_EQ(1ull, model->getStates("goal").getNumberOfSetBits());
+        auto const& initialRow = model->getTransitionMatrix().getRow(*model->getInitialStates().begin());
+        ASSERT_EQ(2ull, initialRow.getNumberOfEntries());
+        for (auto const& entry : initialRow) {
+            EXPECT_EQ(0.5, entry.getValue());
+        }
+        EXPECT_EQ(0.5, model->getTransitionMatrix().getConstrainedRowSum(*model->getInitialStates().begin(), model->getStates("goal")));
+    }
+
+    // States with rewards are kept.
+    generatorOptions.setBuildAllRewardModels();
+    builderOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, builderOptions).build();
+    EXPECT_EQ(4ul, model->getNumberOfStates());
+    auto const& stateRewards = model->getRewardModel("r").getStateRewardVector();
+    EXPECT_EQ(1.0, std::accumulate(stateRewards.begin(), stateRewards.end(), 0.0));
+}
@@ -0,0 +1,108 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/generator/IntervalGuardEvaluator.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+TEST(IntervalGuardEvaluatorTest, AgreesWithEvaluator) {
+    std::string input = R"(dtmc
+module test
+    b : bool init false;
+    x : [-2..5] init 0;
+    [] true -> 1 : (x' = 0);
+endmodule
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "testfile");
+    storm::generator::VariableInformation variableInformation(program, 32);
+    auto& manager = program.getManager();
+    storm::expressions::Expression b = manager.getVariable("b").getExpression();
+    storm::expressions::Expression x = manager.getVariable("x").getExpression();
+
+    std::vector<storm::expressions::Expression> guards = {manager.boolean(true),
+                                                          b,
+                                                          !b && x >= manager.integer(1),
+                                                          manager.integer(-1) < x && x <= manager.integer(3) && b,
+                                                          x == manager.integer(2) + manager.integer(3),
+                                                          x > manager.integer(2) && x < manager.integer(3),
+                                                          x <= manager.integer(7) && x >= manager.integer(-5)};
+    storm::generator::IntervalGuardEvaluator intervalGuards;
+    for (uint64_t i = 0; i < guards.size(); ++i) {
+        ASSERT_TRUE(intervalGuards.addGuard(i, guards[i], variableInformation)) << guards[i];
+    }
+    EXPECT_FALSE(intervalGuards.addGuard(guards.size(), b || x > manager.integer(0), variableInformation));
+    EXPECT_FALSE(intervalGuards.addGuard(guards.size(), x != manager.integer(0), variableInformation));
+    EXPECT_FALSE(intervalGuards.hasGuard(guards.size()));
+    EXPECT_EQ(guards.size(), intervalGuards.getNumberOfGuards());
+
+    auto const& booleanVariable = variableInformation.booleanVariables.front();
+    auto const& integerVariable = variableInformation.integerVariables.front();
+    storm::expressions::ExpressionEvaluator<double> evaluator(manager);
+    for (bool bValue : {false, true}) {
+        for (int64_t xValue = -2; xValue <= 5; ++xValue) {
+            storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+            state.set(booleanVariable.bitOffset, bValue);
+            state.setFromInt(integerVariable.bitOffset, integerVariable.bitWidth, xValue - integerVariable.lowerBound);
+            storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+            intervalGuards.evaluate(state);
+            for (uint64_t i = 0; i < guards.size(); ++i) {
+                EXPECT_EQ(evaluator.asBool(guards[i]), intervalGuards.isSatisfied(i)) << guards[i] << " with b=" << bValue << ", x=" << xValue;
+            }
+        }
+    }
+}
+
+TEST(IntervalGuardEvaluatorTest, BatchAgreesWithSingleStates) {
+    std::string input = R"(dtmc
+module test
+    b : bool init false;
+    x : [0..9] init 0;
+    [] true -> 1 : (x' = 0);
+endmodule
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "testfile");
+    storm::generator::VariableInformation variableInformation(program, 32);
+    auto& manager = program.getManager();
+    storm::expressions::Expression b = manager.getVariable("b").getExpression();
+    storm::expressions::Expression x = manager.getVariable("x").getExpression();
+
+    std::vector<storm::expressions::Expression> guards = {b && x < manager.integer(4), !b, x >= manager.integer(3) && x <= manager.integer(6),
+                                                          x == manager.integer(9)};
+    storm::generator::IntervalGuardEvaluator intervalGuards;
+    for (uint64_t i = 0; i < guards.size(); ++i) {
+        ASSERT_TRUE(intervalGuards.addGuard(i, guards[i], variableInformation));
+    }
+
+    auto const& booleanVariable = variableInformation.booleanVariables.front();
+    auto const& integerVariable = variableInformation.integerVariables.front();
+    std::vector<storm::generator::CompressedState> states;
+    for (bool bValue : {false, true}) {
+        for (int64_t xValue = 0; xValue <= 9; ++xValue) {
+            states.emplace_back(variableInformation.getTotalBitOffset(true));
+            states.back().set(booleanVariable.bitOffset, bValue);
+            states.back().setFromInt(integerVariable.bitOffset, integerVariable.bitWidth, xValue - integerVariable.lowerBound);
+        }
+    }
+    std::vector<storm::generator::CompressedState const*> batch;
+    for (auto const& state : states) {
+        batch.push_back(&state);
+    }
+
+    std::vector<std::vector<bool>> expected;
+    for (auto const& state : states) {
+        intervalGuards.evaluate(state);
+        expected.emplace_back();
+        for (uint64_t i = 0; i < guards.size(); ++i) {
+            expected.back().push_back(intervalGuards.isSatisfied(i));
+        }
+    }
+    intervalGuards.evaluate(batch);
+    for (uint64_t position = 0; position < states.size(); ++position) {
+        intervalGuards.selectState(position);
+        for (uint64_t i = 0; i < guards.size(); ++i) {
+            EXPECT_EQ(expected[position][i], intervalGuards.isSatisfied(i)) << guards[i] << " in state " << position;
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/builder/ModelSizeEstimation.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/utility/AutomaticSettings.h"
+
+namespace {
+
+storm::jani::Model getJaniModelFromPrism(std::string const& pathInTestResourcesDir) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/" + pathInTestResourcesDir);
+    return modelDescription.toJani().preprocess().asJaniModel();
+}
+
+TEST(ModelSizeEstimationTest, CompleteExploration) {
+    auto janiModel = getJaniModelFromPrism("/mdp/two_dice.nm");
+    auto estimate = storm::builder::estimateModelSize(janiModel, 1000);
+    ASSERT_TRUE(estimate.has_value());
+    EXPECT_TRUE(estimate->exact);
+    EXPECT_EQ(169ul, estimate->numberOfStates);
+    EXPECT_EQ(436ul, estimate->numberOfTransitions);
+    EXPECT_LE(estimate->numberOfStates, estimate->numberOfChoices);
+}
+
+TEST(ModelSizeEstimationTest, PartialExploration) {
+    auto janiModel = getJaniModelFromPrism("/mdp/two_dice.nm");
+    auto estimate = storm::builder::estimateModelSize(janiModel, 50);
+    ASSERT_TRUE(estimate.has_value());
+    EXPECT_FALSE(estimate->exact);
+    EXPECT_LE(50ul, estimate->numberOfStates);
+    EXPECT_LE(estimate->numberOfStates, janiModel.getModelInformation().stateDomainSize);
+    EXPECT_LE(estimate->numberOfStates, estimate->numberOfTransitions);
+}
+
+TEST(ModelSizeEstimationTest, RestrictAutomaticEngineToMemory) {
+    auto janiModel = getJaniModelFromPrism("/mdp/two_dice.nm");
+    auto properties = storm::api::parsePropertiesForJaniModel("Pmin=? [F s1=7 & s2=7]", janiModel);
+    auto estimate = storm::builder::estimateModelSize(janiModel, 1000);
+    ASSERT_TRUE(estimate.has_value());
+
+    storm::utility::AutomaticSettings settings;
+    settings.predict(janiModel, properties.front());
+    auto const predictedEngine = settings.getEngine();
+    settings.restrictToMemory(estimate.value(), 1ull << 40);
+    EXPECT_EQ(predictedEngine, settings.getEngine());
+
+    settings.restrictToMemory(estimate.value(), 1000);
+    if (predictedEngine == storm::utility::Engine::Sparse || predictedEngine == storm::utility::Engine::Hybrid) {
+        EXPECT_EQ(storm::utility::Engine::Dd, settings.getEngine());
+    } else {
+        EXPECT_EQ(predictedEngine, settings.getEngine());
+    }
+}
+
+}  // namespace
@@ -0,0 +1,64 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <tuple>
+
+#include "storm/builder/ParallelCompositionBuilder.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+std::shared_ptr<storm::models::sparse::Ctmc<double>> buildCtmc(std::vector<std::tuple<uint64_t, uint64_t, double>> const& transitions,
+                                                               uint64_t numberOfStates) {
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates);
+    for (auto const& transition : transitions) {
+        builder.addNextValue(std::get<0>(transition), std::get<1>(transition), std::get<2>(transition));
+    }
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    labeling.addLabel("a");
+    labeling.addLabelToState("a", 1);
+    return std::make_shared<storm::models::sparse::Ctmc<double>>(builder.build(), labeling);
+}
+
+}  // namespace
+
+TEST(ParallelCompositionBuilderTest, ReachableComposition) {
+    // The second state of the first CTMC has a selfloop and the third state of the second CTMC is unreachable.
+    auto first = buildCtmc({{0, 1, 1.0}, {1, 1, 1.0}}, 2);
+    auto second = buildCtmc({{0, 1, 2.0}, {1, 0, 3.0}, {2, 0, 1.0}}, 3);
+
+    auto full = storm::builder::ParallelCompositionBuilder<double>::compose({first, second, first}, false, false);
+    EXPECT_EQ(12ul, full->getNumberOfStates());
+    EXPECT_EQ(full->getNumberOfStates(), storm::builder::ParallelCompositionBuilder<double>::compose(first, second, false)->getNumberOfStates() * 2);
+
+    auto composition = storm::builder::ParallelCompositionBuilder<double>::compose({first, second, first}, false);
+    ASSERT_EQ(8ul, composition->getNumberOfStates());
+    ASSERT_EQ(1ul, composition->getInitialStates().getNumberOfSetBits());
+    EXPECT_EQ(7ul, composition->getStateLabeling().getStates("a").getNumberOfSetBits());
+
+    auto const& matrix = composition->getTransitionMatrix();
+    uint64_t initialState = *composition->getInitialStates().begin();
+    EXPECT_EQ(3ul, matrix.getRow(initialState).getNumberOfEntries());
+    EXPECT_EQ(4.0, matrix.getRowSum(initialState));
+
+    // In the state where both copies of the first CTMC are in their second state, their selfloops are merged.
+    for (uint64_t state = 0; state < composition->getNumberOfStates(); ++state) {
+        uint64_t selfloops = 0;
+        for (auto const& entry : matrix.getRow(state)) {
+            if (entry.getColumn() == state) {
+                ++selfloops;
+                if (matrix.getRow(state).getNumberOfEntries() == 2) {
+                    EXPECT_EQ(2.0, entry.getValue());
+                }
+            }
+        }
+        EXPECT_LE(selfloops, 1ul);
+    }
+
+    auto conjunction = storm::builder::ParallelCompositionBuilder<double>::compose({first, second, first}, true);
+    EXPECT_EQ(8ul, conjunction->getNumberOfStates());
+    EXPECT_EQ(1ul, conjunction->getStateLabeling().getStates("a").getNumberOfSetBits());
+}
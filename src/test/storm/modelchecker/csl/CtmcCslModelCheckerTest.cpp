@@ -9,6 +9,7 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
@@ -435,6 +436,76 @@ TEST(CtmcCslModelCheckerTest, TransientProbabilities) {
     EXPECT_NEAR(0.595957, result[1], 1e-6);
 }
 
+TEST(CtmcCslModelCheckerTest, BoundedUntilMultipleTimeBounds) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+    matrixBuilder.addNextValue(0, 1, 3.0);
+    matrixBuilder.addNextValue(1, 0, 2.0);
+    matrixBuilder.addNextValue(1, 2, 1.0);
+    matrixBuilder.addNextValue(2, 2, 1.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose();
+
+    std::vector<double> exitRates = {3, 3, 1};
+    storm::storage::BitVector phiStates(3, true);
+    storm::storage::BitVector psiStates(3);
+    psiStates.set(2);
+    storm::Environment env;
+    std::vector<double> upperBounds = {0.5, 4, 0, storm::utility::infinity<double>(), 1};
+    auto results = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+        env, storm::solver::SolveGoal<double>(), matrix, backwardTransitions, phiStates, psiStates, exitRates, upperBounds);
+
+    ASSERT_EQ(upperBounds.size(), results.size());
+    for (uint64_t i = 0; i < upperBounds.size(); ++i) {
+        std::vector<double> expected = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+            env, storm::solver::SolveGoal<double>(), matrix, backwardTransitions, phiStates, psiStates, exitRates, false, 0.0, upperBounds[i]);
+        ASSERT_EQ(expected.size(), results[i].size());
+        for (uint64_t state = 0; state < expected.size(); ++state) {
+            EXPECT_NEAR(expected[state], results[i][state], 1e-6) << "Time bound " << upperBounds[i] << ", state " << state;
+        }
+    }
+    EXPECT_NEAR(0.0, results[2][0], 1e-6);
+    EXPECT_NEAR(1.0, results[3][0], 1e-6);
+}
+
+TEST(CtmcCslModelCheckerTest, BoundedUntilStiffKrylov) {
+    // Two states that switch quickly between each other and slowly reach the target state.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+    matrixBuilder.addNextValue(0, 1, 1e4);
+    matrixBuilder.addNextValue(1, 0, 1e4);
+    matrixBuilder.addNextValue(1, 2, 1e-3);
+    matrixBuilder.addNextValue(2, 2, 1.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose();
+
+    std::vector<double> exitRates = {1e4, 1e4 + 1e-3, 1};
+    storm::storage::BitVector phiStates(3, true);
+    storm::storage::BitVector psiStates(3);
+    psiStates.set(2);
+    storm::Environment env;
+    env.solver().timeBounded().setCtmcMethod(storm::solver::CtmcTransientMethod::Uniformization);
+    std::vector<double> expected = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+        env, storm::solver::SolveGoal<double>(), matrix, backwardTransitions, phiStates, psiStates, exitRates, false, 0.0, 1e3);
+
+    // The time bound times the uniformization rate exceeds the threshold for selecting the Krylov method.
+    env.solver().timeBounded().setCtmcMethod(storm::solver::CtmcTransientMethod::Automatic);
+    std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+        env, storm::solver::SolveGoal<double>(), matrix, backwardTransitions, phiStates, psiStates, exitRates, false, 0.0, 1e3);
+    ASSERT_EQ(expected.size(), result.size());
+    for (uint64_t state = 0; state < expected.size(); ++state) {
+        EXPECT_NEAR(expected[state], result[state], 1e-6) << "State " << state;
+    }
+    // The target is reached with rate 1e-3 from the second state, in which the model spends half of the time.
+    EXPECT_NEAR(1.0 - std::exp(-0.5), result[0], 1e-6);
+
+    // Uniformization would need about 1e10 iterations for the second time bound.
+    std::vector<double> upperBounds = {1e3, 1e6};
+    auto results = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+        env, storm::solver::SolveGoal<double>(), matrix, backwardTransitions, phiStates, psiStates, exitRates, upperBounds);
+    ASSERT_EQ(upperBounds.size(), results.size());
+    EXPECT_NEAR(result[0], results[0][0], 1e-6);
+    EXPECT_NEAR(1.0, results[1][0], 1e-6);
+}
+
 TYPED_TEST(CtmcCslModelCheckerTest, LtlProbabilitiesEmbedded) {
 #ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
     std::string formulasString = "P=?  [ X F (!\"down\" U \"fail_sensors\") ]";
@@ -10,6 +10,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
@@ -166,4 +167,31 @@ TYPED_TEST(ConditionalDtmcPrctlModelCheckerTest, Conditional) {
     storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType>& quantitativeResult4 = result->asExplicitQuantitativeCheckResult<ValueType>();
     EXPECT_NEAR(storm::utility::one<ValueType>(), quantitativeResult4[0], this->precision());
 }
+
+TYPED_TEST(ConditionalDtmcPrctlModelCheckerTest, ConditionalJoint) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/test_conditional.pm");
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildAllLabels();
+    std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> dtmc =
+        storm::builder::ExplicitModelBuilder<ValueType>(program, options).build()->template as<storm::models::sparse::Dtmc<ValueType>>();
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(*dtmc);
+
+    storm::Environment env = this->env();
+    env.modelchecker().setConditionalAlgorithm(storm::modelchecker::helper::ConditionalAlgorithm::Joint);
+
+    auto expManager = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::parser::FormulaParser formulaParser(expManager);
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"target\" || F \"condition\"]");
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *formula);
+    storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType>& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<ValueType>();
+    EXPECT_NEAR(storm::utility::one<ValueType>(), quantitativeResult1[0], this->precision());
+    EXPECT_EQ(storm::utility::infinity<ValueType>(), quantitativeResult1[1]);
+
+    formula = formulaParser.parseSingleFormulaFromString("P=? [F \"condition\" || F \"target\"]");
+    result = checker.check(env, *formula);
+    storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType>& quantitativeResult2 = result->asExplicitQuantitativeCheckResult<ValueType>();
+    EXPECT_NEAR(storm::utility::one<ValueType>(), quantitativeResult2[0], this->precision());
+}
 }  // namespace
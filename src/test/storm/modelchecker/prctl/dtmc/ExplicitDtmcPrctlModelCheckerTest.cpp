@@ -14,6 +14,7 @@
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/SolverEnvironment.h"
 
 TEST(ExplicitDtmcPrctlModelCheckerTest, Die) {
@@ -68,6 +69,33 @@ TEST(ExplicitDtmcPrctlModelCheckerTest, Die) {
     EXPECT_NEAR(11.0 / 3.0, quantitativeResult4[0], precision);
 }
 
+TEST(ExplicitDtmcPrctlModelCheckerTest, DieLongHorizon) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", "");
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+
+    auto expManager = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::parser::FormulaParser formulaParser(expManager);
+    std::shared_ptr<storm::logic::Formula const> shortFormula = formulaParser.parseSingleFormulaFromString("P=? [F<=3 \"one\"]");
+    std::shared_ptr<storm::logic::Formula const> longFormula = formulaParser.parseSingleFormulaFromString("P=? [F<=1000000 \"one\"]");
+    double const precision = 1e-12;
+
+    // Step by step, the computation of the long horizon stops as soon as the vector does not change anymore.
+    storm::Environment env;
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *shortFormula);
+    EXPECT_NEAR(1.0 / 8.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    result = checker.check(env, *longFormula);
+    EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+
+    // With squaring, the long horizon is computed with few dense matrix products.
+    env.modelchecker().setStepBoundedSquaringStateLimit(100);
+    result = checker.check(env, *shortFormula);
+    EXPECT_NEAR(1.0 / 8.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    result = checker.check(env, *longFormula);
+    EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+}
+
 TEST(ExplicitDtmcPrctlModelCheckerTest, Crowds) {
     storm::Environment env;
     double const precision = 1e-6;
@@ -15,6 +15,7 @@
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
@@ -331,4 +332,39 @@ TYPED_TEST(LraDtmcPrctlModelCheckerTest, LRA) {
         EXPECT_NEAR(this->parseNumber("1/10"), quantitativeResult1[14], this->precision());
     }
 }
+
+TEST(LraDtmcConcurrentComponentsTest, ManyBsccs) {
+    // Many BSCCs that are cycles of three states, where one or two of the states are labeled.
+    uint64_t const numberOfBsccs = 300;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(3 * numberOfBsccs, 3 * numberOfBsccs, 3 * numberOfBsccs);
+    storm::models::sparse::StateLabeling ap(3 * numberOfBsccs);
+    ap.addLabel("a");
+    for (uint64_t bscc = 0; bscc < numberOfBsccs; ++bscc) {
+        for (uint64_t offset = 0; offset < 3; ++offset) {
+            matrixBuilder.addNextValue(3 * bscc + offset, 3 * bscc + (offset + 1) % 3, 1.0);
+        }
+        ap.addLabelToState("a", 3 * bscc);
+        if (bscc % 2 == 1) {
+            ap.addLabelToState("a", 3 * bscc + 1);
+        }
+    }
+    storm::models::sparse::Dtmc<double> dtmc(matrixBuilder.build(), ap);
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(dtmc);
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("LRA=? [\"a\"]");
+
+    for (auto method : {storm::solver::LraMethod::ValueIteration, storm::solver::LraMethod::GainBiasEquations}) {
+        for (uint64_t numberOfThreads : {1ull, 4ull}) {
+            storm::Environment env;
+            env.solver().lra().setDetLraMethod(method);
+            env.solver().lra().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().setNumberOfThreads(numberOfThreads);
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *formula);
+            auto const& quantitativeResult = result->asExplicitQuantitativeCheckResult<double>();
+            for (uint64_t state = 0; state < 3 * numberOfBsccs; ++state) {
+                EXPECT_NEAR((state / 3) % 2 == 1 ? 2.0 / 3.0 : 1.0 / 3.0, quantitativeResult[state], 1e-6);
+            }
+        }
+    }
+}
 }  // namespace
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/modelchecker/prctl/helper/DuplicateChoiceElimination.h"
+#include "storm/storage/SparseMatrix.h"
+
+TEST(DuplicateChoiceEliminationTest, RemovesDuplicateRows) {
+    // In state 0, the first two choices coincide while the third one differs in its right-hand side. Both choices of state 1 coincide.
+    storm::storage::SparseMatrixBuilder<double> builder(5, 2, 7, true, true, 2);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 1.0);
+    builder.addNextValue(1, 1, 1.0);
+    builder.addNextValue(2, 1, 1.0);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 0, 0.5);
+    builder.addNextValue(3, 1, 0.5);
+    builder.addNextValue(4, 0, 0.5);
+    builder.addNextValue(4, 1, 0.5);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    std::vector<double> b = {0.0, 0.0, 1.0, 0.0, 0.0};
+
+    for (uint64_t numberOfThreads : {1ull, 2ull}) {
+        storm::modelchecker::helper::DuplicateChoiceElimination<double> elimination(matrix, b, numberOfThreads);
+        EXPECT_EQ(2ull, elimination.getNumberOfDuplicateRows());
+        EXPECT_EQ(storm::storage::BitVector(5, std::vector<uint_fast64_t>({0, 2, 3})), elimination.getKeptRows());
+
+        storm::storage::SparseMatrix<double> reducedMatrix = elimination.reduceMatrix(matrix);
+        EXPECT_EQ(3ull, reducedMatrix.getRowCount());
+        EXPECT_EQ(2ull, reducedMatrix.getRowGroupCount());
+        EXPECT_EQ(std::vector<double>({0.0, 1.0, 0.0}), elimination.reduceVector(b));
+
+        EXPECT_EQ(std::vector<uint64_t>({0, 0}), elimination.reduceScheduler({1, 1}));
+        EXPECT_EQ(std::vector<uint64_t>({1, 0}), elimination.reduceScheduler({2, 0}));
+        EXPECT_EQ(std::vector<uint64_t>({2, 0}), elimination.restoreScheduler({1, 0}));
+    }
+}
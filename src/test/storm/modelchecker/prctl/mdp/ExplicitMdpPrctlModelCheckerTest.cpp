@@ -8,6 +8,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm-parsers/parser/AutoParser.h"
@@ -202,3 +203,73 @@ TEST(ExplicitMdpPrctlModelCheckerTest, AsynchronousLeader) {
 
     EXPECT_NEAR(30.0 / 7.0, quantitativeResult6[0], precision);
 }
+
+TEST(ExplicitMdpPrctlModelCheckerTest, ReleaseIntermediateData) {
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "",
+                                                STORM_TEST_RESOURCES_DIR "/rew/two_dice.flip.trans.rew")
+            ->as<storm::models::sparse::Mdp<double>>();
+    storm::Environment env;
+    storm::Environment releasingEnv;
+    releasingEnv.modelchecker().setReleaseIntermediateData(true);
+    double const precision = 1e-6;
+
+    storm::parser::FormulaParser formulaParser;
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    for (std::string const formulaString : {"Pmin=? [F \"two\"]", "Pmax=? [F \"three\"]", "Rmin=? [F \"done\"]", "Rmax=? [F \"done\"]"}) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+        auto result = checker.check(env, *formula);
+        auto releasingResult = checker.check(releasingEnv, *formula);
+        EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[0], releasingResult->asExplicitQuantitativeCheckResult<double>()[0], precision)
+            << formulaString;
+    }
+    EXPECT_LE(mdp->getTransitionMatrix().getNonzeroEntryCount() * sizeof(double),
+              mdp->getTransitionMatrix().getSizeInBytes());
+}
+
+TEST(ExplicitMdpPrctlModelCheckerTest, ConditionalBisection) {
+    std::string const programString =
+        "mdp\n"
+        "module main\n"
+        "  s : [0..4] init 0;\n"
+        "  [a] s=0 -> 0.5 : (s'=1) + 0.5 : (s'=2);\n"
+        "  [b] s=0 -> 0.2 : (s'=1) + 0.8 : (s'=3);\n"
+        "  [] s=1 -> 0.6 : (s'=4) + 0.4 : (s'=3);\n"
+        "  [] s=2 -> 1 : (s'=4);\n"
+        "  [] s>=3 -> 1 : true;\n"
+        "endmodule\n"
+        "label \"condition\" = s=1 | s=2;\n"
+        "label \"target\" = s=4;\n";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programString, "conditional.nm");
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildAllLabels();
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp =
+        storm::builder::ExplicitModelBuilder<double>(program, options).build()->as<storm::models::sparse::Mdp<double>>();
+    std::shared_ptr<storm::models::sparse::Mdp<double>> dice =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab")
+            ->as<storm::models::sparse::Mdp<double>>();
+
+    storm::Environment env;
+    storm::Environment bisectionEnv;
+    bisectionEnv.modelchecker().setConditionalAlgorithm(storm::modelchecker::helper::ConditionalAlgorithm::Bisection);
+    bisectionEnv.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    double const precision = 1e-6;
+
+    storm::parser::FormulaParser formulaParser;
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"target\" || F \"condition\"]");
+    EXPECT_NEAR(0.8, checker.check(env, *formula)->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    EXPECT_NEAR(0.8, checker.check(bisectionEnv, *formula)->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    formula = formulaParser.parseSingleFormulaFromString("Pmin=? [F \"target\" || F \"condition\"]");
+    EXPECT_NEAR(0.6, checker.check(env, *formula)->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    EXPECT_NEAR(0.6, checker.check(bisectionEnv, *formula)->asExplicitQuantitativeCheckResult<double>()[0], precision);
+
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> diceChecker(*dice);
+    for (std::string const formulaString : {"Pmin=? [F \"two\" || F \"done\"]", "Pmax=? [F \"seven\" || F \"done\"]"}) {
+        formula = formulaParser.parseSingleFormulaFromString(formulaString);
+        auto result = diceChecker.check(env, *formula);
+        auto bisectionResult = diceChecker.check(bisectionEnv, *formula);
+        EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[0], bisectionResult->asExplicitQuantitativeCheckResult<double>()[0], precision)
+            << formulaString;
+    }
+}
@@ -0,0 +1,122 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/prctl/helper/SparseIncrementalPrctlHelper.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+
+namespace {
+
+// State 0 moves to states 1 and 2 with probability 1/2 each. State 1 reaches the goal state 3 or the sink state 4 with probability 1/2 each, state 2 always
+// reaches the goal. If the model is modified, state 1 always reaches the goal.
+storm::storage::SparseMatrix<double> buildDtmc(bool modified) {
+    storm::storage::SparseMatrixBuilder<double> builder(5, 5);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.5);
+    if (modified) {
+        builder.addNextValue(1, 3, 1.0);
+    } else {
+        builder.addNextValue(1, 3, 0.5);
+        builder.addNextValue(1, 4, 0.5);
+    }
+    builder.addNextValue(2, 3, 1.0);
+    builder.addNextValue(3, 3, 1.0);
+    builder.addNextValue(4, 4, 1.0);
+    return builder.build();
+}
+
+// State 0 either moves to state 1 (reward 1) or to state 2 (reward 4). State 1 reaches the goal state 3 with probability 1/2 and otherwise returns to state
+// 0. If the model is modified, state 1 always reaches the goal. State 2 always reaches the goal. All other rewards are one (except for the goal state).
+storm::storage::SparseMatrix<double> buildMdp(bool modified) {
+    storm::storage::SparseMatrixBuilder<double> builder(5, 4, 0, true, true, 4);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 1.0);
+    builder.addNextValue(1, 2, 1.0);
+    builder.newRowGroup(2);
+    if (modified) {
+        builder.addNextValue(2, 3, 1.0);
+    } else {
+        builder.addNextValue(2, 0, 0.5);
+        builder.addNextValue(2, 3, 0.5);
+    }
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 3, 1.0);
+    builder.newRowGroup(4);
+    builder.addNextValue(4, 3, 1.0);
+    return builder.build();
+}
+
+TEST(IncrementalPrctlHelperTest, DtmcUntilProbabilities) {
+    storm::Environment env;
+    storm::storage::SparseMatrix<double> matrix = buildDtmc(false);
+    storm::modelchecker::helper::SparseIncrementalPrctlHelper<double, false> helper(matrix);
+    storm::storage::BitVector phiStates(5, true);
+    storm::storage::BitVector psiStates(5, false);
+    psiStates.set(3);
+
+    std::vector<double> result = helper.computeUntilProbabilities(env, storm::solver::SolveGoal<double>(), phiStates, psiStates);
+    EXPECT_EQ(5ull, helper.getNumberOfRecomputedStates());
+    EXPECT_NEAR(0.75, result[0], 1e-6);
+    EXPECT_NEAR(0.5, result[1], 1e-6);
+    EXPECT_NEAR(1.0, result[2], 1e-6);
+
+    // Only the changed state and its predecessor are recomputed.
+    storm::storage::SparseMatrix<double> modifiedMatrix = buildDtmc(true);
+    storm::storage::BitVector changedStates(5, false);
+    changedStates.set(1);
+    helper.updateTransitionMatrix(modifiedMatrix, changedStates);
+    result = helper.computeUntilProbabilities(env, storm::solver::SolveGoal<double>(), phiStates, psiStates);
+    EXPECT_EQ(2ull, helper.getNumberOfRecomputedStates());
+    EXPECT_NEAR(1.0, result[0], 1e-6);
+    EXPECT_NEAR(1.0, result[1], 1e-6);
+    EXPECT_NEAR(1.0, result[2], 1e-6);
+    EXPECT_NEAR(0.0, result[4], 1e-6);
+
+    // Making state 2 a non-phi state changes its value and thus the value of its predecessor.
+    phiStates.set(2, false);
+    result = helper.computeUntilProbabilities(env, storm::solver::SolveGoal<double>(), phiStates, psiStates);
+    EXPECT_EQ(2ull, helper.getNumberOfRecomputedStates());
+    EXPECT_NEAR(0.5, result[0], 1e-6);
+    EXPECT_NEAR(0.0, result[2], 1e-6);
+}
+
+TEST(IncrementalPrctlHelperTest, MdpReachabilityRewards) {
+    storm::Environment env;
+    storm::storage::SparseMatrix<double> matrix = buildMdp(false);
+    storm::modelchecker::helper::SparseIncrementalPrctlHelper<double, true> helper(matrix);
+    std::vector<double> choiceRewards = {1.0, 4.0, 1.0, 1.0, 0.0};
+    storm::storage::BitVector targetStates(4, false);
+    targetStates.set(3);
+
+    std::vector<double> result = helper.computeReachabilityRewards(env, storm::solver::SolveGoal<double>(true), choiceRewards, targetStates);
+    EXPECT_EQ(4ull, helper.getNumberOfRecomputedStates());
+    EXPECT_NEAR(4.0, result[0], 1e-6);
+    EXPECT_NEAR(3.0, result[1], 1e-6);
+    EXPECT_NEAR(1.0, result[2], 1e-6);
+
+    storm::storage::SparseMatrix<double> modifiedMatrix = buildMdp(true);
+    storm::storage::BitVector changedStates(4, false);
+    changedStates.set(1);
+    helper.updateTransitionMatrix(modifiedMatrix, changedStates);
+    result = helper.computeReachabilityRewards(env, storm::solver::SolveGoal<double>(true), choiceRewards, targetStates);
+    EXPECT_EQ(2ull, helper.getNumberOfRecomputedStates());
+    EXPECT_NEAR(2.0, result[0], 1e-6);
+    EXPECT_NEAR(1.0, result[1], 1e-6);
+    EXPECT_NEAR(1.0, result[2], 1e-6);
+
+    // A changed reward of state 2 also affects state 0, where now the second choice is optimal.
+    choiceRewards[3] = 0.0;
+    choiceRewards[1] = 0.5;
+    result = helper.computeReachabilityRewards(env, storm::solver::SolveGoal<double>(true), choiceRewards, targetStates);
+    EXPECT_EQ(2ull, helper.getNumberOfRecomputedStates());
+    EXPECT_NEAR(0.5, result[0], 1e-6);
+    EXPECT_NEAR(0.0, result[2], 1e-6);
+
+    // The maximal rewards are not cached yet and thus computed for all states.
+    result = helper.computeReachabilityRewards(env, storm::solver::SolveGoal<double>(false), choiceRewards, targetStates);
+    EXPECT_EQ(4ull, helper.getNumberOfRecomputedStates());
+    EXPECT_NEAR(2.0, result[0], 1e-6);
+}
+
+}  // namespace
@@ -9,6 +9,7 @@
 #include "storm/api/properties.h"
 #include "storm/parser/CSVParser.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
@@ -302,4 +303,32 @@ TYPED_TEST(QuantileQueryTest, resources) {
     compare = this->compareResult(model, result, expectedResult);
     EXPECT_TRUE(compare.first) << compare.second;
 }
+
+TYPED_TEST(QuantileQueryTest, resources_threads) {
+    typedef storm::models::sparse::Mdp<typename TestFixture::ValueType> ModelType;
+
+    std::string formulasString = "quantile(max GOLD, max GEM, Pmax>0.95 [F{\"gold\"}>=GOLD,{\"gem\"}>=GEM,{\"steps\"}<=100 true]);\n";
+
+    auto modelFormulas = this->template buildModelFormulas<ModelType>(STORM_TEST_RESOURCES_DIR "/mdp/quantiles_resources.nm", formulasString);
+    auto model = std::move(modelFormulas.first);
+    auto tasks = this->getTasks(modelFormulas.second);
+    auto checker = this->template createModelChecker<ModelType>(model);
+    storm::Environment env = this->env();
+    env.modelchecker().setNumberOfEpochThreads(4);
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    std::vector<std::string> expectedResult;
+    std::pair<bool, std::string> compare;
+
+    expectedResult.clear();
+    expectedResult.push_back("0, 10");
+    expectedResult.push_back("1, 9");
+    expectedResult.push_back("4, 8");
+    expectedResult.push_back("7, 7");
+    expectedResult.push_back("8, 4");
+    expectedResult.push_back("9, 2");
+    expectedResult.push_back("10, 0");
+    result = checker->check(env, tasks[0]);
+    compare = this->compareResult(model, result, expectedResult);
+    EXPECT_TRUE(compare.first) << compare.second;
+}
 }  // namespace
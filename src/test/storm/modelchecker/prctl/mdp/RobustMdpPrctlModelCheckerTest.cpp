@@ -143,3 +143,33 @@ TEST(RobustMDPModelCheckingTest, AddUncertaintyCoin22max) {
     makeUncertainAndCheck(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", "Pmax=? [F \"all_coins_equal_1\"]", 0.1);
     makeUncertainAndCheck(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", "Pmax=? [F \"all_coins_equal_1\"]", 0.2);
 }
+
+TEST(RobustMDPModelCheckingTest, AddUncertaintyCoin22BoundsCertainValue) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"all_coins_equal_1\"]", program));
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr = storm::api::buildSparseModel<double>(program, formulas);
+    auto mdp = modelPtr->as<storm::models::sparse::Mdp<double>>();
+    auto task = storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0]);
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+    auto checker = storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>>(*mdp);
+    auto certainResult = checker.check(env, task);
+    double certainValue = getQuantitativeResultAtInitialState(mdp, certainResult);
+
+    // The robust value iteration visits the uncertain successors in an order that changes during the iterations.
+    auto transformer = storm::transformer::AddUncertainty(modelPtr);
+    std::shared_ptr<storm::models::sparse::Model<storm::Interval>> imdp = transformer.transform(0.1);
+    auto ichecker = storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<storm::Interval>>(
+        *imdp->as<storm::models::sparse::Mdp<storm::Interval>>());
+    auto robustResult = ichecker.check(env, task);
+    double robustValue = getQuantitativeResultAtInitialState(imdp, robustResult);
+    task.setRobustUncertainty(false);
+    auto optimisticResult = ichecker.check(env, task);
+    double optimisticValue = getQuantitativeResultAtInitialState(imdp, optimisticResult);
+    EXPECT_LE(robustValue, certainValue + 1e-6);
+    EXPECT_LE(certainValue, optimisticValue + 1e-6);
+}
@@ -0,0 +1,64 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/api/verification.h"
+
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/modelchecker/hints/SolutionHintCache.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Mdp.h"
+
+TEST(SolutionHintCacheTest, Dice) {
+    std::string const directory = (std::filesystem::temp_directory_path() / "storm-solution-hint-cache-test").string();
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directory(directory);
+
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmin=? [F \"two\"]; Rmax=? [F \"done\"]", program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas);
+
+    storm::Environment env;
+    env.modelchecker().setHintCacheDirectory(directory);
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    storm::modelchecker::SolutionHintCache cache(directory);
+
+    auto probabilityTask = storm::api::createTask<double>(formulas[0], true);
+    auto rewardTask = storm::api::createTask<double>(formulas[1], true);
+    ASSERT_TRUE(storm::modelchecker::SolutionHintCache::isApplicable(env, *model, probabilityTask));
+    EXPECT_EQ(nullptr, cache.load(*model, probabilityTask));
+
+    // The first computation stores its result, the second one starts from it.
+    for (uint64_t run = 0; run < 2; ++run) {
+        auto result = storm::api::verifyWithSparseEngine<double>(env, model, probabilityTask);
+        ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+        EXPECT_NEAR(1.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-8);
+        result = storm::api::verifyWithSparseEngine<double>(env, model, rewardTask);
+        EXPECT_NEAR(22.0 / 3.0, result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-8);
+    }
+
+    auto hint = cache.load(*model, probabilityTask);
+    ASSERT_NE(nullptr, hint);
+    ASSERT_TRUE(hint->hasResultHint());
+    EXPECT_EQ(model->getNumberOfStates(), hint->getResultHint().size());
+    EXPECT_NEAR(1.0 / 36.0, hint->getResultHint()[*model->getInitialStates().begin()], 1e-8);
+    EXPECT_TRUE(hint->hasSchedulerHint());
+
+    // Entries are specific to the optimization direction and the reward model.
+    auto otherFormulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"two\"]", program));
+    EXPECT_EQ(nullptr, cache.load(*model, storm::api::createTask<double>(otherFormulas[0], true)));
+    EXPECT_NE(nullptr, cache.load(*model, rewardTask));
+
+    // Results are not reused if soundness is required.
+    env.solver().setForceSoundness(true);
+    EXPECT_FALSE(storm::modelchecker::SolutionHintCache::isApplicable(env, *model, probabilityTask));
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,75 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
+#include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+// States 0 and 1 form an SCC from which the goal is reached via state 1. State 2 either moves to this SCC or (in the MDP) directly to the goal.
+// Each step yields reward one, except for the direct move to the goal which yields reward five. The expected rewards are 4, 3 and 6 (MDP: 5).
+storm::storage::SparseMatrix<double> buildMatrix(bool withDirectChoice) {
+    // Without the direct choice, the matrix has a trivial row grouping.
+    storm::storage::SparseMatrixBuilder<double> builder(withDirectChoice ? 4 : 3, 3, 4, true, withDirectChoice, withDirectChoice ? 3 : 0);
+    if (withDirectChoice) {
+        builder.newRowGroup(0);
+    }
+    builder.addNextValue(0, 1, 1.0);
+    if (withDirectChoice) {
+        builder.newRowGroup(1);
+    }
+    builder.addNextValue(1, 0, 0.5);
+    if (withDirectChoice) {
+        builder.newRowGroup(2);
+    }
+    builder.addNextValue(2, 0, 0.5);
+    builder.addNextValue(2, 2, 0.5);
+    // If present, the direct choice (row 3) has no transitions within the matrix.
+    return builder.build();
+}
+
+TEST(UpperRewardBoundsComputerTest, Dtmc) {
+    storm::storage::SparseMatrix<double> matrix = buildMatrix(false);
+    std::vector<double> rewards = {1.0, 1.0, 1.0};
+    std::vector<double> targetProbabilities = {0.0, 0.5, 0.0};
+    std::vector<double> values = {4.0, 3.0, 6.0};
+
+    std::vector<double> globalBounds =
+        storm::modelchecker::helper::DsMpiDtmcUpperRewardBoundsComputer<double>(matrix, rewards, targetProbabilities, 2).computeUpperBounds();
+    std::vector<double> sccBounds =
+        storm::modelchecker::helper::DsMpiSccUpperRewardBoundsComputer<double>(matrix, rewards, targetProbabilities, 2).computeUpperBounds();
+    ASSERT_EQ(values.size(), globalBounds.size());
+    ASSERT_EQ(values.size(), sccBounds.size());
+    for (uint64_t state = 0; state < values.size(); ++state) {
+        EXPECT_GE(globalBounds[state], values[state] - 1e-12);
+        EXPECT_GE(sccBounds[state], values[state] - 1e-12);
+    }
+    // State 2 is an SCC on its own, so its bound follows directly from the bound of state 0.
+    EXPECT_NEAR(2.0 + sccBounds[0], sccBounds[2], 1e-12);
+
+    EXPECT_GE(storm::modelchecker::helper::BaierUpperRewardBoundsComputer<double>(matrix, rewards, targetProbabilities, {}, 2).computeUpperBound(), 6.0);
+}
+
+TEST(UpperRewardBoundsComputerTest, Mdp) {
+    storm::storage::SparseMatrix<double> matrix = buildMatrix(true);
+    std::vector<double> rewards = {1.0, 1.0, 1.0, 5.0};
+    std::vector<double> targetProbabilities = {0.0, 0.5, 0.0, 1.0};
+    std::vector<double> minimalValues = {4.0, 3.0, 5.0};
+
+    std::vector<double> globalBounds =
+        storm::modelchecker::helper::DsMpiMdpUpperRewardBoundsComputer<double>(matrix, rewards, targetProbabilities).computeUpperBounds();
+    std::vector<double> sccBounds =
+        storm::modelchecker::helper::DsMpiSccUpperRewardBoundsComputer<double>(matrix, rewards, targetProbabilities).computeUpperBounds();
+    for (uint64_t state = 0; state < minimalValues.size(); ++state) {
+        EXPECT_GE(globalBounds[state], minimalValues[state] - 1e-12);
+        EXPECT_GE(sccBounds[state], minimalValues[state] - 1e-12);
+    }
+    // Moving directly to the goal is the better choice of state 2, whose bound is thus exact.
+    EXPECT_NEAR(5.0, sccBounds[2], 1e-12);
+
+    // The maximal expected reward is 6.
+    EXPECT_GE(storm::modelchecker::helper::BaierUpperRewardBoundsComputer<double>(matrix, rewards, targetProbabilities).computeUpperBound(), 6.0);
+}
+
+}  // namespace
@@ -1,12 +1,17 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <numeric>
+
 #include "storm-parsers/parser/FormulaParser.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/utility/graph.h"
 
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/settings/SettingMemento.h"
@@ -109,6 +114,34 @@ TEST(SparseDtmcEliminationModelCheckerTest, Crowds) {
     EXPECT_NEAR(0.96592521978041668, quantitativeResult5[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+TEST(SparseDtmcEliminationModelCheckerTest, ParallelStateElimination) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    storm::storage::BitVector targetStates = dtmc->getStates("observe0Greater1");
+    auto statesWithProbability01 = storm::utility::graph::performProb01(*dtmc, storm::storage::BitVector(dtmc->getNumberOfStates(), true), targetStates);
+    storm::storage::BitVector maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
+    uint64_t initialState = *dtmc->getInitialStates().begin();
+    ASSERT_TRUE(maybeStates.get(initialState));
+    uint64_t initialIndex = maybeStates.getNumberOfSetBitsBeforeIndex(initialState);
+
+    storm::storage::SparseMatrix<double> submatrix = dtmc->getTransitionMatrix().getSubmatrix(false, maybeStates, maybeStates);
+    std::vector<double> oneStepProbabilities = dtmc->getTransitionMatrix().getConstrainedRowSumVector(maybeStates, statesWithProbability01.second);
+    std::vector<uint64_t> statesToEliminate(maybeStates.getNumberOfSetBits());
+    std::iota(statesToEliminate.begin(), statesToEliminate.end(), 0ull);
+
+    for (uint64_t numberOfThreads : {1ull, 4ull}) {
+        storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(submatrix);
+        storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(submatrix.transpose(), true);
+        std::vector<double> values = oneStepProbabilities;
+        storm::solver::stateelimination::PrioritizedStateEliminator<double> eliminator(flexibleMatrix, flexibleBackwardTransitions, statesToEliminate, values);
+        eliminator.eliminateAllInParallel(numberOfThreads, [initialIndex](uint64_t state) { return state != initialIndex; });
+        EXPECT_NEAR(0.3328800375801578281, values[initialIndex], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision())
+            << numberOfThreads;
+    }
+}
+
 TEST(SparseDtmcEliminationModelCheckerTest, SynchronousLeader) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
         storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/leader4_8.tra", STORM_TEST_RESOURCES_DIR "/lab/leader4_8.lab", "",
@@ -0,0 +1,94 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/parser/BinaryModelParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/api/builder.h"
+#include "storm/api/export.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/StateValuations.h"
+
+namespace {
+
+std::string getTemporaryFilename(std::string const& name) {
+    return (std::filesystem::temp_directory_path() / ("storm-binary-model-test-" + name + ".bin")).string();
+}
+
+void expectEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+    ASSERT_EQ(expected.getType(), actual.getType());
+    EXPECT_EQ(expected.getTransitionMatrix(), actual.getTransitionMatrix());
+    EXPECT_EQ(expected.getStateLabeling(), actual.getStateLabeling());
+    ASSERT_EQ(expected.hasChoiceLabeling(), actual.hasChoiceLabeling());
+    if (expected.hasChoiceLabeling()) {
+        EXPECT_EQ(expected.getChoiceLabeling(), actual.getChoiceLabeling());
+    }
+    ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+    for (auto const& [name, rewardModel] : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(name));
+        auto const& actualRewardModel = actual.getRewardModel(name);
+        ASSERT_EQ(rewardModel.hasStateRewards(), actualRewardModel.hasStateRewards());
+        if (rewardModel.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.getStateRewardVector(), actualRewardModel.getStateRewardVector());
+        }
+        ASSERT_EQ(rewardModel.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+        if (rewardModel.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+        }
+    }
+    if (expected.isOfType(storm::models::ModelType::Ctmc)) {
+        EXPECT_EQ(expected.as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(),
+                  actual.as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+    } else if (expected.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+        auto expectedMa = expected.as<storm::models::sparse::MarkovAutomaton<double>>();
+        auto actualMa = actual.as<storm::models::sparse::MarkovAutomaton<double>>();
+        EXPECT_EQ(expectedMa->getExitRates(), actualMa->getExitRates());
+        EXPECT_EQ(expectedMa->getMarkovianStates(), actualMa->getMarkovianStates());
+    }
+}
+
+}  // namespace
+
+TEST(BinaryModelParserTest, RoundTrip) {
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn", STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn",
+                                    STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn", STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn"}) {
+        auto model = storm::parser::DirectEncodingParser<double>::parseModel(file);
+        std::string binaryFile = getTemporaryFilename(std::filesystem::path(file).stem().string());
+        storm::api::exportSparseModelAsBinary(model, binaryFile);
+        auto loadedModel = storm::parser::BinaryModelParser::parseModel(binaryFile);
+        std::filesystem::remove(binaryFile);
+        expectEqualModels(*model, *loadedModel);
+    }
+}
+
+TEST(BinaryModelParserTest, StateValuations) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::builder::BuilderOptions options;
+    options.setBuildAllLabels().setBuildAllRewardModels().setBuildStateValuations();
+    auto model = storm::api::buildSparseModel<double>(program, options);
+    ASSERT_TRUE(model->hasStateValuations());
+
+    std::string binaryFile = getTemporaryFilename("die");
+    storm::api::exportSparseModelAsBinary(model, binaryFile);
+    auto loadedModel = storm::parser::BinaryModelParser::parseModel(binaryFile, program.getManager().getSharedPointer());
+    auto loadedModelWithoutValuations = storm::parser::BinaryModelParser::parseModel(binaryFile);
+    std::filesystem::remove(binaryFile);
+
+    expectEqualModels(*model, *loadedModel);
+    EXPECT_FALSE(loadedModelWithoutValuations->hasStateValuations());
+    ASSERT_TRUE(loadedModel->hasStateValuations());
+    for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+        EXPECT_EQ(model->getStateValuations().toString(state), loadedModel->getStateValuations().toString(state));
+    }
+}
+
+TEST(BinaryModelParserTest, WrongFormat) {
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryModelParser::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn"),
+                              storm::exceptions::WrongFormatException);
+}
@@ -97,3 +97,35 @@ TEST(DirectEncodingParserTest, IntervalDtmcTest) {
     ASSERT_EQ(613ul, dtmc->getNumberOfStates());
     EXPECT_TRUE(modelPtr->hasUncertainty());
 }
+
+TEST(DirectEncodingParserTest, ParallelParsing) {
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn", STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn",
+                                    STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn", STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn"}) {
+        storm::parser::DirectEncodingParserOptions sequentialOptions;
+        sequentialOptions.buildChoiceLabeling = true;
+        auto expected = storm::parser::DirectEncodingParser<double>::parseModel(file, sequentialOptions);
+
+        // Use tiny chunks such that the states are distributed over many chunks.
+        storm::parser::DirectEncodingParserOptions parallelOptions = sequentialOptions;
+        parallelOptions.numberOfThreads = 4;
+        parallelOptions.chunkSize = 100;
+        auto model = storm::parser::DirectEncodingParser<double>::parseModel(file, parallelOptions);
+
+        EXPECT_EQ(expected->getType(), model->getType()) << file;
+        EXPECT_EQ(expected->getTransitionMatrix(), model->getTransitionMatrix()) << file;
+        EXPECT_EQ(expected->getStateLabeling(), model->getStateLabeling()) << file;
+        ASSERT_EQ(expected->getNumberOfRewardModels(), model->getNumberOfRewardModels()) << file;
+        for (auto const& [name, rewardModel] : expected->getRewardModels()) {
+            ASSERT_TRUE(model->hasRewardModel(name)) << file;
+            auto const& parsedRewardModel = model->getRewardModel(name);
+            EXPECT_EQ(rewardModel.hasStateRewards(), parsedRewardModel.hasStateRewards()) << file;
+            if (rewardModel.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.getStateRewardVector(), parsedRewardModel.getStateRewardVector()) << file;
+            }
+            EXPECT_EQ(rewardModel.hasStateActionRewards(), parsedRewardModel.hasStateActionRewards()) << file;
+            if (rewardModel.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.getStateActionRewardVector(), parsedRewardModel.getStateActionRewardVector()) << file;
+            }
+        }
+    }
+}
@@ -140,6 +140,44 @@ TEST(PrismParser, UnboundedTest) {
     EXPECT_TRUE(result.hasUnboundedVariables());
 }
 
+TEST(PrismParser, FormulaOrderTest) {
+    // The formulas are declared in reverse order of their dependencies. The literal 1e-3 must not be taken as a reference to formula e.
+    std::string testInput =
+        R"(dtmc
+    formula a = b + c;
+    formula b = c * 2 + 1e-3;
+    formula e = 1;
+    formula c = d ? 1 : e;
+    formula d = x > 2;
+
+    module mod1
+        x : [0 .. 8] init 1;
+        [] a < 3 -> 1: (x' = x+1);
+    endmodule)";
+
+    storm::prism::Program result;
+    EXPECT_NO_THROW(result = storm::parser::PrismParser::parseFromString(testInput, "testfile"));
+    ASSERT_EQ(5ul, result.getNumberOfFormulas());
+    std::vector<std::string> formulaNames;
+    for (auto const& formula : result.getFormulas()) {
+        formulaNames.push_back(formula.getName());
+    }
+    EXPECT_EQ(std::vector<std::string>({"e", "d", "c", "b", "a"}), formulaNames);
+    EXPECT_TRUE(result.getFormulas()[4].getExpression().hasRationalType());
+
+    testInput =
+        R"(dtmc
+    formula a = b + 1;
+    formula b = a + 1;
+
+    module mod1
+        x : [0 .. 8] init 1;
+        [] a < 3 -> 1: (x' = x+1);
+    endmodule)";
+
+    STORM_SILENT_EXPECT_THROW(result = storm::parser::PrismParser::parseFromString(testInput, "testfile"), storm::exceptions::WrongFormatException);
+}
+
 TEST(PrismParser, POMDPInputTest) {
     std::string testInput =
         R"(pomdp
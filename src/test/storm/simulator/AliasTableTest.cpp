@@ -0,0 +1,25 @@
+#include "test/storm_gtest.h"
+
+#include "storm/simulator/AliasTable.h"
+
+TEST(AliasTableTest, Frequencies) {
+    // The weights need not be normalized and may contain zeros.
+    std::vector<double> weights = {1.0, 0.0, 5.0, 2.5, 1.5};
+    storm::simulator::AliasTable table(weights);
+    EXPECT_EQ(5ull, table.size());
+
+    // Sampling with equidistant numbers from [0, 1) yields the outcomes with (almost) exactly their probabilities.
+    uint64_t const numberOfSamples = 100000;
+    std::vector<uint64_t> counts(weights.size(), 0);
+    for (uint64_t sample = 0; sample < numberOfSamples; ++sample) {
+        ++counts[table.sample((static_cast<double>(sample) + 0.5) / numberOfSamples)];
+    }
+    EXPECT_EQ(0ull, counts[1]);
+    for (uint64_t outcome = 0; outcome < weights.size(); ++outcome) {
+        EXPECT_NEAR(weights[outcome] / 10.0, static_cast<double>(counts[outcome]) / numberOfSamples, 1e-4);
+    }
+
+    storm::simulator::AliasTable singleton(std::vector<double>{2.0});
+    EXPECT_EQ(0ull, singleton.sample(0.0));
+    EXPECT_EQ(0ull, singleton.sample(0.999));
+}
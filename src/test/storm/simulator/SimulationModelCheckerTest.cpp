@@ -0,0 +1,58 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/simulation/SimulationModelChecker.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/SimulationSettings.h"
+
+TEST(SimulationModelCheckerTest, Geometric) {
+    // In every step, the coin turns heads with probability 1/2. Flips after the first heads do not matter.
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(R"(
+dtmc
+
+module coin
+    heads : bool init false;
+
+    [] !heads -> 0.5 : (heads'=true) + 0.5 : (heads'=false);
+endmodule
+
+label "heads" = heads;
+)",
+                                                                                "coin.pm");
+    storm::parser::FormulaParser formulaParser(program);
+    storm::Environment env;
+    env.solver().setNumberOfThreads(4);
+    double precision = storm::settings::getModule<storm::settings::modules::SimulationSettings>().getPrecision();
+
+    storm::modelchecker::SimulationModelChecker<storm::models::sparse::Dtmc<double>> checker(program);
+
+    auto formula = formulaParser.parseSingleFormulaFromString("P=? [F<=3 \"heads\"]");
+    auto result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(0.875, result->asExplicitQuantitativeCheckResult<double>()[0], 2 * precision);
+
+    // Heads must come up in the second or third flip.
+    formula = formulaParser.parseSingleFormulaFromString("P=? [!\"heads\" U[2,3] \"heads\"]");
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(0.375, result->asExplicitQuantitativeCheckResult<double>()[0], 2 * precision);
+
+    formula = formulaParser.parseSingleFormulaFromString("P>=0.8 [F<=3 \"heads\"]");
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+
+    formula = formulaParser.parseSingleFormulaFromString("P>=0.9 [F<=3 \"heads\"]");
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[0]);
+
+    formula = formulaParser.parseSingleFormulaFromString("P<0.2 [F<=1 \"heads\"]");
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[0]);
+}
@@ -0,0 +1,118 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/helper/DistributedValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+// Creates a substochastic matrix with the given number of row groups, each having two rows with (up to) three entries.
+storm::storage::SparseMatrix<double> createMatrix(uint64_t numberOfGroups) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < 2; ++choice, ++row) {
+            std::vector<uint64_t> successors = {(group * 7 + choice) % numberOfGroups, (group * 13 + 5 * choice + 1) % numberOfGroups,
+                                                (group * 31 + 11 * choice + 2) % numberOfGroups};
+            std::sort(successors.begin(), successors.end());
+            successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+            for (auto const& successor : successors) {
+                builder.addNextValue(row, successor, 0.9 / successors.size());
+            }
+        }
+    }
+    return builder.build(row, numberOfGroups, numberOfGroups);
+}
+
+std::vector<double> createOffsets(uint64_t size) {
+    std::vector<double> offsets(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        offsets[i] = static_cast<double>((i * 7919) % 100) / 100.0;
+    }
+    return offsets;
+}
+
+}  // namespace
+
+TEST(DistributedValueIterationTest, StatePartition) {
+    for (auto partitioning : {storm::utility::mpi::StatePartitioning::Blocks, storm::utility::mpi::StatePartitioning::Hash}) {
+        storm::solver::helper::DistributedStatePartition partition(100, 3, partitioning);
+        std::vector<uint64_t> numberOfOwners(100, 0);
+        for (uint64_t rank = 0; rank < 3; ++rank) {
+            auto ownedStates = partition.getOwnedStates(rank);
+            EXPECT_TRUE(std::is_sorted(ownedStates.begin(), ownedStates.end()));
+            for (auto const& state : ownedStates) {
+                EXPECT_EQ(rank, partition.getOwner(state));
+                ++numberOfOwners[state];
+            }
+            if (partitioning == storm::utility::mpi::StatePartitioning::Blocks) {
+                EXPECT_EQ(rank == 0 ? 34ull : 33ull, ownedStates.size());
+            } else {
+                EXPECT_FALSE(ownedStates.empty());
+            }
+        }
+        for (auto const& owners : numberOfOwners) {
+            EXPECT_EQ(1ull, owners);
+        }
+    }
+}
+
+TEST(DistributedValueIterationTest, HelperMatchesSequential) {
+    auto matrix = createMatrix(2000);
+    auto offsets = createOffsets(matrix.getRowCount());
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        auto sequentialOp = std::make_shared<storm::solver::helper::ValueIterationOperator<double, false>>();
+        sequentialOp->setMatrixBackwards(matrix);
+        std::vector<double> expected(matrix.getRowGroupCount(), 0.0);
+        storm::solver::helper::ValueIterationHelper<double, false> sequentialHelper(sequentialOp);
+        EXPECT_EQ(storm::solver::SolverStatus::Converged, sequentialHelper.VI(expected, offsets, false, 1e-10, dir));
+
+        storm::solver::helper::DistributedValueIterationHelper<false> distributedHelper(matrix, storm::utility::mpi::StatePartitioning::Hash);
+        if (storm::utility::mpi::Communicator::world().getNumberOfRanks() == 1) {
+            // Within a single process, all states are owned locally.
+            EXPECT_EQ(matrix.getRowGroupCount(), distributedHelper.getNumberOfOwnedStates());
+            EXPECT_EQ(0ull, distributedHelper.getNumberOfGhostStates());
+        }
+        std::vector<double> result(matrix.getRowGroupCount(), 0.0);
+        uint64_t numIterations = 0;
+        EXPECT_EQ(storm::solver::SolverStatus::Converged, distributedHelper.VI(result, offsets, numIterations, false, 1e-10, dir));
+        EXPECT_GT(numIterations, 0ull);
+
+        for (uint64_t state = 0; state < result.size(); ++state) {
+            EXPECT_NEAR(expected[state], result[state], 1e-8);
+        }
+    }
+}
+
+TEST(DistributedValueIterationTest, SolverMatchesSequential) {
+    auto matrix = createMatrix(5000);
+    auto offsets = createOffsets(matrix.getRowCount());
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+    std::vector<double> expected(matrix.getRowGroupCount(), 0.0);
+    auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, matrix);
+    solver->setHasUniqueSolution(true);
+    ASSERT_TRUE(solver->solveEquations(env, storm::OptimizationDirection::Maximize, expected, offsets));
+
+    env.solver().setDistributed(true);
+    env.solver().setDistributedStatePartitioning(storm::utility::mpi::StatePartitioning::Blocks);
+    std::vector<double> result(matrix.getRowGroupCount(), 0.0);
+    solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, matrix);
+    solver->setHasUniqueSolution(true);
+    ASSERT_TRUE(solver->solveEquations(env, storm::OptimizationDirection::Maximize, result, offsets));
+
+    for (uint64_t state = 0; state < result.size(); ++state) {
+        EXPECT_NEAR(expected[state], result[state], 1e-8);
+    }
+}
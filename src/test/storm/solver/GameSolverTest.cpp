@@ -23,6 +23,19 @@ class DoubleViEnvironment {
     }
 };
 
+class DoubleViGaussSeidelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().game().setMethod(storm::solver::GameMethod::ValueIteration);
+        env.solver().game().setMultiplicationStyle(storm::solver::MultiplicationStyle::GaussSeidel);
+        env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+
 class DoublePiEnvironment {
    public:
     typedef double ValueType;
@@ -68,7 +81,7 @@ class GameSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoublePiEnvironment, RationalPiEnvironment> TestingTypes;
+typedef ::testing::Types<DoubleViEnvironment, DoubleViGaussSeidelEnvironment, DoublePiEnvironment, RationalPiEnvironment> TestingTypes;
 
 TYPED_TEST_SUITE(GameSolverTest, TestingTypes, );
 
@@ -1,6 +1,8 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <map>
+
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
@@ -37,6 +39,20 @@ class NativeDoublePowerRegMultEnvironment {
     }
 };
 
+class NativeDoublePowerMixedPrecisionEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        env.solver().native().setMixedPrecision(true);
+        return env;
+    }
+};
+
 class NativeDoubleSoundValueIterationEnvironment {
    public:
     typedef double ValueType;
@@ -135,6 +151,91 @@ class NativeDoubleWalkerChaeEnvironment {
     }
 };
 
+class NativeDoubleBicgstabIluEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Bicgstab);
+        env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::Ilu);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        return env;
+    }
+};
+
+class NativeDoubleBicgstabNoneEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Bicgstab);
+        env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::None);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        return env;
+    }
+};
+
+class NativeDoubleGmresDiagonalEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Gmres);
+        env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::Diagonal);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        return env;
+    }
+};
+
+class NativeDoubleGmresIluRestartEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Gmres);
+        env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::Ilu);
+        env.solver().native().setRestartThreshold(1);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        return env;
+    }
+};
+
+class NativeDoubleMultigridEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Multigrid);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        return env;
+    }
+};
+
+class NativeDoubleSoundMultigridEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setForceSoundness(true);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Multigrid);
+        env.solver().native().setRelativeTerminationCriterion(false);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-6"));
+        return env;
+    }
+};
+
 class NativeRationalRationalSearchEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -294,6 +395,19 @@ class EigenRationalLUEnvironment {
     }
 };
 
+class EigenRationalLUNoPresolveEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Eigen);
+        env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+        env.solver().eigen().setFloatingPointPresolve(false);
+        return env;
+    }
+};
+
 class TopologicalEigenRationalLUEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -326,13 +440,16 @@ class LinearEquationSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<NativeDoublePowerEnvironment, NativeDoublePowerRegMultEnvironment, NativeDoubleSoundValueIterationEnvironment,
-                         NativeDoubleOptimisticValueIterationEnvironment, NativeDoubleIntervalIterationEnvironment, NativeDoubleJacobiEnvironment,
-                         NativeDoubleGaussSeidelEnvironment, NativeDoubleSorEnvironment, NativeDoubleWalkerChaeEnvironment,
-                         NativeRationalRationalSearchEnvironment, EliminationRationalEnvironment, GmmGmresIluEnvironment, GmmGmresDiagonalEnvironment,
+typedef ::testing::Types<NativeDoublePowerEnvironment, NativeDoublePowerRegMultEnvironment, NativeDoublePowerMixedPrecisionEnvironment,
+                         NativeDoubleSoundValueIterationEnvironment, NativeDoubleOptimisticValueIterationEnvironment, NativeDoubleIntervalIterationEnvironment,
+                         NativeDoubleJacobiEnvironment, NativeDoubleGaussSeidelEnvironment, NativeDoubleSorEnvironment, NativeDoubleWalkerChaeEnvironment,
+                         NativeDoubleBicgstabIluEnvironment, NativeDoubleBicgstabNoneEnvironment, NativeDoubleGmresDiagonalEnvironment,
+                         NativeDoubleGmresIluRestartEnvironment, NativeDoubleMultigridEnvironment, NativeDoubleSoundMultigridEnvironment,
+                         NativeRationalRationalSearchEnvironment, EliminationRationalEnvironment,
+                         GmmGmresIluEnvironment, GmmGmresDiagonalEnvironment,
                          GmmGmresNoneEnvironment, GmmBicgstabIluEnvironment, GmmQmrDiagonalEnvironment, EigenDGmresDiagonalEnvironment,
                          EigenGmresIluEnvironment, EigenBicgstabNoneEnvironment, EigenDoubleLUEnvironment, EigenRationalLUEnvironment,
-                         TopologicalEigenRationalLUEnvironment>
+                         EigenRationalLUNoPresolveEnvironment, TopologicalEigenRationalLUEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(LinearEquationSolverTest, TestingTypes, );
@@ -373,4 +490,155 @@ TYPED_TEST(LinearEquationSolverTest, solveEquationSystem) {
     EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
     EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
 }
+
+TEST(NativeLinearEquationSolverTest, KrylovIllConditionedChain) {
+    // A long chain of states that drifts towards its start, so the probability to reach its end is tiny and value iteration converges very slowly.
+    uint64_t const numberOfStates = 50000;
+    storm::storage::SparseMatrixBuilder<double> builder;
+    std::vector<double> b(numberOfStates, 0.0);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (state > 0) {
+            builder.addNextValue(state, state - 1, -0.51);
+        }
+        builder.addNextValue(state, state, 1.0);
+        if (state + 1 < numberOfStates) {
+            builder.addNextValue(state, state + 1, -0.49);
+        } else {
+            b[state] = 0.49;
+        }
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+
+    auto solve = [&](storm::solver::NativeLinearEquationSolverMethod method, storm::solver::NativeLinearEquationSolverPreconditioner preconditioner) {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(method);
+        env.solver().native().setPreconditioner(preconditioner);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-12"));
+        env.solver().native().setMaximalNumberOfIterations(1000);
+        env.solver().setNumberOfThreads(4);
+        auto solver = storm::solver::GeneralLinearEquationSolverFactory<double>().create(env, A);
+        std::vector<double> x(numberOfStates, 0.0);
+        EXPECT_TRUE(solver->solveEquations(env, x, b));
+        return x;
+    };
+    // On a tridiagonal matrix, the incomplete LU factorization is exact.
+    auto const ilu = storm::solver::NativeLinearEquationSolverPreconditioner::Ilu;
+    std::vector<double> bicgstabResult = solve(storm::solver::NativeLinearEquationSolverMethod::Bicgstab, ilu);
+    std::vector<double> gmresResult = solve(storm::solver::NativeLinearEquationSolverMethod::Gmres, ilu);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        EXPECT_NEAR(bicgstabResult[state], gmresResult[state], 1e-10);
+    }
+    // The probability to reach the end from the last state is (1 - r^n) / (1 - r^(n+1)) with r = 0.51 / 0.49, which is very close to 1 / r.
+    EXPECT_NEAR(0.49 / 0.51, bicgstabResult[numberOfStates - 1], 1e-8);
+}
+
+TEST(NativeLinearEquationSolverTest, MultigridNearlyCompletelyDecomposable) {
+    // A sequence of clusters of strongly connected states. The clusters are only left with a tiny probability, so Gauss-Seidel would need millions of
+    // iterations to propagate the value of the target (which is reached from the last cluster) to the first cluster.
+    uint64_t const numberOfClusters = 100;
+    uint64_t const clusterSize = 10;
+    auto buildSystem = [&](double exitProbability, std::vector<double>& b) {
+        storm::storage::SparseMatrixBuilder<double> builder;
+        b.assign(numberOfClusters * clusterSize, 0.0);
+        for (uint64_t cluster = 0; cluster < numberOfClusters; ++cluster) {
+            for (uint64_t index = 0; index < clusterSize; ++index) {
+                uint64_t const state = cluster * clusterSize + index;
+                std::map<uint64_t, double> row;
+                row[cluster * clusterSize + (index + 1) % clusterSize] += 0.5;
+                row[cluster * clusterSize + (index + clusterSize - 1) % clusterSize] += 0.5 - exitProbability;
+                if (cluster + 1 < numberOfClusters) {
+                    row[(cluster + 1) * clusterSize] += exitProbability;
+                } else {
+                    b[state] = exitProbability;
+                }
+                for (auto const& entry : row) {
+                    builder.addNextValue(state, entry.first, entry.second);
+                }
+            }
+        }
+        return builder.build();
+    };
+
+    for (bool sound : {false, true}) {
+        storm::Environment env;
+        env.solver().setForceSoundness(sound);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Multigrid);
+        env.solver().native().setRelativeTerminationCriterion(false);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-6"));
+        env.solver().native().setMaximalNumberOfIterations(200);
+        std::vector<double> b;
+        // The sound bounds scale with the expected number of steps, which have to remain representable.
+        storm::storage::SparseMatrix<double> A = buildSystem(sound ? 1e-3 : 1e-7, b);
+        auto solver = storm::solver::GeneralLinearEquationSolverFactory<double>().create(env, A);
+        std::vector<double> x(A.getRowCount(), 0.0);
+        EXPECT_TRUE(solver->solveEquations(env, x, b));
+        // Every state eventually reaches the target.
+        for (uint64_t state = 0; state < x.size(); ++state) {
+            EXPECT_NEAR(1.0, x[state], 1e-6);
+        }
+    }
+}
+
+TEST(EigenLinearEquationSolverTest, FloatingPointPresolveWithRefinement) {
+    // The solution 1/3^40 needs more digits than a double provides, so it can only be certified after refining the floating point solution.
+    storm::RationalNumber const largeCoefficient = storm::utility::pow(storm::utility::convertNumber<storm::RationalNumber>(static_cast<uint64_t>(3)), 40);
+    storm::storage::SparseMatrixBuilder<storm::RationalNumber> builder;
+    builder.addNextValue(0, 0, largeCoefficient);
+    builder.addNextValue(1, 0, largeCoefficient);
+    builder.addNextValue(1, 1, storm::utility::convertNumber<storm::RationalNumber>(static_cast<uint64_t>(7)));
+    storm::storage::SparseMatrix<storm::RationalNumber> A = builder.build();
+    std::vector<storm::RationalNumber> b = {storm::utility::one<storm::RationalNumber>(),
+                                            storm::utility::convertNumber<storm::RationalNumber>(static_cast<uint64_t>(2))};
+
+    storm::Environment env;
+    env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Eigen);
+    env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+    uint64_t const maximalNumberOfRefinementSteps = env.solver().eigen().getNumberOfRefinementSteps();
+    for (uint64_t refinementSteps = 0; refinementSteps <= maximalNumberOfRefinementSteps; ++refinementSteps) {
+        env.solver().eigen().setNumberOfRefinementSteps(refinementSteps);
+        auto solver = storm::solver::GeneralLinearEquationSolverFactory<storm::RationalNumber>().create(env, A);
+        std::vector<storm::RationalNumber> x(2);
+        EXPECT_TRUE(solver->solveEquations(env, x, b));
+        EXPECT_EQ(storm::utility::one<storm::RationalNumber>() / largeCoefficient, x[0]);
+        EXPECT_EQ(storm::utility::one<storm::RationalNumber>() / storm::utility::convertNumber<storm::RationalNumber>(static_cast<uint64_t>(7)), x[1]);
+    }
+}
+
+TEST(TopologicalLinearEquationSolverTest, ConcurrentSccs) {
+    // A tree of SCCs, each consisting of two states where the second state depends on the SCC of the parent.
+    uint64_t const numberOfSccs = 200;
+    storm::storage::SparseMatrixBuilder<double> builder;
+    std::vector<double> b;
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        uint64_t const first = 2 * sccIndex;
+        builder.addNextValue(first, first + 1, 0.5);
+        b.push_back(0.1 + 0.001 * sccIndex);
+        if (sccIndex > 0) {
+            builder.addNextValue(first + 1, 2 * ((sccIndex - 1) / 2), 0.2);
+        }
+        builder.addNextValue(first + 1, first, 0.4);
+        b.push_back(0.1);
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+
+    auto solve = [&](uint64_t numberOfThreads) {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+        env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Eigen);
+        env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+        env.solver().setNumberOfThreads(numberOfThreads);
+        auto solver = storm::solver::GeneralLinearEquationSolverFactory<double>().create(env, A);
+        std::vector<double> x(A.getRowCount());
+        EXPECT_TRUE(solver->solveEquations(env, x, b));
+        return x;
+    };
+    std::vector<double> sequentialResult = solve(1);
+    std::vector<double> concurrentResult = solve(4);
+    ASSERT_EQ(sequentialResult.size(), concurrentResult.size());
+    for (uint64_t state = 0; state < sequentialResult.size(); ++state) {
+        EXPECT_NEAR(sequentialResult[state], concurrentResult[state], 1e-12);
+    }
+}
 }  // namespace
\ No newline at end of file
@@ -1,10 +1,15 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <filesystem>
+
 #include "test/storm_gtest.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/OviSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/SolverSelectionOptions.h"
@@ -37,6 +42,32 @@ class DoubleViRegMultEnvironment {
     }
 };
 
+class DoubleViMixedPrecisionEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setMixedPrecision(true);
+        return env;
+    }
+};
+
+class DoubleViCompressedValuesEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().multiplier().setCompressedValues(true);
+        return env;
+    }
+};
+
 class DoubleSoundViEnvironment {
    public:
     typedef double ValueType;
@@ -76,6 +107,31 @@ class DoubleOptimisticViEnvironment {
     }
 };
 
+class DoublePrioritizedViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PrioritizedValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+
+class DoubleSoundPrioritizedViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PrioritizedValueIteration);
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+};
+
 class DoubleTopologicalViEnvironment {
    public:
     typedef double ValueType;
@@ -103,6 +159,18 @@ class DoublePIEnvironment {
         return env;
     }
 };
+class DoubleMultigridEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Multigrid);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().setLinearEquationSolverPrecision(env.solver().minMax().getPrecision());
+        return env;
+    }
+};
 class RationalPIEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -143,9 +211,10 @@ class MinMaxLinearEquationSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoubleViRegMultEnvironment, DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment,
-                         DoubleOptimisticViEnvironment, DoubleTopologicalViEnvironment, DoublePIEnvironment, RationalPIEnvironment,
-                         RationalRationalSearchEnvironment>
+typedef ::testing::Types<DoubleViEnvironment, DoubleViRegMultEnvironment, DoubleViMixedPrecisionEnvironment, DoubleViCompressedValuesEnvironment,
+                         DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment, DoubleOptimisticViEnvironment, DoublePrioritizedViEnvironment,
+                         DoubleSoundPrioritizedViEnvironment, DoubleTopologicalViEnvironment, DoublePIEnvironment, DoubleMultigridEnvironment,
+                         RationalPIEnvironment, RationalRationalSearchEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(MinMaxLinearEquationSolverTest, TestingTypes, );
@@ -177,4 +246,437 @@ TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquations) {
     ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
     EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
 }
+
+TEST(MinMaxLinearEquationSolverIterationObserverTest, ReportsAndAborts) {
+    // A single state with a self loop, such that the iterates approach the fixpoint 0.99 slowly.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    storm::storage::SparseMatrix<double> A = builder.build();
+    std::vector<double> b = {0.099};
+
+    auto solve = [&](storm::solver::MinMaxMethod method, bool sound, storm::solver::SolverIterationObserver const& observer) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(method);
+        env.solver().setForceSoundness(sound);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        env.solver().setIterationObserver(observer);
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 1.0);
+        solver->setRequirementsChecked(true);
+        std::vector<double> x(1);
+        return solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b);
+    };
+
+    std::vector<storm::solver::SolverIterationInfo> infos;
+    auto record = [&infos](storm::solver::SolverIterationInfo const& info) {
+        infos.push_back(info);
+        return true;
+    };
+    EXPECT_TRUE(solve(storm::solver::MinMaxMethod::ValueIteration, false, record));
+    ASSERT_LT(1ull, infos.size());
+    for (uint64_t i = 1; i < infos.size(); ++i) {
+        EXPECT_EQ(infos[i - 1].iteration + 1, infos[i].iteration);
+        EXPECT_LE(infos[i - 1].elapsedSeconds, infos[i].elapsedSeconds);
+        ASSERT_TRUE(infos[i].residual.has_value());
+        EXPECT_LT(*infos[i].residual, 1.0);
+        EXPECT_EQ(1ull, infos[i].numberOfUpdatedStates.value());
+    }
+
+    infos.clear();
+    EXPECT_TRUE(solve(storm::solver::MinMaxMethod::IntervalIteration, true, record));
+    ASSERT_LT(1ull, infos.size());
+    ASSERT_TRUE(infos.back().boundsGap.has_value());
+    ASSERT_TRUE(infos.front().boundsGap.has_value());
+    EXPECT_LT(*infos.back().boundsGap, *infos.front().boundsGap);
+
+    // The solver aborts as soon as the observer asks for it.
+    uint64_t numberOfCalls = 0;
+    auto abortAfterFive = [&numberOfCalls](storm::solver::SolverIterationInfo const&) { return ++numberOfCalls < 5; };
+    EXPECT_FALSE(solve(storm::solver::MinMaxMethod::ValueIteration, false, abortAfterFive));
+    EXPECT_EQ(5ull, numberOfCalls);
+}
+
+TEST(MinMaxLinearEquationSolverCheckpointTest, ResumesInterruptedSolve) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    storm::storage::SparseMatrix<double> A = builder.build();
+    std::vector<double> b = {0.099};
+    std::string const filename = (std::filesystem::temp_directory_path() / "storm-solver-checkpoint-test.bin").string();
+    std::filesystem::remove(filename);
+
+    auto solve = [&](storm::solver::MinMaxMethod method, std::vector<double> const& offsets, storm::solver::SolverIterationObserver const& observer,
+                     std::vector<double>& x) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(method);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        env.solver().setIterationObserver(observer);
+        env.solver().setCheckpointFilename(filename);
+        env.solver().setCheckpointInterval(0);
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 1.0);
+        solver->setRequirementsChecked(true);
+        x.assign(1, 0.0);
+        return solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, offsets);
+    };
+
+    std::vector<double> x;
+    uint64_t numberOfCalls = 0;
+    auto abortAfterFive = [&numberOfCalls](storm::solver::SolverIterationInfo const&) { return ++numberOfCalls < 5; };
+    for (auto method : {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::IntervalIteration}) {
+        numberOfCalls = 0;
+        EXPECT_FALSE(solve(method, b, abortAfterFive, x));
+
+        // The next solve of the same system continues after the iterations of the interrupted one.
+        std::vector<uint64_t> iterations;
+        auto record = [&iterations](storm::solver::SolverIterationInfo const& info) {
+            iterations.push_back(info.iteration);
+            return true;
+        };
+        EXPECT_TRUE(solve(method, b, record, x));
+        ASSERT_FALSE(iterations.empty());
+        EXPECT_EQ(6ull, iterations.front());
+        EXPECT_NEAR(0.99, x[0], 1e-8);
+
+        // Other equation systems do not use the checkpoint.
+        iterations.clear();
+        EXPECT_TRUE(solve(method, {0.05}, record, x));
+        ASSERT_FALSE(iterations.empty());
+        EXPECT_EQ(1ull, iterations.front());
+        EXPECT_NEAR(0.5, x[0], 1e-8);
+    }
+    std::filesystem::remove(filename);
+}
+
+TEST(MinMaxLinearEquationSolverAnytimeTest, AbortedSolveProvidesBounds) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    storm::storage::SparseMatrix<double> A = builder.build();
+    std::vector<double> b = {0.099};
+
+    uint64_t numberOfCalls = 0;
+    auto abortAfterFive = [&numberOfCalls](storm::solver::SolverIterationInfo const&) { return ++numberOfCalls < 5; };
+    storm::Environment env;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+    for (auto method : {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::IntervalIteration}) {
+        numberOfCalls = 0;
+        env.solver().minMax().setMethod(method);
+        env.solver().setIterationObserver(abortAfterFive);
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 1.0);
+        solver->setRequirementsChecked(true);
+        std::vector<double> x(1, 0.0);
+        EXPECT_FALSE(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+        if (method == storm::solver::MinMaxMethod::ValueIteration) {
+            // Value iteration does not know an upper bound.
+            EXPECT_FALSE(solver->hasAbortedSolveBounds());
+        } else {
+            ASSERT_TRUE(solver->hasAbortedSolveBounds());
+            auto const& bounds = solver->getAbortedSolveBounds();
+            EXPECT_LE(bounds.first[0], 0.99);
+            EXPECT_GE(bounds.second[0], 0.99);
+            EXPECT_GT(bounds.second[0] - bounds.first[0], 1e-3);
+        }
+
+        // A solve that is not aborted does not report bounds.
+        env.solver().setIterationObserver({});
+        EXPECT_TRUE(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_FALSE(solver->hasAbortedSolveBounds());
+    }
+}
+
+TEST(OptimisticValueIterationMinMaxLinearEquationSolverTest, AdaptiveVerificationPhases) {
+    // The value of the second state is approached slowly due to its self loop. The first state either moves to the second state or leaves it earlier.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.5);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(1, 1, 0.9);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 1, 0.999);
+    storm::storage::SparseMatrix<double> A = builder.build();
+    std::vector<double> b = {0.0, 0.1, 0.000999};
+
+    std::vector<storm::solver::SolverIterationInfo> infos;
+    auto solve = [&](storm::OptimizationDirection dir, bool adaptive) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::OptimisticValueIteration);
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setRelativeTerminationCriterion(false);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().ovi().setAdaptive(adaptive);
+        env.solver().setIterationObserver([&infos](storm::solver::SolverIterationInfo const& info) {
+            infos.push_back(info);
+            return true;
+        });
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 1.0);
+        solver->setRequirementsChecked(true);
+        std::vector<double> x(2);
+        EXPECT_TRUE(solver->solveEquations(env, dir, x, b));
+        return x;
+    };
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> nonAdaptiveResult = solve(dir, false);
+        infos.clear();
+        std::vector<double> adaptiveResult = solve(dir, true);
+        EXPECT_NEAR(nonAdaptiveResult[0], adaptiveResult[0], 2e-8);
+        EXPECT_NEAR(nonAdaptiveResult[1], adaptiveResult[1], 2e-8);
+        EXPECT_NEAR(0.999, adaptiveResult[1], 2e-8);
+        EXPECT_NEAR(storm::OptimizationDirection::Minimize == dir ? 0.999 : 0.9991, adaptiveResult[0], 2e-8);
+
+        // Every iteration reports the verification phases, and phases are only counted once they start.
+        ASSERT_FALSE(infos.empty());
+        for (uint64_t i = 0; i < infos.size(); ++i) {
+            ASSERT_TRUE(infos[i].numberOfVerificationPhases.has_value());
+            ASSERT_TRUE(infos[i].numberOfFailedVerificationPhases.has_value());
+            EXPECT_LE(*infos[i].numberOfFailedVerificationPhases, *infos[i].numberOfVerificationPhases);
+            if (*infos[i].inVerificationPhase) {
+                EXPECT_LT(*infos[i].numberOfFailedVerificationPhases, *infos[i].numberOfVerificationPhases);
+            }
+            if (i > 0) {
+                EXPECT_LE(*infos[i - 1].numberOfVerificationPhases, *infos[i].numberOfVerificationPhases);
+            }
+        }
+        infos.clear();
+    }
+}
+
+TEST(PrioritizedMinMaxLinearEquationSolverTest, MatchesValueIteration) {
+    // A chain of states that either move forward or restart, where only the last states are affected by a second action.
+    uint64_t const numberOfStates = 1000;
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    std::vector<double> b;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.newRowGroup(row);
+        if (state + 1 < numberOfStates) {
+            builder.addNextValue(row, 0, 0.1);
+            builder.addNextValue(row, state + 1, 0.85);
+        }
+        b.push_back(state + 1 < numberOfStates ? 0.0 : 1.0);
+        ++row;
+        if (state + 10 >= numberOfStates) {
+            builder.addNextValue(row, state, 0.5);
+            b.push_back(0.4);
+            ++row;
+        }
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+
+    auto solve = [&](storm::solver::MinMaxMethod method, bool sound, storm::OptimizationDirection dir) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(method);
+        env.solver().setForceSoundness(sound);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 1.0);
+        solver->setRequirementsChecked(true);
+        std::vector<double> x(A.getRowGroupCount());
+        EXPECT_TRUE(solver->solveEquations(env, dir, x, b));
+        return x;
+    };
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> viResult = solve(storm::solver::MinMaxMethod::ValueIteration, false, dir);
+        std::vector<double> pviResult = solve(storm::solver::MinMaxMethod::PrioritizedValueIteration, false, dir);
+        std::vector<double> soundPviResult = solve(storm::solver::MinMaxMethod::PrioritizedValueIteration, true, dir);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            EXPECT_NEAR(viResult[state], pviResult[state], 1e-8);
+            EXPECT_NEAR(viResult[state], soundPviResult[state], 1e-8);
+        }
+    }
+}
+
+TEST(TopologicalMinMaxLinearEquationSolverTest, ConcurrentSccs) {
+    // A tree of SCCs, each consisting of two states where the second state depends on the SCC of the parent.
+    uint64_t const numberOfSccs = 200;
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    std::vector<double> b;
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        uint64_t const first = 2 * sccIndex;
+        builder.newRowGroup(row);
+        builder.addNextValue(row++, first + 1, 0.5);
+        b.push_back(0.1);
+        builder.addNextValue(row++, first + 1, 0.3);
+        b.push_back(0.2 + 0.001 * sccIndex);
+        builder.newRowGroup(row);
+        if (sccIndex > 0) {
+            builder.addNextValue(row, 2 * ((sccIndex - 1) / 2), 0.2);
+        }
+        builder.addNextValue(row, first, 0.4);
+        ++row;
+        b.push_back(0.1);
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+
+    auto solve = [&](uint64_t numberOfThreads, storm::OptimizationDirection dir, std::vector<uint64_t>& choices) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+        env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        env.solver().setNumberOfThreads(numberOfThreads);
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 2.0);
+        solver->setTrackScheduler(true);
+        solver->setRequirementsChecked(true);
+        std::vector<double> x(A.getRowGroupCount());
+        EXPECT_TRUE(solver->solveEquations(env, dir, x, b));
+        choices = solver->getSchedulerChoices();
+        return x;
+    };
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<uint64_t> sequentialChoices, concurrentChoices;
+        std::vector<double> sequentialResult = solve(1, dir, sequentialChoices);
+        std::vector<double> concurrentResult = solve(4, dir, concurrentChoices);
+        ASSERT_EQ(sequentialResult.size(), concurrentResult.size());
+        for (uint64_t state = 0; state < sequentialResult.size(); ++state) {
+            EXPECT_NEAR(sequentialResult[state], concurrentResult[state], 1e-8);
+        }
+        EXPECT_EQ(sequentialChoices, concurrentChoices);
+    }
+}
+
+TEST(TopologicalMinMaxLinearEquationSolverTest, SoundSccsWithExitBounds) {
+    // A chain of SCCs, each consisting of two states where the second state can exit to the previous SCC.
+    uint64_t const numberOfSccs = 50;
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    std::vector<double> b;
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        uint64_t const first = 2 * sccIndex;
+        builder.newRowGroup(row);
+        builder.addNextValue(row++, first + 1, 0.9);
+        b.push_back(0.05);
+        builder.addNextValue(row++, first + 1, 0.5);
+        b.push_back(0.3);
+        builder.newRowGroup(row);
+        if (sccIndex > 0) {
+            builder.addNextValue(row, first - 2, 0.5);
+        }
+        builder.addNextValue(row, first, 0.4);
+        ++row;
+        b.push_back(sccIndex > 0 ? 0.0 : 0.5);
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+
+    auto solve = [&](storm::solver::MinMaxMethod underlyingMethod, bool sound, storm::OptimizationDirection dir) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+        env.solver().topological().setUnderlyingMinMaxMethod(underlyingMethod);
+        env.solver().setForceSoundness(sound);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        // The loose global bounds are tightened for each SCC by the values of the states the SCC exits to.
+        solver->setBounds(0.0, 100.0);
+        solver->setRequirementsChecked(true);
+        std::vector<double> x(A.getRowGroupCount());
+        EXPECT_TRUE(solver->solveEquations(env, dir, x, b));
+        return x;
+    };
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expected = solve(storm::solver::MinMaxMethod::PolicyIteration, false, dir);
+        for (auto method : {storm::solver::MinMaxMethod::IntervalIteration, storm::solver::MinMaxMethod::SoundValueIteration}) {
+            std::vector<double> result = solve(method, true, dir);
+            ASSERT_EQ(expected.size(), result.size());
+            for (uint64_t state = 0; state < expected.size(); ++state) {
+                EXPECT_NEAR(expected[state], result[state], 1e-8);
+            }
+        }
+    }
+}
+
+TEST(PolicyIterationMinMaxLinearEquationSolverTest, ChangingChoices) {
+    // Every state has two choices with a single entry (so changing between them only changes the row in place) and one choice with two entries.
+    uint64_t const numberOfStates = 100;
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    std::vector<double> b;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.newRowGroup(row);
+        builder.addNextValue(row++, (state + 1) % numberOfStates, 0.6);
+        b.push_back(0.1 * (state % 3));
+        std::vector<uint64_t> columns = {(state + 2) % numberOfStates, (state + 5) % numberOfStates};
+        std::sort(columns.begin(), columns.end());
+        builder.addNextValue(row, columns[0], 0.3);
+        builder.addNextValue(row++, columns[1], 0.3);
+        b.push_back(0.1);
+        builder.addNextValue(row++, (state + 3) % numberOfStates, 0.7);
+        b.push_back(0.05 * (state % 4));
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+
+    auto solve = [&](storm::solver::MinMaxMethod method, storm::solver::EquationSolverType linearEquationSolverType, uint64_t numberOfThreads,
+                     storm::OptimizationDirection dir) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(method);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        env.solver().setLinearEquationSolverType(linearEquationSolverType);
+        env.solver().setLinearEquationSolverPrecision(env.solver().minMax().getPrecision());
+        env.solver().setNumberOfThreads(numberOfThreads);
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 10.0);
+        solver->setRequirementsChecked(true);
+        std::vector<double> x(A.getRowGroupCount());
+        EXPECT_TRUE(solver->solveEquations(env, dir, x, b));
+        return x;
+    };
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> reference = solve(storm::solver::MinMaxMethod::ValueIteration, storm::solver::EquationSolverType::Native, 1, dir);
+        for (auto linearEquationSolverType : {storm::solver::EquationSolverType::Native, storm::solver::EquationSolverType::Gmmxx}) {
+            for (uint64_t numberOfThreads : {1ull, 4ull}) {
+                std::vector<double> result = solve(storm::solver::MinMaxMethod::PolicyIteration, linearEquationSolverType, numberOfThreads, dir);
+                ASSERT_EQ(reference.size(), result.size());
+                for (uint64_t state = 0; state < reference.size(); ++state) {
+                    EXPECT_NEAR(reference[state], result[state], 1e-6);
+                }
+            }
+        }
+    }
+}
+
+TEST(LpMinMaxLinearEquationSolverTest, FixedRowGroups) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.5);
+    builder.addNextValue(0, 1, 0.5);
+    builder.newRowGroup(2);
+    storm::storage::SparseMatrix<double> A = builder.build(3, 2, 2);
+    std::vector<double> b = {0.0, 0.3, 0.8};
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::LinearProgramming);
+    auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+    solver->setHasUniqueSolution(true);
+    solver->setHasNoEndComponents(true);
+    // The value of the second state is fixed by its bounds, so no constraints are created for it.
+    solver->setBounds(std::vector<double>({0.0, 0.8}), std::vector<double>({1.0, 0.8}));
+    solver->setRequirementsChecked(true);
+    std::vector<double> x(2);
+    ASSERT_TRUE(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+    EXPECT_NEAR(0.8, x[0], 1e-6);
+    EXPECT_NEAR(0.8, x[1], 1e-6);
+    ASSERT_TRUE(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+    EXPECT_NEAR(0.3, x[0], 1e-6);
+    EXPECT_NEAR(0.8, x[1], 1e-6);
+}
 }  // namespace
@@ -0,0 +1,70 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/helper/MinMaxMethodSelection.h"
+#include "storm/storage/SparseMatrix.h"
+
+TEST(MinMaxMethodSelectionTest, FeaturesAndRanking) {
+    storm::storage::SparseMatrixBuilder<double> builder(4, 3, 6, true, true, 3);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.5);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(1, 2, 1.0);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 0, 0.0005);
+    builder.addNextValue(2, 2, 0.9995);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 2, 1.0);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+
+    storm::storage::BitVector subsystem(3, true);
+    subsystem.set(2, false);
+    auto features = storm::solver::helper::computeMinMaxProblemFeatures(matrix, subsystem);
+    EXPECT_EQ(2ull, features.numberOfStates);
+    EXPECT_EQ(3ull, features.numberOfChoices);
+    EXPECT_EQ(3ull, features.numberOfEntries);
+    EXPECT_EQ(1ull, features.numberOfNonTrivialSccs);
+    EXPECT_EQ(2ull, features.largestSccSize);
+    EXPECT_EQ(2ull, features.maximalRowGroupSize);
+    EXPECT_NEAR(1.5, features.averageRowGroupSize, 1e-12);
+    EXPECT_NEAR(0.0005, features.minimalProbability, 1e-12);
+    EXPECT_FALSE(features.isAcyclic());
+
+    auto ranking = storm::solver::helper::rankMinMaxMethods(features, false);
+    ASSERT_LE(3ull, ranking.size());
+    EXPECT_EQ(storm::solver::MinMaxMethod::PolicyIteration, ranking[0]);
+    EXPECT_EQ(storm::solver::MinMaxMethod::ViToPi, ranking[1]);
+    EXPECT_EQ(storm::solver::MinMaxMethod::ValueIteration, ranking[2]);
+
+    auto soundRanking = storm::solver::helper::rankMinMaxMethods(features, true);
+    ASSERT_LE(1ull, soundRanking.size());
+    EXPECT_EQ(storm::solver::MinMaxMethod::IntervalIteration, soundRanking[0]);
+}
+
+TEST(MinMaxMethodSelectionTest, ModelCheckingWithRace) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"three\"]; Rmin=? [F \"done\"]", program));
+    auto mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological, true);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    env.solver().minMax().setAutomaticMethodSelection(true);
+    env.solver().minMax().setAutomaticMethodRaceTime(200);
+
+    auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0], true));
+    EXPECT_NEAR(2.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[*mdp->getInitialStates().begin()], 1e-6);
+    result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[1], true));
+    EXPECT_NEAR(22.0 / 3.0, result->asExplicitQuantitativeCheckResult<double>()[*mdp->getInitialStates().begin()], 1e-6);
+}
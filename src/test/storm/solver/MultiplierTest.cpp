@@ -19,6 +19,41 @@ class NativeEnvironment {
     }
 };
 
+class NativeSplitStorageEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        env.solver().multiplier().setSplitStorage(true);
+        return env;
+    }
+};
+
+class SimdEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Simd);
+        return env;
+    }
+};
+
+class CudaEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        // Without CUDA support, the native multiplier is used instead.
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Cuda);
+        return env;
+    }
+};
+
 class GmmxxEnvironment {
    public:
     typedef double ValueType;
@@ -49,7 +84,7 @@ class MultiplierTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<NativeEnvironment, GmmxxEnvironment> TestingTypes;
+typedef ::testing::Types<NativeEnvironment, NativeSplitStorageEnvironment, SimdEnvironment, CudaEnvironment, GmmxxEnvironment> TestingTypes;
 
 TYPED_TEST_SUITE(MultiplierTest, TestingTypes, );
 
@@ -78,6 +113,37 @@ TYPED_TEST(MultiplierTest, repeatedMultiplyTest) {
     EXPECT_NEAR(x[0], this->parseNumber("1"), this->precision());
 }
 
+TYPED_TEST(MultiplierTest, repeatedMultiplyUntilSteadyTest) {
+    typedef typename TestFixture::ValueType ValueType;
+    storm::storage::SparseMatrixBuilder<ValueType> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 4, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 4, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 3, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 4, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(3, 4, this->parseNumber("1")));
+    ASSERT_NO_THROW(builder.addNextValue(4, 4, this->parseNumber("1")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    std::vector<ValueType> x(5);
+    x[4] = this->parseNumber("1");
+
+    auto factory = storm::solver::MultiplierFactory<ValueType>();
+    auto multiplier = factory.create(this->env(), A);
+    // After four multiplications, all values are one and the fifth multiplication does not change them.
+    EXPECT_EQ(5ull, multiplier->repeatedMultiplyUntilSteady(this->env(), x, nullptr, 1000000));
+    EXPECT_NEAR(x[0], this->parseNumber("1"), this->precision());
+
+    x.assign(5, this->parseNumber("0"));
+    x[4] = this->parseNumber("1");
+    EXPECT_EQ(2ull, multiplier->repeatedMultiplyUntilSteady(this->env(), x, nullptr, 2));
+    EXPECT_NEAR(x[2], this->parseNumber("1"), this->precision());
+    EXPECT_NEAR(x[1], this->parseNumber("0.75"), this->precision());
+}
+
 TYPED_TEST(MultiplierTest, repeatedMultiplyAndReduceTest) {
     typedef typename TestFixture::ValueType ValueType;
 
@@ -123,4 +189,66 @@ TYPED_TEST(MultiplierTest, repeatedMultiplyAndReduceTest) {
     EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
 }
 
+TYPED_TEST(MultiplierTest, multiplyBlockTest) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.099")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("0.001")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("1")));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("1")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    auto factory = storm::solver::MultiplierFactory<ValueType>();
+    auto multiplier = factory.create(this->env(), A);
+
+    // Compare the multiplication of blocks of different sizes with the multiplication of the individual vectors.
+    for (uint64_t blockSize : {1, 3, 4}) {
+        std::vector<ValueType> xBlock(3 * blockSize), bBlock(4 * blockSize);
+        for (uint64_t i = 0; i < xBlock.size(); ++i) {
+            xBlock[i] = this->parseNumber(std::to_string(i % 5)) / this->parseNumber("4");
+        }
+        for (uint64_t i = 0; i < bBlock.size(); ++i) {
+            bBlock[i] = this->parseNumber(std::to_string(i % 3)) / this->parseNumber("10");
+        }
+        std::vector<ValueType> resultBlock, reducedBlock;
+        ASSERT_NO_THROW(multiplier->multiplyBlock(this->env(), blockSize, xBlock, &bBlock, resultBlock));
+        ASSERT_NO_THROW(multiplier->multiplyAndReduceBlock(this->env(), storm::OptimizationDirection::Maximize, blockSize, xBlock, &bBlock, reducedBlock));
+        ASSERT_EQ(4 * blockSize, resultBlock.size());
+        ASSERT_EQ(3 * blockSize, reducedBlock.size());
+
+        for (uint64_t vector = 0; vector < blockSize; ++vector) {
+            std::vector<ValueType> x(3), b(4), result, reduced;
+            for (uint64_t i = 0; i < 3; ++i) {
+                x[i] = xBlock[i * blockSize + vector];
+            }
+            for (uint64_t i = 0; i < 4; ++i) {
+                b[i] = bBlock[i * blockSize + vector];
+            }
+            multiplier->multiply(this->env(), x, &b, result);
+            multiplier->multiplyAndReduce(this->env(), storm::OptimizationDirection::Maximize, x, &b, reduced);
+            for (uint64_t i = 0; i < 4; ++i) {
+                EXPECT_NEAR(result[i], resultBlock[i * blockSize + vector], this->precision());
+            }
+            for (uint64_t i = 0; i < 3; ++i) {
+                EXPECT_NEAR(reduced[i], reducedBlock[i * blockSize + vector], this->precision());
+            }
+        }
+
+        // The result may replace the input.
+        ASSERT_NO_THROW(multiplier->multiplyAndReduceBlock(this->env(), storm::OptimizationDirection::Maximize, blockSize, xBlock, &bBlock, xBlock));
+        for (uint64_t i = 0; i < xBlock.size(); ++i) {
+            EXPECT_NEAR(reducedBlock[i], xBlock[i], this->precision());
+        }
+    }
+}
+
 }  // namespace
\ No newline at end of file
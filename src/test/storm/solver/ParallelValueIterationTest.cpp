@@ -0,0 +1,181 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/threads.h"
+
+namespace {
+
+// Creates a substochastic matrix with the given number of row groups, each having two rows with three entries.
+storm::storage::SparseMatrix<double> createMatrix(uint64_t numberOfGroups) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < 2; ++choice, ++row) {
+            std::vector<uint64_t> successors = {(group * 7 + choice) % numberOfGroups, (group * 13 + 5 * choice + 1) % numberOfGroups,
+                                                (group * 31 + 11 * choice + 2) % numberOfGroups};
+            std::sort(successors.begin(), successors.end());
+            successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+            for (auto const& successor : successors) {
+                builder.addNextValue(row, successor, 0.9 / successors.size());
+            }
+        }
+    }
+    return builder.build(row, numberOfGroups, numberOfGroups);
+}
+
+std::vector<double> createOffsets(uint64_t size) {
+    std::vector<double> offsets(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        offsets[i] = static_cast<double>((i * 7919) % 100) / 100.0;
+    }
+    return offsets;
+}
+
+}  // namespace
+
+TEST(ParallelValueIterationTest, OperatorMatchesSequential) {
+    auto matrix = createMatrix(5000);
+    auto offsets = createOffsets(matrix.getRowCount());
+
+    for (auto mult : {storm::solver::MultiplicationStyle::Regular, storm::solver::MultiplicationStyle::GaussSeidel}) {
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            auto sequentialOp = std::make_shared<storm::solver::helper::ValueIterationOperator<double, false>>();
+            sequentialOp->setMatrixBackwards(matrix);
+            std::vector<double> expected(matrix.getRowGroupCount(), 0.0);
+            storm::solver::helper::ValueIterationHelper<double, false> sequentialHelper(sequentialOp);
+            EXPECT_EQ(storm::solver::SolverStatus::Converged, sequentialHelper.VI(expected, offsets, false, 1e-10, dir, {}, mult));
+
+            auto parallelOp = std::make_shared<storm::solver::helper::ValueIterationOperator<double, false>>();
+            parallelOp->setMatrixBackwards(matrix);
+            // Use small chunks so that the matrix is actually split among the threads.
+            parallelOp->setNumberOfThreads(4, 256);
+            EXPECT_EQ(4ull, parallelOp->getNumberOfThreads());
+            std::vector<double> result(matrix.getRowGroupCount(), 0.0);
+            storm::solver::helper::ValueIterationHelper<double, false> parallelHelper(parallelOp);
+            EXPECT_EQ(storm::solver::SolverStatus::Converged, parallelHelper.VI(result, offsets, false, 1e-10, dir, {}, mult));
+
+            for (uint64_t state = 0; state < result.size(); ++state) {
+                EXPECT_NEAR(expected[state], result[state], 1e-8);
+            }
+        }
+    }
+}
+
+TEST(ParallelValueIterationTest, SolverMatchesSequential) {
+    auto matrix = createMatrix(20000);
+    auto offsets = createOffsets(matrix.getRowCount());
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+    std::vector<double> expected(matrix.getRowGroupCount(), 0.0);
+    auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, matrix);
+    solver->setHasUniqueSolution(true);
+    ASSERT_TRUE(solver->solveEquations(env, storm::OptimizationDirection::Maximize, expected, offsets));
+
+    env.solver().setNumberOfThreads(4);
+    EXPECT_EQ(4ull, env.solver().getNumberOfThreads());
+    std::vector<double> result(matrix.getRowGroupCount(), 0.0);
+    solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, matrix);
+    solver->setHasUniqueSolution(true);
+    ASSERT_TRUE(solver->solveEquations(env, storm::OptimizationDirection::Maximize, result, offsets));
+
+    for (uint64_t state = 0; state < result.size(); ++state) {
+        EXPECT_NEAR(expected[state], result[state], 1e-8);
+    }
+}
+
+TEST(ParallelValueIterationTest, NumaPlacementMatchesSequential) {
+    auto matrix = createMatrix(5000);
+    auto offsets = createOffsets(matrix.getRowCount());
+
+    auto sequentialOp = std::make_shared<storm::solver::helper::ValueIterationOperator<double, false>>();
+    sequentialOp->setMatrixBackwards(matrix);
+    std::vector<double> expected(matrix.getRowGroupCount(), 0.0);
+    storm::solver::helper::ValueIterationHelper<double, false> sequentialHelper(sequentialOp);
+    EXPECT_EQ(storm::solver::SolverStatus::Converged, sequentialHelper.VI(expected, offsets, false, 1e-10, storm::OptimizationDirection::Maximize));
+
+    // The matrix entries are placed on the threads even if the system has only a single NUMA node.
+    storm::utility::setThreadAffinityPolicy(storm::utility::ThreadAffinityPolicy::NumaNodes);
+    auto parallelOp = std::make_shared<storm::solver::helper::ValueIterationOperator<double, false>>();
+    parallelOp->setMatrixBackwards(matrix);
+    parallelOp->setNumberOfThreads(4, 256);
+    std::vector<double> result(matrix.getRowGroupCount(), 0.0);
+    storm::solver::helper::ValueIterationHelper<double, false> parallelHelper(parallelOp);
+    EXPECT_EQ(storm::solver::SolverStatus::Converged, parallelHelper.VI(result, offsets, false, 1e-10, storm::OptimizationDirection::Maximize));
+    storm::utility::setThreadAffinityPolicy(storm::utility::ThreadAffinityPolicy::None);
+
+    for (uint64_t state = 0; state < result.size(); ++state) {
+        EXPECT_NEAR(expected[state], result[state], 1e-8);
+    }
+}
+
+TEST(ParallelValueIterationTest, AsynchronousUpdatesMatchSequential) {
+    auto matrix = createMatrix(20000);
+    auto offsets = createOffsets(matrix.getRowCount());
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().minMax().setMultiplicationStyle(storm::solver::MultiplicationStyle::GaussSeidel);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+    std::vector<double> expected(matrix.getRowGroupCount(), 0.0);
+    auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, matrix);
+    solver->setHasUniqueSolution(true);
+    ASSERT_TRUE(solver->solveEquations(env, storm::OptimizationDirection::Minimize, expected, offsets));
+
+    env.solver().setNumberOfThreads(4);
+    env.solver().minMax().setAsynchronousUpdates(true);
+    std::vector<double> result(matrix.getRowGroupCount(), 0.0);
+    solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, matrix);
+    solver->setHasUniqueSolution(true);
+    ASSERT_TRUE(solver->solveEquations(env, storm::OptimizationDirection::Minimize, result, offsets));
+
+    for (uint64_t state = 0; state < result.size(); ++state) {
+        EXPECT_NEAR(expected[state], result[state], 1e-8);
+    }
+}
+
+TEST(ParallelValueIterationTest, CompactIndicesMatchFullIndices) {
+    auto matrix = createMatrix(5000);
+    auto offsets = createOffsets(matrix.getRowCount());
+
+    auto fullOp = std::make_shared<storm::solver::helper::ValueIterationOperator<double, false>>();
+    fullOp->setCompactIndices(false);
+    fullOp->setMatrixBackwards(matrix);
+    EXPECT_FALSE(fullOp->isUsingCompactIndices());
+    std::vector<double> expected(matrix.getRowGroupCount(), 0.0);
+    storm::solver::helper::ValueIterationHelper<double, false> fullHelper(fullOp);
+    EXPECT_EQ(storm::solver::SolverStatus::Converged, fullHelper.VI(expected, offsets, false, 1e-10, storm::OptimizationDirection::Maximize));
+
+    // Compact indices are used by default, both for sequential and parallel applications.
+    for (uint64_t numberOfThreads : {1ull, 4ull}) {
+        auto compactOp = std::make_shared<storm::solver::helper::ValueIterationOperator<double, false>>();
+        compactOp->setMatrixBackwards(matrix);
+        compactOp->setNumberOfThreads(numberOfThreads, 256);
+        EXPECT_TRUE(compactOp->isUsingCompactIndices());
+        std::vector<double> result(matrix.getRowGroupCount(), 0.0);
+        storm::solver::helper::ValueIterationHelper<double, false> compactHelper(compactOp);
+        EXPECT_EQ(storm::solver::SolverStatus::Converged, compactHelper.VI(result, offsets, false, 1e-10, storm::OptimizationDirection::Maximize));
+        for (uint64_t state = 0; state < result.size(); ++state) {
+            EXPECT_NEAR(expected[state], result[state], 1e-8);
+        }
+    }
+
+    // Switching the representation of an operator retains the matrix.
+    fullOp->setCompactIndices(true);
+    EXPECT_TRUE(fullOp->isUsingCompactIndices());
+    std::vector<double> result(matrix.getRowGroupCount(), 0.0);
+    EXPECT_EQ(storm::solver::SolverStatus::Converged, fullHelper.VI(result, offsets, false, 1e-10, storm::OptimizationDirection::Maximize));
+    for (uint64_t state = 0; state < result.size(); ++state) {
+        EXPECT_NEAR(expected[state], result[state], 1e-8);
+    }
+}
@@ -0,0 +1,96 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <chrono>
+#include <iostream>
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/api/builder.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/multiplier/Multiplier.h"
+#include "storm/solver/multiplier/SimdMultiplier.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+std::shared_ptr<storm::models::sparse::Mdp<double>> buildMdp(std::string const& pathToPrismFile) {
+    storm::prism::Program program = storm::api::parseProgram(pathToPrismFile);
+    return storm::api::buildSparseModel<double>(program, storm::builder::BuilderOptions())->template as<storm::models::sparse::Mdp<double>>();
+}
+
+std::vector<double> getInputVector(uint64_t size) {
+    std::vector<double> x(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        x[i] = static_cast<double>((i * 7919) % 1000) / 1000.0;
+    }
+    return x;
+}
+
+}  // namespace
+
+TEST(SimdMultiplierTest, MatchesNativeMultiplier) {
+    auto mdp = buildMdp(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    auto const& matrix = mdp->getTransitionMatrix();
+    storm::Environment env;
+    env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+    auto nativeMultiplier = storm::solver::MultiplierFactory<double>().create(env, matrix);
+
+    std::vector<double> x = getInputVector(matrix.getColumnCount());
+    std::vector<double> b = getInputVector(matrix.getRowCount());
+    std::vector<double> expectedResult(matrix.getRowCount());
+    nativeMultiplier->multiply(env, x, &b, expectedResult);
+    std::vector<double> expectedMinResult(matrix.getRowGroupCount());
+    std::vector<uint64_t> expectedMinChoices(matrix.getRowGroupCount(), 0);
+    nativeMultiplier->multiplyAndReduce(env, storm::OptimizationDirection::Minimize, x, &b, expectedMinResult, &expectedMinChoices);
+    std::vector<double> expectedMaxResult(matrix.getRowGroupCount());
+    nativeMultiplier->multiplyAndReduce(env, storm::OptimizationDirection::Maximize, x, nullptr, expectedMaxResult);
+
+    for (auto instructionSet : {storm::solver::SimdInstructionSet::Scalar, storm::solver::SimdInstructionSet::Avx2,
+                                storm::solver::SimdInstructionSet::Avx512, storm::solver::SimdInstructionSet::Neon}) {
+        if (!storm::solver::SimdMultiplier<double>::isSupported(instructionSet)) {
+            continue;
+        }
+        storm::solver::SimdMultiplier<double> multiplier(matrix, instructionSet);
+        EXPECT_EQ(instructionSet, multiplier.getInstructionSet());
+
+        std::vector<double> result(matrix.getRowCount());
+        multiplier.multiply(env, x, &b, result);
+        for (uint64_t row = 0; row < result.size(); ++row) {
+            EXPECT_NEAR(expectedResult[row], result[row], 1e-12) << " with " << toString(instructionSet);
+        }
+
+        std::vector<double> minResult(matrix.getRowGroupCount());
+        std::vector<uint64_t> minChoices(matrix.getRowGroupCount(), 0);
+        multiplier.multiplyAndReduce(env, storm::OptimizationDirection::Minimize, x, &b, minResult, &minChoices);
+        std::vector<double> maxResult(matrix.getRowGroupCount());
+        multiplier.multiplyAndReduce(env, storm::OptimizationDirection::Maximize, x, nullptr, maxResult);
+        for (uint64_t group = 0; group < minResult.size(); ++group) {
+            EXPECT_NEAR(expectedMinResult[group], minResult[group], 1e-12) << " with " << toString(instructionSet);
+            EXPECT_NEAR(expectedMaxResult[group], maxResult[group], 1e-12) << " with " << toString(instructionSet);
+        }
+    }
+}
+
+// A benchmark comparing the SIMD multiplier with the native and gmm++ multipliers. Run it via --gtest_also_run_disabled_tests.
+TEST(SimdMultiplierTest, DISABLED_Benchmark) {
+    uint64_t const numberOfIterations = 200;
+    for (std::string const& model : {STORM_TEST_RESOURCES_DIR "/mdp/wlan0-2-4.nm", STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm",
+                                     STORM_TEST_RESOURCES_DIR "/mdp/firewire3-0.5.nm"}) {
+        auto mdp = buildMdp(model);
+        auto const& matrix = mdp->getTransitionMatrix();
+        std::cout << model << " (" << matrix.getRowGroupCount() << " states, " << matrix.getEntryCount() << " transitions, SIMD instruction set "
+                  << toString(storm::solver::SimdMultiplier<double>::detectInstructionSet()) << ")\n";
+        for (auto type : {storm::solver::MultiplierType::Native, storm::solver::MultiplierType::Gmmxx, storm::solver::MultiplierType::Simd}) {
+            storm::Environment env;
+            env.solver().multiplier().setType(type);
+            auto multiplier = storm::solver::MultiplierFactory<double>().create(env, matrix);
+            std::vector<double> x = getInputVector(matrix.getColumnCount());
+            auto start = std::chrono::high_resolution_clock::now();
+            multiplier->repeatedMultiplyAndReduce(env, storm::OptimizationDirection::Maximize, x, nullptr, numberOfIterations);
+            auto time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+            std::cout << "\t" << toString(type) << ": " << time << "ms for " << numberOfIterations << " iterations\n";
+        }
+    }
+}
@@ -67,3 +67,27 @@ TEST(BitVectorHashMapTest, FindOrAdd) {
     EXPECT_EQ(5ul, map.findOrAdd(fifth, 0));
     EXPECT_EQ(6ul, map.findOrAdd(sixth, 0));
 }
+
+TEST(BitVectorHashMapTest, WyhashHighLoad) {
+    storm::storage::BitVectorHashMap<uint64_t, storm::storage::WyhashBitVectorHash<uint64_t>> map(192, 1, 0.95);
+
+    // Many keys only differ in a few bits, which leads to collisions and long probe sequences.
+    for (uint64_t i = 0; i < 2000; ++i) {
+        storm::storage::BitVector key(192);
+        key.setFromInt(0, 64, i % 1000);
+        key.setFromInt(128, 64, (i % 1000) % 7);
+        map.findOrAdd(key, i);
+    }
+    EXPECT_EQ(1000ul, map.size());
+    EXPECT_GE(map.getAverageProbeLength(), 1.0);
+
+    for (uint64_t i = 0; i < 1000; ++i) {
+        storm::storage::BitVector key(192);
+        key.setFromInt(0, 64, i);
+        key.setFromInt(128, 64, i % 7);
+        EXPECT_EQ(i, map.getValue(key));
+    }
+    storm::storage::BitVector missing(192);
+    missing.setFromInt(0, 64, 1000);
+    EXPECT_FALSE(map.contains(missing));
+}
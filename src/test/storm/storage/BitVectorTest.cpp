@@ -653,3 +653,70 @@ TEST(BitVectorTest, Assignment) {
     v1.set(9999);
     ASSERT_TRUE(v1.get(9999));
 }
+
+TEST(BitVectorTest, InlineStorage) {
+    // Small bit vectors store their buckets inline, larger ones on the heap. Check that copying, moving and resizing works across this boundary.
+    storm::storage::BitVector small(100);
+    small.set(3);
+    small.set(99);
+    EXPECT_EQ(sizeof(storm::storage::BitVector), small.getSizeInBytes());
+
+    storm::storage::BitVector movedSmall(std::move(small));
+    EXPECT_TRUE(movedSmall.get(3));
+    EXPECT_TRUE(movedSmall.get(99));
+    EXPECT_EQ(0ull, small.size());
+
+    storm::storage::BitVector large(1000, true);
+    large = movedSmall;
+    EXPECT_EQ(100ull, large.size());
+    EXPECT_EQ(2ull, large.getNumberOfSetBits());
+
+    large.resize(1000, true);
+    EXPECT_TRUE(large.get(3));
+    EXPECT_FALSE(large.get(4));
+    EXPECT_TRUE(large.get(999));
+    EXPECT_EQ(900ull + 2ull, large.getNumberOfSetBits());
+
+    storm::storage::BitVector movedLarge(1);
+    movedLarge = std::move(large);
+    movedLarge.resize(64);
+    EXPECT_EQ(1ull, movedLarge.getNumberOfSetBits());
+    EXPECT_EQ(sizeof(storm::storage::BitVector), movedLarge.getSizeInBytes());
+
+    movedSmall = std::move(movedLarge);
+    EXPECT_EQ(64ull, movedSmall.size());
+    EXPECT_TRUE(movedSmall.get(3));
+}
+
+TEST(BitVectorTest, LargeOperationsAndRankIndex) {
+    // The vectors are large enough for the vectorized code paths (if available).
+    storm::storage::BitVector first(5003), second(5003);
+    for (uint_fast64_t i = 0; i < 5003; ++i) {
+        first.set(i, i % 3 == 0);
+        second.set(i, i % 5 != 0);
+    }
+
+    storm::storage::BitVector difference = first;
+    difference.andNot(second);
+    EXPECT_EQ(first & ~second, difference);
+    EXPECT_EQ(1668ull, first.getNumberOfSetBits());
+    EXPECT_EQ(334ull, difference.getNumberOfSetBits());
+    EXPECT_TRUE(difference.isSubsetOf(first));
+    EXPECT_FALSE(first.isSubsetOf(second));
+    EXPECT_TRUE(difference.isDisjointFrom(second));
+    EXPECT_FALSE(first.isDisjointFrom(second));
+
+    std::vector<uint_fast64_t> setBits;
+    difference.forEachSetBit([&setBits](uint_fast64_t index) { setBits.push_back(index); });
+    EXPECT_EQ(std::vector<uint_fast64_t>(difference.begin(), difference.end()), setBits);
+
+    storm::storage::BitVectorRankIndex rankIndex(first);
+    EXPECT_EQ(first.getNumberOfSetBits(), rankIndex.getNumberOfSetBits());
+    for (uint_fast64_t i = 0; i <= 5003; i += 7) {
+        EXPECT_EQ(first.getNumberOfSetBitsBeforeIndex(i), rankIndex.getNumberOfSetBitsBeforeIndex(i));
+    }
+    EXPECT_EQ(0ull, rankIndex.getIndexOfSetBit(0));
+    EXPECT_EQ(3000ull, rankIndex.getIndexOfSetBit(1000));
+    EXPECT_EQ(5001ull, rankIndex.getIndexOfSetBit(1667));
+    EXPECT_EQ(5003ull, rankIndex.getIndexOfSetBit(1668));
+}
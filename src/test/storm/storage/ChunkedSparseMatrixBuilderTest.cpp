@@ -0,0 +1,72 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <thread>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/storage/ChunkedSparseMatrixBuilder.h"
+#include "storm/storage/SparseMatrix.h"
+
+TEST(ChunkedSparseMatrixBuilderTest, SequentialRows) {
+    // Chunks of two entries force rows to be moved to a new chunk.
+    storm::storage::ChunkedSparseMatrixBuilder<double> chunkedBuilder(true, 2);
+    chunkedBuilder.newRowGroup(0);
+    chunkedBuilder.addNextValue(0, 1, 0.5);
+    chunkedBuilder.addNextValue(0, 0, 0.25);
+    chunkedBuilder.addNextValue(0, 2, 0.25);
+    chunkedBuilder.addNextValue(1, 2, 1.0);
+    chunkedBuilder.newRowGroup(2);
+    chunkedBuilder.addNextValue(2, 3, 0.5);
+    chunkedBuilder.addNextValue(2, 0, 0.5);
+    chunkedBuilder.addNextValue(2, 0, 0.25);
+    chunkedBuilder.newRowGroup(3);
+    chunkedBuilder.addNextValue(3, 1, 1.0);
+    EXPECT_EQ(3ull, chunkedBuilder.getCurrentRowGroupCount());
+    storm::storage::SparseMatrix<double> matrix = chunkedBuilder.build(0, 0, 4);
+
+    storm::storage::SparseMatrixBuilder<double> builder(4, 4, 7, true, true, 4);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.25);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.25);
+    builder.addNextValue(1, 2, 1.0);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 0, 0.75);
+    builder.addNextValue(2, 3, 0.5);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 1, 1.0);
+    EXPECT_EQ(builder.build(), matrix);
+
+    EXPECT_THROW(chunkedBuilder.addNextValue(2, 0, 1.0), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(ChunkedSparseMatrixBuilderTest, AppendedRows) {
+    storm::storage::ChunkedSparseMatrixBuilder<double> chunkedBuilder(false, 4);
+    chunkedBuilder.addNextValue(0, 0, 1.0);
+
+    // Rows 1 to 4 are written concurrently, row 5 is empty.
+    chunkedBuilder.appendRows(1, {2, 2, 2, 2, 0});
+    auto writeRows = [&chunkedBuilder](uint_fast64_t firstRow, uint_fast64_t endRow) {
+        storm::storage::ChunkedSparseMatrixBuilder<double>::RowWriter writer(chunkedBuilder);
+        for (uint_fast64_t row = firstRow; row < endRow; ++row) {
+            // The entries are given in descending order, which the writer needs to sort.
+            writer.addNextValue(row, row + 1, static_cast<double>(row));
+            writer.addNextValue(row, row, static_cast<double>(row));
+        }
+    };
+    std::thread thread(writeRows, 1, 3);
+    writeRows(3, 5);
+    thread.join();
+    chunkedBuilder.addNextValue(6, 6, 1.0);
+    EXPECT_EQ(7ull, chunkedBuilder.getCurrentRowCount());
+    storm::storage::SparseMatrix<double> matrix = chunkedBuilder.build();
+
+    storm::storage::SparseMatrixBuilder<double> builder(7, 7, 10);
+    builder.addNextValue(0, 0, 1.0);
+    for (uint_fast64_t row = 1; row < 5; ++row) {
+        builder.addNextValue(row, row, static_cast<double>(row));
+        builder.addNextValue(row, row + 1, static_cast<double>(row));
+    }
+    builder.addNextValue(6, 6, 1.0);
+    EXPECT_EQ(builder.build(), matrix);
+}
@@ -0,0 +1,47 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/CompressedBitVector.h"
+
+TEST(CompressedBitVectorTest, ConversionAndOperations) {
+    // Three chunks: a sparse one, one with a long run and a (shorter) dense one.
+    uint64_t const size = 2 * 65536 + 1000;
+    storm::storage::BitVector sparse(size), runs(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        sparse.set(i, i % 10007 == 0 || (i >= 2 * 65536 && i % 2 == 0));
+        runs.set(i, i >= 60000 && i < 70000);
+    }
+
+    storm::storage::CompressedBitVector compressedSparse(sparse), compressedRuns(runs);
+    EXPECT_EQ(size, compressedSparse.size());
+    EXPECT_EQ(sparse, compressedSparse.toBitVector());
+    EXPECT_EQ(runs, compressedRuns.toBitVector());
+    EXPECT_EQ(sparse.getNumberOfSetBits(), compressedSparse.getNumberOfSetBits());
+    EXPECT_TRUE(compressedRuns.get(65536));
+    EXPECT_FALSE(compressedRuns.get(70000));
+    EXPECT_LT(compressedRuns.getSizeInBytes(), runs.getSizeInBytes() / 10);
+
+    EXPECT_EQ(sparse & runs, (compressedSparse & compressedRuns).toBitVector());
+    EXPECT_EQ(sparse | runs, (compressedSparse | compressedRuns).toBitVector());
+    EXPECT_EQ(~runs, (~compressedRuns).toBitVector());
+    EXPECT_TRUE((compressedRuns | ~compressedRuns).full());
+    EXPECT_TRUE((compressedRuns & ~compressedRuns).empty());
+
+    std::vector<uint64_t> setBits;
+    compressedSparse.forEachSetBit([&setBits](uint64_t index) { setBits.push_back(index); });
+    EXPECT_EQ(std::vector<uint64_t>(sparse.begin(), sparse.end()), setBits);
+
+    // The representation is unique, so modified vectors are equal to the compression of the modified dense vector.
+    compressedRuns.set(5);
+    compressedRuns.set(60000, false);
+    runs.set(5);
+    runs.set(60000, false);
+    EXPECT_EQ(storm::storage::CompressedBitVector(runs), compressedRuns);
+    EXPECT_NE(compressedSparse, compressedRuns);
+    EXPECT_NE(compressedSparse < compressedRuns, compressedRuns < compressedSparse);
+
+    EXPECT_TRUE(storm::storage::CompressedBitVector(size, true).full());
+    EXPECT_EQ(storm::storage::BitVector(size, true), storm::storage::CompressedBitVector(size, true).toBitVector());
+    EXPECT_TRUE(storm::storage::CompressedBitVector(size).empty());
+}
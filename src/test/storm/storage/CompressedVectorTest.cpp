@@ -0,0 +1,66 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/CompressedVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+TEST(CompressedVectorTest, Compression) {
+    std::vector<double> constant(100, 2.0);
+    constant[17] = 3.0;
+    auto compressedConstant = storm::storage::CompressedVector<double>::compress(constant);
+    ASSERT_TRUE(compressedConstant.has_value());
+    EXPECT_EQ(2.0, compressedConstant->getDefaultValue());
+    EXPECT_EQ(std::vector<uint64_t>({17}), compressedConstant->getIndices());
+    EXPECT_EQ(3.0, (*compressedConstant)[17]);
+    EXPECT_EQ(2.0, (*compressedConstant)[18]);
+    EXPECT_EQ(constant, compressedConstant->toVector());
+
+    std::vector<double> sparse(100, 0.0);
+    sparse[0] = 1.0;
+    sparse[99] = 4.0;
+    auto compressedSparse = storm::storage::CompressedVector<double>::compress(sparse);
+    ASSERT_TRUE(compressedSparse.has_value());
+    EXPECT_EQ(0.0, compressedSparse->getDefaultValue());
+    std::vector<double> sum = constant;
+    compressedSparse->addTo(sum);
+    EXPECT_EQ(3.0, sum[0]);
+    EXPECT_EQ(6.0, sum[99]);
+    EXPECT_EQ(2.0, sum[50]);
+
+    std::vector<double> dense(100);
+    for (uint64_t i = 0; i < dense.size(); ++i) {
+        dense[i] = i % 3;
+    }
+    EXPECT_FALSE(storm::storage::CompressedVector<double>::compress(dense).has_value());
+}
+
+TEST(CompressedVectorTest, CompressedRewardModel) {
+    // Two states with two and one choice, respectively.
+    storm::storage::SparseMatrixBuilder<double> builder(3, 2, 3, true, true, 2);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 1.0);
+    builder.addNextValue(1, 1, 1.0);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 1, 1.0);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+
+    storm::models::sparse::StandardRewardModel<double> dense(std::vector<double>({0.0, 5.0}), std::vector<double>(3, 1.0));
+    storm::models::sparse::StandardRewardModel<double> compressed(dense);
+    compressed.compress();
+    EXPECT_TRUE(compressed.isCompressed());
+    EXPECT_EQ(1.0, compressed.getStateActionReward(1));
+    EXPECT_EQ(5.0, compressed.getStateReward(1));
+    EXPECT_EQ(dense.getTotalRewardVector(matrix), compressed.getTotalRewardVector(matrix));
+    EXPECT_EQ(dense.getChoicesWithZeroReward(matrix), compressed.getChoicesWithZeroReward(matrix));
+
+    auto shared = compressed.getSharedTotalRewardVector(matrix);
+    EXPECT_EQ(shared, compressed.getSharedTotalRewardVector(matrix));
+    EXPECT_EQ(dense.getTotalRewardVector(matrix), *shared);
+
+    // Modifying the rewards expands them and discards the shared vector.
+    compressed.setStateActionReward(2, 2.0);
+    EXPECT_FALSE(compressed.isCompressed());
+    EXPECT_EQ(std::vector<double>({1.0, 1.0, 7.0}), *compressed.getSharedTotalRewardVector(matrix));
+    EXPECT_EQ(std::vector<double>({1.0, 1.0, 6.0}), *shared);
+}
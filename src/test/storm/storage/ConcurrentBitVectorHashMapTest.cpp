@@ -0,0 +1,139 @@
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+#include "storm/utility/parallel.h"
+
+namespace {
+storm::storage::BitVector makeKey(uint64_t bucketSize, uint64_t i) {
+    storm::storage::BitVector key(bucketSize);
+    key.setFromInt(0, 64, i * 2654435761ull);
+    if (bucketSize > 64) {
+        key.setFromInt(64, 64, i);
+    }
+    return key;
+}
+}  // namespace
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(64, 3, 0.75, 2);
+
+    storm::storage::BitVector first(64);
+    first.set(4);
+    first.set(47);
+    ASSERT_NO_THROW(map.findOrAdd(first, 1));
+
+    storm::storage::BitVector second(64);
+    second.set(8);
+    second.set(18);
+    ASSERT_NO_THROW(map.findOrAdd(second, 2));
+
+    EXPECT_EQ(1ul, map.findOrAdd(first, 3));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 3));
+
+    storm::storage::BitVector third(64);
+    third.set(10);
+    third.set(63);
+    auto valueBucketPair = map.findOrAddAndGetBucket(third, 3);
+    EXPECT_EQ(3ul, valueBucketPair.first);
+    EXPECT_EQ(third, map.getBucketAndValue(valueBucketPair.second).first);
+    EXPECT_EQ(3ul, map.getBucketAndValue(valueBucketPair.second).second);
+
+    // Insert sufficiently many keys to trigger resizes.
+    for (uint64_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(i + 10, map.findOrAdd(makeKey(64, i), i + 10));
+    }
+    EXPECT_EQ(1003ul, map.size());
+    EXPECT_EQ(1ul, map.findOrAdd(first, 2));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 1));
+    EXPECT_EQ(3ul, map.findOrAdd(third, 1));
+    for (uint64_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(i + 10, map.getValue(makeKey(64, i)));
+    }
+
+    storm::storage::BitVector fourth(64);
+    fourth.set(12);
+    fourth.set(14);
+    EXPECT_FALSE(map.contains(fourth));
+    EXPECT_FALSE(map.find(fourth).has_value());
+    EXPECT_TRUE(map.contains(first));
+    EXPECT_EQ(1ul, map.find(first).value());
+
+    uint64_t numberOfElements = 0;
+    map.forEach([&numberOfElements](storm::storage::BitVector const&, uint64_t const&) { ++numberOfElements; });
+    EXPECT_EQ(map.size(), numberOfElements);
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentFindOrAdd) {
+    uint64_t const numberOfKeys = 19997;  // prime, so every thread visits all keys
+    uint64_t const numberOfThreads = 8;
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 10);
+    std::atomic<uint32_t> nextId(0);
+
+    // All threads insert all keys (in different orders) and every key is assigned the next free id exactly once.
+    std::vector<std::vector<uint32_t>> idsPerThread(numberOfThreads, std::vector<uint32_t>(numberOfKeys));
+    storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), numberOfThreads, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t thread = begin; thread < end; ++thread) {
+            for (uint64_t i = 0; i < numberOfKeys; ++i) {
+                uint64_t key = (i * (2 * thread + 1)) % numberOfKeys;
+                idsPerThread[thread][key] = map.findOrAddWithGenerator(makeKey(128, key), [&nextId]() { return nextId++; }).first;
+            }
+        }
+    });
+
+    EXPECT_EQ(numberOfKeys, map.size());
+    EXPECT_EQ(numberOfKeys, nextId.load());
+    storm::storage::BitVector seenIds(numberOfKeys);
+    for (uint64_t key = 0; key < numberOfKeys; ++key) {
+        uint32_t id = idsPerThread[0][key];
+        ASSERT_LT(id, numberOfKeys);
+        EXPECT_FALSE(seenIds.get(id));
+        seenIds.set(id);
+        for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+            EXPECT_EQ(id, idsPerThread[thread][key]);
+        }
+        EXPECT_EQ(id, map.getValue(makeKey(128, key)));
+    }
+}
+
+// A microbenchmark comparing the concurrent map with the sequential one. Run it via --gtest_also_run_disabled_tests.
+TEST(ConcurrentBitVectorHashMapTest, DISABLED_Benchmark) {
+    uint64_t const numberOfKeys = 4000000;
+    uint64_t const operationsPerKey = 4;
+    auto measure = [](auto const& function) {
+        auto start = std::chrono::high_resolution_clock::now();
+        function();
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    };
+
+    {
+        storm::storage::BitVectorHashMap<uint32_t> map(64);
+        auto time = measure([&]() {
+            for (uint64_t operation = 0; operation < numberOfKeys * operationsPerKey; ++operation) {
+                map.findOrAdd(makeKey(64, operation % numberOfKeys), static_cast<uint32_t>(map.size()));
+            }
+        });
+        std::cout << "BitVectorHashMap (sequential): " << time << "ms\n";
+    }
+
+    for (uint64_t numberOfThreads : {1ull, 8ull, 32ull, 64ull}) {
+        storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(64);
+        std::atomic<uint32_t> nextId(0);
+        auto time = measure([&]() {
+            storm::utility::parallel::forEachChunk(numberOfThreads, static_cast<uint64_t>(0), numberOfKeys * operationsPerKey,
+                                                   [&](uint64_t, uint64_t begin, uint64_t end) {
+                                                       for (uint64_t operation = begin; operation < end; ++operation) {
+                                                           map.findOrAddWithGenerator(makeKey(64, operation % numberOfKeys), [&nextId]() { return nextId++; });
+                                                       }
+                                                   });
+        });
+        EXPECT_EQ(numberOfKeys, map.size());
+        std::cout << "ConcurrentBitVectorHashMap (" << numberOfThreads << " threads): " << time << "ms\n";
+    }
+}
@@ -2,6 +2,7 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/BlockedMatrix.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/dd/Odd.h"
@@ -58,6 +59,22 @@ TEST(CuddDd, BddConstants) {
     EXPECT_EQ(1ul, one.getNodeCount());
 }
 
+TEST(CuddDd, Statistics) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd = manager->template getIdentity<double>(x.first);
+
+    storm::dd::DdManagerStatistics statistics = manager->getStatistics();
+    EXPECT_LE(dd.getNodeCount(), statistics.nodeCount);
+    ASSERT_TRUE(statistics.peakNodeCount.has_value());
+    EXPECT_LE(statistics.nodeCount, statistics.peakNodeCount.value());
+    EXPECT_LT(0ul, statistics.uniqueTableSize);
+    EXPECT_LT(0ul, statistics.cacheSize);
+    ASSERT_TRUE(statistics.cacheLookups.has_value());
+    ASSERT_TRUE(statistics.cacheHits.has_value());
+    EXPECT_LE(statistics.cacheHits.value(), statistics.cacheLookups.value());
+}
+
 TEST(CuddDd, BddExistAbstractRepresentative) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
 
@@ -701,6 +718,47 @@ TEST(CuddDd, AddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(CuddDd, BlockedMatrixTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd =
+        manager->template getIdentity<double>(x.first).equals(manager->template getIdentity<double>(x.second)).template toAdd<double>() *
+        manager->getRange(x.first).template toAdd<double>();
+    dd += manager->getEncoding(x.first, 1).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>() +
+          manager->getEncoding(x.second, 1).template toAdd<double>() * manager->getRange(x.first).template toAdd<double>();
+    storm::dd::Add<storm::dd::DdType::CUDD, double> offsets =
+        manager->template getIdentity<double>(x.first) * manager->getRange(x.first).template toAdd<double>();
+    storm::dd::Odd odd = manager->getRange(x.first).template toAdd<double>().createOdd();
+
+    std::vector<double> input = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<double> expected(9), result(9);
+    storm::storage::SparseMatrix<double> matrix = dd.toMatrix({x.first}, {x.second}, odd, odd);
+    std::vector<double> b = offsets.toVector(odd);
+    matrix.multiplyWithVector(input, expected, &b);
+
+    storm::dd::BlockedMatrix<storm::dd::DdType::CUDD, double> blockedMatrix(dd, {x.first}, {}, odd, odd, 4, offsets);
+    EXPECT_EQ(3ul, blockedMatrix.getNumberOfBlocks());
+    blockedMatrix.multiply(input, result);
+    for (uint64_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(expected[i], result[i]);
+    }
+
+    // Now with a non-trivial row grouping.
+    dd = manager->getRange(x.first).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>() *
+         manager->getEncoding(a.first, 0).ite(dd, dd + manager->template getConstant<double>(1));
+    matrix = dd.toMatrix({a.first}, odd, odd);
+    matrix.multiplyAndReduce(storm::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), input, nullptr, expected, nullptr);
+
+    storm::dd::BlockedMatrix<storm::dd::DdType::CUDD, double> blockedGroupedMatrix(dd, {x.first}, {a.first}, odd, odd, 2);
+    EXPECT_EQ(5ul, blockedGroupedMatrix.getNumberOfBlocks());
+    blockedGroupedMatrix.multiply(input, result, storm::OptimizationDirection::Maximize);
+    for (uint64_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(expected[i], result[i]);
+    }
+}
+
 TEST(CuddDd, BddOddTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
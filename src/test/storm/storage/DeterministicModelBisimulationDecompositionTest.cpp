@@ -1,6 +1,9 @@
 #include "storm-config.h"
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm-parsers/parser/FormulaParser.h"
+#include "storm/api/bisimulation.h"
+#include "storm/builder/ParallelCompositionBuilder.h"
+#include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
@@ -126,3 +129,65 @@ TEST(DeterministicModelBisimulationDecomposition, Crowds) {
     EXPECT_EQ(65ul, result->getNumberOfStates());
     EXPECT_EQ(105ul, result->getNumberOfTransitions());
 }
+
+TEST(DeterministicModelBisimulationDecomposition, CrowdsSignatureBasedRefinement) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>>::Options options;
+    options.signatureBasedRefinement = true;
+
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim(*dtmc, options);
+    std::shared_ptr<storm::models::sparse::Model<double>> result;
+    ASSERT_NO_THROW(bisim.computeBisimulationDecomposition());
+    ASSERT_NO_THROW(result = bisim.getQuotient());
+
+    EXPECT_EQ(storm::models::ModelType::Dtmc, result->getType());
+    EXPECT_EQ(334ul, result->getNumberOfStates());
+    EXPECT_EQ(546ul, result->getNumberOfTransitions());
+
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+
+    typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>>::Options options2(*dtmc, *formula);
+    options2.signatureBasedRefinement = true;
+
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim2(*dtmc, options2);
+    ASSERT_NO_THROW(bisim2.computeBisimulationDecomposition());
+    ASSERT_NO_THROW(result = bisim2.getQuotient());
+
+    EXPECT_EQ(storm::models::ModelType::Dtmc, result->getType());
+    EXPECT_EQ(64ul, result->getNumberOfStates());
+    EXPECT_EQ(104ul, result->getNumberOfTransitions());
+}
+
+TEST(DeterministicModelBisimulationDecomposition, CompositionalCtmc) {
+    // A CTMC that reaches the "done" state via one of two symmetric intermediate states.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(4, 4);
+    matrixBuilder.addNextValue(0, 1, 1.0);
+    matrixBuilder.addNextValue(0, 2, 1.0);
+    matrixBuilder.addNextValue(1, 3, 2.0);
+    matrixBuilder.addNextValue(2, 3, 2.0);
+    storm::models::sparse::StateLabeling labeling(4);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    labeling.addLabel("done");
+    labeling.addLabelToState("done", 3);
+    auto ctmc = std::make_shared<storm::models::sparse::Ctmc<double>>(matrixBuilder.build(), labeling);
+
+    std::shared_ptr<storm::models::sparse::Ctmc<double>> result;
+    ASSERT_NO_THROW(result = storm::api::performCompositionalBisimulationMinimization<double>({ctmc, ctmc}, {}, false));
+    EXPECT_EQ(6ul, result->getNumberOfStates());
+    EXPECT_EQ(1ul, result->getInitialStates().getNumberOfSetBits());
+
+    // Minimizing the full composition yields a quotient of the same size.
+    auto composition = storm::builder::ParallelCompositionBuilder<double>::compose(ctmc, ctmc, false);
+    EXPECT_EQ(16ul, composition->getNumberOfStates());
+    auto monolithicResult = storm::api::performDeterministicSparseBisimulationMinimization<storm::models::sparse::Ctmc<double>>(
+        composition, {}, storm::storage::BisimulationType::Strong);
+    EXPECT_EQ(result->getNumberOfStates(), monolithicResult->getNumberOfStates());
+    EXPECT_EQ(result->getNumberOfTransitions(), monolithicResult->getNumberOfTransitions());
+}
@@ -0,0 +1,65 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <map>
+
+#include "storm/storage/DiskBackedStateMap.h"
+
+namespace {
+
+storm::storage::BitVector createState(uint64_t bitsPerState, uint64_t value) {
+    storm::storage::BitVector state(bitsPerState);
+    state.setFromInt(0, 64, value * 2654435761ull);
+    state.setFromInt(bitsPerState - 64, 64, value);
+    return state;
+}
+
+}  // namespace
+
+TEST(DiskBackedStateMapTest, InsertAndFind) {
+    uint64_t const bitsPerState = 128;
+    storm::storage::DiskBackedStateMap<uint32_t> map(bitsPerState, 100);
+    std::map<uint64_t, uint32_t> expectedIds;
+    for (uint64_t step = 0; step < 3000; ++step) {
+        uint64_t const value = (step * 7919) % 1000;
+        auto state = createState(bitsPerState, value);
+        auto id = map.find(state);
+        if (expectedIds.count(value) > 0) {
+            ASSERT_TRUE(id.has_value());
+            EXPECT_EQ(expectedIds.at(value), id.value());
+        } else {
+            EXPECT_FALSE(id.has_value());
+            uint32_t const newId = static_cast<uint32_t>(expectedIds.size());
+            map.insert(state, newId);
+            expectedIds.emplace(value, newId);
+        }
+    }
+    EXPECT_EQ(1000ull, map.size());
+    EXPECT_EQ(10ull, map.getNumberOfRuns());
+    EXPECT_EQ(0ull, map.getNumberOfStatesInMemory());
+
+    // Look up contained and absent states at once.
+    std::vector<storm::storage::BitVector> states;
+    for (uint64_t value = 500; value < 1500; ++value) {
+        states.push_back(createState(bitsPerState, value));
+    }
+    auto ids = map.findOnDisk(states);
+    for (uint64_t value = 500; value < 1500; ++value) {
+        if (value < 1000) {
+            ASSERT_TRUE(ids[value - 500].has_value());
+            EXPECT_EQ(expectedIds.at(value), ids[value - 500].value());
+        } else {
+            EXPECT_FALSE(ids[value - 500].has_value());
+        }
+    }
+
+    uint64_t numberOfVisitedStates = 0;
+    map.forEachChunk([&](std::vector<std::pair<storm::storage::BitVector, uint32_t>> const& chunk) {
+        EXPECT_LE(chunk.size(), 100ull);
+        for (auto const& [state, id] : chunk) {
+            EXPECT_EQ(expectedIds.at(state.getAsInt(bitsPerState - 64, 64)), id);
+            ++numberOfVisitedStates;
+        }
+    });
+    EXPECT_EQ(1000ull, numberOfVisitedStates);
+}
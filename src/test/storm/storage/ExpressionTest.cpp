@@ -343,6 +343,38 @@ TEST(Expression, SimplificationTest) {
     EXPECT_TRUE(simplifiedExpression.isFalse());
 }
 
+TEST(Expression, UniqueExpressionTest) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+    storm::expressions::Variable b = manager->declareBooleanVariable("b");
+
+    // Build the same expression twice from separately allocated nodes.
+    storm::expressions::Expression first = storm::expressions::ite(b.getExpression(), x.getExpression() + manager->integer(1), manager->integer(0)) > 2;
+    storm::expressions::Expression second = storm::expressions::ite(b.getExpression(), x.getExpression() + manager->integer(1), manager->integer(0)) > 2;
+    EXPECT_FALSE(first.areSame(second));
+    EXPECT_TRUE(first.isSyntacticallyEqual(second));
+
+    storm::expressions::Expression uniqueFirst = manager->getUniqueExpression(first);
+    storm::expressions::Expression uniqueSecond = manager->getUniqueExpression(second);
+    EXPECT_TRUE(uniqueFirst.areSame(uniqueSecond));
+    EXPECT_TRUE(uniqueFirst.isSyntacticallyEqual(first));
+    uint64_t numberOfNodes = manager->getNumberOfUniqueExpressionNodes();
+    EXPECT_EQ(8ull, numberOfNodes);
+
+    // Common subexpressions are shared.
+    storm::expressions::Expression sum = manager->getUniqueExpression(x.getExpression() + manager->integer(1));
+    EXPECT_TRUE(uniqueFirst.getOperand(0).getOperand(1).areSame(sum));
+    EXPECT_EQ(numberOfNodes, manager->getNumberOfUniqueExpressionNodes());
+    EXPECT_FALSE(manager->getUniqueExpression(x.getExpression() + manager->integer(2)).areSame(sum));
+
+    storm::expressions::Expression simplified = manager->getSimplifiedUniqueExpression(b.getExpression() && manager->boolean(true));
+    EXPECT_TRUE(simplified.areSame(manager->getUniqueExpression(b.getExpression())));
+    EXPECT_TRUE(simplified.areSame(manager->getSimplifiedUniqueExpression(b.getExpression() && manager->boolean(true))));
+
+    manager->clearUniqueExpressions();
+    EXPECT_EQ(0ull, manager->getNumberOfUniqueExpressionNodes());
+}
+
 TEST(Expression, SimpleEvaluationTest) {
     std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
 
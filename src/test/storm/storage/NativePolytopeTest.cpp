@@ -0,0 +1,68 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/geometry/Polytope.h"
+#include "storm/utility/constants.h"
+
+#ifdef STORM_HAVE_CARL
+
+namespace {
+
+typedef storm::RationalNumber ValueType;
+typedef storm::storage::geometry::Polytope<ValueType>::Point Point;
+
+std::vector<Point> sortedVertices(std::shared_ptr<storm::storage::geometry::Polytope<ValueType>> const& polytope) {
+    std::vector<Point> vertices = polytope->getVertices();
+    std::sort(vertices.begin(), vertices.end());
+    return vertices;
+}
+
+// Returns the vertices of a polytope with the same halfspaces but without any stored information.
+std::vector<Point> sortedVerticesFromHalfspaces(std::shared_ptr<storm::storage::geometry::Polytope<ValueType>> const& polytope) {
+    return sortedVertices(storm::storage::geometry::Polytope<ValueType>::create(polytope->getHalfspaces()));
+}
+
+ValueType number(int64_t numerator, int64_t denominator = 1) {
+    return storm::utility::convertNumber<ValueType>(numerator) / storm::utility::convertNumber<ValueType>(denominator);
+}
+
+}  // namespace
+
+TEST(NativePolytopeTest, IncrementalIntersection) {
+    std::vector<Point> points = {{number(1), number(0), number(0)}, {number(0), number(1), number(0)}, {number(0), number(0), number(1)}};
+    auto polytope = storm::storage::geometry::Polytope<ValueType>::createDownwardClosure(points);
+    EXPECT_EQ(sortedVerticesFromHalfspaces(polytope), sortedVertices(polytope));
+
+    std::vector<storm::storage::geometry::Halfspace<ValueType>> halfspaces;
+    halfspaces.emplace_back(Point({number(-1), number(0), number(0)}), number(0));
+    halfspaces.emplace_back(Point({number(0), number(-1), number(0)}), number(0));
+    halfspaces.emplace_back(Point({number(1), number(1), number(0)}), number(1, 2));
+    halfspaces.emplace_back(Point({number(0), number(0), number(-1)}), number(0));
+    halfspaces.emplace_back(Point({number(1), number(-1), number(1)}), number(1, 3));
+    for (auto const& halfspace : halfspaces) {
+        polytope = polytope->intersection(halfspace);
+        EXPECT_EQ(sortedVerticesFromHalfspaces(polytope), sortedVertices(polytope));
+        EXPECT_FALSE(polytope->isEmpty());
+    }
+
+    auto emptyPolytope = polytope->intersection(storm::storage::geometry::Halfspace<ValueType>(Point({number(1), number(1), number(1)}), number(-1)));
+    EXPECT_TRUE(emptyPolytope->getVertices().empty());
+    EXPECT_TRUE(emptyPolytope->isEmpty());
+}
+
+TEST(NativePolytopeTest, ConvexUnion) {
+    std::vector<Point> lhsPoints = {{number(0), number(0)}, {number(2), number(0)}, {number(1), number(1)}};
+    std::vector<Point> rhsPoints = {{number(1), number(1, 2)}, {number(1), number(3)}};
+    auto lhs = storm::storage::geometry::Polytope<ValueType>::create(lhsPoints);
+    auto rhs = storm::storage::geometry::Polytope<ValueType>::create(rhsPoints);
+    auto result = lhs->convexUnion(rhs);
+    std::vector<Point> expected = {{number(0), number(0)}, {number(1), number(3)}, {number(2), number(0)}};
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(expected, sortedVertices(result));
+    EXPECT_EQ(expected, sortedVerticesFromHalfspaces(result));
+}
+
+#endif
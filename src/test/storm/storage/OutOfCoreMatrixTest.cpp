@@ -0,0 +1,92 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+
+#include "storm/solver/helper/OutOfCoreValueIterationHelper.h"
+#include "storm/storage/OutOfCoreMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+std::string getTemporaryFilename(std::string const& name) {
+    return (std::filesystem::temp_directory_path() / ("storm-out-of-core-test-" + name + ".bin")).string();
+}
+
+}  // namespace
+
+TEST(OutOfCoreMatrixTest, WriteAndRead) {
+    std::string filename = getTemporaryFilename("write-and-read");
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true, 0);
+    {
+        storm::storage::OutOfCoreMatrixWriter writer(filename, true, storm::models::ModelType::Mdp, 2);
+        for (uint64_t group = 0; group < 20; ++group) {
+            builder.newRowGroup(2 * group);
+            writer.newRowGroup(2 * group);
+            for (uint64_t row = 2 * group; row < 2 * group + 2; ++row) {
+                for (uint64_t column = row % 3; column < 20; column += 7) {
+                    builder.addNextValue(row, column, 0.1 * (row + column));
+                    writer.addNextValue(row, column, 0.1 * (row + column));
+                }
+            }
+        }
+        storm::storage::OutOfCoreMatrix matrix = writer.build(0, 20);
+        storm::storage::SparseMatrix<double> expected = builder.build(0, 20);
+        EXPECT_EQ(expected.getRowCount(), matrix.getRowCount());
+        EXPECT_EQ(expected.getEntryCount(), matrix.getEntryCount());
+        EXPECT_EQ(20ull, matrix.getRowGroupCount());
+        EXPECT_EQ(expected, matrix.toSparseMatrix());
+
+        // Process the matrix in blocks of (at most) three entries and check that every entry is visited exactly once.
+        uint64_t nextRowGroup = 0;
+        uint64_t visitedEntries = 0;
+        matrix.forEachBlock(3 * sizeof(storm::storage::OutOfCoreMatrix::Entry),
+                            [&](uint64_t firstRowGroup, uint64_t endRowGroup, storm::storage::OutOfCoreMatrix::Entry const* entries) {
+                                EXPECT_EQ(nextRowGroup, firstRowGroup);
+                                EXPECT_LT(firstRowGroup, endRowGroup);
+                                uint64_t const firstEntry = matrix.getRowIndications()[matrix.getRowGroupStart(firstRowGroup)];
+                                for (uint64_t row = matrix.getRowGroupStart(firstRowGroup); row < matrix.getRowGroupStart(endRowGroup); ++row) {
+                                    auto expectedEntry = expected.begin(row);
+                                    for (uint64_t entry = matrix.getRowIndications()[row]; entry < matrix.getRowIndications()[row + 1]; ++entry) {
+                                        EXPECT_EQ(expectedEntry->getColumn(), entries[entry - firstEntry].getColumn());
+                                        EXPECT_EQ(expectedEntry->getValue(), entries[entry - firstEntry].getValue());
+                                        ++expectedEntry;
+                                        ++visitedEntries;
+                                    }
+                                }
+                                nextRowGroup = endRowGroup;
+                            });
+        EXPECT_EQ(20ull, nextRowGroup);
+        EXPECT_EQ(matrix.getEntryCount(), visitedEntries);
+    }
+    std::filesystem::remove(filename);
+}
+
+TEST(OutOfCoreMatrixTest, BlockGaussSeidel) {
+    std::string filename = getTemporaryFilename("block-gauss-seidel");
+    {
+        // A random walk on 0..100 that moves up with probability 0.5 and stays otherwise. The expected number of steps to reach state 100 is
+        // 2 * (100 - state).
+        uint64_t const numberOfStates = 101;
+        storm::storage::OutOfCoreMatrixWriter writer(filename, false, storm::models::ModelType::Dtmc, 16);
+        for (uint64_t state = 0; state + 1 < numberOfStates; ++state) {
+            writer.addNextValue(state, state, 0.5);
+            writer.addNextValue(state, state + 1, 0.5);
+        }
+        // State 100 is the target and has no outgoing transitions in the equation system.
+        storm::storage::OutOfCoreMatrix matrix = writer.build(numberOfStates, numberOfStates);
+        EXPECT_EQ(numberOfStates, matrix.getRowCount());
+
+        std::vector<double> offsets(numberOfStates, 1.0);
+        offsets.back() = 0.0;
+        std::vector<double> values(numberOfStates, 0.0);
+        uint64_t numberOfPasses = 0;
+        storm::solver::helper::OutOfCoreValueIterationHelper helper(matrix, 10 * sizeof(storm::storage::OutOfCoreMatrix::Entry), 100);
+        auto status = helper.VI(values, offsets, numberOfPasses, false, 1e-9);
+        EXPECT_EQ(storm::solver::SolverStatus::Converged, status);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            EXPECT_NEAR(2.0 * (numberOfStates - 1 - state), values[state], 1e-4) << "in state " << state;
+        }
+    }
+    std::filesystem::remove(filename);
+}
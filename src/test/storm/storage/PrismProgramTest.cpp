@@ -185,4 +185,40 @@ TEST(PrismProgramTest, ReplaceConstantByVariable) {
                         origPrismProgram.getConstant("CrowdSize"), origPrismProgram.getManager().integer(0), origPrismProgram.getManager().integer(20), true));
     EXPECT_NO_THROW(transformedPrismProgram.getGlobalIntegerVariable("CrowdSize"));
     EXPECT_FALSE(transformedPrismProgram.hasConstant("CrowdSize"));
-}
\ No newline at end of file
+}
+TEST(PrismProgramTest, Slice) {
+    std::string const input = R"(dtmc
+module main
+    s : [0..2] init 0;
+    log : [0..10] init 0;
+    debug : bool init false;
+    [] s=0 -> 0.5:(s'=1)&(log'=min(log+1,10)) + 0.5:(s'=2)&(log'=min(log+1,10));
+    [] s>0 & !debug -> (s'=s);
+    [] debug -> (log'=0);
+endmodule
+label "goal" = s=2;
+label "logged" = log>5;
+rewards "steps" true : 1; endrewards
+rewards "logs" log>0 : 1; endrewards
+)";
+    storm::prism::Program program;
+    ASSERT_NO_THROW(program = storm::parser::PrismParser::parseFromString(input, "testfile"));
+
+    // The log and debug variables can not influence the label and the reward model.
+    storm::prism::Program sliced = program.slice({}, {"goal"}, {"steps"});
+    storm::prism::Module const& module = sliced.getModule("main");
+    EXPECT_EQ(0ull, module.getNumberOfBooleanVariables());
+    ASSERT_EQ(1ull, module.getNumberOfIntegerVariables());
+    EXPECT_EQ("s", module.getIntegerVariables().front().getName());
+    // The command that can never be executed is removed.
+    EXPECT_EQ(2ull, module.getNumberOfCommands());
+    EXPECT_TRUE(sliced.hasLabel("goal"));
+    EXPECT_FALSE(sliced.hasLabel("logged"));
+    EXPECT_TRUE(sliced.hasRewardModel("steps"));
+    EXPECT_FALSE(sliced.hasRewardModel("logs"));
+
+    // Variables that influence the kept label are kept.
+    sliced = program.slice({}, {"logged"}, {});
+    EXPECT_EQ(2ull, sliced.getModule("main").getNumberOfIntegerVariables());
+    EXPECT_EQ(0ull, sliced.getNumberOfRewardModels());
+}
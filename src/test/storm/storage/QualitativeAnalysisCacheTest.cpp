@@ -0,0 +1,54 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+#include <utility>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/QualitativeAnalysisCache.h"
+
+TEST(QualitativeAnalysisCacheTest, GetOrCompute) {
+    storm::storage::QualitativeAnalysisCache cache(2);
+    typedef storm::storage::QualitativeAnalysisCache::AnalysisType AnalysisType;
+
+    uint64_t numberOfComputations = 0;
+    auto compute = [&numberOfComputations]() {
+        ++numberOfComputations;
+        storm::storage::BitVector prob0(4, false), prob1(4, false);
+        prob0.set(0);
+        prob1.set(3);
+        return std::make_pair(prob0, prob1);
+    };
+
+    storm::storage::BitVector allStates(4, true);
+    storm::storage::BitVector firstTarget(4, false), secondTarget(4, false), thirdTarget(4, false);
+    firstTarget.set(3);
+    secondTarget.set(2);
+    thirdTarget.set(1);
+
+    auto result = cache.getOrCompute(AnalysisType::Prob01, allStates, firstTarget, compute);
+    EXPECT_EQ(1ull, numberOfComputations);
+    EXPECT_TRUE(result.first.get(0));
+    EXPECT_TRUE(result.second.get(3));
+
+    // The same analysis is taken from the cache, other analyses or targets are computed.
+    auto cachedResult = cache.getOrCompute(AnalysisType::Prob01, allStates, firstTarget, compute);
+    EXPECT_EQ(1ull, numberOfComputations);
+    EXPECT_TRUE(result == cachedResult);
+    cache.getOrCompute(AnalysisType::Prob01Max, allStates, firstTarget, compute);
+    EXPECT_EQ(2ull, numberOfComputations);
+    EXPECT_EQ(2ull, cache.getNumberOfEntries());
+
+    // The oldest entry is discarded first.
+    cache.getOrCompute(AnalysisType::Prob01, allStates, secondTarget, compute);
+    EXPECT_EQ(3ull, numberOfComputations);
+    EXPECT_EQ(2ull, cache.getNumberOfEntries());
+    cache.getOrCompute(AnalysisType::Prob01Max, allStates, firstTarget, compute);
+    EXPECT_EQ(3ull, numberOfComputations);
+    cache.getOrCompute(AnalysisType::Prob01, allStates, firstTarget, compute);
+    EXPECT_EQ(4ull, numberOfComputations);
+
+    cache.clear();
+    EXPECT_EQ(0ull, cache.getNumberOfEntries());
+    cache.getOrCompute(AnalysisType::Prob01, allStates, thirdTarget, compute);
+    EXPECT_EQ(5ull, numberOfComputations);
+}
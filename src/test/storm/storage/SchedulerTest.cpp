@@ -50,3 +50,27 @@ TEST(SchedulerTest, PartialDeterministicMemorylessScheduler) {
     ASSERT_FALSE(scheduler.getChoice(1).isDefined());
     ASSERT_FALSE(scheduler.getChoice(2).isDefined());
 }
+
+TEST(SchedulerTest, RandomizedChoiceAfterDeterministicChoices) {
+    storm::storage::Scheduler<double> scheduler(3);
+
+    ASSERT_NO_THROW(scheduler.setChoice(2, 0));
+    ASSERT_NO_THROW(scheduler.setChoice(1, 1));
+    ASSERT_TRUE(scheduler.isDeterministicScheduler());
+
+    storm::storage::Distribution<double, uint_fast64_t> distribution;
+    distribution.addProbability(0, 0.25);
+    distribution.addProbability(1, 0.75);
+    ASSERT_NO_THROW(scheduler.setChoice(distribution, 2));
+
+    ASSERT_FALSE(scheduler.isPartialScheduler());
+    ASSERT_FALSE(scheduler.isDeterministicScheduler());
+    ASSERT_EQ(2ul, scheduler.getChoice(0).getDeterministicChoice());
+    ASSERT_EQ(1ul, scheduler.getChoice(1).getDeterministicChoice());
+    ASSERT_FALSE(scheduler.getChoice(2).isDeterministic());
+    ASSERT_EQ(0.75, scheduler.getChoice(2).getChoiceAsDistribution().getProbability(1));
+
+    ASSERT_NO_THROW(scheduler.setChoice(0, 2));
+    ASSERT_TRUE(scheduler.isDeterministicScheduler());
+    ASSERT_EQ(0ul, scheduler.getChoice(2).getDeterministicChoice());
+}
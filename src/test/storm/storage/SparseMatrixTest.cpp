@@ -3,6 +3,7 @@
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SplitSparseMatrix.h"
 #include "storm/utility/permutation.h"
 #include "test/storm_gtest.h"
 
@@ -486,6 +487,24 @@ TEST(SparseMatrix, Submatrix) {
     ASSERT_NO_THROW(matrix5 = matrixBuilder5.build());
 
     ASSERT_TRUE(matrix4 == matrix5);
+
+    storm::storage::BitVector allRowGroups(4, true);
+    storm::storage::BitVector allRows(5, true);
+    storm::storage::BitVector allColumns(4, true);
+    EXPECT_TRUE(matrix == matrix.getSubmatrix(true, allRowGroups, allColumns));
+    EXPECT_TRUE(matrix == matrix.getSubmatrix(false, allRows, allColumns));
+
+    // Empty row groups are dropped if the row constraint is interpreted over the rows, even if all rows are kept.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder6(2, 3, 2, true, true, 3);
+    ASSERT_NO_THROW(matrixBuilder6.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder6.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder6.newRowGroup(1));
+    ASSERT_NO_THROW(matrixBuilder6.newRowGroup(1));
+    ASSERT_NO_THROW(matrixBuilder6.addNextValue(1, 0, 1.0));
+    storm::storage::SparseMatrix<double> matrix6;
+    ASSERT_NO_THROW(matrix6 = matrixBuilder6.build());
+    EXPECT_EQ(3ul, matrix6.getSubmatrix(true, storm::storage::BitVector(3, true), storm::storage::BitVector(3, true)).getRowGroupCount());
+    EXPECT_EQ(2ul, matrix6.getSubmatrix(false, storm::storage::BitVector(2, true), storm::storage::BitVector(3, true)).getRowGroupCount());
 }
 
 TEST(SparseMatrix, RestrictRows) {
@@ -979,4 +998,57 @@ TEST(SparseMatrix, DropZeroEntries) {
 
     ASSERT_TRUE(matrixX == matrix4);
     ASSERT_FALSE(matrixX.getEntryCount() == matrix4.getEntryCount());
-}
\ No newline at end of file
+}
+TEST(SparseMatrix, SplitStorage) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9, true, true, 3);
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 1.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 1, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 2, 1.1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 0, 0.1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 1, 0.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 3, 0.3));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    ASSERT_TRUE(storm::storage::SplitSparseMatrix<double, uint32_t>::fitsColumnIndexType(matrix));
+    storm::storage::SplitSparseMatrix<double, uint32_t> splitMatrix(matrix);
+    EXPECT_EQ(matrix.getRowCount(), splitMatrix.getRowCount());
+    EXPECT_EQ(matrix.getColumnCount(), splitMatrix.getColumnCount());
+    EXPECT_EQ(matrix.getEntryCount(), splitMatrix.getEntryCount());
+
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        auto entryIt = matrix.begin(row);
+        for (auto const& entry : splitMatrix.getRow(row)) {
+            ASSERT_TRUE(entryIt != matrix.end(row));
+            EXPECT_EQ(entryIt->getColumn(), entry.getColumn());
+            EXPECT_EQ(entryIt->getValue(), entry.getValue());
+            ++entryIt;
+        }
+        EXPECT_TRUE(entryIt == matrix.end(row));
+    }
+
+    std::vector<double> x = {1, 0.3, 1.4, 7.1};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5};
+    std::vector<double> result(matrix.getRowCount());
+    std::vector<double> splitResult(matrix.getRowCount());
+    matrix.multiplyWithVector(x, result, &b);
+    ASSERT_NO_THROW(splitMatrix.multiplyWithVector(x, splitResult, &b));
+    EXPECT_EQ(result, splitResult);
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> reducedResult(matrix.getRowGroupCount());
+        std::vector<double> splitReducedResult(matrix.getRowGroupCount());
+        std::vector<uint64_t> choices(matrix.getRowGroupCount(), 0);
+        std::vector<uint64_t> splitChoices(matrix.getRowGroupCount(), 0);
+        matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, nullptr, reducedResult, &choices);
+        ASSERT_NO_THROW(splitMatrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, nullptr, splitReducedResult, &splitChoices));
+        EXPECT_EQ(reducedResult, splitReducedResult);
+        EXPECT_EQ(choices, splitChoices);
+    }
+}
@@ -0,0 +1,57 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <limits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/StateValuations.h"
+
+TEST(StateValuationsTest, BuildSelectAndBlowup) {
+    storm::expressions::ExpressionManager manager;
+    auto b = manager.declareBooleanVariable("b");
+    auto x = manager.declareIntegerVariable("x");
+    auto y = manager.declareIntegerVariable("y");
+    auto r = manager.declareRationalVariable("r");
+
+    storm::storage::sparse::StateValuationsBuilder builder;
+    builder.addVariable(b);
+    builder.addVariable(x);
+    builder.addVariable(y);
+    builder.addVariable(r);
+    // States are added out of order and state 2 gets no valuation.
+    builder.addState(3, {true}, {-5, std::numeric_limits<int64_t>::max()}, {storm::RationalNumber(1) / storm::RationalNumber(3)});
+    builder.addState(0, {false}, {7, std::numeric_limits<int64_t>::min()}, {storm::RationalNumber(2)});
+    builder.addState(1, {true}, {7, 0}, {storm::RationalNumber(0)});
+    auto valuations = builder.build();
+
+    ASSERT_EQ(4ull, valuations.getNumberOfStates());
+    EXPECT_FALSE(valuations.isEmpty(0));
+    EXPECT_TRUE(valuations.isEmpty(2));
+    EXPECT_FALSE(valuations.getBooleanValue(0, b));
+    EXPECT_TRUE(valuations.getBooleanValue(3, b));
+    EXPECT_EQ(7, valuations.getIntegerValue(0, x));
+    EXPECT_EQ(7, valuations.getIntegerValue(1, x));
+    EXPECT_EQ(-5, valuations.getIntegerValue(3, x));
+    EXPECT_EQ(std::numeric_limits<int64_t>::min(), valuations.getIntegerValue(0, y));
+    EXPECT_EQ(0, valuations.getIntegerValue(1, y));
+    EXPECT_EQ(std::numeric_limits<int64_t>::max(), valuations.getIntegerValue(3, y));
+    EXPECT_EQ(storm::RationalNumber(1) / storm::RationalNumber(3), valuations.getRationalValue(3, r));
+
+    storm::storage::BitVector selectedStates(4, false);
+    selectedStates.set(1);
+    selectedStates.set(3);
+    auto selected = valuations.selectStates(selectedStates);
+    ASSERT_EQ(2ull, selected.getNumberOfStates());
+    EXPECT_EQ(valuations.toString(1), selected.toString(0));
+    EXPECT_EQ(valuations.toString(3), selected.toString(1));
+
+    auto blownUp = valuations.blowup({3, 3, 0});
+    ASSERT_EQ(3ull, blownUp.getNumberOfStates());
+    EXPECT_EQ(-5, blownUp.getIntegerValue(1, x));
+    EXPECT_EQ(valuations.toString(0), blownUp.toString(2));
+
+    auto withInvalid = valuations.selectStates(std::vector<storm::storage::sparse::state_type>({0, 17}));
+    EXPECT_FALSE(withInvalid.isEmpty(0));
+    EXPECT_TRUE(withInvalid.isEmpty(1));
+}
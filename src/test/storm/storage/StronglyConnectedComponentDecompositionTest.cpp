@@ -1,4 +1,9 @@
 #include "storm-config.h"
+
+#include <map>
+#include <random>
+#include <set>
+
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -90,3 +95,86 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+namespace {
+
+// Maps each state of the given decomposition to the smallest state of its SCC and the depth of its SCC.
+std::map<uint64_t, std::pair<uint64_t, uint64_t>> getCanonicalSccs(storm::storage::StronglyConnectedComponentDecomposition<double> const& decomposition) {
+    std::map<uint64_t, std::pair<uint64_t, uint64_t>> result;
+    for (uint64_t sccIndex = 0; sccIndex < decomposition.size(); ++sccIndex) {
+        auto const& scc = decomposition.getBlock(sccIndex);
+        uint64_t smallestState = *std::min_element(scc.begin(), scc.end());
+        for (auto state : scc) {
+            result[state] = {smallestState, decomposition.getSccDepth(sccIndex)};
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(StronglyConnectedComponentDecomposition, ParallelSystemFromMatrix) {
+    // Build a large system with many small and some large SCCs such that the parallel algorithm is used.
+    uint64_t const numberOfStates = 150000;
+    std::mt19937 generator(42);
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfStates, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        matrixBuilder.newRowGroup(row);
+        uint64_t const numberOfChoices = 1 + generator() % 2;
+        for (uint64_t choice = 0; choice < numberOfChoices; ++choice, ++row) {
+            std::set<uint64_t> successors = {std::min(numberOfStates - 1, state + generator() % 4)};
+            if (generator() % 4 == 0) {
+                successors.insert(state >= 10 ? state - generator() % 10 : 0);
+            }
+            if (generator() % 20 == 0) {
+                successors.insert(generator() % numberOfStates);
+            }
+            for (auto successor : successors) {
+                matrixBuilder.addNextValue(row, successor, 1.0 / successors.size());
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    storm::storage::BitVector subsystem(numberOfStates, true);
+    for (uint64_t state = 0; state < numberOfStates; state += 7) {
+        subsystem.set(state, false);
+    }
+
+    for (bool useSubsystem : {false, true}) {
+        storm::storage::StronglyConnectedComponentDecompositionOptions options;
+        options.computeSccDepths();
+        if (useSubsystem) {
+            options.subsystem(subsystem);
+        }
+        storm::storage::StronglyConnectedComponentDecomposition<double> sequentialDecomposition(matrix, options.numberOfThreads(1));
+        storm::storage::StronglyConnectedComponentDecomposition<double> parallelDecomposition(matrix, options.numberOfThreads(4));
+        ASSERT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+        EXPECT_EQ(getCanonicalSccs(sequentialDecomposition), getCanonicalSccs(parallelDecomposition));
+
+        // The SCCs are sorted in reverse topological order.
+        std::vector<uint64_t> stateToSccIndex(numberOfStates);
+        for (uint64_t sccIndex = 0; sccIndex < parallelDecomposition.size(); ++sccIndex) {
+            for (auto state : parallelDecomposition.getBlock(sccIndex)) {
+                stateToSccIndex[state] = sccIndex;
+            }
+        }
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (useSubsystem && !subsystem.get(state)) {
+                continue;
+            }
+            for (auto const& entry : matrix.getRowGroup(state)) {
+                if (!useSubsystem || subsystem.get(entry.getColumn())) {
+                    EXPECT_LE(stateToSccIndex[entry.getColumn()], stateToSccIndex[state]);
+                }
+            }
+        }
+
+        options.dropNaiveSccs().onlyBottomSccs();
+        sequentialDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options.numberOfThreads(1));
+        parallelDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options.numberOfThreads(4));
+        ASSERT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+        EXPECT_EQ(getCanonicalSccs(sequentialDecomposition), getCanonicalSccs(parallelDecomposition));
+    }
+}
@@ -9,9 +9,13 @@
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/dd/BisimulationDecomposition.h"
 
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/helper/PartialBisimulationDtmcPrctlHelper.h"
 #include "storm/modelchecker/results/CheckResult.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
@@ -159,6 +163,48 @@ TEST(SymbolicModelBisimulationDecomposition, DiePartialQuotient_Cudd) {
     EXPECT_NEAR(resultBounds.first, static_cast<double>(1) / 6, 1e-6);
 }
 
+TEST(SymbolicModelBisimulationDecomposition, DieSparsePartialQuotient_Cudd) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> model =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD, double>().build(program);
+
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"one\"]");
+    std::shared_ptr<storm::logic::Formula const> minFormula = formulaParser.parseSingleFormulaFromString("Pmin=? [F \"one\"]");
+    std::shared_ptr<storm::logic::Formula const> maxFormula = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"one\"]");
+
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {formula};
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::CUDD, double> decomposition(*model, formulas, storm::storage::BisimulationType::Strong);
+    decomposition.compute(1);
+    ASSERT_FALSE(decomposition.getReachedFixedPoint());
+
+    std::shared_ptr<storm::models::Model<double>> quotient = decomposition.getQuotient(storm::dd::bisimulation::QuotientFormat::Sparse);
+    ASSERT_EQ(storm::models::ModelType::Mdp, quotient->getType());
+    ASSERT_TRUE(quotient->isSparseModel());
+    std::shared_ptr<storm::models::sparse::Mdp<double>> quotientMdp = quotient->as<storm::models::sparse::Mdp<double>>();
+    // Choices of states of the same block that agree in the quotient are merged.
+    EXPECT_LT(quotientMdp->getNumberOfChoices(), model->getNumberOfStates());
+
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*quotientMdp);
+    storm::modelchecker::ExplicitQualitativeCheckResult initialStates(quotientMdp->getInitialStates());
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(*minFormula);
+    result->filter(initialStates);
+    double lowerBound = result->asQuantitativeCheckResult<double>().getMin();
+    result = checker.check(*maxFormula);
+    result->filter(initialStates);
+    double upperBound = result->asQuantitativeCheckResult<double>().getMax();
+    EXPECT_LE(lowerBound, 1.0 / 6 + 1e-6);
+    EXPECT_GE(upperBound, 1.0 / 6 - 1e-6);
+
+    // Checking with a budget of zero refines the partition by one step per round until the bounds meet.
+    storm::Environment env;
+    result = storm::modelchecker::helper::PartialBisimulationDtmcPrctlHelper<storm::dd::DdType::CUDD, double>::compute(
+        env, *model->as<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>>(),
+        storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula, true), std::chrono::milliseconds(0));
+    EXPECT_NEAR(1.0 / 6, result->asQuantitativeCheckResult<double>().getMin(), 1e-6);
+}
+
 TEST(SymbolicModelBisimulationDecomposition, Die_Sylvan) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
 
@@ -3,6 +3,7 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/api/storm.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/transformer/StatePermuter.h"
 #include "storm/utility/permutation.h"
 #include "test/storm_gtest.h"
@@ -44,6 +45,23 @@ void testStatePermuter(std::string const& prismModelFile, std::string const& for
     EXPECT_EQ(permutedModel->getNumberOfStates() - 1, *permutedModel->getInitialStates().begin()) << "Failed for model " << prismModelFile;
     permutedModel = checkOrder(storm::utility::permutation::OrderKind::ReverseBfs);
     EXPECT_EQ(permutedModel->getNumberOfStates() - 1, *permutedModel->getInitialStates().begin()) << "Failed for model " << prismModelFile;
+    checkOrder(storm::utility::permutation::OrderKind::ReverseCuthillMcKee);
+    permutedModel = checkOrder(storm::utility::permutation::OrderKind::Topological);
+    // Transitions that leave a strongly connected component lead to states with larger indices.
+    auto const sccs = storm::storage::StronglyConnectedComponentDecomposition<double>(permutedModel->getTransitionMatrix());
+    std::vector<uint64_t> stateToScc(permutedModel->getNumberOfStates());
+    for (uint64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+        for (auto state : sccs.getBlock(sccIndex)) {
+            stateToScc[state] = sccIndex;
+        }
+    }
+    for (uint64_t state = 0; state < permutedModel->getNumberOfStates(); ++state) {
+        for (auto const& entry : permutedModel->getTransitionMatrix().getRowGroup(state)) {
+            if (stateToScc[entry.getColumn()] != stateToScc[state]) {
+                EXPECT_LT(state, entry.getColumn()) << "Failed for model " << prismModelFile;
+            }
+        }
+    }
 }
 TEST(StatePermuterTest, BrpTest) {
     testStatePermuter(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", "P=? [ F \"target\"]");
@@ -0,0 +1,63 @@
+#include "test/storm_gtest.h"
+
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/transformer/SubsystemBuilder.h"
+
+namespace {
+
+storm::storage::SparseMatrix<double> buildMatrix(double scaling) {
+    storm::storage::SparseMatrixBuilder<double> builder(5, 4, 6, true, true, 4);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 0.5 * scaling);
+    builder.addNextValue(0, 2, 0.5 * scaling);
+    builder.addNextValue(1, 3, scaling);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 1, scaling);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 3, scaling);
+    builder.newRowGroup(4);
+    builder.addNextValue(4, 3, scaling);
+    return builder.build();
+}
+
+}  // namespace
+
+TEST(SubsystemBuilderTest, DeadlocksAndTransitionRewards) {
+    storm::models::sparse::StateLabeling labeling(4);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<double>> rewardModels;
+    rewardModels.emplace("rew", storm::models::sparse::StandardRewardModel<double>(std::nullopt, std::nullopt, buildMatrix(2.0)));
+    storm::models::sparse::Mdp<double> mdp(buildMatrix(1.0), labeling, rewardModels);
+
+    // Removing state 3 removes the second choice of state 0 and the only choice of state 2, which is then fixed by a selfloop.
+    storm::storage::BitVector subsystemStates(4, true);
+    subsystemStates.set(3, false);
+    storm::transformer::SubsystemBuilderOptions options;
+    options.fixDeadlocks = true;
+    options.buildActionMapping = true;
+    auto result = storm::transformer::buildSubsystem(mdp, subsystemStates, storm::storage::BitVector(5, true), true, options);
+
+    storm::storage::SparseMatrixBuilder<double> expectedBuilder(3, 3, 4, true, true, 3);
+    expectedBuilder.newRowGroup(0);
+    expectedBuilder.addNextValue(0, 1, 0.5);
+    expectedBuilder.addNextValue(0, 2, 0.5);
+    expectedBuilder.newRowGroup(1);
+    expectedBuilder.addNextValue(1, 1, 1.0);
+    expectedBuilder.newRowGroup(2);
+    expectedBuilder.addNextValue(2, 2, 1.0);
+    EXPECT_EQ(expectedBuilder.build(), result.model->getTransitionMatrix());
+
+    EXPECT_EQ(std::vector<uint_fast64_t>({0, 1, 2}), result.newToOldStateIndexMapping);
+    EXPECT_EQ(std::vector<uint64_t>({0, 2, std::numeric_limits<uint64_t>::max()}), result.newToOldActionIndexMapping);
+    EXPECT_EQ(std::vector<uint_fast64_t>({0, 2}), std::vector<uint_fast64_t>(result.keptActions.begin(), result.keptActions.end()));
+    ASSERT_TRUE(result.deadlockLabel.is_initialized());
+    EXPECT_TRUE(result.model->getStateLabeling().getStateHasLabel(result.deadlockLabel.get(), 2));
+
+    auto const& transitionRewards = result.model->getRewardModel("rew").getTransitionRewardMatrix();
+    EXPECT_EQ(3ull, transitionRewards.getRowCount());
+    EXPECT_EQ(3ull, transitionRewards.getEntryCount());
+    EXPECT_EQ(0ull, transitionRewards.getRow(2).getNumberOfEntries());
+    EXPECT_EQ(2.0, transitionRewards.getRow(1).begin()->getValue());
+}
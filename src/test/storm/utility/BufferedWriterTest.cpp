@@ -0,0 +1,37 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <limits>
+#include <sstream>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/io/BufferedWriter.h"
+
+namespace {
+template<typename Stream>
+void writeValues(Stream& stream) {
+    for (int64_t i = -20; i < 200; ++i) {
+        stream << "state " << static_cast<uint64_t>(i * i) << ' ' << i << " : " << 1.0 / (i == 0 ? 7 : i) << '\n';
+    }
+    stream << std::string("rational ") << storm::utility::convertNumber<storm::RationalNumber>(std::string("1/3")) << '\n';
+    stream << std::numeric_limits<int64_t>::min() << ' ' << std::numeric_limits<uint64_t>::max() << ' ' << 1e-300 << ' ' << 0.0 << '\n';
+}
+}  // namespace
+
+TEST(BufferedWriterTest, SameOutputAsStream) {
+    std::stringstream expected;
+    expected.precision(10);
+    writeValues(expected);
+
+    for (bool asynchronous : {false, true}) {
+        std::stringstream actual;
+        actual.precision(10);
+        {
+            // Use a small buffer such that it is written several times
+            storm::exporter::BufferedWriter writer(actual, 100, asynchronous);
+            writeValues(writer);
+            writer.flush();
+        }
+        EXPECT_EQ(expected.str(), actual.str());
+    }
+}
@@ -1,6 +1,9 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <random>
+#include <set>
+
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdPrismModelBuilder.h"
 #include "storm/builder/ExplicitModelBuilder.h"
@@ -14,6 +17,7 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/utility/LevelSynchronousBackwardSearch.h"
 #include "storm/utility/graph.h"
 
 TEST(GraphTest, SymbolicProb01_Cudd) {
@@ -329,3 +333,56 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST(GraphTest, ExplicitLevelSynchronousBackwardSearch) {
+    // Build a system that is large enough such that levels are expanded with multiple threads and bottom-up.
+    uint64_t const numberOfStates = 60000;
+    std::mt19937 generator(42);
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfStates, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        matrixBuilder.newRowGroup(row);
+        uint64_t const numberOfChoices = 1 + generator() % 2;
+        for (uint64_t choice = 0; choice < numberOfChoices; ++choice, ++row) {
+            std::set<uint64_t> successors = {(state + 1 + generator() % 5) % numberOfStates};
+            if (generator() % 4 == 0) {
+                successors.insert(generator() % numberOfStates);
+            }
+            for (auto successor : successors) {
+                matrixBuilder.addNextValue(row, successor, 1.0 / successors.size());
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> transitionMatrix = matrixBuilder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = transitionMatrix.transpose(true);
+    storm::storage::BitVector phiStates(numberOfStates), psiStates(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        phiStates.set(state, generator() % 10 != 0);
+        psiStates.set(state, generator() % 6 == 0);
+    }
+
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    auto allChoicesHaveReachedSuccessor = [&](uint64_t state, storm::storage::BitVector const& reachedStates) {
+        for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+            auto successors = transitionMatrix.getRow(row);
+            if (std::none_of(successors.begin(), successors.end(), [&](auto const& entry) { return reachedStates.get(entry.getColumn()); })) {
+                return false;
+            }
+        }
+        return true;
+    };
+    for (std::optional<uint64_t> maximalSteps : {std::optional<uint64_t>(), std::optional<uint64_t>(2)}) {
+        storm::storage::BitVector expected = storm::utility::graph::performProbGreater0A(
+            transitionMatrix, rowGroupIndices, backwardTransitions, phiStates, psiStates, maximalSteps.has_value(), maximalSteps.value_or(0));
+        for (uint64_t numberOfThreads : {1, 4}) {
+            storm::utility::graph::LevelSynchronousBackwardSearch<double> search(backwardTransitions, numberOfThreads);
+            for (bool allowBottomUp : {false, true}) {
+                EXPECT_EQ(expected, search.search(phiStates, psiStates, allChoicesHaveReachedSuccessor, allowBottomUp, maximalSteps));
+            }
+        }
+    }
+
+    storm::storage::BitVector expected = storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates);
+    storm::utility::graph::LevelSynchronousBackwardSearch<double> search(backwardTransitions, 4);
+    EXPECT_EQ(expected, search.search(phiStates, psiStates, [](uint64_t, storm::storage::BitVector const&) { return true; }, false));
+}
@@ -0,0 +1,55 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sstream>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/io/JsonWriter.h"
+
+TEST(JsonWriterTest, SameOutputAsDumpJson) {
+    storm::json<storm::RationalNumber> valuation;
+    valuation["x"] = 3;
+    valuation["flag"] = true;
+    valuation["y"] = storm::utility::convertNumber<storm::RationalNumber>(std::string("1/4"));
+
+    storm::json<storm::RationalNumber> expected;
+    for (uint64_t state = 0; state < 3; ++state) {
+        storm::json<storm::RationalNumber> entry;
+        entry["c"] = std::vector<storm::json<storm::RationalNumber>>();
+        if (state != 1) {
+            storm::json<storm::RationalNumber> choice;
+            choice["index"] = state;
+            choice["labels"] = std::vector<std::string>({"a\"b", "tab\t"});
+            choice["prob"] = storm::utility::convertNumber<storm::RationalNumber>(std::string("1/2"));
+            entry["c"].push_back(std::move(choice));
+        }
+        entry["e"] = storm::json<storm::RationalNumber>::object();
+        entry["s"] = valuation;
+        expected.push_back(std::move(entry));
+    }
+
+    for (bool compact : {false, true}) {
+        std::stringstream actual;
+        storm::exporter::JsonWriter writer(actual, compact);
+        writer.beginArray();
+        for (uint64_t state = 0; state < 3; ++state) {
+            writer.beginObject();
+            writer.key("c").beginArray();
+            if (state != 1) {
+                writer.beginObject();
+                writer.key("index").value(state);
+                writer.key("labels").beginArray().value("a\"b").value(std::string("tab\t")).endArray();
+                writer.key("prob").value(storm::utility::convertNumber<storm::RationalNumber>(std::string("1/2")));
+                writer.endObject();
+            }
+            writer.endArray();
+            writer.key("e").beginObject().endObject();
+            writer.key("s").value(valuation);
+            writer.endObject();
+        }
+        writer.endArray();
+        writer.flush();
+        EXPECT_EQ(storm::dumpJson(expected, compact), actual.str());
+    }
+}
@@ -0,0 +1,57 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/util/ModelBuildCache.h"
+#include "storm/api/builder.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+std::string getCacheDirectory(std::string const& name) {
+    return (boost::filesystem::temp_directory_path() / ("storm-build-cache-test-" + name)).string();
+}
+
+}  // namespace
+
+TEST(ModelBuildCacheTest, StoreAndLoad) {
+    storm::storage::SymbolicModelDescription description(storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm"));
+    storm::builder::BuilderOptions options(true, true);
+    auto model = storm::api::buildSparseModel<double>(description, options);
+
+    storm::utility::ModelBuildCache cache(getCacheDirectory("store"), 1024 * 1024 * 1024);
+    cache.clear();
+    std::string key = storm::utility::ModelBuildCache::computeKey(description, options);
+    EXPECT_EQ(nullptr, cache.load(key));
+    EXPECT_TRUE(cache.store(key, model));
+
+    auto loadedModel = cache.load(key);
+    ASSERT_NE(nullptr, loadedModel);
+    EXPECT_EQ(model->getTransitionMatrix(), loadedModel->getTransitionMatrix());
+    EXPECT_EQ(model->getStateLabeling(), loadedModel->getStateLabeling());
+    EXPECT_EQ(model->getNumberOfRewardModels(), loadedModel->getNumberOfRewardModels());
+
+    // Different options or a different model must not hit the entry.
+    storm::builder::BuilderOptions otherOptions(true, true);
+    otherOptions.setBuildChoiceLabels();
+    EXPECT_NE(key, storm::utility::ModelBuildCache::computeKey(description, otherOptions));
+    EXPECT_EQ(nullptr, cache.load(storm::utility::ModelBuildCache::computeKey(description, otherOptions)));
+    EXPECT_EQ(nullptr, cache.load(storm::utility::ModelBuildCache::computeKey(description, options, "other")));
+    storm::storage::SymbolicModelDescription otherDescription(storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm"));
+    EXPECT_NE(key, storm::utility::ModelBuildCache::computeKey(otherDescription.preprocess(), options));
+    cache.clear();
+    EXPECT_EQ(nullptr, cache.load(key));
+}
+
+TEST(ModelBuildCacheTest, SizeLimit) {
+    storm::storage::SymbolicModelDescription description(storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm"));
+    storm::builder::BuilderOptions options(true, true);
+    auto model = storm::api::buildSparseModel<double>(description, options);
+
+    // The limit is too small for any model, so entries are evicted immediately.
+    storm::utility::ModelBuildCache cache(getCacheDirectory("limit"), 1);
+    cache.clear();
+    std::string key = storm::utility::ModelBuildCache::computeKey(description, options);
+    EXPECT_TRUE(cache.store(key, model));
+    EXPECT_EQ(nullptr, cache.load(key));
+}
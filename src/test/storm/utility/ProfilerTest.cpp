@@ -0,0 +1,44 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/utility/Profiler.h"
+
+TEST(ProfilerTest, NestedPhases) {
+    auto& profiler = storm::utility::Profiler::getInstance();
+    profiler.clear();
+    profiler.setEnabled(true);
+    {
+        storm::utility::ProfilerPhase outer("outer");
+        outer.addCounter("states", 10);
+        {
+            storm::utility::ProfilerPhase inner("inner");
+            profiler.addCounter("iterations", 3);
+            profiler.addCounter("iterations", 4);
+        }
+        outer.addCounter("states", 5);
+    }
+    profiler.setEnabled(false);
+    {
+        // Phases are not recorded if the profiler is disabled.
+        storm::utility::ProfilerPhase ignored("ignored");
+    }
+
+    auto phases = profiler.getPhases();
+    ASSERT_EQ(2ull, phases.size());
+    EXPECT_EQ("outer", phases[0].name);
+    EXPECT_EQ(0ull, phases[0].depth);
+    EXPECT_TRUE(phases[0].finished);
+    EXPECT_EQ(15ull, phases[0].counters.at("states"));
+    EXPECT_EQ("inner", phases[1].name);
+    EXPECT_EQ(1ull, phases[1].depth);
+    EXPECT_EQ(7ull, phases[1].counters.at("iterations"));
+    EXPECT_LE(phases[0].startMicroseconds, phases[1].startMicroseconds);
+    EXPECT_LE(phases[1].wallMicroseconds, phases[0].wallMicroseconds);
+
+    auto trace = profiler.toChromeTrace();
+    ASSERT_EQ(2ull, trace["traceEvents"].size());
+    EXPECT_EQ("X", trace["traceEvents"][0]["ph"].get<std::string>());
+    EXPECT_EQ("outer", trace["traceEvents"][0]["name"].get<std::string>());
+    EXPECT_EQ(7ull, trace["traceEvents"][1]["args"]["iterations"].get<uint64_t>());
+    profiler.clear();
+}
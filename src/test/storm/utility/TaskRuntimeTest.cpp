@@ -0,0 +1,73 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/TaskRuntime.h"
+#include "storm/utility/parallel.h"
+
+TEST(TaskRuntimeTest, TaskGroup) {
+    std::vector<uint64_t> values(100, 0);
+    storm::utility::parallel::TaskGroup group;
+    for (uint64_t index = 0; index < values.size(); ++index) {
+        group.run([&values, index]() { values[index] = index; });
+    }
+    group.wait();
+    for (uint64_t index = 0; index < values.size(); ++index) {
+        EXPECT_EQ(index, values[index]);
+    }
+    EXPECT_GE(storm::utility::parallel::TaskRuntime::runtime().getNumberOfWorkers(), 1ull);
+
+    // The group can be reused after waiting and rethrows the exception of a task.
+    group.run([]() { throw std::runtime_error("failure"); });
+    EXPECT_THROW(group.wait(), std::runtime_error);
+
+    // Tasks of a cancelled group are skipped.
+    std::atomic<uint64_t> executed(0);
+    group.cancel();
+    group.run([&executed]() { ++executed; });
+    group.wait();
+    EXPECT_EQ(0ull, executed.load());
+}
+
+TEST(TaskRuntimeTest, NestedChunks) {
+    std::vector<uint64_t> sums(4, 0);
+    storm::utility::parallel::forEachChunk(4, 0ull, 4ull, [&sums](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t outer = begin; outer < end; ++outer) {
+            std::vector<uint64_t> values(1000);
+            storm::utility::parallel::forEachChunk(3, 0ull, 1000ull, [&values, outer](uint64_t, uint64_t innerBegin, uint64_t innerEnd) {
+                for (uint64_t inner = innerBegin; inner < innerEnd; ++inner) {
+                    values[inner] = outer + inner;
+                }
+            });
+            sums[outer] = std::accumulate(values.begin(), values.end(), 0ull);
+        }
+    });
+    for (uint64_t outer = 0; outer < sums.size(); ++outer) {
+        EXPECT_EQ(1000 * outer + 499500, sums[outer]);
+    }
+}
+
+TEST(TaskRuntimeTest, ThreadTimeout) {
+    storm::utility::resources::setThreadTimeout(0);
+    std::atomic<uint64_t> terminated(0);
+    storm::utility::parallel::forEachChunk(4, 0ull, 4ull, [&terminated](uint64_t, uint64_t, uint64_t) {
+        if (storm::utility::resources::isTerminate()) {
+            ++terminated;
+        }
+    });
+    storm::utility::resources::resetThreadTimeout();
+    EXPECT_EQ(4ull, terminated.load());
+
+    // Without timeout, the workers do not terminate.
+    terminated = 0;
+    storm::utility::parallel::forEachChunk(4, 0ull, 4ull, [&terminated](uint64_t, uint64_t, uint64_t) {
+        if (storm::utility::resources::isTerminate()) {
+            ++terminated;
+        }
+    });
+    EXPECT_EQ(0ull, terminated.load());
+}
@@ -48,4 +48,75 @@ TEST(VectorTest, grouped_inverse_permute) {
     std::vector<double> aperm = storm::utility::vector::applyInversePermutationToGroupedVector(inversePermutation, a, groupIndices);
     std::vector<double> expected = {4.0, 5.0, 1.0, 2.0, 3.0};
     EXPECT_EQ(aperm, expected);
-}
\ No newline at end of file
+}
+TEST(VectorTest, apply_and_check_convergence) {
+    std::vector<double> a = {1.0, 2.0, 4.0};
+    std::vector<double> b = {0.5, 0.5, 0.5};
+    std::vector<double> reference = {0.5, 1.0, 2.0};
+    std::vector<double> target(3);
+    EXPECT_TRUE(storm::utility::vector::applyPointwiseAndCheckConvergence(a, b, target, reference, 1e-6, false, std::multiplies<>()));
+    EXPECT_EQ(reference, target);
+    reference[2] = 2.1;
+    EXPECT_FALSE(storm::utility::vector::applyPointwiseAndCheckConvergence(a, b, target, reference, 1e-6, false, std::multiplies<>()));
+    EXPECT_NEAR(0.1, storm::utility::vector::applyPointwiseAndComputeMaximalDifference(a, b, target, reference, std::multiplies<>()), 1e-12);
+    EXPECT_EQ(2.0, target[2]);
+}
+
+TEST(VectorTest, parallel_operations) {
+    auto& runtime = storm::utility::parallel::TaskRuntime::runtime();
+    uint64_t const numberOfThreads = runtime.getNumberOfThreads();
+    runtime.setNumberOfThreads(4);
+    uint64_t const size = 4 * storm::utility::vector::minimalNumberOfElementsPerThread + 3;
+    ASSERT_EQ(4ull, storm::utility::vector::getNumberOfThreadsForVector<double>(size));
+
+    std::vector<double> a(size), b(size, 1.0), target(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        a[i] = static_cast<double>(i);
+    }
+    storm::utility::vector::addVectors(a, b, target);
+    EXPECT_EQ(1.0, target.front());
+    EXPECT_EQ(static_cast<double>(size), target.back());
+
+    // Only the last element differs, so the other threads find no difference.
+    std::vector<double> reference = a;
+    reference.back() += 1.0;
+    EXPECT_FALSE(storm::utility::vector::equalModuloPrecision(a, reference, 1e-6, false));
+    reference.back() = a.back();
+    EXPECT_TRUE(storm::utility::vector::equalModuloPrecision(a, reference, 1e-6, false));
+    reference.back() += 2.0;
+    EXPECT_FALSE(storm::utility::vector::applyPointwiseAndCheckConvergence(a, b, target, reference, 1e-6, false, std::multiplies<>()));
+    EXPECT_EQ(2.0, storm::utility::vector::applyPointwiseAndComputeMaximalDifference(a, b, target, reference, std::multiplies<>()));
+    EXPECT_EQ(a, target);
+
+    // Groups of size one to three, where the values of each group decrease.
+    std::vector<uint_fast64_t> rowGrouping = {0};
+    while (rowGrouping.back() < size) {
+        rowGrouping.push_back(std::min<uint_fast64_t>(size, rowGrouping.back() + 1 + rowGrouping.size() % 3));
+    }
+    std::vector<double> source(size);
+    for (uint64_t group = 0; group + 1 < rowGrouping.size(); ++group) {
+        for (uint64_t row = rowGrouping[group]; row < rowGrouping[group + 1]; ++row) {
+            source[row] = static_cast<double>(group) - static_cast<double>(row - rowGrouping[group]);
+        }
+    }
+    std::vector<double> reduced(rowGrouping.size() - 1);
+    std::vector<uint_fast64_t> choices(reduced.size(), 0);
+    storm::utility::vector::reduceVectorMinOrMax(storm::solver::OptimizationDirection::Minimize, source, reduced, rowGrouping, &choices);
+    for (uint64_t group = 0; group < reduced.size(); ++group) {
+        uint64_t const groupSize = rowGrouping[group + 1] - rowGrouping[group];
+        EXPECT_EQ(static_cast<double>(group) - static_cast<double>(groupSize - 1), reduced[group]);
+        EXPECT_EQ(groupSize - 1, choices[group]);
+    }
+
+    storm::storage::BitVector positions(size);
+    for (uint64_t i = 0; i < size; i += 3) {
+        positions.set(i);
+    }
+    std::vector<double> selected(positions.getNumberOfSetBits());
+    storm::utility::vector::selectVectorValues(selected, positions, a);
+    for (uint64_t i = 0; i < selected.size(); ++i) {
+        EXPECT_EQ(static_cast<double>(3 * i), selected[i]);
+    }
+
+    runtime.setNumberOfThreads(numberOfThreads);
+}